@@ -0,0 +1,207 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/buffered_inserter.hpp
+/// @brief @copybrief storages::clickhouse::BufferedInserter
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+#include <userver/utils/meta.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+/// Settings of storages::clickhouse::BufferedInserter
+struct BufferedInserterSettings final {
+  /// Max number of rows in an insert
+  std::size_t max_batch_rows{100'000};
+
+  /// Max approximate size of the rows of an insert
+  std::size_t max_batch_bytes{16 * 1024 * 1024};
+
+  /// Max time a row waits for its insert to fill up, zero disables the time
+  /// based inserts
+  std::chrono::milliseconds max_batch_delay{1000};
+
+  /// Max number of rows that are buffered or being inserted, pushing waits
+  /// for the inserts above it
+  std::size_t max_buffered_rows{1'000'000};
+
+  /// Max number of inserts executed concurrently
+  std::size_t max_in_flight{2};
+
+  /// Command control of the inserts
+  OptionalCommandControl command_control;
+};
+
+namespace impl {
+
+class BufferedInserterBase {
+ public:
+  BufferedInserterBase(const BufferedInserterBase&) = delete;
+  BufferedInserterBase& operator=(const BufferedInserterBase&) = delete;
+
+  /// Starts an insert of the buffered rows without waiting for it to fill up
+  void Flush();
+
+  /// Inserts the buffered rows and waits for all the inserts
+  void Finish();
+
+  /// Writes the insert statistics
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ protected:
+  using InsertFunc = std::function<void(
+      const Cluster&, OptionalCommandControl, const std::string& table_name,
+      const std::vector<std::string_view>& column_names)>;
+
+  BufferedInserterBase(std::shared_ptr<Cluster> cluster, std::string table_name,
+                       std::vector<std::string> column_names,
+                       BufferedInserterSettings settings);
+  ~BufferedInserterBase();
+
+  /// Takes the space for a row in the buffer, waits for it if `should_wait`
+  bool ReserveRow(bool should_wait);
+
+  /// Accounts a row appended to the buffer under the lock of GetMutex()
+  void OnRowAppended(std::unique_lock<engine::Mutex>& lock, std::size_t bytes);
+
+  /// Takes the buffered rows under the lock of GetMutex()
+  virtual InsertFunc TakeRows() = 0;
+
+  /// Stops the time based inserts, must be called by the derived destructor
+  void StopFlushing();
+
+  engine::Mutex& GetMutex() { return mutex_; }
+
+ private:
+  struct Statistics;
+
+  void SendBuffered(std::unique_lock<engine::Mutex>& lock);
+  void Insert(const InsertFunc& insert, std::size_t rows, std::size_t bytes);
+  void WaitInFlight();
+
+  const std::shared_ptr<Cluster> cluster_;
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_name_views_;
+  const BufferedInserterSettings settings_;
+
+  engine::CancellableSemaphore buffered_rows_semaphore_;
+  engine::Semaphore in_flight_semaphore_;
+
+  engine::Mutex mutex_;
+  std::size_t pending_rows_{0};
+  std::size_t pending_bytes_{0};
+  std::vector<engine::TaskWithResult<void>> in_flight_;
+
+  std::unique_ptr<Statistics> stats_;
+
+  USERVER_NAMESPACE::utils::PeriodicTask flush_task_;
+};
+
+template <typename Row>
+std::size_t EstimateRowBytes(const Row& row) {
+  std::size_t bytes = sizeof(Row);
+  boost::pfr::for_each_field(row, [&bytes](const auto& field) {
+    using Field = std::decay_t<decltype(field)>;
+    if constexpr (std::is_same_v<Field, std::string>) {
+      bytes += field.size();
+    } else if constexpr (meta::kIsVector<Field>) {
+      bytes += field.size() * sizeof(typename Field::value_type);
+    }
+  });
+  return bytes;
+}
+
+}  // namespace impl
+
+/// @brief Buffers the rows pushed from many coroutines and inserts them into
+/// a table in large blocks.
+///
+/// ClickHouse handles a few large inserts much better than many small ones.
+/// The rows are inserted once the buffer has `max_batch_rows` rows or
+/// `max_batch_bytes` of them, or once the first row has waited for
+/// `max_batch_delay`. At most `max_in_flight` inserts are executed at a time.
+///
+/// The number of the rows that are buffered or being inserted is limited by
+/// `max_buffered_rows`: Push() waits for the inserts above it and TryPush()
+/// drops the row. A failed insert is logged and its rows are dropped. The
+/// numbers of the inserted and the dropped rows, the insert timings and the
+/// insert sizes are reported by WriteStatistics().
+///
+/// `Row` is a clickhouse-mapped type, see @ref clickhouse_io and
+/// storages::clickhouse::Cluster::InsertRows. The methods may be called
+/// concurrently. The destructor waits for the inserts in flight but drops the
+/// rows that were not sent, call Finish() to insert them.
+///
+/// ## Example:
+/// @code
+/// storages::clickhouse::BufferedInserter<RequestRow> inserter(
+///     cluster, "requests", {"timestamp", "path", "status"}, {});
+/// inserter.Push(RequestRow{now, path, status});
+/// @endcode
+template <typename Row>
+class BufferedInserter final : public impl::BufferedInserterBase {
+ public:
+  BufferedInserter(std::shared_ptr<Cluster> cluster, std::string table_name,
+                   std::vector<std::string> column_names,
+                   BufferedInserterSettings settings)
+      : BufferedInserterBase(std::move(cluster), std::move(table_name),
+                             std::move(column_names), std::move(settings)) {}
+
+  ~BufferedInserter() { StopFlushing(); }
+
+  /// @brief Appends a row to the buffer, waits for the space in it
+  /// @returns false if the task was cancelled and the row was dropped
+  bool Push(Row row) { return DoPush(std::move(row), true); }
+
+  /// @brief Appends a row to the buffer if there is space in it
+  /// @returns false if the buffer is full and the row was dropped
+  bool TryPush(Row row) { return DoPush(std::move(row), false); }
+
+ private:
+  bool DoPush(Row&& row, bool should_wait) {
+    if (!ReserveRow(should_wait)) return false;
+
+    const auto bytes = impl::EstimateRowBytes(row);
+    std::unique_lock lock(GetMutex());
+    rows_.push_back(std::move(row));
+    OnRowAppended(lock, bytes);
+    return true;
+  }
+
+  InsertFunc TakeRows() override {
+    return [rows = std::exchange(rows_, {})](
+               const Cluster& cluster, OptionalCommandControl command_control,
+               const std::string& table_name,
+               const std::vector<std::string_view>& column_names) {
+      cluster.InsertRows(command_control, table_name, column_names, rows);
+    };
+  }
+
+  std::vector<Row> rows_;
+};
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/components/component_fwd.hpp>
 
+#include <userver/storages/clickhouse/execution_result.hpp>
 #include <userver/storages/clickhouse/fwd.hpp>
 #include <userver/storages/clickhouse/impl/insertion_request.hpp>
 #include <userver/storages/clickhouse/impl/pool.hpp>
@@ -60,6 +61,29 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster with args as
+  /// query parameters and hand the result to `handler` block by block, as the
+  /// blocks arrive.
+  ///
+  /// Only the current block is kept in memory: the next one is not read from
+  /// the connection until the handler returns, so a slow handler throttles
+  /// the server instead of piling the blocks up. Map the blocks with
+  /// ExecutionResult::As or ExecutionResult::AsRows. An exception thrown by
+  /// the handler aborts the query and is rethrown.
+  /// @note The execute timeout of the command control limits the whole
+  /// query, including the time spent in the handler.
+  template <typename... Args>
+  void ExecuteStreaming(const Query& query, const ResultBlockHandler& handler,
+                        const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings
+  /// at some host of the cluster with args as query parameters and hand the
+  /// result to `handler` block by block, as the blocks arrive.
+  template <typename... Args>
+  void ExecuteStreaming(OptionalCommandControl, const Query& query,
+                        const ResultBlockHandler& handler,
+                        const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -131,6 +155,9 @@ class Cluster final {
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreaming(OptionalCommandControl, const Query& query,
+                          const ResultBlockHandler& handler) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +216,22 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(const Query& query,
+                               const ResultBlockHandler& handler,
+                               const Args&... args) const {
+  ExecuteStreaming(OptionalCommandControl{}, query, handler, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                               const Query& query,
+                               const ResultBlockHandler& handler,
+                               const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreaming(optional_cc, formatted_query, handler);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -50,7 +50,10 @@ namespace components {
 /// max_pool_size         | maximum number of created connections            | 10
 /// queue_timeout         | client waiting for a free connection time limit  | 1s
 /// use_secure_connection | whether to use TLS for connections               | true
-/// compression           | compression method to use (none / lz4)           | none
+/// compression           | compression method to use (none / lz4 / zstd)    | none
+/// send_buffer_size      | socket send buffer size, 0 for system default    | 0
+/// recv_buffer_size      | socket receive buffer size, 0 for system default | 0
+/// insert_block_size     | max rows per insert block, 0 for unlimited       | 0
 
 // clang-format on
 
@@ -3,6 +3,7 @@
 /// @file userver/storages/clickhouse/execution_result.hpp
 /// @brief Result accessor.
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
@@ -11,6 +12,7 @@
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
 
+#include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 #include <userver/storages/clickhouse/io/result_mapper.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -57,10 +59,22 @@ class ExecutionResult final {
   template <typename Container>
   Container AsContainer() &&;
 
+  /// @brief Returns the values of a numeric column without copying them.
+  /// The view is valid while the result is alive.
+  /// `ColumnType` is one of the numeric io::columns, e.g.
+  /// io::columns::Int64Column or io::columns::Float64Column.
+  template <typename ColumnType>
+  io::columns::NumericColumnData<typename ColumnType::cpp_type> GetColumnView(
+      size_t ind) const;
+
  private:
   impl::BlockWrapperPtr block_;
 };
 
+/// Handler of the result blocks of
+/// storages::clickhouse::Cluster::ExecuteStreaming
+using ResultBlockHandler = std::function<void(ExecutionResult&&)>;
+
 template <typename T>
 T ExecutionResult::As() && {
   UASSERT(block_);
@@ -85,6 +99,16 @@ auto ExecutionResult::AsRows() && {
   return io::RowsMapper<T>{std::move(block_)};
 }
 
+template <typename ColumnType>
+io::columns::NumericColumnData<typename ColumnType::cpp_type>
+ExecutionResult::GetColumnView(size_t ind) const {
+  static_assert(io::columns::kIsNumericColumn<ColumnType>,
+                "Only the numeric columns can be viewed without copying");
+  UASSERT(block_);
+  return io::columns::GetNumericColumnData<typename ColumnType::cpp_type>(
+      io::columns::GetWrappedColumn(*block_, ind));
+}
+
 template <typename Container>
 Container ExecutionResult::AsContainer() && {
   UASSERT(block_);
@@ -29,6 +29,9 @@ class Pool final {
 
   ExecutionResult Execute(OptionalCommandControl, const Query& query) const;
 
+  void ExecuteStreaming(OptionalCommandControl, const Query& query,
+                        const ResultBlockHandler& handler) const;
+
   void Insert(OptionalCommandControl, const InsertionRequest& request) const;
 
   void WriteStatistics(
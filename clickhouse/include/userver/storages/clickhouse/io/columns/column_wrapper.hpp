@@ -2,8 +2,11 @@
 
 #include <memory>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+#include <userver/utils/span.hpp>
 
 namespace clickhouse {
 class Column;
@@ -22,6 +25,22 @@ void AppendWrappedColumn(clickhouse::impl::BlockWrapper& block,
 
 size_t GetColumnSize(const ColumnRef& column);
 
+/// Whether the values of the column are stored contiguously as `cpp_type`
+template <typename ColumnType>
+inline constexpr bool kIsNumericColumn =
+    std::is_arithmetic_v<typename ColumnType::cpp_type> &&
+    std::is_same_v<typename ColumnType::container_type,
+                   std::vector<typename ColumnType::cpp_type>>;
+
+/// Contiguous values of a numeric column
+template <typename T>
+using NumericColumnData = USERVER_NAMESPACE::utils::span<const T>;
+
+/// @brief Returns the values of a native numeric column without copying them
+/// @throws std::runtime_error if the column does not hold `T` values
+template <typename T>
+NumericColumnData<T> GetNumericColumnData(const ColumnRef& column);
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -30,9 +30,17 @@ class ColumnsMapper final {
     using ColumnType = std::tuple_element_t<Index, MappedType>;
     static_assert(std::is_same_v<Field, typename ColumnType::container_type>);
 
-    auto column = ColumnType{io::columns::GetWrappedColumn(block_, i)};
-    field.reserve(column.Size());
-    for (auto& it : column) field.push_back(std::move(it));
+    if constexpr (io::columns::kIsNumericColumn<ColumnType>) {
+      // copies the whole column at once
+      const auto data =
+          io::columns::GetNumericColumnData<typename ColumnType::cpp_type>(
+              io::columns::GetWrappedColumn(block_, i));
+      field.assign(data.begin(), data.end());
+    } else {
+      auto column = ColumnType{io::columns::GetWrappedColumn(block_, i)};
+      field.reserve(column.Size());
+      for (auto& it : column) field.push_back(std::move(it));
+    }
   }
 
  private:
@@ -0,0 +1,169 @@
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/percentile_format_json.hpp>
+
+#include <storages/clickhouse/stats/pool_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+namespace {
+
+const std::string kFlushTaskName = "clickhouse_buffered_insert_flush";
+
+std::vector<std::string_view> MakeViews(
+    const std::vector<std::string>& strings) {
+  return {strings.begin(), strings.end()};
+}
+
+}  // namespace
+
+struct BufferedInserterBase::Statistics final {
+  stats::Counter rows_inserted{};
+  stats::Counter rows_dropped{};
+  stats::Counter inserts{};
+  stats::Counter failed_inserts{};
+  stats::RecentPeriod timings{};
+  stats::RecentPeriod batch_rows{};
+  stats::RecentPeriod batch_bytes{};
+};
+
+BufferedInserterBase::BufferedInserterBase(
+    std::shared_ptr<Cluster> cluster, std::string table_name,
+    std::vector<std::string> column_names, BufferedInserterSettings settings)
+    : cluster_(std::move(cluster)),
+      table_name_(std::move(table_name)),
+      column_names_(std::move(column_names)),
+      column_name_views_(MakeViews(column_names_)),
+      settings_(std::move(settings)),
+      buffered_rows_semaphore_(
+          std::max<std::size_t>(settings_.max_buffered_rows, 1)),
+      in_flight_semaphore_(std::max<std::size_t>(settings_.max_in_flight, 1)),
+      stats_(std::make_unique<Statistics>()) {
+  UINVARIANT(cluster_, "Cluster must be set");
+  if (settings_.max_batch_delay.count() > 0) {
+    flush_task_.Start(kFlushTaskName,
+                      {settings_.max_batch_delay,
+                       {USERVER_NAMESPACE::utils::PeriodicTask::Flags::kStrong},
+                       logging::Level::kTrace},
+                      [this] { Flush(); });
+  }
+}
+
+BufferedInserterBase::~BufferedInserterBase() {
+  UASSERT_MSG(!flush_task_.IsRunning(),
+              "StopFlushing() must be called by the derived destructor");
+  for (auto& task : in_flight_) task.BlockingWait();
+}
+
+void BufferedInserterBase::Flush() {
+  std::unique_lock lock(mutex_);
+  if (pending_rows_) SendBuffered(lock);
+}
+
+void BufferedInserterBase::Finish() {
+  Flush();
+  WaitInFlight();
+}
+
+void BufferedInserterBase::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  writer["rows"]["inserted"] = stats_->rows_inserted;
+  writer["rows"]["dropped"] = stats_->rows_dropped;
+  writer["inserts"]["total"] = stats_->inserts;
+  writer["inserts"]["error"] = stats_->failed_inserts;
+  writer["inserts"]["timings"] = stats_->timings;
+  writer["inserts"]["rows"] = stats_->batch_rows;
+  writer["inserts"]["bytes"] = stats_->batch_bytes;
+}
+
+bool BufferedInserterBase::ReserveRow(bool should_wait) {
+  const bool is_reserved =
+      should_wait
+          ? buffered_rows_semaphore_.try_lock_shared_until(engine::Deadline{})
+          : buffered_rows_semaphore_.try_lock_shared();
+  if (!is_reserved) ++stats_->rows_dropped;
+  return is_reserved;
+}
+
+void BufferedInserterBase::OnRowAppended(std::unique_lock<engine::Mutex>& lock,
+                                         std::size_t bytes) {
+  UASSERT(lock.owns_lock());
+  ++pending_rows_;
+  pending_bytes_ += bytes;
+  // A batch larger than the buffer would never fill up
+  const auto max_batch_rows =
+      std::min(settings_.max_batch_rows, settings_.max_buffered_rows);
+  if (pending_rows_ >= max_batch_rows ||
+      pending_bytes_ >= settings_.max_batch_bytes) {
+    SendBuffered(lock);
+  }
+}
+
+void BufferedInserterBase::StopFlushing() { flush_task_.Stop(); }
+
+void BufferedInserterBase::SendBuffered(std::unique_lock<engine::Mutex>& lock) {
+  UASSERT(lock.owns_lock());
+
+  // Waits for a free slot before taking the rows, so that they stay buffered
+  // if the wait is cancelled
+  engine::SemaphoreLock in_flight_lock(in_flight_semaphore_);
+
+  in_flight_.erase(std::remove_if(in_flight_.begin(), in_flight_.end(),
+                                  [](const auto& task) {
+                                    return task.IsFinished();
+                                  }),
+                   in_flight_.end());
+
+  const auto rows = std::exchange(pending_rows_, 0);
+  const auto bytes = std::exchange(pending_bytes_, 0);
+  in_flight_.push_back(USERVER_NAMESPACE::utils::CriticalAsync(
+      "clickhouse_buffered_insert",
+      [this, insert = TakeRows(), rows, bytes,
+       in_flight_lock = std::move(in_flight_lock)] {
+        Insert(insert, rows, bytes);
+      }));
+}
+
+void BufferedInserterBase::Insert(const InsertFunc& insert, std::size_t rows,
+                                  std::size_t bytes) {
+  const auto start = std::chrono::steady_clock::now();
+  try {
+    insert(*cluster_, settings_.command_control, table_name_,
+           column_name_views_);
+    stats_->rows_inserted += rows;
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to insert " << rows << " buffered rows into '"
+                << table_name_ << "': " << ex;
+    ++stats_->failed_inserts;
+    stats_->rows_dropped += rows;
+  }
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  ++stats_->inserts;
+  stats_->timings.GetCurrentCounter().Account(duration.count());
+  stats_->batch_rows.GetCurrentCounter().Account(rows);
+  stats_->batch_bytes.GetCurrentCounter().Account(bytes);
+  buffered_rows_semaphore_.unlock_shared_count(rows);
+}
+
+void BufferedInserterBase::WaitInFlight() {
+  std::vector<engine::TaskWithResult<void>> tasks;
+  {
+    std::lock_guard lock(mutex_);
+    tasks.swap(in_flight_);
+  }
+  for (auto& task : tasks) task.Get();
+}
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
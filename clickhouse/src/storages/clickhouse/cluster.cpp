@@ -54,6 +54,12 @@ ExecutionResult Cluster::DoExecute(OptionalCommandControl optional_cc,
   return GetPool().Execute(optional_cc, query);
 }
 
+void Cluster::DoExecuteStreaming(OptionalCommandControl optional_cc,
+                                 const Query& query,
+                                 const ResultBlockHandler& handler) const {
+  GetPool().ExecuteStreaming(optional_cc, query, handler);
+}
+
 void Cluster::DoInsert(OptionalCommandControl optional_cc,
                        const impl::InsertionRequest& request) const {
   GetPool().Insert(optional_cc, request);
@@ -74,8 +74,20 @@ properties:
         defaultDescription: true
     compression:
         type: string
-        description: compression method to use (none / lz4)
+        description: compression method to use (none / lz4 / zstd)
         defaultDescription: none
+    send_buffer_size:
+        type: integer
+        description: socket send buffer size, 0 for the system default
+        defaultDescription: 0
+    recv_buffer_size:
+        type: integer
+        description: socket receive buffer size, 0 for the system default
+        defaultDescription: 0
+    insert_block_size:
+        type: integer
+        description: max rows per insert block, 0 for unlimited
+        defaultDescription: 0
 )");
 }
 
@@ -1,5 +1,6 @@
 #include "connection.hpp"
 
+#include <algorithm>
 #include <exception>
 
 #include <clickhouse/block.h>
@@ -15,6 +16,7 @@
 #include <storages/clickhouse/impl/block_wrapper.hpp>
 #include <storages/clickhouse/impl/native_client_factory.hpp>
 #include <storages/clickhouse/impl/tracing_tags.hpp>
+#include <storages/clickhouse/stats/pool_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -76,9 +78,11 @@ class Connection::ConnectionBrokenGuard final {
 Connection::Connection(clients::dns::Resolver& resolver,
                        const EndpointSettings& endpoint,
                        const AuthSettings& auth,
-                       const ConnectionSettings& connection_settings)
+                       const ConnectionSettings& connection_settings,
+                       stats::PoolNetworkStatistics& network_stats)
     : client_{NativeClientFactory::Create(resolver, endpoint, auth,
-                                          connection_settings)} {}
+                                          connection_settings, network_stats)},
+      insert_block_size_{connection_settings.insert_block_size} {}
 
 ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
                                     const Query& query) {
@@ -104,13 +108,55 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                  const Query& query,
+                                  const ResultBlockHandler& handler) {
+  clickhouse_cpp::Query native_query{query.QueryText()};
+  native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+    // we must return 'true' if we don't want to cancel query
+    return !engine::current_task::ShouldCancel();
+  });
+
+  auto& span = tracing::Span::CurrentSpan();
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  // The next block is not read from the socket until the handler returns
+  native_query.OnData([&handler, &scope](const NativeBlock& data) {
+    scope.Reset(scopes::kExec);
+    if (data.GetRowCount() == 0) return;
+
+    auto block_ptr = std::make_unique<BlockWrapper>(NativeBlock{data});
+    handler(ExecutionResult{BlockWrapperPtr{block_ptr.release()}});
+  });
+
+  DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
-  const auto& block = request.GetBlock();
+  const auto& block = request.GetBlock().GetNative();
+  const auto deadline = GetDeadline(optional_cc);
 
   auto guard = GetBrokenGuard();
-  client_.Insert(request.GetTableName(), block.GetNative(),
-                 GetDeadline(optional_cc));
+  const auto rows_count = block.GetRowCount();
+  if (insert_block_size_ == 0 || rows_count <= insert_block_size_) {
+    client_.Insert(request.GetTableName(), block, deadline);
+    return;
+  }
+
+  // Large inserts are sent as several native blocks, which keeps the
+  // compression buffers small. The blocks are not inserted atomically.
+  for (std::size_t offset = 0; offset < rows_count;
+       offset += insert_block_size_) {
+    const auto slice_size = std::min(insert_block_size_, rows_count - offset);
+
+    NativeBlock slice{block.GetColumnCount(), slice_size};
+    for (std::size_t ind = 0; ind < block.GetColumnCount(); ++ind) {
+      slice.AppendColumn(block.GetColumnName(ind),
+                         block[ind]->Slice(offset, slice_size));
+    }
+    client_.Insert(request.GetTableName(), slice, deadline);
+  }
 }
 
 void Connection::Ping() {
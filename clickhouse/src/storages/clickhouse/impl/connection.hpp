@@ -14,6 +14,10 @@ namespace storages::clickhouse {
 
 class Query;
 
+namespace stats {
+struct PoolNetworkStatistics;
+}
+
 namespace impl {
 
 struct EndpointSettings;
@@ -24,10 +28,14 @@ class InsertionRequest;
 class Connection final {
  public:
   Connection(clients::dns::Resolver&, const EndpointSettings&,
-             const AuthSettings&, const ConnectionSettings&);
+             const AuthSettings&, const ConnectionSettings&,
+             stats::PoolNetworkStatistics&);
 
   ExecutionResult Execute(OptionalCommandControl, const Query&);
 
+  void ExecuteStreaming(OptionalCommandControl, const Query&,
+                        const ResultBlockHandler&);
+
   void Insert(OptionalCommandControl, const InsertionRequest&);
 
   void Ping();
@@ -41,6 +49,7 @@ class Connection final {
   void DoExecute(OptionalCommandControl, const clickhouse_cpp::Query&);
 
   NativeClientWrapper client_;
+  const std::size_t insert_block_size_;
   bool broken_{false};
 };
 }  // namespace impl
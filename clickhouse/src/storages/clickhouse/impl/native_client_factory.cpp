@@ -2,6 +2,7 @@
 
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <sys/socket.h>
 
 #include <clickhouse/base/input.h>
 #include <clickhouse/base/output.h>
@@ -16,6 +17,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <storages/clickhouse/impl/tracing_tags.hpp>
+#include <storages/clickhouse/stats/pool_statistics.hpp>
 
 namespace clickhouse {
 // Not present before 2.5.0, but we don't use it anyway.
@@ -39,8 +41,9 @@ constexpr std::chrono::milliseconds kConnectTimeout{1500};
 template <typename T>
 class ClickhouseSocketInput final : public clickhouse_cpp::InputStream {
  public:
-  ClickhouseSocketInput(T& socket, engine::Deadline& deadline)
-      : socket_{socket}, deadline_{deadline} {}
+  ClickhouseSocketInput(T& socket, engine::Deadline& deadline,
+                        stats::PoolNetworkStatistics& stats)
+      : socket_{socket}, deadline_{deadline}, stats_{stats} {}
   ~ClickhouseSocketInput() override = default;
 
  protected:
@@ -52,6 +55,7 @@ class ClickhouseSocketInput final : public clickhouse_cpp::InputStream {
     const auto read = socket_.RecvSome(buf, len, deadline_);
 
     if (!read) throw engine::io::IoException{"socket reset by peer"};
+    stats_.bytes_received += read;
 
     return read;
   }
@@ -59,13 +63,15 @@ class ClickhouseSocketInput final : public clickhouse_cpp::InputStream {
  private:
   T& socket_;
   engine::Deadline& deadline_;
+  stats::PoolNetworkStatistics& stats_;
 };
 
 template <typename T>
 class ClickhouseSocketOutput final : public clickhouse_cpp::OutputStream {
  public:
-  ClickhouseSocketOutput(T& socket, engine::Deadline& deadline)
-      : socket_{socket}, deadline_{deadline} {}
+  ClickhouseSocketOutput(T& socket, engine::Deadline& deadline,
+                         stats::PoolNetworkStatistics& stats)
+      : socket_{socket}, deadline_{deadline}, stats_{stats} {}
   ~ClickhouseSocketOutput() override = default;
 
  protected:
@@ -73,6 +79,7 @@ class ClickhouseSocketOutput final : public clickhouse_cpp::OutputStream {
     if (deadline_.IsReached()) throw engine::io::IoTimeout{};
 
     const auto sent = socket_.SendAll(data, len, deadline_);
+    stats_.bytes_sent += sent;
     if (sent != len) throw engine::io::IoException{"broken pipe?"};
 
     return sent;
@@ -81,11 +88,21 @@ class ClickhouseSocketOutput final : public clickhouse_cpp::OutputStream {
  private:
   T& socket_;
   engine::Deadline& deadline_;
+  stats::PoolNetworkStatistics& stats_;
 };
 
-Socket CreateSocket(engine::io::Sockaddr addr, engine::Deadline deadline) {
+void SetBufferSize(Socket& socket, int optname, std::size_t size) {
+  if (size == 0) return;
+  socket.SetOption(SOL_SOCKET, optname, static_cast<int>(size));
+}
+
+Socket CreateSocket(engine::io::Sockaddr addr, engine::Deadline deadline,
+                    const ConnectionSettings& settings) {
   Socket socket{addr.Domain(), engine::io::SocketType::kTcp};
   socket.SetOption(IPPROTO_TCP, TCP_NODELAY, 1);
+  // must be set before connecting for the TCP window scaling to pick them up
+  SetBufferSize(socket, SO_SNDBUF, settings.send_buffer_size);
+  SetBufferSize(socket, SO_RCVBUF, settings.recv_buffer_size);
   socket.Connect(addr, deadline);
 
   return socket;
@@ -93,48 +110,59 @@ Socket CreateSocket(engine::io::Sockaddr addr, engine::Deadline deadline) {
 
 class ClickhouseSocketAdapter : public clickhouse_cpp::SocketBase {
  public:
-  ClickhouseSocketAdapter(engine::io::Sockaddr addr, engine::Deadline& deadline)
-      : deadline_{deadline}, socket_{CreateSocket(addr, deadline_)} {}
+  ClickhouseSocketAdapter(engine::io::Sockaddr addr, engine::Deadline& deadline,
+                          const ConnectionSettings& settings,
+                          stats::PoolNetworkStatistics& stats)
+      : deadline_{deadline},
+        stats_{stats},
+        socket_{CreateSocket(addr, deadline_, settings)} {}
 
   ~ClickhouseSocketAdapter() override { socket_.Close(); }
 
   std::unique_ptr<clickhouse_cpp::InputStream> makeInputStream()
       const override {
-    return std::make_unique<ClickhouseSocketInput<Socket>>(socket_, deadline_);
+    return std::make_unique<ClickhouseSocketInput<Socket>>(socket_, deadline_,
+                                                           stats_);
   }
 
   std::unique_ptr<clickhouse_cpp::OutputStream> makeOutputStream()
       const override {
-    return std::make_unique<ClickhouseSocketOutput<Socket>>(socket_, deadline_);
+    return std::make_unique<ClickhouseSocketOutput<Socket>>(socket_, deadline_,
+                                                            stats_);
   }
 
  private:
   engine::Deadline& deadline_;
+  stats::PoolNetworkStatistics& stats_;
   mutable Socket socket_;
 };
 
 class ClickhouseTlsSocketAdapter : public clickhouse_cpp::SocketBase {
  public:
   ClickhouseTlsSocketAdapter(engine::io::Sockaddr addr,
-                             engine::Deadline& deadline)
+                             engine::Deadline& deadline,
+                             const ConnectionSettings& settings,
+                             stats::PoolNetworkStatistics& stats)
       : deadline_{deadline},
+        stats_{stats},
         tls_socket_{engine::io::TlsWrapper::StartTlsClient(
-            CreateSocket(addr, deadline_), {}, deadline_)} {}
+            CreateSocket(addr, deadline_, settings), {}, deadline_)} {}
 
   std::unique_ptr<clickhouse_cpp::InputStream> makeInputStream()
       const override {
-    return std::make_unique<ClickhouseSocketInput<TlsSocket>>(tls_socket_,
-                                                              deadline_);
+    return std::make_unique<ClickhouseSocketInput<TlsSocket>>(
+        tls_socket_, deadline_, stats_);
   }
 
   std::unique_ptr<clickhouse_cpp::OutputStream> makeOutputStream()
       const override {
-    return std::make_unique<ClickhouseSocketOutput<TlsSocket>>(tls_socket_,
-                                                               deadline_);
+    return std::make_unique<ClickhouseSocketOutput<TlsSocket>>(
+        tls_socket_, deadline_, stats_);
   }
 
  private:
   engine::Deadline& deadline_;
+  stats::PoolNetworkStatistics& stats_;
   mutable TlsSocket tls_socket_;
 };
 
@@ -167,11 +195,14 @@ class ClickhouseCppSocketFactoryHack : public clickhouse_cpp::SocketFactory {
 
 class ClickhouseSocketFactory final : public ClickhouseCppSocketFactoryHack {
  public:
-  ClickhouseSocketFactory(clients::dns::Resolver& resolver, ConnectionMode mode,
-                          engine::Deadline& operations_deadline)
+  ClickhouseSocketFactory(clients::dns::Resolver& resolver,
+                          const ConnectionSettings& settings,
+                          engine::Deadline& operations_deadline,
+                          stats::PoolNetworkStatistics& stats)
       : resolver_{resolver},
-        mode_{mode},
-        operations_deadline_{operations_deadline} {}
+        settings_{settings},
+        operations_deadline_{operations_deadline},
+        stats_{stats} {}
 
   ~ClickhouseSocketFactory() override = default;
 
@@ -192,13 +223,13 @@ class ClickhouseSocketFactory final : public ClickhouseCppSocketFactoryHack {
         // of one attempt consuming the whole budget.
         operations_deadline_ = engine::Deadline::FromDuration(kConnectTimeout);
 
-        switch (mode_) {
+        switch (settings_.connection_mode) {
           case ConnectionMode::kNonSecure:
             return std::make_unique<ClickhouseSocketAdapter>(
-                current_addr, operations_deadline_);
+                current_addr, operations_deadline_, settings_, stats_);
           case ConnectionMode::kSecure:
             return std::make_unique<ClickhouseTlsSocketAdapter>(
-                current_addr, operations_deadline_);
+                current_addr, operations_deadline_, settings_, stats_);
         }
       } catch (const std::exception&) {
       }
@@ -210,9 +241,10 @@ class ClickhouseSocketFactory final : public ClickhouseCppSocketFactoryHack {
   }
 
   clients::dns::Resolver& resolver_;
-  ConnectionMode mode_;
+  const ConnectionSettings settings_;
 
   engine::Deadline& operations_deadline_;
+  stats::PoolNetworkStatistics& stats_;
 };
 
 clickhouse_cpp::CompressionMethod GetCompressionMethod(
@@ -222,6 +254,8 @@ clickhouse_cpp::CompressionMethod GetCompressionMethod(
       return clickhouse_cpp::CompressionMethod::None;
     case CompressionMethod::kLZ4:
       return clickhouse_cpp::CompressionMethod::LZ4;
+    case CompressionMethod::kZSTD:
+      return clickhouse_cpp::CompressionMethod::ZSTD;
   }
   UINVARIANT(false, "Invalid value of CompressionMethod enum");
 }
@@ -230,11 +264,13 @@ clickhouse_cpp::CompressionMethod GetCompressionMethod(
 
 NativeClientWrapper::NativeClientWrapper(
     clients::dns::Resolver& resolver,
-    const clickhouse_cpp::ClientOptions& options, ConnectionMode mode) {
+    const clickhouse_cpp::ClientOptions& options,
+    const ConnectionSettings& connection_settings,
+    stats::PoolNetworkStatistics& network_stats) {
   SetDeadline(engine::Deadline::FromDuration(kConnectTimeout));
 
   auto socket_factory = std::make_unique<ClickhouseSocketFactory>(
-      resolver, mode, operations_deadline_);
+      resolver, connection_settings, operations_deadline_, network_stats);
   native_client_ = std::make_unique<clickhouse_cpp::Client>(
       options, std::move(socket_factory));
 }
@@ -265,7 +301,8 @@ void NativeClientWrapper::SetDeadline(engine::Deadline deadline) {
 
 NativeClientWrapper NativeClientFactory::Create(
     clients::dns::Resolver& resolver, const EndpointSettings& endpoint,
-    const AuthSettings& auth, const ConnectionSettings& connection_settings) {
+    const AuthSettings& auth, const ConnectionSettings& connection_settings,
+    stats::PoolNetworkStatistics& network_stats) {
   const auto options = clickhouse_cpp::ClientOptions{}
                            .SetHost(endpoint.host)
                            .SetPort(endpoint.port)
@@ -276,8 +313,8 @@ NativeClientWrapper NativeClientFactory::Create(
                                connection_settings.compression_method));
 
   tracing::Span span{scopes::kConnect};
-  return NativeClientWrapper{resolver, options,
-                             connection_settings.connection_mode};
+  return NativeClientWrapper{resolver, options, connection_settings,
+                             network_stats};
 }
 
 }  // namespace storages::clickhouse::impl
@@ -18,13 +18,17 @@ class Client;
 
 USERVER_NAMESPACE_BEGIN
 
+namespace storages::clickhouse::stats {
+struct PoolNetworkStatistics;
+}
+
 namespace storages::clickhouse::impl {
 
 class NativeClientWrapper final {
  public:
   NativeClientWrapper(clients::dns::Resolver&,
                       const clickhouse_cpp::ClientOptions&,
-                      ConnectionSettings::ConnectionMode);
+                      const ConnectionSettings&, stats::PoolNetworkStatistics&);
   ~NativeClientWrapper();
 
   void Execute(const clickhouse_cpp::Query& query, engine::Deadline deadline);
@@ -45,7 +49,8 @@ class NativeClientFactory final {
   static NativeClientWrapper Create(clients::dns::Resolver&,
                                     const EndpointSettings&,
                                     const AuthSettings&,
-                                    const ConnectionSettings&);
+                                    const ConnectionSettings&,
+                                    stats::PoolNetworkStatistics&);
 };
 
 }  // namespace storages::clickhouse::impl
@@ -46,7 +46,8 @@ static CompressionMethod Parse(const yaml_config::YamlConfig& value,
   static constexpr utils::TrivialBiMap kMap([](auto selector) {
     return selector()
         .Case(CompressionMethod::kNone, "none")
-        .Case(CompressionMethod::kLZ4, "lz4");
+        .Case(CompressionMethod::kLZ4, "lz4")
+        .Case(CompressionMethod::kZSTD, "zstd");
   });
 
   return utils::ParseFromValueString(value, kMap);
@@ -64,7 +65,10 @@ ConnectionSettings::ConnectionSettings(
     : connection_mode{GetConnectionMode(
           config["use_secure_connection"].As<bool>(true))},
       compression_method{config["compression"].As<CompressionMethod>(
-          CompressionMethod::kNone)} {}
+          CompressionMethod::kNone)},
+      send_buffer_size{config["send_buffer_size"].As<std::size_t>(0)},
+      recv_buffer_size{config["recv_buffer_size"].As<std::size_t>(0)},
+      insert_block_size{config["insert_block_size"].As<std::size_t>(0)} {}
 
 PoolSettings::PoolSettings(const components::ComponentConfig& config,
                            const EndpointSettings& endpoint,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 
@@ -30,12 +31,19 @@ struct EndpointSettings final {
 struct ConnectionSettings final {
   enum class ConnectionMode { kNonSecure, kSecure };
 
-  enum class CompressionMethod { kNone, kLZ4 };
+  enum class CompressionMethod { kNone, kLZ4, kZSTD };
 
   ConnectionMode connection_mode{ConnectionMode::kSecure};
 
   CompressionMethod compression_method{CompressionMethod::kNone};
 
+  // socket buffer sizes, 0 leaves the system defaults
+  std::size_t send_buffer_size{0};
+  std::size_t recv_buffer_size{0};
+
+  // max rows sent in a single native block on insert, 0 means unlimited
+  std::size_t insert_block_size{0};
+
   ConnectionSettings(const components::ComponentConfig&);
 };
 
@@ -1,5 +1,11 @@
 #include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
 
+#include <cstdint>
+
+#include <clickhouse/columns/numeric.h>
+#include <fmt/format.h>
+
+#include <userver/compiler/demangle.hpp>
 #include <userver/utils/assert.hpp>
 
 #include <storages/clickhouse/impl/block_wrapper.hpp>
@@ -24,6 +30,35 @@ void AppendWrappedColumn(clickhouse::impl::BlockWrapper& block,
 
 size_t GetColumnSize(const ColumnRef& column) { return column->Size(); }
 
+template <typename T>
+NumericColumnData<T> GetNumericColumnData(const ColumnRef& column) {
+  using NativeType = clickhouse::impl::clickhouse_cpp::ColumnVector<T>;
+
+  const auto typed_column = column->As<NativeType>();
+  if (!typed_column) {
+    throw std::runtime_error{
+        fmt::format("failed to cast column of type '{}' to a column of '{}'",
+                    column->Type()->GetName(),
+                    USERVER_NAMESPACE::compiler::GetTypeName<T>())};
+  }
+
+  const auto& data = typed_column->GetWritableData();
+  return {data.data(), data.size()};
+}
+
+template NumericColumnData<std::int8_t> GetNumericColumnData(const ColumnRef&);
+template NumericColumnData<std::uint8_t> GetNumericColumnData(const ColumnRef&);
+template NumericColumnData<std::uint16_t> GetNumericColumnData(
+    const ColumnRef&);
+template NumericColumnData<std::int32_t> GetNumericColumnData(const ColumnRef&);
+template NumericColumnData<std::uint32_t> GetNumericColumnData(
+    const ColumnRef&);
+template NumericColumnData<std::int64_t> GetNumericColumnData(const ColumnRef&);
+template NumericColumnData<std::uint64_t> GetNumericColumnData(
+    const ColumnRef&);
+template NumericColumnData<float> GetNumericColumnData(const ColumnRef&);
+template NumericColumnData<double> GetNumericColumnData(const ColumnRef&);
+
 }  // namespace storages::clickhouse::io::columns
 
 USERVER_NAMESPACE_END
@@ -30,10 +30,16 @@ struct PoolQueryStatistics final {
   RecentPeriod timings{};
 };
 
+struct PoolNetworkStatistics final {
+  Counter bytes_sent{};
+  Counter bytes_received{};
+};
+
 struct PoolStatistics final {
   PoolConnectionStatistics connections{};
   PoolQueryStatistics queries{};
   PoolQueryStatistics inserts{};
+  PoolNetworkStatistics network{};
 };
 
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
@@ -45,6 +51,9 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
 void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                 const PoolConnectionStatistics& stats);
 
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const PoolNetworkStatistics& stats);
+
 }  // namespace storages::clickhouse::stats
 
 USERVER_NAMESPACE_END
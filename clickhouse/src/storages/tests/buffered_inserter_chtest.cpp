@@ -0,0 +1,100 @@
+#include <userver/utest/utest.hpp>
+
+#include <memory>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/clickhouse/buffered_inserter.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/query.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct CountResult final {
+  std::vector<uint64_t> count;
+};
+
+struct InsertedRow final {
+  uint64_t id;
+  std::string value;
+};
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<CountResult> {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+template <>
+struct CppToClickhouse<InsertedRow> {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+}  // namespace storages::clickhouse::io
+
+namespace {
+
+using storages::clickhouse::BufferedInserter;
+
+std::shared_ptr<storages::clickhouse::Cluster> MakeNonOwning(
+    ClusterWrapper& cluster) {
+  return {std::shared_ptr<storages::clickhouse::Cluster>{}, &*cluster};
+}
+
+uint64_t CountRows(ClusterWrapper& cluster, const std::string& table) {
+  return cluster
+      ->Execute(storages::clickhouse::Query{"SELECT count() FROM " + table})
+      .As<CountResult>()
+      .count.at(0);
+}
+
+void RecreateTable(ClusterWrapper& cluster, const std::string& table) {
+  cluster->Execute(
+      storages::clickhouse::Query{"DROP TABLE IF EXISTS " + table});
+  cluster->Execute(storages::clickhouse::Query{
+      "CREATE TABLE " + table + " (id UInt64, value String) ENGINE = Memory"});
+}
+
+}  // namespace
+
+UTEST(BufferedInserter, InsertsInBatches) {
+  ClusterWrapper cluster{};
+  RecreateTable(cluster, "buffered_inserter_batches");
+
+  storages::clickhouse::BufferedInserterSettings settings;
+  settings.max_batch_rows = 100;
+  settings.max_buffered_rows = 300;
+  BufferedInserter<InsertedRow> inserter(MakeNonOwning(cluster),
+                                         "buffered_inserter_batches",
+                                         {"id", "value"}, std::move(settings));
+  for (uint64_t i = 0; i < 1050; ++i) {
+    EXPECT_TRUE(inserter.Push({i, "value"}));
+  }
+  inserter.Finish();
+
+  EXPECT_EQ(CountRows(cluster, "buffered_inserter_batches"), 1050);
+}
+
+UTEST(BufferedInserter, InsertsByTime) {
+  ClusterWrapper cluster{};
+  RecreateTable(cluster, "buffered_inserter_time");
+
+  storages::clickhouse::BufferedInserterSettings settings;
+  settings.max_batch_delay = std::chrono::milliseconds{10};
+  BufferedInserter<InsertedRow> inserter(MakeNonOwning(cluster),
+                                         "buffered_inserter_time",
+                                         {"id", "value"}, std::move(settings));
+  EXPECT_TRUE(inserter.Push({1, "value"}));
+
+  while (CountRows(cluster, "buffered_inserter_time") == 0) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -121,4 +121,57 @@ UTEST(Execute, IterationMovesFromUnderlying) {
   }
 }
 
+UTEST(Execute, NumericColumnView) {
+  ClusterWrapper cluster{};
+
+  const auto result = cluster->Execute(common_query);
+  const auto numbers =
+      result.GetColumnView<storages::clickhouse::io::columns::UInt64Column>(0);
+  ASSERT_EQ(numbers.size(), 10000);
+  EXPECT_EQ(numbers[5001], 5001);
+
+  UEXPECT_THROW(
+      result.GetColumnView<storages::clickhouse::io::columns::Int32Column>(0),
+      std::runtime_error);
+}
+
+UTEST(Execute, Streaming) {
+  ClusterWrapper cluster{};
+
+  const storages::clickhouse::Query q{
+      "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+      "FROM numbers(0, 10000) c SETTINGS max_block_size = 1000"};
+
+  size_t blocks = 0;
+  uint64_t sum = 0;
+  cluster->ExecuteStreaming(
+      q, [&](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks;
+        for (auto&& row : std::move(block).AsRows<RowData>()) {
+          sum += row.number;
+        }
+      });
+
+  EXPECT_GT(blocks, 1);
+  EXPECT_EQ(sum, 10000 * (10000 - 1) / 2);
+}
+
+UTEST(Execute, StreamingHandlerThrows) {
+  ClusterWrapper cluster{};
+
+  const storages::clickhouse::Query q{
+      "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+      "FROM numbers(0, 10000) c SETTINGS max_block_size = 1000"};
+
+  UEXPECT_THROW(cluster->ExecuteStreaming(
+                    q,
+                    [](storages::clickhouse::ExecutionResult&&) {
+                      throw std::runtime_error{"stop"};
+                    }),
+                std::runtime_error);
+
+  // the cluster is still usable
+  EXPECT_EQ(cluster->Execute(common_query).GetRowsCount(), 10000);
+}
+
 USERVER_NAMESPACE_END
@@ -57,6 +57,19 @@ UTEST(Metrics, Basic) {
   EXPECT_EQ(insert_stats.SingleMetric("error").AsInt(), 1);
 }
 
+UTEST(Metrics, NetworkBytes) {
+  ClusterWrapper cluster{true};
+
+  const DummyData data{std::vector<std::string>(1000, "str")};
+  cluster->Execute("CREATE TEMPORARY TABLE IF NOT EXISTS tmp(value String)");
+  cluster->Insert("tmp", {"value"}, data);
+  cluster->Execute("SELECT value FROM tmp");
+
+  const auto network_stats = cluster.GetStatistics("clickhouse.network");
+  EXPECT_GT(network_stats.SingleMetric("bytes_sent").AsInt(), 0);
+  EXPECT_GT(network_stats.SingleMetric("bytes_received").AsInt(), 0);
+}
+
 UTEST(Metrics, ActiveConnections) {
   PoolWrapper pool{};
 
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <fmt/format.h>
+
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/handlers/json_error_builder.hpp>
+#include <userver/server/http/form_data_stream_reader.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response_body_stream.hpp>
 #include <userver/testsuite/testpoint.hpp>
 #include <userver/utest/using_namespace_userver.hpp>
@@ -59,4 +63,40 @@ class HttpServerHandler final : public server::handlers::HttpHandlerBase {
   }
 };
 
+class RequestStreamHandler final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-chaos-request-stream";
+
+  RequestStreamHandler(const components::ComponentConfig& config,
+                       const components::ComponentContext& context)
+      : HttpHandlerBase(config, context) {}
+
+  /// [RequestBodyStream]
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest& request,
+      server::request::RequestContext&) const override {
+    const auto deadline =
+        engine::Deadline::FromDuration(std::chrono::seconds{10});
+    std::string chunk;
+
+    if (request.GetArg("type") == "form-data") {
+      std::string result;
+      server::http::FormDataStreamReader reader{request};
+      while (const auto part = reader.NextPart(deadline)) {
+        std::size_t size = 0;
+        while (reader.ReadChunk(chunk, deadline)) size += chunk.size();
+        result += fmt::format("{}={}\n", part->name, size);
+      }
+      return result;
+    }
+
+    auto& body_stream = request.GetBodyStream();
+    std::size_t size = 0;
+    while (body_stream.ReadChunk(chunk, deadline)) size += chunk.size();
+    UINVARIANT(body_stream.IsComplete(), "The body is not received");
+    return std::to_string(size);
+  }
+  /// [RequestBodyStream]
+};
+
 }  // namespace chaos
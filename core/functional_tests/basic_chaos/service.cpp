@@ -23,6 +23,7 @@ int main(int argc, char* argv[]) {
           .Append<chaos::HttpClientHandler>()
           .Append<chaos::StreamHandler>()
           .Append<chaos::HttpServerHandler>()
+          .Append<chaos::RequestStreamHandler>()
           .Append<chaos::ResolverHandler>()
           .Append<components::LoggingConfigurator>()
           .Append<components::HttpClient>()
@@ -0,0 +1,68 @@
+import pytest
+
+DATA_PARTS_MAX_SIZE = 1024
+BODY_SIZE = 4 * 1024 * 1024
+TIMEOUT = 20.0
+
+FORM_DATA_BODY = (
+    b'--zzz\r\n'
+    b'Content-Disposition: form-data; name="text"\r\n'
+    b'\r\n'
+    b'value\r\n'
+    b'--zzz\r\n'
+    b'Content-Disposition: form-data; name="file"; filename="a.bin"\r\n'
+    b'Content-Type: application/octet-stream\r\n'
+    b'\r\n' + b'\r\n--zz' * 100000 + b'\r\n'
+    b'--zzz--\r\n'
+)
+
+
+async def _chunks(data: bytes, chunk_size: int):
+    for pos in range(0, len(data), chunk_size):
+        yield data[pos : pos + chunk_size]
+
+
+@pytest.mark.parametrize('chunked', [False, True])
+async def test_body(modified_service_client, gate, chunked):
+    gate.to_server_smaller_parts(DATA_PARTS_MAX_SIZE)
+
+    body = b'x' * BODY_SIZE
+    response = await modified_service_client.post(
+        '/chaos/httpserver/request-stream',
+        data=_chunks(body, 64 * 1024) if chunked else body,
+        timeout=TIMEOUT,
+    )
+    assert response.status == 200
+    assert response.text == str(BODY_SIZE)
+
+
+async def test_small_body(service_client):
+    response = await service_client.post(
+        '/chaos/httpserver/request-stream', data='small',
+    )
+    assert response.status == 200
+    assert response.text == '5'
+
+
+async def test_form_data(modified_service_client, gate):
+    gate.to_server_smaller_parts(DATA_PARTS_MAX_SIZE)
+
+    response = await modified_service_client.post(
+        '/chaos/httpserver/request-stream',
+        params={'type': 'form-data'},
+        headers={'Content-Type': 'multipart/form-data; boundary=zzz'},
+        data=FORM_DATA_BODY,
+        timeout=TIMEOUT,
+    )
+    assert response.status == 200
+    assert response.text == 'text=5\nfile=600000\n'
+
+
+async def test_malformed_form_data(service_client):
+    response = await service_client.post(
+        '/chaos/httpserver/request-stream',
+        params={'type': 'form-data'},
+        headers={'Content-Type': 'multipart/form-data; boundary=zzz'},
+        data=b'--zzz\r\nContent-Type: text/plain\r\n\r\nvalue\r\n--zzz--\r\n',
+    )
+    assert response.status == 400
@@ -1,3 +1,7 @@
+#include <vector>
+
+#include <fmt/format.h>
+
 #include <userver/clients/dns/component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 
@@ -46,6 +50,15 @@ class WebsocketsHandler final : public server::websocket::WebsocketHandlerBase {
         break;
       }
 
+      if (message.data == "batch") {
+        std::vector<server::websocket::Message> batch;
+        for (int i = 0; i < 3; ++i) {
+          batch.push_back({fmt::format("batch-{}", i), {}, true});
+        }
+        chat.SendBatch(batch);
+        continue;
+      }
+
       chat.Send(std::move(message));
     }
     if (message.close_status) chat.Close(*message.close_status);
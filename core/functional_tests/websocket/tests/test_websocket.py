@@ -97,3 +97,31 @@ async def test_two(websocket_client):
             for _ in range(10):
                 msg = await chat1.recv()
                 assert msg == b'A'
+
+
+async def test_permessage_deflate(websocket_client):
+    async with websocket_client.get('chat') as chat:
+        assert [ext.name for ext in chat.extensions] == ['permessage-deflate']
+
+        msg = '{"text":"hello"}' * 1000
+        await chat.send(msg)
+        response = await chat.recv()
+        assert response == msg
+
+
+async def test_no_permessage_deflate(service_port):
+    async with websockets.connect(
+            f'ws://localhost:{service_port}/chat', compression=None,
+    ) as chat:
+        assert chat.extensions == []
+        msg = '{"text":"hello"}' * 1000
+        await chat.send(msg)
+        assert await chat.recv() == msg
+
+
+async def test_batch(websocket_client):
+    async with websocket_client.get('chat') as chat:
+        await chat.send('batch')
+        for i in range(3):
+            response = await chat.recv()
+            assert response == f'batch-{i}'
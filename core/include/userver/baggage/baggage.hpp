@@ -4,6 +4,9 @@
 /// @brief @copybrief baggage::Baggage
 
 #include <algorithm>  // TODO: remove
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -85,14 +88,23 @@ class BaggageEntry {
 /// For more details on header check the official site
 /// https://w3c.github.io/baggage/
 ///
+/// The header is parsed lazily on the first access to the entries, so requests
+/// that only pass the baggage through to the outgoing requests never parse it.
+///
 /// @see baggage::BaggageManagerComponent
 class Baggage {
  public:
+  using AllowedKeys = std::unordered_set<std::string>;
+
   Baggage(std::string header, std::unordered_set<std::string> allowed_keys);
+  Baggage(std::string header, std::shared_ptr<const AllowedKeys> allowed_keys);
   Baggage(const Baggage&) noexcept;
   Baggage(Baggage&&) noexcept;
+  Baggage& operator=(const Baggage&);
+  Baggage& operator=(Baggage&&) noexcept;
 
-  std::string ToString() const;
+  /// @returns header for the outgoing requests, rendered once
+  const std::string& ToString() const;
 
   /// @return vector of entries
   const std::vector<BaggageEntry>& GetEntries() const;
@@ -122,33 +134,56 @@ class Baggage {
   /// @returns std::nullopt If key, value or properties
   /// don't match with requirements or if allowed_keys
   /// don't contain selected key
-  std::optional<BaggageEntry> TryMakeBaggageEntry(std::string_view entry);
+  std::optional<BaggageEntry> TryMakeBaggageEntry(std::string_view entry) const;
   static std::optional<BaggageEntryProperty> TryMakeBaggageEntryProperty(
       std::string_view property);
 
  private:
+  /// @brief Parse header_value_ once, safe to call concurrently
+  void EnsureParsed() const;
+
+  /// @brief Drop the parsed state after header_value_ modification
+  void ResetParsed() noexcept;
+
+  /// @brief Header to copy into a new Baggage, already parsed header is
+  /// taken in its valid form
+  const std::string& GetSourceHeader() const noexcept;
+  std::string& GetSourceHeader() noexcept;
+
   /// @brief Parse baggage_header and fill entries_
-  void FillEntries();
+  void FillEntries() const;
 
   /// @brief Create result_header
-  void CreateResultHeader();
+  void CreateResultHeader() const;
 
   std::string header_value_;
-  std::unordered_set<std::string> allowed_keys_;
-  std::vector<BaggageEntry> entries_;
+  std::shared_ptr<const AllowedKeys> allowed_keys_;
+
+  // Baggage is shared between the tasks of a request via
+  // engine::TaskInheritedVariable, so the lazy parsing is guarded
+  mutable std::mutex parse_mutex_;
+  mutable std::atomic<bool> is_parsed_{false};
+
+  // views into header_value_
+  mutable std::vector<BaggageEntry> entries_;
 
   // result header after parsing entities.
   // empty string if is_valid_header == true
-  std::string result_header_;
+  mutable std::string result_header_;
 
   // true if requested header == header for sending
-  bool is_valid_header_ = true;
+  mutable bool is_valid_header_ = true;
 };
 
 /// @brief Parsing function
 std::optional<Baggage> TryMakeBaggage(
     std::string header, std::unordered_set<std::string> allowed_keys);
 
+/// @overload
+std::optional<Baggage> TryMakeBaggage(
+    std::string header,
+    std::shared_ptr<const Baggage::AllowedKeys> allowed_keys);
+
 template <typename T>
 bool HasInvalidSymbols(const T& obj) {
   return std::find_if(obj.begin(), obj.end(), [](unsigned char x) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <unordered_set>
 
@@ -12,6 +13,10 @@ namespace baggage {
 
 struct BaggageSettings final {
   std::unordered_set<std::string> allowed_keys;
+
+  // Same keys, shared by all the baggage::Baggage instances created with this
+  // config, so that requests do not copy the set
+  std::shared_ptr<const std::unordered_set<std::string>> shared_allowed_keys;
 };
 
 BaggageSettings Parse(const formats::json::Value& value,
@@ -0,0 +1,107 @@
+#pragma once
+
+/// @file userver/cache/arena.hpp
+/// @brief @copybrief cache::Arena
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_containers
+///
+/// @brief A dedicated memory arena for the contents of a cache
+///
+/// If the framework is built with jemalloc, the memory is allocated from
+/// a separate jemalloc arena that bypasses the thread caches. The items of a
+/// cache snapshot do not interleave with the rest of the allocations of the
+/// service then, and the whole arena is returned to the OS at once when the
+/// snapshot is destroyed. Otherwise the global heap is used.
+///
+/// Usually there is one arena per cache snapshot: create a new arena for each
+/// full update, incremental updates copy the container into the same arena.
+///
+/// @see cache::ArenaAllocator
+class Arena final {
+ public:
+  /// Creates a new arena
+  static std::shared_ptr<Arena> Create();
+
+  /// Returns the memory of the arena to the OS. All the allocations of the
+  /// arena must be deallocated by this moment.
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  /// @throws std::bad_alloc
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  void Deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept;
+
+  /// Returns the number of bytes currently allocated in the arena
+  std::size_t GetAllocatedBytes() const;
+
+  /// Returns whether a dedicated jemalloc arena is used
+  bool IsDedicated() const noexcept;
+
+ private:
+  Arena();
+
+  std::optional<unsigned> arena_index_;
+  // only used with the global heap
+  std::atomic<std::size_t> allocated_bytes_{0};
+};
+
+/// @ingroup userver_containers
+///
+/// @brief An allocator for the standard containers that allocates the memory
+/// in a cache::Arena. The arena lives as long as any of its allocators.
+///
+/// @snippet cache/arena_test.cpp Sample arena allocator
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(std::shared_ptr<Arena> arena) noexcept
+      : arena_(std::move(arena)) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+      : arena_(other.arena_) {}
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept {
+    arena_->Deallocate(ptr, n * sizeof(T), alignof(T));
+  }
+
+  const std::shared_ptr<Arena>& GetArena() const noexcept { return arena_; }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const noexcept {
+    return arena_ == other.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+    return arena_ != other.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class ArenaAllocator;
+
+  std::shared_ptr<Arena> arena_;
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -67,6 +67,7 @@ struct Config final {
 
   AllowedUpdateTypes allowed_update_types;
   bool allow_first_update_failure;
+  bool first_update_background;
   std::optional<bool> force_periodic_update;
   bool config_updates_enabled;
   bool has_pre_assign_check;
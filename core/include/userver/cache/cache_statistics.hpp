@@ -38,6 +38,8 @@ struct Statistics final {
   UpdateStatistics full_update;
   UpdateStatistics incremental_update;
   std::atomic<std::size_t> documents_current_count{0};
+  std::atomic<std::size_t> memory_current_bytes{0};
+  std::atomic<bool> memory_reported{false};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats);
@@ -83,6 +85,11 @@ class UpdateStatisticsScope final {
   /// @param add the number of non-valid items newly received
   void IncreaseDocumentsParseFailures(std::size_t add);
 
+  /// @brief Report the memory used by the cache contents, e.g.
+  /// cache::Arena::GetAllocatedBytes(). The memory metric is only written
+  /// for the caches that report it.
+  void SetMemoryUsage(std::size_t bytes);
+
  private:
   void DoFinish(impl::UpdateState new_state);
 
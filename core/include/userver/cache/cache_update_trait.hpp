@@ -84,6 +84,9 @@ class CacheUpdateTrait {
   /// Checks for the presence of the flag for pre-assign check
   bool HasPreAssignCheck() const;
 
+  /// Checks whether the component starts without waiting for the first update
+  bool IsFirstUpdateInBackground() const;
+
   // For internal use only
   // TODO remove after TAXICOMMON-3959
   engine::TaskProcessor& GetCacheTaskProcessor() const;
@@ -4,26 +4,34 @@
 /// @brief @copybrief components::CachingComponentBase
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
 #include <fmt/format.h>
 
 #include <userver/cache/cache_update_trait.hpp>
+#include <userver/cache/change_set.hpp>
 #include <userver/cache/exceptions.hpp>
 #include <userver/compiler/demangle.hpp>
+#include <userver/components/component_context.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/components/loggable_component_base.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/concurrent/async_event_channel.hpp>
 #include <userver/dump/helpers.hpp>
 #include <userver/dump/meta.hpp>
 #include <userver/dump/operations.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
 #include <userver/utils/meta.hpp>
 #include <userver/utils/shared_readable_ptr.hpp>
+#include <userver/utils/statistics/entry.hpp>
 #include <userver/yaml_config/schema.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -62,6 +70,7 @@ namespace components {
 /// full-update-jitter | max. amount of time by which full-update-interval may be adjusted for requests dispersal | full-update-interval / 10
 /// updates-enabled | if false, cache updates are disabled (except for the first one if !first-update-fail-ok) | true
 /// first-update-fail-ok | whether first update failure is non-fatal | false
+/// first-update-background | whether to start the component without waiting for the first update, see below | false
 /// task-processor | the name of the TaskProcessor for running DoWork | main-task-processor
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 /// exception-interval | Used instead of `update-interval` in case of exception | update_interval
@@ -104,10 +113,34 @@ namespace components {
 /// `required`    | make a synchronous update of type `first-update-type`, stop the service on failure
 /// `best-effort` | make a synchronous update of type `first-update-type`, keep working and use data from dump on failure
 ///
+/// ### first-update-background
+/// With `first-update-background: true` the component starts without waiting
+/// for the first update, the update is made by the periodic update task right
+/// after the start and is retried after `exception-interval` on failures.
+/// Until the cache gets its contents, Get() throws cache::EmptyCacheError,
+/// Get(engine::Deadline) waits for the contents, and the component reports
+/// components::ComponentHealth::kFatal, so that server::handlers::Ping reports
+/// the service as not ready. The option is ignored if a dump is loaded or
+/// the periodic updates are disabled in testsuite.
+///
+/// ### Subscribers statistics
+/// The time it takes each subscriber to process a cache update, counted from
+/// the moment the new value is set, is exported as `cache.subscribers` metrics
+/// with `cache_name`, `channel` and `listener` labels. Subscribers that only
+/// store the new value may use AsyncEventChannel::AddInlineListener on
+/// GetEventChannel() to avoid starting a task per update.
+///
 /// ### testsuite-force-periodic-update
 ///  use it to enable periodic cache update for a component in testsuite environment
 ///  where testsuite-periodic-update-enabled from TestsuiteSupport config is false
 ///
+/// ### Incremental change notifications
+/// Dependent caches may subscribe with UpdateAndListenChanges to receive the
+/// keys changed by each update along with the new snapshot, and update
+/// their own data incrementally instead of rebuilding it. The keys are
+/// available only if the derived cache publishes them with SetWithChanges,
+/// otherwise the subscribers receive only the snapshot.
+///
 /// By default, update types are guessed based on update intervals presence.
 /// If both `update-interval` and `full-update-interval` are present,
 /// `full-and-incremental` types is assumed. Otherwise `only-full` is used.
@@ -136,6 +169,13 @@ class CachingComponentBase : public LoggableComponentBase,
   /// returns true.
   utils::SharedReadablePtr<T> Get() const;
 
+  /// @brief Waits for the cache contents if the cache is empty, e.g. during
+  /// the first update made in background.
+  /// @return cache contents. May be nullptr if and only if MayReturnNull()
+  /// returns true.
+  /// @throws cache::EmptyCacheError if the cache is still empty at `deadline`
+  utils::SharedReadablePtr<T> Get(engine::Deadline deadline) const;
+
   /// @return cache contents. May be nullptr regardless of MayReturnNull().
   utils::SharedReadablePtr<T> GetUnsafe() const;
 
@@ -149,12 +189,32 @@ class CachingComponentBase : public LoggableComponentBase,
   concurrent::AsyncEventChannel<const std::shared_ptr<const T>&>&
   GetEventChannel();
 
+  /// Subscribes to cache updates with the changed keys using a member
+  /// function. Also immediately invokes the function with the current cache
+  /// contents and unknown changes. See cache::CacheChanges.
+  template <class Class>
+  concurrent::AsyncEventSubscriberScope UpdateAndListenChanges(
+      Class* obj, std::string name,
+      void (Class::*func)(const cache::CacheChanges<T>&));
+
+  concurrent::AsyncEventChannel<const cache::CacheChanges<T>&>&
+  GetChangesChannel();
+
+  /// Reports kFatal until a cache with `first-update-background: true` gets
+  /// its contents
+  ComponentHealth GetComponentHealth() const override;
+
   static yaml_config::Schema GetStaticConfigSchema();
 
  protected:
   void Set(std::unique_ptr<const T> value_ptr);
   void Set(T&& value);
 
+  /// Same as Set, but also notifies the UpdateAndListenChanges subscribers
+  /// about the keys changed since the previous snapshot
+  void SetWithChanges(std::unique_ptr<const T> value_ptr,
+                      const cache::ChangeSet<cache::ChangeSetKey<T>>& changes);
+
   template <typename... Args>
   void Emplace(Args&&... args);
 
@@ -188,9 +248,19 @@ class CachingComponentBase : public LoggableComponentBase,
   virtual void PreAssignCheck(const T* old_value_ptr,
                               const T* new_value_ptr) const;
 
+  void DoSet(std::unique_ptr<const T> value_ptr,
+             const cache::ChangeSet<cache::ChangeSetKey<T>>* changes);
+
   rcu::Variable<std::shared_ptr<const T>> cache_;
   concurrent::AsyncEventChannel<const std::shared_ptr<const T>&> event_channel_;
+  concurrent::AsyncEventChannel<const cache::CacheChanges<T>&>
+      changes_channel_;
   utils::impl::WaitTokenStorage wait_token_storage_;
+  utils::statistics::Entry subscribers_statistics_holder_;
+
+  // Wakes up the Get(engine::Deadline) callers when the cache gets contents
+  mutable engine::Mutex contents_mutex_;
+  mutable engine::ConditionVariable contents_cv_;
 };
 
 template <typename T>
@@ -202,8 +272,27 @@ CachingComponentBase<T>::CachingComponentBase(const ComponentConfig& config,
                      [this](auto& function) {
                        const auto ptr = cache_.ReadCopy();
                        if (ptr) function(ptr);
-                     }) {
+                     }),
+      changes_channel_(components::GetCurrentComponentName(config) +
+                           "-changes",
+                       [this](auto& function) {
+                         const auto ptr = cache_.ReadCopy();
+                         if (ptr) function(cache::CacheChanges<T>{ptr});
+                       }) {
   const auto initial_config = GetConfig();
+
+  subscribers_statistics_holder_ =
+      context.FindComponent<components::StatisticsStorage>()
+          .GetStorage()
+          .RegisterWriter(
+              "cache.subscribers", [this](utils::statistics::Writer& writer) {
+                writer.ValueWithLabels(
+                    event_channel_,
+                    {{"cache_name", Name()}, {"channel", "update"}});
+                writer.ValueWithLabels(
+                    changes_channel_,
+                    {{"cache_name", Name()}, {"channel", "changes"}});
+              });
 }
 
 template <typename T>
@@ -224,6 +313,25 @@ utils::SharedReadablePtr<T> CachingComponentBase<T>::Get() const {
   return ptr;
 }
 
+template <typename T>
+utils::SharedReadablePtr<T> CachingComponentBase<T>::Get(
+    engine::Deadline deadline) const {
+  if (!GetUnsafe()) {
+    std::unique_lock lock(contents_mutex_);
+    [[maybe_unused]] const bool has_contents = contents_cv_.WaitUntil(
+        lock, deadline, [this] { return GetUnsafe() != nullptr; });
+  }
+  return Get();
+}
+
+template <typename T>
+ComponentHealth CachingComponentBase<T>::GetComponentHealth() const {
+  if (IsFirstUpdateInBackground() && !GetUnsafe()) {
+    return ComponentHealth::kFatal;
+  }
+  return ComponentHealth::kOk;
+}
+
 template <typename T>
 template <typename Class>
 concurrent::AsyncEventSubscriberScope CachingComponentBase<T>::UpdateAndListen(
@@ -241,6 +349,24 @@ CachingComponentBase<T>::GetEventChannel() {
   return event_channel_;
 }
 
+template <typename T>
+template <typename Class>
+concurrent::AsyncEventSubscriberScope
+CachingComponentBase<T>::UpdateAndListenChanges(
+    Class* obj, std::string name,
+    void (Class::*func)(const cache::CacheChanges<T>&)) {
+  return changes_channel_.DoUpdateAndListen(obj, std::move(name), func, [&] {
+    const auto ptr = Get();
+    (obj->*func)(cache::CacheChanges<T>{ptr});
+  });
+}
+
+template <typename T>
+concurrent::AsyncEventChannel<const cache::CacheChanges<T>&>&
+CachingComponentBase<T>::GetChangesChannel() {
+  return changes_channel_;
+}
+
 template <typename T>
 utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
   return utils::SharedReadablePtr<T>(cache_.ReadCopy());
@@ -248,6 +374,22 @@ utils::SharedReadablePtr<T> CachingComponentBase<T>::GetUnsafe() const {
 
 template <typename T>
 void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
+  DoSet(std::move(value_ptr), nullptr);
+}
+
+template <typename T>
+void CachingComponentBase<T>::SetWithChanges(
+    std::unique_ptr<const T> value_ptr,
+    const cache::ChangeSet<cache::ChangeSetKey<T>>& changes) {
+  static_assert(cache::kHasChangeSetKey<T>,
+                "The cache contents must have a key_type to report changes");
+  DoSet(std::move(value_ptr), &changes);
+}
+
+template <typename T>
+void CachingComponentBase<T>::DoSet(
+    std::unique_ptr<const T> value_ptr,
+    const cache::ChangeSet<cache::ChangeSetKey<T>>* changes) {
   auto deleter = [token = wait_token_storage_.GetToken(),
                   &cache_task_processor =
                       GetCacheTaskProcessor()](const T* raw_ptr) mutable {
@@ -271,7 +413,16 @@ void CachingComponentBase<T>::Set(std::unique_ptr<const T> value_ptr) {
   }
 
   cache_.Assign(new_value);
+  if (new_value) {
+    // Makes sure that the waiters either see the new value or are already
+    // waiting for the notification
+    {
+      const std::lock_guard lock(contents_mutex_);
+    }
+    contents_cv_.NotifyAll();
+  }
   event_channel_.SendEvent(new_value);
+  changes_channel_.SendEvent(cache::CacheChanges<T>{new_value, changes});
   OnCacheModified();
 }
 
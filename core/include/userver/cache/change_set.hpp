@@ -0,0 +1,66 @@
+#pragma once
+
+/// @file userver/cache/change_set.hpp
+/// @brief @copybrief cache::ChangeSet
+
+#include <memory>
+#include <vector>
+
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+namespace impl {
+
+template <typename T>
+using KeyTypeImpl = typename T::key_type;
+
+struct NoKey final {};
+
+}  // namespace impl
+
+/// The key type of the cache::ChangeSet of a cache with contents of type `T`:
+/// `T::key_type` for associative containers
+template <typename T>
+using ChangeSetKey = meta::DetectedOr<impl::NoKey, impl::KeyTypeImpl, T>;
+
+/// Whether caches with contents of type `T` may report their changes
+template <typename T>
+inline constexpr bool kHasChangeSetKey =
+    meta::kIsDetected<impl::KeyTypeImpl, T>;
+
+/// @brief Keys changed by a cache update, relative to the previous snapshot
+///
+/// A key updated several times within one update may appear in both
+/// `inserted` and `updated`.
+template <typename Key>
+struct ChangeSet final {
+  bool IsEmpty() const noexcept {
+    return inserted.empty() && updated.empty() && erased.empty();
+  }
+
+  std::vector<Key> inserted;
+  std::vector<Key> updated;
+  std::vector<Key> erased;
+};
+
+/// @brief The event sent to the subscribers of
+/// components::CachingComponentBase::UpdateAndListenChanges
+template <typename T>
+struct CacheChanges final {
+  using Key = ChangeSetKey<T>;
+
+  /// The new contents of the cache, may be nullptr
+  std::shared_ptr<const T> snapshot;
+
+  /// The keys changed since the previous event, nullptr if they are unknown,
+  /// e.g. after a full update, on subscription or after loading a dump. In
+  /// that case the subscriber should process the whole snapshot.
+  const ChangeSet<Key>* changes{nullptr};
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
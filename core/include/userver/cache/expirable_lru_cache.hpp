@@ -5,18 +5,29 @@
 
 #include <atomic>
 #include <chrono>
+#include <cmath>
+#include <exception>
+#include <memory>
 #include <optional>
+#include <unordered_map>
+#include <utility>
 
 #include <userver/cache/lru_cache_config.hpp>
 #include <userver/cache/lru_cache_statistics.hpp>
 #include <userver/cache/nway_lru_cache.hpp>
-#include <userver/concurrent/mutex_set.hpp>
+#include <userver/cache/policy.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/engine/async.hpp>
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/impl/cached_time.hpp>
 #include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -28,6 +39,8 @@ template <typename Value>
 struct ExpirableValue final {
   Value value;
   std::chrono::steady_clock::time_point update_time;
+  // not dumped, zero if unknown
+  std::chrono::steady_clock::duration update_duration{};
 };
 
 template <typename Value>
@@ -44,9 +57,77 @@ impl::ExpirableValue<Value> Read(dump::Reader& reader,
   // Evaluation order of arguments is guaranteed in brace-initialization.
   return impl::ExpirableValue<Value>{
       reader.Read<Value>(),
-      reader.Read<std::chrono::system_clock::time_point>() - now + steady_now};
+      reader.Read<std::chrono::system_clock::time_point>() - now + steady_now,
+      {}};
 }
 
+/// The result of a value update, shared by the concurrent callers
+template <typename Value>
+class InFlightUpdate final {
+ public:
+  void SetValue(const Value& value) {
+    std::lock_guard lock(mutex_);
+    value_.emplace(value);
+    cv_.NotifyAll();
+  }
+
+  void SetException(std::exception_ptr exception) {
+    std::lock_guard lock(mutex_);
+    exception_ = std::move(exception);
+    cv_.NotifyAll();
+  }
+
+  /// Waits for the update to finish, rethrows the exception of the update
+  Value Get() {
+    std::unique_lock lock(mutex_);
+    if (!cv_.Wait(lock, [this] { return value_ || exception_; })) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+    if (exception_) std::rethrow_exception(exception_);
+    return *value_;
+  }
+
+ private:
+  engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  std::optional<Value> value_;
+  std::exception_ptr exception_;
+};
+
+/// Value updates that are currently running, at most one per key
+template <typename Key, typename Value, typename Hash, typename Equal>
+class InFlightUpdates final {
+ public:
+  using UpdatePtr = std::shared_ptr<InFlightUpdate<Value>>;
+
+  InFlightUpdates(const Hash& hash, const Equal& equal)
+      : updates_(0, hash, equal) {}
+
+  /// @returns the running update of the key and `false`, or a new update and
+  /// `true`. In the latter case the caller must run the update and call
+  /// `Finish`.
+  std::pair<UpdatePtr, bool> Start(const Key& key) {
+    std::lock_guard lock(mutex_);
+    const auto it = updates_.find(key);
+    if (it != updates_.end()) return {it->second, false};
+
+    auto update = std::make_shared<InFlightUpdate<Value>>();
+    updates_.emplace(key, update);
+    return {std::move(update), true};
+  }
+
+  void Finish(const Key& key) {
+    std::lock_guard lock(mutex_);
+    updates_.erase(key);
+  }
+
+ private:
+  // only taken on cache misses and updates
+  engine::Mutex mutex_;
+  std::unordered_map<Key, UpdatePtr, Hash, Equal> updates_;
+};
+
 }  // namespace impl
 
 /// @ingroup userver_containers
@@ -61,6 +142,7 @@ template <typename Key, typename Value, typename Hash = std::hash<Key>,
 class ExpirableLruCache final {
  public:
   using UpdateValueFunc = std::function<Value(const Key&)>;
+  using WeightFunc = std::function<std::size_t(const Key&, const Value&)>;
 
   /// Cache read mode
   enum class ReadMode {
@@ -68,10 +150,11 @@ class ExpirableLruCache final {
     kUseCache,   ///< Cache value got from update function
   };
 
-  /// For the description of `ways` and `way_size`,
+  /// For the description of `ways`, `way_size` and `policy`,
   /// see the cache::NWayLRU::NWayLRU constructor.
   ExpirableLruCache(size_t ways, size_t way_size, const Hash& hash = Hash(),
-                    const Equal& equal = Equal());
+                    const Equal& equal = Equal(),
+                    CachePolicy policy = CachePolicy::kLRU);
 
   ~ExpirableLruCache();
 
@@ -79,6 +162,15 @@ class ExpirableLruCache final {
   /// see the cache::NWayLRU::NWayLRU constructor.
   void SetWaySize(size_t way_size);
 
+  /// For the description of `way_max_weight`,
+  /// see cache::NWayLRU::UpdateWayMaxWeight.
+  void SetWayMaxWeight(size_t way_max_weight);
+
+  /// Sets the function that computes the weight of the values, e.g. their
+  /// size in bytes. Must be called on an empty cache before any other method.
+  /// This method is not thread-safe. See cache::NWayLRU::SetWeightFunction.
+  void SetWeightFunction(WeightFunc weight_func);
+
   std::chrono::milliseconds GetMaxLifetime() const noexcept;
 
   void SetMaxLifetime(std::chrono::milliseconds max_lifetime);
@@ -90,10 +182,22 @@ class ExpirableLruCache final {
    */
   void SetBackgroundUpdate(BackgroundUpdateMode background_update);
 
+  /**
+   * Sets the probabilistic early refresh (XFetch) factor. If "beta" is
+   * positive, a cache hit starts a background update with a probability
+   * that grows as the value approaches its expiration, and grows faster for
+   * values with longer update duration. 0 disables the early refresh,
+   * 1 is a good starting point.
+   */
+  void SetEarlyRefreshBeta(double beta);
+
   /**
    * @returns GetOptional("key", update_func) if it is not std::nullopt.
    * Otherwise the result of update_func(key) is returned, and additionally
    * stored in cache if "read_mode" is kUseCache.
+   *
+   * Concurrent calls for the same missing key are coalesced: only one of them
+   * calls update_func, the others wait for its result or exception.
    */
   Value Get(const Key& key, const UpdateValueFunc& update_func,
             ReadMode read_mode = ReadMode::kUseCache);
@@ -135,6 +239,16 @@ class ExpirableLruCache final {
 
   size_t GetSizeApproximate() const;
 
+  /// Returns the number of values dropped by the CachePolicy::kWTinyLFU
+  /// admission policy
+  size_t GetAdmissionRejectsApproximate() const;
+
+  /// Returns the total weight of the values, see SetWeightFunction
+  size_t GetWeightApproximate() const;
+
+  /// Returns the weight statistics, std::nullopt if no weight function is set
+  std::optional<impl::ExpirableLruCacheWeight> GetWeightStatistics() const;
+
   /// Clear cache
   void Invalidate();
 
@@ -159,21 +273,33 @@ class ExpirableLruCache final {
   bool ShouldUpdate(std::chrono::steady_clock::time_point update_time,
                     std::chrono::steady_clock::time_point now) const;
 
+  bool ShouldRefreshEarly(const impl::ExpirableValue<Value>& value,
+                          std::chrono::steady_clock::time_point now) const;
+
+  Value RunUpdate(const Key& key, const UpdateValueFunc& update_func,
+                  ReadMode read_mode, impl::InFlightUpdate<Value>& update);
+
   cache::NWayLRU<Key, impl::ExpirableValue<Value>, Hash, Equal> lru_;
+  const std::size_t ways_;
+  bool has_weight_function_{false};
+  std::atomic<std::size_t> way_max_weight_{0};
   std::atomic<std::chrono::milliseconds> max_lifetime_{
       std::chrono::milliseconds(0)};
   std::atomic<BackgroundUpdateMode> background_update_mode_{
       BackgroundUpdateMode::kDisabled};
+  std::atomic<double> early_refresh_beta_{0};
   impl::ExpirableLruCacheStatistics stats_;
-  concurrent::MutexSet<Key, Hash, Equal> mutex_set_;
+  impl::InFlightUpdates<Key, Value, Hash, Equal> in_flight_updates_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 };
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::ExpirableLruCache(
-    size_t ways, size_t way_size, const Hash& hash, const Equal& equal)
-    : lru_(ways, way_size, hash, equal),
-      mutex_set_{ways, way_size, hash, equal} {}
+    size_t ways, size_t way_size, const Hash& hash, const Equal& equal,
+    CachePolicy policy)
+    : lru_(ways, way_size, hash, equal, policy),
+      ways_(ways),
+      in_flight_updates_(hash, equal) {}
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 ExpirableLruCache<Key, Value, Hash, Equal>::~ExpirableLruCache() {
@@ -185,6 +311,28 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetWaySize(size_t way_size) {
   lru_.UpdateWaySize(way_size);
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWayMaxWeight(
+    size_t way_max_weight) {
+  way_max_weight_ = way_max_weight;
+  lru_.UpdateWayMaxWeight(way_max_weight);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetWeightFunction(
+    WeightFunc weight_func) {
+  has_weight_function_ = static_cast<bool>(weight_func);
+  if (!weight_func) {
+    lru_.SetWeightFunction({});
+    return;
+  }
+  lru_.SetWeightFunction(
+      [weight_func = std::move(weight_func)](
+          const Key& key, const impl::ExpirableValue<Value>& value) {
+        return weight_func(key, value.value);
+      });
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 std::chrono::milliseconds
 ExpirableLruCache<Key, Value, Hash, Equal>::GetMaxLifetime() const noexcept {
@@ -203,29 +351,51 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::SetBackgroundUpdate(
   background_update_mode_ = background_update;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+void ExpirableLruCache<Key, Value, Hash, Equal>::SetEarlyRefreshBeta(
+    double beta) {
+  early_refresh_beta_ = beta;
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 Value ExpirableLruCache<Key, Value, Hash, Equal>::Get(
     const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode) {
-  auto now = utils::datetime::SteadyNow();
   auto opt_old_value = GetOptional(key, update_func);
   if (opt_old_value) {
     return std::move(*opt_old_value);
   }
 
-  auto mutex = mutex_set_.GetMutexForKey(key);
-  std::lock_guard lock(mutex);
-  // Test one more time - concurrent ExpirableLruCache::Get()
-  // might have put the value
-  auto old_value = lru_.Get(key);
-  if (old_value && !IsExpired(old_value->update_time, now)) {
-    return std::move(old_value->value);
-  }
+  auto [update, is_started] = in_flight_updates_.Start(key);
+  if (!is_started) return update->Get();
 
-  auto value = update_func(key);
-  if (read_mode == ReadMode::kUseCache) {
-    lru_.Put(key, {value, now});
+  utils::ScopeGuard finish([this, &key] { in_flight_updates_.Finish(key); });
+  return RunUpdate(key, update_func, read_mode, *update);
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value ExpirableLruCache<Key, Value, Hash, Equal>::RunUpdate(
+    const Key& key, const UpdateValueFunc& update_func, ReadMode read_mode,
+    impl::InFlightUpdate<Value>& update) {
+  try {
+    auto now = utils::datetime::SteadyNow();
+    // Test one more time - concurrent ExpirableLruCache::Get()
+    // might have put the value
+    auto old_value = lru_.Get(key);
+    if (old_value && !IsExpired(old_value->update_time, now)) {
+      update.SetValue(old_value->value);
+      return std::move(old_value->value);
+    }
+
+    auto value = update_func(key);
+    if (read_mode == ReadMode::kUseCache) {
+      lru_.Put(key, {value, now, utils::datetime::SteadyNow() - now});
+    }
+    update.SetValue(value);
+    return value;
+  } catch (...) {
+    update.SetException(std::current_exception());
+    throw;
   }
-  return value;
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -238,7 +408,8 @@ std::optional<Value> ExpirableLruCache<Key, Value, Hash, Equal>::GetOptional(
     if (!IsExpired(old_value->update_time, now)) {
       impl::CacheHit(stats_);
 
-      if (ShouldUpdate(old_value->update_time, now)) {
+      if (ShouldUpdate(old_value->update_time, now) ||
+          ShouldRefreshEarly(*old_value, now)) {
         UpdateInBackground(key, update_func);
       }
 
@@ -312,13 +483,13 @@ ExpirableLruCache<Key, Value, Hash, Equal>::GetOptionalNoUpdate(
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
                                                      const Value& value) {
-  lru_.Put(key, {value, utils::datetime::SteadyNow()});
+  lru_.Put(key, {value, utils::datetime::SteadyNow(), {}});
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Put(const Key& key,
                                                      Value&& value) {
-  lru_.Put(key, {std::move(value), utils::datetime::SteadyNow()});
+  lru_.Put(key, {std::move(value), utils::datetime::SteadyNow(), {}});
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
@@ -332,6 +503,27 @@ size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetSizeApproximate() const {
   return lru_.GetSize();
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t
+ExpirableLruCache<Key, Value, Hash, Equal>::GetAdmissionRejectsApproximate()
+    const {
+  return lru_.GetAdmissionRejects();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+size_t ExpirableLruCache<Key, Value, Hash, Equal>::GetWeightApproximate()
+    const {
+  return lru_.GetWeight();
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+std::optional<impl::ExpirableLruCacheWeight>
+ExpirableLruCache<Key, Value, Hash, Equal>::GetWeightStatistics() const {
+  if (!has_weight_function_) return std::nullopt;
+  return impl::ExpirableLruCacheWeight{GetWeightApproximate(),
+                                       way_max_weight_.load() * ways_};
+}
+
 template <typename Key, typename Value, typename Hash, typename Equal>
 void ExpirableLruCache<Key, Value, Hash, Equal>::Invalidate() {
   lru_.Invalidate();
@@ -352,16 +544,22 @@ void ExpirableLruCache<Key, Value, Hash, Equal>::UpdateInBackground(
   // cache will wait for all detached tasks in ~ExpirableLruCache()
   engine::AsyncNoSpan([token = wait_token_storage_.GetToken(), this, key,
                        update_func = std::move(update_func)] {
-    auto mutex = mutex_set_.GetMutexForKey(key);
-    std::unique_lock lock(mutex, std::try_to_lock);
-    if (!lock) {
+    auto [update, is_started] = in_flight_updates_.Start(key);
+    if (!is_started) {
       // someone is updating the key right now
       return;
     }
 
-    auto now = utils::datetime::SteadyNow();
-    auto value = update_func(key);
-    lru_.Put(key, {value, now});
+    utils::ScopeGuard finish([this, &key] { in_flight_updates_.Finish(key); });
+    try {
+      auto now = utils::datetime::SteadyNow();
+      auto value = update_func(key);
+      lru_.Put(key, {value, now, utils::datetime::SteadyNow() - now});
+      update->SetValue(value);
+    } catch (...) {
+      update->SetException(std::current_exception());
+      throw;
+    }
   }).Detach();
 }
 
@@ -382,6 +580,25 @@ bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldUpdate(
          max_lifetime.count() != 0 && update_time + max_lifetime / 2 < now;
 }
 
+template <typename Key, typename Value, typename Hash, typename Equal>
+bool ExpirableLruCache<Key, Value, Hash, Equal>::ShouldRefreshEarly(
+    const impl::ExpirableValue<Value>& value,
+    std::chrono::steady_clock::time_point now) const {
+  const auto beta = early_refresh_beta_.load();
+  const auto max_lifetime = max_lifetime_.load();
+  if (beta <= 0 || max_lifetime.count() == 0 ||
+      value.update_duration.count() <= 0) {
+    return false;
+  }
+
+  // XFetch: refresh if now - duration * beta * ln(rand) >= expiration time
+  const auto gap = std::chrono::duration<double>(value.update_duration) *
+                   beta * -std::log(1.0 - utils::RandRange(1.0));
+  return now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                   gap) >=
+         value.update_time + max_lifetime;
+}
+
 template <typename Key, typename Value, typename Hash = std::hash<Key>,
           typename Equal = std::equal_to<Key>>
 class LruCacheWrapper final {
@@ -441,6 +658,8 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCache<Key, Value, Hash, Equal>& cache) {
   writer["current-documents-count"] = cache.GetSizeApproximate();
+  writer["admission-rejects"] = cache.GetAdmissionRejectsApproximate();
+  if (const auto weight = cache.GetWeightStatistics()) writer = *weight;
   writer = cache.GetStatistics();
 }
 
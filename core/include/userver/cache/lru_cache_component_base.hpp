@@ -56,8 +56,12 @@ yaml_config::Schema GetLruCacheComponentBaseSchema();
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// size | max amount of items to store in cache | --
+/// max-weight | max total weight of the items, e.g. in bytes; requires a weight function passed to the constructor (0 is unlimited) | 0
 /// ways | number of ways for associative cache | --
+/// policy | eviction policy: `lru`, `w-tinylfu` or `clock`, see cache::CachePolicy | lru
 /// lifetime | TTL for cache entries (0 is unlimited) | 0
+/// background-update | enables asynchronous updates for expiring values | false
+/// early-refresh-beta | factor of the probabilistic early refresh of the values that are about to expire, see cache::ExpirableLruCache::SetEarlyRefreshBeta (0 is disabled) | 0
 /// config-settings | enables dynamic reconfiguration with CacheConfigSet | true
 ///
 /// ## Example usage:
@@ -79,10 +83,18 @@ class LruCacheComponent : public components::LoggableComponentBase,
  public:
   using Cache = ExpirableLruCache<Key, Value, Hash, Equal>;
   using CacheWrapper = LruCacheWrapper<Key, Value, Hash, Equal>;
+  using WeightFunc = typename Cache::WeightFunc;
 
   LruCacheComponent(const components::ComponentConfig&,
                     const components::ComponentContext&);
 
+  /// @param weight_func computes the weight of the values, e.g. their size in
+  /// bytes, the total weight is limited by the `max-weight` option.
+  /// See cache::ExpirableLruCache::SetWeightFunction.
+  LruCacheComponent(const components::ComponentConfig&,
+                    const components::ComponentContext&,
+                    WeightFunc weight_func);
+
   ~LruCacheComponent() override;
 
   CacheWrapper GetCache();
@@ -125,11 +137,23 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
     const components::ComponentConfig& config,
     const components::ComponentContext& context)
+    : LruCacheComponent(config, context, WeightFunc{}) {}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context, WeightFunc weight_func)
     : LoggableComponentBase(config, context),
       name_(components::GetCurrentComponentName(config)),
       static_config_(config),
       cache_(std::make_shared<Cache>(static_config_.ways,
-                                     static_config_.GetWaySize())) {
+                                     static_config_.GetWaySize(), Hash{},
+                                     Equal{}, static_config_.policy)) {
+  if (weight_func) {
+    cache_->SetWeightFunction(std::move(weight_func));
+    cache_->SetWayMaxWeight(static_config_.GetWayMaxWeight());
+  }
+
   if (impl::IsDumpSupportEnabled(config)) {
     dumper_ = std::make_shared<dump::Dumper>(
         config, context, static_cast<dump::DumpableEntity&>(*this));
@@ -139,6 +163,7 @@ LruCacheComponent<Key, Value, Hash, Equal>::LruCacheComponent(
 
   cache_->SetMaxLifetime(static_config_.config.lifetime);
   cache_->SetBackgroundUpdate(static_config_.config.background_update);
+  cache_->SetEarlyRefreshBeta(static_config_.config.early_refresh_beta);
 
   if (static_config_.use_dynamic_config) {
     LOG_INFO() << "Dynamic LRU cache config is enabled, subscribing on "
@@ -205,8 +230,10 @@ template <typename Key, typename Value, typename Hash, typename Equal>
 void LruCacheComponent<Key, Value, Hash, Equal>::UpdateConfig(
     const LruCacheConfig& config) {
   cache_->SetWaySize(config.GetWaySize(static_config_.ways));
+  cache_->SetWayMaxWeight(config.GetWayMaxWeight(static_config_.ways));
   cache_->SetMaxLifetime(config.lifetime);
   cache_->SetBackgroundUpdate(config.background_update);
+  cache_->SetEarlyRefreshBeta(config.early_refresh_beta);
 }
 
 template <typename Key, typename Value, typename Hash, typename Equal>
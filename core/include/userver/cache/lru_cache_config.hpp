@@ -5,6 +5,7 @@
 #include <optional>
 #include <unordered_map>
 
+#include <userver/cache/policy.hpp>
 #include <userver/components/component_fwd.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -27,9 +28,13 @@ struct LruCacheConfig final {
 
   std::size_t GetWaySize(std::size_t ways) const;
 
+  std::size_t GetWayMaxWeight(std::size_t ways) const;
+
   std::size_t size;
+  std::size_t max_weight;
   std::chrono::milliseconds lifetime;
   BackgroundUpdateMode background_update;
+  double early_refresh_beta;
 };
 
 LruCacheConfig Parse(const formats::json::Value& value,
@@ -41,8 +46,11 @@ struct LruCacheConfigStatic final {
 
   std::size_t GetWaySize() const;
 
+  std::size_t GetWayMaxWeight() const;
+
   LruCacheConfig config;
   std::size_t ways;
+  CachePolicy policy;
   bool use_dynamic_config;
 };
 
@@ -34,6 +34,13 @@ struct ExpirableLruCacheStatistics final {
       recent{std::chrono::seconds(5), std::chrono::seconds(60)};
 };
 
+/// Weight of the items of a cache with a weight function
+struct ExpirableLruCacheWeight final {
+  std::size_t current{0};
+  /// 0 if the weight is not limited
+  std::size_t max{0};
+};
+
 void CacheHit(ExpirableLruCacheStatistics& stats);
 
 void CacheMiss(ExpirableLruCacheStatistics& stats);
@@ -43,6 +50,9 @@ void CacheStale(ExpirableLruCacheStatistics& stats);
 void DumpMetric(utils::statistics::Writer& writer,
                 const ExpirableLruCacheStatistics& stats);
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExpirableLruCacheWeight& weight);
+
 }  // namespace cache::impl
 
 USERVER_NAMESPACE_END
@@ -1,13 +1,19 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <variant>
 #include <vector>
 
 #include <userver/cache/lru_map.hpp>
+#include <userver/cache/policy.hpp>
 #include <userver/dump/dumper.hpp>
 #include <userver/dump/operations.hpp>
-#include <userver/engine/mutex.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,9 +24,12 @@ template <typename T, typename U, typename Hash = std::hash<T>,
           typename Equal = std::equal_to<T>>
 class NWayLRU final {
  public:
+  /// Returns the weight of an item, e.g. its size in bytes
+  using WeightFunction = std::function<std::size_t(const T&, const U&)>;
+
   /// @param ways is the number of ways (a.k.a. shards, internal hash-maps),
   /// into which elements are distributed based on their hash. Each shard is
-  /// protected by an individual mutex. Larger `ways` means more internal
+  /// protected by an individual shared mutex. Larger `ways` means more internal
   /// hash-map instances and more memory usage, but less contention. A good
   /// starting point is `ways=16`. If you encounter contention, you can increase
   /// `ways` to something on the order of `256` or whatever your RAM constraints
@@ -31,8 +40,13 @@ class NWayLRU final {
   /// according to the LRU policy.
   ///
   /// The maximum total number of elements is `ways * way_size`.
+  ///
+  /// @param policy is the eviction policy of each way, see cache::CachePolicy.
+  /// With CachePolicy::kClock cache hits take only a shared lock of the way,
+  /// which is preferable for read-mostly caches with high concurrency.
   NWayLRU(size_t ways, size_t way_size, const Hash& hash = Hash(),
-          const Equal& equal = Equal());
+          const Equal& equal = Equal(),
+          CachePolicy policy = CachePolicy::kLRU);
 
   void Put(const T& key, U value);
 
@@ -55,10 +69,34 @@ class NWayLRU final {
 
   size_t GetSize() const;
 
+  /// Returns the total weight of the items, 0 if no weight function is set
+  size_t GetWeight() const;
+
+  /// Returns the number of items dropped by the CachePolicy::kWTinyLFU
+  /// admission policy since the cache creation
+  size_t GetAdmissionRejects() const;
+
   /// For the description of `way_size`,
   /// see the cache::NWayLRU::NWayLRU constructor.
   void UpdateWaySize(size_t way_size);
 
+  /// Sets the maximum total weight of the items per way, see
+  /// cache::NWayLRU::SetWeightFunction. When the weight of a way exceeds
+  /// this number, the least used elements of the way are deleted. Items
+  /// heavier than `way_max_weight` are not stored. 0 means no limit.
+  ///
+  /// The maximum total weight of the elements is `ways * way_max_weight`.
+  void UpdateWayMaxWeight(size_t way_max_weight);
+
+  /// Sets the function that computes the weight of the items. Must be called
+  /// on an empty cache before any other method. This method is not
+  /// thread-safe.
+  ///
+  /// The function must return the same weight for the same key and value.
+  /// Without the weight function the cache is limited by the number of items
+  /// only, and `way_max_weight` is ignored.
+  void SetWeightFunction(WeightFunction weight_func);
+
   void Write(dump::Writer& writer) const;
   void Read(dump::Reader& reader);
 
@@ -68,41 +106,97 @@ class NWayLRU final {
 
  private:
   struct Way {
+    using Lru = LruMap<T, U, Hash, Equal, CachePolicy::kLRU>;
+    using WTinyLfu = LruMap<T, U, Hash, Equal, CachePolicy::kWTinyLFU>;
+    using Clock = LruMap<T, U, Hash, Equal, CachePolicy::kClock>;
+    using Cache = std::variant<Lru, WTinyLfu, Clock>;
+
     Way(Way&& other) noexcept : cache(std::move(other.cache)) {}
 
     // max_size is not used, will be reset by Resize() in NWayLRU::NWayLRU
-    Way(const Hash& hash, const Equal& equal) : cache(1, hash, equal) {}
+    Way(const Hash& hash, const Equal& equal, CachePolicy policy)
+        : cache(MakeCache(hash, equal, policy)) {}
+
+    template <typename Function>
+    decltype(auto) Visit(Function&& func) {
+      return std::visit(std::forward<Function>(func), cache);
+    }
+
+    template <typename Function>
+    decltype(auto) Visit(Function&& func) const {
+      return std::visit(std::forward<Function>(func), cache);
+    }
 
-    mutable engine::Mutex mutex;
-    LruMap<T, U, Hash, Equal> cache;
+    static Cache MakeCache(const Hash& hash, const Equal& equal,
+                           CachePolicy policy) {
+      switch (policy) {
+        case CachePolicy::kWTinyLFU:
+          return Cache(std::in_place_type<WTinyLfu>, 1, hash, equal);
+        case CachePolicy::kClock:
+          return Cache(std::in_place_type<Clock>, 1, hash, equal);
+        case CachePolicy::kLRU:
+          break;
+      }
+      return Cache(std::in_place_type<Lru>, 1, hash, equal);
+    }
+
+    mutable engine::SharedMutex mutex;
+    Cache cache;
+    // guarded by the mutex, only used with the weight function
+    std::size_t weight{0};
+    std::size_t max_weight{0};
   };
 
   Way& GetWay(const T& key);
 
+  template <typename Cache>
+  void PutWeighted(Way& way, Cache& cache, const T& key, U&& value);
+
+  template <typename Cache>
+  void Erase(Way& way, Cache& cache, const T& key, const U& value);
+
+  template <typename Cache>
+  void EvictLeastUsed(Way& way, Cache& cache);
+
+  template <typename Cache>
+  void TrimWay(Way& way, Cache& cache);
+
+  template <typename Cache>
+  void RecalculateWeight(Way& way, Cache& cache);
+
   void NotifyDumper();
 
   std::vector<Way> caches_;
   Hash hash_fn_;
   std::shared_ptr<dump::Dumper> dumper_{nullptr};
+  WeightFunction weight_func_;
 };
 
 template <typename T, typename U, typename Hash, typename Eq>
 NWayLRU<T, U, Hash, Eq>::NWayLRU(size_t ways, size_t way_size, const Hash& hash,
-                                 const Eq& equal)
+                                 const Eq& equal, CachePolicy policy)
     : caches_(), hash_fn_(hash) {
   caches_.reserve(ways);
-  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal);
+  for (size_t i = 0; i < ways; ++i) caches_.emplace_back(hash, equal, policy);
   if (ways == 0) throw std::logic_error("Ways must be positive");
 
-  for (auto& way : caches_) way.cache.SetMaxSize(way_size);
+  for (auto& way : caches_) {
+    way.Visit([way_size](auto& cache) { cache.SetMaxSize(way_size); });
+  }
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Put(const T& key, U value) {
   auto& way = GetWay(key);
   {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Put(key, std::move(value));
+    std::unique_lock<engine::SharedMutex> lock(way.mutex);
+    way.Visit([&](auto& cache) {
+      if (weight_func_) {
+        PutWeighted(way, cache, key, std::move(value));
+      } else {
+        cache.Put(key, std::move(value));
+      }
+    });
   }
   NotifyDumper();
 }
@@ -112,23 +206,49 @@ template <typename Validator>
 std::optional<U> NWayLRU<T, U, Hash, Eq>::Get(const T& key,
                                               Validator validator) {
   auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  auto* value = way.cache.Get(key);
+  if (auto* clock = std::get_if<typename Way::Clock>(&way.cache)) {
+    {
+      std::shared_lock<engine::SharedMutex> lock(way.mutex);
+      const auto* value = clock->GetShared(key);
+      if (!value) return std::nullopt;
+      if (validator(*value)) return *value;
+    }
 
-  if (value) {
-    if (validator(*value)) return *value;
-    way.cache.Erase(key);
+    // The value was rejected, it may have been updated while unlocked
+    std::unique_lock<engine::SharedMutex> lock(way.mutex);
+    const auto* value = clock->GetShared(key);
+    if (value) {
+      if (validator(*value)) return *value;
+      Erase(way, *clock, key, *value);
+    }
+    return std::nullopt;
   }
 
-  return std::nullopt;
+  std::unique_lock<engine::SharedMutex> lock(way.mutex);
+  return way.Visit([&](auto& cache) -> std::optional<U> {
+    auto* value = cache.Get(key);
+
+    if (value) {
+      if (validator(*value)) return *value;
+      Erase(way, cache, key, *value);
+    }
+
+    return std::nullopt;
+  });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
   auto& way = GetWay(key);
   {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Erase(key);
+    std::unique_lock<engine::SharedMutex> lock(way.mutex);
+    way.Visit([&](auto& cache) {
+      if (!weight_func_) {
+        cache.Erase(key);
+      } else if (const auto* value = cache.Get(key)) {
+        Erase(way, cache, key, *value);
+      }
+    });
   }
   NotifyDumper();
 }
@@ -136,15 +256,17 @@ void NWayLRU<T, U, Hash, Eq>::InvalidateByKey(const T& key) {
 template <typename T, typename U, typename Hash, typename Eq>
 U NWayLRU<T, U, Hash, Eq>::GetOr(const T& key, const U& default_value) {
   auto& way = GetWay(key);
-  std::unique_lock<engine::Mutex> lock(way.mutex);
-  return way.cache.GetOr(key, default_value);
+  std::unique_lock<engine::SharedMutex> lock(way.mutex);
+  return way.Visit(
+      [&](auto& cache) { return cache.GetOr(key, default_value); });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::Invalidate() {
   for (auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.Clear();
+    std::unique_lock<engine::SharedMutex> lock(way.mutex);
+    way.Visit([](auto& cache) { cache.Clear(); });
+    way.weight = 0;
   }
   NotifyDumper();
 }
@@ -153,8 +275,8 @@ template <typename T, typename U, typename Hash, typename Eq>
 template <typename Function>
 void NWayLRU<T, U, Hash, Eq>::VisitAll(Function func) const {
   for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.VisitAll(func);
+    std::shared_lock<engine::SharedMutex> lock(way.mutex);
+    way.Visit([&func](const auto& cache) { cache.VisitAll(func); });
   }
 }
 
@@ -162,18 +284,120 @@ template <typename T, typename U, typename Hash, typename Eq>
 size_t NWayLRU<T, U, Hash, Eq>::GetSize() const {
   size_t size{0};
   for (const auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    size += way.cache.GetSize();
+    std::shared_lock<engine::SharedMutex> lock(way.mutex);
+    size += way.Visit([](const auto& cache) { return cache.GetSize(); });
   }
   return size;
 }
 
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetWeight() const {
+  size_t weight{0};
+  for (const auto& way : caches_) {
+    std::shared_lock<engine::SharedMutex> lock(way.mutex);
+    weight += way.weight;
+  }
+  return weight;
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+size_t NWayLRU<T, U, Hash, Eq>::GetAdmissionRejects() const {
+  size_t rejects{0};
+  for (const auto& way : caches_) {
+    std::shared_lock<engine::SharedMutex> lock(way.mutex);
+    rejects += way.Visit(
+        [](const auto& cache) { return cache.GetAdmissionRejects(); });
+  }
+  return rejects;
+}
+
 template <typename T, typename U, typename Hash, typename Eq>
 void NWayLRU<T, U, Hash, Eq>::UpdateWaySize(size_t way_size) {
   for (auto& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
-    way.cache.SetMaxSize(way_size);
+    std::unique_lock<engine::SharedMutex> lock(way.mutex);
+    way.Visit([&](auto& cache) {
+      const auto old_way_size = cache.GetCapacity();
+      cache.SetMaxSize(way_size);
+      // the cache evicts the items on its own while shrinking
+      if (weight_func_ && way_size < old_way_size) {
+        RecalculateWeight(way, cache);
+      }
+    });
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::UpdateWayMaxWeight(size_t way_max_weight) {
+  for (auto& way : caches_) {
+    std::unique_lock<engine::SharedMutex> lock(way.mutex);
+    way.max_weight = way_max_weight;
+    way.Visit([&](auto& cache) { TrimWay(way, cache); });
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+void NWayLRU<T, U, Hash, Eq>::SetWeightFunction(WeightFunction weight_func) {
+  UASSERT_MSG(GetSize() == 0,
+              "The weight function must be set on an empty cache");
+  weight_func_ = std::move(weight_func);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Cache>
+void NWayLRU<T, U, Hash, Eq>::PutWeighted(Way& way, Cache& cache,
+                                          const T& key, U&& value) {
+  const auto weight = weight_func_(key, value);
+
+  if (const auto* old_value = cache.Get(key)) {
+    way.weight -= weight_func_(key, *old_value);
+  } else {
+    // make room here, so that the cache does not evict items on its own
+    while (cache.GetSize() >= cache.GetCapacity()) EvictLeastUsed(way, cache);
+  }
+
+  if (way.max_weight != 0 && weight > way.max_weight) {
+    cache.Erase(key);
+    return;
   }
+
+  cache.Put(key, std::move(value));
+  way.weight += weight;
+  TrimWay(way, cache);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Cache>
+void NWayLRU<T, U, Hash, Eq>::Erase(Way& way, Cache& cache, const T& key,
+                                    const U& value) {
+  if (weight_func_) way.weight -= weight_func_(key, value);
+  cache.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Cache>
+void NWayLRU<T, U, Hash, Eq>::EvictLeastUsed(Way& way, Cache& cache) {
+  const auto* key = cache.GetLeastUsedKey();
+  UASSERT(key);
+  const T victim = *key;
+  Erase(way, cache, victim, *cache.GetLeastUsed());
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Cache>
+void NWayLRU<T, U, Hash, Eq>::TrimWay(Way& way, Cache& cache) {
+  if (!weight_func_ || way.max_weight == 0) return;
+  while (way.weight > way.max_weight && cache.GetSize() != 0) {
+    EvictLeastUsed(way, cache);
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Eq>
+template <typename Cache>
+void NWayLRU<T, U, Hash, Eq>::RecalculateWeight(Way& way, Cache& cache) {
+  way.weight = 0;
+  cache.VisitAll([&](const T& key, const U& value) {
+    way.weight += weight_func_(key, value);
+  });
 }
 
 template <typename T, typename U, typename Hash, typename Eq>
@@ -194,13 +418,15 @@ void NWayLRU<T, U, Hash, Equal>::Write(dump::Writer& writer) const {
   writer.Write(caches_.size());
 
   for (const Way& way : caches_) {
-    std::unique_lock<engine::Mutex> lock(way.mutex);
+    std::shared_lock<engine::SharedMutex> lock(way.mutex);
 
-    writer.Write(way.cache.GetSize());
+    way.Visit([&writer](const auto& cache) {
+      writer.Write(cache.GetSize());
 
-    way.cache.VisitAll([&writer](const T& key, const U& value) {
-      writer.Write(key);
-      writer.Write(value);
+      cache.VisitAll([&writer](const T& key, const U& value) {
+        writer.Write(key);
+        writer.Write(value);
+      });
     });
   }
 }
@@ -33,6 +33,8 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-update-margin | time before the reply expiration when the requested record is updated in background | network-timeout
+/// cache-max-stale-ttl | limit for serving an expired reply while it is being updated | 24h
 ///
 /// ## Static configuration example:
 ///
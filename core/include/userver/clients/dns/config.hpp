@@ -4,6 +4,7 @@
 /// @brief @copybrief clients::dns::ResolverConfig
 
 #include <chrono>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,14 @@ struct ResolverConfig {
 
   /// Network cache failure TTL
   std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+  /// Time before the reply expiration when the requested record is updated
+  /// in background (network_timeout if not set)
+  std::optional<std::chrono::milliseconds> cache_update_margin;
+
+  /// Network cache upper limit for serving an expired reply while it is
+  /// being updated in background
+  std::chrono::milliseconds cache_max_stale_ttl{std::chrono::hours{24}};
 };
 
 }  // namespace clients::dns
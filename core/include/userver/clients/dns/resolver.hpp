@@ -34,6 +34,17 @@ class Resolver {
     utils::statistics::RelaxedCounter<size_t> network_failure{0};
   };
 
+  struct NetUpdateCounters {
+    /// background updates of the records that are about to expire
+    utils::statistics::RelaxedCounter<size_t> prefetch{0};
+    /// background updates of the expired records that are served stale
+    utils::statistics::RelaxedCounter<size_t> stale_refresh{0};
+    /// expired records dropped as they were older than cache_max_stale_ttl
+    utils::statistics::RelaxedCounter<size_t> stale_expired{0};
+    /// total time of the finished network queries
+    utils::statistics::RelaxedCounter<size_t> network_time_us{0};
+  };
+
   Resolver(engine::TaskProcessor& fs_task_processor,
            const ResolverConfig& config);
   Resolver(const Resolver&) = delete;
@@ -47,6 +58,11 @@ class Resolver {
   ///  - Cached network resolution results
   ///  - Network name servers
   ///
+  /// The cached reply that is about to expire is returned as is and is
+  /// updated in background. The expired reply is returned as well while
+  /// it is being updated, unless it is older than
+  /// ResolverConfig::cache_max_stale_ttl.
+  ///
   /// @throws clients::dns::NotResolvedException if none of the sources provide
   /// a result within the specified deadline.
   AddrVector Resolve(const std::string& name, engine::Deadline deadline);
@@ -54,6 +70,9 @@ class Resolver {
   /// Returns lookup source counters.
   const LookupSourceCounters& GetLookupSourceCounters() const;
 
+  /// Returns network cache update counters.
+  const NetUpdateCounters& GetNetUpdateCounters() const;
+
   /// Forces the reload of lookup table file. Waits until the reload is done.
   void ReloadHosts();
 
@@ -65,7 +84,7 @@ class Resolver {
 
  private:
   class Impl;
-  constexpr static size_t kSize = 1728;
+  constexpr static size_t kSize = 1792;
   constexpr static size_t kAlignment = 16;
   utils::FastPimpl<Impl, kSize, kAlignment> impl_;
 };
@@ -7,7 +7,9 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <atomic>
 #include <memory>
+#include <optional>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
@@ -20,6 +22,8 @@
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/not_null.hpp>
 #include <userver/utils/periodic_task.hpp>
+#include <userver/utils/retry_budget.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/swappingsmart.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
@@ -36,6 +40,7 @@ class HeadersPropagator;
 namespace curl {
 class easy;
 class multi;
+class share;
 class ConnectRateLimiter;
 }  // namespace curl
 
@@ -53,6 +58,7 @@ class Statistics;
 struct PoolStatistics;
 struct InstanceStatistics;
 class DestinationStatistics;
+class RequestCoalescer;
 
 /// @ingroup userver_clients
 ///
@@ -131,8 +137,13 @@ class Client final {
   void SetDnsResolver(clients::dns::Resolver* resolver);
 
  private:
+  Request CreateRequestImpl(std::optional<std::size_t> multi_index);
+
   void ReinitEasy();
 
+  // Keeps the connections of impl::WarmPoolsSettings established in each multi
+  void WarmUpPools();
+
   InstanceStatistics GetMultiStatistics(size_t n) const;
 
   size_t FindMultiIndex(const curl::multi*) const;
@@ -149,6 +160,8 @@ class Client final {
   std::atomic<std::size_t> pending_tasks_{0};
 
   const impl::DeadlinePropagationConfig deadline_propagation_config_;
+  // TLS sessions cache of all the easy handles, null if not shared
+  std::shared_ptr<curl::share> share_;
 
   std::shared_ptr<DestinationStatistics> destination_statistics_;
   std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
@@ -176,10 +189,20 @@ class Client final {
 
   std::shared_ptr<curl::ConnectRateLimiter> connect_rate_limiter_;
 
+  // Caps the rate of the hedged attempts, see Request::hedging()
+  utils::RetryBudget hedging_budget_;
+  // Shares the transfers of the identical requests, see Request::coalescing()
+  std::unique_ptr<RequestCoalescer> coalescer_;
+
   clients::dns::Resolver* resolver_{nullptr};
   utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
   const server::http::HeadersPropagator* headers_propagator_{nullptr};
   impl::PluginPipeline plugin_pipeline_;
+
+  const impl::WarmPoolsSettings warm_pools_;
+  std::atomic<std::size_t> warm_connections_{0};
+  utils::statistics::RateCounter warm_up_errors_;
+  utils::PeriodicTask warm_pools_task_;
 };
 
 }  // namespace clients::http
@@ -38,6 +38,7 @@ namespace components {
 /// thread-name-prefix | set OS thread name to this value | ''
 /// threads | number of threads to process low level HTTP related IO system calls | 8
 /// defer-events | whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care | false
+/// share-tls-sessions | whether to share the TLS sessions cache between the IO threads to resume the sessions on new connections instead of full handshakes | false
 /// fs-task-processor | task processor to run blocking HTTP related calls, like DNS resolving or hosts reading | -
 /// destination-metrics-auto-max-size | set max number of automatically created destination metrics | 100
 /// user-agent | User-Agent HTTP header to show on all requests, result of utils::GetUserverIdentifier() if empty | empty
@@ -47,6 +48,15 @@ namespace components {
 /// testsuite-allowed-url-prefixes | if set, checks that all URLs start with any of the passed prefixes, asserts if not. Set for testing purposes only. | ''
 /// dns_resolver | server hostname resolver type (getaddrinfo or async) | 'async'
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
+/// address-balancing.enabled | balance the requests across the host addresses resolved by the async dns_resolver with the power of two choices by the in-flight requests count and the latency EWMA | false
+/// address-balancing.ejection-error-ratio | share of the failed attempts (network errors and 5xx) in a window that ejects the address | 0.5
+/// address-balancing.ejection-window | number of the attempts to an address to compute the error ratio over | 20
+/// address-balancing.ejection-time | for how long the ejected address is not picked unless all the addresses are ejected | 30s
+/// warm-pools.destinations | list of objects with the `url` to send the warm-up HEAD requests to and the number of `connections` (1 by default) to keep established with it in each of the IO threads | []
+/// warm-pools.refresh-period | period of the warm-up requests, should be less than the idle connections max age of 118s | 60s
+/// warm-pools.timeout | timeout of the warm-up requests | 1s
+/// http2.max-concurrent-streams | max number of the concurrent HTTP/2 streams over one connection in each of the IO threads | 100
+/// http2.max-host-connections | max number of the connections to a host in each of the IO threads, the requests beyond the limit wait for a free connection or stream | unlimited
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 ///
 /// ## Static configuration example:
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
@@ -23,12 +25,57 @@ struct DeadlinePropagationConfig {
   bool update_header{true};
 };
 
+struct AddressBalancerSettings final {
+  bool enabled{false};
+  /// Share of the failed attempts in a window that ejects the address
+  double ejection_error_ratio{0.5};
+  /// Number of the attempts to an address to compute the error ratio over
+  std::size_t ejection_window{20};
+  std::chrono::milliseconds ejection_time{std::chrono::seconds{30}};
+};
+
+AddressBalancerSettings Parse(const yaml_config::YamlConfig& value,
+                              formats::parse::To<AddressBalancerSettings>);
+
+struct WarmPoolSettings final {
+  /// URL to send the warm-up HEAD requests to
+  std::string url;
+  /// Connections to keep per curl multi (per IO thread)
+  std::size_t connections{1};
+};
+
+WarmPoolSettings Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<WarmPoolSettings>);
+
+struct WarmPoolsSettings final {
+  std::vector<WarmPoolSettings> destinations;
+  /// Should be less than the curl idle connections max age (118s)
+  std::chrono::milliseconds refresh_period{std::chrono::seconds{60}};
+  std::chrono::milliseconds timeout{std::chrono::seconds{1}};
+};
+
+WarmPoolsSettings Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<WarmPoolsSettings>);
+
+struct Http2Settings final {
+  /// std::nullopt keeps the libcurl defaults
+  std::optional<std::size_t> max_concurrent_streams;
+  std::optional<std::size_t> max_host_connections;
+};
+
+Http2Settings Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<Http2Settings>);
+
 // Static config
 struct ClientSettings final {
   std::string thread_name_prefix{};
   size_t io_threads{8};
   bool defer_events{false};
+  bool share_tls_sessions{false};
   DeadlinePropagationConfig deadline_propagation{};
+  AddressBalancerSettings address_balancing{};
+  WarmPoolsSettings warm_pools{};
+  Http2Settings http2{};
   const tracing::TracingManagerBase* tracing_manager{nullptr};
   const server::http::HeadersPropagator* headers_propagator{nullptr};
 };
@@ -3,7 +3,9 @@
 /// @file userver/clients/http/request.hpp
 /// @brief @copybrief clients::http::Request
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -83,6 +85,22 @@ enum class ProxyAuthType {
 
 ProxyAuthType ProxyAuthTypeFromString(const std::string& auth_name);
 
+/// Settings of the hedged requests, see Request::hedging()
+struct HedgingSettings final {
+  /// The delay after which the hedged attempt is sent
+  std::chrono::milliseconds delay{50};
+  /// If set, the delay is this percentile (0-100) of the recent timings of
+  /// the destination metric and `delay` is used while there are no timings
+  std::optional<double> delay_percentile;
+};
+
+/// Settings of the requests coalescing, see Request::coalescing()
+struct CoalescingSettings final {
+  /// Names of the headers that make the requests different, the requests with
+  /// the same method and URL but other headers are coalesced
+  std::vector<std::string> key_headers;
+};
+
 /// Class for creating and performing new http requests
 class Request final {
  public:
@@ -244,6 +262,33 @@ class Request final {
   Request& retry(short retries = 3, bool on_fails = true) &;
   Request retry(short retries = 3, bool on_fails = true) &&;
 
+  /// Enables hedging: if there is no response after the delay, a copy of the
+  /// request is sent over another connection. The first response wins and
+  /// the other attempt is cancelled.
+  ///
+  /// The hedged attempts are capped by a utils::RetryBudget of the client.
+  /// The hedged attempt is sent only while the response is waited with
+  /// ResponseFuture::Wait(), ResponseFuture::Get() or perform(). Forms,
+  /// streamed bodies and async_perform_stream_body() are not hedged.
+  ///
+  /// Hedge only the idempotent requests.
+  Request& hedging(const HedgingSettings& settings) &;
+  Request hedging(const HedgingSettings& settings) &&;
+
+  /// Enables coalescing: the GET requests of the client with the same URL and
+  /// values of the `settings.key_headers` that are in flight at the same time
+  /// share one transfer, each of them gets a copy of the response.
+  ///
+  /// The transfer is performed with the timeout, retries and deadline of the
+  /// request that started it, and is cancelled when all the requests sharing
+  /// it are cancelled or their futures are destroyed. Only the GET requests
+  /// without a body performed with async_perform() or perform() are coalesced.
+  ///
+  /// Do not wait for several coalesced futures with the same transfer in one
+  /// engine::WaitAny() call.
+  Request& coalescing(const CoalescingSettings& settings = {}) &;
+  Request coalescing(const CoalescingSettings& settings = {}) &&;
+
   /// Set unix domain socket as connection endpoint and provide path to it
   /// When enabled, request will connect to the Unix domain socket instead
   /// of establishing a TCP connection to a host.
@@ -352,6 +397,8 @@ class Request final {
   std::string ExtractData();
 
  private:
+  friend class RequestBatch;
+
   std::shared_ptr<RequestState> pimpl_;
 };
 
@@ -0,0 +1,88 @@
+#pragma once
+
+/// @file userver/clients/http/request_batch.hpp
+/// @brief @copybrief clients::http::RequestBatch
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Performs a number of requests concurrently with one deadline and
+/// waits for all of them or for a quorum of the successful ones.
+///
+/// The requests are started by Add() within the `http_batch` span. The
+/// timeouts of the requests are cut to the deadline of the batch and the
+/// unfinished requests are cancelled once the result is known.
+///
+/// A request succeeded if it got a 2xx response.
+///
+/// ## Example usage:
+///
+/// @snippet clients/http/client_test.cpp  Sample HTTP RequestBatch usage
+class RequestBatch final {
+ public:
+  struct Result {
+    /// nullptr if the request failed or was cancelled
+    std::shared_ptr<Response> response;
+    /// the error of the request, a CancelException for the cancelled requests
+    std::exception_ptr exception;
+
+    bool IsSuccess() const noexcept;
+  };
+
+  explicit RequestBatch(engine::Deadline deadline);
+
+  RequestBatch(RequestBatch&&) = delete;
+  RequestBatch& operator=(RequestBatch&&) = delete;
+
+  /// Cancels the unfinished requests
+  ~RequestBatch();
+
+  /// Starts the request, returns its index in GetResults()
+  std::size_t Add(Request request);
+
+  /// @brief Waits until all the requests are finished or the deadline is
+  /// reached, the unfinished requests are cancelled.
+  /// @throws clients::http::CancelException on task cancellation
+  void WaitAll();
+
+  /// @brief Waits until `quorum` requests succeed, cancels the rest of them.
+  ///
+  /// Returns early with `false` if the quorum can not be reached anymore or
+  /// the deadline is reached.
+  /// @throws clients::http::CancelException on task cancellation
+  bool WaitQuorum(std::size_t quorum);
+
+  /// The results in the order of Add() calls. The results of the requests
+  /// that are still in flight are empty.
+  const std::vector<Result>& GetResults() const noexcept { return results_; }
+
+  std::size_t GetSuccessCount() const noexcept { return successes_; }
+
+ private:
+  bool WaitNext();
+  void Collect(std::size_t index);
+  void CancelPending();
+
+  const engine::Deadline deadline_;
+  tracing::Span span_;
+  std::vector<ResponseFuture> futures_;
+  std::vector<Result> results_;
+  std::size_t finished_{0};
+  std::size_t successes_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
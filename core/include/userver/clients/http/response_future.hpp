@@ -17,6 +17,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 
+class CoalescedResponse;
 class RequestState;
 
 namespace impl {
@@ -46,14 +47,28 @@ class ResponseFuture final {
   engine::impl::ContextAccessor* TryGetContextAccessor() noexcept;
 
   ResponseFuture(engine::Future<std::shared_ptr<Response>>&& future,
+                 std::shared_ptr<RequestState> request,
+                 std::shared_ptr<RequestState> hedge = {});
+
+  ResponseFuture(std::shared_ptr<CoalescedResponse> coalesced,
                  std::shared_ptr<RequestState> request);
   /// @endcond
 
  private:
+  engine::FutureStatus WaitForResponse();
+
   engine::Future<std::shared_ptr<Response>> future_;
   engine::Deadline deadline_;
   std::shared_ptr<RequestState> request_state_;
   bool was_deadline_propagated_{false};
+
+  // The hedged attempt, see Request::hedging()
+  std::shared_ptr<RequestState> hedge_state_;
+  engine::Future<std::shared_ptr<Response>> hedge_future_;
+  engine::Deadline hedge_deadline_;
+
+  // The response shared with the identical requests, see Request::coalescing()
+  std::shared_ptr<CoalescedResponse> coalesced_;
 };
 
 }  // namespace clients::http
@@ -0,0 +1,62 @@
+#pragma once
+
+/// @file userver/clients/http/streamed_json.hpp
+/// @brief Incremental JSON parsing of the clients::http::StreamedResponse body
+
+#include <string>
+#include <string_view>
+
+#include <userver/clients/http/streamed_response.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace impl {
+
+/// Feeds the chunks of a StreamedResponse body to the chunked JSON parsers
+class StreamedChunkReader final {
+ public:
+  StreamedChunkReader(StreamedResponse& response, engine::Deadline deadline);
+
+  /// @returns an empty string_view at the end of the body
+  /// @throws clients::http::TimeoutException if the deadline is reached
+  std::string_view operator()();
+
+ private:
+  StreamedResponse& response_;
+  const engine::Deadline deadline_;
+  std::string chunk_;
+};
+
+}  // namespace impl
+
+/// @brief Parses the JSON body of the `response` with the SAX `Parser` as the
+/// chunks arrive, the whole raw body is never held in memory.
+///
+/// The status code is not checked, see StreamedResponse::StatusCode().
+///
+/// @throws clients::http::TimeoutException if the deadline is reached
+/// @throws formats::json::parser::ParseError if the body is not a valid `T`
+template <typename T, typename Parser>
+T ParseStreamedJson(StreamedResponse& response, engine::Deadline deadline) {
+  impl::StreamedChunkReader reader{response, deadline};
+  return formats::json::parser::ParseChunkedToType<T, Parser>(reader);
+}
+
+/// @brief Builds the DOM of the JSON body of the `response` as the chunks
+/// arrive, the whole raw body is never held in memory.
+///
+/// The status code is not checked, see StreamedResponse::StatusCode().
+///
+/// @throws clients::http::TimeoutException if the deadline is reached
+/// @throws formats::json::ParseException if the body is not a valid JSON
+formats::json::Value ReadStreamedJson(StreamedResponse& response,
+                                      engine::Deadline deadline);
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
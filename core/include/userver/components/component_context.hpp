@@ -176,6 +176,8 @@ class ComponentContext final {
   impl::ComponentBase* AddComponent(std::string_view name,
                                     const ComponentFactory& factory);
 
+  void ReportStartupProfile() const;
+
   void OnAllComponentsLoaded();
 
   void OnAllComponentsAreStopping();
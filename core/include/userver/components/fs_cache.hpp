@@ -24,6 +24,15 @@ namespace components {
 /// dir               | directory to cache files from                        | /var/www
 /// update-period     | Update period (0 - fill the cache only at startup)   | 0
 /// fs-task-processor | task processor to do filesystem operations           | fs-task-processor
+/// keep-descriptors  | keep files open instead of reading them to memory    | false
+///
+/// With `keep-descriptors: true` server::handlers::HttpHandlerStatic sends the
+/// files with sendfile(2). The files should be replaced atomically (e.g. by
+/// rename), otherwise a response may get a partially written file.
+///
+/// On Linux a non-zero `update-period` makes the cache follow inotify events
+/// instead of rescanning `dir`: only the changed files are re-read, shortly
+/// after their writers go quiet.
 
 // clang-format on
 
@@ -8,6 +8,8 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/rcu/rcu.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,8 +17,14 @@ namespace logging {
 struct DynamicDebugConfig;
 }
 
+namespace utils::statistics {
+class Writer;
+}
+
 namespace components {
 
+class Logging;
+
 // clang-format off
 
 /// @ingroup userver_components
@@ -28,7 +36,9 @@ namespace components {
 ///
 /// ## Dynamic config
 /// * @ref USERVER_LOG_DYNAMIC_DEBUG
+/// * @ref USERVER_LOG_LIMITED
 /// * @ref USERVER_NO_LOG_SPANS
+/// * @ref USERVER_TRACE_TAIL_SAMPLING
 ///
 /// ## Static options:
 /// Name | Description | Default value
@@ -36,6 +46,10 @@ namespace components {
 /// limited-logging-enable | set to true to make LOG_LIMITED drop repeated logs | -
 /// limited-logging-interval | utils::StringToDuration suitable duration string to group repeated logs into one message | -
 ///
+/// ## Statistics
+/// `log-limited.dropped` with the `location` label counts the logs dropped by
+/// each `LOG_LIMITED*` location.
+///
 /// ## Config example:
 ///
 /// @snippet components/common_component_list_test.cpp Sample logging configurator component config
@@ -56,9 +70,13 @@ class LoggingConfigurator final : public impl::ComponentBase {
 
  private:
   void OnConfigUpdate(const dynamic_config::Snapshot& config);
+  void WriteStatistics(utils::statistics::Writer& writer) const;
 
+  Logging& logging_component_;
+  utils::PeriodicTask log_limited_summary_task_;
   concurrent::AsyncEventSubscriberScope config_subscription_;
   rcu::Variable<logging::DynamicDebugConfig> dynamic_debug_;
+  utils::statistics::Entry statistics_holder_;
 };
 
 /// }@
@@ -33,6 +33,8 @@ class Manager;
 /// coro_pool.initial_size | amount of coroutines to preallocate on startup | 1000
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | 4000
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
+/// coro_pool.local_cache_size | max amount of idle coroutines to keep in a per-thread cache in front of the shared pool, 0 to disable | 32
+/// coro_pool.stack_usage_sample_every | measure the stack high-water mark on each N-th task finish on each thread and report it in the coro-pool.stack-usage metrics, 0 to disable | 0
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
 /// components | dictionary of "component name": "options" | -
@@ -40,6 +42,7 @@ class Manager;
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
 /// mlock_debug_info | whether to mlock(2) process debug info to prevent major page faults on unwinding | true
 /// disable_phdr_cache | whether to disable caching of phdr_info objects. Usable if rebuilding with cmake variable USERVER_DISABLE_PHDR_CACHE is off limits, and has the same effect | false
+/// startup_trace_path | file to write the load times and the dependencies of the components to, in Chrome Trace Event format (chrome://tracing, Perfetto). The critical path of the startup is logged regardless of this option | -
 ///
 /// ## Static task_processor options:
 /// Name | Description | Default value
@@ -49,6 +52,15 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 10000
+/// task-queue | task queue implementation: 'global' for a single queue shared by all the workers, 'work-stealing' for per-worker local queues with a LIFO slot for woken up tasks and stealing by idle workers | global
+/// cpu-affinity | list of CPUs to bind the worker threads to, in the Linux cpulist format, e.g. '0-7,16-23' | -
+/// numa-node | NUMA node to bind the worker threads to; the task processor also gets its own coroutine pool, wakeups from other nodes are reported as `cross_node_wakeups`. Mutually exclusive with `cpu-affinity` | -
+/// coro-stack-size | stack size of the coroutines of this task processor. If set, the task processor gets its own coroutine pool, so that tasks may choose between small-stack and large-stack task processors | coro_pool.stack_size
+/// io-backend | I/O backend of the sockets created in this task processor: 'ev' waits for the socket readiness in the ev threads, 'io-uring' performs the operations that would block with io_uring and accepts connections with a multishot accept (requires Linux 5.19+) | ev
+/// io-uring-entries | size of the io_uring submission queue | 4096
+/// io-uring-max-file-operations | max count of the io_uring file operations in flight (the fs:: functions given an 'io-uring' task processor do the file I/O with io_uring instead of blocking its threads), the rest wait for their turn | 64
+/// preemption-time-slice | time slice after which the long-running task steps are asked to yield by engine::ShouldYield(), see engine::YieldIfNeeded(); 0 to disable | 0
+/// resource-accounting | accumulate the thread CPU time and the allocated bytes of each task to report them as `cpu_ms` and `alloc_bytes` of the spans and in the handler statistics, see engine::current_task::GetResourceUsage() | false
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
@@ -18,14 +18,22 @@ ValidationMode Parse(const yaml_config::YamlConfig& value,
                      formats::parse::To<ValidationMode>);
 
 namespace impl {
+
+// Building a schema parses and merges the YAML of the whole component
+// hierarchy, so it is done once per component type
+template <typename Component>
+const yaml_config::Schema& GetCachedStaticConfigSchema() {
+  static const yaml_config::Schema schema = Component::GetStaticConfigSchema();
+  return schema;
+}
+
 template <typename Component>
 void TryValidateStaticConfig(const components::ComponentConfig& static_config,
                              ValidationMode validation_condition) {
   if (components::kHasValidate<Component> ||
       validation_condition == ValidationMode::kAll) {
-    yaml_config::Schema schema = Component::GetStaticConfigSchema();
-
-    yaml_config::impl::Validate(static_config, schema);
+    yaml_config::impl::Validate(static_config,
+                                GetCachedStaticConfigSchema<Component>());
   }
 }
 
@@ -0,0 +1,182 @@
+#pragma once
+
+/// @file userver/components/tcp_framed_acceptor_base.hpp
+/// @brief @copybrief components::TcpFramedAcceptorBase
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/components/tcp_acceptor_base.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/statistics/entry.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace impl {
+struct TcpFramedStats;
+}  // namespace impl
+
+/// @brief How the frames of a components::TcpFramedConnection are delimited
+struct TcpFramingConfig final {
+  enum class Type {
+    /// Each frame is preceded by its payload size as a big-endian integer
+    /// of `length_prefix_size` bytes
+    kLengthPrefix,
+    /// Each frame is followed by the `delimiter`
+    kDelimiter,
+  };
+
+  Type type{Type::kLengthPrefix};
+  std::size_t length_prefix_size{4};
+  std::string delimiter{"\n"};
+
+  /// Max size of a received frame payload, larger frames close the connection
+  std::size_t max_frame_size{1024 * 1024};
+  /// Initial size of the receive buffer, it grows up to fit the largest frame
+  std::size_t receive_buffer_size{16 * 1024};
+  /// Frames queued for sending above these limits are sent right away,
+  /// blocking the sender until the peer reads them
+  std::size_t max_pending_send_bytes{256 * 1024};
+  std::size_t max_pending_send_frames{64};
+};
+
+TcpFramingConfig Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<TcpFramingConfig>);
+
+/// @brief Frame-level reads and writes over an engine::io::Socket
+///
+/// Received frames are returned as views into the receive buffer without
+/// copying. Sent frames are queued and written by a single vectored write
+/// when the connection is about to wait for the next frame, when the queue
+/// limits are reached or on Flush().
+///
+/// The methods must not be called concurrently.
+class TcpFramedConnection final {
+ public:
+  TcpFramedConnection(engine::io::Socket& socket,
+                      const TcpFramingConfig& config,
+                      impl::TcpFramedStats* stats = nullptr);
+  ~TcpFramedConnection();
+
+  TcpFramedConnection(const TcpFramedConnection&) = delete;
+  TcpFramedConnection& operator=(const TcpFramedConnection&) = delete;
+
+  /// @brief Returns the payload of the next frame, or std::nullopt if the
+  /// peer closed the connection between the frames.
+  ///
+  /// Sends the queued frames before waiting for the socket. The returned view
+  /// is valid until the next ReadFrame call.
+  ///
+  /// @throw engine::io::IoException on I/O errors, on frames larger than
+  /// TcpFramingConfig::max_frame_size and if the connection was closed in the
+  /// middle of a frame.
+  std::optional<std::string_view> ReadFrame(engine::Deadline deadline = {});
+
+  /// @brief Queues the frame for sending, sends the queued frames if the
+  /// limits of TcpFramingConfig are reached.
+  ///
+  /// @throw engine::io::IoException on I/O errors
+  void SendFrame(std::string payload, engine::Deadline deadline = {});
+
+  /// @brief Sends the queued frames
+  ///
+  /// @throw engine::io::IoException on I/O errors
+  void Flush(engine::Deadline deadline = {});
+
+  std::size_t GetPendingSendBytes() const noexcept {
+    return pending_send_bytes_;
+  }
+
+  engine::io::Socket& GetSocket() noexcept { return socket_; }
+
+ private:
+  struct PendingFrame {
+    std::string payload;
+    std::array<char, 8> length_prefix;
+  };
+
+  std::optional<std::string_view> TryParseFrame();
+  void PrepareForRecv();
+
+  engine::io::Socket& socket_;
+  const TcpFramingConfig& config_;
+  impl::TcpFramedStats* const stats_;
+
+  std::unique_ptr<char[]> buffer_;
+  std::size_t buffer_size_{0};
+  std::size_t begin_{0};
+  std::size_t end_{0};
+  std::size_t delimiter_scan_pos_{0};
+  std::size_t consumed_frame_size_{0};
+
+  std::vector<PendingFrame> pending_frames_;
+  std::vector<struct ::iovec> iovecs_;
+  std::size_t pending_send_bytes_{0};
+};
+
+// clang-format off
+
+/// @ingroup userver_base_classes userver_components
+///
+/// @brief Component for accepting TCP connections of framed binary or text
+/// protocols.
+///
+/// Each accepted connection is processed in a new coroutine by
+/// ProcessConnection of the derived class, that reads and sends whole frames
+/// via components::TcpFramedConnection. The queued frames are sent after
+/// ProcessConnection returns.
+///
+/// Exports the statistics of the connections, frames and bytes as
+/// `tcp.<component name>`.
+///
+/// ## Static options:
+/// All the options of components::TcpAcceptorBase and the following ones:
+///
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// framing.type | `length-prefix` or `delimiter` | length-prefix
+/// framing.length-prefix-size | size of the big-endian payload size before each frame: 1, 2, 4 or 8 | 4
+/// framing.delimiter | string after each frame | '\\n'
+/// framing.max-frame-size | max size of a received frame payload | 1048576
+/// framing.receive-buffer-size | initial size of the receive buffer of a connection | 16384
+/// framing.max-pending-send-bytes | size of the queued frames that makes the sender wait for the peer | 262144
+/// framing.max-pending-send-frames | count of the queued frames that makes the sender wait for the peer | 64
+
+// clang-format on
+class TcpFramedAcceptorBase : public TcpAcceptorBase {
+ public:
+  TcpFramedAcceptorBase(const ComponentConfig&, const ComponentContext&);
+  ~TcpFramedAcceptorBase() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  /// Override this function to process incoming connections.
+  ///
+  /// @warning The function is called concurrently from multiple threads on
+  /// each new connection.
+  virtual void ProcessConnection(TcpFramedConnection& connection) = 0;
+
+ private:
+  void ProcessSocket(engine::io::Socket&& sock) final;
+
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
+  const TcpFramingConfig framing_config_;
+  const std::unique_ptr<impl::TcpFramedStats> stats_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,12 @@
 /// @file userver/concurrent/async_event_channel.hpp
 /// @brief @copybrief concurrent::AsyncEventChannel
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <typeindex>
@@ -12,12 +17,14 @@
 #include <vector>
 
 #include <userver/concurrent/async_event_source.hpp>
-#include <userver/concurrent/variable.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -27,6 +34,9 @@ namespace impl {
 
 void WaitForTask(std::string_view name, engine::TaskWithResult<void>& task);
 
+void ReportUnhandledException(std::string_view listener_name,
+                              const std::exception& ex) noexcept;
+
 [[noreturn]] void ReportAlreadySubscribed(std::string_view channel_name,
                                           std::string_view listener_name);
 
@@ -43,6 +53,20 @@ std::string MakeAsyncChannelName(std::string_view base, std::string_view name);
 
 inline constexpr bool kCheckSubscriptionUB = utils::impl::kEnableAssert;
 
+enum class DispatchMode { kTask, kInline };
+
+// Time from SendEvent to the moment the listener has processed the event
+struct ListenerStatistics final {
+  void Account(std::chrono::steady_clock::time_point send_time) noexcept;
+
+  utils::statistics::RateCounter events;
+  utils::statistics::RateCounter total_latency_ms;
+  std::atomic<std::int64_t> last_latency_ms{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ListenerStatistics& stats);
+
 // During the `AsyncEventSubscriberScope::Unsubscribe` call or destruction of
 // `AsyncEventSubscriberScope`, all variables used by callback must be valid
 // (must not be destroyed). A common cause of crashes in this place: there is no
@@ -50,7 +74,7 @@ inline constexpr bool kCheckSubscriptionUB = utils::impl::kEnableAssert;
 // struct fields.
 template <typename Func>
 void CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnsubscribing(
-    std::function<void(Func&)>& on_listener_removal, Func& listener_func,
+    const std::function<void(Func&)>& on_listener_removal, Func& listener_func,
     std::string_view channel_name, std::string_view listener_name) noexcept {
   if (!on_listener_removal) return;
   try {
@@ -68,6 +92,10 @@ void CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnsubscribing(
 /// i.e. only after the event was processed a new event may appear for
 /// processing, same listener is never called concurrently.
 ///
+/// The listeners are read without locking while an event is being sent. By
+/// default, each listener gets its own task, see AddInlineListener for cheap
+/// listeners.
+///
 /// Example usage:
 /// @snippet concurrent/async_event_channel_test.cpp  AsyncEventChannel sample
 template <typename... Args>
@@ -78,8 +106,7 @@ class AsyncEventChannel : public AsyncEventSource<Args...> {
 
   /// @brief The primary constructor
   /// @param name used for diagnostic purposes and is also accessible with Name
-  explicit AsyncEventChannel(std::string name)
-      : name_(std::move(name)), data_(ListenersData{{}, {}}) {}
+  explicit AsyncEventChannel(std::string name) : name_(std::move(name)) {}
 
   /// @brief The constructor with `AsyncEventSubscriberScope` usage checking.
   ///
@@ -101,7 +128,7 @@ class AsyncEventChannel : public AsyncEventSource<Args...> {
   /// @see impl::CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnsubscribing
   AsyncEventChannel(std::string name, OnRemoveCallback on_listener_removal)
       : name_(std::move(name)),
-        data_(ListenersData{{}, std::move(on_listener_removal)}) {}
+        on_listener_removal_(std::move(on_listener_removal)) {}
 
   /// @brief For use in `UpdateAndListen` of specific event channels
   ///
@@ -130,6 +157,30 @@ class AsyncEventChannel : public AsyncEventSource<Args...> {
         std::forward<UpdaterFunc>(updater));
   }
 
+  /// @brief Subscribes a listener that is called right in the task that sends
+  /// the event, without starting a new task.
+  ///
+  /// Use it for cheap listeners that do not wait for anything, e.g. the ones
+  /// that just store the new value. The inline listeners run one after
+  /// another, so a slow one delays the rest.
+  ///
+  /// @see AsyncEventSource::AddListener
+  template <class Class>
+  AsyncEventSubscriberScope AddInlineListener(Class* obj, std::string_view name,
+                                              void (Class::*func)(Args...)) {
+    return AddInlineListener(
+        FunctionId(obj), name,
+        [obj, func](Args... args) { (obj->*func)(args...); });
+  }
+
+  /// @overload
+  AsyncEventSubscriberScope AddInlineListener(FunctionId id,
+                                              std::string_view name,
+                                              Function&& func) {
+    return DoAddListener(id, name, std::move(func),
+                         impl::DispatchMode::kInline);
+  }
+
   /// Send the next event and wait until all the listeners process it.
   ///
   /// Strict FIFO serialization is guaranteed, i.e. only after this event is
@@ -137,78 +188,126 @@ class AsyncEventChannel : public AsyncEventSource<Args...> {
   /// listener/subscriber is never called concurrently.
   void SendEvent(Args... args) const {
     std::lock_guard lock(event_mutex_);
-    auto data = data_.Lock();
-    auto& listeners = data->listeners;
-
-    std::vector<engine::TaskWithResult<void>> tasks;
-    tasks.reserve(listeners.size());
+    const auto send_time = std::chrono::steady_clock::now();
+    const auto listeners = listeners_.Read();
+
+    // All the tasks are started first, so that the heavy listeners work while
+    // the inline ones are being called.
+    std::vector<std::pair<const Listener*, engine::TaskWithResult<void>>> tasks;
+    tasks.reserve(listeners->size());
+    for (const auto& [_, listener] : *listeners) {
+      if (listener->dispatch_mode != impl::DispatchMode::kTask) continue;
+      tasks.emplace_back(
+          listener.get(),
+          utils::Async(listener->task_name, [&, &listener = *listener] {
+            listener.callback(args...);
+            listener.statistics.Account(send_time);
+          }));
+    }
 
-    for (const auto& [_, listener] : listeners) {
-      tasks.push_back(utils::Async(
-          listener.task_name,
-          [&, &callback = listener.callback] { callback(args...); }));
+    {
+      // Cancellation of the sender must not be seen by the listeners, just
+      // like with the listeners' own tasks
+      const engine::TaskCancellationBlocker cancel_blocker;
+      for (const auto& [_, listener] : *listeners) {
+        if (listener->dispatch_mode != impl::DispatchMode::kInline) continue;
+        try {
+          listener->callback(args...);
+        } catch (const std::exception& ex) {
+          impl::ReportUnhandledException(listener->name, ex);
+        }
+        listener->statistics.Account(send_time);
+      }
     }
 
-    std::size_t i = 0;
-    for (const auto& [_, listener] : listeners) {
-      impl::WaitForTask(listener.name, tasks[i++]);
+    for (auto& [listener, task] : tasks) {
+      impl::WaitForTask(listener->name, task);
     }
   }
 
   /// @returns the name of this event channel
   const std::string& Name() const noexcept { return name_; }
 
+  /// Writes the event processing latency of each listener, labeled with the
+  /// listener name
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const AsyncEventChannel& channel) {
+    const auto listeners = channel.listeners_.Read();
+    for (const auto& [_, listener] : *listeners) {
+      writer.ValueWithLabels(listener->statistics,
+                             {"listener", listener->name});
+    }
+  }
+
  private:
   struct Listener final {
+    Listener(std::string_view name, Function&& callback, std::string task_name,
+             impl::DispatchMode dispatch_mode)
+        : name(name),
+          callback(std::move(callback)),
+          task_name(std::move(task_name)),
+          dispatch_mode(dispatch_mode) {}
+
     std::string name;
     Function callback;
     std::string task_name;
+    impl::DispatchMode dispatch_mode;
+    mutable impl::ListenerStatistics statistics;
   };
 
-  struct ListenersData final {
-    std::unordered_map<FunctionId, Listener, FunctionId::Hash> listeners;
-    OnRemoveCallback on_listener_removal;
-  };
+  using Listeners = std::unordered_map<FunctionId, std::shared_ptr<Listener>,
+                                       FunctionId::Hash>;
 
   void RemoveListener(FunctionId id, UnsubscribingKind kind) noexcept final {
     engine::TaskCancellationBlocker blocker;
-    auto data = data_.Lock();
-    auto& listeners = data->listeners;
-    const auto iter = listeners.find(id);
+    // The listener may be running, the callers rely on it being finished by
+    // the time the subscription is cancelled
+    std::lock_guard event_lock(event_mutex_);
+    auto listeners = listeners_.StartWrite();
+    const auto iter = listeners->find(id);
 
-    if (iter == listeners.end()) {
+    if (iter == listeners->end()) {
       impl::ReportNotSubscribed(Name());
       return;
     }
 
     if (kind == UnsubscribingKind::kAutomatic) {
-      if (!data->on_listener_removal) {
-        impl::ReportUnsubscribingAutomatically(name_, iter->second.name);
+      if (!on_listener_removal_) {
+        impl::ReportUnsubscribingAutomatically(name_, iter->second->name);
       }
 
       if constexpr (impl::kCheckSubscriptionUB) {
         // Fake listener call to check
         impl::CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnsubscribing(
-            data->on_listener_removal, iter->second.callback, name_,
-            iter->second.name);
+            on_listener_removal_, iter->second->callback, name_,
+            iter->second->name);
       }
     }
-    listeners.erase(iter);
+    listeners->erase(iter);
+    listeners.Commit();
   }
 
   AsyncEventSubscriberScope DoAddListener(FunctionId id, std::string_view name,
                                           Function&& func) final {
-    auto data = data_.Lock();
-    auto& listeners = data->listeners;
+    return DoAddListener(id, name, std::move(func), impl::DispatchMode::kTask);
+  }
+
+  AsyncEventSubscriberScope DoAddListener(FunctionId id, std::string_view name,
+                                          Function&& func,
+                                          impl::DispatchMode dispatch_mode) {
+    auto listeners = listeners_.StartWrite();
     auto task_name = impl::MakeAsyncChannelName(name_, name);
-    const auto [iterator, success] = listeners.emplace(
-        id, Listener{std::string{name}, std::move(func), std::move(task_name)});
+    const auto [iterator, success] = listeners->emplace(
+        id, std::make_shared<Listener>(name, std::move(func),
+                                       std::move(task_name), dispatch_mode));
     if (!success) impl::ReportAlreadySubscribed(Name(), name);
+    listeners.Commit();
     return AsyncEventSubscriberScope(*this, id);
   }
 
   const std::string name_;
-  concurrent::Variable<ListenersData> data_;
+  const OnRemoveCallback on_listener_removal_;
+  rcu::Variable<Listeners> listeners_;
   mutable engine::Mutex event_mutex_;
 };
 
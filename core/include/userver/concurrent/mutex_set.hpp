@@ -5,12 +5,14 @@
 
 #include <chrono>
 #include <functional>
+#include <mutex>
 #include <string>
-#include <unordered_set>
+#include <unordered_map>
 #include <utility>
 
-#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/utils/cached_hash.hpp>
 #include <userver/utils/fixed_array.hpp>
@@ -21,19 +23,68 @@ namespace concurrent {
 
 namespace impl {
 
+// A task waiting for a key of a MutexSet, lives on the stack of the waiter
+struct KeyWaiter final {
+  engine::SingleConsumerEvent event;
+  KeyWaiter* next{nullptr};
+  // Set by unlock() when the key is handed off to this waiter
+  bool granted{false};
+};
+
+// FIFO queue of the tasks waiting for a single locked key
+class KeyWaiters final {
+ public:
+  void PushBack(KeyWaiter& waiter) noexcept {
+    UASSERT(!waiter.next);
+    if (tail_) {
+      tail_->next = &waiter;
+    } else {
+      head_ = &waiter;
+    }
+    tail_ = &waiter;
+  }
+
+  KeyWaiter* PopFront() noexcept {
+    auto* const result = head_;
+    if (result) {
+      head_ = result->next;
+      if (!head_) tail_ = nullptr;
+      result->next = nullptr;
+    }
+    return result;
+  }
+
+  void Remove(KeyWaiter& waiter) noexcept {
+    KeyWaiter* prev = nullptr;
+    for (auto* it = head_; it; prev = it, it = it->next) {
+      if (it != &waiter) continue;
+
+      (prev ? prev->next : head_) = waiter.next;
+      if (tail_ == &waiter) tail_ = prev;
+      waiter.next = nullptr;
+      return;
+    }
+    UASSERT_MSG(false, "KeyWaiter is not in the queue");
+  }
+
+ private:
+  KeyWaiter* head_{nullptr};
+  KeyWaiter* tail_{nullptr};
+};
+
 template <typename T, typename Equal>
 struct MutexDatum final {
   explicit MutexDatum(size_t way_size, const Equal& equal = Equal{})
-      : set(way_size, {}, equal) {}
+      : locked(way_size, {}, equal) {}
 
   ~MutexDatum() {
-    UASSERT_MSG(set.empty(),
+    UASSERT_MSG(locked.empty(),
                 "MutexDatum is destroyed while someone is holding the lock");
   }
 
   engine::Mutex mutex;
-  engine::ConditionVariable cv;
-  std::unordered_set<T, std::hash<T>, Equal> set;
+  // Locked keys along with the tasks waiting for them
+  std::unordered_map<T, KeyWaiters, std::hash<T>, Equal> locked;
 };
 
 }  // namespace impl
@@ -45,6 +96,8 @@ struct MutexDatum final {
 ///       argument to GetMutexForKey() share the same critical section. IOW, if
 ///       the first mutex is locked, the second one will block until the first
 ///       mutex is unlocked.
+/// @note tasks waiting for the same key acquire it in FIFO order: unlock()
+///       passes the key directly to the first waiter and wakes up only it.
 /// @note can be used only from coroutines.
 template <typename Key, typename Equal>
 class ItemMutex final {
@@ -69,7 +122,7 @@ class ItemMutex final {
   bool try_lock_until(std::chrono::time_point<Clock, Duration>);
 
  private:
-  bool TryFinishLocking();
+  bool LockUntil(engine::Deadline deadline);
 
   MutexDatum& md_;
   const HashAndKey key_;
@@ -83,6 +136,13 @@ class ItemMutex final {
 /// multiple keys when the key set is not known at compile time and may change
 /// in runtime.
 ///
+/// Keys are distributed between `ways` shards, each with its own
+/// engine::Mutex protecting a short lookup in the set of locked keys. Tasks
+/// never sleep on that mutex while waiting for a key, so contention on a key
+/// does not affect other keys, but unrelated keys of the same shard still
+/// compete for the shard mutex. Use about as many ways as there are task
+/// processor threads for highly concurrent workloads.
+///
 /// Example:
 /// @snippet src/concurrent/mutex_set_test.cpp  Sample mutex set usage
 template <typename Key = std::string, typename Hash = std::hash<Key>,
@@ -127,10 +187,7 @@ ItemMutex<Key, Equal>::ItemMutex(MutexDatum& md, HashAndKey&& key)
 template <typename Key, typename Equal>
 void ItemMutex<Key, Equal>::lock() {
   engine::TaskCancellationBlocker blocker;
-  std::unique_lock<engine::Mutex> lock(md_.mutex);
-
-  [[maybe_unused]] auto is_locked =
-      md_.cv.Wait(lock, [this] { return TryFinishLocking(); });
+  [[maybe_unused]] const bool is_locked = LockUntil(engine::Deadline{});
   UASSERT(is_locked);
 }
 
@@ -138,20 +195,21 @@ template <typename Key, typename Equal>
 void ItemMutex<Key, Equal>::unlock() {
   std::unique_lock lock(md_.mutex);
 
+  const auto it = md_.locked.find(key_);
+  UASSERT_MSG(it != md_.locked.end(), "ItemMutex is not locked");
+
+  // Hand the key off to the first waiter. Waking up only the waiters of this
+  // key avoids the thundering herd on a shard with many locked keys. Send()
+  // is called under the shard mutex, which the waiter takes before it
+  // destroys the KeyWaiter.
+  if (auto* next = it->second.PopFront()) {
+    next->granted = true;
+    next->event.Send();
+    return;
+  }
+
   // Forcing the destructor of the node to run outside of the critical section
-  [[maybe_unused]] auto node = md_.set.extract(key_);
-
-  // We must wakeup all the waiters, because otherwise we can wake up the wrong
-  // one and loose the wakeup:
-  //
-  // Task #1 waits for mutex A, task #2 waits for mutex B
-  // Task #3
-  //  * unlocks mutex A
-  //  * does NotifyOne
-  //  * wakeups thread #2
-  //  * mutex B is still locked, task #2 goes to sleep
-  //  * we lost the wakeup :(
-  md_.cv.NotifyAll();
+  [[maybe_unused]] auto node = md_.locked.extract(it);
 
   lock.unlock();
 
@@ -160,30 +218,47 @@ void ItemMutex<Key, Equal>::unlock() {
 
 template <typename Key, typename Equal>
 bool ItemMutex<Key, Equal>::try_lock() {
-  std::unique_lock<engine::Mutex> lock(md_.mutex);
-  return TryFinishLocking();
+  return LockUntil(engine::Deadline::Passed());
 }
 
 template <typename Key, typename Equal>
 template <typename Rep, typename Period>
 bool ItemMutex<Key, Equal>::try_lock_for(
     std::chrono::duration<Rep, Period> duration) {
-  std::unique_lock<engine::Mutex> lock(md_.mutex);
-  return md_.cv.WaitFor(lock, duration, [this] { return TryFinishLocking(); });
+  return LockUntil(engine::Deadline::FromDuration(duration));
 }
 
 template <typename Key, typename Equal>
 template <typename Clock, typename Duration>
 bool ItemMutex<Key, Equal>::try_lock_until(
     std::chrono::time_point<Clock, Duration> time_point) {
-  std::unique_lock<engine::Mutex> lock(md_.mutex);
-  return md_.cv.WaitUntil(lock, time_point,
-                          [this] { return TryFinishLocking(); });
+  return LockUntil(engine::Deadline::FromTimePoint(time_point));
 }
 
 template <typename Key, typename Equal>
-bool ItemMutex<Key, Equal>::TryFinishLocking() {
-  return md_.set.insert(key_).second;
+bool ItemMutex<Key, Equal>::LockUntil(engine::Deadline deadline) {
+  impl::KeyWaiter waiter;
+
+  {
+    std::lock_guard lock(md_.mutex);
+    auto [it, inserted] = md_.locked.try_emplace(key_);
+    if (inserted) return true;
+    if (deadline.IsReached()) return false;
+    it->second.PushBack(waiter);
+  }
+
+  [[maybe_unused]] const bool signaled =
+      waiter.event.WaitForEventUntil(deadline);
+
+  // Also waits for unlock() to finish with the `waiter`
+  std::lock_guard lock(md_.mutex);
+  if (waiter.granted) return true;
+
+  // Deadline or cancellation. The key is still locked, as it has a waiter.
+  const auto it = md_.locked.find(key_);
+  UASSERT(it != md_.locked.end());
+  it->second.Remove(waiter);
+  return false;
 }
 
 }  // namespace concurrent
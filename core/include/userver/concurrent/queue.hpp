@@ -1,8 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -233,6 +236,47 @@ class GenericQueue final
     return consumer_side_.PopNoblock(token, value);
   }
 
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>& values,
+                              engine::Deadline deadline) {
+    if (values.empty()) return true;
+    return producer_side_.PushMany(token, values, GetElementsSize(values),
+                                   deadline);
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushManyNoblock(Token& token, std::vector<T>& values) {
+    if (values.empty()) return true;
+    return producer_side_.PushManyNoblock(token, values,
+                                          GetElementsSize(values));
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (max_count == 0) return 0;
+    return consumer_side_.PopMany(token, values, max_count, deadline);
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopManyNoblock(Token& token, std::vector<T>& values,
+                                           std::size_t max_count) {
+    if (max_count == 0) return 0;
+    return consumer_side_.PopManyNoblock(token, values, max_count);
+  }
+
+  template <typename Iterator>
+  static std::size_t GetElementsSize(Iterator first, Iterator last) {
+    std::size_t size = 0;
+    for (; first != last; ++first) size += QueuePolicy::GetElementSize(*first);
+    return size;
+  }
+
+  static std::size_t GetElementsSize(const std::vector<T>& values) {
+    return GetElementsSize(values.begin(), values.end());
+  }
+
   void PrepareProducer() {
     std::size_t old_producers_count{};
     utils::AtomicUpdate(producers_count_, [&](auto old_value) {
@@ -304,6 +348,26 @@ class GenericQueue final
     consumer_side_.OnElementPushed();
   }
 
+  // Pushes all the `values` with a single notification of the consumers
+  template <typename Token>
+  void DoPushMany(Token& token, std::vector<T>& values) {
+    const auto first = std::make_move_iterator(values.begin());
+    if constexpr (std::is_same_v<Token, moodycamel::ProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(token, first, values.size());
+    } else if constexpr (std::is_same_v<Token, MultiProducerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(first, values.size());
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      queue_.enqueue_bulk(single_producer_token_, first, values.size());
+    }
+
+    consumer_side_.OnElementsPushed(values.size());
+    values.clear();
+  }
+
   template <typename Token>
   [[nodiscard]] bool DoPop(Token& token, T& value) {
     bool success{};
@@ -328,6 +392,32 @@ class GenericQueue final
     return false;
   }
 
+  // Pops up to `max_count` elements into `first` with a single notification
+  // of the producers, returns the number of the popped elements
+  template <typename Token, typename Iterator>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, Iterator first,
+                                      std::size_t max_count) {
+    std::size_t count{};
+
+    if constexpr (std::is_same_v<Token, moodycamel::ConsumerToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(token, first, max_count);
+    } else if constexpr (std::is_same_v<Token, impl::MultiToken>) {
+      static_assert(QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk(first, max_count);
+    } else {
+      static_assert(std::is_same_v<Token, impl::NoToken>);
+      static_assert(!QueuePolicy::kIsMultipleProducer);
+      count = queue_.try_dequeue_bulk_from_producer(single_producer_token_,
+                                                    first, max_count);
+    }
+
+    if (count != 0) {
+      producer_side_.OnElementPopped(GetElementsSize(first, first + count));
+    }
+    return count;
+  }
+
   moodycamel::ConcurrentQueue<T> queue_{1};
   std::atomic<std::size_t> consumers_count_{0};
   std::atomic<std::size_t> producers_count_{0};
@@ -368,6 +458,27 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return DoPush(token, std::move(value));
   }
 
+  // Blocks until there is space for all the values
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>& values,
+                              std::size_t values_size,
+                              engine::Deadline deadline) {
+    while (!DoPushMany(token, values, values_size)) {
+      if (queue_.NoMoreConsumers() ||
+          values_size > total_capacity_.load() ||
+          !non_full_event_.WaitForEventUntil(deadline)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushManyNoblock(Token& token, std::vector<T>& values,
+                                     std::size_t values_size) {
+    return DoPushMany(token, values, values_size);
+  }
+
   void OnElementPopped(std::size_t released_capacity) {
     used_capacity_.fetch_sub(released_capacity);
     non_full_event_.Send();
@@ -406,6 +517,20 @@ class GenericQueue<T, QueuePolicy>::SingleProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, std::vector<T>& values,
+                                std::size_t values_size) {
+    if (queue_.NoMoreConsumers() ||
+        used_capacity_.load() + values_size > total_capacity_.load()) {
+      return false;
+    }
+
+    used_capacity_.fetch_add(values_size);
+    queue_.DoPushMany(token, values);
+    non_full_event_.Reset();
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent non_full_event_;
   std::atomic<std::size_t> used_capacity_;
@@ -438,6 +563,23 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
            DoPush(token, std::move(value));
   }
 
+  // Blocks until there is space for all the values
+  template <typename Token>
+  [[nodiscard]] bool PushMany(Token& token, std::vector<T>& values,
+                              std::size_t values_size,
+                              engine::Deadline deadline) {
+    return remaining_capacity_.try_lock_shared_until_count(deadline,
+                                                           values_size) &&
+           DoPushMany(token, values, values_size);
+  }
+
+  template <typename Token>
+  [[nodiscard]] bool PushManyNoblock(Token& token, std::vector<T>& values,
+                                     std::size_t values_size) {
+    return remaining_capacity_.try_lock_shared_count(values_size) &&
+           DoPushMany(token, values, values_size);
+  }
+
   void OnElementPopped(std::size_t value_size) {
     remaining_capacity_.unlock_shared_count(value_size);
   }
@@ -476,6 +618,19 @@ class GenericQueue<T, QueuePolicy>::MultiProducerSide final {
     return true;
   }
 
+  template <typename Token>
+  [[nodiscard]] bool DoPushMany(Token& token, std::vector<T>& values,
+                                std::size_t values_size) {
+    UASSERT(values_size > 0);
+    if (queue_.NoMoreConsumers()) {
+      remaining_capacity_.unlock_shared_count(values_size);
+      return false;
+    }
+
+    queue_.DoPushMany(token, values);
+    return true;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore remaining_capacity_;
   concurrent::impl::SemaphoreCapacityControl remaining_capacity_control_;
@@ -508,8 +663,32 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return DoPop(token, value);
   }
 
-  void OnElementPushed() {
-    ++element_count_;
+  // Blocks only if queue is empty
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    std::size_t count{};
+    while (!(count = DoPopMany(token, values, max_count))) {
+      if (queue_.NoMoreProducers() ||
+          !nonempty_event_.WaitForEventUntil(deadline)) {
+        // See the comment in Pop
+        return DoPopMany(token, values, max_count);
+      }
+    }
+    return count;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopManyNoblock(Token& token, std::vector<T>& values,
+                                           std::size_t max_count) {
+    return DoPopMany(token, values, max_count);
+  }
+
+  void OnElementPushed() { OnElementsPushed(1); }
+
+  void OnElementsPushed(std::size_t count) {
+    element_count_ += count;
     nonempty_event_.Send();
   }
 
@@ -530,6 +709,27 @@ class GenericQueue<T, QueuePolicy>::SingleConsumerSide final {
     return false;
   }
 
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t max_count) {
+    // element_count_ is incremented after the elements are pushed, so all of
+    // them are already in the queue
+    max_count = std::min(max_count, element_count_.load());
+    if (max_count == 0) return 0;
+
+    const auto old_size = values.size();
+    values.resize(old_size + max_count);
+    const auto count =
+        queue_.DoPopMany(token, values.begin() + old_size, max_count);
+    values.resize(old_size + count);
+
+    if (count != 0) {
+      element_count_ -= count;
+      nonempty_event_.Reset();
+    }
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::SingleConsumerEvent nonempty_event_;
   std::atomic<std::size_t> element_count_;
@@ -561,8 +761,30 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     return element_count_.try_lock_shared() && DoPop(token, value);
   }
 
+  // Blocks only if queue is empty
+  template <typename Token>
+  [[nodiscard]] std::size_t PopMany(Token& token, std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (!element_count_.try_lock_shared_until(deadline)) return 0;
+    const auto locked_count = 1 + TryLockElements(max_count - 1);
+    return DoPopMany(token, values, locked_count);
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t PopManyNoblock(Token& token, std::vector<T>& values,
+                                           std::size_t max_count) {
+    const auto locked_count = TryLockElements(max_count);
+    if (locked_count == 0) return 0;
+    return DoPopMany(token, values, locked_count);
+  }
+
   void OnElementPushed() { element_count_.unlock_shared(); }
 
+  void OnElementsPushed(std::size_t count) {
+    element_count_.unlock_shared_count(count);
+  }
+
   void StopBlockingOnPop() {
     element_count_control_.SetCapacityOverride(kUnbounded +
                                                kSemaphoreUnlockValue);
@@ -598,6 +820,38 @@ class GenericQueue<T, QueuePolicy>::MultiConsumerSide final {
     }
   }
 
+  // Locks up to `max_count` of the available elements without waiting,
+  // returns the number of the locked elements
+  std::size_t TryLockElements(std::size_t max_count) {
+    auto count = std::min(max_count, element_count_.RemainingApprox());
+    while (count != 0 && !element_count_.try_lock_shared_count(count)) {
+      // Other consumers got some of the elements
+      count = std::min(count / 2, element_count_.RemainingApprox());
+    }
+    return count;
+  }
+
+  template <typename Token>
+  [[nodiscard]] std::size_t DoPopMany(Token& token, std::vector<T>& values,
+                                      std::size_t locked_count) {
+    const auto old_size = values.size();
+    values.resize(old_size + locked_count);
+
+    std::size_t count = 0;
+    while (count != locked_count) {
+      count += queue_.DoPopMany(token, values.begin() + old_size + count,
+                                locked_count - count);
+      if (count != locked_count && queue_.NoMoreProducers()) {
+        element_count_.unlock_shared_count(locked_count - count);
+        break;
+      }
+      // See the comment in DoPop
+    }
+
+    values.resize(old_size + count);
+    return count;
+  }
+
   GenericQueue& queue_;
   engine::CancellableSemaphore element_count_;
   concurrent::impl::SemaphoreCapacityControl element_count_control_;
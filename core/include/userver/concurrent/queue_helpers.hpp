@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 
@@ -63,6 +64,27 @@ class Producer final {
     return queue_->PushNoblock(token_, std::move(value));
   }
 
+  /// Push all the `values` into queue at once, waking up the consumers only
+  /// once. May wait asynchronously until there is space for all of them.
+  /// Clears `values` on success, leaves them unmodified otherwise.
+  /// @returns whether push succeeded before the deadline and before the task
+  /// was canceled.
+  /// @note `false` is returned if the `values` do not fit into the empty queue
+  [[nodiscard]] bool PushMany(std::vector<ValueType>& values,
+                              engine::Deadline deadline = {}) const {
+    UASSERT(queue_);
+    return queue_->PushMany(token_, values, deadline);
+  }
+
+  /// Try to push all the `values` into queue at once without blocking. May be
+  /// used in non-coroutine environment. Clears `values` on success, leaves
+  /// them unmodified otherwise.
+  /// @returns whether push succeeded.
+  [[nodiscard]] bool PushManyNoblock(std::vector<ValueType>& values) const {
+    UASSERT(queue_);
+    return queue_->PushManyNoblock(token_, values);
+  }
+
   void Reset() && {
     if (queue_) queue_->MarkProducerIsDead();
     queue_.reset();
@@ -124,6 +146,27 @@ class Consumer final {
     return queue_->PopNoblock(token_, value);
   }
 
+  /// Pop up to `max_count` elements from queue and append them to `values`,
+  /// waking up the producers only once. May wait asynchronously if the queue
+  /// is empty, but the producer is alive.
+  /// @returns the number of popped elements, 0 if nothing was popped before
+  /// the deadline.
+  /// @note `0` can be returned before the deadline
+  /// when the producer is no longer alive.
+  [[nodiscard]] std::size_t PopMany(std::vector<ValueType>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline = {}) const {
+    return queue_->PopMany(token_, values, max_count, deadline);
+  }
+
+  /// Try to pop up to `max_count` elements from queue and append them to
+  /// `values` without blocking. May be used in non-coroutine environment
+  /// @return the number of popped elements.
+  [[nodiscard]] std::size_t PopManyNoblock(std::vector<ValueType>& values,
+                                           std::size_t max_count) const {
+    return queue_->PopManyNoblock(token_, values, max_count);
+  }
+
   /// Const access to source queue.
   [[nodiscard]] std::shared_ptr<const QueueType> Queue() const {
     return {queue_};
@@ -0,0 +1,281 @@
+#pragma once
+
+/// @file userver/concurrent/sharded_map.hpp
+/// @brief @copybrief concurrent::ShardedMap
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+template <typename Key, typename Value,
+          typename RcuMapTraits = rcu::DefaultRcuMapTraits<Key, Value>>
+class ShardedMap;
+
+/// @brief Forward iterator for the concurrent::ShardedMap
+///
+/// Use member functions of concurrent::ShardedMap to retrieve the iterator.
+template <typename Key, typename Value, typename IterValue,
+          typename RcuMapTraits>
+class ShardedMapIterator final {
+  using Shard = std::conditional_t<std::is_const_v<IterValue>,
+                                   const rcu::RcuMap<Key, Value, RcuMapTraits>,
+                                   rcu::RcuMap<Key, Value, RcuMapTraits>>;
+  using ShardIterator =
+      rcu::RcuMapIterator<Key, Value, IterValue, RcuMapTraits>;
+
+ public:
+  using iterator_category = std::input_iterator_tag;
+  using difference_type = ptrdiff_t;
+  using value_type = typename ShardIterator::value_type;
+  using reference = typename ShardIterator::reference;
+  using pointer = typename ShardIterator::pointer;
+
+  ShardedMapIterator() = default;
+
+  ShardedMapIterator operator++(int) {
+    ShardedMapIterator tmp(*this);
+    ++*this;
+    return tmp;
+  }
+
+  ShardedMapIterator& operator++() {
+    UASSERT(shard_index_ < shard_count_);
+    ++it_;
+    SkipEmptyShards();
+    return *this;
+  }
+
+  reference operator*() const { return *it_; }
+  pointer operator->() const { return it_.operator->(); }
+
+  bool operator==(const ShardedMapIterator& rhs) const {
+    const auto is_end = shard_index_ == shard_count_;
+    const auto rhs_is_end = rhs.shard_index_ == rhs.shard_count_;
+    if (is_end || rhs_is_end) return is_end == rhs_is_end;
+    return shard_index_ == rhs.shard_index_ && it_ == rhs.it_;
+  }
+
+  bool operator!=(const ShardedMapIterator& rhs) const {
+    return !(*this == rhs);
+  }
+
+  /// @cond
+  /// For internal use only
+  ShardedMapIterator(Shard* shards, std::size_t shard_count)
+      : shards_(shards), shard_count_(shard_count) {
+    if (shard_count_ == 0) return;
+    it_ = shards_[0].begin();
+    SkipEmptyShards();
+  }
+  /// @endcond
+
+ private:
+  void SkipEmptyShards() {
+    while (it_ == ShardIterator{}) {
+      if (++shard_index_ == shard_count_) return;
+      it_ = shards_[shard_index_].begin();
+    }
+  }
+
+  Shard* shards_{nullptr};
+  std::size_t shard_count_{0};
+  std::size_t shard_index_{0};
+  ShardIterator it_;
+};
+
+/// @ingroup userver_concurrency userver_containers
+///
+/// @brief Map-like structure with the interface of rcu::RcuMap, that is split
+/// into independent RCU shards by the hash of the key.
+///
+/// An insert or an erase copies only the keyset of a single shard and locks
+/// only its mutex, reads are RCU reads of a single shard. Prefer it to
+/// rcu::RcuMap for big maps with frequent keyset changes: choose the shard
+/// count so that a shard holds some thousands of keys.
+///
+/// The differences from rcu::RcuMap:
+/// - there are no transactions (`StartWrite`), a change to several keys is not
+///   atomic;
+/// - iteration and GetSnapshot() fix the keyset of each shard at the moment
+///   the iteration reaches it, not of the whole map at once.
+///
+/// @note No synchronization is provided for value access, it must be
+/// implemented by Value when necessary.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename Key, typename Value, typename RcuMapTraits>
+class ShardedMap final {
+  using Shard = rcu::RcuMap<Key, Value, RcuMapTraits>;
+
+ public:
+  using Hash = typename Shard::Hash;
+  using KeyEqual = typename Shard::KeyEqual;
+  using MutexType = typename Shard::MutexType;
+  using ValuePtr = typename Shard::ValuePtr;
+  using ConstValuePtr = typename Shard::ConstValuePtr;
+  using Iterator = ShardedMapIterator<Key, Value, Value, RcuMapTraits>;
+  using ConstIterator =
+      ShardedMapIterator<Key, Value, const Value, RcuMapTraits>;
+  using RawMap = typename Shard::RawMap;
+  using Snapshot = typename Shard::Snapshot;
+  using InsertReturnType = typename Shard::InsertReturnType;
+
+  static constexpr std::size_t kDefaultShardCount = 256;
+
+  explicit ShardedMap(std::size_t shard_count = kDefaultShardCount)
+      : shards_(std::make_unique<Shard[]>(shard_count)),
+        shard_count_(shard_count) {
+    UINVARIANT(shard_count > 0, "ShardedMap must have at least one shard");
+  }
+
+  ShardedMap(const ShardedMap&) = delete;
+  ShardedMap(ShardedMap&&) = delete;
+  ShardedMap& operator=(const ShardedMap&) = delete;
+  ShardedMap& operator=(ShardedMap&&) = delete;
+
+  /// Returns the number of the shards
+  std::size_t GetShardCount() const noexcept { return shard_count_; }
+
+  /// Returns an estimated size of the map at some point in time
+  std::size_t SizeApprox() const {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+      result += shards_[i].SizeApprox();
+    }
+    return result;
+  }
+
+  /// @name Iteration support
+  /// @details Keyset of a shard is fixed when the iteration reaches it.
+  /// @{
+  ConstIterator begin() const {
+    return ConstIterator{shards_.get(), shard_count_};
+  }
+  ConstIterator end() const { return {}; }
+  Iterator begin() { return Iterator{shards_.get(), shard_count_}; }
+  Iterator end() { return {}; }
+  /// @}
+
+  /// @brief Returns a readonly value pointer by its key if exists
+  /// @throws rcu::MissingKeyException if the key is not present
+  // Protects from assignment to map[key]
+  // NOLINTNEXTLINE(readability-const-return-type)
+  const ConstValuePtr operator[](const Key& key) const {
+    return GetShard(key)[key];
+  }
+
+  /// @brief Returns a modifiable value pointer by key if exists or
+  /// default-creates one
+  /// @note Copies the shard of the key if the key doesn't exist.
+  // NOLINTNEXTLINE(readability-const-return-type)
+  const ValuePtr operator[](const Key& key) { return GetShard(key)[key]; }
+
+  /// @brief Inserts a new element into the container if there is no element
+  /// with the key in the container.
+  /// @see rcu::RcuMap::Insert
+  InsertReturnType Insert(const Key& key, ValuePtr value) {
+    return GetShard(key).Insert(key, std::move(value));
+  }
+
+  /// @brief Inserts a new element into the container constructed in-place with
+  /// the given args if there is no element with the key in the container.
+  /// @see rcu::RcuMap::Emplace
+  template <typename... Args>
+  InsertReturnType Emplace(const Key& key, Args&&... args) {
+    return GetShard(key).Emplace(key, std::forward<Args>(args)...);
+  }
+
+  /// @brief If a key equivalent to `key` already exists in the container, does
+  /// nothing, otherwise behaves like `Emplace`.
+  /// @see rcu::RcuMap::TryEmplace
+  template <typename... Args>
+  InsertReturnType TryEmplace(const Key& key, Args&&... args) {
+    return GetShard(key).TryEmplace(key, std::forward<Args>(args)...);
+  }
+
+  /// @brief If a key equivalent to `key` already exists in the container,
+  /// replaces the associated value. Otherwise, inserts a new pair into the map.
+  template <typename RawKey>
+  void InsertOrAssign(RawKey&& key, ValuePtr value) {
+    auto& shard = GetShard(key);
+    shard.InsertOrAssign(std::forward<RawKey>(key), std::move(value));
+  }
+
+  /// @brief Returns a readonly value pointer by its key or an empty pointer
+  // NOLINTNEXTLINE(readability-const-return-type)
+  const ConstValuePtr Get(const Key& key) const {
+    return GetShard(key).Get(key);
+  }
+
+  /// @brief Returns a modifiable value pointer by key or an empty pointer
+  // NOLINTNEXTLINE(readability-const-return-type)
+  const ValuePtr Get(const Key& key) { return GetShard(key).Get(key); }
+
+  /// @brief Removes a key from the map
+  /// @returns whether the key was present
+  /// @note Copies the shard of the key.
+  bool Erase(const Key& key) { return GetShard(key).Erase(key); }
+
+  /// @brief Removes a key from the map returning its value
+  /// @returns a value if the key was present, empty pointer otherwise
+  /// @note Copies the shard of the key.
+  ValuePtr Pop(const Key& key) { return GetShard(key).Pop(key); }
+
+  /// Resets the map to an empty state, shard by shard
+  void Clear() {
+    for (std::size_t i = 0; i < shard_count_; ++i) shards_[i].Clear();
+  }
+
+  /// Replace current data by data from `new_map`, shard by shard
+  void Assign(RawMap new_map) {
+    auto new_shards = std::make_unique<RawMap[]>(shard_count_);
+    for (auto& [key, value] : new_map) {
+      new_shards[GetShardIndex(key)].emplace(key, std::move(value));
+    }
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+      shards_[i].Assign(std::move(new_shards[i]));
+    }
+  }
+
+  /// @brief Returns a readonly copy of the map
+  Snapshot GetSnapshot() const {
+    Snapshot result;
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+      auto shard_snapshot = shards_[i].GetSnapshot();
+      result.insert(std::make_move_iterator(shard_snapshot.begin()),
+                    std::make_move_iterator(shard_snapshot.end()));
+    }
+    return result;
+  }
+
+ private:
+  std::size_t GetShardIndex(const Key& key) const {
+    // The shard maps use the low bits of the same hash for their buckets, mix
+    // the bits to keep both distributions uniform
+    const auto hash = static_cast<std::uint64_t>(Hash{}(key));
+    return ((hash * 0x9E3779B97F4A7C15ULL) >> 32) % shard_count_;
+  }
+
+  Shard& GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+
+  const Shard& GetShard(const Key& key) const {
+    return shards_[GetShardIndex(key)];
+  }
+
+  const std::unique_ptr<Shard[]> shards_;
+  const std::size_t shard_count_;
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
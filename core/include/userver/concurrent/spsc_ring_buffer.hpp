@@ -0,0 +1,310 @@
+#pragma once
+
+/// @file userver/concurrent/spsc_ring_buffer.hpp
+/// @brief @copybrief concurrent::SpscRingBuffer
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <userver/concurrent/queue_helpers.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace concurrent {
+
+/// @ingroup userver_concurrency
+///
+/// @brief Bounded single producer single consumer queue of trivially copyable
+/// values on top of a preallocated ring buffer.
+///
+/// Unlike concurrent::SpscQueue, pushes and pops do not allocate and do not
+/// touch the semaphores. The waiting side spins for a while and then sleeps
+/// on an engine::SingleConsumerEvent, the other side notifies it only if it
+/// sleeps. The batch operations (PushMany, PopMany) commit the whole batch at
+/// once, prefer them for the small values.
+///
+/// Suits two tasks that pass a lot of small records to each other.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+template <typename T>
+class SpscRingBuffer final
+    : public std::enable_shared_from_this<SpscRingBuffer<T>> {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "SpscRingBuffer only supports trivially copyable types, use "
+                "concurrent::SpscQueue for the other ones");
+
+  struct EmplaceEnabler final {
+    // Disable {}-initialization in Queue's constructor
+    explicit EmplaceEnabler() = default;
+  };
+
+  using ProducerToken = impl::NoToken;
+  using ConsumerToken = impl::NoToken;
+
+  friend class Producer<SpscRingBuffer, ProducerToken, EmplaceEnabler>;
+  friend class Consumer<SpscRingBuffer, ConsumerToken, EmplaceEnabler>;
+
+ public:
+  using ValueType = T;
+
+  using Producer =
+      concurrent::Producer<SpscRingBuffer, ProducerToken, EmplaceEnabler>;
+  using Consumer =
+      concurrent::Consumer<SpscRingBuffer, ConsumerToken, EmplaceEnabler>;
+
+  /// @cond
+  // For internal use only
+  explicit SpscRingBuffer(std::size_t capacity, EmplaceEnabler /*unused*/)
+      : mask_(RoundUpToPowerOfTwo(capacity) - 1),
+        queue_(std::make_unique<T[]>(mask_ + 1)) {}
+
+  SpscRingBuffer(SpscRingBuffer&&) = delete;
+  SpscRingBuffer(const SpscRingBuffer&) = delete;
+  SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+  SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+  ~SpscRingBuffer() {
+    UASSERT(producer_is_dead_ || !producer_is_created_);
+    UASSERT(consumer_is_dead_ || !consumer_is_created_);
+  }
+  /// @endcond
+
+  /// Create a new queue, `capacity` is rounded up to a power of two
+  static std::shared_ptr<SpscRingBuffer> Create(std::size_t capacity) {
+    return std::make_shared<SpscRingBuffer>(capacity, EmplaceEnabler{});
+  }
+
+  /// Get a `Producer` which makes it possible to push items into the queue.
+  /// Can be called only once.
+  ///
+  /// @note `Producer` may outlive the queue and the `Consumer`.
+  Producer GetProducer() {
+    UINVARIANT(!producer_is_created_.exchange(true),
+               "SpscRingBuffer::Producer must only be obtained a single time");
+    return Producer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// Get a `Consumer` which makes it possible to read items from the queue.
+  /// Can be called only once.
+  ///
+  /// @note `Consumer` may outlive the queue and the `Producer`.
+  Consumer GetConsumer() {
+    UINVARIANT(!consumer_is_created_.exchange(true),
+               "SpscRingBuffer::Consumer must only be obtained a single time");
+    return Consumer(this->shared_from_this(), EmplaceEnabler{});
+  }
+
+  /// @brief Gets the maximum number of elements in the queue
+  std::size_t GetCapacity() const noexcept { return mask_ + 1; }
+
+  /// @brief Gets the approximate size of queue
+  std::size_t GetSizeApproximate() const noexcept {
+    const auto head = head_.load(std::memory_order_relaxed);
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    return tail >= head ? tail - head : 0;
+  }
+
+ private:
+  // The number of the checks before going to sleep
+  static constexpr std::size_t kSpinIterations = 128;
+
+  static constexpr std::size_t kCacheLineSize = 64;
+
+  static std::size_t RoundUpToPowerOfTwo(std::size_t value) {
+    UINVARIANT(value > 0, "SpscRingBuffer capacity must be positive");
+    std::size_t result = 1;
+    while (result < value) result *= 2;
+    return result;
+  }
+
+  [[nodiscard]] bool Push(ProducerToken& /*unused*/, T&& value,
+                          engine::Deadline deadline) {
+    if (!WaitForSpace(1, deadline)) return false;
+    Write(&value, 1);
+    return true;
+  }
+
+  [[nodiscard]] bool PushNoblock(ProducerToken& /*unused*/, T&& value) {
+    if (consumer_is_dead_.load() || !HasSpace(1)) return false;
+    Write(&value, 1);
+    return true;
+  }
+
+  [[nodiscard]] bool PushMany(ProducerToken& /*unused*/,
+                              std::vector<T>& values,
+                              engine::Deadline deadline) {
+    if (values.empty()) return true;
+    if (values.size() > GetCapacity()) return false;
+    if (!WaitForSpace(values.size(), deadline)) return false;
+    Write(values.data(), values.size());
+    values.clear();
+    return true;
+  }
+
+  [[nodiscard]] bool PushManyNoblock(ProducerToken& /*unused*/,
+                                     std::vector<T>& values) {
+    if (values.empty()) return true;
+    if (consumer_is_dead_.load() || !HasSpace(values.size())) return false;
+    Write(values.data(), values.size());
+    values.clear();
+    return true;
+  }
+
+  [[nodiscard]] bool Pop(ConsumerToken& /*unused*/, T& value,
+                         engine::Deadline deadline) {
+    return WaitForElements(deadline) && Read(&value, 1) == 1;
+  }
+
+  [[nodiscard]] bool PopNoblock(ConsumerToken& /*unused*/, T& value) {
+    return Read(&value, 1) == 1;
+  }
+
+  [[nodiscard]] std::size_t PopMany(ConsumerToken& token,
+                                    std::vector<T>& values,
+                                    std::size_t max_count,
+                                    engine::Deadline deadline) {
+    if (max_count == 0 || !WaitForElements(deadline)) return 0;
+    return PopManyNoblock(token, values, max_count);
+  }
+
+  [[nodiscard]] std::size_t PopManyNoblock(ConsumerToken& /*unused*/,
+                                           std::vector<T>& values,
+                                           std::size_t max_count) {
+    max_count = std::min(max_count, GetAvailable());
+    if (max_count == 0) return 0;
+
+    const auto old_size = values.size();
+    values.resize(old_size + max_count);
+    const auto count = Read(values.data() + old_size, max_count);
+    values.resize(old_size + count);
+    return count;
+  }
+
+  void MarkProducerIsDead() {
+    producer_is_dead_ = true;
+    nonempty_event_.Send();
+  }
+
+  void MarkConsumerIsDead() {
+    consumer_is_dead_ = true;
+    nonfull_event_.Send();
+  }
+
+  // Producer side
+
+  bool HasSpace(std::size_t count) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ + count <= GetCapacity()) return true;
+    cached_head_ = head_.load(std::memory_order_acquire);
+    return tail - cached_head_ + count <= GetCapacity();
+  }
+
+  bool WaitForSpace(std::size_t count, engine::Deadline deadline) {
+    for (std::size_t i = 0; i < kSpinIterations; ++i) {
+      if (consumer_is_dead_.load()) return false;
+      if (HasSpace(count)) return true;
+    }
+
+    while (true) {
+      is_producer_sleeping_.store(true, std::memory_order_relaxed);
+      // Pairs with the fence in Read
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (consumer_is_dead_.load() || HasSpace(count)) break;
+      if (!nonfull_event_.WaitForEventUntil(deadline)) break;
+    }
+    is_producer_sleeping_.store(false, std::memory_order_relaxed);
+    return !consumer_is_dead_.load() && HasSpace(count);
+  }
+
+  void Write(const T* values, std::size_t count) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < count; ++i) {
+      queue_[(tail + i) & mask_] = values[i];
+    }
+    tail_.store(tail + count, std::memory_order_release);
+
+    // Pairs with the fence in WaitForElements
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (is_consumer_sleeping_.load(std::memory_order_relaxed)) {
+      nonempty_event_.Send();
+    }
+  }
+
+  // Consumer side
+
+  std::size_t GetAvailable() {
+    const auto head = head_.load(std::memory_order_relaxed);
+    if (cached_tail_ != head) return cached_tail_ - head;
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    return cached_tail_ - head;
+  }
+
+  bool WaitForElements(engine::Deadline deadline) {
+    for (std::size_t i = 0; i < kSpinIterations; ++i) {
+      if (GetAvailable() != 0) return true;
+      if (producer_is_dead_.load()) break;
+    }
+
+    while (true) {
+      is_consumer_sleeping_.store(true, std::memory_order_relaxed);
+      // Pairs with the fence in Write
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (GetAvailable() != 0 || producer_is_dead_.load()) break;
+      if (!nonempty_event_.WaitForEventUntil(deadline)) break;
+    }
+    is_consumer_sleeping_.store(false, std::memory_order_relaxed);
+    // Producer might have pushed something before dying, check twice to avoid
+    // TOCTOU
+    return GetAvailable() != 0;
+  }
+
+  std::size_t Read(T* values, std::size_t max_count) {
+    const auto count = std::min(max_count, GetAvailable());
+    if (count == 0) return 0;
+
+    const auto head = head_.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < count; ++i) {
+      values[i] = queue_[(head + i) & mask_];
+    }
+    head_.store(head + count, std::memory_order_release);
+
+    // Pairs with the fence in WaitForSpace
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (is_producer_sleeping_.load(std::memory_order_relaxed)) {
+      nonfull_event_.Send();
+    }
+    return count;
+  }
+
+  const std::size_t mask_;
+  // The storage of the ring buffer. Named `queue_` for the Producer and
+  // Consumer helpers.
+  const std::unique_ptr<T[]> queue_;
+
+  // Written by the producer
+  alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};
+  std::atomic<bool> is_producer_sleeping_{false};
+  std::size_t cached_head_{0};
+
+  // Written by the consumer
+  alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};
+  std::atomic<bool> is_consumer_sleeping_{false};
+  std::size_t cached_tail_{0};
+
+  alignas(kCacheLineSize) engine::SingleConsumerEvent nonempty_event_;
+  engine::SingleConsumerEvent nonfull_event_;
+  std::atomic<bool> producer_is_created_{false};
+  std::atomic<bool> consumer_is_created_{false};
+  std::atomic<bool> producer_is_dead_{false};
+  std::atomic<bool> consumer_is_dead_{false};
+};
+
+}  // namespace concurrent
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/formats/json_fwd.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+struct GradientConfig {
+  // Ratio of the current timings to the long-term ones that is not considered
+  // a queue growth
+  double tolerance{1.5};
+  // Share of the newly computed limit applied at each step
+  double smoothing{0.2};
+  double errors_threshold_percent{5.0};  // 5%
+  std::size_t safe_delta_limit{10};
+  std::size_t min_limit{10};
+  std::size_t min_qps{10};
+};
+
+GradientConfig Parse(const formats::json::Value& value,
+                     formats::parse::To<GradientConfig>);
+
+/// Concurrency limiting controller in the spirit of Netflix Gradient2.
+///
+/// Tracks the ratio of the long-term timings to the current ones. While the
+/// current timings stay within the tolerance there is no limit. Once they
+/// grow, which means that requests are queued, the limit is set to the current
+/// load and then is continuously multiplied by the gradient with a small
+/// headroom of sqrt(limit), so it shrinks while the queue grows and recovers
+/// as soon as the timings return to normal.
+class GradientController final : public Controller {
+ public:
+  using StaticConfig = Controller::Config;
+
+  GradientController(
+      const std::string& name, v2::Sensor& sensor, Limiter& limiter,
+      Stats& stats, const StaticConfig& config,
+      dynamic_config::Source config_source,
+      std::function<GradientConfig(const dynamic_config::Snapshot&)>
+          config_getter);
+
+  Limit Update(const Sensor::Data& current) override;
+
+ private:
+  double long_timings_{0};
+  std::size_t epochs_passed_{0};
+  std::optional<double> limit_;
+
+  dynamic_config::Source config_source_;
+  std::function<GradientConfig(const dynamic_config::Snapshot&)>
+      config_getter_;
+};
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
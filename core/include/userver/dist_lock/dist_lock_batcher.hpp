@@ -0,0 +1,123 @@
+#pragma once
+
+/// @file userver/dist_lock/dist_lock_batcher.hpp
+/// @brief @copybrief dist_lock::DistLockBatcher
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/dist_lock/dist_lock_strategy.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+namespace impl {
+class BatcherState;
+}  // namespace impl
+
+/// Request to acquire or prolong a single lock of a batch.
+struct BatchLockRequest {
+  std::string lock_name;
+  std::string locker_id;
+};
+
+/// Outcome of acquiring or prolonging a single lock of a batch.
+struct BatchLockResult {
+  enum class Status {
+    kAcquired,  ///< the lock is held by the requester
+    kBusy,      ///< the lock is held by another host
+    kFailed,    ///< backend failed to process this lock
+  };
+
+  Status status{Status::kFailed};
+
+  /// Token that the backend increases each time the lock changes its owner,
+  /// 0 if the backend does not support fencing.
+  std::uint64_t fencing_token{0};
+};
+
+/// @ingroup userver_base_classes userver_concurrency
+///
+/// @brief Interface for distributed lock strategies that acquire and prolong
+/// many locks in a single round-trip to the backend.
+///
+/// Use with dist_lock::DistLockBatcher.
+class BatchedDistLockStrategyBase {
+ public:
+  virtual ~BatchedDistLockStrategyBase() = default;
+
+  /// Acquires or prolongs all the locks of the batch.
+  ///
+  /// @param lock_ttl The duration for which the locks must be held.
+  /// @param requests Locks to acquire, lock names are unique within a batch.
+  /// @returns results in the order of `requests`
+  /// @throws anything when the whole batch fails, strategy is responsible for
+  /// cleanup.
+  virtual std::vector<BatchLockResult> AcquireBatch(
+      std::chrono::milliseconds lock_ttl,
+      const std::vector<BatchLockRequest>& requests) = 0;
+
+  /// Releases the lock.
+  ///
+  /// @note Exceptions are ignored.
+  virtual void Release(const BatchLockRequest& request) = 0;
+};
+
+/// Batcher settings
+struct DistLockBatcherSettings {
+  /// For how long the first lock of a batch waits for other locks to join.
+  /// Should be noticeably less than DistLockSettings::prolong_interval.
+  std::chrono::milliseconds batch_window{10};
+
+  /// The batch is sent right away when it has this many locks.
+  std::size_t max_batch_size{1000};
+};
+
+/// @brief Groups Acquire() calls of many distributed locks into batches
+///
+/// Each lock gets its own DistLockStrategyBase from MakeStrategy() to be used
+/// with DistLockedWorker or DistLockedTask as usual. Acquisitions and
+/// prolongations of the locks that happen within the batch window are sent to
+/// the backend as a single BatchedDistLockStrategyBase::AcquireBatch() call,
+/// so the number of round-trips does not grow with the number of locks.
+///
+/// The batcher also caches the fencing tokens of the held locks along with
+/// their lease deadlines, so the workers may check their ownership without
+/// going to the backend.
+///
+/// The batcher is cheap to copy, all the copies share the same state.
+class DistLockBatcher final {
+ public:
+  explicit DistLockBatcher(
+      std::shared_ptr<BatchedDistLockStrategyBase> strategy,
+      const DistLockBatcherSettings& settings = {});
+
+  ~DistLockBatcher();
+
+  /// Returns a strategy for the lock `lock_name`, the strategy keeps the
+  /// batcher state alive.
+  /// @note A lock name must be used by at most one worker at a time.
+  std::shared_ptr<DistLockStrategyBase> MakeStrategy(std::string lock_name);
+
+  /// Returns the fencing token of the lock if it is held by this process and
+  /// its lease has not expired yet, without going to the backend.
+  std::optional<std::uint64_t> GetFencingToken(
+      std::string_view lock_name) const;
+
+  /// Returns the number of AcquireBatch() calls made so far.
+  std::size_t GetBatchesCount() const noexcept;
+
+ private:
+  std::shared_ptr<impl::BatcherState> state_;
+};
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
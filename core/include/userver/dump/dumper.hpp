@@ -85,6 +85,8 @@ enum class UpdateType {
 /// `min-interval` | `string` (duration) | `WriteDumpAsync` calls performed in a fast succession are ignored | `0s`
 /// `fs-task-processor` | `string` | `TaskProcessor` for blocking disk IO | `fs-task-processor`
 /// `encrypted` | `boolean` | Whether to encrypt the dump | `false`
+/// `memory-mapped` | `boolean` | Whether to `mmap` the dump instead of reading it, see dump::MappedMap | `false`
+/// `compressed` | `boolean` | Whether to compress the dump with zstd, requires `USERVER_FEATURE_ZSTD` | `false`
 ///
 /// ## Sample usage
 /// @snippet core/src/dump/dumper_test.cpp  Sample Dumper usage
@@ -166,7 +168,7 @@ class Dumper final {
          const components::ComponentContext& context, DumpableEntity& dumpable);
 
   class Impl;
-  utils::FastPimpl<Impl, 1088, 16> impl_;
+  utils::FastPimpl<Impl, 1136, 16> impl_;
 };
 
 }  // namespace dump
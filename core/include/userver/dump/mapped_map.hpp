@@ -0,0 +1,216 @@
+#pragma once
+
+/// @file userver/dump/mapped_map.hpp
+/// @brief @copybrief dump::MappedMap
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/operations.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+/// A sorted array of string keys and values, stored as a single flat buffer
+/// with offset-based references
+class MappedImage final {
+ public:
+  using Entries = std::vector<std::pair<std::string_view, std::string_view>>;
+
+  /// Creates an empty image
+  MappedImage();
+
+  /// Creates an image from the entries, on duplicate keys the last one wins
+  explicit MappedImage(Entries entries);
+
+  /// @throws `Error` if `data` does not contain a valid image
+  explicit MappedImage(SharedData data);
+
+  std::size_t GetSize() const noexcept { return size_; }
+
+  std::string_view GetKey(std::size_t index) const;
+
+  std::string_view GetValue(std::size_t index) const;
+
+  std::optional<std::size_t> Find(std::string_view key) const;
+
+  std::string_view GetBytes() const noexcept { return data_.data; }
+
+ private:
+  SharedData data_;
+  std::size_t size_{0};
+};
+
+void Write(Writer& writer, const MappedImage& value);
+
+MappedImage Read(Reader& reader, To<MappedImage>);
+
+}  // namespace impl
+
+/// @ingroup userver_containers
+///
+/// @brief An immutable string-keyed map, that can be loaded from a dump
+/// without any parsing or allocations.
+///
+/// The map is stored as a single flat buffer: a sorted array of entries
+/// followed by the keys and values, referenced by offsets. The same buffer
+/// is written to the dump as-is. When the dump is read with `memory-mapped`
+/// option of dump::Dumper enabled, the map keeps serving reads directly from
+/// the mapping, and the pages of the dump file are only loaded on access.
+/// Other readers copy the buffer in one go, which is still much faster than
+/// field-by-field parsing.
+///
+/// `Value` must either be `std::string` (returned as `std::string_view`)
+/// or a trivially copyable type without pointers (returned by value).
+/// Lookups are `O(log n)`. Copying the map is cheap, the copies share
+/// the buffer.
+///
+/// To use it in a cache, specify `dump::MappedMap<Value>` as the cache
+/// `DataType` and construct a new map in `Update` from any range of key-value
+/// pairs.
+template <typename Value>
+class MappedMap final {
+  static_assert(std::is_same_v<Value, std::string> ||
+                    std::is_trivially_copyable_v<Value>,
+                "dump::MappedMap only supports std::string and trivially "
+                "copyable values");
+
+ public:
+  using ValueView = std::conditional_t<std::is_same_v<Value, std::string>,
+                                       std::string_view, Value>;
+  using value_type = std::pair<std::string_view, ValueView>;
+
+  class Iterator final {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = MappedMap::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type;
+    using pointer = void;
+
+    Iterator() = default;
+
+    value_type operator*() const { return map_->At(index_); }
+
+    Iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++index_;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const Iterator& other) const noexcept {
+      return index_ != other.index_;
+    }
+
+   private:
+    friend class MappedMap;
+
+    Iterator(const MappedMap* map, std::size_t index)
+        : map_(map), index_(index) {}
+
+    const MappedMap* map_{nullptr};
+    std::size_t index_{0};
+  };
+
+  /// Creates an empty map
+  MappedMap() = default;
+
+  /// @brief Creates a map from a range of key-value pairs
+  /// @note On duplicate keys the last one wins
+  template <typename Range, typename = std::enable_if_t<!std::is_same_v<
+                                std::decay_t<Range>, MappedMap>>>
+  explicit MappedMap(const Range& range) : image_(MakeEntries(range)) {}
+
+  std::size_t size() const noexcept { return image_.GetSize(); }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  Iterator begin() const { return Iterator{this, 0}; }
+
+  Iterator end() const { return Iterator{this, size()}; }
+
+  /// @returns the value for `key` or `std::nullopt` if it is missing
+  std::optional<ValueView> Find(std::string_view key) const {
+    const auto index = image_.Find(key);
+    if (!index) return std::nullopt;
+    return ToValue(image_.GetValue(*index));
+  }
+
+  bool Contains(std::string_view key) const {
+    return image_.Find(key).has_value();
+  }
+
+ private:
+  friend void Write(Writer& writer, const MappedMap& value) {
+    writer.Write(value.image_);
+  }
+
+  friend MappedMap Read(Reader& reader, To<MappedMap>) {
+    return MappedMap{reader.Read<impl::MappedImage>()};
+  }
+
+  explicit MappedMap(impl::MappedImage&& image) : image_(std::move(image)) {}
+
+  template <typename Range>
+  static impl::MappedImage::Entries MakeEntries(const Range& range) {
+    impl::MappedImage::Entries entries;
+    if constexpr (meta::kIsSizable<Range>) entries.reserve(std::size(range));
+    for (const auto& [key, value] : range) {
+      entries.emplace_back(std::string_view{key}, ToBytes(value));
+    }
+    return entries;
+  }
+
+  static std::string_view ToBytes(const Value& value) {
+    if constexpr (std::is_same_v<Value, std::string>) {
+      return value;
+    } else {
+      return {reinterpret_cast<const char*>(&value), sizeof(Value)};
+    }
+  }
+
+  static ValueView ToValue(std::string_view bytes) {
+    if constexpr (std::is_same_v<Value, std::string>) {
+      return bytes;
+    } else {
+      if (bytes.size() != sizeof(Value)) {
+        throw Error("Unexpected value size in dump::MappedMap");
+      }
+      Value value{};
+      // the mapped value is not necessarily aligned
+      std::memcpy(&value, bytes.data(), sizeof(Value));
+      return value;
+    }
+  }
+
+  value_type At(std::size_t index) const {
+    return {image_.GetKey(index), ToValue(image_.GetValue(index))};
+  }
+
+  impl::MappedImage image_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -19,6 +20,13 @@ class Error final : public std::runtime_error {
   explicit Error(std::string message) : std::runtime_error(message) {}
 };
 
+/// @brief A chunk of dump data that stays valid for as long as `holder` is
+/// alive, regardless of the subsequent reads
+struct SharedData final {
+  std::shared_ptr<const void> holder;
+  std::string_view data;
+};
+
 /// A general interface for binary data output
 class Writer {
  public:
@@ -68,7 +76,15 @@ class Reader {
   /// @throws `Error` on read operation failure
   virtual std::string_view ReadRaw(std::size_t max_size) = 0;
 
+  /// @brief Reads exactly `size` bytes of binary data, the result outlives
+  /// the `Reader`
+  /// @note The default implementation copies the data returned by `ReadRaw`.
+  /// Readers backed by a memory mapping return a part of the mapping.
+  /// @throws `Error` on read operation failure or on end-of-file
+  virtual SharedData ReadShared(std::size_t size);
+
   friend std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t size);
+  friend SharedData ReadSharedUnsafe(Reader& reader, std::size_t size);
 };
 
 namespace impl {
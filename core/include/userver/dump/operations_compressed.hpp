@@ -0,0 +1,73 @@
+#pragma once
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/utils/fast_pimpl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// @brief Writes a zstd-compressed dump file.
+///
+/// The data is split into blocks, that are compressed in parallel on the
+/// current task processor. Each block is protected by a CRC32C checksum.
+/// An index of the blocks is written at the end of the file.
+class CompressedWriter final : public Writer {
+ public:
+  /// @brief Creates a new dump file and opens it
+  /// @throws `Error` on a filesystem error
+  CompressedWriter(std::string path, boost::filesystem::perms perms,
+                   tracing::ScopeTime& scope);
+
+  ~CompressedWriter() override;
+
+  void Finish() override;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  struct Impl;
+  utils::FastPimpl<Impl, 336, 8> impl_;
+};
+
+/// @brief Reads a dump file written by `CompressedWriter`.
+///
+/// The blocks are decompressed ahead of time in parallel on the current task
+/// processor. A block with a checksum mismatch fails the read with `Error`
+/// before any of its data is returned.
+class CompressedReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file and reads the block index
+  /// @throws `Error` on a filesystem error or on a malformed index
+  explicit CompressedReader(std::string path);
+
+  ~CompressedReader() override;
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  struct Impl;
+  utils::FastPimpl<Impl, 232, 8> impl_;
+};
+
+class CompressedOperationsFactory final : public OperationsFactory {
+ public:
+  explicit CompressedOperationsFactory(boost::filesystem::perms perms);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const boost::filesystem::perms perms_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
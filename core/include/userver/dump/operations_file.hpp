@@ -52,9 +52,33 @@ class FileReader final : public Reader {
   std::string curr_chunk_;
 };
 
+/// @brief A handle to a dump file that is memory-mapped instead of being read.
+/// @details Only the pages that are actually accessed are loaded from disk.
+/// The data returned by `ReadSharedUnsafe` points into the mapping and keeps
+/// it alive after the reader is destroyed. Dump files are never modified in
+/// place, so the mapping stays valid even if the dump file is removed.
+class MappedFileReader final : public Reader {
+ public:
+  /// @brief Opens and maps an existing dump file
+  /// @throws `Error` on a filesystem error
+  explicit MappedFileReader(std::string path);
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+  SharedData ReadShared(std::size_t size) override;
+
+  std::string path_;
+  std::shared_ptr<const void> mapping_;
+  std::string_view data_;
+  std::size_t position_{0};
+};
+
 class FileOperationsFactory final : public OperationsFactory {
  public:
-  explicit FileOperationsFactory(boost::filesystem::perms perms);
+  explicit FileOperationsFactory(boost::filesystem::perms perms,
+                                 bool memory_mapped = false);
 
   std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -63,6 +87,7 @@ class FileOperationsFactory final : public OperationsFactory {
 
  private:
   const boost::filesystem::perms perms_;
+  const bool memory_mapped_;
 };
 
 }  // namespace dump
@@ -0,0 +1,178 @@
+#pragma once
+
+/// @file userver/dump/parallel_helpers.hpp
+/// @brief Convenience functions to load and dump containers in parallel in
+/// classes derived from components::CachingComponentBase.
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/meta_containers.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+/// A `Writer` that appends to a string buffer
+class BufferWriter final : public Writer {
+ public:
+  void Finish() override;
+
+  std::string Extract() &&;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  std::string data_;
+};
+
+/// A `Reader` that reads from a buffer, which must outlive the `Reader`
+class BufferReader final : public Reader {
+ public:
+  explicit BufferReader(std::string_view data);
+
+  void Finish() override;
+
+ private:
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string_view unread_data_;
+};
+
+template <typename T>
+using MergeResult = decltype(std::declval<T&>().merge(std::declval<T&>()));
+
+template <typename T>
+void MergeShard(T& result, T&& shard) {
+  if constexpr (meta::kIsDetected<MergeResult, T>) {
+    // moves the nodes without reallocating the elements
+    result.merge(shard);
+  } else {
+    for (auto& item : shard) {
+      dump::Insert(result, std::move(item));
+    }
+  }
+}
+
+}  // namespace impl
+
+/// @brief Convenience function to use in
+/// components::CachingComponentBase::WriteContents override to dump a large
+/// container in parallel.
+///
+/// The container is split into `shard_count` shards of equal size, and each
+/// shard is serialized on a separate task of the current task processor,
+/// which is the `fs-task-processor` of the dump. The shards are written to
+/// `writer` in order as soon as they are ready, so the encryption
+/// of the dump overlaps with the serialization.
+///
+/// @note The dump written with `WriteParallel` must be read with
+/// `ReadParallel`. Serialized shards are kept in memory until written.
+///
+/// @see @ref scripts/docs/en/userver/cache_dumps.md
+template <typename T>
+void WriteParallel(Writer& writer, const T& contents,
+                   std::size_t shard_count) {
+  static_assert(kIsContainer<T> && kIsWritable<meta::RangeValueType<T>>);
+  UINVARIANT(shard_count != 0, "shard_count must be positive");
+
+  const std::size_t size = std::size(contents);
+  shard_count = std::max(std::min(shard_count, size), std::size_t{1});
+
+  using Iterator = decltype(std::begin(contents));
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  tasks.reserve(shard_count);
+
+  Iterator shard_begin = std::begin(contents);
+  for (std::size_t i = 0; i < shard_count; ++i) {
+    const std::size_t shard_size =
+        size / shard_count + (i < size % shard_count ? 1 : 0);
+    Iterator shard_end = shard_begin;
+    std::advance(shard_end, shard_size);
+
+    tasks.push_back(utils::Async(
+        "dump-write-shard", [shard_begin, shard_end, shard_size] {
+          impl::BufferWriter shard_writer;
+          shard_writer.Write(shard_size);
+          for (auto it = shard_begin; it != shard_end; ++it) {
+            // explicit cast for vector<bool> shenanigans
+            shard_writer.Write(
+                static_cast<const meta::RangeValueType<T>&>(*it));
+          }
+          return std::move(shard_writer).Extract();
+        }));
+    shard_begin = shard_end;
+  }
+
+  writer.Write(tasks.size());
+  for (auto& task : tasks) {
+    writer.Write(task.Get());
+  }
+}
+
+/// @brief Convenience function to use in
+/// components::CachingComponentBase::ReadContents override to load a dump
+/// written by `WriteParallel`.
+///
+/// Each shard is deserialized on a separate task of the current task
+/// processor, then the shards are merged into a single container. Node-based
+/// containers are merged without reallocating the elements.
+///
+/// @see @ref scripts/docs/en/userver/cache_dumps.md
+template <typename T>
+std::unique_ptr<const T> ReadParallel(Reader& reader) {
+  static_assert(kIsContainer<T> && kIsReadable<meta::RangeValueType<T>>);
+
+  const auto shard_count = reader.Read<std::size_t>();
+  std::vector<SharedData> shards;
+  shards.reserve(shard_count);
+  for (std::size_t i = 0; i < shard_count; ++i) {
+    const auto shard_size = reader.Read<std::size_t>();
+    shards.push_back(ReadSharedUnsafe(reader, shard_size));
+  }
+
+  std::vector<engine::TaskWithResult<T>> tasks;
+  tasks.reserve(shard_count);
+  for (const auto& shard : shards) {
+    tasks.push_back(utils::Async("dump-read-shard", [data = shard.data] {
+      impl::BufferReader shard_reader{data};
+      auto result = shard_reader.Read<T>();
+      shard_reader.Finish();
+      return result;
+    }));
+  }
+  auto results = engine::GetAll(tasks);
+  shards.clear();
+
+  auto contents = std::make_unique<T>();
+  if constexpr (meta::kIsReservable<T>) {
+    std::size_t total_size = 0;
+    for (const auto& result : results) total_size += std::size(result);
+    contents->reserve(total_size);
+  }
+  for (auto& result : results) {
+    impl::MergeShard(*contents, std::move(result));
+  }
+  return contents;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
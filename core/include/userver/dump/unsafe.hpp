@@ -27,6 +27,12 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size);
 /// @warning The `string_view` will be invalidated on the next `Read` operation
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size);
 
+/// @brief Reads a non-size-prefixed chunk of data that stays valid for as
+/// long as the returned `SharedData::holder` is alive
+/// @note With `MappedFileReader`, no copying is performed, and the pages of
+/// the file are loaded lazily on access
+SharedData ReadSharedUnsafe(Reader& reader, std::size_t size);
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
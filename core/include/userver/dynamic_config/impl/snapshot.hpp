@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -56,6 +58,12 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  // Parses only the configs that read the docs changed between `previous_docs`
+  // and `docs`, the rest of the configs are shared with `previous`, which
+  // must have been parsed from `previous_docs`
+  SnapshotData(const DocsMap& docs, const SnapshotData& previous,
+               const DocsMap& previous_docs);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -70,10 +78,27 @@ class SnapshotData final {
 
   bool IsEmpty() const noexcept;
 
+  // Returns true if the config is shared between the snapshots, which means
+  // that it is the same. The reverse is not guaranteed.
+  bool IsSameConfig(const SnapshotData& other, ConfigId id) const noexcept;
+
+  // Returns the number of configs parsed for this snapshot, as opposed to
+  // the ones shared with a previous snapshot
+  std::size_t GetParsedCount() const noexcept { return parsed_count_; }
+
  private:
+  struct Config final {
+    std::any value;
+    // Docs read by the factory, nullopt if the value did not come from docs
+    std::optional<std::vector<std::string>> docs_names;
+  };
+
   const std::any& DoGet(ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  void Parse(ConfigId id, const DocsMap& docs);
+
+  std::vector<std::shared_ptr<const Config>> user_configs_;
+  std::size_t parsed_count_{0};
 };
 
 class StorageData;
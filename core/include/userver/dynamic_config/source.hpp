@@ -223,7 +223,12 @@ class Source final {
     UASSERT(!current.GetData().IsEmpty());
     UASSERT(!previous.GetData().IsEmpty());
 
-    const bool is_equal = (true && ... && (previous[keys] == current[keys]));
+    // Configs that were not parsed anew are shared between the snapshots
+    const bool is_equal =
+        (true && ... &&
+         (previous.GetData().IsSameConfig(current.GetData(),
+                                          impl::ConfigIdGetter::Get(keys)) ||
+          previous[keys] == current[keys]));
     return !is_equal;
   }
 
@@ -0,0 +1,163 @@
+#pragma once
+
+/// @file userver/engine/distributed_shared_mutex.hpp
+/// @brief @copybrief engine::DistributedSharedMutex
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @ingroup userver_concurrency
+///
+/// @brief engine::SharedMutex for the read-mostly data: the readers do not
+/// share a counter.
+///
+/// A reader increments a counter of its thread and checks that there is no
+/// writer, so the readers of different threads do not contend on a cache
+/// line. A writer raises a flag that turns the new readers away and waits for
+/// the readers to drain. Writers are slower than the ones of
+/// engine::SharedMutex and the mutex takes a few cache lines, use it when
+/// the mutex is locked for reading on every request and seldom for writing.
+///
+/// Ignores task cancellations (succeeds even if the current task is cancelled).
+///
+/// Writers (unique locks) have priority over readers (shared locks),
+/// thus new shared lock waits for the pending writes to finish, which in turn
+/// waits for existing shared locks to unlock first.
+///
+/// @see @ref scripts/docs/en/userver/synchronization.md
+class DistributedSharedMutex final {
+ public:
+  DistributedSharedMutex();
+  ~DistributedSharedMutex();
+
+  DistributedSharedMutex(const DistributedSharedMutex&) = delete;
+  DistributedSharedMutex(DistributedSharedMutex&&) = delete;
+  DistributedSharedMutex& operator=(const DistributedSharedMutex&) = delete;
+  DistributedSharedMutex& operator=(DistributedSharedMutex&&) = delete;
+
+  /// Locks the mutex for unique ownership. Blocks current coroutine if the
+  /// mutex is locked by another coroutine for reading or writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock();
+
+  /// Unlocks the mutex for unique ownership. Before calling this method the
+  /// the mutex should be locked for unique ownership by current coroutine.
+  void unlock();
+
+  /// Tries to lock the mutex for unique ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock();
+
+  /// Tries to lock the mutex for unique ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_for(const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for unique ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_until(Deadline deadline);
+
+  /// Locks the mutex for shared ownership. Blocks current coroutine if the
+  /// mutex is locked by another coroutine for writing.
+  ///
+  /// @note The method waits for the mutex even if the current task is
+  /// cancelled.
+  void lock_shared();
+
+  /// Unlocks the mutex for shared ownership. Before calling this method the
+  /// mutex should be locked for shared ownership by current coroutine.
+  void unlock_shared();
+
+  /// Tries to lock the mutex for shared ownership without blocking the
+  /// coroutine, returns true if succeeded.
+  [[nodiscard]] bool try_lock_shared();
+
+  /// Tries to lock the mutex for shared ownership in specified duration.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Rep, typename Period>
+  [[nodiscard]] bool try_lock_shared_for(
+      const std::chrono::duration<Rep, Period>&);
+
+  /// Tries to lock the mutex for shared ownership till specified time point.
+  ///
+  /// @returns true if the locking succeeded
+  template <typename Clock, typename Duration>
+  [[nodiscard]] bool try_lock_shared_until(
+      const std::chrono::time_point<Clock, Duration>&);
+
+  /// @overload
+  [[nodiscard]] bool try_lock_shared_until(Deadline deadline);
+
+ private:
+  static constexpr std::size_t kSlotCount = 8;
+
+  // A coroutine may unlock on another thread than it locked on, so a single
+  // slot may go negative, but the sum of the slots may not.
+  struct alignas(64) ReaderSlot final {
+    std::atomic<std::int64_t> readers{0};
+  };
+
+  std::atomic<std::int64_t>& GetCurrentSlot() noexcept;
+  bool HasReaders() const noexcept;
+  void OnReaderLeft() noexcept;
+  bool WaitForReadersToDrain(Deadline deadline);
+  bool WaitForNoWriter(Deadline deadline);
+  void ReleaseWriter();
+
+  ReaderSlot slots_[kSlotCount];
+
+  alignas(64) std::atomic<bool> has_writer_{false};
+  Mutex writers_mutex_;
+  SingleConsumerEvent readers_drained_event_;
+  Mutex writer_left_mutex_;
+  ConditionVariable writer_left_cv_;
+};
+
+template <typename Rep, typename Period>
+bool DistributedSharedMutex::try_lock_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_until(Deadline::FromDuration(duration));
+}
+
+template <typename Rep, typename Period>
+bool DistributedSharedMutex::try_lock_shared_for(
+    const std::chrono::duration<Rep, Period>& duration) {
+  return try_lock_shared_until(Deadline::FromDuration(duration));
+}
+
+template <typename Clock, typename Duration>
+bool DistributedSharedMutex::try_lock_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_until(Deadline::FromTimePoint(until));
+}
+
+template <typename Clock, typename Duration>
+bool DistributedSharedMutex::try_lock_shared_until(
+    const std::chrono::time_point<Clock, Duration>& until) {
+  return try_lock_shared_until(Deadline::FromTimePoint(until));
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
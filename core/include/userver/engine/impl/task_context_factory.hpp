@@ -3,9 +3,11 @@
 #include <cstddef>
 #include <memory>
 #include <new>
+#include <optional>
 #include <utility>
 
 #include <userver/engine/impl/task_context_holder.hpp>
+#include <userver/engine/task/scheduling_class.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/wrapped_call.hpp>
@@ -24,6 +26,8 @@ struct TaskConfig final {
   Task::Importance importance{Task::Importance::kNormal};
   Task::WaitMode wait_mode{Task::WaitMode::kSingleWaiter};
   engine::Deadline deadline;
+  // Inherited from the current task if not set
+  std::optional<SchedulingClass> scheduling_class{};
 };
 
 [[nodiscard]] TaskContext& PlacementNewTaskContext(
@@ -4,6 +4,7 @@
 /// @brief Common definitions and base classes for stream like objects
 
 #include <cstddef>
+#include <initializer_list>
 #include <memory>
 
 #include <userver/engine/deadline.hpp>
@@ -59,14 +60,23 @@ class WritableBase {
   [[nodiscard]] virtual size_t WriteAll(const void* buf, size_t len,
                                         Deadline deadline) = 0;
 
-  [[nodiscard]] virtual size_t WriteAll(std::initializer_list<IoData> list,
+  /// @brief Sends exactly list_size IoData, streams that support vectored
+  /// writes send them with a single call.
+  /// @note Can return less than total length if stream is closed by peer.
+  [[nodiscard]] virtual size_t WriteAll(const IoData* list,
+                                        std::size_t list_size,
                                         Deadline deadline) {
     size_t result{0};
-    for (const auto& io_data : list) {
-      result += WriteAll(io_data.data, io_data.len, deadline);
+    for (std::size_t i = 0; i < list_size; ++i) {
+      result += WriteAll(list[i].data, list[i].len, deadline);
     }
     return result;
   }
+
+  [[nodiscard]] virtual size_t WriteAll(std::initializer_list<IoData> list,
+                                        Deadline deadline) {
+    return WriteAll(list.begin(), list.size(), deadline);
+  }
 };
 
 /// @ingroup userver_base_classes
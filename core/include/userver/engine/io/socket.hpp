@@ -99,6 +99,11 @@ class [[nodiscard]] Socket final : public RwBase {
   [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size,
                                Deadline deadline);
 
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
   /// @brief Sends exactly list_size iovec to the socket.
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const struct iovec* list, std::size_t list_size,
@@ -108,6 +113,15 @@ class [[nodiscard]] Socket final : public RwBase {
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+  /// @brief Sends exactly len bytes of the file starting at offset to the
+  /// socket, with sendfile(2) where available.
+  /// @note Can return less than len if socket is closed by peer or the file
+  /// is shorter.
+  /// @warning Reading the file is blocking, use only for the files that are
+  /// expected to be in the OS page cache.
+  [[nodiscard]] size_t SendFile(int file_fd, std::size_t offset,
+                                std::size_t len, Deadline deadline);
+
   /// @brief Accepts a connection from a listening socket.
   /// @see engine::io::Listen
   [[nodiscard]] Socket Accept(Deadline);
@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file userver/engine/io/splice.hpp
+/// @brief Zero-copy transfer of data between sockets and pipes
+
+#include <cstddef>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/pipe.hpp>
+#include <userver/engine/io/socket.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+/// @brief Moves at least one and at most `len` bytes from `source` to
+/// `destination` inside the kernel with splice(2), the data is not copied
+/// through the userspace. On platforms without splice the data is copied.
+/// @returns the number of bytes moved, 0 if `source` is closed by peer
+/// @throws IoTimeout, IoCancelled or IoSystemError
+[[nodiscard]] std::size_t SpliceSome(Socket& source, PipeWriter& destination,
+                                     std::size_t len, Deadline deadline);
+
+/// @overload
+[[nodiscard]] std::size_t SpliceSome(PipeReader& source, Socket& destination,
+                                     std::size_t len, Deadline deadline);
+
+/// @overload
+[[nodiscard]] std::size_t SpliceSome(PipeReader& source,
+                                     PipeWriter& destination, std::size_t len,
+                                     Deadline deadline);
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,8 @@
 /// @file userver/engine/io/tls_wrapper.hpp
 /// @brief TLS socket wrappers
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,6 +19,39 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::io {
 
+/// @brief Keys to encrypt and decrypt the stateless TLS session tickets.
+///
+/// Each TLS server wrapper has its own SSL context, so the sessions may only
+/// be resumed on another connection if the servers share the ticket keys.
+/// The keys may be rotated at any time: the first key encrypts the new
+/// tickets, the rest only decrypt the tickets issued before the rotation,
+/// and such tickets are renewed with the first key.
+///
+/// Thread safe.
+class TlsSessionTicketKeys final {
+ public:
+  /// Size of a key: 16 bytes of the key name, 32 bytes of the HMAC-SHA256 key
+  /// and 32 bytes of the AES-256 key
+  static constexpr std::size_t kKeySize = 80;
+
+  /// Creates a random key
+  TlsSessionTicketKeys();
+  ~TlsSessionTicketKeys();
+
+  /// @brief Replaces the keys, the first one is used for encryption
+  /// @throws std::invalid_argument if `keys` is empty or a key size is not
+  /// kKeySize
+  void SetKeys(std::vector<std::string> keys);
+
+  /// @cond
+  class Impl;
+  Impl& GetImpl() noexcept { return *impl_; }
+  /// @endcond
+
+ private:
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Class for TLS communications over a Socket.
 ///
 /// Not thread safe.
@@ -30,11 +65,23 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
                                    const std::string& server_name,
                                    Deadline deadline);
 
-  /// Starts a TLS server on an opened socket
+  /// @brief Starts a TLS server on an opened socket
+  /// @param alpn_protocols application protocols to negotiate with ALPN, in
+  /// the order of preference, e.g. `{"h2", "http/1.1"}`
+  /// @param kernel_tls offload the record encryption to the kernel (kTLS)
+  /// after the handshake where supported by OpenSSL, the kernel and the
+  /// negotiated cipher; falls back to the userspace encryption otherwise.
+  /// The socket returned by StopTls() of a kTLS session may only be closed.
+  /// @param session_ticket_keys keys of the session tickets shared with the
+  /// other servers to resume the sessions, must outlive the wrapper; the
+  /// tickets of this server only are issued if null
   static TlsWrapper StartTlsServer(
       Socket&& socket, const crypto::Certificate& cert,
       const crypto::PrivateKey& key, Deadline deadline,
-      const std::vector<crypto::Certificate>& cert_authorities = {});
+      const std::vector<crypto::Certificate>& cert_authorities = {},
+      const std::vector<std::string>& alpn_protocols = {},
+      bool kernel_tls = false,
+      TlsSessionTicketKeys* session_ticket_keys = nullptr);
 
   ~TlsWrapper() override;
 
@@ -66,6 +113,13 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
   /// @note Can return less than len if socket is closed by peer.
   [[nodiscard]] size_t SendAll(const void* buf, size_t len, Deadline deadline);
 
+  /// @brief Sends exactly list_size IoData to the socket.
+  /// @note Small buffers are coalesced with the following ones to produce
+  /// fewer TLS records and socket writes.
+  /// @note Can return less than len if socket is closed by peer.
+  [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size,
+                               Deadline deadline);
+
   /// @brief Finishes TLS session and returns the socket.
   /// @warning Wrapper becomes invalid on entry and can only be used to retry
   ///   socket extraction if interrupted.
@@ -93,6 +147,30 @@ class [[nodiscard]] TlsWrapper final : public RwBase {
     return SendAll(buf, len, deadline);
   }
 
+  [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size,
+                                Deadline deadline) override {
+    return SendAll(list, list_size, deadline);
+  }
+
+  [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list,
+                                Deadline deadline) override {
+    return SendAll(list.begin(), list.size(), deadline);
+  }
+
+  /// Returns the protocol negotiated with ALPN, empty if none
+  std::string GetAlpnProtocol() const;
+
+  /// Returns whether the session was resumed instead of a full handshake
+  bool IsSessionReused() const;
+
+  /// @brief Returns whether the record encryption of the sent data is
+  /// offloaded to the kernel
+  bool IsKernelTlsSendEnabled() const;
+
+  /// @brief Returns whether the record decryption of the received data is
+  /// offloaded to the kernel
+  bool IsKernelTlsRecvEnabled() const;
+
   int GetRawFd();
 
  private:
@@ -20,6 +20,10 @@ namespace engine {
 ///
 /// Ignores task cancellations (succeeds even if the current task is cancelled).
 ///
+/// Under contention a task spins for a short adaptive time before going to
+/// sleep, as the lock is usually released sooner than a sleep and a wakeup
+/// take.
+///
 /// ## Example usage:
 ///
 /// @snippet engine/mutex_test.cpp  Sample engine::Mutex usage
@@ -27,7 +31,20 @@ namespace engine {
 /// @see @ref scripts/docs/en/userver/synchronization.md
 class Mutex final {
  public:
+  /// @brief What happens to the mutex on unlock if there are waiters
+  enum class Fairness {
+    /// The mutex is released and a waiter is woken up to compete for it with
+    /// other tasks. Provides the best throughput.
+    kUnfair,
+
+    /// The ownership is passed directly to the longest waiting task, other
+    /// tasks can not grab the mutex in between. Bounds the waiting time of
+    /// each task on hot mutexes at the cost of throughput.
+    kHandoff,
+  };
+
   Mutex();
+  explicit Mutex(Fairness fairness);
   ~Mutex();
 
   Mutex(const Mutex&) = delete;
@@ -46,8 +63,9 @@ class Mutex final {
   /// Unlocks the mutex. Before calling this method the mutex should be locked
   /// by the current coroutine.
   ///
-  /// @note the order of coroutines to unblock is unspecified. Any code assuming
-  /// any specific order (e.g. FIFO) is incorrect and should be fixed.
+  /// @note the order of coroutines to unblock is unspecified unless the mutex
+  /// is constructed with Fairness::kHandoff. Any code assuming any specific
+  /// order (e.g. FIFO) for a default mutex is incorrect and should be fixed.
   void unlock();
 
   /// Tries to lock the mutex without blocking the coroutine, returns true if
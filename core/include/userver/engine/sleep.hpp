@@ -15,6 +15,21 @@ namespace engine {
 /// other tasks to execute
 void Yield();
 
+/// @brief Returns true if the current task step runs for longer than the
+/// `preemption-time-slice` of the task processor, meaning that a long-running
+/// CPU-bound loop should call engine::Yield() to let other tasks execute.
+///
+/// The check is a single relaxed atomic load. Always returns false outside of
+/// the task processors with `preemption-time-slice` set.
+///
+/// @warning Yielding while holding a std::mutex or other thread-bound lock
+/// is not allowed, so the loops should check the flag only at safe points.
+bool ShouldYield() noexcept;
+
+/// @brief Calls engine::Yield() if engine::ShouldYield() returns true, a
+/// cheap cooperative preemption point for long-running CPU-bound loops.
+void YieldIfNeeded();
+
 /// @cond
 /// Recursion stoppers/specializations
 void InterruptibleSleepUntil(Deadline);
@@ -13,6 +13,11 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::io {
+class PipeReader;
+class PipeWriter;
+}  // namespace engine::io
+
 namespace engine::subprocess {
 
 class ChildProcessImpl;
@@ -63,9 +68,24 @@ class ChildProcess final {
   /// Send a signal to the child process.
   void SendSignal(int signum);
 
+  /// @brief Writing end of the pipe connected to stdin of the child, see
+  /// ExecOptions::pipe_stdin. Close it to signal the end of input.
+  /// @throws std::logic_error if stdin of the child is not piped
+  io::PipeWriter& GetStdin();
+
+  /// @brief Reading end of the pipe connected to stdout of the child, see
+  /// ExecOptions::pipe_stdout.
+  /// @throws std::logic_error if stdout of the child is not piped
+  io::PipeReader& GetStdout();
+
+  /// @brief Reading end of the pipe connected to stderr of the child, see
+  /// ExecOptions::pipe_stderr.
+  /// @throws std::logic_error if stderr of the child is not piped
+  io::PipeReader& GetStderr();
+
  private:
   static constexpr std::size_t kImplSize =
-      compiler::SelectSize().For64Bit(24).For32Bit(12);
+      compiler::SelectSize().For64Bit(96).For32Bit(48);
   static constexpr std::size_t kImplAlignment = alignof(void*);
   utils::FastPimpl<ChildProcessImpl, kImplSize, kImplAlignment> impl_;
 };
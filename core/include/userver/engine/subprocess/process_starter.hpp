@@ -22,6 +22,27 @@ class ThreadControl;
 
 namespace subprocess {
 
+/// @brief Options of ProcessStarter::Exec
+struct ExecOptions final {
+  /// Environment variables of the child process, the current environment is
+  /// used if not set
+  std::optional<EnvironmentVariables> env;
+
+  /// File to append the stdout of the child process to
+  std::optional<std::string> stdout_file;
+  /// File to append the stderr of the child process to
+  std::optional<std::string> stderr_file;
+
+  /// Connect stdin of the child process to ChildProcess::GetStdin()
+  bool pipe_stdin{false};
+  /// Connect stdout of the child process to ChildProcess::GetStdout(),
+  /// conflicts with `stdout_file`
+  bool pipe_stdout{false};
+  /// Connect stderr of the child process to ChildProcess::GetStderr(),
+  /// conflicts with `stderr_file`
+  bool pipe_stderr{false};
+};
+
 /// @ingroup userver_clients
 ///
 /// @brief Creates a new OS subprocess and executes a command in it.
@@ -53,7 +74,20 @@ class ProcessStarter {
       const std::optional<std::string>& stdout_file = std::nullopt,
       const std::optional<std::string>& stderr_file = std::nullopt);
 
+  /// @brief Exec subprocess with the standard streams optionally connected to
+  /// async pipes.
+  ///
+  /// @snippet engine/subprocess/process_starter_test.cpp  Exec with pipes
+  ChildProcess Exec(const std::string& command,
+                    const std::vector<std::string>& args,
+                    const ExecOptions& options);
+
  private:
+  ChildProcess DoExec(const std::string& command,
+                      const std::vector<std::string>& args,
+                      const EnvironmentVariables& env,
+                      const ExecOptions& options);
+
   ev::ThreadControl& thread_control_;
 };
 
@@ -0,0 +1,49 @@
+#pragma once
+
+/// @file userver/engine/task/scheduling_class.hpp
+/// @brief @copybrief engine::SchedulingClass
+
+#include <cstddef>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// @brief Scheduling class of a task.
+///
+/// The global task queue of an engine::TaskProcessor serves the classes by
+/// weighted fair share: when all the classes have tasks to run,
+/// kLatencyCritical tasks get 8/13 of the starts, kNormal tasks get 4/13 and
+/// kBackground tasks get 1/13. A class that has no tasks gives its share to
+/// the others. On overload kBackground tasks are cancelled first.
+///
+/// A new task inherits the scheduling class of the task that creates it.
+/// The `work-stealing` task queue ignores the scheduling classes.
+enum class SchedulingClass {
+  kLatencyCritical,
+  kNormal,
+  kBackground,
+};
+
+/// @cond
+inline constexpr std::size_t kSchedulingClassCount = 3;
+/// @endcond
+
+std::string_view ToString(SchedulingClass scheduling_class) noexcept;
+
+namespace current_task {
+
+/// Returns the scheduling class of the current task
+SchedulingClass GetSchedulingClass() noexcept;
+
+/// Sets the scheduling class of the current task. It takes effect from the
+/// next time the task is scheduled, the tasks that are created afterwards by
+/// the current task inherit it.
+void SetSchedulingClass(SchedulingClass scheduling_class) noexcept;
+
+}  // namespace current_task
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
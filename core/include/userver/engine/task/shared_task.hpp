@@ -52,6 +52,9 @@ class [[nodiscard]] SharedTask : public TaskBase {
   SharedTask& operator=(SharedTask&& other) noexcept;
 
   /// @cond
+  // For internal use only.
+  impl::ContextAccessor* TryGetContextAccessor() noexcept;
+
   static constexpr WaitMode kWaitMode = WaitMode::kMultipleWaiters;
 
  protected:
@@ -4,6 +4,7 @@
 /// @brief @copybrief engine::TaskBase
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -180,6 +181,24 @@ TaskProcessor& GetTaskProcessor();
 /// Returns task coroutine stack size
 std::size_t GetStackSize();
 
+/// @brief Resources consumed by the current task since its start
+struct ResourceUsage final {
+  /// Thread CPU time spent while the task was running
+  std::chrono::nanoseconds cpu_time{0};
+  /// Bytes allocated while the task was running, always 0 without jemalloc
+  std::uint64_t allocated_bytes{0};
+};
+
+/// @brief Returns the resources consumed by the current task, all zeros if
+/// the `resource-accounting` option of its task processor is disabled.
+///
+/// Only the current task is accounted, the resources of its child tasks are
+/// accounted in those tasks.
+ResourceUsage GetResourceUsage() noexcept;
+
+/// Returns whether GetResourceUsage() accounts the current task
+bool IsResourceUsageAccounted() noexcept;
+
 /// @cond
 // Returns ev thread handle, internal use only
 ev::ThreadControl& GetEventThread();
@@ -3,6 +3,9 @@
 /// @file userver/fs/fs_cache_client.hpp
 /// @brief @copybref fs::FsCacheClient
 
+#include <string>
+#include <unordered_map>
+
 #include <userver/engine/io/sys/linux/inotify.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
@@ -19,12 +22,20 @@ namespace fs {
 class FsCacheClient final {
  public:
   /// @brief Fills the cache and starts periodic update
+  ///
+  /// On Linux the cache subscribes to inotify events instead of rescanning the
+  /// directory. Only the changed files are re-read, and bursts of events for
+  /// the same file are coalesced into a single read.
+  ///
   /// @param dir directory to cache files from
-  /// @param update_period time (0 - fill the cache only at startup), not used
-  /// in Linux
+  /// @param update_period time (0 - fill the cache only at startup), on Linux
+  /// any non-zero value enables inotify-based updates
   /// @param tp task processor to do filesystem operations
+  /// @param flags settings read files
   FsCacheClient(std::string_view dir, std::chrono::milliseconds update_period,
-                engine::TaskProcessor& tp);
+                engine::TaskProcessor& tp,
+                utils::Flags<SettingsReadFile> flags = {
+                    SettingsReadFile::kSkipHidden});
 
   /// @brief get file from memory
   /// @param path to file
@@ -37,8 +48,13 @@ class FsCacheClient final {
 
  private:
 #ifdef __linux__
+  enum class FileChange { kReload, kDelete };
+  using PendingChanges = std::unordered_map<std::string, FileChange>;
+
   void InotifyWork();
 
+  void ApplyChanges(const PendingChanges& pending);
+
   void HandleDelete(const std::string& path);
 
   static void HandleDeleteDirectory(engine::io::sys::linux::Inotify& inotify,
@@ -53,6 +69,7 @@ class FsCacheClient final {
   const std::string dir_;
   const std::chrono::milliseconds update_period_;
   engine::TaskProcessor& tp_;
+  const utils::Flags<SettingsReadFile> flags_;
 #ifndef __linux__
   utils::PeriodicTask cache_updater_;
 #endif
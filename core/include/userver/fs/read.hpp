@@ -3,6 +3,7 @@
 /// @file userver/fs/read.hpp
 /// @brief functions for asynchronous file read operations
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -15,10 +16,20 @@ USERVER_NAMESPACE_BEGIN
 /// @brief filesystem support
 namespace fs {
 
+namespace blocking {
+class FileDescriptor;
+}  // namespace blocking
+
 /// @brief Struct file with load data
 struct FileInfoWithData {
+  /// File contents, empty if SettingsReadFile::kKeepDescriptor is used
   std::string data;
   std::string extension;
+  /// File size at the time of reading
+  std::size_t size{0};
+  /// Descriptor of the file opened for reading if
+  /// SettingsReadFile::kKeepDescriptor is used, `nullptr` otherwise
+  std::shared_ptr<const blocking::FileDescriptor> file;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -29,6 +40,8 @@ enum class SettingsReadFile {
   kNone = 0,
   /// Skip hidden files,
   kSkipHidden = 1 << 0,
+  /// Keep the files open instead of reading their contents into memory
+  kKeepDescriptor = 1 << 1,
 };
 
 /// @brief Returns relative path from full path
@@ -53,11 +66,24 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file to open
 /// @returns file contents
+/// @note If `async_tp` has `io-backend: io-uring`, the file is read in chunks
+/// with io_uring by the calling task and no thread of `async_tp` is blocked
 /// @throws std::runtime_error if read fails for any reason (e.g. no such file,
 /// read error, etc.),
 std::string ReadFileContents(engine::TaskProcessor& async_tp,
                              const std::string& path);
 
+/// @brief Reads file info and contents (or opens the file if
+/// SettingsReadFile::kKeepDescriptor is set) asynchronously
+/// @param async_tp TaskProcessor for synchronous waiting
+/// @param path file to open
+/// @param flags settings read files
+/// @throws std::runtime_error if read fails for any reason (e.g. no such file,
+/// read error, etc.),
+FileInfoWithData ReadFileInfoWithData(engine::TaskProcessor& async_tp,
+                                      const std::string& path,
+                                      utils::Flags<SettingsReadFile> flags);
+
 /// @brief Checks whether the file exists asynchronosly
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path file path to check
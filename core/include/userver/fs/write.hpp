@@ -33,6 +33,9 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path);
 /// @param path file to rewrite
 /// @param contents new file contents
 /// @throws std::runtime_error if failed to overwrite
+/// @note If `async_tp` has `io-backend: io-uring`, the file is written in
+/// chunks with io_uring by the calling task and no thread of `async_tp` is
+/// blocked
 void RewriteFileContents(engine::TaskProcessor& async_tp,
                          const std::string& path, std::string_view contents);
 
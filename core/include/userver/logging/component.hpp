@@ -51,6 +51,11 @@ namespace components {
 /// flush_level | messages of this and higher levels get flushed to the file immediately | warning
 /// message_queue_size | the size of internal message queue, must be a power of 2 | 65536
 /// overflow_behavior | message handling policy while the queue is full: `discard` drops messages, `block` waits until message gets into the queue | discard
+/// deferred_formatting | if `true`, the messages are formatted on the logger task processor instead of the logging coroutine | false
+/// max_batch_size | if not 0, the records are written to the log file in batches of up to this many bytes, a batch is written at the end of the queue drain | 0
+/// batch_flush_latency | the batch is kept across the queue drains until it gets this old; the batch of an idle logger is written on the periodic flush | 0ms
+/// compression | compression of the log file: `zstd` compresses the records in the logger task, a zstd frame is ended on each log reopen and every 4MiB of logs, requires `USERVER_FEATURE_ZSTD` | none
+/// compression_level | zstd compression level from 1 to 22 | 3
 /// testsuite-capture | if exists, setups additional TCP log sink for testing purposes | {}
 /// fs-task-processor | task processor for disk I/O operations for this logger | fs-task-processor of the loggers component
 ///
@@ -67,6 +72,8 @@ namespace components {
 /// ---- | ----------- | -------------
 /// host | testsuite hostname, e.g. localhost | -
 /// port | testsuite port | -
+/// message_queue_size | the size of the separate message queue of the TCP sink, so that a stuck testsuite does not block the other sinks of the logger | 65536
+/// overflow_behavior | message handling policy while the queue of the TCP sink is full: `discard` drops messages, `block` waits until message gets into the queue and stalls the other sinks | discard
 ///
 /// ## Static configuration example:
 ///
@@ -4,9 +4,12 @@
 /// @brief Implementation of hazard pointer
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <list>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/engine/async.hpp>
@@ -69,6 +72,30 @@ inline compiler::ThreadLocal local_cached_data =
 
 uint64_t GetNextEpoch() noexcept;
 
+// Reader counters of DestructionType::kEpoch. Readers increment the counter
+// of the active parity in the shard of their thread, and decrement the same
+// counter when done (possibly from another thread). A writer flips the active
+// parity only when all the readers of the inactive one are gone, so an old
+// value is destroyed after two such flips.
+struct EpochReaders final {
+  static constexpr std::size_t kShardCount = 8;
+
+  struct alignas(64) Shard final {
+    std::atomic<std::uint64_t> readers[2]{0, 0};
+  };
+
+  std::uint64_t CountReaders(std::size_t parity) const noexcept {
+    std::uint64_t result = 0;
+    for (const auto& shard : shards) result += shard.readers[parity].load();
+    return result;
+  }
+
+  std::atomic<std::size_t> active_parity{0};
+  Shard shards[kShardCount];
+};
+
+std::size_t GetEpochShardIndex() noexcept;
+
 }  // namespace impl
 
 /// Default Rcu traits.
@@ -87,8 +114,17 @@ struct DefaultRcuTraits {
 template <typename T, typename RcuTraits>
 class [[nodiscard]] ReadablePtr final {
  public:
-  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr)
-      : hp_record_(&ptr.MakeHazardPointer()) {
+  explicit ReadablePtr(const Variable<T, RcuTraits>& ptr) {
+    if (ptr.epoch_readers_) {
+      epoch_variable_ = &ptr;
+      epoch_counter_ = &ptr.EnterEpoch();
+      // The counter is incremented before loading the pointer, so the writer
+      // either sees us in the counters or we see its new value
+      t_ptr_ = ptr.GetCurrent();
+      return;
+    }
+
+    hp_record_ = &ptr.MakeHazardPointer();
     // This cycle guarantees that at the end of it both t_ptr_ and
     // hp_record_->ptr will both be set to
     // 1. something meaningful
@@ -102,7 +138,10 @@ class [[nodiscard]] ReadablePtr final {
   }
 
   ReadablePtr(ReadablePtr<T, RcuTraits>&& other) noexcept
-      : t_ptr_(other.t_ptr_), hp_record_(other.hp_record_) {
+      : t_ptr_(other.t_ptr_),
+        hp_record_(other.hp_record_),
+        epoch_variable_(other.epoch_variable_),
+        epoch_counter_(other.epoch_counter_) {
     other.t_ptr_ = nullptr;
   }
 
@@ -130,13 +169,15 @@ class [[nodiscard]] ReadablePtr final {
 
     // Get rid of our current hp_record_
     if (t_ptr_) {
-      hp_record_->Release();
+      Release();
     }
     // After that moment, the content of our hp_record_ can't be used -
     // no more hp_record_->xyz calls, because it is probably already reused in
     // some other ReadablePtr. Also, don't call t_ptr_, it is probably already
     // freed. Just take values from 'other'.
     hp_record_ = other.hp_record_;
+    epoch_variable_ = other.epoch_variable_;
+    epoch_counter_ = other.epoch_counter_;
     t_ptr_ = other.t_ptr_;
 
     // Now, it won't do us any good if there were two glorified things having
@@ -150,7 +191,8 @@ class [[nodiscard]] ReadablePtr final {
   }
 
   ReadablePtr(const ReadablePtr<T, RcuTraits>& other)
-      : ReadablePtr(other.hp_record_->owner) {}
+      : ReadablePtr(other.epoch_variable_ ? *other.epoch_variable_
+                                          : other.hp_record_->owner) {}
 
   ReadablePtr& operator=(const ReadablePtr<T, RcuTraits>& other) {
     if (this != &other) *this = ReadablePtr<T, RcuTraits>{other};
@@ -159,8 +201,7 @@ class [[nodiscard]] ReadablePtr final {
 
   ~ReadablePtr() {
     if (!t_ptr_) return;
-    UASSERT(hp_record_ != nullptr);
-    hp_record_->Release();
+    Release();
   }
 
   const T* Get() const& {
@@ -183,6 +224,15 @@ class [[nodiscard]] ReadablePtr final {
     std::abort();
   }
 
+  void Release() noexcept {
+    if (epoch_counter_) {
+      epoch_counter_->fetch_sub(1);
+      return;
+    }
+    UASSERT(hp_record_ != nullptr);
+    hp_record_->Release();
+  }
+
   // This is a pointer to actual data. If it is null, then we treat it as
   // an indicator that this ReadablePtr is cleared and won't call
   // any logic associated with hp_record_
@@ -191,7 +241,11 @@ class [[nodiscard]] ReadablePtr final {
   // Invariant is this: if t_ptr_ is not nullptr, then hp_record_ is also
   // not nullptr and points to hazard pointer containing same T*.
   // Thus, if t_ptr_ is nullptr, then hp_record_ is undefined.
-  impl::HazardPointerRecord<T, RcuTraits>* hp_record_;
+  impl::HazardPointerRecord<T, RcuTraits>* hp_record_{nullptr};
+  // Used instead of hp_record_ for DestructionType::kEpoch, with the same
+  // invariant.
+  const Variable<T, RcuTraits>* epoch_variable_{nullptr};
+  std::atomic<std::uint64_t>* epoch_counter_{nullptr};
 };
 
 /// Smart pointer for rcu::Variable<T> for changing RCU value. It stores a
@@ -277,8 +331,22 @@ class [[nodiscard]] WritablePtr final {
 };
 
 /// @brief Can be passed to `rcu::Variable` as the first argument to customize
-/// whether old values should be destroyed asynchronously.
-enum class DestructionType { kSync, kAsync };
+/// how old values should be destroyed.
+enum class DestructionType {
+  /// Old values are destroyed by the writer, readers use hazard pointers
+  kSync,
+  /// Old values are destroyed in a separate task, readers use hazard pointers
+  kAsync,
+  /// @brief Epoch-based reclamation: a read is a single atomic increment of a
+  /// per-thread counter instead of a hazard pointer.
+  ///
+  /// Old values are destroyed in batches in a separate task, after all the
+  /// readers that started before the value was replaced are gone. Suits the
+  /// big values that are read by every request and updated seldom. A
+  /// long-living ReadablePtr delays the destruction of all the values that
+  /// are replaced after it was taken, not only of its own one.
+  kEpoch,
+};
 
 /// @ingroup userver_concurrency userver_containers
 ///
@@ -332,6 +400,9 @@ class Variable final {
   Variable(DestructionType destruction_type, Args&&... initial_value_args)
       : destruction_type_(destruction_type),
         epoch_(impl::GetNextEpoch()),
+        epoch_readers_(destruction_type == DestructionType::kEpoch
+                           ? std::make_unique<impl::EpochReaders>()
+                           : nullptr),
         current_(new T(std::forward<Args>(initial_value_args)...)) {}
 
   Variable(const Variable&) = delete;
@@ -350,9 +421,12 @@ class Variable final {
       delete hp;
       hp = next;
     }
+    UASSERT_MSG(!epoch_readers_ || (epoch_readers_->CountReaders(0) == 0 &&
+                                    epoch_readers_->CountReaders(1) == 0),
+                "RCU variable is destroyed while being used");
 
     // Make sure all data is deleted after return from dtr
-    if (destruction_type_ == DestructionType::kAsync) {
+    if (destruction_type_ != DestructionType::kSync) {
       wait_token_storage_.WaitForAllTokens();
     }
   }
@@ -404,6 +478,10 @@ class Variable final {
       return;
     }
 
+    if (epoch_readers_) {
+      ReclaimEpoch();
+      return;
+    }
     ScanRetiredList(CollectHazardPtrs(lock));
   }
 
@@ -469,8 +547,38 @@ class Variable final {
     return hp;
   }
 
+  std::atomic<std::uint64_t>& EnterEpoch() const {
+    auto& shard = epoch_readers_->shards[impl::GetEpochShardIndex()];
+    auto& counter = shard.readers[epoch_readers_->active_parity.load()];
+    counter.fetch_add(1);
+    return counter;
+  }
+
+  // Destroys the values retired before the previous parity flip if their
+  // readers are gone, and flips the parity for the values retired since.
+  void ReclaimEpoch() {
+    if (epoch_retired_.empty() && epoch_draining_.empty()) return;
+
+    const auto inactive_parity = 1 - epoch_readers_->active_parity.load();
+    if (epoch_readers_->CountReaders(inactive_parity) != 0) {
+      LOG_TRACE() << "Not reclaiming, readers of the previous epoch are active";
+      return;
+    }
+
+    DeleteAsync(std::move(epoch_draining_));
+    epoch_draining_ = std::move(epoch_retired_);
+    epoch_retired_.clear();
+    epoch_readers_->active_parity = inactive_parity;
+  }
+
   void Retire(std::unique_ptr<T> old_ptr, std::unique_lock<MutexType>& lock) {
     LOG_TRACE() << "Retiring ptr=" << old_ptr.get();
+    if (epoch_readers_) {
+      epoch_retired_.push_back(std::move(old_ptr));
+      ReclaimEpoch();
+      return;
+    }
+
     auto hazard_ptrs = CollectHazardPtrs(lock);
 
     if (hazard_ptrs.count(old_ptr.get()) > 0) {
@@ -511,12 +619,23 @@ class Variable final {
     return hazard_ptrs;
   }
 
+  void DeleteAsync(std::vector<std::unique_ptr<T>> ptrs) {
+    if (ptrs.empty()) return;
+    engine::CriticalAsyncNoSpan([ptrs = std::move(ptrs),
+                                 token = wait_token_storage_
+                                             .GetToken()]() mutable {
+      // Make sure *ptrs are deleted before token is destroyed
+      ptrs.clear();
+    }).Detach();
+  }
+
   void DeleteAsync(std::unique_ptr<T> ptr) {
     switch (destruction_type_) {
       case DestructionType::kSync:
         ptr.reset();
         break;
       case DestructionType::kAsync:
+      case DestructionType::kEpoch:
         engine::CriticalAsyncNoSpan([ptr = std::move(ptr),
                                      token = wait_token_storage_
                                                  .GetToken()]() mutable {
@@ -529,6 +648,8 @@ class Variable final {
 
   const DestructionType destruction_type_;
   const uint64_t epoch_;
+  // Only for DestructionType::kEpoch
+  const std::unique_ptr<impl::EpochReaders> epoch_readers_;
 
   mutable std::atomic<impl::HazardPointerRecord<T, RcuTraits>*> hp_record_head_{
       {nullptr}};
@@ -537,6 +658,10 @@ class Variable final {
   // may be read without mutex_ locked, but must be changed with held mutex_
   std::atomic<T*> current_;
   std::list<std::unique_ptr<T>> retire_list_head_;
+  // DestructionType::kEpoch values retired since the last parity flip and
+  // before it
+  std::vector<std::unique_ptr<T>> epoch_retired_;
+  std::vector<std::unique_ptr<T>> epoch_draining_;
   utils::impl::WaitTokenStorage wait_token_storage_;
 
   friend class ReadablePtr<T, RcuTraits>;
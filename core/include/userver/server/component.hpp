@@ -66,17 +66,31 @@ namespace components {
 /// tls.cert | path to TLS server certificate | -
 /// tls.private-key | path to TLS server certificate private key | -
 /// tls.private-key-passphrase-name | passphrase name located in secdist's "passphrases" section | -
+/// tls.kernel-offload | offload the TLS record encryption and decryption to the kernel (kTLS) after the handshake; requires OpenSSL 3.0+ built with kTLS and the `tls` Linux kernel module, silently falls back to the userspace encryption for the unsupported ciphers and TLS versions | false
+/// tls.handshake-task-processor | task processor to run the TLS handshakes on, so that a reconnect storm does not stall the request processing | task_processor of the listener
+/// tls.max-concurrent-handshakes | max count of the TLS handshakes in progress, the rest of the new connections wait; 0 for unlimited | 0
+/// tls.session-ticket-keys-name | name of the base64-encoded 80-byte TLS session ticket keys in secdist's "tls_session_ticket_keys" section; the first key encrypts the new tickets, the rest are the previous keys that only decrypt; the keys are rotated on secdist updates. A random key per process is used if not set | -
 /// handler-defaults.max_url_size | max path/URL size or empty to not limit | 8192
 /// handler-defaults.max_request_size | max size of the whole request | 1024 * 1024
 /// handler-defaults.max_headers_size | max request headers size | 65536
 /// handler-defaults.parse_args_from_body | optional field to parse request according to x-www-form-urlencoded rules and make parameters accessible as query parameters | false
+/// handler-defaults.zero_copy_body | keep a big request body in the connection buffer instead of copying it, see server::http::HttpRequest::RequestBodyView() | false
 /// handler-defaults.set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// handler-defaults.deadline_propagation_enabled | when `false`, disables HTTP handler deadline propagation | true
 /// handler-defaults.deadline_expired_status_code | the HTTP status code to return if the request deadline expires | 498
-/// connection.in_buffer_size | size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU | 32 * 1024
+/// connection.in_buffer_size | max size of the buffer for request receive: bigger values use more RAM and less CPU | 32 * 1024
+/// connection.in_buffer_min_size | initial size of the buffer for request receive, it doubles up to in_buffer_size when a read fills it and shrinks back after a series of small reads | 4 * 1024
+/// connection.in_buffer_pool_size | max size of the idle receive buffers that the listener keeps for reuse, the buffers of the idle connections are returned to the pool | 16 * 1024 * 1024
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
+/// connection.max_pipelined_responses_size | stop reading pipelined requests of a connection while the ready responses that wait for the previous ones to be sent are larger than this value | 16 * 1024 * 1024
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
-/// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// connection.http_version | '2' to serve HTTP/2 (ALPN h2 on TLS listeners, h2c with prior knowledge otherwise) along with HTTP/1.1 | '1.1'
+/// connection.http2_session.max_concurrent_streams | max number of concurrent streams (requests) of a connection | 100
+/// connection.http2_session.initial_window_size | initial flow-control window size of a stream in bytes | 65535
+/// connection.http2_session.max_frame_size | max size of a received frame payload in bytes | 16384
+/// shards | how many listening sockets bound with SO_REUSEPORT accept the connections concurrently, one task per socket; do not set if not sure what it is doing | <count of the ev threads of the task processor>
+/// reuseport-cpu-steering | make the kernel pass each new connection to the shard number `CPU % shards`, where CPU is the one that handled the connection packets; Linux only | false
+/// accept-throttling-queue-wait | pause accepting the new connections while the queue wait time of the task processor is bigger than this value, e.g. '20ms'; 0 disables the throttling | 0
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
 
@@ -30,7 +30,11 @@ namespace server::handlers {
 /// max_request_size | max size of the whole request | 1024 * 1024
 /// max_headers_size | max request headers size | 65536
 /// parse_args_from_body | optional field to parse request according to x-www-form-urlencoded rules and make parameters accessible as query parameters | false
+/// zero_copy_body | keep a big request body in the connection buffer instead of copying it, see server::http::HttpRequest::RequestBodyView() | false
+/// request-body-stream | read the request body while it is received, see server::http::HttpRequest::GetBodyStream() | false
+/// response-compression | server::handlers::ResponseCompressionConfig, compress the responses by the Accept-Encoding of the request, see @ref scripts/docs/en/userver/http_server.md | -
 /// auth | server::handlers::auth::HandlerAuthConfig authorization config | -
+/// adaptive-concurrency | server::handlers::AdaptiveConcurrencyConfig, limit of the requests in flight that is decreased when the latency grows over the baseline and is increased otherwise, see @ref scripts/docs/en/userver/http_server.md | -
 /// url_trailing_slash | 'both' to treat URLs with and without a trailing slash as equal, 'strict-match' otherwise | 'both'
 /// max_requests_in_flight | integer to limit max pending requests to this handler | <no limit>
 /// request_body_size_log_limit | trim request to this size before logging | 512
@@ -39,10 +43,12 @@ namespace server::handlers {
 /// decompress_request | allow decompression of the requests | true
 /// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
+/// response-headers | map of the headers to add to each response of the handler, serialized once at startup; the headers set by the handler code take precedence | {}
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// deadline_propagation_enabled | when `false`, disables HTTP handler @ref scripts/docs/en/userver/deadline_propagation.md "deadline propagation" | true
 /// deadline_expired_status_code | the HTTP status code to return if the request @ref scripts/docs/en/userver/deadline_propagation.md "deadline expires" | 498
+/// scheduling-class | engine::SchedulingClass of the request tasks, one of `latency-critical`, `normal`, `background` | normal
 
 // clang-format on
 class HandlerBase : public components::LoggableComponentBase {
@@ -2,9 +2,11 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include <userver/engine/task/scheduling_class.hpp>
 #include <userver/server/handlers/auth/handler_auth_config.hpp>
 #include <userver/server/handlers/fallback_handlers.hpp>
 #include <userver/server/http/http_status.hpp>
@@ -26,6 +28,34 @@ enum class UrlTrailingSlashOption {
   kDefault = kBoth,
 };
 
+/// Compression of the responses, see the `response-compression` static option
+/// of server::handlers::HandlerBase
+struct ResponseCompressionConfig {
+  bool enabled{false};
+  /// Smaller responses are sent as is, the streamed ones are always compressed
+  std::size_t min_size{1024};
+  /// Content codings in the order of preference
+  std::vector<std::string> encodings{"zstd", "br", "gzip"};
+  int gzip_level{6};
+  int brotli_level{4};
+  int zstd_level{3};
+};
+
+/// Adaptive limit of the requests in flight, see the `adaptive-concurrency`
+/// static option of server::handlers::HandlerBase
+struct AdaptiveConcurrencyConfig {
+  bool enabled{false};
+  /// Only compute the limit and report it in the metrics, do not reject
+  /// the requests over the limit
+  bool observe_only{true};
+  std::size_t initial_limit{100};
+  std::size_t min_limit{10};
+  std::size_t max_limit{10000};
+  /// The limit is decreased when the latency exceeds the baseline latency
+  /// this many times
+  double latency_tolerance{2.0};
+};
+
 struct HandlerConfig {
   std::variant<std::string, FallbackHandler> path;
   std::string task_processor;
@@ -40,10 +70,15 @@ struct HandlerConfig {
   bool decompress_request{true};
   bool throttling_enabled{true};
   bool response_body_stream{false};
+  bool request_body_stream{false};
+  ResponseCompressionConfig response_compression{};
+  AdaptiveConcurrencyConfig adaptive_concurrency{};
+  std::vector<std::pair<std::string, std::string>> response_headers;
   std::optional<bool> set_response_server_hostname;
   bool set_tracing_headers{true};
   bool deadline_propagation_enabled{true};
   http::HttpStatus deadline_expired_status_code{498};
+  engine::SchedulingClass scheduling_class{engine::SchedulingClass::kNormal};
 };
 
 HandlerConfig ParseHandlerConfigsWithDefaults(
@@ -39,6 +39,7 @@ class HttpHandlerStatistics;
 class HttpRequestStatistics;
 class HttpHandlerMethodStatistics;
 class HttpHandlerStatisticsScope;
+class AdaptiveConcurrencyLimiter;
 
 // clang-format off
 
@@ -85,6 +86,9 @@ class HttpHandlerBase : public HandlerBase {
 
   // For internal use only.
   HttpRequestStatistics& GetRequestStatistics() const;
+
+  // For internal use only, nullptr if the adaptive concurrency is disabled.
+  AdaptiveConcurrencyLimiter* GetAdaptiveConcurrencyLimiter() const;
   /// @endcond
 
   /// Override it if you need a custom logging level for messages about finish
@@ -195,8 +199,6 @@ class HttpHandlerBase : public HandlerBase {
   void FormatStatistics(utils::statistics::Writer result,
                         const HttpStatistics& stats);
 
-  void SetResponseServerHostname(http::HttpResponse& response) const;
-
   void BuildMiddlewarePipeline(const components::ComponentConfig&,
                                const components::ComponentContext&);
 
@@ -208,8 +210,10 @@ class HttpHandlerBase : public HandlerBase {
 
   std::unique_ptr<HttpHandlerStatistics> handler_statistics_;
   std::unique_ptr<HttpRequestStatistics> request_statistics_;
+  std::unique_ptr<AdaptiveConcurrencyLimiter> adaptive_concurrency_;
 
-  bool set_response_server_hostname_;
+  // The response-headers and the X-YaTaxi-Server-Hostname header
+  std::unique_ptr<const http::impl::HeadersBlock> static_headers_;
   bool is_body_streamed_;
 
   std::unique_ptr<middlewares::HttpMiddlewareBase> first_middleware_;
@@ -0,0 +1,167 @@
+#pragma once
+
+/// @file userver/server/handlers/http_handler_json_typed_base.hpp
+/// @brief @copybrief server::handlers::HttpHandlerJsonTypedBase
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/http/content_type.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/handlers/json_error_builder.hpp>
+#include <userver/server/handlers/legacy_json_error_builder.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace impl {
+
+inline constexpr std::string_view kJsonTypedRequestDataName =
+    "__request_json_typed";
+inline constexpr std::string_view kJsonTypedResponseDataName =
+    "__response_json_typed";
+
+}  // namespace impl
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers userver_base_classes
+///
+/// @brief Convenient base for handlers that accept requests with body in
+/// JSON format and respond with body in JSON format, working with C++ types
+/// instead of formats::json::Value.
+///
+/// The request body is parsed into `InputType` via formats::json::Value::As.
+///
+/// The response is written via `WriteToStream(const ReturnType&,
+/// formats::json::StringBuilder&)` straight into the response body, without
+/// building a formats::json::Value. Types that only provide `Serialize` are
+/// still supported, `WriteToStream` falls back to `Serialize` for them.
+
+// clang-format on
+
+template <typename InputType, typename ReturnType>
+class HttpHandlerJsonTypedBase : public HttpHandlerBase {
+ public:
+  HttpHandlerJsonTypedBase(
+      const components::ComponentConfig& config,
+      const components::ComponentContext& component_context,
+      bool is_monitor = false);
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext& context) const final;
+
+  virtual ReturnType HandleRequestJsonTypedThrow(
+      const http::HttpRequest& request, const InputType& input,
+      request::RequestContext& context) const = 0;
+
+  /// @returns A pointer to input data if it was parsed successfully or
+  /// nullptr otherwise.
+  const InputType* GetInputData(const request::RequestContext& context) const;
+
+  /// @returns a pointer to output data if it was returned successfully by
+  /// `HandleRequestJsonTypedThrow()` or nullptr otherwise.
+  const ReturnType* GetOutputData(const request::RequestContext& context) const;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ protected:
+  void ParseRequestData(const http::HttpRequest& request,
+                        request::RequestContext& context) const override;
+
+ private:
+  FormattedErrorData GetFormattedExternalErrorBody(
+      const CustomHandlerException& exc) const final;
+};
+
+template <typename InputType, typename ReturnType>
+HttpHandlerJsonTypedBase<InputType, ReturnType>::HttpHandlerJsonTypedBase(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context, bool is_monitor)
+    : HttpHandlerBase(config, component_context, is_monitor) {}
+
+template <typename InputType, typename ReturnType>
+std::string HttpHandlerJsonTypedBase<InputType, ReturnType>::HandleRequestThrow(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto& input =
+      context.GetData<const InputType&>(impl::kJsonTypedRequestDataName);
+
+  auto& response = request.GetHttpResponse();
+  response.SetContentType(
+      USERVER_NAMESPACE::http::content_type::kApplicationJson);
+
+  const auto& ret =
+      context.SetData(std::string{impl::kJsonTypedResponseDataName},
+                      HandleRequestJsonTypedThrow(request, input, context));
+
+  const auto scope_time =
+      tracing::ScopeTime::CreateOptionalScopeTime("serialize_json");
+  formats::json::StringBuilder sb;
+  WriteToStream(ret, sb);
+  return sb.GetString();
+}
+
+template <typename InputType, typename ReturnType>
+const InputType* HttpHandlerJsonTypedBase<InputType, ReturnType>::GetInputData(
+    const request::RequestContext& context) const {
+  return context.GetDataOptional<const InputType>(
+      impl::kJsonTypedRequestDataName);
+}
+
+template <typename InputType, typename ReturnType>
+const ReturnType*
+HttpHandlerJsonTypedBase<InputType, ReturnType>::GetOutputData(
+    const request::RequestContext& context) const {
+  return context.GetDataOptional<const ReturnType>(
+      impl::kJsonTypedResponseDataName);
+}
+
+template <typename InputType, typename ReturnType>
+void HttpHandlerJsonTypedBase<InputType, ReturnType>::ParseRequestData(
+    const http::HttpRequest& request, request::RequestContext& context) const {
+  const auto& body = request.RequestBody();
+
+  try {
+    auto json =
+        body.empty() ? formats::json::Value{} : formats::json::FromString(body);
+    context.SetData(std::string{impl::kJsonTypedRequestDataName},
+                    json.As<InputType>());
+  } catch (const formats::json::Exception& e) {
+    throw RequestParseError(
+        InternalMessage{"Invalid JSON body"},
+        ExternalBody{std::string("Invalid JSON body: ") + e.what()});
+  }
+}
+
+template <typename InputType, typename ReturnType>
+FormattedErrorData
+HttpHandlerJsonTypedBase<InputType, ReturnType>::GetFormattedExternalErrorBody(
+    const CustomHandlerException& exc) const {
+  if (exc.GetServiceCode().empty()) {
+    // Legacy format has no "service codes", only HTTP codes.
+    return {LegacyJsonErrorBuilder(exc).GetExternalBody(),
+            LegacyJsonErrorBuilder::GetContentType()};
+  }
+  return {JsonErrorBuilder(exc).GetExternalBody(),
+          JsonErrorBuilder::GetContentType()};
+}
+
+template <typename InputType, typename ReturnType>
+yaml_config::Schema
+HttpHandlerJsonTypedBase<InputType, ReturnType>::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("HTTP handler JSON typed base config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
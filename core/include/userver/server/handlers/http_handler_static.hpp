@@ -19,6 +19,10 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// If the components::FsCache keeps the files open (`keep-descriptors`
+/// option), the files are sent with sendfile(2) instead of being copied from
+/// memory.
+///
 /// ## Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
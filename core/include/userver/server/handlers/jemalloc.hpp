@@ -3,6 +3,7 @@
 /// @file userver/server/handlers/jemalloc.hpp
 /// @brief @copybrief server::handlers::Jemalloc
 
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,8 +16,13 @@ namespace server::handlers {
 ///
 /// @brief Handler that controls the jemalloc allocator.
 ///
-/// The component has no service configuration except the
-/// @ref userver_http_handlers "common handler options".
+/// ## Static options:
+/// Inherits all the options from server::handlers::HttpHandlerBase and adds the
+/// following ones:
+///
+/// Name              | Description                                   | Default value
+/// ----------------- | --------------------------------------------- | -------------
+/// fs-task-processor | task processor to write and read the profiles | fs-task-processor
 ///
 /// ## Static configuration example:
 ///
@@ -28,6 +34,21 @@ namespace server::handlers {
 /// * `enable` - to start memory profiling
 /// * `disable` - to stop memory profiling
 /// * `dump` - to get jemalloc profiling dump
+/// * `profile` - to download the sampled live allocations of the running
+///   profiler in heap_v2 format, see below
+///
+/// ## Heap profiling
+/// With the service started with `MALLOC_CONF=prof:true,prof_active:false`
+/// the profiler is activated by the `enable` command, after that the
+/// `profile` command returns the stacks of the sampled live allocations
+/// without writing anything to the working directory of the service:
+/// @code
+/// curl -X POST localhost:8085/service/jemalloc/prof/profile -o heap.prof
+/// jeprof --svg ./service heap.prof > heap.svg  # or: pprof -http=: ./service heap.prof
+/// @endcode
+/// The worker threads of the task processors are named after their task
+/// processors in the profile, so the live bytes of each thread in the header
+/// of the profile can be attributed to a task processor.
 
 // clang-format on
 
@@ -44,6 +65,9 @@ class Jemalloc final : public HttpHandlerBase {
                                  request::RequestContext&) const override;
 
   static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  engine::TaskProcessor& fs_task_processor_;
 };
 
 }  // namespace server::handlers
@@ -0,0 +1,74 @@
+#pragma once
+
+/// @file userver/server/handlers/task_profiler.hpp
+/// @brief @copybrief server::handlers::TaskProfiler
+
+#include <unordered_map>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// clang-format off
+
+/// @ingroup userver_components userver_http_handlers
+///
+/// @brief Handler that returns the samples of the task profiler.
+///
+/// The profiler samples every N-th task of a task processor if the
+/// `sample-every-task` option is set in the
+/// @ref USERVER_TASK_PROCESSOR_PROFILER_DEBUG dynamic config. For the sampled
+/// tasks it accumulates the time on CPU, the time spent runnable in the task
+/// queue and the time blocked on each kind of the wait primitives (mutex,
+/// future, semaphore, io, sleep...), grouped by the name of the current
+/// tracing::Span.
+///
+/// The component has no service configuration except the
+/// @ref userver_http_handlers "common handler options".
+///
+/// The component is not a part of components::CommonServerComponentList(),
+/// append it to the component list to serve the samples.
+///
+/// ## Static configuration example:
+///
+/// @snippet components/common_server_component_list_test.cpp  Sample handler task profiler component config
+///
+/// ## Scheme
+/// GET returns the samples in the "folded stacks" format, that is accepted by
+/// flamegraph.pl, speedscope and other flame graph tools. Each line is
+/// `<task processor>;<span>;<on_cpu|runnable|blocked>[;<wait kind>] <us>`,
+/// where `<us>` is the total time in microseconds. Provide an optional query
+/// parameter `task_processor` to get the samples of a single task processor.
+///
+/// DELETE resets the accumulated samples.
+
+// clang-format on
+class TaskProfiler final : public HttpHandlerBase {
+ public:
+  TaskProfiler(const components::ComponentConfig& config,
+               const components::ComponentContext& component_context);
+
+  /// @ingroup userver_component_names
+  /// @brief The default name of server::handlers::TaskProfiler
+  static constexpr std::string_view kName = "handler-task-profiler";
+
+  std::string HandleRequestThrow(const http::HttpRequest& request,
+                                 request::RequestContext&) const override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  const std::unordered_map<std::string, engine::TaskProcessor*>
+      task_processors_;
+};
+
+}  // namespace server::handlers
+
+template <>
+inline constexpr bool
+    components::kHasValidate<server::handlers::TaskProfiler> = true;
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,60 @@
+#pragma once
+
+/// @file userver/server/http/form_data_stream_reader.hpp
+/// @brief @copybrief server::http::FormDataStreamReader
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpRequest;
+
+/// @brief Reads the parts of a multipart/form-data request body while the
+/// connection receives it, without keeping the whole body in memory.
+///
+/// Requires `request-body-stream: true` in the handler config, see
+/// server::http::HttpRequest::GetBodyStream(). Unlike the
+/// server::http::HttpRequest::GetFormDataArg() the line breaks must be CRLF.
+///
+/// All the methods throw server::handlers::RequestParseError if the body is
+/// malformed, is not received completely or the deadline expires.
+class FormDataStreamReader final {
+ public:
+  /// @brief Headers of a part of the body
+  struct Part {
+    std::string name;
+    std::optional<std::string> filename;
+    std::optional<std::string> content_type;
+  };
+
+  /// @throws server::handlers::RequestParseError if the request is not
+  /// multipart/form-data or has no boundary
+  explicit FormDataStreamReader(const HttpRequest& request);
+
+  FormDataStreamReader(FormDataStreamReader&&) noexcept;
+  FormDataStreamReader& operator=(FormDataStreamReader&&) noexcept;
+  ~FormDataStreamReader();
+
+  /// Skips the rest of the current part and reads the headers of the next one
+  /// @returns std::nullopt if there are no more parts
+  std::optional<Part> NextPart(engine::Deadline deadline);
+
+  /// Read another part of the value of the current part into `output`, any
+  /// previous data in `output` is dropped.
+  /// @returns `false` if the value of the current part is over
+  bool ReadChunk(std::string& output, engine::Deadline deadline);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
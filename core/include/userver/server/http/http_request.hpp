@@ -13,6 +13,7 @@
 #include <userver/logging/log_helper_fwd.hpp>
 #include <userver/server/http/form_data_arg.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/utils/impl/projecting_view.hpp>
 #include <userver/utils/str_icase.hpp>
@@ -194,6 +195,19 @@ class HttpRequest final {
   /// @return HTTP body.
   const std::string& RequestBody() const;
 
+  /// @return HTTP body without copying it out of the connection buffer if the
+  /// handler has `zero_copy_body` enabled. The view is valid for the lifetime
+  /// of the request or till the SetRequestBody() call.
+  std::string_view RequestBodyView() const;
+
+  /// @return HTTP body of a request to a handler with
+  /// `request-body-stream: true`, RequestBody() is empty for such requests.
+  /// If the whole request was received in a single read, the stream already
+  /// holds the whole body.
+  /// @throws std::logic_error if `request-body-stream` is not enabled for the
+  /// handler
+  RequestBodyStream& GetBodyStream() const;
+
   /// @return HTTP headers.
   const HeadersMap& RequestHeaders() const;
 
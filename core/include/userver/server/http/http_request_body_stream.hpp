@@ -0,0 +1,55 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Body of a request to a handler with `request-body-stream: true`,
+/// that is read while the connection receives it.
+///
+/// The connection stops reading the socket while more than 1 MiB of the body
+/// is not read by the handler.
+/// The `max_request_size` handler option does not apply to the streamed body.
+///
+/// @see @ref server::http::FormDataStreamReader
+class RequestBodyStream final {
+ public:
+  using Queue = concurrent::StringStreamQueue;
+
+  /// @cond
+  // For internal use only
+  RequestBodyStream(Queue::Consumer&& consumer,
+                    std::shared_ptr<const std::atomic<bool>> is_complete);
+  /// @endcond
+
+  RequestBodyStream(RequestBodyStream&&) noexcept = default;
+
+  /// Read another part of the body into `output`, any previous data in
+  /// `output` is dropped.
+  /// @returns `false` if the body is over or the deadline expired
+  /// @note The chunk size is not related to the HTTP chunks
+  [[nodiscard]] bool ReadChunk(std::string& output, engine::Deadline deadline);
+
+  /// @returns `true` if the whole body was received by the server, `false` if
+  /// it is still being received or the client has closed the connection in the
+  /// middle of the body
+  bool IsComplete() const noexcept;
+
+ private:
+  Queue::Consumer consumer_;
+  std::shared_ptr<const std::atomic<bool>> is_complete_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,9 @@
 /// @file userver/server/http/http_response.hpp
 /// @brief @copybrief server::http::HttpResponse
 
+#include <array>
 #include <chrono>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -14,12 +16,21 @@
 #include <userver/server/http/http_response_cookie.hpp>
 #include <userver/server/request/response_base.hpp>
 #include <userver/utils/impl/projecting_view.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/str_icase.hpp>
 
 #include "http_status.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
+namespace fs {
+struct FileInfoWithData;
+}  // namespace fs
+
+namespace compression {
+class Compressor;
+}  // namespace compression
+
 namespace server::http {
 
 namespace impl {
@@ -27,9 +38,12 @@ namespace impl {
 void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header,
                   std::string_view key, std::string_view val);
 
+class HeadersBlock;
+
 }  // namespace impl
 
 class HttpRequestImpl;
+class Http2Session;
 
 /// @brief HTTP Response data
 class HttpResponse final : public request::ResponseBase {
@@ -66,6 +80,13 @@ class HttpResponse final : public request::ResponseBase {
       const USERVER_NAMESPACE::http::headers::PredefinedHeader& header,
       std::string value);
 
+  /// @cond
+  // For internal use only. Adds the pre-serialized headers of a handler or of
+  // a server, `headers` must outlive the response. The headers set by
+  // SetHeader() take precedence, ClearHeaders() does not remove these ones.
+  void AddStaticHeaders(const impl::HeadersBlock& headers);
+  /// @endcond
+
   /// @brief Add or rewrite the Content-Type header.
   void SetContentType(const USERVER_NAMESPACE::http::ContentType& type);
 
@@ -95,7 +116,8 @@ class HttpResponse final : public request::ResponseBase {
   HeadersMapKeys GetHeaderNames() const;
 
   /// @return Value of the header with case insensitive name header_name, or an
-  /// empty string if no such header.
+  /// empty string if no such header. The static headers of the handler are
+  /// also looked up, though they are not listed by GetHeaderNames().
   const std::string& GetHeader(std::string_view header_name) const;
   /// @overload
   const std::string& GetHeader(
@@ -130,6 +152,13 @@ class HttpResponse final : public request::ResponseBase {
   bool WaitForHeadersEnd() override;
   void SetHeadersEnd() override;
 
+  /// @brief Sends the contents of the file as the response body instead of
+  /// the data, see the `keep-descriptors` option of components::FsCache.
+  ///
+  /// Plain socket connections get the file with sendfile(2), without copying
+  /// it to the userspace; TLS connections get it read in chunks.
+  void SetFileBody(std::shared_ptr<const fs::FileInfoWithData> file);
+
   using Queue = concurrent::StringStreamQueue;
 
   void SetStreamBody();
@@ -137,7 +166,17 @@ class HttpResponse final : public request::ResponseBase {
   // Can be called only once
   Queue::Producer GetBodyProducer();
 
+  /// @cond
+  // For internal use only. The chunks of the streamed body are compressed
+  // with the `compressor` before sending, see ResponseBodyStream.
+  void SetBodyStreamCompressor(
+      std::unique_ptr<compression::Compressor> compressor);
+  /// @endcond
+
  private:
+  friend class Http2Session;
+  friend class ResponseBodyStream;
+
   // Returns total size of the response
   std::size_t SetBodyStreamed(
       engine::io::RwBase& socket,
@@ -148,15 +187,27 @@ class HttpResponse final : public request::ResponseBase {
       engine::io::RwBase& socket,
       USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+  utils::span<const impl::HeadersBlock* const> GetStaticHeaders()
+      const noexcept;
+
+  const std::string* FindStaticHeader(std::string_view name) const noexcept;
+
+  bool HasStaticContentType() const noexcept;
+
   const HttpRequestImpl& request_;
   HttpStatus status_ = HttpStatus::kOk;
   HeadersMap headers_;
+  // The server and the handler blocks
+  std::array<const impl::HeadersBlock*, 2> static_headers_{};
+  std::size_t static_headers_count_{0};
   CookiesMap cookies_;
 
   engine::SingleConsumerEvent headers_end_{
       engine::SingleConsumerEvent::NoAutoReset()};
   std::optional<Queue::Consumer> body_stream_;
   std::optional<Queue::Producer> body_stream_producer_;
+  std::unique_ptr<compression::Compressor> body_stream_compressor_;
+  std::shared_ptr<const fs::FileInfoWithData> file_body_;
 };
 
 void SetThrottleReason(http::HttpResponse& http_response,
@@ -38,6 +38,9 @@ class ResponseBodyStream final {
       server::http::HttpResponse::Queue::Producer&& queue_producer,
       server::http::HttpResponse& http_response);
 
+  // Pushes the end of the compressed body if the response is compressed
+  void PushBodyEnd(engine::Deadline deadline);
+
   bool headers_ended_{false};
   HttpResponse::Queue::Producer queue_producer_;
   server::http::HttpResponse& http_response_;
@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file userver/server/http/json_body_stream_writer.hpp
+/// @brief @copybrief server::http::JsonBodyStreamWriter
+
+#include <cstddef>
+#include <string>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/server/http/http_response_body_stream_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+/// @brief Writes a JSON response body to ResponseBodyStream in parts
+///
+/// The JSON is written with formats::json::StringBuilder as usual, the written
+/// data is sent as soon as it exceeds the flush threshold. This allows
+/// returning e.g. an array with millions of items with constant memory.
+///
+/// SetEndOfHeaders() must be called on the stream before writing.
+/// Use formats::json::StringBuilder::ObjectGuard and
+/// formats::json::StringBuilder::ArrayGuard on GetBuilder() for nesting and
+/// call Flush() when all the guards are destroyed.
+///
+/// @warning The status code and the beginning of the body may be already sent
+/// when a serialization error happens, the client gets a truncated JSON then.
+///
+/// ## Example usage:
+///
+/// @code
+/// void HandleStreamRequest(const server::http::HttpRequest&,
+///                          server::request::RequestContext&,
+///                          server::http::ResponseBodyStream& stream) const {
+///   stream.SetHeader(http::headers::kContentType, "application/json");
+///   stream.SetEndOfHeaders();
+///
+///   server::http::JsonBodyStreamWriter writer{stream, deadline};
+///   {
+///     formats::json::StringBuilder::ArrayGuard guard{writer.GetBuilder()};
+///     for (const auto& row : storage.Export()) writer.Write(row);
+///   }
+///   writer.Flush();
+/// }
+/// @endcode
+class JsonBodyStreamWriter final {
+ public:
+  static constexpr std::size_t kDefaultFlushThreshold = 64 * 1024;
+
+  JsonBodyStreamWriter(ResponseBodyStream& stream, engine::Deadline deadline,
+                       std::size_t flush_threshold = kDefaultFlushThreshold);
+
+  JsonBodyStreamWriter(const JsonBodyStreamWriter&) = delete;
+  JsonBodyStreamWriter& operator=(const JsonBodyStreamWriter&) = delete;
+
+  /// The builder to write the JSON into, the written data is sent by
+  /// FlushIfNeeded() and Flush()
+  formats::json::StringBuilder& GetBuilder() { return builder_; }
+
+  /// Writes the value via WriteToStream and sends the written data if it
+  /// exceeds the threshold
+  template <typename T>
+  void Write(const T& value) {
+    WriteToStream(value, builder_);
+    FlushIfNeeded();
+  }
+
+  /// Sends the written data if it exceeds the threshold
+  void FlushIfNeeded();
+
+  /// Sends all the written data, call when all the guards are destroyed
+  void Flush();
+
+ private:
+  ResponseBodyStream& stream_;
+  const engine::Deadline deadline_;
+  const std::size_t flush_threshold_;
+  formats::json::StringBuilder builder_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -22,6 +22,10 @@ class HttpHandlerBase;
 
 namespace middlewares {
 
+namespace impl {
+class PipelineBuilder;
+}
+
 class HttpMiddlewareBase {
  public:
   HttpMiddlewareBase();
@@ -33,8 +37,13 @@ class HttpMiddlewareBase {
 
   void Next(http::HttpRequest& request, request::RequestContext& context) const;
 
+  /// Override it to return true if, with the current handler config, the
+  /// middleware does nothing but call Next(). Such middlewares are left out
+  /// of the pipeline of the handler, saving a virtual call per request.
+  virtual bool IsNoop() const noexcept;
+
  private:
-  friend class handlers::HttpHandlerBase;
+  friend class impl::PipelineBuilder;
 
   std::unique_ptr<HttpMiddlewareBase> next_{nullptr};
 };
@@ -8,6 +8,7 @@
 // TODO: use fwd declarations
 #include <userver/logging/fwd.hpp>
 #include <userver/server/request/response_base.hpp>
+#include <userver/utils/arena.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -53,6 +54,13 @@ class RequestBase {
 
   virtual void AccountResponseTime() = 0;
 
+  /// @brief Memory arena that is freed with the request, for the small
+  /// objects that live as long as the request does.
+  ///
+  /// Not thread safe, must be used only by the task that owns the request at
+  /// the moment: the parser, then the handler.
+  utils::Arena& GetArena() const { return arena_; }
+
  protected:
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point start_time_;
@@ -66,6 +74,10 @@ class RequestBase {
   std::chrono::steady_clock::time_point start_send_response_time_;
   // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
   std::chrono::steady_clock::time_point finish_send_response_time_;
+
+ private:
+  // Is destroyed after the members of the derived classes that allocate in it
+  mutable utils::Arena arena_;
 };
 
 }  // namespace server::request
@@ -14,6 +14,7 @@ struct HttpRequestConfig {
   std::size_t max_request_size = 1024 * 1024;
   std::size_t max_headers_size = 65536;
   bool parse_args_from_body = false;
+  bool zero_copy_body = false;
   bool testing_mode = false;
   bool decompress_request = false;
   bool set_tracing_headers = true;
@@ -18,6 +18,13 @@ namespace server::request {
 
 class ResponseDataAccounter final {
  public:
+  ResponseDataAccounter() = default;
+
+  /// The data is also accounted in the `parent`, e.g. the data of a
+  /// connection is accounted in the data of the server
+  explicit ResponseDataAccounter(ResponseDataAccounter& parent)
+      : parent_(&parent) {}
+
   void StartRequest(size_t size,
                     std::chrono::steady_clock::time_point create_time);
 
@@ -30,6 +37,9 @@ class ResponseDataAccounter final {
 
   void SetMaxLevel(size_t size) { max_ = size; }
 
+  /// Returns true if the limit of this accounter or of its parents is reached
+  bool IsLimitReached() const;
+
   std::chrono::milliseconds GetAvgRequestTime() const;
 
  private:
@@ -37,6 +47,7 @@ class ResponseDataAccounter final {
   std::atomic<size_t> max_{std::numeric_limits<size_t>::max()};
   std::atomic<size_t> count_{0};
   std::atomic<size_t> time_sum_{0};
+  ResponseDataAccounter* const parent_{nullptr};
 };
 
 /// @brief Base class for all the server responses.
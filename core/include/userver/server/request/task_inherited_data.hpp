@@ -4,6 +4,9 @@
 /// @brief @copybrief server::request::TaskInheritedData
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include <userver/engine/deadline.hpp>
@@ -28,6 +31,27 @@ class DeadlineSignal final {
   std::atomic<bool> value_{false};
 };
 
+/// @brief Counts downstream calls affected by server::request::DeadlineBudget.
+class DeadlineBudgetStats final {
+ public:
+  DeadlineBudgetStats() noexcept;
+  DeadlineBudgetStats(const DeadlineBudgetStats&) noexcept;
+  DeadlineBudgetStats& operator=(const DeadlineBudgetStats&) noexcept;
+
+  void AccountLimitedCall() noexcept;
+  void AccountSkippedCall() noexcept;
+
+  /// Calls started with a share of the remaining deadline
+  std::uint64_t GetLimitedCalls() const noexcept;
+
+  /// Calls that were not even attempted, as their share was too small
+  std::uint64_t GetSkippedCalls() const noexcept;
+
+ private:
+  std::atomic<std::uint64_t> limited_calls_{0};
+  std::atomic<std::uint64_t> skipped_calls_{0};
+};
+
 /// @brief Per-request data that should be available inside handlers
 struct TaskInheritedData final {
   /// The static path of the handler
@@ -44,6 +68,9 @@ struct TaskInheritedData final {
 
   /// Signals when an operation has detected deadline expiration
   mutable DeadlineSignal deadline_signal{};
+
+  /// Downstream calls limited or skipped by DeadlineBudget
+  mutable DeadlineBudgetStats deadline_budget_stats{};
 };
 
 /// @see TaskInheritedData for details on the contents.
@@ -81,6 +108,67 @@ class [[nodiscard]] DeadlinePropagationBlocker final {
   TaskInheritedData old_value_;
 };
 
+/// @brief Splits the remaining deadline between the planned downstream calls
+///
+/// Without it every downstream call gets the whole remaining deadline of the
+/// request, so the first slow call leaves nothing for the rest, and calls
+/// made late in the request run only to be thrown away. Within the scope of
+/// DeadlineBudget each StartCall() sets the task-inherited deadline to an
+/// equal share of the time left for the calls that are not started yet. Time
+/// left unused by a fast call goes to the following calls.
+///
+/// The deadline is picked up by all clients that support deadline
+/// propagation (HTTP, gRPC, Redis, Mongo), child tasks started after
+/// StartCall() inherit it as well. For other clients use GetCallDeadline().
+///
+/// Does nothing if the request has no deadline.
+///
+/// Limited and skipped calls are reported in the
+/// `deadline-budget-limited-calls` and `deadline-budget-skipped-calls`
+/// metrics of the HTTP handler if the budget is used from the handler task.
+///
+/// @code
+/// server::request::DeadlineBudget budget{2};
+/// if (budget.StartCall()) profile = FetchProfile();
+/// if (budget.StartCall()) orders = FetchOrders();
+/// @endcode
+class [[nodiscard]] DeadlineBudget final {
+ public:
+  /// Calls with a smaller share are not worth trying by default: timeouts are
+  /// propagated with millisecond precision.
+  static constexpr std::chrono::milliseconds kDefaultMinCallBudget{1};
+
+  /// @param planned_calls the number of downstream calls to split the deadline
+  /// between, StartCall() calls beyond it get all the remaining time
+  /// @param min_call_budget StartCall() returns false if the share of the
+  /// call is less than that
+  explicit DeadlineBudget(
+      std::size_t planned_calls,
+      std::chrono::milliseconds min_call_budget = kDefaultMinCallBudget);
+
+  DeadlineBudget(DeadlineBudget&&) = delete;
+  DeadlineBudget& operator=(DeadlineBudget&&) = delete;
+  ~DeadlineBudget();
+
+  /// @brief Sets the task-inherited deadline for the next downstream call.
+  /// @returns false if the remaining time is too short for the call, in that
+  /// case the call should not be made at all.
+  [[nodiscard]] bool StartCall();
+
+  /// @returns the deadline set by the last StartCall(), or the request
+  /// deadline if it returned false or was not called yet
+  engine::Deadline GetCallDeadline() const noexcept;
+
+ private:
+  void SetDeadline(const TaskInheritedData& current, engine::Deadline deadline);
+
+  TaskInheritedData old_value_;
+  std::size_t calls_left_;
+  const std::chrono::milliseconds min_call_budget_;
+  engine::Deadline call_deadline_;
+  bool is_patched_{false};
+};
+
 }  // namespace server::request
 
 USERVER_NAMESPACE_END
@@ -45,11 +45,28 @@ struct Message {
 
 class WebSocketConnectionImpl;
 
+/// @brief The permessage-deflate extension settings, RFC 7692
+struct DeflateConfig final {
+  bool enabled = false;
+  /// Reset the compression context after each sent message, saves memory of
+  /// the idle connections at the cost of the compression ratio
+  bool server_no_context_takeover = false;
+  /// Ask the client to reset its compression context after each message
+  bool client_no_context_takeover = false;
+  int compression_level = 6;
+  /// Smaller messages are sent uncompressed
+  unsigned min_message_size = 64;
+};
+
 struct Config final {
   unsigned max_remote_payload = 65536;
   unsigned fragment_size = 65536;  // 0 - do not fragment
+  DeflateConfig permessage_deflate{};
 };
 
+DeflateConfig Parse(const yaml_config::YamlConfig&,
+                    formats::parse::To<DeflateConfig>);
+
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
 
 struct Statistics final {
@@ -91,6 +108,13 @@ class WebSocketConnection {
   virtual void Send(const Message& message) = 0;
   virtual void SendText(std::string_view message) = 0;
 
+  /// @brief Send the messages in order, coalescing their frames into as few
+  /// socket writes as possible. Prefer it to a series of Send() calls for
+  /// many small messages.
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Has the same thread-safety guarantees as Send().
+  virtual void SendBatch(utils::span<const Message> messages) = 0;
+
   template <typename ContiguousContainer>
   void SendBinary(const ContiguousContainer& message) {
     static_assert(sizeof(typename ContiguousContainer::value_type) == 1,
@@ -28,6 +28,11 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate.enabled | accept the permessage-deflate offers of the clients (RFC 7692) | false
+/// permessage-deflate.server-no-context-takeover | reset the compression context after each sent message | false
+/// permessage-deflate.client-no-context-takeover | ask the clients to reset the compression context after each message | false
+/// permessage-deflate.compression-level | zlib compression level of the sent messages | 6
+/// permessage-deflate.min-message-size | smaller messages are sent uncompressed | 64
 ///
 /// ## Example usage:
 ///
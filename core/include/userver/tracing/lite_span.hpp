@@ -0,0 +1,57 @@
+#pragma once
+
+/// @file userver/tracing/lite_span.hpp
+/// @brief @copybrief tracing::LiteSpan
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+#include <userver/tracing/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace impl {
+class TimeStorage;
+}  // namespace impl
+
+/// @brief Lightweight replacement of tracing::Span for the internal scopes,
+/// e.g. for the iterations of tight loops.
+///
+/// Records the duration of the scope into the tracing::ScopeTime of
+/// tracing::Span::CurrentSpan() under the `name`, it is logged with the
+/// current span as `<name>_time`. Does not generate ids, keep tags
+/// or log anything on its own unless promoted to a tracing::Span by Promote().
+///
+/// Does nothing if there is no current span.
+///
+/// @warning The `name` is not copied and must outlive the LiteSpan.
+class LiteSpan final {
+ public:
+  explicit LiteSpan(std::string_view name) noexcept;
+
+  LiteSpan(LiteSpan&&) = delete;
+  LiteSpan& operator=(LiteSpan&&) = delete;
+  ~LiteSpan();
+
+  /// @brief Creates a tracing::Span named after the scope, that is a child of
+  /// the current span and is logged as usual. The span starts at the first
+  /// call of Promote(), the duration of the whole scope is still recorded into
+  /// the parent span.
+  tracing::Span& Promote();
+
+  /// Returns time elapsed since the start of the scope
+  ScopeTime::Duration DurationSinceStart() const;
+
+ private:
+  impl::TimeStorage* time_storage_;
+  const std::string_view name_;
+  const std::chrono::steady_clock::time_point start_;
+  std::optional<tracing::Span> span_;
+};
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -175,6 +175,9 @@ class Span final {
 
   /// Identifies a specific span. It does not propagate
   const std::string& GetSpanId() const;
+
+  /// The name of the span, e.g. the name of the handler
+  const std::string& GetName() const;
   const std::string& GetParentId() const;
 
   /// @returns true if this span would be logged with the current local and
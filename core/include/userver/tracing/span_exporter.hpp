@@ -0,0 +1,57 @@
+#pragma once
+
+/// @file userver/tracing/span_exporter.hpp
+/// @brief @copybrief tracing::SpanExporter
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/logging/level.hpp>
+#include <userver/logging/log_extra.hpp>
+#include <userver/tracing/tracer_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+/// @brief Data of a finished tracing::Span
+struct FinishedSpan final {
+  std::string name;
+  std::string trace_id;
+  std::string span_id;
+  std::string parent_id;
+  ReferenceType reference_type{ReferenceType::kChild};
+  logging::Level level{logging::Level::kInfo};
+
+  std::chrono::system_clock::time_point start_time;
+  std::chrono::system_clock::time_point end_time;
+
+  /// Inheritable and non-inheritable tags of the span, followed by the totals
+  /// of its tracing::ScopeTime in milliseconds with the `_time` key suffix
+  std::vector<logging::LogExtra::Pair> tags;
+};
+
+/// @brief Base class for the exporters that send the finished spans to
+/// a tracing backend directly, without formatting them into the logs.
+///
+/// The exporter receives the spans that would be logged, the span log level
+/// and @ref USERVER_NO_LOG_SPANS apply.
+class SpanExporter {
+ public:
+  virtual ~SpanExporter();
+
+  /// Called from the destructor of each finished span, must not block
+  virtual void Export(FinishedSpan&& span) noexcept = 0;
+};
+
+/// @brief Sets the exporter for all the finished spans, `nullptr` disables
+/// the export. If `log_spans` is `false`, the exported spans are not written
+/// to the logs.
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter,
+                     bool log_spans = true);
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
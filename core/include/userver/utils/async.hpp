@@ -41,7 +41,7 @@ struct SpanWrapCall {
 
   struct Impl;
 
-  static constexpr std::size_t kImplSize = 4264;
+  static constexpr std::size_t kImplSize = 4312;
   static constexpr std::size_t kImplAlign = 8;
   utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
 };
@@ -53,6 +53,37 @@ inline auto SpanLazyPrvalue(std::string&& name) {
   });
 }
 
+// A wrapper that inherits task-local variables of the current task without
+// creating a Span, and applies a function to the rest of arguments.
+struct InheritVariablesWrapCall {
+  InheritVariablesWrapCall();
+
+  InheritVariablesWrapCall(const InheritVariablesWrapCall&) = delete;
+  InheritVariablesWrapCall(InheritVariablesWrapCall&&) = delete;
+  InheritVariablesWrapCall& operator=(const InheritVariablesWrapCall&) = delete;
+  InheritVariablesWrapCall& operator=(InheritVariablesWrapCall&&) = delete;
+  ~InheritVariablesWrapCall();
+
+  template <typename Function, typename... Args>
+  auto operator()(Function&& f, Args&&... args) {
+    DoBeforeInvoke();
+    return std::invoke(std::forward<Function>(f), std::forward<Args>(args)...);
+  }
+
+ private:
+  void DoBeforeInvoke();
+
+  struct Impl;
+
+  static constexpr std::size_t kImplSize = 40;
+  static constexpr std::size_t kImplAlign = 8;
+  utils::FastPimpl<Impl, kImplSize, kImplAlign> pimpl_;
+};
+
+inline auto InheritVariablesLazyPrvalue() {
+  return utils::LazyPrvalue([] { return InheritVariablesWrapCall(); });
+}
+
 }  // namespace impl
 
 /// @ingroup userver_concurrency
@@ -109,6 +140,9 @@ inline auto SpanLazyPrvalue(std::string&& name) {
 ///      nanoseconds of performance where no logging is expected.
 ///      But beware! Using tracing::Span::CurrentSpan() will trigger asserts
 ///      and lead to UB in production.
+/// * utils::AsyncNoSpanInheritVariables creates a span-less task that still
+///   inherits task-inherited variables, see below. Use it for tiny subtasks
+///   of a request, where creating a tracing::Span costs more than the work.
 ///
 /// By the propagation of engine::TaskInheritedVariable instances:
 ///
@@ -116,6 +150,8 @@ inline auto SpanLazyPrvalue(std::string&& name) {
 ///   inherit all task-inherited variables from the parent task.
 /// * Functions from `engine::*AsyncNoSpan*` family do not inherit any
 ///   task-inherited variables.
+/// * utils::AsyncNoSpanInheritVariables inherits all task-inherited variables
+///   from the parent task, the variables are shared, not copied.
 ///
 /// By deadline: some `utils::*Async*` functions accept an `engine::Deadline`
 /// parameter. If the deadline expires, the task is cancelled. See `*Async*`
@@ -475,6 +511,49 @@ template <typename Function, typename... Args>
       std::forward<Function>(f), std::forward<Args>(args)...);
 }
 
+/// @ingroup userver_concurrency
+///
+/// @brief Starts an asynchronous task without a tracing::Span that inherits
+/// all engine::TaskInheritedVariable instances from the current task.
+///
+/// The task is much cheaper to start than the one from utils::Async, which
+/// makes a difference for tiny subtasks that are awaited by the parent.
+///
+/// @warning The task does not have a tracing::Span, so its logs are not bound
+/// to the trace of the parent, and tracing::Span::CurrentSpan() will trigger
+/// asserts and lead to UB in production. Create a tracing::Span inside the
+/// task if it needs to log.
+///
+/// @see @ref flavors_of_async
+///
+/// @param tasks_processor Task processor to run on
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpanInheritVariables(
+    engine::TaskProcessor& task_processor, Function&& f, Args&&... args) {
+  return engine::AsyncNoSpan(task_processor,
+                             impl::InheritVariablesLazyPrvalue(),
+                             std::forward<Function>(f),
+                             std::forward<Args>(args)...);
+}
+
+/// @overload
+/// @ingroup userver_concurrency
+///
+/// The task will be launched on the current TaskProcessor.
+///
+/// @param f Function to execute asynchronously
+/// @param args Arguments to pass to the function
+/// @returns engine::TaskWithResult
+template <typename Function, typename... Args>
+[[nodiscard]] auto AsyncNoSpanInheritVariables(Function&& f, Args&&... args) {
+  return utils::AsyncNoSpanInheritVariables(
+      engine::current_task::GetTaskProcessor(), std::forward<Function>(f),
+      std::forward<Args>(args)...);
+}
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,137 @@
+#pragma once
+
+/// @file userver/utils/parallel_for.hpp
+/// @brief @copybrief utils::ParallelFor
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/get_all.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl {
+
+struct ParallelForPlan final {
+  std::size_t chunk_size{0};
+  std::size_t chunk_count{0};
+  std::size_t task_count{0};
+  bool caller_participates{false};
+};
+
+ParallelForPlan MakeParallelForPlan(engine::TaskProcessor& task_processor,
+                                    std::size_t size,
+                                    std::size_t min_chunk_size);
+
+// Calls `func(chunk_index, begin, end)` for every chunk of the plan. The
+// tasks pick the chunks one by one, so that a slow chunk does not hold back
+// the whole range.
+template <typename ChunkFunction>
+void RunParallelChunks(engine::TaskProcessor& task_processor,
+                       const std::string& name, const ParallelForPlan& plan,
+                       std::size_t size, const ChunkFunction& func) {
+  std::atomic<std::size_t> next_chunk{0};
+  const auto process_chunks = [&] {
+    for (auto chunk = next_chunk++; chunk < plan.chunk_count;
+         chunk = next_chunk++) {
+      if (engine::current_task::ShouldCancel()) return;
+      const auto begin = chunk * plan.chunk_size;
+      const auto end = std::min(begin + plan.chunk_size, size);
+      func(chunk, begin, end);
+    }
+  };
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  const auto spawned = plan.task_count - (plan.caller_participates ? 1 : 0);
+  tasks.reserve(spawned);
+  for (std::size_t i = 0; i < spawned; ++i) {
+    tasks.push_back(utils::Async(task_processor, name, process_chunks));
+  }
+  if (plan.caller_participates) process_chunks();
+  engine::GetAll(tasks);
+}
+
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Calls `func(begin, end)` for the consecutive subranges of
+/// `[0, size)` in parallel on the `task_processor`.
+///
+/// Unlike a utils::Async per element, starts at most one task per worker of
+/// the `task_processor`. The range is split into a few chunks per worker of at
+/// least `min_chunk_size` elements, which the tasks pick one by one. If the
+/// caller runs on the same task processor, it processes the chunks too.
+///
+/// `func` is called concurrently and must be thread-safe. If it throws, the
+/// remaining chunks are skipped and the exception is rethrown.
+///
+/// @code
+/// std::vector<Item> items = ...;
+/// utils::ParallelFor(task_processor, "render", items.size(), 1000,
+///                    [&](std::size_t begin, std::size_t end) {
+///                      for (auto i = begin; i < end; ++i) Render(items[i]);
+///                    });
+/// @endcode
+template <typename Function>
+void ParallelFor(engine::TaskProcessor& task_processor, const std::string& name,
+                 std::size_t size, std::size_t min_chunk_size,
+                 const Function& func) {
+  const auto plan = impl::MakeParallelForPlan(task_processor, size,
+                                              min_chunk_size);
+  impl::RunParallelChunks(
+      task_processor, name, plan, size,
+      [&func](std::size_t, std::size_t begin, std::size_t end) {
+        func(begin, end);
+      });
+}
+
+/// @ingroup userver_concurrency
+///
+/// @brief Computes `map(begin, end)` for the subranges of `[0, size)` in
+/// parallel like utils::ParallelFor and folds the results in the order of the
+/// subranges with `reduce(accumulated, chunk_result)` starting from `init`.
+///
+/// @code
+/// const auto total = utils::ParallelMapReduce(
+///     task_processor, "sum", values.size(), 10000, std::int64_t{0},
+///     [&](std::size_t begin, std::size_t end) {
+///       return std::accumulate(values.begin() + begin, values.begin() + end,
+///                              std::int64_t{0});
+///     },
+///     std::plus<>{});
+/// @endcode
+template <typename T, typename MapFunction, typename ReduceFunction>
+T ParallelMapReduce(engine::TaskProcessor& task_processor,
+                    const std::string& name, std::size_t size,
+                    std::size_t min_chunk_size, T init, const MapFunction& map,
+                    const ReduceFunction& reduce) {
+  const auto plan = impl::MakeParallelForPlan(task_processor, size,
+                                              min_chunk_size);
+  std::vector<std::optional<T>> results(plan.chunk_count);
+  impl::RunParallelChunks(
+      task_processor, name, plan, size,
+      [&map, &results](std::size_t chunk, std::size_t begin, std::size_t end) {
+        results[chunk].emplace(map(begin, end));
+      });
+
+  for (auto& result : results) {
+    init = reduce(std::move(init), std::move(*result));
+  }
+  return init;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
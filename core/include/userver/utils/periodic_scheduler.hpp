@@ -0,0 +1,112 @@
+#pragma once
+
+/// @file userver/utils/periodic_scheduler.hpp
+/// @brief @copybrief utils::PeriodicScheduler
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl {
+class PeriodicJob;
+}  // namespace impl
+
+/// @ingroup userver_concurrency
+///
+/// @brief Runs many periodic callbacks on a single timer wheel.
+///
+/// Each utils::PeriodicTask owns a coroutine that sleeps between the
+/// executions. With thousands of periodic tasks (per-tenant refreshers, locks,
+/// health checks) the idle coroutines and timers add up. PeriodicScheduler
+/// keeps the jobs in a hashed timer wheel driven by a single coroutine and
+/// spawns a task only when a job fires.
+///
+/// Jobs use PeriodicTask::Settings with the same semantics as PeriodicTask:
+/// Flags::kNow, Flags::kStrong, Flags::kChaotic, `exception_period`,
+/// `span_level` and `task_processor` are respected. The precision of the
+/// periods is limited by the resolution of the scheduler.
+///
+/// The scheduler must outlive all of its jobs.
+///
+/// ## Example usage:
+///
+/// @snippet utils/periodic_scheduler_test.cpp  PeriodicScheduler
+class PeriodicScheduler final {
+ public:
+  using Settings = PeriodicTask::Settings;
+  using Flags = PeriodicTask::Flags;
+  using Callback = PeriodicTask::Callback;
+
+  static constexpr std::chrono::milliseconds kDefaultResolution{10};
+
+  /// @brief Handle of a periodic job, the job runs until the handle is stopped
+  /// or destroyed.
+  class Job final {
+   public:
+    /// Constructs a handle that refers to no job
+    Job() noexcept;
+
+    Job(Job&&) noexcept;
+    Job& operator=(Job&&) noexcept;
+    ~Job();
+
+    /// @brief Stops the job. If the callback is running, cancels it and waits
+    /// for its completion.
+    void Stop() noexcept;
+
+    /// @brief Sets the new settings for the job, the flags are not changed.
+    ///
+    /// A new period is applied to the currently awaited execution.
+    void SetSettings(Settings settings);
+
+    /// @brief Schedules the next execution right away, or right after the
+    /// running one finishes.
+    void ForceStepAsync();
+
+    /// Checks if the handle refers to a job that was not stopped
+    bool IsRunning() const noexcept;
+
+   private:
+    friend class PeriodicScheduler;
+
+    explicit Job(std::shared_ptr<impl::PeriodicJob> job) noexcept;
+
+    std::shared_ptr<impl::PeriodicJob> job_;
+  };
+
+  /// @brief Starts the driver coroutine of the wheel on `task_processor`.
+  /// @param resolution the tick of the wheel, the periods are rounded up to it
+  explicit PeriodicScheduler(
+      engine::TaskProcessor& task_processor,
+      std::chrono::milliseconds resolution = kDefaultResolution);
+
+  PeriodicScheduler(PeriodicScheduler&&) = delete;
+  PeriodicScheduler& operator=(PeriodicScheduler&&) = delete;
+  ~PeriodicScheduler();
+
+  /// @brief Adds a periodic job. Unless `settings.task_processor` is set, the
+  /// callback runs on the TaskProcessor of the scheduler.
+  /// @warning The job must be stopped before the callback becomes invalid.
+  [[nodiscard]] Job Add(std::string name, Settings settings,
+                        Callback callback);
+
+  /// Number of the jobs that were added and not stopped yet
+  std::size_t GetJobsCount() const noexcept;
+
+ private:
+  friend class impl::PeriodicJob;
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <userver/utils/span.hpp>
 #include <userver/utils/statistics/fwd.hpp>
@@ -60,6 +61,9 @@ struct BoundsBlock;
 ///
 /// Histogram can be used in utils::statistics::MetricTag:
 /// @snippet utils/statistics/histogram_test.cpp  metric tag
+///
+/// For a histogram that is written to from many threads at once, see
+/// utils::statistics::ShardedHistogram.
 class Histogram final {
  public:
   /// Sets upper bounds for each non-"infinite" bucket. The lowest bound is
@@ -90,8 +94,13 @@ class Histogram final {
   /// @endcond
 
  private:
+  friend class ShardedHistogram;
+
   void UpdateBounds();
 
+  // Returns the index in `buckets_`, 0 for the "infinity" bucket.
+  std::size_t FindBucketIndex(double value) const noexcept;
+
   std::unique_ptr<impl::histogram::Bucket[]> buckets_;
   // B+ tree of bucket bounds for optimization of Account.
   std::unique_ptr<impl::histogram::BoundsBlock[]> bounds_;
@@ -102,6 +111,17 @@ class Histogram final {
 /// Metric serialization support for Histogram.
 void DumpMetric(Writer& writer, const Histogram& histogram);
 
+/// @brief Returns `count` histogram bounds that grow exponentially:
+/// `first_bound`, `first_bound * factor`, `first_bound * factor^2`, ...
+///
+/// Such buckets have the same relative precision across several orders of
+/// magnitude, which suits the latencies: e.g.
+/// `MakeExponentialBounds(0.1, 1.5, 30)` covers 0.1ms..12.8s with buckets that
+/// are at most 1.5 times wide, so high percentiles are estimated without
+/// tuning the bounds by hand.
+std::vector<double> MakeExponentialBounds(double first_bound, double factor,
+                                          std::size_t count);
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,201 @@
+#pragma once
+
+/// @file userver/utils/statistics/sharded_counter.hpp
+/// @brief @copybrief utils::statistics::ShardedRelaxedCounter
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+inline constexpr std::size_t kCounterShardCount = 8;
+inline constexpr std::size_t kCounterShardAlignment = 64;
+
+std::size_t AssignCounterShardIndex() noexcept;
+
+// The shard of the current thread. A coroutine may keep using the shard of its
+// previous thread after a migration, which only costs some cache misses.
+inline std::size_t GetCounterShardIndex() noexcept {
+  thread_local const std::size_t index = AssignCounterShardIndex();
+  return index;
+}
+
+template <typename T>
+class ShardedAtomic final {
+ public:
+  static_assert(std::atomic<T>::is_always_lock_free);
+
+  constexpr ShardedAtomic() noexcept = default;
+
+  void Add(T arg) noexcept {
+    shards_[GetCounterShardIndex()].value.fetch_add(arg,
+                                                    std::memory_order_relaxed);
+  }
+
+  void Sub(T arg) noexcept {
+    shards_[GetCounterShardIndex()].value.fetch_sub(arg,
+                                                    std::memory_order_relaxed);
+  }
+
+  T Load() const noexcept {
+    T result{};
+    for (const auto& shard : shards_) {
+      result += shard.value.load(std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  void Store(T desired) noexcept {
+    shards_[0].value.store(desired, std::memory_order_relaxed);
+    for (std::size_t i = 1; i < shards_.size(); ++i) {
+      shards_[i].value.store(T{}, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  struct alignas(kCounterShardAlignment) Shard final {
+    std::atomic<T> value{T{}};
+  };
+
+  std::array<Shard, kCounterShardCount> shards_{};
+};
+
+}  // namespace impl
+
+/// @brief utils::statistics::RelaxedCounter that is split into per-thread
+/// shards on separate cache lines.
+///
+/// The increments from different threads do not contend, but Load() sums all
+/// the shards and the counter takes kCounterShardCount cache lines. Use it for
+/// the counters that are incremented from all the threads on every request,
+/// and that are mostly read for the statistics.
+///
+/// Store() is not atomic with respect to the concurrent modifications.
+template <class T>
+class ShardedRelaxedCounter final {
+ public:
+  using ValueType = T;
+
+  constexpr ShardedRelaxedCounter() noexcept = default;
+  ShardedRelaxedCounter(T desired) noexcept { Store(desired); }
+
+  ShardedRelaxedCounter(const ShardedRelaxedCounter& other) noexcept {
+    Store(other.Load());
+  }
+
+  ShardedRelaxedCounter& operator=(
+      const ShardedRelaxedCounter& other) noexcept {
+    if (this == &other) return *this;
+
+    Store(other.Load());
+    return *this;
+  }
+
+  ShardedRelaxedCounter& operator=(T desired) noexcept {
+    Store(desired);
+    return *this;
+  }
+
+  void Store(T desired) noexcept { value_.Store(desired); }
+
+  T Load() const noexcept { return value_.Load(); }
+
+  operator T() const noexcept { return Load(); }
+
+  ShardedRelaxedCounter& operator++() noexcept {
+    value_.Add(1);
+    return *this;
+  }
+
+  void operator++(int) noexcept { value_.Add(1); }
+
+  ShardedRelaxedCounter& operator--() noexcept {
+    value_.Sub(1);
+    return *this;
+  }
+
+  void operator--(int) noexcept { value_.Sub(1); }
+
+  ShardedRelaxedCounter& operator+=(T arg) noexcept {
+    value_.Add(arg);
+    return *this;
+  }
+
+  ShardedRelaxedCounter& operator-=(T arg) noexcept {
+    value_.Sub(arg);
+    return *this;
+  }
+
+ private:
+  impl::ShardedAtomic<T> value_;
+};
+
+template <typename T>
+void DumpMetric(Writer& writer, const ShardedRelaxedCounter<T>& value) {
+  writer = value.Load();
+}
+
+/// @brief utils::statistics::RateCounter that is split into per-thread
+/// shards on separate cache lines.
+///
+/// @see utils::statistics::ShardedRelaxedCounter for the tradeoffs
+class ShardedRateCounter final {
+ public:
+  using ValueType = Rate;
+
+  constexpr ShardedRateCounter() noexcept = default;
+  explicit ShardedRateCounter(Rate desired) noexcept { Store(desired); }
+
+  ShardedRateCounter(const ShardedRateCounter& other) noexcept {
+    Store(other.Load());
+  }
+
+  ShardedRateCounter& operator=(const ShardedRateCounter& other) noexcept {
+    if (this == &other) return *this;
+
+    Store(other.Load());
+    return *this;
+  }
+
+  ShardedRateCounter& operator=(Rate desired) noexcept {
+    Store(desired);
+    return *this;
+  }
+
+  void Store(Rate desired) noexcept { value_.Store(desired.value); }
+
+  Rate Load() const noexcept { return Rate{value_.Load()}; }
+
+  void Add(Rate arg) noexcept { value_.Add(arg.value); }
+
+  ShardedRateCounter& operator++() noexcept {
+    value_.Add(1);
+    return *this;
+  }
+
+  void operator++(int) noexcept { value_.Add(1); }
+
+  ShardedRateCounter& operator+=(Rate arg) noexcept {
+    value_.Add(arg.value);
+    return *this;
+  }
+
+ private:
+  impl::ShardedAtomic<Rate::ValueType> value_;
+};
+
+void DumpMetric(Writer& writer, const ShardedRateCounter& value);
+
+void ResetMetric(ShardedRateCounter& value);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
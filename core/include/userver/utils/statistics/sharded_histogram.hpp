@@ -0,0 +1,63 @@
+#pragma once
+
+/// @file userver/utils/statistics/sharded_histogram.hpp
+/// @brief @copybrief utils::statistics::ShardedHistogram
+
+#include <cstdint>
+#include <memory>
+
+#include <userver/utils/span.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/histogram_aggregator.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+/// @brief utils::statistics::Histogram that is split into per-thread shards
+/// with the buckets on separate cache lines.
+///
+/// Account from different threads does not contend, the shards are summed
+/// when the metric is written. The memory footprint is
+/// impl::kCounterShardCount times the one of a Histogram.
+///
+/// Use it for the histograms that are written to from all the threads on
+/// every request. Bounds from utils::statistics::MakeExponentialBounds are a
+/// good default for the latencies.
+class ShardedHistogram final {
+ public:
+  /// Sets upper bounds for each non-"infinite" bucket. The lowest bound is
+  /// always 0.
+  explicit ShardedHistogram(utils::span<const double> upper_bounds);
+
+  ShardedHistogram(ShardedHistogram&&) noexcept;
+  ShardedHistogram& operator=(ShardedHistogram&&) noexcept;
+  ~ShardedHistogram();
+
+  /// Atomically increment the bucket corresponding to the given value in the
+  /// shard of the current thread.
+  void Account(double value, std::uint64_t count = 1) noexcept;
+
+  /// Sums the shards. The result is not a consistent snapshot with respect
+  /// to the concurrent Account calls.
+  HistogramAggregator Collect() const;
+
+  /// Atomically reset all counters of all the shards to zero.
+  friend void ResetMetric(ShardedHistogram& histogram) noexcept;
+
+ private:
+  impl::histogram::Bucket* GetShard(std::size_t index) const noexcept;
+
+  // Holds the bounds and the search tree, its counters are not used.
+  Histogram lookup_;
+  std::unique_ptr<impl::histogram::Bucket[]> buckets_;
+  std::size_t shard_stride_;
+};
+
+/// Metric serialization support for ShardedHistogram.
+void DumpMetric(Writer& writer, const ShardedHistogram& histogram);
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <userver/baggage/baggage.hpp>
 
 #include <algorithm>
+#include <utility>
 
 #include <fmt/format.h>
 
@@ -8,6 +9,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -91,7 +93,8 @@ const BaggageEntryProperty& BaggageEntry::GetProperty(
   throw BaggageException("Entry doesn't contain selected property");
 }
 
-std::string Baggage::ToString() const {
+const std::string& Baggage::ToString() const {
+  EnsureParsed();
   if (is_valid_header_) {
     return header_value_;
   }
@@ -99,12 +102,15 @@ std::string Baggage::ToString() const {
 }
 
 const std::vector<BaggageEntry>& Baggage::GetEntries() const {
+  EnsureParsed();
   return entries_;
 }
 
 bool Baggage::HasEntry(const std::string& key) const {
+  EnsureParsed();
+  const auto encoded_key = http::UrlEncode(key);
   for (const auto& entry : entries_) {
-    if (entry.key_ == http::UrlEncode(key)) {
+    if (entry.key_ == encoded_key) {
       return true;
     }
   }
@@ -112,8 +118,10 @@ bool Baggage::HasEntry(const std::string& key) const {
 }
 
 const BaggageEntry& Baggage::GetEntry(const std::string& key) const {
+  EnsureParsed();
+  const auto encoded_key = http::UrlEncode(key);
   for (const auto& entry : entries_) {
-    if (entry.key_ == http::UrlEncode(key)) {
+    if (entry.key_ == encoded_key) {
       return entry;
     }
   }
@@ -122,52 +130,53 @@ const BaggageEntry& Baggage::GetEntry(const std::string& key) const {
 
 Baggage::Baggage(std::string header,
                  std::unordered_set<std::string> allowed_keys)
+    : Baggage(std::move(header),
+              std::make_shared<const AllowedKeys>(std::move(allowed_keys))) {}
+
+Baggage::Baggage(std::string header,
+                 std::shared_ptr<const AllowedKeys> allowed_keys)
     : header_value_(std::move(header)), allowed_keys_(std::move(allowed_keys)) {
+  UASSERT(allowed_keys_);
   header_value_.erase(
       std::remove_if(header_value_.begin(), header_value_.end(),
                      [](unsigned char x) { return std::isspace(x); }),
       header_value_.end());
-
-  FillEntries();
-
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
-  }
 }
 
+// Entries point into header_value_, so copies and moves take the header only
+// and parse it again on demand
 Baggage::Baggage(const Baggage& baggage_copy) noexcept
-    : allowed_keys_(baggage_copy.allowed_keys_) {
-  if (baggage_copy.is_valid_header_) {
-    header_value_ = baggage_copy.header_value_;
-  } else {
-    header_value_ = baggage_copy.result_header_;
-  }
-  FillEntries();
+    : header_value_(baggage_copy.GetSourceHeader()),
+      allowed_keys_(baggage_copy.allowed_keys_) {}
 
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
-  }
+Baggage::Baggage(Baggage&& baggage_copy) noexcept
+    : allowed_keys_(baggage_copy.allowed_keys_) {
+  header_value_ = std::move(baggage_copy.GetSourceHeader());
+  baggage_copy.header_value_.clear();
+  baggage_copy.ResetParsed();
 }
 
-Baggage::Baggage(Baggage&& baggage_copy) noexcept
-    : allowed_keys_(std::move(baggage_copy.allowed_keys_)) {
-  if (baggage_copy.is_valid_header_) {
-    header_value_ = std::move(baggage_copy.header_value_);
-  } else {
-    header_value_ = std::move(baggage_copy.result_header_);
-  }
-  FillEntries();
+Baggage& Baggage::operator=(const Baggage& other) {
+  if (this == &other) return *this;
+  header_value_ = other.GetSourceHeader();
+  allowed_keys_ = other.allowed_keys_;
+  ResetParsed();
+  return *this;
+}
 
-  // if header contains invalid symbols, we should fill result_header_
-  if (!is_valid_header_) {
-    CreateResultHeader();
-  }
+Baggage& Baggage::operator=(Baggage&& other) noexcept {
+  if (this == &other) return *this;
+  header_value_ = std::move(other.GetSourceHeader());
+  allowed_keys_ = other.allowed_keys_;
+  ResetParsed();
+  other.header_value_.clear();
+  other.ResetParsed();
+  return *this;
 }
 
 void Baggage::AddEntry(std::string key, std::string value,
                        BaggageProperties properties) {
+  EnsureParsed();
   auto encoded_key = http::UrlEncode(key);
   auto encoded_value = http::UrlEncode(value);
   if (!IsValidEntry(key)) {
@@ -199,13 +208,6 @@ void Baggage::AddEntry(std::string key, std::string value,
           "Exceeded the limit of header length: {}", kHeaderLengthLimit));
     }
     header_value_ += entry;
-    entries_.clear();
-    FillEntries();
-
-    // if header contains invalid symbols, we should fill result_header_
-    if (!is_valid_header_) {
-      CreateResultHeader();
-    }
   } else {
     if (result_header_.size() + entry.size() >= kHeaderLengthLimit) {
       throw BaggageException(fmt::format(
@@ -214,26 +216,52 @@ void Baggage::AddEntry(std::string key, std::string value,
     // if header contains invalid entities, we should make new header
     // by concatenating result_header_ and new entry
     header_value_ = result_header_ + entry;
-    is_valid_header_ = true;
-    entries_.clear();
-    FillEntries();
-
-    // if header contains invalid symbols, we should fill result_header_
-    if (!is_valid_header_) {
-      CreateResultHeader();
-    }
   }
+  ResetParsed();
 }
 
 bool Baggage::IsValidEntry(const std::string& key) const {
-  return allowed_keys_.count(key);
+  return allowed_keys_->count(key);
 }
 
 std::unordered_set<std::string> Baggage::GetAllowedKeys() const {
-  return allowed_keys_;
+  return *allowed_keys_;
+}
+
+void Baggage::EnsureParsed() const {
+  if (is_parsed_.load(std::memory_order_acquire)) return;
+
+  const std::lock_guard lock{parse_mutex_};
+  if (is_parsed_.load(std::memory_order_relaxed)) return;
+
+  FillEntries();
+
+  // if header contains invalid symbols, we should fill result_header_
+  if (!is_valid_header_) {
+    CreateResultHeader();
+  }
+  is_parsed_.store(true, std::memory_order_release);
 }
 
-void Baggage::CreateResultHeader() {
+void Baggage::ResetParsed() noexcept {
+  entries_.clear();
+  result_header_.clear();
+  is_valid_header_ = true;
+  is_parsed_.store(false, std::memory_order_relaxed);
+}
+
+const std::string& Baggage::GetSourceHeader() const noexcept {
+  if (is_parsed_.load(std::memory_order_acquire) && !is_valid_header_) {
+    return result_header_;
+  }
+  return header_value_;
+}
+
+std::string& Baggage::GetSourceHeader() noexcept {
+  return const_cast<std::string&>(std::as_const(*this).GetSourceHeader());
+}
+
+void Baggage::CreateResultHeader() const {
   result_header_.reserve(header_value_.size());
   for (size_t i = 0; i < entries_.size(); i++) {
     if (i != 0) {
@@ -243,8 +271,7 @@ void Baggage::CreateResultHeader() {
   }
 }
 
-void Baggage::FillEntries() {
-  entries_.reserve(kEntitiesLimit);
+void Baggage::FillEntries() const {
   for (size_t header_pos = 0;
        header_pos != std::string::npos && entries_.size() < kEntitiesLimit;) {
     std::string_view entry{header_value_};
@@ -268,7 +295,7 @@ void Baggage::FillEntries() {
 }
 
 std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
-    std::string_view entry) {
+    std::string_view entry) const {
   if (entry.find(',') != std::string_view::npos) {
     LOG_LIMITED_WARNING() << "Entry contains invalid symbol: ','";
     return std::nullopt;
@@ -289,7 +316,7 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
     return std::nullopt;
   }
   key.remove_suffix(entry.size() - entry_delimiter);
-  if (!allowed_keys_.count(http::parser::UrlDecode(key))) {
+  if (!allowed_keys_->count(http::parser::UrlDecode(key))) {
     LOG_LIMITED_WARNING() << fmt::format("Key {} is not available", key);
     return std::nullopt;
   }
@@ -320,7 +347,6 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
 
   // make properties
   std::vector<BaggageEntryProperty> properties;
-  properties.reserve(kEntitiesLimit);
   while (property_pos != std::string_view::npos) {
     std::string_view property{entry};
     property.remove_prefix(property_pos + 1);
@@ -337,7 +363,8 @@ std::optional<BaggageEntry> Baggage::TryMakeBaggageEntry(
       }
     }
   }
-  return std::make_optional<BaggageEntry>({key, value, properties});
+  return std::make_optional<BaggageEntry>(
+      {key, value, std::move(properties)});
 }
 
 std::optional<BaggageEntryProperty> Baggage::TryMakeBaggageEntryProperty(
@@ -382,6 +409,14 @@ std::optional<BaggageEntryProperty> Baggage::TryMakeBaggageEntryProperty(
 
 std::optional<Baggage> TryMakeBaggage(
     std::string header, std::unordered_set<std::string> allowed_keys) {
+  return TryMakeBaggage(
+      std::move(header),
+      std::make_shared<const Baggage::AllowedKeys>(std::move(allowed_keys)));
+}
+
+std::optional<Baggage> TryMakeBaggage(
+    std::string header,
+    std::shared_ptr<const Baggage::AllowedKeys> allowed_keys) {
   if (header.size() > kHeaderLengthLimit) {
     LOG_LIMITED_WARNING() << fmt::format(
         "Exceeded the limit of header length: {}", kHeaderLengthLimit);
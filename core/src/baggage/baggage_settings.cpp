@@ -12,6 +12,9 @@ BaggageSettings Parse(const formats::json::Value& value,
   BaggageSettings result{};
   result.allowed_keys =
       value["allowed_keys"].As<std::unordered_set<std::string>>();
+  result.shared_allowed_keys =
+      std::make_shared<const std::unordered_set<std::string>>(
+          result.allowed_keys);
   return result;
 }
 
@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <userver/baggage/baggage.hpp>
+#include <userver/engine/async.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -142,6 +143,45 @@ UTEST(Baggage, WithoutCommas) {
             "\n\tProperty: property");
 }
 
+// Entries are parsed lazily and point into the header, check that copies and
+// moves of parsed and not yet parsed baggage keep them valid
+UTEST(Baggage, CopyAndMove) {
+  const auto allowed_keys =
+      std::make_shared<const baggage::Baggage::AllowedKeys>(kAllowedKeys);
+  const baggage::Baggage source{"key1=v1,key6=v6,key2=v2;p", allowed_keys};
+
+  const auto copy = source;
+  ASSERT_EQ(source.ToString(), "key1=v1,key2=v2;p");
+
+  auto parsed_copy = source;
+  ASSERT_EQ(parsed_copy.ToString(), "key1=v1,key2=v2;p");
+  const auto moved = std::move(parsed_copy);
+
+  for (const auto* baggage : {&source, &copy, &moved}) {
+    ASSERT_EQ(PrintBaggage(*baggage),
+              "Baggage:"
+              "\nEntry: key1 v1"
+              "\nEntry: key2 v2"
+              "\n\tProperty: p");
+  }
+}
+
+UTEST_MT(Baggage, ConcurrentParse, 4) {
+  const baggage::Baggage baggage{"key1=value1,key2=value2", kAllowedKeys};
+
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  for (int i = 0; i < 4; ++i) {
+    tasks.push_back(
+        engine::AsyncNoSpan([&baggage] { return PrintBaggage(baggage); }));
+  }
+  for (auto& task : tasks) {
+    EXPECT_EQ(task.Get(),
+              "Baggage:"
+              "\nEntry: key1 value1"
+              "\nEntry: key2 value2");
+  }
+}
+
 // Check HasEntry, GetEntry, HasProperty and GetProperty
 UTEST(Baggage, FindEntities) {
   std::string header =
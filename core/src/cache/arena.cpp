@@ -0,0 +1,83 @@
+#include <userver/cache/arena.hpp>
+
+#include <new>
+
+#include <userver/logging/log.hpp>
+#include <utils/jemalloc.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+std::shared_ptr<Arena> Arena::Create() {
+  return std::shared_ptr<Arena>(new Arena());
+}
+
+Arena::Arena() {
+  unsigned arena_index = 0;
+  const auto ec = utils::jemalloc::CreateArena(arena_index);
+  if (!ec) {
+    arena_index_ = arena_index;
+  } else {
+    LOG_DEBUG() << "Dedicated cache arenas are not available, using the "
+                   "global heap: "
+                << ec.message();
+  }
+}
+
+Arena::~Arena() {
+  if (!arena_index_) return;
+
+  const auto ec = utils::jemalloc::DestroyArena(*arena_index_);
+  if (ec) {
+    LOG_WARNING() << "Failed to destroy the jemalloc arena " << *arena_index_
+                  << ": " << ec.message();
+  }
+}
+
+void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+  if (arena_index_) {
+    // mallocx does not accept zero size
+    void* ptr = utils::jemalloc::AllocateInArena(
+        *arena_index_, size ? size : 1, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+  }
+
+  void* ptr = ::operator new(size, std::align_val_t{alignment});
+  allocated_bytes_.fetch_add(size, std::memory_order_relaxed);
+  return ptr;
+}
+
+void Arena::Deallocate(void* ptr, std::size_t size,
+                       std::size_t alignment) noexcept {
+  if (arena_index_) {
+    utils::jemalloc::DeallocateInArena(ptr, size ? size : 1, alignment);
+    return;
+  }
+
+  ::operator delete(ptr, size, std::align_val_t{alignment});
+  allocated_bytes_.fetch_sub(size, std::memory_order_relaxed);
+}
+
+std::size_t Arena::GetAllocatedBytes() const {
+  if (arena_index_) {
+    std::size_t allocated_bytes = 0;
+    const auto ec =
+        utils::jemalloc::GetArenaAllocatedBytes(*arena_index_, allocated_bytes);
+    if (ec) {
+      LOG_LIMITED_WARNING() << "Failed to get the statistics of the jemalloc "
+                               "arena "
+                            << *arena_index_ << ": " << ec.message();
+    }
+    return allocated_bytes;
+  }
+
+  return allocated_bytes_.load(std::memory_order_relaxed);
+}
+
+bool Arena::IsDedicated() const noexcept { return arena_index_.has_value(); }
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#include <userver/cache/arena.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(CacheArena, Vector) {
+  const auto arena = cache::Arena::Create();
+  {
+    std::vector<int, cache::ArenaAllocator<int>> vector{
+        cache::ArenaAllocator<int>{arena}};
+    vector.resize(1000, 42);
+    EXPECT_GE(arena->GetAllocatedBytes(), 1000 * sizeof(int));
+    EXPECT_EQ(vector.get_allocator().GetArena(), arena);
+  }
+  if (!arena->IsDedicated()) EXPECT_EQ(arena->GetAllocatedBytes(), 0);
+}
+
+TEST(CacheArena, OverAligned) {
+  struct alignas(64) Aligned {
+    char data[64];
+  };
+
+  const auto arena = cache::Arena::Create();
+  std::vector<Aligned, cache::ArenaAllocator<Aligned>> vector{
+      cache::ArenaAllocator<Aligned>{arena}};
+  vector.resize(10);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.data()) % 64, 0);
+}
+
+TEST(CacheArena, Map) {
+  /// [Sample arena allocator]
+  using Allocator =
+      cache::ArenaAllocator<std::pair<const std::string, std::string>>;
+  using Map = std::unordered_map<std::string, std::string,
+                                 std::hash<std::string>,
+                                 std::equal_to<std::string>, Allocator>;
+
+  // A new arena for each full update of the cache
+  auto contents = std::make_unique<Map>(Allocator{cache::Arena::Create()});
+  contents->emplace("key", "value");
+
+  // Incremental updates copy the contents into the same arena
+  auto copy = std::make_unique<Map>(*contents);
+  /// [Sample arena allocator]
+
+  EXPECT_EQ(copy->get_allocator(), contents->get_allocator());
+  EXPECT_EQ(copy->at("key"), "value");
+  EXPECT_GT(contents->get_allocator().GetArena()->GetAllocatedBytes(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -38,6 +38,7 @@ constexpr std::string_view kIsStrongPeriod = "is-strong-period";
 constexpr std::string_view kHasPreAssignCheck = "has-pre-assign-check";
 
 constexpr std::string_view kFirstUpdateFailOk = "first-update-fail-ok";
+constexpr std::string_view kFirstUpdateBackground = "first-update-background";
 constexpr std::string_view kUpdateTypes = "update-types";
 constexpr std::string_view kForcePeriodicUpdates =
     "testsuite-force-periodic-update";
@@ -140,6 +141,8 @@ Config::Config(const yaml_config::YamlConfig& config,
                const std::optional<dump::Config>& dump_config)
     : allowed_update_types(ParseUpdateMode(config)),
       allow_first_update_failure(config[kFirstUpdateFailOk].As<bool>(false)),
+      first_update_background(
+          config[kFirstUpdateBackground].As<bool>(false)),
       force_periodic_update(
           config[kForcePeriodicUpdates].As<std::optional<bool>>()),
       config_updates_enabled(config[kConfigSettings].As<bool>(true)),
@@ -16,6 +16,8 @@ constexpr const char* kStatisticsNameIncremental = "incremental";
 constexpr const char* kStatisticsNameAny = "any";
 constexpr const char* kStatisticsNameCurrentDocumentsCount =
     "current-documents-count";
+constexpr const char* kStatisticsNameCurrentMemoryBytes =
+    "current-memory-bytes";
 
 template <typename Clock, typename Duration>
 std::int64_t TimeStampToMillisecondsFromNow(
@@ -89,6 +91,10 @@ void DumpMetric(utils::statistics::Writer& writer, const Statistics& stats) {
 
   writer[cache::kStatisticsNameCurrentDocumentsCount] =
       stats.documents_current_count;
+  if (stats.memory_reported) {
+    writer[cache::kStatisticsNameCurrentMemoryBytes] =
+        stats.memory_current_bytes;
+  }
 }
 
 }  // namespace impl
@@ -137,6 +143,11 @@ void UpdateStatisticsScope::IncreaseDocumentsParseFailures(std::size_t add) {
   update_stats_.documents_parse_failures += add;
 }
 
+void UpdateStatisticsScope::SetMemoryUsage(std::size_t bytes) {
+  stats_.memory_current_bytes = bytes;
+  stats_.memory_reported = true;
+}
+
 void UpdateStatisticsScope::DoFinish(impl::UpdateState new_state) {
   UASSERT(new_state != impl::UpdateState::kNotFinished);
   // TODO Some production caches call Finish multiple times. We should fix those
@@ -49,6 +49,10 @@ bool CacheUpdateTrait::HasPreAssignCheck() const {
   return impl_->HasPreAssignCheck();
 }
 
+bool CacheUpdateTrait::IsFirstUpdateInBackground() const {
+  return impl_->IsFirstUpdateInBackground();
+}
+
 rcu::ReadablePtr<Config> CacheUpdateTrait::GetConfig() const {
   return impl_->GetConfig();
 }
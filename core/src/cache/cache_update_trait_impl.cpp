@@ -170,10 +170,21 @@ void CacheUpdateTrait::Impl::StartPeriodicUpdates(
               : UpdateType::kIncremental;
     }
 
-    if ((last_update_ == std::chrono::system_clock::time_point{} ||
+    const bool needs_first_update =
+        (last_update_ == std::chrono::system_clock::time_point{} ||
          config->first_update_mode != FirstUpdateMode::kSkip) &&
         (!(flags & CacheUpdateTrait::Flag::kNoFirstUpdate) ||
-         !periodic_update_enabled_)) {
+         !periodic_update_enabled_);
+
+    if (needs_first_update && static_config_.first_update_background &&
+        periodic_update_enabled_) {
+      // The periodic task makes the first update right after its start, the
+      // cache stays empty and reports kFatal health until it succeeds
+      LOG_INFO() << "Cache " << name_
+                 << " is started, its first update goes in background";
+      first_update_invalidation_ = FirstUpdateInvalidation::kNo;
+      periodic_task_flags_ |= utils::PeriodicTask::Flags::kNow;
+    } else if (needs_first_update) {
       // ignore kNoFirstUpdate if !periodic_update_enabled_
       // because some components require caches to be updated at least once
 
@@ -375,6 +386,10 @@ bool CacheUpdateTrait::Impl::HasPreAssignCheck() const {
   return static_config_.has_pre_assign_check;
 }
 
+bool CacheUpdateTrait::Impl::IsFirstUpdateInBackground() const {
+  return static_config_.first_update_background;
+}
+
 engine::TaskProcessor& CacheUpdateTrait::Impl::GetCacheTaskProcessor() const {
   return task_processor_;
 }
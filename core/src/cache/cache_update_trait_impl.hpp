@@ -56,6 +56,8 @@ class CacheUpdateTrait::Impl final {
 
   bool HasPreAssignCheck() const;
 
+  bool IsFirstUpdateInBackground() const;
+
   rcu::ReadablePtr<Config> GetConfig() const;
 
   engine::TaskProcessor& GetCacheTaskProcessor() const;
@@ -3,6 +3,7 @@
 #include <chrono>
 #include <exception>
 #include <optional>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -10,10 +11,15 @@
 #include <boost/filesystem.hpp>
 
 #include <cache/internal_helpers_test.hpp>
+#include <components/component_list_test.hpp>
 #include <dump/internal_helpers_test.hpp>
 #include <userver/cache/cache_config.hpp>
+#include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/update_type.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/components/minimal_component_list.hpp>
+#include <userver/components/run.hpp>
 #include <userver/dump/common.hpp>
 #include <userver/dump/test_helpers.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
@@ -24,6 +30,7 @@
 #include <userver/fs/blocking/write.hpp>
 #include <userver/testsuite/cache_control.hpp>
 #include <userver/testsuite/dump_control.hpp>
+#include <userver/testsuite/testsuite_support.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/enumerate.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
@@ -753,6 +760,16 @@ update-interval: 10s
   return {formats::yaml::FromString(kConfig), {}};
 }
 
+yaml_config::YamlConfig MakeBackgroundFirstUpdateCacheConfig() {
+  static const std::string kConfig = R"(
+update-types: full-and-incremental
+full-update-interval: 10s
+update-interval: 10s
+first-update-background: true
+)";
+  return {formats::yaml::FromString(kConfig), {}};
+}
+
 yaml_config::YamlConfig MakeForcedUpdateDisabledCacheConfig() {
   static const std::string kConfig = R"(
 update-types: full-and-incremental
@@ -821,6 +838,35 @@ UTEST(CacheInvalidateAsync, PeriodicUpdatesNotEnabled) {
   EXPECT_EQ(cache.GetUpdatesCount(), 1);
 }
 
+UTEST(CacheUpdateTrait, FirstUpdateBackground) {
+  cache::MockEnvironment environment(
+      testsuite::impl::PeriodicUpdatesMode::kEnabled);
+  const ForcedUpdateCache::Settings settings{
+      InvalidateBeforeStartPeriodicUpdates{true},
+      InvalidateAtFirstUpdate{false}, FirstSyncUpdate{true}};
+  ForcedUpdateCache cache(MakeBackgroundFirstUpdateCacheConfig(), environment,
+                          settings);
+
+  // The constructor does not wait for the first update
+  EXPECT_EQ(cache.GetUpdatesCount(), 0);
+
+  YieldNTimes(10);
+  EXPECT_EQ(cache.GetFullUpdatesCount(), 1);
+  EXPECT_EQ(cache.GetIncrementalUpdatesCount(), 0);
+}
+
+UTEST(CacheUpdateTrait, FirstUpdateBackgroundIgnoredInTestsuite) {
+  cache::MockEnvironment environment(
+      testsuite::impl::PeriodicUpdatesMode::kDisabled);
+  const ForcedUpdateCache::Settings settings{
+      InvalidateBeforeStartPeriodicUpdates{false},
+      InvalidateAtFirstUpdate{false}, FirstSyncUpdate{true}};
+  ForcedUpdateCache cache(MakeBackgroundFirstUpdateCacheConfig(), environment,
+                          settings);
+
+  EXPECT_EQ(cache.GetFullUpdatesCount(), 1);
+}
+
 namespace {
 
 auto SimulateCacheStartup(ForcedUpdateCache::Settings settings) {
@@ -907,4 +953,141 @@ UTEST(CacheUpdateTrait, FinishWithError) {
                     std::exception, "FinishWithError");
 }
 
+namespace {
+
+using ChangesData = std::unordered_map<int, int>;
+
+// Full updates reset the contents, incremental updates change a key and
+// insert a new one
+class ChangesCache final
+    : public components::CachingComponentBase<ChangesData> {
+ public:
+  static constexpr std::string_view kName = "changes-cache";
+
+  ChangesCache(const components::ComponentConfig& config,
+               const components::ComponentContext& context)
+      : CachingComponentBase(config, context) {
+    StartPeriodicUpdates();
+  }
+
+  ~ChangesCache() override { StopPeriodicUpdates(); }
+
+  using cache::CacheUpdateTrait::UpdateSyncDebug;
+
+ private:
+  void Update(cache::UpdateType type,
+              const std::chrono::system_clock::time_point& /*last_update*/,
+              const std::chrono::system_clock::time_point& /*now*/,
+              cache::UpdateStatisticsScope& stats_scope) override {
+    if (type == cache::UpdateType::kFull) {
+      stats_scope.Finish(2);
+      Set(ChangesData{{1, 1}, {2, 2}});
+      return;
+    }
+
+    const auto previous = Get();
+    auto data = std::make_unique<ChangesData>(*previous);
+    const auto next_key = static_cast<int>(data->size()) + 1;
+    cache::ChangeSet<int> changes;
+    (*data)[2] += 10;
+    changes.updated.push_back(2);
+    (*data)[next_key] = next_key;
+    changes.inserted.push_back(next_key);
+
+    stats_scope.Finish(data->size());
+    SetWithChanges(std::move(data), changes);
+  }
+};
+
+struct ChangesEvent final {
+  std::size_t snapshot_size{0};
+  std::optional<cache::ChangeSet<int>> changes;
+};
+
+class ChangesListener final : public components::LoggableComponentBase {
+ public:
+  static constexpr std::string_view kName = "changes-listener";
+
+  ChangesListener(const components::ComponentConfig& config,
+                  const components::ComponentContext& context)
+      : LoggableComponentBase(config, context),
+        cache_(context.FindComponent<ChangesCache>()) {
+    subscription_ = cache_.UpdateAndListenChanges(this, std::string{kName},
+                                                  &ChangesListener::OnChanges);
+  }
+
+  ~ChangesListener() override { subscription_.Unsubscribe(); }
+
+  void OnAllComponentsLoaded() override {
+    ASSERT_EQ(events_.size(), 1);
+    // The current contents on subscription, the changes are unknown
+    EXPECT_EQ(events_[0].snapshot_size, 2);
+    EXPECT_FALSE(events_[0].changes);
+
+    cache_.UpdateSyncDebug(cache::UpdateType::kIncremental);
+    ASSERT_EQ(events_.size(), 2);
+    EXPECT_EQ(events_[1].snapshot_size, 3);
+    ASSERT_TRUE(events_[1].changes);
+    EXPECT_EQ(events_[1].changes->inserted, std::vector<int>{3});
+    EXPECT_EQ(events_[1].changes->updated, std::vector<int>{2});
+    EXPECT_TRUE(events_[1].changes->erased.empty());
+
+    cache_.UpdateSyncDebug(cache::UpdateType::kIncremental);
+    ASSERT_EQ(events_.size(), 3);
+    ASSERT_TRUE(events_[2].changes);
+    EXPECT_EQ(events_[2].changes->inserted, std::vector<int>{4});
+
+    // A full update reports the whole snapshot
+    cache_.UpdateSyncDebug(cache::UpdateType::kFull);
+    ASSERT_EQ(events_.size(), 4);
+    EXPECT_EQ(events_[3].snapshot_size, 2);
+    EXPECT_FALSE(events_[3].changes);
+  }
+
+ private:
+  void OnChanges(const cache::CacheChanges<ChangesData>& changes) {
+    auto& event = events_.emplace_back();
+    event.snapshot_size = changes.snapshot ? changes.snapshot->size() : 0;
+    if (changes.changes) event.changes = *changes.changes;
+  }
+
+  ChangesCache& cache_;
+  std::vector<ChangesEvent> events_;
+  concurrent::AsyncEventSubscriberScope subscription_;
+};
+
+// BEWARE! No separate fs-task-processor. Testing almost single thread mode
+constexpr std::string_view kChangesStaticConfig = R"(
+components_manager:
+  default_task_processor: main-task-processor
+  event_thread_pool:
+    threads: 1
+  task_processors:
+    main-task-processor:
+      worker_threads: 1
+  components:
+    changes-cache:
+      update-types: full-and-incremental
+      update-interval: 10h
+      full-update-interval: 10h
+      config-settings: false
+    changes-listener:
+    logging:
+      fs-task-processor: main-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+    testsuite-support:
+)";
+
+}  // namespace
+
+TEST_F(ComponentList, CachingComponentChanges) {
+  components::RunOnce(components::InMemoryConfig{kChangesStaticConfig},
+                      components::MinimalComponentList()
+                          .Append<components::TestsuiteSupport>()
+                          .Append<ChangesCache>()
+                          .Append<ChangesListener>());
+}
+
 USERVER_NAMESPACE_END
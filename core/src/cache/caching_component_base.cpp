@@ -45,6 +45,12 @@ properties:
         type: boolean
         description: whether first update failure is non-fatal
         defaultDescription: false
+    first-update-background:
+        type: boolean
+        description: |
+            whether to start the component without waiting for the first
+            update, which is then done by the periodic update task
+        defaultDescription: false
     task-processor:
         type: string
         description: the name of the TaskProcessor for running DoWork
@@ -1,10 +1,15 @@
+#include <atomic>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <userver/utest/utest.hpp>
 
 #include <userver/cache/expirable_lru_cache.hpp>
 #include <userver/dump/operations_mock.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/utils/mock_now.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -357,6 +362,108 @@ UTEST(ExpirableLruCache, Example) {
   /// [Sample ExpirableLruCache]
 }
 
+UTEST_MT(ExpirableLruCache, CoalescedUpdates, 4) {
+  for (const auto read_mode : {SimpleCache::ReadMode::kUseCache,
+                               SimpleCache::ReadMode::kSkipCache}) {
+    auto cache = CreateSimpleCache();
+    std::atomic<int> calls{0};
+    const auto update = [&calls](const SimpleCacheKey&) {
+      ++calls;
+      engine::SleepFor(std::chrono::milliseconds(100));
+      return 42;
+    };
+
+    std::vector<engine::TaskWithResult<SimpleCacheValue>> tasks;
+    for (int i = 0; i < 10; ++i) {
+      tasks.push_back(engine::AsyncNoSpan(
+          [&] { return cache.Get("my-key", update, read_mode); }));
+    }
+    for (auto& task : tasks) EXPECT_EQ(42, task.Get());
+    EXPECT_EQ(1, calls.load());
+  }
+}
+
+UTEST_MT(ExpirableLruCache, CoalescedUpdateFailure, 4) {
+  auto cache = CreateSimpleCache();
+  std::atomic<int> calls{0};
+  const auto update = [&calls](const SimpleCacheKey&) -> SimpleCacheValue {
+    ++calls;
+    engine::SleepFor(std::chrono::milliseconds(100));
+    throw std::runtime_error("update failed");
+  };
+
+  std::vector<engine::TaskWithResult<SimpleCacheValue>> tasks;
+  for (int i = 0; i < 10; ++i) {
+    tasks.push_back(
+        engine::AsyncNoSpan([&] { return cache.Get("my-key", update); }));
+  }
+  for (auto& task : tasks) EXPECT_THROW(task.Get(), std::runtime_error);
+  EXPECT_EQ(1, calls.load());
+
+  // the failed update is not cached
+  EXPECT_EQ(1, cache.Get("my-key", [](const SimpleCacheKey&) { return 1; }));
+}
+
+UTEST(ExpirableLruCache, EarlyRefresh) {
+  auto counter = std::make_shared<Counter>();
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+
+  auto cache = CreateSimpleCache();
+  cache.SetMaxLifetime(std::chrono::seconds(10));
+  const SimpleCacheKey key = "my-key";
+
+  const auto slow_update = [&counter](SimpleCacheValue value) {
+    return [counter, value](const SimpleCacheKey&) {
+      ++(*counter);
+      utils::datetime::MockSleep(std::chrono::milliseconds(1));
+      return value;
+    };
+  };
+
+  EXPECT_EQ(1, cache.Get(key, slow_update(1)));
+  EXPECT_EQ(Counter::One(), *counter);
+
+  // disabled by default
+  counter->Flush();
+  EXPECT_EQ(1, cache.Get(key, slow_update(2)));
+  EngineYield();
+  EXPECT_EQ(Counter::Zero(), *counter);
+
+  // with a huge beta the refresh is almost certain
+  cache.SetEarlyRefreshBeta(1e9);
+  EXPECT_EQ(1, cache.Get(key, slow_update(2)));
+  EngineYield();
+  EXPECT_EQ(Counter::One(), *counter);
+  EXPECT_EQ(2, cache.GetOptionalNoUpdate(key));
+}
+
+UTEST(ExpirableLruCache, Weight) {
+  cache::ExpirableLruCache<std::string, std::string> cache(1, 100);
+  EXPECT_FALSE(cache.GetWeightStatistics());
+
+  cache.SetWeightFunction([](const std::string& key, const std::string& value) {
+    return key.size() + value.size();
+  });
+  cache.SetWayMaxWeight(20);
+
+  cache.Put("a", std::string(9, 'x'));
+  cache.Put("b", std::string(9, 'x'));
+  EXPECT_EQ(20, cache.GetWeightApproximate());
+
+  cache.Put("c", "x");
+  EXPECT_EQ(12, cache.GetWeightApproximate());
+  EXPECT_FALSE(cache.GetOptionalNoUpdate("a"));
+  EXPECT_TRUE(cache.GetOptionalNoUpdate("b"));
+
+  const auto stats = cache.GetWeightStatistics();
+  ASSERT_TRUE(stats);
+  EXPECT_EQ(12, stats->current);
+  EXPECT_EQ(20, stats->max);
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetWeightApproximate());
+}
+
 UTEST(LruCacheWrapper, HitWrapper) {
   auto counter = std::make_shared<Counter>();
 
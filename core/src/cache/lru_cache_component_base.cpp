@@ -50,9 +50,23 @@ properties:
     size:
         type: integer
         description: max amount of items to store in cache
+    max-weight:
+        type: integer
+        description: |
+            max total weight of the items, e.g. in bytes, for caches with a
+            weight function (0 is unlimited)
+        defaultDescription: 0
     ways:
         type: integer
         description: number of ways for associative cache
+    policy:
+        type: string
+        description: eviction policy of the cache
+        defaultDescription: lru
+        enum:
+          - lru
+          - w-tinylfu
+          - clock
     lifetime:
         type: string
         description: TTL for cache entries (0 is unlimited)
@@ -61,6 +75,12 @@ properties:
         type: boolean
         description: enables asynchronous updates for expring values
         defaultDescription: false
+    early-refresh-beta:
+        type: number
+        description: |
+            factor of the probabilistic early refresh of the values that are
+            about to expire (0 is disabled)
+        defaultDescription: 0
     config-settings:
         type: boolean
         description: enables dynamic reconfiguration with CacheConfigSet
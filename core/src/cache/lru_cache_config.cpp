@@ -2,10 +2,13 @@
 
 #include <stdexcept>
 
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/dump/config.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -15,9 +18,23 @@ namespace {
 
 constexpr std::string_view kWays = "ways";
 constexpr std::string_view kSize = "size";
+constexpr std::string_view kMaxWeight = "max-weight";
 constexpr std::string_view kLifetime = "lifetime";
 constexpr std::string_view kBackgroundUpdate = "background-update";
 constexpr std::string_view kLifetimeMs = "lifetime-ms";
+constexpr std::string_view kEarlyRefreshBeta = "early-refresh-beta";
+constexpr std::string_view kPolicy = "policy";
+
+CachePolicy ParsePolicy(const yaml_config::YamlConfig& value) {
+  const auto policy = value.As<std::string>("lru");
+  if (policy == "lru") return CachePolicy::kLRU;
+  if (policy == "w-tinylfu") return CachePolicy::kWTinyLFU;
+  if (policy == "clock") return CachePolicy::kClock;
+  throw std::runtime_error(
+      fmt::format("Unknown LRU cache policy '{}' at '{}', expected 'lru', "
+                  "'w-tinylfu' or 'clock'",
+                  policy, value.GetPath()));
+}
 
 }  // namespace
 
@@ -25,11 +42,16 @@ using dump::impl::ParseMs;
 
 LruCacheConfig::LruCacheConfig(const yaml_config::YamlConfig& config)
     : size(config[kSize].As<std::size_t>()),
+      max_weight(config[kMaxWeight].As<std::size_t>(0)),
       lifetime(config[kLifetime].As<std::chrono::milliseconds>(0)),
       background_update(config[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      early_refresh_beta(config[kEarlyRefreshBeta].As<double>(0)) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
+  if (early_refresh_beta < 0) {
+    throw std::runtime_error("early-refresh-beta is negative");
+  }
 }
 
 LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
@@ -37,11 +59,16 @@ LruCacheConfig::LruCacheConfig(const components::ComponentConfig& config)
 
 LruCacheConfig::LruCacheConfig(const formats::json::Value& value)
     : size(value[kSize].As<std::size_t>()),
+      max_weight(value[kMaxWeight].As<std::size_t>(0)),
       lifetime(ParseMs(value[kLifetimeMs])),
       background_update(value[kBackgroundUpdate].As<bool>(false)
                             ? BackgroundUpdateMode::kEnabled
-                            : BackgroundUpdateMode::kDisabled) {
+                            : BackgroundUpdateMode::kDisabled),
+      early_refresh_beta(value[kEarlyRefreshBeta].As<double>(0)) {
   if (size == 0) throw std::runtime_error("cache-size is non-positive");
+  if (early_refresh_beta < 0) {
+    throw std::runtime_error("early-refresh-beta is negative");
+  }
 }
 
 std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
@@ -49,6 +76,12 @@ std::size_t LruCacheConfig::GetWaySize(std::size_t ways) const {
   return way_size == 0 ? 1 : way_size;
 }
 
+std::size_t LruCacheConfig::GetWayMaxWeight(std::size_t ways) const {
+  if (max_weight == 0) return 0;
+  const auto way_max_weight = max_weight / ways;
+  return way_max_weight == 0 ? 1 : way_max_weight;
+}
+
 LruCacheConfig Parse(const formats::json::Value& value,
                      formats::parse::To<LruCacheConfig>) {
   return LruCacheConfig{value};
@@ -58,6 +91,7 @@ LruCacheConfigStatic::LruCacheConfigStatic(
     const yaml_config::YamlConfig& config)
     : config(config),
       ways(config[kWays].As<std::size_t>()),
+      policy(ParsePolicy(config[kPolicy])),
       use_dynamic_config(config["config-settings"].As<bool>(true)) {
   if (ways <= 0) throw std::runtime_error("cache-ways is non-positive");
 }
@@ -71,6 +105,10 @@ std::size_t LruCacheConfigStatic::GetWaySize() const {
   return config.GetWaySize(ways);
 }
 
+std::size_t LruCacheConfigStatic::GetWayMaxWeight() const {
+  return config.GetWayMaxWeight(ways);
+}
+
 const dynamic_config::Key<std::unordered_map<std::string, LruCacheConfig>>
     kLruCacheConfigSet{"USERVER_LRU_CACHES",
                        dynamic_config::DefaultAsJsonString{"{}"}};
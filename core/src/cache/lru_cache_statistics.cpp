@@ -63,6 +63,12 @@ void DumpMetric(utils::statistics::Writer& writer,
       s1min_hits / static_cast<double>(s1min_total ? s1min_total : 1);
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExpirableLruCacheWeight& weight) {
+  writer["current-weight"] = weight.current;
+  writer["max-weight"] = weight.max;
+}
+
 }  // namespace cache::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <userver/cache/nway_lru_cache.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr unsigned kWays = 4;
+constexpr unsigned kWaySize = 1000;
+constexpr unsigned kElementsCount = kWays * kWaySize / 2;
+
+// Concurrent Get of the cached keys, measures the contention on the ways
+template <cache::CachePolicy Policy>
+void NWayLruConcurrentGet(benchmark::State& state) {
+  const auto threads = static_cast<std::size_t>(state.range(0));
+  engine::RunStandalone(threads, [&] {
+    cache::NWayLRU<unsigned, unsigned> lru(kWays, kWaySize, {}, {}, Policy);
+    for (unsigned i = 0; i < kElementsCount; ++i) lru.Put(i, i);
+
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(threads - 1);
+    for (std::size_t thread_id = 1; thread_id < threads; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        unsigned i = thread_id * 101;
+        while (keep_running) {
+          benchmark::DoNotOptimize(lru.Get(++i % kElementsCount));
+        }
+      }));
+    }
+
+    unsigned i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(lru.Get(++i % kElementsCount));
+    }
+
+    keep_running = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+BENCHMARK_TEMPLATE(NWayLruConcurrentGet, cache::CachePolicy::kLRU)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(NWayLruConcurrentGet, cache::CachePolicy::kClock)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+// Concurrent Get with a small share of Put of new keys
+template <cache::CachePolicy Policy>
+void NWayLruConcurrentGetPut(benchmark::State& state) {
+  const auto threads = static_cast<std::size_t>(state.range(0));
+  engine::RunStandalone(threads, [&] {
+    cache::NWayLRU<unsigned, unsigned> lru(kWays, kWaySize, {}, {}, Policy);
+    for (unsigned i = 0; i < kElementsCount; ++i) lru.Put(i, i);
+
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(threads - 1);
+    for (std::size_t thread_id = 1; thread_id < threads; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        unsigned i = thread_id * 101;
+        while (keep_running) {
+          if (++i % 64 == 0) {
+            lru.Put(i, i);
+          } else {
+            benchmark::DoNotOptimize(lru.Get(i % kElementsCount));
+          }
+        }
+      }));
+    }
+
+    unsigned i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      benchmark::DoNotOptimize(lru.Get(++i % kElementsCount));
+    }
+
+    keep_running = false;
+    for (auto& task : tasks) task.Get();
+  });
+}
+BENCHMARK_TEMPLATE(NWayLruConcurrentGetPut, cache::CachePolicy::kLRU)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+BENCHMARK_TEMPLATE(NWayLruConcurrentGetPut, cache::CachePolicy::kClock)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,10 @@
 #include <userver/utest/utest.hpp>
 
+#include <vector>
+
 #include <userver/cache/nway_lru_cache.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -54,6 +58,106 @@ UTEST(NWayLRU, SetMultipleWays) {
   EXPECT_EQ(1, cache.Get(1));
 }
 
+UTEST(NWayLRU, WTinyLfu) {
+  Cache cache(2, 100, {}, {}, cache::CachePolicy::kWTinyLFU);
+  for (int i = 0; i < 50; ++i) {
+    cache.Put(i, i);
+    EXPECT_EQ(i, cache.Get(i));
+  }
+
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_EQ(i % 50, cache.Get(i % 50));
+    if (!cache.Get(50 + i)) cache.Put(50 + i, 50 + i);
+  }
+  EXPECT_LE(cache.GetSize(), 200);
+  EXPECT_GT(cache.GetAdmissionRejects(), 0);
+
+  cache.UpdateWaySize(10);
+  EXPECT_LE(cache.GetSize(), 20);
+
+  cache.Invalidate();
+  EXPECT_EQ(0, cache.GetSize());
+}
+
+UTEST(NWayLRU, Clock) {
+  Cache cache(1, 3, {}, {}, cache::CachePolicy::kClock);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  cache.Put(3, 3);
+  EXPECT_EQ(1, cache.Get(1));
+
+  cache.Put(4, 4);
+  EXPECT_EQ(3, cache.GetSize());
+  EXPECT_EQ(1, cache.Get(1));
+  EXPECT_FALSE(cache.Get(2).has_value());
+
+  EXPECT_FALSE(cache.Get(1, [](int) { return false; }).has_value());
+  EXPECT_EQ(2, cache.GetSize());
+  EXPECT_EQ(0, cache.GetOr(1, 0));
+}
+
+UTEST(NWayLRU, Weighted) {
+  for (const auto policy :
+       {cache::CachePolicy::kLRU, cache::CachePolicy::kWTinyLFU,
+        cache::CachePolicy::kClock}) {
+    Cache cache(1, 100, {}, {}, policy);
+    cache.SetWeightFunction([](int, int value) { return value; });
+    cache.UpdateWayMaxWeight(10);
+
+    cache.Put(1, 4);
+    cache.Put(2, 5);
+    EXPECT_EQ(9, cache.GetWeight());
+
+    cache.Put(3, 3);
+    EXPECT_LE(cache.GetWeight(), 10);
+    EXPECT_EQ(3, cache.Get(3));
+    EXPECT_EQ(2, cache.GetSize());
+
+    // too heavy to be stored
+    cache.Put(4, 11);
+    EXPECT_FALSE(cache.Get(4).has_value());
+    EXPECT_LE(cache.GetWeight(), 10);
+
+    cache.Put(3, 1);
+    cache.InvalidateByKey(2);
+    EXPECT_FALSE(cache.Get(3, [](int) { return false; }).has_value());
+    EXPECT_EQ(0, cache.GetSize());
+    EXPECT_EQ(0, cache.GetWeight());
+
+    for (int i = 0; i < 100; ++i) cache.Put(i, 1);
+    EXPECT_EQ(10, cache.GetWeight());
+    cache.UpdateWaySize(5);
+    EXPECT_EQ(5, cache.GetWeight());
+    cache.UpdateWayMaxWeight(2);
+    EXPECT_EQ(2, cache.GetWeight());
+
+    cache.Invalidate();
+    EXPECT_EQ(0, cache.GetWeight());
+  }
+}
+
+UTEST_MT(NWayLRU, ClockConcurrentReads, 4) {
+  Cache cache(2, 100, {}, {}, cache::CachePolicy::kClock);
+  for (int i = 0; i < 100; ++i) cache.Put(i, i);
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int task = 0; task < 4; ++task) {
+    tasks.push_back(engine::AsyncNoSpan([&cache, task] {
+      for (int i = 0; i < 10000; ++i) {
+        const auto key = (i * 7 + task) % 150;
+        const auto value = cache.Get(key);
+        if (value) {
+          EXPECT_EQ(key, *value);
+        } else if (i % 3 == 0) {
+          cache.Put(key, key);
+        }
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+  EXPECT_LE(cache.GetSize(), 200);
+}
+
 UTEST(NWayLRU, HashCombine) {
   for (const auto seed : std::vector<std::size_t>{0, 1, 7, 42, 100, 1000}) {
     /// @note: checking for seed used in way selection to not be equal after
@@ -39,6 +39,12 @@ ResolverConfig ParseResolverConfig(
   config.cache_failure_ttl =
       component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(
           config.cache_failure_ttl);
+  config.cache_update_margin =
+      component_config["cache-update-margin"]
+          .As<std::optional<std::chrono::milliseconds>>();
+  config.cache_max_stale_ttl =
+      component_config["cache-max-stale-ttl"].As<std::chrono::milliseconds>(
+          config.cache_max_stale_ttl);
   return config;
 }
 
@@ -53,22 +59,30 @@ Component::Component(const components::ComponentConfig& config,
   auto& storage =
       context.FindComponent<components::StatisticsStorage>().GetStorage();
   statistics_holder_ = storage.RegisterWriter(
-      config.Name() + ".replies", [this](auto& writer) { Write(writer); });
+      config.Name(), [this](auto& writer) { Write(writer); });
 }
 
 clients::dns::Resolver& Component::GetResolver() { return resolver_; }
 
 void Component::Write(utils::statistics::Writer& writer) {
   const auto& counters = GetResolver().GetLookupSourceCounters();
-  writer.ValueWithLabels(counters.file, {kDnsReplySource, "file"});
-  writer.ValueWithLabels(counters.cached, {kDnsReplySource, "cached"});
-  writer.ValueWithLabels(counters.cached_stale,
-                         {kDnsReplySource, "cached-stale"});
-  writer.ValueWithLabels(counters.cached_failure,
-                         {kDnsReplySource, "cached-failure"});
-  writer.ValueWithLabels(counters.network, {kDnsReplySource, "network"});
-  writer.ValueWithLabels(counters.network_failure,
-                         {kDnsReplySource, "network-failure"});
+  auto replies = writer["replies"];
+  replies.ValueWithLabels(counters.file, {kDnsReplySource, "file"});
+  replies.ValueWithLabels(counters.cached, {kDnsReplySource, "cached"});
+  replies.ValueWithLabels(counters.cached_stale,
+                          {kDnsReplySource, "cached-stale"});
+  replies.ValueWithLabels(counters.cached_failure,
+                          {kDnsReplySource, "cached-failure"});
+  replies.ValueWithLabels(counters.network, {kDnsReplySource, "network"});
+  replies.ValueWithLabels(counters.network_failure,
+                          {kDnsReplySource, "network-failure"});
+
+  const auto& update_counters = GetResolver().GetNetUpdateCounters();
+  auto updates = writer["updates"];
+  updates["prefetch"] = update_counters.prefetch;
+  updates["stale-refresh"] = update_counters.stale_refresh;
+  updates["stale-expired"] = update_counters.stale_expired;
+  updates["network-time-us"] = update_counters.network_time_us;
 }
 
 yaml_config::Schema Component::GetStaticConfigSchema() {
@@ -119,6 +133,14 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-update-margin:
+        type: string
+        description: time before the reply expiration when the requested record is updated in background
+        defaultDescription: network-timeout
+    cache-max-stale-ttl:
+        type: string
+        description: limit for serving an expired reply while it is being updated
+        defaultDescription: 24h
 )");
 }
 
@@ -118,6 +118,8 @@ enum class FailureMode { kIgnore, kCache };
 
 class Resolver::Impl {
  public:
+  using TimePoint = std::chrono::steady_clock::time_point;
+
   struct NetCacheResult {
     enum class Status {
       kMiss,
@@ -128,12 +130,14 @@ class Resolver::Impl {
 
     Status status{Status::kMiss};
     AddrVector addrs;
+    bool is_stale{false};
   };
 
   Impl(engine::TaskProcessor& fs_task_processor, const ResolverConfig& config);
   ~Impl();
 
   const LookupSourceCounters& GetLookupSourceCounters() const;
+  const NetUpdateCounters& GetNetUpdateCounters() const;
 
   void ReloadHosts();
   void FlushNetworkCache();
@@ -144,6 +148,7 @@ class Resolver::Impl {
 
   auto GetUpdateMutex(const std::string& name);
   void AccountNetUpdateFailure();
+  void AccountNetworkTime(TimePoint started_at);
 
   template <typename Mutex>
   AddrVector DoForegroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
@@ -152,7 +157,7 @@ class Resolver::Impl {
 
   template <typename Mutex>
   void StartBackgroundQuery(std::unique_lock<Mutex>& lock, Mutex&& mutex,
-                            const std::string& name);
+                            const std::string& name, bool is_stale);
 
  private:
   struct NetCacheEntry {
@@ -164,20 +169,23 @@ class Resolver::Impl {
   template <typename Mutex>
   void MoveQueryToBackground(std::unique_lock<Mutex>& lock, Mutex&& mutex,
                              engine::Future<NetResolver::Response>&& future,
-                             const std::string& name, FailureMode failure_mode);
+                             const std::string& name, FailureMode failure_mode,
+                             TimePoint started_at);
 
   template <typename Mutex>
   void FinishNetUpdate(std::unique_lock<Mutex>& lock,
                        engine::Future<NetResolver::Response>&& future,
                        const std::string& name, AddrVector* addrs,
-                       FailureMode failure_mode);
+                       FailureMode failure_mode, TimePoint started_at);
 
   LookupSourceCounters source_counters_;
+  NetUpdateCounters update_counters_;
   FileResolver file_resolver_;
   NetResolver net_resolver_;
   const std::chrono::milliseconds net_cache_update_margin_;
   const std::chrono::milliseconds net_cache_max_reply_ttl_;
   const std::chrono::milliseconds net_cache_failure_ttl_;
+  const std::chrono::milliseconds net_cache_max_stale_ttl_;
   cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
   concurrent::MutexSet<std::string> net_cache_update_mutexes_;
   utils::impl::WaitTokenStorage wait_token_storage_;
@@ -189,9 +197,11 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
                      config.file_update_interval},
       net_resolver_{fs_task_processor, config.network_timeout,
                     config.network_attempts, config.network_custom_servers},
-      net_cache_update_margin_{config.network_timeout},
+      net_cache_update_margin_{
+          config.cache_update_margin.value_or(config.network_timeout)},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
+      net_cache_max_stale_ttl_{config.cache_max_stale_ttl},
       net_cache_{config.cache_ways, config.cache_size_per_way},
       net_cache_update_mutexes_(config.cache_ways) {}
 
@@ -202,6 +212,11 @@ const Resolver::LookupSourceCounters& Resolver::Impl::GetLookupSourceCounters()
   return source_counters_;
 }
 
+const Resolver::NetUpdateCounters& Resolver::Impl::GetNetUpdateCounters()
+    const {
+  return update_counters_;
+}
+
 void Resolver::Impl::ReloadHosts() { file_resolver_.ReloadHosts(); }
 
 void Resolver::Impl::FlushNetworkCache() { net_cache_.Invalidate(); }
@@ -234,6 +249,13 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
     return result;
   }
 
+  if (now - cached->expiration > net_cache_max_stale_ttl_) {
+    // too old to be served while updating, resolve it as a missing one
+    ++update_counters_.stale_expired;
+    net_cache_.InvalidateByKey(name);
+    return result;
+  }
+
   result.addrs = cached->addrs;
   if (cached->expiration >= now) {
     ++source_counters_.cached;
@@ -245,6 +267,8 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(
     result.status = NetCacheResult::Status::kHitReply;
   } else {
     result.status = NetCacheResult::Status::kHitReplyWithUpdate;
+    // the update is accounted only if it is started
+    result.is_stale = cached->expiration < now;
   }
 
   return result;
@@ -258,6 +282,13 @@ void Resolver::Impl::AccountNetUpdateFailure() {
   ++source_counters_.network_failure;
 }
 
+void Resolver::Impl::AccountNetworkTime(TimePoint started_at) {
+  update_counters_.network_time_us +=
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - started_at)
+          .count();
+}
+
 template <typename Mutex>
 AddrVector Resolver::Impl::DoForegroundQuery(std::unique_lock<Mutex>& lock,
                                              Mutex&& mutex,
@@ -267,12 +298,13 @@ AddrVector Resolver::Impl::DoForegroundQuery(std::unique_lock<Mutex>& lock,
   UASSERT(lock.mutex() == &mutex);
 
   LOG_TRACE() << "Resolving '" << name << "' in foreground";
+  const auto started_at = std::chrono::steady_clock::now();
   auto future = net_resolver_.Resolve(name);
   auto future_status = future.wait_until(deadline);
   if (future_status != engine::FutureStatus::kReady) {
     LOG_TRACE() << "Sending query for '" << name << "' to background";
     MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future),
-                          name, FailureMode::kCache);
+                          name, FailureMode::kCache, started_at);
     // not updating counters here as the request lives on in the background
     if (future_status == engine::FutureStatus::kTimeout) {
       throw NotResolvedException{"Resolving '" + name + "' timed out"};
@@ -280,38 +312,46 @@ AddrVector Resolver::Impl::DoForegroundQuery(std::unique_lock<Mutex>& lock,
     throw NotResolvedException{"Resolving '" + name + "' interrupted"};
   }
   AddrVector addrs;
-  FinishNetUpdate(lock, std::move(future), name, &addrs, FailureMode::kCache);
+  FinishNetUpdate(lock, std::move(future), name, &addrs, FailureMode::kCache,
+                  started_at);
   return addrs;
 }
 
 template <typename Mutex>
 void Resolver::Impl::StartBackgroundQuery(std::unique_lock<Mutex>& lock,
                                           Mutex&& mutex,
-                                          const std::string& name) {
+                                          const std::string& name,
+                                          bool is_stale) {
   UASSERT(lock.mutex() == &mutex);
   if (!lock && !lock.try_lock()) {
     LOG_TRACE() << "Record for '" << name << "' is already updating, skipping";
     return;
   }
   LOG_TRACE() << "Updating record for '" << name << "' in background";
+  if (is_stale) {
+    ++update_counters_.stale_refresh;
+  } else {
+    ++update_counters_.prefetch;
+  }
+  const auto started_at = std::chrono::steady_clock::now();
   auto future = net_resolver_.Resolve(name);
   MoveQueryToBackground(lock, std::forward<Mutex>(mutex), std::move(future),
-                        name, FailureMode::kIgnore);
+                        name, FailureMode::kIgnore, started_at);
 }
 
 template <typename Mutex>
 void Resolver::Impl::MoveQueryToBackground(
     std::unique_lock<Mutex>& lock, Mutex&& mutex,
     engine::Future<NetResolver::Response>&& future, const std::string& name,
-    FailureMode failure_mode) {
+    FailureMode failure_mode, TimePoint started_at) {
   UASSERT(lock);
   UASSERT(lock.mutex() == &mutex);
   engine::CriticalAsyncNoSpan(
-      [token = wait_token_storage_.GetToken(), this, name, failure_mode](
-          auto&& mutex, auto&& future) {
+      [token = wait_token_storage_.GetToken(), this, name, failure_mode,
+       started_at](auto&& mutex, auto&& future) {
         std::unique_lock lock{mutex, std::adopt_lock};
         this->FinishNetUpdate(lock, std::forward<decltype(future)>(future),
-                              name, nullptr, failure_mode);
+                              name, nullptr, failure_mode, started_at);
       },
       std::forward<Mutex>(mutex), std::move(future))
       .Detach();
@@ -327,12 +367,14 @@ template <typename Mutex>
 void Resolver::Impl::FinishNetUpdate(
     std::unique_lock<Mutex>& lock,
     engine::Future<NetResolver::Response>&& future, const std::string& name,
-    AddrVector* addrs, FailureMode failure_mode) {
+    AddrVector* addrs, FailureMode failure_mode, TimePoint started_at) {
   UASSERT(lock);
   NetResolver::Response response;
   try {
     response = future.get();
+    AccountNetworkTime(started_at);
   } catch (const ResolverException& ex) {
+    AccountNetworkTime(started_at);
     LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
     if (failure_mode == FailureMode::kCache) {
       LOG_TRACE() << "Caching failure for '" << name << '\'';
@@ -418,7 +460,8 @@ AddrVector Resolver::Resolve(const std::string& name,
       return impl_->DoForegroundQuery(lock, std::move(mutex), name, deadline);
 
     case Impl::NetCacheResult::Status::kHitReplyWithUpdate:
-      impl_->StartBackgroundQuery(lock, std::move(mutex), name);
+      impl_->StartBackgroundQuery(lock, std::move(mutex), name,
+                                  net_result.is_stale);
       [[fallthrough]];
     case Impl::NetCacheResult::Status::kHitReply:
       return std::move(net_result.addrs);
@@ -436,6 +479,10 @@ const Resolver::LookupSourceCounters& Resolver::GetLookupSourceCounters()
   return impl_->GetLookupSourceCounters();
 }
 
+const Resolver::NetUpdateCounters& Resolver::GetNetUpdateCounters() const {
+  return impl_->GetNetUpdateCounters();
+}
+
 void Resolver::ReloadHosts() { impl_->ReloadHosts(); }
 
 void Resolver::FlushNetworkCache() { impl_->FlushNetworkCache(); }
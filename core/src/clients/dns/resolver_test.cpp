@@ -58,7 +58,9 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
   using ServerMock = utest::DnsServerMock;
 
-  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way,
+                 std::chrono::milliseconds cache_max_stale_ttl =
+                     std::chrono::hours{24})
       : hosts_file{[] {
           auto file = fs::blocking::TempFile::Create();
           fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -87,6 +89,7 @@ struct MockedResolver {
               config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl},
               config.cache_ways = 1;
               config.cache_size_per_way = cache_size_per_way;
+              config.cache_max_stale_ttl = cache_max_stale_ttl;
               config.network_custom_servers = {server_mock.GetServerAddress()};
               return config;
             }()} {}
@@ -399,6 +402,40 @@ UTEST(Resolver, CacheStale) {
   EXPECT_EQ(counters.network_failure, 0);
 }
 
+UTEST(Resolver, CacheMaxStaleTtl) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{1, 1, std::chrono::seconds{5}};
+
+  utils::datetime::MockNowSet({});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  utils::datetime::MockSleep(std::chrono::seconds{3});
+
+  // served stale while updating
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  utils::datetime::MockSleep(std::chrono::seconds{10});
+
+  // too old to be served
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  const auto& counters = resolver->GetLookupSourceCounters();
+  EXPECT_EQ(counters.cached_stale, 1);
+  EXPECT_GE(counters.network, 2);
+  EXPECT_EQ(counters.network_failure, 0);
+
+  const auto& update_counters = resolver->GetNetUpdateCounters();
+  EXPECT_EQ(update_counters.prefetch, 0);
+  EXPECT_EQ(update_counters.stale_refresh, 1);
+  EXPECT_EQ(update_counters.stale_expired, 1);
+}
+
 UTEST(Resolver, CacheFailures) {
   const auto test_deadline =
       engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
@@ -0,0 +1,180 @@
+#include <clients/http/address_balancer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+// Protects from the unbounded memory growth on the hosts with ever changing
+// addresses, the new addresses are not balanced after the limit is reached
+constexpr std::size_t kMaxAddresses = 1000;
+
+// Weight of the new latency sample, 1/kEwmaDivisor
+constexpr std::int64_t kEwmaDivisor = 5;
+
+std::chrono::steady_clock::rep Now() noexcept {
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+bool IsEjected(const AddressStatistics& stats,
+               std::chrono::steady_clock::rep now) noexcept {
+  return stats.ejected_until.load() > now;
+}
+
+double Score(const AddressStatistics& stats) noexcept {
+  // The addresses without the latency estimation are preferred to get one
+  return static_cast<double>(stats.in_flight.load() + 1) *
+         static_cast<double>(stats.latency_ewma_us.load() + 1);
+}
+
+void UpdateEwma(std::atomic<std::int64_t>& ewma, std::int64_t sample) {
+  auto old_value = ewma.load();
+  std::int64_t new_value = 0;
+  do {
+    new_value = (old_value == 0)
+                    ? sample
+                    : old_value + (sample - old_value) / kEwmaDivisor;
+  } while (!ewma.compare_exchange_weak(old_value, new_value));
+}
+
+}  // namespace
+
+AddressBalancer::Lease::Lease(std::shared_ptr<AddressStatistics> stats,
+                              const engine::io::Sockaddr& addr) noexcept
+    : stats_(std::move(stats)), addr_(addr) {}
+
+AddressBalancer::Lease& AddressBalancer::Lease::operator=(
+    Lease&& other) noexcept {
+  if (this == &other) return *this;
+  if (stats_) --stats_->in_flight;
+  stats_ = std::move(other.stats_);
+  addr_ = other.addr_;
+  return *this;
+}
+
+AddressBalancer::Lease::~Lease() {
+  if (stats_) --stats_->in_flight;
+}
+
+AddressBalancer::AddressBalancer(const impl::AddressBalancerSettings& settings)
+    : settings_(settings) {}
+
+AddressBalancer::Lease AddressBalancer::Pick(
+    const clients::dns::AddrVector& addrs) {
+  if (!settings_.enabled || addrs.empty()) return {};
+
+  struct Candidate {
+    std::shared_ptr<AddressStatistics> stats;
+    const engine::io::Sockaddr* addr;
+  };
+  boost::container::small_vector<Candidate, 4> candidates;
+  candidates.reserve(addrs.size());
+
+  for (const auto& addr : addrs) {
+    const auto key = addr.PrimaryAddressString();
+    auto stats = addresses_.Get(key);
+    if (!stats) {
+      if (addresses_.SizeApprox() >= kMaxAddresses) return {};
+      stats = addresses_[key];
+    }
+    candidates.push_back({std::move(stats), &addr});
+  }
+
+  // All the addresses are used if all of them are ejected
+  const auto now = Now();
+  const auto healthy_end =
+      std::stable_partition(candidates.begin(), candidates.end(),
+                            [now](const Candidate& candidate) {
+                              return !IsEjected(*candidate.stats, now);
+                            });
+  if (healthy_end != candidates.begin()) {
+    candidates.erase(healthy_end, candidates.end());
+  }
+
+  std::size_t index = 0;
+  if (candidates.size() > 1) {
+    const auto first = utils::RandRange(candidates.size());
+    auto second = utils::RandRange(candidates.size() - 1);
+    if (second >= first) ++second;
+    index = Score(*candidates[second].stats) < Score(*candidates[first].stats)
+                ? second
+                : first;
+  }
+
+  auto& picked = candidates[index];
+  ++picked.stats->in_flight;
+  ++picked.stats->picks;
+  return Lease{std::move(picked.stats), *picked.addr};
+}
+
+void AddressBalancer::AccountAttempt(const Lease& lease,
+                                     std::chrono::microseconds latency,
+                                     bool is_error) noexcept {
+  if (!lease) return;
+  auto& stats = *lease.stats_;
+
+  ++stats.attempts;
+  if (is_error) {
+    ++stats.errors;
+    ++stats.window_errors;
+  } else {
+    // The fast failures must not attract the traffic
+    UpdateEwma(stats.latency_ewma_us, latency.count());
+  }
+
+  auto attempts = ++stats.window_attempts;
+  if (attempts < settings_.ejection_window) return;
+  // Concurrent attempts only blur the window boundaries a bit
+  if (!stats.window_attempts.compare_exchange_strong(attempts, 0)) return;
+
+  const auto errors = stats.window_errors.exchange(0);
+  if (static_cast<double>(errors) >=
+      settings_.ejection_error_ratio * static_cast<double>(attempts)) {
+    stats.ejected_until =
+        Now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    settings_.ejection_time)
+                    .count();
+    ++stats.ejections;
+  }
+}
+
+AddressBalancer::AddressesMap::ConstIterator AddressBalancer::begin() const {
+  return addresses_.begin();
+}
+
+AddressBalancer::AddressesMap::ConstIterator AddressBalancer::end() const {
+  return addresses_.end();
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AddressStatistics& stats) {
+  writer["in-flight"] = stats.in_flight.load();
+  writer["latency-ewma-ms"] = stats.latency_ewma_us.load() / 1000;
+  writer["ejected"] = IsEjected(stats, Now()) ? 1 : 0;
+  writer["picks"] = stats.picks;
+  writer["attempts"] = stats.attempts;
+  writer["errors"] = stats.errors;
+  writer["ejections"] = stats.ejections;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AddressBalancer& balancer) {
+  for (const auto& [address, stats_ptr] : balancer) {
+    UASSERT(stats_ptr);
+    writer.ValueWithLabels(*stats_ptr, {"http_address", address});
+  }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <userver/clients/dns/common.hpp>
+#include <userver/clients/http/impl/config.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+struct AddressStatistics final {
+  std::atomic<std::size_t> in_flight{0};
+  /// 0 until the first attempt is finished
+  std::atomic<std::int64_t> latency_ewma_us{0};
+
+  // Tumbling window of the attempts for the outlier ejection
+  std::atomic<std::size_t> window_attempts{0};
+  std::atomic<std::size_t> window_errors{0};
+  std::atomic<std::chrono::steady_clock::rep> ejected_until{0};
+
+  utils::statistics::RateCounter picks;
+  utils::statistics::RateCounter attempts;
+  utils::statistics::RateCounter errors;
+  utils::statistics::RateCounter ejections;
+};
+
+/// @brief Picks one of the resolved addresses of a host with the power of two
+/// choices by the in-flight requests count and the EWMA of latency, ejects the
+/// addresses with too many failed attempts for a while.
+class AddressBalancer final {
+ public:
+  /// @brief Keeps the address picked for a request, the address is considered
+  /// busy with the request until the lease is destroyed.
+  class Lease final {
+   public:
+    Lease() = default;
+    Lease(Lease&&) noexcept = default;
+    Lease& operator=(Lease&&) noexcept;
+    ~Lease();
+
+    explicit operator bool() const noexcept { return !!stats_; }
+
+    const engine::io::Sockaddr& GetAddress() const noexcept { return addr_; }
+
+   private:
+    friend class AddressBalancer;
+
+    Lease(std::shared_ptr<AddressStatistics> stats,
+          const engine::io::Sockaddr& addr) noexcept;
+
+    std::shared_ptr<AddressStatistics> stats_;
+    engine::io::Sockaddr addr_;
+  };
+
+  explicit AddressBalancer(const impl::AddressBalancerSettings& settings);
+
+  bool IsEnabled() const noexcept { return settings_.enabled; }
+
+  /// Must be called from a coroutine, returns an empty lease if the balancing
+  /// is disabled or too many addresses are tracked
+  Lease Pick(const clients::dns::AddrVector& addrs);
+
+  /// Accounts a finished attempt of the request to the leased address
+  void AccountAttempt(const Lease& lease, std::chrono::microseconds latency,
+                      bool is_error) noexcept;
+
+  using AddressesMap = rcu::RcuMap<std::string, AddressStatistics>;
+
+  AddressesMap::ConstIterator begin() const;
+  AddressesMap::ConstIterator end() const;
+
+ private:
+  const impl::AddressBalancerSettings settings_;
+  AddressesMap addresses_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AddressStatistics& stats);
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AddressBalancer& balancer);
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,106 @@
+#include <clients/http/address_balancer.hpp>
+
+#include <netinet/in.h>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using clients::http::AddressBalancer;
+
+constexpr std::chrono::microseconds kFast{1000};
+constexpr std::chrono::microseconds kSlow{100000};
+
+engine::io::Sockaddr MakeAddress(std::uint8_t last_octet) {
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(0x7f000000 | last_octet);
+  return engine::io::Sockaddr{&addr};
+}
+
+clients::http::impl::AddressBalancerSettings MakeSettings() {
+  clients::http::impl::AddressBalancerSettings settings;
+  settings.enabled = true;
+  settings.ejection_window = 4;
+  return settings;
+}
+
+void Account(AddressBalancer& balancer, const engine::io::Sockaddr& addr,
+             std::chrono::microseconds latency, bool is_error) {
+  const auto lease = balancer.Pick({addr});
+  ASSERT_TRUE(lease);
+  balancer.AccountAttempt(lease, latency, is_error);
+}
+
+std::string PickAddress(AddressBalancer& balancer,
+                        const clients::dns::AddrVector& addrs) {
+  const auto lease = balancer.Pick(addrs);
+  EXPECT_TRUE(lease);
+  return lease ? lease.GetAddress().PrimaryAddressString() : std::string{};
+}
+
+}  // namespace
+
+UTEST(AddressBalancer, Disabled) {
+  AddressBalancer balancer{{}};
+  EXPECT_FALSE(balancer.Pick({MakeAddress(1), MakeAddress(2)}));
+  EXPECT_EQ(balancer.begin(), balancer.end());
+}
+
+UTEST(AddressBalancer, PrefersFastAddress) {
+  AddressBalancer balancer{MakeSettings()};
+  const clients::dns::AddrVector addrs{MakeAddress(1), MakeAddress(2)};
+
+  Account(balancer, addrs[0], kSlow, false);
+  Account(balancer, addrs[1], kFast, false);
+
+  std::vector<AddressBalancer::Lease> leases;
+  for (int i = 0; i < 10; ++i) {
+    leases.push_back(balancer.Pick(addrs));
+    ASSERT_TRUE(leases.back());
+    EXPECT_EQ(leases.back().GetAddress().PrimaryAddressString(), "127.0.0.2");
+  }
+
+  // The fast address is loaded enough to prefer the slow one
+  std::size_t slow_picks = 0;
+  for (int i = 0; i < 100; ++i) {
+    leases.push_back(balancer.Pick(addrs));
+    ASSERT_TRUE(leases.back());
+    if (leases.back().GetAddress().PrimaryAddressString() == "127.0.0.1") {
+      ++slow_picks;
+    }
+  }
+  EXPECT_GT(slow_picks, 0);
+
+  leases.clear();
+  EXPECT_EQ(PickAddress(balancer, addrs), "127.0.0.2");
+}
+
+UTEST(AddressBalancer, Ejection) {
+  AddressBalancer balancer{MakeSettings()};
+  const clients::dns::AddrVector addrs{MakeAddress(1), MakeAddress(2)};
+
+  Account(balancer, addrs[1], kSlow, false);
+  for (int i = 0; i < 4; ++i) Account(balancer, addrs[0], kFast, i % 2 == 0);
+
+  // The fast address is ejected for half of the attempts failed
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(PickAddress(balancer, addrs), "127.0.0.2");
+  }
+
+  for (int i = 0; i < 3; ++i) Account(balancer, addrs[1], kFast, true);
+  // All the addresses are ejected, any of them is picked
+  EXPECT_NE(PickAddress(balancer, addrs), "");
+
+  std::size_t addresses = 0;
+  for (const auto& [address, stats] : balancer) {
+    ++addresses;
+    EXPECT_EQ(stats->ejections.Load(), utils::statistics::Rate{1}) << address;
+    EXPECT_EQ(stats->in_flight.load(), std::size_t{0});
+  }
+  EXPECT_EQ(addresses, std::size_t{2});
+}
+
+USERVER_NAMESPACE_END
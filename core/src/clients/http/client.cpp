@@ -15,11 +15,13 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/request_coalescer.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/openssl.hpp>
 #include <curl-ev/multi.hpp>
 #include <curl-ev/ratelimit.hpp>
+#include <curl-ev/share.hpp>
 #include <engine/ev/thread_pool.hpp>
 #include <server/http/headers_propagator.hpp>
 
@@ -49,14 +51,17 @@ Client::Client(impl::ClientSettings settings,
                engine::TaskProcessor& fs_task_processor,
                impl::PluginPipeline&& plugin_pipeline)
     : deadline_propagation_config_(settings.deadline_propagation),
-      destination_statistics_(std::make_shared<DestinationStatistics>()),
+      destination_statistics_(std::make_shared<DestinationStatistics>(
+          settings.address_balancing)),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
       connect_rate_limiter_(std::make_shared<curl::ConnectRateLimiter>()),
+      coalescer_(std::make_unique<RequestCoalescer>()),
       tracing_manager_(GetTracingManager(settings)),
       headers_propagator_(settings.headers_propagator),
-      plugin_pipeline_(std::move(plugin_pipeline)) {
+      plugin_pipeline_(std::move(plugin_pipeline)),
+      warm_pools_(std::move(settings.warm_pools)) {
   const auto io_threads = settings.io_threads;
   const auto& thread_name_prefix = settings.thread_name_prefix;
 
@@ -68,6 +73,11 @@ Client::Client(impl::ClientSettings settings,
   ev_config.defer_events = settings.defer_events;
   thread_pool_ = std::make_unique<engine::ev::ThreadPool>(std::move(ev_config));
 
+  if (settings.share_tls_sessions) {
+    share_ = std::make_shared<curl::share>();
+    share_->set_share_ssl_session(true);
+  }
+
   ReinitEasy();
 
   multis_.reserve(io_threads);
@@ -87,9 +97,28 @@ Client::Client(impl::ClientSettings settings,
                           [this] { ReinitEasy(); });
 
   SetConfig({});
+
+  if (settings.http2.max_concurrent_streams) {
+    for (auto& multi : multis_) {
+      multi->SetMaxConcurrentStreams(
+          ClampToLong(*settings.http2.max_concurrent_streams));
+    }
+  }
+  if (settings.http2.max_host_connections) {
+    SetMaxHostConnections(*settings.http2.max_host_connections);
+  }
+
+  if (!warm_pools_.destinations.empty()) {
+    warm_pools_task_.Start(
+        "http_warm_pools",
+        utils::PeriodicTask::Settings(warm_pools_.refresh_period,
+                                      {utils::PeriodicTask::Flags::kNow}),
+        [this] { WarmUpPools(); });
+  }
 }
 
 Client::~Client() {
+  warm_pools_task_.Stop();
   easy_reinit_task_.Stop();
 
   // We have to destroy *this only when all the requests are finished, because
@@ -113,9 +142,12 @@ Client::~Client() {
   thread_pool_.reset();
 }
 
-Request Client::CreateRequest() {
-  auto request = [this] {
-    auto easy = TryDequeueIdle();
+Request Client::CreateRequest() { return CreateRequestImpl(std::nullopt); }
+
+Request Client::CreateRequestImpl(std::optional<std::size_t> multi_index) {
+  auto request = [this, multi_index] {
+    // Idle handles are bound to random multis
+    auto easy = multi_index ? nullptr : TryDequeueIdle();
     if (easy) {
       auto idx = FindMultiIndex(easy->GetMulti());
       auto wrapper =
@@ -125,7 +157,9 @@ Request Client::CreateRequest() {
           destination_statistics_, resolver_,
           plugin_pipeline_,        *tracing_manager_.GetBase()};
     } else {
-      auto i = utils::RandRange(multis_.size());
+      const auto i =
+          multi_index ? *multi_index : utils::RandRange(multis_.size());
+      UASSERT(i < multis_.size());
       auto& multi = multis_[i];
 
       try {
@@ -186,9 +220,43 @@ void Client::SetDnsResolver(clients::dns::Resolver* resolver) {
   resolver_ = resolver;
 }
 
+void Client::WarmUpPools() {
+  // HTTP/1.1 transfers that are in flight at the same time use different
+  // connections, those are left in the multi connection cache afterwards and
+  // their TLS sessions are cached for the resumption.
+  // With the multiplexing enabled the requests share a single connection.
+  std::vector<ResponseFuture> futures;
+  for (std::size_t i = 0; i < multis_.size(); ++i) {
+    for (const auto& pool : warm_pools_.destinations) {
+      for (std::size_t j = 0; j < pool.connections; ++j) {
+        futures.push_back(CreateRequestImpl(i)
+                              .head(pool.url)
+                              .retry(1)
+                              .timeout(warm_pools_.timeout)
+                              .async_perform());
+      }
+    }
+  }
+
+  std::size_t warm = 0;
+  for (auto& future : futures) {
+    try {
+      // Any HTTP status means that the connection is established
+      future.Get();
+      ++warm;
+    } catch (const clients::http::CancelException&) {
+      throw;
+    } catch (const std::exception& e) {
+      ++warm_up_errors_;
+      LOG_LIMITED_WARNING() << "Failed to warm up a connection: " << e;
+    }
+  }
+  warm_connections_ = warm;
+}
+
 void Client::ReinitEasy() {
   easy_.Set(utils::CriticalAsync(fs_task_processor_, "http_easy_reinit",
-                                 &curl::easy::CreateBlocking)
+                                 &curl::easy::CreateBlocking, share_)
                 .Get());
 }
 
@@ -222,6 +290,13 @@ PoolStatistics Client::GetPoolStatistics() const {
   for (size_t i = 0; i < multis_.size(); i++) {
     stats.multi.push_back(GetMultiStatistics(i));
   };
+
+  for (const auto& pool : warm_pools_.destinations) {
+    stats.warm_pool.target += pool.connections * multis_.size();
+  }
+  stats.warm_pool.warm = warm_connections_.load();
+  stats.warm_pool.errors = warm_up_errors_.Load();
+  stats.coalescing = coalescer_->GetStatistics();
   return stats;
 }
 
@@ -1,5 +1,6 @@
 #include <userver/clients/http/client.hpp>
 
+#include <atomic>
 #include <set>
 
 #include <fmt/format.h>
@@ -7,11 +8,14 @@
 #include <boost/algorithm/string/trim.hpp>
 
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/request_batch.hpp>
 #include <userver/clients/http/request_tracing_editor.hpp>
+#include <userver/clients/http/streamed_json.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
 #include <userver/crypto/certificate.hpp>
@@ -19,10 +23,12 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
 #include <userver/utils/userver_info.hpp>
@@ -386,6 +392,37 @@ struct Response503WithConnDrop {
   }
 };
 
+struct SlowFirstResponse {
+  std::shared_ptr<std::atomic<std::size_t>> requests =
+      std::make_shared<std::atomic<std::size_t>>(0);
+
+  HttpResponse operator()(const HttpRequest& request) const {
+    LOG_INFO() << "HTTP Server receive: " << request;
+
+    if ((*requests)++ == 0) {
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    }
+
+    return {
+        "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: "
+        "4\r\n\r\nfast",
+        HttpResponse::kWriteAndClose};
+  }
+};
+
+struct CountingKeepAliveResponse {
+  std::shared_ptr<std::atomic<std::size_t>> requests =
+      std::make_shared<std::atomic<std::size_t>>(0);
+
+  HttpResponse operator()(const HttpRequest& request) const {
+    LOG_INFO() << "HTTP Server receive: " << request;
+    ++*requests;
+
+    return {"HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+            HttpResponse::kWriteAndContinue};
+  }
+};
+
 struct CheckCookie {
   const std::set<std::string> expected_cookies;
 
@@ -1321,6 +1358,123 @@ UTEST(HttpClient, Retry) {
   EXPECT_EQ(2, response->GetStats().retries_count);
 }
 
+UTEST(HttpClient, Hedging) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const SlowFirstResponse callback;
+  const utest::SimpleServer http_server{callback};
+
+  auto request = http_client_ptr->CreateRequest()
+                     .get(http_server.GetBaseUrl())
+                     .timeout(kTimeout)
+                     .hedging({std::chrono::milliseconds{10}});
+
+  // The first attempt hangs, the hedged one wins
+  auto response = request.perform();
+  EXPECT_EQ(200, response->status_code());
+  EXPECT_EQ("fast", response->body());
+  EXPECT_EQ(2, *callback.requests);
+
+  // No hedged attempt for the fast responses
+  response = request.hedging({kTimeout}).perform();
+  EXPECT_EQ("fast", response->body());
+  EXPECT_EQ(3, *callback.requests);
+}
+
+UTEST(HttpClient, WarmPools) {
+  const CountingKeepAliveResponse callback;
+  const utest::SimpleServer http_server{callback};
+
+  const tracing::GenericTracingManager tracing_manager{
+      tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+  clients::http::impl::ClientSettings settings;
+  settings.io_threads = 1;
+  settings.tracing_manager = &tracing_manager;
+  settings.warm_pools.destinations.push_back({http_server.GetBaseUrl(), 2});
+  clients::http::Client http_client{
+      std::move(settings), engine::current_task::GetTaskProcessor(),
+      std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+  // The pool is warmed up in background right after the start
+  while (http_client.GetPoolStatistics().warm_pool.warm != 2) {
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+  const auto stats = http_client.GetPoolStatistics().warm_pool;
+  EXPECT_EQ(stats.target, 2);
+  EXPECT_EQ(stats.errors, utils::statistics::Rate{0});
+  EXPECT_EQ(*callback.requests, 2);
+}
+
+UTEST(HttpClient, Coalescing) {
+  const auto requests = std::make_shared<std::atomic<std::size_t>>(0);
+  const utest::SimpleServer http_server{[requests](const HttpRequest& request) {
+    ++*requests;
+    return sleep_callback_base(request, std::chrono::milliseconds{100});
+  }};
+  auto http_client_ptr = utest::CreateHttpClient();
+  const auto url = http_server.GetBaseUrl();
+
+  constexpr std::size_t kRequests = 10;
+  std::vector<clients::http::ResponseFuture> futures;
+  for (std::size_t i = 0; i < kRequests; ++i) {
+    futures.push_back(http_client_ptr->CreateRequest()
+                          .get(url)
+                          .timeout(utest::kMaxTestWaitTime)
+                          .coalescing()
+                          .async_perform());
+  }
+  for (auto& future : futures) {
+    const auto response = future.Get();
+    EXPECT_EQ(response->status_code(), clients::http::Status::OK);
+    EXPECT_EQ(response->body_view(), std::string(4096, '@'));
+  }
+  EXPECT_EQ(*requests, 1);
+
+  const auto stats = http_client_ptr->GetPoolStatistics().coalescing;
+  EXPECT_EQ(stats.requests, utils::statistics::Rate{kRequests});
+  EXPECT_EQ(stats.hits, utils::statistics::Rate{kRequests - 1});
+  EXPECT_EQ(stats.waiters, 0);
+
+  // The finished transfer is not shared with the new requests
+  http_client_ptr->CreateRequest()
+      .get(url)
+      .timeout(utest::kMaxTestWaitTime)
+      .coalescing()
+      .perform();
+  EXPECT_EQ(*requests, 2);
+}
+
+UTEST(HttpClient, RequestBatch) {
+  auto http_client_ptr = utest::CreateHttpClient();
+  const utest::SimpleServer fast_server{
+      clients::http::Response200WithHeader{"xxx: good"}};
+  const utest::SimpleServer slow_server{&sleep_callback};
+  auto& http_client = *http_client_ptr;
+  const std::vector<std::string> urls{fast_server.GetBaseUrl(),
+                                      fast_server.GetBaseUrl(),
+                                      slow_server.GetBaseUrl()};
+
+  /// [Sample HTTP RequestBatch usage]
+  clients::http::RequestBatch batch{
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime)};
+  for (const auto& url : urls) {
+    batch.Add(http_client.CreateRequest().get(url).timeout(
+        std::chrono::seconds{1}));
+  }
+
+  // The slow request is cancelled as soon as two of the requests succeed
+  EXPECT_TRUE(batch.WaitQuorum(2));
+  /// [Sample HTTP RequestBatch usage]
+
+  const auto& results = batch.GetResults();
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_TRUE(results[0].IsSuccess());
+  EXPECT_TRUE(results[1].IsSuccess());
+  EXPECT_FALSE(results[2].response);
+  UEXPECT_THROW(std::rethrow_exception(results[2].exception),
+                clients::http::CancelException);
+  EXPECT_EQ(batch.GetSuccessCount(), 2);
+}
+
 UTEST(HttpClient, TinyTimeout) {
   auto http_client_ptr = utest::CreateHttpClient();
   const utest::SimpleServer http_server{sleep_callback_1s};
@@ -1475,6 +1629,32 @@ UTEST(HttpClient, DISABLED_RequestReuseSampleStream) {
   EXPECT_EQ(*shared_echo_callback.responses_200, 3);
 }
 
+UTEST(HttpClient, StreamedJson) {
+  const utest::SimpleServer http_server{EchoCallback{}};
+  auto http_client_ptr = utest::CreateHttpClient();
+
+  const std::string data = R"({"items": [1, 2, 3], "next": "some cursor"})";
+  const auto expected = formats::json::FromString(data);
+  const auto perform_stream = [&] {
+    return http_client_ptr->CreateRequest()
+        .post(http_server.GetBaseUrl(), data)
+        .retry(1)
+        .timeout(kTimeout)
+        .async_perform_stream_body(concurrent::StringStreamQueue::Create());
+  };
+  const auto deadline = engine::Deadline::FromDuration(kTimeout);
+
+  auto dom_response = perform_stream();
+  EXPECT_EQ(dom_response.StatusCode(), clients::http::Status::OK);
+  EXPECT_EQ(clients::http::ReadStreamedJson(dom_response, deadline), expected);
+
+  auto sax_response = perform_stream();
+  EXPECT_EQ((clients::http::ParseStreamedJson<
+                formats::json::Value, formats::json::parser::JsonValueParser>(
+                sax_response, deadline)),
+            expected);
+}
+
 UTEST(HttpClient, RequestReuseDifferentUrlAndTimeout) {
   EchoCallback shared_echo_callback;
   const utest::SimpleServer http_echo_server{shared_echo_callback,
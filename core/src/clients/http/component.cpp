@@ -203,6 +203,10 @@ properties:
         type: boolean
         description: whether to defer events execution to a periodic timer; might affect timings a bit, might boost performance, use with care
         defaultDescription: false
+    share-tls-sessions:
+        type: boolean
+        description: whether to share the TLS sessions cache between the IO threads to resume the sessions on new connections instead of full handshakes
+        defaultDescription: false
     fs-task-processor:
         type: string
         description: task processor to run blocking HTTP related calls, like DNS resolving or hosts reading
@@ -246,6 +250,76 @@ properties:
             Note: timeout is always updated from the task-inherited deadline
             when present.
         defaultDescription: true
+    address-balancing:
+        type: object
+        description: |
+            Balancing of the requests across the addresses of a host resolved
+            by the async dns_resolver
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: pick the address by the power of two choices over the in-flight requests count and the latency EWMA
+                defaultDescription: false
+            ejection-error-ratio:
+                type: number
+                description: share of the failed attempts in a window that ejects the address
+                defaultDescription: 0.5
+            ejection-window:
+                type: integer
+                description: number of the attempts to an address to compute the error ratio over
+                defaultDescription: 20
+                minimum: 1
+            ejection-time:
+                type: string
+                description: for how long the ejected address is not picked unless all the addresses are ejected
+                defaultDescription: 30s
+    warm-pools:
+        type: object
+        description: |
+            Connections to keep established in each of the IO threads by
+            the periodic warm-up HEAD requests
+        additionalProperties: false
+        properties:
+            destinations:
+                type: array
+                description: destinations to keep the connections to
+                items:
+                    type: object
+                    description: destination
+                    additionalProperties: false
+                    properties:
+                        url:
+                            type: string
+                            description: URL to send the warm-up HEAD requests to
+                        connections:
+                            type: integer
+                            description: connections to keep per IO thread
+                            defaultDescription: 1
+                            minimum: 1
+            refresh-period:
+                type: string
+                description: period of the warm-up requests, should be less than the idle connections max age of 118s
+                defaultDescription: 60s
+            timeout:
+                type: string
+                description: timeout of the warm-up requests
+                defaultDescription: 1s
+    http2:
+        type: object
+        description: HTTP/2 multiplexing settings of each of the IO threads
+        additionalProperties: false
+        properties:
+            max-concurrent-streams:
+                type: integer
+                description: max number of the concurrent streams over one connection
+                defaultDescription: 100
+                minimum: 1
+            max-host-connections:
+                type: integer
+                description: max number of the connections to a host, the requests beyond the limit wait for a free connection or stream
+                defaultDescription: unlimited
+                minimum: 1
     plugins:
         type: array
         description: HTTP client plugin names
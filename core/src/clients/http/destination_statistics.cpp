@@ -6,6 +6,10 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 
+DestinationStatistics::DestinationStatistics(
+    const impl::AddressBalancerSettings& address_balancing)
+    : address_balancer_(address_balancing) {}
+
 std::shared_ptr<RequestStats>
 DestinationStatistics::GetStatisticsForDestination(
     const std::string& destination) {
@@ -83,6 +87,9 @@ void DumpMetric(utils::statistics::Writer& writer,
     writer.ValueWithLabels(DestinationStatisticsView{instance_stat},
                            {{"http_destination", url}, {"version", "2"}});
   }
+
+  const auto& address_balancer = stats.GetAddressBalancer();
+  if (address_balancer.IsEnabled()) writer["addresses"] = address_balancer;
 }
 
 }  // namespace clients::http
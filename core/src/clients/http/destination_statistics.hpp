@@ -6,6 +6,7 @@
 #include <userver/rcu/rcu_map.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 
+#include <clients/http/address_balancer.hpp>
 #include <clients/http/statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,6 +15,9 @@ namespace clients::http {
 
 class DestinationStatistics final {
  public:
+  explicit DestinationStatistics(
+      const impl::AddressBalancerSettings& address_balancing = {});
+
   // Return pointer to related RequestStats
   std::shared_ptr<RequestStats> GetStatisticsForDestination(
       const std::string& destination);
@@ -30,6 +34,11 @@ class DestinationStatistics final {
   DestinationsMap::ConstIterator begin() const;
   DestinationsMap::ConstIterator end() const;
 
+  AddressBalancer& GetAddressBalancer() noexcept { return address_balancer_; }
+  const AddressBalancer& GetAddressBalancer() const noexcept {
+    return address_balancer_;
+  }
+
  private:
   std::shared_ptr<RequestStats> GetExistingStatisticsForDestination(
       const std::string& destination);
@@ -40,6 +49,7 @@ class DestinationStatistics final {
   rcu::RcuMap<std::string, Statistics> rcu_map_;
   size_t max_auto_destinations_{0};
   std::atomic<size_t> current_auto_destinations_{0};
+  AddressBalancer address_balancer_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -1,7 +1,9 @@
 #include <clients/http/easy_wrapper.hpp>
 
 #include <userver/clients/http/client.hpp>
+#include <userver/clients/http/error.hpp>
 #include <userver/clients/http/response_future.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,6 +19,30 @@ EasyWrapper::~EasyWrapper() { client_.PushIdleEasy(std::move(easy_)); }
 
 curl::easy& EasyWrapper::Easy() { return *easy_; }
 
+std::shared_ptr<EasyWrapper> EasyWrapper::Clone() {
+  std::shared_ptr<curl::easy> easy;
+  try {
+    // curl_easy_duphandle() may block, same as in Client::CreateRequest()
+    easy = engine::AsyncNoSpan(client_.fs_task_processor_, [this] {
+             return easy_->CloneBlocking();
+           }).Get();
+  } catch (engine::WaitInterruptedException&) {
+    throw clients::http::CancelException();
+  } catch (engine::TaskCancelledException&) {
+    throw clients::http::CancelException();
+  }
+  if (!easy) return {};
+  return std::make_shared<EasyWrapper>(std::move(easy), client_);
+}
+
+utils::RetryBudget& EasyWrapper::GetHedgingBudget() noexcept {
+  return client_.hedging_budget_;
+}
+
+RequestCoalescer& EasyWrapper::GetCoalescer() noexcept {
+  return *client_.coalescer_;
+}
+
 }  // namespace clients::http::impl
 
 USERVER_NAMESPACE_END
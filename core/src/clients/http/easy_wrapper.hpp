@@ -3,11 +3,13 @@
 #include <memory>
 
 #include <curl-ev/easy.hpp>
+#include <userver/utils/retry_budget.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 class Client;
+class RequestCoalescer;
 }  // namespace clients::http
 
 namespace clients::http::impl {
@@ -25,6 +27,14 @@ class EasyWrapper final {
 
   curl::easy& Easy();
 
+  /// Returns a wrapper of a clone of the easy, or nullptr if the request can
+  /// not be cloned. Must not be called while the easy is performing.
+  std::shared_ptr<EasyWrapper> Clone();
+
+  utils::RetryBudget& GetHedgingBudget() noexcept;
+
+  RequestCoalescer& GetCoalescer() noexcept;
+
  private:
   std::shared_ptr<curl::easy> easy_;
   Client& client_;
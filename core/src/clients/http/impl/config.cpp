@@ -1,9 +1,11 @@
 #include <userver/clients/http/impl/config.hpp>
 
+#include <stdexcept>
 #include <string_view>
 
 #include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -39,6 +41,70 @@ DeadlinePropagationConfig ParseDeadlinePropagationConfig(
 
 }  // namespace
 
+AddressBalancerSettings Parse(const yaml_config::YamlConfig& value,
+                              formats::parse::To<AddressBalancerSettings>) {
+  AddressBalancerSettings result;
+  result.enabled = value["enabled"].As<bool>(result.enabled);
+  result.ejection_error_ratio =
+      value["ejection-error-ratio"].As<double>(result.ejection_error_ratio);
+  if (result.ejection_error_ratio <= 0 || result.ejection_error_ratio > 1) {
+    throw std::runtime_error("Invalid ejection-error-ratio value in " +
+                             value.GetPath());
+  }
+  result.ejection_window =
+      value["ejection-window"].As<std::size_t>(result.ejection_window);
+  if (result.ejection_window == 0) {
+    throw std::runtime_error("Invalid ejection-window value in " +
+                             value.GetPath());
+  }
+  result.ejection_time =
+      value["ejection-time"].As<std::chrono::milliseconds>(
+          result.ejection_time);
+  return result;
+}
+
+WarmPoolSettings Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<WarmPoolSettings>) {
+  WarmPoolSettings result;
+  result.url = value["url"].As<std::string>();
+  result.connections = value["connections"].As<std::size_t>(result.connections);
+  if (result.connections == 0) {
+    throw std::runtime_error("Invalid connections value in " +
+                             value.GetPath());
+  }
+  return result;
+}
+
+WarmPoolsSettings Parse(const yaml_config::YamlConfig& value,
+                        formats::parse::To<WarmPoolsSettings>) {
+  WarmPoolsSettings result;
+  result.destinations =
+      value["destinations"].As<std::vector<WarmPoolSettings>>(
+          result.destinations);
+  result.refresh_period = value["refresh-period"].As<std::chrono::milliseconds>(
+      result.refresh_period);
+  if (result.refresh_period <= std::chrono::milliseconds::zero()) {
+    throw std::runtime_error("Invalid refresh-period value in " +
+                             value.GetPath());
+  }
+  result.timeout =
+      value["timeout"].As<std::chrono::milliseconds>(result.timeout);
+  return result;
+}
+
+Http2Settings Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<Http2Settings>) {
+  Http2Settings result;
+  result.max_concurrent_streams =
+      value["max-concurrent-streams"].As<std::optional<std::size_t>>();
+  result.max_host_connections =
+      value["max-host-connections"].As<std::optional<std::size_t>>();
+  if (result.max_concurrent_streams == 0 || result.max_host_connections == 0) {
+    throw std::runtime_error("Invalid http2 limit value in " + value.GetPath());
+  }
+  return result;
+}
+
 ClientSettings Parse(const yaml_config::YamlConfig& value,
                      formats::parse::To<ClientSettings>) {
   ClientSettings result;
@@ -46,7 +112,15 @@ ClientSettings Parse(const yaml_config::YamlConfig& value,
       value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
   result.io_threads = value["threads"].As<size_t>(result.io_threads);
   result.defer_events = value["defer-events"].As<bool>(result.defer_events);
+  result.share_tls_sessions =
+      value["share-tls-sessions"].As<bool>(result.share_tls_sessions);
   result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+  result.address_balancing =
+      value["address-balancing"].As<AddressBalancerSettings>(
+          result.address_balancing);
+  result.warm_pools =
+      value["warm-pools"].As<WarmPoolsSettings>(result.warm_pools);
+  result.http2 = value["http2"].As<Http2Settings>(result.http2);
   return result;
 }
 
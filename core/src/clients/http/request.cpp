@@ -227,7 +227,19 @@ Request::Request(std::shared_ptr<impl::EasyWrapper>&& wrapper,
 }
 
 ResponseFuture Request::async_perform(utils::impl::SourceLocation location) {
-  return ResponseFuture{pimpl_->async_perform(location), pimpl_};
+  if (auto key = pimpl_->GetCoalescingKey()) {
+    auto coalesced = pimpl_->GetCoalescer().Join(std::move(*key), [&] {
+      auto hedge = pimpl_->CreateHedge(location);
+      return ResponseFuture{pimpl_->async_perform(location), pimpl_,
+                            std::move(hedge)};
+    });
+    return ResponseFuture{std::move(coalesced), pimpl_};
+  }
+
+  // The hedge copies the easy, so it is created before the request starts
+  auto hedge = pimpl_->CreateHedge(location);
+  return ResponseFuture{pimpl_->async_perform(location), pimpl_,
+                        std::move(hedge)};
 }
 
 StreamedResponse Request::async_perform_stream_body(
@@ -337,6 +349,24 @@ Request Request::retry(short retries, bool on_fails) && {
   return std::move(this->retry(retries, on_fails));
 }
 
+Request& Request::coalescing(const CoalescingSettings& settings) & {
+  pimpl_->coalescing(settings);
+  return *this;
+}
+Request Request::coalescing(const CoalescingSettings& settings) && {
+  return std::move(this->coalescing(settings));
+}
+
+Request& Request::hedging(const HedgingSettings& settings) & {
+  UASSERT_MSG(settings.delay >= std::chrono::milliseconds::zero(),
+              "negative hedging delay");
+  pimpl_->hedging(settings);
+  return *this;
+}
+Request Request::hedging(const HedgingSettings& settings) && {
+  return std::move(this->hedging(settings));
+}
+
 Request& Request::unix_socket_path(const std::string& path) & {
   pimpl_->unix_socket_path(path);
   return *this;
@@ -370,6 +400,7 @@ Request& Request::data(std::string data) & {
     pimpl_->easy().add_header(kHeaderExpect, "",
                               curl::easy::EmptyHeaderAction::kDoNotSend);
   pimpl_->easy().set_post_fields(std::move(data));
+  pimpl_->SetIsGetMethod(false);
   return *this;
 }
 Request Request::data(std::string data) && {
@@ -380,6 +411,7 @@ Request& Request::form(const Form& form) & {
   pimpl_->easy().set_http_post(form.GetNative());
   pimpl_->easy().add_header(kHeaderExpect, "",
                             curl::easy::EmptyHeaderAction::kDoNotSend);
+  pimpl_->SetIsGetMethod(false);
   return *this;
 }
 Request Request::form(const Form& form) && {
@@ -482,6 +514,7 @@ Request Request::cookies(
 }
 
 Request& Request::method(HttpMethod method) & {
+  pimpl_->SetIsGetMethod(method == HttpMethod::kGet);
   switch (method) {
     case HttpMethod::kDelete:
     case HttpMethod::kOptions:
@@ -535,6 +568,7 @@ Request& Request::set_custom_http_request_method(std::string method) & {
          "changing of request type. Use it only if you need to make "
          "GET-request with body.";
   pimpl_->easy().set_custom_request(method);
+  pimpl_->SetIsGetMethod(false);
   return *this;
 }
 Request Request::set_custom_http_request_method(std::string method) && {
@@ -0,0 +1,109 @@
+#include <userver/clients/http/request_batch.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <clients/http/request_state.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+std::exception_ptr MakeCancelledByBatchException() {
+  return std::make_exception_ptr(
+      CancelException("HTTP request was cancelled by the batch", {}));
+}
+
+}  // namespace
+
+bool RequestBatch::Result::IsSuccess() const noexcept {
+  if (!response) return false;
+  const auto code = static_cast<int>(response->status_code());
+  return code >= 200 && code < 300;
+}
+
+RequestBatch::RequestBatch(engine::Deadline deadline)
+    : deadline_(deadline), span_("http_batch") {}
+
+RequestBatch::~RequestBatch() {
+  CancelPending();
+  span_.AddTag("http_batch_size", futures_.size());
+  span_.AddTag("http_batch_successes", successes_);
+}
+
+std::size_t RequestBatch::Add(Request request) {
+  if (deadline_.IsReachable()) {
+    const auto time_left =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline_.TimeLeft());
+    if (request.pimpl_->timeout() > time_left.count()) {
+      request.timeout(std::max(time_left, std::chrono::milliseconds{1}));
+    }
+  }
+
+  futures_.push_back(request.async_perform());
+  results_.emplace_back();
+  return futures_.size() - 1;
+}
+
+void RequestBatch::WaitAll() {
+  while (finished_ < futures_.size() && WaitNext()) {
+  }
+  CancelPending();
+}
+
+bool RequestBatch::WaitQuorum(std::size_t quorum) {
+  UINVARIANT(quorum <= futures_.size(), "Quorum is more than the batch size");
+  while (successes_ < quorum &&
+         successes_ + (futures_.size() - finished_) >= quorum && WaitNext()) {
+  }
+  CancelPending();
+  return successes_ >= quorum;
+}
+
+bool RequestBatch::WaitNext() {
+  // The finished futures are invalid and are skipped by WaitAny
+  const auto index = engine::WaitAnyUntil(deadline_, futures_);
+  if (!index) {
+    if (engine::current_task::ShouldCancel()) {
+      CancelPending();
+      throw CancelException(
+          "HTTP batch wait was aborted due to task cancellation", {});
+    }
+    return false;
+  }
+  Collect(*index);
+  return true;
+}
+
+void RequestBatch::Collect(std::size_t index) {
+  auto& result = results_[index];
+  try {
+    result.response = futures_[index].Get();
+  } catch (const std::exception&) {
+    result.exception = std::current_exception();
+  }
+  ++finished_;
+  if (result.IsSuccess()) ++successes_;
+}
+
+void RequestBatch::CancelPending() {
+  for (std::size_t i = 0; i < futures_.size(); ++i) {
+    auto& result = results_[i];
+    if (result.response || result.exception) continue;
+    futures_[i].Cancel();
+    result.exception = MakeCancelledByBatchException();
+    ++finished_;
+  }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
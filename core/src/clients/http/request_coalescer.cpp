@@ -0,0 +1,115 @@
+#include <clients/http/request_coalescer.hpp>
+
+#include <utility>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// The transfer shared by the identical requests, the last of the requests
+/// that drops it cancels the transfer if it is not finished yet
+class CoalescedResponse::Transfer final {
+ public:
+  Transfer(RequestCoalescer& coalescer, std::string key, std::uint64_t id)
+      : coalescer_(coalescer), key_(std::move(key)), id_(id) {}
+
+  ~Transfer() { coalescer_.Erase(key_, id_); }
+
+  void Start(ResponseFuture&& future) {
+    task_ = engine::SharedAsyncNoSpan(
+        [&coalescer = coalescer_, key = key_, id = id_,
+         future = std::move(future)]() mutable {
+          // The new requests must not get the finished response
+          const utils::FastScopeGuard erase_guard(
+              [&]() noexcept { coalescer.Erase(key, id); });
+          return future.Get();
+        });
+  }
+
+  engine::SharedTaskWithResult<std::shared_ptr<Response>>& GetTask() noexcept {
+    return task_;
+  }
+
+ private:
+  RequestCoalescer& coalescer_;
+  const std::string key_;
+  const std::uint64_t id_;
+  engine::SharedTaskWithResult<std::shared_ptr<Response>> task_;
+};
+
+CoalescedResponse::CoalescedResponse(std::shared_ptr<Transfer> transfer,
+                                     std::atomic<std::size_t>& waiters) noexcept
+    : transfer_(std::move(transfer)), waiters_(waiters) {
+  ++waiters_;
+}
+
+CoalescedResponse::~CoalescedResponse() { --waiters_; }
+
+engine::FutureStatus CoalescedResponse::WaitUntil(engine::Deadline deadline) {
+  auto& task = transfer_->GetTask();
+  try {
+    task.WaitUntil(deadline);
+  } catch (const engine::WaitInterruptedException&) {
+    return engine::FutureStatus::kCancelled;
+  }
+  return task.IsFinished() ? engine::FutureStatus::kReady
+                           : engine::FutureStatus::kTimeout;
+}
+
+std::shared_ptr<Response> CoalescedResponse::Get() {
+  const auto& response = transfer_->GetTask().Get();
+  UASSERT(response);
+  return std::make_shared<Response>(*response);
+}
+
+engine::impl::ContextAccessor*
+CoalescedResponse::TryGetContextAccessor() noexcept {
+  return transfer_->GetTask().TryGetContextAccessor();
+}
+
+std::shared_ptr<CoalescedResponse> RequestCoalescer::Join(
+    std::string key, utils::function_ref<ResponseFuture()> perform) {
+  ++requests_;
+
+  // Declared before the lock as the destructor of the transfer locks the map
+  std::shared_ptr<CoalescedResponse::Transfer> transfer;
+
+  auto transfers = transfers_.Lock();
+  auto& entry = (*transfers)[key];
+  transfer = entry.transfer.lock();
+  if (transfer) {
+    ++hits_;
+    return std::make_shared<CoalescedResponse>(std::move(transfer), waiters_);
+  }
+
+  entry.id = ++next_id_;
+  transfer = std::make_shared<CoalescedResponse::Transfer>(
+      *this, std::move(key), entry.id);
+  entry.transfer = transfer;
+  // The identical requests wait on the lock until the transfer is started
+  transfer->Start(perform());
+  return std::make_shared<CoalescedResponse>(std::move(transfer), waiters_);
+}
+
+CoalescingStatistics RequestCoalescer::GetStatistics() const {
+  CoalescingStatistics stats;
+  stats.requests = requests_.Load();
+  stats.hits = hits_.Load();
+  stats.waiters = waiters_.load();
+  return stats;
+}
+
+void RequestCoalescer::Erase(const std::string& key,
+                             std::uint64_t id) noexcept {
+  auto transfers = transfers_.Lock();
+  const auto it = transfers->find(key);
+  if (it != transfers->end() && it->second.id == id) transfers->erase(it);
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
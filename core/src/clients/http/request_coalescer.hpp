@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include <userver/clients/http/response.hpp>
+#include <userver/clients/http/response_future.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/future_status.hpp>
+#include <userver/engine/task/shared_task_with_result.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <clients/http/statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief The response of a coalesced request, each of the identical requests
+/// gets its own copy of the Response.
+class CoalescedResponse final {
+ public:
+  class Transfer;
+
+  CoalescedResponse(std::shared_ptr<Transfer> transfer,
+                    std::atomic<std::size_t>& waiters) noexcept;
+  CoalescedResponse(const CoalescedResponse&) = delete;
+  CoalescedResponse& operator=(const CoalescedResponse&) = delete;
+  ~CoalescedResponse();
+
+  engine::FutureStatus WaitUntil(engine::Deadline deadline);
+
+  /// Returns a copy of the response or rethrows the error of the transfer
+  std::shared_ptr<Response> Get();
+
+  engine::impl::ContextAccessor* TryGetContextAccessor() noexcept;
+
+ private:
+  std::shared_ptr<Transfer> transfer_;
+  std::atomic<std::size_t>& waiters_;
+};
+
+/// @brief Shares one transfer between the identical in-flight requests of a
+/// client, see Request::coalescing().
+class RequestCoalescer final {
+ public:
+  /// Returns the response of the in-flight transfer with the same key, or
+  /// starts a new transfer with `perform` if there is none.
+  std::shared_ptr<CoalescedResponse> Join(
+      std::string key, utils::function_ref<ResponseFuture()> perform);
+
+  CoalescingStatistics GetStatistics() const;
+
+ private:
+  friend class CoalescedResponse::Transfer;
+
+  struct Entry {
+    std::weak_ptr<CoalescedResponse::Transfer> transfer;
+    std::uint64_t id{0};
+  };
+
+  void Erase(const std::string& key, std::uint64_t id) noexcept;
+
+  concurrent::Variable<std::unordered_map<std::string, Entry>> transfers_;
+  std::atomic<std::uint64_t> next_id_{0};
+
+  utils::statistics::RateCounter requests_;
+  utils::statistics::RateCounter hits_;
+  std::atomic<std::size_t> waiters_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -337,6 +337,91 @@ void RequestState::retry(short retries, bool on_fails) {
   retry_.on_fails = on_fails;
 }
 
+void RequestState::hedging(const HedgingSettings& settings) {
+  hedging_ = settings;
+}
+
+std::shared_ptr<RequestState> RequestState::CreateHedge(
+    utils::impl::SourceLocation location) {
+  if (!hedging_) return {};
+  auto wrapper = easy_->Clone();
+  if (!wrapper) return {};
+
+  auto hedge = std::make_shared<RequestState>(
+      std::move(wrapper), stats_->CreateSibling(), dest_stats_, resolver_,
+      plugin_pipeline_, *tracing_manager_);
+  if (is_reply_decoding_disabled_) hedge->DisableReplyDecoding();
+  if (ca_ || cert_) {
+    // Legacy certificates setup, see ca() and client_key_cert()
+    hedge->ca_ = ca_;
+    hedge->cert_ = cert_;
+    hedge->pkey_ = pkey_;
+    hedge->easy().set_ssl_ctx_data(hedge.get());
+  }
+  hedge->original_timeout_ = original_timeout_;
+  hedge->remote_timeout_ = remote_timeout_;
+  hedge->retry_.retries = retry_.retries;
+  hedge->retry_.on_fails = retry_.on_fails;
+  hedge->deadline_propagation_config_ = deadline_propagation_config_;
+  hedge->headers_propagator_ = headers_propagator_;
+  hedge->testsuite_config_ = testsuite_config_;
+  hedge->allowed_urls_extra_ = allowed_urls_extra_;
+  hedge->destination_metric_name_ = destination_metric_name_;
+  if (dest_req_stats_) {
+    hedge->dest_req_stats_ = dest_req_stats_->CreateSibling();
+  }
+  hedge->proxy_url_ = proxy_url_;
+  hedge->log_url_ = log_url_;
+  hedge->has_user_connect_to_ = has_user_connect_to_;
+  if (balanced_connect_to_) {
+    // The list is owned by this request, the hedge picks its own address
+    hedge->easy().set_connect_to(nullptr);
+  }
+  hedge->hedge_location_ = location;
+  return hedge;
+}
+
+void RequestState::coalescing(const CoalescingSettings& settings) {
+  coalescing_ = settings;
+}
+
+std::optional<std::string> RequestState::GetCoalescingKey() const {
+  if (!coalescing_ || !is_get_method_) return std::nullopt;
+
+  std::string key = easy().get_original_url();
+  for (const auto& name : coalescing_->key_headers) {
+    key += '\n';
+    key += name;
+    key += ':';
+    if (const auto value = easy().FindHeaderByName(name)) key += *value;
+  }
+  return key;
+}
+
+RequestCoalescer& RequestState::GetCoalescer() noexcept {
+  return easy_->GetCoalescer();
+}
+
+engine::Future<std::shared_ptr<Response>> RequestState::async_perform_hedge() {
+  UASSERT(hedge_location_);
+  return async_perform(*hedge_location_);
+}
+
+std::optional<std::chrono::milliseconds> RequestState::GetHedgingDelay()
+    const {
+  if (!hedging_) return std::nullopt;
+  if (hedging_->delay_percentile && dest_req_stats_) {
+    const auto percentile =
+        dest_req_stats_->GetRecentTimingPercentile(*hedging_->delay_percentile);
+    if (percentile) return percentile;
+  }
+  return hedging_->delay;
+}
+
+utils::RetryBudget& RequestState::GetHedgingBudget() noexcept {
+  return easy_->GetHedgingBudget();
+}
+
 void RequestState::unix_socket_path(const std::string& path) {
   easy().set_unix_socket_path(path);
 }
@@ -345,6 +430,7 @@ void RequestState::connect_to(const ConnectTo& connect_to) {
   curl::native::curl_slist* ptr = connect_to.GetUnderlying();
   if (ptr) {
     easy().set_connect_to(ptr);
+    has_user_connect_to_ = true;
   }
 }
 
@@ -390,6 +476,7 @@ void RequestState::SetAllowedUrlsExtra(const std::vector<std::string>& urls) {
 
 void RequestState::DisableReplyDecoding() {
   easy().set_accept_encoding(nullptr);
+  is_reply_decoding_disabled_ = true;
 }
 
 void RequestState::SetDeadlinePropagationConfig(
@@ -466,6 +553,8 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder,
   }
 
   holder->AccountResponse(err);
+  // The address is not busy with the request any more
+  holder->balanced_address_ = {};
   const auto sockets = easy.get_num_connects();
   holder->WithRequestStats(
       [sockets](RequestStats& stats) { stats.AccountOpenSockets(sockets); });
@@ -623,6 +712,7 @@ void RequestState::parse_header(char* ptr, size_t size) try {
         LOG_INFO() << "drop header " << k << "=" << v;
       // In case of redirect drop 1st response headers
       response_->headers().clear();
+      AccountTlsHandshake();
     }
     return;
   }
@@ -649,6 +739,20 @@ void RequestState::parse_header(char* ptr, size_t size) try {
   LOG_ERROR() << "Failed to parse header: " << e.what();
 }
 
+void RequestState::AccountTlsHandshake() {
+  // The status line is the first point where the TLS connection of the new
+  // response is established and is still alive
+  const auto connects = easy().get_num_connects();
+  if (connects <= tls_accounted_connects_) return;
+  tls_accounted_connects_ = connects;
+
+  const auto resumed = easy().get_tls_session_resumed();
+  if (!resumed) return;
+  WithRequestStats([resumed = *resumed](RequestStats& stats) {
+    stats.AccountTlsHandshake(resumed);
+  });
+}
+
 void RequestState::SetLoggedUrl(std::string url) { log_url_ = std::move(url); }
 
 const std::string& RequestState::GetLoggedOriginalUrl() const noexcept {
@@ -713,6 +817,7 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
   UASSERT(response_);
   response_->sink_string().clear();
   response_->body().clear();
+  tls_accounted_connects_ = 0;
 
   UpdateTimeoutHeader();
 
@@ -890,6 +995,28 @@ void RequestState::AccountResponse(std::error_code err) {
     else
       stats.FinishOk(static_cast<int>(easy().get_response_code()), attempts);
   });
+
+  if (!err &&
+      easy().get_http_version() == curl::native::CURL_HTTP_VERSION_2_0) {
+    // A new connection is waited until it is established, an established one
+    // until the request is sent over one of its free streams
+    const bool new_connection = easy().get_num_connects() > 0;
+    const auto wait_us =
+        new_connection ? std::max(easy().get_appconnect_time_usec(),
+                                  easy().get_connect_time_usec())
+                       : easy().get_pretransfer_time_usec();
+    WithRequestStats([new_connection, wait_us](RequestStats& stats) {
+      stats.AccountHttp2Stream(new_connection,
+                               std::chrono::microseconds{wait_us});
+    });
+  }
+
+  if (balanced_address_) {
+    const bool is_error = err || easy().get_response_code() >= 500;
+    dest_stats_->GetAddressBalancer().AccountAttempt(
+        balanced_address_,
+        std::chrono::microseconds{easy().get_total_time_usec()}, is_error);
+  }
 }
 
 std::exception_ptr RequestState::PrepareException(std::error_code err) {
@@ -1016,6 +1143,7 @@ void RequestState::StartNewSpan(utils::impl::SourceLocation location) {
   plugin_pipeline_.HookCreateSpan(*this);
   span.AddTag(tracing::kHttpUrl, GetLoggedOriginalUrl());
   span.AddTag(tracing::kMaxAttempts, retry_.retries);
+  if (hedge_location_) span.AddTag("hedge", 1);
 
   // Span is local to a Request, it is not related to current coroutine
   span.DetachFromCoroStack();
@@ -1047,14 +1175,45 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
   if (hostname.find(':') != std::string::npos) return;
 
   const auto addrs = resolver.Resolve(hostname, deadline);
+  const std::string port = target.Get().GetPortPtr().get();
+  if (BalanceTargetAddress(hostname, port, addrs)) return;
+
   auto addr_strings =
       addrs | boost::adaptors::transformed(
                   [](const auto& addr) { return addr.PrimaryAddressString(); });
 
-  easy().add_resolve(hostname, target.Get().GetPortPtr().get(),
+  easy().add_resolve(hostname, port,
                      fmt::to_string(fmt::join(addr_strings, ",")));
 }
 
+bool RequestState::BalanceTargetAddress(const std::string& hostname,
+                                        const std::string& port,
+                                        const clients::dns::AddrVector& addrs) {
+  // CURLOPT_CONNECT_TO is not applied to the proxy connections
+  if (!proxy_url_.empty() || has_user_connect_to_) return false;
+
+  balanced_address_ = dest_stats_->GetAddressBalancer().Pick(addrs);
+  if (!balanced_address_) {
+    if (balanced_connect_to_) {
+      easy().set_connect_to(nullptr);
+      balanced_connect_to_.reset();
+    }
+    return false;
+  }
+
+  const auto& addr = balanced_address_.GetAddress();
+  auto addr_string = addr.PrimaryAddressString();
+  if (addr.Domain() == engine::io::AddrDomain::kInet6) {
+    addr_string = fmt::format("[{}]", addr_string);
+  }
+  // Unlike CURLOPT_RESOLVE, the connections to the different addresses of the
+  // host are not reused for each other
+  balanced_connect_to_.emplace(
+      fmt::format("{}:{}:{}:", hostname, port, addr_string));
+  easy().set_connect_to(balanced_connect_to_->GetUnderlying());
+  return true;
+}
+
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) {
   tracing_manager_ = m;
 }
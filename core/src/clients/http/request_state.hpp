@@ -7,10 +7,13 @@
 #include <string>
 #include <system_error>
 
+#include <userver/clients/dns/common.hpp>
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
 #include <userver/clients/http/plugin.hpp>
+#include <userver/clients/http/request.hpp>
 #include <userver/clients/http/request_tracing_editor.hpp>
 #include <userver/clients/http/response_future.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -25,9 +28,11 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/not_null.hpp>
+#include <userver/utils/retry_budget.hpp>
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/request_coalescer.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
@@ -39,7 +44,6 @@ USERVER_NAMESPACE_BEGIN
 namespace clients::http {
 
 class StreamedResponse;
-class ConnectTo;
 
 class RequestState : public std::enable_shared_from_this<RequestState> {
  public:
@@ -82,6 +86,12 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void set_timeout(long timeout_ms);
   /// set number of retries
   void retry(short retries, bool on_fails);
+  /// enable hedging
+  void hedging(const HedgingSettings& settings);
+  /// enable coalescing of the identical requests
+  void coalescing(const CoalescingSettings& settings);
+  /// whether the request is a GET, data() and form() make it a POST
+  void SetIsGetMethod(bool is_get) noexcept { is_get_method_ = is_get; }
   /// set unix socket as transport instead of TCP
   void unix_socket_path(const std::string& path);
   /// set connect_to option
@@ -99,6 +109,22 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   /// get retries count
   short retries() const { return retry_.retries; }
 
+  /// Returns a not started copy of the request for the hedged attempt, or
+  /// nullptr if hedging is disabled or the request can not be copied. Must be
+  /// called before async_perform().
+  std::shared_ptr<RequestState> CreateHedge(
+      utils::impl::SourceLocation location);
+  /// Performs the copy returned by CreateHedge()
+  engine::Future<std::shared_ptr<Response>> async_perform_hedge();
+  /// The delay of the hedged attempt, std::nullopt if hedging is disabled
+  std::optional<std::chrono::milliseconds> GetHedgingDelay() const;
+  utils::RetryBudget& GetHedgingBudget() noexcept;
+
+  /// The key of the identical requests, std::nullopt if the request is not
+  /// coalesced
+  std::optional<std::string> GetCoalescingKey() const;
+  RequestCoalescer& GetCoalescer() noexcept;
+
   engine::Deadline GetDeadline() const noexcept;
   /// true iff *we detected* that the deadline has expired
   bool IsDeadlineExpired() const noexcept;
@@ -148,6 +174,8 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   /// parse one header
   void parse_header(char* ptr, size_t size);
+  /// Accounts the TLS handshake of a new connection, if any
+  void AccountTlsHandshake();
   void ParseSingleCookie(const char* ptr, size_t size);
   /// simply run perform_request if there is now errors from timer
   void on_retry_timer(std::error_code err);
@@ -180,6 +208,9 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
   void WithRequestStats(const Func& func);
 
   void ResolveTargetAddress(clients::dns::Resolver& resolver);
+  bool BalanceTargetAddress(const std::string& hostname,
+                            const std::string& port,
+                            const clients::dns::AddrVector& addrs);
 
   /// curl handler wrapper
   std::shared_ptr<impl::EasyWrapper> easy_;
@@ -212,6 +243,15 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   utils::NotNull<const tracing::TracingManagerBase*> tracing_manager_;
   const server::http::HeadersPropagator* headers_propagator_{nullptr};
+  bool is_reply_decoding_disabled_{false};
+
+  std::optional<HedgingSettings> hedging_;
+  /// set for the hedged attempts
+  std::optional<utils::impl::SourceLocation> hedge_location_;
+
+  std::optional<CoalescingSettings> coalescing_;
+  bool is_get_method_{true};
+
   /// struct for reties
   struct {
     /// maximum number of retries
@@ -232,6 +272,13 @@ class RequestState : public std::enable_shared_from_this<RequestState> {
 
   clients::dns::Resolver* resolver_{nullptr};
   std::string proxy_url_;
+
+  bool has_user_connect_to_{false};
+  /// address picked by the AddressBalancer and the CONNECT_TO list for it
+  AddressBalancer::Lease balanced_address_;
+  std::optional<ConnectTo> balanced_connect_to_;
+  /// connections of the current attempt with the accounted TLS handshake
+  long tls_accounted_connects_{0};
   impl::PluginPipeline& plugin_pipeline_;
 
   struct StreamData {
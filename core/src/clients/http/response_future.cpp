@@ -2,7 +2,10 @@
 
 #include <algorithm>
 
+#include <clients/http/request_coalescer.hpp>
 #include <clients/http/request_state.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/wait_any.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
 
@@ -40,21 +43,51 @@ engine::Deadline ComputeBaseDeadline(RequestState& request_state) {
 
 ResponseFuture::ResponseFuture(
     engine::Future<std::shared_ptr<Response>>&& future,
-    std::shared_ptr<RequestState> request_state)
+    std::shared_ptr<RequestState> request_state,
+    std::shared_ptr<RequestState> hedge)
     : future_(std::move(future)),
       deadline_(ComputeBaseDeadline(*request_state)),
-      request_state_(std::move(request_state)) {
+      request_state_(std::move(request_state)),
+      hedge_state_(std::move(hedge)) {
   const auto propagated_deadline = request_state_->GetDeadline();
   if (propagated_deadline < deadline_) {
     deadline_ = propagated_deadline;
     was_deadline_propagated_ = true;
   }
+
+  if (hedge_state_) {
+    const auto delay = request_state_->GetHedgingDelay();
+    UASSERT(delay);
+    hedge_deadline_ = engine::Deadline::FromDuration(*delay);
+    // There is no time left for the hedged attempt
+    if (!(hedge_deadline_ < deadline_)) hedge_state_.reset();
+  }
+}
+
+ResponseFuture::ResponseFuture(std::shared_ptr<CoalescedResponse> coalesced,
+                               std::shared_ptr<RequestState> request_state)
+    : deadline_(ComputeBaseDeadline(*request_state)),
+      request_state_(std::move(request_state)),
+      coalesced_(std::move(coalesced)) {
+  UASSERT(coalesced_);
+  // The request itself is not performed, so its deadline is not set
+  const auto propagated_deadline =
+      server::request::GetTaskInheritedDeadline();
+  if (propagated_deadline < deadline_) {
+    deadline_ = propagated_deadline;
+    was_deadline_propagated_ = true;
+  }
 }
 
 ResponseFuture::ResponseFuture(ResponseFuture&& other) noexcept {
   std::swap(future_, other.future_);
   std::swap(deadline_, other.deadline_);
   std::swap(request_state_, other.request_state_);
+  std::swap(was_deadline_propagated_, other.was_deadline_propagated_);
+  std::swap(hedge_state_, other.hedge_state_);
+  std::swap(hedge_future_, other.hedge_future_);
+  std::swap(hedge_deadline_, other.hedge_deadline_);
+  std::swap(coalesced_, other.coalesced_);
 }
 
 ResponseFuture& ResponseFuture::operator=(ResponseFuture&& other) noexcept {
@@ -64,25 +97,36 @@ ResponseFuture& ResponseFuture::operator=(ResponseFuture&& other) noexcept {
   deadline_ = other.deadline_;
   request_state_ = std::move(other.request_state_);
   was_deadline_propagated_ = other.was_deadline_propagated_;
+  hedge_state_ = std::move(other.hedge_state_);
+  hedge_future_ = std::move(other.hedge_future_);
+  hedge_deadline_ = other.hedge_deadline_;
+  coalesced_ = std::move(other.coalesced_);
   return *this;
 }
 
 ResponseFuture::~ResponseFuture() { Cancel(); }
 
 void ResponseFuture::Cancel() {
-  if (request_state_) {
+  // The coalesced transfer is cancelled when all of its requests are gone
+  if (request_state_ && !coalesced_) {
     request_state_->Cancel();
   }
+  if (hedge_future_.valid()) {
+    hedge_state_->Cancel();
+  }
   Detach();
 }
 
 void ResponseFuture::Detach() {
   future_ = {};
   request_state_.reset();
+  hedge_future_ = {};
+  hedge_state_.reset();
+  coalesced_.reset();
 }
 
 std::future_status ResponseFuture::Wait() {
-  switch (future_.wait_until(deadline_)) {
+  switch (WaitForResponse()) {
     case engine::FutureStatus::kCancelled: {
       const auto stats = request_state_->easy().get_local_stats();
 
@@ -117,7 +161,7 @@ std::shared_ptr<Response> ResponseFuture::Get() {
     if (request_state_->IsDeadlineExpired()) {
       server::request::MarkTaskInheritedDeadlineExpired();
     }
-    auto response = future_.get();
+    auto response = coalesced_ ? coalesced_->Get() : future_.get();
     Detach();
     return response;
   }
@@ -125,9 +169,49 @@ std::shared_ptr<Response> ResponseFuture::Get() {
   throw TimeoutException("Future timeout", {});  // no local stats available
 }
 
+engine::FutureStatus ResponseFuture::WaitForResponse() {
+  if (coalesced_) return coalesced_->WaitUntil(deadline_);
+  if (!hedge_state_) return future_.wait_until(deadline_);
+
+  auto& budget = request_state_->GetHedgingBudget();
+  if (!hedge_future_.valid()) {
+    const auto status = future_.wait_until(hedge_deadline_);
+    if (status != engine::FutureStatus::kTimeout) {
+      if (status == engine::FutureStatus::kReady) budget.AccountOk();
+      hedge_state_.reset();
+      return status;
+    }
+    if (!budget.CanRetry()) {
+      hedge_state_.reset();
+      return future_.wait_until(deadline_);
+    }
+    // Each hedged attempt spends a token, the requests that are fast enough
+    // return a part of it
+    budget.AccountFail();
+    hedge_future_ = hedge_state_->async_perform_hedge();
+  }
+
+  const auto ready = engine::WaitAnyUntil(deadline_, future_, hedge_future_);
+  if (!ready) {
+    return engine::current_task::ShouldCancel()
+               ? engine::FutureStatus::kCancelled
+               : engine::FutureStatus::kTimeout;
+  }
+  if (*ready == 1) {
+    std::swap(future_, hedge_future_);
+    std::swap(request_state_, hedge_state_);
+  }
+  // The loser is removed from the multi
+  hedge_state_->Cancel();
+  hedge_state_.reset();
+  hedge_future_ = {};
+  return engine::FutureStatus::kReady;
+}
+
 engine::impl::ContextAccessor*
 ResponseFuture::TryGetContextAccessor() noexcept {
-  return future_.TryGetContextAccessor();
+  return coalesced_ ? coalesced_->TryGetContextAccessor()
+                    : future_.TryGetContextAccessor();
 }
 
 }  // namespace clients::http
@@ -62,6 +62,24 @@ void RequestStats::AccountOpenSockets(size_t sockets) noexcept {
   stats_.socket_open_ += utils::statistics::Rate{sockets};
 }
 
+void RequestStats::AccountTlsHandshake(bool resumed) noexcept {
+  ++stats_.tls_handshakes_;
+  if (resumed) ++stats_.tls_resumed_handshakes_;
+}
+
+void RequestStats::AccountHttp2Stream(
+    bool new_connection, std::chrono::microseconds wait_time) noexcept {
+  ++stats_.http2_streams_;
+  const auto wait_us =
+      static_cast<utils::statistics::Rate::ValueType>(wait_time.count());
+  if (new_connection) {
+    ++stats_.http2_new_connections_;
+    stats_.http2_connection_wait_us_.Add(utils::statistics::Rate{wait_us});
+  } else {
+    stats_.http2_stream_wait_us_.Add(utils::statistics::Rate{wait_us});
+  }
+}
+
 void RequestStats::AccountTimeoutUpdatedByDeadline() noexcept {
   ++stats_.timeout_updated_by_deadline_;
 }
@@ -70,6 +88,17 @@ void RequestStats::AccountCancelledByDeadline() noexcept {
   ++stats_.cancelled_by_deadline_;
 }
 
+std::shared_ptr<RequestStats> RequestStats::CreateSibling() const {
+  return stats_.CreateRequestStats();
+}
+
+std::optional<std::chrono::milliseconds>
+RequestStats::GetRecentTimingPercentile(double percent) const {
+  const auto& timings = stats_.timings_percentile_.GetPreviousCounter(1);
+  if (timings.Count() == 0) return std::nullopt;
+  return std::chrono::milliseconds{timings.GetPercentile(percent)};
+}
+
 Statistics::ErrorGroup Statistics::ErrorCodeToGroup(std::error_code ec) {
   using ErrorCode = curl::errc::EasyErrorCode;
 
@@ -161,6 +190,14 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
 
   writer["sockets"]["open"] = stats.multi.socket_open;
+
+  writer["tls"]["handshakes"] = stats.tls_handshakes;
+  writer["tls"]["resumed-handshakes"] = stats.tls_resumed_handshakes;
+
+  writer["http2"]["streams"] = stats.http2_streams;
+  writer["http2"]["new-connections"] = stats.http2_new_connections;
+  writer["http2"]["connection-wait-us"] = stats.http2_connection_wait_us;
+  writer["http2"]["stream-wait-us"] = stats.http2_stream_wait_us;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -181,6 +218,20 @@ void DumpMetric(utils::statistics::Writer& writer,
       stats.multi.socket_open.value - stats.multi.socket_close.value};
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const WarmPoolStatistics& stats) {
+  writer["target"] = stats.target;
+  writer["warm"] = stats.warm;
+  writer["errors"] = stats.errors;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const CoalescingStatistics& stats) {
+  writer["requests"] = stats.requests;
+  writer["hits"] = stats.hits;
+  writer["waiters"] = stats.waiters;
+}
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const PoolStatistics& stats) {
   InstanceStatistics sum_stats;
@@ -190,6 +241,9 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 
   writer.ValueWithLabels(sum_stats, {"version", "2"});
+
+  if (stats.warm_pool.target != 0) writer["warm-pool"] = stats.warm_pool;
+  writer["coalescing"] = stats.coalescing;
 }
 
 InstanceStatistics::InstanceStatistics(const Statistics& other)
@@ -199,6 +253,12 @@ InstanceStatistics::InstanceStatistics(const Statistics& other)
       retries(other.retries_.Load()),
       timeout_updated_by_deadline(other.timeout_updated_by_deadline_.Load()),
       cancelled_by_deadline(other.cancelled_by_deadline_.Load()),
+      tls_handshakes(other.tls_handshakes_.Load()),
+      tls_resumed_handshakes(other.tls_resumed_handshakes_.Load()),
+      http2_streams(other.http2_streams_.Load()),
+      http2_new_connections(other.http2_new_connections_.Load()),
+      http2_connection_wait_us(other.http2_connection_wait_us_.Load()),
+      http2_stream_wait_us(other.http2_stream_wait_us_.Load()),
       reply_status(other.reply_status_) {
   for (size_t i = 0; i < error_count.size(); i++)
     error_count[i] = other.error_count_[i].Load();
@@ -233,6 +293,12 @@ InstanceStatistics& InstanceStatistics::operator+=(
 
   timeout_updated_by_deadline += stat.timeout_updated_by_deadline;
   cancelled_by_deadline += stat.cancelled_by_deadline;
+  tls_handshakes += stat.tls_handshakes;
+  tls_resumed_handshakes += stat.tls_resumed_handshakes;
+  http2_streams += stat.http2_streams;
+  http2_new_connections += stat.http2_new_connections;
+  http2_connection_wait_us += stat.http2_connection_wait_us;
+  http2_stream_wait_us += stat.http2_stream_wait_us;
   reply_status += stat.reply_status;
 
   multi += stat.multi;
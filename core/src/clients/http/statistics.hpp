@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -35,6 +36,21 @@ class RequestStats final {
   void AccountTimeoutUpdatedByDeadline() noexcept;
   void AccountCancelledByDeadline() noexcept;
 
+  void AccountTlsHandshake(bool resumed) noexcept;
+
+  /// Accounts an attempt performed over HTTP/2 with the time it waited for a
+  /// new connection or for a free stream of an established one
+  void AccountHttp2Stream(bool new_connection,
+                          std::chrono::microseconds wait_time) noexcept;
+
+  // Stats of another request to the same destination, e.g. of a hedge
+  std::shared_ptr<RequestStats> CreateSibling() const;
+
+  // The percentile of the timings of the previous statistics epoch,
+  // std::nullopt if there were no requests
+  std::optional<std::chrono::milliseconds> GetRecentTimingPercentile(
+      double percent) const;
+
  private:
   void StoreTiming() noexcept;
 
@@ -103,6 +119,12 @@ class Statistics {
   utils::statistics::RateCounter socket_open_{0};
   utils::statistics::RateCounter timeout_updated_by_deadline_;
   utils::statistics::RateCounter cancelled_by_deadline_;
+  utils::statistics::RateCounter tls_handshakes_;
+  utils::statistics::RateCounter tls_resumed_handshakes_;
+  utils::statistics::RateCounter http2_streams_;
+  utils::statistics::RateCounter http2_new_connections_;
+  utils::statistics::RateCounter http2_connection_wait_us_;
+  utils::statistics::RateCounter http2_stream_wait_us_;
   utils::statistics::HttpCodes reply_status_;
 
   friend struct InstanceStatistics;
@@ -130,13 +152,38 @@ struct InstanceStatistics {
 
   utils::statistics::Rate timeout_updated_by_deadline;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate tls_handshakes;
+  utils::statistics::Rate tls_resumed_handshakes;
+  utils::statistics::Rate http2_streams;
+  utils::statistics::Rate http2_new_connections;
+  utils::statistics::Rate http2_connection_wait_us;
+  utils::statistics::Rate http2_stream_wait_us;
   utils::statistics::HttpCodes::Snapshot reply_status;
 
   MultiStats multi;
 };
 
+struct WarmPoolStatistics {
+  /// connections to keep established, 0 if no warm pools are configured
+  std::size_t target{0};
+  /// connections established by the last warm-up round
+  std::size_t warm{0};
+  utils::statistics::Rate errors;
+};
+
+struct CoalescingStatistics {
+  /// requests with the coalescing enabled, see Request::coalescing()
+  utils::statistics::Rate requests;
+  /// requests that joined an identical in-flight request
+  utils::statistics::Rate hits;
+  /// requests waiting for a coalesced response right now
+  std::size_t waiters{0};
+};
+
 struct PoolStatistics {
   std::vector<InstanceStatistics> multi;
+  WarmPoolStatistics warm_pool;
+  CoalescingStatistics coalescing;
 };
 
 struct DestinationStatisticsView {
@@ -149,6 +196,12 @@ void DumpMetric(utils::statistics::Writer& writer,
 void DumpMetric(utils::statistics::Writer& writer,
                 const InstanceStatistics& stats);
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const WarmPoolStatistics& stats);
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const CoalescingStatistics& stats);
+
 void DumpMetric(utils::statistics::Writer& writer, const PoolStatistics& stats);
 
 }  // namespace clients::http
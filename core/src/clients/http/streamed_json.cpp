@@ -0,0 +1,38 @@
+#include <userver/clients/http/streamed_json.hpp>
+
+#include <userver/clients/http/error.hpp>
+#include <userver/formats/json/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace impl {
+
+StreamedChunkReader::StreamedChunkReader(StreamedResponse& response,
+                                         engine::Deadline deadline)
+    : response_(response), deadline_(deadline) {}
+
+std::string_view StreamedChunkReader::operator()() {
+  while (response_.ReadChunk(chunk_, deadline_)) {
+    // An empty chunk marks the end of input for the parsers
+    if (!chunk_.empty()) return chunk_;
+  }
+
+  if (deadline_.IsReached()) {
+    throw TimeoutException("Timeout on reading the streamed JSON body", {});
+  }
+  return {};
+}
+
+}  // namespace impl
+
+formats::json::Value ReadStreamedJson(StreamedResponse& response,
+                                      engine::Deadline deadline) {
+  impl::StreamedChunkReader reader{response, deadline};
+  return formats::json::FromChunks(reader);
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include <userver/fs/blocking/temp_directory.hpp>  // for fs::blocking::TempDirectory
 #include <userver/fs/blocking/write.hpp>  // for fs::blocking::RewriteFileContents
 #include <userver/server/handlers/ping.hpp>
+#include <userver/server/handlers/task_profiler.hpp>
 
 #include <components/component_list_test.hpp>
 #include <userver/internal/net/net_listener.hpp>
@@ -225,6 +226,13 @@ components_manager:
         method: GET,PUT,DELETE
         task_processor: monitor-task-processor
 # /// [Sample handler dynamic debug log component config]
+# /// [Sample handler task profiler component config]
+# yaml
+    handler-task-profiler:
+        path: /service/task-profiler
+        method: GET,DELETE
+        task_processor: monitor-task-processor
+# /// [Sample handler task profiler component config]
 config_vars: )";
 
 struct ServicePorts final {
@@ -285,7 +293,8 @@ TEST_F(CommonServerComponentList, Smoke) {
                                  GetConfigVarsPath()},
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
-          .Append<server::handlers::Ping>());
+          .Append<server::handlers::Ping>()
+          .Append<server::handlers::TaskProfiler>());
 }
 
 TEST_F(CommonServerComponentList, TraceLogging) {
@@ -300,7 +309,8 @@ TEST_F(CommonServerComponentList, TraceLogging) {
                                  GetConfigVarsPath()},
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
-          .Append<server::handlers::Ping>());
+          .Append<server::handlers::Ping>()
+          .Append<server::handlers::TaskProfiler>());
 }
 
 TEST_F(CommonServerComponentList, NullLogging) {
@@ -315,7 +325,8 @@ TEST_F(CommonServerComponentList, NullLogging) {
                                  GetConfigVarsPath()},
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
-          .Append<server::handlers::Ping>());
+          .Append<server::handlers::Ping>()
+          .Append<server::handlers::TaskProfiler>());
 }
 
 TEST_F(CommonServerComponentList, BlockingDefaultLogger) {
@@ -330,7 +341,8 @@ TEST_F(CommonServerComponentList, BlockingDefaultLogger) {
   const auto component_list =
       components::CommonComponentList()
           .AppendComponentList(components::CommonServerComponentList())
-          .Append<server::handlers::Ping>();
+          .Append<server::handlers::Ping>()
+          .Append<server::handlers::TaskProfiler>();
   UEXPECT_THROW_MSG(components::RunOnce(config, component_list), std::exception,
                     "efault logger");
 }
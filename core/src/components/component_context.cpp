@@ -30,6 +30,10 @@ impl::ComponentBase* ComponentContext::AddComponent(
   return impl_->AddComponent(name, factory, *this);
 }
 
+void ComponentContext::ReportStartupProfile() const {
+  impl_->ReportStartupProfile();
+}
+
 void ComponentContext::OnAllComponentsLoaded() {
   impl_->OnAllComponentsLoaded();
 }
@@ -149,6 +149,34 @@ std::string ComponentInfo::GetDependencies() const {
                      fmt::join(it_depends_on_, delimiter));
 }
 
+void ComponentInfo::SetLoadTimes(std::chrono::steady_clock::time_point start,
+                                 std::chrono::steady_clock::time_point finish) {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  load_start_ = start;
+  load_finish_ = finish;
+}
+
+void ComponentInfo::AddDependencyWaiting(
+    std::chrono::steady_clock::duration waiting) {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  load_waiting_ += waiting;
+}
+
+std::optional<ComponentLoadProfile> ComponentInfo::GetLoadProfile() const {
+  std::lock_guard<engine::Mutex> lock(mutex_);
+  if (load_finish_ == std::chrono::steady_clock::time_point{}) {
+    return std::nullopt;
+  }
+
+  ComponentLoadProfile profile{name_, load_start_, load_finish_, load_waiting_,
+                               {}};
+  profile.dependencies.reserve(it_depends_on_.size());
+  for (const auto& dependency : it_depends_on_) {
+    profile.dependencies.emplace_back(dependency.StringViewName());
+  }
+  return profile;
+}
+
 bool ComponentInfo::HasComponent() const {
   std::lock_guard<engine::Mutex> lock(mutex_);
   return !!component_;
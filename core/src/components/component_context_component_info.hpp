@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 
@@ -10,6 +12,7 @@
 #include <userver/engine/mutex.hpp>
 
 #include "impl/component_name_from_info.hpp"
+#include "startup_profile.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -72,6 +75,11 @@ class ComponentInfo final {
 
   std::string GetDependencies() const;
 
+  void SetLoadTimes(std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point finish);
+  void AddDependencyWaiting(std::chrono::steady_clock::duration waiting);
+  std::optional<ComponentLoadProfile> GetLoadProfile() const;
+
  private:
   bool HasComponent() const;
   std::unique_ptr<ComponentBase> ExtractComponent();
@@ -92,6 +100,10 @@ class ComponentInfo final {
   ComponentLifetimeStage stage_ = ComponentLifetimeStage::kNull;
   bool stage_switching_cancelled_{false};
   std::atomic<bool> on_loading_cancelled_called_{false};
+
+  std::chrono::steady_clock::time_point load_start_;
+  std::chrono::steady_clock::time_point load_finish_;
+  std::chrono::steady_clock::duration load_waiting_{};
 };
 
 }  // namespace components::impl
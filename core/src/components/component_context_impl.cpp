@@ -1,6 +1,7 @@
 #include <components/component_context_impl.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <queue>
 
 #include <fmt/format.h>
@@ -8,6 +9,7 @@
 #include <userver/compiler/demangle.hpp>
 #include <userver/concurrent/variable.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
@@ -16,6 +18,8 @@
 #include <components/component_context_component_info.hpp>
 #include <components/impl/component_name_from_info.hpp>
 #include <components/manager.hpp>
+#include <components/manager_config.hpp>
+#include <components/startup_profile.hpp>
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -117,7 +121,10 @@ impl::ComponentBase* ComponentContext::Impl::AddComponent(
     throw std::runtime_error("trying to add component " + std::string{name} +
                              " multiple times");
 
-  component_info.SetComponent(factory(context));
+  const auto load_start = std::chrono::steady_clock::now();
+  auto component_ptr = factory(context);
+  component_info.SetLoadTimes(load_start, std::chrono::steady_clock::now());
+  component_info.SetComponent(std::move(component_ptr));
   auto* component = component_info.GetComponent();
   if (component) {
     // Call the following command on logs to get the component dependencies:
@@ -130,6 +137,31 @@ impl::ComponentBase* ComponentContext::Impl::AddComponent(
   return component;
 }
 
+void ComponentContext::Impl::ReportStartupProfile() const {
+  impl::StartupProfile profile;
+  profile.reserve(components_.size());
+  for (const auto& [name, component_info] : components_) {
+    auto component_profile = component_info.GetLoadProfile();
+    if (component_profile) profile.push_back(std::move(*component_profile));
+  }
+
+  LOG_INFO() << "Components startup critical path: "
+             << impl::FormatStartupCriticalPath(
+                    impl::FindStartupCriticalPath(profile));
+
+  const auto& trace_path = manager_.GetConfig().startup_trace_path;
+  if (!trace_path.empty()) {
+    try {
+      fs::blocking::RewriteFileContents(
+          trace_path, impl::ToChromeTrace(profile, manager_.GetStartTime()));
+      LOG_INFO() << "Components startup trace is written to " << trace_path;
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to write the components startup trace to "
+                  << trace_path << ": " << ex;
+    }
+  }
+}
+
 void ComponentContext::Impl::OnAllComponentsLoaded() {
   StopPrintAddingComponentsTask();
   tracing::Span span(kOnAllComponentsLoadedRootName);
@@ -343,7 +375,11 @@ impl::ComponentBase* ComponentContext::Impl::DoFindComponent(
   }
   SearchingComponentScope finder(*this, this_component_name);
 
-  return component_info.WaitAndGetComponent();
+  const auto wait_start = std::chrono::steady_clock::now();
+  component = component_info.WaitAndGetComponent();
+  components_.at(this_component_name)
+      .AddDependencyWaiting(std::chrono::steady_clock::now() - wait_start);
+  return component;
 }
 
 void ComponentContext::Impl::AddDependency(impl::ComponentNameFromInfo name) {
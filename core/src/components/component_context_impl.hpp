@@ -31,6 +31,8 @@ struct ComponentContext::Impl {
                                     const ComponentFactory& factory,
                                     ComponentContext& context);
 
+  void ReportStartupProfile() const;
+
   void OnAllComponentsLoaded();
 
   void OnAllComponentsAreStopping();
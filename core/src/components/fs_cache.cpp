@@ -7,6 +7,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace components {
 
+namespace {
+
+utils::Flags<fs::SettingsReadFile> GetReadFileFlags(
+    const components::ComponentConfig& config) {
+  utils::Flags<fs::SettingsReadFile> flags{fs::SettingsReadFile::kSkipHidden};
+  if (config["keep-descriptors"].As<bool>(false)) {
+    flags |= fs::SettingsReadFile::kKeepDescriptor;
+  }
+  return flags;
+}
+
+}  // namespace
+
 const FsCache::Client& FsCache::GetClient() const { return client_; }
 
 FsCache::FsCache(const components::ComponentConfig& config,
@@ -16,7 +29,8 @@ FsCache::FsCache(const components::ComponentConfig& config,
           config["dir"].As<std::string>("/var/www"),
           config["update-period"].As<std::chrono::milliseconds>(0),
           context.GetTaskProcessor(config["fs-task-processor"].As<std::string>(
-              "fs-task-processor"))) {}
+              "fs-task-processor")),
+          GetReadFileFlags(config)) {}
 
 yaml_config::Schema FsCache::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
@@ -37,6 +51,11 @@ properties:
         type: string
         description: task processor to do filesystem operations
         defaultDescription: fs-task-processor
+    keep-descriptors:
+        type: boolean
+        description: |
+            keep the files open instead of storing their contents in memory
+        defaultDescription: false
 )");
 }
 
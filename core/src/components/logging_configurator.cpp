@@ -1,12 +1,21 @@
 #include <userver/components/logging_configurator.hpp>
 
+#include <optional>
+
 #include <logging/dynamic_debug.hpp>
 #include <logging/dynamic_debug_config.hpp>
+#include <logging/log_limited_config.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/logging/component.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/tracing/tracer.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <logging/rate_limit.hpp>
@@ -28,6 +37,20 @@ const dynamic_config::Key<tracing::NoLogSpans> kNoLogSpans{
 )"}};
 /// [key]
 
+const dynamic_config::Key<tracing::TailSampling> kTailSampling{
+    "USERVER_TRACE_TAIL_SAMPLING", dynamic_config::DefaultAsJsonString{R"(
+  {
+    "enabled": false
+  }
+)"}};
+
+const dynamic_config::Key<logging::LogLimitedConfig> kLogLimited{
+    "USERVER_LOG_LIMITED", dynamic_config::DefaultAsJsonString{R"(
+  {
+    "enabled": false
+  }
+)"}};
+
 const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
     "USERVER_LOG_DYNAMIC_DEBUG", dynamic_config::DefaultAsJsonString{R"(
   {
@@ -36,29 +59,82 @@ const dynamic_config::Key<logging::DynamicDebugConfig> kDynamicDebugConfig{
   }
 )"}};
 
+utils::PeriodicTask::Settings MakeSummarySettings(
+    const logging::LogLimitedConfig& config) {
+  return utils::PeriodicTask::Settings{config.summary_interval, {},
+                                       logging::Level::kTrace};
+}
+
+std::optional<logging::impl::LogLimitedBuckets> MakeLogLimitedBuckets(
+    const logging::LogLimitedConfig& config, Logging& logging_component) {
+  if (!config.enabled) return std::nullopt;
+
+  const auto make_bucket = [](const logging::LogLimitedBucketConfig& bucket) {
+    return logging::impl::LogLimitedBucket{
+        bucket.burst,
+        {1, std::chrono::steady_clock::duration{std::chrono::seconds{1}} /
+                bucket.rate_per_second}};
+  };
+
+  logging::impl::LogLimitedBuckets buckets;
+  buckets.defaults = make_bucket(config.defaults);
+  for (const auto& [name, bucket] : config.loggers) {
+    const auto logger = logging_component.GetLoggerOptional(name);
+    if (!logger) {
+      LOG_WARNING() << "Unknown logger '" << name << "' in USERVER_LOG_LIMITED";
+      continue;
+    }
+    buckets.loggers.emplace(logger.get(), make_bucket(bucket));
+  }
+  return buckets;
+}
+
 }  // namespace
 
 LoggingConfigurator::LoggingConfigurator(const ComponentConfig& config,
-                                         const ComponentContext& context) {
+                                         const ComponentContext& context)
+    : logging_component_(context.FindComponent<Logging>()) {
   logging::impl::SetLogLimitedEnable(
       config["limited-logging-enable"].As<bool>());
   logging::impl::SetLogLimitedInterval(
       config["limited-logging-interval"].As<std::chrono::milliseconds>());
 
+  log_limited_summary_task_.Start(
+      "log_limited_summary", MakeSummarySettings(logging::LogLimitedConfig{}),
+      [] { logging::impl::LogDroppedSummary(); });
+
   config_subscription_ =
       context.FindComponent<components::DynamicConfig>()
           .GetSource()
           .UpdateAndListen(this, kName, &LoggingConfigurator::OnConfigUpdate);
+
+  auto* const statistics_storage =
+      context.FindComponentOptional<components::StatisticsStorage>();
+  if (statistics_storage) {
+    statistics_holder_ = statistics_storage->GetStorage().RegisterWriter(
+        "log-limited", [this](utils::statistics::Writer& writer) {
+          WriteStatistics(writer);
+        });
+  }
 }
 
 LoggingConfigurator::~LoggingConfigurator() {
+  statistics_holder_.Unregister();
   config_subscription_.Unsubscribe();
+  log_limited_summary_task_.Stop();
+  logging::impl::SetLogLimitedBuckets(std::nullopt);
 }
 
 void LoggingConfigurator::OnConfigUpdate(
     const dynamic_config::Snapshot& config) {
   (void)this;  // silence clang-tidy
   tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans{config[kNoLogSpans]});
+  tracing::SetTailSampling(tracing::TailSampling{config[kTailSampling]});
+
+  const auto& log_limited = config[kLogLimited];
+  logging::impl::SetLogLimitedBuckets(
+      MakeLogLimitedBuckets(log_limited, logging_component_));
+  log_limited_summary_task_.SetSettings(MakeSummarySettings(log_limited));
 
   try {
     const auto& dd = config[kDynamicDebugConfig];
@@ -91,6 +167,17 @@ void LoggingConfigurator::OnConfigUpdate(
   }
 }
 
+void LoggingConfigurator::WriteStatistics(
+    utils::statistics::Writer& writer) const {
+  (void)this;  // silence clang-tidy
+  logging::impl::ForEachDroppingLocation(
+      [&writer](logging::impl::RateLimitLocation& location) {
+        writer["dropped"].ValueWithLabels(
+            utils::statistics::Rate{location.total_dropped_count.load()},
+            {"location", fmt::format("{}:{}", location.path, location.line)});
+      });
+}
+
 yaml_config::Schema LoggingConfigurator::GetStaticConfigSchema() {
   return yaml_config::MergeSchemas<impl::ComponentBase>(R"(
 type: object
@@ -359,6 +359,8 @@ void Manager::AddComponents(const ComponentList& component_list) {
         "were caught");
   }
 
+  component_context_.ReportStartupProfile();
+
   LOG_INFO() << "All components created. Constructors for all the components "
                 "have completed. Preparing to run OnAllComponentsLoaded "
                 "for each component.";
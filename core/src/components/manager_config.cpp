@@ -103,6 +103,19 @@ properties:
                 type: integer
                 description: size of a single coroutine, bytes
                 defaultDescription: 256 * 1024
+            local_cache_size:
+                type: integer
+                description: |
+                    max amount of idle coroutines to keep in a per-thread
+                    cache in front of the shared pool, 0 to disable
+                defaultDescription: 32
+            stack_usage_sample_every:
+                type: integer
+                description: |
+                    measure the stack high-water mark on each N-th task
+                    finish on each thread and report it in the
+                    coro-pool.stack-usage metrics, 0 to disable
+                defaultDescription: 0
     event_thread_pool:
         type: object
         description: event thread pool options
@@ -166,6 +179,76 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                task-queue:
+                    type: string
+                    description: |
+                        task queue implementation. `global` is the single
+                        queue shared by all the workers, `work-stealing`
+                        gives each worker its own local queue and lets
+                        idle workers steal tasks from the busy ones
+                    defaultDescription: global
+                    enum:
+                      - global
+                      - work-stealing
+                cpu-affinity:
+                    type: string
+                    description: |
+                        list of CPUs to bind the worker threads to, in the
+                        Linux cpulist format, e.g. `0-7,16-23`
+                numa-node:
+                    type: integer
+                    description: |
+                        NUMA node to bind the worker threads to. The task
+                        processor also gets its own coroutine pool, so that
+                        the coroutine stacks stay on the node memory
+                    minimum: 0
+                coro-stack-size:
+                    type: integer
+                    description: |
+                        stack size of the coroutines of this task processor,
+                        bytes. If set, the task processor gets its own
+                        coroutine pool, e.g. for a small-stack or a
+                        large-stack task processor
+                    defaultDescription: coro_pool.stack_size
+                io-backend:
+                    type: string
+                    description: |
+                        I/O backend of the sockets created in this task
+                        processor. `ev` waits for the socket readiness in
+                        the ev threads, `io-uring` performs the operations
+                        that would block with io_uring (Linux 5.19+). With
+                        `io-uring` the fs:: functions that are given this
+                        task processor perform the file I/O with io_uring
+                        instead of blocking its threads
+                    defaultDescription: ev
+                    enum:
+                      - ev
+                      - io-uring
+                io-uring-entries:
+                    type: integer
+                    description: |
+                        size of the io_uring submission queue
+                    defaultDescription: 4096
+                io-uring-max-file-operations:
+                    type: integer
+                    description: |
+                        max count of the io_uring file operations in
+                        flight, the rest wait for their turn
+                    defaultDescription: 64
+                preemption-time-slice:
+                    type: string
+                    description: |
+                        time slice after which the long-running task steps
+                        are asked to yield by engine::ShouldYield(), 0 to
+                        disable
+                    defaultDescription: 0
+                resource-accounting:
+                    type: boolean
+                    description: |
+                        accumulate the thread CPU time and the allocated
+                        bytes of each task to report them in the spans and
+                        the handler statistics
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
@@ -194,6 +277,12 @@ properties:
         type: boolean
         description: whether to disable caching of phdr_info objects
         defaultDescription: false
+    startup_trace_path:
+        type: string
+        description: |
+            file to write the components load times and dependencies to, in
+            Chrome Trace Event format
+        defaultDescription: ''
     static_config_validation:
         type: object
         description: settings for basic syntax validation in config.yaml
@@ -234,6 +323,8 @@ ManagerConfig Parse(const yaml_config::YamlConfig& value,
       value["mlock_debug_info"].As<bool>(config.mlock_debug_info);
   config.disable_phdr_cache =
       value["disable_phdr_cache"].As<bool>(config.disable_phdr_cache);
+  config.startup_trace_path =
+      value["startup_trace_path"].As<std::string>(config.startup_trace_path);
   return config;
 }
 
@@ -2,12 +2,14 @@
 
 #include <components/manager_config.hpp>
 #include <components/manager_controller_component_config.hpp>
+#include <engine/coro/stack_usage_monitor.hpp>
 #include <engine/task/task_processor.hpp>
 #include <engine/task/task_processor_pools.hpp>
 #include <userver/components/statistics_storage.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/logging/component.hpp>
+#include <userver/utils/statistics/rate.hpp>
 
 #include <components/manager.hpp>
 
@@ -15,6 +17,16 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
+namespace coro {
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const StackUsageMonitor& stack_usage_monitor) {
+  writer["histogram-kib"] = stack_usage_monitor.GetUsageHistogram();
+  writer["max-bytes"] = stack_usage_monitor.GetMaxUsage();
+}
+
+}  // namespace coro
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const engine::TaskProcessor& task_processor) {
   const auto& counter = task_processor.GetTaskCounter();
@@ -46,6 +58,20 @@ void DumpMetric(utils::statistics::Writer& writer,
 
     context_switch["overloaded"] = counter.GetTasksOverloadSensor().value;
     context_switch["no_overloaded"] = counter.GetTasksNoOverloadSensor().value;
+    context_switch["cross_node_wakeups"] = counter.GetCrossNodeWakeups().value;
+  }
+
+  if (const auto coro_stats = task_processor.GetLocalCoroPoolStats()) {
+    auto coroutines = writer["coro-pool"]["coroutines"];
+    coroutines["active"] = coro_stats->active_coroutines;
+    coroutines["total"] = coro_stats->total_coroutines;
+    coroutines["local-cache-hits"] = coro_stats->local_cache_hits;
+    coroutines["local-cache-misses"] = coro_stats->local_cache_misses;
+  }
+
+  const auto* stack_usage_monitor = task_processor.GetLocalStackUsageMonitor();
+  if (stack_usage_monitor && stack_usage_monitor->IsEnabled()) {
+    writer["coro-pool"]["stack-usage"] = *stack_usage_monitor;
   }
 
   writer["worker-threads"] = task_processor.GetWorkerCount();
@@ -100,18 +126,32 @@ void ManagerControllerComponent::WriteStatistics(
   const auto& pools_ptr = components_manager_.GetTaskProcessorPools();
   auto& ev_thread_pool = pools_ptr->EventThreadPool();
   for (auto* thread : ev_thread_pool.NextThreads(ev_thread_pool.GetSize())) {
-    writer["ev-threads"]["cpu-load-percent"].ValueWithLabels(
-        thread->GetCurrentLoadPercent(),
-        {{"ev_thread_name", thread->GetName()}});
+    const utils::statistics::LabelView label{"ev_thread_name",
+                                             thread->GetName()};
+    auto ev_threads = writer["ev-threads"];
+    ev_threads["cpu-load-percent"].ValueWithLabels(
+        thread->GetCurrentLoadPercent(), label);
+    ev_threads["loop-utilization-percent"].ValueWithLabels(
+        thread->GetLoopUtilizationPercent(), label);
+    ev_threads["pending-async-payloads"].ValueWithLabels(
+        thread->GetPendingPayloadsCount(), label);
+    ev_threads["invoked-watchers"].ValueWithLabels(
+        utils::statistics::Rate{thread->GetInvokedWatchersCount()}, label);
   }
 
   // coroutines
   if (auto coro_pool = writer["coro-pool"]) {
+    const auto& pool =
+        components_manager_.GetTaskProcessorPools()->GetCoroPool();
+    if (pool.GetStackUsageMonitor().IsEnabled()) {
+      coro_pool["stack-usage"] = pool.GetStackUsageMonitor();
+    }
     if (auto coro_stats = coro_pool["coroutines"]) {
-      auto stats =
-          components_manager_.GetTaskProcessorPools()->GetCoroPool().GetStats();
+      auto stats = pool.GetStats();
       coro_stats["active"] = stats.active_coroutines;
       coro_stats["total"] = stats.total_coroutines;
+      coro_stats["local-cache-hits"] = stats.local_cache_hits;
+      coro_stats["local-cache-misses"] = stats.local_cache_misses;
     }
   }
 
@@ -62,6 +62,8 @@ ManagerControllerDynamicConfig ManagerControllerDynamicConfig::Parse(
               value["execution-slice-threshold-us"].As<int>()};
       tp_settings.profiler_force_stacktrace =
           value["profiler-force-stacktrace"].As<bool>(false);
+      tp_settings.profiler_sample_every_task =
+          value["sample-every-task"].As<std::size_t>(0);
     }
   }
 
@@ -0,0 +1,104 @@
+#include <components/startup_profile.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+namespace {
+
+std::int64_t ToMicroseconds(std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration)
+      .count();
+}
+
+}  // namespace
+
+std::vector<const ComponentLoadProfile*> FindStartupCriticalPath(
+    const StartupProfile& profile) {
+  std::unordered_map<std::string_view, const ComponentLoadProfile*> by_name;
+  by_name.reserve(profile.size());
+  const ComponentLoadProfile* last = nullptr;
+  for (const auto& component : profile) {
+    by_name.emplace(component.name, &component);
+    if (!last || component.finish > last->finish) last = &component;
+  }
+
+  std::vector<const ComponentLoadProfile*> path;
+  for (const auto* current = last; current;) {
+    path.push_back(current);
+
+    const ComponentLoadProfile* next = nullptr;
+    for (const auto& dependency_name : current->dependencies) {
+      const auto it = by_name.find(dependency_name);
+      if (it == by_name.end()) continue;
+
+      const auto& dependency = *it->second;
+      // A dependency that had loaded before the component started did not
+      // delay it
+      if (dependency.finish <= current->start ||
+          dependency.finish >= current->finish) {
+        continue;
+      }
+      if (!next || dependency.finish > next->finish) next = &dependency;
+    }
+    current = next;
+  }
+
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+std::string FormatStartupCriticalPath(
+    const std::vector<const ComponentLoadProfile*>& path) {
+  std::string result;
+  for (const auto* component : path) {
+    if (!result.empty()) result += " -> ";
+    const auto own_time =
+        component->finish - component->start - component->waiting;
+    fmt::format_to(
+        std::back_inserter(result), "{} ({}ms)", component->name,
+        std::chrono::duration_cast<std::chrono::milliseconds>(own_time)
+            .count());
+  }
+  return result;
+}
+
+std::string ToChromeTrace(const StartupProfile& profile,
+                          std::chrono::steady_clock::time_point origin) {
+  formats::json::ValueBuilder events(formats::common::Type::kArray);
+  std::size_t thread_id = 0;
+  for (const auto& component : profile) {
+    formats::json::ValueBuilder event;
+    event["name"] = component.name;
+    event["cat"] = "component";
+    event["ph"] = "X";
+    event["pid"] = 1;
+    // A row per component, as the components are loaded concurrently
+    event["tid"] = ++thread_id;
+    event["ts"] = ToMicroseconds(component.start - origin);
+    event["dur"] = ToMicroseconds(component.finish - component.start);
+    event["args"]["waiting_us"] = ToMicroseconds(component.waiting);
+    event["args"]["dependencies"] = component.dependencies;
+    events.PushBack(std::move(event));
+  }
+
+  formats::json::ValueBuilder trace;
+  trace["traceEvents"] = std::move(events);
+  trace["displayTimeUnit"] = "ms";
+  return formats::json::ToString(trace.ExtractValue());
+}
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components::impl {
+
+struct ComponentLoadProfile final {
+  std::string name;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point finish;
+  // Time spent in FindComponent() waiting for the dependencies to load
+  std::chrono::steady_clock::duration waiting{};
+  std::vector<std::string> dependencies;
+};
+
+using StartupProfile = std::vector<ComponentLoadProfile>;
+
+// Returns the chain of components that defined the load time: the component
+// that finished last, the dependency it waited for the longest, and so on.
+// The first element of the result is the component that started the chain.
+std::vector<const ComponentLoadProfile*> FindStartupCriticalPath(
+    const StartupProfile& profile);
+
+// Formats the critical path as 'a (10ms) -> b (200ms)', with the time the
+// components spent loading without waiting for the dependencies
+std::string FormatStartupCriticalPath(
+    const std::vector<const ComponentLoadProfile*>& path);
+
+// Returns the profile in Chrome Trace Event format, which is accepted by
+// chrome://tracing and https://ui.perfetto.dev
+std::string ToChromeTrace(const StartupProfile& profile,
+                          std::chrono::steady_clock::time_point origin);
+
+}  // namespace components::impl
+
+USERVER_NAMESPACE_END
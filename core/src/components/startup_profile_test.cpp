@@ -0,0 +1,85 @@
+#include <components/startup_profile.hpp>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using components::impl::ComponentLoadProfile;
+using components::impl::StartupProfile;
+
+const auto kOrigin = std::chrono::steady_clock::time_point{} +
+                     std::chrono::hours{1};
+
+ComponentLoadProfile MakeProfile(std::string name, int start_ms,
+                                 int finish_ms, int waiting_ms,
+                                 std::vector<std::string> dependencies) {
+  return {std::move(name), kOrigin + std::chrono::milliseconds{start_ms},
+          kOrigin + std::chrono::milliseconds{finish_ms},
+          std::chrono::milliseconds{waiting_ms}, std::move(dependencies)};
+}
+
+// 'handler' waits for 'slow-cache' that waits for 'config', 'fast-cache'
+// loads concurrently and finishes early
+StartupProfile MakeStartupProfile() {
+  return {
+      MakeProfile("config", 0, 100, 0, {}),
+      MakeProfile("fast-cache", 0, 50, 0, {}),
+      MakeProfile("slow-cache", 0, 900, 100, {"config"}),
+      MakeProfile("handler", 0, 910, 900, {"fast-cache", "slow-cache"}),
+      MakeProfile("logging", 0, 5, 0, {}),
+  };
+}
+
+}  // namespace
+
+TEST(StartupProfile, CriticalPath) {
+  const auto profile = MakeStartupProfile();
+  const auto path = components::impl::FindStartupCriticalPath(profile);
+
+  ASSERT_EQ(path.size(), 3);
+  EXPECT_EQ(path[0]->name, "config");
+  EXPECT_EQ(path[1]->name, "slow-cache");
+  EXPECT_EQ(path[2]->name, "handler");
+
+  EXPECT_EQ(components::impl::FormatStartupCriticalPath(path),
+            "config (100ms) -> slow-cache (800ms) -> handler (10ms)");
+}
+
+TEST(StartupProfile, CriticalPathSkipsLoadedDependencies) {
+  const StartupProfile profile{
+      MakeProfile("config", 0, 100, 0, {}),
+      MakeProfile("late-component", 200, 300, 0, {"config"}),
+  };
+  const auto path = components::impl::FindStartupCriticalPath(profile);
+
+  ASSERT_EQ(path.size(), 1);
+  EXPECT_EQ(path[0]->name, "late-component");
+}
+
+TEST(StartupProfile, EmptyProfile) {
+  EXPECT_TRUE(components::impl::FindStartupCriticalPath({}).empty());
+}
+
+TEST(StartupProfile, ChromeTrace) {
+  const auto profile = MakeStartupProfile();
+  const auto trace = formats::json::FromString(
+      components::impl::ToChromeTrace(profile, kOrigin));
+
+  const auto events = trace["traceEvents"];
+  ASSERT_EQ(events.GetSize(), profile.size());
+
+  const auto handler = events[3];
+  EXPECT_EQ(handler["name"].As<std::string>(), "handler");
+  EXPECT_EQ(handler["ph"].As<std::string>(), "X");
+  EXPECT_EQ(handler["ts"].As<std::int64_t>(), 0);
+  EXPECT_EQ(handler["dur"].As<std::int64_t>(), 910'000);
+  EXPECT_EQ(handler["args"]["waiting_us"].As<std::int64_t>(), 900'000);
+  EXPECT_EQ(handler["args"]["dependencies"].As<std::vector<std::string>>(),
+            (std::vector<std::string>{"fast-cache", "slow-cache"}));
+}
+
+USERVER_NAMESPACE_END
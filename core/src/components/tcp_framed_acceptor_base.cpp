@@ -0,0 +1,400 @@
+#include <userver/components/tcp_framed_acceptor_base.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/utils/trivial_map.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+#include <sys/uio.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace impl {
+
+struct TcpFramedStats final {
+  std::atomic<std::uint64_t> active_connections{0};
+  std::atomic<std::uint64_t> connections_created{0};
+  std::atomic<std::uint64_t> connections_closed{0};
+
+  std::atomic<std::uint64_t> frames_received{0};
+  std::atomic<std::uint64_t> frames_sent{0};
+  std::atomic<std::uint64_t> frame_errors{0};
+
+  std::atomic<std::uint64_t> bytes_received{0};
+  std::atomic<std::uint64_t> bytes_sent{0};
+  std::atomic<std::uint64_t> send_calls{0};
+};
+
+}  // namespace impl
+
+namespace {
+
+constexpr utils::TrivialBiMap kFramingTypes = [](auto selector) {
+  return selector()
+      .Case(TcpFramingConfig::Type::kLengthPrefix, "length-prefix")
+      .Case(TcpFramingConfig::Type::kDelimiter, "delimiter");
+};
+
+// Each frame takes up to 2 iovecs: the payload and either the length prefix
+// or the delimiter
+constexpr std::size_t kMaxFramesPerSend = IOV_MAX / 2;
+
+std::size_t GetFramingOverhead(const TcpFramingConfig& config) noexcept {
+  return config.type == TcpFramingConfig::Type::kLengthPrefix
+             ? config.length_prefix_size
+             : config.delimiter.size();
+}
+
+void ThrowFrameTooLarge(std::size_t size, std::size_t max_size) {
+  throw engine::io::IoException(fmt::format(
+      "Received frame of size {} exceeds the max size {}", size, max_size));
+}
+
+}  // namespace
+
+TcpFramingConfig Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<TcpFramingConfig>) {
+  TcpFramingConfig config;
+
+  if (!value["type"].IsMissing()) {
+    config.type = utils::ParseFromValueString(value["type"], kFramingTypes);
+  }
+  config.length_prefix_size = value["length-prefix-size"].As<std::size_t>(
+      config.length_prefix_size);
+  config.delimiter = value["delimiter"].As<std::string>(config.delimiter);
+  config.max_frame_size =
+      value["max-frame-size"].As<std::size_t>(config.max_frame_size);
+  config.receive_buffer_size = value["receive-buffer-size"].As<std::size_t>(
+      config.receive_buffer_size);
+  config.max_pending_send_bytes =
+      value["max-pending-send-bytes"].As<std::size_t>(
+          config.max_pending_send_bytes);
+  config.max_pending_send_frames =
+      value["max-pending-send-frames"].As<std::size_t>(
+          config.max_pending_send_frames);
+
+  const auto prefix_size = config.length_prefix_size;
+  if (prefix_size != 1 && prefix_size != 2 && prefix_size != 4 &&
+      prefix_size != 8) {
+    throw std::runtime_error("Invalid length-prefix-size value in " +
+                             value.GetPath() + ", expected 1, 2, 4 or 8");
+  }
+  if (config.delimiter.empty()) {
+    throw std::runtime_error("Empty delimiter in " + value.GetPath());
+  }
+  if (config.max_frame_size == 0 || config.receive_buffer_size == 0) {
+    throw std::runtime_error("Invalid frame or buffer size in " +
+                             value.GetPath());
+  }
+  if (config.max_pending_send_frames == 0) {
+    throw std::runtime_error("Invalid max-pending-send-frames value in " +
+                             value.GetPath());
+  }
+
+  return config;
+}
+
+TcpFramedConnection::TcpFramedConnection(engine::io::Socket& socket,
+                                         const TcpFramingConfig& config,
+                                         impl::TcpFramedStats* stats)
+    : socket_(socket),
+      config_(config),
+      stats_(stats),
+      buffer_(std::make_unique<char[]>(config.receive_buffer_size)),
+      buffer_size_(config.receive_buffer_size) {
+  pending_frames_.reserve(
+      std::min(config.max_pending_send_frames, kMaxFramesPerSend));
+}
+
+TcpFramedConnection::~TcpFramedConnection() = default;
+
+std::optional<std::string_view> TcpFramedConnection::ReadFrame(
+    engine::Deadline deadline) {
+  begin_ += std::exchange(consumed_frame_size_, 0);
+  delimiter_scan_pos_ = std::max(delimiter_scan_pos_, begin_);
+
+  while (true) {
+    if (auto frame = TryParseFrame()) {
+      if (stats_) ++stats_->frames_received;
+      return frame;
+    }
+
+    // Responses to the pipelined frames are sent by a single write
+    Flush(deadline);
+    PrepareForRecv();
+
+    const auto bytes_read =
+        socket_.RecvSome(buffer_.get() + end_, buffer_size_ - end_, deadline);
+    if (bytes_read == 0) {
+      if (begin_ == end_) return std::nullopt;
+      throw engine::io::IoException(
+          "Connection was closed in the middle of a frame");
+    }
+    end_ += bytes_read;
+    if (stats_) stats_->bytes_received += bytes_read;
+  }
+}
+
+std::optional<std::string_view> TcpFramedConnection::TryParseFrame() {
+  const char* const data = buffer_.get();
+  const std::size_t available = end_ - begin_;
+
+  if (config_.type == TcpFramingConfig::Type::kLengthPrefix) {
+    const auto prefix_size = config_.length_prefix_size;
+    if (available < prefix_size) return std::nullopt;
+
+    std::uint64_t payload_size = 0;
+    for (std::size_t i = 0; i < prefix_size; ++i) {
+      payload_size = (payload_size << 8) |
+                     static_cast<unsigned char>(data[begin_ + i]);
+    }
+    if (payload_size > config_.max_frame_size) {
+      if (stats_) ++stats_->frame_errors;
+      ThrowFrameTooLarge(payload_size, config_.max_frame_size);
+    }
+    if (available - prefix_size < payload_size) return std::nullopt;
+
+    consumed_frame_size_ = prefix_size + payload_size;
+    return std::string_view{data + begin_ + prefix_size, payload_size};
+  }
+
+  // The delimiter may start in the part of the buffer that has already been
+  // scanned
+  const std::string_view delimiter = config_.delimiter;
+  const auto scan_from =
+      std::max(begin_, delimiter_scan_pos_ >= delimiter.size()
+                           ? delimiter_scan_pos_ - delimiter.size() + 1
+                           : 0);
+  const std::string_view unscanned{data + scan_from, end_ - scan_from};
+  const auto position = unscanned.find(delimiter);
+  if (position == std::string_view::npos) {
+    delimiter_scan_pos_ = end_;
+    if (available >= config_.max_frame_size + delimiter.size()) {
+      if (stats_) ++stats_->frame_errors;
+      ThrowFrameTooLarge(available, config_.max_frame_size);
+    }
+    return std::nullopt;
+  }
+
+  const auto payload_size = scan_from + position - begin_;
+  if (payload_size > config_.max_frame_size) {
+    if (stats_) ++stats_->frame_errors;
+    ThrowFrameTooLarge(payload_size, config_.max_frame_size);
+  }
+  consumed_frame_size_ = payload_size + delimiter.size();
+  delimiter_scan_pos_ = begin_ + consumed_frame_size_;
+  return std::string_view{data + begin_, payload_size};
+}
+
+void TcpFramedConnection::PrepareForRecv() {
+  if (begin_ == end_) {
+    begin_ = end_ = delimiter_scan_pos_ = 0;
+  }
+  if (end_ != buffer_size_) return;
+
+  const auto available = end_ - begin_;
+  if (begin_ != 0) {
+    // Moves the beginning of an incomplete frame to the start of the buffer
+    std::memmove(buffer_.get(), buffer_.get() + begin_, available);
+    delimiter_scan_pos_ -= begin_;
+    begin_ = 0;
+    end_ = available;
+    return;
+  }
+
+  // The frame does not fit into the buffer
+  const auto max_buffer_size =
+      config_.max_frame_size + GetFramingOverhead(config_);
+  const auto new_size = std::min(buffer_size_ * 2, max_buffer_size);
+  UASSERT_MSG(new_size > buffer_size_, "Too large frames must be rejected");
+  auto new_buffer = std::make_unique<char[]>(new_size);
+  std::memcpy(new_buffer.get(), buffer_.get(), available);
+  buffer_ = std::move(new_buffer);
+  buffer_size_ = new_size;
+}
+
+void TcpFramedConnection::SendFrame(std::string payload,
+                                    engine::Deadline deadline) {
+  auto& frame = pending_frames_.emplace_back();
+  if (config_.type == TcpFramingConfig::Type::kLengthPrefix) {
+    const auto prefix_size = config_.length_prefix_size;
+    std::uint64_t size = payload.size();
+    for (std::size_t i = prefix_size; i > 0; --i) {
+      frame.length_prefix[i - 1] = static_cast<char>(size & 0xff);
+      size >>= 8;
+    }
+    UINVARIANT(size == 0, "Frame payload is too large for the length prefix");
+  }
+  pending_send_bytes_ += payload.size() + GetFramingOverhead(config_);
+  frame.payload = std::move(payload);
+
+  if (pending_send_bytes_ >= config_.max_pending_send_bytes ||
+      pending_frames_.size() >=
+          std::min(config_.max_pending_send_frames, kMaxFramesPerSend)) {
+    Flush(deadline);
+  }
+}
+
+void TcpFramedConnection::Flush(engine::Deadline deadline) {
+  if (pending_frames_.empty()) return;
+
+  const bool is_length_prefix =
+      config_.type == TcpFramingConfig::Type::kLengthPrefix;
+  iovecs_.clear();
+  for (auto& frame : pending_frames_) {
+    if (is_length_prefix) {
+      iovecs_.push_back(
+          {frame.length_prefix.data(), config_.length_prefix_size});
+    }
+    if (!frame.payload.empty()) {
+      iovecs_.push_back({frame.payload.data(), frame.payload.size()});
+    }
+    if (!is_length_prefix) {
+      iovecs_.push_back({const_cast<char*>(config_.delimiter.data()),
+                         config_.delimiter.size()});
+    }
+  }
+
+  const auto frames_count = pending_frames_.size();
+  const auto bytes_count = pending_send_bytes_;
+  pending_frames_.clear();
+  pending_send_bytes_ = 0;
+
+  const auto sent = socket_.SendAll(iovecs_.data(), iovecs_.size(), deadline);
+  if (stats_) {
+    ++stats_->send_calls;
+    stats_->bytes_sent += sent;
+  }
+  if (sent != bytes_count) {
+    throw engine::io::IoException("Connection was closed by peer");
+  }
+  if (stats_) stats_->frames_sent += frames_count;
+}
+
+TcpFramedAcceptorBase::TcpFramedAcceptorBase(const ComponentConfig& config,
+                                             const ComponentContext& context)
+    : TcpAcceptorBase(config, context),
+      framing_config_(config["framing"].As<TcpFramingConfig>()),
+      stats_(std::make_unique<impl::TcpFramedStats>()) {
+  auto& statistics_storage =
+      context.FindComponent<StatisticsStorage>().GetStorage();
+  statistics_holder_ = statistics_storage.RegisterWriter(
+      "tcp." + config.Name(), [this](utils::statistics::Writer& writer) {
+        WriteStatistics(writer);
+      });
+}
+
+TcpFramedAcceptorBase::~TcpFramedAcceptorBase() {
+  statistics_holder_.Unregister();
+}
+
+yaml_config::Schema TcpFramedAcceptorBase::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<TcpAcceptorBase>(R"(
+# yaml
+type: object
+description: |
+  Component for accepting incoming TCP connections of framed protocols
+additionalProperties: false
+properties:
+  framing:
+      type: object
+      description: framing of the messages
+      additionalProperties: false
+      defaultDescription: length-prefixed frames
+      properties:
+          type:
+              type: string
+              description: framing type
+              defaultDescription: length-prefix
+              enum:
+                - length-prefix
+                - delimiter
+          length-prefix-size:
+              type: integer
+              description: |
+                  size of the big-endian payload size before each frame:
+                  1, 2, 4 or 8
+              defaultDescription: 4
+          delimiter:
+              type: string
+              description: string after each frame
+              defaultDescription: '\n'
+          max-frame-size:
+              type: integer
+              description: max size of a received frame payload
+              defaultDescription: 1048576
+          receive-buffer-size:
+              type: integer
+              description: initial size of the receive buffer of a connection
+              defaultDescription: 16384
+          max-pending-send-bytes:
+              type: integer
+              description: |
+                  size of the queued frames that makes the sender wait for
+                  the peer
+              defaultDescription: 262144
+          max-pending-send-frames:
+              type: integer
+              description: |
+                  count of the queued frames that makes the sender wait for
+                  the peer
+              defaultDescription: 64
+)");
+}
+
+void TcpFramedAcceptorBase::ProcessSocket(engine::io::Socket&& sock) {
+  ++stats_->active_connections;
+  ++stats_->connections_created;
+
+  try {
+    TcpFramedConnection connection{sock, framing_config_, stats_.get()};
+    ProcessConnection(connection);
+    connection.Flush();
+  } catch (const engine::io::IoException& e) {
+    LOG_INFO() << "Closing the connection: " << e;
+  } catch (const std::exception& e) {
+    LOG_ERROR() << "Error while processing the connection: " << e;
+  }
+
+  --stats_->active_connections;
+  ++stats_->connections_closed;
+}
+
+void TcpFramedAcceptorBase::WriteStatistics(
+    utils::statistics::Writer& writer) const {
+  if (auto conn_stats = writer["connections"]) {
+    conn_stats["active"] = stats_->active_connections;
+    conn_stats["opened"] = stats_->connections_created;
+    conn_stats["closed"] = stats_->connections_closed;
+  }
+  if (auto frame_stats = writer["frames"]) {
+    frame_stats["received"] = stats_->frames_received;
+    frame_stats["sent"] = stats_->frames_sent;
+    frame_stats["errors"] = stats_->frame_errors;
+  }
+  if (auto bytes_stats = writer["bytes"]) {
+    bytes_stats["received"] = stats_->bytes_received;
+    bytes_stats["sent"] = stats_->bytes_sent;
+  }
+  writer["send-calls"] = stats_->send_calls;
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
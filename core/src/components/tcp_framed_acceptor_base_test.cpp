@@ -0,0 +1,159 @@
+#include <userver/components/tcp_framed_acceptor_base.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string LengthPrefixed(std::string_view payload) {
+  std::string result(2, '\0');
+  result[0] = static_cast<char>(payload.size() >> 8);
+  result[1] = static_cast<char>(payload.size() & 0xff);
+  result += payload;
+  return result;
+}
+
+components::TcpFramingConfig MakeLengthPrefixConfig() {
+  components::TcpFramingConfig config;
+  config.length_prefix_size = 2;
+  config.receive_buffer_size = 16;
+  config.max_frame_size = 64;
+  return config;
+}
+
+components::TcpFramingConfig MakeDelimiterConfig() {
+  components::TcpFramingConfig config;
+  config.type = components::TcpFramingConfig::Type::kDelimiter;
+  config.delimiter = "\r\n";
+  config.receive_buffer_size = 4;
+  config.max_frame_size = 16;
+  return config;
+}
+
+}  // namespace
+
+UTEST(TcpFramedConnection, LengthPrefix) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+  const auto config = MakeLengthPrefixConfig();
+  components::TcpFramedConnection connection{server, config};
+
+  // Frames split between the reads and larger than the receive buffer
+  const auto data = LengthPrefixed("hello") + LengthPrefixed("") +
+                    LengthPrefixed("a frame larger than the buffer");
+  const auto split = data.size() / 2;
+  ASSERT_EQ(client.SendAll(data.data(), split, deadline), split);
+
+  auto frame = connection.ReadFrame(deadline);
+  ASSERT_TRUE(frame);
+  EXPECT_EQ(*frame, "hello");
+  connection.SendFrame(std::string{*frame}, deadline);
+
+  frame = connection.ReadFrame(deadline);
+  ASSERT_TRUE(frame);
+  EXPECT_EQ(*frame, "");
+  connection.SendFrame({}, deadline);
+  EXPECT_EQ(connection.GetPendingSendBytes(), 9);
+
+  ASSERT_EQ(client.SendAll(data.data() + split, data.size() - split, deadline),
+            data.size() - split);
+  frame = connection.ReadFrame(deadline);
+  ASSERT_TRUE(frame);
+  EXPECT_EQ(*frame, "a frame larger than the buffer");
+  EXPECT_EQ(connection.GetPendingSendBytes(), 0);
+
+  const auto expected = LengthPrefixed("hello") + LengthPrefixed("");
+  std::string reply(expected.size(), '\0');
+  ASSERT_EQ(client.RecvAll(reply.data(), reply.size(), deadline),
+            reply.size());
+  EXPECT_EQ(reply, expected);
+
+  client.Close();
+  EXPECT_FALSE(connection.ReadFrame(deadline));
+}
+
+UTEST(TcpFramedConnection, Delimiter) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+  const auto config = MakeDelimiterConfig();
+  components::TcpFramedConnection connection{server, config};
+
+  auto send_task = engine::AsyncNoSpan([&client = client, deadline] {
+    // The delimiter is split between the writes
+    for (const std::string_view part : {"first\r", "\nsecond\r\n\r", "\n"}) {
+      ASSERT_EQ(client.SendAll(part.data(), part.size(), deadline),
+                part.size());
+      engine::Yield();
+    }
+  });
+
+  std::vector<std::string> frames;
+  for (int i = 0; i < 3; ++i) {
+    const auto frame = connection.ReadFrame(deadline);
+    ASSERT_TRUE(frame);
+    frames.emplace_back(*frame);
+    connection.SendFrame(std::string{*frame}, deadline);
+  }
+  EXPECT_EQ(frames, (std::vector<std::string>{"first", "second", ""}));
+  connection.Flush(deadline);
+  send_task.Get();
+
+  constexpr std::string_view kExpected = "first\r\nsecond\r\n\r\n";
+  std::string reply(kExpected.size(), '\0');
+  ASSERT_EQ(client.RecvAll(reply.data(), reply.size(), deadline),
+            reply.size());
+  EXPECT_EQ(reply, kExpected);
+}
+
+UTEST(TcpFramedConnection, TooLargeFrame) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+  const auto config = MakeDelimiterConfig();
+  components::TcpFramedConnection connection{server, config};
+
+  const std::string data(config.max_frame_size + config.delimiter.size(), 'x');
+  ASSERT_EQ(client.SendAll(data.data(), data.size(), deadline), data.size());
+  UEXPECT_THROW(connection.ReadFrame(deadline), engine::io::IoException);
+}
+
+UTEST(TcpFramedConnection, ClosedInTheMiddleOfFrame) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+  const auto config = MakeLengthPrefixConfig();
+  components::TcpFramedConnection connection{server, config};
+
+  const auto data = LengthPrefixed("truncated");
+  ASSERT_EQ(client.SendAll(data.data(), 4, deadline), 4);
+  client.Close();
+  UEXPECT_THROW(connection.ReadFrame(deadline), engine::io::IoException);
+}
+
+UTEST(TcpFramedConnection, Backpressure) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+  auto config = MakeLengthPrefixConfig();
+  config.max_pending_send_frames = 3;
+  components::TcpFramedConnection connection{server, config};
+
+  connection.SendFrame("a", deadline);
+  connection.SendFrame("b", deadline);
+  EXPECT_EQ(connection.GetPendingSendBytes(), 6);
+  connection.SendFrame("c", deadline);
+  EXPECT_EQ(connection.GetPendingSendBytes(), 0);
+
+  const auto expected =
+      LengthPrefixed("a") + LengthPrefixed("b") + LengthPrefixed("c");
+  std::string reply(expected.size(), '\0');
+  ASSERT_EQ(client.RecvAll(reply.data(), reply.size(), deadline),
+            reply.size());
+  EXPECT_EQ(reply, expected);
+}
+
+USERVER_NAMESPACE_END
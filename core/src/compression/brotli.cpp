@@ -0,0 +1,94 @@
+#include <compression/brotli.hpp>
+
+#ifdef USERVER_FEATURE_BROTLI_ENABLED
+#include <cstdint>
+#include <new>
+
+#include <brotli/encode.h>
+#include <fmt/format.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::brotli {
+
+#ifdef USERVER_FEATURE_BROTLI_ENABLED
+namespace {
+
+constexpr std::size_t kCompressBufferSize = 16 * 1024;
+
+class BrotliCompressor final : public Compressor {
+ public:
+  explicit BrotliCompressor(int level)
+      : Compressor(Encoding::kBrotli),
+        state_(BrotliEncoderCreateInstance(nullptr, nullptr, nullptr),
+               &BrotliEncoderDestroyInstance) {
+    if (!state_) throw std::bad_alloc();
+    if (level < BROTLI_MIN_QUALITY || level > BROTLI_MAX_QUALITY ||
+        !BrotliEncoderSetParameter(state_.get(), BROTLI_PARAM_QUALITY,
+                                   level)) {
+      throw CompressionError(
+          fmt::format("failed to initialize brotli with level {}", level));
+    }
+  }
+
+  void Compress(std::string_view data, bool flush,
+                std::string& output) override {
+    Run(flush ? BROTLI_OPERATION_FLUSH : BROTLI_OPERATION_PROCESS, data,
+        output);
+  }
+
+  void Finish(std::string& output) override {
+    Run(BROTLI_OPERATION_FINISH, {}, output);
+  }
+
+ private:
+  void Run(BrotliEncoderOperation operation, std::string_view data,
+           std::string& output) {
+    auto available_in = data.size();
+    const auto* next_in = reinterpret_cast<const std::uint8_t*>(data.data());
+
+    while (true) {
+      const auto old_size = output.size();
+      output.resize(old_size + kCompressBufferSize);
+      auto available_out = kCompressBufferSize;
+      auto* next_out =
+          reinterpret_cast<std::uint8_t*>(output.data() + old_size);
+      const auto ok = BrotliEncoderCompressStream(
+          state_.get(), operation, &available_in, &next_in, &available_out,
+          &next_out, nullptr);
+      output.resize(output.size() - available_out);
+      if (!ok) throw CompressionError("failed to compress brotli data");
+
+      if (operation == BROTLI_OPERATION_FINISH) {
+        if (BrotliEncoderIsFinished(state_.get())) break;
+      } else if (available_in == 0 &&
+                 !BrotliEncoderHasMoreOutput(state_.get())) {
+        break;
+      }
+    }
+  }
+
+  std::unique_ptr<BrotliEncoderState, decltype(&BrotliEncoderDestroyInstance)>
+      state_;
+};
+
+}  // namespace
+
+bool IsSupported() noexcept { return true; }
+
+std::unique_ptr<Compressor> MakeCompressor(int level) {
+  return std::make_unique<BrotliCompressor>(level);
+}
+#else
+bool IsSupported() noexcept { return false; }
+
+std::unique_ptr<Compressor> MakeCompressor(int /*level*/) {
+  throw CompressionError(
+      "brotli support is disabled, build with USERVER_FEATURE_BROTLI=ON");
+}
+#endif
+
+}  // namespace compression::brotli
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <memory>
+
+#include <compression/compressor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::brotli {
+
+/// Returns false if the brotli support is disabled, see
+/// `USERVER_FEATURE_BROTLI`
+bool IsSupported() noexcept;
+
+/// Creates a brotli compressor, `level` is from 0 to 11.
+/// @throws CompressionError on invalid level or if brotli is not supported
+std::unique_ptr<Compressor> MakeCompressor(int level);
+
+}  // namespace compression::brotli
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,186 @@
+#include <compression/compressor.hpp>
+
+#include <array>
+#include <stdexcept>
+
+#include <compression/brotli.hpp>
+#include <compression/gzip.hpp>
+#include <compression/zstd.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression {
+
+namespace {
+
+constexpr std::size_t kEncodingsCount = 3;
+
+// qvalues are parsed in thousandths
+constexpr int kMaxQValue = 1000;
+
+std::string_view TrimOws(std::string_view value) {
+  while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+    value.remove_prefix(1);
+  }
+  while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+    value.remove_suffix(1);
+  }
+  return value;
+}
+
+// RFC 9110, 12.4.2:
+// qvalue = ( "0" [ "." 0*3DIGIT ] ) / ( "1" [ "." 0*3("0") ] )
+std::optional<int> ParseQValue(std::string_view value) {
+  if (value.empty() || (value.front() != '0' && value.front() != '1')) {
+    return std::nullopt;
+  }
+  int result = (value.front() - '0') * kMaxQValue;
+  value.remove_prefix(1);
+  if (value.empty()) return result;
+
+  if (value.front() != '.' || value.size() > 4) return std::nullopt;
+  value.remove_prefix(1);
+  int scale = kMaxQValue / 10;
+  for (const char c : value) {
+    if (c < '0' || c > '9') return std::nullopt;
+    result += (c - '0') * scale;
+    scale /= 10;
+  }
+  if (result > kMaxQValue) return std::nullopt;
+  return result;
+}
+
+// Returns the qvalue of the element of Accept-Encoding and puts the coding
+// into `coding`, std::nullopt for the malformed elements
+std::optional<int> ParseElement(std::string_view element,
+                                std::string_view& coding) {
+  auto params_pos = element.find(';');
+  coding = TrimOws(element.substr(0, params_pos));
+  if (coding.empty()) return std::nullopt;
+
+  int qvalue = kMaxQValue;
+  while (params_pos != std::string_view::npos) {
+    element.remove_prefix(params_pos + 1);
+    params_pos = element.find(';');
+    const auto param = TrimOws(element.substr(0, params_pos));
+    if (param.size() < 2 || (param[0] != 'q' && param[0] != 'Q') ||
+        param[1] != '=') {
+      continue;
+    }
+    const auto parsed = ParseQValue(param.substr(2));
+    if (!parsed) return std::nullopt;
+    qvalue = *parsed;
+  }
+  return qvalue;
+}
+
+std::optional<Encoding> TryEncodingFromString(std::string_view encoding) {
+  const utils::StrIcaseEqual equal;
+  if (equal(encoding, "gzip") || equal(encoding, "x-gzip")) {
+    return Encoding::kGzip;
+  }
+  if (equal(encoding, "br")) return Encoding::kBrotli;
+  if (equal(encoding, "zstd")) return Encoding::kZstd;
+  return std::nullopt;
+}
+
+}  // namespace
+
+std::string_view ToString(Encoding encoding) noexcept {
+  switch (encoding) {
+    case Encoding::kGzip:
+      return "gzip";
+    case Encoding::kBrotli:
+      return "br";
+    case Encoding::kZstd:
+      return "zstd";
+  }
+
+  UINVARIANT(false, "Unexpected compression encoding");
+}
+
+Encoding EncodingFromString(std::string_view encoding) {
+  const auto result = TryEncodingFromString(encoding);
+  if (result) return *result;
+  throw std::runtime_error("Unknown content coding '" + std::string{encoding} +
+                           '\'');
+}
+
+bool IsSupported(Encoding encoding) noexcept {
+  switch (encoding) {
+    case Encoding::kGzip:
+      return true;
+    case Encoding::kBrotli:
+      return brotli::IsSupported();
+    case Encoding::kZstd:
+      return zstd::IsSupported();
+  }
+  return false;
+}
+
+Compressor::~Compressor() = default;
+
+std::unique_ptr<Compressor> MakeCompressor(Encoding encoding, int level) {
+  switch (encoding) {
+    case Encoding::kGzip:
+      return gzip::MakeCompressor(level);
+    case Encoding::kBrotli:
+      return brotli::MakeCompressor(level);
+    case Encoding::kZstd:
+      return zstd::MakeCompressor(level);
+  }
+
+  UINVARIANT(false, "Unexpected compression encoding");
+}
+
+std::string Compress(Encoding encoding, std::string_view data, int level) {
+  auto compressor = MakeCompressor(encoding, level);
+  std::string result;
+  compressor->Compress(data, /*flush=*/false, result);
+  compressor->Finish(result);
+  return result;
+}
+
+std::optional<Encoding> NegotiateEncoding(
+    std::string_view accept_encoding, utils::span<const Encoding> encodings) {
+  // -1 for the codings that are not mentioned
+  std::array<int, kEncodingsCount> qvalues{-1, -1, -1};
+  int any_qvalue = -1;
+
+  while (!accept_encoding.empty()) {
+    const auto pos = accept_encoding.find(',');
+    const auto element = accept_encoding.substr(0, pos);
+    accept_encoding.remove_prefix(pos == std::string_view::npos ? element.size()
+                                                                : pos + 1);
+
+    std::string_view coding;
+    const auto qvalue = ParseElement(element, coding);
+    if (!qvalue) continue;
+
+    if (coding == "*") {
+      any_qvalue = *qvalue;
+      continue;
+    }
+    // identity and the unknown codings are skipped
+    const auto encoding = TryEncodingFromString(coding);
+    if (encoding) qvalues[static_cast<std::size_t>(*encoding)] = *qvalue;
+  }
+
+  std::optional<Encoding> result;
+  int best_qvalue = 0;
+  for (const auto encoding : encodings) {
+    auto qvalue = qvalues[static_cast<std::size_t>(encoding)];
+    if (qvalue < 0) qvalue = any_qvalue;
+    if (qvalue > best_qvalue) {
+      best_qvalue = qvalue;
+      result = encoding;
+    }
+  }
+  return result;
+}
+
+}  // namespace compression
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <compression/error.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression {
+
+/// HTTP content codings
+enum class Encoding {
+  kGzip,
+  kBrotli,
+  kZstd,
+};
+
+/// Returns the content coding token: "gzip", "br" or "zstd"
+std::string_view ToString(Encoding encoding) noexcept;
+
+/// @throws std::runtime_error on unknown content coding
+Encoding EncodingFromString(std::string_view encoding);
+
+/// Returns false if the library of the encoding was disabled at build time
+bool IsSupported(Encoding encoding) noexcept;
+
+/// Streaming compressor, the output is appended to the `output`
+class Compressor {
+ public:
+  explicit Compressor(Encoding encoding) noexcept : encoding_(encoding) {}
+  virtual ~Compressor();
+
+  Encoding GetEncoding() const noexcept { return encoding_; }
+
+  /// Compresses the `data`. With `flush` everything passed so far can be
+  /// decompressed from the output, it makes the compression worse.
+  /// @throws CompressionError
+  virtual void Compress(std::string_view data, bool flush,
+                        std::string& output) = 0;
+
+  /// Writes the end of the stream, the compressor can not be used afterwards.
+  /// @throws CompressionError
+  virtual void Finish(std::string& output) = 0;
+
+ private:
+  const Encoding encoding_;
+};
+
+/// @throws CompressionError if the encoding is not supported
+std::unique_ptr<Compressor> MakeCompressor(Encoding encoding, int level);
+
+/// Compresses the whole data at once.
+/// @throws CompressionError
+std::string Compress(Encoding encoding, std::string_view data, int level);
+
+/// Chooses the encoding by the value of the Accept-Encoding header. The
+/// `encodings` are ordered by the server preference, it breaks the ties of
+/// the qvalues. Returns std::nullopt if none of `encodings` is acceptable.
+std::optional<Encoding> NegotiateEncoding(
+    std::string_view accept_encoding, utils::span<const Encoding> encodings);
+
+}  // namespace compression
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,137 @@
+#include <compression/compressor.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <compression/gzip.hpp>
+#include <compression/zstd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using compression::Encoding;
+
+constexpr std::size_t kMaxSize = 1024 * 1024;
+
+std::string MakeData() {
+  std::string result;
+  for (int i = 0; i < 1000; ++i) {
+    result += R"({"id":)" + std::to_string(i) + R"(,"name":"some name"},)";
+  }
+  return result;
+}
+
+std::optional<Encoding> Negotiate(std::string_view accept_encoding) {
+  constexpr Encoding kEncodings[] = {Encoding::kZstd, Encoding::kBrotli,
+                                     Encoding::kGzip};
+  return compression::NegotiateEncoding(accept_encoding, kEncodings);
+}
+
+}  // namespace
+
+TEST(Compression, GzipRoundTrip) {
+  const auto data = MakeData();
+  const auto compressed = compression::Compress(Encoding::kGzip, data, 6);
+  EXPECT_LT(compressed.size(), data.size() / 10);
+  EXPECT_EQ(compression::gzip::Decompress(compressed, kMaxSize), data);
+
+  EXPECT_EQ(compression::gzip::Decompress(
+                compression::Compress(Encoding::kGzip, {}, 6), kMaxSize),
+            "");
+}
+
+TEST(Compression, GzipStreamFlush) {
+  const auto data = MakeData();
+  auto compressor = compression::MakeCompressor(Encoding::kGzip, 1);
+
+  std::string compressed;
+  std::vector<std::size_t> flushed_sizes;
+  for (std::size_t pos = 0; pos < data.size(); pos += 1000) {
+    const auto chunk = std::string_view{data}.substr(pos, 1000);
+    compressor->Compress(chunk, /*flush=*/true, compressed);
+    flushed_sizes.push_back(compressed.size());
+  }
+  compressor->Finish(compressed);
+
+  EXPECT_EQ(compression::gzip::Decompress(compressed, kMaxSize), data);
+  for (std::size_t i = 1; i < flushed_sizes.size(); ++i) {
+    // Each flush produces some output
+    EXPECT_LT(flushed_sizes[i - 1], flushed_sizes[i]);
+  }
+}
+
+TEST(Compression, InvalidLevel) {
+  EXPECT_THROW(compression::MakeCompressor(Encoding::kGzip, 42),
+               compression::CompressionError);
+  EXPECT_THROW(compression::MakeCompressor(Encoding::kBrotli, 42),
+               compression::CompressionError);
+  EXPECT_THROW(compression::MakeCompressor(Encoding::kZstd, 42),
+               compression::CompressionError);
+}
+
+TEST(Compression, OptionalEncodings) {
+  const auto data = MakeData();
+  for (const auto encoding : {Encoding::kBrotli, Encoding::kZstd}) {
+    if (!compression::IsSupported(encoding)) {
+      EXPECT_THROW(compression::MakeCompressor(encoding, 1),
+                   compression::CompressionError);
+      continue;
+    }
+    const auto compressed = compression::Compress(encoding, data, 1);
+    EXPECT_LT(compressed.size(), data.size() / 10);
+  }
+}
+
+TEST(Compression, ZstdRoundTrip) {
+  if (!compression::zstd::IsSupported()) {
+    EXPECT_THROW(compression::zstd::Decompress("", kMaxSize),
+                 compression::DecompressionError);
+    return;
+  }
+
+  const auto data = MakeData();
+  const auto compressed = compression::Compress(Encoding::kZstd, data, 3);
+  EXPECT_EQ(compression::zstd::Decompress(compressed, kMaxSize), data);
+  EXPECT_THROW(compression::zstd::Decompress(compressed, data.size() - 1),
+               compression::TooBigError);
+  EXPECT_THROW(compression::zstd::Decompress(
+                   std::string_view{compressed}.substr(0, compressed.size() / 2),
+                   kMaxSize),
+               compression::DecompressionError);
+}
+
+TEST(Compression, EncodingStrings) {
+  for (const auto encoding :
+       {Encoding::kGzip, Encoding::kBrotli, Encoding::kZstd}) {
+    EXPECT_EQ(compression::EncodingFromString(compression::ToString(encoding)),
+              encoding);
+  }
+  EXPECT_EQ(compression::EncodingFromString("X-GZip"), Encoding::kGzip);
+  EXPECT_THROW(compression::EncodingFromString("deflate"), std::runtime_error);
+}
+
+TEST(Compression, NegotiateEncoding) {
+  EXPECT_EQ(Negotiate(""), std::nullopt);
+  EXPECT_EQ(Negotiate("identity"), std::nullopt);
+  EXPECT_EQ(Negotiate("deflate, gzip"), Encoding::kGzip);
+  EXPECT_EQ(Negotiate("gzip, br"), Encoding::kBrotli);
+  EXPECT_EQ(Negotiate("gzip, deflate, br, zstd"), Encoding::kZstd);
+  EXPECT_EQ(Negotiate("*"), Encoding::kZstd);
+  EXPECT_EQ(Negotiate("br;q=0.5, gzip;q=0.8"), Encoding::kGzip);
+  EXPECT_EQ(Negotiate(" br ; q=0.5 ,\tGZIP ; Q=1.0 "), Encoding::kGzip);
+  EXPECT_EQ(Negotiate("*;q=0.1, gzip;q=0.2"), Encoding::kGzip);
+  EXPECT_EQ(Negotiate("*;q=0.5, zstd;q=0"), Encoding::kBrotli);
+  EXPECT_EQ(Negotiate("gzip;q=0, *;q=0"), std::nullopt);
+  EXPECT_EQ(Negotiate("gzip;q=0.000"), std::nullopt);
+  EXPECT_EQ(Negotiate("x-gzip;q=0.001"), Encoding::kGzip);
+
+  // Malformed elements are ignored
+  EXPECT_EQ(Negotiate("br;q=2, gzip"), Encoding::kGzip);
+  EXPECT_EQ(Negotiate("br;q=0.1234, gzip;q=abc"), std::nullopt);
+  EXPECT_EQ(Negotiate(",,;q=1, gzip;level=1"), Encoding::kGzip);
+}
+
+USERVER_NAMESPACE_END
@@ -1,7 +1,12 @@
 #include <compression/gzip.hpp>
 
+#include <limits>
+
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
+#include <zlib.h>
+
+#include <fmt/format.h>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,7 +14,66 @@ namespace compression::gzip {
 
 namespace {
 constexpr auto kDecompressBufferSize = 1024;
-}
+
+constexpr std::size_t kCompressBufferSize = 16 * 1024;
+
+// 15 is the max window size, +16 writes the gzip header instead of the zlib
+// one
+constexpr int kGzipWindowBits = 15 + 16;
+constexpr int kMemLevel = 8;
+
+class GzipCompressor final : public Compressor {
+ public:
+  explicit GzipCompressor(int level) : Compressor(Encoding::kGzip) {
+    const auto rc = deflateInit2(&stream_, level, Z_DEFLATED, kGzipWindowBits,
+                                 kMemLevel, Z_DEFAULT_STRATEGY);
+    if (rc != Z_OK) {
+      throw CompressionError(
+          fmt::format("failed to initialize gzip with level {}", level));
+    }
+  }
+
+  ~GzipCompressor() override { deflateEnd(&stream_); }
+
+  void Compress(std::string_view data, bool flush,
+                std::string& output) override {
+    Deflate(data, flush ? Z_SYNC_FLUSH : Z_NO_FLUSH, output);
+  }
+
+  void Finish(std::string& output) override { Deflate({}, Z_FINISH, output); }
+
+ private:
+  void Deflate(std::string_view data, int flush, std::string& output) {
+    constexpr std::size_t kMaxInput = std::numeric_limits<uInt>::max();
+    do {
+      const auto input_size = std::min(data.size(), kMaxInput);
+      // zlib does not modify the input
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      stream_.next_in =
+          reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+      stream_.avail_in = input_size;
+      data.remove_prefix(input_size);
+      const auto current_flush = data.empty() ? flush : Z_NO_FLUSH;
+
+      // The output is complete when deflate() leaves some space in it
+      do {
+        const auto old_size = output.size();
+        output.resize(old_size + kCompressBufferSize);
+        stream_.next_out = reinterpret_cast<Bytef*>(output.data() + old_size);
+        stream_.avail_out = kCompressBufferSize;
+        const auto rc = deflate(&stream_, current_flush);
+        output.resize(output.size() - stream_.avail_out);
+        if (rc == Z_STREAM_ERROR) {
+          throw CompressionError("failed to compress gzip data");
+        }
+      } while (stream_.avail_out == 0);
+    } while (!data.empty());
+  }
+
+  z_stream stream_{};
+};
+
+}  // namespace
 
 std::string Decompress(std::string_view compressed, size_t max_size) {
   std::string decompressed;
@@ -38,6 +102,10 @@ std::string Decompress(std::string_view compressed, size_t max_size) {
   return decompressed;
 }
 
+std::unique_ptr<Compressor> MakeCompressor(int level) {
+  return std::make_unique<GzipCompressor>(level);
+}
+
 }  // namespace compression::gzip
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,130 @@
+#include <compression/zstd.hpp>
+
+#ifdef USERVER_FEATURE_ZSTD_ENABLED
+#include <new>
+
+#include <fmt/format.h>
+#include <zstd.h>
+#endif
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::zstd {
+
+#ifdef USERVER_FEATURE_ZSTD_ENABLED
+namespace {
+
+class ZstdCompressor final : public Compressor {
+ public:
+  explicit ZstdCompressor(int level)
+      : Compressor(Encoding::kZstd),
+        context_(ZSTD_createCCtx(), &ZSTD_freeCCtx) {
+    if (!context_) throw std::bad_alloc();
+    if (level < ZSTD_minCLevel() || level > ZSTD_maxCLevel() ||
+        ZSTD_isError(ZSTD_CCtx_setParameter(context_.get(),
+                                            ZSTD_c_compressionLevel, level))) {
+      throw CompressionError(
+          fmt::format("failed to initialize zstd with level {}", level));
+    }
+  }
+
+  void Compress(std::string_view data, bool flush,
+                std::string& output) override {
+    Run(flush ? ZSTD_e_flush : ZSTD_e_continue, data, output);
+  }
+
+  void Finish(std::string& output) override { Run(ZSTD_e_end, {}, output); }
+
+ private:
+  void Run(ZSTD_EndDirective directive, std::string_view data,
+           std::string& output) {
+    ZSTD_inBuffer input{data.data(), data.size(), 0};
+    const auto buffer_size = ZSTD_CStreamOutSize();
+
+    while (true) {
+      const auto old_size = output.size();
+      output.resize(old_size + buffer_size);
+      ZSTD_outBuffer out{output.data() + old_size, buffer_size, 0};
+      const auto remaining =
+          ZSTD_compressStream2(context_.get(), &out, &input, directive);
+      output.resize(old_size + out.pos);
+      if (ZSTD_isError(remaining)) {
+        throw CompressionError(fmt::format("failed to compress zstd data: {}",
+                                           ZSTD_getErrorName(remaining)));
+      }
+
+      // For flush and end the zero means that everything is written
+      if (directive == ZSTD_e_continue ? input.pos == input.size
+                                       : remaining == 0) {
+        break;
+      }
+    }
+  }
+
+  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context_;
+};
+
+}  // namespace
+
+bool IsSupported() noexcept { return true; }
+
+std::unique_ptr<Compressor> MakeCompressor(int level) {
+  return std::make_unique<ZstdCompressor>(level);
+}
+
+std::string Decompress(std::string_view compressed, std::size_t max_size) {
+  const std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context{
+      ZSTD_createDCtx(), &ZSTD_freeDCtx};
+  if (!context) throw std::bad_alloc();
+
+  std::string output;
+  const auto content_size =
+      ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+  if (content_size != ZSTD_CONTENTSIZE_UNKNOWN &&
+      content_size != ZSTD_CONTENTSIZE_ERROR) {
+    if (content_size > max_size) throw TooBigError();
+    output.reserve(content_size);
+  }
+
+  ZSTD_inBuffer input{compressed.data(), compressed.size(), 0};
+  const auto buffer_size = ZSTD_DStreamOutSize();
+  std::size_t remaining = 0;
+  while (true) {
+    const auto old_size = output.size();
+    output.resize(old_size + buffer_size);
+    ZSTD_outBuffer out{output.data() + old_size, buffer_size, 0};
+    remaining = ZSTD_decompressStream(context.get(), &out, &input);
+    output.resize(old_size + out.pos);
+    if (ZSTD_isError(remaining)) {
+      throw DecompressionError(fmt::format(
+          "failed to decompress zstd data: {}", ZSTD_getErrorName(remaining)));
+    }
+    if (output.size() > max_size) throw TooBigError();
+
+    // A full output buffer means that there may be more data to flush
+    if (input.pos == input.size && out.pos < out.size) break;
+  }
+
+  if (remaining != 0) {
+    throw DecompressionError("failed to decompress zstd data: truncated frame");
+  }
+  return output;
+}
+#else
+bool IsSupported() noexcept { return false; }
+
+std::unique_ptr<Compressor> MakeCompressor(int /*level*/) {
+  throw CompressionError(
+      "zstd support is disabled, build with USERVER_FEATURE_ZSTD=ON");
+}
+
+std::string Decompress(std::string_view /*compressed*/,
+                       std::size_t /*max_size*/) {
+  throw DecompressionError(
+      "zstd support is disabled, build with USERVER_FEATURE_ZSTD=ON");
+}
+#endif
+
+}  // namespace compression::zstd
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <compression/compressor.hpp>
+#include <compression/error.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace compression::zstd {
+
+/// Returns false if the zstd support is disabled, see
+/// `USERVER_FEATURE_ZSTD`
+bool IsSupported() noexcept;
+
+/// Creates a zstd compressor, `level` is from 1 to 22.
+/// @throws CompressionError on invalid level or if zstd is not supported
+std::unique_ptr<Compressor> MakeCompressor(int level);
+
+/// Decompresses the zstd frames.
+/// @throws DecompressionError on malformed data or if zstd is not supported
+/// @throws TooBigError if the result does not fit into `max_size`
+std::string Decompress(std::string_view compressed, std::size_t max_size);
+
+}  // namespace compression::zstd
+
+USERVER_NAMESPACE_END
@@ -24,10 +24,34 @@ void WaitForTask(std::string_view name, engine::TaskWithResult<void>& task) {
   try {
     task.Get();
   } catch (const std::exception& e) {
-    LOG_ERROR() << "Unhandled exception in subscriber " << name << ": " << e;
+    ReportUnhandledException(name, e);
   }
 }
 
+void ReportUnhandledException(std::string_view listener_name,
+                              const std::exception& ex) noexcept {
+  LOG_ERROR() << "Unhandled exception in subscriber " << listener_name << ": "
+              << ex;
+}
+
+void ListenerStatistics::Account(
+    std::chrono::steady_clock::time_point send_time) noexcept {
+  const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - send_time);
+  ++events;
+  total_latency_ms += utils::statistics::Rate{
+      static_cast<utils::statistics::Rate::ValueType>(latency.count())};
+  last_latency_ms.store(latency.count(), std::memory_order_relaxed);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ListenerStatistics& stats) {
+  writer["events"] = stats.events;
+  writer["latency-ms"]["total"] = stats.total_latency_ms;
+  writer["latency-ms"]["last"] =
+      stats.last_latency_ms.load(std::memory_order_relaxed);
+}
+
 [[noreturn]] void ReportAlreadySubscribed(std::string_view channel_name,
                                           std::string_view listener_name) {
   UINVARIANT(false, fmt::format("{} is already subscribed to channel {}",
@@ -4,6 +4,8 @@
 #include <stdexcept>
 
 #include <userver/concurrent/async_event_channel.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -77,6 +79,62 @@ UTEST(AsyncEventChannel, PublishTwoSubscribers) {
   sub2.Unsubscribe();
 }
 
+UTEST(AsyncEventChannel, InlineListener) {
+  concurrent::AsyncEventChannel<int> channel("channel");
+
+  int inline_value{0};
+  int task_value{0};
+  Subscriber inline_subscriber(inline_value);
+  Subscriber task_subscriber(task_value);
+
+  auto inline_sub = channel.AddInlineListener(&inline_subscriber, "inline",
+                                              &Subscriber::OnEvent);
+  auto task_sub =
+      channel.AddListener(&task_subscriber, "task", &Subscriber::OnEvent);
+
+  channel.SendEvent(1);
+  EXPECT_EQ(inline_value, 1);
+  EXPECT_EQ(task_value, 1);
+
+  inline_sub.Unsubscribe();
+  channel.SendEvent(2);
+  EXPECT_EQ(inline_value, 1);
+  EXPECT_EQ(task_value, 2);
+
+  task_sub.Unsubscribe();
+}
+
+UTEST(AsyncEventChannel, ListenerStatistics) {
+  concurrent::AsyncEventChannel<int> channel("channel");
+
+  int value1{0};
+  int value2{0};
+  Subscriber s1(value1);
+  Subscriber s2(value2);
+  auto sub1 = channel.AddInlineListener(&s1, "inline", &Subscriber::OnEvent);
+  auto sub2 = channel.AddListener(&s2, "task", &Subscriber::OnEvent);
+
+  channel.SendEvent(1);
+  channel.SendEvent(2);
+
+  utils::statistics::Storage storage;
+  auto statistics_holder = storage.RegisterWriter(
+      "channel", [&](utils::statistics::Writer& writer) { writer = channel; });
+  const utils::statistics::Snapshot snapshot{storage};
+
+  for (const auto* listener : {"inline", "task"}) {
+    EXPECT_EQ(
+        snapshot.SingleMetric("channel.events", {{"listener", listener}})
+            .AsRate(),
+        utils::statistics::Rate{2});
+    UEXPECT_NO_THROW(snapshot.SingleMetric("channel.latency-ms.last",
+                                           {{"listener", listener}}));
+  }
+
+  sub1.Unsubscribe();
+  sub2.Unsubscribe();
+}
+
 UTEST(AsyncEventChannel, PublishException) {
   concurrent::AsyncEventChannel<int> channel("channel");
 
@@ -2,6 +2,7 @@
 
 #include <userver/concurrent/mpsc_queue.hpp>
 #include <userver/concurrent/queue.hpp>
+#include <userver/concurrent/spsc_ring_buffer.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/utils/async.hpp>
 
@@ -31,6 +32,36 @@ auto GetConsumerTask(std::shared_ptr<QueueType> queue,
     }
   });
 }
+
+template <typename QueueType>
+auto GetBatchProducerTask(std::shared_ptr<QueueType> queue,
+                          std::size_t batch_size, std::atomic<bool>& run) {
+  return utils::Async(
+      "producer", [producer = queue->GetProducer(), batch_size, &run] {
+        std::size_t message = 0;
+        std::vector<std::size_t> batch;
+        while (run) {
+          while (batch.size() < batch_size) batch.push_back(message++);
+          bool res = producer.PushMany(batch);
+          benchmark::DoNotOptimize(res);
+        }
+      });
+}
+
+template <typename QueueType>
+auto GetBatchConsumerTask(std::shared_ptr<QueueType> queue,
+                          std::size_t batch_size,
+                          const std::atomic<bool>& run) {
+  return utils::Async(
+      "consumer", [consumer = queue->GetConsumer(), batch_size, &run]() {
+        std::vector<std::size_t> values;
+        while (run) {
+          values.clear();
+          auto res = consumer.PopMany(values, batch_size);
+          benchmark::DoNotOptimize(res);
+        }
+      });
+}
 }  // namespace
 
 template <typename QueueType>
@@ -67,6 +98,46 @@ void producer_consumer(benchmark::State& state) {
   });
 }
 
+// Same as producer_consumer, but the elements are pushed and popped in
+// batches of state.range(3) elements
+template <typename QueueType>
+void producer_consumer_batch(benchmark::State& state) {
+  engine::RunStandalone(state.range(0) + state.range(1), [&] {
+    std::size_t ProducersCount = state.range(0);
+    std::size_t ConsumersCount = state.range(1);
+    std::size_t QueueSize = state.range(2);
+    std::size_t BatchSize = state.range(3);
+
+    std::atomic<bool> run{true};
+    auto queue = QueueType::Create(QueueSize);
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(ProducersCount + ConsumersCount - 1);
+    for (std::size_t i = 0; i < ProducersCount - 1; ++i) {
+      tasks.push_back(GetBatchProducerTask(queue, BatchSize, run));
+    }
+
+    for (std::size_t i = 0; i < ConsumersCount; ++i) {
+      tasks.push_back(GetBatchConsumerTask(queue, BatchSize, run));
+    }
+
+    // Current thread work
+    {
+      std::size_t message = 0;
+      std::vector<std::size_t> batch;
+      auto producer = queue->GetProducer();
+      for ([[maybe_unused]] auto _ : state) {
+        while (batch.size() < BatchSize) batch.push_back(message++);
+        bool res = producer.PushMany(batch);
+        benchmark::DoNotOptimize(res);
+      }
+      state.SetItemsProcessed(state.iterations() * BatchSize);
+    }
+
+    run = false;
+  });
+}
+
 BENCHMARK_TEMPLATE(producer_consumer, concurrent::NonFifoMpmcQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 4}, {128, 512}});
@@ -95,4 +166,37 @@ BENCHMARK_TEMPLATE(producer_consumer, concurrent::MpscQueue<std::size_t>)
     ->RangeMultiplier(2)
     ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}});
 
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::NonFifoMpmcQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 4}, {1024, 1024}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::NonFifoMpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 4}, {1, 1}, {1'000'000'000, 1'000'000'000}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch, concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {1'000'000'000, 1'000'000'000}, {1, 64}});
+
+// SpscRingBuffer preallocates its capacity, compare it with the equally
+// bounded SpscQueue
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(8)
+    ->Ranges({{1, 1}, {1, 1}, {1024, 65536}});
+
+BENCHMARK_TEMPLATE(producer_consumer, concurrent::SpscRingBuffer<std::size_t>)
+    ->RangeMultiplier(8)
+    ->Ranges({{1, 1}, {1, 1}, {1024, 65536}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch, concurrent::SpscQueue<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {1024, 1024}, {1, 64}});
+
+BENCHMARK_TEMPLATE(producer_consumer_batch,
+                   concurrent::SpscRingBuffer<std::size_t>)
+    ->RangeMultiplier(4)
+    ->Ranges({{1, 1}, {1, 1}, {1024, 1024}, {1, 64}});
+
 USERVER_NAMESPACE_END
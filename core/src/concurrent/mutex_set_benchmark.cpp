@@ -65,11 +65,11 @@ void mutex_set_lock_unlock_no_contention(benchmark::State& state) {
 }
 
 BENCHMARK_TEMPLATE(mutex_set_lock_unlock_no_contention, int)
-    ->RangeMultiplier(2)
-    ->Range(1, 8);
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
 BENCHMARK_TEMPLATE(mutex_set_lock_unlock_no_contention, std::string)
-    ->RangeMultiplier(2)
-    ->Range(1, 8);
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
 
 template <typename T>
 void mutex_set_lock_unlock_contention(benchmark::State& state) {
@@ -131,11 +131,11 @@ void mutex_set_lock_unlock_contention(benchmark::State& state) {
 }
 
 BENCHMARK_TEMPLATE(mutex_set_lock_unlock_contention, int)
-    ->RangeMultiplier(2)
-    ->Range(1, 8);
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
 BENCHMARK_TEMPLATE(mutex_set_lock_unlock_contention, std::string)
-    ->RangeMultiplier(2)
-    ->Range(1, 8);
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
 
 template <typename T>
 void mutex_set_8ways_lock_unlock_contention(benchmark::State& state) {
@@ -180,11 +180,59 @@ void mutex_set_8ways_lock_unlock_contention(benchmark::State& state) {
 }
 
 BENCHMARK_TEMPLATE(mutex_set_8ways_lock_unlock_contention, int)
-    ->RangeMultiplier(2)
-    ->Range(1, 8);
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
 BENCHMARK_TEMPLATE(mutex_set_8ways_lock_unlock_contention, std::string)
-    ->RangeMultiplier(2)
-    ->Range(1, 8);
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+// Each task locks its own keys, so the only contention is on the shards.
+// Arguments: number of threads, number of ways.
+template <typename T>
+void mutex_set_sharded_lock_unlock(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    constexpr std::size_t kKeysCount = 16;
+    concurrent::MutexSet<T> ms(state.range(1));
+
+    const auto do_work = [&](std::size_t thread_id) {
+      const std::size_t addition = thread_id * kKeysCount;
+      for (std::size_t i = 0; i < kKeysCount; ++i) {
+        auto mutex = ms.GetMutexForKey(GetKeyForBenchmark<T>(addition + i));
+        std::unique_lock lock(mutex);
+        benchmark::DoNotOptimize(lock);
+      }
+    };
+
+    const std::size_t concurrent_jobs = state.range(0);
+    std::atomic<bool> keep_running{true};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(concurrent_jobs);
+
+    for (std::size_t thread_id = 1; thread_id < concurrent_jobs; ++thread_id) {
+      tasks.push_back(engine::AsyncNoSpan([&, thread_id] {
+        while (keep_running) {
+          do_work(thread_id);
+        }
+      }));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      do_work(0);
+    }
+    state.SetItemsProcessed(state.iterations() * kKeysCount);
+
+    keep_running = false;
+
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+
+BENCHMARK_TEMPLATE(mutex_set_sharded_lock_unlock, int)
+    ->ArgsProduct({{1, 4, 16, 64}, {1, 16, 64}});
+BENCHMARK_TEMPLATE(mutex_set_sharded_lock_unlock, std::string)
+    ->ArgsProduct({{1, 4, 16, 64}, {1, 16, 64}});
 
 }  // namespace
 
@@ -1,6 +1,9 @@
 #include <userver/utest/utest.hpp>
 
+#include <vector>
+
 #include <userver/concurrent/mutex_set.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/async.hpp>
 
@@ -99,6 +102,65 @@ UTEST(MutexSet, Notify) {
   task.Get();
 }
 
+UTEST(MutexSet, Fifo) {
+  constexpr std::size_t kWaiters = 5;
+  concurrent::MutexSet<int> ms;
+  auto mutex = ms.GetMutexForKey(1);
+  std::unique_lock lock(mutex);
+
+  std::vector<std::size_t> order;
+  std::vector<engine::TaskWithResult<void>> waiters;
+  for (std::size_t i = 0; i < kWaiters; ++i) {
+    waiters.push_back(engine::AsyncNoSpan([&ms, &order, i] {
+      auto m = ms.GetMutexForKey(1);
+      std::lock_guard lock(m);
+      order.push_back(i);
+    }));
+    engine::Yield();
+  }
+
+  lock.unlock();
+  // The key is handed off to the first waiter, no barging
+  EXPECT_FALSE(mutex.try_lock());
+
+  for (auto& waiter : waiters) waiter.Get();
+  const std::vector<std::size_t> expected{0, 1, 2, 3, 4};
+  EXPECT_EQ(order, expected);
+}
+
+UTEST(MutexSet, WaiterTimeoutInTheMiddle) {
+  concurrent::MutexSet<int> ms;
+  auto mutex = ms.GetMutexForKey(1);
+  std::unique_lock lock(mutex);
+
+  auto first = engine::AsyncNoSpan([&ms] {
+    auto m = ms.GetMutexForKey(1);
+    std::lock_guard lock(m);
+  });
+  engine::Yield();
+
+  auto timed_out = engine::AsyncNoSpan([&ms] {
+    auto m = ms.GetMutexForKey(1);
+    return m.try_lock_for(std::chrono::milliseconds{1});
+  });
+  engine::Yield();
+
+  auto last = engine::AsyncNoSpan([&ms] {
+    auto m = ms.GetMutexForKey(1);
+    std::lock_guard lock(m);
+  });
+  engine::Yield();
+
+  EXPECT_FALSE(timed_out.Get());
+
+  lock.unlock();
+  first.Get();
+  last.Get();
+
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
 UTEST(MutexSet, Sample) {
   /// [Sample mutex set usage]
   concurrent::MutexSet<std::string> ms;
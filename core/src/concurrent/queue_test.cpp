@@ -17,6 +17,7 @@ namespace {
 constexpr std::size_t kProducersCount = 4;
 constexpr std::size_t kConsumersCount = 4;
 constexpr std::size_t kMessageCount = 1000;
+constexpr std::size_t kBatchSize = 10;
 
 template <typename Producer>
 auto GetProducerTask(const Producer& producer, std::size_t i) {
@@ -83,6 +84,77 @@ TYPED_TEST(NonCoroutineTest, PushPopNoblock) {
   EXPECT_EQ(value, 2);
 }
 
+TYPED_TEST(NonCoroutineTest, PushPopManyNoblock) {
+  auto queue = TypeParam::Create(4);
+
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<std::size_t> values{0, 1, 2};
+  EXPECT_TRUE(producer.PushManyNoblock(values));
+  EXPECT_TRUE(values.empty());
+  EXPECT_EQ(queue->GetSizeApproximate(), 3);
+
+  values = {3, 4};
+  EXPECT_FALSE(producer.PushManyNoblock(values));
+  EXPECT_EQ(values, (std::vector<std::size_t>{3, 4}));
+
+  std::vector<std::size_t> popped;
+  EXPECT_EQ(consumer.PopManyNoblock(popped, 2), 2);
+  EXPECT_EQ(popped, (std::vector<std::size_t>{0, 1}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 1);
+
+  EXPECT_TRUE(producer.PushManyNoblock(values));
+  EXPECT_EQ(consumer.PopManyNoblock(popped, 10), 3);
+  EXPECT_EQ(popped, (std::vector<std::size_t>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+
+  EXPECT_EQ(consumer.PopManyNoblock(popped, 10), 0);
+  EXPECT_EQ(popped.size(), 5);
+}
+
+UTEST(NonFifoMpmcQueue, PushManyOverCapacity) {
+  auto queue = concurrent::NonFifoMpmcQueue<int>::Create(2);
+  auto consumer = queue->GetConsumer();
+  auto producer = queue->GetProducer();
+
+  std::vector<int> values{0, 1, 2};
+  EXPECT_FALSE(producer.PushMany(values));
+  EXPECT_EQ(values.size(), 3);
+}
+
+UTEST(SpscQueue, PushManyOverCapacity) {
+  auto queue = concurrent::SpscQueue<int>::Create(2);
+  auto consumer = queue->GetConsumer();
+  auto producer = queue->GetProducer();
+
+  std::vector<int> values{0, 1, 2};
+  EXPECT_FALSE(producer.PushMany(values));
+  EXPECT_EQ(values.size(), 3);
+}
+
+UTEST(SpscQueue, PushManyBlocks) {
+  auto queue = concurrent::SpscQueue<int>::Create(3);
+  auto consumer = queue->GetConsumer();
+
+  auto producer_task =
+      utils::Async("producer", [producer = queue->GetProducer()] {
+        std::vector<int> values{0, 1};
+        EXPECT_TRUE(producer.PushMany(values));
+        values = {2, 3};
+        EXPECT_TRUE(producer.PushMany(values));
+      });
+
+  std::vector<int> popped;
+  while (popped.size() < 4) {
+    int value{};
+    ASSERT_TRUE(consumer.Pop(value));
+    popped.push_back(value);
+  }
+  EXPECT_EQ(popped, (std::vector<int>{0, 1, 2, 3}));
+  UEXPECT_NO_THROW(producer_task.Get());
+}
+
 UTEST(NonFifoMpmcQueue, ConsumerIsDead) {
   auto queue = concurrent::NonFifoMpmcQueue<int>::Create();
   auto producer = queue->GetProducer();
@@ -140,6 +212,69 @@ UTEST_MT(NonFifoMpmcQueue, Mpmc, kProducersCount + kConsumersCount) {
                           [](int item) { return item == 1; }));
 }
 
+UTEST_MT(NonFifoMpmcQueue, MpmcMany, kProducersCount + kConsumersCount) {
+  auto queue = concurrent::NonFifoMpmcQueue<std::size_t>::Create(kMessageCount);
+  std::vector<concurrent::NonFifoMpmcQueue<std::size_t>::Producer> producers;
+  producers.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers.emplace_back(queue->GetProducer());
+  }
+
+  std::vector<engine::TaskWithResult<void>> producers_tasks;
+  producers_tasks.reserve(kProducersCount);
+  for (std::size_t i = 0; i < kProducersCount; ++i) {
+    producers_tasks.push_back(
+        utils::Async("producer", [&producer = producers[i], i] {
+          std::vector<std::size_t> batch;
+          for (std::size_t message = i * kMessageCount;
+               message < (i + 1) * kMessageCount; ++message) {
+            batch.push_back(message);
+            if (batch.size() == kBatchSize) {
+              ASSERT_TRUE(producer.PushMany(batch));
+            }
+          }
+          ASSERT_TRUE(producer.PushMany(batch));
+        }));
+  }
+
+  std::vector<concurrent::NonFifoMpmcQueue<std::size_t>::Consumer> consumers;
+  consumers.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers.emplace_back(queue->GetConsumer());
+  }
+
+  std::vector<int> consumed_messages(kMessageCount * kProducersCount, 0);
+  engine::Mutex mutex;
+
+  std::vector<engine::TaskWithResult<void>> consumers_tasks;
+  consumers_tasks.reserve(kConsumersCount);
+  for (std::size_t i = 0; i < kConsumersCount; ++i) {
+    consumers_tasks.push_back(utils::Async(
+        "consumer", [&consumer = consumers[i], &consumed_messages, &mutex] {
+          std::vector<std::size_t> values;
+          while (consumer.PopMany(values, kBatchSize)) {
+            EXPECT_LE(values.size(), kBatchSize);
+            const std::lock_guard lock(mutex);
+            for (const auto value : values) ++consumed_messages[value];
+            values.clear();
+          }
+        }));
+  }
+
+  for (auto& task : producers_tasks) {
+    task.Get();
+  }
+  producers.clear();
+
+  for (auto& task : consumers_tasks) {
+    task.Get();
+  }
+
+  ASSERT_TRUE(std::all_of(consumed_messages.begin(), consumed_messages.end(),
+                          [](int item) { return item == 1; }));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
 UTEST_MT(NonFifoMpmcQueue, SizeAfterConsumersDie, kConsumersCount + 1) {
   constexpr std::size_t kAttemptsCount = 1000;
 
@@ -0,0 +1,103 @@
+#include <userver/concurrent/sharded_map.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(ShardedMap, Empty) {
+  concurrent::ShardedMap<std::string, int> map{16};
+  const auto& cmap = map;
+
+  EXPECT_EQ(map.GetShardCount(), 16);
+  EXPECT_EQ(0, map.SizeApprox());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(cmap.begin(), cmap.end());
+  EXPECT_TRUE(map.GetSnapshot().empty());
+}
+
+UTEST(ShardedMap, Modify) {
+  concurrent::ShardedMap<std::string, int> map{16};
+  const auto& cmap = map;
+
+  UEXPECT_THROW(cmap["any"], rcu::MissingKeyException);
+  EXPECT_FALSE(map.Get("any"));
+  EXPECT_FALSE(map.Erase("any"));
+  EXPECT_FALSE(map.Pop("any"));
+
+  UEXPECT_NO_THROW(*map["any"] = 1);
+  EXPECT_EQ(1, *cmap["any"]);
+  EXPECT_EQ(1, *cmap.Get("any"));
+  EXPECT_TRUE(map.Erase("any"));
+  EXPECT_FALSE(map.Erase("any"));
+
+  EXPECT_TRUE(map.Insert("any", std::make_shared<int>(3)).inserted);
+  EXPECT_FALSE(map.Insert("any", std::make_shared<int>(0)).inserted);
+  EXPECT_EQ(*map.Pop("any"), 3);
+
+  EXPECT_TRUE(map.Emplace("any", 4).inserted);
+  EXPECT_EQ(*map.Emplace("any", 0).value, 4);
+  EXPECT_EQ(*map.Pop("any"), 4);
+
+  EXPECT_TRUE(map.TryEmplace("any", 5).inserted);
+  EXPECT_FALSE(map.TryEmplace("any", 0).inserted);
+
+  map.InsertOrAssign("any", std::make_shared<int>(6));
+  EXPECT_EQ(*cmap["any"], 6);
+
+  map.Clear();
+  EXPECT_EQ(0, map.SizeApprox());
+}
+
+UTEST(ShardedMap, IterationAndSnapshot) {
+  constexpr int kKeys = 100;
+  concurrent::ShardedMap<int, int> map{8};
+
+  std::unordered_map<int, std::shared_ptr<int>> raw_map;
+  for (int i = 0; i < kKeys; ++i) raw_map.emplace(i, std::make_shared<int>(i));
+  map.Assign(std::move(raw_map));
+  EXPECT_EQ(map.SizeApprox(), kKeys);
+
+  std::vector<bool> seen(kKeys, false);
+  for (const auto& [key, value] : map) {
+    ASSERT_GE(key, 0);
+    ASSERT_LT(key, kKeys);
+    EXPECT_FALSE(seen[key]);
+    EXPECT_EQ(*value, key);
+    seen[key] = true;
+  }
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), true), kKeys);
+
+  const auto snapshot = map.GetSnapshot();
+  EXPECT_EQ(snapshot.size(), kKeys);
+  EXPECT_EQ(*snapshot.at(42), 42);
+}
+
+UTEST_MT(ShardedMap, ConcurrentWrites, 4) {
+  constexpr int kTasks = 4;
+  constexpr int kKeysPerTask = 1000;
+  concurrent::ShardedMap<int, int> map{32};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTasks);
+  for (int i = 0; i < kTasks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&map, i] {
+      for (int key = i * kKeysPerTask; key < (i + 1) * kKeysPerTask; ++key) {
+        EXPECT_TRUE(map.Emplace(key, key).inserted);
+        EXPECT_EQ(*map.Get(key), key);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  EXPECT_EQ(map.SizeApprox(), kTasks * kKeysPerTask);
+}
+
+USERVER_NAMESPACE_END
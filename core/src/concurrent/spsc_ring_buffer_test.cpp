@@ -0,0 +1,160 @@
+#include <userver/concurrent/spsc_ring_buffer.hpp>
+
+#include <optional>
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMessageCount = 10000;
+
+struct Record final {
+  std::uint64_t id;
+  double price;
+};
+
+}  // namespace
+
+TEST(SpscRingBuffer, Capacity) {
+  EXPECT_EQ(concurrent::SpscRingBuffer<int>::Create(1)->GetCapacity(), 1);
+  EXPECT_EQ(concurrent::SpscRingBuffer<int>::Create(5)->GetCapacity(), 8);
+  EXPECT_EQ(concurrent::SpscRingBuffer<int>::Create(64)->GetCapacity(), 64);
+}
+
+TEST(SpscRingBuffer, Noblock) {
+  auto queue = concurrent::SpscRingBuffer<int>::Create(2);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  int value{};
+  EXPECT_FALSE(consumer.PopNoblock(value));
+
+  EXPECT_TRUE(producer.PushNoblock(1));
+  EXPECT_TRUE(producer.PushNoblock(2));
+  EXPECT_FALSE(producer.PushNoblock(3));
+  EXPECT_EQ(queue->GetSizeApproximate(), 2);
+
+  EXPECT_TRUE(consumer.PopNoblock(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(producer.PushNoblock(3));
+
+  EXPECT_TRUE(consumer.PopNoblock(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_TRUE(consumer.PopNoblock(value));
+  EXPECT_EQ(value, 3);
+  EXPECT_FALSE(consumer.PopNoblock(value));
+  EXPECT_EQ(queue->GetSizeApproximate(), 0);
+}
+
+TEST(SpscRingBuffer, ManyNoblock) {
+  auto queue = concurrent::SpscRingBuffer<int>::Create(4);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<int> values{1, 2, 3};
+  EXPECT_TRUE(producer.PushManyNoblock(values));
+  EXPECT_TRUE(values.empty());
+
+  values = {4, 5};
+  EXPECT_FALSE(producer.PushManyNoblock(values));
+  EXPECT_EQ(values.size(), 2);
+
+  std::vector<int> popped;
+  EXPECT_EQ(consumer.PopManyNoblock(popped, 2), 2);
+  EXPECT_TRUE(producer.PushManyNoblock(values));
+  EXPECT_EQ(consumer.PopManyNoblock(popped, 10), 3);
+  EXPECT_EQ(popped, (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+UTEST(SpscRingBuffer, PushManyOverCapacity) {
+  auto queue = concurrent::SpscRingBuffer<int>::Create(2);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  std::vector<int> values{1, 2, 3};
+  EXPECT_FALSE(producer.PushMany(values));
+  EXPECT_EQ(values.size(), 3);
+}
+
+UTEST(SpscRingBuffer, ProducerIsDead) {
+  auto queue = concurrent::SpscRingBuffer<int>::Create(4);
+  auto consumer = queue->GetConsumer();
+  {
+    auto producer = queue->GetProducer();
+    EXPECT_TRUE(producer.Push(1));
+  }
+
+  int value{};
+  EXPECT_TRUE(consumer.Pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_FALSE(consumer.Pop(value));
+}
+
+UTEST(SpscRingBuffer, ConsumerIsDead) {
+  auto queue = concurrent::SpscRingBuffer<int>::Create(1);
+  auto producer = queue->GetProducer();
+  std::optional consumer{queue->GetConsumer()};
+  EXPECT_TRUE(producer.Push(1));
+
+  auto producer_task = utils::Async("producer", [&producer] {
+    // Sleeps until the consumer dies
+    EXPECT_FALSE(producer.Push(2));
+  });
+  engine::Yield();
+
+  consumer.reset();
+  UEXPECT_NO_THROW(producer_task.Get());
+  EXPECT_FALSE(producer.Push(3));
+}
+
+UTEST(SpscRingBuffer, Cancel) {
+  auto queue = concurrent::SpscRingBuffer<int>::Create(1);
+  auto producer = queue->GetProducer();
+  auto consumer = queue->GetConsumer();
+
+  engine::current_task::GetCancellationToken().RequestCancel();
+  int value{};
+  EXPECT_FALSE(consumer.Pop(value));
+  EXPECT_TRUE(producer.Push(1));
+  EXPECT_FALSE(producer.Push(2));
+}
+
+UTEST_MT(SpscRingBuffer, Spsc, 2) {
+  auto queue = concurrent::SpscRingBuffer<Record>::Create(64);
+
+  auto producer_task =
+      utils::Async("producer", [producer = queue->GetProducer()] {
+        std::vector<Record> batch;
+        for (std::uint64_t id = 0; id < kMessageCount; ++id) {
+          if (id % 2) {
+            ASSERT_TRUE(producer.Push(Record{id, 1.0}));
+            continue;
+          }
+          batch.push_back(Record{id, 2.0});
+          if (batch.size() == 16) ASSERT_TRUE(producer.PushMany(batch));
+        }
+        ASSERT_TRUE(producer.PushMany(batch));
+      });
+
+  auto consumer = queue->GetConsumer();
+  std::vector<Record> records;
+  while (consumer.PopMany(records, 32)) {
+  }
+  UEXPECT_NO_THROW(producer_task.Get());
+
+  ASSERT_EQ(records.size(), kMessageCount);
+  std::vector<bool> seen(kMessageCount, false);
+  for (const auto& record : records) {
+    ASSERT_LT(record.id, kMessageCount);
+    EXPECT_FALSE(seen[record.id]);
+    seen[record.id] = true;
+  }
+}
+
+USERVER_NAMESPACE_END
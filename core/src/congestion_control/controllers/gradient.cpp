@@ -0,0 +1,95 @@
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+#include <userver/dynamic_config/value.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+constexpr std::size_t kLongTimingsEpochs = 30;
+constexpr double kMinGradient = 0.5;
+}  // namespace
+
+GradientConfig Parse(const formats::json::Value& value,
+                     formats::parse::To<GradientConfig>) {
+  GradientConfig result;
+  result.tolerance = value["tolerance"].As<double>(result.tolerance);
+  result.smoothing = value["smoothing"].As<double>(result.smoothing);
+  result.errors_threshold_percent =
+      value["errors-threshold-percent"].As<double>(
+          result.errors_threshold_percent);
+  result.safe_delta_limit =
+      value["deactivate-delta"].As<std::size_t>(result.safe_delta_limit);
+  result.min_limit = value["min-limit"].As<std::size_t>(result.min_limit);
+  result.min_qps = value["min-qps"].As<std::size_t>(result.min_qps);
+  return result;
+}
+
+GradientController::GradientController(
+    const std::string& name, v2::Sensor& sensor, Limiter& limiter, Stats& stats,
+    const StaticConfig& config, dynamic_config::Source config_source,
+    std::function<GradientConfig(const dynamic_config::Snapshot&)>
+        config_getter)
+    : Controller(name, sensor, limiter, stats,
+                 {config.fake_mode, config.enabled}),
+      config_source_(config_source),
+      config_getter_(std::move(config_getter)) {}
+
+Limit GradientController::Update(const Sensor::Data& current) {
+  const auto config = config_getter_(config_source_.GetSnapshot());
+  const auto current_load = current.current_load;
+
+  if (current.total < config.min_qps && !limit_) {
+    // Too little QPS, timings avg data is VERY noisy
+    return {std::nullopt, current_load};
+  }
+
+  const auto timings =
+      static_cast<double>(std::max<std::size_t>(current.timings_avg_ms, 1));
+  if (epochs_passed_ < kLongTimingsEpochs) {
+    // First seconds of service life are used to learn the normal timings
+    ++epochs_passed_;
+    long_timings_ += (timings - long_timings_) / epochs_passed_;
+    return {std::nullopt, current_load};
+  }
+
+  // Current timings grow over the long-term ones when the requests are queued
+  auto gradient =
+      std::clamp(config.tolerance * long_timings_ / timings, kMinGradient, 1.0);
+  if (100 * current.GetRate() > config.errors_threshold_percent) {
+    gradient = kMinGradient;
+  }
+
+  // Long-term timings slowly follow the current ones, so that a persistent
+  // change of the timings eventually becomes the new normal
+  long_timings_ += (timings - long_timings_) / kLongTimingsEpochs;
+
+  if (!limit_) {
+    if (gradient >= 1.0) return {std::nullopt, current_load};
+
+    LOG_ERROR() << GetName() << " Congestion Control is activated";
+    limit_ = current_load;
+  }
+
+  // sqrt(limit) headroom lets the limit grow back while there is no queue
+  const auto new_limit = *limit_ * gradient + std::sqrt(*limit_);
+  *limit_ = *limit_ * (1 - config.smoothing) + new_limit * config.smoothing;
+  *limit_ = std::max(*limit_, static_cast<double>(config.min_limit));
+
+  if (gradient >= 1.0 && *limit_ > current_load + config.safe_delta_limit) {
+    LOG_ERROR() << GetName() << " Congestion Control is deactivated";
+    limit_.reset();
+    return {std::nullopt, current_load};
+  }
+
+  return {static_cast<std::size_t>(*limit_), current_load};
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,116 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/dynamic_config/test_helpers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor : public congestion_control::v2::Sensor {
+  Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter : public congestion_control::Limiter {
+  void SetLimit(const congestion_control::Limit&) override {}
+};
+
+congestion_control::v2::Stats stats;
+FakeSensor sensor;
+FakeLimiter limiter;
+
+congestion_control::v2::GradientController MakeController() {
+  return {"test",
+          sensor,
+          limiter,
+          stats,
+          {},
+          dynamic_config::GetDefaultSource(),
+          [](auto) { return congestion_control::v2::GradientConfig(); }};
+}
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t timings_avg_ms) {
+  congestion_control::v2::Sensor::Data data;
+  data.total = 100;
+  data.timings_avg_ms = timings_avg_ms;
+  data.current_load = 50;
+  return data;
+}
+
+void WarmUp(congestion_control::v2::GradientController& controller) {
+  for (std::size_t i = 0; i < 30; i++) {
+    const auto limit = controller.Update(MakeData(100));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+}  // namespace
+
+TEST(CCGradient, Zero) {
+  auto controller = MakeController();
+
+  for (std::size_t i = 0; i < 1000; i++) {
+    const auto limit = controller.Update({});
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, FirstSeconds) {
+  auto controller = MakeController();
+
+  for (std::size_t i = 0; i < 30; i++) {
+    const auto limit = controller.Update(MakeData(10000));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, WithinTolerance) {
+  auto controller = MakeController();
+  WarmUp(controller);
+
+  for (std::size_t i = 0; i < 100; i++) {
+    const auto limit = controller.Update(MakeData(140));
+    EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+  }
+}
+
+TEST(CCGradient, QueueGrowth) {
+  auto controller = MakeController();
+  WarmUp(controller);
+
+  // Timings grow, the limit shrinks continuously
+  std::size_t previous_limit = 50;
+  for (std::size_t i = 0; i < 10; i++) {
+    const auto limit = controller.Update(MakeData(1000));
+    ASSERT_TRUE(limit.load_limit.has_value()) << i;
+    EXPECT_LT(*limit.load_limit, previous_limit) << i;
+    EXPECT_GE(*limit.load_limit, 10) << i;
+    previous_limit = *limit.load_limit;
+  }
+
+  // Timings are back to normal, the limit grows and is eventually removed
+  bool deactivated = false;
+  for (std::size_t i = 0; i < 100 && !deactivated; i++) {
+    const auto limit = controller.Update(MakeData(100));
+    if (!limit.load_limit) {
+      deactivated = true;
+      break;
+    }
+    EXPECT_GE(*limit.load_limit, previous_limit) << i;
+    previous_limit = *limit.load_limit;
+  }
+  EXPECT_TRUE(deactivated);
+}
+
+TEST(CCGradient, Errors) {
+  auto controller = MakeController();
+  WarmUp(controller);
+
+  auto data = MakeData(100);
+  data.timeouts = 10;
+  const auto limit = controller.Update(data);
+  ASSERT_TRUE(limit.load_limit.has_value());
+  EXPECT_LT(*limit.load_limit, 50);
+}
+
+USERVER_NAMESPACE_END
@@ -9,6 +9,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <utility>
 
 #include <curl-ev/easy.hpp>
@@ -21,6 +22,7 @@
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
+#include <openssl/ssl.h>
 
 #include <engine/ev/thread_control.hpp>
 #include <server/net/listener_impl.hpp>
@@ -35,6 +37,10 @@ USERVER_NAMESPACE_BEGIN
 namespace curl {
 namespace {
 
+// The body buffer is not reserved beyond this size to not trust the peer with
+// the memory allocations, the larger bodies grow the buffer as usual
+constexpr native::curl_off_t kMaxSinkReserve = 16 * 1024 * 1024;
+
 bool IsHeaderMatchingName(std::string_view header, std::string_view name) {
   return header.size() > name.size() &&
          utils::StrIcaseEqual()(header.substr(0, name.size()), name) &&
@@ -117,7 +123,8 @@ easy::~easy() {
   }
 }
 
-std::shared_ptr<const easy> easy::CreateBlocking() {
+std::shared_ptr<const easy> easy::CreateBlocking(
+    std::shared_ptr<share> share) {
   impl::CurlGlobal::Init();
 
   // Note: curl_easy_init() is blocking.
@@ -126,7 +133,9 @@ std::shared_ptr<const easy> easy::CreateBlocking() {
     throw std::bad_alloc();
   }
 
-  return std::make_shared<const easy>(handle, nullptr);
+  auto result = std::make_shared<easy>(handle, nullptr);
+  if (share) result->set_share(std::move(share));
+  return result;
 }
 
 std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
@@ -136,7 +145,52 @@ std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
     throw std::bad_alloc();
   }
 
-  return std::make_shared<easy>(cloned, &multi_handle);
+  auto result = std::make_shared<easy>(cloned, &multi_handle);
+  // curl_easy_duphandle() does not copy the share
+  if (share_) result->set_share(share_);
+  return result;
+}
+
+std::shared_ptr<easy> easy::CloneBlocking() const {
+  UASSERT(multi_);
+  UASSERT(!multi_registered_);
+  if (form_ || source_) return {};
+
+  // Note: curl_easy_duphandle() is blocking.
+  auto* cloned = native::curl_easy_duphandle(handle_);
+  if (!cloned) {
+    throw std::bad_alloc();
+  }
+  auto result = std::make_shared<easy>(cloned, multi_);
+
+  // The options that point to the members of this easy are set anew
+  if (!orig_url_str_.empty()) result->set_url(orig_url_str_);
+  if (!post_fields_.empty()) result->set_post_fields(std::string{post_fields_});
+  if (progress_callback_) result->set_progress_callback(progress_callback_);
+
+  const auto copy_list = [](const std::shared_ptr<string_list>& list) {
+    std::shared_ptr<string_list> copy;
+    if (list) {
+      copy = std::make_shared<string_list>();
+      list->ForEach([&copy](const std::string& value) { copy->add(value); });
+    }
+    return copy;
+  };
+  result->set_headers(copy_list(headers_));
+  result->set_http200_aliases(copy_list(http200_aliases_));
+  result->set_resolves(copy_list(resolved_hosts_));
+  result->proxy_headers_ = copy_list(proxy_headers_);
+  if (result->proxy_headers_) {
+    throw_error(
+        std::error_code{
+            static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
+                cloned, native::CURLOPT_PROXYHEADER,
+                result->proxy_headers_->native_handle()))},
+        "set_proxy_headers");
+  }
+  if (share_) result->set_share(share_);
+
+  return result;
 }
 
 easy* easy::from_native(native::CURL* native_easy) {
@@ -603,7 +657,7 @@ void easy::set_share(std::shared_ptr<share> share) {
 void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
   share_ = std::move(share);
 
-  if (share) {
+  if (share_) {
     ec = std::error_code{
         static_cast<errc::EasyErrorCode>(native::curl_easy_setopt(
             handle_, native::CURLOPT_SHARE, share_->native_handle()))};
@@ -613,6 +667,19 @@ void easy::set_share(std::shared_ptr<share> share, std::error_code& ec) {
   }
 }
 
+std::optional<bool> easy::get_tls_session_resumed() const {
+  native::curl_tlssessioninfo* info = nullptr;
+  if (native::curl_easy_getinfo(handle_, native::CURLINFO_TLS_SSL_PTR,
+                                &info) != native::CURLE_OK) {
+    return std::nullopt;
+  }
+  if (!info || !info->internals ||
+      info->backend != native::CURLSSLBACKEND_OPENSSL) {
+    return std::nullopt;
+  }
+  return SSL_session_reused(static_cast<SSL*>(info->internals)) == 1;
+}
+
 bool easy::has_post_data() const { return !post_fields_.empty() || form_; }
 
 const std::string& easy::get_post_data() const { return post_fields_; }
@@ -686,6 +753,7 @@ size_t easy::write_function(char* ptr, size_t size, size_t nmemb,
   }
 
   try {
+    if (self->sink_->empty()) self->reserve_sink();
     self->sink_->append(ptr, actual_size);
   } catch (const std::exception&) {
     // out of memory
@@ -695,6 +763,19 @@ size_t easy::write_function(char* ptr, size_t size, size_t nmemb,
   return actual_size;
 }
 
+void easy::reserve_sink() {
+  // Content-Length is known after the headers, the body of an encoded reply is
+  // larger than it, but the buffer still grows fewer times
+  native::curl_off_t length = -1;
+  if (native::curl_easy_getinfo(handle_,
+                                native::CURLINFO_CONTENT_LENGTH_DOWNLOAD_T,
+                                &length) != native::CURLE_OK ||
+      length <= 0) {
+    return;
+  }
+  sink_->reserve(static_cast<std::size_t>(std::min(length, kMaxSinkReserve)));
+}
+
 size_t easy::read_function(void* ptr, size_t size, size_t nmemb,
                            void* userdata) noexcept {
   // FIXME readsome doesn't work with TFTP (see cURL docs)
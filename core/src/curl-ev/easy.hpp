@@ -202,7 +202,9 @@ class easy final : public std::enable_shared_from_this<easy> {
 
   // Creates an initialized but unbound easy, use GetBound() for usable
   // instances. May block on resolver initialization.
-  static std::shared_ptr<const easy> CreateBlocking();
+  // The `share` is set to this handle and to the handles bound from it
+  static std::shared_ptr<const easy> CreateBlocking(
+      std::shared_ptr<share> share = {});
 
   easy(native::CURL*, multi*);
   easy(const easy&) = delete;
@@ -212,6 +214,12 @@ class easy final : public std::enable_shared_from_this<easy> {
   // resolver initialization).
   std::shared_ptr<easy> GetBoundBlocking(multi&) const;
 
+  // Makes a clone of a configured easy bound to the same multi, for another
+  // concurrent transfer of the same request. Returns nullptr for the requests
+  // that upload a form or a stream, those can not be cloned. The callbacks and
+  // the sink are not cloned. Must not be called while the easy is performing.
+  std::shared_ptr<easy> CloneBlocking() const;
+
   const multi* GetMulti() const { return multi_; }
 
   inline native::CURL* native_handle() { return handle_; }
@@ -728,6 +736,11 @@ class easy final : public std::enable_shared_from_this<easy> {
   IMPLEMENT_CURL_OPTION_GET_LONG(get_os_errno, native::CURLINFO_OS_ERRNO);
   IMPLEMENT_CURL_OPTION_GET_LONG(get_num_connects,
                                  native::CURLINFO_NUM_CONNECTS);
+
+  // Whether the TLS session of the current connection was resumed,
+  // std::nullopt for the non-TLS connections and non-OpenSSL backends.
+  // Must be called during the transfer, e.g. from the header function.
+  std::optional<bool> get_tls_session_resumed() const;
   IMPLEMENT_CURL_OPTION_GET_LIST(get_ssl_engines, native::CURLINFO_SSL_ENGINES);
   IMPLEMENT_CURL_OPTION_GET_LIST(get_cookielist, native::CURLINFO_COOKIELIST);
   IMPLEMENT_CURL_OPTION_GET_LONG(get_lastsocket, native::CURLINFO_LASTSOCKET);
@@ -807,6 +820,8 @@ class easy final : public std::enable_shared_from_this<easy> {
 
   static size_t write_function(char* ptr, size_t size, size_t nmemb,
                                void* userdata) noexcept;
+  // Reserves the sink for the whole body if its length is known
+  void reserve_sink();
   static size_t read_function(void* ptr, size_t size, size_t nmemb,
                               void* userdata) noexcept;
   static int seek_function(void* instream, native::curl_off_t offset,
@@ -0,0 +1,241 @@
+#include <userver/dist_lock/dist_lock_batcher.hpp>
+
+#include <atomic>
+#include <exception>
+#include <map>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dist_lock {
+
+namespace impl {
+
+namespace {
+
+struct Batch final {
+  std::vector<BatchLockRequest> requests;
+  std::vector<BatchLockResult> results;
+  std::exception_ptr error;
+  bool is_done{false};
+};
+
+struct CachedToken final {
+  std::uint64_t fencing_token{0};
+  std::chrono::steady_clock::time_point lease_deadline;
+};
+
+}  // namespace
+
+class BatcherState final {
+ public:
+  BatcherState(std::shared_ptr<BatchedDistLockStrategyBase> strategy,
+               const DistLockBatcherSettings& settings)
+      : strategy_(std::move(strategy)), settings_(settings) {
+    UASSERT(strategy_);
+    UASSERT(settings_.max_batch_size > 0);
+  }
+
+  BatchLockResult Acquire(std::chrono::milliseconds lock_ttl,
+                          BatchLockRequest request);
+
+  void Release(const BatchLockRequest& request);
+
+  std::optional<std::uint64_t> GetFencingToken(
+      std::string_view lock_name) const;
+
+  std::size_t GetBatchesCount() const noexcept { return batches_count_; }
+
+ private:
+  using PendingBatches =
+      std::map<std::chrono::milliseconds, std::shared_ptr<Batch>>;
+
+  void ClosePending(std::chrono::milliseconds lock_ttl, const Batch& batch);
+  void Send(std::chrono::milliseconds lock_ttl, Batch& batch) noexcept;
+
+  const std::shared_ptr<BatchedDistLockStrategyBase> strategy_;
+  const DistLockBatcherSettings settings_;
+
+  mutable engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  // Batches that accept new locks, one per lock TTL
+  PendingBatches pending_;
+  utils::impl::TransparentMap<std::string, CachedToken> tokens_;
+
+  std::atomic<std::size_t> batches_count_{0};
+};
+
+BatchLockResult BatcherState::Acquire(std::chrono::milliseconds lock_ttl,
+                                      BatchLockRequest request) {
+  // The lease could not start before the request was made
+  const auto lease_deadline = utils::datetime::SteadyNow() + lock_ttl;
+
+  std::unique_lock lock(mutex_);
+  auto& pending = pending_[lock_ttl];
+  const bool is_leader = !pending;
+  if (is_leader) pending = std::make_shared<Batch>();
+
+  const auto batch = pending;
+  const auto index = batch->requests.size();
+  batch->requests.push_back(std::move(request));
+
+  if (is_leader) {
+    // Other locks of the batch depend on this task, it must send the batch
+    // even if cancelled
+    const engine::TaskCancellationBlocker cancel_blocker;
+    [[maybe_unused]] const bool is_full = cv_.WaitUntil(
+        lock, engine::Deadline::FromDuration(settings_.batch_window), [&] {
+          return batch->requests.size() >= settings_.max_batch_size;
+        });
+    ClosePending(lock_ttl, *batch);
+
+    lock.unlock();
+    Send(lock_ttl, *batch);
+    lock.lock();
+
+    batch->is_done = true;
+    cv_.NotifyAll();
+  } else {
+    if (batch->requests.size() >= settings_.max_batch_size) {
+      ClosePending(lock_ttl, *batch);
+      cv_.NotifyAll();
+    }
+    if (!cv_.Wait(lock, [&] { return batch->is_done; })) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+  }
+
+  // requests are not modified once the batch is closed
+  const auto& lock_name = batch->requests[index].lock_name;
+  if (batch->error) {
+    tokens_.erase(lock_name);
+    std::rethrow_exception(batch->error);
+  }
+
+  const auto result = batch->results[index];
+  if (result.status == BatchLockResult::Status::kAcquired) {
+    utils::impl::TransparentInsertOrAssign(
+        tokens_, lock_name, CachedToken{result.fencing_token, lease_deadline});
+  } else {
+    tokens_.erase(lock_name);
+  }
+  return result;
+}
+
+void BatcherState::Release(const BatchLockRequest& request) {
+  {
+    const std::lock_guard lock(mutex_);
+    tokens_.erase(request.lock_name);
+  }
+  strategy_->Release(request);
+}
+
+std::optional<std::uint64_t> BatcherState::GetFencingToken(
+    std::string_view lock_name) const {
+  const std::lock_guard lock(mutex_);
+  const auto* cached =
+      utils::impl::FindTransparentOrNullptr(tokens_, lock_name);
+  if (!cached || cached->lease_deadline <= utils::datetime::SteadyNow()) {
+    return std::nullopt;
+  }
+  return cached->fencing_token;
+}
+
+void BatcherState::ClosePending(std::chrono::milliseconds lock_ttl,
+                                const Batch& batch) {
+  const auto it = pending_.find(lock_ttl);
+  if (it != pending_.end() && it->second.get() == &batch) pending_.erase(it);
+}
+
+void BatcherState::Send(std::chrono::milliseconds lock_ttl,
+                        Batch& batch) noexcept {
+  ++batches_count_;
+  try {
+    batch.results = strategy_->AcquireBatch(lock_ttl, batch.requests);
+    if (batch.results.size() != batch.requests.size()) {
+      throw std::logic_error(fmt::format(
+          "AcquireBatch returned {} results for {} distributed locks",
+          batch.results.size(), batch.requests.size()));
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Batch acquisition of " << batch.requests.size()
+                  << " distributed locks failed: " << ex;
+    batch.error = std::current_exception();
+  }
+}
+
+namespace {
+
+class BatchedLockStrategy final : public DistLockStrategyBase {
+ public:
+  BatchedLockStrategy(std::shared_ptr<BatcherState> state,
+                      std::string lock_name)
+      : state_(std::move(state)), lock_name_(std::move(lock_name)) {}
+
+  void Acquire(std::chrono::milliseconds lock_ttl,
+               const std::string& locker_id) override {
+    const auto result = state_->Acquire(lock_ttl, {lock_name_, locker_id});
+    switch (result.status) {
+      case BatchLockResult::Status::kAcquired:
+        return;
+      case BatchLockResult::Status::kBusy:
+        throw LockIsAcquiredByAnotherHostException();
+      case BatchLockResult::Status::kFailed:
+        break;
+    }
+    throw std::runtime_error(
+        fmt::format("Failed to acquire distributed lock '{}'", lock_name_));
+  }
+
+  void Release(const std::string& locker_id) override {
+    state_->Release({lock_name_, locker_id});
+  }
+
+ private:
+  const std::shared_ptr<BatcherState> state_;
+  const std::string lock_name_;
+};
+
+}  // namespace
+
+}  // namespace impl
+
+DistLockBatcher::DistLockBatcher(
+    std::shared_ptr<BatchedDistLockStrategyBase> strategy,
+    const DistLockBatcherSettings& settings)
+    : state_(std::make_shared<impl::BatcherState>(std::move(strategy),
+                                                  settings)) {}
+
+DistLockBatcher::~DistLockBatcher() = default;
+
+std::shared_ptr<DistLockStrategyBase> DistLockBatcher::MakeStrategy(
+    std::string lock_name) {
+  return std::make_shared<impl::BatchedLockStrategy>(state_,
+                                                     std::move(lock_name));
+}
+
+std::optional<std::uint64_t> DistLockBatcher::GetFencingToken(
+    std::string_view lock_name) const {
+  return state_->GetFencingToken(lock_name);
+}
+
+std::size_t DistLockBatcher::GetBatchesCount() const noexcept {
+  return state_->GetBatchesCount();
+}
+
+}  // namespace dist_lock
+
+USERVER_NAMESPACE_END
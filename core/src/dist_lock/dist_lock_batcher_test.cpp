@@ -0,0 +1,145 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/dist_lock/dist_lock_batcher.hpp>
+#include <userver/engine/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kLockTtl{1000};
+
+class MockBatchedStrategy final
+    : public dist_lock::BatchedDistLockStrategyBase {
+ public:
+  std::vector<dist_lock::BatchLockResult> AcquireBatch(
+      std::chrono::milliseconds,
+      const std::vector<dist_lock::BatchLockRequest>& requests) override {
+    if (fail_) throw std::runtime_error("backend is down");
+    max_batch_size_ = std::max(max_batch_size_.load(), requests.size());
+
+    std::vector<dist_lock::BatchLockResult> results;
+    auto owners = owners_.Lock();
+    for (const auto& request : requests) {
+      auto& owner = (*owners)[request.lock_name];
+      if (!owner.empty() && owner != request.locker_id) {
+        results.push_back({dist_lock::BatchLockResult::Status::kBusy});
+        continue;
+      }
+      if (owner.empty()) ++fencing_token_;
+      owner = request.locker_id;
+      results.push_back(
+          {dist_lock::BatchLockResult::Status::kAcquired, fencing_token_});
+    }
+    return results;
+  }
+
+  void Release(const dist_lock::BatchLockRequest& request) override {
+    auto owners = owners_.Lock();
+    auto& owner = (*owners)[request.lock_name];
+    if (owner == request.locker_id) owner.clear();
+  }
+
+  void SetOwner(const std::string& lock_name, const std::string& owner) {
+    auto owners = owners_.Lock();
+    (*owners)[lock_name] = owner;
+  }
+
+  void Fail(bool fail) { fail_ = fail; }
+
+  std::size_t GetMaxBatchSize() const { return max_batch_size_; }
+
+ private:
+  concurrent::Variable<std::unordered_map<std::string, std::string>> owners_;
+  std::uint64_t fencing_token_{0};
+  std::atomic<bool> fail_{false};
+  std::atomic<std::size_t> max_batch_size_{0};
+};
+
+}  // namespace
+
+UTEST_MT(DistLockBatcher, Batching, 4) {
+  constexpr std::size_t kLocks = 32;
+  auto backend = std::make_shared<MockBatchedStrategy>();
+  const dist_lock::DistLockBatcherSettings settings{utest::kMaxTestWaitTime,
+                                                    kLocks};
+  dist_lock::DistLockBatcher batcher{backend, settings};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t i = 0; i < kLocks; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&batcher, i] {
+      batcher.MakeStrategy("lock-" + std::to_string(i))
+          ->Acquire(kLockTtl, "locker");
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+
+  // The batch is sent as soon as it is full, long before the window ends
+  EXPECT_EQ(batcher.GetBatchesCount(), 1u);
+  EXPECT_EQ(backend->GetMaxBatchSize(), kLocks);
+  for (std::size_t i = 0; i < kLocks; ++i) {
+    EXPECT_TRUE(batcher.GetFencingToken("lock-" + std::to_string(i)));
+  }
+}
+
+UTEST(DistLockBatcher, FencingToken) {
+  auto backend = std::make_shared<MockBatchedStrategy>();
+  dist_lock::DistLockBatcher batcher{backend};
+  auto strategy = batcher.MakeStrategy("lock");
+
+  EXPECT_FALSE(batcher.GetFencingToken("lock"));
+  strategy->Acquire(kLockTtl, "me");
+  const auto token = batcher.GetFencingToken("lock");
+  ASSERT_TRUE(token);
+
+  // prolongation keeps the token
+  strategy->Acquire(kLockTtl, "me");
+  EXPECT_EQ(batcher.GetFencingToken("lock"), token);
+
+  strategy->Release("me");
+  EXPECT_FALSE(batcher.GetFencingToken("lock"));
+
+  strategy->Acquire(kLockTtl, "me");
+  EXPECT_GT(batcher.GetFencingToken("lock").value_or(0), *token);
+  strategy->Release("me");
+
+  strategy->Acquire(std::chrono::milliseconds{0}, "me");
+  EXPECT_FALSE(batcher.GetFencingToken("lock"));
+  strategy->Release("me");
+}
+
+UTEST(DistLockBatcher, Busy) {
+  auto backend = std::make_shared<MockBatchedStrategy>();
+  dist_lock::DistLockBatcher batcher{backend};
+  auto strategy = batcher.MakeStrategy("lock");
+
+  strategy->Acquire(kLockTtl, "me");
+  backend->SetOwner("lock", "other");
+  UEXPECT_THROW(strategy->Acquire(kLockTtl, "me"),
+                dist_lock::LockIsAcquiredByAnotherHostException);
+  EXPECT_FALSE(batcher.GetFencingToken("lock"));
+}
+
+UTEST(DistLockBatcher, BackendFailure) {
+  auto backend = std::make_shared<MockBatchedStrategy>();
+  dist_lock::DistLockBatcher batcher{backend};
+  auto strategy = batcher.MakeStrategy("lock");
+
+  strategy->Acquire(kLockTtl, "me");
+  backend->Fail(true);
+  UEXPECT_THROW(strategy->Acquire(kLockTtl, "me"), std::runtime_error);
+  EXPECT_FALSE(batcher.GetFencingToken("lock"));
+
+  backend->Fail(false);
+  UEXPECT_NO_THROW(strategy->Acquire(kLockTtl, "me"));
+  strategy->Release("me");
+}
+
+USERVER_NAMESPACE_END
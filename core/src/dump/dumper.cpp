@@ -574,6 +574,14 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            memory-mapped:
+                type: boolean
+                description: Whether to mmap the dump instead of reading it, incompatible with encrypted
+                defaultDescription: false
+            compressed:
+                type: boolean
+                description: Whether to compress the dump with zstd, incompatible with encrypted and memory-mapped
+                defaultDescription: false
 )");
 }
 
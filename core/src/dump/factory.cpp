@@ -1,6 +1,7 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_compressed.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
 #include <userver/storages/secdist/component.hpp>
@@ -30,15 +31,22 @@ std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
     auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
     return std::make_unique<dump::EncryptedOperationsFactory>(
         std::move(secret_key), dump_perms);
+  } else if (config.dump_is_compressed) {
+    return std::make_unique<dump::CompressedOperationsFactory>(dump_perms);
   } else {
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    return std::make_unique<dump::FileOperationsFactory>(
+        dump_perms, config.dump_is_memory_mapped);
   }
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(
     const Config& config) {
   auto dump_perms = GetPerms(config);
-  return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+  if (config.dump_is_compressed) {
+    return std::make_unique<dump::CompressedOperationsFactory>(dump_perms);
+  }
+  return std::make_unique<dump::FileOperationsFactory>(
+      dump_perms, config.dump_is_memory_mapped);
 }
 
 }  // namespace dump
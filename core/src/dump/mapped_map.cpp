@@ -0,0 +1,181 @@
+#include <userver/dump/mapped_map.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+namespace {
+
+// "USRVMAP1" in little-endian
+constexpr std::uint64_t kMagic = 0x3150414d56525355;
+
+struct Header final {
+  std::uint64_t magic;
+  std::uint64_t size;
+};
+
+struct Entry final {
+  std::uint64_t key_offset;
+  std::uint64_t key_size;
+  std::uint64_t value_offset;
+  std::uint64_t value_size;
+};
+
+static_assert(std::is_trivially_copyable_v<Header>);
+static_assert(std::is_trivially_copyable_v<Entry>);
+
+// The image may be mapped at an arbitrary offset, so the structures are
+// memcpy-ed instead of being accessed in place
+template <typename T>
+T Load(std::string_view bytes, std::size_t offset) {
+  UASSERT(offset + sizeof(T) <= bytes.size());
+  T result{};
+  std::memcpy(&result, bytes.data() + offset, sizeof(T));
+  return result;
+}
+
+template <typename T>
+void Store(std::string& bytes, std::size_t offset, const T& value) {
+  UASSERT(offset + sizeof(T) <= bytes.size());
+  std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+Entry LoadEntry(std::string_view bytes, std::size_t index) {
+  return Load<Entry>(bytes, sizeof(Header) + index * sizeof(Entry));
+}
+
+std::string_view Slice(std::string_view bytes, std::uint64_t offset,
+                       std::uint64_t size) {
+  if (offset > bytes.size() || size > bytes.size() - offset) {
+    throw Error(fmt::format(
+        "Corrupted dump::MappedMap: offset={}, size={}, image-size={}", offset,
+        size, bytes.size()));
+  }
+  return bytes.substr(offset, size);
+}
+
+SharedData MakeImage(MappedImage::Entries&& entries) {
+  std::stable_sort(
+      entries.begin(), entries.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  // keep the last one of the equal keys
+  auto unique_end = entries.begin();
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    const auto next = std::next(it);
+    if (next != entries.end() && next->first == it->first) continue;
+    *unique_end++ = *it;
+  }
+  entries.erase(unique_end, entries.end());
+
+  std::size_t total_size = sizeof(Header) + entries.size() * sizeof(Entry);
+  for (const auto& [key, value] : entries) {
+    total_size += key.size() + value.size();
+  }
+
+  auto image = std::make_shared<std::string>(total_size, '\0');
+  Store(*image, 0, Header{kMagic, entries.size()});
+
+  std::size_t data_offset = sizeof(Header) + entries.size() * sizeof(Entry);
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    const auto& [key, value] = entries[i];
+    const Entry entry{data_offset, key.size(), data_offset + key.size(),
+                      value.size()};
+    Store(*image, sizeof(Header) + i * sizeof(Entry), entry);
+
+    key.copy(image->data() + entry.key_offset, key.size());
+    value.copy(image->data() + entry.value_offset, value.size());
+    data_offset += key.size() + value.size();
+  }
+  UASSERT(data_offset == total_size);
+
+  const std::string_view bytes = *image;
+  return {std::move(image), bytes};
+}
+
+}  // namespace
+
+MappedImage::MappedImage() : MappedImage(Entries{}) {}
+
+MappedImage::MappedImage(Entries entries)
+    : data_(MakeImage(std::move(entries))),
+      size_(Load<Header>(data_.data, 0).size) {}
+
+MappedImage::MappedImage(SharedData data) : data_(std::move(data)) {
+  const auto bytes = data_.data;
+  if (bytes.size() < sizeof(Header)) {
+    throw Error(fmt::format("Corrupted dump::MappedMap: image-size={}",
+                            bytes.size()));
+  }
+
+  const auto header = Load<Header>(bytes, 0);
+  if (header.magic != kMagic) {
+    throw Error("Corrupted dump::MappedMap: unexpected magic number");
+  }
+  // Entries themselves are validated lazily on access, so that loading a map
+  // does not touch all the pages of the image
+  if (header.size > (bytes.size() - sizeof(Header)) / sizeof(Entry)) {
+    throw Error(
+        fmt::format("Corrupted dump::MappedMap: size={}, image-size={}",
+                    header.size, bytes.size()));
+  }
+  size_ = header.size;
+}
+
+std::string_view MappedImage::GetKey(std::size_t index) const {
+  UASSERT(index < size_);
+  const auto entry = LoadEntry(data_.data, index);
+  return Slice(data_.data, entry.key_offset, entry.key_size);
+}
+
+std::string_view MappedImage::GetValue(std::size_t index) const {
+  UASSERT(index < size_);
+  const auto entry = LoadEntry(data_.data, index);
+  return Slice(data_.data, entry.value_offset, entry.value_size);
+}
+
+std::optional<std::size_t> MappedImage::Find(std::string_view key) const {
+  std::size_t left = 0;
+  std::size_t right = size_;
+  while (left < right) {
+    const auto middle = left + (right - left) / 2;
+    if (GetKey(middle) < key) {
+      left = middle + 1;
+    } else {
+      right = middle;
+    }
+  }
+
+  if (left == size_ || GetKey(left) != key) return std::nullopt;
+  return left;
+}
+
+void Write(Writer& writer, const MappedImage& value) {
+  const auto bytes = value.GetBytes();
+  writer.Write(bytes.size());
+  WriteStringViewUnsafe(writer, bytes);
+}
+
+MappedImage Read(Reader& reader, To<MappedImage>) {
+  const auto size = reader.Read<std::size_t>();
+  return MappedImage{ReadSharedUnsafe(reader, size)};
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
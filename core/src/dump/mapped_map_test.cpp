@@ -0,0 +1,127 @@
+#include <userver/dump/mapped_map.hpp>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/dump/common.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/test_helpers.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct Point {
+  int x;
+  double y;
+};
+
+template <typename Value>
+std::map<std::string, Value> ToStdMap(const dump::MappedMap<Value>& map) {
+  std::map<std::string, Value> result;
+  for (const auto& [key, value] : map) {
+    result.emplace(key, value);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(DumpMappedMap, Empty) {
+  const dump::MappedMap<std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.Find(""), std::nullopt);
+
+  const auto after_cycle =
+      dump::FromBinary<dump::MappedMap<std::string>>(dump::ToBinary(map));
+  EXPECT_TRUE(after_cycle.empty());
+}
+
+TEST(DumpMappedMap, Strings) {
+  const std::unordered_map<std::string, std::string> original{
+      {"b", "bar"}, {"a", "foo"}, {"", "empty"}, {"c", ""}};
+  const dump::MappedMap<std::string> map{original};
+
+  EXPECT_EQ(map.size(), original.size());
+  EXPECT_EQ(map.Find("a"), "foo");
+  EXPECT_EQ(map.Find("b"), "bar");
+  EXPECT_EQ(map.Find(""), "empty");
+  EXPECT_EQ(map.Find("c"), "");
+  EXPECT_EQ(map.Find("d"), std::nullopt);
+  EXPECT_TRUE(map.Contains("c"));
+  EXPECT_FALSE(map.Contains("ab"));
+
+  const std::map<std::string, std::string> sorted(original.begin(),
+                                                  original.end());
+  EXPECT_EQ(ToStdMap(map), sorted);
+}
+
+TEST(DumpMappedMap, DuplicateKeys) {
+  const std::vector<std::pair<std::string, std::string>> original{
+      {"a", "1"}, {"b", "2"}, {"a", "3"}};
+  const dump::MappedMap<std::string> map{original};
+
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.Find("a"), "3");
+  EXPECT_EQ(map.Find("b"), "2");
+}
+
+TEST(DumpMappedMap, TriviallyCopyable) {
+  const std::map<std::string, Point> original{{"one", {1, 1.5}},
+                                              {"two", {2, 2.5}}};
+  const dump::MappedMap<Point> map{original};
+
+  const auto after_cycle =
+      dump::FromBinary<dump::MappedMap<Point>>(dump::ToBinary(map));
+  ASSERT_EQ(after_cycle.size(), 2);
+  const auto two = after_cycle.Find("two");
+  ASSERT_TRUE(two);
+  EXPECT_EQ(two->x, 2);
+  EXPECT_EQ(two->y, 2.5);
+}
+
+TEST(DumpMappedMap, Corrupted) {
+  EXPECT_THROW(dump::FromBinary<dump::MappedMap<int>>(
+                   dump::ToBinary(std::string(20, 'a'))),
+               dump::Error);
+}
+
+UTEST(DumpMappedMap, MemoryMappedFile) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+
+  std::unordered_map<std::string, std::string> original;
+  for (int i = 0; i < 1000; ++i) {
+    original.emplace(std::to_string(i), std::string(i, 'a'));
+  }
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(dump::MappedMap<std::string>{original});
+  writer.Write(42);
+  writer.Finish();
+
+  std::optional<dump::MappedMap<std::string>> map;
+  {
+    dump::MappedFileReader reader(path);
+    map = reader.Read<dump::MappedMap<std::string>>();
+    EXPECT_EQ(reader.Read<int>(), 42);
+    reader.Finish();
+  }
+
+  // The mapping outlives the reader
+  ASSERT_EQ(map->size(), original.size());
+  for (const auto& [key, value] : original) {
+    EXPECT_EQ(map->Find(key), value);
+  }
+}
+
+USERVER_NAMESPACE_END
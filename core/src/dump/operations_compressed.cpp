@@ -0,0 +1,369 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <compression/compressor.hpp>
+#include <compression/zstd.hpp>
+#include <userver/dump/operations_file.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <utils/crc32c.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace {
+
+constexpr std::size_t kBlockSize = 1 << 20;
+constexpr std::size_t kMaxBlocksInFlight = 8;
+constexpr int kCompressionLevel = 3;
+
+constexpr std::string_view kMagic = "USRVDZ01";
+
+// All integers are little-endian, like in the rest of the dump formats
+struct IndexEntry final {
+  std::uint64_t offset;
+  std::uint32_t compressed_size;
+  std::uint32_t raw_size;
+  std::uint32_t crc32c;
+  std::uint32_t reserved;
+};
+
+struct Trailer final {
+  std::uint64_t index_offset;
+  std::uint64_t block_count;
+  std::uint32_t index_crc32c;
+  std::uint32_t reserved;
+  char magic[8];
+};
+
+static_assert(sizeof(IndexEntry) == 24);
+static_assert(sizeof(Trailer) == 32);
+
+struct CompressedBlock final {
+  std::string payload;
+  std::uint32_t raw_size;
+  std::uint32_t crc32c;
+};
+
+template <typename T>
+std::string_view AsBytes(const T& value) {
+  return {reinterpret_cast<const char*>(&value), sizeof(value)};
+}
+
+}  // namespace
+
+struct CompressedWriter::Impl {
+  std::string path;
+  FileWriter file;
+  std::string block;
+  std::deque<engine::TaskWithResult<CompressedBlock>> in_flight;
+  std::vector<IndexEntry> index;
+  std::uint64_t offset{0};
+
+  Impl(std::string&& path, boost::filesystem::perms perms,
+       tracing::ScopeTime& scope)
+      : path(std::move(path)), file(this->path, perms, scope) {
+    block.reserve(kBlockSize);
+  }
+
+  void StartBlock() {
+    if (in_flight.size() >= kMaxBlocksInFlight) WriteCompletedBlock();
+
+    in_flight.push_back(utils::Async(
+        "dump-compress-block", [raw = std::move(block)] {
+          auto payload = compression::Compress(compression::Encoding::kZstd,
+                                               raw, kCompressionLevel);
+          const auto crc32c = utils::Crc32c(payload);
+          return CompressedBlock{std::move(payload),
+                                 static_cast<std::uint32_t>(raw.size()),
+                                 crc32c};
+        }));
+
+    block = std::string{};
+    block.reserve(kBlockSize);
+  }
+
+  void WriteCompletedBlock() {
+    UASSERT(!in_flight.empty());
+    auto compressed = [&] {
+      try {
+        return in_flight.front().Get();
+      } catch (const compression::CompressionError& ex) {
+        throw Error(fmt::format("Failed to compress the dump file \"{}\": {}",
+                                path, ex.what()));
+      }
+    }();
+    in_flight.pop_front();
+
+    WriteStringViewUnsafe(file, compressed.payload);
+    index.push_back(IndexEntry{
+        offset, static_cast<std::uint32_t>(compressed.payload.size()),
+        compressed.raw_size, compressed.crc32c, 0});
+    offset += compressed.payload.size();
+  }
+};
+
+CompressedWriter::CompressedWriter(std::string path,
+                                   boost::filesystem::perms perms,
+                                   tracing::ScopeTime& scope)
+    : impl_(std::move(path), perms, scope) {}
+
+CompressedWriter::~CompressedWriter() = default;
+
+void CompressedWriter::WriteRaw(std::string_view data) {
+  while (!data.empty()) {
+    const auto chunk_size =
+        std::min(data.size(), kBlockSize - impl_->block.size());
+    impl_->block.append(data.substr(0, chunk_size));
+    data.remove_prefix(chunk_size);
+    if (impl_->block.size() == kBlockSize) impl_->StartBlock();
+  }
+}
+
+void CompressedWriter::Finish() {
+  if (!impl_->block.empty()) impl_->StartBlock();
+  while (!impl_->in_flight.empty()) impl_->WriteCompletedBlock();
+
+  const std::string_view index_bytes{
+      reinterpret_cast<const char*>(impl_->index.data()),
+      impl_->index.size() * sizeof(IndexEntry)};
+  Trailer trailer{impl_->offset, impl_->index.size(),
+                  utils::Crc32c(index_bytes), 0, {}};
+  kMagic.copy(trailer.magic, sizeof(trailer.magic));
+
+  WriteStringViewUnsafe(impl_->file, index_bytes);
+  WriteStringViewUnsafe(impl_->file, AsBytes(trailer));
+  impl_->file.Finish();
+}
+
+struct CompressedReader::Impl {
+  std::string path;
+  fs::blocking::FileDescriptor file;
+  std::vector<IndexEntry> index;
+  std::size_t next_block{0};
+  std::deque<engine::TaskWithResult<std::string>> in_flight;
+  std::string current;
+  std::size_t current_position{0};
+  std::string chunk;
+  std::uint64_t unread_size{0};
+
+  explicit Impl(const std::string& path)
+      : path(path),
+        file(fs::blocking::FileDescriptor::Open(
+            this->path, fs::blocking::OpenFlag::kRead)) {}
+
+  std::string ReadExactly(std::uint64_t offset, std::size_t size) {
+    std::string result(size, '\0');
+    file.Seek(offset);
+    std::size_t bytes_read = 0;
+    while (bytes_read < size) {
+      const auto read = file.Read(result.data() + bytes_read, size - bytes_read);
+      if (read == 0) {
+        throw Error(fmt::format(
+            "Unexpected end-of-file in the dump file \"{}\": offset={}, "
+            "requested-size={}",
+            path, offset + bytes_read, size - bytes_read));
+      }
+      bytes_read += read;
+    }
+    return result;
+  }
+
+  void ReadIndex() {
+    const auto file_size = file.GetSize();
+    if (file_size < sizeof(Trailer)) {
+      throw Error(fmt::format(
+          "The compressed dump file \"{}\" is truncated: file-size={}", path,
+          file_size));
+    }
+
+    Trailer trailer{};
+    ReadExactly(file_size - sizeof(Trailer), sizeof(Trailer))
+        .copy(reinterpret_cast<char*>(&trailer), sizeof(Trailer));
+    if (std::string_view{trailer.magic, sizeof(trailer.magic)} != kMagic) {
+      throw Error(fmt::format(
+          "The dump file \"{}\" is not a compressed dump or is truncated",
+          path));
+    }
+
+    const auto index_end = file_size - sizeof(Trailer);
+    if (trailer.index_offset > index_end ||
+        (index_end - trailer.index_offset) / sizeof(IndexEntry) !=
+            trailer.block_count ||
+        (index_end - trailer.index_offset) % sizeof(IndexEntry) != 0) {
+      throw Error(fmt::format(
+          "Corrupted block index in the dump file \"{}\": index-offset={}, "
+          "block-count={}, file-size={}",
+          path, trailer.index_offset, trailer.block_count, file_size));
+    }
+
+    const auto index_bytes = ReadExactly(trailer.index_offset,
+                                         index_end - trailer.index_offset);
+    if (utils::Crc32c(index_bytes) != trailer.index_crc32c) {
+      throw Error(fmt::format(
+          "Checksum mismatch in the block index of the dump file \"{}\"",
+          path));
+    }
+    index.resize(trailer.block_count);
+    index_bytes.copy(reinterpret_cast<char*>(index.data()),
+                     index_bytes.size());
+
+    std::uint64_t expected_offset = 0;
+    for (const auto& entry : index) {
+      if (entry.offset != expected_offset) {
+        throw Error(fmt::format(
+            "Corrupted block index in the dump file \"{}\": block-offset={}, "
+            "expected-offset={}",
+            path, entry.offset, expected_offset));
+      }
+      expected_offset += entry.compressed_size;
+      unread_size += entry.raw_size;
+    }
+    if (expected_offset != trailer.index_offset) {
+      throw Error(fmt::format(
+          "Corrupted block index in the dump file \"{}\": blocks-end={}, "
+          "index-offset={}",
+          path, expected_offset, trailer.index_offset));
+    }
+  }
+
+  void StartDecompression() {
+    while (in_flight.size() < kMaxBlocksInFlight && next_block < index.size()) {
+      const auto block_number = next_block++;
+      const auto& entry = index[block_number];
+      in_flight.push_back(utils::Async(
+          "dump-decompress-block",
+          [this, entry, block_number,
+           payload = ReadExactly(entry.offset, entry.compressed_size)] {
+            if (utils::Crc32c(payload) != entry.crc32c) {
+              throw Error(fmt::format(
+                  "Checksum mismatch in block {} of the dump file \"{}\"",
+                  block_number, path));
+            }
+
+            std::string raw;
+            try {
+              raw = compression::zstd::Decompress(payload, entry.raw_size);
+            } catch (const compression::DecompressionError& ex) {
+              throw Error(fmt::format(
+                  "Failed to decompress block {} of the dump file \"{}\": {}",
+                  block_number, path, ex.what()));
+            }
+            if (raw.size() != entry.raw_size) {
+              throw Error(fmt::format(
+                  "Unexpected size of block {} of the dump file \"{}\": "
+                  "size={}, expected-size={}",
+                  block_number, path, raw.size(), entry.raw_size));
+            }
+            return raw;
+          }));
+    }
+  }
+
+  bool NextBlock() {
+    StartDecompression();
+    if (in_flight.empty()) return false;
+
+    current = in_flight.front().Get();
+    current_position = 0;
+    in_flight.pop_front();
+    StartDecompression();
+    return true;
+  }
+
+  std::string_view TakeFromCurrent(std::size_t max_size) {
+    const auto result =
+        std::string_view{current}.substr(current_position, max_size);
+    current_position += result.size();
+    unread_size -= result.size();
+    return result;
+  }
+};
+
+CompressedReader::CompressedReader(std::string path) : impl_([&] {
+  try {
+    return Impl{path};
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for reading \"{}\". Reason: {}", path,
+        ex.what()));
+  }
+}()) {
+  try {
+    impl_->ReadIndex();
+  } catch (const Error&) {
+    throw;
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to read from the dump file \"{}\": {}",
+                            impl_->path, ex.what()));
+  }
+}
+
+CompressedReader::~CompressedReader() = default;
+
+std::string_view CompressedReader::ReadRaw(std::size_t max_size) {
+  auto& impl = *impl_;
+  if (impl.current.size() - impl.current_position >= max_size) {
+    return impl.TakeFromCurrent(max_size);
+  }
+
+  // the requested data spans multiple blocks
+  impl.chunk.clear();
+  impl.chunk.append(impl.TakeFromCurrent(max_size));
+  try {
+    while (impl.chunk.size() < max_size && impl.NextBlock()) {
+      impl.chunk.append(impl.TakeFromCurrent(max_size - impl.chunk.size()));
+    }
+  } catch (const Error&) {
+    throw;
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to read from the dump file \"{}\": {}",
+                            impl.path, ex.what()));
+  }
+  return impl.chunk;
+}
+
+void CompressedReader::Finish() {
+  if (impl_->unread_size != 0) {
+    throw Error(fmt::format(
+        "Unexpected extra data at the end of the dump file \"{}\": "
+        "unread-size={}",
+        impl_->path, impl_->unread_size));
+  }
+}
+
+CompressedOperationsFactory::CompressedOperationsFactory(
+    boost::filesystem::perms perms)
+    : perms_(perms) {
+  if (!compression::zstd::IsSupported()) {
+    throw std::runtime_error(
+        "Dump compression requires zstd, build with USERVER_FEATURE_ZSTD=ON");
+  }
+}
+
+std::unique_ptr<Reader> CompressedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<CompressedReader>(std::move(full_path));
+}
+
+std::unique_ptr<Writer> CompressedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<CompressedWriter>(std::move(full_path), perms_,
+                                            scope);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
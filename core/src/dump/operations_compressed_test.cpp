@@ -0,0 +1,106 @@
+#include <userver/dump/operations_compressed.hpp>
+
+#include <boost/regex.hpp>
+
+#include <compression/zstd.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Spans several compression blocks
+constexpr int kItemCount = 300'000;
+
+void WriteDump(const std::string& path) {
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(path, boost::filesystem::perms::owner_all,
+                                scope_time);
+  for (int i = 0; i < kItemCount; ++i) {
+    writer.Write(std::to_string(i));
+  }
+  writer.Finish();
+}
+
+}  // namespace
+
+UTEST_MT(DumpCompressedFile, WriteRead, 4) {
+  if (!compression::zstd::IsSupported()) GTEST_SKIP();
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+  WriteDump(path);
+
+  dump::CompressedReader reader(path);
+  for (int i = 0; i < kItemCount; ++i) {
+    ASSERT_EQ(reader.Read<std::string>(), std::to_string(i));
+  }
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpCompressedFile, Empty) {
+  if (!compression::zstd::IsSupported()) GTEST_SKIP();
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::CompressedWriter writer(path, boost::filesystem::perms::owner_read,
+                                scope_time);
+  writer.Finish();
+
+  dump::CompressedReader reader(path);
+  UEXPECT_THROW(reader.Read<int>(), dump::Error);
+  UEXPECT_NO_THROW(reader.Finish());
+}
+
+UTEST(DumpCompressedFile, Underread) {
+  if (!compression::zstd::IsSupported()) GTEST_SKIP();
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+  WriteDump(path);
+
+  dump::CompressedReader reader(path);
+  EXPECT_EQ(reader.Read<std::string>(), "0");
+  UEXPECT_THROW(reader.Finish(), dump::Error);
+}
+
+UTEST(DumpCompressedFile, CorruptedBlock) {
+  if (!compression::zstd::IsSupported()) GTEST_SKIP();
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+  WriteDump(path);
+
+  auto contents = fs::blocking::ReadFileContents(path);
+  contents[10] ^= 1;
+  fs::blocking::RewriteFileContents(path, contents);
+
+  dump::CompressedReader reader(path);
+  try {
+    reader.Read<std::string>();
+  } catch (const dump::Error& ex) {
+    EXPECT_TRUE(boost::regex_search(
+        ex.what(), boost::regex{"Checksum mismatch in block 0"}))
+        << ex.what();
+    return;
+  }
+  FAIL();
+}
+
+UTEST(DumpCompressedFile, Truncated) {
+  if (!compression::zstd::IsSupported()) GTEST_SKIP();
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = dir.GetPath() + "/dump";
+  WriteDump(path);
+
+  auto contents = fs::blocking::ReadFileContents(path);
+  contents.resize(contents.size() - 1);
+  fs::blocking::RewriteFileContents(path, contents);
+
+  UEXPECT_THROW(dump::CompressedReader{path}, dump::Error);
+}
+
+USERVER_NAMESPACE_END
@@ -1,13 +1,19 @@
 #include <userver/dump/operations_file.hpp>
 
+#include <sys/mman.h>
+
 #include <algorithm>
 #include <stdexcept>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include <userver/dump/unsafe.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace dump {
@@ -116,11 +122,57 @@ void FileReader::Finish() {
   }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms)
-    : perms_(perms) {}
+MappedFileReader::MappedFileReader(std::string path) : path_(std::move(path)) {
+  try {
+    const auto file =
+        fs::blocking::FileDescriptor::Open(path_, fs::blocking::OpenFlag::kRead);
+    const auto size = file.GetSize();
+    // mmap does not accept empty mappings
+    if (size == 0) return;
+
+    void* const address = utils::CheckSyscallNotEquals(
+        ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file.GetNative(), 0),
+        MAP_FAILED, "mapping the dump file");
+    mapping_ = std::shared_ptr<const void>(address, [size](const void* ptr) {
+      ::munmap(const_cast<void*>(ptr), size);
+    });
+    data_ = std::string_view{static_cast<const char*>(address), size};
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to open the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+}
+
+std::string_view MappedFileReader::ReadRaw(std::size_t max_size) {
+  const auto result = data_.substr(position_, max_size);
+  position_ += result.size();
+  return result;
+}
+
+SharedData MappedFileReader::ReadShared(std::size_t size) {
+  const auto result = ReadStringViewUnsafe(*this, size);
+  return {mapping_, result};
+}
+
+void MappedFileReader::Finish() {
+  if (position_ != data_.size()) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, data_.size(), position_, data_.size() - position_));
+  }
+}
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms,
+                                             bool memory_mapped)
+    : perms_(perms), memory_mapped_(memory_mapped) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
     std::string full_path) {
+  if (memory_mapped_) {
+    return std::make_unique<MappedFileReader>(std::move(full_path));
+  }
   return std::make_unique<FileReader>(std::move(full_path));
 }
 
@@ -0,0 +1,35 @@
+#include <userver/dump/parallel_helpers.hpp>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump::impl {
+
+void BufferWriter::WriteRaw(std::string_view data) { data_.append(data); }
+
+void BufferWriter::Finish() {
+  // nothing to do
+}
+
+std::string BufferWriter::Extract() && { return std::move(data_); }
+
+BufferReader::BufferReader(std::string_view data) : unread_data_(data) {}
+
+std::string_view BufferReader::ReadRaw(std::size_t max_size) {
+  const auto result = unread_data_.substr(0, max_size);
+  unread_data_.remove_prefix(result.size());
+  return result;
+}
+
+void BufferReader::Finish() {
+  if (!unread_data_.empty()) {
+    throw Error(fmt::format(
+        "Unexpected extra data at the end of a dump shard: unread-size={}",
+        unread_data_.size()));
+  }
+}
+
+}  // namespace dump::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,48 @@
+#include <userver/dump/parallel_helpers.hpp>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/dump/test_helpers.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+template <typename T>
+T WriteReadParallel(const T& original, std::size_t shard_count) {
+  dump::MockWriter writer;
+  dump::WriteParallel(writer, original, shard_count);
+  dump::MockReader reader(std::move(writer).Extract());
+  auto result = dump::ReadParallel<T>(reader);
+  reader.Finish();
+  return *result;
+}
+
+}  // namespace
+
+UTEST_MT(DumpParallelHelpers, Vector, 4) {
+  std::vector<std::string> original;
+  for (int i = 0; i < 1000; ++i) original.push_back(std::to_string(i));
+
+  for (const std::size_t shard_count : {1, 3, 4, 1000, 2000}) {
+    EXPECT_EQ(WriteReadParallel(original, shard_count), original);
+  }
+}
+
+UTEST_MT(DumpParallelHelpers, UnorderedMap, 4) {
+  std::unordered_map<int, std::string> original;
+  for (int i = 0; i < 1000; ++i) original.emplace(i, std::to_string(i));
+
+  EXPECT_EQ(WriteReadParallel(original, 7), original);
+}
+
+UTEST(DumpParallelHelpers, Empty) {
+  const std::map<std::string, int> original;
+  EXPECT_EQ(WriteReadParallel(original, 4), original);
+}
+
+USERVER_NAMESPACE_END
@@ -6,6 +6,7 @@
 #include <userver/dynamic_config/source.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
+#include <userver/dynamic_config/value.hpp>
 #include <userver/formats/json/serialize.hpp>
 
 using namespace std::chrono_literals;
@@ -504,6 +505,32 @@ UTEST(DynamicConfig, JsonConfig) {
   EXPECT_EQ(snapshot[kJsonConfig], kJson);
 }
 
+UTEST(DynamicConfig, ParseChangedOnly) {
+  using dynamic_config::impl::ConfigIdGetter;
+  using dynamic_config::impl::SnapshotData;
+
+  const auto docs = dynamic_config::impl::MakeDefaultDocsMap();
+  const SnapshotData previous(docs, {});
+
+  const SnapshotData unchanged(docs, previous, docs);
+  EXPECT_EQ(unchanged.GetParsedCount(), 0);
+
+  auto new_docs = docs;
+  new_docs.Set("SAMPLE_STRUCT_CONFIG", formats::json::FromString(R"(
+    {"is_foo_enabled": true, "bar_period_ms": 42000}
+  )"));
+  const SnapshotData current(new_docs, previous, docs);
+  EXPECT_EQ(current.GetParsedCount(), 1);
+
+  const auto struct_id = ConfigIdGetter::Get(kSampleStructConfig);
+  EXPECT_FALSE(current.IsSameConfig(previous, struct_id));
+  EXPECT_TRUE(current.Get<SampleStructConfig>(struct_id).is_foo_enabled);
+
+  const auto dummy_id = ConfigIdGetter::Get(kDummyConfig);
+  EXPECT_TRUE(current.IsSameConfig(previous, dummy_id));
+  EXPECT_EQ(current.Get<DummyConfig>(dummy_id).foo, 42);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -1,14 +1,18 @@
 #include <userver/dynamic_config/impl/snapshot.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/dynamic_config/exception.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/utils/cpu_relax.hpp>
-#include <userver/utils/enumerate.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 #include <userver/utils/impl/static_registration.hpp>
 
+#include <utils/internal_tag.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace dynamic_config::impl {
@@ -112,7 +116,8 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   user_configs_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    user_configs_[config_variable.GetId()] =
+        std::make_shared<const Config>(Config{config_variable.GetValue(), {}});
   }
 }
 
@@ -120,16 +125,10 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
                            const std::vector<KeyValue>& overrides)
     : SnapshotData(overrides) {
   utils::StreamingCpuRelax relax(1, nullptr);
-  for (const auto [id, metadata] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+    if (!user_configs_[id]) {
       relax.Relax(1);
-      try {
-        user_configs_[id] = metadata.factory(defaults);
-      } catch (const std::exception& ex) {
-        throw ConfigParseError(
-            fmt::format("{} while parsing dynamic config values. {}",
-                        compiler::GetTypeName(typeid(ex)), ex.what()));
-      }
+      Parse(id, defaults);
     }
   }
 }
@@ -139,21 +138,73 @@ SnapshotData::SnapshotData(const SnapshotData& defaults,
     : SnapshotData(overrides) {
   if (defaults.IsEmpty()) return;
 
-  for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (user_configs_[id].has_value()) continue;
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+    if (user_configs_[id]) continue;
     user_configs_[id] = defaults.user_configs_[id];
   }
 }
 
+SnapshotData::SnapshotData(const DocsMap& docs, const SnapshotData& previous,
+                           const DocsMap& previous_docs)
+    : SnapshotData(std::vector<KeyValue>{}) {
+  const auto is_doc_changed = [&](const std::string& name) {
+    const bool has_doc = docs.Has(name);
+    if (has_doc != previous_docs.Has(name)) return true;
+    // Also marks the doc as used in `docs`, as the shared config uses it
+    return has_doc && docs.Get(name) != previous_docs.Get(name);
+  };
+
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (ConfigId id = 0; id < user_configs_.size(); ++id) {
+    const auto* previous_config =
+        previous.IsEmpty() ? nullptr : previous.user_configs_[id].get();
+    if (previous_config && previous_config->docs_names) {
+      const auto& names = *previous_config->docs_names;
+      if (std::none_of(names.begin(), names.end(), is_doc_changed)) {
+        user_configs_[id] = previous.user_configs_[id];
+        continue;
+      }
+    }
+
+    relax.Relax(1);
+    Parse(id, docs);
+  }
+}
+
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
+bool SnapshotData::IsSameConfig(const SnapshotData& other,
+                                ConfigId id) const noexcept {
+  return id < user_configs_.size() && id < other.user_configs_.size() &&
+         user_configs_[id] && user_configs_[id] == other.user_configs_[id];
+}
+
 const std::any& SnapshotData::DoGet(ConfigId id) const {
   UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config || !config->value.has_value()) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  return config->value;
+}
+
+void SnapshotData::Parse(ConfigId id, const DocsMap& docs) {
+  std::vector<std::string> docs_names;
+  docs.SetUsedNamesRecorder(&docs_names, utils::InternalTag{});
+  const utils::FastScopeGuard reset_recorder([&docs]() noexcept {
+    docs.SetUsedNamesRecorder(nullptr, utils::InternalTag{});
+  });
+
+  try {
+    auto value = Registry()[id].factory(docs);
+    user_configs_[id] = std::make_shared<const Config>(
+        Config{std::move(value), std::move(docs_names)});
+    ++parsed_count_;
+  } catch (const std::exception& ex) {
+    throw ConfigParseError(
+        fmt::format("{} while parsing dynamic config values. {}",
+                    compiler::GetTypeName(typeid(ex)), ex.what()));
+  }
 }
 
 }  // namespace dynamic_config::impl
@@ -87,6 +87,10 @@ class DynamicConfig::Impl final {
   engine::TaskProcessor* fs_task_processor_;
 
   dynamic_config::impl::StorageData cache_;
+  // Docs of the config in cache_, only the configs that read the changed docs
+  // are parsed on update
+  engine::Mutex update_mutex_;
+  dynamic_config::DocsMap current_docs_;
   std::string fs_loading_error_msg_;
   dynamic_config::DocsMap fallback_config_;
 
@@ -181,7 +185,8 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
     const dynamic_config::DocsMap& value) {
   try {
-    dynamic_config::impl::SnapshotData config(value, {});
+    const auto previous = cache_.Read();
+    dynamic_config::impl::SnapshotData config(value, *previous, current_docs_);
     stats_.was_last_parse_successful = true;
     alert_storage_.StopAlertNow("config_parse_error");
     return config;
@@ -197,7 +202,10 @@ dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
 }
 
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
+  const std::lock_guard lock(update_mutex_);
   auto config = ParseConfig(value);
+  LOG_DEBUG() << "Parsed " << config.GetParsedCount()
+              << " dynamic configs affected by the update";
 
   if (!value.GetConfigsExpectedToBeUsed(utils::InternalTag{}).empty()) {
     LOG_INFO() << "Some configs expected to be used are actually not needed: "
@@ -212,6 +220,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
     loaded_cv_.NotifyAll();
   };
   cache_.Update(std::move(config), std::move(after_assign_hook));
+  current_docs_ = value;
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater,
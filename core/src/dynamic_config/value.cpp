@@ -23,11 +23,13 @@ formats::json::Value DocsMap::Get(std::string_view name) const {
   if (used_it != configs_to_be_used_.end()) {
     configs_to_be_used_.erase(used_it);
   }
+  if (used_names_recorder_) used_names_recorder_->push_back(it->first);
 
   return it->second;
 }
 
 bool DocsMap::Has(std::string_view name) const {
+  if (used_names_recorder_) used_names_recorder_->emplace_back(name);
   return utils::impl::FindTransparent(docs_, name) != docs_.end();
 }
 
@@ -92,6 +94,11 @@ DocsMap::GetConfigsExpectedToBeUsed(utils::InternalTag) const {
   return configs_to_be_used_;
 }
 
+void DocsMap::SetUsedNamesRecorder(std::vector<std::string>* names,
+                                   utils::InternalTag) const {
+  used_names_recorder_ = names;
+}
+
 namespace impl {
 
 [[noreturn]] void ThrowNoValueException(std::string_view dict_name,
@@ -3,7 +3,12 @@
 #include <algorithm>  // for std::max
 #include <atomic>
 #include <cerrno>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include <moodycamel/concurrentqueue.h>
 
@@ -14,6 +19,7 @@
 
 #include "pool_config.hpp"
 #include "pool_stats.hpp"
+#include "stack_usage_monitor.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -34,18 +40,32 @@ class Pool final {
   void PutCoroutine(CoroutinePtr&& coroutine_ptr);
   PoolStats GetStats() const;
   std::size_t GetStackSize() const;
+  const PoolConfig& GetConfig() const noexcept;
+
+  StackUsageMonitor& GetStackUsageMonitor() noexcept;
+  const StackUsageMonitor& GetStackUsageMonitor() const noexcept;
 
  private:
+  class LocalCache;
+
   Coroutine CreateCoroutine(bool quiet = false);
   void OnCoroutineDestruction() noexcept;
 
   template <typename Token>
   Token& GetUsedPoolToken();
 
+  LocalCache* GetLocalCache();
+  void RefillLocalCache(LocalCache& cache);
+  void FlushLocalCache(LocalCache& cache, std::size_t count) noexcept;
+  void PutCoroutineShared(Coroutine&& coroutine,
+                          moodycamel::ProducerToken* token) noexcept;
+  void UnregisterLocalCache(LocalCache& cache) noexcept;
+
   const PoolConfig config_;
   const Executor executor_;
 
   boost::coroutines2::protected_fixedsize_stack stack_allocator_;
+  StackUsageMonitor stack_usage_monitor_;
 
   // We aim to reuse coroutines as much as possible,
   // because since coroutine stack is a mmap-ed chunk of memory and not actually
@@ -58,6 +78,16 @@ class Pool final {
 
   std::atomic<std::size_t> idle_coroutines_num_;
   std::atomic<std::size_t> total_coroutines_num_;
+
+  // Per-thread caches in front of the shared queues, so that short tasks do
+  // not contend on the shared structures. The mutex guards the list of
+  // caches, the counters of the exited threads and the binding of the caches
+  // to the pools, all of them change rarely. It is shared by all the pools,
+  // because an exiting thread may not lock a mutex of a destroyed pool.
+  static inline std::mutex local_caches_mutex_;
+  std::vector<LocalCache*> local_caches_;
+  std::uint64_t exited_local_cache_hits_{0};
+  std::uint64_t exited_local_cache_misses_{0};
 };
 
 template <typename Task>
@@ -89,11 +119,39 @@ class Pool<Task>::CoroutinePtr final {
   Pool<Task>* pool_;
 };
 
+template <typename Task>
+class Pool<Task>::LocalCache final {
+ public:
+  LocalCache() = default;
+  LocalCache(const LocalCache&) = delete;
+  LocalCache& operator=(const LocalCache&) = delete;
+
+  // Gives the cached coroutines back on thread exit. Caches of the threads
+  // that outlive the pool are detached by the pool destructor.
+  ~LocalCache() {
+    std::lock_guard lock(local_caches_mutex_);
+    auto* const bound_pool = pool.load(std::memory_order_relaxed);
+    if (bound_pool) bound_pool->UnregisterLocalCache(*this);
+  }
+
+  // The pool that the cache of the current thread is bound to, only changes
+  // under local_caches_mutex_
+  std::atomic<Pool<Task>*> pool{nullptr};
+  std::vector<Coroutine> coroutines;
+
+  // Only written by the owning thread
+  std::atomic<std::size_t> size{0};
+  std::atomic<std::uint64_t> hits{0};
+  std::atomic<std::uint64_t> misses{0};
+};
+
 template <typename Task>
 Pool<Task>::Pool(PoolConfig config, Executor executor)
     : config_(std::move(config)),
       executor_(executor),
       stack_allocator_(config_.stack_size),
+      stack_usage_monitor_(config_.stack_size,
+                           config_.stack_usage_sample_every),
       initial_coroutines_(config_.initial_size),
       used_coroutines_(config_.max_size),
       idle_coroutines_num_(config_.initial_size),
@@ -107,10 +165,41 @@ Pool<Task>::Pool(PoolConfig config, Executor executor)
 }
 
 template <typename Task>
-Pool<Task>::~Pool() = default;
+Pool<Task>::~Pool() {
+  // The pool is not used concurrently with its destruction, so the caches of
+  // the alive threads may be safely cleared from here
+  std::lock_guard lock(local_caches_mutex_);
+  for (auto* cache : local_caches_) {
+    for (auto& coroutine : cache->coroutines) {
+      [[maybe_unused]] const Coroutine destroyed = std::move(coroutine);
+    }
+    cache->coroutines.clear();
+    cache->size.store(0, std::memory_order_relaxed);
+    cache->hits.store(0, std::memory_order_relaxed);
+    cache->misses.store(0, std::memory_order_relaxed);
+    cache->pool.store(nullptr, std::memory_order_relaxed);
+  }
+}
 
 template <typename Task>
 typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
+  if (auto* cache = GetLocalCache()) {
+    auto& counter = cache->coroutines.empty() ? cache->misses : cache->hits;
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+
+    if (cache->coroutines.empty()) RefillLocalCache(*cache);
+    if (cache->coroutines.empty()) {
+      return CoroutinePtr(CreateCoroutine(), *this);
+    }
+
+    // LIFO: the most recently used stack is the most likely to be hot
+    Coroutine coroutine = std::move(cache->coroutines.back());
+    cache->coroutines.pop_back();
+    cache->size.store(cache->coroutines.size(), std::memory_order_relaxed);
+    return CoroutinePtr(std::move(coroutine), *this);
+  }
+
   struct CoroutineMover {
     std::optional<Coroutine>& result;
 
@@ -138,6 +227,16 @@ typename Pool<Task>::CoroutinePtr Pool<Task>::GetCoroutine() {
 
 template <typename Task>
 void Pool<Task>::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
+  if (auto* cache = GetLocalCache()) {
+    if (cache->coroutines.size() >= config_.local_cache_size) {
+      // Give the older half back to the shared pool, keep the hot stacks
+      FlushLocalCache(*cache, (cache->coroutines.size() + 1) / 2);
+    }
+    cache->coroutines.push_back(std::move(coroutine_ptr.Get()));
+    cache->size.store(cache->coroutines.size(), std::memory_order_relaxed);
+    return;
+  }
+
   if (idle_coroutines_num_.load() >= config_.max_size) return;
   auto& token = GetUsedPoolToken<moodycamel::ProducerToken>();
   const bool ok =
@@ -149,11 +248,23 @@ void Pool<Task>::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
 template <typename Task>
 PoolStats Pool<Task>::GetStats() const {
   PoolStats stats;
-  stats.active_coroutines =
-      total_coroutines_num_.load() -
-      (used_coroutines_.size_approx() + initial_coroutines_.size_approx());
-  stats.total_coroutines =
-      std::max(total_coroutines_num_.load(), stats.active_coroutines);
+  std::size_t locally_cached = 0;
+  {
+    std::lock_guard lock(local_caches_mutex_);
+    stats.local_cache_hits = exited_local_cache_hits_;
+    stats.local_cache_misses = exited_local_cache_misses_;
+    for (const auto* cache : local_caches_) {
+      locally_cached += cache->size.load(std::memory_order_relaxed);
+      stats.local_cache_hits += cache->hits.load(std::memory_order_relaxed);
+      stats.local_cache_misses += cache->misses.load(std::memory_order_relaxed);
+    }
+  }
+
+  const auto total = total_coroutines_num_.load();
+  const auto idle = used_coroutines_.size_approx() +
+                    initial_coroutines_.size_approx() + locally_cached;
+  stats.active_coroutines = total > idle ? total - idle : 0;
+  stats.total_coroutines = std::max(total, stats.active_coroutines);
   return stats;
 }
 
@@ -194,6 +305,21 @@ std::size_t Pool<Task>::GetStackSize() const {
   return config_.stack_size;
 }
 
+template <typename Task>
+const PoolConfig& Pool<Task>::GetConfig() const noexcept {
+  return config_;
+}
+
+template <typename Task>
+StackUsageMonitor& Pool<Task>::GetStackUsageMonitor() noexcept {
+  return stack_usage_monitor_;
+}
+
+template <typename Task>
+const StackUsageMonitor& Pool<Task>::GetStackUsageMonitor() const noexcept {
+  return stack_usage_monitor_;
+}
+
 template <typename Task>
 template <typename Token>
 Token& Pool<Task>::GetUsedPoolToken() {
@@ -201,6 +327,87 @@ Token& Pool<Task>::GetUsedPoolToken() {
   return token;
 }
 
+template <typename Task>
+typename Pool<Task>::LocalCache* Pool<Task>::GetLocalCache() {
+  if (config_.local_cache_size == 0) return nullptr;
+
+  thread_local LocalCache cache;
+  if (!cache.pool.load(std::memory_order_relaxed)) {
+    // The thread cache is bound to the first alive pool used by the thread
+    cache.coroutines.reserve(config_.local_cache_size);
+    std::lock_guard lock(local_caches_mutex_);
+    cache.pool.store(this, std::memory_order_relaxed);
+    local_caches_.push_back(&cache);
+  }
+  return cache.pool.load(std::memory_order_relaxed) == this ? &cache : nullptr;
+}
+
+template <typename Task>
+void Pool<Task>::RefillLocalCache(LocalCache& cache) {
+  const auto batch_size =
+      std::max<std::size_t>(config_.local_cache_size / 2, 1);
+
+  auto dequeued = used_coroutines_.try_dequeue_bulk(
+      GetUsedPoolToken<moodycamel::ConsumerToken>(),
+      std::back_inserter(cache.coroutines), batch_size);
+  if (dequeued < batch_size) {
+    dequeued += initial_coroutines_.try_dequeue_bulk(
+        std::back_inserter(cache.coroutines), batch_size - dequeued);
+  }
+  if (dequeued) idle_coroutines_num_ -= dequeued;
+  cache.size.store(cache.coroutines.size(), std::memory_order_relaxed);
+}
+
+template <typename Task>
+void Pool<Task>::FlushLocalCache(LocalCache& cache,
+                                 std::size_t count) noexcept {
+  UASSERT(count <= cache.coroutines.size());
+  const auto first = cache.coroutines.begin();
+  auto& token = GetUsedPoolToken<moodycamel::ProducerToken>();
+  for (auto it = first; it != first + count; ++it) {
+    PutCoroutineShared(std::move(*it), &token);
+  }
+  cache.coroutines.erase(first, first + count);
+  cache.size.store(cache.coroutines.size(), std::memory_order_relaxed);
+}
+
+template <typename Task>
+void Pool<Task>::PutCoroutineShared(
+    Coroutine&& coroutine, moodycamel::ProducerToken* token) noexcept {
+  if (idle_coroutines_num_.load() < config_.max_size) {
+    const bool ok = token
+                        ? used_coroutines_.enqueue(*token, std::move(coroutine))
+                        : used_coroutines_.enqueue(std::move(coroutine));
+    if (ok) {
+      ++idle_coroutines_num_;
+      return;
+    }
+  }
+
+  // Same as for a CoroutinePtr that was not put back into the pool
+  [[maybe_unused]] const Coroutine destroyed = std::move(coroutine);
+  OnCoroutineDestruction();
+}
+
+template <typename Task>
+void Pool<Task>::UnregisterLocalCache(LocalCache& cache) noexcept {
+  // Called on thread exit under local_caches_mutex_, so the pool may not
+  // detach the cache concurrently. The thread-local tokens may be already
+  // destroyed.
+  for (auto& coroutine : cache.coroutines) {
+    PutCoroutineShared(std::move(coroutine), nullptr);
+  }
+  cache.coroutines.clear();
+  cache.size.store(0, std::memory_order_relaxed);
+  cache.pool.store(nullptr, std::memory_order_relaxed);
+
+  exited_local_cache_hits_ += cache.hits.load(std::memory_order_relaxed);
+  exited_local_cache_misses_ += cache.misses.load(std::memory_order_relaxed);
+  local_caches_.erase(
+      std::remove(local_caches_.begin(), local_caches_.end(), &cache),
+      local_caches_.end());
+}
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -13,6 +13,8 @@ struct PoolConfig {
   std::size_t initial_size = 1000;
   std::size_t max_size = 4000;
   std::size_t stack_size = 256 * 1024ULL;
+  std::size_t local_cache_size = 32;
+  std::size_t stack_usage_sample_every = 0;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value,
@@ -0,0 +1,124 @@
+#include <engine/coro/pool.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct DummyTask {};
+
+using Pool = engine::coro::Pool<DummyTask>;
+
+constexpr std::size_t kCacheSize = 4;
+constexpr std::size_t kCoroutines = 16;
+
+void DummyExecutor(Pool::TaskPipe& task_pipe) {
+  for ([[maybe_unused]] auto* task : task_pipe) {
+  }
+}
+
+engine::coro::PoolConfig MakeConfig(std::size_t local_cache_size) {
+  engine::coro::PoolConfig config;
+  config.initial_size = 2;
+  config.max_size = 100;
+  config.stack_size = 64 * 1024;
+  config.local_cache_size = local_cache_size;
+  return config;
+}
+
+void RunInThread(std::function<void()> func) { std::thread(func).join(); }
+
+}  // namespace
+
+TEST(CoroPool, LocalCacheHits) {
+  Pool pool(MakeConfig(kCacheSize), &DummyExecutor);
+
+  RunInThread([&pool] {
+    for (int i = 0; i < 10; ++i) {
+      auto coroutine = pool.GetCoroutine();
+      EXPECT_EQ(pool.GetStats().active_coroutines, 1);
+      pool.PutCoroutine(std::move(coroutine));
+    }
+
+    const auto stats = pool.GetStats();
+    EXPECT_EQ(stats.local_cache_misses, 1);
+    EXPECT_EQ(stats.local_cache_hits, 9);
+    EXPECT_EQ(stats.active_coroutines, 0);
+  });
+
+  // The cache of the exited thread is given back to the shared pool
+  const auto stats = pool.GetStats();
+  EXPECT_EQ(stats.local_cache_misses, 1);
+  EXPECT_EQ(stats.local_cache_hits, 9);
+  EXPECT_EQ(stats.active_coroutines, 0);
+  EXPECT_EQ(stats.total_coroutines, 2);
+}
+
+TEST(CoroPool, LocalCacheRebalancing) {
+  Pool pool(MakeConfig(kCacheSize), &DummyExecutor);
+
+  RunInThread([&pool] {
+    std::vector<Pool::CoroutinePtr> coroutines;
+    for (std::size_t i = 0; i < kCoroutines; ++i) {
+      coroutines.push_back(pool.GetCoroutine());
+    }
+    EXPECT_EQ(pool.GetStats().active_coroutines, kCoroutines);
+    EXPECT_EQ(pool.GetStats().total_coroutines, kCoroutines);
+
+    for (auto& coroutine : coroutines) pool.PutCoroutine(std::move(coroutine));
+    coroutines.clear();
+
+    const auto stats = pool.GetStats();
+    EXPECT_EQ(stats.active_coroutines, 0);
+    EXPECT_EQ(stats.total_coroutines, kCoroutines);
+  });
+
+  // Another thread gets the coroutines flushed by the first one
+  RunInThread([&pool] {
+    std::vector<Pool::CoroutinePtr> coroutines;
+    for (std::size_t i = 0; i < kCoroutines; ++i) {
+      coroutines.push_back(pool.GetCoroutine());
+    }
+    EXPECT_EQ(pool.GetStats().total_coroutines, kCoroutines);
+    for (auto& coroutine : coroutines) pool.PutCoroutine(std::move(coroutine));
+  });
+
+  EXPECT_EQ(pool.GetStats().active_coroutines, 0);
+}
+
+TEST(CoroPool, LocalCacheDisabled) {
+  Pool pool(MakeConfig(0), &DummyExecutor);
+
+  RunInThread([&pool] {
+    for (int i = 0; i < 10; ++i) {
+      pool.PutCoroutine(pool.GetCoroutine());
+    }
+  });
+
+  const auto stats = pool.GetStats();
+  EXPECT_EQ(stats.local_cache_hits, 0);
+  EXPECT_EQ(stats.local_cache_misses, 0);
+  EXPECT_EQ(stats.active_coroutines, 0);
+  EXPECT_EQ(stats.total_coroutines, 2);
+}
+
+TEST(CoroPool, LocalCacheOutlivesPool) {
+  RunInThread([] {
+    for (int i = 0; i < 3; ++i) {
+      Pool pool(MakeConfig(kCacheSize), &DummyExecutor);
+      pool.PutCoroutine(pool.GetCoroutine());
+      pool.PutCoroutine(pool.GetCoroutine());
+
+      // The thread cache is rebound to the new pool
+      const auto stats = pool.GetStats();
+      EXPECT_EQ(stats.local_cache_misses, 1);
+      EXPECT_EQ(stats.local_cache_hits, 1);
+    }
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <engine/coro/stack_usage_monitor.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+namespace {
+
+constexpr std::array<double, 10> kUsageBoundsKiB{4,  8,   16,  32,  64,
+                                                 128, 256, 512, 1024, 4096};
+
+// Enough for an 8 MiB stack with 4 KiB pages
+constexpr std::size_t kMaxPages = 2048;
+
+std::size_t GetPageSize() noexcept {
+  static const auto kPageSize =
+      static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  return kPageSize;
+}
+
+}  // namespace
+
+StackUsageMonitor::StackUsageMonitor(std::size_t stack_size,
+                                     std::size_t sample_every)
+    : stack_size_(stack_size),
+      sample_every_(sample_every),
+      usage_histogram_(kUsageBoundsKiB) {}
+
+void StackUsageMonitor::AccountStackUsage(const void* stack_top) noexcept {
+  if (!IsEnabled()) return;
+
+  thread_local std::size_t calls_count = 0;
+  if (++calls_count < sample_every_) return;
+  calls_count = 0;
+
+  const auto usage = MeasureStackUsage(stack_top, stack_size_);
+  if (!usage) return;
+
+  usage_histogram_.Account(static_cast<double>(*usage) / 1024);
+
+  auto max_usage = max_usage_.load(std::memory_order_relaxed);
+  while (max_usage < *usage &&
+         !max_usage_.compare_exchange_weak(max_usage, *usage,
+                                           std::memory_order_relaxed)) {
+  }
+}
+
+std::optional<std::size_t> StackUsageMonitor::MeasureStackUsage(
+    const void* stack_top, std::size_t stack_size) noexcept {
+  const auto page_size = GetPageSize();
+  const auto pages = (stack_size + page_size - 1) / page_size;
+  if (pages == 0 || pages > kMaxPages) return std::nullopt;
+
+  // Stacks grow down and the top of the stack mapping is page aligned
+  const auto top = (reinterpret_cast<std::uintptr_t>(stack_top) + page_size) /
+                   page_size * page_size;
+  const auto bottom = top - pages * page_size;
+
+#ifdef __APPLE__
+  using ResidencyVector = char;
+#else
+  using ResidencyVector = unsigned char;
+#endif
+  std::array<ResidencyVector, kMaxPages> residency{};
+  // NOLINTNEXTLINE(performance-no-int-to-ptr)
+  if (::mincore(reinterpret_cast<void*>(bottom), pages * page_size,
+                residency.data()) != 0) {
+    return std::nullopt;
+  }
+
+  for (std::size_t i = 0; i < pages; ++i) {
+    if (residency[i] & 1) return (pages - i) * page_size;
+  }
+  return 0;
+}
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+#include <userver/utils/statistics/histogram.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::coro {
+
+/// Samples the high-water marks of coroutine stacks. The usage is measured by
+/// checking which pages of the stack are resident (mincore), so it is the
+/// maximum usage over the lifetime of the stack, not of the last task.
+class StackUsageMonitor final {
+ public:
+  /// @param sample_every measure each N-th call to AccountStackUsage on each
+  /// thread, 0 disables the monitor
+  StackUsageMonitor(std::size_t stack_size, std::size_t sample_every);
+
+  bool IsEnabled() const noexcept { return sample_every_ != 0; }
+
+  /// Must be called from within the coroutine, `stack_top` is an address in
+  /// the topmost page of the coroutine stack.
+  void AccountStackUsage(const void* stack_top) noexcept;
+
+  /// Histogram of sampled stack usage, in KiB
+  const utils::statistics::Histogram& GetUsageHistogram() const noexcept {
+    return usage_histogram_;
+  }
+
+  /// Max sampled stack usage, in bytes
+  std::size_t GetMaxUsage() const noexcept { return max_usage_.load(); }
+
+  /// Returns the high-water mark of the stack in bytes or std::nullopt if
+  /// the residency of the stack pages can not be checked.
+  static std::optional<std::size_t> MeasureStackUsage(
+      const void* stack_top, std::size_t stack_size) noexcept;
+
+ private:
+  const std::size_t stack_size_;
+  const std::size_t sample_every_;
+  utils::statistics::Histogram usage_histogram_;
+  std::atomic<std::size_t> max_usage_{0};
+};
+
+}  // namespace engine::coro
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,82 @@
+#include <engine/coro/stack_usage_monitor.hpp>
+
+#include <cstring>
+#include <functional>
+
+#include <engine/coro/pool.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kStackSize = 256 * 1024;
+constexpr std::size_t kTouchedSize = 128 * 1024;
+
+struct FunctionTask {
+  std::function<void(const void* stack_top)> func;
+};
+
+using Pool = engine::coro::Pool<FunctionTask>;
+
+void FunctionExecutor(Pool::TaskPipe& task_pipe) {
+  const void* const stack_top = __builtin_frame_address(0);
+  for (auto* task : task_pipe) {
+    task->func(stack_top);
+  }
+}
+
+engine::coro::PoolConfig MakeConfig() {
+  engine::coro::PoolConfig config;
+  config.initial_size = 0;
+  config.max_size = 10;
+  config.stack_size = kStackSize;
+  return config;
+}
+
+[[gnu::noinline]] void TouchStack(std::size_t size) {
+  auto* volatile buffer = static_cast<char*>(__builtin_alloca(size));
+  std::memset(buffer, 1, size);
+}
+
+std::optional<std::size_t> MeasureInCoroutine(Pool& pool,
+                                              std::size_t touch_size) {
+  std::optional<std::size_t> result;
+  FunctionTask task{[&](const void* stack_top) {
+    if (touch_size) TouchStack(touch_size);
+    result = engine::coro::StackUsageMonitor::MeasureStackUsage(stack_top,
+                                                               kStackSize);
+  }};
+
+  auto coroutine = pool.GetCoroutine();
+  coroutine.Get()(&task);
+  return result;
+}
+
+}  // namespace
+
+TEST(StackUsageMonitor, Measure) {
+  Pool pool(MakeConfig(), &FunctionExecutor);
+
+  const auto idle_usage = MeasureInCoroutine(pool, 0);
+  const auto busy_usage = MeasureInCoroutine(pool, kTouchedSize);
+#ifdef __linux__
+  ASSERT_TRUE(idle_usage);
+  ASSERT_TRUE(busy_usage);
+  EXPECT_LT(*idle_usage, kTouchedSize);
+  EXPECT_GE(*busy_usage, kTouchedSize);
+  EXPECT_LE(*busy_usage, kStackSize);
+#endif
+}
+
+TEST(StackUsageMonitor, Disabled) {
+  engine::coro::StackUsageMonitor monitor(kStackSize, 0);
+  EXPECT_FALSE(monitor.IsEnabled());
+
+  int local = 0;
+  monitor.AccountStackUsage(&local);
+  EXPECT_EQ(monitor.GetMaxUsage(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,140 @@
+#include <userver/engine/distributed_shared_mutex.hpp>
+
+#include <mutex>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+std::size_t GetThreadSlotIndex(std::size_t slot_count) noexcept {
+  static std::atomic<std::size_t> next_index{0};
+  thread_local const std::size_t index =
+      next_index.fetch_add(1, std::memory_order_relaxed);
+  return index % slot_count;
+}
+
+}  // namespace
+
+DistributedSharedMutex::DistributedSharedMutex() = default;
+
+DistributedSharedMutex::~DistributedSharedMutex() {
+  UASSERT_MSG(!HasReaders(), "DistributedSharedMutex is destroyed while used");
+}
+
+void DistributedSharedMutex::lock() {
+  TaskCancellationBlocker blocker;
+  const auto ok = try_lock_until(Deadline{});
+  UASSERT(ok);
+}
+
+void DistributedSharedMutex::unlock() {
+  UASSERT_MSG(has_writer_.load(), "unlock without lock");
+  ReleaseWriter();
+  writers_mutex_.unlock();
+}
+
+bool DistributedSharedMutex::try_lock() {
+  if (!writers_mutex_.try_lock()) return false;
+
+  has_writer_.store(true);
+  if (!HasReaders()) return true;
+
+  ReleaseWriter();
+  writers_mutex_.unlock();
+  return false;
+}
+
+bool DistributedSharedMutex::try_lock_until(Deadline deadline) {
+  if (!writers_mutex_.try_lock_until(deadline)) return false;
+
+  // Pairs with the increment in try_lock_shared: either the reader sees
+  // the writer, or the writer sees the reader
+  has_writer_.store(true);
+  if (WaitForReadersToDrain(deadline)) return true;
+
+  ReleaseWriter();
+  writers_mutex_.unlock();
+  return false;
+}
+
+void DistributedSharedMutex::lock_shared() {
+  TaskCancellationBlocker blocker;
+  const auto ok = try_lock_shared_until(Deadline{});
+  UASSERT(ok);
+}
+
+void DistributedSharedMutex::unlock_shared() {
+  GetCurrentSlot().fetch_sub(1);
+  OnReaderLeft();
+}
+
+bool DistributedSharedMutex::try_lock_shared() {
+  auto& slot = GetCurrentSlot();
+  slot.fetch_add(1);
+  if (!has_writer_.load()) return true;
+
+  // No suspension since the increment, so this is the same slot
+  slot.fetch_sub(1);
+  OnReaderLeft();
+  return false;
+}
+
+bool DistributedSharedMutex::try_lock_shared_until(Deadline deadline) {
+  while (!try_lock_shared()) {
+    if (!WaitForNoWriter(deadline)) return false;
+  }
+  return true;
+}
+
+std::atomic<std::int64_t>& DistributedSharedMutex::GetCurrentSlot() noexcept {
+  return slots_[GetThreadSlotIndex(kSlotCount)].readers;
+}
+
+bool DistributedSharedMutex::HasReaders() const noexcept {
+  // A reader that locked before the writer flag was raised is always counted
+  // here, but its decrement may be missed if it happens in another slot. So
+  // the sum may be more than the number of the readers, but never less.
+  std::int64_t readers = 0;
+  for (const auto& slot : slots_) readers += slot.readers.load();
+  return readers != 0;
+}
+
+void DistributedSharedMutex::OnReaderLeft() noexcept {
+  if (has_writer_.load()) readers_drained_event_.Send();
+}
+
+bool DistributedSharedMutex::WaitForReadersToDrain(Deadline deadline) {
+  // Only the writer that holds writers_mutex_ waits here
+  while (HasReaders()) {
+    if (!readers_drained_event_.WaitForEventUntil(deadline)) {
+      return !HasReaders();
+    }
+  }
+  return true;
+}
+
+bool DistributedSharedMutex::WaitForNoWriter(Deadline deadline) {
+  /* Fast path */
+  if (!has_writer_.load()) return true;
+
+  std::unique_lock<Mutex> lock(writer_left_mutex_);
+  return writer_left_cv_.WaitUntil(lock, deadline,
+                                   [this] { return !has_writer_.load(); });
+}
+
+void DistributedSharedMutex::ReleaseWriter() {
+  has_writer_.store(false);
+
+  TaskCancellationBlocker blocker;
+  std::lock_guard<Mutex> lock(writer_left_mutex_);
+  writer_left_cv_.NotifyAll();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
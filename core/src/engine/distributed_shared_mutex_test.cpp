@@ -0,0 +1,132 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/distributed_shared_mutex.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(DistributedSharedMutex, SharedLockUnlockDouble) {
+  engine::DistributedSharedMutex mutex;
+  mutex.lock_shared();
+  mutex.lock_shared();
+  mutex.unlock_shared();
+  mutex.unlock_shared();
+
+  mutex.lock();
+  mutex.unlock();
+}
+
+UTEST(DistributedSharedMutex, SharedAndUniqueLock) {
+  engine::DistributedSharedMutex mutex;
+
+  std::unique_lock<engine::DistributedSharedMutex> lock(mutex);
+  auto reader = utils::Async("", [&mutex] {
+    std::shared_lock<engine::DistributedSharedMutex> lock(mutex);
+  });
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(reader.IsFinished());
+
+  lock.unlock();
+
+  reader.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(reader.IsFinished());
+  UEXPECT_NO_THROW(reader.Get());
+}
+
+UTEST(DistributedSharedMutex, UniqueAndSharedLock) {
+  engine::DistributedSharedMutex mutex;
+
+  std::shared_lock<engine::DistributedSharedMutex> lock(mutex);
+  auto writer = utils::Async("", [&mutex] {
+    std::unique_lock<engine::DistributedSharedMutex> lock(mutex);
+  });
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_FALSE(writer.IsFinished());
+  EXPECT_FALSE(mutex.try_lock_shared());
+
+  lock.unlock();
+
+  writer.WaitFor(std::chrono::milliseconds(50));
+  EXPECT_TRUE(writer.IsFinished());
+  UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST(DistributedSharedMutex, TryLock) {
+  engine::DistributedSharedMutex mutex;
+
+  ASSERT_TRUE(mutex.try_lock());
+  auto task = utils::Async("", [&mutex] {
+    return mutex.try_lock() || mutex.try_lock_shared();
+  });
+  EXPECT_FALSE(task.Get());
+  mutex.unlock();
+
+  ASSERT_TRUE(mutex.try_lock_shared());
+  EXPECT_FALSE(mutex.try_lock());
+  EXPECT_FALSE(mutex.try_lock_for(std::chrono::milliseconds{10}));
+  mutex.unlock_shared();
+
+  // the mutex must be free of writers
+  EXPECT_TRUE(mutex.try_lock_shared_for(std::chrono::milliseconds{10}));
+  mutex.unlock_shared();
+}
+
+UTEST(DistributedSharedMutex, LockIgnoresCancellation) {
+  engine::DistributedSharedMutex mutex;
+
+  std::shared_lock<engine::DistributedSharedMutex> lock(mutex);
+  auto writer = utils::Async("", [&mutex] {
+    std::unique_lock<engine::DistributedSharedMutex> lock(mutex);
+  });
+  writer.WaitFor(std::chrono::milliseconds(10));
+  writer.RequestCancel();
+
+  writer.WaitFor(std::chrono::milliseconds(10));
+  EXPECT_FALSE(writer.IsFinished());
+
+  lock.unlock();
+  UEXPECT_NO_THROW(writer.Get());
+}
+
+UTEST_MT(DistributedSharedMutex, ReadersAndWriters, 4) {
+  constexpr int kReaders = 3;
+  constexpr int kWrites = 100;
+
+  engine::DistributedSharedMutex mutex;
+  int data[2]{0, 0};
+  std::atomic<bool> keep_running{true};
+
+  std::vector<engine::TaskWithResult<void>> readers;
+  readers.reserve(kReaders);
+  for (int i = 0; i < kReaders; ++i) {
+    readers.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        std::shared_lock<engine::DistributedSharedMutex> lock(mutex);
+        EXPECT_EQ(data[0], data[1]);
+      }
+    }));
+  }
+
+  for (int i = 0; i < kWrites; ++i) {
+    std::unique_lock<engine::DistributedSharedMutex> lock(mutex);
+    ++data[0];
+    engine::Yield();
+    ++data[1];
+  }
+
+  keep_running = false;
+  for (auto& reader : readers) reader.Get();
+  EXPECT_EQ(data[0], kWrites);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <stdexcept>
 
@@ -37,6 +38,11 @@ const auto kEventImmediateSetupThreshold =
     kPeriodicEventsDriverInterval +
     utils::datetime::SteadyCoarseClock::resolution();
 
+// The timer wheel is advanced by the periodic timer, so it can not be more
+// precise than the periodic timer interval
+constexpr std::chrono::milliseconds kTimerWheelTick =
+    kPeriodicEventsDriverInterval;
+
 std::atomic_flag& GetEvDefaultLoopFlag() {
   static std::atomic_flag ev_default_loop_flag ATOMIC_FLAG_INIT;
   return ev_default_loop_flag;
@@ -60,6 +66,8 @@ void ReleaseEvDefaultLoop() {
 constexpr std::chrono::milliseconds kCpuStatsCollectInterval{1000};
 constexpr std::size_t kCpuStatsThrottle{16};
 
+constexpr std::chrono::milliseconds kLoopStatsInterval{1000};
+
 }  // namespace
 
 Thread::Thread(const std::string& thread_name,
@@ -76,6 +84,7 @@ Thread::Thread(const std::string& thread_name, bool use_ev_default_loop,
       register_event_mode_(register_event_mode),
       loop_(nullptr),
       lock_(loop_mutex_, std::defer_lock),
+      timer_wheel_start_(Deadline::Clock::now()),
       name_{thread_name},
       cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle},
       is_running_(false) {
@@ -122,6 +131,8 @@ void Thread::RegisterInEvLoop(AsyncPayloadBase& payload) {
     return;
   }
 
+  // Incremented before the push, so that the counter never goes below zero
+  pending_payloads_.fetch_add(1, std::memory_order_relaxed);
   func_queue_.Push(payload);
 }
 
@@ -129,12 +140,50 @@ bool Thread::IsInEvThread() const {
   return (std::this_thread::get_id() == thread_.get_id());
 }
 
+bool Thread::HasTimerWheel() const noexcept {
+  return register_event_mode_ == RegisterEventMode::kDeferred;
+}
+
+void Thread::StartTimer(TimerWheel::Entry& entry,
+                        Deadline::Duration time_left) noexcept {
+  UASSERT(IsInEvThread());
+  UASSERT(HasTimerWheel());
+  // Round up, the timer must not fire before the deadline
+  const auto expiry =
+      std::chrono::ceil<std::chrono::milliseconds>(
+          Deadline::Clock::now() - timer_wheel_start_ + time_left) /
+      kTimerWheelTick;
+  timer_wheel_.Schedule(entry, static_cast<TimerWheel::Tick>(expiry));
+}
+
+void Thread::StopTimer(TimerWheel::Entry& entry) noexcept {
+  UASSERT(IsInEvThread());
+  timer_wheel_.Cancel(entry);
+}
+
+TimerWheel::Tick Thread::GetTimerWheelTick() const noexcept {
+  return static_cast<TimerWheel::Tick>(
+      (Deadline::Clock::now() - timer_wheel_start_) / kTimerWheelTick);
+}
+
 std::uint8_t Thread::GetCurrentLoadPercent() const {
   return cpu_stats_storage_.GetCurrentLoadPercent();
 }
 
 const std::string& Thread::GetName() const { return name_; }
 
+std::uint8_t Thread::GetLoopUtilizationPercent() const noexcept {
+  return loop_utilization_percent_.load(std::memory_order_relaxed);
+}
+
+std::size_t Thread::GetPendingPayloadsCount() const noexcept {
+  return pending_payloads_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Thread::GetInvokedWatchersCount() const noexcept {
+  return invoked_watchers_.load(std::memory_order_relaxed);
+}
+
 void Thread::Start() {
   loop_ = use_ev_default_loop_ ? ev_default_loop(EVFLAG_AUTO)
                                : ev_loop_new(EVFLAG_AUTO);
@@ -179,6 +228,8 @@ void Thread::Start() {
     ev_child_init(&watch_child_, ChildWatcher, 0, 0);
     ev_child_start(loop_, &watch_child_);
   }
+  ev_set_invoke_pending_cb(loop_, InvokePending);
+  stats_window_start_ = std::chrono::steady_clock::now();
 
   is_running_ = true;
   thread_ = std::thread([this] {
@@ -205,6 +256,7 @@ void Thread::RunEvLoop() {
     ev_run(loop_, EVRUN_ONCE);
     UpdateLoopWatcherImpl();
     cpu_stats_storage_.Collect();
+    UpdateLoopStatistics();
     ReleaseImpl();
   }
 
@@ -218,21 +270,41 @@ void Thread::RunEvLoop() {
   if (use_ev_default_loop_) ev_child_stop(loop_, &watch_child_);
 }
 
+void Thread::UpdateLoopStatistics() noexcept {
+  const auto now = std::chrono::steady_clock::now();
+  const auto window = now - stats_window_start_;
+  if (window < kLoopStatsInterval) return;
+
+  const auto busy = busy_in_window_ + (now - busy_since_);
+  const auto percent = std::min<std::int64_t>(100, busy * 100 / window);
+  loop_utilization_percent_.store(static_cast<std::uint8_t>(percent),
+                                  std::memory_order_relaxed);
+
+  busy_in_window_ = {};
+  busy_since_ = now;
+  stats_window_start_ = now;
+}
+
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
   auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
   UASSERT(ev_thread != nullptr);
   ev_thread->UpdateLoopWatcherImpl();
 }
 
-void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer*,
+void Thread::UpdateTimersWatcher(struct ev_loop* loop, ev_timer* w,
                                  int) noexcept {
   auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
   UASSERT(ev_thread != nullptr);
   ev_thread->UpdateLoopWatcherImpl();
+  if (w == &ev_thread->timers_driver_) {
+    ev_thread->timer_wheel_.Advance(ev_thread->GetTimerWheelTick());
+  }
 }
 
 void Thread::UpdateLoopWatcherImpl() {
+  std::size_t performed = 0;
   while (AsyncPayloadBase* payload = func_queue_.TryPop()) {
+    ++performed;
     LOG_TRACE() << "Thread::UpdateLoopWatcherImpl(), "
                 << compiler::GetTypeName(typeid(*payload));
     try {
@@ -241,6 +313,9 @@ void Thread::UpdateLoopWatcherImpl() {
       LOG_WARNING() << "exception in async thread func: " << ex;
     }
   }
+  if (performed != 0) {
+    pending_payloads_.fetch_sub(performed, std::memory_order_relaxed);
+  }
 }
 
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -302,6 +377,17 @@ void Thread::ChildWatcherImpl(ev_child* w) {
   }
 }
 
+void Thread::InvokePending(struct ev_loop* loop) {
+  auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+  UASSERT(ev_thread != nullptr);
+  // Written only from the ev thread
+  ev_thread->invoked_watchers_.store(
+      ev_thread->invoked_watchers_.load(std::memory_order_relaxed) +
+          ev_pending_count(loop),
+      std::memory_order_relaxed);
+  ev_invoke_pending(loop);
+}
+
 void Thread::Acquire(struct ev_loop* loop) noexcept {
   auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
   UASSERT(ev_thread != nullptr);
@@ -314,8 +400,17 @@ void Thread::Release(struct ev_loop* loop) noexcept {
   ev_thread->ReleaseImpl();
 }
 
-void Thread::AcquireImpl() noexcept { lock_.lock(); }
-void Thread::ReleaseImpl() noexcept { lock_.unlock(); }
+// The loop releases the lock only to wait for events, the time between
+// AcquireImpl and ReleaseImpl is the time the loop is busy
+void Thread::AcquireImpl() noexcept {
+  lock_.lock();
+  busy_since_ = std::chrono::steady_clock::now();
+}
+
+void Thread::ReleaseImpl() noexcept {
+  busy_in_window_ += std::chrono::steady_clock::now() - busy_since_;
+  lock_.unlock();
+}
 
 }  // namespace engine::ev
 
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -12,6 +15,7 @@
 
 #include <concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -52,9 +56,29 @@ class Thread final {
 
   bool IsInEvThread() const;
 
+  // The timer wheel is driven by the ~1ms periodic timer, so it is only
+  // available in the kDeferred mode.
+  bool HasTimerWheel() const noexcept;
+
+  // Schedules the entry to fire at the first wheel tick after `time_left`.
+  // Must be called from the ev thread.
+  void StartTimer(TimerWheel::Entry& entry,
+                  Deadline::Duration time_left) noexcept;
+  void StopTimer(TimerWheel::Entry& entry) noexcept;
+
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
+  // Share of the wall time the loop was not waiting for events, over the last
+  // kLoopStatsInterval
+  std::uint8_t GetLoopUtilizationPercent() const noexcept;
+
+  // Payloads queued by RunInEvLoop* and not yet performed
+  std::size_t GetPendingPayloadsCount() const noexcept;
+
+  // Watcher callbacks invoked since the start, including the internal ones
+  std::uint64_t GetInvokedWatchersCount() const noexcept;
+
  private:
   Thread(const std::string& thread_name, bool use_ev_default_loop,
          RegisterEventMode register_event_mode);
@@ -65,15 +89,19 @@ class Thread final {
 
   void StopEventLoop();
   void RunEvLoop();
+  void UpdateLoopStatistics() noexcept;
 
   static void UpdateLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   static void UpdateTimersWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
   void UpdateLoopWatcherImpl();
+  TimerWheel::Tick GetTimerWheelTick() const noexcept;
   static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
   void BreakLoopWatcherImpl();
   static void ChildWatcher(struct ev_loop*, ev_child* w, int) noexcept;
   static void ChildWatcherImpl(ev_child* w);
 
+  static void InvokePending(struct ev_loop* loop);
+
   static void Acquire(struct ev_loop* loop) noexcept;
   static void Release(struct ev_loop* loop) noexcept;
   void AcquireImpl() noexcept;
@@ -90,6 +118,8 @@ class Thread final {
   std::unique_lock<std::mutex> lock_;
 
   ev_timer timers_driver_{};
+  const Deadline::TimePoint timer_wheel_start_;
+  TimerWheel timer_wheel_;
   ev_timer stats_timer_{};
   ev_async watch_update_{};
   ev_async watch_break_{};
@@ -98,6 +128,15 @@ class Thread final {
   const std::string name_;
   utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
 
+  // Accessed only from the ev thread
+  std::chrono::steady_clock::time_point busy_since_{};
+  std::chrono::steady_clock::time_point stats_window_start_{};
+  std::chrono::steady_clock::duration busy_in_window_{};
+
+  std::atomic<std::uint8_t> loop_utilization_percent_{0};
+  std::atomic<std::size_t> pending_payloads_{0};
+  std::atomic<std::uint64_t> invoked_watchers_{0};
+
   bool is_running_;
 };
 
@@ -36,6 +36,18 @@ const std::string& ThreadControlBase::GetName() const {
   return thread_.GetName();
 }
 
+std::uint8_t ThreadControlBase::GetLoopUtilizationPercent() const noexcept {
+  return thread_.GetLoopUtilizationPercent();
+}
+
+std::size_t ThreadControlBase::GetPendingPayloadsCount() const noexcept {
+  return thread_.GetPendingPayloadsCount();
+}
+
+std::uint64_t ThreadControlBase::GetInvokedWatchersCount() const noexcept {
+  return thread_.GetInvokedWatchersCount();
+}
+
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void ThreadControlBase::DoStart(ev_timer& w) noexcept {
   UASSERT(IsInEvThread());
@@ -85,6 +97,23 @@ void ThreadControlBase::DoStop(ev_io& w) noexcept {
   ev_io_stop(GetEvLoop(), &w);
 }
 
+bool ThreadControlBase::DoHasTimerWheel() const noexcept {
+  return thread_.HasTimerWheel();
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStart(TimerWheel::Entry& entry,
+                                Deadline::Duration time_left) noexcept {
+  UASSERT(IsInEvThread());
+  thread_.StartTimer(entry, time_left);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ThreadControlBase::DoStop(TimerWheel::Entry& entry) noexcept {
+  UASSERT(IsInEvThread());
+  thread_.StopTimer(entry);
+}
+
 TimerThreadControl::TimerThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
@@ -97,6 +126,21 @@ void TimerThreadControl::Stop(ev_timer& w) noexcept { DoStop(w); }
 // NOLINTNEXTLINE(readability-make-member-function-const)
 void TimerThreadControl::Again(ev_timer& w) noexcept { DoAgain(w); }
 
+bool TimerThreadControl::HasTimerWheel() const noexcept {
+  return DoHasTimerWheel();
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Start(TimerWheel::Entry& entry,
+                               Deadline::Duration time_left) noexcept {
+  DoStart(entry, time_left);
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void TimerThreadControl::Stop(TimerWheel::Entry& entry) noexcept {
+  DoStop(entry);
+}
+
 ThreadControl::ThreadControl(Thread& thread) noexcept
     : ThreadControlBase{thread} {}
 
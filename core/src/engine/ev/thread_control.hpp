@@ -9,6 +9,7 @@
 #include <ev.h>
 
 #include <engine/ev/async_payload_base.hpp>
+#include <engine/ev/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_use_event.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -133,6 +134,10 @@ class ThreadControlBase {
   std::uint8_t GetCurrentLoadPercent() const;
   const std::string& GetName() const;
 
+  std::uint8_t GetLoopUtilizationPercent() const noexcept;
+  std::size_t GetPendingPayloadsCount() const noexcept;
+  std::uint64_t GetInvokedWatchersCount() const noexcept;
+
  protected:
   explicit ThreadControlBase(Thread& thread) noexcept;
 
@@ -147,6 +152,10 @@ class ThreadControlBase {
   void DoStart(ev_io& w) noexcept;
   void DoStop(ev_io& w) noexcept;
 
+  bool DoHasTimerWheel() const noexcept;
+  void DoStart(TimerWheel::Entry& entry, Deadline::Duration time_left) noexcept;
+  void DoStop(TimerWheel::Entry& entry) noexcept;
+
  private:
   Thread& thread_;
 };
@@ -215,6 +224,13 @@ class TimerThreadControl final : public ThreadControlBase {
   void Start(ev_timer& w) noexcept;
   void Stop(ev_timer& w) noexcept;
   void Again(ev_timer& w) noexcept;
+
+  /// Whether the ev thread has a timer wheel with ~1ms granularity, which is
+  /// cheaper than the libev timers for the long timeouts.
+  bool HasTimerWheel() const noexcept;
+
+  void Start(TimerWheel::Entry& entry, Deadline::Duration time_left) noexcept;
+  void Stop(TimerWheel::Entry& entry) noexcept;
 };
 
 class ThreadControl final : public ThreadControlBase {
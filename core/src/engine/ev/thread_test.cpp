@@ -0,0 +1,27 @@
+#include <engine/ev/thread_pool.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(EvThread, Statistics) {
+  engine::ev::ThreadPoolConfig config;
+  config.threads = 1;
+  config.thread_name = "ev-stats-test";
+  engine::ev::ThreadPool pool{config};
+  auto& thread = pool.NextThread();
+
+  const auto invoked_before = thread.GetInvokedWatchersCount();
+
+  std::size_t pending_inside = 0;
+  thread.RunInEvLoopBlocking(
+      [&] { pending_inside = thread.GetPendingPayloadsCount(); });
+  // The running payload is still accounted as pending
+  EXPECT_GE(pending_inside, 1);
+
+  // The payload is run by the ev_async watcher
+  EXPECT_GT(thread.GetInvokedWatchersCount(), invoked_before);
+  EXPECT_LE(thread.GetLoopUtilizationPercent(), 100);
+}
+
+USERVER_NAMESPACE_END
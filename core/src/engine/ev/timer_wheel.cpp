@@ -0,0 +1,100 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+namespace {
+
+constexpr TimerWheel::Tick kSlotMask = TimerWheel::kSlots - 1;
+
+}  // namespace
+
+TimerWheel::TimerWheel(Tick now) noexcept : next_tick_(now + 1) {}
+
+void TimerWheel::Schedule(Entry& entry, Tick expiry) noexcept {
+  if (entry.IsScheduled()) Unlink(entry);
+  entry.expiry_ = expiry;
+  Insert(entry);
+}
+
+void TimerWheel::Cancel(Entry& entry) noexcept {
+  if (entry.IsScheduled()) Unlink(entry);
+}
+
+void TimerWheel::Advance(Tick now) noexcept {
+  while (next_tick_ <= now) {
+    const auto tick = next_tick_;
+    const auto index = tick & kSlotMask;
+    if (index == 0) Cascade(tick);
+
+    // The entries that are scheduled by the callbacks for `tick` or earlier
+    // go to the next tick, never to the slot that is being processed
+    ++next_tick_;
+    auto*& slot = slots_[0][index];
+    while (slot) {
+      auto& entry = *slot;
+      Unlink(entry);
+      entry.callback_(entry);
+    }
+  }
+}
+
+void TimerWheel::Link(Entry*& head, Entry& entry) noexcept {
+  UASSERT(!entry.IsScheduled());
+  entry.next_ = head;
+  entry.pprev_ = &head;
+  if (head) head->pprev_ = &entry.next_;
+  head = &entry;
+}
+
+void TimerWheel::Unlink(Entry& entry) noexcept {
+  UASSERT(entry.IsScheduled());
+  *entry.pprev_ = entry.next_;
+  if (entry.next_) entry.next_->pprev_ = entry.pprev_;
+  entry.next_ = nullptr;
+  entry.pprev_ = nullptr;
+}
+
+void TimerWheel::Insert(Entry& entry) noexcept {
+  if (entry.expiry_ < next_tick_) entry.expiry_ = next_tick_;
+  if (entry.expiry_ - next_tick_ > kMaxDelay) {
+    entry.expiry_ = next_tick_ + kMaxDelay;
+  }
+
+  const auto delay = entry.expiry_ - next_tick_;
+  std::size_t level = 0;
+  while (level + 1 < kLevels &&
+         delay >= (Tick{1} << ((level + 1) * kLevelBits))) {
+    ++level;
+  }
+
+  const auto index = (entry.expiry_ >> (level * kLevelBits)) & kSlotMask;
+  Link(slots_[level][index], entry);
+}
+
+void TimerWheel::Cascade(Tick tick) noexcept {
+  // Called when the lowest level wraps around: the current slot of each
+  // upper level now fits into the levels below it
+  for (std::size_t level = 1; level < kLevels; ++level) {
+    const auto index = (tick >> (level * kLevelBits)) & kSlotMask;
+
+    auto* entry = slots_[level][index];
+    slots_[level][index] = nullptr;
+    while (entry) {
+      auto* next = entry->next_;
+      entry->next_ = nullptr;
+      entry->pprev_ = nullptr;
+      Insert(*entry);
+      entry = next;
+    }
+
+    if (index != 0) break;
+  }
+}
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+// Hierarchical timer wheel with O(1) Schedule and Cancel. Time is measured in
+// ticks, the owner advances the wheel. There are kLevels levels of kSlots
+// slots each; a level covers kSlots times the range of the previous one, and
+// its entries are cascaded to the lower levels as the time approaches.
+//
+// The timers that are further than the wheel covers (~4.6 hours with 1ms
+// ticks) fire early at the end of the range, their owner is expected to check
+// the real deadline and reschedule.
+//
+// Not thread-safe, used from a single ev thread.
+class TimerWheel final {
+ public:
+  using Tick = std::uint64_t;
+
+  class Entry;
+  using Callback = void (*)(Entry&) noexcept;
+
+  class Entry final {
+   public:
+    explicit Entry(Callback callback) noexcept : callback_(callback) {}
+
+    Entry(const Entry&) = delete;
+    Entry& operator=(const Entry&) = delete;
+
+    bool IsScheduled() const noexcept { return pprev_ != nullptr; }
+
+    // Not used by the wheel, like ev_timer::data
+    void* data{nullptr};
+
+   private:
+    friend class TimerWheel;
+
+    Entry* next_{nullptr};
+    // Points to the pointer that points to this entry
+    Entry** pprev_{nullptr};
+    Tick expiry_{0};
+    const Callback callback_;
+  };
+
+  static constexpr std::size_t kLevelBits = 6;
+  static constexpr std::size_t kSlots = std::size_t{1} << kLevelBits;
+  static constexpr std::size_t kLevels = 4;
+  static constexpr Tick kMaxDelay = (Tick{1} << (kLevelBits * kLevels)) - 1;
+
+  explicit TimerWheel(Tick now = 0) noexcept;
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  // Schedules the entry to fire on the first Advance(now) with
+  // `now >= expiry`, reschedules an already scheduled one.
+  void Schedule(Entry& entry, Tick expiry) noexcept;
+
+  void Cancel(Entry& entry) noexcept;
+
+  // Fires the callbacks of all the entries that have expired by `now`. The
+  // callbacks may schedule and cancel any entries.
+  void Advance(Tick now) noexcept;
+
+  // The first tick that was not processed by Advance yet
+  Tick GetNextTick() const noexcept { return next_tick_; }
+
+ private:
+  static void Link(Entry*& head, Entry& entry) noexcept;
+  static void Unlink(Entry& entry) noexcept;
+
+  void Insert(Entry& entry) noexcept;
+  void Cascade(Tick tick) noexcept;
+
+  std::array<std::array<Entry*, kSlots>, kLevels> slots_{};
+  Tick next_tick_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
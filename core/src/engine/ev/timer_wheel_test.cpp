@@ -0,0 +1,158 @@
+#include <engine/ev/timer_wheel.hpp>
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::ev::TimerWheel;
+
+struct Fired final {
+  std::vector<int> ids;
+};
+
+struct TestEntry final {
+  TestEntry(Fired& fired, int id) : fired(fired), id(id) {
+    entry.data = this;
+  }
+
+  static void OnFire(TimerWheel::Entry& entry) noexcept {
+    auto& self = *static_cast<TestEntry*>(entry.data);
+    self.fired.ids.push_back(self.id);
+  }
+
+  Fired& fired;
+  const int id;
+  TimerWheel::Entry entry{&OnFire};
+};
+
+}  // namespace
+
+TEST(TimerWheel, FiresInOrder) {
+  TimerWheel wheel;
+  Fired fired;
+  TestEntry first{fired, 1};
+  TestEntry second{fired, 2};
+  TestEntry third{fired, 3};
+
+  wheel.Schedule(third.entry, 5000);
+  wheel.Schedule(first.entry, 10);
+  wheel.Schedule(second.entry, 100);
+  EXPECT_TRUE(first.entry.IsScheduled());
+
+  wheel.Advance(9);
+  EXPECT_TRUE(fired.ids.empty());
+
+  wheel.Advance(10);
+  EXPECT_EQ(fired.ids, std::vector<int>{1});
+  EXPECT_FALSE(first.entry.IsScheduled());
+
+  wheel.Advance(4999);
+  EXPECT_EQ(fired.ids, (std::vector<int>{1, 2}));
+
+  wheel.Advance(5000);
+  EXPECT_EQ(fired.ids, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(TimerWheel, Cancel) {
+  TimerWheel wheel;
+  Fired fired;
+  TestEntry first{fired, 1};
+  TestEntry second{fired, 2};
+
+  wheel.Schedule(first.entry, 70);
+  wheel.Schedule(second.entry, 70);
+  wheel.Cancel(first.entry);
+  EXPECT_FALSE(first.entry.IsScheduled());
+  wheel.Cancel(first.entry);
+
+  wheel.Advance(100);
+  EXPECT_EQ(fired.ids, std::vector<int>{2});
+}
+
+TEST(TimerWheel, Reschedule) {
+  TimerWheel wheel;
+  Fired fired;
+  TestEntry entry{fired, 1};
+
+  wheel.Schedule(entry.entry, 1000);
+  wheel.Schedule(entry.entry, 20);
+  wheel.Advance(20);
+  EXPECT_EQ(fired.ids, std::vector<int>{1});
+
+  wheel.Advance(2000);
+  EXPECT_EQ(fired.ids, std::vector<int>{1});
+}
+
+TEST(TimerWheel, PastExpiryFiresOnNextTick) {
+  TimerWheel wheel{100};
+  Fired fired;
+  TestEntry entry{fired, 1};
+
+  wheel.Schedule(entry.entry, 50);
+  wheel.Advance(101);
+  EXPECT_EQ(fired.ids, std::vector<int>{1});
+}
+
+TEST(TimerWheel, Levels) {
+  TimerWheel wheel{12345};
+  Fired fired;
+  std::vector<std::unique_ptr<TestEntry>> entries;
+
+  const TimerWheel::Tick delays[] = {
+      1, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 262145, 999999,
+      TimerWheel::kMaxDelay,
+  };
+  for (const auto delay : delays) {
+    entries.push_back(
+        std::make_unique<TestEntry>(fired, static_cast<int>(entries.size())));
+    wheel.Schedule(entries.back()->entry, 12345 + delay);
+  }
+
+  for (std::size_t i = 0; i < std::size(delays); ++i) {
+    wheel.Advance(12345 + delays[i] - 1);
+    EXPECT_EQ(fired.ids.size(), i) << "delay=" << delays[i];
+    wheel.Advance(12345 + delays[i]);
+    EXPECT_EQ(fired.ids.size(), i + 1) << "delay=" << delays[i];
+  }
+}
+
+TEST(TimerWheel, BeyondRangeFiresEarly) {
+  TimerWheel wheel;
+  Fired fired;
+  TestEntry entry{fired, 1};
+
+  wheel.Schedule(entry.entry, TimerWheel::kMaxDelay * 2);
+  wheel.Advance(TimerWheel::kMaxDelay + 1);
+  EXPECT_EQ(fired.ids, std::vector<int>{1});
+}
+
+TEST(TimerWheel, RescheduleFromCallback) {
+  struct Periodic final {
+    static void OnFire(TimerWheel::Entry& entry) noexcept {
+      auto& self = *static_cast<Periodic*>(entry.data);
+      ++self.count;
+      self.wheel.Schedule(entry, self.wheel.GetNextTick() + 9);
+    }
+
+    TimerWheel& wheel;
+    int count{0};
+    TimerWheel::Entry entry{&OnFire};
+  };
+
+  TimerWheel wheel;
+  Periodic periodic{wheel};
+  periodic.entry.data = &periodic;
+  wheel.Schedule(periodic.entry, 10);
+
+  wheel.Advance(1000);
+  EXPECT_EQ(periodic.count, 100);
+  wheel.Cancel(periodic.entry);
+}
+
+USERVER_NAMESPACE_END
@@ -42,6 +42,10 @@ class CvWaitStrategy final : public WaitStrategy {
     return EarlyWakeup{false};
   }
 
+  std::string_view GetWaitKind() const noexcept override {
+    return "condition_variable";
+  }
+
   void DisableWakeups() noexcept override {
     UASSERT(current_.IsCurrent());
 
@@ -25,6 +25,8 @@ class FutureWaitStrategy final : public impl::WaitStrategy {
     return target_.TryAppendWaiter(current_);
   }
 
+  std::string_view GetWaitKind() const noexcept override { return "future"; }
+
   void DisableWakeups() noexcept override { target_.RemoveWaiter(current_); }
 
  private:
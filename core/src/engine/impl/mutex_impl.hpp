@@ -1,11 +1,16 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <userver/utils/assert.hpp>
 
+#include <compiler/relax_cpu.hpp>
 #include <engine/impl/wait_list.hpp>
 #include <engine/impl/wait_list_light.hpp>
 #include <engine/task/task_context.hpp>
@@ -15,10 +20,39 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+// CPU timestamp counter on x86, nanoseconds elsewhere. Only used to bound
+// spinning, so the exact units do not matter much.
+inline std::uint64_t ReadSpinClock() noexcept {
+#if defined(__x86_64__) || defined(__amd64__) || defined(__i386__)
+  return __builtin_ia32_rdtsc();
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+// Adaptive spinning and handoff state. Empty for WaitListLight to keep
+// SingleWaitingTaskMutex small.
+template <class Waiters>
+class MutexAdaptiveState {};
+
+template <>
+class MutexAdaptiveState<WaitList> {
+ protected:
+  // Moving average of the spin duration that ended with the lock acquired
+  std::atomic<std::uint32_t> spin_estimate_{0};
+  bool handoff_{false};
+};
+
 template <class Waiters>
-class MutexImpl {
+class MutexImpl : private MutexAdaptiveState<Waiters> {
  public:
   MutexImpl();
+
+  // With `handoff` set, unlock() passes ownership directly to the first
+  // waiting task instead of releasing the mutex for anyone to grab.
+  explicit MutexImpl(bool handoff);
   ~MutexImpl();
 
   MutexImpl(const MutexImpl&) = delete;
@@ -38,7 +72,12 @@ class MutexImpl {
   class MutexWaitStrategy;
 
   bool LockFastPath(TaskContext&) noexcept;
+  bool LockSpinPath(TaskContext&) noexcept;
   bool LockSlowPath(TaskContext&, Deadline);
+  bool UnlockWithHandoff();
+
+  static constexpr std::uint32_t kMinSpinCycles = 2'000;
+  static constexpr std::uint32_t kMaxSpinCycles = 20'000;
 
   std::atomic<TaskContext*> owner_;
   Waiters lock_waiters_;
@@ -61,6 +100,8 @@ class MutexImpl<WaitList>::MutexWaitStrategy final : public WaitStrategy {
     return EarlyWakeup{false};
   }
 
+  std::string_view GetWaitKind() const noexcept override { return "mutex"; }
+
   void DisableWakeups() noexcept override {
     lock_.lock();
     mutex_.lock_waiters_.Remove(lock_, current_);
@@ -88,6 +129,8 @@ class MutexImpl<WaitListLight>::MutexWaitStrategy final : public WaitStrategy {
     return EarlyWakeup{false};
   }
 
+  std::string_view GetWaitKind() const noexcept override { return "mutex"; }
+
   void DisableWakeups() noexcept override {
     mutex_.lock_waiters_.Remove(current_);
   }
@@ -104,6 +147,13 @@ MutexImpl<Waiters>::MutexImpl() : owner_(nullptr) {
 #endif
 }
 
+template <class Waiters>
+MutexImpl<Waiters>::MutexImpl(bool handoff) : MutexImpl() {
+  static_assert(std::is_same_v<Waiters, WaitList>,
+                "Handoff is only implemented for WaitList");
+  this->handoff_ = handoff;
+}
+
 template <class Waiters>
 MutexImpl<Waiters>::~MutexImpl() {
   UASSERT(!owner_);
@@ -119,8 +169,65 @@ bool MutexImpl<Waiters>::LockFastPath(TaskContext& current) noexcept {
                                         std::memory_order_acquire);
 }
 
+// Spins for a while before going to sleep: a short critical section on
+// another worker is likely to end sooner than a sleep + wakeup round trip.
+//
+// The owner's TaskContext is never dereferenced, as it may be destroyed right
+// after unlock(). Instead, the owner pointer change tells that the lock is
+// being passed around between other tasks and that it is time to sleep.
+template <class Waiters>
+bool MutexImpl<Waiters>::LockSpinPath(TaskContext& current) noexcept {
+  if constexpr (std::is_same_v<Waiters, WaitList>) {
+    auto* const initial_owner = owner_.load(std::memory_order_relaxed);
+    // Let the slow path report locking twice from the same task
+    if (initial_owner == &current) return false;
+    // With handoff the sleeping waiters get the lock first
+    if (this->handoff_ && lock_waiters_.GetCountOfSleepies()) return false;
+    // The owner can not run while we spin on its only worker
+    if (GetWorkerCount(current.GetTaskProcessor()) < 2) return false;
+
+    const std::uint32_t estimate =
+        this->spin_estimate_.load(std::memory_order_relaxed);
+    const std::uint64_t budget =
+        std::min<std::uint64_t>(kMaxSpinCycles, 2 * estimate + kMinSpinCycles);
+
+    compiler::RelaxCpu relax;
+    const auto start = ReadSpinClock();
+    while (true) {
+      relax();
+      TaskContext* owner = owner_.load(std::memory_order_relaxed);
+      const auto spent = ReadSpinClock() - start;
+
+      if (owner == nullptr &&
+          owner_.compare_exchange_strong(owner, &current,
+                                         std::memory_order_acquire)) {
+        const auto spent_clamped =
+            static_cast<std::uint32_t>(std::min<std::uint64_t>(spent, budget));
+        this->spin_estimate_.store(
+            estimate - estimate / 8 + spent_clamped / 8,
+            std::memory_order_relaxed);
+        return true;
+      }
+
+      if ((owner != nullptr && owner != initial_owner) || spent >= budget) {
+        break;
+      }
+    }
+
+    // Spinning did not pay off, spin less next time
+    this->spin_estimate_.store(estimate - estimate / 8,
+                               std::memory_order_relaxed);
+    return false;
+  } else {
+    static_assert(std::is_same_v<Waiters, WaitListLight>);
+    return false;
+  }
+}
+
 template <class Waiters>
 bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
+  if (LockSpinPath(current)) return true;
+
   TaskContext* expected = nullptr;
 
   const engine::TaskCancellationBlocker block_cancels;
@@ -131,6 +238,11 @@ bool MutexImpl<Waiters>::LockSlowPath(TaskContext& current, Deadline deadline) {
                "MutexImpl is locked twice from the same task");
 
     const auto wakeup_source = current.Sleep(wait_manager, deadline);
+    if constexpr (std::is_same_v<Waiters, WaitList>) {
+      // Handed off by unlock() under WaitList::Lock, which DisableWakeups()
+      // takes before returning from Sleep(). Holds even on a deadline.
+      if (owner_.load(std::memory_order_acquire) == &current) return true;
+    }
     if (!HasWaitSucceeded(wakeup_source)) {
       return false;
     }
@@ -150,6 +262,13 @@ void MutexImpl<Waiters>::unlock() {
 #if USERVER_IMPL_HAS_TSAN
   __tsan_mutex_pre_unlock(this, 0);
 #endif
+  if (UnlockWithHandoff()) {
+#if USERVER_IMPL_HAS_TSAN
+    __tsan_mutex_post_unlock(this, 0);
+#endif
+    return;
+  }
+
   auto* old_owner = owner_.exchange(nullptr, std::memory_order_acq_rel);
   UASSERT(old_owner && old_owner->IsCurrent());
 
@@ -168,6 +287,25 @@ void MutexImpl<Waiters>::unlock() {
 #endif
 }
 
+template <class Waiters>
+bool MutexImpl<Waiters>::UnlockWithHandoff() {
+  if constexpr (std::is_same_v<Waiters, WaitList>) {
+    if (!this->handoff_ || !lock_waiters_.GetCountOfSleepies()) return false;
+
+    UASSERT(owner_.load() && owner_.load()->IsCurrent());
+    WaitList::Lock lock(lock_waiters_);
+    // A waiter that is not in the list yet checks `owner_` under the same
+    // lock, so it either gets woken up here or sees the mutex released.
+    auto* const next = lock_waiters_.GetFirst(lock);
+    owner_.store(next, std::memory_order_release);
+    if (next) lock_waiters_.WakeupOne(lock);
+    return true;
+  } else {
+    static_assert(std::is_same_v<Waiters, WaitListLight>);
+    return false;
+  }
+}
+
 template <class Waiters>
 bool MutexImpl<Waiters>::try_lock() {
 #if USERVER_IMPL_HAS_TSAN
@@ -1,12 +1,135 @@
 #include <userver/engine/impl/task_context_factory.hpp>
 
+#include <cstddef>
+#include <new>
+
 #include <engine/task/task_context.hpp>
+#include <userver/compiler/impl/tls.hpp>
 #include <userver/utils/assert.hpp>
 
+#if defined(__SANITIZE_ADDRESS__)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_TASK_CONTEXT_POOL 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_TASK_CONTEXT_POOL 0
+#endif
+#endif
+
+#ifndef USERVER_IMPL_TASK_CONTEXT_POOL
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define USERVER_IMPL_TASK_CONTEXT_POOL 1
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::impl {
 
+namespace {
+
+// Each allocation is prefixed with a header that stores its size class, so
+// that DeleteFusedTaskContext knows where to put the block.
+constexpr std::size_t kHeaderSize = kTaskContextAlignment;
+static_assert(kHeaderSize >= sizeof(std::size_t));
+
+// Blocks up to 8KiB are pooled, which covers TaskContext along with the
+// payload of utils::Async and of typical lambdas.
+constexpr std::size_t kSizeClassGranularity = 256;
+constexpr std::size_t kSizeClassesCount = 32;
+constexpr std::size_t kNotPooled = kSizeClassesCount;
+
+// Limits the memory that a thread may hold in its freelists.
+constexpr std::size_t kMaxCachedBytesPerClass = 32 * 1024;
+
+constexpr std::size_t GetClassSize(std::size_t size_class) noexcept {
+  return (size_class + 1) * kSizeClassGranularity;
+}
+
+constexpr std::size_t GetSizeClass(std::size_t block_size) noexcept {
+  const auto size_class =
+      (block_size + kSizeClassGranularity - 1) / kSizeClassGranularity - 1;
+  return size_class < kSizeClassesCount ? size_class : kNotPooled;
+}
+
+std::byte* AllocateBlock(std::size_t block_size) {
+  return static_cast<std::byte*>(
+      ::operator new[](block_size, std::align_val_t{kTaskContextAlignment}));
+}
+
+void DeleteBlock(std::byte* block) noexcept {
+  ::operator delete[](block, std::align_val_t{kTaskContextAlignment});
+}
+
+#if USERVER_IMPL_TASK_CONTEXT_POOL
+
+struct FreeBlock final {
+  FreeBlock* next;
+};
+
+// Freed blocks go to the freelist of the thread that frees them. Tasks are
+// mostly created and destroyed by the same TaskProcessor threads, so the
+// blocks are reused without touching the allocator.
+class LocalFreeLists final {
+ public:
+  LocalFreeLists() = default;
+  LocalFreeLists(const LocalFreeLists&) = delete;
+  LocalFreeLists& operator=(const LocalFreeLists&) = delete;
+  ~LocalFreeLists();
+
+  std::byte* TryPop(std::size_t size_class) noexcept {
+    auto& list = lists_[size_class];
+    FreeBlock* const block = list.head;
+    if (!block) return nullptr;
+    list.head = block->next;
+    --list.size;
+    return reinterpret_cast<std::byte*>(block);
+  }
+
+  bool TryPush(std::size_t size_class, std::byte* block) noexcept {
+    auto& list = lists_[size_class];
+    if (list.size >= kMaxCachedBytesPerClass / GetClassSize(size_class)) {
+      return false;
+    }
+    list.head = new (block) FreeBlock{list.head};
+    ++list.size;
+    return true;
+  }
+
+ private:
+  struct FreeList final {
+    FreeBlock* head{nullptr};
+    std::size_t size{0};
+  };
+
+  FreeList lists_[kSizeClassesCount]{};
+};
+
+// Tasks may still be destroyed by the destructors of other thread_local
+// variables after the freelists are gone.
+thread_local bool are_local_free_lists_destroyed = false;
+
+LocalFreeLists::~LocalFreeLists() {
+  are_local_free_lists_destroyed = true;
+  for (auto& list : lists_) {
+    while (list.head) {
+      FreeBlock* const block = list.head;
+      list.head = block->next;
+      DeleteBlock(reinterpret_cast<std::byte*>(block));
+    }
+  }
+}
+
+USERVER_IMPL_PREVENT_TLS_CACHING LocalFreeLists* GetLocalFreeLists() noexcept {
+  if (are_local_free_lists_destroyed) return nullptr;
+  thread_local LocalFreeLists free_lists;
+  return &free_lists;
+}
+
+#endif
+
+}  // namespace
+
 std::size_t GetTaskContextSize() noexcept { return sizeof(TaskContext); }
 
 static_assert(kTaskContextAlignment >= alignof(TaskContext));
@@ -14,18 +137,44 @@ static_assert(sizeof(TaskContext) % kTaskContextAlignment == 0);
 
 TaskContext& PlacementNewTaskContext(std::byte* storage, TaskConfig config,
                                      utils::impl::WrappedCallBase& payload) {
-  return *new (storage) TaskContext{config.task_processor, config.importance,
-                                    config.wait_mode, config.deadline, payload};
+  return *new (storage) TaskContext{
+      config.task_processor, config.importance, config.wait_mode,
+      config.deadline, config.scheduling_class, payload};
 }
 
 std::byte* AllocateFusedTaskContext(std::size_t total_size) {
-  return static_cast<std::byte*>(
-      ::operator new[](total_size, std::align_val_t{kTaskContextAlignment}));
+  const auto size_class = GetSizeClass(kHeaderSize + total_size);
+
+  std::byte* block = nullptr;
+#if USERVER_IMPL_TASK_CONTEXT_POOL
+  if (size_class != kNotPooled) {
+    if (auto* const free_lists = GetLocalFreeLists()) {
+      block = free_lists->TryPop(size_class);
+    }
+  }
+#endif
+  if (!block) {
+    block = AllocateBlock(size_class == kNotPooled ? kHeaderSize + total_size
+                                                   : GetClassSize(size_class));
+  }
+
+  new (block) std::size_t{size_class};
+  return block + kHeaderSize;
 }
 
 void DeleteFusedTaskContext(std::byte* storage) noexcept {
   UASSERT(storage);
-  ::operator delete[](storage, std::align_val_t{kTaskContextAlignment});
+  std::byte* const block = storage - kHeaderSize;
+  const auto size_class = *std::launder(reinterpret_cast<std::size_t*>(block));
+  UASSERT(size_class <= kNotPooled);
+
+#if USERVER_IMPL_TASK_CONTEXT_POOL
+  if (size_class != kNotPooled) {
+    auto* const free_lists = GetLocalFreeLists();
+    if (free_lists && free_lists->TryPush(size_class, block)) return;
+  }
+#endif
+  DeleteBlock(block);
 }
 
 }  // namespace engine::impl
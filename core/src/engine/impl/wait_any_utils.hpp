@@ -40,6 +40,8 @@ class WaitAnyWaitStrategy final : public WaitStrategy {
     return EarlyWakeup{false};
   }
 
+  std::string_view GetWaitKind() const noexcept override { return "wait_any"; }
+
   void DisableWakeups() noexcept override { DoDisableWakeups(targets_); }
 
  private:
@@ -60,6 +60,11 @@ void WaitList::Append(
   waiting_contexts_->push_back(*context.detach());  // referencing, not copying!
 }
 
+impl::TaskContext* WaitList::GetFirst(Lock& lock) noexcept {
+  UASSERT(lock);
+  return waiting_contexts_->empty() ? nullptr : &waiting_contexts_->front();
+}
+
 void WaitList::WakeupOne(Lock& lock) {
   UASSERT(lock);
   if (!waiting_contexts_->empty()) {
@@ -65,6 +65,9 @@ class WaitList final {
   /// @brief Remove the task from the `WaitList` without wakeup
   void Remove(Lock& lock, impl::TaskContext& context) noexcept;
 
+  /// @brief Get the task that `WakeupOne` would wake up, nullptr if empty
+  impl::TaskContext* GetFirst(Lock&) noexcept;
+
   void WakeupOne(Lock&);
   void WakeupAll(Lock&);
 
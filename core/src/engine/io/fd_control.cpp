@@ -12,6 +12,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <engine/task/task_context.hpp>
+#include <engine/task/task_processor.hpp>
 #include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -73,7 +74,10 @@ bool Direction::Wait(Deadline deadline) {
   return poller_.Wait(deadline).has_value();
 }
 
-void Direction::Reset(int fd) { poller_.Reset(fd, kind_); }
+void Direction::Reset(int fd, IoUringBackend* uring) {
+  poller_.Reset(fd, kind_);
+  uring_ = uring;
+}
 
 void Direction::Invalidate() { poller_.Invalidate(); }
 
@@ -94,8 +98,9 @@ FdControlHolder FdControl::Adopt(int fd) {
   SetCloexec(fd);
   SetNonblock(fd);
   ReduceSigpipe(fd);
-  fd_control->read_.Reset(fd);
-  fd_control->write_.Reset(fd);
+  auto* uring = current_task::GetTaskProcessor().GetIoUringBackend();
+  fd_control->read_.Reset(fd, uring);
+  fd_control->write_.Reset(fd, uring);
   return fd_control;
 }
 
@@ -104,6 +109,9 @@ void FdControl::Close() {
   Invalidate();
 
   const auto fd = Fd();
+  // Pending io_uring operations hold the file, so close alone does not
+  // interrupt them
+  if (auto* uring = GetIoUring()) uring->CancelFd(fd);
   if (::close(fd) == -1) {
     const auto error_code = errno;
     std::error_code ec(error_code, std::system_category());
@@ -115,6 +123,14 @@ void FdControl::Close() {
   write_.WakeupWaiters();
 }
 
+IoUringAcceptor& FdControl::GetIoUringAcceptor() {
+  UASSERT(GetIoUring());
+  if (!uring_acceptor_) {
+    uring_acceptor_ = std::make_unique<IoUringAcceptor>(*GetIoUring(), Fd());
+  }
+  return *uring_acceptor_;
+}
+
 void FdControl::Invalidate() {
   read_.Invalidate();
   write_.Invalidate();
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <sys/types.h>
 #include <sys/uio.h>
 #include <atomic>
 #include <cerrno>
+#include <memory>
+#include <optional>
 
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/fd_control_holder.hpp>
@@ -12,6 +15,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/io/io_uring_backend.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
@@ -86,11 +90,37 @@ class Direction final {
                     TransferMode mode, Deadline deadline,
                     const Context&... context);
 
+  // Same as PerformIo, but transfers `len` bytes of the file `file_fd`
+  // starting at `offset`.
+  // (FileIoFunc*)(int, int, off_t*, size_t), e.g. sendfile
+  template <typename FileIoFunc, typename... Context>
+  size_t PerformFileIo(SingleUserGuard& guard, FileIoFunc&& io_func,
+                       int file_fd, off_t offset, size_t len,
+                       TransferMode mode, Deadline deadline,
+                       const Context&... context);
+
+  // Same as PerformIo, but if the fd is bound to io_uring and the io_func
+  // would block, waits for the readiness and transfers the data with a single
+  // io_uring operation instead of waiting in the ev thread.
+  // (UringFunc*)(IoUringBackend&, int, void*, size_t, Deadline)
+  template <typename IoFunc, typename UringFunc, typename... Context>
+  size_t PerformIo(SingleUserGuard& guard, IoFunc&& io_func,
+                   UringFunc&& uring_func, void* buf, size_t len,
+                   TransferMode mode, Deadline deadline,
+                   const Context&... context);
+
+  // (UringFunc*)(IoUringBackend&, int, struct iovec*, size_t, Deadline)
+  template <typename IoFunc, typename UringFunc, typename... Context>
+  size_t PerformIoV(SingleUserGuard& guard, IoFunc&& io_func,
+                    UringFunc&& uring_func, struct iovec* list,
+                    std::size_t list_size, TransferMode mode,
+                    Deadline deadline, const Context&... context);
+
  private:
   friend class FdControl;
   explicit Direction(Kind kind);
 
-  void Reset(int fd);
+  void Reset(int fd, IoUringBackend* uring);
   void WakeupWaiters() { poller_.WakeupWaiters(); }
 
   // does not notify
@@ -101,8 +131,18 @@ class Direction final {
                            TransferMode mode, Deadline deadline,
                            Context&... context);
 
+  // Returns the result of uring_func if the io_uring operation should be
+  // performed, std::nullopt otherwise
+  template <typename UringFunc, typename... Context>
+  std::optional<ssize_t> TryPerformUringIo(int error_code,
+                                           size_t processed_bytes,
+                                           TransferMode mode,
+                                           UringFunc& uring_func,
+                                           const Context&... context);
+
   FdPoller poller_;
   Kind kind_;
+  IoUringBackend* uring_{nullptr};
 };
 
 class FdControl final {
@@ -118,6 +158,12 @@ class FdControl final {
 
   int Fd() const { return read_.Fd(); }
 
+  // The io_uring backend of the task processor that adopted the fd, if any
+  IoUringBackend* GetIoUring() const noexcept { return read_.uring_; }
+
+  // Must be used under the SingleUserGuard of the Read() direction
+  IoUringAcceptor& GetIoUringAcceptor();
+
   Direction& Read() {
     UASSERT(IsValid());
     return read_;
@@ -135,6 +181,7 @@ class FdControl final {
  private:
   Direction read_;
   Direction write_;
+  std::unique_ptr<IoUringAcceptor> uring_acceptor_;
 };
 
 template <typename... Context>
@@ -185,6 +232,41 @@ ErrorMode Direction::TryHandleError(int error_code, size_t processed_bytes,
   return ErrorMode::kProcessed;
 }
 
+template <typename UringFunc, typename... Context>
+std::optional<ssize_t> Direction::TryPerformUringIo(int error_code,
+                                                    size_t processed_bytes,
+                                                    TransferMode mode,
+                                                    UringFunc& uring_func,
+                                                    const Context&... context) {
+  if (!uring_) return std::nullopt;
+  if (error_code != EWOULDBLOCK
+#if EWOULDBLOCK != EAGAIN
+      && error_code != EAGAIN
+#endif
+  ) {
+    return std::nullopt;
+  }
+  // TryHandleError completes the operation without waiting
+  if (processed_bytes != 0 && mode != TransferMode::kWhole) return std::nullopt;
+
+  const auto result = uring_func(*uring_);
+  if (result == -ECANCELED) {
+    if (!IsValid()) {
+      throw((IoException() << "Fd closed during ") << ... << context);
+    }
+    if (current_task::ShouldCancel()) {
+      throw(IoCancelled(/*bytes_transferred =*/processed_bytes)
+            << ... << context);
+    }
+    throw(IoTimeout(/*bytes_transferred =*/processed_bytes) << ... << context);
+  }
+  if (result < 0) {
+    errno = -result;
+    return -1;
+  }
+  return result;
+}
+
 template <typename IoFunc, typename... Context>
 size_t Direction::PerformIoV(SingleUserGuard&, IoFunc&& io_func,
                              struct iovec* list, std::size_t list_size,
@@ -249,6 +331,120 @@ size_t Direction::PerformIo(SingleUserGuard&, IoFunc&& io_func, void* buf,
   return pos - begin;
 }
 
+template <typename IoFunc, typename UringFunc, typename... Context>
+size_t Direction::PerformIoV(SingleUserGuard& guard, IoFunc&& io_func,
+                             UringFunc&& uring_func, struct iovec* list,
+                             std::size_t list_size, TransferMode mode,
+                             Deadline deadline, const Context&... context) {
+  if (!uring_) {
+    return PerformIoV(guard, io_func, list, list_size, mode, deadline,
+                      context...);
+  }
+
+  UASSERT(list_size > 0);
+  UASSERT(list_size <= IOV_MAX);
+  std::size_t processed_bytes = 0;
+  do {
+    ssize_t chunk_size = io_func(Fd(), list, list_size);
+    if (chunk_size < 0) {
+      auto uring_io = [&](IoUringBackend& uring) {
+        return uring_func(uring, Fd(), list, list_size, deadline);
+      };
+      chunk_size = TryPerformUringIo(errno, processed_bytes, mode, uring_io,
+                                     context...)
+                       .value_or(chunk_size);
+    }
+
+    if (chunk_size > 0) {
+      processed_bytes += chunk_size;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+      std::size_t offset = chunk_size;
+      while (list_size > 0) {
+        const std::size_t len = list->iov_len;
+        if (offset >= len) {
+          ++list;
+          offset -= len;
+          --list_size;
+          UASSERT(list_size != 0 || offset == 0);
+        } else {
+          list->iov_len -= offset;
+          list->iov_base = static_cast<char*>(list->iov_base) + offset;
+          break;
+        }
+      }
+    } else if (!chunk_size ||
+               TryHandleError(errno, processed_bytes, mode, deadline,
+                              context...) == ErrorMode::kFatal) {
+      break;
+    }
+  } while (list_size != 0);
+  return processed_bytes;
+}
+
+template <typename FileIoFunc, typename... Context>
+size_t Direction::PerformFileIo(SingleUserGuard&, FileIoFunc&& io_func,
+                                int file_fd, off_t offset, size_t len,
+                                TransferMode mode, Deadline deadline,
+                                const Context&... context) {
+  size_t processed_bytes = 0;
+  while (processed_bytes < len) {
+    // io_func advances the offset
+    const ssize_t chunk_size =
+        io_func(Fd(), file_fd, &offset, len - processed_bytes);
+    if (chunk_size > 0) {
+      processed_bytes += chunk_size;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+    } else if (!chunk_size ||
+               TryHandleError(errno, processed_bytes, mode, deadline,
+                              context...) == ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return processed_bytes;
+}
+
+template <typename IoFunc, typename UringFunc, typename... Context>
+size_t Direction::PerformIo(SingleUserGuard& guard, IoFunc&& io_func,
+                            UringFunc&& uring_func, void* buf, size_t len,
+                            TransferMode mode, Deadline deadline,
+                            const Context&... context) {
+  if (!uring_) {
+    return PerformIo(guard, io_func, buf, len, mode, deadline, context...);
+  }
+
+  char* const begin = static_cast<char*>(buf);
+  char* const end = begin + len;
+
+  char* pos = begin;
+
+  while (pos < end) {
+    ssize_t chunk_size = io_func(Fd(), pos, end - pos);
+    if (chunk_size < 0) {
+      auto uring_io = [&](IoUringBackend& uring) {
+        return uring_func(uring, Fd(), pos, end - pos, deadline);
+      };
+      chunk_size = TryPerformUringIo(errno, pos - begin, mode, uring_io,
+                                     context...)
+                       .value_or(chunk_size);
+    }
+
+    if (chunk_size > 0) {
+      pos += chunk_size;
+      if (mode == TransferMode::kOnce) {
+        break;
+      }
+    } else if (!chunk_size || TryHandleError(errno, pos - begin, mode, deadline,
+                                             context...) == ErrorMode::kFatal) {
+      break;
+    }
+  }
+  return pos - begin;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
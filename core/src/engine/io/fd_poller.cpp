@@ -81,6 +81,8 @@ class DirectionWaitStrategy final : public engine::impl::WaitStrategy {
     return engine::impl::EarlyWakeup{false};
   }
 
+  std::string_view GetWaitKind() const noexcept override { return "io"; }
+
   void DisableWakeups() noexcept override {
     waiters_.Remove(current_);
     // we need to stop watcher manually to avoid racy wakeups later
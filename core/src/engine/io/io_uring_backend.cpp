@@ -0,0 +1,361 @@
+#include <engine/io/io_uring_backend.hpp>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/single_use_event.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <engine/ev/thread_control.hpp>
+#include <engine/io/sys/linux/io_uring.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+
+#ifdef __linux__
+
+namespace {
+
+using sys::linux::IoUring;
+using sys::linux::IoUringCompletionHandler;
+
+// Accepted connections that may wait for IoUringAcceptor::Accept before the
+// multishot accept is paused
+constexpr std::size_t kMaxPendingConnections = 128;
+
+constexpr int kSendFlags = MSG_NOSIGNAL;
+
+class SingleShotOperation final : public IoUringCompletionHandler {
+ public:
+  void OnCompletion(int result, std::uint32_t) noexcept override {
+    result_ = result;
+    event_.Send();
+  }
+
+  int Perform(IoUring& ring, const io_uring_sqe& sqe, Deadline deadline) {
+    ring.Submit(sqe, this);
+    if (event_.WaitUntil(deadline) != FutureStatus::kReady) {
+      try {
+        ring.Cancel(this);
+      } catch (const std::exception& ex) {
+        LOG_LIMITED_ERROR() << "Failed to cancel io_uring operation: " << ex;
+      }
+      // The kernel may still write into the buffers of the operation
+      event_.WaitNonCancellable();
+    }
+    return result_;
+  }
+
+ private:
+  SingleUseEvent event_;
+  int result_{0};
+};
+
+io_uring_sqe MakeSqe(std::uint8_t opcode, int fd) {
+  io_uring_sqe sqe{};
+  sqe.opcode = opcode;
+  sqe.fd = fd;
+  return sqe;
+}
+
+}  // namespace
+
+struct IoUringBackend::Impl final {
+  Impl(std::size_t entries, std::size_t max_file_operations,
+       ev::ThreadControl& ev_thread)
+      : ring(entries),
+        ev_thread(ev_thread),
+        file_operations(max_file_operations) {
+    ev_io_init(&watcher, &OnRingReadable, ring.Fd(), EV_READ);
+    watcher.data = this;
+    ev_thread.RunInEvLoopBlocking(
+        [this] { ev_io_start(this->ev_thread.GetEvLoop(), &watcher); });
+  }
+
+  ~Impl() {
+    ev_thread.RunInEvLoopBlocking(
+        [this] { ev_io_stop(ev_thread.GetEvLoop(), &watcher); });
+  }
+
+  int Perform(const io_uring_sqe& sqe, Deadline deadline) {
+    SingleShotOperation operation;
+    return operation.Perform(ring, sqe, deadline);
+  }
+
+  int PerformFileOperation(const io_uring_sqe& sqe) {
+    // Regular file operations are executed by the kernel workers, too many of
+    // them in flight would only grow the kernel thread pool
+    if (!file_operations.try_lock_shared_until(Deadline{})) return -ECANCELED;
+    const std::shared_lock lock(file_operations, std::adopt_lock);
+    return Perform(sqe, {});
+  }
+
+  static void OnRingReadable(struct ev_loop*, ev_io* w, int) noexcept {
+    static_cast<Impl*>(w->data)->ring.ReapCompletions();
+  }
+
+  IoUring ring;
+  ev::ThreadControl& ev_thread;
+  ev_io watcher{};
+  Semaphore file_operations;
+};
+
+IoUringBackend::IoUringBackend(std::size_t entries,
+                               std::size_t max_file_operations,
+                               ev::ThreadControl& ev_thread)
+    : impl_(std::make_unique<Impl>(entries, max_file_operations, ev_thread)) {
+}
+
+IoUringBackend::~IoUringBackend() = default;
+
+bool IoUringBackend::IsSupported() noexcept { return IoUring::IsSupported(); }
+
+int IoUringBackend::Recv(int fd, void* buf, std::size_t len,
+                         Deadline deadline) {
+  auto sqe = MakeSqe(IORING_OP_RECV, fd);
+  sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+  sqe.len = static_cast<std::uint32_t>(len);
+  return impl_->Perform(sqe, deadline);
+}
+
+int IoUringBackend::Send(int fd, void* buf, std::size_t len,
+                         Deadline deadline) {
+  auto sqe = MakeSqe(IORING_OP_SEND, fd);
+  sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+  sqe.len = static_cast<std::uint32_t>(len);
+  sqe.msg_flags = kSendFlags;
+  return impl_->Perform(sqe, deadline);
+}
+
+int IoUringBackend::SendMsg(int fd, struct iovec* list, std::size_t list_size,
+                            Deadline deadline) {
+  struct msghdr msg {};
+  msg.msg_iov = list;
+  msg.msg_iovlen = list_size;
+
+  auto sqe = MakeSqe(IORING_OP_SENDMSG, fd);
+  sqe.addr = reinterpret_cast<std::uintptr_t>(&msg);
+  sqe.len = 1;
+  sqe.msg_flags = kSendFlags;
+  return impl_->Perform(sqe, deadline);
+}
+
+void IoUringBackend::CancelFd(int fd) noexcept {
+  try {
+    impl_->ring.CancelFd(fd);
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Failed to cancel io_uring operations on fd=" << fd << ": "
+                << ex;
+  }
+}
+
+int IoUringBackend::OpenAt(const char* path, int flags, mode_t mode) {
+  auto sqe = MakeSqe(IORING_OP_OPENAT, AT_FDCWD);
+  sqe.addr = reinterpret_cast<std::uintptr_t>(path);
+  sqe.open_flags = static_cast<std::uint32_t>(flags);
+  sqe.len = mode;
+  return impl_->PerformFileOperation(sqe);
+}
+
+int IoUringBackend::ReadAt(int fd, void* buf, std::size_t len,
+                           std::uint64_t offset) {
+  auto sqe = MakeSqe(IORING_OP_READ, fd);
+  sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+  sqe.len = static_cast<std::uint32_t>(len);
+  sqe.off = offset;
+  return impl_->PerformFileOperation(sqe);
+}
+
+int IoUringBackend::WriteAt(int fd, const void* buf, std::size_t len,
+                            std::uint64_t offset) {
+  auto sqe = MakeSqe(IORING_OP_WRITE, fd);
+  sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+  sqe.len = static_cast<std::uint32_t>(len);
+  sqe.off = offset;
+  return impl_->PerformFileOperation(sqe);
+}
+
+int IoUringBackend::FSync(int fd) {
+  return impl_->PerformFileOperation(MakeSqe(IORING_OP_FSYNC, fd));
+}
+
+int IoUringBackend::Close(int fd) {
+  return impl_->PerformFileOperation(MakeSqe(IORING_OP_CLOSE, fd));
+}
+
+class IoUringAcceptor::State final
+    : public IoUringCompletionHandler,
+      public std::enable_shared_from_this<IoUringAcceptor::State> {
+ public:
+  State(IoUring& ring, int fd) : ring_(ring), fd_(fd) {}
+
+  ~State() {
+    for (const auto result : results_) {
+      if (result >= 0) ::close(result);
+    }
+  }
+
+  int Accept(Deadline deadline) {
+    for (;;) {
+      {
+        std::lock_guard lock(mutex_);
+        if (!results_.empty()) {
+          const auto result = results_.front();
+          results_.pop_front();
+          return result;
+        }
+        if (!self_) Arm();
+      }
+
+      if (!event_.WaitForEventUntil(deadline)) return -ECANCELED;
+    }
+  }
+
+  void Stop() noexcept {
+    std::lock_guard lock(mutex_);
+    is_stopped_ = true;
+    if (self_) CancelLocked();
+  }
+
+  void OnCompletion(int result, std::uint32_t flags) noexcept override {
+    // Destroyed last, after all the members of the State are used
+    std::shared_ptr<State> finished;
+    {
+      std::lock_guard lock(mutex_);
+      if (!(flags & IORING_CQE_F_MORE)) finished = std::move(self_);
+
+      if (is_stopped_) {
+        if (result >= 0) ::close(result);
+        return;
+      }
+      if (result != -ECANCELED || !is_paused_) results_.push_back(result);
+
+      if (self_ && !is_paused_ && results_.size() >= kMaxPendingConnections) {
+        // Do not let the kernel accept the connections that nobody serves,
+        // the accept is resumed when the queue is drained
+        is_paused_ = true;
+        CancelLocked();
+      }
+    }
+    event_.Send();
+  }
+
+ private:
+  void Arm() {
+    auto sqe = MakeSqe(IORING_OP_ACCEPT, fd_);
+    sqe.ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe.accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+
+    self_ = shared_from_this();
+    is_paused_ = false;
+    try {
+      ring_.Submit(sqe, this);
+    } catch (const std::exception&) {
+      self_.reset();
+      throw;
+    }
+  }
+
+  void CancelLocked() noexcept {
+    try {
+      ring_.Cancel(this);
+    } catch (const std::exception& ex) {
+      LOG_LIMITED_ERROR() << "Failed to cancel io_uring accept: " << ex;
+    }
+  }
+
+  IoUring& ring_;
+  const int fd_;
+  SingleConsumerEvent event_;
+
+  std::mutex mutex_;
+  std::deque<int> results_;
+  // Keeps the State alive while the kernel may post completions for it
+  std::shared_ptr<State> self_;
+  bool is_paused_{false};
+  bool is_stopped_{false};
+};
+
+IoUringAcceptor::IoUringAcceptor(IoUringBackend& backend, int fd)
+    : state_(std::make_shared<State>(backend.impl_->ring, fd)) {}
+
+IoUringAcceptor::~IoUringAcceptor() { state_->Stop(); }
+
+int IoUringAcceptor::Accept(Deadline deadline) {
+  return state_->Accept(deadline);
+}
+
+#else  // __linux__
+
+struct IoUringBackend::Impl final {};
+
+class IoUringAcceptor::State final {};
+
+IoUringBackend::IoUringBackend(std::size_t, std::size_t, ev::ThreadControl&) {
+  throw std::runtime_error("io_uring is not supported on this platform");
+}
+
+IoUringBackend::~IoUringBackend() = default;
+
+bool IoUringBackend::IsSupported() noexcept { return false; }
+
+int IoUringBackend::Recv(int, void*, std::size_t, Deadline) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+int IoUringBackend::Send(int, void*, std::size_t, Deadline) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+int IoUringBackend::SendMsg(int, struct iovec*, std::size_t, Deadline) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+void IoUringBackend::CancelFd(int) noexcept {}
+
+int IoUringBackend::OpenAt(const char*, int, mode_t) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+int IoUringBackend::ReadAt(int, void*, std::size_t, std::uint64_t) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+int IoUringBackend::WriteAt(int, const void*, std::size_t, std::uint64_t) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+int IoUringBackend::FSync(int) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+int IoUringBackend::Close(int) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+IoUringAcceptor::IoUringAcceptor(IoUringBackend&, int) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+IoUringAcceptor::~IoUringAcceptor() = default;
+
+int IoUringAcceptor::Accept(Deadline) {
+  UINVARIANT(false, "io_uring is not supported on this platform");
+}
+
+#endif  // __linux__
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
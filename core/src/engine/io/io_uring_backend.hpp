@@ -0,0 +1,95 @@
+#pragma once
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+class ThreadControl;
+}  // namespace engine::ev
+
+namespace engine::io::impl {
+
+/// @brief io_uring based socket I/O of a task processor, see the `io-backend`
+/// task processor option.
+///
+/// It replaces the 'wait for readiness in ev thread, then repeat the syscall'
+/// dance: an operation that would block is handed to the ring as is, and its
+/// completion wakes up the task. Completions are reaped in batches by an ev
+/// thread that watches the ring fd.
+///
+/// The operations return the number of transferred bytes or a negative errno.
+/// If the deadline expires or the task is cancelled, the operation is
+/// cancelled and -ECANCELED is returned if nothing was transferred.
+///
+/// Also performs the file I/O of the fs:: functions, at most
+/// `max_file_operations` file operations are in flight, the rest wait.
+/// File operations ignore deadlines, they are cancelled only with the task.
+///
+/// Must outlive all the sockets that use it.
+class IoUringBackend final {
+ public:
+  IoUringBackend(std::size_t entries, std::size_t max_file_operations,
+                 ev::ThreadControl& ev_thread);
+  ~IoUringBackend();
+
+  /// Returns false if the OS does not provide the required io_uring features
+  static bool IsSupported() noexcept;
+
+  int Recv(int fd, void* buf, std::size_t len, Deadline deadline);
+
+  int Send(int fd, void* buf, std::size_t len, Deadline deadline);
+
+  int SendMsg(int fd, struct iovec* list, std::size_t list_size,
+              Deadline deadline);
+
+  /// Cancels all the operations on the fd, must be called before close
+  void CancelFd(int fd) noexcept;
+
+  /// Returns the opened fd or a negative errno
+  int OpenAt(const char* path, int flags, mode_t mode);
+
+  int ReadAt(int fd, void* buf, std::size_t len, std::uint64_t offset);
+
+  int WriteAt(int fd, const void* buf, std::size_t len, std::uint64_t offset);
+
+  int FSync(int fd);
+
+  int Close(int fd);
+
+ private:
+  friend class IoUringAcceptor;
+  struct Impl;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @brief Accepts the connections of a listening socket with a single
+/// multishot io_uring accept.
+///
+/// The kernel keeps accepting the connections until a bounded number of them
+/// is waiting for IoUringAcceptor::Accept.
+class IoUringAcceptor final {
+ public:
+  IoUringAcceptor(IoUringBackend& backend, int fd);
+  ~IoUringAcceptor();
+
+  /// Returns the fd of an accepted connection or a negative errno
+  int Accept(Deadline deadline);
+
+ private:
+  class State;
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace engine::io::impl
+
+USERVER_NAMESPACE_END
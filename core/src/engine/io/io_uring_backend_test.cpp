@@ -0,0 +1,189 @@
+#include <engine/io/io_uring_backend.hpp>
+
+#include <array>
+#include <string>
+#include <system_error>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/read.hpp>
+#include <userver/fs/write.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace io = engine::io;
+using Deadline = engine::Deadline;
+using TcpListener = internal::net::TcpListener;
+
+constexpr std::string_view kData = "hello, io_uring";
+
+void RunInIoUringTaskProcessor(utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.name = "io-uring-task-processor";
+  config.thread_name = "uring-worker";
+  config.worker_threads = 2;
+  config.io_backend = engine::IoBackend::kIoUring;
+  config.io_uring_entries = 64;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+}  // namespace
+
+TEST(IoUringBackend, SendRecv) {
+  if (!io::impl::IoUringBackend::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  RunInIoUringTaskProcessor([] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    // The receiver waits before the data is sent, so the data is received by
+    // an io_uring operation
+    auto receiver = engine::AsyncNoSpan([&server = server, deadline] {
+      std::array<char, kData.size()> buf{};
+      EXPECT_EQ(server.RecvAll(buf.data(), buf.size(), deadline), buf.size());
+      EXPECT_EQ(std::string_view(buf.data(), buf.size()), kData);
+    });
+    engine::SleepFor(std::chrono::milliseconds{10});
+
+    EXPECT_EQ(client.SendAll(kData.data(), kData.size(), deadline),
+              kData.size());
+    receiver.Get();
+
+    EXPECT_FALSE(server.Getpeername().PrimaryAddressString().empty());
+  });
+}
+
+TEST(IoUringBackend, AcceptMany) {
+  if (!io::impl::IoUringBackend::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  RunInIoUringTaskProcessor([] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    for (int i = 0; i < 10; ++i) {
+      auto [server, client] = listener.MakeSocketPair(deadline);
+      EXPECT_TRUE(server.IsValid());
+      EXPECT_TRUE(client.IsValid());
+    }
+
+    UEXPECT_THROW([[maybe_unused]] auto socket = listener.socket.Accept(
+                      Deadline::FromDuration(std::chrono::milliseconds{10})),
+                  io::IoTimeout);
+  });
+}
+
+TEST(IoUringBackend, RecvTimeout) {
+  if (!io::impl::IoUringBackend::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  RunInIoUringTaskProcessor([] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    std::array<char, 16> buf{};
+    UEXPECT_THROW(
+        server.RecvSome(buf.data(), buf.size(),
+                        Deadline::FromDuration(std::chrono::milliseconds{10})),
+        io::IoTimeout);
+
+    // The socket is still usable after the cancelled operation
+    EXPECT_EQ(client.SendAll(kData.data(), kData.size(), deadline),
+              kData.size());
+    EXPECT_EQ(server.RecvAll(buf.data(), kData.size(), deadline),
+              kData.size());
+  });
+}
+
+TEST(IoUringBackend, RecvCancel) {
+  if (!io::impl::IoUringBackend::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  RunInIoUringTaskProcessor([] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    auto receiver = engine::AsyncNoSpan([&server = server, deadline] {
+      std::array<char, 16> buf{};
+      UEXPECT_THROW(server.RecvSome(buf.data(), buf.size(), deadline),
+                    io::IoCancelled);
+    });
+    engine::SleepFor(std::chrono::milliseconds{10});
+    receiver.SyncCancel();
+    UEXPECT_NO_THROW(receiver.Get());
+  });
+}
+
+TEST(IoUringBackend, PeerClose) {
+  if (!io::impl::IoUringBackend::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  RunInIoUringTaskProcessor([] {
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    TcpListener listener;
+    auto [server, client] = listener.MakeSocketPair(deadline);
+
+    auto receiver = engine::AsyncNoSpan([&server = server, deadline] {
+      std::array<char, 16> buf{};
+      EXPECT_EQ(server.RecvSome(buf.data(), buf.size(), deadline), 0);
+    });
+    engine::SleepFor(std::chrono::milliseconds{10});
+    client.Close();
+    receiver.Get();
+  });
+}
+
+TEST(IoUringBackend, Files) {
+  if (!io::impl::IoUringBackend::IsSupported()) {
+    GTEST_SKIP() << "io_uring is not supported";
+  }
+
+  RunInIoUringTaskProcessor([] {
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = dir.GetPath() + "/file";
+
+    // Larger than a single io_uring operation transfers
+    std::string contents(3 * 1024 * 1024 + 17, '\0');
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+      contents[i] = static_cast<char>(i * 31);
+    }
+    fs::RewriteFileContents(task_processor, path, contents);
+    EXPECT_EQ(fs::blocking::ReadFileContents(path), contents);
+    EXPECT_EQ(fs::ReadFileContents(task_processor, path), contents);
+
+    fs::RewriteFileContents(task_processor, path, kData);
+    EXPECT_EQ(fs::ReadFileContents(task_processor, path), kData);
+
+    UEXPECT_THROW(fs::ReadFileContents(task_processor, path + "-missing"),
+                  std::system_error);
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,8 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/pipe.hpp>
+#include <userver/engine/io/splice.hpp>
+#include <userver/engine/sleep.hpp>
 
 #include <utils/signal_catcher.hpp>
 
@@ -136,4 +138,37 @@ UTEST(Pipe, CloseWrite) {
                                    Deadline::FromDuration(kIoTimeout)));
 }
 
+UTEST(Pipe, Splice) {
+  io::Pipe source;
+  io::Pipe destination;
+  const std::string data = "spliced data";
+  std::string received(data.size(), '\0');
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  ASSERT_EQ(data.size(),
+            source.writer.WriteAll(data.data(), data.size(), deadline));
+  EXPECT_EQ(data.size(), io::SpliceSome(source.reader, destination.writer,
+                                        1024, deadline));
+  ASSERT_EQ(data.size(), destination.reader.ReadAll(received.data(),
+                                                    received.size(), deadline));
+  EXPECT_EQ(data, received);
+
+  UEXPECT_THROW([[maybe_unused]] auto spliced = io::SpliceSome(
+                    source.reader, destination.writer, 1024,
+                    Deadline::FromDuration(kIoTimeout)),
+                io::IoTimeout);
+
+  auto writer_task = engine::AsyncNoSpan([&] {
+    engine::SleepFor(kIoTimeout);
+    [[maybe_unused]] auto wrote_bytes =
+        source.writer.WriteAll(data.data(), 1, deadline);
+    source.writer.Close();
+  });
+  EXPECT_EQ(1, io::SpliceSome(source.reader, destination.writer, 1024,
+                              deadline));
+  writer_task.Get();
+  EXPECT_EQ(0, io::SpliceSome(source.reader, destination.writer, 1024,
+                              deadline));
+}
+
 USERVER_NAMESPACE_END
@@ -1,10 +1,15 @@
 #include <userver/engine/io/socket.hpp>
 
 #include <fcntl.h>
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
 #include <sys/socket.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <array>
 #include <cerrno>
 #include <string>
 #include <vector>
@@ -69,6 +74,42 @@ Sockaddr& MemoizeAddr(Sockaddr& addr, decltype(&::getpeername) getter,
                     0);
 }
 
+// FileIoFunc wrapper for Direction::PerformFileIo
+
+[[nodiscard]] ssize_t SendFileWrapper(int fd, int file_fd, off_t* offset,
+                                      size_t len) {
+#ifdef __linux__
+  return ::sendfile(fd, file_fd, offset, len);
+#else
+  // MAC_COMPAT: sendfile has a different signature, read and send instead
+  std::array<char, 64 * 1024> buf;
+  const auto read = ::pread(file_fd, buf.data(), std::min(len, buf.size()),
+                            *offset);
+  if (read <= 0) return read;
+  const auto sent = SendWrapper(fd, buf.data(), read);
+  if (sent > 0) *offset += sent;
+  return sent;
+#endif
+}
+
+// UringFunc wrappers for Direction::PerformIo
+
+[[nodiscard]] int UringRecvWrapper(impl::IoUringBackend& uring, int fd,
+                                   void* buf, size_t len, Deadline deadline) {
+  return uring.Recv(fd, buf, len, deadline);
+}
+
+[[nodiscard]] int UringSendWrapper(impl::IoUringBackend& uring, int fd,
+                                   void* buf, size_t len, Deadline deadline) {
+  return uring.Send(fd, buf, len, deadline);
+}
+
+[[nodiscard]] int UringSendMsgWrapper(impl::IoUringBackend& uring, int fd,
+                                      struct iovec* list, size_t list_size,
+                                      Deadline deadline) {
+  return uring.SendMsg(fd, list, list_size, deadline);
+}
+
 class RecvFromWrapper {
  public:
   [[nodiscard]] ssize_t operator()(int fd, void* buf, size_t len) {
@@ -106,6 +147,28 @@ class SendToWrapper {
   const Sockaddr& dest_addr_;
 };
 
+bool IsRetriableAcceptError(int error_code) {
+  switch (error_code) {
+    case ECONNABORTED:  // DOA connection
+    case EINTR:         // signal interrupt
+    // TCP/IP network errors
+    case ENETDOWN:
+    case EPROTO:
+    case ENOPROTOOPT:
+    case EHOSTDOWN:
+#ifdef ENONET  // No ENONET in Mac OS
+    case ENONET:
+#endif
+    case EHOSTUNREACH:
+    case EOPNOTSUPP:
+    case ENETUNREACH:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
 void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
   UASSERT(data);
   UASSERT(count > 0);
@@ -220,8 +283,9 @@ size_t Socket::RecvSome(void* buf, size_t len, Deadline deadline) {
   }
   auto& dir = fd_control_->Read();
   impl::Direction::SingleUserGuard guard(dir);
-  return dir.PerformIo(guard, &RecvWrapper, buf, len, impl::TransferMode::kOnce,
-                       deadline, "RecvSome from ", peername_);
+  return dir.PerformIo(guard, &RecvWrapper, &UringRecvWrapper, buf, len,
+                       impl::TransferMode::kOnce, deadline, "RecvSome from ",
+                       peername_);
 }
 
 size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
@@ -230,7 +294,7 @@ size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
   }
   auto& dir = fd_control_->Read();
   impl::Direction::SingleUserGuard guard(dir);
-  return dir.PerformIo(guard, &RecvWrapper, buf, len,
+  return dir.PerformIo(guard, &RecvWrapper, &UringRecvWrapper, buf, len,
                        impl::TransferMode::kWhole, deadline, "RecvAll from ",
                        peername_);
 }
@@ -265,9 +329,10 @@ size_t Socket::SendAll(const struct iovec* list, std::size_t list_size,
   auto& dir = fd_control_->Write();
   impl::Direction::SingleUserGuard guard(dir);
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  return dir.PerformIoV(guard, &writev, const_cast<struct iovec*>(list),
-                        list_size, impl::TransferMode::kWhole, deadline,
-                        "SendAll to ", peername_);
+  return dir.PerformIoV(guard, &writev, &UringSendMsgWrapper,
+                        const_cast<struct iovec*>(list), list_size,
+                        impl::TransferMode::kWhole, deadline, "SendAll to ",
+                        peername_);
 }
 
 size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
@@ -277,9 +342,22 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
   auto& dir = fd_control_->Write();
   impl::Direction::SingleUserGuard guard(dir);
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  return dir.PerformIo(guard, &SendWrapper, const_cast<void*>(buf), len,
-                       impl::TransferMode::kWhole, deadline, "SendAll to ",
-                       peername_);
+  return dir.PerformIo(guard, &SendWrapper, &UringSendWrapper,
+                       const_cast<void*>(buf), len, impl::TransferMode::kWhole,
+                       deadline, "SendAll to ", peername_);
+}
+
+size_t Socket::SendFile(int file_fd, std::size_t offset, std::size_t len,
+                        Deadline deadline) {
+  if (!IsValid()) {
+    throw IoException("Attempt to SendFile to closed socket");
+  }
+  auto& dir = fd_control_->Write();
+  impl::Direction::SingleUserGuard guard(dir);
+  return dir.PerformFileIo(guard, &SendFileWrapper, file_fd,
+                           static_cast<off_t>(offset), len,
+                           impl::TransferMode::kWhole, deadline,
+                           "SendFile to ", peername_);
 }
 
 Socket::RecvFromResult Socket::RecvSomeFrom(void* buf, size_t len,
@@ -325,6 +403,29 @@ Socket Socket::Accept(Deadline deadline) {
   }
   auto& dir = fd_control_->Read();
   impl::Direction::SingleUserGuard guard(dir);
+  if (fd_control_->GetIoUring()) {
+    auto& acceptor = fd_control_->GetIoUringAcceptor();
+    for (;;) {
+      const int result = acceptor.Accept(deadline);
+      // The peer address is not reported by the multishot accept,
+      // Getpeername() requests it on demand
+      if (result >= 0) return Socket(result);
+
+      if (result == -ECANCELED) {
+        if (!dir.IsValid()) {
+          throw IoException("Fd closed during Accept");
+        }
+        if (current_task::ShouldCancel()) {
+          throw IoCancelled() << "Accept";
+        }
+        throw IoTimeout() << "Accept";
+      }
+      if (!IsRetriableAcceptError(-result)) {
+        throw IoSystemError(-result, "Error while accepting a connection");
+      }
+    }
+  }
+
   for (;;) {
     Sockaddr buf;
     auto len = buf.Capacity();
@@ -357,25 +458,11 @@ Socket Socket::Accept(Deadline deadline) {
         }
         break;
 
-      case ECONNABORTED:  // DOA connection
-      case EINTR:         // signal interrupt
-      // TCP/IP network errors
-      case ENETDOWN:
-      case EPROTO:
-      case ENOPROTOOPT:
-      case EHOSTDOWN:
-#ifdef ENONET  // No ENONET in Mac OS
-      case ENONET:
-#endif
-      case EHOSTUNREACH:
-      case EOPNOTSUPP:
-      case ENETUNREACH:
-        // retry accept()
-        break;
-
       default:
-        utils::CheckSyscallCustomException<IoSystemError>(
-            -1, "accepting a connection");
+        if (!IsRetriableAcceptError(errno)) {
+          utils::CheckSyscallCustomException<IoSystemError>(
+              -1, "accepting a connection");
+        }
     }
   }
 }
@@ -8,6 +8,7 @@
 #include <array>
 #include <cerrno>
 #include <cstdlib>
+#include <string>
 #include <string_view>
 
 #include <userver/engine/async.hpp>
@@ -17,6 +18,9 @@
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -207,6 +211,35 @@ UTEST(Socket, SendAllVectorHeap) {
   EXPECT_EQ(bytes_sent, bytes_read);
 }
 
+UTEST(Socket, SendFile) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  const auto file = fs::blocking::TempFile::Create();
+  const std::string contents(256 * 1024, 'x');
+  fs::blocking::RewriteFileContents(file.GetPath(), "header" + contents);
+  const auto fd = fs::blocking::FileDescriptor::Open(
+      file.GetPath(), fs::blocking::OpenFlag::kRead);
+
+  TcpListener listener;
+  auto sockets = listener.MakeSocketPair(deadline);
+  auto listen_task = engine::AsyncNoSpan([&sockets, &deadline, &contents] {
+    std::string buf(contents.size(), '\0');
+    EXPECT_EQ(sockets.first.RecvAll(buf.data(), buf.size(), deadline),
+              buf.size());
+    EXPECT_EQ(buf, contents);
+  });
+
+  EXPECT_EQ(sockets.second.SendFile(fd.GetNative(), 6, contents.size(),
+                                    deadline),
+            contents.size());
+  listen_task.Get();
+
+  // The file is shorter than requested
+  EXPECT_EQ(sockets.second.SendFile(fd.GetNative(), 6 + contents.size() - 1,
+                                    contents.size(), deadline),
+            1);
+}
+
 UTEST(Socket, Cancel) {
   const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
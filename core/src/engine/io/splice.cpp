@@ -0,0 +1,90 @@
+#include <userver/engine/io/splice.hpp>
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <utility>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io {
+
+namespace {
+
+#ifdef __linux__
+
+template <typename Source, typename Destination>
+std::size_t DoSpliceSome(Source& source, Destination& destination,
+                         std::size_t len, Deadline deadline) {
+  if (!source.IsValid() || !destination.IsValid()) {
+    throw IoException("Attempt to SpliceSome with a closed end");
+  }
+
+  // splice does not tell which of the ends is not ready, so the ends are
+  // waited for in turn; the destination is usually writable right away
+  bool wait_destination = true;
+  while (true) {
+    const auto spliced =
+        ::splice(source.Fd(), nullptr, destination.Fd(), nullptr, len,
+                 SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (spliced >= 0) return spliced;
+
+    const auto error_code = errno;
+    if (error_code == EINTR) continue;
+    if (error_code != EAGAIN && error_code != EWOULDBLOCK) {
+      throw IoSystemError(error_code, "SpliceSome")
+          << "Error while splicing fd=" << source.Fd()
+          << " to fd=" << destination.Fd();
+    }
+
+    if (current_task::ShouldCancel()) throw IoCancelled() << "SpliceSome";
+    const bool is_ready = std::exchange(wait_destination, !wait_destination)
+                              ? destination.WaitWriteable(deadline)
+                              : source.WaitReadable(deadline);
+    if (!is_ready) {
+      if (current_task::ShouldCancel()) throw IoCancelled() << "SpliceSome";
+      throw IoTimeout() << "SpliceSome";
+    }
+  }
+}
+
+#else
+
+// MAC_COMPAT: no splice, copy through a buffer
+template <typename Source, typename Destination>
+std::size_t DoSpliceSome(Source& source, Destination& destination,
+                         std::size_t len, Deadline deadline) {
+  std::array<char, 64 * 1024> buf;
+  const auto read =
+      source.ReadSome(buf.data(), std::min(len, buf.size()), deadline);
+  if (read == 0) return 0;
+  return destination.WriteAll(buf.data(), read, deadline);
+}
+
+#endif
+
+}  // namespace
+
+std::size_t SpliceSome(Socket& source, PipeWriter& destination,
+                       std::size_t len, Deadline deadline) {
+  return DoSpliceSome(source, destination, len, deadline);
+}
+
+std::size_t SpliceSome(PipeReader& source, Socket& destination,
+                       std::size_t len, Deadline deadline) {
+  return DoSpliceSome(source, destination, len, deadline);
+}
+
+std::size_t SpliceSome(PipeReader& source, PipeWriter& destination,
+                       std::size_t len, Deadline deadline) {
+  return DoSpliceSome(source, destination, len, deadline);
+}
+
+}  // namespace engine::io
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,240 @@
+#ifdef __linux__
+
+#include <engine/io/sys/linux/io_uring.hpp>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::sys::linux {
+
+namespace {
+
+int IoUringSetup(std::uint32_t entries, io_uring_params& params) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int IoUringEnter(int fd, std::uint32_t to_submit, std::uint32_t min_complete,
+                 std::uint32_t flags) noexcept {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+int IoUringRegister(int fd, std::uint32_t opcode, void* arg,
+                    std::uint32_t nr_args) noexcept {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+std::uint32_t LoadAcquire(const std::uint32_t* ptr) noexcept {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+void StoreRelease(std::uint32_t* ptr, std::uint32_t value) noexcept {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+void* MapRing(int fd, std::size_t size, std::uint64_t offset) {
+  return utils::CheckSyscallNotEqualsCustomException<IoSystemError>(
+      ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+             fd, static_cast<off_t>(offset)),
+      MAP_FAILED, "mapping io_uring, offset={}", offset);
+}
+
+void UnmapRing(void* ring, std::size_t size) noexcept {
+  if (ring) ::munmap(ring, size);
+}
+
+}  // namespace
+
+IoUring::IoUring(std::size_t entries) {
+  // Submit the remaining SQEs even if one of them fails to be prepared
+  params_.flags = IORING_SETUP_CLAMP | IORING_SETUP_SUBMIT_ALL;
+  fd_ = utils::CheckSyscallCustomException<IoSystemError>(
+      IoUringSetup(static_cast<std::uint32_t>(entries), params_),
+      "setting up io_uring with {} entries", entries);
+
+  try {
+    sq_ring_size_ =
+        params_.sq_off.array + params_.sq_entries * sizeof(std::uint32_t);
+    cq_ring_size_ =
+        params_.cq_off.cqes + params_.cq_entries * sizeof(io_uring_cqe);
+    if (params_.features & IORING_FEAT_SINGLE_MMAP) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ = MapRing(fd_, sq_ring_size_, IORING_OFF_SQ_RING);
+    if (params_.features & IORING_FEAT_SINGLE_MMAP) {
+      cq_ring_ = sq_ring_;
+    } else {
+      cq_ring_ = MapRing(fd_, cq_ring_size_, IORING_OFF_CQ_RING);
+    }
+    sqes_size_ = params_.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(
+        MapRing(fd_, sqes_size_, IORING_OFF_SQES));
+  } catch (const std::exception&) {
+    UnmapAndClose();
+    throw;
+  }
+
+  sq_mask_ = *SqField(params_.sq_off.ring_mask);
+  sq_array_ = SqField(params_.sq_off.array);
+  cq_mask_ = *CqField(params_.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<io_uring_cqe*>(static_cast<char*>(cq_ring_) +
+                                          params_.cq_off.cqes);
+}
+
+IoUring::~IoUring() { UnmapAndClose(); }
+
+bool IoUring::IsSupported() noexcept {
+  io_uring_params params{};
+  const int fd = IoUringSetup(1, params);
+  if (fd == -1) return false;
+
+  // IORING_OP_SOCKET was added in the same release as multishot accept and
+  // IORING_ASYNC_CANCEL_FD, there is no other way to probe for them
+  std::vector<char> probe_storage(
+      sizeof(io_uring_probe) + IORING_OP_LAST * sizeof(io_uring_probe_op));
+  auto* probe = reinterpret_cast<io_uring_probe*>(probe_storage.data());
+  const bool is_supported =
+      (params.features & IORING_FEAT_NODROP) &&
+      IoUringRegister(fd, IORING_REGISTER_PROBE, probe, IORING_OP_LAST) == 0 &&
+      probe->last_op >= IORING_OP_SOCKET &&
+      (probe->ops[IORING_OP_SOCKET].flags & IO_URING_OP_SUPPORTED);
+
+  ::close(fd);
+  return is_supported;
+}
+
+void IoUring::Submit(const io_uring_sqe& sqe,
+                     IoUringCompletionHandler* handler) {
+  {
+    std::lock_guard lock(submit_mutex_);
+    auto* const tail_ptr = SqField(params_.sq_off.tail);
+    const auto* const head_ptr = SqField(params_.sq_off.head);
+    // The tail is only written by us under the lock
+    const auto tail = *tail_ptr;
+
+    if (tail - LoadAcquire(head_ptr) >= params_.sq_entries) {
+      // Submissions are synchronous, so a single call frees the whole queue
+      // unless the kernel is out of resources
+      const int ret = IoUringEnter(fd_, params_.sq_entries, 0, 0);
+      const int error_code = ret < 0 ? errno : EBUSY;
+      if (tail - LoadAcquire(head_ptr) >= params_.sq_entries) {
+        throw IoSystemError(error_code,
+                            "flushing the full io_uring submission queue");
+      }
+    }
+
+    const auto index = tail & sq_mask_;
+    sqes_[index] = sqe;
+    sqes_[index].user_data = reinterpret_cast<std::uintptr_t>(handler);
+    sq_array_[index] = index;
+    StoreRelease(tail_ptr, tail + 1);
+  }
+
+  // Whoever publishes the first pending SQE submits the SQEs of the others
+  if (pending_submissions_.fetch_add(1, std::memory_order_acq_rel) == 0) {
+    FlushSubmissions(1);
+  }
+}
+
+void IoUring::Cancel(IoUringCompletionHandler* handler) {
+  io_uring_sqe sqe{};
+  sqe.opcode = IORING_OP_ASYNC_CANCEL;
+  sqe.fd = -1;
+  sqe.addr = reinterpret_cast<std::uintptr_t>(handler);
+  Submit(sqe, nullptr);
+}
+
+void IoUring::CancelFd(int fd) {
+  io_uring_sqe sqe{};
+  sqe.opcode = IORING_OP_ASYNC_CANCEL;
+  sqe.fd = fd;
+  sqe.cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+  Submit(sqe, nullptr);
+}
+
+std::size_t IoUring::ReapCompletions() noexcept {
+  auto* const head_ptr = CqField(params_.cq_off.head);
+  const auto* const tail_ptr = CqField(params_.cq_off.tail);
+  // The head is only written by the reaping thread
+  auto head = *head_ptr;
+
+  std::size_t reaped = 0;
+  bool overflow_flushed = false;
+  for (;;) {
+    if (head == LoadAcquire(tail_ptr)) {
+      // With IORING_FEAT_NODROP the completions that did not fit into the CQ
+      // are kept by the kernel until we ask for them
+      const auto sq_flags =
+          __atomic_load_n(SqField(params_.sq_off.flags), __ATOMIC_RELAXED);
+      if (overflow_flushed || !(sq_flags & IORING_SQ_CQ_OVERFLOW)) break;
+      IoUringEnter(fd_, 0, 0, IORING_ENTER_GETEVENTS);
+      overflow_flushed = true;
+      continue;
+    }
+
+    const io_uring_cqe cqe = cqes_[head & cq_mask_];
+    StoreRelease(head_ptr, ++head);
+    ++reaped;
+
+    // NOLINTNEXTLINE(performance-no-int-to-ptr)
+    auto* handler = reinterpret_cast<IoUringCompletionHandler*>(cqe.user_data);
+    if (handler) handler->OnCompletion(cqe.res, cqe.flags);
+  }
+  return reaped;
+}
+
+std::uint32_t* IoUring::SqField(std::uint32_t offset) const noexcept {
+  return reinterpret_cast<std::uint32_t*>(static_cast<char*>(sq_ring_) +
+                                          offset);
+}
+
+std::uint32_t* IoUring::CqField(std::uint32_t offset) const noexcept {
+  return reinterpret_cast<std::uint32_t*>(static_cast<char*>(cq_ring_) +
+                                          offset);
+}
+
+void IoUring::UnmapAndClose() noexcept {
+  UnmapRing(sqes_, sqes_size_);
+  if (cq_ring_ != sq_ring_) UnmapRing(cq_ring_, cq_ring_size_);
+  UnmapRing(sq_ring_, sq_ring_size_);
+  if (fd_ != -1) ::close(fd_);
+}
+
+void IoUring::FlushSubmissions(std::uint32_t count) noexcept {
+  while (count != 0) {
+    // The kernel submits at most the published SQEs, so the SQEs that
+    // failed to be submitted earlier are retried here as well
+    int ret = 0;
+    do {
+      ret = IoUringEnter(fd_, params_.sq_entries, 0, 0);
+    } while (ret < 0 && errno == EINTR);
+    if (ret < 0) {
+      LOG_LIMITED_ERROR() << "io_uring_enter failed: "
+                          << std::error_code(errno, std::system_category());
+    }
+
+    count = pending_submissions_.fetch_sub(count, std::memory_order_acq_rel) -
+            count;
+  }
+}
+
+}  // namespace engine::io::sys::linux
+
+USERVER_NAMESPACE_END
+
+#endif  // __linux__
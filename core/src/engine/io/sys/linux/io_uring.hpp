@@ -0,0 +1,98 @@
+#pragma once
+
+#ifdef __linux__
+
+#include <linux/io_uring.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::sys::linux {
+
+/// Receives the completions of the io_uring operations. For multishot
+/// operations OnCompletion is called for each CQE, the last one has no
+/// IORING_CQE_F_MORE flag set.
+class IoUringCompletionHandler {
+ public:
+  virtual void OnCompletion(int result, std::uint32_t flags) noexcept = 0;
+
+ protected:
+  ~IoUringCompletionHandler() = default;
+};
+
+/// A thin wrapper around the io_uring submission and completion rings,
+/// without liburing.
+///
+/// Submission is thread safe: concurrent submitters are combined, so that
+/// a single io_uring_enter call submits the SQEs of several threads.
+/// Completions must be reaped by a single thread.
+class IoUring final {
+ public:
+  /// @throws IoSystemError if io_uring can not be set up
+  explicit IoUring(std::size_t entries);
+  ~IoUring();
+
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+
+  /// Returns false if the kernel lacks some of the io_uring features that we
+  /// rely on: multishot accept, cancellation by fd, no CQ overflow drops.
+  /// All of them are available since Linux 5.19.
+  static bool IsSupported() noexcept;
+
+  /// The ring fd is readable when there are completions to reap
+  int Fd() const noexcept { return fd_; }
+
+  /// Submits the operation, `handler` must be alive until its last
+  /// completion. A nullptr `handler` ignores the completion.
+  /// @throws IoSystemError if the submission queue can not be flushed
+  void Submit(const io_uring_sqe& sqe, IoUringCompletionHandler* handler);
+
+  /// Cancels the operation of the `handler` if any, the handler gets
+  /// -ECANCELED unless the operation has already completed.
+  void Cancel(IoUringCompletionHandler* handler);
+
+  /// Cancels all the operations on the fd
+  void CancelFd(int fd);
+
+  /// Calls the handlers of the available completions, returns the number of
+  /// the reaped completions. Must be called from a single thread only.
+  std::size_t ReapCompletions() noexcept;
+
+ private:
+  std::uint32_t* SqField(std::uint32_t offset) const noexcept;
+  std::uint32_t* CqField(std::uint32_t offset) const noexcept;
+
+  void UnmapAndClose() noexcept;
+  void FlushSubmissions(std::uint32_t count) noexcept;
+
+  int fd_{-1};
+  io_uring_params params_{};
+
+  void* sq_ring_{nullptr};
+  std::size_t sq_ring_size_{0};
+  void* cq_ring_{nullptr};
+  std::size_t cq_ring_size_{0};
+  io_uring_sqe* sqes_{nullptr};
+  std::size_t sqes_size_{0};
+
+  std::uint32_t sq_mask_{0};
+  std::uint32_t* sq_array_{nullptr};
+  std::uint32_t cq_mask_{0};
+  io_uring_cqe* cqes_{nullptr};
+
+  // Guards the SQ tail and the SQE slots
+  std::mutex submit_mutex_;
+  // SQEs that were published but not yet submitted by io_uring_enter
+  std::atomic<std::uint32_t> pending_submissions_{0};
+};
+
+}  // namespace engine::io::sys::linux
+
+USERVER_NAMESPACE_END
+
+#endif  // __linux__
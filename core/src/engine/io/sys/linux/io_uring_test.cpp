@@ -0,0 +1,194 @@
+#ifdef __linux__
+
+#include <engine/io/sys/linux/io_uring.hpp>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using engine::io::sys::linux::IoUring;
+
+namespace {
+
+class RecordingHandler final
+    : public engine::io::sys::linux::IoUringCompletionHandler {
+ public:
+  void OnCompletion(int result, std::uint32_t flags) noexcept override {
+    ++completions;
+    last_result = result;
+    last_flags = flags;
+  }
+
+  int completions{0};
+  int last_result{0};
+  std::uint32_t last_flags{0};
+};
+
+class SocketPair final {
+ public:
+  SocketPair() {
+    EXPECT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds_), 0);
+  }
+  ~SocketPair() {
+    ::close(fds_[0]);
+    ::close(fds_[1]);
+  }
+
+  int First() const { return fds_[0]; }
+  int Second() const { return fds_[1]; }
+
+ private:
+  int fds_[2]{-1, -1};
+};
+
+bool WaitForCompletions(const IoUring& ring) {
+  ::pollfd pfd{ring.Fd(), POLLIN, 0};
+  return ::poll(&pfd, 1, /*timeout_ms=*/5000) == 1;
+}
+
+io_uring_sqe MakeRecv(int fd, void* buf, std::size_t len) {
+  io_uring_sqe sqe{};
+  sqe.opcode = IORING_OP_RECV;
+  sqe.fd = fd;
+  sqe.addr = reinterpret_cast<std::uintptr_t>(buf);
+  sqe.len = len;
+  return sqe;
+}
+
+}  // namespace
+
+TEST(IoUring, Recv) {
+  if (!IoUring::IsSupported()) GTEST_SKIP() << "io_uring is not supported";
+
+  IoUring ring(8);
+  SocketPair sockets;
+  RecordingHandler handler;
+  std::array<char, 16> buf{};
+
+  ring.Submit(MakeRecv(sockets.First(), buf.data(), buf.size()), &handler);
+  EXPECT_EQ(ring.ReapCompletions(), 0);
+
+  constexpr std::string_view kData = "hello";
+  ASSERT_EQ(::write(sockets.Second(), kData.data(), kData.size()),
+            static_cast<ssize_t>(kData.size()));
+
+  ASSERT_TRUE(WaitForCompletions(ring));
+  EXPECT_EQ(ring.ReapCompletions(), 1);
+  EXPECT_EQ(handler.completions, 1);
+  ASSERT_EQ(handler.last_result, static_cast<int>(kData.size()));
+  EXPECT_EQ(std::string_view(buf.data(), kData.size()), kData);
+}
+
+TEST(IoUring, Cancel) {
+  if (!IoUring::IsSupported()) GTEST_SKIP() << "io_uring is not supported";
+
+  IoUring ring(8);
+  SocketPair sockets;
+  RecordingHandler first;
+  RecordingHandler second;
+  std::array<char, 16> buf{};
+
+  ring.Submit(MakeRecv(sockets.First(), buf.data(), buf.size()), &first);
+  ring.Submit(MakeRecv(sockets.Second(), buf.data(), buf.size()), &second);
+
+  ring.Cancel(&first);
+  ASSERT_TRUE(WaitForCompletions(ring));
+  ring.ReapCompletions();
+  EXPECT_EQ(first.completions, 1);
+  EXPECT_EQ(first.last_result, -ECANCELED);
+  EXPECT_EQ(second.completions, 0);
+
+  ring.CancelFd(sockets.Second());
+  ASSERT_TRUE(WaitForCompletions(ring));
+  ring.ReapCompletions();
+  EXPECT_EQ(second.completions, 1);
+  EXPECT_EQ(second.last_result, -ECANCELED);
+}
+
+TEST(IoUring, MultishotAccept) {
+  if (!IoUring::IsSupported()) GTEST_SKIP() << "io_uring is not supported";
+
+  const int listener = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+  ASSERT_NE(listener, -1);
+  ::sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addr_len = sizeof(addr);
+  ASSERT_EQ(::bind(listener, reinterpret_cast<::sockaddr*>(&addr), addr_len),
+            0);
+  ASSERT_EQ(::listen(listener, 16), 0);
+  ASSERT_EQ(::getsockname(listener, reinterpret_cast<::sockaddr*>(&addr),
+                          &addr_len),
+            0);
+
+  IoUring ring(8);
+  RecordingHandler handler;
+  io_uring_sqe sqe{};
+  sqe.opcode = IORING_OP_ACCEPT;
+  sqe.fd = listener;
+  sqe.ioprio = IORING_ACCEPT_MULTISHOT;
+  sqe.accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+  ring.Submit(sqe, &handler);
+
+  constexpr int kConnections = 3;
+  for (int i = 0; i < kConnections; ++i) {
+    const int client = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_EQ(
+        ::connect(client, reinterpret_cast<::sockaddr*>(&addr), addr_len), 0);
+    ASSERT_TRUE(WaitForCompletions(ring));
+    ring.ReapCompletions();
+    EXPECT_EQ(handler.completions, i + 1);
+    EXPECT_GE(handler.last_result, 0);
+    EXPECT_TRUE(handler.last_flags & IORING_CQE_F_MORE);
+    ::close(handler.last_result);
+    ::close(client);
+  }
+
+  ring.Cancel(&handler);
+  ASSERT_TRUE(WaitForCompletions(ring));
+  ring.ReapCompletions();
+  EXPECT_EQ(handler.completions, kConnections + 1);
+  EXPECT_EQ(handler.last_result, -ECANCELED);
+  EXPECT_FALSE(handler.last_flags & IORING_CQE_F_MORE);
+
+  ::close(listener);
+}
+
+TEST(IoUring, FullSubmissionQueue) {
+  if (!IoUring::IsSupported()) GTEST_SKIP() << "io_uring is not supported";
+
+  constexpr std::size_t kEntries = 4;
+  constexpr std::size_t kOperations = kEntries * 4;
+  IoUring ring(kEntries);
+
+  std::array<RecordingHandler, kOperations> handlers;
+  for (auto& handler : handlers) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_NOP;
+    ring.Submit(sqe, &handler);
+  }
+
+  std::size_t reaped = 0;
+  while (reaped < kOperations && WaitForCompletions(ring)) {
+    reaped += ring.ReapCompletions();
+  }
+  EXPECT_EQ(reaped, kOperations);
+  for (const auto& handler : handlers) {
+    EXPECT_EQ(handler.completions, 1);
+    EXPECT_EQ(handler.last_result, 0);
+  }
+}
+
+USERVER_NAMESPACE_END
+
+#endif  // __linux__
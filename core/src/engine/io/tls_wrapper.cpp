@@ -1,18 +1,36 @@
 #include <userver/engine/io/tls_wrapper.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <exception>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 #include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#else
+#include <openssl/hmac.h>
+#endif
 
 #include <crypto/helpers.hpp>
 #include <crypto/openssl.hpp>
 #include <engine/io/fd_control.hpp>
 #include <userver/engine/io/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -48,6 +66,10 @@ void BIO_set_shutdown(BIO* bio, int shutdown) { bio->shutdown = shutdown; }
 
 constexpr const char* kBioMethodName = "userver-socket";
 
+// Each SSL_write produces at least one TLS record and a socket write, so the
+// small buffers of a vectored send are glued together
+constexpr std::size_t kCoalesceBufferSize = 4096;
+
 struct SocketBioData {
   explicit SocketBioData(Socket&& socket) : socket(std::move(socket)) {
     if (!this->socket) {
@@ -225,11 +247,165 @@ SslCtx MakeSslCtx() {
   return ssl_ctx;
 }
 
+// Builds the ALPN wire format: length prefixed protocol names
+std::string MakeAlpnProtocolList(const std::vector<std::string>& protocols) {
+  std::string result;
+  for (const auto& protocol : protocols) {
+    UINVARIANT(!protocol.empty() && protocol.size() <= 255,
+               fmt::format("Invalid ALPN protocol name '{}'", protocol));
+    result += static_cast<char>(protocol.size());
+    result += protocol;
+  }
+  return result;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x010002000L
+int SelectAlpnProtocol(SSL*, const unsigned char** out, unsigned char* outlen,
+                       const unsigned char* in, unsigned int inlen,
+                       void* arg) noexcept {
+  const auto& server_protocols = *static_cast<const std::string*>(arg);
+  unsigned char* selected = nullptr;
+  // Server preference order
+  if (SSL_select_next_proto(
+          &selected, outlen,
+          reinterpret_cast<const unsigned char*>(server_protocols.data()),
+          server_protocols.size(), in, inlen) != OPENSSL_NPN_NEGOTIATED) {
+    // No common protocol, proceed as if the client did not use ALPN
+    return SSL_TLSEXT_ERR_NOACK;
+  }
+  *out = selected;
+  return SSL_TLSEXT_ERR_OK;
+}
+#endif
+
+// Session ticket key layout, see TlsSessionTicketKeys::kKeySize
+constexpr std::size_t kTicketKeyNameSize = 16;
+constexpr std::size_t kTicketHmacKeySize = 32;
+constexpr std::size_t kTicketAesKeySize = 32;
+static_assert(kTicketKeyNameSize + kTicketHmacKeySize + kTicketAesKeySize ==
+              TlsSessionTicketKeys::kKeySize);
+
+}  // namespace
+
+class TlsSessionTicketKeys::Impl final {
+ public:
+  rcu::Variable<std::vector<std::string>> keys;
+};
+
+namespace {
+
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+using TicketMacCtx = EVP_MAC_CTX;
+#else
+using TicketMacCtx = HMAC_CTX;
+#endif
+
+bool InitTicketMac(TicketMacCtx* mac_ctx, const std::string& key) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto* hmac_key = const_cast<char*>(key.data() + kTicketKeyNameSize);
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+  char digest[] = "SHA256";
+  const std::array params{
+      OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, hmac_key,
+                                        kTicketHmacKeySize),
+      OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+      OSSL_PARAM_construct_end(),
+  };
+  return 1 == EVP_MAC_CTX_set_params(mac_ctx, params.data());
+#else
+  return 1 == HMAC_Init_ex(mac_ctx, hmac_key, kTicketHmacKeySize,
+                           EVP_sha256(), nullptr);
+#endif
+}
+
+// Returns 1 to use the key, 2 to use the key and renew the ticket, 0 if the
+// ticket key is unknown and -1 on error
+int SessionTicketKeyCallback(SSL* ssl, unsigned char* key_name,
+                             unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+                             TicketMacCtx* mac_ctx, int enc) noexcept {
+  auto* keys_impl = static_cast<TlsSessionTicketKeys::Impl*>(
+      SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
+  UASSERT(keys_impl);
+  const auto keys = keys_impl->keys.Read();
+  UASSERT(!keys->empty());
+
+  const auto aes_key = [](const std::string& key) {
+    return reinterpret_cast<const unsigned char*>(
+        key.data() + kTicketKeyNameSize + kTicketHmacKeySize);
+  };
+
+  if (enc) {
+    const auto& key = keys->front();
+    std::memcpy(key_name, key.data(), kTicketKeyNameSize);
+    const auto iv_size = EVP_CIPHER_iv_length(EVP_aes_256_cbc());
+    if (1 != RAND_bytes(iv, iv_size)) return -1;
+    if (1 != EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr,
+                                aes_key(key), iv)) {
+      return -1;
+    }
+    return InitTicketMac(mac_ctx, key) ? 1 : -1;
+  }
+
+  for (std::size_t i = 0; i < keys->size(); ++i) {
+    const auto& key = (*keys)[i];
+    if (std::memcmp(key_name, key.data(), kTicketKeyNameSize) != 0) continue;
+
+    if (1 != EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr,
+                                aes_key(key), iv)) {
+      return -1;
+    }
+    if (!InitTicketMac(mac_ctx, key)) return -1;
+    return i == 0 ? 1 : 2;
+  }
+  // Issued before the rotation of all the known keys, a full handshake
+  return 0;
+}
+
+void SetUpSessionTickets(SSL_CTX* ssl_ctx,
+                         TlsSessionTicketKeys& session_ticket_keys) {
+  // The session is bound to the context, the same for all the servers that
+  // share the keys
+  constexpr std::string_view kSessionIdContext = "userver";
+  if (1 != SSL_CTX_set_session_id_context(
+               ssl_ctx,
+               reinterpret_cast<const unsigned char*>(kSessionIdContext.data()),
+               kSessionIdContext.size())) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: "
+        "SSL_CTX_set_session_id_context"));
+  }
+  SSL_CTX_set_app_data(ssl_ctx, &session_ticket_keys.GetImpl());
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L
+  const auto ret = SSL_CTX_set_tlsext_ticket_key_evp_cb(
+      ssl_ctx, &SessionTicketKeyCallback);
+#else
+  // cast in openssl1.1 macro expansion
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  const auto ret =
+      SSL_CTX_set_tlsext_ticket_key_cb(ssl_ctx, &SessionTicketKeyCallback);
+#endif
+  if (1 != ret) {
+    throw TlsException(crypto::FormatSslError(
+        "Failed to set up server TLS wrapper: session ticket key callback"));
+  }
+}
+
 enum InterruptAction {
   kPass,
   kFail,
 };
 
+// kTLS is supported by OpenSSL 3.0+ built with enable-ktls. OpenSSL
+// installs the session keys into the kernel during the handshake only if the
+// write (read) BIO is a socket BIO, so the kTLS sessions use the stock
+// socket BIO on the nonblocking socket and wait for the socket readiness on
+// SSL_ERROR_WANT_READ/SSL_ERROR_WANT_WRITE themselves.
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L && !defined(OPENSSL_NO_KTLS)
+constexpr bool kIsKernelTlsSupported = true;
+#else
+constexpr bool kIsKernelTlsSupported = false;
+#endif
+
 }  // namespace
 
 class TlsWrapper::Impl {
@@ -239,12 +415,21 @@ class TlsWrapper::Impl {
   Impl(Impl&& other) noexcept
       : bio_data(std::move(other.bio_data)),
         ssl(std::move(other.ssl)),
-        is_in_shutdown(other.is_in_shutdown) {
+        is_in_shutdown(other.is_in_shutdown),
+        uses_socket_bio(other.uses_socket_bio) {
     UASSERT(SSL_get_rbio(ssl.get()) == SSL_get_wbio(ssl.get()));
-    SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
+    // The stock socket BIO refers to the fd only
+    if (!uses_socket_bio) {
+      SyncBioData(SSL_get_rbio(ssl.get()), &other.bio_data);
+    }
   }
 
-  void SetUp(SslCtx&& ssl_ctx) {
+  void SetUp(SslCtx&& ssl_ctx, bool kernel_tls = false) {
+    if (kernel_tls && kIsKernelTlsSupported) {
+      SetUpKernelTls(std::move(ssl_ctx));
+      return;
+    }
+
     Bio socket_bio{BIO_new(GetSocketBioMethod())};
     if (!socket_bio) {
       throw TlsException(
@@ -266,6 +451,45 @@ class TlsWrapper::Impl {
     [[maybe_unused]] const auto* disowned_bio = socket_bio.release();
   }
 
+  // Runs SSL_connect or SSL_accept
+  void Handshake(int (*handshake_func)(SSL*), Deadline deadline,
+                 std::string_view side) {
+    bio_data.current_deadline = deadline;
+    while (true) {
+      const auto ret = handshake_func(ssl.get());
+      if (ret == 1) return;
+
+      if (bio_data.last_exception) {
+        std::rethrow_exception(bio_data.last_exception);
+      }
+      const auto ssl_error = SSL_get_error(ssl.get(), ret);
+      if (uses_socket_bio && (ssl_error == SSL_ERROR_WANT_READ ||
+                              ssl_error == SSL_ERROR_WANT_WRITE)) {
+        WaitSocket(ssl_error, deadline, 0, "Handshake");
+        continue;
+      }
+      throw TlsException(crypto::FormatSslError(fmt::format(
+          "Failed to set up {} TLS wrapper ({})", side, ssl_error)));
+    }
+  }
+
+  // Waits for the socket readiness requested by the SSL_ERROR_WANT_* of the
+  // stock socket BIO, throws on timeout or cancellation like the userver
+  // socket BIO does
+  void WaitSocket(int ssl_error, Deadline deadline,
+                  std::size_t bytes_transferred, const char* context) {
+    UASSERT(uses_socket_bio);
+    const bool is_ready = ssl_error == SSL_ERROR_WANT_READ
+                              ? bio_data.socket.WaitReadable(deadline)
+                              : bio_data.socket.WaitWriteable(deadline);
+    if (is_ready) return;
+
+    if (current_task::ShouldCancel()) {
+      throw IoCancelled(bytes_transferred) << context;
+    }
+    throw IoTimeout(bytes_transferred) << context;
+  }
+
   template <typename SslIoFunc>
   size_t PerformSslIo(SslIoFunc&& io_func, void* buf, size_t len,
                       impl::TransferMode mode, InterruptAction interrupt_action,
@@ -308,6 +532,17 @@ class TlsWrapper::Impl {
             UINVARIANT(false,
                        fmt::format("Unexpected SSL_ERROR: {}", ssl_error));
         }
+        if (uses_socket_bio && (ssl_error == SSL_ERROR_WANT_READ ||
+                                ssl_error == SSL_ERROR_WANT_WRITE)) {
+          try {
+            WaitSocket(ssl_error, deadline, pos - begin, context);
+          } catch (const IoInterrupted&) {
+            // See the comment below
+            if (interrupt_action == InterruptAction::kFail) ssl.reset();
+            throw;
+          }
+          continue;
+        }
         if (bio_data.last_exception) {
           if (interrupt_action == InterruptAction::kFail) {
             // Sometimes (when writing) we must either retry the io_func with
@@ -336,8 +571,26 @@ class TlsWrapper::Impl {
   SocketBioData bio_data;
   Ssl ssl;
   bool is_in_shutdown{false};
+  bool uses_socket_bio{false};
 
  private:
+  void SetUpKernelTls(SslCtx&& ssl_ctx) {
+    ssl.reset(SSL_new(ssl_ctx.get()));
+    if (!ssl) {
+      throw TlsException(
+          crypto::FormatSslError("Failed to set up TLS wrapper: SSL_new"));
+    }
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L && !defined(OPENSSL_NO_KTLS)
+    SSL_set_options(ssl.get(), SSL_OP_ENABLE_KTLS);
+#endif
+    // Creates a socket BIO that does not own the fd
+    if (1 != SSL_set_fd(ssl.get(), bio_data.socket.Fd())) {
+      throw TlsException(
+          crypto::FormatSslError("Failed to set up TLS wrapper: SSL_set_fd"));
+    }
+    uses_socket_bio = true;
+  }
+
   void SyncBioData(BIO* bio,
                    [[maybe_unused]] SocketBioData* old_data) noexcept {
     UASSERT(BIO_get_data(bio) == old_data);
@@ -345,6 +598,33 @@ class TlsWrapper::Impl {
   }
 };
 
+TlsSessionTicketKeys::TlsSessionTicketKeys()
+    : impl_(std::make_unique<Impl>()) {
+  std::string key(kKeySize, '\0');
+  if (1 != RAND_bytes(reinterpret_cast<unsigned char*>(key.data()),
+                      key.size())) {
+    throw TlsException(
+        crypto::FormatSslError("Failed to generate a session ticket key"));
+  }
+  impl_->keys.Assign({std::move(key)});
+}
+
+TlsSessionTicketKeys::~TlsSessionTicketKeys() = default;
+
+void TlsSessionTicketKeys::SetKeys(std::vector<std::string> keys) {
+  if (keys.empty()) {
+    throw std::invalid_argument("No TLS session ticket keys");
+  }
+  for (const auto& key : keys) {
+    if (key.size() != kKeySize) {
+      throw std::invalid_argument(
+          fmt::format("Invalid TLS session ticket key size {}, expected {}",
+                      key.size(), kKeySize));
+    }
+  }
+  impl_->keys.Assign(std::move(keys));
+}
+
 TlsWrapper::TlsWrapper(Socket&& socket) : impl_(std::move(socket)) {}
 
 TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
@@ -378,26 +658,20 @@ TlsWrapper TlsWrapper::StartTlsClient(Socket&& socket,
     }
   }
 
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_connect(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
-
-    throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up client TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
-  }
+  wrapper.impl_->Handshake(&SSL_connect, deadline, "client");
   return wrapper;
 }
 
 TlsWrapper TlsWrapper::StartTlsServer(
     Socket&& socket, const crypto::Certificate& cert,
     const crypto::PrivateKey& key, Deadline deadline,
-    const std::vector<crypto::Certificate>& cert_authorities) {
+    const std::vector<crypto::Certificate>& cert_authorities,
+    const std::vector<std::string>& alpn_protocols, bool kernel_tls,
+    TlsSessionTicketKeys* session_ticket_keys) {
   auto ssl_ctx = MakeSslCtx();
+  if (session_ticket_keys) {
+    SetUpSessionTickets(ssl_ctx.get(), *session_ticket_keys);
+  }
 
   if (!cert_authorities.empty()) {
     auto* store = SSL_CTX_get_cert_store(ssl_ctx.get());
@@ -425,19 +699,33 @@ TlsWrapper TlsWrapper::StartTlsServer(
         "Failed to set up server TLS wrapper: SSL_CTX_use_PrivateKey"));
   }
 
-  TlsWrapper wrapper{std::move(socket)};
-  wrapper.impl_->SetUp(std::move(ssl_ctx));
-  wrapper.impl_->bio_data.current_deadline = deadline;
-
-  auto ret = SSL_accept(wrapper.impl_->ssl.get());
-  if (1 != ret) {
-    if (wrapper.impl_->bio_data.last_exception) {
-      std::rethrow_exception(wrapper.impl_->bio_data.last_exception);
-    }
+  // Used by the ALPN callback during the handshake only, renegotiation is
+  // disabled
+  const auto alpn_protocol_list = MakeAlpnProtocolList(alpn_protocols);
+  if (!alpn_protocol_list.empty()) {
+#if OPENSSL_VERSION_NUMBER >= 0x010002000L
+    SSL_CTX_set_alpn_select_cb(
+        ssl_ctx.get(), &SelectAlpnProtocol,
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const_cast<std::string*>(&alpn_protocol_list));
+#else
+    LOG_LIMITED_WARNING() << "ALPN is not supported by the OpenSSL version";
+#endif
+  }
 
-    throw TlsException(crypto::FormatSslError(
-        fmt::format("Failed to set up server TLS wrapper ({})",
-                    SSL_get_error(wrapper.impl_->ssl.get(), ret))));
+  TlsWrapper wrapper{std::move(socket)};
+  wrapper.impl_->SetUp(std::move(ssl_ctx), kernel_tls);
+
+  {
+    const utils::ScopeGuard reset_alpn_callback([&] {
+#if OPENSSL_VERSION_NUMBER >= 0x010002000L
+      if (!alpn_protocol_list.empty()) {
+        SSL_CTX_set_alpn_select_cb(SSL_get_SSL_CTX(wrapper.impl_->ssl.get()),
+                                   nullptr, nullptr);
+      }
+#endif
+    });
+    wrapper.impl_->Handshake(&SSL_accept, deadline, "server");
   }
 
   return wrapper;
@@ -488,6 +776,53 @@ size_t TlsWrapper::SendAll(const void* buf, size_t len, Deadline deadline) {
                              deadline, "SendAll");
 }
 
+size_t TlsWrapper::SendAll(const IoData* list, std::size_t list_size,
+                           Deadline deadline) {
+  std::array<char, kCoalesceBufferSize> buffer;
+  std::size_t buffered = 0;
+  size_t result = 0;
+
+  for (std::size_t i = 0; i < list_size; ++i) {
+    const auto* data = static_cast<const char*>(list[i].data);
+    auto len = list[i].len;
+    if (len == 0) continue;
+
+    if (buffered != 0) {
+      // Top up the buffer with the head of the current piece
+      const auto consumed = std::min(len, buffer.size() - buffered);
+      std::memcpy(buffer.data() + buffered, data, consumed);
+      buffered += consumed;
+      data += consumed;
+      len -= consumed;
+      if (buffered < buffer.size()) continue;
+
+      result += SendAll(buffer.data(), buffered, deadline);
+      buffered = 0;
+    }
+
+    if (len < buffer.size()) {
+      std::memcpy(buffer.data(), data, len);
+      buffered = len;
+    } else {
+      result += SendAll(data, len, deadline);
+    }
+  }
+
+  if (buffered != 0) result += SendAll(buffer.data(), buffered, deadline);
+  return result;
+}
+
+std::string TlsWrapper::GetAlpnProtocol() const {
+  if (!impl_->ssl) return {};
+#if OPENSSL_VERSION_NUMBER >= 0x010002000L
+  const unsigned char* protocol = nullptr;
+  unsigned int length = 0;
+  SSL_get0_alpn_selected(impl_->ssl.get(), &protocol, &length);
+  if (protocol) return {reinterpret_cast<const char*>(protocol), length};
+#endif
+  return {};
+}
+
 Socket TlsWrapper::StopTls(Deadline deadline) {
   if (impl_->ssl) {
     impl_->is_in_shutdown = true;
@@ -501,6 +836,9 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
           // this is fine
           case SSL_ERROR_WANT_READ:
           case SSL_ERROR_WANT_WRITE:
+            if (impl_->uses_socket_bio) {
+              impl_->WaitSocket(ssl_error, deadline, 0, "StopTls");
+            }
             break;
 
           // connection breaking errors
@@ -525,6 +863,28 @@ Socket TlsWrapper::StopTls(Deadline deadline) {
   return std::move(impl_->bio_data.socket);
 }
 
+bool TlsWrapper::IsSessionReused() const {
+  return impl_->ssl && SSL_session_reused(impl_->ssl.get()) == 1;
+}
+
+bool TlsWrapper::IsKernelTlsSendEnabled() const {
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L && !defined(OPENSSL_NO_KTLS)
+  if (impl_->ssl && impl_->uses_socket_bio) {
+    return BIO_get_ktls_send(SSL_get_wbio(impl_->ssl.get())) == 1;
+  }
+#endif
+  return false;
+}
+
+bool TlsWrapper::IsKernelTlsRecvEnabled() const {
+#if OPENSSL_VERSION_NUMBER >= 0x030000000L && !defined(OPENSSL_NO_KTLS)
+  if (impl_->ssl && impl_->uses_socket_bio) {
+    return BIO_get_ktls_recv(SSL_get_rbio(impl_->ssl.get())) == 1;
+  }
+#endif
+  return false;
+}
+
 int TlsWrapper::GetRawFd() { return impl_->bio_data.socket.Fd(); }
 
 }  // namespace engine::io
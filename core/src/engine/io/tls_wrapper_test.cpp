@@ -1,10 +1,15 @@
 #include <userver/utest/utest.hpp>
 
+#include <fcntl.h>
 #include <openssl/opensslv.h>
+#include <openssl/ssl.h>
 #include <sys/socket.h>
+#include <unistd.h>
 
 #include <stdexcept>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include <userver/engine/async.hpp>
@@ -137,6 +142,78 @@ v2R63aFo/UfQSQ4dhC0o2Vy74DyLwnO3pH8wudfBJ8/LX/Uz/A==
 
 constexpr auto kShortTimeout = std::chrono::milliseconds{10};
 
+// Blocking OpenSSL client that keeps the session between the connections,
+// TlsWrapper clients never resume the sessions
+class ResumingTlsClient final {
+ public:
+  ResumingTlsClient() : ctx_(SSL_CTX_new(TLS_client_method())) {}
+
+  ~ResumingTlsClient() {
+    if (session_) SSL_SESSION_free(session_);
+    SSL_CTX_free(ctx_);
+  }
+
+  // Reads a byte to get the session tickets and shuts the connection down.
+  // Returns whether the session was resumed.
+  bool Connect(int fd) {
+    ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) & ~O_NONBLOCK);
+    SSL* ssl = SSL_new(ctx_);
+    SSL_set_fd(ssl, fd);
+    if (session_) SSL_set_session(ssl, session_);
+
+    bool is_reused = false;
+    char c = 0;
+    if (SSL_connect(ssl) == 1 && SSL_read(ssl, &c, 1) == 1) {
+      is_reused = SSL_session_reused(ssl) == 1;
+      if (session_) SSL_SESSION_free(session_);
+      session_ = SSL_get1_session(ssl);
+      SSL_shutdown(ssl);
+    } else {
+      ADD_FAILURE() << "TLS client connection failed";
+    }
+    SSL_free(ssl);
+    ::close(fd);
+    return is_reused;
+  }
+
+ private:
+  SSL_CTX* ctx_;
+  SSL_SESSION* session_{nullptr};
+};
+
+// Connects the client to a new server with its own SSL context, returns
+// whether the session was resumed
+bool ConnectWithTicketKeys(ResumingTlsClient& client,
+                           io::TlsSessionTicketKeys& keys, Deadline deadline) {
+  TcpListener tcp_listener;
+  auto [server, client_socket] = tcp_listener.MakeSocketPair(deadline);
+
+  auto server_task = engine::AsyncNoSpan(
+      [&keys, deadline](auto&& server) {
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key), deadline, {}, {},
+            /*kernel_tls=*/false, &keys);
+        EXPECT_EQ(1, tls_server.SendAll("1", 1, deadline));
+        char c = 0;
+        EXPECT_EQ(0, tls_server.RecvSome(&c, 1, deadline));
+        return tls_server.IsSessionReused();
+      },
+      std::move(server));
+
+  bool is_client_reused = false;
+  std::thread client_thread(
+      [&client, &is_client_reused, fd = std::move(client_socket).Release()] {
+        is_client_reused = client.Connect(fd);
+      });
+  const bool is_server_reused = server_task.Get();
+  client_thread.join();
+
+  EXPECT_EQ(is_server_reused, is_client_reused);
+  return is_server_reused;
+}
+
 }  // namespace
 
 UTEST_MT(TlsWrapper, Smoke, 2) {
@@ -216,6 +293,46 @@ UTEST_MT(TlsWrapper, DocTest, 2) {
   EXPECT_EQ(result, kData.substr(0, result.size()));
 }
 
+UTEST_MT(TlsWrapper, SendVector, 2) {
+  const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(deadline);
+
+  // Small pieces are coalesced, large ones are partially sent as is
+  const std::string header = "header";
+  const std::string empty;
+  const std::string large(100 * 1024, 'x');
+  const std::string trailer = "trailer";
+  const auto expected = header + large + trailer + header;
+
+  auto server_task = engine::AsyncNoSpan(
+      [&, deadline](auto&& server) {
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key), deadline);
+        io::WritableBase& writable = tls_server;
+        EXPECT_EQ(expected.size(),
+                  writable.WriteAll({{header.data(), header.size()},
+                                     {empty.data(), empty.size()},
+                                     {large.data(), large.size()},
+                                     {trailer.data(), trailer.size()},
+                                     {header.data(), header.size()}},
+                                    deadline));
+      },
+      std::move(server));
+
+  auto tls_client =
+      io::TlsWrapper::StartTlsClient(std::move(client), {}, deadline);
+  std::string buffer(expected.size(), '\0');
+  EXPECT_EQ(expected.size(),
+            tls_client.RecvAll(buffer.data(), buffer.size(), deadline));
+  EXPECT_EQ(expected, buffer);
+
+  server_task.Get();
+}
+
 UTEST(TlsWrapper, Move) {
   const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
 
@@ -572,4 +689,103 @@ UTEST(TlsWrapper, PeerDisconnect) {
   server_task.Get();
 }
 
+UTEST_MT(TlsWrapper, KernelTls, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  TcpListener tcp_listener;
+  auto [server, client] = tcp_listener.MakeSocketPair(test_deadline);
+
+  // The data spans several TLS records
+  const std::string data(100'000, 'x');
+
+  engine::SingleConsumerEvent timeout_happened;
+  auto server_task = engine::AsyncNoSpan(
+      [test_deadline, &data, &timeout_happened](auto&& server) {
+        // Falls back to the userspace encryption where kTLS is not available
+        auto tls_server = io::TlsWrapper::StartTlsServer(
+            std::forward<decltype(server)>(server),
+            crypto::Certificate::LoadFromString(cert),
+            crypto::PrivateKey::LoadFromString(key), test_deadline, {}, {},
+            /*kernel_tls=*/true);
+        LOG_INFO() << "kTLS send: " << tls_server.IsKernelTlsSendEnabled()
+                   << ", recv: " << tls_server.IsKernelTlsRecvEnabled();
+
+        char c = 0;
+        UEXPECT_THROW(static_cast<void>(tls_server.RecvSome(
+                          &c, 1, Deadline::FromDuration(kShortTimeout))),
+                      io::IoTimeout);
+        timeout_happened.Send();
+
+        std::string received(data.size(), '\0');
+        EXPECT_EQ(data.size(),
+                  tls_server.RecvAll(received.data(), received.size(),
+                                     test_deadline));
+        EXPECT_EQ(data, received);
+        EXPECT_EQ(data.size(),
+                  tls_server.SendAll(data.data(), data.size(), test_deadline));
+      },
+      std::move(server));
+
+  auto tls_client =
+      io::TlsWrapper::StartTlsClient(std::move(client), {}, test_deadline);
+  ASSERT_TRUE(timeout_happened.WaitForEventUntil(test_deadline));
+  EXPECT_EQ(data.size(),
+            tls_client.SendAll(data.data(), data.size(), test_deadline));
+  std::string received(data.size(), '\0');
+  EXPECT_EQ(data.size(), tls_client.RecvAll(received.data(), received.size(),
+                                            test_deadline));
+  EXPECT_EQ(data, received);
+
+  server_task.Get();
+}
+
+UTEST_MT(TlsWrapper, SessionTicketKeysShared, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  io::TlsSessionTicketKeys keys;
+  ResumingTlsClient client;
+  EXPECT_FALSE(ConnectWithTicketKeys(client, keys, test_deadline));
+  // Another server context decrypts the ticket with the shared key
+  EXPECT_TRUE(ConnectWithTicketKeys(client, keys, test_deadline));
+  EXPECT_TRUE(ConnectWithTicketKeys(client, keys, test_deadline));
+
+  // A server with other keys does a full handshake
+  io::TlsSessionTicketKeys other_keys;
+  EXPECT_FALSE(ConnectWithTicketKeys(client, other_keys, test_deadline));
+}
+
+UTEST_MT(TlsWrapper, SessionTicketKeysRotation, 2) {
+  const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+  const std::string old_key(io::TlsSessionTicketKeys::kKeySize, 'o');
+  const std::string new_key(io::TlsSessionTicketKeys::kKeySize, 'n');
+  const std::string unknown_key(io::TlsSessionTicketKeys::kKeySize, 'u');
+
+  io::TlsSessionTicketKeys keys;
+  keys.SetKeys({old_key});
+  ResumingTlsClient client;
+  EXPECT_FALSE(ConnectWithTicketKeys(client, keys, test_deadline));
+
+  // The ticket of the old key is still accepted and is renewed with the new key
+  keys.SetKeys({new_key, old_key});
+  EXPECT_TRUE(ConnectWithTicketKeys(client, keys, test_deadline));
+
+  keys.SetKeys({new_key});
+  EXPECT_TRUE(ConnectWithTicketKeys(client, keys, test_deadline));
+
+  keys.SetKeys({unknown_key});
+  EXPECT_FALSE(ConnectWithTicketKeys(client, keys, test_deadline));
+}
+
+UTEST(TlsWrapper, SessionTicketKeysInvalid) {
+  io::TlsSessionTicketKeys keys;
+  UEXPECT_THROW(keys.SetKeys({}), std::invalid_argument);
+  UEXPECT_THROW(keys.SetKeys({std::string(16, 'k')}), std::invalid_argument);
+  UEXPECT_THROW(
+      keys.SetKeys({std::string(io::TlsSessionTicketKeys::kKeySize, 'k'),
+                    std::string(io::TlsSessionTicketKeys::kKeySize + 1, 'k')}),
+      std::invalid_argument);
+  UEXPECT_NO_THROW(
+      keys.SetKeys({std::string(io::TlsSessionTicketKeys::kKeySize, 'k')}));
+}
+
 USERVER_NAMESPACE_END
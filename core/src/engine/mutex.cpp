@@ -6,10 +6,15 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine {
 
-class Mutex::Impl final : public impl::MutexImpl<impl::WaitList> {};
+class Mutex::Impl final : public impl::MutexImpl<impl::WaitList> {
+ public:
+  using MutexImpl::MutexImpl;
+};
 
 Mutex::Mutex() = default;
 
+Mutex::Mutex(Fairness fairness) : impl_(fairness == Fairness::kHandoff) {}
+
 Mutex::~Mutex() = default;
 
 void Mutex::lock() { impl_->lock(); }
@@ -1,6 +1,8 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <mutex>
 #include <thread>
@@ -55,6 +57,16 @@ class AsyncCoroPool {
   std::vector<engine::TaskWithResult<void>> tasks;
 };
 
+// engine::Mutex with Fairness::kHandoff
+class HandoffMutex final {
+ public:
+  void lock() { mutex_.lock(); }
+  void unlock() { mutex_.unlock(); }
+
+ private:
+  engine::Mutex mutex_{engine::Mutex::Fairness::kHandoff};
+};
+
 template <typename T>
 struct PoolForImpl;
 
@@ -68,6 +80,11 @@ struct PoolForImpl<engine::Mutex> {
   using Pool = AsyncCoroPool;
 };
 
+template <>
+struct PoolForImpl<HandoffMutex> {
+  using Pool = AsyncCoroPool;
+};
+
 template <>
 struct PoolForImpl<engine::SingleWaitingTaskMutex> {
   using Pool = AsyncCoroPool;
@@ -212,6 +229,79 @@ void generic_contention_with_payload(benchmark::State& state) {
       total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
 }
 
+// Most of the critical sections are short, but every 16th one is ~100 times
+// longer, as with a cache that is sometimes rebuilt under the lock. Reports
+// the worst lock acquisition time to show the starvation of the waiters.
+template <typename Mutex>
+void generic_contention_mixed_payload(benchmark::State& state) {
+  constexpr std::uint64_t kLongSectionEvery = 16;
+  constexpr int kShortPayload = 2;
+  constexpr int kLongPayload = 200;
+
+  std::atomic<bool> run{true};
+  std::atomic<std::uint64_t> lock_unlock_count{0};
+  std::atomic<std::int64_t> max_wait_ns{0};
+  concurrent::impl::InterferenceShield<Mutex> m;
+
+  const auto lock_unlock = [&](std::uint64_t iteration,
+                               std::int64_t& local_max_wait_ns) {
+    const auto start = std::chrono::steady_clock::now();
+    m->lock();
+    const auto wait_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+    local_max_wait_ns = std::max(local_max_wait_ns, wait_ns);
+
+    const int payload = iteration % kLongSectionEvery == 0 ? kLongPayload
+                                                           : kShortPayload;
+    for (int i = 0; i < payload; ++i) {
+      benchmark::DoNotOptimize(utils::Rand());
+    }
+    m->unlock();
+  };
+
+  const auto update_max_wait = [&](std::int64_t local_max_wait_ns) {
+    auto current = max_wait_ns.load();
+    while (current < local_max_wait_ns &&
+           !max_wait_ns.compare_exchange_weak(current, local_max_wait_ns)) {
+    }
+  };
+
+  PoolFor<Mutex> pool(state.range(0) - 1, [&]() {
+    std::uint64_t local_lock_unlock_count = 0;
+    std::int64_t local_max_wait_ns = 0;
+
+    while (run) {
+      lock_unlock(local_lock_unlock_count, local_max_wait_ns);
+      ++local_lock_unlock_count;
+    }
+
+    lock_unlock_count += local_lock_unlock_count;
+    update_max_wait(local_max_wait_ns);
+  });
+
+  std::uint64_t local_lock_unlock_count = 0;
+  std::int64_t local_max_wait_ns = 0;
+
+  for ([[maybe_unused]] auto _ : state) {
+    lock_unlock(local_lock_unlock_count, local_max_wait_ns);
+    ++local_lock_unlock_count;
+  }
+
+  lock_unlock_count += local_lock_unlock_count;
+  update_max_wait(local_max_wait_ns);
+
+  run = false;
+  pool.Wait();
+  const auto total_lock_unlock_count =
+      static_cast<double>(lock_unlock_count.load());
+  state.counters["locks"] =
+      benchmark::Counter(total_lock_unlock_count, benchmark::Counter::kIsRate);
+  state.counters["locks-per-thread"] = benchmark::Counter(
+      total_lock_unlock_count / state.range(0), benchmark::Counter::kIsRate);
+  state.counters["max-wait-ns"] = static_cast<double>(max_wait_ns.load());
+}
+
 //////// Benchmarks
 
 // Note: We intentionally do not run std::* benchmarks from RunStandalone to
@@ -276,6 +366,22 @@ void single_waiting_task_mutex_contention_with_payload(
   });
 }
 
+void mutex_coro_contention_mixed_payload(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    generic_contention_mixed_payload<engine::Mutex>(state);
+  });
+}
+
+void mutex_coro_handoff_contention_mixed_payload(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    generic_contention_mixed_payload<HandoffMutex>(state);
+  });
+}
+
+void mutex_std_contention_mixed_payload(benchmark::State& state) {
+  generic_contention_mixed_payload<std::mutex>(state);
+}
+
 }  // namespace
 
 BENCHMARK(mutex_coro_lock);
@@ -294,4 +400,14 @@ BENCHMARK(mutex_coro_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(mutex_std_contention_with_payload)->RangeMultiplier(2)->Range(1, 32);
 BENCHMARK(single_waiting_task_mutex_contention_with_payload)->Range(1, 2);
 
+BENCHMARK(mutex_coro_contention_mixed_payload)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK(mutex_coro_handoff_contention_mixed_payload)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+BENCHMARK(mutex_std_contention_mixed_payload)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
 USERVER_NAMESPACE_END
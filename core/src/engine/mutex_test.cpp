@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <userver/engine/async.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/shared_mutex.hpp>
@@ -13,6 +15,35 @@ using namespace std::chrono_literals;
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+// engine::Mutex with Fairness::kHandoff for the typed tests
+class HandoffMutex final {
+ public:
+  void lock() { mutex_.lock(); }
+  void unlock() { mutex_.unlock(); }
+  bool try_lock() noexcept { return mutex_.try_lock(); }
+
+  template <typename Rep, typename Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period>& duration) {
+    return mutex_.try_lock_for(duration);
+  }
+
+  template <typename Clock, typename Duration>
+  bool try_lock_until(const std::chrono::time_point<Clock, Duration>& until) {
+    return mutex_.try_lock_until(until);
+  }
+
+  bool try_lock_until(engine::Deadline deadline) {
+    return mutex_.try_lock_until(deadline);
+  }
+
+ private:
+  engine::Mutex mutex_{engine::Mutex::Fairness::kHandoff};
+};
+
+}  // namespace
+
 template <class T>
 struct Mutex : public ::testing::Test {};
 TYPED_UTEST_SUITE_P(Mutex);
@@ -165,12 +196,51 @@ UTEST(Mutex, SampleMutex) {
   /// [Sample engine::Mutex usage]
 }
 
+UTEST(Mutex, HandoffPassesOwnership) {
+  engine::Mutex mutex{engine::Mutex::Fairness::kHandoff};
+  std::unique_lock lock(mutex);
+
+  auto waiter = engine::AsyncNoSpan([&mutex] { std::lock_guard lock(mutex); });
+  engine::Yield();
+  lock.unlock();
+
+  // The mutex now belongs to the waiter, even though it has not run yet
+  EXPECT_FALSE(mutex.try_lock());
+  waiter.Get();
+
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+UTEST(Mutex, HandoffIsFifo) {
+  constexpr std::size_t kWaiters = 5;
+  engine::Mutex mutex{engine::Mutex::Fairness::kHandoff};
+  std::unique_lock lock(mutex);
+
+  std::vector<std::size_t> order;
+  std::vector<engine::TaskWithResult<void>> waiters;
+  for (std::size_t i = 0; i < kWaiters; ++i) {
+    waiters.push_back(engine::AsyncNoSpan([&mutex, &order, i] {
+      std::lock_guard lock(mutex);
+      order.push_back(i);
+    }));
+    engine::Yield();
+  }
+
+  lock.unlock();
+  for (auto& waiter : waiters) waiter.Get();
+
+  const std::vector<std::size_t> expected{0, 1, 2, 3, 4};
+  EXPECT_EQ(order, expected);
+}
+
 REGISTER_TYPED_UTEST_SUITE_P(Mutex,
 
                              LockUnlock, LockUnlockDouble, WaitAndCancel,
                              TryLock, LockPassing, NotifyAndDeadlineRace);
 
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineMutex, Mutex, engine::Mutex);
+INSTANTIATE_TYPED_UTEST_SUITE_P(EngineHandoffMutex, Mutex, HandoffMutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSharedMutex, Mutex, engine::SharedMutex);
 INSTANTIATE_TYPED_UTEST_SUITE_P(EngineSingleWaitingTaskMutex, Mutex,
                                 engine::SingleWaitingTaskMutex);
@@ -0,0 +1,226 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/single_threaded_task_processors_pool.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+// Scheduler benchmarks: latency of wakeups and task handoffs between workers.
+// Each benchmark reports latency percentiles of a single iteration in
+// nanoseconds along with the usual mean time, run them with different worker
+// counts to compare scheduling policies.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+class LatencyRecorder final {
+ public:
+  explicit LatencyRecorder(benchmark::State& state) : state_(state) {
+    latencies_ns_.reserve(1 << 16);
+  }
+
+  LatencyRecorder(const LatencyRecorder&) = delete;
+  LatencyRecorder& operator=(const LatencyRecorder&) = delete;
+
+  ~LatencyRecorder() {
+    if (latencies_ns_.empty()) return;
+    std::sort(latencies_ns_.begin(), latencies_ns_.end());
+
+    const auto percentile = [this](double p) {
+      const auto index =
+          static_cast<std::size_t>(p / 100 * latencies_ns_.size());
+      return static_cast<double>(
+          latencies_ns_[std::min(index, latencies_ns_.size() - 1)]);
+    };
+    state_.counters["p50_ns"] = percentile(50);
+    state_.counters["p90_ns"] = percentile(90);
+    state_.counters["p99_ns"] = percentile(99);
+    state_.counters["p99.9_ns"] = percentile(99.9);
+  }
+
+  void Record(Clock::time_point start) { Record(Clock::now() - start); }
+
+  void Record(Clock::duration duration) {
+    latencies_ns_.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+            .count());
+  }
+
+ private:
+  benchmark::State& state_;
+  std::vector<std::int64_t> latencies_ns_;
+};
+
+// Runs `pong` in a separate task that answers every ping
+class PingPong final {
+ public:
+  explicit PingPong(engine::TaskProcessor& peer_task_processor) {
+    peer_ = engine::AsyncNoSpan(peer_task_processor, [this] {
+      while (ping_.WaitForEvent() && keep_running_) pong_.Send();
+    });
+  }
+
+  ~PingPong() {
+    keep_running_ = false;
+    ping_.Send();
+    peer_.Get();
+  }
+
+  void RoundTrip() {
+    ping_.Send();
+    [[maybe_unused]] const bool ok = pong_.WaitForEvent();
+  }
+
+ private:
+  engine::SingleConsumerEvent ping_;
+  engine::SingleConsumerEvent pong_;
+  std::atomic<bool> keep_running_{true};
+  engine::TaskWithResult<void> peer_;
+};
+
+}  // namespace
+
+// Wakeup of a task waiting for an event and back, the tasks migrate freely
+// between the workers of a single task processor
+void engine_scheduler_ping_pong(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    LatencyRecorder recorder{state};
+    PingPong ping_pong{engine::current_task::GetTaskProcessor()};
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto start = Clock::now();
+      ping_pong.RoundTrip();
+      recorder.Record(start);
+    }
+  });
+}
+BENCHMARK(engine_scheduler_ping_pong)->RangeMultiplier(2)->Range(1, 8);
+
+// Same as above, but the peer task lives on another task processor, so every
+// wakeup crosses the task processor boundary
+void engine_scheduler_cross_processor_ping_pong(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    auto peer_pool = engine::SingleThreadedTaskProcessorsPool::MakeForTests(1);
+    LatencyRecorder recorder{state};
+    PingPong ping_pong{peer_pool.At(0)};
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto start = Clock::now();
+      ping_pong.RoundTrip();
+      recorder.Record(start);
+    }
+  });
+}
+BENCHMARK(engine_scheduler_cross_processor_ping_pong)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+// Spawns a task on another task processor and waits for its result
+void engine_scheduler_cross_processor_handoff(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    auto peer_pool = engine::SingleThreadedTaskProcessorsPool::MakeForTests(1);
+    LatencyRecorder recorder{state};
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto start = Clock::now();
+      engine::AsyncNoSpan(peer_pool.At(0), [] {}).Get();
+      recorder.Record(start);
+    }
+  });
+}
+BENCHMARK(engine_scheduler_cross_processor_handoff)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+// Spawns N tasks and waits for all of them
+void engine_scheduler_fan_out_fan_in(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    const auto tasks_count = state.range(1);
+    LatencyRecorder recorder{state};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(tasks_count);
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto start = Clock::now();
+      for (std::int64_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([] {}));
+      }
+      for (auto& task : tasks) task.Get();
+      recorder.Record(start);
+
+      tasks.clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * tasks_count);
+  });
+}
+BENCHMARK(engine_scheduler_fan_out_fan_in)
+    ->ArgsProduct({{1, 2, 4, 8}, {16, 256}});
+
+// Start latency of a task while the queue of the task processor is contended
+// by `workers - 1` background spawners and by a spawner on a foreign task
+// processor. Spawners wait for each batch to keep the queue bounded.
+void engine_scheduler_spawn_under_contention(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    auto& tp = engine::current_task::GetTaskProcessor();
+    auto foreign_pool =
+        engine::SingleThreadedTaskProcessorsPool::MakeForTests(1);
+
+    std::atomic<bool> keep_running{true};
+    const auto spawner = [&] {
+      constexpr std::size_t kBatchSize = 16;
+      std::vector<engine::TaskWithResult<void>> batch;
+      batch.reserve(kBatchSize);
+
+      std::uint64_t spawned = 0;
+      while (keep_running) {
+        for (std::size_t i = 0; i < kBatchSize; ++i) {
+          batch.push_back(engine::AsyncNoSpan(tp, [] {}));
+        }
+        for (auto& task : batch) task.Get();
+        batch.clear();
+        spawned += kBatchSize;
+      }
+      return spawned;
+    };
+
+    std::vector<engine::TaskWithResult<std::uint64_t>> spawners;
+    for (std::int64_t i = 0; i < state.range(0) - 1; ++i) {
+      spawners.push_back(engine::AsyncNoSpan(spawner));
+    }
+    spawners.push_back(engine::AsyncNoSpan(foreign_pool.At(0), spawner));
+
+    {
+      LatencyRecorder recorder{state};
+      for ([[maybe_unused]] auto _ : state) {
+        const auto start = Clock::now();
+        const auto started_after =
+            engine::AsyncNoSpan([start] { return Clock::now() - start; })
+                .Get();
+        recorder.Record(started_after);
+      }
+    }
+
+    keep_running = false;
+    std::uint64_t spawned = 0;
+    for (auto& task : spawners) spawned += task.Get();
+
+    state.counters["background_spawns"] =
+        benchmark::Counter(spawned, benchmark::Counter::kIsRate);
+  });
+}
+BENCHMARK(engine_scheduler_spawn_under_contention)
+    ->RangeMultiplier(2)
+    ->Range(1, 8);
+
+USERVER_NAMESPACE_END
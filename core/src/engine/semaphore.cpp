@@ -31,6 +31,8 @@ class SemaphoreWaitStrategy final : public impl::WaitStrategy {
     return impl::EarlyWakeup{false};
   }
 
+  std::string_view GetWaitKind() const noexcept override { return "semaphore"; }
+
   void DisableWakeups() noexcept override {
     lock_.lock();
     waiters_.Remove(lock_, current_);
@@ -16,6 +16,8 @@ class SingleConsumerEvent::EventWaitStrategy final : public impl::WaitStrategy {
     return impl::EarlyWakeup{event_.waiters_->GetSignalOrAppend(&current_)};
   }
 
+  std::string_view GetWaitKind() const noexcept override { return "event"; }
+
   void DisableWakeups() noexcept override { event_.waiters_->Remove(current_); }
 
  private:
@@ -16,6 +16,8 @@ class CommonSleepWaitStrategy final : public WaitStrategy {
 
   EarlyWakeup SetupWakeups() override { return EarlyWakeup{false}; }
 
+  std::string_view GetWaitKind() const noexcept override { return "sleep"; }
+
   void DisableWakeups() noexcept override {}
 };
 }  // namespace
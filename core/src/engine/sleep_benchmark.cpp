@@ -1,9 +1,13 @@
 #include <benchmark/benchmark.h>
 
+#include <cstdint>
+#include <vector>
+
 #include <engine/ev/thread_control.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 
 using namespace std::chrono_literals;
 
@@ -67,4 +71,27 @@ BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false);
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, unreached_task_deadline,
                   true);
 
+// Many tasks arm long timers that are never reached, as the IO timeouts do
+void concurrent_unreached_sleep_benchmark(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(state.range(0));
+
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::int64_t i = 0; i < state.range(0); ++i) {
+        tasks.push_back(engine::AsyncNoSpan(
+            [] { engine::InterruptibleSleepFor(20s); }));
+      }
+      engine::Yield();
+      for (auto& task : tasks) task.SyncCancel();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+  });
+}
+BENCHMARK(concurrent_unreached_sleep_benchmark)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024 * 16)
+    ->Unit(benchmark::kMicrosecond);
+
 USERVER_NAMESPACE_END
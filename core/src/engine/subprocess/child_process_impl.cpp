@@ -3,6 +3,8 @@
 #include <sys/types.h>
 
 #include <csignal>
+#include <stdexcept>
+#include <string>
 
 #include <userver/engine/task/cancel.hpp>
 #include <utils/check_syscall.hpp>
@@ -11,6 +13,20 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
+namespace {
+
+template <typename PipeEnd>
+PipeEnd& GetPipeEnd(std::optional<PipeEnd>& pipe_end, const char* name) {
+  if (!pipe_end) {
+    throw std::logic_error(std::string{name} +
+                           " of the child process is not piped, see "
+                           "engine::subprocess::ExecOptions");
+  }
+  return *pipe_end;
+}
+
+}  // namespace
+
 ChildProcessImpl::ChildProcessImpl(int pid,
                                    Future<ChildProcessStatus>&& status_future)
     : pid_(pid), status_future_(std::move(status_future)) {}
@@ -35,6 +51,18 @@ void ChildProcessImpl::SendSignal(int signum) {
   utils::CheckSyscall(kill(pid_, signum), "kill, pid={}", pid_);
 }
 
+io::PipeWriter& ChildProcessImpl::GetStdin() {
+  return GetPipeEnd(pipes_.stdin_writer, "stdin");
+}
+
+io::PipeReader& ChildProcessImpl::GetStdout() {
+  return GetPipeEnd(pipes_.stdout_reader, "stdout");
+}
+
+io::PipeReader& ChildProcessImpl::GetStderr() {
+  return GetPipeEnd(pipes_.stderr_reader, "stderr");
+}
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
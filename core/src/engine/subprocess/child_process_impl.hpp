@@ -1,15 +1,24 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/future.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process_status.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::subprocess {
 
+// Parent ends of the pipes connected to the standard streams of the child
+struct ChildProcessPipes final {
+  std::optional<io::PipeWriter> stdin_writer;
+  std::optional<io::PipeReader> stdout_reader;
+  std::optional<io::PipeReader> stderr_reader;
+};
+
 class ChildProcessImpl {
  public:
   ChildProcessImpl(int pid, Future<ChildProcessStatus>&& status_future);
@@ -24,9 +33,16 @@ class ChildProcessImpl {
 
   void SendSignal(int signum);
 
+  void SetPipes(ChildProcessPipes&& pipes) { pipes_ = std::move(pipes); }
+
+  io::PipeWriter& GetStdin();
+  io::PipeReader& GetStdout();
+  io::PipeReader& GetStderr();
+
  private:
   int pid_;
   Future<ChildProcessStatus> status_future_;
+  ChildProcessPipes pipes_;
 };
 
 }  // namespace engine::subprocess
@@ -1,5 +1,6 @@
 #include <userver/engine/subprocess/process_starter.hpp>
 
+#include <fcntl.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -13,8 +14,10 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <userver/engine/io/pipe.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
 #include <utils/check_syscall.hpp>
 
 #include <engine/ev/child_process_map.hpp>
@@ -31,10 +34,37 @@ USERVER_NAMESPACE_BEGIN
 namespace engine::subprocess {
 namespace {
 
+constexpr int kInheritedFd = -1;
+
+// Child ends of the pipes to the standard streams of the child
+struct ChildPipeFds final {
+  int stdin_fd{kInheritedFd};
+  int stdout_fd{kInheritedFd};
+  int stderr_fd{kInheritedFd};
+};
+
+void RedirectToPipe(int pipe_fd, int std_fd) {
+  if (pipe_fd == kInheritedFd) return;
+
+  // The pipes are non-blocking, while the programs expect blocking standard
+  // streams. The flag of the child end is shared only with the copy in the
+  // parent, which is closed there after the fork.
+  const auto flags =
+      utils::CheckSyscall(::fcntl(pipe_fd, F_GETFL), "fcntl F_GETFL");
+  utils::CheckSyscall(::fcntl(pipe_fd, F_SETFL, flags & ~O_NONBLOCK),
+                      "fcntl F_SETFL");
+  utils::CheckSyscall(::dup2(pipe_fd, std_fd), "dup2 pipe to fd {}", std_fd);
+}
+
 void DoExecve(const std::string& command, const std::vector<std::string>& args,
               const EnvironmentVariables& env,
               const std::optional<std::string>& stdout_file,
-              const std::optional<std::string>& stderr_file) {
+              const std::optional<std::string>& stderr_file,
+              const ChildPipeFds& pipe_fds) {
+  RedirectToPipe(pipe_fds.stdin_fd, STDIN_FILENO);
+  RedirectToPipe(pipe_fds.stdout_fd, STDOUT_FILENO);
+  RedirectToPipe(pipe_fds.stderr_fd, STDERR_FILENO);
+
   if (stdout_file) {
     if (!std::freopen(stdout_file->c_str(), "a", stdout)) {
       utils::CheckSyscall(-1, "freopen stdout to {}", *stdout_file);
@@ -82,9 +112,41 @@ ChildProcess ProcessStarter::Exec(
     const EnvironmentVariables& env,
     const std::optional<std::string>& stdout_file,
     const std::optional<std::string>& stderr_file) {
+  ExecOptions options;
+  options.stdout_file = stdout_file;
+  options.stderr_file = stderr_file;
+  return DoExec(command, args, env, options);
+}
+
+ChildProcess ProcessStarter::DoExec(const std::string& command,
+                                    const std::vector<std::string>& args,
+                                    const EnvironmentVariables& env,
+                                    const ExecOptions& options) {
+  UINVARIANT(!options.pipe_stdout || !options.stdout_file,
+             "stdout of a child process cannot be both piped and redirected "
+             "to a file");
+  UINVARIANT(!options.pipe_stderr || !options.stderr_file,
+             "stderr of a child process cannot be both piped and redirected "
+             "to a file");
+
   tracing::Span span("ProcessStarter::Exec");
   span.AddTag("command", command);
-  Promise<ChildProcess> promise;
+
+  std::optional<io::Pipe> stdin_pipe;
+  std::optional<io::Pipe> stdout_pipe;
+  std::optional<io::Pipe> stderr_pipe;
+  ChildPipeFds pipe_fds;
+  if (options.pipe_stdin) {
+    pipe_fds.stdin_fd = stdin_pipe.emplace().reader.Fd();
+  }
+  if (options.pipe_stdout) {
+    pipe_fds.stdout_fd = stdout_pipe.emplace().writer.Fd();
+  }
+  if (options.pipe_stderr) {
+    pipe_fds.stderr_fd = stderr_pipe.emplace().writer.Fd();
+  }
+
+  Promise<ChildProcessImpl> promise;
   auto future = promise.get_future();
   thread_control_.RunInEvLoopAsync([&, promise = std::move(promise)]() mutable {
     LOG_DEBUG() << "do fork() + execve(), command=" << command << ", args=["
@@ -108,8 +170,8 @@ ChildProcess ProcessStarter::Exec(
       auto res = ChildProcessMapSet(
           pid, ev::ChildProcessMapValue(std::move(exec_result_promise)));
       if (res.second) {
-        promise.set_value(ChildProcess{
-            ChildProcessImpl{pid, res.first->status_promise.get_future()}});
+        promise.set_value(
+            ChildProcessImpl{pid, res.first->status_promise.get_future()});
       } else {
         std::string msg = "process with pid=" + std::to_string(pid) +
                           " already exists in child_process_map";
@@ -121,7 +183,8 @@ ChildProcess ProcessStarter::Exec(
       // in child thread
       try {
         try {
-          DoExecve(command, args, env, stdout_file, stderr_file);
+          DoExecve(command, args, env, options.stdout_file,
+                   options.stderr_file, pipe_fds);
         } catch (const std::exception& ex) {
           std::cerr << "Cannot execute child: " << ex.what();
         }
@@ -134,7 +197,25 @@ ChildProcess ProcessStarter::Exec(
   });
 
   engine::TaskCancellationBlocker cancel_blocker;
-  return future.get();
+  auto impl = future.get();
+
+  // The child has its own copies of the child ends
+  ChildProcessPipes pipes;
+  if (stdin_pipe) {
+    stdin_pipe->reader.Close();
+    pipes.stdin_writer.emplace(std::move(stdin_pipe->writer));
+  }
+  if (stdout_pipe) {
+    stdout_pipe->writer.Close();
+    pipes.stdout_reader.emplace(std::move(stdout_pipe->reader));
+  }
+  if (stderr_pipe) {
+    stderr_pipe->writer.Close();
+    pipes.stderr_reader.emplace(std::move(stderr_pipe->reader));
+  }
+  impl.SetPipes(std::move(pipes));
+
+  return ChildProcess{std::move(impl)};
 }
 
 ChildProcess ProcessStarter::Exec(
@@ -156,6 +237,15 @@ ChildProcess ProcessStarter::Exec(
               stderr_file);
 }
 
+ChildProcess ProcessStarter::Exec(const std::string& command,
+                                  const std::vector<std::string>& args,
+                                  const ExecOptions& options) {
+  if (options.env) return DoExec(command, args, *options.env, options);
+  return DoExec(command, args,
+                EnvironmentVariables{GetCurrentEnvironmentVariables()},
+                options);
+}
+
 }  // namespace engine::subprocess
 
 USERVER_NAMESPACE_END
@@ -19,6 +19,7 @@
 
 #include <engine/ev/thread_control.hpp>
 #include <engine/ev/thread_pool.hpp>
+#include <userver/engine/io/pipe.hpp>
 #include <userver/engine/subprocess/child_process.hpp>
 #include <userver/engine/subprocess/process_starter.hpp>
 #include <userver/engine/task/task.hpp>
@@ -65,6 +66,35 @@ UTEST(Subprocess, False) {
   EXPECT_NE(0, status.GetExitCode());
 }
 
+UTEST(Subprocess, Pipes) {
+  engine::subprocess::ProcessStarter starter(
+      engine::current_task::GetTaskProcessor());
+  const auto deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  /// [Exec with pipes]
+  engine::subprocess::ExecOptions options;
+  options.pipe_stdin = true;
+  options.pipe_stdout = true;
+  auto child = starter.Exec("/bin/cat", {}, options);
+
+  const std::string input = "Hello from the parent";
+  ASSERT_EQ(input.size(),
+            child.GetStdin().WriteAll(input.data(), input.size(), deadline));
+  child.GetStdin().Close();
+
+  std::string output(input.size(), '\0');
+  ASSERT_EQ(output.size(),
+            child.GetStdout().ReadAll(output.data(), output.size(), deadline));
+  /// [Exec with pipes]
+  EXPECT_EQ(input, output);
+
+  const auto status = child.Get();
+  ASSERT_TRUE(status.IsExited());
+  EXPECT_EQ(0, status.GetExitCode());
+  UEXPECT_THROW(child.GetStderr(), std::logic_error);
+}
+
 UTEST(Subprocess, CheckLogClosesFds) {
   auto file = fs::blocking::TempFile::Create("/tmp", kLogFilePart);
   auto logger = logging::MakeFileLogger("to_file", file.GetPath(),
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
@@ -99,4 +100,36 @@ void async_comparisons_coro_spanned(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro_spanned)->RangeMultiplier(2)->Range(1, 32);
 
+void async_comparisons_coro_inherit_variables(benchmark::State& state) {
+  engine::RunStandalone(state.range(0), [&] {
+    std::uint64_t constructed_joined_count = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      utils::AsyncNoSpanInheritVariables([] {}).Wait();
+      ++constructed_joined_count;
+    }
+    benchmark::DoNotOptimize(constructed_joined_count);
+  });
+}
+BENCHMARK(async_comparisons_coro_inherit_variables)
+    ->RangeMultiplier(2)
+    ->Range(1, 32);
+
+// Many tasks alive at the same time do not fit into the per-thread freelists
+void async_comparisons_coro_batch(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    constexpr std::size_t kTasksCount = 256;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasksCount);
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(engine::AsyncNoSpan([] {}));
+      }
+      for (auto& task : tasks) task.Wait();
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * kTasksCount);
+  });
+}
+BENCHMARK(async_comparisons_coro_batch);
+
 USERVER_NAMESPACE_END
@@ -18,6 +18,11 @@ enum class Action {
   kWakeupByEpoch,
 };
 
+// The timer wheel has ~1ms granularity, the shorter timers keep the precision
+// of libev timers. The longer ones (e.g. the IO timeouts, which are rarely
+// reached) are cheaper to arm and to cancel in the wheel.
+constexpr std::chrono::milliseconds kMinTimerWheelTimeLeft{10};
+
 template <class Derived>
 class Finalizer : public ev::SingleShotAsyncPayload<Finalizer<Derived>> {
  public:
@@ -62,9 +67,11 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   void DoFinalizeInEvThread();
 
  private:
+  void ArmTimerInEvThread(Deadline::Duration time_left) noexcept;
   void StopTimerInEvThread() noexcept;
 
   static void OnTimer(struct ev_loop*, ev_timer* w, int) noexcept;
+  static void OnWheelTimer(ev::TimerWheel::Entry& entry) noexcept;
   static void InvokeTimerFunction(const Params& params, TaskContext& context);
   void DoOnTimer();
 
@@ -72,6 +79,7 @@ class ContextTimer::Impl final : public TimerArmer<Impl>,
   ev::TimerThreadControl* thread_control_ = nullptr;
   Params params_;
   ev_timer timer_{};
+  ev::TimerWheel::Entry wheel_entry_{&OnWheelTimer};
   ev::DataPipeToEv<Params> params_pipe_to_ev_;
 };
 
@@ -79,11 +87,13 @@ ContextTimer::Impl::Impl() {
   timer_.data = this;
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   ev_init(&timer_, OnTimer);
+  wheel_entry_.data = this;
 }
 
 ContextTimer::Impl::~Impl() {
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
   UASSERT(!ev_is_active(&timer_));
+  UASSERT(!wheel_entry_.IsScheduled());
 }
 
 bool ContextTimer::Impl::WasStarted() const noexcept {
@@ -137,19 +147,31 @@ void ContextTimer::Impl::DoArmTimerInEvThread() {
   params_ = std::move(*params);
 
   using LibEvDuration = std::chrono::duration<double>;
-  const auto time_left =
-      std::chrono::duration_cast<LibEvDuration>(params_.deadline.TimeLeft())
-          .count();
+  const auto time_left = params_.deadline.TimeLeft();
 
-  LOG_TRACE() << "time_left=" << time_left;
-  if (time_left <= 0.0) {
+  LOG_TRACE() << "time_left="
+              << std::chrono::duration_cast<LibEvDuration>(time_left).count();
+  if (time_left <= Deadline::Duration::zero()) {
     // Optimization for small deadlines or high load
     DoOnTimer();
     return;
   }
 
-  timer_.repeat = time_left;
+  ArmTimerInEvThread(time_left);
+}
+
+void ContextTimer::Impl::ArmTimerInEvThread(
+    Deadline::Duration time_left) noexcept {
   UASSERT(thread_control_);
+  if (time_left >= kMinTimerWheelTimeLeft && thread_control_->HasTimerWheel()) {
+    thread_control_->Stop(timer_);
+    thread_control_->Start(wheel_entry_, time_left);
+    return;
+  }
+
+  using LibEvDuration = std::chrono::duration<double>;
+  thread_control_->Stop(wheel_entry_);
+  timer_.repeat = std::chrono::duration_cast<LibEvDuration>(time_left).count();
   thread_control_->Again(timer_);
 }
 
@@ -171,6 +193,7 @@ void ContextTimer::Impl::InvokeTimerFunction(const Params& params,
 void ContextTimer::Impl::StopTimerInEvThread() noexcept {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
   thread_control_->Stop(timer_);
+  thread_control_->Stop(wheel_entry_);
 }
 
 void ContextTimer::Impl::DoFinalizeInEvThread() {
@@ -193,6 +216,21 @@ void ContextTimer::Impl::OnTimer(struct ev_loop*, ev_timer* w, int) noexcept {
   ev_timer->DoOnTimer();
 }
 
+void ContextTimer::Impl::OnWheelTimer(ev::TimerWheel::Entry& entry) noexcept {
+  UASSERT(!engine::current_task::IsTaskProcessorThread());
+
+  auto* ev_timer = static_cast<Impl*>(entry.data);
+  UASSERT(ev_timer != nullptr);
+
+  // The timers beyond the wheel range fire early
+  const auto time_left = ev_timer->params_.deadline.TimeLeft();
+  if (time_left > Deadline::Duration::zero()) {
+    ev_timer->ArmTimerInEvThread(time_left);
+    return;
+  }
+  ev_timer->DoOnTimer();
+}
+
 void ContextTimer::Impl::DoOnTimer() {
   UASSERT(!engine::current_task::IsTaskProcessorThread());
 
@@ -53,7 +53,7 @@ class ContextTimer final {
 
  private:
   class Impl;
-  utils::FastPimpl<Impl, 160, 16> impl_;
+  utils::FastPimpl<Impl, 200, 16> impl_;
 };
 
 }  // namespace engine::impl
@@ -0,0 +1,116 @@
+#include <engine/task/cpu_affinity.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+std::size_t ParseCpuId(std::string_view cpu, std::string_view cpu_list) {
+  std::size_t result = 0;
+  const auto* const end = cpu.data() + cpu.size();
+  const auto [ptr, ec] = std::from_chars(cpu.data(), end, result);
+  if (cpu.empty() || ec != std::errc{} || ptr != end) {
+    throw std::runtime_error(
+        fmt::format("Invalid CPU id '{}' in CPU list '{}'", cpu, cpu_list));
+  }
+  return result;
+}
+
+}  // namespace
+
+CpuList ParseCpuList(std::string_view cpu_list) {
+  CpuList result;
+
+  const auto trimmed = utils::text::Trim(std::string{cpu_list});
+  std::string_view rest{trimmed};
+  while (true) {
+    const auto comma_pos = rest.find(',');
+    const auto range = rest.substr(0, comma_pos);
+
+    const auto dash_pos = range.find('-');
+    if (dash_pos == std::string_view::npos) {
+      result.push_back(ParseCpuId(range, cpu_list));
+    } else {
+      const auto first = ParseCpuId(range.substr(0, dash_pos), cpu_list);
+      const auto last = ParseCpuId(range.substr(dash_pos + 1), cpu_list);
+      if (first > last) {
+        throw std::runtime_error(fmt::format(
+            "Invalid CPU range '{}' in CPU list '{}'", range, cpu_list));
+      }
+      for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+    }
+
+    if (comma_pos == std::string_view::npos) break;
+    rest.remove_prefix(comma_pos + 1);
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+  return result;
+}
+
+CpuList GetNumaNodeCpus(std::size_t numa_node) {
+  const auto path =
+      fmt::format("/sys/devices/system/node/node{}/cpulist", numa_node);
+  std::string contents;
+  try {
+    contents = fs::blocking::ReadFileContents(path);
+  } catch (const std::exception& ex) {
+    throw std::runtime_error(fmt::format(
+        "Failed to get CPUs of NUMA node {}: {}", numa_node, ex.what()));
+  }
+  return ParseCpuList(contents);
+}
+
+void SetCurrentThreadAffinity(const CpuList& cpus) {
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    if (cpu >= CPU_SETSIZE) {
+      throw std::system_error(
+          std::make_error_code(std::errc::invalid_argument),
+          fmt::format("CPU id {} is out of supported range", cpu));
+    }
+    CPU_SET(cpu, &cpu_set);
+  }
+
+  const auto err =
+      ::pthread_setaffinity_np(::pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (err) {
+    throw std::system_error(err, std::system_category(),
+                            "Error while setting thread CPU affinity");
+  }
+#else
+  (void)cpus;
+  throw std::system_error(
+      std::make_error_code(std::errc::function_not_supported),
+      "Setting thread CPU affinity is not supported on this platform");
+#endif
+}
+
+std::optional<std::size_t> GetCurrentCpu() noexcept {
+#ifdef __linux__
+  const auto cpu = ::sched_getcpu();
+  if (cpu >= 0) return static_cast<std::size_t>(cpu);
+#endif
+  return std::nullopt;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
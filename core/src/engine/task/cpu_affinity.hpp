@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Sorted list of unique CPU ids
+using CpuList = std::vector<std::size_t>;
+
+/// Parses a CPU list in the Linux format, e.g. "0-3,8,10-11"
+/// @throws std::runtime_error on invalid input
+CpuList ParseCpuList(std::string_view cpu_list);
+
+/// Returns CPUs of the NUMA node, reads sysfs, so may only be used on startup
+/// @throws std::runtime_error if there is no such NUMA node
+CpuList GetNumaNodeCpus(std::size_t numa_node);
+
+/// Binds the current OS thread to the CPUs
+/// @throws std::system_error
+void SetCurrentThreadAffinity(const CpuList& cpus);
+
+/// Returns the CPU the current thread is running on, if known
+std::optional<std::size_t> GetCurrentCpu() noexcept;
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,43 @@
+#include <engine/task/cpu_affinity.hpp>
+
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using engine::impl::CpuList;
+using engine::impl::ParseCpuList;
+
+TEST(CpuAffinity, ParseCpuList) {
+  EXPECT_EQ(ParseCpuList("0"), (CpuList{0}));
+  EXPECT_EQ(ParseCpuList("0-3"), (CpuList{0, 1, 2, 3}));
+  EXPECT_EQ(ParseCpuList("0-1,8,10-11"), (CpuList{0, 1, 8, 10, 11}));
+  EXPECT_EQ(ParseCpuList("5,1-2,2\n"), (CpuList{1, 2, 5}));
+}
+
+TEST(CpuAffinity, ParseCpuListInvalid) {
+  EXPECT_THROW(ParseCpuList(""), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("a"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("1,"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("3-1"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("1-"), std::runtime_error);
+  EXPECT_THROW(ParseCpuList("-1"), std::runtime_error);
+}
+
+TEST(CpuAffinity, CurrentThread) {
+  // Do not change the affinity of the main test thread
+  std::thread([] {
+    const auto cpu = engine::impl::GetCurrentCpu();
+#ifdef __linux__
+    ASSERT_TRUE(cpu);
+    EXPECT_NO_THROW(engine::impl::SetCurrentThreadAffinity({*cpu}));
+    EXPECT_EQ(engine::impl::GetCurrentCpu(), cpu);
+#else
+    EXPECT_FALSE(cpu);
+#endif
+  }).join();
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#include <engine/task/preemption.hpp>
+
+#include <vector>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/thread_name.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+
+namespace {
+thread_local WorkerTimeSlice* current_time_slice = nullptr;
+}  // namespace
+
+PreemptionMonitor::PreemptionMonitor(std::size_t worker_count,
+                                     std::chrono::microseconds time_slice)
+    : worker_count_(worker_count),
+      time_slice_(time_slice),
+      workers_(std::make_unique<
+               concurrent::impl::InterferenceShield<WorkerTimeSlice>[]>(
+          worker_count)) {
+  UASSERT(time_slice_.count() > 0);
+  thread_ = std::thread([this] {
+    utils::SetCurrentThreadName("preemption");
+    Run();
+  });
+}
+
+PreemptionMonitor::~PreemptionMonitor() {
+  {
+    const std::lock_guard lock(mutex_);
+    is_stopped_ = true;
+  }
+  stop_cv_.notify_all();
+  thread_.join();
+}
+
+WorkerTimeSlice& PreemptionMonitor::GetWorkerTimeSlice(
+    std::size_t worker_index) noexcept {
+  UASSERT(worker_index < worker_count_);
+  return *workers_[worker_index];
+}
+
+void PreemptionMonitor::Run() {
+  std::vector<std::uint64_t> last_steps(worker_count_, 0);
+
+  std::unique_lock lock(mutex_);
+  while (!stop_cv_.wait_for(lock, time_slice_,
+                            [this] { return is_stopped_; })) {
+    for (std::size_t i = 0; i < worker_count_; ++i) {
+      auto& worker = *workers_[i];
+      const auto steps = worker.steps.load(std::memory_order_relaxed);
+      // No context switches for the whole time slice. The flag may also be
+      // set for an idle worker, it is reset before the next task step.
+      if (steps == last_steps[i]) {
+        worker.should_yield.store(true, std::memory_order_relaxed);
+      }
+      last_steps[i] = steps;
+    }
+  }
+}
+
+void SetCurrentWorkerTimeSlice(WorkerTimeSlice* time_slice) noexcept {
+  current_time_slice = time_slice;
+}
+
+void StartWorkerTimeSlice() noexcept {
+  auto* time_slice = current_time_slice;
+  if (!time_slice) return;
+
+  // Only the worker writes the counter, no need for an atomic increment
+  time_slice->steps.store(
+      time_slice->steps.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+  time_slice->should_yield.store(false, std::memory_order_relaxed);
+}
+
+}  // namespace impl
+
+bool ShouldYield() noexcept {
+  const auto* time_slice = impl::current_time_slice;
+  return time_slice && time_slice->should_yield.load(std::memory_order_relaxed);
+}
+
+void YieldIfNeeded() {
+  if (ShouldYield()) Yield();
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <concurrent/impl/interference_shield.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Preemption state of a worker thread
+struct WorkerTimeSlice final {
+  // Incremented by the worker before each task step
+  std::atomic<std::uint64_t> steps{0};
+  // Set by the PreemptionMonitor, reset by the worker before each task step
+  std::atomic<bool> should_yield{false};
+};
+
+// Sets WorkerTimeSlice::should_yield of the workers that execute the same
+// task step for longer than the time slice. The flag is set after the
+// step has been running for one to two time slices, so that the workers only
+// pay for a plain store per context switch and the hot loops only pay for a
+// relaxed load in engine::ShouldYield().
+class PreemptionMonitor final {
+ public:
+  PreemptionMonitor(std::size_t worker_count,
+                    std::chrono::microseconds time_slice);
+  ~PreemptionMonitor();
+
+  PreemptionMonitor(const PreemptionMonitor&) = delete;
+  PreemptionMonitor& operator=(const PreemptionMonitor&) = delete;
+
+  WorkerTimeSlice& GetWorkerTimeSlice(std::size_t worker_index) noexcept;
+
+ private:
+  void Run();
+
+  const std::size_t worker_count_;
+  const std::chrono::microseconds time_slice_;
+  std::unique_ptr<concurrent::impl::InterferenceShield<WorkerTimeSlice>[]>
+      workers_;
+
+  std::mutex mutex_;
+  std::condition_variable stop_cv_;
+  bool is_stopped_{false};
+  std::thread thread_;
+};
+
+// Makes engine::ShouldYield() of the current thread use `time_slice`, nullptr
+// disables the preemption checks
+void SetCurrentWorkerTimeSlice(WorkerTimeSlice* time_slice) noexcept;
+
+// Called by the worker before each task step
+void StartWorkerTimeSlice() noexcept;
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
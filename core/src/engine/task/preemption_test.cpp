@@ -0,0 +1,77 @@
+#include <engine/task/preemption.hpp>
+
+#include <atomic>
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void RunInPreemptiveTaskProcessor(utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.name = "preemptive-task-processor";
+  config.thread_name = "preempt-worker";
+  config.worker_threads = 1;
+  config.preemption_time_slice = std::chrono::milliseconds{5};
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+}  // namespace
+
+UTEST(Preemption, DisabledByDefault) {
+  EXPECT_FALSE(engine::ShouldYield());
+  engine::YieldIfNeeded();
+}
+
+TEST(Preemption, ShouldYieldOutsideOfCoroutine) {
+  EXPECT_FALSE(engine::ShouldYield());
+}
+
+TEST(Preemption, LongStepIsPreempted) {
+  RunInPreemptiveTaskProcessor([] {
+    engine::Yield();
+    EXPECT_FALSE(engine::ShouldYield());
+
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (!engine::ShouldYield() && !deadline.IsReached()) {
+      // Busy loop without context switches
+    }
+    EXPECT_TRUE(engine::ShouldYield());
+
+    engine::Yield();
+    EXPECT_FALSE(engine::ShouldYield());
+  });
+}
+
+TEST(Preemption, OtherTasksProgress) {
+  RunInPreemptiveTaskProcessor([] {
+    std::atomic<bool> other_ran{false};
+    auto other = engine::AsyncNoSpan([&other_ran] { other_ran = true; });
+
+    // The only worker is busy with this task, the other one runs only when
+    // this task is preempted
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (!other_ran && !deadline.IsReached()) {
+      engine::YieldIfNeeded();
+    }
+    EXPECT_TRUE(other_ran);
+    other.Get();
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,84 @@
+#include <userver/engine/task/task_base.hpp>
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void RunInAccountingTaskProcessor(utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.name = "accounting-task-processor";
+  config.thread_name = "account-worker";
+  config.worker_threads = 1;
+  config.resource_accounting = true;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+void BusyLoopFor(std::chrono::milliseconds duration) {
+  const auto deadline = engine::Deadline::FromDuration(duration);
+  while (!deadline.IsReached()) {
+    // Busy loop without context switches
+  }
+}
+
+}  // namespace
+
+UTEST(ResourceUsage, DisabledByDefault) {
+  EXPECT_FALSE(engine::current_task::IsResourceUsageAccounted());
+  BusyLoopFor(std::chrono::milliseconds{1});
+
+  const auto usage = engine::current_task::GetResourceUsage();
+  EXPECT_EQ(usage.cpu_time.count(), 0);
+  EXPECT_EQ(usage.allocated_bytes, 0);
+}
+
+TEST(ResourceUsage, CpuTime) {
+  RunInAccountingTaskProcessor([] {
+    EXPECT_TRUE(engine::current_task::IsResourceUsageAccounted());
+
+    BusyLoopFor(std::chrono::milliseconds{20});
+    engine::Yield();
+    BusyLoopFor(std::chrono::milliseconds{20});
+    const auto busy = engine::current_task::GetResourceUsage();
+    EXPECT_GE(busy.cpu_time, std::chrono::milliseconds{20});
+
+    // Sleeping takes no CPU time of the task
+    engine::SleepFor(std::chrono::milliseconds{50});
+    const auto slept = engine::current_task::GetResourceUsage();
+    EXPECT_GE(slept.cpu_time, busy.cpu_time);
+    EXPECT_LT(slept.cpu_time - busy.cpu_time, std::chrono::milliseconds{40});
+    EXPECT_GE(slept.allocated_bytes, busy.allocated_bytes);
+  });
+}
+
+TEST(ResourceUsage, ChildTaskIsAccountedSeparately) {
+  RunInAccountingTaskProcessor([] {
+    const auto before = engine::current_task::GetResourceUsage();
+
+    auto child = engine::AsyncNoSpan([] {
+      BusyLoopFor(std::chrono::milliseconds{20});
+      return engine::current_task::GetResourceUsage();
+    });
+    const auto child_usage = child.Get();
+    EXPECT_GE(child_usage.cpu_time, std::chrono::milliseconds{10});
+
+    const auto after = engine::current_task::GetResourceUsage();
+    EXPECT_LT(after.cpu_time - before.cpu_time, std::chrono::milliseconds{15});
+  });
+}
+
+USERVER_NAMESPACE_END
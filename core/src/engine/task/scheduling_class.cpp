@@ -0,0 +1,37 @@
+#include <userver/engine/task/scheduling_class.hpp>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+std::string_view ToString(SchedulingClass scheduling_class) noexcept {
+  switch (scheduling_class) {
+    case SchedulingClass::kLatencyCritical:
+      return "latency-critical";
+    case SchedulingClass::kNormal:
+      return "normal";
+    case SchedulingClass::kBackground:
+      return "background";
+  }
+  UASSERT_MSG(false, "Unexpected scheduling class");
+  return "unknown";
+}
+
+namespace current_task {
+
+SchedulingClass GetSchedulingClass() noexcept {
+  return GetCurrentTaskContext().GetSchedulingClass();
+}
+
+void SetSchedulingClass(SchedulingClass scheduling_class) noexcept {
+  GetCurrentTaskContext().SetSchedulingClass(scheduling_class);
+}
+
+}  // namespace current_task
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -47,6 +47,10 @@ SharedTask& SharedTask::operator=(SharedTask&& other) noexcept {
   return *this;
 }
 
+impl::ContextAccessor* SharedTask::TryGetContextAccessor() noexcept {
+  return IsValid() ? &GetContext() : nullptr;
+}
+
 void SharedTask::DecrementSharedUsages() noexcept {
   if (!IsValid()) {
     return;
@@ -176,10 +176,18 @@ TaskProcessor& GetTaskProcessor() {
 }
 
 std::size_t GetStackSize() {
-  return GetTaskProcessor()
-      .GetTaskProcessorPools()
-      ->GetCoroPool()
-      .GetStackSize();
+  return GetTaskProcessor().GetCoroStackSize();
+}
+
+ResourceUsage GetResourceUsage() noexcept {
+  auto* context = GetCurrentTaskContextUnchecked();
+  if (!context) return {};
+  return context->GetResourceUsage();
+}
+
+bool IsResourceUsageAccounted() noexcept {
+  auto* context = GetCurrentTaskContextUnchecked();
+  return context && context->IsResourceAccounted();
 }
 
 ev::ThreadControl& GetEventThread() {
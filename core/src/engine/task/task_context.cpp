@@ -1,5 +1,6 @@
 #include "task_context.hpp"
 
+#include <ctime>
 #include <exception>
 #include <utility>
 
@@ -15,6 +16,7 @@
 #include <userver/engine/impl/task_context_factory.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
+#include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/underlying_value.hpp>
 
@@ -25,6 +27,7 @@
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/task_processor.hpp>
 #include <utils/impl/assert_extra.hpp>
+#include <utils/jemalloc.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -76,6 +79,26 @@ namespace impl {
 
 namespace {
 
+compiler::ThreadLocal local_allocated_bytes_counter = [] {
+  return utils::jemalloc::GetThreadAllocatedBytesCounter();
+};
+
+// Monotonic counters of the current thread, the task keeps running on the
+// same thread between the context switches
+current_task::ResourceUsage ReadThreadResourceUsage() noexcept {
+  current_task::ResourceUsage usage;
+
+  struct timespec cpu_time {};
+  if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time) == 0) {
+    usage.cpu_time = std::chrono::seconds{cpu_time.tv_sec} +
+                     std::chrono::nanoseconds{cpu_time.tv_nsec};
+  }
+
+  auto counter = local_allocated_bytes_counter.Use();
+  if (*counter) usage.allocated_bytes = **counter;
+  return usage;
+}
+
 auto ReadableTaskId(const TaskContext* task) noexcept {
   return logging::HexShort(task ? task->GetTaskId() : 0);
 }
@@ -97,6 +120,11 @@ class CurrentTaskScope final {
   EhGlobals& eh_store_;
 };
 
+std::string_view GetCurrentSpanName() {
+  const auto* span = tracing::Span::CurrentSpanUnchecked();
+  return span ? std::string_view{span->GetName()} : std::string_view{};
+}
+
 constexpr SleepState MakeNextEpochSleepState(SleepState::Epoch current) {
   using Epoch = SleepState::Epoch;
   return {SleepFlags::kNone, Epoch{utils::UnderlyingValue(current) + 1}};
@@ -105,19 +133,30 @@ constexpr SleepState MakeNextEpochSleepState(SleepState::Epoch current) {
 auto* const kFinishedDetachedToken =
     reinterpret_cast<DetachedTasksSyncBlock::Token*>(1);
 
+SchedulingClass GetInitialSchedulingClass(
+    std::optional<SchedulingClass> scheduling_class) noexcept {
+  if (scheduling_class) return *scheduling_class;
+  auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+  return parent ? parent->GetSchedulingClass() : SchedulingClass::kNormal;
+}
+
 }  // namespace
 
 TaskContext::TaskContext(TaskProcessor& task_processor,
                          Task::Importance importance, Task::WaitMode wait_type,
                          Deadline deadline,
+                         std::optional<SchedulingClass> scheduling_class,
                          utils::impl::WrappedCallBase& payload)
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      scheduling_class_(GetInitialSchedulingClass(scheduling_class)),
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
-      trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
+      trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()),
+      is_profiled_(task_processor_.ShouldProfileNewTask()),
+      is_resource_accounted_(task_processor_.IsResourceAccountingEnabled()) {
   UASSERT(payload_);
   LOG_TRACE() << "task with task_id="
               << ReadableTaskId(current_task::GetCurrentTaskContextUnchecked())
@@ -322,13 +361,16 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy,
   yield_reason_ = YieldReason::kTaskWaiting;
   UASSERT(task_pipe_);
   TraceStateTransition(Task::State::kSuspended);
+  if (is_profiled_) profiler_wait_kind_ = wait_strategy.GetWaitKind();
   ProfilerStopExecution();
+  ResourceAccountingStopExecution();
 
   auto& task_pipe_ref = *task_pipe_;
   TsanAcquireBarrier();
   [[maybe_unused]] TaskContext* context = task_pipe_ref().get();
   TsanReleaseBarrier();
 
+  ResourceAccountingStartExecution();
   ProfilerStartExecution();
   TraceStateTransition(Task::State::kRunning);
   UASSERT(context == this);
@@ -483,12 +525,16 @@ class TaskContext::LocalStorageGuard {
 };
 
 void TaskContext::CoroFunc(TaskPipe& task_pipe) {
+  // The frame of the coroutine entry function is in the topmost stack page
+  const void* const stack_top = __builtin_frame_address(0);
+
   for (TaskContext* context : task_pipe) {
     UASSERT(context);
     context->TsanReleaseBarrier();
     context->yield_reason_ = YieldReason::kNone;
     context->task_pipe_ = &task_pipe;
 
+    context->ResourceAccountingStartExecution();
     context->ProfilerStartExecution();
 
     // We only let tasks ran with CriticalAsync enter function body, others
@@ -525,6 +571,8 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
     }
 
     context->ProfilerStopExecution();
+    context->ResourceAccountingStopExecution();
+    context->task_processor_.AccountStackUsage(stack_top);
 
     context->task_pipe_ = nullptr;
     context->TsanAcquireBarrier();
@@ -668,23 +716,38 @@ void TaskContext::Schedule() {
   UASSERT(state_ != Task::State::kQueued);
   SetState(Task::State::kQueued);
   TraceStateTransition(Task::State::kQueued);
+  if (is_profiled_) profiler_queued_ = std::chrono::steady_clock::now();
   task_processor_.Schedule(this);
   // NOTE: may be executed at this point
 }
 
 void TaskContext::ProfilerStartExecution() {
   auto threshold_us = task_processor_.GetProfilerThreshold();
-  if (threshold_us.count() > 0) {
-    execute_started_ = std::chrono::steady_clock::now();
-  } else {
+  if (threshold_us.count() <= 0 && !is_profiled_) {
     execute_started_ = {};
+    return;
+  }
+
+  execute_started_ = std::chrono::steady_clock::now();
+  if (!is_profiled_) return;
+
+  using Kind = TaskProfiler::SampleKind;
+  auto& profiler = task_processor_.GetTaskProfiler();
+  const auto span_name = GetCurrentSpanName();
+  const auto queued = std::exchange(profiler_queued_, {});
+  const auto sleep_started = std::exchange(profiler_sleep_started_, {});
+  if (queued == std::chrono::steady_clock::time_point{}) return;
+
+  if (sleep_started != std::chrono::steady_clock::time_point{} &&
+      queued > sleep_started) {
+    profiler.Account(Kind::kBlocked, span_name, profiler_wait_kind_,
+                     queued - sleep_started);
   }
+  profiler.Account(Kind::kRunnable, span_name, {},
+                   execute_started_ - queued);
 }
 
 void TaskContext::ProfilerStopExecution() {
-  auto threshold_us = task_processor_.GetProfilerThreshold();
-  if (threshold_us.count() <= 0) return;
-
   if (execute_started_ == std::chrono::steady_clock::time_point{}) {
     // the task was started w/o profiling, skip it
     return;
@@ -692,6 +755,15 @@ void TaskContext::ProfilerStopExecution() {
 
   auto now = std::chrono::steady_clock::now();
   auto duration = now - execute_started_;
+
+  if (is_profiled_) {
+    profiler_sleep_started_ = now;
+    task_processor_.GetTaskProfiler().Account(
+        TaskProfiler::SampleKind::kOnCpu, GetCurrentSpanName(), {}, duration);
+  }
+
+  auto threshold_us = task_processor_.GetProfilerThreshold();
+  if (threshold_us.count() <= 0) return;
   auto duration_us =
       std::chrono::duration_cast<std::chrono::microseconds>(duration);
 
@@ -707,6 +779,28 @@ void TaskContext::ProfilerStopExecution() {
   }
 }
 
+current_task::ResourceUsage TaskContext::GetResourceUsage() const noexcept {
+  if (!is_resource_accounted_) return {};
+
+  const auto now = ReadThreadResourceUsage();
+  const auto& start = resource_slice_start_;
+  return {
+      resource_usage_.cpu_time + (now.cpu_time - start.cpu_time),
+      resource_usage_.allocated_bytes +
+          (now.allocated_bytes - start.allocated_bytes),
+  };
+}
+
+void TaskContext::ResourceAccountingStartExecution() noexcept {
+  if (!is_resource_accounted_) return;
+  resource_slice_start_ = ReadThreadResourceUsage();
+}
+
+void TaskContext::ResourceAccountingStopExecution() noexcept {
+  if (!is_resource_accounted_) return;
+  resource_usage_ = GetResourceUsage();
+}
+
 void TaskContext::TraceStateTransition(Task::State state) {
   if (trace_csw_left_ == 0) return;
   --trace_csw_left_;
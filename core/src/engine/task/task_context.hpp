@@ -3,6 +3,8 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <vector>
 
 #include <ev.h>
@@ -22,6 +24,7 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/scheduling_class.hpp>
 #include <userver/engine/task/task.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
@@ -55,6 +58,10 @@ class WaitStrategy {
   // It may not sleep.
   virtual void DisableWakeups() noexcept = 0;
 
+  // Names the wait primitive in the task profiler, must return a string
+  // literal.
+  virtual std::string_view GetWaitKind() const noexcept { return "other"; }
+
  protected:
   constexpr WaitStrategy() noexcept = default;
 
@@ -80,6 +87,7 @@ class TaskContext final : public ContextAccessor {
   };
 
   TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline,
+              std::optional<SchedulingClass>,
               utils::impl::WrappedCallBase& payload);
 
   ~TaskContext() noexcept;
@@ -101,6 +109,19 @@ class TaskContext final : public ContextAccessor {
   // exceeding these limits causes task to become cancelled
   bool IsCritical() const;
 
+  bool IsResourceAccounted() const noexcept { return is_resource_accounted_; }
+
+  // Must be called from the task itself
+  current_task::ResourceUsage GetResourceUsage() const noexcept;
+
+  SchedulingClass GetSchedulingClass() const noexcept {
+    return scheduling_class_.load(std::memory_order_relaxed);
+  }
+
+  void SetSchedulingClass(SchedulingClass scheduling_class) noexcept {
+    scheduling_class_.store(scheduling_class, std::memory_order_relaxed);
+  }
+
   // whether task is allowed to be awaited from multiple coroutines
   // simultaneously
   bool IsSharedWaitAllowed() const;
@@ -207,6 +228,9 @@ class TaskContext final : public ContextAccessor {
   void ProfilerStartExecution();
   void ProfilerStopExecution();
 
+  void ResourceAccountingStartExecution() noexcept;
+  void ResourceAccountingStopExecution() noexcept;
+
   void TraceStateTransition(Task::State state);
 
   void TsanAcquireBarrier() noexcept;
@@ -216,6 +240,7 @@ class TaskContext final : public ContextAccessor {
   TaskProcessor& task_processor_;
   TaskCounter::Token task_counter_token_;
   const bool is_critical_;
+  std::atomic<SchedulingClass> scheduling_class_;
   bool is_cancellable_{true};
   bool within_sleep_{false};
   EhGlobals eh_globals_;
@@ -236,6 +261,18 @@ class TaskContext final : public ContextAccessor {
   std::chrono::steady_clock::time_point execute_started_;
   std::chrono::steady_clock::time_point last_state_change_timepoint_;
 
+  // Timings of the tasks sampled by the TaskProfiler, {} if not defined
+  std::chrono::steady_clock::time_point profiler_sleep_started_;
+  std::chrono::steady_clock::time_point profiler_queued_;
+  std::string_view profiler_wait_kind_;
+  const bool is_profiled_;
+
+  // Usage of the finished execution slices and the thread counters at the
+  // start of the current one, see TaskProcessorConfig::resource_accounting
+  const bool is_resource_accounted_;
+  current_task::ResourceUsage resource_usage_{};
+  current_task::ResourceUsage resource_slice_start_{};
+
   std::size_t trace_csw_left_;
 
   AtomicSleepState sleep_state_{
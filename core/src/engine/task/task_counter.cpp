@@ -121,6 +121,10 @@ Rate TaskCounter::GetSpuriousWakeups() const noexcept {
   return GetApproximate(LocalCounterId::kSpuriousWakeups);
 }
 
+Rate TaskCounter::GetCrossNodeWakeups() const noexcept {
+  return GetApproximate(GlobalCounterId::kCrossNodeWakeups);
+}
+
 void TaskCounter::AccountTaskCancel() noexcept {
   Increment(LocalCounterId::kCancelled);
 }
@@ -153,6 +157,10 @@ void TaskCounter::AccountSpuriousWakeup() noexcept {
   Increment(LocalCounterId::kSpuriousWakeups);
 }
 
+void TaskCounter::AccountCrossNodeWakeup() noexcept {
+  Increment(GlobalCounterId::kCrossNodeWakeups);
+}
+
 Rate TaskCounter::GetApproximate(LocalCounterId id) const noexcept {
   Rate total;
   for (const auto& local_counters_block : local_counters_) {
@@ -55,6 +55,8 @@ class TaskCounter final {
 
   Rate GetSpuriousWakeups() const noexcept;
 
+  Rate GetCrossNodeWakeups() const noexcept;
+
   void AccountTaskCancel() noexcept;
 
   void AccountTaskCancelOverload() noexcept;
@@ -71,6 +73,8 @@ class TaskCounter final {
 
   void AccountSpuriousWakeup() noexcept;
 
+  void AccountCrossNodeWakeup() noexcept;
+
  private:
   // Counters that may be mutated from outside the bound TaskProcessor.
   enum class GlobalCounterId : std::size_t {
@@ -79,6 +83,7 @@ class TaskCounter final {
 
     kCancelOverload,
     kOverload,
+    kCrossNodeWakeups,
 
     kCountersSize,
   };
@@ -1,6 +1,7 @@
 #include "task_processor.hpp"
 
 #include <sys/types.h>
+#include <algorithm>
 #include <csignal>
 
 #include <fmt/format.h>
@@ -12,9 +13,11 @@
 #include <userver/utils/rand.hpp>
 #include <userver/utils/thread_name.hpp>
 #include <userver/utils/threads.hpp>
+#include <utils/jemalloc.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <engine/task/counted_coroutine_ptr.hpp>
+#include <engine/task/cpu_affinity.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
 
@@ -38,6 +41,15 @@ void SetTaskQueueWaitTimepoint(impl::TaskContext* context) {
   }
 }
 
+// Background tasks are cancelled half way to the overload limits, to keep the
+// capacity of the task processor for the rest of the work
+template <typename Limit>
+Limit GetOverloadLimit(Limit limit, const impl::TaskContext& context) {
+  return context.GetSchedulingClass() == SchedulingClass::kBackground
+             ? limit / 2
+             : limit;
+}
+
 // Hooks are modified only before task processors created and only in main
 // thread, so it doesn't need any synchronization.
 std::vector<std::function<void()>>& ThreadStartedHooks() {
@@ -54,6 +66,54 @@ void EmitMagicNanosleep() {
   nanosleep(&ts, nullptr);
 }
 
+std::variant<TaskQueue, WorkStealingTaskQueue> MakeTaskQueue(
+    const TaskProcessorConfig& config) {
+  switch (config.task_queue) {
+    case TaskQueueType::kGlobalTaskQueue:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<TaskQueue>, config};
+    case TaskQueueType::kWorkStealingTaskQueue:
+      return std::variant<TaskQueue, WorkStealingTaskQueue>{
+          std::in_place_type<WorkStealingTaskQueue>, config};
+  }
+  UINVARIANT(false, "Unexpected value of task queue type");
+}
+
+std::unique_ptr<coro::Pool<impl::TaskContext>> MakeLocalCoroPool(
+    const TaskProcessorConfig& config, impl::TaskProcessorPools& pools) {
+  if (!config.numa_node && !config.coro_stack_size) return {};
+
+  // Coroutines are created on demand by the worker threads, so that the
+  // stacks are first touched and thus allocated on the NUMA node.
+  auto coro_config = pools.GetCoroPool().GetConfig();
+  coro_config.initial_size = 0;
+  if (config.coro_stack_size) coro_config.stack_size = *config.coro_stack_size;
+  return std::make_unique<coro::Pool<impl::TaskContext>>(
+      std::move(coro_config), &impl::TaskContext::CoroFunc);
+}
+
+std::unique_ptr<io::impl::IoUringBackend> MakeIoUringBackend(
+    const TaskProcessorConfig& config, impl::TaskProcessorPools& pools) {
+  if (config.io_backend != IoBackend::kIoUring) return {};
+
+  if (!io::impl::IoUringBackend::IsSupported()) {
+    throw std::runtime_error(fmt::format(
+        "Task processor '{}' requires io_uring, that is only supported on "
+        "Linux 5.19 or newer. Use 'io-backend: ev' for this system",
+        config.name));
+  }
+  return std::make_unique<io::impl::IoUringBackend>(
+      config.io_uring_entries, config.io_uring_max_file_operations,
+      pools.EventThreadPool().NextThread());
+}
+
+std::unique_ptr<impl::PreemptionMonitor> MakePreemptionMonitor(
+    const TaskProcessorConfig& config) {
+  if (config.preemption_time_slice.count() <= 0) return {};
+  return std::make_unique<impl::PreemptionMonitor>(
+      config.worker_threads, config.preemption_time_slice);
+}
+
 void TaskProcessorThreadStartedHook() {
   utils::impl::AssertStaticRegistrationFinished();
   utils::WithDefaultRandom([](auto&) {});
@@ -68,14 +128,23 @@ void TaskProcessorThreadStartedHook() {
 TaskProcessor::TaskProcessor(TaskProcessorConfig config,
                              std::shared_ptr<impl::TaskProcessorPools> pools)
     : task_counter_(config.worker_threads),
-      task_queue_(config),
+      task_queue_(MakeTaskQueue(config)),
       config_(std::move(config)),
-      pools_(std::move(pools)) {
+      pools_(std::move(pools)),
+      local_coro_pool_(MakeLocalCoroPool(config_, *pools_)),
+      io_uring_backend_(MakeIoUringBackend(config_, *pools_)),
+      preemption_monitor_(MakePreemptionMonitor(config_)) {
   utils::impl::FinishStaticRegistration();
   try {
     LOG_INFO() << "creating task_processor " << Name() << " "
                << "worker_threads=" << config_.worker_threads
-               << " thread_name=" << config_.thread_name;
+               << " thread_name=" << config_.thread_name << " task_queue="
+               << (std::holds_alternative<WorkStealingTaskQueue>(task_queue_)
+                       ? "work-stealing"
+                       : "global")
+               << " cpu_affinity_size=" << config_.cpu_affinity.size()
+               << " io_backend="
+               << (io_uring_backend_ ? "io-uring" : "ev");
     concurrent::impl::Latch workers_left{
         static_cast<std::ptrdiff_t>(config_.worker_threads)};
     workers_.reserve(config_.worker_threads);
@@ -105,7 +174,7 @@ void TaskProcessor::Cleanup() noexcept {
   // Some tasks may be bound but not scheduled yet
   task_counter_.WaitForExhaustion();
 
-  task_queue_.StopProcessing();
+  std::visit([](auto& queue) { queue.StopProcessing(); }, task_queue_);
 
   for (auto& w : workers_) {
     w.join();
@@ -123,10 +192,13 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
   UASSERT(context);
   if (max_task_queue_wait_length_ && !context->IsCritical()) {
     const auto queue_size = GetTaskQueueSize();
-    if (queue_size >= max_task_queue_wait_length_) {
+    const auto max_queue_size =
+        GetOverloadLimit(max_task_queue_wait_length_.load(), *context);
+    if (queue_size >= max_queue_size) {
       LOG_LIMITED_WARNING()
           << "failed to enqueue task: task_queue_ size=" << queue_size << " >= "
-          << "task_queue_size_threshold=" << max_task_queue_wait_length_
+          << "task_queue_size_threshold=" << max_queue_size
+          << " scheduling_class=" << ToString(context->GetSchedulingClass())
           << " task_processor=" << Name();
       HandleOverload(*context);
     }
@@ -134,9 +206,11 @@ void TaskProcessor::Schedule(impl::TaskContext* context) {
   if (is_shutting_down_)
     context->RequestCancel(TaskCancellationReason::kShutdown);
 
+  if (config_.numa_node) AccountCrossNodeWakeup();
+
   SetTaskQueueWaitTimepoint(context);
 
-  task_queue_.Push(context);
+  std::visit([context](auto& queue) { queue.Push(context); }, task_queue_);
 }
 
 void TaskProcessor::Adopt(impl::TaskContext& context) {
@@ -148,7 +222,30 @@ ev::ThreadPool& TaskProcessor::EventThreadPool() {
 }
 
 impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() {
-  return {pools_->GetCoroPool().GetCoroutine(), *this};
+  return {GetCoroPool().GetCoroutine(), *this};
+}
+
+std::size_t TaskProcessor::GetCoroStackSize() {
+  return GetCoroPool().GetStackSize();
+}
+
+void TaskProcessor::AccountStackUsage(const void* stack_top) noexcept {
+  GetCoroPool().GetStackUsageMonitor().AccountStackUsage(stack_top);
+}
+
+const coro::StackUsageMonitor* TaskProcessor::GetLocalStackUsageMonitor()
+    const {
+  if (!local_coro_pool_) return nullptr;
+  return &local_coro_pool_->GetStackUsageMonitor();
+}
+
+coro::Pool<impl::TaskContext>& TaskProcessor::GetCoroPool() noexcept {
+  return local_coro_pool_ ? *local_coro_pool_ : pools_->GetCoroPool();
+}
+
+std::optional<coro::PoolStats> TaskProcessor::GetLocalCoroPoolStats() const {
+  if (!local_coro_pool_) return std::nullopt;
+  return local_coro_pool_->GetStats();
 }
 
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
@@ -179,6 +276,20 @@ void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
     }
   }
   profiler_force_stacktrace_.store(settings.profiler_force_stacktrace);
+
+  const auto sample_every_task = settings.profiler_sample_every_task;
+  const auto old_sample_every_task =
+      profiler_sample_every_task_.exchange(sample_every_task);
+  if (sample_every_task != 0 && old_sample_every_task == 0) {
+    LOG_WARNING() << fmt::format(
+        "Task sampling profiler is now enabled for task processor '{}' "
+        "(every {} task)",
+        config_.thread_name, sample_every_task);
+  } else if (sample_every_task == 0 && old_sample_every_task != 0) {
+    LOG_WARNING() << fmt::format(
+        "Task sampling profiler is now disabled for task processor '{}'",
+        config_.thread_name);
+  }
 }
 
 std::chrono::microseconds TaskProcessor::GetProfilerThreshold() const {
@@ -189,6 +300,17 @@ bool TaskProcessor::ShouldProfilerForceStacktrace() const {
   return profiler_force_stacktrace_.load();
 }
 
+bool TaskProcessor::ShouldProfileNewTask() const {
+  const auto sample_every_task =
+      profiler_sample_every_task_.load(std::memory_order_relaxed);
+  if (sample_every_task == 0) return false;
+
+  thread_local std::size_t count = 0;
+  if (++count < sample_every_task) return false;
+  count = 0;
+  return true;
+}
+
 size_t TaskProcessor::GetTaskTraceMaxCswForNewTask() const {
   thread_local size_t count = 0;
   if (count++ == config_.task_trace_every) {
@@ -228,6 +350,10 @@ void RegisterThreadStartedHook(std::function<void()> func) {
   ThreadStartedHooks().push_back(std::move(func));
 }
 
+std::size_t GetWorkerCount(const TaskProcessor& task_processor) {
+  return task_processor.GetWorkerCount();
+}
+
 void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
   switch (config_.os_scheduling) {
     case OsScheduling::kNormal:
@@ -241,19 +367,47 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
   }
 
   utils::SetCurrentThreadName(fmt::format("{}_{}", config_.thread_name, index));
+  // Attributes the heap profile of the thread to the task processor, fails
+  // harmlessly if the heap profiling is not available
+  [[maybe_unused]] const auto prof_name_ec =
+      utils::jemalloc::SetThreadProfName(Name());
+
+  if (!config_.cpu_affinity.empty()) {
+    try {
+      impl::SetCurrentThreadAffinity(config_.cpu_affinity);
+    } catch (const std::exception& ex) {
+      LOG_ERROR() << "Failed to bind a worker thread of task processor '"
+                  << Name() << "' to CPUs: " << ex;
+    }
+  }
 
   impl::SetLocalTaskCounterData(task_counter_, index);
 
+  if (preemption_monitor_) {
+    impl::SetCurrentWorkerTimeSlice(
+        &preemption_monitor_->GetWorkerTimeSlice(index));
+  }
+
+  if (auto* queue = std::get_if<WorkStealingTaskQueue>(&task_queue_)) {
+    queue->PrepareWorker(index);
+  }
+
   TaskProcessorThreadStartedHook();
 }
 
 void TaskProcessor::ProcessTasks() noexcept {
+  std::visit([this](auto& queue) { ProcessTasks(queue); }, task_queue_);
+}
+
+template <typename Queue>
+void TaskProcessor::ProcessTasks(Queue& queue) noexcept {
   while (true) {
-    auto context = task_queue_.PopBlocking();
+    auto context = queue.PopBlocking();
     if (!context) break;
 
     GetTaskCounter().AccountTaskSwitchSlow();
     CheckWaitTime(*context);
+    impl::StartWorkerTimeSlice();
 
     bool has_failed = false;
     try {
@@ -278,6 +432,7 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
     return;
   }
 
+  bool is_overloaded_for_class = false;
   const auto wait_timepoint = context.GetQueueWaitTimepoint();
   if (wait_timepoint != std::chrono::steady_clock::time_point()) {
     const auto wait_time = std::chrono::steady_clock::now() - wait_timepoint;
@@ -287,6 +442,9 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
 
     SetTaskQueueWaitTimeOverloaded(max_wait_time.count() &&
                                    wait_time >= max_wait_time);
+    is_overloaded_for_class =
+        max_wait_time.count() &&
+        wait_time >= GetOverloadLimit(max_wait_time, context);
 
     if (sensor_wait_time.count() && wait_time >= sensor_wait_time) {
       GetTaskCounter().AccountTaskOverloadSensor();
@@ -299,7 +457,7 @@ void TaskProcessor::CheckWaitTime(impl::TaskContext& context) {
   }
 
   // Don't cancel critical tasks, but use their timestamp to cancel other tasks
-  if (task_queue_wait_time_overloaded_->load()) {
+  if (task_queue_wait_time_overloaded_->load() || is_overloaded_for_class) {
     HandleOverload(context);
   }
 }
@@ -312,6 +470,16 @@ void TaskProcessor::SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept {
   }
 }
 
+void TaskProcessor::AccountCrossNodeWakeup() noexcept {
+  const auto cpu = impl::GetCurrentCpu();
+  if (!cpu) return;
+
+  if (!std::binary_search(config_.cpu_affinity.begin(),
+                          config_.cpu_affinity.end(), *cpu)) {
+    GetTaskCounter().AccountCrossNodeWakeup();
+  }
+}
+
 void TaskProcessor::HandleOverload(impl::TaskContext& context) {
   GetTaskCounter().AccountTaskOverload();
 
@@ -4,15 +4,22 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
+#include <variant>
 #include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <concurrent/impl/interference_shield.hpp>
+#include <engine/coro/pool.hpp>
+#include <engine/io/io_uring_backend.hpp>
+#include <engine/task/preemption.hpp>
 #include <engine/task/task_counter.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <engine/task/task_profiler.hpp>
 #include <engine/task/task_queue.hpp>
+#include <engine/task/work_stealing_task_queue.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
@@ -45,6 +52,23 @@ class TaskProcessor final {
 
   impl::CountedCoroutinePtr GetCoroutine();
 
+  std::size_t GetCoroStackSize();
+
+  /// Must be called from within a coroutine of this task processor
+  void AccountStackUsage(const void* stack_top) noexcept;
+
+  /// Stats of the coroutine pool owned by this task processor, if any
+  std::optional<coro::PoolStats> GetLocalCoroPoolStats() const;
+
+  /// The io_uring backend of the sockets created in this task processor, if
+  /// enabled by the `io-backend` option
+  io::impl::IoUringBackend* GetIoUringBackend() noexcept {
+    return io_uring_backend_.get();
+  }
+
+  /// Stack usage of the coroutine pool owned by this task processor, if any
+  const coro::StackUsageMonitor* GetLocalStackUsageMonitor() const;
+
   ev::ThreadPool& EventThreadPool();
 
   std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() {
@@ -57,7 +81,11 @@ class TaskProcessor final {
 
   const impl::TaskCounter& GetTaskCounter() const { return task_counter_; }
 
-  size_t GetTaskQueueSize() const { return task_queue_.GetSizeApproximate(); }
+  size_t GetTaskQueueSize() const {
+    return std::visit(
+        [](const auto& queue) { return queue.GetSizeApproximate(); },
+        task_queue_);
+  }
 
   size_t GetWorkerCount() const { return workers_.size(); }
 
@@ -67,6 +95,22 @@ class TaskProcessor final {
 
   bool ShouldProfilerForceStacktrace() const;
 
+  /// Whether the TaskProfiler should sample the new task, see the
+  /// `sample-every-task` option of USERVER_TASK_PROCESSOR_PROFILER_DEBUG
+  bool ShouldProfileNewTask() const;
+
+  /// Whether the tasks accumulate their CPU time and allocated bytes, see
+  /// the `resource-accounting` static option
+  bool IsResourceAccountingEnabled() const noexcept {
+    return config_.resource_accounting;
+  }
+
+  impl::TaskProfiler& GetTaskProfiler() noexcept { return task_profiler_; }
+
+  const impl::TaskProfiler& GetTaskProfiler() const noexcept {
+    return task_profiler_;
+  }
+
   size_t GetTaskTraceMaxCswForNewTask() const;
 
   const std::string& GetTaskTraceLoggerName() const;
@@ -80,27 +124,40 @@ class TaskProcessor final {
  private:
   void Cleanup() noexcept;
 
+  coro::Pool<impl::TaskContext>& GetCoroPool() noexcept;
+
   void PrepareWorkerThread(std::size_t index) noexcept;
 
   void ProcessTasks() noexcept;
 
+  template <typename Queue>
+  void ProcessTasks(Queue& queue) noexcept;
+
   void CheckWaitTime(impl::TaskContext& context);
 
   void SetTaskQueueWaitTimeOverloaded(bool new_value) noexcept;
 
   void HandleOverload(impl::TaskContext& context);
 
+  void AccountCrossNodeWakeup() noexcept;
+
   impl::TaskCounter task_counter_;
   concurrent::impl::InterferenceShield<impl::DetachedTasksSyncBlock>
       detached_contexts_{impl::DetachedTasksSyncBlock::StopMode::kCancel};
   concurrent::impl::InterferenceShield<std::atomic<bool>>
       task_queue_wait_time_overloaded_{false};
-  TaskQueue task_queue_;
+  std::variant<TaskQueue, WorkStealingTaskQueue> task_queue_;
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
+  // Only present for the task processors bound to a NUMA node or with a
+  // custom coroutine stack size
+  std::unique_ptr<coro::Pool<impl::TaskContext>> local_coro_pool_;
+  std::unique_ptr<io::impl::IoUringBackend> io_uring_backend_;
+  std::unique_ptr<impl::PreemptionMonitor> preemption_monitor_;
   std::vector<std::thread> workers_;
   logging::LoggerPtr task_trace_logger_{nullptr};
+  impl::TaskProfiler task_profiler_;
 
   std::atomic<std::chrono::microseconds> task_profiler_threshold_{{}};
   std::atomic<std::chrono::microseconds> sensor_task_queue_wait_time_{{}};
@@ -110,6 +167,7 @@ class TaskProcessor final {
   std::atomic<TaskProcessorSettings::OverloadAction> overload_action_{
       TaskProcessorSettings::OverloadAction::kIgnore};
   std::atomic<bool> profiler_force_stacktrace_{false};
+  std::atomic<std::size_t> profiler_sample_every_task_{0};
   std::atomic<bool> is_shutting_down_{false};
   std::atomic<bool> task_trace_logger_set_{false};
 
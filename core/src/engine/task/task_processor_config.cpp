@@ -2,6 +2,7 @@
 
 #include <cstdint>
 
+#include <engine/task/cpu_affinity.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
@@ -45,6 +46,28 @@ OsScheduling Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(TaskQueueType::kGlobalTaskQueue, "global")
+        .Case(TaskQueueType::kWorkStealingTaskQueue, "work-stealing");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(IoBackend::kEv, "ev")
+        .Case(IoBackend::kIoUring, "io-uring");
+  });
+
+  return utils::ParseFromValueString(value, kMap);
+}
+
 TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
                           formats::parse::To<TaskProcessorConfig>) {
   TaskProcessorConfig config;
@@ -56,6 +79,35 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.task_queue =
+      value["task-queue"].As<TaskQueueType>(config.task_queue);
+
+  config.coro_stack_size =
+      value["coro-stack-size"].As<std::optional<std::size_t>>();
+  config.io_backend = value["io-backend"].As<IoBackend>(config.io_backend);
+  config.io_uring_entries =
+      value["io-uring-entries"].As<std::size_t>(config.io_uring_entries);
+  config.io_uring_max_file_operations =
+      value["io-uring-max-file-operations"].As<std::size_t>(
+          config.io_uring_max_file_operations);
+  config.preemption_time_slice =
+      value["preemption-time-slice"].As<std::chrono::milliseconds>(
+          config.preemption_time_slice);
+  config.resource_accounting =
+      value["resource-accounting"].As<bool>(config.resource_accounting);
+
+  const auto cpu_affinity = value["cpu-affinity"];
+  config.numa_node = value["numa-node"].As<std::optional<std::size_t>>();
+  if (!cpu_affinity.IsMissing() && config.numa_node) {
+    throw std::runtime_error(
+        "Only one of 'cpu-affinity' and 'numa-node' may be specified for a "
+        "task processor");
+  }
+  if (!cpu_affinity.IsMissing()) {
+    config.cpu_affinity = impl::ParseCpuList(cpu_affinity.As<std::string>());
+  } else if (config.numa_node) {
+    config.cpu_affinity = impl::GetNumaNodeCpus(*config.numa_node);
+  }
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
@@ -3,7 +3,9 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
@@ -21,6 +23,22 @@ enum class OsScheduling {
 OsScheduling Parse(const yaml_config::YamlConfig& value,
                    formats::parse::To<OsScheduling>);
 
+enum class TaskQueueType {
+  kGlobalTaskQueue,
+  kWorkStealingTaskQueue,
+};
+
+TaskQueueType Parse(const yaml_config::YamlConfig& value,
+                    formats::parse::To<TaskQueueType>);
+
+enum class IoBackend {
+  kEv,
+  kIoUring,
+};
+
+IoBackend Parse(const yaml_config::YamlConfig& value,
+                formats::parse::To<IoBackend>);
+
 struct TaskProcessorConfig {
   std::string name;
 
@@ -29,6 +47,27 @@ struct TaskProcessorConfig {
   std::string thread_name;
   OsScheduling os_scheduling{OsScheduling::kNormal};
   int spinning_iterations{10000};
+  TaskQueueType task_queue{TaskQueueType::kGlobalTaskQueue};
+
+  // Sorted CPU ids to bind the worker threads to, empty for no binding
+  std::vector<std::size_t> cpu_affinity;
+  std::optional<std::size_t> numa_node;
+
+  // Stack size of the task processor own coroutine pool, if any
+  std::optional<std::size_t> coro_stack_size;
+
+  IoBackend io_backend{IoBackend::kEv};
+  std::size_t io_uring_entries{4096};
+  // Max count of the file operations in flight in the io_uring backend
+  std::size_t io_uring_max_file_operations{64};
+
+  // Time slice after which the long-running task steps are asked to yield by
+  // engine::ShouldYield(), zero to disable
+  std::chrono::milliseconds preemption_time_slice{0};
+
+  // Accumulate the thread CPU time and allocated bytes of each task, see
+  // engine::current_task::GetResourceUsage()
+  bool resource_accounting{false};
 
   std::size_t task_trace_every{1000};
   std::size_t task_trace_max_csw{0};
@@ -50,6 +89,8 @@ struct TaskProcessorSettings {
 
   std::chrono::microseconds profiler_execution_slice_threshold{0};
   bool profiler_force_stacktrace{false};
+  // 0 disables the sampling TaskProfiler
+  std::size_t profiler_sample_every_task{0};
 };
 
 TaskProcessorSettings::OverloadAction Parse(
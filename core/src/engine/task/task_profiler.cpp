@@ -0,0 +1,51 @@
+#include <engine/task/task_profiler.hpp>
+
+#include <functional>
+
+#include <boost/functional/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+void TaskProfiler::Account(SampleKind kind, std::string_view span_name,
+                           std::string_view wait_kind,
+                           std::chrono::nanoseconds duration) {
+  auto& shard = shards_[utils::statistics::impl::GetCounterShardIndex()];
+  Key key{std::string{span_name}, kind, wait_kind};
+
+  std::lock_guard lock(shard.mutex);
+  auto& value = shard.samples[std::move(key)];
+  ++value.count;
+  value.total += duration;
+}
+
+void TaskProfiler::Reset() noexcept {
+  for (auto& shard : shards_) {
+    std::lock_guard lock(shard.mutex);
+    shard.samples.clear();
+  }
+}
+
+std::size_t TaskProfiler::KeyHash::operator()(const Key& key) const noexcept {
+  std::size_t seed = std::hash<std::string>{}(key.span_name);
+  boost::hash_combine(seed, static_cast<std::uint8_t>(key.kind));
+  boost::hash_combine(seed, std::hash<std::string_view>{}(key.wait_kind));
+  return seed;
+}
+
+std::string_view ToString(TaskProfiler::SampleKind kind) noexcept {
+  switch (kind) {
+    case TaskProfiler::SampleKind::kOnCpu:
+      return "on_cpu";
+    case TaskProfiler::SampleKind::kRunnable:
+      return "runnable";
+    case TaskProfiler::SampleKind::kBlocked:
+      return "blocked";
+  }
+  return "unknown";
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
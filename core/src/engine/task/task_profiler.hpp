@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+// Accumulates the time that the sampled tasks of a TaskProcessor spend
+// running, waiting in the task queue and sleeping on the wait primitives,
+// grouped by the name of the current tracing::Span.
+class TaskProfiler final {
+ public:
+  enum class SampleKind : std::uint8_t {
+    kOnCpu,
+    kRunnable,
+    kBlocked,
+  };
+
+  struct Key final {
+    std::string span_name;
+    SampleKind kind;
+    // Must point to a string literal, see WaitStrategy::GetWaitKind
+    std::string_view wait_kind;
+
+    bool operator==(const Key& other) const noexcept {
+      return kind == other.kind && wait_kind == other.wait_kind &&
+             span_name == other.span_name;
+    }
+  };
+
+  struct Value final {
+    std::uint64_t count{0};
+    std::chrono::nanoseconds total{0};
+  };
+
+  void Account(SampleKind kind, std::string_view span_name,
+               std::string_view wait_kind,
+               std::chrono::nanoseconds duration);
+
+  // Calls `func(const Key&, const Value&)` for each of the accumulated
+  // samples, the samples of the same key from different shards are not merged
+  template <typename Func>
+  void Visit(Func func) const;
+
+  void Reset() noexcept;
+
+ private:
+  struct KeyHash final {
+    std::size_t operator()(const Key& key) const noexcept;
+  };
+
+  struct alignas(utils::statistics::impl::kCounterShardAlignment) Shard final {
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Value, KeyHash> samples;
+  };
+
+  std::array<Shard, utils::statistics::impl::kCounterShardCount> shards_;
+};
+
+std::string_view ToString(TaskProfiler::SampleKind kind) noexcept;
+
+template <typename Func>
+void TaskProfiler::Visit(Func func) const {
+  for (const auto& shard : shards_) {
+    std::lock_guard lock(shard.mutex);
+    for (const auto& [key, value] : shard.samples) func(key, value);
+  }
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,75 @@
+#include <engine/task/task_profiler.hpp>
+
+#include <chrono>
+#include <map>
+#include <string>
+
+#include <engine/task/task_processor.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::impl::TaskProfiler;
+using Kind = TaskProfiler::SampleKind;
+
+std::map<std::string, TaskProfiler::Value> Collect(
+    const TaskProfiler& profiler) {
+  std::map<std::string, TaskProfiler::Value> result;
+  profiler.Visit([&](const TaskProfiler::Key& key,
+                     const TaskProfiler::Value& value) {
+    auto& merged = result[key.span_name + ";" +
+                          std::string{engine::impl::ToString(key.kind)} +
+                          ";" + std::string{key.wait_kind}];
+    merged.count += value.count;
+    merged.total += value.total;
+  });
+  return result;
+}
+
+}  // namespace
+
+TEST(TaskProfiler, Basic) {
+  TaskProfiler profiler;
+  profiler.Account(Kind::kOnCpu, "span", {}, std::chrono::microseconds{10});
+  profiler.Account(Kind::kOnCpu, "span", {}, std::chrono::microseconds{20});
+  profiler.Account(Kind::kBlocked, "span", "mutex",
+                   std::chrono::microseconds{5});
+
+  auto samples = Collect(profiler);
+  ASSERT_EQ(samples.size(), 2);
+  EXPECT_EQ(samples["span;on_cpu;"].count, 2);
+  EXPECT_EQ(samples["span;on_cpu;"].total, std::chrono::microseconds{30});
+  EXPECT_EQ(samples["span;blocked;mutex"].count, 1);
+
+  profiler.Reset();
+  EXPECT_TRUE(Collect(profiler).empty());
+}
+
+UTEST(TaskProfiler, SampledTasks) {
+  auto& task_processor = engine::current_task::GetTaskProcessor();
+  engine::TaskProcessorSettings settings;
+  settings.profiler_sample_every_task = 1;
+  task_processor.SetSettings(settings);
+
+  engine::AsyncNoSpan([] {
+    tracing::Span span{"sampled-span"};
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }).Get();
+
+  settings.profiler_sample_every_task = 0;
+  task_processor.SetSettings(settings);
+
+  auto samples = Collect(task_processor.GetTaskProfiler());
+  EXPECT_GE(samples["sampled-span;on_cpu;"].count, 1);
+  EXPECT_GE(samples["sampled-span;runnable;"].count, 1);
+  // The sleep deadline is computed a bit before the task goes to sleep
+  EXPECT_GE(samples["sampled-span;blocked;sleep"].total,
+            std::chrono::milliseconds{5});
+}
+
+USERVER_NAMESPACE_END
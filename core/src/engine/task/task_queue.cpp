@@ -8,58 +8,99 @@ namespace engine {
 
 namespace {
 constexpr std::size_t kSemaphoreInitialCount = 0;
+
+constexpr auto kLatencyCritical = SchedulingClass::kLatencyCritical;
+constexpr auto kNormal = SchedulingClass::kNormal;
+constexpr auto kBackground = SchedulingClass::kBackground;
+
+// Weighted round robin over the scheduling classes with 8:4:1 weights,
+// interleaved to keep the latency of each class low
+constexpr std::array kSchedule{
+    kLatencyCritical, kNormal, kLatencyCritical, kLatencyCritical, kNormal,
+    kLatencyCritical, kBackground, kLatencyCritical, kNormal, kLatencyCritical,
+    kLatencyCritical, kNormal, kLatencyCritical,
+};
+
+// The classes to try if the scheduled one has no tasks
+constexpr std::array kPriorityOrder{kLatencyCritical, kNormal, kBackground};
+static_assert(kPriorityOrder.size() == kSchedulingClassCount);
+
+constexpr std::size_t ToIndex(SchedulingClass scheduling_class) noexcept {
+  return static_cast<std::size_t>(scheduling_class);
 }
 
+}  // namespace
+
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
     : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
   UASSERT(context);
-  DoPush(context.get());
+  DoPush(context.get(), context->GetSchedulingClass());
   context.detach();
 }
 
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
   // Current thread handles only a single TaskProcessor, so it's safe to store
-  // a token for the task processor in a thread-local variable.
-  thread_local moodycamel::ConsumerToken token(queue_);
-
-  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(token),
+  // tokens for the task processor in a thread-local variable.
+  thread_local ConsumerTokens tokens{
+      moodycamel::ConsumerToken{queues_[ToIndex(kLatencyCritical)]},
+      moodycamel::ConsumerToken{queues_[ToIndex(kNormal)]},
+      moodycamel::ConsumerToken{queues_[ToIndex(kBackground)]},
+  };
+
+  boost::intrusive_ptr<impl::TaskContext> context{DoPopBlocking(tokens),
                                                   /* add_ref= */ false};
 
   if (!context) {
     // return "stop" token back
-    DoPush(nullptr);
+    DoPush(nullptr, kNormal);
   }
 
   return context;
 }
 
-void TaskQueue::StopProcessing() { DoPush(nullptr); }
+void TaskQueue::StopProcessing() { DoPush(nullptr, kNormal); }
 
 std::size_t TaskQueue::GetSizeApproximate() const noexcept {
-  return queue_.size_approx();
+  std::size_t size = 0;
+  for (const auto& queue : queues_) size += queue.size_approx();
+  return size;
 }
 
-void TaskQueue::DoPush(impl::TaskContext* context) {
+void TaskQueue::DoPush(impl::TaskContext* context,
+                       SchedulingClass scheduling_class) {
   // This piece of code is copy-pasted from
   // moodycamel::BlockingConcurrentQueue::enqueue
-  queue_.enqueue(context);
+  queues_[ToIndex(scheduling_class)].enqueue(context);
   queue_semaphore_.signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
+impl::TaskContext* TaskQueue::DoPopBlocking(ConsumerTokens& tokens) {
+  thread_local std::size_t schedule_position = 0;
+
   impl::TaskContext* context{};
 
-  // This piece of code is copy-pasted from
+  const auto try_dequeue = [&](SchedulingClass scheduling_class) {
+    const auto index = ToIndex(scheduling_class);
+    return queues_[index].try_dequeue(tokens[index], context);
+  };
+
+  // This piece of code is adapted from
   // moodycamel::BlockingConcurrentQueue::wait_dequeue
   queue_semaphore_.wait();
-  while (!queue_.try_dequeue(token, context)) {
+
+  const auto scheduled = kSchedule[schedule_position];
+  schedule_position = (schedule_position + 1) % kSchedule.size();
+  if (try_dequeue(scheduled)) return context;
+
+  while (true) {
+    for (const auto scheduling_class : kPriorityOrder) {
+      if (try_dequeue(scheduling_class)) return context;
+    }
     // Can happen when another consumer steals our item in exchange for another
     // item in a Moodycamel sub-queue that we have already passed.
   }
-
-  return context;
 }
 
 }  // namespace engine
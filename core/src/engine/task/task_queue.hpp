@@ -1,10 +1,13 @@
 #pragma once
 
+#include <array>
+
 #include <moodycamel/blockingconcurrentqueue.h>
 #include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include <engine/task/task_processor_config.hpp>
+#include <userver/engine/task/scheduling_class.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,6 +17,8 @@ namespace impl {
 class TaskContext;
 }  // namespace impl
 
+// Serves the tasks of the different scheduling classes by weighted fair share,
+// see engine::SchedulingClass
 class TaskQueue final {
  public:
   explicit TaskQueue(const TaskProcessorConfig& config);
@@ -28,11 +33,15 @@ class TaskQueue final {
   std::size_t GetSizeApproximate() const noexcept;
 
  private:
-  void DoPush(impl::TaskContext* context);
+  using Queue = moodycamel::ConcurrentQueue<impl::TaskContext*>;
+  using ConsumerTokens =
+      std::array<moodycamel::ConsumerToken, kSchedulingClassCount>;
+
+  void DoPush(impl::TaskContext* context, SchedulingClass scheduling_class);
 
-  impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+  impl::TaskContext* DoPopBlocking(ConsumerTokens& tokens);
 
-  moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
+  std::array<Queue, kSchedulingClassCount> queues_;
   moodycamel::LightweightSemaphore queue_semaphore_;
 };
 
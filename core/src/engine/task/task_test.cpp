@@ -1,8 +1,10 @@
 #include <userver/utest/utest.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/condition_variable.hpp>
@@ -11,6 +13,7 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/scheduling_class.hpp>
 #include <userver/engine/task/task.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -388,4 +391,53 @@ UTEST(Task, SyncCancelAndWait) {
   task.Get();
 }
 
+UTEST(Task, SchedulingClassInherited) {
+  EXPECT_EQ(engine::current_task::GetSchedulingClass(),
+            engine::SchedulingClass::kNormal);
+
+  engine::current_task::SetSchedulingClass(
+      engine::SchedulingClass::kBackground);
+  auto task = engine::AsyncNoSpan([] {
+    EXPECT_EQ(engine::current_task::GetSchedulingClass(),
+              engine::SchedulingClass::kBackground);
+  });
+  task.Get();
+
+  engine::current_task::SetSchedulingClass(engine::SchedulingClass::kNormal);
+}
+
+UTEST(Task, SchedulingClassFairShare) {
+  // A round of the weighted round robin of the task queue
+  constexpr std::size_t kRound = 13;
+
+  std::vector<engine::SchedulingClass> started;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  const auto spawn = [&](engine::SchedulingClass scheduling_class) {
+    engine::current_task::SetSchedulingClass(scheduling_class);
+    tasks.push_back(engine::AsyncNoSpan([&started] {
+      started.push_back(engine::current_task::GetSchedulingClass());
+    }));
+  };
+
+  // The only worker thread is busy with the current task, so all the tasks
+  // are in the queue before any of them starts
+  for (std::size_t i = 0; i < kRound; ++i) {
+    spawn(engine::SchedulingClass::kBackground);
+  }
+  for (std::size_t i = 0; i < kRound; ++i) {
+    spawn(engine::SchedulingClass::kLatencyCritical);
+  }
+  engine::current_task::SetSchedulingClass(engine::SchedulingClass::kNormal);
+
+  for (auto& task : tasks) task.Get();
+  ASSERT_EQ(started.size(), 2 * kRound);
+
+  const auto background_started =
+      std::count(started.begin(), started.begin() + kRound,
+                 engine::SchedulingClass::kBackground);
+  // Background tasks get their share, but do not take over
+  EXPECT_GE(background_started, 1);
+  EXPECT_LE(background_started, 2);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,276 @@
+#include <engine/task/work_stealing_task_queue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <optional>
+
+#include <engine/task/task_context.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+constexpr std::size_t kSemaphoreInitialCount = 0;
+
+// Same as in Tokio: check the global queue every N pops, so that the tasks
+// from the outside are not starved by the tasks that wake up each other.
+constexpr std::size_t kGlobalQueueCheckInterval = 61;
+
+// Limits the number of consecutive pops from the LIFO slot, otherwise two
+// tasks that wake up each other could starve the local queue.
+constexpr std::size_t kMaxLifoStreak = 3;
+
+constexpr std::size_t kStealBatchSize = 32;
+
+void StoreSingleWriter(std::atomic<std::int64_t>& counter,
+                       std::int64_t diff) noexcept {
+  counter.store(counter.load(std::memory_order_relaxed) + diff,
+                std::memory_order_relaxed);
+}
+
+}  // namespace
+
+struct alignas(concurrent::impl::kDestructiveInterferenceSize)
+    WorkStealingTaskQueue::Consumer final {
+  WorkStealingTaskQueue* owner{nullptr};
+
+  moodycamel::ConcurrentQueue<impl::TaskContext*> local_queue;
+  moodycamel::ProducerToken local_producer_token{local_queue};
+  moodycamel::ConsumerToken local_consumer_token{local_queue};
+  std::optional<moodycamel::ConsumerToken> global_consumer_token;
+
+  std::atomic<impl::TaskContext*> lifo_slot{nullptr};
+
+  // Pushes to this worker minus pops by this worker. Only written by the
+  // worker thread itself, may be negative because of stealing.
+  std::atomic<std::int64_t> size{0};
+
+  std::size_t pops_count{0};
+  std::size_t lifo_streak{0};
+};
+
+namespace {
+thread_local void* local_consumer = nullptr;
+}  // namespace
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
+    : workers_count_(config.worker_threads),
+      consumers_(std::make_unique<Consumer[]>(config.worker_threads)),
+      sleep_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {
+  for (std::size_t i = 0; i < workers_count_; ++i) {
+    consumers_[i].owner = this;
+  }
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() = default;
+
+void WorkStealingTaskQueue::PrepareWorker(std::size_t index) {
+  UASSERT(index < workers_count_);
+  auto& consumer = consumers_[index];
+  consumer.global_consumer_token.emplace(global_queue_);
+  local_consumer = &consumer;
+}
+
+void WorkStealingTaskQueue::Push(
+    boost::intrusive_ptr<impl::TaskContext>&& context) {
+  UASSERT(context);
+  auto* const consumer = GetLocalConsumer();
+  AccountPush(consumer);
+
+  if (consumer) {
+    // The most recently woken up task is likely to work with the data that is
+    // hot in the cache of the current worker, run it next.
+    auto* const previous = consumer->lifo_slot.exchange(
+        context.detach(), std::memory_order_acq_rel);
+    if (previous) {
+      consumer->local_queue.enqueue(consumer->local_producer_token, previous);
+    }
+  } else {
+    global_queue_.enqueue(context.detach());
+  }
+
+  TryWakeOneWorker();
+}
+
+boost::intrusive_ptr<impl::TaskContext> WorkStealingTaskQueue::PopBlocking() {
+  auto* const consumer = GetLocalConsumer();
+  UASSERT_MSG(consumer,
+              "PopBlocking must be called from a prepared worker thread");
+  return {PopOrSleep(*consumer), /* add_ref= */ false};
+}
+
+void WorkStealingTaskQueue::StopProcessing() {
+  is_stopped_.store(true);
+  while (TryWakeOneWorker()) {
+  }
+}
+
+std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
+  auto size = global_queue_size_->load(std::memory_order_relaxed);
+  for (std::size_t i = 0; i < workers_count_; ++i) {
+    size += consumers_[i].size.load(std::memory_order_relaxed);
+  }
+  return size > 0 ? static_cast<std::size_t>(size) : 0;
+}
+
+WorkStealingTaskQueue::Consumer* WorkStealingTaskQueue::GetLocalConsumer()
+    const noexcept {
+  auto* const consumer = static_cast<Consumer*>(local_consumer);
+  if (consumer && consumer->owner == this) return consumer;
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPop(Consumer& consumer) {
+  impl::TaskContext* context = nullptr;
+
+  if (++consumer.pops_count % kGlobalQueueCheckInterval == 0) {
+    context = TryPopGlobal(consumer);
+    if (context) return context;
+  }
+
+  if (consumer.lifo_streak < kMaxLifoStreak) {
+    context = consumer.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+    if (context) {
+      ++consumer.lifo_streak;
+      return context;
+    }
+  }
+  consumer.lifo_streak = 0;
+
+  if (consumer.local_queue.try_dequeue(consumer.local_consumer_token,
+                                       context)) {
+    return context;
+  }
+
+  context = consumer.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+  if (context) return context;
+
+  context = TryPopGlobal(consumer);
+  if (context) return context;
+
+  return TrySteal(consumer);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopGlobal(Consumer& consumer) {
+  UASSERT(consumer.global_consumer_token);
+  impl::TaskContext* context = nullptr;
+  if (global_queue_.try_dequeue(*consumer.global_consumer_token, context)) {
+    return context;
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TrySteal(Consumer& consumer) {
+  if (workers_count_ < 2) return nullptr;
+
+  const auto start = utils::RandRange(workers_count_);
+  for (std::size_t i = 0; i < workers_count_; ++i) {
+    auto& victim = consumers_[(start + i) % workers_count_];
+    if (&victim == &consumer) continue;
+
+    auto* const context = TryStealFrom(consumer, victim);
+    if (context) return context;
+  }
+  return nullptr;
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryStealFrom(Consumer& thief,
+                                                       Consumer& victim) {
+  std::array<impl::TaskContext*, kStealBatchSize> batch{};
+  const auto to_steal = std::clamp<std::size_t>(
+      victim.local_queue.size_approx() / 2, 1, kStealBatchSize);
+
+  const auto stolen =
+      victim.local_queue.try_dequeue_bulk(batch.begin(), to_steal);
+  if (stolen == 0) {
+    // The victim is busy running a long task, don't let the task that it has
+    // woken up wait for it.
+    return victim.lifo_slot.exchange(nullptr, std::memory_order_acq_rel);
+  }
+
+  if (stolen > 1) {
+    thief.local_queue.enqueue_bulk(thief.local_producer_token,
+                                   batch.begin() + 1, stolen - 1);
+  }
+  return batch[0];
+}
+
+impl::TaskContext* WorkStealingTaskQueue::PopOrSleep(Consumer& consumer) {
+  while (true) {
+    auto* context = TryPop(consumer);
+    if (context) {
+      AccountPop(consumer);
+      return context;
+    }
+
+    // Announce the intention to sleep before the final check, so that a
+    // concurrent Push either sees the sleeper or its task is seen here.
+    sleeping_workers_->fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    context = TryPop(consumer);
+    if (context) {
+      CancelSleep();
+      AccountPop(consumer);
+      return context;
+    }
+
+    if (is_stopped_.load()) {
+      CancelSleep();
+      return nullptr;
+    }
+
+    sleep_semaphore_.wait();
+  }
+}
+
+void WorkStealingTaskQueue::CancelSleep() noexcept {
+  auto& sleeping = *sleeping_workers_;
+  auto count = sleeping.load(std::memory_order_relaxed);
+  while (true) {
+    if (count == 0) {
+      // Someone has already woken us up, consume the wakeup
+      sleep_semaphore_.wait();
+      return;
+    }
+    if (sleeping.compare_exchange_weak(count, count - 1,
+                                       std::memory_order_relaxed)) {
+      return;
+    }
+  }
+}
+
+bool WorkStealingTaskQueue::TryWakeOneWorker() noexcept {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto& sleeping = *sleeping_workers_;
+  auto count = sleeping.load(std::memory_order_relaxed);
+  while (count > 0) {
+    if (sleeping.compare_exchange_weak(count, count - 1,
+                                       std::memory_order_relaxed)) {
+      sleep_semaphore_.signal();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingTaskQueue::AccountPush(Consumer* consumer) noexcept {
+  if (consumer) {
+    StoreSingleWriter(consumer->size, 1);
+  } else {
+    global_queue_size_->fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void WorkStealingTaskQueue::AccountPop(Consumer& consumer) noexcept {
+  StoreSingleWriter(consumer.size, -1);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
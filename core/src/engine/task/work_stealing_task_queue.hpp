@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <moodycamel/concurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <concurrent/impl/interference_shield.hpp>
+#include <engine/task/task_processor_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// A task queue with a local queue and a LIFO slot per worker thread.
+///
+/// Tasks scheduled from a worker thread of the same TaskProcessor go to the
+/// LIFO slot of that worker, pushing the previous occupant of the slot into
+/// the worker-local queue. Tasks scheduled from other threads go to a shared
+/// global queue. Workers that ran out of tasks check the global queue and then
+/// steal tasks from the other workers before going to sleep.
+///
+/// Sleeping workers share a semaphore, but it is only touched when some
+/// workers are actually sleeping, so under load the workers do not contend on
+/// a shared structure.
+class WorkStealingTaskQueue final {
+ public:
+  explicit WorkStealingTaskQueue(const TaskProcessorConfig& config);
+  ~WorkStealingTaskQueue();
+
+  WorkStealingTaskQueue(WorkStealingTaskQueue&&) = delete;
+  WorkStealingTaskQueue& operator=(WorkStealingTaskQueue&&) = delete;
+
+  /// Binds the current thread to the worker with the specified index. Must be
+  /// called once by each worker thread before PopBlocking.
+  void PrepareWorker(std::size_t index);
+
+  void Push(boost::intrusive_ptr<impl::TaskContext>&& context);
+
+  // Returns nullptr as a stop signal
+  boost::intrusive_ptr<impl::TaskContext> PopBlocking();
+
+  void StopProcessing();
+
+  std::size_t GetSizeApproximate() const noexcept;
+
+ private:
+  struct Consumer;
+
+  Consumer* GetLocalConsumer() const noexcept;
+
+  impl::TaskContext* TryPop(Consumer& consumer);
+  impl::TaskContext* TryPopGlobal(Consumer& consumer);
+  impl::TaskContext* TrySteal(Consumer& consumer);
+  impl::TaskContext* TryStealFrom(Consumer& thief, Consumer& victim);
+
+  impl::TaskContext* PopOrSleep(Consumer& consumer);
+  void CancelSleep() noexcept;
+  bool TryWakeOneWorker() noexcept;
+
+  void AccountPush(Consumer* consumer) noexcept;
+  void AccountPop(Consumer& consumer) noexcept;
+
+  const std::size_t workers_count_;
+  const std::unique_ptr<Consumer[]> consumers_;
+
+  moodycamel::ConcurrentQueue<impl::TaskContext*> global_queue_;
+  concurrent::impl::InterferenceShield<std::atomic<std::int64_t>>
+      global_queue_size_{0};
+
+  concurrent::impl::InterferenceShield<std::atomic<std::int64_t>>
+      sleeping_workers_{0};
+  moodycamel::LightweightSemaphore sleep_semaphore_;
+  std::atomic<bool> is_stopped_{false};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
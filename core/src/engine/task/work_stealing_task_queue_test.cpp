@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kWorkerThreads = 4;
+
+void RunInWorkStealingTaskProcessor(utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.name = "ws-task-processor";
+  config.thread_name = "ws-worker";
+  config.worker_threads = kWorkerThreads;
+  config.task_queue = engine::TaskQueueType::kWorkStealingTaskQueue;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+}  // namespace
+
+TEST(WorkStealingTaskQueue, FanOut) {
+  RunInWorkStealingTaskProcessor([] {
+    constexpr std::size_t kTasks = 1000;
+    std::atomic<std::size_t> counter{0};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasks);
+    for (std::size_t i = 0; i < kTasks; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&counter] {
+        engine::Yield();
+        ++counter;
+      }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(counter, kTasks);
+  });
+}
+
+TEST(WorkStealingTaskQueue, NestedSpawns) {
+  RunInWorkStealingTaskProcessor([] {
+    constexpr std::size_t kOuterTasks = 16;
+    constexpr std::size_t kInnerTasks = 64;
+    std::atomic<std::size_t> counter{0};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kOuterTasks);
+    for (std::size_t i = 0; i < kOuterTasks; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&counter] {
+        std::vector<engine::TaskWithResult<void>> inner;
+        inner.reserve(kInnerTasks);
+        for (std::size_t j = 0; j < kInnerTasks; ++j) {
+          inner.push_back(engine::AsyncNoSpan([&counter] { ++counter; }));
+        }
+        for (auto& task : inner) task.Get();
+      }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(counter, kOuterTasks * kInnerTasks);
+  });
+}
+
+TEST(WorkStealingTaskQueue, PingPong) {
+  RunInWorkStealingTaskProcessor([] {
+    constexpr std::size_t kIterations = 1000;
+    engine::SingleConsumerEvent ping;
+    engine::SingleConsumerEvent pong;
+
+    auto task = engine::AsyncNoSpan([&] {
+      for (std::size_t i = 0; i < kIterations; ++i) {
+        ASSERT_TRUE(ping.WaitForEvent());
+        pong.Send();
+      }
+    });
+
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      ping.Send();
+      ASSERT_TRUE(pong.WaitForEvent());
+    }
+    task.Get();
+  });
+}
+
+TEST(WorkStealingTaskQueue, LongTaskDoesNotBlockWokenUpTasks) {
+  RunInWorkStealingTaskProcessor([] {
+    std::atomic<bool> is_done{false};
+
+    // Spawned from this worker, the task lands in its LIFO slot. Other workers
+    // must steal it while the current one is busy.
+    auto task = engine::AsyncNoSpan([&is_done] { is_done = true; });
+
+    const auto deadline =
+        std::chrono::steady_clock::now() + utest::kMaxTestWaitTime;
+    while (!is_done && std::chrono::steady_clock::now() < deadline) {
+      // busy loop without context switches
+    }
+
+    EXPECT_TRUE(is_done);
+    task.Get();
+  });
+}
+
+TEST(WorkStealingTaskQueue, QueueSize) {
+  RunInWorkStealingTaskProcessor([] {
+    auto& task_processor = engine::current_task::GetTaskProcessor();
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    for (std::size_t i = 0; i < 100; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([] {}));
+    }
+    EXPECT_LE(task_processor.GetTaskQueueSize(), tasks.size());
+
+    for (auto& task : tasks) task.Get();
+    engine::SleepFor(std::chrono::milliseconds{10});
+    EXPECT_EQ(task_processor.GetTaskQueueSize(), 0);
+  });
+}
+
+USERVER_NAMESPACE_END
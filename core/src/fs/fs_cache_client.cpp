@@ -3,6 +3,10 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <algorithm>
+#include <exception>
+
+#include <userver/engine/deadline.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
@@ -32,6 +36,13 @@ namespace fs {
 #ifdef __linux__
 namespace {
 
+// Editors and deploy tools write files in many small chunks, each producing
+// an event. The changes are applied once the files stay quiet for a while.
+constexpr std::chrono::milliseconds kCoalescingWindow{20};
+
+// Files that are written continuously are still reloaded this often
+constexpr std::chrono::milliseconds kMaxCoalescingDelay{200};
+
 bool IsFilepathHidden(const std::string& path) {
   auto filename = boost::filesystem::path(path).filename().string();
   return filename[0] == '.';
@@ -42,8 +53,12 @@ bool IsFilepathHidden(const std::string& path) {
 
 FsCacheClient::FsCacheClient(std::string_view dir,
                              std::chrono::milliseconds update_period,
-                             engine::TaskProcessor& tp)
-    : dir_(GetNormalizeDirectory(dir)), update_period_(update_period), tp_(tp) {
+                             engine::TaskProcessor& tp,
+                             utils::Flags<SettingsReadFile> flags)
+    : dir_(GetNormalizeDirectory(dir)),
+      update_period_(update_period),
+      tp_(tp),
+      flags_(flags) {
   UpdateCache();
 
   if (update_period_ == std::chrono::milliseconds(0)) {
@@ -61,8 +76,7 @@ FsCacheClient::FsCacheClient(std::string_view dir,
 }
 
 void FsCacheClient::UpdateCache() {
-  auto map = fs::ReadRecursiveFilesInfoWithData(
-      tp_, dir_, {fs::SettingsReadFile::kSkipHidden});
+  auto map = fs::ReadRecursiveFilesInfoWithData(tp_, dir_, flags_);
   data_.Assign(std::move(map));
 }
 
@@ -73,15 +87,35 @@ void FsCacheClient::InotifyWork() {
 
   HandleCreateDirectory(inotify, dir_);
 
+  PendingChanges pending;
+  auto max_deadline = engine::Deadline::Passed();
+
   while (!engine::current_task::ShouldCancel()) {
-    auto event = inotify.Poll({});
-    LOG_INFO() << event;
-    if (!event) return;
+    // Wait for the first event indefinitely, then gather the rest of the burst
+    // until the files stay quiet for kCoalescingWindow.
+    auto deadline = engine::Deadline{};
+    if (!pending.empty()) {
+      deadline = std::min(engine::Deadline::FromDuration(kCoalescingWindow),
+                          max_deadline);
+    }
+
+    auto event = inotify.Poll(deadline);
+    if (!event) {
+      if (pending.empty()) return;
+      ApplyChanges(pending);
+      pending.clear();
+      continue;
+    }
+    LOG_DEBUG() << *event;
+
+    if (pending.empty()) {
+      max_deadline = engine::Deadline::FromDuration(kMaxCoalescingDelay);
+    }
 
     if (event->mask & linux::EventType::kMovedFrom ||
         event->mask & linux::EventType::kDelete) {
       if (!(event->mask & linux::EventType::kIsDir)) {
-        HandleDelete(event->path);
+        pending[event->path] = FileChange::kDelete;
       } else {
         HandleDeleteDirectory(inotify, event->path);
       }
@@ -89,9 +123,10 @@ void FsCacheClient::InotifyWork() {
 
     if (event->mask & linux::EventType::kMovedTo ||
         event->mask & linux::EventType::kCreate ||
-        event->mask & linux::EventType::kModify) {
+        event->mask & linux::EventType::kModify ||
+        event->mask & linux::EventType::kCloseWrite) {
       if (!(event->mask & linux::EventType::kIsDir)) {
-        HandleCreate(event->path);
+        pending[event->path] = FileChange::kReload;
       } else {
         HandleCreateDirectory(inotify, event->path);
       }
@@ -99,33 +134,50 @@ void FsCacheClient::InotifyWork() {
   }
 }
 
+void FsCacheClient::ApplyChanges(const PendingChanges& pending) {
+  for (const auto& [path, change] : pending) {
+    if (change == FileChange::kDelete) {
+      HandleDelete(path);
+      continue;
+    }
+
+    try {
+      HandleCreate(path);
+    } catch (const std::exception& ex) {
+      // The file could be removed or replaced after the event
+      LOG_WARNING() << "Failed to reload file " << path << ": " << ex;
+      HandleDelete(path);
+    }
+  }
+}
+
 void FsCacheClient::HandleDelete(const std::string& path) {
   data_.Erase(GetLexicallyRelative(path, dir_));
 }
 
 void FsCacheClient::HandleDeleteDirectory(
     engine::io::sys::linux::Inotify& inotify, const std::string& path) {
-  LOG_INFO() << "HandleDeleteDirectory()";
+  LOG_DEBUG() << "HandleDeleteDirectory(" << path << ")";
   inotify.RmWatch(path);
 }
 
 void FsCacheClient::HandleCreate(const std::string& path) {
-  if (IsFilepathHidden(path)) return;
-
-  FileInfoWithData info{};
-  info.extension = boost::filesystem::path(path).extension().string();
-  info.data = ReadFileContents(tp_, path);
-  data_.InsertOrAssign(
-      GetLexicallyRelative(path, dir_),
-      std::make_shared<const FileInfoWithData>(std::move(info)));
+  if ((flags_ & SettingsReadFile::kSkipHidden) && IsFilepathHidden(path)) {
+    return;
+  }
+
+  data_.InsertOrAssign(GetLexicallyRelative(path, dir_),
+                       std::make_shared<const FileInfoWithData>(
+                           ReadFileInfoWithData(tp_, path, flags_)));
 }
 
 void FsCacheClient::HandleCreateDirectory(
     engine::io::sys::linux::Inotify& inotify, const std::string& path) {
-  LOG_INFO() << "HandleCreateDirectory(" << path << ")";
+  LOG_DEBUG() << "HandleCreateDirectory(" << path << ")";
   namespace linux = engine::io::sys::linux;
   inotify.AddWatch(path, {
                              linux::EventType::kModify,
+                             linux::EventType::kCloseWrite,
                              linux::EventType::kMovedFrom,
                              linux::EventType::kMovedTo,
                              linux::EventType::kDelete,
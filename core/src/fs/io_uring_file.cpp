@@ -0,0 +1,133 @@
+#include <fs/io_uring_file.hpp>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <engine/io/io_uring_backend.hpp>
+#include <engine/task/task_processor.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace fs::impl {
+
+namespace {
+
+// Large files are transferred in chunks, so that a single operation neither
+// holds a kernel worker for too long nor overflows the 32-bit length
+constexpr std::size_t kMaxChunkSize = 1 << 20;
+constexpr std::size_t kMinReadSize = 4096;
+
+// The same as the default perms of fs::blocking::FileDescriptor::Open
+constexpr mode_t kDefaultPerms = S_IRUSR | S_IWUSR;
+
+int CheckResult(int result, std::string_view action, const std::string& path) {
+  if (result < 0) {
+    throw std::system_error(
+        std::error_code(-result, std::system_category()),
+        fmt::format("Error while {} '{}'", action, path));
+  }
+  return result;
+}
+
+class File final {
+ public:
+  File(engine::io::impl::IoUringBackend& uring, const std::string& path,
+       int flags)
+      : uring_(uring),
+        path_(path),
+        fd_(CheckResult(uring_.OpenAt(path.c_str(), flags | O_CLOEXEC,
+                                      kDefaultPerms),
+                        "opening file", path)) {}
+
+  File(const File&) = delete;
+  File& operator=(const File&) = delete;
+
+  ~File() {
+    // Only on errors, the result of close is ignored anyway
+    if (fd_ != -1) ::close(fd_);
+  }
+
+  std::size_t GetSizeHint() const {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
+    struct ::stat stats;
+    // The inode is already loaded by open, fstat does not touch the disk
+    if (::fstat(fd_, &stats) != 0) return 0;
+    return static_cast<std::size_t>(std::max<off_t>(stats.st_size, 0));
+  }
+
+  std::size_t ReadAt(char* buf, std::size_t len, std::size_t offset) {
+    return CheckResult(
+        uring_.ReadAt(fd_, buf, std::min(len, kMaxChunkSize), offset),
+        "reading file", path_);
+  }
+
+  std::size_t WriteAt(std::string_view data, std::size_t offset) {
+    return CheckResult(
+        uring_.WriteAt(fd_, data.data(), std::min(data.size(), kMaxChunkSize),
+                       offset),
+        "writing file", path_);
+  }
+
+  void Close() {
+    CheckResult(uring_.Close(std::exchange(fd_, -1)), "closing file", path_);
+  }
+
+ private:
+  engine::io::impl::IoUringBackend& uring_;
+  const std::string& path_;
+  int fd_;
+};
+
+}  // namespace
+
+engine::io::impl::IoUringBackend* GetIoUring(
+    engine::TaskProcessor& async_tp) noexcept {
+  return async_tp.GetIoUringBackend();
+}
+
+std::string ReadFileContents(engine::io::impl::IoUringBackend& uring,
+                             const std::string& path) {
+  File file(uring, path, O_RDONLY);
+
+  // The file may change while it is read, so the data is read up to EOF
+  // regardless of the size
+  std::string result(std::max(file.GetSizeHint() + 1, kMinReadSize), '\0');
+  std::size_t size = 0;
+  for (;;) {
+    if (size == result.size()) result.resize(result.size() * 2);
+    const auto read =
+        file.ReadAt(result.data() + size, result.size() - size, size);
+    if (read == 0) break;
+    size += read;
+  }
+  result.resize(size);
+
+  file.Close();
+  return result;
+}
+
+void RewriteFileContents(engine::io::impl::IoUringBackend& uring,
+                         const std::string& path, std::string_view contents) {
+  File file(uring, path, O_WRONLY | O_CREAT | O_TRUNC);
+
+  std::size_t offset = 0;
+  while (offset < contents.size()) {
+    const auto written = file.WriteAt(contents.substr(offset), offset);
+    if (written == 0) CheckResult(-ENOSPC, "writing file", path);
+    offset += written;
+  }
+
+  file.Close();
+}
+
+}  // namespace fs::impl
+
+USERVER_NAMESPACE_END
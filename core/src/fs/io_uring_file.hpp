@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::io::impl {
+class IoUringBackend;
+}  // namespace engine::io::impl
+
+namespace fs::impl {
+
+/// Returns the io_uring backend of the task processor, if it has one. The fs::
+/// functions given such a task processor do the file I/O with io_uring in the
+/// calling task instead of blocking the threads of the task processor.
+engine::io::impl::IoUringBackend* GetIoUring(
+    engine::TaskProcessor& async_tp) noexcept;
+
+/// @throws std::system_error
+std::string ReadFileContents(engine::io::impl::IoUringBackend& uring,
+                             const std::string& path);
+
+/// @throws std::system_error
+void RewriteFileContents(engine::io::impl::IoUringBackend& uring,
+                         const std::string& path, std::string_view contents);
+
+}  // namespace fs::impl
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,12 @@
 #include <userver/fs/read.hpp>
 
 #include <userver/engine/async.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
 
+#include <fs/io_uring_file.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -27,10 +30,33 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
 
 std::string ReadFileContents(engine::TaskProcessor& async_tp,
                              const std::string& path) {
+  if (auto* uring = impl::GetIoUring(async_tp)) {
+    return impl::ReadFileContents(*uring, path);
+  }
   return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path)
       .Get();
 }
 
+FileInfoWithData ReadFileInfoWithData(engine::TaskProcessor& async_tp,
+                                      const std::string& path,
+                                      utils::Flags<SettingsReadFile> flags) {
+  FileInfoWithData info{};
+  info.extension = boost::filesystem::path(path).extension().string();
+  if (flags & SettingsReadFile::kKeepDescriptor) {
+    auto file = engine::AsyncNoSpan(async_tp, [&path] {
+                  return fs::blocking::FileDescriptor::Open(
+                      path, fs::blocking::OpenFlag::kRead);
+                }).Get();
+    info.size = file.GetSize();
+    info.file = std::make_shared<const fs::blocking::FileDescriptor>(
+        std::move(file));
+  } else {
+    info.data = ReadFileContents(async_tp, path);
+    info.size = info.data.size();
+  }
+  return info;
+}
+
 FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     engine::TaskProcessor& async_tp, const std::string& path,
     utils::Flags<SettingsReadFile> flags) {
@@ -48,11 +74,9 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     if (it->status().type() != boost::filesystem::regular_file) continue;
     if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path()))
       continue;
-    FileInfoWithData info{};
-    info.extension = it->path().extension().string();
-    info.data = ReadFileContents(async_tp, it->path().string());
     data[GetLexicallyRelative(it->path().string(), path)] =
-        std::make_shared<const FileInfoWithData>(std::move(info));
+        std::make_shared<const FileInfoWithData>(
+            ReadFileInfoWithData(async_tp, it->path().string(), flags));
   }
   return data;
 }
@@ -5,6 +5,8 @@
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/write.hpp>
 
+#include <fs/io_uring_file.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace fs {
@@ -24,6 +26,10 @@ void CreateDirectories(engine::TaskProcessor& async_tp, std::string_view path) {
 
 void RewriteFileContents(engine::TaskProcessor& async_tp,
                          const std::string& path, std::string_view contents) {
+  if (auto* uring = impl::GetIoUring(async_tp)) {
+    impl::RewriteFileContents(*uring, path, contents);
+    return;
+  }
   engine::AsyncNoSpan(async_tp, &fs::blocking::RewriteFileContents, path,
                       contents)
       .Get();
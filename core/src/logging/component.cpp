@@ -267,6 +267,29 @@ properties:
                     enum:
                       - discard
                       - block
+                deferred_formatting:
+                    type: boolean
+                    description: if `true`, the messages are formatted on the logger task processor instead of the logging coroutine
+                    defaultDescription: false
+                max_batch_size:
+                    type: integer
+                    description: if not 0, the records are written to the log file in batches of up to this many bytes, a batch is written at the end of the queue drain
+                    defaultDescription: 0
+                batch_flush_latency:
+                    type: string
+                    description: the batch is kept across the queue drains until it gets this old; the batch of an idle logger is written on the periodic flush
+                    defaultDescription: 0ms
+                compression:
+                    type: string
+                    description: "compression of the log file: `zstd` compresses the records in the logger task, a zstd frame is ended on each log reopen and every 4MiB of logs"
+                    defaultDescription: none
+                    enum:
+                      - none
+                      - zstd
+                compression_level:
+                    type: integer
+                    description: zstd compression level from 1 to 22
+                    defaultDescription: 3
                 fs-task-processor:
                     type: string
                     description: task processor for disk I/O operations for this logger
@@ -283,6 +306,17 @@ properties:
                         port:
                             type: integer
                             description: testsuite port
+                        message_queue_size:
+                            type: integer
+                            description: the size of the separate message queue of the TCP sink
+                            defaultDescription: 65536
+                        overflow_behavior:
+                            type: string
+                            description: "message handling policy while the queue of the TCP sink is full: `discard` drops messages, `block` waits until message gets into the queue"
+                            defaultDescription: discard
+                            enum:
+                              - discard
+                              - block
 )");
 }
 
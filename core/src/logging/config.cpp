@@ -18,6 +18,16 @@ QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
   return utils::ParseFromValueString(value, kMap);
 }
 
+Compression Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Compression>) {
+  static constexpr utils::TrivialBiMap kMap([](auto selector) {
+    return selector()
+        .Case(Compression::kNone, "none")
+        .Case(Compression::kZstd, "zstd");
+  });
+  return utils::ParseFromValueString(value, kMap);
+}
+
 Format Parse(const yaml_config::YamlConfig& value, formats::parse::To<Format>) {
   const auto format_str = value.As<std::string>("tskv");
   return FormatFromString(format_str);
@@ -28,6 +38,11 @@ TestsuiteCaptureConfig Parse(const yaml_config::YamlConfig& value,
   TestsuiteCaptureConfig config;
   config.host = value["host"].As<std::string>();
   config.port = value["port"].As<int>();
+  config.message_queue_size =
+      value["message_queue_size"].As<size_t>(config.message_queue_size);
+  config.queue_overflow_behavior =
+      value["overflow_behavior"].As<QueueOverflowBehavior>(
+          config.queue_overflow_behavior);
   return config;
 }
 
@@ -52,6 +67,20 @@ LoggerConfig Parse(const yaml_config::YamlConfig& value,
       value["overflow_behavior"].As<QueueOverflowBehavior>(
           config.queue_overflow_behavior);
 
+  config.deferred_formatting =
+      value["deferred_formatting"].As<bool>(config.deferred_formatting);
+
+  config.max_batch_size =
+      value["max_batch_size"].As<size_t>(config.max_batch_size);
+  config.batch_flush_latency =
+      value["batch_flush_latency"].As<std::chrono::milliseconds>(
+          config.batch_flush_latency);
+
+  config.compression =
+      value["compression"].As<Compression>(config.compression);
+  config.compression_level =
+      value["compression_level"].As<int>(config.compression_level);
+
   config.fs_task_processor =
       value["fs-task-processor"].As<std::optional<std::string>>();
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 #include <unordered_map>
 
@@ -11,21 +12,34 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 
+enum class QueueOverflowBehavior { kDiscard, kBlock };
+
+QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
+                            formats::parse::To<QueueOverflowBehavior>);
+
+enum class Compression { kNone, kZstd };
+
+Compression Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<Compression>);
+
+inline constexpr size_t kDefaultMessageQueueSize = 1 << 16;
+
 struct TestsuiteCaptureConfig final {
   std::string host;
   int port{};
+
+  // The socket sink has its own queue to not stall the other sinks
+  size_t message_queue_size = kDefaultMessageQueueSize;
+  QueueOverflowBehavior queue_overflow_behavior =
+      QueueOverflowBehavior::kDiscard;
 };
 
 TestsuiteCaptureConfig Parse(const yaml_config::YamlConfig& value,
                              formats::parse::To<TestsuiteCaptureConfig>);
 
-enum class QueueOverflowBehavior { kDiscard, kBlock };
-
-QueueOverflowBehavior Parse(const yaml_config::YamlConfig& value,
-                            formats::parse::To<QueueOverflowBehavior>);
-
 struct LoggerConfig final {
-  static constexpr size_t kDefaultMessageQueueSize = 1 << 16;
+  static constexpr size_t kDefaultMessageQueueSize =
+      logging::kDefaultMessageQueueSize;
 
   void SetName(std::string name);
 
@@ -41,6 +55,15 @@ struct LoggerConfig final {
   QueueOverflowBehavior queue_overflow_behavior =
       QueueOverflowBehavior::kDiscard;
 
+  bool deferred_formatting = false;
+
+  // 0 disables the batching of file writes
+  size_t max_batch_size = 0;
+  std::chrono::milliseconds batch_flush_latency{0};
+
+  Compression compression = Compression::kNone;
+  int compression_level = 3;
+
   std::optional<std::string> fs_task_processor;
 
   std::optional<TestsuiteCaptureConfig> testsuite_capture;
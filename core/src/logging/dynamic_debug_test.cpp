@@ -54,6 +54,34 @@ TEST_F(LoggingTest, DynamicDebugDisable) {
   EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("here")));
 }
 
+TEST_F(LoggingTest, DynamicDebugLevelChange) {
+  const std::string filename{USERVER_FILEPATH};
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+
+  const auto do_log = [](std::string_view string) {
+#line 25001
+    LOG_DEBUG() << string;
+  };
+
+  do_log("before");
+  SetDefaultLoggerLevel(logging::Level::kDebug);
+  do_log("level lowered");
+  SetDefaultLoggerLevel(logging::Level::kInfo);
+  do_log("level restored");
+
+  logging::AddDynamicDebugLog(filename, 25001);
+  do_log("enabled");
+  logging::RemoveDynamicDebugLog(filename, 25001);
+  do_log("after");
+
+  EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("before")));
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("level lowered"));
+  EXPECT_THAT(GetStreamString(),
+              testing::Not(testing::HasSubstr("level restored")));
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("enabled"));
+  EXPECT_THAT(GetStreamString(), testing::Not(testing::HasSubstr("after")));
+}
+
 TEST_F(LoggingTest, DynamicDebugAnyLine) {
   const std::string filename{USERVER_FILEPATH};
   SetDefaultLoggerLevel(logging::Level::kNone);
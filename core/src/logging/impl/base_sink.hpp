@@ -24,6 +24,10 @@ class BaseSink {
 
   virtual void Flush();
 
+  /// Called by the logger after a queue drain, the sinks that batch the
+  /// records may write them out
+  virtual void EndBatch();
+
   virtual void Reopen(ReopenMode);
 
   void SetLevel(Level log_level);
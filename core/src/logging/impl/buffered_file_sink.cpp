@@ -1,35 +1,144 @@
 #include "buffered_file_sink.hpp"
 
+#include <iostream>
+
+#include <compression/compressor.hpp>
+
 #include "open_file_helper.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
-BufferedFileSink::BufferedFileSink(const std::string& filename)
-    : filename_{filename}, file_(OpenFile<fs::blocking::CFile>(filename)) {
-  if (file_.GetSize() > 0) {
+namespace {
+
+std::unique_ptr<compression::Compressor> MakeCompressor(
+    const SinkCompressionConfig& config) {
+  if (config.zstd_level == 0) return nullptr;
+  return compression::MakeCompressor(compression::Encoding::kZstd,
+                                     config.zstd_level);
+}
+
+}  // namespace
+
+BufferedFileSink::BufferedFileSink(const std::string& filename,
+                                   SinkBatchConfig batch_config,
+                                   SinkCompressionConfig compression_config)
+    : filename_{filename},
+      file_(OpenFile<fs::blocking::CFile>(filename)),
+      batch_config_(batch_config),
+      compression_config_(compression_config),
+      compressor_(MakeCompressor(compression_config_)) {
+  // The new zstd frames are appended to the old ones as is
+  if (file_.GetSize() > 0 && !compressor_) {
     file_.Write("\n");
   }
+  batch_.reserve(batch_config_.max_size);
 }
 
 void BufferedFileSink::Reopen(ReopenMode mode) {
+  WriteBatch();
+  // The rotated file ends with a complete frame
+  EndFrame();
   file_.FlushLight();
   auto new_file = OpenFile<fs::blocking::CFile>(filename_, mode);
   std::move(file_).Close();
   file_ = std::move(new_file);
 }
 
-BufferedFileSink::~BufferedFileSink() = default;
+BufferedFileSink::~BufferedFileSink() {
+  try {
+    if (file_.IsOpen()) {
+      WriteBatch();
+      EndFrame();
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Failed to write the batch of logs to '" << filename_
+              << "': " << e.what() << '\n';
+  }
+}
+
+void BufferedFileSink::Write(std::string_view log) {
+  if (batch_config_.max_size == 0) {
+    WriteToFile(log);
+    return;
+  }
 
-void BufferedFileSink::Write(std::string_view log) { file_.Write(log); }
+  if (batch_.size() + log.size() > batch_config_.max_size) {
+    WriteBatch();
+  }
+  if (batch_.empty()) {
+    batch_start_ = std::chrono::steady_clock::now();
+  }
+  batch_.append(log);
+}
 
 void BufferedFileSink::Flush() {
   if (file_.IsOpen()) {
+    WriteBatch();
+    FlushFrame();
     file_.FlushLight();
   }
 }
 
+void BufferedFileSink::EndBatch() {
+  if (batch_.empty()) return;
+
+  if (batch_config_.flush_latency.count() == 0 ||
+      std::chrono::steady_clock::now() - batch_start_ >=
+          batch_config_.flush_latency) {
+    WriteBatch();
+  }
+}
+
+void BufferedFileSink::WriteBatch() {
+  if (batch_.empty()) return;
+  WriteToFile(batch_);
+  file_.FlushLight();
+  batch_.clear();
+}
+
+void BufferedFileSink::WriteToFile(std::string_view data) {
+  if (!compressor_) {
+    file_.Write(data);
+    return;
+  }
+
+  compressor_->Compress(data, false, compressed_);
+  frame_size_ += data.size();
+  is_frame_flushed_ = false;
+  if (frame_size_ >= compression_config_.max_frame_size) {
+    EndFrame();
+  } else {
+    WriteCompressed();
+  }
+}
+
+void BufferedFileSink::FlushFrame() {
+  if (!compressor_ || is_frame_flushed_) return;
+
+  // Makes everything written so far readable without ending the frame
+  compressor_->Compress({}, true, compressed_);
+  is_frame_flushed_ = true;
+  WriteCompressed();
+}
+
+void BufferedFileSink::EndFrame() {
+  if (!compressor_ || frame_size_ == 0) return;
+
+  compressor_->Finish(compressed_);
+  WriteCompressed();
+  compressor_ = MakeCompressor(compression_config_);
+  frame_size_ = 0;
+  is_frame_flushed_ = true;
+}
+
+void BufferedFileSink::WriteCompressed() {
+  if (compressed_.empty()) return;
+  file_.Write(compressed_);
+  compressed_.clear();
+}
+
 BufferedFileSink::BufferedFileSink(fs::blocking::CFile&& file)
     : file_(std::move(file)) {}
 
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
 #include <cstdio>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <string_view>
 
 #include <logging/impl/base_sink.hpp>
@@ -9,17 +12,44 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace compression {
+class Compressor;
+}
+
 namespace logging::impl {
 
+struct SinkBatchConfig final {
+  // The records are collected and written to the file at once until the batch
+  // reaches this size. 0 disables the batching.
+  std::size_t max_size{0};
+
+  // The batch is kept across the queue drains until it gets this old. The idle
+  // logger writes it out on the next Flush().
+  std::chrono::milliseconds flush_latency{0};
+};
+
+struct SinkCompressionConfig final {
+  // zstd compression level of the file, 0 disables the compression
+  int zstd_level{0};
+
+  // The zstd frame is ended after this many bytes of logs and on reopen, so
+  // the file may be decompressed starting from any frame
+  std::size_t max_frame_size{4 * 1024 * 1024};
+};
+
 class BufferedFileSink : public BaseSink {
  public:
-  explicit BufferedFileSink(const std::string& filename);
+  explicit BufferedFileSink(const std::string& filename,
+                            SinkBatchConfig batch_config = {},
+                            SinkCompressionConfig compression_config = {});
   ~BufferedFileSink() override;
 
   void Reopen(ReopenMode mode) override;
 
   void Flush() override;
 
+  void EndBatch() override;
+
  protected:
   explicit BufferedFileSink(fs::blocking::CFile&& file);
 
@@ -28,8 +58,23 @@ class BufferedFileSink : public BaseSink {
   fs::blocking::CFile& GetFile();
 
  private:
+  void WriteBatch();
+  void WriteToFile(std::string_view data);
+  void FlushFrame();
+  void EndFrame();
+  void WriteCompressed();
+
   std::string filename_;
   fs::blocking::CFile file_;
+  const SinkBatchConfig batch_config_;
+  std::string batch_;
+  std::chrono::steady_clock::time_point batch_start_{};
+
+  const SinkCompressionConfig compression_config_;
+  std::unique_ptr<compression::Compressor> compressor_;
+  std::string compressed_;
+  std::size_t frame_size_{0};
+  bool is_frame_flushed_{true};
 };
 
 class BufferedUnownedFileSink final : public BufferedFileSink {
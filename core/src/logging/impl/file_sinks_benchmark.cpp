@@ -38,4 +38,31 @@ void check_buffered_file_sink(benchmark::State& state) {
 }
 BENCHMARK(check_buffered_file_sink);
 
+// Writes batches of state.range(0) KiB, the logger ends a batch after every
+// state.range(1) records
+void check_batched_file_sink(benchmark::State& state) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const std::string filename =
+      temp_root.GetPath() + "/temp_file_" + std::to_string(utils::Rand());
+  auto sink = logging::impl::BufferedFileSink(
+      filename, {static_cast<std::size_t>(state.range(0)) * 1024,
+                 std::chrono::milliseconds{state.range(2)}});
+  const auto drain_size = state.range(1);
+  for ([[maybe_unused]] auto _ : state) {
+    for (auto i = 0; i < kCountLogs; ++i) {
+      sink.Log({"message\n", logging::Level::kWarning});
+      if ((i + 1) % drain_size == 0) sink.EndBatch();
+    }
+  }
+  sink.Flush();
+}
+// {max batch size KiB, records per queue drain, flush latency ms}
+BENCHMARK(check_batched_file_sink)
+    ->Args({64, 1, 0})
+    ->Args({64, 64, 0})
+    ->Args({64, 1024, 0})
+    ->Args({1024, 1024, 0})
+    ->Args({64, 1, 10})
+    ->Args({1024, 64, 10});
+
 USERVER_NAMESPACE_END
@@ -2,12 +2,15 @@
 
 #include <functional>
 
+#include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
 #include <userver/fs/blocking/temp_file.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/utest/parameter_names.hpp>
 #include <userver/utest/utest.hpp>
 
+#include <compression/zstd.hpp>
+
 #include "buffered_file_sink.hpp"
 #include "sink_helper_test.hpp"
 
@@ -30,6 +33,11 @@ SinkPtr MakeBufferedFileSink(const std::string& filename) {
   return std::make_unique<logging::impl::BufferedFileSink>(filename);
 }
 
+SinkPtr MakeBatchedFileSink(const std::string& filename) {
+  return std::make_unique<logging::impl::BufferedFileSink>(
+      filename, logging::impl::SinkBatchConfig{16, std::chrono::hours{1}});
+}
+
 class FileSinks : public testing::TestWithParam<SinkFactory> {
  protected:
   const std::string& GetTempRootPath() const { return temp_root_.GetPath(); }
@@ -188,10 +196,68 @@ UTEST_P(FileSinks, TestValidWriteMultiInFile) {
             test::Messages("message", "message 2", "message 3"));
 }
 
+UTEST(BatchedFileSink, EndBatch) {
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto filename = temp_root.GetPath() + "/temp_file";
+
+  logging::impl::BufferedFileSink sink{filename, {64, {}}};
+  sink.Log({"message\n", logging::Level::kInfo});
+  EXPECT_EQ(test::ReadFromFile(filename), test::Messages());
+
+  sink.EndBatch();
+  EXPECT_EQ(test::ReadFromFile(filename), test::Messages("message"));
+
+  logging::impl::BufferedFileSink latency_sink{filename + "_2",
+                                               {64, std::chrono::hours{1}}};
+  latency_sink.Log({"message\n", logging::Level::kInfo});
+  latency_sink.EndBatch();
+  EXPECT_EQ(test::ReadFromFile(filename + "_2"), test::Messages());
+
+  // Overflows the batch
+  latency_sink.Log({std::string(64, 'a') + '\n', logging::Level::kInfo});
+  EXPECT_EQ(test::ReadFromFile(filename + "_2"), test::Messages("message"));
+
+  latency_sink.Flush();
+  EXPECT_EQ(test::ReadFromFile(filename + "_2"),
+            test::Messages("message", std::string(64, 'a')));
+}
+
+UTEST(CompressedFileSink, Frames) {
+  if (!compression::zstd::IsSupported()) {
+    GTEST_SKIP() << "zstd support is disabled";
+  }
+
+  const auto temp_root = fs::blocking::TempDirectory::Create();
+  const auto filename = temp_root.GetPath() + "/temp_file";
+  constexpr std::size_t kMaxSize = 1024;
+
+  {
+    logging::impl::BufferedFileSink sink{filename, {}, {3, 64}};
+    sink.Log({"message\n", logging::Level::kInfo});
+    sink.Flush();
+
+    // Ends the frame
+    sink.Reopen(logging::impl::ReopenMode::kAppend);
+    EXPECT_EQ(compression::zstd::Decompress(
+                  fs::blocking::ReadFileContents(filename), kMaxSize),
+              "message\n");
+
+    // Ends the frame by size
+    sink.Log({std::string(64, 'a') + '\n', logging::Level::kInfo});
+    sink.Log({"message 2\n", logging::Level::kInfo});
+  }
+
+  EXPECT_EQ(compression::zstd::Decompress(
+                fs::blocking::ReadFileContents(filename), kMaxSize),
+            "message\n" + std::string(64, 'a') + "\nmessage 2\n");
+}
+
 INSTANTIATE_UTEST_SUITE_P(/* no prefix */, FileSinks,
                           testing::Values(SinkFactory{"FileSink", MakeFileSink},
                                           SinkFactory{"BufferedFileSink",
-                                                      MakeBufferedFileSink}),
+                                                      MakeBufferedFileSink},
+                                          SinkFactory{"BatchedFileSink",
+                                                      MakeBatchedFileSink}),
                           utest::PrintTestName());
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,56 @@
+#include <logging/impl/queued_sink.hpp>
+
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+QueuedSink::QueuedSink(SinkPtr sink, Format format, std::string name,
+                       std::size_t max_queue_size,
+                       QueueOverflowBehavior overflow_policy)
+    : queue_(format, std::move(name)),
+      sink_(*sink),
+      max_queue_size_(max_queue_size),
+      overflow_policy_(overflow_policy) {
+  UASSERT(sink);
+  // The levels are checked by the outer logger and by the wrapped sink
+  queue_.SetLevel(Level::kTrace);
+  queue_.SetFlushOn(Level::kNone);
+  queue_.AddSink(std::move(sink));
+}
+
+QueuedSink::~QueuedSink() = default;
+
+void QueuedSink::StartConsumerTask(engine::TaskProcessor& task_processor) {
+  queue_.StartConsumerTask(task_processor, max_queue_size_, overflow_policy_);
+}
+
+void QueuedSink::StopConsumerTask() { queue_.StopConsumerTask(); }
+
+void QueuedSink::Push(Level level, std::shared_ptr<const std::string> payload) {
+  queue_.LogShared(level, std::move(payload));
+}
+
+void QueuedSink::FlushQueue() { queue_.Flush(); }
+
+BaseSink& QueuedSink::GetSink() const noexcept { return sink_; }
+
+void QueuedSink::Flush() {
+  // Called from the consumer task of the outer logger that must not wait for
+  // a stuck sink
+}
+
+void QueuedSink::Write(std::string_view log) {
+  // TpLogger pushes the messages with their levels, other writers are only
+  // filtered by the level of the wrapped sink
+  const auto level = sink_.GetLevel();
+  if (level == Level::kNone) return;
+  Push(level, std::make_shared<const std::string>(log));
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <logging/config.hpp>
+#include <logging/impl/base_sink.hpp>
+#include <logging/tp_logger.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+class TaskProcessor;
+}
+
+namespace logging::impl {
+
+/// Writes into the wrapped sink from its own queue and consumer task, so that
+/// a slow or stuck sink does not stall the other sinks of a TpLogger. The
+/// messages are shared with the queue by reference counting.
+///
+/// Intended for the network sinks, the wrapped sink is never reopened.
+class QueuedSink final : public BaseSink {
+ public:
+  QueuedSink(SinkPtr sink, Format format, std::string name,
+             std::size_t max_queue_size, QueueOverflowBehavior overflow_policy);
+  ~QueuedSink() override;
+
+  void StartConsumerTask(engine::TaskProcessor& task_processor);
+  void StopConsumerTask();
+
+  /// Enqueues the formatted message without copying it
+  void Push(Level level, std::shared_ptr<const std::string> payload);
+
+  /// Waits for the enqueued messages to be written and flushed
+  void FlushQueue();
+
+  /// The sink level is checked by TpLogger before formatting the message
+  BaseSink& GetSink() const noexcept;
+
+  /// Does not wait for the queue, see FlushQueue()
+  void Flush() override;
+
+ protected:
+  void Write(std::string_view log) override;
+
+ private:
+  TpLogger queue_;
+  BaseSink& sink_;
+  const std::size_t max_queue_size_;
+  const QueueOverflowBehavior overflow_policy_;
+};
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
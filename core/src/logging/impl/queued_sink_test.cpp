@@ -0,0 +1,88 @@
+#include <logging/impl/queued_sink.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+#include <logging/logging_test.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kMessages = 10;
+constexpr std::size_t kSinkQueueSize = 4;
+
+class StuckSink final : public logging::impl::BaseSink {
+ public:
+  void Unblock() { unblocked_.Send(); }
+
+  std::size_t GetWriteCount() const { return write_count_; }
+
+ protected:
+  void Write(std::string_view) override {
+    [[maybe_unused]] const bool success = unblocked_.WaitForEvent();
+    ++write_count_;
+  }
+
+ private:
+  engine::SingleConsumerEvent unblocked_{
+      engine::SingleConsumerEvent::NoAutoReset{}};
+  std::atomic<std::size_t> write_count_{0};
+};
+
+std::size_t CountLines(const std::string& text) {
+  return std::count(text.begin(), text.end(), '\n');
+}
+
+}  // namespace
+
+UTEST(QueuedSink, StuckSinkDoesNotBlockOtherSinks) {
+  logging::impl::TpLogger logger{logging::Format::kRaw, "test-logger"};
+
+  auto stuck_sink_holder = std::make_unique<StuckSink>();
+  auto& stuck_sink = *stuck_sink_holder;
+  logger.AddSink(std::make_unique<logging::impl::QueuedSink>(
+      std::move(stuck_sink_holder), logging::Format::kRaw, "test-queue",
+      kSinkQueueSize, logging::QueueOverflowBehavior::kDiscard));
+
+  auto string_sink_holder = std::make_unique<StringSink>();
+  auto& stream = string_sink_holder->GetStream();
+  logger.AddSink(std::move(string_sink_holder));
+
+  logger.StartConsumerTask(engine::current_task::GetTaskProcessor(), 64,
+                           logging::QueueOverflowBehavior::kDiscard);
+
+  for (std::size_t i = 0; i < kMessages; ++i) {
+    logger.Log(logging::Level::kInfo, "message\n");
+  }
+  while (CountLines(stream.str()) < kMessages) {
+    engine::Yield();
+  }
+
+  stuck_sink.Unblock();
+  logger.Flush();
+  EXPECT_GE(stuck_sink.GetWriteCount(), 1);
+  EXPECT_LE(stuck_sink.GetWriteCount(), kSinkQueueSize + 1);
+
+  logger.StopConsumerTask();
+}
+
+UTEST(QueuedSink, SyncMode) {
+  logging::impl::TpLogger logger{logging::Format::kRaw, "test-logger"};
+
+  auto string_sink_holder = std::make_unique<StringSink>();
+  auto& stream = string_sink_holder->GetStream();
+  logger.AddSink(std::make_unique<logging::impl::QueuedSink>(
+      std::move(string_sink_holder), logging::Format::kRaw, "test-queue",
+      kSinkQueueSize, logging::QueueOverflowBehavior::kDiscard));
+
+  logger.Log(logging::Level::kInfo, "message\n");
+  logger.Flush();
+  EXPECT_EQ(stream.str(), "message\n");
+}
+
+USERVER_NAMESPACE_END
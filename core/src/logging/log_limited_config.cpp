@@ -0,0 +1,47 @@
+#include <logging/log_limited_config.hpp>
+
+#include <cstdint>
+
+#include <userver/formats/common/items.hpp>
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+namespace {
+
+LogLimitedBucketConfig ParseBucket(const formats::json::Value& value,
+                                   const LogLimitedBucketConfig& defaults) {
+  LogLimitedBucketConfig ret;
+  ret.burst = value["burst"].As<std::size_t>(defaults.burst);
+  ret.rate_per_second =
+      value["rate-per-second"].As<std::size_t>(defaults.rate_per_second);
+  return ret;
+}
+
+}  // namespace
+
+LogLimitedConfig Parse(const formats::json::Value& value,
+                       formats::parse::To<LogLimitedConfig>) {
+  const LogLimitedConfig defaults;
+
+  LogLimitedConfig ret;
+  ret.enabled = value["enabled"].As<bool>(defaults.enabled);
+  ret.defaults = ParseBucket(value, defaults.defaults);
+  const auto loggers = value["loggers"];
+  if (!loggers.IsMissing()) {
+    for (const auto& [name, logger] : Items(loggers)) {
+      ret.loggers.emplace(name, ParseBucket(logger, ret.defaults));
+    }
+  }
+  ret.summary_interval =
+      std::chrono::milliseconds{value["summary-interval-ms"].As<std::int64_t>(
+          defaults.summary_interval.count())};
+
+  return ret;
+}
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
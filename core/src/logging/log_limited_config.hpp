@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include <userver/formats/parse/to.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace logging {
+
+struct LogLimitedBucketConfig {
+  std::size_t burst{100};
+  std::size_t rate_per_second{10};
+};
+
+struct LogLimitedConfig {
+  bool enabled{false};
+  LogLimitedBucketConfig defaults;
+  std::unordered_map<std::string, LogLimitedBucketConfig> loggers;
+  std::chrono::milliseconds summary_interval{10000};
+};
+
+LogLimitedConfig Parse(const formats::json::Value& value,
+                       formats::parse::To<LogLimitedConfig>);
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
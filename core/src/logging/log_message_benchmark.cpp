@@ -7,6 +7,7 @@
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
 
+#include <logging/log_record.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -38,6 +39,20 @@ class PrependedTagLogger final : public NoopLogger {
   }
 };
 
+class TskvNoopLogger final : public logging::impl::LoggerBase {
+ public:
+  explicit TskvNoopLogger(bool deferred_formatting) noexcept
+      : LoggerBase(logging::Format::kTskv) {
+    SetLevel(logging::Level::kInfo);
+    SetDeferredFormatting(deferred_formatting);
+  }
+  void Log(logging::Level, std::string_view) override {}
+  // TpLogger formats the record on its own task processor
+  void LogRecord(logging::Level, std::chrono::system_clock::time_point,
+                 std::string_view) override {}
+  void Flush() override {}
+};
+
 class LogHelperBenchmark : public benchmark::Fixture {
   void SetUp(const benchmark::State&) override {
     guard_.emplace(std::make_shared<NoopLogger>());
@@ -162,6 +177,44 @@ void LogPrependedTags(benchmark::State& state) {
 }
 BENCHMARK(LogPrependedTags);
 
+void LogStringTskv(benchmark::State& state) {
+  const logging::DefaultLoggerGuard guard{
+      std::make_shared<TskvNoopLogger>(state.range(1) != 0)};
+  const auto msg = Launder(std::string(state.range(0), '*') + "\t\n");
+
+  for ([[maybe_unused]] auto _ : state) {
+    LOG_INFO() << msg;
+  }
+}
+// The second argument enables the deferred formatting
+BENCHMARK(LogStringTskv)->Ranges({{8, 8 << 10}, {0, 1}});
+
+void LogDisabledLevel(benchmark::State& state) {
+  const logging::DefaultLoggerGuard guard{std::make_shared<NoopLogger>()};
+
+  for ([[maybe_unused]] auto _ : state) {
+    LOG_DEBUG() << "";
+  }
+}
+BENCHMARK(LogDisabledLevel);
+
+void LogMessageBegin(benchmark::State& state) {
+  const auto format = static_cast<logging::Format>(state.range(0));
+  auto time = std::chrono::system_clock::now();
+  logging::LogBuffer buffer;
+
+  for ([[maybe_unused]] auto _ : state) {
+    buffer.clear();
+    logging::impl::PutMessageBegin(buffer, format, logging::Level::kInfo, time);
+    benchmark::DoNotOptimize(buffer.data());
+    // A new second every 100'000 messages
+    time += std::chrono::microseconds{10};
+  }
+}
+BENCHMARK(LogMessageBegin)
+    ->Arg(static_cast<int>(logging::Format::kTskv))
+    ->Arg(static_cast<int>(logging::Format::kLtsv));
+
 }  // namespace
 
 USERVER_NAMESPACE_END
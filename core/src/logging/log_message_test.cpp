@@ -16,6 +16,7 @@
 #include <userver/decimal64/decimal64.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/utils/mock_now.hpp>
 #include <userver/utils/regex.hpp>
 #include <userver/utils/traceful_exception.hpp>
 #include <utils/encoding/tskv_testdata_bin.hpp>
@@ -60,6 +61,14 @@ int CountLimitedLoggedTimes() {
   return cs.logged_count;
 }
 
+int CountTokenBucketLoggedTimes(int log_attempts) {
+  CountingStruct cs;
+  for (int i = 0; i < log_attempts; ++i) {
+    LOG_LIMITED_CRITICAL() << cs;
+  }
+  return cs.logged_count;
+}
+
 }  // namespace
 
 TEST_F(LoggingTest, TskvEncode) {
@@ -481,6 +490,25 @@ TEST_F(LoggingTest, LogLimitedDisabled) {
   logging::impl::SetLogLimitedEnable(true);
 }
 
+TEST_F(LoggingTest, LogLimitedTokenBucket) {
+  utils::datetime::MockNowSet(std::chrono::system_clock::now());
+  logging::impl::SetLogLimitedBuckets(logging::impl::LogLimitedBuckets{
+      {3, {1, std::chrono::seconds{1}}}, {}});
+
+  EXPECT_EQ(CountTokenBucketLoggedTimes(10), 3);
+  utils::datetime::MockSleep(std::chrono::seconds{2});
+  EXPECT_EQ(CountTokenBucketLoggedTimes(10), 2);
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr("[7 logs dropped]"));
+
+  ClearLog();
+  logging::impl::LogDroppedSummary();
+  logging::LogFlush();
+  EXPECT_THAT(GetStreamString(), testing::HasSubstr(" dropped 8 logs"));
+
+  logging::impl::SetLogLimitedBuckets(std::nullopt);
+  utils::datetime::MockNowUnset();
+}
+
 TEST_F(LoggingTest, CustomLoggerLevel) {
   const auto logger_data =
       MakeNamedStreamLogger("other-logger", logging::Format::kTskv);
@@ -3,6 +3,8 @@
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
+#include <logging/impl/queued_sink.hpp>
+#include <logging/log_record.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
@@ -73,6 +75,10 @@ void TpLogger::StartConsumerTask(engine::TaskProcessor& task_processor,
     queue_consumer_ = {};
   });
 
+  for (auto* const queued_sink : queued_sinks_) {
+    queued_sink->StartConsumerTask(task_processor);
+  }
+
   consuming_task_ = engine::CriticalAsyncNoSpan(
       task_processor,
       [this, guard = std::move(exit_async_guard)] { ProcessingLoop(); });
@@ -98,6 +104,11 @@ void TpLogger::StopConsumerTask() {
   const engine::TaskCancellationBlocker block_cancel;
   consuming_task_.Wait();
   consuming_task_ = {};
+
+  // The consumer task has already pushed everything into the sink queues
+  for (auto* const queued_sink : queued_sinks_) {
+    queued_sink->StopConsumerTask();
+  }
 }
 
 void TpLogger::Flush() {
@@ -121,11 +132,40 @@ void TpLogger::Flush() {
 
     future.get();
   }
+
+  // The consumer task does not wait for the sinks with their own queues
+  for (auto* const queued_sink : queued_sinks_) {
+    queued_sink->FlushQueue();
+  }
 }
 
 statistics::LogStatistics& TpLogger::GetStatistics() noexcept { return stats_; }
 
 void TpLogger::Log(Level level, std::string_view msg) {
+  PushLog(level, [&] {
+    return impl::async::Log{level, std::string{msg}};
+  });
+}
+
+void TpLogger::LogRecord(Level level,
+                         std::chrono::system_clock::time_point time,
+                         std::string_view record) {
+  PushLog(level, [&] {
+    return impl::async::Log{level, std::string{record}, time, true};
+  });
+}
+
+void TpLogger::LogShared(Level level,
+                         std::shared_ptr<const std::string> payload) {
+  PushLog(level, [&] {
+    impl::async::Log log{level};
+    log.shared_payload = std::move(payload);
+    return log;
+  });
+}
+
+template <typename MakeLog>
+void TpLogger::PushLog(Level level, MakeLog make_log) {
   ++stats_.by_level[static_cast<std::size_t>(level)];
 
   if (GetSinks().empty()) {
@@ -139,7 +179,7 @@ void TpLogger::Log(Level level, std::string_view msg) {
     produced_->fetch_add(1);
 
     try {
-      Push(impl::async::Log{level, std::string{msg}});
+      Push(make_log());
     } catch (const std::exception&) {
       // failed to construct a Log action or a node in Push
       produced_->fetch_sub(1);
@@ -175,6 +215,13 @@ bool TpLogger::DoShouldLog(Level level) const noexcept {
 
 void TpLogger::AddSink(impl::SinkPtr&& sink) {
   UASSERT(sink);
+  UASSERT_MSG(state_ == State::kSync,
+              "Sinks should be added before starting the consumer task");
+  if (auto* const queued_sink = dynamic_cast<QueuedSink*>(sink.get())) {
+    queued_sinks_.push_back(queued_sink);
+  } else {
+    direct_sinks_.push_back(sink.get());
+  }
   sinks_.push_back(std::move(sink));
 }
 
@@ -289,19 +336,35 @@ void TpLogger::ConsumeQueueOnce(Queue::Consumer& consumer) noexcept {
   while (auto* const node_base = consumer.TryPop()) {
     ConsumeNode(*node_base);
   }
+  // The sinks may write out the records of the whole drain at once
+  BackendEndBatch();
 }
 
 void TpLogger::CleanUpQueue(Queue::Consumer&& consumer) noexcept {
-  std::move(consumer).ConsumeAndStop(
-      [this](auto& node) noexcept { ConsumeNode(node); });
+  // Another thread may become the consumer right after the stop, so the
+  // batches are ended while we are still the consumer.
+  std::move(consumer).ConsumeAndStop([this](auto& node) noexcept {
+    ConsumeNode(node);
+    BackendEndBatch();
+  });
 }
 
 void TpLogger::BackendLog(impl::async::Log&& action) const {
   LogMessage message;
-  message.payload = action.payload;
   message.level = action.level;
 
-  for (const auto& sink : GetSinks()) {
+  LogBuffer formatted;
+  if (action.is_record) {
+    FormatLogRecord(formatted, GetFormat(), action.level, action.time,
+                    action.payload);
+    message.payload = std::string_view{formatted.data(), formatted.size()};
+  } else if (action.shared_payload) {
+    message.payload = *action.shared_payload;
+  } else {
+    message.payload = action.payload;
+  }
+
+  for (auto* const sink : direct_sinks_) {
     try {
       sink->Log(message);
     } catch (const std::exception& e) {
@@ -310,6 +373,21 @@ void TpLogger::BackendLog(impl::async::Log&& action) const {
     }
   }
 
+  // A single copy of the message is shared by the queues of the sinks
+  std::shared_ptr<const std::string> shared_payload = action.shared_payload;
+  for (auto* const queued_sink : queued_sinks_) {
+    if (!queued_sink->GetSink().ShouldLog(message.level)) continue;
+    try {
+      if (!shared_payload) {
+        shared_payload = std::make_shared<const std::string>(message.payload);
+      }
+      queued_sink->Push(message.level, shared_payload);
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, "While writing a log message caught an exception: " +
+                             std::string(e.what()));
+    }
+  }
+
   if (ShouldFlush(message.level)) {
     BackendFlush();
   }
@@ -326,6 +404,17 @@ void TpLogger::BackendFlush() const {
   }
 }
 
+void TpLogger::BackendEndBatch() const noexcept {
+  for (const auto& sink : GetSinks()) {
+    try {
+      sink->EndBatch();
+    } catch (const std::exception& e) {
+      UASSERT_MSG(false, "While writing a batch of logs caught an exception: " +
+                             std::string(e.what()));
+    }
+  }
+}
+
 void TpLogger::BackendReopen(ReopenMode reopen_mode) const {
   std::string result_messages{};
   for (const auto& [index, sink] : utils::enumerate(GetSinks())) {
@@ -30,12 +30,18 @@ namespace logging::impl {
 
 using SinkPtr = std::unique_ptr<BaseSink>;
 
+class QueuedSink;
+
 namespace async {
 
 struct Log {
   Level level{};
   std::string payload{};
   std::chrono::system_clock::time_point time{std::chrono::system_clock::now()};
+  // The payload is a binary record that is formatted by the consumer task
+  bool is_record{false};
+  // Formatted message shared by the queues of several sinks, replaces payload
+  std::shared_ptr<const std::string> shared_payload{};
 };
 
 struct FlushCoro {
@@ -74,6 +80,9 @@ class TpLogger final : public LoggerBase {
   void StopConsumerTask();
 
   void Log(Level level, std::string_view msg) override;
+  void LogRecord(Level level, std::chrono::system_clock::time_point time,
+                 std::string_view record) override;
+  void LogShared(Level level, std::shared_ptr<const std::string> payload);
   void Flush() override;
   void PrependCommonTags(TagWriter writer) const override;
 
@@ -100,6 +109,8 @@ class TpLogger final : public LoggerBase {
   using Queue = engine::impl::AsyncFlatCombiningQueue;
   using QueueSize = std::int64_t;
 
+  template <typename MakeLog>
+  void PushLog(Level level, MakeLog make_log);
   void ProcessingLoop();
   bool HasFreeQueueCapacity() noexcept;
   bool TryWaitFreeQueueCapacity();
@@ -112,10 +123,15 @@ class TpLogger final : public LoggerBase {
   void BackendPerform(impl::async::Action&& action) noexcept;
   void BackendLog(impl::async::Log&& action) const;
   void BackendFlush() const;
+  void BackendEndBatch() const noexcept;
   void BackendReopen(ReopenMode reopen_mode) const;
 
   const std::string logger_name_;
   std::vector<impl::SinkPtr> sinks_;
+  // Non-owning views of sinks_: the sinks written by the consumer task and
+  // the sinks with their own queues
+  std::vector<BaseSink*> direct_sinks_;
+  std::vector<QueuedSink*> queued_sinks_;
   mutable statistics::LogStatistics stats_{};
 
   engine::Mutex capacity_waiters_mutex_;
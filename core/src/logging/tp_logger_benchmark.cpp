@@ -1,6 +1,7 @@
 #include <logging/tp_logger.hpp>
 
 #include <benchmark/benchmark.h>
+#include <fmt/format.h>
 
 #include <logging/impl/null_sink.hpp>
 #include <userver/engine/run_standalone.hpp>
@@ -34,6 +35,8 @@ class TpLoggerBenchmark : public benchmark::Fixture {
 
   void TearDown(const benchmark::State&) override { guard_.reset(); }
 
+  void EnableDeferredFormatting() { tp_logger_->SetDeferredFormatting(true); }
+
   auto StartAsyncLoggerScope() {
     tp_logger_->StartConsumerTask(engine::current_task::GetTaskProcessor(),
                                   1 << 30,
@@ -65,6 +68,39 @@ BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogString)
     ->Range(8, 8 << 10)
     ->Complexity();
 
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogStringDeferred)
+(benchmark::State& state) {
+  EnableDeferredFormatting();
+  engine::RunStandalone(2, [&] {
+    auto scope = StartAsyncLoggerScope();
+    const auto msg = Launder(std::string(state.range(0), '*'));
+    for ([[maybe_unused]] auto _ : state) {
+      LOG_INFO() << msg;
+    }
+    state.SetComplexityN(state.range(0));
+  });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogStringDeferred)
+    ->RangeMultiplier(2)
+    ->Range(8, 8 << 10)
+    ->Complexity();
+
+BENCHMARK_DEFINE_F(TpLoggerBenchmark, LogInsideSpan)
+(benchmark::State& state) {
+  engine::RunStandalone(2, [&] {
+    auto scope = StartAsyncLoggerScope();
+    tracing::Span span("span");
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      span.AddTag(fmt::format("some_long_tag_key_{}", i),
+                  std::string(64, '*'));
+    }
+    for ([[maybe_unused]] auto _ : state) {
+      LOG_INFO() << "message";
+    }
+  });
+}
+BENCHMARK_REGISTER_F(TpLoggerBenchmark, LogInsideSpan)->Arg(0)->Arg(4)->Arg(16);
+
 namespace {
 
 __attribute__((noinline)) void LogDebug() { LOG_DEBUG() << 42; }
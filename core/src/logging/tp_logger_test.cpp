@@ -324,6 +324,29 @@ UTEST_F(LoggingTestCoro, TpLoggerBasicAsync) {
   EXPECT_EQ(GetMetric("by_level", {"level", "trace"}), 0);
 }
 
+UTEST(TpLogger, DeferredFormatting) {
+  for (const auto format : {logging::Format::kTskv, logging::Format::kLtsv}) {
+    auto direct = MakeNamedStreamLogger("direct", format);
+    auto deferred = MakeNamedStreamLogger("deferred", format);
+    deferred.logger->SetDeferredFormatting(true);
+
+    for (const auto& logger : {direct.logger, deferred.logger}) {
+      LOG_INFO_TO(logger) << "text\twith\nescaping\\"
+                          << logging::LogExtra{{"key.with.dots", "a\tb"},
+                                               {"number", 42}};
+    }
+
+    // The timestamps differ
+    const auto direct_log = direct.stream.str();
+    const auto deferred_log = deferred.stream.str();
+    const std::string_view level_key =
+        format == logging::Format::kLtsv ? "\tlevel:" : "\tlevel=";
+    ASSERT_NE(direct_log.find(level_key), std::string::npos);
+    EXPECT_EQ(direct_log.substr(direct_log.find(level_key)),
+              deferred_log.substr(deferred_log.find(level_key)));
+  }
+}
+
 UTEST_F(LoggingTestCoro, TpLoggerBasicAsyncMetrics) {
   auto logger = StartAsyncLogger();
 
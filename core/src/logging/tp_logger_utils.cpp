@@ -9,6 +9,7 @@
 #include <boost/range/algorithm/find_if.hpp>
 
 #include <logging/impl/buffered_file_sink.hpp>
+#include <logging/impl/queued_sink.hpp>
 #include <logging/impl/tcp_socket_sink.hpp>
 #include <logging/impl/unix_socket_sink.hpp>
 #include <userver/logging/format.hpp>
@@ -38,13 +39,21 @@ void CreateLogDirectory(const std::string& logger_name,
   }
 }
 
-SinkPtr GetSinkFromFilename(const std::string& file_path) {
+SinkPtr GetSinkFromFilename(const LoggerConfig& config) {
+  const auto& file_path = config.file_path;
   if (utils::text::StartsWith(file_path, kUnixSocketPrefix)) {
     // Use Unix-socket sink
     return std::make_unique<UnixSocketSink>(
         file_path.substr(kUnixSocketPrefix.size()));
   } else {
-    return std::make_unique<BufferedFileSink>(file_path);
+    SinkCompressionConfig compression_config;
+    if (config.compression == Compression::kZstd) {
+      compression_config.zstd_level = config.compression_level;
+    }
+    return std::make_unique<BufferedFileSink>(
+        file_path,
+        SinkBatchConfig{config.max_batch_size, config.batch_flush_latency},
+        compression_config);
   }
 }
 
@@ -57,7 +66,7 @@ SinkPtr MakeOptionalSink(const LoggerConfig& config) {
     return std::make_unique<logging::impl::BufferedUnownedFileSink>(stdout);
   } else {
     CreateLogDirectory(config.logger_name, config.file_path);
-    return GetSinkFromFilename(config.file_path);
+    return GetSinkFromFilename(config);
   }
 }
 
@@ -73,6 +82,7 @@ std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
   auto logger = std::make_shared<TpLogger>(config.format, config.logger_name);
   logger->SetLevel(config.level);
   logger->SetFlushOn(config.flush_level);
+  logger->SetDeferredFormatting(config.deferred_formatting);
 
   if (auto basic_sink = MakeOptionalSink(config)) {
     logger->AddSink(std::move(basic_sink));
@@ -80,10 +90,13 @@ std::shared_ptr<TpLogger> MakeTpLogger(const LoggerConfig& config) {
 
   if (config.testsuite_capture) {
     auto socket_sink_holder = MakeTestsuiteSink(*config.testsuite_capture);
-    auto* const socket_sink = socket_sink_holder.get();
-    logger->AddSink(std::move(socket_sink_holder));
     // Overwriting the level of TpLogger.
-    socket_sink->SetLevel(logging::Level::kNone);
+    socket_sink_holder->SetLevel(logging::Level::kNone);
+    logger->AddSink(std::make_unique<QueuedSink>(
+        std::move(socket_sink_holder), config.format,
+        config.logger_name + "-testsuite-capture",
+        config.testsuite_capture->message_queue_size,
+        config.testsuite_capture->queue_overflow_behavior));
   }
 
   return logger;
@@ -106,8 +119,11 @@ std::shared_ptr<TpLogger> GetDefaultLoggerOrMakeTpLogger(
 
 TcpSocketSink* GetTcpSocketSink(TpLogger& logger) {
   for (const auto& sink_ptr : logger.GetSinks()) {
-    if (auto* const tcp_socket_sink =
-            dynamic_cast<TcpSocketSink*>(sink_ptr.get())) {
+    auto* sink = sink_ptr.get();
+    if (auto* const queued_sink = dynamic_cast<QueuedSink*>(sink)) {
+      sink = &queued_sink->GetSink();
+    }
+    if (auto* const tcp_socket_sink = dynamic_cast<TcpSocketSink*>(sink)) {
       return tcp_socket_sink;
     }
   }
@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <queue>
 #include <vector>
@@ -117,6 +118,53 @@ BENCHMARK(rcu_contention)
     ->Ranges({{1, 16}, {0, 1}, {1, 4}})
     ->Ranges({{2048, 2048}, {0, 1}, {1, 4}});
 
+// Readers in all the threads, a writer updates the value periodically.
+template <rcu::DestructionType DestructionType>
+void rcu_read_contention(benchmark::State& state) {
+  const std::size_t readers_count = state.range(0);
+
+  engine::RunStandalone(readers_count, [&] {
+    std::atomic<bool> run{true};
+    rcu::Variable<std::vector<std::uint64_t>> var{
+        DestructionType, std::vector<std::uint64_t>(1024, 42)};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(readers_count);
+
+    for (std::size_t i = 0; i < readers_count - 1; i++) {
+      tasks.push_back(utils::Async("reader", [&] {
+        while (run) {
+          auto reader = var.Read();
+          benchmark::DoNotOptimize(reader->front());
+        }
+      }));
+    }
+
+    tasks.push_back(utils::Async("writer", [&] {
+      while (run) {
+        var.Assign(std::vector<std::uint64_t>(1024, 42));
+        engine::SleepFor(std::chrono::milliseconds{1});
+      }
+    }));
+
+    for ([[maybe_unused]] auto _ : state) {
+      auto reader = var.Read();
+      benchmark::DoNotOptimize(reader->front());
+    }
+
+    run = false;
+    for (auto& task : tasks) {
+      task.Get();
+    }
+  });
+}
+BENCHMARK_TEMPLATE(rcu_read_contention, rcu::DestructionType::kAsync)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_TEMPLATE(rcu_read_contention, rcu::DestructionType::kEpoch)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
 void rcu_of_shared_ptr(benchmark::State& state) {
   const std::size_t readers_count = state.range(0);
 
@@ -2,7 +2,9 @@
 
 #include <atomic>
 #include <future>
+#include <optional>
 #include <thread>
+#include <vector>
 
 #include <engine/task/task_context.hpp>
 #include <userver/engine/sleep.hpp>
@@ -535,6 +537,64 @@ UTEST(Rcu, SyncDestruction) {
   EXPECT_TRUE(destroyed[2]);
 }
 
+UTEST(Rcu, EpochDestruction) {
+  std::atomic<bool> destroyed[2]{false, false};
+  {
+    rcu::Variable<DestructionTracker> var{rcu::DestructionType::kEpoch,
+                                          destroyed[0]};
+    std::optional<rcu::ReadablePtr<DestructionTracker>> reader{var.Read()};
+
+    var.Emplace(destroyed[1]);
+    var.Cleanup();
+    engine::Yield();
+    engine::Yield();
+    EXPECT_FALSE(destroyed[0]);
+
+    const auto reader_copy = *reader;
+    reader.reset();
+    var.Cleanup();
+    engine::Yield();
+    engine::Yield();
+    EXPECT_TRUE(destroyed[0]);
+    EXPECT_FALSE(destroyed[1]);
+  }
+
+  EXPECT_TRUE(destroyed[1]);
+}
+
+UTEST_MT(Rcu, EpochConcurrentReads, 4) {
+  constexpr int kReaders = 3;
+  constexpr int kIterations = 1000;
+
+  rcu::Variable<std::vector<int>> var{rcu::DestructionType::kEpoch,
+                                      std::vector<int>(100, 0)};
+  std::atomic<bool> keep_running{true};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kReaders);
+  for (int i = 0; i < kReaders; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&] {
+      while (keep_running) {
+        const auto reader = var.Read();
+        const auto copy = reader;
+        ASSERT_EQ(reader->size(), 100);
+        EXPECT_EQ(reader->front(), reader->back());
+        EXPECT_LE(reader->front(), copy->front());
+      }
+    }));
+  }
+
+  for (int i = 1; i <= kIterations; ++i) {
+    var.Assign(std::vector<int>(100, i));
+    if (i % 10 == 0) engine::Yield();
+  }
+
+  keep_running = false;
+  for (auto& task : tasks) {
+    task.Get();
+  }
+}
+
 UTEST_MT(Rcu, Core, 3) {
   const auto deadline =
       engine::Deadline::FromDuration(std::chrono::milliseconds{100});
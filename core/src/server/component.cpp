@@ -134,6 +134,28 @@ properties:
                     private-key-passphrase-name:
                         type: string
                         description: passphrase name located in secdist
+                    kernel-offload:
+                        type: boolean
+                        description: |
+                            offload the TLS record encryption to the kernel
+                            (kTLS) after the handshake where supported
+                        defaultDescription: false
+                    handshake-task-processor:
+                        type: string
+                        description: |
+                            task processor to run the TLS handshakes on,
+                            the listener task processor if not set
+                    max-concurrent-handshakes:
+                        type: integer
+                        description: |
+                            max count of the TLS handshakes in progress,
+                            0 for unlimited
+                        defaultDescription: 0
+                    session-ticket-keys-name:
+                        type: string
+                        description: |
+                            name of the TLS session ticket keys located in
+                            secdist
             handler-defaults:
                 type: object
                 description: handler defaults options
@@ -151,6 +173,10 @@ properties:
                     parse_args_from_body:
                         type: boolean
                         description: optional field to parse request according to x-www-form-urlencoded rules and make parameters accessible as query parameters
+                    zero_copy_body:
+                        type: boolean
+                        description: keep a big request body in the connection buffer, see server::http::HttpRequest::RequestBodyView()
+                        defaultDescription: false
                     set_tracing_headers:
                         type: boolean
                         description: whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId)
@@ -174,19 +200,71 @@ properties:
                 properties:
                     in_buffer_size:
                         type: integer
-                        description: "size of the buffer to preallocate for request receive: bigger values use more RAM and less CPU"
+                        description: "max size of the buffer for request receive: bigger values use more RAM and less CPU"
                         defaultDescription: 32 * 1024
+                    in_buffer_min_size:
+                        type: integer
+                        description: "initial size of the buffer for request receive, it doubles up to in_buffer_size when a read fills it and shrinks back after a series of small reads"
+                        defaultDescription: 4 * 1024
+                        minimum: 1
+                    in_buffer_pool_size:
+                        type: integer
+                        description: max size of the idle receive buffers that the listener keeps for reuse, the buffers of the idle connections are returned to the pool
+                        defaultDescription: 16 * 1024 * 1024
                     requests_queue_size_threshold:
                         type: integer
                         description: drop requests from handlers that allow throttling if there's more pending requests than allowed by this value
                         defaultDescription: 100
+                    max_pipelined_responses_size:
+                        type: integer
+                        description: stop reading pipelined requests of a connection while the ready responses that wait for the previous ones to be sent are larger than this value
+                        defaultDescription: 16 * 1024 * 1024
                     keepalive_timeout:
                         type: integer
                         description: timeout in seconds to drop connection if there's not data received from it
                         defaultDescription: 600
+                    http_version:
+                        type: string
+                        description: "'2' to serve HTTP/2 (ALPN h2 on TLS listeners, h2c with prior knowledge otherwise) along with HTTP/1.1"
+                        defaultDescription: '1.1'
+                        enum:
+                          - '1.1'
+                          - '2'
+                    http2_session:
+                        type: object
+                        description: HTTP/2 session settings
+                        additionalProperties: false
+                        properties:
+                            max_concurrent_streams:
+                                type: integer
+                                description: max number of concurrent streams (requests) of a connection
+                                defaultDescription: 100
+                                minimum: 1
+                            initial_window_size:
+                                type: integer
+                                description: initial flow-control window size of a stream in bytes
+                                defaultDescription: 65535
+                                minimum: 1
+                                maximum: 2147483647
+                            max_frame_size:
+                                type: integer
+                                description: max size of a received frame payload in bytes
+                                defaultDescription: 16384
+                                minimum: 16384
+                                maximum: 16777215
             shards:
                 type: integer
-                description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+                description: how many listening sockets bound with SO_REUSEPORT accept the connections concurrently, one task per socket; do not set if not sure what it is doing
+                defaultDescription: <count of the ev threads of the task processor>
+                minimum: 1
+            reuseport-cpu-steering:
+                type: boolean
+                description: make the kernel pass each new connection to the shard number `CPU % shards`, where CPU is the one that handled the connection packets; Linux only, ignored for unix-socket
+                defaultDescription: false
+            accept-throttling-queue-wait:
+                type: string
+                description: pause accepting the new connections while the queue wait time of the task processor is bigger than this value, e.g. '20ms'; the connections wait in the backlog meanwhile. 0 disables the throttling
+                defaultDescription: 0
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
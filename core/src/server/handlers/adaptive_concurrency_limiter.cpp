@@ -0,0 +1,140 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+constexpr std::chrono::milliseconds kWindow{100};
+constexpr std::uint64_t kMinWindowSamples = 10;
+constexpr double kDecreaseFactor = 0.9;
+// Share of the difference between the current latency and the baseline one
+// that is added to the baseline each window, so that the baseline follows
+// a persistent change of the latency
+constexpr double kBaselineDrift = 0.01;
+// Latency growth that is never considered queueing, protects the handlers
+// with microsecond latencies from reacting on noise
+constexpr double kMinQueueingLatencyUs = 1000;
+
+void UpdateMax(std::atomic<std::size_t>& max, std::size_t value) noexcept {
+  auto current = max.load(std::memory_order_relaxed);
+  while (current < value &&
+         !max.compare_exchange_weak(current, value,
+                                    std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace
+
+AdaptiveConcurrencyLimiter::Token::Token(AdaptiveConcurrencyLimiter& limiter,
+                                         Clock::time_point start)
+    : limiter_(&limiter), start_(start) {}
+
+AdaptiveConcurrencyLimiter::Token::Token(Token&& other) noexcept
+    : limiter_(std::exchange(other.limiter_, nullptr)), start_(other.start_) {}
+
+AdaptiveConcurrencyLimiter::Token::~Token() {
+  if (!limiter_) return;
+  limiter_->in_flight_.fetch_sub(1, std::memory_order_relaxed);
+  const auto now = Clock::now();
+  limiter_->AccountLatency(
+      std::chrono::duration_cast<std::chrono::microseconds>(now - start_),
+      now);
+}
+
+AdaptiveConcurrencyLimiter::AdaptiveConcurrencyLimiter(
+    const AdaptiveConcurrencyConfig& config)
+    : config_(config),
+      limit_(config.initial_limit),
+      window_start_(Clock::now().time_since_epoch().count()) {}
+
+std::optional<AdaptiveConcurrencyLimiter::Token>
+AdaptiveConcurrencyLimiter::TryAcquire() {
+  const auto in_flight = in_flight_.fetch_add(1, std::memory_order_relaxed) + 1;
+  UpdateMax(window_max_in_flight_, in_flight);
+
+  if (in_flight > limit_.load(std::memory_order_relaxed)) {
+    ++over_limit_;
+    if (!config_.observe_only) {
+      in_flight_.fetch_sub(1, std::memory_order_relaxed);
+      ++rejected_;
+      return std::nullopt;
+    }
+  }
+  return Token{*this, Clock::now()};
+}
+
+std::size_t AdaptiveConcurrencyLimiter::GetLimit() const noexcept {
+  return limit_.load(std::memory_order_relaxed);
+}
+
+void AdaptiveConcurrencyLimiter::AccountLatency(
+    std::chrono::microseconds latency, Clock::time_point now) {
+  window_latency_sum_us_.fetch_add(latency.count(), std::memory_order_relaxed);
+  const auto samples =
+      window_samples_.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  const Clock::time_point window_start{
+      Clock::duration{window_start_.load(std::memory_order_relaxed)}};
+  if (now - window_start < kWindow || samples < kMinWindowSamples) return;
+
+  // A single request updates the limit, the others do not wait for it
+  if (is_updating_.exchange(true, std::memory_order_acquire)) return;
+  UpdateLimit(now);
+  is_updating_.store(false, std::memory_order_release);
+}
+
+void AdaptiveConcurrencyLimiter::UpdateLimit(Clock::time_point now) {
+  const auto samples = window_samples_.exchange(0, std::memory_order_relaxed);
+  const auto latency_sum_us =
+      window_latency_sum_us_.exchange(0, std::memory_order_relaxed);
+  const auto max_in_flight = window_max_in_flight_.exchange(
+      in_flight_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  window_start_.store(now.time_since_epoch().count(),
+                      std::memory_order_relaxed);
+  if (samples == 0) return;
+
+  const auto latency_us = static_cast<double>(latency_sum_us) / samples;
+  auto baseline_us = static_cast<double>(
+      baseline_latency_us_.load(std::memory_order_relaxed));
+  if (baseline_us <= 0 || latency_us < baseline_us) {
+    baseline_us = latency_us;
+  } else {
+    baseline_us += (latency_us - baseline_us) * kBaselineDrift;
+  }
+  baseline_latency_us_.store(static_cast<std::int64_t>(baseline_us),
+                             std::memory_order_relaxed);
+
+  auto limit = limit_.load(std::memory_order_relaxed);
+  const auto queueing_latency_us =
+      std::max(config_.latency_tolerance * baseline_us,
+               baseline_us + kMinQueueingLatencyUs);
+  if (latency_us > queueing_latency_us) {
+    limit = static_cast<std::size_t>(limit * kDecreaseFactor);
+  } else if (max_in_flight >= limit) {
+    // Only grow the limit that is actually reached
+    ++limit;
+  }
+  limit_.store(std::clamp(limit, config_.min_limit, config_.max_limit),
+               std::memory_order_relaxed);
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AdaptiveConcurrencyLimiter& limiter) {
+  writer["limit"] = limiter.GetLimit();
+  writer["observe-only"] = limiter.IsObserveOnly() ? 1 : 0;
+  writer["baseline-latency-us"] =
+      limiter.baseline_latency_us_.load(std::memory_order_relaxed);
+  writer["over-limit"] = limiter.over_limit_.Load();
+  writer["rejected"] = limiter.rejected_.Load();
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+// Limit of the requests in flight of a handler that adapts to the latency:
+// the requests latency is averaged over short windows, each window the limit
+// is multiplicatively decreased if the latency exceeds the baseline by
+// `latency_tolerance` times and is additively increased if the limit was
+// reached otherwise. The baseline follows the lowest observed latency and
+// slowly drifts to the current one.
+class AdaptiveConcurrencyLimiter final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  class Token final {
+   public:
+    Token(Token&& other) noexcept;
+    Token& operator=(Token&&) = delete;
+    ~Token();
+
+   private:
+    friend class AdaptiveConcurrencyLimiter;
+
+    Token(AdaptiveConcurrencyLimiter& limiter, Clock::time_point start);
+
+    AdaptiveConcurrencyLimiter* limiter_;
+    Clock::time_point start_;
+  };
+
+  explicit AdaptiveConcurrencyLimiter(const AdaptiveConcurrencyConfig& config);
+
+  // Returns nullopt if the request should be rejected. The returned token
+  // reports the latency of the request on destruction.
+  std::optional<Token> TryAcquire();
+
+  std::size_t GetLimit() const noexcept;
+
+  bool IsObserveOnly() const noexcept { return config_.observe_only; }
+
+  // Called by Token on destruction, public for tests
+  void AccountLatency(std::chrono::microseconds latency, Clock::time_point now);
+
+ private:
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const AdaptiveConcurrencyLimiter& limiter);
+
+  void UpdateLimit(Clock::time_point now);
+
+  const AdaptiveConcurrencyConfig config_;
+
+  std::atomic<std::size_t> limit_;
+  std::atomic<std::size_t> in_flight_{0};
+  std::atomic<std::int64_t> baseline_latency_us_{0};
+
+  // Current window
+  std::atomic<Clock::rep> window_start_;
+  std::atomic<std::size_t> window_max_in_flight_{0};
+  std::atomic<std::uint64_t> window_samples_{0};
+  std::atomic<std::uint64_t> window_latency_sum_us_{0};
+  std::atomic<bool> is_updating_{false};
+
+  utils::statistics::RateCounter over_limit_;
+  utils::statistics::RateCounter rejected_;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const AdaptiveConcurrencyLimiter& limiter);
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
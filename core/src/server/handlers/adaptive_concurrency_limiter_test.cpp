@@ -0,0 +1,103 @@
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::handlers::AdaptiveConcurrencyConfig;
+using server::handlers::AdaptiveConcurrencyLimiter;
+using namespace std::chrono_literals;
+
+AdaptiveConcurrencyConfig MakeConfig(std::size_t initial_limit,
+                                     bool observe_only) {
+  AdaptiveConcurrencyConfig config;
+  config.enabled = true;
+  config.observe_only = observe_only;
+  config.initial_limit = initial_limit;
+  config.min_limit = 1;
+  config.max_limit = 1000;
+  return config;
+}
+
+// Completes a window of requests with the same latency
+void AccountWindow(AdaptiveConcurrencyLimiter& limiter,
+                   std::chrono::microseconds latency,
+                   AdaptiveConcurrencyLimiter::Clock::time_point now) {
+  for (int i = 0; i < 10; ++i) limiter.AccountLatency(latency, now);
+}
+
+}  // namespace
+
+TEST(AdaptiveConcurrencyLimiter, Rejects) {
+  AdaptiveConcurrencyLimiter limiter(MakeConfig(2, /*observe_only=*/false));
+
+  auto first = limiter.TryAcquire();
+  auto second = limiter.TryAcquire();
+  EXPECT_TRUE(first);
+  EXPECT_TRUE(second);
+  EXPECT_FALSE(limiter.TryAcquire());
+
+  first.reset();
+  EXPECT_TRUE(limiter.TryAcquire());
+}
+
+TEST(AdaptiveConcurrencyLimiter, ObserveOnly) {
+  AdaptiveConcurrencyLimiter limiter(MakeConfig(2, /*observe_only=*/true));
+
+  std::vector<AdaptiveConcurrencyLimiter::Token> tokens;
+  for (int i = 0; i < 5; ++i) {
+    auto token = limiter.TryAcquire();
+    ASSERT_TRUE(token);
+    tokens.push_back(std::move(*token));
+  }
+}
+
+TEST(AdaptiveConcurrencyLimiter, DecreasesOnLatencyGrowth) {
+  AdaptiveConcurrencyLimiter limiter(MakeConfig(100, /*observe_only=*/false));
+  const auto start = AdaptiveConcurrencyLimiter::Clock::now();
+
+  AccountWindow(limiter, 10ms, start + 200ms);
+  EXPECT_EQ(limiter.GetLimit(), 100);
+
+  // Latency within the tolerance
+  AccountWindow(limiter, 15ms, start + 400ms);
+  EXPECT_EQ(limiter.GetLimit(), 100);
+
+  AccountWindow(limiter, 100ms, start + 600ms);
+  EXPECT_EQ(limiter.GetLimit(), 90);
+
+  AccountWindow(limiter, 100ms, start + 800ms);
+  EXPECT_EQ(limiter.GetLimit(), 81);
+}
+
+TEST(AdaptiveConcurrencyLimiter, IncreasesWhenReached) {
+  AdaptiveConcurrencyLimiter limiter(MakeConfig(2, /*observe_only=*/false));
+  const auto start = AdaptiveConcurrencyLimiter::Clock::now();
+
+  {
+    const auto first = limiter.TryAcquire();
+    const auto second = limiter.TryAcquire();
+    AccountWindow(limiter, 10ms, start + 200ms);
+  }
+  EXPECT_EQ(limiter.GetLimit(), 3);
+
+  // The limit is not reached, no reason to grow it
+  AccountWindow(limiter, 10ms, start + 400ms);
+  EXPECT_EQ(limiter.GetLimit(), 3);
+}
+
+TEST(AdaptiveConcurrencyLimiter, ShortWindow) {
+  AdaptiveConcurrencyLimiter limiter(MakeConfig(100, /*observe_only=*/false));
+  const auto start = AdaptiveConcurrencyLimiter::Clock::now();
+
+  AccountWindow(limiter, 10ms, start + 200ms);
+  // Not enough time has passed since the previous window
+  AccountWindow(limiter, 100ms, start + 250ms);
+  EXPECT_EQ(limiter.GetLimit(), 100);
+}
+
+USERVER_NAMESPACE_END
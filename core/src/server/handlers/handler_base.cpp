@@ -54,6 +54,10 @@ properties:
         type: boolean
         description: optional field to parse request according to x-www-form-urlencoded rules and make parameters accessible as query parameters
         defaultDescription: false
+    zero_copy_body:
+        type: boolean
+        description: keep a big request body in the connection buffer, see server::http::HttpRequest::RequestBodyView()
+        defaultDescription: false
     auth:
         type: object
         description: server::handlers::auth::HandlerAuthConfig authorization config
@@ -103,10 +107,91 @@ properties:
         type: boolean
         description: set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header
         defaultDescription: <takes the value from components::Server config>
+    response-headers:
+        type: object
+        description: headers to add to each response of the handler, they are serialized once at startup; the headers set by the handler code take precedence
+        defaultDescription: '{}'
+        additionalProperties:
+            type: string
+            description: header value
+        properties: {}
     response-body-stream:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: read the request body while it is received, see server::http::HttpRequest::GetBodyStream()
+        defaultDescription: false
+    response-compression:
+        type: object
+        description: compression of the responses by the Accept-Encoding of the request
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: compress the responses
+                defaultDescription: false
+            min-size:
+                type: integer
+                description: the smaller responses are not compressed, does not apply to response-body-stream
+                defaultDescription: 1024
+                minimum: 0
+            encodings:
+                type: array
+                description: content codings in the order of preference, the ones disabled at build time are skipped
+                defaultDescription: '[zstd, br, gzip]'
+                items:
+                    type: string
+                    description: content coding
+                    enum:
+                      - zstd
+                      - br
+                      - gzip
+            gzip-level:
+                type: integer
+                description: gzip compression level from 0 to 9
+                defaultDescription: 6
+            brotli-level:
+                type: integer
+                description: brotli compression level from 0 to 11
+                defaultDescription: 4
+            zstd-level:
+                type: integer
+                description: zstd compression level from 1 to 22
+                defaultDescription: 3
+    adaptive-concurrency:
+        type: object
+        description: limit of the requests in flight that adapts to the observed latency
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: compute the adaptive limit
+                defaultDescription: false
+            observe-only:
+                type: boolean
+                description: only report the limit in the metrics, do not reject the requests over it
+                defaultDescription: true
+            initial-limit:
+                type: integer
+                description: the limit before any latency is observed
+                defaultDescription: 100
+                minimum: 1
+            min-limit:
+                type: integer
+                description: the limit is never decreased below this value
+                defaultDescription: 10
+                minimum: 1
+            max-limit:
+                type: integer
+                description: the limit is never increased above this value
+                defaultDescription: 10000
+                minimum: 1
+            latency-tolerance:
+                type: number
+                description: the limit is decreased when the latency exceeds the baseline latency this many times
+                defaultDescription: 2.0
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
@@ -138,6 +223,14 @@ properties:
         defaultDescription: taken from server.listener.handler-defaults.deadline_expired_status_code
         minimum: 400
         maximum: 599
+    scheduling-class:
+        type: string
+        description: the engine::SchedulingClass of the tasks that handle the requests
+        defaultDescription: normal
+        enum:
+          - latency-critical
+          - normal
+          - background
 )");
 }
 
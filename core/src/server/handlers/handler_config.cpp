@@ -1,5 +1,7 @@
 #include <userver/server/handlers/handler_config.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include <server/server_config.hpp>
@@ -7,6 +9,7 @@
 #include <server/http/parse_http_status.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/logging/level_serialization.hpp>
+#include <userver/utils/trivial_map.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,7 +17,20 @@ namespace server::handlers {
 
 namespace {
 constexpr size_t kLogRequestDataSizeDefaultLimit = 512;
+
+constexpr utils::TrivialBiMap kSchedulingClassMap([](auto selector) {
+  return selector()
+      .Case(engine::SchedulingClass::kLatencyCritical, "latency-critical")
+      .Case(engine::SchedulingClass::kNormal, "normal")
+      .Case(engine::SchedulingClass::kBackground, "background");
+});
+
+engine::SchedulingClass ParseSchedulingClass(
+    const yaml_config::YamlConfig& value) {
+  if (value.IsMissing()) return engine::SchedulingClass::kNormal;
+  return utils::ParseFromValueString(value, kSchedulingClassMap);
 }
+}  // namespace
 
 UrlTrailingSlashOption Parse(const yaml_config::YamlConfig& yaml,
                              formats::parse::To<UrlTrailingSlashOption>) {
@@ -31,6 +47,48 @@ FallbackHandler Parse(const yaml_config::YamlConfig& yaml,
   return FallbackHandlerFromString(value);
 }
 
+ResponseCompressionConfig Parse(const yaml_config::YamlConfig& yaml,
+                                formats::parse::To<ResponseCompressionConfig>) {
+  ResponseCompressionConfig config;
+  config.enabled = yaml["enabled"].As<bool>(config.enabled);
+  config.min_size = yaml["min-size"].As<std::size_t>(config.min_size);
+  config.encodings =
+      yaml["encodings"].As<std::vector<std::string>>(config.encodings);
+  config.gzip_level = yaml["gzip-level"].As<int>(config.gzip_level);
+  config.brotli_level = yaml["brotli-level"].As<int>(config.brotli_level);
+  config.zstd_level = yaml["zstd-level"].As<int>(config.zstd_level);
+  return config;
+}
+
+AdaptiveConcurrencyConfig Parse(const yaml_config::YamlConfig& yaml,
+                                formats::parse::To<AdaptiveConcurrencyConfig>) {
+  AdaptiveConcurrencyConfig config;
+  config.enabled = yaml["enabled"].As<bool>(config.enabled);
+  config.observe_only = yaml["observe-only"].As<bool>(config.observe_only);
+  config.min_limit = yaml["min-limit"].As<std::size_t>(config.min_limit);
+  config.max_limit = yaml["max-limit"].As<std::size_t>(config.max_limit);
+  config.initial_limit =
+      yaml["initial-limit"].As<std::size_t>(config.initial_limit);
+  config.latency_tolerance =
+      yaml["latency-tolerance"].As<double>(config.latency_tolerance);
+
+  if (config.min_limit == 0 || config.min_limit > config.max_limit) {
+    throw std::runtime_error(fmt::format(
+        "Invalid adaptive-concurrency limits at {}: min-limit={}, "
+        "max-limit={}",
+        yaml.GetPath(), config.min_limit, config.max_limit));
+  }
+  if (config.latency_tolerance <= 1.0) {
+    throw std::runtime_error(fmt::format(
+        "adaptive-concurrency latency-tolerance at {} should be greater than "
+        "1, current value is {}",
+        yaml.GetPath(), config.latency_tolerance));
+  }
+  config.initial_limit =
+      std::clamp(config.initial_limit, config.min_limit, config.max_limit);
+  return config;
+}
+
 HandlerConfig ParseHandlerConfigsWithDefaults(
     const yaml_config::YamlConfig& value,
     const server::ServerConfig& server_config, bool is_monitor) {
@@ -68,6 +126,8 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
   config.request_config.parse_args_from_body =
       value["parse_args_from_body"].As<bool>(
           handler_defaults.parse_args_from_body);
+  config.request_config.zero_copy_body =
+      value["zero_copy_body"].As<bool>(handler_defaults.zero_copy_body);
   config.auth = value["auth"].As<std::optional<auth::HandlerAuthConfig>>();
   config.url_trailing_slash =
       value["url_trailing_slash"].As<UrlTrailingSlashOption>(
@@ -88,6 +148,17 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
       value["set-response-server-hostname"].As<std::optional<bool>>();
 
   config.response_body_stream = value["response-body-stream"].As<bool>(false);
+  config.request_body_stream = value["request-body-stream"].As<bool>(false);
+  config.response_compression =
+      value["response-compression"].As<ResponseCompressionConfig>(
+          ResponseCompressionConfig{});
+  config.adaptive_concurrency =
+      value["adaptive-concurrency"].As<AdaptiveConcurrencyConfig>(
+          AdaptiveConcurrencyConfig{});
+  for (const auto& [name, header_value] : Items(value["response-headers"])) {
+    config.response_headers.emplace_back(name,
+                                         header_value.As<std::string>());
+  }
 
   if (config.max_requests_per_second &&
       config.max_requests_per_second.value() <= 0) {
@@ -107,6 +178,8 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
       value["deadline_expired_status_code"].As<http::HttpStatus>(
           handler_defaults.deadline_expired_status_code);
 
+  config.scheduling_class = ParseSchedulingClass(value["scheduling-class"]);
+
   return config;
 }
 
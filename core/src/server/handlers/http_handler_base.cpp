@@ -4,9 +4,12 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/container/small_vector.hpp>
 
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
+#include <server/http/headers_block.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <server/middlewares/handler_adapter.hpp>
+#include <server/middlewares/pipeline.hpp>
 #include <server/request/internal_request_context.hpp>
 #include <server/server_config.hpp>
 
@@ -53,6 +56,9 @@ constexpr std::string_view kDefaultMiddlewares[] = {
     "userver-set-accept-encoding-middleware",
 
     "userver-unknown-exceptions-handling-middleware",
+    // Compresses the bodies produced by everything below, the compression
+    // errors are handled above.
+    "userver-compression-middleware",
 
     "userver-rate-limit-middleware",
     "userver-deadline-propagation-middleware",
@@ -128,6 +134,11 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
               .As<std::unordered_map<std::string, std::string>>({}))),
       handler_statistics_(std::make_unique<HttpHandlerStatistics>()),
       request_statistics_(std::make_unique<HttpRequestStatistics>()),
+      adaptive_concurrency_(
+          GetConfig().adaptive_concurrency.enabled
+              ? std::make_unique<AdaptiveConcurrencyLimiter>(
+                    GetConfig().adaptive_concurrency)
+              : nullptr),
       is_body_streamed_(config["response-body-stream"].As<bool>(false)) {
   if (allowed_methods_.empty()) {
     LOG_WARNING() << "empty allowed methods list in " << config.Name();
@@ -165,17 +176,25 @@ HttpHandlerBase::HttpHandlerBase(const components::ComponentConfig& config,
       std::move(prefix),
       [this](utils::statistics::Writer& result) {
         FormatStatistics(result["handler"], *handler_statistics_);
+        if (adaptive_concurrency_) {
+          result["handler"]["adaptive-concurrency"] = *adaptive_concurrency_;
+        }
         if constexpr (kIncludeServerHttpMetrics) {
           FormatStatistics(result["request"], *request_statistics_);
         }
       },
       std::move(labels));
 
-  set_response_server_hostname_ =
-      GetConfig().set_response_server_hostname.value_or(
+  auto static_headers = GetConfig().response_headers;
+  if (GetConfig().set_response_server_hostname.value_or(
           server_component.GetServer()
               .GetConfig()
-              .set_response_server_hostname);
+              .set_response_server_hostname)) {
+    static_headers.emplace_back(
+        USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname, kHostname);
+  }
+  static_headers_ =
+      std::make_unique<http::impl::HeadersBlock>(std::move(static_headers));
 
   BuildMiddlewarePipeline(config, context);
 }
@@ -230,6 +249,8 @@ void HttpHandlerBase::HandleRequestStream(
                                 }));
     }
   }
+
+  response_body_stream.PushBodyEnd(engine::Deadline());
 }
 
 void HttpHandlerBase::HandleHttpRequest(
@@ -258,10 +279,13 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
   http::HttpRequest http_request(http_request_impl);
   auto& response = http_request.GetHttpResponse();
 
+  if (!static_headers_->IsEmpty()) response.AddStaticHeaders(*static_headers_);
+
   context.GetInternalContext().SetConfigSnapshot(config_source_.GetSnapshot());
   try {
     UASSERT(first_middleware_);
-    first_middleware_->HandleRequest(http_request, context);
+    middlewares::impl::PipelineBuilder::Run(*first_middleware_, http_request,
+                                            context);
   } catch (const std::exception& ex) {
     UASSERT_MSG(false,
                 "Middlewares should handle exceptions by themselves and not "
@@ -270,7 +294,6 @@ void HttpHandlerBase::HandleRequest(request::RequestBase& request,
     response.SetStatus(http::HttpStatus::kInternalServerError);
   }
 
-  SetResponseServerHostname(response);
   response.SetHeadersEnd();
 }
 
@@ -332,6 +355,11 @@ HttpRequestStatistics& HttpHandlerBase::GetRequestStatistics() const {
   return *request_statistics_;
 }
 
+AdaptiveConcurrencyLimiter* HttpHandlerBase::GetAdaptiveConcurrencyLimiter()
+    const {
+  return adaptive_concurrency_.get();
+}
+
 logging::Level HttpHandlerBase::GetLogLevelForResponseStatus(
     http::HttpStatus status) const {
   const auto status_code = static_cast<int>(status);
@@ -452,14 +480,6 @@ void HttpHandlerBase::FormatStatistics(utils::statistics::Writer result,
   result = total;
 }
 
-void HttpHandlerBase::SetResponseServerHostname(
-    http::HttpResponse& response) const {
-  if (set_response_server_hostname_) {
-    response.SetHeader(USERVER_NAMESPACE::http::headers::kXYaTaxiServerHostname,
-                       kHostname);
-  }
-}
-
 void HttpHandlerBase::BuildMiddlewarePipeline(
     const components::ComponentConfig& config,
     const components::ComponentContext& context) {
@@ -473,13 +493,12 @@ void HttpHandlerBase::BuildMiddlewarePipeline(
         "AppendComponentList()"};
   }
 
-  auto* next_middleware_ptr_{&first_middleware_};
+  middlewares::impl::PipelineBuilder pipeline;
   const auto add_middleware = [this, &config, &context,
-                               &next_middleware_ptr_](std::string_view name) {
-    *next_middleware_ptr_ =
+                               &pipeline](std::string_view name) {
+    pipeline.Append(
         context.FindComponent<middlewares::HttpMiddlewareFactoryBase>(name)
-            .Create(*this, config);
-    next_middleware_ptr_ = &(*next_middleware_ptr_)->next_;
+            .Create(*this, config));
   };
 
   // TODO : TAXICOMMON-8253, build the actual pipeline from config
@@ -489,6 +508,10 @@ void HttpHandlerBase::BuildMiddlewarePipeline(
 
   // Finalize the pipeline
   { add_middleware(middlewares::HandlerAdapterFactory::kName); }
+
+  LOG_DEBUG() << "Skipped " << pipeline.GetSkippedCount()
+              << " no-op middlewares for handler " << HandlerName();
+  first_middleware_ = std::move(pipeline).Build();
 }
 
 yaml_config::Schema HttpHandlerBase::GetStaticConfigSchema() {
@@ -24,6 +24,10 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["rate-limit-reached"] = stats.rate_limit_reached;
   writer["deadline-received"] = stats.deadline_received;
   writer["cancelled-by-deadline"] = stats.cancelled_by_deadline;
+  writer["deadline-budget-limited-calls"] = stats.deadline_budget_limited_calls;
+  writer["deadline-budget-skipped-calls"] = stats.deadline_budget_skipped_calls;
+  writer["cpu-time-us"] = stats.cpu_time_us;
+  writer["allocated-bytes"] = stats.allocated_bytes;
   writer["timings"] = stats.timings;
 }
 
@@ -36,6 +40,21 @@ void HttpHandlerMethodStatistics::Account(
   timings_.GetCurrentCounter().Account(stats.timing.count());
   if (stats.deadline.IsReachable()) ++deadline_received_;
   if (stats.cancelled_by_deadline) ++cancelled_by_deadline_;
+  if (stats.deadline_budget_limited_calls) {
+    deadline_budget_limited_calls_ +=
+        utils::statistics::Rate{stats.deadline_budget_limited_calls};
+  }
+  if (stats.deadline_budget_skipped_calls) {
+    deadline_budget_skipped_calls_ +=
+        utils::statistics::Rate{stats.deadline_budget_skipped_calls};
+  }
+  if (stats.cpu_time.count() > 0) {
+    cpu_time_us_ += utils::statistics::Rate{
+        static_cast<std::uint64_t>(stats.cpu_time.count())};
+  }
+  if (stats.allocated_bytes) {
+    allocated_bytes_ += utils::statistics::Rate{stats.allocated_bytes};
+  }
 }
 
 std::size_t HttpHandlerMethodStatistics::GetInFlight() const noexcept {
@@ -59,7 +78,13 @@ HttpHandlerStatisticsSnapshot::HttpHandlerStatisticsSnapshot(
       too_many_requests_in_flight(stats.too_many_requests_in_flight_.Load()),
       rate_limit_reached(stats.rate_limit_reached_.Load()),
       deadline_received(stats.deadline_received_.Load()),
-      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()) {}
+      cancelled_by_deadline(stats.cancelled_by_deadline_.Load()),
+      deadline_budget_limited_calls(
+          stats.deadline_budget_limited_calls_.Load()),
+      deadline_budget_skipped_calls(
+          stats.deadline_budget_skipped_calls_.Load()),
+      cpu_time_us(stats.cpu_time_us_.Load()),
+      allocated_bytes(stats.allocated_bytes_.Load()) {}
 
 void HttpHandlerStatisticsSnapshot::Add(
     const HttpHandlerStatisticsSnapshot& other) {
@@ -71,6 +96,10 @@ void HttpHandlerStatisticsSnapshot::Add(
   rate_limit_reached += other.rate_limit_reached;
   deadline_received += other.deadline_received;
   cancelled_by_deadline += other.cancelled_by_deadline;
+  deadline_budget_limited_calls += other.deadline_budget_limited_calls;
+  deadline_budget_skipped_calls += other.deadline_budget_skipped_calls;
+  cpu_time_us += other.cpu_time_us;
+  allocated_bytes += other.allocated_bytes;
 }
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -98,12 +127,14 @@ HttpHandlerStatisticsScope::HttpHandlerStatisticsScope(
     : stats_(stats),
       method_(method),
       start_time_(std::chrono::steady_clock::now()),
+      start_resource_usage_(engine::current_task::GetResourceUsage()),
       response_(response) {
   stats_.ForMethod(method).IncrementInFlight();
 }
 
 HttpHandlerStatisticsScope::~HttpHandlerStatisticsScope() {
   const auto finish_time = std::chrono::steady_clock::now();
+  const auto finish_resource_usage = engine::current_task::GetResourceUsage();
   const auto* const data = request::kTaskInheritedData.GetOptional();
 
   HttpHandlerStatisticsEntry stats;
@@ -112,6 +143,16 @@ HttpHandlerStatisticsScope::~HttpHandlerStatisticsScope() {
       finish_time - start_time_);
   stats.deadline = data ? data->deadline : engine::Deadline{};
   stats.cancelled_by_deadline = cancelled_by_deadline_;
+  stats.cpu_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      finish_resource_usage.cpu_time - start_resource_usage_.cpu_time);
+  stats.allocated_bytes = finish_resource_usage.allocated_bytes -
+                          start_resource_usage_.allocated_bytes;
+  if (data) {
+    stats.deadline_budget_limited_calls =
+        data->deadline_budget_stats.GetLimitedCalls();
+    stats.deadline_budget_skipped_calls =
+        data->deadline_budget_stats.GetSkippedCalls();
+  }
   stats_.ForMethod(method_).Account(stats);
   stats_.ForMethod(method_).DecrementInFlight();
 }
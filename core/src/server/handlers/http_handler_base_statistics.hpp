@@ -3,16 +3,19 @@
 #include <array>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 #include <server/http/handler_methods.hpp>
 #include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_base.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/statistics/percentile.hpp>
 #include <userver/utils/statistics/rate.hpp>
 #include <userver/utils/statistics/rate_counter.hpp>
 #include <userver/utils/statistics/recentperiod.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
 #include <utils/statistics/http_codes.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -25,6 +28,11 @@ struct HttpHandlerStatisticsEntry final {
   std::chrono::milliseconds timing{};
   engine::Deadline deadline{};
   bool cancelled_by_deadline{false};
+  std::uint64_t deadline_budget_limited_calls{0};
+  std::uint64_t deadline_budget_skipped_calls{0};
+  // Zero unless the `resource-accounting` of the task processor is enabled
+  std::chrono::microseconds cpu_time{0};
+  std::uint64_t allocated_bytes{0};
 };
 
 struct HttpHandlerStatisticsSnapshot;
@@ -57,12 +65,17 @@ class HttpHandlerMethodStatistics final {
 
   RecentPeriod timings_;
   utils::statistics::HttpCodes reply_codes_;
-  utils::statistics::RateCounter started_;
-  utils::statistics::RateCounter finished_;
+  // Incremented by every request, sharded to avoid cache line bouncing
+  utils::statistics::ShardedRateCounter started_;
+  utils::statistics::ShardedRateCounter finished_;
   utils::statistics::RateCounter too_many_requests_in_flight_;
   utils::statistics::RateCounter rate_limit_reached_;
   utils::statistics::RateCounter deadline_received_;
   utils::statistics::RateCounter cancelled_by_deadline_;
+  utils::statistics::RateCounter deadline_budget_limited_calls_;
+  utils::statistics::RateCounter deadline_budget_skipped_calls_;
+  utils::statistics::RateCounter cpu_time_us_;
+  utils::statistics::RateCounter allocated_bytes_;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -84,6 +97,10 @@ struct HttpHandlerStatisticsSnapshot final {
   utils::statistics::Rate rate_limit_reached;
   utils::statistics::Rate deadline_received;
   utils::statistics::Rate cancelled_by_deadline;
+  utils::statistics::Rate deadline_budget_limited_calls;
+  utils::statistics::Rate deadline_budget_skipped_calls;
+  utils::statistics::Rate cpu_time_us;
+  utils::statistics::Rate allocated_bytes;
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -154,6 +171,7 @@ class HttpHandlerStatisticsScope final {
   HttpHandlerStatistics& stats_;
   const http::HttpMethod method_;
   const std::chrono::steady_clock::time_point start_time_;
+  const engine::current_task::ResourceUsage start_resource_usage_;
   server::http::HttpResponse& response_;
   bool cancelled_by_deadline_{false};
 };
@@ -1,8 +1,13 @@
 #include <userver/server/handlers/jemalloc.hpp>
 
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/http/content_type.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/from_string.hpp>
-#include <userver/yaml_config/schema.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
 #include <utils/jemalloc.hpp>
 #include <utils/strerror.hpp>
 
@@ -21,7 +26,9 @@ std::string HandleRc(std::error_code ec) {
 
 Jemalloc::Jemalloc(const components::ComponentConfig& config,
                    const components::ComponentContext& component_context)
-    : HttpHandlerBase(config, component_context, /*is_monitor = */ true) {}
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      fs_task_processor_(component_context.GetTaskProcessor(
+          config["fs-task-processor"].As<std::string>("fs-task-processor"))) {}
 
 std::string Jemalloc::HandleRequestThrow(const http::HttpRequest& request,
                                          request::RequestContext&) const {
@@ -33,7 +40,26 @@ std::string Jemalloc::HandleRequestThrow(const http::HttpRequest& request,
   } else if (command == "stat") {
     return utils::jemalloc::Stats();
   } else if (command == "dump") {
-    return HandleRc(utils::jemalloc::ProfDump());
+    // the profile is written to the working directory
+    return HandleRc(engine::AsyncNoSpan(fs_task_processor_, [] {
+                      return utils::jemalloc::ProfDump();
+                    }).Get());
+  } else if (command == "profile") {
+    std::string profile;
+    // the profile goes through a temporary file
+    const auto ec = engine::AsyncNoSpan(fs_task_processor_, [&profile] {
+                      return utils::jemalloc::ProfDump(profile);
+                    }).Get();
+    if (ec) {
+      request.SetResponseStatus(server::http::HttpStatus::kServiceUnavailable);
+      return HandleRc(ec);
+    }
+    auto& response = request.GetHttpResponse();
+    response.SetContentType(USERVER_NAMESPACE::http::content_type::
+                                kApplicationOctetStream);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kContentDisposition,
+                       std::string{"attachment; filename=\"heap.prof\""});
+    return profile;
   } else if (command == "bg_threads_set_max") {
     size_t num_threads = 0;
     if (!request.HasArg("count")) {
@@ -57,9 +83,16 @@ std::string Jemalloc::HandleRequestThrow(const http::HttpRequest& request,
 }
 
 yaml_config::Schema Jemalloc::GetStaticConfigSchema() {
-  auto schema = HttpHandlerBase::GetStaticConfigSchema();
-  schema.UpdateDescription("handler-jemalloc config");
-  return schema;
+  return yaml_config::MergeSchemas<HttpHandlerBase>(R"(
+type: object
+description: handler-jemalloc config
+additionalProperties: false
+properties:
+    fs-task-processor:
+        type: string
+        description: task processor to write and read the profiles
+        defaultDescription: fs-task-processor
+)");
 }
 
 }  // namespace server::handlers
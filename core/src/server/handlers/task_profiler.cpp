@@ -0,0 +1,108 @@
+#include <userver/server/handlers/task_profiler.hpp>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <components/manager.hpp>
+#include <engine/task/task_processor.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/yaml_config/schema.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::handlers {
+
+namespace {
+
+std::unordered_map<std::string, engine::TaskProcessor*> GetTaskProcessors(
+    const components::ComponentContext& component_context) {
+  std::unordered_map<std::string, engine::TaskProcessor*> result;
+  for (const auto& [name, task_processor] :
+       component_context.GetManager().GetTaskProcessorsMap()) {
+    result.emplace(name, task_processor.get());
+  }
+  return result;
+}
+
+void DumpFolded(std::string_view task_processor_name,
+                const engine::impl::TaskProfiler& profiler,
+                std::string& result) {
+  // Merges the shards and sorts the stacks, as flamegraph.pl expects
+  std::map<std::string, std::chrono::nanoseconds> stacks;
+  profiler.Visit([&](const auto& key, const auto& value) {
+    auto stack = fmt::format(
+        "{};{};{}", task_processor_name,
+        key.span_name.empty() ? std::string_view{"<no span>"}
+                              : std::string_view{key.span_name},
+        engine::impl::ToString(key.kind));
+    if (!key.wait_kind.empty()) {
+      stack.push_back(';');
+      stack.append(key.wait_kind);
+    }
+    stacks[std::move(stack)] += value.total;
+  });
+
+  for (const auto& [stack, total] : stacks) {
+    const auto total_us =
+        std::chrono::duration_cast<std::chrono::microseconds>(total).count();
+    if (total_us == 0) continue;
+    result += fmt::format("{} {}\n", stack, total_us);
+  }
+}
+
+}  // namespace
+
+TaskProfiler::TaskProfiler(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& component_context)
+    : HttpHandlerBase(config, component_context, /*is_monitor = */ true),
+      task_processors_(GetTaskProcessors(component_context)) {}
+
+std::string TaskProfiler::HandleRequestThrow(const http::HttpRequest& request,
+                                             request::RequestContext&) const {
+  const auto& task_processor_name = request.GetArg("task_processor");
+
+  std::vector<std::pair<std::string_view, engine::TaskProcessor*>> selected;
+  if (task_processor_name.empty()) {
+    selected.assign(task_processors_.begin(), task_processors_.end());
+  } else {
+    const auto it = task_processors_.find(task_processor_name);
+    if (it == task_processors_.end()) {
+      request.SetResponseStatus(server::http::HttpStatus::kNotFound);
+      return "Task processor not found\n";
+    }
+    selected.emplace_back(it->first, it->second);
+  }
+
+  switch (request.GetMethod()) {
+    case http::HttpMethod::kGet: {
+      std::string result;
+      for (const auto& [name, task_processor] : selected) {
+        DumpFolded(name, task_processor->GetTaskProfiler(), result);
+      }
+      return result;
+    }
+    case http::HttpMethod::kDelete:
+      for (const auto& [name, task_processor] : selected) {
+        task_processor->GetTaskProfiler().Reset();
+      }
+      return "OK\n";
+    default:
+      throw std::runtime_error("unsupported method: " + request.GetMethodStr());
+  }
+}
+
+yaml_config::Schema TaskProfiler::GetStaticConfigSchema() {
+  auto schema = HttpHandlerBase::GetStaticConfigSchema();
+  schema.UpdateDescription("handler-task-profiler config");
+  return schema;
+}
+
+}  // namespace server::handlers
+
+USERVER_NAMESPACE_END
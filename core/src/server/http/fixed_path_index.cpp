@@ -34,12 +34,14 @@ void FixedPathIndex::AddHandler(std::string path,
                                                         {});
 }
 
-bool FixedPathIndex::MatchRequest(HttpMethod method, const std::string& path,
+bool FixedPathIndex::MatchRequest(HttpMethod method, std::string_view path,
                                   MatchRequestResult& match_result) const {
-  auto it = handler_method_index_map_.find(path);
-  if (it == handler_method_index_map_.end()) return false;
+  const auto* handler_method_index =
+      utils::impl::FindTransparentOrNullptr(handler_method_index_map_, path);
+  if (!handler_method_index) return false;
 
-  const auto* handler_info_data = it->second.GetHandlerInfoData(method);
+  const auto* handler_info_data =
+      handler_method_index->GetHandlerInfoData(method);
   if (!handler_info_data) {
     match_result.status = MatchRequestResult::Status::kMethodNotAllowed;
     return false;
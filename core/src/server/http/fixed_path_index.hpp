@@ -1,7 +1,7 @@
 #pragma once
 
 #include <string>
-#include <unordered_map>
+#include <string_view>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
@@ -9,6 +9,7 @@
 #include <server/http/handler_method_index.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_method.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -18,14 +19,15 @@ class FixedPathIndex final {
  public:
   void AddHandler(const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
-  bool MatchRequest(HttpMethod method, const std::string& path,
+  bool MatchRequest(HttpMethod method, std::string_view path,
                     MatchRequestResult& match_result) const;
 
  private:
   void AddHandler(std::string path, const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
 
-  std::unordered_map<std::string, HandlerMethodIndex> handler_method_index_map_;
+  utils::impl::TransparentMap<std::string, HandlerMethodIndex>
+      handler_method_index_map_;
 };
 
 }  // namespace server::http::impl
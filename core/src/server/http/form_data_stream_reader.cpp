@@ -0,0 +1,122 @@
+#include <userver/server/http/form_data_stream_reader.hpp>
+
+#include <server/http/multipart_form_data_parser.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+std::string GetBoundary(const HttpRequest& request) {
+  std::string boundary;
+  std::string charset;
+  if (!ParseMultipartContentType(
+          request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType),
+          boundary, charset)) {
+    throw handlers::RequestParseError(handlers::InternalMessage{
+        "Content type is not multipart/form-data with a boundary"});
+  }
+  return boundary;
+}
+
+}  // namespace
+
+struct FormDataStreamReader::Impl {
+  explicit Impl(const HttpRequest& request)
+      : stream(request.GetBodyStream()), parser(GetBoundary(request)) {}
+
+  MultipartFormDataStreamParser::Event Next(engine::Deadline deadline) {
+    while (true) {
+      const auto event = parser.Next();
+      if (event == MultipartFormDataStreamParser::Event::kError) {
+        throw handlers::RequestParseError(
+            handlers::InternalMessage{"Malformed multipart/form-data body"});
+      }
+      if (event != MultipartFormDataStreamParser::Event::kNeedMoreData) {
+        return event;
+      }
+
+      if (stream.ReadChunk(chunk, deadline)) {
+        parser.Append(chunk);
+      } else if (stream.IsComplete()) {
+        parser.SetEndOfInput();
+      } else {
+        throw handlers::RequestParseError(handlers::InternalMessage{
+            "Failed to receive the multipart/form-data body"});
+      }
+    }
+  }
+
+  RequestBodyStream& stream;
+  MultipartFormDataStreamParser parser;
+  std::string chunk;
+  bool is_in_part{false};
+};
+
+FormDataStreamReader::FormDataStreamReader(const HttpRequest& request)
+    : impl_(std::make_unique<Impl>(request)) {}
+
+FormDataStreamReader::FormDataStreamReader(FormDataStreamReader&&) noexcept =
+    default;
+
+FormDataStreamReader& FormDataStreamReader::operator=(
+    FormDataStreamReader&&) noexcept = default;
+
+FormDataStreamReader::~FormDataStreamReader() = default;
+
+std::optional<FormDataStreamReader::Part> FormDataStreamReader::NextPart(
+    engine::Deadline deadline) {
+  using Event = MultipartFormDataStreamParser::Event;
+  while (true) {
+    switch (impl_->Next(deadline)) {
+      case Event::kPart: {
+        impl_->is_in_part = true;
+        const auto& part = impl_->parser.GetPart();
+        return Part{part.name, part.filename, part.content_type};
+      }
+      case Event::kEnd:
+        impl_->is_in_part = false;
+        return std::nullopt;
+      case Event::kData:
+      case Event::kPartEnd:
+        // Skipping the rest of the current part
+        break;
+      case Event::kNeedMoreData:
+      case Event::kError:
+        UASSERT(false);
+        break;
+    }
+  }
+}
+
+bool FormDataStreamReader::ReadChunk(std::string& output,
+                                     engine::Deadline deadline) {
+  using Event = MultipartFormDataStreamParser::Event;
+  if (!impl_->is_in_part) return false;
+
+  switch (impl_->Next(deadline)) {
+    case Event::kData:
+      output = impl_->parser.GetData();
+      return true;
+    case Event::kPartEnd:
+      impl_->is_in_part = false;
+      return false;
+    case Event::kPart:
+    case Event::kEnd:
+    case Event::kNeedMoreData:
+    case Event::kError:
+      break;
+  }
+  UASSERT_MSG(false, "Unexpected event inside of a form-data part");
+  return false;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -28,7 +28,7 @@ class HandlerInfoIndex::HandlerInfoIndexImpl final {
   const HandlerList& GetHandlers() const;
 
   MatchRequestResult MatchRequest(HttpMethod method,
-                                  const std::string& path) const;
+                                  std::string_view path) const;
 
   void SetFallbackHandler(const handlers::HttpHandlerBase& handler,
                           engine::TaskProcessor& task_processor);
@@ -60,7 +60,7 @@ HandlerInfoIndex::HandlerInfoIndexImpl::GetHandlers() const {
 }
 
 MatchRequestResult HandlerInfoIndex::HandlerInfoIndexImpl::MatchRequest(
-    HttpMethod method, const std::string& path) const {
+    HttpMethod method, std::string_view path) const {
   MatchRequestResult match_result;
   if (fixed_path_index_.MatchRequest(method, path, match_result))
     return match_result;
@@ -113,7 +113,7 @@ const HandlerInfoIndex::HandlerList& HandlerInfoIndex::GetHandlers() const {
 }
 
 MatchRequestResult HandlerInfoIndex::MatchRequest(
-    HttpMethod method, const std::string& path) const {
+    HttpMethod method, std::string_view path) const {
   return impl_->MatchRequest(method, path);
 }
 
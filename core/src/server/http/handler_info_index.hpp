@@ -3,8 +3,11 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/server/handlers/fallback_handlers.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
@@ -34,7 +37,11 @@ struct MatchRequestResult {
   const HandlerInfo* handler_info = nullptr;
   size_t matched_path_length = 0;
   Status status = Status::kHandlerNotFound;
-  std::vector<std::pair<std::string, std::string>> args_from_path;
+  // The names reference the handler config, the values reference the path
+  // passed to HandlerInfoIndex::MatchRequest
+  boost::container::small_vector<std::pair<std::string_view, std::string_view>,
+                                 8>
+      args_from_path;
 };
 
 class HandlerInfoIndex final {
@@ -52,7 +59,7 @@ class HandlerInfoIndex final {
   const HandlerInfo* GetFallbackHandler(handlers::FallbackHandler) const;
 
   MatchRequestResult MatchRequest(HttpMethod method,
-                                  const std::string& path) const;
+                                  std::string_view path) const;
 
  private:
   class HandlerInfoIndexImpl;
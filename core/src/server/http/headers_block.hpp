@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/http/header_map.hpp>
+#include <userver/http/predefined_header.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// @brief The response headers that are the same for all the responses of a
+/// handler or of a server, serialized in the HTTP/1.1 format once.
+///
+/// The block is spliced into the responses as is, skipping only the headers
+/// that were set by the handler code for the particular response.
+///
+/// The block is referenced by the responses and must outlive them.
+class HeadersBlock final {
+ public:
+  using HeadersList = std::vector<std::pair<std::string, std::string>>;
+
+  struct Header final {
+    std::string name;
+    std::string lowercase_name;
+    std::string value;
+  };
+
+  /// @throws std::runtime_error for the invalid and duplicate headers and for
+  /// the headers that are computed per response, e.g. Content-Length or Date.
+  explicit HeadersBlock(HeadersList headers);
+
+  HeadersBlock(const HeadersBlock&) = delete;
+  HeadersBlock& operator=(const HeadersBlock&) = delete;
+
+  bool IsEmpty() const noexcept { return headers_.empty(); }
+
+  bool HasContentType() const noexcept { return has_content_type_; }
+
+  const std::vector<Header>& GetHeaders() const noexcept { return headers_; }
+
+  /// @returns the value of the header with case insensitive `name` or nullptr
+  const std::string* FindValue(std::string_view name) const noexcept;
+
+  /// @returns true if the i-th header was set for the particular response or
+  /// is in one of the `overriding_blocks`
+  bool IsOverridden(
+      std::size_t i,
+      const USERVER_NAMESPACE::http::headers::HeaderMap& overrides,
+      utils::span<const HeadersBlock* const> overriding_blocks) const;
+
+  /// Appends the headers that are not overridden to the `buffer`
+  void OutputInHttpFormat(
+      const USERVER_NAMESPACE::http::headers::HeaderMap& overrides,
+      utils::span<const HeadersBlock* const> overriding_blocks,
+      USERVER_NAMESPACE::http::headers::HeadersString& buffer) const;
+
+ private:
+  std::vector<Header> headers_;
+  // Point to the names in headers_, precompute the hashes for the lookups
+  std::vector<USERVER_NAMESPACE::http::headers::PredefinedHeader> keys_;
+  std::string serialized_;
+  // End offsets of the headers in serialized_
+  std::vector<std::size_t> ends_;
+  bool has_content_type_{false};
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
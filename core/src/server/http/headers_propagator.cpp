@@ -1,20 +1,30 @@
 #include <server/http/headers_propagator.hpp>
 
-#include <userver/server/request/task_inherited_request.hpp>
+#include <server/http/http_request_impl.hpp>
+#include <server/request/task_inherited_request_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
 
 HeadersPropagator::HeadersPropagator(std::vector<std::string>&& headers)
-    : headers_(std::move(headers)) {}
+    : headers_(std::move(headers)) {
+  lookups_.reserve(headers_.size());
+  for (const auto& header : headers_) {
+    lookups_.emplace_back(header);
+  }
+}
 
 void HeadersPropagator::PropagateHeaders(
     clients::http::RequestTracingEditor request) const {
-  for (const auto& header : headers_) {
-    if (server::request::HasTaskInheritedHeader(header)) {
-      request.SetHeader(header,
-                        server::request::GetTaskInheritedHeader(header));
+  const auto* inherited_request =
+      server::request::kTaskInheritedRequest.GetOptional();
+  if (inherited_request == nullptr) return;
+
+  const auto& http_request = **inherited_request;
+  for (const auto& header : lookups_) {
+    if (http_request.HasHeader(header)) {
+      request.SetHeader(header, http_request.GetHeader(header));
     }
   }
 }
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include <userver/clients/http/request_tracing_editor.hpp>
+#include <userver/http/predefined_header.hpp>
 #include <userver/server/http/http_request.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -14,10 +15,16 @@ class HeadersPropagator final {
  public:
   explicit HeadersPropagator(std::vector<std::string>&&);
 
+  HeadersPropagator(const HeadersPropagator&) = delete;
+  HeadersPropagator& operator=(const HeadersPropagator&) = delete;
+
   void PropagateHeaders(clients::http::RequestTracingEditor request) const;
 
  private:
   const std::vector<std::string> headers_;
+  // Views into headers_ with precomputed hashes, to avoid hashing the header
+  // names on every outgoing request
+  std::vector<USERVER_NAMESPACE::http::headers::PredefinedHeader> lookups_;
 };
 
 }  // namespace server::http
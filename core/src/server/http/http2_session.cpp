@@ -0,0 +1,571 @@
+#include "http2_session.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <string_view>
+#include <vector>
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#include <nghttp2/nghttp2.h>
+
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/read.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/http/http_method.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/server/request/request_base.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <server/http/headers_block.hpp>
+#include <server/http/http_cached_date.hpp>
+
+#include "http_request_impl.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::string_view kDefaultContentType = "application/octet-stream";
+
+// Headers that are meaningless or prohibited in HTTP/2 (RFC 9113, 8.2.2)
+constexpr std::string_view kConnectionSpecificHeaders[] = {
+    "connection", "keep-alive", "proxy-connection", "transfer-encoding",
+    "upgrade",
+};
+
+std::string_view ToStringView(const std::uint8_t* data, std::size_t size) {
+  return {reinterpret_cast<const char*>(data), size};
+}
+
+std::string ToLowerAscii(std::string_view str) {
+  std::string result{str};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+  }
+  return result;
+}
+
+bool IsConnectionSpecificHeader(std::string_view lowercase_name) {
+  return std::find(std::begin(kConnectionSpecificHeaders),
+                   std::end(kConnectionSpecificHeaders),
+                   lowercase_name) != std::end(kConnectionSpecificHeaders);
+}
+
+bool IsBodyForbiddenForStatus(HttpStatus status) {
+  return status == HttpStatus::kNoContent ||
+         status == HttpStatus::kNotModified ||
+         (static_cast<int>(status) >= 100 && static_cast<int>(status) < 200);
+}
+
+HttpMethod ParseHttpMethod(std::string_view method_str) {
+  try {
+    return HttpMethodFromString(method_str);
+  } catch (const std::exception&) {
+    // Rejected by the handler lookup, as with HTTP/1.1
+    return HttpMethod::kUnknown;
+  }
+}
+
+nghttp2_nv MakeNv(const std::string& name, const std::string& value) {
+  // nghttp2 copies the names and the values on submission
+  return {reinterpret_cast<std::uint8_t*>(const_cast<char*>(name.data())),
+          reinterpret_cast<std::uint8_t*>(const_cast<char*>(value.data())),
+          name.size(), value.size(), NGHTTP2_NV_FLAG_NONE};
+}
+
+}  // namespace
+
+struct Http2Session::Stream final {
+  // Reads the next piece of the response body into `buf`
+  ssize_t ReadBody(std::uint8_t* buf, std::size_t length,
+                   std::uint32_t& data_flags);
+
+  // Request parsing
+  std::unique_ptr<HttpRequestConstructor> request_constructor;
+  bool is_pseudo_headers_complete{false};
+  bool has_host_header{false};
+  std::string authority;
+  std::string cookies;
+
+  // Response sending
+  std::shared_ptr<request::RequestBase> request;
+  std::string_view data;
+  const fs::FileInfoWithData* file{nullptr};
+  std::size_t body_offset{0};
+  bool is_streamed{false};
+  std::deque<std::string> body_parts;
+  bool is_body_finished{false};
+  bool is_deferred{false};
+  std::size_t sent_bytes{0};
+};
+
+ssize_t Http2Session::Stream::ReadBody(std::uint8_t* buf, std::size_t length,
+                                       std::uint32_t& data_flags) {
+  std::size_t size = 0;
+  if (file) {
+    const auto to_read = std::min(length, file->size - body_offset);
+    ssize_t read_bytes = 0;
+    do {
+      read_bytes = ::pread(file->file->GetNative(), buf, to_read,
+                           static_cast<off_t>(body_offset));
+    } while (read_bytes < 0 && errno == EINTR);
+    if (read_bytes <= 0 && to_read != 0) {
+      // The file was truncated after the content-length was sent
+      LOG_WARNING() << "Failed to read " << to_read
+                    << " bytes of a file response body at offset "
+                    << body_offset;
+      return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+    }
+    size = static_cast<std::size_t>(read_bytes);
+    body_offset += size;
+    if (body_offset == file->size) data_flags |= NGHTTP2_DATA_FLAG_EOF;
+  } else if (is_streamed) {
+    while (size < length && !body_parts.empty()) {
+      auto& part = body_parts.front();
+      const auto to_copy = std::min(length - size, part.size() - body_offset);
+      std::memcpy(buf + size, part.data() + body_offset, to_copy);
+      size += to_copy;
+      body_offset += to_copy;
+      if (body_offset == part.size()) {
+        body_parts.pop_front();
+        body_offset = 0;
+      }
+    }
+    if (body_parts.empty()) {
+      if (is_body_finished) {
+        data_flags |= NGHTTP2_DATA_FLAG_EOF;
+      } else if (size == 0) {
+        is_deferred = true;
+        return NGHTTP2_ERR_DEFERRED;
+      }
+    }
+  } else {
+    size = std::min(length, data.size() - body_offset);
+    std::memcpy(buf, data.data() + body_offset, size);
+    body_offset += size;
+    if (body_offset == data.size()) data_flags |= NGHTTP2_DATA_FLAG_EOF;
+  }
+
+  sent_bytes += size;
+  return static_cast<ssize_t>(size);
+}
+
+struct Http2Session::Callbacks final {
+  static Http2Session& Self(void* user_data) {
+    UASSERT(user_data);
+    return *static_cast<Http2Session*>(user_data);
+  }
+
+  static int OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame,
+                            void* user_data) {
+    if (frame->hd.type != NGHTTP2_HEADERS ||
+        frame->headers.cat != NGHTTP2_HCAT_REQUEST) {
+      return 0;
+    }
+
+    auto& self = Self(user_data);
+    auto stream = std::make_unique<Stream>();
+    stream->request_constructor = std::make_unique<HttpRequestConstructor>(
+        self.request_constructor_config_, self.handler_info_index_,
+        self.data_accounter_);
+    stream->request_constructor->SetHttpMajor(2);
+    stream->request_constructor->SetHttpMinor(0);
+    ++self.stats_.parsing_request_count;
+    self.streams_[frame->hd.stream_id] = std::move(stream);
+    return 0;
+  }
+
+  static int OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                      const std::uint8_t* name, std::size_t name_size,
+                      const std::uint8_t* value, std::size_t value_size,
+                      std::uint8_t, void* user_data) {
+    // Trailers are ignored, as they are by the HTTP/1.1 parser
+    if (frame->hd.type != NGHTTP2_HEADERS ||
+        frame->headers.cat != NGHTTP2_HCAT_REQUEST) {
+      return 0;
+    }
+
+    auto& self = Self(user_data);
+    auto* stream = self.FindStream(frame->hd.stream_id);
+    if (!stream || !stream->request_constructor) return 0;
+
+    const auto header_name = ToStringView(name, name_size);
+    const auto header_value = ToStringView(value, value_size);
+    auto& constructor = *stream->request_constructor;
+    try {
+      // nghttp2 has already validated the headers, so that the pseudo
+      // headers go first and the names are in lowercase
+      if (!header_name.empty() && header_name.front() == ':') {
+        if (header_name == ":method") {
+          constructor.SetMethod(ParseHttpMethod(header_value));
+        } else if (header_name == ":path") {
+          constructor.AppendUrl(header_value.data(), header_value.size());
+        } else if (header_name == ":authority") {
+          stream->authority = header_value;
+        }
+        return 0;
+      }
+
+      self.CompletePseudoHeaders(*stream);
+      if (header_name == "cookie") {
+        // Split cookies are joined with "; " rather than with ", "
+        // (RFC 9113, 8.2.3)
+        if (!stream->cookies.empty()) stream->cookies += "; ";
+        stream->cookies += header_value;
+        return 0;
+      }
+      if (header_name == "host") stream->has_host_header = true;
+      constructor.AppendHeaderField(header_name.data(), header_name.size());
+      constructor.AppendHeaderValue(header_value.data(), header_value.size());
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't append header '" << header_name << "': " << ex;
+      self.FinalizeRequest(frame->hd.stream_id, *stream);
+    }
+    return 0;
+  }
+
+  static int OnFrameRecv(nghttp2_session*, const nghttp2_frame* frame,
+                         void* user_data) {
+    if (frame->hd.type != NGHTTP2_HEADERS && frame->hd.type != NGHTTP2_DATA) {
+      return 0;
+    }
+
+    auto& self = Self(user_data);
+    auto* stream = self.FindStream(frame->hd.stream_id);
+    if (!stream || !stream->request_constructor) return 0;
+
+    try {
+      if (frame->hd.type == NGHTTP2_HEADERS &&
+          frame->headers.cat == NGHTTP2_HCAT_REQUEST) {
+        auto& constructor = *stream->request_constructor;
+        self.CompletePseudoHeaders(*stream);
+        if (!stream->cookies.empty()) {
+          constructor.AppendHeaderField("cookie", 6);
+          constructor.AppendHeaderValue(stream->cookies.data(),
+                                        stream->cookies.size());
+        }
+        if (!stream->has_host_header && !stream->authority.empty()) {
+          constructor.AppendHeaderField("host", 4);
+          constructor.AppendHeaderValue(stream->authority.data(),
+                                        stream->authority.size());
+        }
+        constructor.AppendHeaderField("", 0);
+        LOG_TRACE() << "headers complete for stream " << frame->hd.stream_id;
+      }
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't complete headers: " << ex;
+      self.FinalizeRequest(frame->hd.stream_id, *stream);
+      return 0;
+    }
+
+    if (frame->hd.flags & NGHTTP2_FLAG_END_STREAM) {
+      self.FinalizeRequest(frame->hd.stream_id, *stream);
+    }
+    return 0;
+  }
+
+  static int OnDataChunkRecv(nghttp2_session*, std::uint8_t,
+                             std::int32_t stream_id, const std::uint8_t* data,
+                             std::size_t size, void* user_data) {
+    auto& self = Self(user_data);
+    auto* stream = self.FindStream(stream_id);
+    if (!stream || !stream->request_constructor) return 0;
+
+    try {
+      stream->request_constructor->AppendBody(
+          reinterpret_cast<const char*>(data), size);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "can't append body: " << ex;
+      self.FinalizeRequest(stream_id, *stream);
+    }
+    return 0;
+  }
+
+  static int OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                           std::uint32_t error_code, void* user_data) {
+    auto& self = Self(user_data);
+    const auto it = self.streams_.find(stream_id);
+    if (it == self.streams_.end()) return 0;
+
+    auto stream = std::move(it->second);
+    self.streams_.erase(it);
+
+    if (stream->request_constructor) {
+      // The peer has reset the stream before sending the whole request
+      --self.stats_.parsing_request_count;
+    } else if (stream->request) {
+      std::optional<std::size_t> sent_bytes;
+      if (error_code == NGHTTP2_NO_ERROR) sent_bytes = stream->sent_bytes;
+      self.on_stream_close_cb_(stream_id, sent_bytes);
+    }
+    return 0;
+  }
+
+  static ssize_t ReadData(nghttp2_session*, std::int32_t stream_id,
+                          std::uint8_t* buf, std::size_t length,
+                          std::uint32_t* data_flags, nghttp2_data_source*,
+                          void* user_data) {
+    auto* stream = Self(user_data).FindStream(stream_id);
+    if (!stream) return NGHTTP2_ERR_TEMPORAL_CALLBACK_FAILURE;
+    return stream->ReadBody(buf, length, *data_flags);
+  }
+};
+
+Http2Session::Http2Session(const HandlerInfoIndex& handler_info_index,
+                           const request::HttpRequestConfig& request_config,
+                           const net::Http2SessionConfig& session_config,
+                           OnNewRequestCb&& on_new_request_cb,
+                           OnStreamCloseCb&& on_stream_close_cb,
+                           net::ParserStats& stats,
+                           request::ResponseDataAccounter& data_accounter)
+    : handler_info_index_(handler_info_index),
+      request_constructor_config_{request_config},
+      on_new_request_cb_(std::move(on_new_request_cb)),
+      on_stream_close_cb_(std::move(on_stream_close_cb)),
+      stats_(stats),
+      data_accounter_(data_accounter) {
+  nghttp2_session_callbacks* callbacks = nullptr;
+  if (nghttp2_session_callbacks_new(&callbacks) != 0) {
+    throw std::bad_alloc();
+  }
+  nghttp2_session_callbacks_set_on_begin_headers_callback(
+      callbacks, &Callbacks::OnBeginHeaders);
+  nghttp2_session_callbacks_set_on_header_callback(callbacks,
+                                                   &Callbacks::OnHeader);
+  nghttp2_session_callbacks_set_on_frame_recv_callback(
+      callbacks, &Callbacks::OnFrameRecv);
+  nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+      callbacks, &Callbacks::OnDataChunkRecv);
+  nghttp2_session_callbacks_set_on_stream_close_callback(
+      callbacks, &Callbacks::OnStreamClose);
+
+  const int res = nghttp2_session_server_new(&session_, callbacks, this);
+  nghttp2_session_callbacks_del(callbacks);
+  if (res != 0) throw std::bad_alloc();
+
+  const nghttp2_settings_entry settings[] = {
+      {NGHTTP2_SETTINGS_MAX_CONCURRENT_STREAMS,
+       session_config.max_concurrent_streams},
+      {NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE,
+       session_config.initial_window_size},
+      {NGHTTP2_SETTINGS_MAX_FRAME_SIZE, session_config.max_frame_size},
+  };
+  if (nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, settings,
+                              std::size(settings)) != 0) {
+    nghttp2_session_del(session_);
+    throw std::runtime_error("invalid HTTP/2 session settings");
+  }
+  // The connection window defaults to 64KiB regardless of the settings
+  if (session_config.initial_window_size >
+      NGHTTP2_INITIAL_CONNECTION_WINDOW_SIZE) {
+    nghttp2_session_set_local_window_size(
+        session_, NGHTTP2_FLAG_NONE, 0,
+        static_cast<std::int32_t>(session_config.initial_window_size));
+  }
+}
+
+Http2Session::~Http2Session() {
+  for (const auto& [stream_id, stream] : streams_) {
+    if (stream->request_constructor) --stats_.parsing_request_count;
+  }
+  // The streams that are left are not reported as closed
+  streams_.clear();
+  nghttp2_session_del(session_);
+}
+
+bool Http2Session::Parse(const char* data, size_t size) {
+  const auto res = nghttp2_session_mem_recv(
+      session_, reinterpret_cast<const std::uint8_t*>(data), size);
+  if (res < 0) {
+    LOG_WARNING() << "HTTP/2 session error: " << nghttp2_strerror(res);
+    nghttp2_session_terminate_session(session_, NGHTTP2_PROTOCOL_ERROR);
+    return false;
+  }
+  return IsAlive();
+}
+
+void Http2Session::SubmitResponse(StreamId stream_id) {
+  auto* stream = FindStream(stream_id);
+  if (!stream) return;
+  UASSERT(stream->request);
+
+  auto& request = static_cast<HttpRequestImpl&>(*stream->request);
+  auto& response = request.GetHttpResponse();
+
+  std::vector<std::string> storage;
+  storage.reserve((response.headers_.size() + response.cookies_.size()) * 2 +
+                  8);
+  const auto add_header = [&storage](std::string name, std::string value) {
+    storage.push_back(std::move(name));
+    storage.push_back(std::move(value));
+  };
+
+  const auto status = static_cast<int>(response.status_);
+  add_header(":status", fmt::format(FMT_COMPILE("{}"), status));
+  const auto end = response.headers_.end();
+  if (response.headers_.find(USERVER_NAMESPACE::http::headers::kDate) == end) {
+    // impl::GetCachedDate() must not cross thread boundaries
+    add_header("date", std::string{impl::GetCachedDate()});
+  }
+  if (response.headers_.find(USERVER_NAMESPACE::http::headers::kContentType) ==
+          end &&
+      !response.HasStaticContentType()) {
+    add_header("content-type", std::string{kDefaultContentType});
+  }
+  for (const auto& [name, value] : response.headers_) {
+    auto lowercase_name = ToLowerAscii(name);
+    if (IsConnectionSpecificHeader(lowercase_name) ||
+        lowercase_name == "content-length") {
+      continue;
+    }
+    add_header(std::move(lowercase_name), value);
+  }
+  const auto static_headers = response.GetStaticHeaders();
+  for (std::size_t i = 0; i < static_headers.size(); ++i) {
+    const auto& headers = static_headers[i]->GetHeaders();
+    for (std::size_t j = 0; j < headers.size(); ++j) {
+      if (IsConnectionSpecificHeader(headers[j].lowercase_name) ||
+          static_headers[i]->IsOverridden(j, response.headers_,
+                                          static_headers.subspan(i + 1))) {
+        continue;
+      }
+      add_header(headers[j].lowercase_name, headers[j].value);
+    }
+  }
+  for (const auto& cookie : response.cookies_) {
+    add_header("set-cookie", cookie.second.ToString());
+  }
+
+  const bool is_body_forbidden = IsBodyForbiddenForStatus(response.status_);
+  const bool is_head_request = request.GetMethod() == HttpMethod::kHead;
+  const auto& data = response.GetData();
+  stream->is_streamed = response.IsBodyStreamed() && data.empty();
+  if (!stream->is_streamed) {
+    // The data is set instead of the file on errors
+    if (data.empty()) stream->file = response.file_body_.get();
+    stream->data = data;
+    if (!is_body_forbidden) {
+      add_header("content-length",
+                 fmt::format(FMT_COMPILE("{}"), stream->file
+                                                    ? stream->file->size
+                                                    : stream->data.size()));
+    }
+  }
+
+  std::vector<nghttp2_nv> nva;
+  nva.reserve(storage.size() / 2);
+  for (std::size_t i = 0; i < storage.size(); i += 2) {
+    nva.push_back(MakeNv(storage[i], storage[i + 1]));
+    stream->sent_bytes += storage[i].size() + storage[i + 1].size();
+  }
+
+  nghttp2_data_provider data_provider{};
+  data_provider.read_callback = &Callbacks::ReadData;
+  const bool has_body = !is_body_forbidden && !is_head_request;
+  const int res = nghttp2_submit_response(session_, stream_id, nva.data(),
+                                          nva.size(),
+                                          has_body ? &data_provider : nullptr);
+  if (res != 0) {
+    LOG_WARNING() << "Failed to submit the response of stream " << stream_id
+                  << ": " << nghttp2_strerror(res);
+    nghttp2_submit_rst_stream(session_, NGHTTP2_FLAG_NONE, stream_id,
+                              NGHTTP2_INTERNAL_ERROR);
+  }
+  if (!has_body) stream->is_streamed = false;
+}
+
+void Http2Session::AppendStreamedBody(StreamId stream_id,
+                                      std::string&& body_part) {
+  auto* stream = FindStream(stream_id);
+  if (!stream || !stream->is_streamed || body_part.empty()) return;
+  stream->body_parts.push_back(std::move(body_part));
+  ResumeData(stream_id);
+}
+
+void Http2Session::FinishStreamedBody(StreamId stream_id) {
+  auto* stream = FindStream(stream_id);
+  if (!stream || !stream->is_streamed) return;
+  stream->is_body_finished = true;
+  ResumeData(stream_id);
+}
+
+void Http2Session::Serialize(std::string& output, std::size_t max_size) {
+  while (!is_broken_ && output.size() < max_size) {
+    const std::uint8_t* data = nullptr;
+    const auto size = nghttp2_session_mem_send(session_, &data);
+    if (size < 0) {
+      LOG_WARNING() << "HTTP/2 session error: " << nghttp2_strerror(size);
+      is_broken_ = true;
+      break;
+    }
+    if (size == 0) break;
+    output.append(reinterpret_cast<const char*>(data), size);
+  }
+}
+
+bool Http2Session::IsAlive() const {
+  return !is_broken_ && (nghttp2_session_want_read(session_) ||
+                         nghttp2_session_want_write(session_));
+}
+
+void Http2Session::Terminate() {
+  nghttp2_session_terminate_session(session_, NGHTTP2_NO_ERROR);
+}
+
+bool Http2Session::PopStreamedBodyPart(HttpResponse& response,
+                                       std::string& body_part) {
+  UASSERT(response.body_stream_);
+  return response.body_stream_->Pop(body_part);
+}
+
+void Http2Session::SetResponseSent(HttpResponse& response,
+                                   std::size_t sent_bytes) {
+  response.SetSent(sent_bytes, std::chrono::steady_clock::now());
+}
+
+Http2Session::Stream* Http2Session::FindStream(StreamId stream_id) {
+  const auto it = streams_.find(stream_id);
+  return it == streams_.end() ? nullptr : it->second.get();
+}
+
+void Http2Session::CompletePseudoHeaders(Stream& stream) {
+  if (stream.is_pseudo_headers_complete) return;
+  stream.is_pseudo_headers_complete = true;
+  stream.request_constructor->ParseUrl();
+}
+
+void Http2Session::FinalizeRequest(StreamId stream_id, Stream& stream) {
+  UASSERT(stream.request_constructor);
+  auto request_constructor = std::move(stream.request_constructor);
+  --stats_.parsing_request_count;
+
+  // Finalize() reports the errors of the constructor with the response
+  stream.request = request_constructor->Finalize();
+  if (!stream.request) {
+    LOG_ERROR() << "request is null after Finalize()";
+    nghttp2_submit_rst_stream(session_, NGHTTP2_FLAG_NONE, stream_id,
+                              NGHTTP2_INTERNAL_ERROR);
+    return;
+  }
+  LOG_TRACE() << "request complete for stream " << stream_id;
+  on_new_request_cb_(stream_id, std::shared_ptr{stream.request});
+}
+
+void Http2Session::ResumeData(StreamId stream_id) {
+  auto* stream = FindStream(stream_id);
+  if (!stream || !stream->is_deferred) return;
+  stream->is_deferred = false;
+  nghttp2_session_resume_data(session_, stream_id);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <server/net/connection_config.hpp>
+#include <server/net/stats.hpp>
+#include <server/request/request_parser.hpp>
+
+#include <userver/server/request/request_config.hpp>
+
+#include "http_request_constructor.hpp"
+
+struct nghttp2_session;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpResponse;
+
+/// @brief Server side of an HTTP/2 connection on top of nghttp2.
+///
+/// Parse() consumes the bytes received from the peer and reports the
+/// completed requests of the streams, SubmitResponse() and friends queue the
+/// responses, Serialize() produces the bytes to send to the peer.
+///
+/// Does no I/O and is not thread safe, the caller is expected to guard it.
+class Http2Session final : public request::RequestParser {
+ public:
+  using StreamId = std::int32_t;
+
+  /// The ALPN protocol identifier of HTTP/2 over TLS
+  static constexpr std::string_view kAlpnProtocol = "h2";
+
+  /// The connection preface of HTTP/2 clients, in particular of the clients
+  /// with prior knowledge of HTTP/2 support by a plain text server
+  static constexpr std::string_view kClientPreface =
+      "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+
+  using OnNewRequestCb = std::function<void(
+      StreamId, std::shared_ptr<request::RequestBase>&&)>;
+
+  /// Called for the streams that were reported by OnNewRequestCb when they
+  /// are closed, `sent_bytes` is empty if the response was not sent
+  /// completely.
+  using OnStreamCloseCb =
+      std::function<void(StreamId, std::optional<std::size_t> sent_bytes)>;
+
+  Http2Session(const HandlerInfoIndex& handler_info_index,
+               const request::HttpRequestConfig& request_config,
+               const net::Http2SessionConfig& session_config,
+               OnNewRequestCb&& on_new_request_cb,
+               OnStreamCloseCb&& on_stream_close_cb, net::ParserStats& stats,
+               request::ResponseDataAccounter& data_accounter);
+  ~Http2Session() override;
+
+  /// Returns false on connection errors, the GOAWAY frame (if any) should
+  /// still be serialized and sent to the peer
+  bool Parse(const char* data, size_t size) override;
+
+  /// Queues the headers and the body of the response of the stream. A
+  /// streamed body is deferred until AppendStreamedBody or
+  /// FinishStreamedBody are called.
+  void SubmitResponse(StreamId stream_id);
+
+  void AppendStreamedBody(StreamId stream_id, std::string&& body_part);
+  void FinishStreamedBody(StreamId stream_id);
+
+  /// Appends the pending frames to `output` until it is at least `max_size`
+  /// long or there are no more frames to send
+  void Serialize(std::string& output, std::size_t max_size);
+
+  /// Returns false if both sides are done with the connection
+  bool IsAlive() const;
+
+  /// Queues GOAWAY, the streams that are already open are served
+  void Terminate();
+
+  /// Returns false when the handler has produced the whole streamed body
+  static bool PopStreamedBodyPart(HttpResponse& response,
+                                  std::string& body_part);
+
+  static void SetResponseSent(HttpResponse& response, std::size_t sent_bytes);
+
+ private:
+  struct Stream;
+  struct Callbacks;
+
+  Stream* FindStream(StreamId stream_id);
+
+  void CompletePseudoHeaders(Stream& stream);
+  void FinalizeRequest(StreamId stream_id, Stream& stream);
+  void ResumeData(StreamId stream_id);
+
+  const HandlerInfoIndex& handler_info_index_;
+  const HttpRequestConstructor::Config request_constructor_config_;
+  OnNewRequestCb on_new_request_cb_;
+  OnStreamCloseCb on_stream_close_cb_;
+  net::ParserStats& stats_;
+  request::ResponseDataAccounter& data_accounter_;
+
+  std::unordered_map<StreamId, std::unique_ptr<Stream>> streams_;
+  nghttp2_session* session_{nullptr};
+  bool is_broken_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
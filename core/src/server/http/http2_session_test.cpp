@@ -0,0 +1,433 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nghttp2/nghttp2.h>
+
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/text_light.hpp>
+
+#include <server/http/http2_session.hpp>
+#include <server/http/http_request_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::Http2Session;
+using StreamId = Http2Session::StreamId;
+
+constexpr std::string_view kHttp11Request =
+    "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+
+struct ClientStream {
+  std::map<std::string, std::string> headers;
+  std::string body;
+  std::optional<std::uint32_t> close_error_code;
+};
+
+// The peer of the server session, talks HTTP/2 with the real nghttp2 client
+class Http2Client final {
+ public:
+  Http2Client() {
+    nghttp2_session_callbacks* callbacks = nullptr;
+    nghttp2_session_callbacks_new(&callbacks);
+    nghttp2_session_callbacks_set_on_header_callback(callbacks, &OnHeader);
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(
+        callbacks, &OnDataChunkRecv);
+    nghttp2_session_callbacks_set_on_stream_close_callback(callbacks,
+                                                           &OnStreamClose);
+    nghttp2_session_client_new(&session_, callbacks, this);
+    nghttp2_session_callbacks_del(callbacks);
+    nghttp2_submit_settings(session_, NGHTTP2_FLAG_NONE, nullptr, 0);
+  }
+
+  ~Http2Client() { nghttp2_session_del(session_); }
+
+  Http2Client(const Http2Client&) = delete;
+  Http2Client& operator=(const Http2Client&) = delete;
+
+  StreamId SubmitRequest(std::string_view method, std::string_view path,
+                         std::optional<std::string> body = {}) {
+    const auto nva = MakeRequestHeaders(method, path);
+    if (!body) {
+      return nghttp2_submit_request(session_, nullptr, nva.data(), nva.size(),
+                                    nullptr, nullptr);
+    }
+
+    request_bodies_.push_back(std::make_unique<std::string>(*body));
+    nghttp2_data_provider data_provider{};
+    data_provider.source.ptr = request_bodies_.back().get();
+    data_provider.read_callback = &ReadRequestBody;
+    return nghttp2_submit_request(session_, nullptr, nva.data(), nva.size(),
+                                  &data_provider, nullptr);
+  }
+
+  // Sends the headers of a request with a body that is never sent
+  StreamId SubmitRequestHeaders(std::string_view method,
+                                std::string_view path) {
+    const auto nva = MakeRequestHeaders(method, path);
+    return nghttp2_submit_headers(session_, NGHTTP2_FLAG_NONE, -1, nullptr,
+                                  nva.data(), nva.size(), nullptr);
+  }
+
+  void SubmitRstStream(StreamId stream_id) {
+    nghttp2_submit_rst_stream(session_, NGHTTP2_FLAG_NONE, stream_id,
+                              NGHTTP2_CANCEL);
+  }
+
+  std::string Serialize() {
+    std::string output;
+    while (true) {
+      const std::uint8_t* data = nullptr;
+      const auto size = nghttp2_session_mem_send(session_, &data);
+      EXPECT_GE(size, 0) << nghttp2_strerror(static_cast<int>(size));
+      if (size <= 0) break;
+      output.append(reinterpret_cast<const char*>(data), size);
+    }
+    return output;
+  }
+
+  void Parse(std::string_view input) {
+    const auto res = nghttp2_session_mem_recv(
+        session_, reinterpret_cast<const std::uint8_t*>(input.data()),
+        input.size());
+    EXPECT_EQ(res, static_cast<ssize_t>(input.size()))
+        << nghttp2_strerror(static_cast<int>(res));
+  }
+
+  const ClientStream& GetStream(StreamId stream_id) {
+    return streams_[stream_id];
+  }
+
+ private:
+  static Http2Client& Self(void* user_data) {
+    return *static_cast<Http2Client*>(user_data);
+  }
+
+  static nghttp2_nv MakeNv(std::string_view name, std::string_view value) {
+    return {reinterpret_cast<std::uint8_t*>(const_cast<char*>(name.data())),
+            reinterpret_cast<std::uint8_t*>(const_cast<char*>(value.data())),
+            name.size(), value.size(), NGHTTP2_NV_FLAG_NONE};
+  }
+
+  static std::vector<nghttp2_nv> MakeRequestHeaders(std::string_view method,
+                                                    std::string_view path) {
+    return {MakeNv(":method", method), MakeNv(":scheme", "http"),
+            MakeNv(":authority", "localhost"), MakeNv(":path", path)};
+  }
+
+  static int OnHeader(nghttp2_session*, const nghttp2_frame* frame,
+                      const std::uint8_t* name, std::size_t name_size,
+                      const std::uint8_t* value, std::size_t value_size,
+                      std::uint8_t, void* user_data) {
+    Self(user_data).streams_[frame->hd.stream_id].headers.emplace(
+        std::string(reinterpret_cast<const char*>(name), name_size),
+        std::string(reinterpret_cast<const char*>(value), value_size));
+    return 0;
+  }
+
+  static int OnDataChunkRecv(nghttp2_session*, std::uint8_t,
+                             std::int32_t stream_id, const std::uint8_t* data,
+                             std::size_t size, void* user_data) {
+    Self(user_data).streams_[stream_id].body.append(
+        reinterpret_cast<const char*>(data), size);
+    return 0;
+  }
+
+  static int OnStreamClose(nghttp2_session*, std::int32_t stream_id,
+                           std::uint32_t error_code, void* user_data) {
+    Self(user_data).streams_[stream_id].close_error_code = error_code;
+    return 0;
+  }
+
+  static ssize_t ReadRequestBody(nghttp2_session*, std::int32_t,
+                                 std::uint8_t* buf, std::size_t length,
+                                 std::uint32_t* data_flags,
+                                 nghttp2_data_source* source, void*) {
+    auto& body = *static_cast<std::string*>(source->ptr);
+    const auto size = std::min(length, body.size());
+    std::memcpy(buf, body.data(), size);
+    body.erase(0, size);
+    if (body.empty()) *data_flags |= NGHTTP2_DATA_FLAG_EOF;
+    return static_cast<ssize_t>(size);
+  }
+
+  nghttp2_session* session_{nullptr};
+  std::map<StreamId, ClientStream> streams_;
+  std::vector<std::unique_ptr<std::string>> request_bodies_;
+};
+
+struct ServerRequest {
+  StreamId stream_id;
+  std::shared_ptr<server::request::RequestBase> request;
+};
+
+class Http2Server final {
+ public:
+  Http2Server()
+      : session_(
+            kHandlerInfoIndex, kRequestConfig, kSessionConfig,
+            [this](StreamId stream_id,
+                   std::shared_ptr<server::request::RequestBase>&& request) {
+              requests_.push_back({stream_id, std::move(request)});
+            },
+            [this](StreamId stream_id, std::optional<std::size_t> sent_bytes) {
+              closed_streams_.emplace(stream_id, sent_bytes);
+            },
+            stats_, data_accounter_) {}
+
+  Http2Session& GetSession() { return session_; }
+  const server::net::ParserStats& GetStats() const { return stats_; }
+  std::vector<ServerRequest>& GetRequests() { return requests_; }
+  const std::map<StreamId, std::optional<std::size_t>>& GetClosedStreams()
+      const {
+    return closed_streams_;
+  }
+
+  static server::http::HttpRequestImpl& GetRequestImpl(
+      const ServerRequest& request) {
+    return dynamic_cast<server::http::HttpRequestImpl&>(*request.request);
+  }
+
+ private:
+  static inline const server::http::HandlerInfoIndex kHandlerInfoIndex;
+  static constexpr server::request::HttpRequestConfig kRequestConfig{
+      /*.max_url_size = */ 8192,
+      /*.max_request_size = */ 1024 * 1024,
+      /*.max_headers_size = */ 65536,
+      /*.parse_args_from_body = */ false,
+      /*.testing_mode = */ true,  // non default value
+      /*.decompress_request = */ false,
+  };
+  static inline const server::net::Http2SessionConfig kSessionConfig;
+
+  server::net::ParserStats stats_;
+  server::request::ResponseDataAccounter data_accounter_;
+  std::vector<ServerRequest> requests_;
+  std::map<StreamId, std::optional<std::size_t>> closed_streams_;
+  Http2Session session_;
+};
+
+// Passes the frames between the peers until both have nothing to send
+void Exchange(Http2Client& client, Http2Server& server) {
+  while (true) {
+    const auto to_server = client.Serialize();
+    if (!to_server.empty()) {
+      EXPECT_TRUE(
+          server.GetSession().Parse(to_server.data(), to_server.size()));
+    }
+
+    std::string to_client;
+    server.GetSession().Serialize(to_client, 64 * 1024);
+    if (!to_client.empty()) client.Parse(to_client);
+
+    if (to_server.empty() && to_client.empty()) break;
+  }
+}
+
+}  // namespace
+
+TEST(Http2Session, ClientPreface) {
+  Http2Client client;
+  const auto first_bytes = client.Serialize();
+  EXPECT_TRUE(
+      utils::text::StartsWith(first_bytes, Http2Session::kClientPreface));
+
+  // The detection of the plain text HTTP/2 waits for more bytes while the
+  // received ones are a prefix of the preface
+  for (std::size_t i = 0; i < Http2Session::kClientPreface.size(); ++i) {
+    EXPECT_TRUE(utils::text::StartsWith(Http2Session::kClientPreface,
+                                        first_bytes.substr(0, i)));
+  }
+  EXPECT_FALSE(
+      utils::text::StartsWith(kHttp11Request, Http2Session::kClientPreface));
+  EXPECT_FALSE(utils::text::StartsWith(Http2Session::kClientPreface,
+                                       kHttp11Request.substr(0, 1)));
+}
+
+UTEST(Http2Session, NoClientPreface) {
+  Http2Server server;
+  EXPECT_FALSE(server.GetSession().Parse(kHttp11Request.data(),
+                                         kHttp11Request.size()));
+  EXPECT_TRUE(server.GetRequests().empty());
+
+  // GOAWAY is sent to the peer
+  std::string output;
+  server.GetSession().Serialize(output, 64 * 1024);
+  EXPECT_FALSE(output.empty());
+}
+
+UTEST(Http2Session, RequestResponse) {
+  Http2Client client;
+  Http2Server server;
+
+  const auto stream_id = client.SubmitRequest("POST", "/test?arg=value",
+                                              std::string{"request body"});
+  ASSERT_GT(stream_id, 0);
+  Exchange(client, server);
+
+  ASSERT_EQ(server.GetRequests().size(), 1);
+  const auto& server_request = server.GetRequests().front();
+  EXPECT_EQ(server_request.stream_id, stream_id);
+  EXPECT_EQ(server.GetStats().parsing_request_count.load(), 0);
+
+  auto& request = Http2Server::GetRequestImpl(server_request);
+  EXPECT_EQ(request.GetMethod(), server::http::HttpMethod::kPost);
+  EXPECT_EQ(request.GetRequestPath(), "/test");
+  EXPECT_EQ(request.GetArg("arg"), "value");
+  EXPECT_EQ(request.GetHeader("host"), "localhost");
+  EXPECT_EQ(request.RequestBody(), "request body");
+
+  auto& response = request.GetHttpResponse();
+  response.SetStatus(server::http::HttpStatus::kCreated);
+  response.SetHeader(std::string{"X-Header"}, "header value");
+  response.SetData("response body");
+  server.GetSession().SubmitResponse(stream_id);
+  EXPECT_TRUE(server.GetClosedStreams().empty());
+  Exchange(client, server);
+
+  const auto& client_stream = client.GetStream(stream_id);
+  EXPECT_EQ(client_stream.headers.at(":status"), "201");
+  EXPECT_EQ(client_stream.headers.at("x-header"), "header value");
+  EXPECT_EQ(client_stream.headers.at("content-length"), "13");
+  EXPECT_EQ(client_stream.headers.count("date"), 1);
+  EXPECT_EQ(client_stream.body, "response body");
+  EXPECT_EQ(client_stream.close_error_code, NGHTTP2_NO_ERROR);
+
+  ASSERT_EQ(server.GetClosedStreams().size(), 1);
+  const auto& sent_bytes = server.GetClosedStreams().at(stream_id);
+  ASSERT_TRUE(sent_bytes);
+  EXPECT_GT(*sent_bytes, std::string_view{"response body"}.size());
+  EXPECT_TRUE(server.GetSession().IsAlive());
+}
+
+UTEST(Http2Session, ConcurrentStreams) {
+  Http2Client client;
+  Http2Server server;
+
+  const auto first_id = client.SubmitRequest("GET", "/first");
+  const auto second_id = client.SubmitRequest("GET", "/second");
+  Exchange(client, server);
+  ASSERT_EQ(server.GetRequests().size(), 2);
+
+  // The responses are sent in any order
+  for (auto it = server.GetRequests().rbegin();
+       it != server.GetRequests().rend(); ++it) {
+    auto& request = Http2Server::GetRequestImpl(*it);
+    request.GetHttpResponse().SetData(request.GetRequestPath());
+    server.GetSession().SubmitResponse(it->stream_id);
+  }
+  Exchange(client, server);
+
+  EXPECT_EQ(client.GetStream(first_id).body, "/first");
+  EXPECT_EQ(client.GetStream(second_id).body, "/second");
+  EXPECT_EQ(server.GetClosedStreams().size(), 2);
+}
+
+UTEST(Http2Session, StreamedBody) {
+  Http2Client client;
+  Http2Server server;
+
+  const auto stream_id = client.SubmitRequest("GET", "/stream");
+  Exchange(client, server);
+  ASSERT_EQ(server.GetRequests().size(), 1);
+
+  auto& response =
+      Http2Server::GetRequestImpl(server.GetRequests().front())
+          .GetHttpResponse();
+  response.SetStreamBody();
+  server.GetSession().SubmitResponse(stream_id);
+  Exchange(client, server);
+
+  // The headers are sent right away, the body waits for the handler
+  const auto& client_stream = client.GetStream(stream_id);
+  EXPECT_EQ(client_stream.headers.at(":status"), "200");
+  EXPECT_EQ(client_stream.headers.count("content-length"), 0);
+  EXPECT_TRUE(client_stream.body.empty());
+  EXPECT_FALSE(client_stream.close_error_code);
+
+  server.GetSession().AppendStreamedBody(stream_id, "first ");
+  Exchange(client, server);
+  EXPECT_EQ(client_stream.body, "first ");
+  EXPECT_FALSE(client_stream.close_error_code);
+
+  server.GetSession().AppendStreamedBody(stream_id, "second ");
+  server.GetSession().AppendStreamedBody(stream_id, "third");
+  Exchange(client, server);
+  EXPECT_EQ(client_stream.body, "first second third");
+  EXPECT_TRUE(server.GetClosedStreams().empty());
+
+  server.GetSession().FinishStreamedBody(stream_id);
+  Exchange(client, server);
+  EXPECT_EQ(client_stream.body, "first second third");
+  EXPECT_EQ(client_stream.close_error_code, NGHTTP2_NO_ERROR);
+  ASSERT_EQ(server.GetClosedStreams().size(), 1);
+  EXPECT_TRUE(server.GetClosedStreams().at(stream_id));
+}
+
+UTEST(Http2Session, ResetBeforeRequestIsComplete) {
+  Http2Client client;
+  Http2Server server;
+
+  const auto stream_id = client.SubmitRequestHeaders("POST", "/reset");
+  ASSERT_GT(stream_id, 0);
+  Exchange(client, server);
+  EXPECT_TRUE(server.GetRequests().empty());
+  EXPECT_EQ(server.GetStats().parsing_request_count.load(), 1);
+
+  client.SubmitRstStream(stream_id);
+  Exchange(client, server);
+  EXPECT_TRUE(server.GetRequests().empty());
+  EXPECT_TRUE(server.GetClosedStreams().empty());
+  EXPECT_EQ(server.GetStats().parsing_request_count.load(), 0);
+
+  // The connection is still usable
+  const auto next_id = client.SubmitRequest("GET", "/next");
+  Exchange(client, server);
+  ASSERT_EQ(server.GetRequests().size(), 1);
+  EXPECT_EQ(server.GetRequests().front().stream_id, next_id);
+}
+
+UTEST(Http2Session, ResetBeforeResponseIsSent) {
+  Http2Client client;
+  Http2Server server;
+
+  const auto stream_id = client.SubmitRequest("GET", "/reset");
+  Exchange(client, server);
+  ASSERT_EQ(server.GetRequests().size(), 1);
+
+  client.SubmitRstStream(stream_id);
+  Exchange(client, server);
+  ASSERT_EQ(server.GetClosedStreams().size(), 1);
+  EXPECT_FALSE(server.GetClosedStreams().at(stream_id));
+
+  // The late response of the handler is dropped
+  server.GetSession().SubmitResponse(stream_id);
+  Exchange(client, server);
+  EXPECT_TRUE(client.GetStream(stream_id).headers.empty());
+}
+
+UTEST(Http2Session, Terminate) {
+  Http2Client client;
+  Http2Server server;
+
+  client.SubmitRequest("GET", "/");
+  Exchange(client, server);
+  ASSERT_EQ(server.GetRequests().size(), 1);
+
+  server.GetSession().Terminate();
+  Exchange(client, server);
+  EXPECT_FALSE(server.GetSession().IsAlive());
+}
+
+USERVER_NAMESPACE_END
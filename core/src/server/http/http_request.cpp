@@ -164,6 +164,14 @@ const std::string& HttpRequest::RequestBody() const {
   return impl_.RequestBody();
 }
 
+std::string_view HttpRequest::RequestBodyView() const {
+  return impl_.RequestBodyView();
+}
+
+RequestBodyStream& HttpRequest::GetBodyStream() const {
+  return impl_.GetBodyStream();
+}
+
 const HttpRequest::HeadersMap& HttpRequest::RequestHeaders() const {
   return impl_.GetHeaders();
 }
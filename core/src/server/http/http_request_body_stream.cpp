@@ -0,0 +1,25 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(
+    Queue::Consumer&& consumer,
+    std::shared_ptr<const std::atomic<bool>> is_complete)
+    : consumer_(std::move(consumer)), is_complete_(std::move(is_complete)) {
+  UASSERT(is_complete_);
+}
+
+bool RequestBodyStream::ReadChunk(std::string& output,
+                                  engine::Deadline deadline) {
+  return consumer_.Pop(output, deadline);
+}
+
+bool RequestBodyStream::IsComplete() const noexcept { return *is_complete_; }
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
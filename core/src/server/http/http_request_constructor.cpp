@@ -17,6 +17,10 @@ namespace server::http {
 
 namespace {
 
+// The smaller bodies are copied, that is cheaper than keeping the whole
+// connection buffer alive
+constexpr std::size_t kMinZeroCopyBodySize = 1024;
+
 inline void Strip(const char*& begin, const char*& end) {
   while (begin < end && isspace(*begin)) ++begin;
   while (begin < end && isspace(end[-1])) --end;
@@ -95,7 +99,7 @@ void HttpRequestConstructor::ParseUrl() {
   const auto* handler_info = match_result.handler_info;
 
   request_->SetMatchedPathLength(match_result.matched_path_length);
-  request_->SetPathArgs(std::move(match_result.args_from_path));
+  request_->SetPathArgs(match_result.args_from_path);
 
   if (!handler_info && request_->GetMethod() == HttpMethod::kOptions &&
       match_result.status == MatchRequestResult::Status::kMethodNotAllowed) {
@@ -111,6 +115,8 @@ void HttpRequestConstructor::ParseUrl() {
     config_.max_headers_size = handler_config.request_config.max_headers_size;
     config_.parse_args_from_body =
         handler_config.request_config.parse_args_from_body;
+    config_.zero_copy_body = handler_config.request_config.zero_copy_body;
+    is_body_streamed_ = handler_config.request_body_stream;
     if (handler_config.decompress_request) config_.decompress_request = true;
 
     request_->SetTaskProcessor(handler_info->task_processor);
@@ -161,10 +167,40 @@ void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
   request_->request_body_.append(data, size);
 }
 
+void HttpRequestConstructor::SetBody(
+    std::string_view body, const std::shared_ptr<const void>& buffer) {
+  if (!config_.zero_copy_body || body.size() < kMinZeroCopyBodySize) {
+    AppendBody(body.data(), body.size());
+    return;
+  }
+
+  AccountRequestSize(body.size());
+  UASSERT(request_->request_body_.empty());
+  request_->request_body_buffer_ = buffer;
+  request_->request_body_view_ = body;
+}
+
+void HttpRequestConstructor::SetBodyStream(RequestBodyStream&& body_stream) {
+  UASSERT(is_body_streamed_);
+  request_->SetBodyStream(std::move(body_stream));
+}
+
 void HttpRequestConstructor::SetIsFinal(bool is_final) {
   request_->is_final_ = is_final;
 }
 
+bool HttpRequestConstructor::Admit(const AdmitRequestCb& admit_request_cb) {
+  // The broken requests are answered without the handler anyway
+  if (status_ != Status::kOk) return true;
+
+  if (!admit_request_cb(*request_)) {
+    SetStatus(Status::kRejected);
+    return false;
+  }
+  request_->SetAdmitted();
+  return true;
+}
+
 std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
   LOG_TRACE() << "method=" << request_->GetMethodStr();
 
@@ -172,6 +208,20 @@ std::shared_ptr<request::RequestBase> HttpRequestConstructor::Finalize() {
 
   CheckStatus();
 
+  if (is_body_streamed_ && !request_->body_stream_) {
+    // The whole body was received before the headers were parsed
+    const auto queue = RequestBodyStream::Queue::Create();
+    auto producer = queue->GetProducer();
+    if (!request_->RequestBodyView().empty()) {
+      [[maybe_unused]] const bool pushed = producer.PushNoblock(
+          std::string{request_->RequestBodyView()});
+      UASSERT(pushed);
+      request_->SetRequestBody({});
+    }
+    request_->SetBodyStream(RequestBodyStream{
+        queue->GetConsumer(), std::make_shared<std::atomic<bool>>(true)});
+  }
+
   return std::move(request_);  // request_ is left empty
 }
 
@@ -188,10 +238,11 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   try {
     ParseArgs(parsed_url_);
-    if (config_.parse_args_from_body) {
-      if (!config_.decompress_request || !request_->IsBodyCompressed())
-        ParseArgs(request_->request_body_.data(),
-                  request_->request_body_.size());
+    if (config_.parse_args_from_body && !is_body_streamed_) {
+      if (!config_.decompress_request || !request_->IsBodyCompressed()) {
+        const auto body = request_->RequestBodyView();
+        ParseArgs(body.data(), body.size());
+      }
     }
   } catch (const std::exception& ex) {
     LOG_WARNING() << "can't parse args: " << ex;
@@ -199,11 +250,6 @@ void HttpRequestConstructor::FinalizeImpl() {
     return;
   }
 
-  UASSERT(std::all_of(request_->request_args_.begin(),
-                      request_->request_args_.end(),
-                      [](const auto& arg) { return !arg.second.empty(); }));
-
-  LOG_TRACE() << "request_args:" << request_->request_args_;
   LOG_TRACE() << "headers:" << request_->headers_;
 
   try {
@@ -218,7 +264,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
   const auto& content_type =
       request_->GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-  if (IsMultipartFormDataContentType(content_type)) {
+  if (IsMultipartFormDataContentType(content_type) && !is_body_streamed_) {
     if (!ParseMultipartFormData(content_type, request_->RequestBody(),
                                 request_->form_data_args_)) {
       SetStatus(Status::kParseMultipartFormDataError);
@@ -229,18 +275,19 @@ void HttpRequestConstructor::FinalizeImpl() {
 void HttpRequestConstructor::ParseArgs(const http_parser_url& url) {
   if (url.field_set & (1 << http_parser_url_fields::UF_QUERY)) {
     const auto& str_info = url.field_data[http_parser_url_fields::UF_QUERY];
-    ParseArgs(request_->url_.data() + str_info.off, str_info.len);
-    LOG_TRACE() << "query="
-                << request_->url_.substr(str_info.off, str_info.len);
+    const auto query =
+        std::string_view{request_->url_}.substr(str_info.off, str_info.len);
+    // The arguments are decoded by the request on the first access
+    USERVER_NAMESPACE::http::parser::ValidateArgs(query);
+    request_->raw_query_args_ = query;
+    LOG_TRACE() << "query=" << query;
   }
 }
 
 void HttpRequestConstructor::ParseArgs(const char* data, size_t size) {
-  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(
-      std::string_view(data, size),
-      [this](std::string&& key, std::string&& value) {
-        request_->request_args_[std::move(key)].push_back(std::move(value));
-      });
+  const std::string_view body{data, size};
+  USERVER_NAMESPACE::http::parser::ValidateArgs(body);
+  request_->raw_body_args_ = body;
 }
 
 void HttpRequestConstructor::AddHeader() {
@@ -398,6 +445,10 @@ void HttpRequestConstructor::CheckStatus() const {
           "invalid body of multipart/form-data request");
       request_->GetHttpResponse().SetReady();
       break;
+    case Status::kRejected:
+      // The response was set by the admission check
+      request_->GetHttpResponse().SetReady();
+      break;
   }
 }
 
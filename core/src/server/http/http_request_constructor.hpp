@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <string_view>
 
 #include <http_parser.h>
 
@@ -31,9 +33,11 @@ class HttpRequestConstructor final : public request::RequestConstructor {
     kParseArgsError,
     kParseCookiesError,
     kParseMultipartFormDataError,
+    kRejected,
   };
 
   using Config = server::request::HttpRequestConfig;
+  using AdmitRequestCb = std::function<bool(request::RequestBase&)>;
 
   HttpRequestConstructor(Config config,
                          const HandlerInfoIndex& handler_info_index,
@@ -51,9 +55,22 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   void AppendHeaderField(const char* data, size_t size);
   void AppendHeaderValue(const char* data, size_t size);
   void AppendBody(const char* data, size_t size);
+  // References the body in the `buffer` if `zero_copy_body` is enabled for
+  // the handler, copies it otherwise
+  void SetBody(std::string_view body,
+               const std::shared_ptr<const void>& buffer);
 
   void SetIsFinal(bool is_final);
 
+  // Must be called after the headers are parsed. Returns false if the request
+  // was rejected by the `admit_request_cb`, its body must be skipped then
+  bool Admit(const AdmitRequestCb& admit_request_cb);
+
+  // The handler has `request-body-stream: true`
+  bool IsBodyStreamed() const { return is_body_streamed_; }
+  // The body is pushed into the stream after Finalize()
+  void SetBodyStream(RequestBodyStream&& body_stream);
+
   std::shared_ptr<request::RequestBase> Finalize() override;
 
  private:
@@ -84,6 +101,7 @@ class HttpRequestConstructor final : public request::RequestConstructor {
   size_t url_size_ = 0;
   size_t headers_size_ = 0;
   bool url_parsed_ = false;
+  bool is_body_streamed_ = false;
   Status status_ = Status::kOk;
 
   std::shared_ptr<HttpRequestImpl> request_;
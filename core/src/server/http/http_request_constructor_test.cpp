@@ -15,4 +15,74 @@ TEST(HttpRequestConstructor, DecodeUrlPlus) {
   EXPECT_EQ("Some String", http::parser::UrlDecode(str));
 }
 
+TEST(HttpRequestConstructor, DecodeUrlLong) {
+  const std::string plain(100, 'x');
+  EXPECT_EQ(plain, http::parser::UrlDecode(plain));
+  EXPECT_EQ(plain + " " + plain + "/" + plain,
+            http::parser::UrlDecode(plain + "+" + plain + "%2F" + plain));
+}
+
+TEST(HttpRequestConstructor, DecodeUrlInvalid) {
+  for (const std::string_view str :
+       {"%", "a%2", "%2g", "%%20", "abcdefghijklmnopqrstuvwxyz%ZZ"}) {
+    EXPECT_THROW(http::parser::UrlDecode(str), std::runtime_error) << str;
+  }
+}
+
+namespace {
+
+using Args = std::vector<std::pair<std::string, std::string>>;
+
+Args ParseArgs(std::string_view args) {
+  Args result;
+  http::parser::ParseAndConsumeArgs(
+      args, [&result](std::string&& key, std::string&& value) {
+        result.emplace_back(std::move(key), std::move(value));
+      });
+  return result;
+}
+
+Args ParseArgsByName(std::string_view args, std::string_view name) {
+  Args result;
+  http::parser::ParseAndConsumeArgsByName(
+      args, name, [&result](std::string&& key, std::string&& value) {
+        result.emplace_back(std::move(key), std::move(value));
+      });
+  return result;
+}
+
+}  // namespace
+
+TEST(HttpRequestConstructor, ParseArgs) {
+  EXPECT_EQ(ParseArgs(""), Args{});
+  EXPECT_EQ(ParseArgs("a=1&b=&=2&c&d=x=y&&e+f=%41"),
+            (Args{{"a", "1"}, {"b", ""}, {"d", "x=y"}, {"e f", "A"}}));
+
+  std::string long_args;
+  Args expected;
+  for (int i = 0; i < 50; ++i) {
+    const auto index = std::to_string(i);
+    long_args += "argument" + index + "=value" + index + "&";
+    expected.emplace_back("argument" + index, "value" + index);
+  }
+  EXPECT_EQ(ParseArgs(long_args), expected);
+}
+
+TEST(HttpRequestConstructor, ParseArgsByName) {
+  constexpr std::string_view kArgs = "Arg=1&b=2&arg=3&ar%67=4&arg2=5&arg";
+  EXPECT_EQ(ParseArgsByName(kArgs, "arg"), (Args{{"arg", "3"}, {"arg", "4"}}));
+  EXPECT_EQ(ParseArgsByName(kArgs, "Arg"), (Args{{"Arg", "1"}}));
+  EXPECT_EQ(ParseArgsByName(kArgs, "ARG"), Args{});
+  EXPECT_EQ(ParseArgsByName(kArgs, "b"), (Args{{"b", "2"}}));
+  EXPECT_EQ(ParseArgsByName(kArgs, "c"), Args{});
+}
+
+TEST(HttpRequestConstructor, ValidateArgs) {
+  EXPECT_NO_THROW(http::parser::ValidateArgs("a=%20&b=+&c%41=1"));
+  // The arguments without names are skipped by ParseAndConsumeArgs
+  EXPECT_NO_THROW(http::parser::ValidateArgs("%zz&=%zz"));
+  EXPECT_THROW(http::parser::ValidateArgs("a=1&b=%2"), std::runtime_error);
+  EXPECT_THROW(http::parser::ValidateArgs("%zz=1"), std::runtime_error);
+}
+
 USERVER_NAMESPACE_END
@@ -50,7 +50,8 @@ HttpRequestHandler::HttpRequestHandler(
     bool is_monitor, std::string server_name)
     : add_handler_disabled_(false),
       is_monitor_(is_monitor),
-      server_name_(std::move(server_name)),
+      server_headers_({{std::string{USERVER_NAMESPACE::http::headers::kServer},
+                        std::move(server_name)}}),
       rate_limit_(utils::TokenBucket::MakeUnbounded()),
       metrics_(component_context.FindComponent<components::StatisticsStorage>()
                    .GetMetricsStorage()),
@@ -89,8 +90,7 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
       static_cast<const http::HttpRequestImpl&>(*request);
 
   auto& http_response = http_request.GetHttpResponse();
-  http_response.SetHeader(USERVER_NAMESPACE::http::headers::kServer,
-                          server_name_);
+  http_response.AddStaticHeaders(server_headers_);
   if (http_response.IsReady()) {
     // Request is broken somehow, user handler must not be called
     request->SetTaskCreateTime();
@@ -108,24 +108,72 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
     // by HttpRequestConstructor::CheckStatus
     return StartFailsafeTask(std::move(request));
   }
-  auto throttling_enabled = handler->GetConfig().throttling_enabled;
+  // The HTTP/1.1 requests are checked by AdmitRequest() before their body is
+  // received
+  if (!http_request.IsAdmitted() && !CheckThrottling(http_request)) {
+    return StartFailsafeTask(std::move(request));
+  }
+  const auto& config = config_source_.GetSnapshot();
+
+  if (handler->GetConfig().response_body_stream &&
+      config[handlers::kStreamApiEnabled]) {
+    http_response.SetStreamBody();
+  }
+
+  auto payload = [request = std::move(request), handler] {
+    server::request::kTaskInheritedRequest.Set(
+        std::static_pointer_cast<HttpRequestImpl>(request));
+
+    request->SetTaskStartTime();
+
+    request::RequestContext context;
+    handler->HandleRequest(*request, context);
+
+    const auto now = std::chrono::steady_clock::now();
+    request->SetResponseNotifyTime(now);
+    request->GetResponse().SetReady(now);
+  };
+
+  const auto throttling_enabled = handler->GetConfig().throttling_enabled;
+  const auto importance = !is_monitor_ && throttling_enabled
+                              ? engine::Task::Importance::kNormal
+                              : engine::Task::Importance::kCritical;
+  return engine::TaskWithResult<void>{engine::impl::MakeTask(
+      {*task_processor,
+       importance,
+       engine::Task::WaitMode::kSingleWaiter,
+       {},
+       handler->GetConfig().scheduling_class},
+      std::move(payload))};
+}  // namespace http
+
+bool HttpRequestHandler::AdmitRequest(request::RequestBase& request) const {
+  UASSERT(dynamic_cast<HttpRequestImpl*>(&request));
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+  return CheckThrottling(static_cast<const HttpRequestImpl&>(request));
+}
+
+bool HttpRequestHandler::CheckThrottling(
+    const HttpRequestImpl& http_request) const {
+  const auto* handler = http_request.GetHttpHandler();
+  if (!handler || !handler->GetConfig().throttling_enabled) return true;
+  auto& http_response = http_request.GetHttpResponse();
 
-  if (throttling_enabled && http_response.IsLimitReached()) {
+  if (http_response.IsLimitReached()) {
     SetThrottleReason(http_response, "Too many pending responses",
                       std::string{USERVER_NAMESPACE::http::headers::
                                       ratelimit_reason::kMaxPendingResponses});
 
     http_request.SetResponseStatus(HttpStatus::kTooManyRequests);
-    http_request.GetHttpResponse().SetReady();
-    request->SetTaskCreateTime();
+    http_response.SetReady();
     LOG_LIMITED_ERROR() << "Request throttled (too many pending responses, "
                            "limit via 'server.max_response_size_in_flight')";
-    return StartFailsafeTask(std::move(request));
+    return false;
   }
-  const auto& config = config_source_.GetSnapshot();
 
-  if (throttling_enabled && !rate_limit_.Obtain()) {
-    auto config_var = config[handlers::kCcCustomStatus];
+  if (!rate_limit_.Obtain()) {
+    const auto config = config_source_.GetSnapshot();
+    const auto& config_var = config[handlers::kCcCustomStatus];
     const auto& delta = config_var.max_time_delta;
 
     auto status = HttpStatus::kTooManyRequests;
@@ -151,34 +199,11 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(
         << "url=" << http_request.GetUrl()
         << ", status_code=" << static_cast<size_t>(status);
 
-    return StartFailsafeTask(std::move(request));
+    return false;
   }
 
-  if (handler->GetConfig().response_body_stream &&
-      config[handlers::kStreamApiEnabled]) {
-    http_response.SetStreamBody();
-  }
-
-  auto payload = [request = std::move(request), handler] {
-    server::request::kTaskInheritedRequest.Set(
-        std::static_pointer_cast<HttpRequestImpl>(request));
-
-    request->SetTaskStartTime();
-
-    request::RequestContext context;
-    handler->HandleRequest(*request, context);
-
-    const auto now = std::chrono::steady_clock::now();
-    request->SetResponseNotifyTime(now);
-    request->GetResponse().SetReady(now);
-  };
-
-  if (!is_monitor_ && throttling_enabled) {
-    return engine::AsyncNoSpan(*task_processor, std::move(payload));
-  } else {
-    return engine::CriticalAsyncNoSpan(*task_processor, std::move(payload));
-  }
-}  // namespace http
+  return true;
+}
 
 void HttpRequestHandler::DisableAddHandler() {
   const auto was_enabled = !add_handler_disabled_.exchange(true);
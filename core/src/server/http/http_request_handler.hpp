@@ -2,6 +2,7 @@
 
 #include <optional>
 
+#include <server/http/headers_block.hpp>
 #include <server/http/request_handler_base.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/engine/mutex.hpp>
@@ -18,6 +19,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
 
+class HttpRequestImpl;
+
 class HttpRequestHandler final : public RequestHandlerBase {
  public:
   HttpRequestHandler(
@@ -33,6 +36,8 @@ class HttpRequestHandler final : public RequestHandlerBase {
   engine::TaskWithResult<void> StartRequestTask(
       std::shared_ptr<request::RequestBase> request) const override;
 
+  bool AdmitRequest(request::RequestBase& request) const override;
+
   void DisableAddHandler();
   void AddHandler(const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
@@ -51,6 +56,9 @@ class HttpRequestHandler final : public RequestHandlerBase {
   void SetRpsRatelimitStatusCode(HttpStatus status_code);
 
  private:
+  // Returns false and sets the response if the server is overloaded
+  bool CheckThrottling(const HttpRequestImpl& http_request) const;
+
   logging::LoggerPtr logger_access_;
   logging::LoggerPtr logger_access_tskv_;
 
@@ -62,7 +70,8 @@ class HttpRequestHandler final : public RequestHandlerBase {
 
   std::atomic<bool> add_handler_disabled_;
   const bool is_monitor_;
-  const std::string server_name_;
+  // The Server header
+  const impl::HeadersBlock server_headers_;
   NewRequestHook new_request_hook_;
   mutable utils::TokenBucket rate_limit_;
   std::atomic<HttpStatus> cc_status_code_{HttpStatus::kTooManyRequests};
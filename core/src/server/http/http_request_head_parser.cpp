@@ -0,0 +1,275 @@
+#include <server/http/http_request_head_parser.hpp>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#include <http_parser.h>
+
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// http_parser rejects the heads that are larger
+#ifdef HTTP_MAX_HEADER_SIZE
+constexpr std::size_t kMaxHeadSize = HTTP_MAX_HEADER_SIZE;
+#else
+constexpr std::size_t kMaxHeadSize = 80 * 1024;
+#endif
+
+// Content-Length values that are longer do not fit into uint64_t
+constexpr std::size_t kMaxContentLengthDigits = 18;
+
+constexpr std::array<bool, 256> MakeTokenChars() {
+  std::array<bool, 256> result{};
+  for (char c = '0'; c <= '9'; ++c) {
+    result[static_cast<unsigned char>(c)] = true;
+  }
+  for (char c = 'a'; c <= 'z'; ++c) {
+    result[static_cast<unsigned char>(c)] = true;
+  }
+  for (char c = 'A'; c <= 'Z'; ++c) {
+    result[static_cast<unsigned char>(c)] = true;
+  }
+  for (char c : std::string_view{"!#$%&'*+-.^_`|~"}) {
+    result[static_cast<unsigned char>(c)] = true;
+  }
+  return result;
+}
+
+constexpr auto kTokenChars = MakeTokenChars();
+
+bool IsControl(unsigned char c, bool stop_at_space) noexcept {
+  return c < 0x20 || c == 0x7f || (stop_at_space && c == ' ');
+}
+
+HttpMethod ParseMethod(std::string_view method) noexcept {
+  switch (method.size()) {
+    case 3:
+      if (method == "GET") return HttpMethod::kGet;
+      if (method == "PUT") return HttpMethod::kPut;
+      break;
+    case 4:
+      if (method == "POST") return HttpMethod::kPost;
+      if (method == "HEAD") return HttpMethod::kHead;
+      break;
+    case 5:
+      if (method == "PATCH") return HttpMethod::kPatch;
+      break;
+    case 6:
+      if (method == "DELETE") return HttpMethod::kDelete;
+      break;
+    case 7:
+      if (method == "OPTIONS") return HttpMethod::kOptions;
+      break;
+  }
+  return HttpMethod::kUnknown;
+}
+
+bool ParseContentLength(std::string_view value, std::size_t& result) noexcept {
+  if (value.empty() || value.size() > kMaxContentLengthDigits) return false;
+  result = 0;
+  for (const char c : value) {
+    if (c < '0' || c > '9') return false;
+    result = result * 10 + (c - '0');
+  }
+  return true;
+}
+
+class HeadParser final {
+ public:
+  HeadParser(std::string_view data, RequestHead& head) noexcept
+      : data_(data.substr(0, kMaxHeadSize)), head_(head) {}
+
+  bool Parse() {
+    head_.headers.clear();
+    head_.content_length = 0;
+    return ParseRequestLine() && ParseHeaders();
+  }
+
+ private:
+  bool ParseRequestLine() noexcept {
+    const auto method_end = data_.find(' ');
+    if (method_end == std::string_view::npos) return false;
+    head_.method = ParseMethod(data_.substr(0, method_end));
+    if (head_.method == HttpMethod::kUnknown) return false;
+    pos_ = method_end + 1;
+
+    const auto url_end = pos_ + impl::FindControl(data_.substr(pos_), true);
+    if (url_end == pos_ || url_end >= data_.size() || data_[url_end] != ' ') {
+      return false;
+    }
+    head_.url = data_.substr(pos_, url_end - pos_);
+    pos_ = url_end + 1;
+
+    constexpr std::string_view kVersionPrefix = "HTTP/1.";
+    const auto version = data_.substr(pos_, kVersionPrefix.size() + 3);
+    if (version.size() != kVersionPrefix.size() + 3 ||
+        version.substr(0, kVersionPrefix.size()) != kVersionPrefix ||
+        version.substr(kVersionPrefix.size() + 1) != "\r\n") {
+      return false;
+    }
+    const char minor = version[kVersionPrefix.size()];
+    if (minor != '0' && minor != '1') return false;
+    head_.http_major = 1;
+    head_.http_minor = minor - '0';
+    head_.keep_alive = (minor == '1');
+    pos_ += version.size();
+    return true;
+  }
+
+  bool ParseHeaders() {
+    bool has_content_length = false;
+    while (true) {
+      if (pos_ + 2 > data_.size()) return false;
+      if (data_[pos_] == '\r') {
+        if (data_[pos_ + 1] != '\n') return false;
+        head_.size = pos_ + 2;
+        return true;
+      }
+
+      // Header name
+      const auto name_begin = pos_;
+      while (pos_ < data_.size() &&
+             kTokenChars[static_cast<unsigned char>(data_[pos_])]) {
+        ++pos_;
+      }
+      if (pos_ == name_begin || pos_ == data_.size() || data_[pos_] != ':') {
+        return false;
+      }
+      const auto name = data_.substr(name_begin, pos_ - name_begin);
+      ++pos_;
+
+      // Header value without the leading whitespace
+      while (pos_ < data_.size() && (data_[pos_] == ' ' || data_[pos_] == '\t'))
+        ++pos_;
+      const auto value_begin = pos_;
+      while (true) {
+        pos_ += impl::FindControl(data_.substr(pos_), false);
+        if (pos_ >= data_.size() || data_[pos_] != '\t') break;
+        ++pos_;
+      }
+      if (pos_ + 1 >= data_.size() || data_[pos_] != '\r' ||
+          data_[pos_ + 1] != '\n') {
+        return false;
+      }
+      const auto value = data_.substr(value_begin, pos_ - value_begin);
+      pos_ += 2;
+
+      if (!ProcessSpecialHeader(name, value, has_content_length)) return false;
+      head_.headers.emplace_back(name, value);
+    }
+  }
+
+  // Leaves the headers that affect the framing of the request to http_parser
+  bool ProcessSpecialHeader(std::string_view name, std::string_view value,
+                            bool& has_content_length) noexcept {
+    static const utils::StrIcaseEqual kEqual;
+    switch (name.size()) {
+      case 7:  // upgrade
+        return !kEqual(name, "upgrade");
+      case 10:  // connection
+        if (!kEqual(name, "connection")) return true;
+        if (kEqual(value, "close")) {
+          head_.keep_alive = false;
+        } else if (kEqual(value, "keep-alive")) {
+          head_.keep_alive = true;
+        } else {
+          return false;
+        }
+        return true;
+      case 14:  // content-length
+        if (!kEqual(name, "content-length")) return true;
+        if (has_content_length) return false;
+        has_content_length = true;
+        return ParseContentLength(value, head_.content_length);
+      case 16:  // proxy-connection
+        return !kEqual(name, "proxy-connection");
+      case 17:  // transfer-encoding
+        return !kEqual(name, "transfer-encoding");
+      default:
+        return true;
+    }
+  }
+
+  const std::string_view data_;
+  RequestHead& head_;
+  std::size_t pos_{0};
+};
+
+}  // namespace
+
+bool ParseRequestHead(std::string_view data, RequestHead& head) {
+  return HeadParser{data, head}.Parse();
+}
+
+namespace impl {
+
+std::size_t FindControl(std::string_view data, bool stop_at_space) noexcept {
+  const auto* const begin = reinterpret_cast<const unsigned char*>(data.data());
+  const auto size = data.size();
+  std::size_t i = 0;
+
+  // A byte `c` is found if `c <= max` or `c == DEL`
+  const unsigned char max = stop_at_space ? 0x20 : 0x1f;
+#if defined(__AVX2__)
+  const auto max_vector = _mm256_set1_epi8(static_cast<char>(max));
+  const auto del_vector = _mm256_set1_epi8(0x7f);
+  for (; i + 32 <= size; i += 32) {
+    const auto chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + i));
+    const auto found = _mm256_or_si256(
+        _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, max_vector), chunk),
+        _mm256_cmpeq_epi8(chunk, del_vector));
+    const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(found));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+#elif defined(__SSE2__)
+  const auto max_vector = _mm_set1_epi8(static_cast<char>(max));
+  const auto del_vector = _mm_set1_epi8(0x7f);
+  for (; i + 16 <= size; i += 16) {
+    const auto chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i));
+    const auto found =
+        _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(chunk, max_vector), chunk),
+                     _mm_cmpeq_epi8(chunk, del_vector));
+    const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(found));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  const auto max_vector = vdupq_n_u8(max);
+  const auto del_vector = vdupq_n_u8(0x7f);
+  for (; i + 16 <= size; i += 16) {
+    const auto chunk = vld1q_u8(begin + i);
+    const auto found = vorrq_u8(vcleq_u8(chunk, max_vector),
+                                vceqq_u8(chunk, del_vector));
+    // 4 bits per byte
+    const auto mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(found), 4)), 0);
+    if (mask != 0) return i + __builtin_ctzll(mask) / 4;
+  }
+#endif
+
+  for (; i < size; ++i) {
+    if (IsControl(begin[i], stop_at_space)) return i;
+  }
+  return size;
+}
+
+}  // namespace impl
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <userver/server/http/http_method.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+// The request line and the headers of a request, the views point into the
+// parsed buffer.
+struct RequestHead final {
+  using Header = std::pair<std::string_view, std::string_view>;
+
+  HttpMethod method{HttpMethod::kUnknown};
+  std::string_view url;
+  unsigned short http_major{0};
+  unsigned short http_minor{0};
+  // In the order of the request, the values are left-trimmed as http_parser
+  // does
+  std::vector<Header> headers;
+  std::size_t content_length{0};
+  bool keep_alive{false};
+  // The size of the request line and the headers including the final CRLF
+  std::size_t size{0};
+};
+
+// Parses the head of a request that is entirely in `data`, scanning for the
+// delimiters with SIMD. Only handles the common requests: a known method
+// except CONNECT, HTTP/1.0 or HTTP/1.1, CRLF line endings, no folded headers,
+// optional Content-Length, no Transfer-Encoding and no Upgrade.
+//
+// Returns false if the head is incomplete, malformed or uncommon, http_parser
+// should be used for such requests. `head` is reused to avoid allocations.
+bool ParseRequestHead(std::string_view data, RequestHead& head);
+
+namespace impl {
+
+// Returns the position of the first byte that is a control character or
+// DEL, or is a space if `stop_at_space`, or `data.size()` if there are none.
+std::size_t FindControl(std::string_view data, bool stop_at_space) noexcept;
+
+}  // namespace impl
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
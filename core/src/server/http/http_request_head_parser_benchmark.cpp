@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <fmt/format.h>
+
+#include <server/http/http_request_head_parser.hpp>
+#include <server/http/http_request_parser.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string MakeRequest(std::int64_t headers_count) {
+  std::string result = "GET /v1/some/handler?arg=value HTTP/1.1\r\n";
+  for (std::int64_t i = 0; i < headers_count; ++i) {
+    result += fmt::format("X-Test-Header-{}: some header value {}\r\n", i, i);
+  }
+  result += "\r\n";
+  return result;
+}
+
+void http_request_head_parser(benchmark::State& state) {
+  const auto request = MakeRequest(state.range(0));
+  server::http::RequestHead head;
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(server::http::ParseRequestHead(request, head));
+    benchmark::DoNotOptimize(head);
+  }
+  state.SetBytesProcessed(state.iterations() * request.size());
+}
+
+// The last byte is sent separately, so the request goes through http_parser
+void http_request_parser(benchmark::State& state, bool split) {
+  engine::RunStandalone([&] {
+    const auto request = MakeRequest(state.range(0));
+    const server::http::HandlerInfoIndex handler_info_index;
+    const server::request::HttpRequestConfig config{};
+    server::net::ParserStats stats;
+    server::request::ResponseDataAccounter accounter;
+    std::size_t count = 0;
+    server::http::HttpRequestParser parser(
+        handler_info_index, config,
+        [&count](std::shared_ptr<server::request::RequestBase>&&) { ++count; },
+        stats, accounter);
+
+    const auto first_size = split ? request.size() - 1 : request.size();
+    for ([[maybe_unused]] auto _ : state) {
+      parser.Parse(request.data(), first_size);
+      if (split) parser.Parse(request.data() + first_size, 1);
+    }
+    benchmark::DoNotOptimize(count);
+    state.SetBytesProcessed(state.iterations() * request.size());
+  });
+}
+
+}  // namespace
+
+BENCHMARK(http_request_head_parser)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK_CAPTURE(http_request_parser, fast, false)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+BENCHMARK_CAPTURE(http_request_parser, http_parser, true)
+    ->RangeMultiplier(4)
+    ->Range(1, 64);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,115 @@
+#include <server/http/http_request_head_parser.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::HttpMethod;
+using server::http::ParseRequestHead;
+using server::http::RequestHead;
+
+std::size_t FindControlNaive(std::string_view data, bool stop_at_space) {
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    const auto c = static_cast<unsigned char>(data[i]);
+    if (c < 0x20 || c == 0x7f || (stop_at_space && c == ' ')) return i;
+  }
+  return data.size();
+}
+
+}  // namespace
+
+TEST(HttpRequestHeadParser, Basic) {
+  const std::string_view request =
+      "POST /path?a=b HTTP/1.1\r\n"
+      "Host: example.com\r\n"
+      "X-Value:  \t spaces \t inside  \r\n"
+      "Empty:\r\n"
+      "Content-Length: 4\r\n"
+      "\r\n"
+      "body";
+
+  RequestHead head;
+  ASSERT_TRUE(ParseRequestHead(request, head));
+  EXPECT_EQ(head.method, HttpMethod::kPost);
+  EXPECT_EQ(head.url, "/path?a=b");
+  EXPECT_EQ(head.http_major, 1);
+  EXPECT_EQ(head.http_minor, 1);
+  EXPECT_TRUE(head.keep_alive);
+  EXPECT_EQ(head.content_length, 4);
+  EXPECT_EQ(request.substr(head.size), "body");
+
+  const std::vector<RequestHead::Header> expected_headers{
+      {"Host", "example.com"},
+      {"X-Value", "spaces \t inside  "},
+      {"Empty", ""},
+      {"Content-Length", "4"},
+  };
+  EXPECT_EQ(head.headers, expected_headers);
+}
+
+TEST(HttpRequestHeadParser, KeepAlive) {
+  RequestHead head;
+  ASSERT_TRUE(ParseRequestHead("GET / HTTP/1.0\r\n\r\n", head));
+  EXPECT_FALSE(head.keep_alive);
+
+  ASSERT_TRUE(ParseRequestHead(
+      "GET / HTTP/1.0\r\nConnection: Keep-Alive\r\n\r\n", head));
+  EXPECT_TRUE(head.keep_alive);
+
+  ASSERT_TRUE(
+      ParseRequestHead("GET / HTTP/1.1\r\nconnection: close\r\n\r\n", head));
+  EXPECT_FALSE(head.keep_alive);
+}
+
+TEST(HttpRequestHeadParser, Fallback) {
+  const std::string_view requests[] = {
+      "",
+      "GET / HTTP/1.1\r\nHost: example.com\r\n",
+      "GET / HTTP/1.1\r\nHost: exa",
+      "GET / HTTP/1.1\r\n\r",
+      "GET / HTTP/1.1\n\n",
+      "GET / HTTP/1.1\r\nHost: example.com\n\r\n",
+      "GET / HTTP/2.0\r\n\r\n",
+      "GET  / HTTP/1.1\r\n\r\n",
+      "GET / HTTP/1.1 \r\n\r\n",
+      "PURGE / HTTP/1.1\r\n\r\n",
+      "CONNECT example.com:443 HTTP/1.1\r\n\r\n",
+      "GET / HTTP/1.1\r\nHost : example.com\r\n\r\n",
+      "GET / HTTP/1.1\r\nX: a\r\n folded\r\n\r\n",
+      "GET / HTTP/1.1\r\nX: a\x01\r\n\r\n",
+      "GET / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n",
+      "GET / HTTP/1.1\r\nUpgrade: websocket\r\n\r\n",
+      "GET / HTTP/1.1\r\nConnection: close, te\r\n\r\n",
+      "GET / HTTP/1.1\r\nContent-Length: 1x\r\n\r\n",
+      "GET / HTTP/1.1\r\nContent-Length: 1\r\nContent-Length: 1\r\n\r\n",
+  };
+
+  for (const auto request : requests) {
+    RequestHead head;
+    EXPECT_FALSE(ParseRequestHead(request, head)) << request;
+  }
+}
+
+TEST(HttpRequestHeadParser, FindControl) {
+  for (std::size_t size = 0; size < 100; ++size) {
+    for (std::size_t pos = 0; pos <= size; ++pos) {
+      for (const char c : {'\r', '\0', '\x7f', ' ', '\t'}) {
+        std::string data(size, 'a');
+        if (pos < size) data[pos] = c;
+        data.push_back('\x80');
+
+        for (const bool stop_at_space : {false, true}) {
+          EXPECT_EQ(server::http::impl::FindControl(data, stop_at_space),
+                    FindControlNaive(data, stop_at_space))
+              << "size=" << size << " pos=" << pos;
+        }
+      }
+    }
+  }
+}
+
+USERVER_NAMESPACE_END
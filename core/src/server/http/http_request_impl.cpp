@@ -75,10 +75,12 @@ namespace server::http {
 // unordered_maps because we don't need different seeds and want to avoid its
 // overhead.
 HttpRequestImpl::HttpRequestImpl(request::ResponseDataAccounter& data_accounter)
-    : form_data_args_(kZeroAllocationBucketCount,
+    : request_args_(kZeroAllocationBucketCount),
+      form_data_args_(kZeroAllocationBucketCount,
                       request_args_.hash_function()),
       path_args_by_name_index_(kZeroAllocationBucketCount,
-                               request_args_.hash_function()),
+                               request_args_.hash_function(), std::equal_to<>{},
+                               utils::ArenaAllocator<char>{GetArena()}),
       headers_(kBucketCount),
       cookies_(kZeroAllocationBucketCount, request_args_.hash_function()),
       response_(*this, data_accounter) {}
@@ -98,29 +100,31 @@ const std::string& HttpRequestImpl::GetHost() const {
 }
 
 const std::string& HttpRequestImpl::GetArg(std::string_view arg_name) const {
-  const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
+  const auto* ptr = FindArg(arg_name);
   if (!ptr) return kEmptyString;
   return ptr->at(0);
 }
 
 const std::vector<std::string>& HttpRequestImpl::GetArgVector(
     std::string_view arg_name) const {
-  const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
+  const auto* ptr = FindArg(arg_name);
   if (!ptr) return kEmptyVector;
   return *ptr;
 }
 
 bool HttpRequestImpl::HasArg(std::string_view arg_name) const {
-  const auto* ptr =
-      utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
-  return !!ptr;
+  return FindArg(arg_name) != nullptr;
 }
 
-size_t HttpRequestImpl::ArgCount() const { return request_args_.size(); }
+size_t HttpRequestImpl::ArgCount() const {
+  const std::lock_guard lock{request_args_mutex_};
+  ParseAllArgs();
+  return request_args_.size();
+}
 
 std::vector<std::string> HttpRequestImpl::ArgNames() const {
+  const std::lock_guard lock{request_args_mutex_};
+  ParseAllArgs();
   std::vector<std::string> res;
   res.reserve(request_args_.size());
   for (const auto& arg : request_args_) res.push_back(arg.first);
@@ -253,18 +257,92 @@ const HttpRequest::CookiesMap& HttpRequestImpl::GetCookies() const {
   return cookies_;
 }
 
+const std::string& HttpRequestImpl::RequestBody() const {
+  if (request_body_buffer_) {
+    std::call_once(request_body_copy_once_, [this] {
+      request_body_.assign(request_body_view_);
+    });
+  }
+  return request_body_;
+}
+
+std::string_view HttpRequestImpl::RequestBodyView() const noexcept {
+  if (request_body_buffer_) return request_body_view_;
+  return request_body_;
+}
+
+RequestBodyStream& HttpRequestImpl::GetBodyStream() const {
+  if (!body_stream_) {
+    throw std::logic_error(
+        "GetBodyStream() is called, but `request-body-stream` is not enabled "
+        "for the handler");
+  }
+  return *body_stream_;
+}
+
+void HttpRequestImpl::SetBodyStream(RequestBodyStream&& body_stream) {
+  UASSERT(!body_stream_);
+  body_stream_.emplace(std::move(body_stream));
+}
+
 void HttpRequestImpl::SetRequestBody(std::string body) {
+  if (!raw_body_args_.empty()) {
+    // The raw arguments reference the old body
+    const std::lock_guard lock{request_args_mutex_};
+    ParseAllArgs();
+    raw_body_args_ = {};
+  }
   request_body_ = std::move(body);
+  request_body_buffer_.reset();
+  request_body_view_ = {};
 }
 
 void HttpRequestImpl::ParseArgsFromBody() {
+  const std::lock_guard lock{request_args_mutex_};
   UASSERT_MSG(
-      request_args_.empty(),
+      request_args_.empty() && !are_all_args_parsed_,
       "References to arguments could be invalidated by ParseArgsFromBody()");
-  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(
-      request_body_, [this](std::string&& key, std::string&& value) {
-        request_args_[std::move(key)].push_back(std::move(value));
-      });
+  const auto body = RequestBodyView();
+  USERVER_NAMESPACE::http::parser::ValidateArgs(body);
+  raw_body_args_ = body;
+}
+
+const std::vector<std::string>* HttpRequestImpl::FindArg(
+    std::string_view arg_name) const {
+  const std::lock_guard lock{request_args_mutex_};
+  const auto* ptr =
+      utils::impl::FindTransparentOrNullptr(request_args_, arg_name);
+  if (ptr || are_all_args_parsed_) return ptr;
+
+  std::vector<std::string> values;
+  const auto consume = [&values](std::string&&, std::string&& value) {
+    values.push_back(std::move(value));
+  };
+  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgsByName(raw_query_args_,
+                                                             arg_name, consume);
+  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgsByName(raw_body_args_,
+                                                             arg_name, consume);
+  if (values.empty()) return nullptr;
+  return &request_args_.emplace(std::string{arg_name}, std::move(values))
+              .first->second;
+}
+
+void HttpRequestImpl::ParseAllArgs() const {
+  if (are_all_args_parsed_) return;
+
+  // The arguments decoded by FindArg() are complete and may be referenced
+  // already, so only the missing ones are merged
+  decltype(request_args_) args(kZeroAllocationBucketCount,
+                               request_args_.hash_function());
+  const auto consume = [&args](std::string&& key, std::string&& value) {
+    args[std::move(key)].push_back(std::move(value));
+  };
+  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(raw_query_args_,
+                                                       consume);
+  USERVER_NAMESPACE::http::parser::ParseAndConsumeArgs(raw_body_args_,
+                                                       consume);
+  request_args_.merge(args);
+  are_all_args_parsed_ = true;
 }
 
 bool HttpRequestImpl::IsBodyCompressed() const {
@@ -279,15 +357,16 @@ void HttpRequestImpl::DoUpgrade(std::unique_ptr<engine::io::RwBase>&& socket,
 }
 
 void HttpRequestImpl::SetPathArgs(
-    std::vector<std::pair<std::string, std::string>> args) {
+    utils::span<const std::pair<std::string_view, std::string_view>> args) {
   path_args_.clear();
   path_args_.reserve(args.size());
 
   path_args_by_name_index_.clear();
-  for (auto& [name, value] : args) {
-    path_args_.push_back(std::move(value));
+  for (const auto& [name, value] : args) {
+    path_args_.emplace_back(value);
     if (!name.empty()) {
-      path_args_by_name_index_[std::move(name)] = path_args_.size() - 1;
+      utils::impl::TransparentInsertOrAssign(path_args_by_name_index_, name,
+                                             path_args_.size() - 1);
     }
   }
 }
@@ -2,7 +2,10 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -12,8 +15,10 @@
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_base.hpp>
+#include <userver/utils/arena.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/span.hpp>
 #include <userver/utils/str_icase.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -82,7 +87,10 @@ class HttpRequestImpl final : public request::RequestBase {
   HttpRequest::CookiesMapKeys GetCookieNames() const;
   const HttpRequest::CookiesMap& GetCookies() const;
 
-  const std::string& RequestBody() const { return request_body_; }
+  const std::string& RequestBody() const;
+  std::string_view RequestBodyView() const noexcept;
+  RequestBodyStream& GetBodyStream() const;
+  void SetBodyStream(RequestBodyStream&& body_stream);
   void SetRequestBody(std::string body);
   void ParseArgsFromBody();
   void SetResponseStatus(HttpStatus status) const {
@@ -120,7 +128,8 @@ class HttpRequestImpl final : public request::RequestBase {
                           utils::datetime::WallCoarseClock::time_point tp,
                           const std::string& remote_address) const;
 
-  void SetPathArgs(std::vector<std::pair<std::string, std::string>> args);
+  void SetPathArgs(
+      utils::span<const std::pair<std::string_view, std::string_view>> args);
 
   void SetMatchedPathLength(size_t length) override;
 
@@ -136,28 +145,58 @@ class HttpRequestImpl final : public request::RequestBase {
 
   void SetHttpHandlerStatistics(handlers::HttpRequestStatistics&);
 
+  // The overload checks of the server were passed right after the headers
+  // were parsed, see RequestHandlerBase::AdmitRequest()
+  void SetAdmitted() { is_admitted_ = true; }
+  bool IsAdmitted() const { return is_admitted_; }
+
   friend class HttpRequestConstructor;
 
  private:
+  // The nodes of the maps are allocated in the arena of the request
+  template <typename Value>
+  using ArenaMap = utils::impl::TransparentMap<
+      std::string, Value, utils::StrCaseHash, std::equal_to<>,
+      utils::ArenaAllocator<std::pair<const std::string, Value>>>;
+
+  const std::vector<std::string>* FindArg(std::string_view arg_name) const;
+  // request_args_mutex_ must be locked
+  void ParseAllArgs() const;
+
   HttpMethod method_{HttpMethod::kUnknown};
   unsigned short http_major_{1};
   unsigned short http_minor_{1};
   std::string url_;
   std::string request_path_;
-  std::string request_body_;
+  // Set if the body references the connection buffer, the body is copied
+  // into request_body_ on the first call to RequestBody()
+  mutable std::string request_body_;
+  std::shared_ptr<const void> request_body_buffer_;
+  std::string_view request_body_view_;
+  mutable std::once_flag request_body_copy_once_;
+  // Set for the handlers with `request-body-stream: true`
+  mutable std::optional<RequestBodyStream> body_stream_;
   std::string path_suffix_;
-  utils::impl::TransparentMap<std::string, std::vector<std::string>,
-                              utils::StrCaseHash>
+  // Validated query and body arguments. They are decoded into request_args_
+  // on the first access by name, or all at once by ArgCount() and ArgNames().
+  // The const getters may be called from several tasks, so request_args_ is
+  // allocated on the heap rather than in the single-threaded request arena.
+  std::string_view raw_query_args_;
+  std::string_view raw_body_args_;
+  mutable std::mutex request_args_mutex_;
+  mutable utils::impl::TransparentMap<std::string, std::vector<std::string>,
+                                      utils::StrCaseHash>
       request_args_;
+  mutable bool are_all_args_parsed_{false};
   utils::impl::TransparentMap<std::string, std::vector<FormDataArg>,
                               utils::StrCaseHash>
       form_data_args_;
   std::vector<std::string> path_args_;
-  utils::impl::TransparentMap<std::string, size_t, utils::StrCaseHash>
-      path_args_by_name_index_;
+  ArenaMap<size_t> path_args_by_name_index_;
   HttpRequest::HeadersMap headers_;
   HttpRequest::CookiesMap cookies_;
   bool is_final_{false};
+  bool is_admitted_{false};
   UpgradeCallback upgrade_websocket_cb_;
 
   mutable HttpResponse response_;
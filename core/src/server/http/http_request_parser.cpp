@@ -1,9 +1,12 @@
 #include "http_request_parser.hpp"
 
+#include <climits>
+
 #include <userver/logging/log.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -11,6 +14,9 @@ namespace server::http {
 
 namespace {
 
+// The pushes into the body stream wait while this much is not read
+constexpr std::size_t kMaxBodyStreamQueueSize = 1024 * 1024;
+
 HttpMethod ConvertHttpMethod(http_method method) {
   switch (method) {
     case HTTP_DELETE:
@@ -52,23 +58,56 @@ HttpRequestParser::HttpRequestParser(
     const HandlerInfoIndex& handler_info_index,
     const request::HttpRequestConfig& request_config,
     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-    request::ResponseDataAccounter& data_accounter)
+    request::ResponseDataAccounter& data_accounter,
+    AdmitRequestCb admit_request_cb)
     : handler_info_index_(handler_info_index),
       request_constructor_config_{request_config},
       on_new_request_cb_(std::move(on_new_request_cb)),
+      admit_request_cb_(std::move(admit_request_cb)),
       stats_(stats),
       data_accounter_(data_accounter) {
   http_parser_init(&parser_, HTTP_REQUEST);
   parser_.data = this;
 }
 
+bool HttpRequestParser::Parse(const char* data, size_t size,
+                              std::shared_ptr<const void> buffer) {
+  input_buffer_ = std::move(buffer);
+  utils::FastScopeGuard reset_buffer([this]() noexcept {
+    input_buffer_.reset();
+  });
+  return Parse(data, size);
+}
+
 bool HttpRequestParser::Parse(const char* data, size_t size) {
+  // http_parser is used for the requests that were started in the previous
+  // reads, the ones that do not fit into this read and the uncommon ones
+  while (!request_constructor_ && !body_stream_producer_ &&
+         !is_skipping_body_ && size != 0) {
+    if (is_closed_) {
+      LOG_WARNING() << "data after the final request, size=" << size;
+      return false;
+    }
+
+    std::size_t request_size = 0;
+    const auto result = ParseFast({data, size}, request_size);
+    if (result == FastParseResult::kError) return false;
+    if (result == FastParseResult::kFallback) break;
+    data += request_size;
+    size -= request_size;
+  }
+  if (size == 0) return true;
+
   size_t parsed = http_parser_execute(&parser_, &parser_settings, data, size);
   if (parsed != size) {
     LOG_WARNING() << "parsed=" << parsed << " size=" << size
                   << " error_description="
                   << http_errno_description(HTTP_PARSER_ERRNO(&parser_));
-    FinalizeRequest();
+    if (body_stream_producer_) {
+      StopBodyStream(false);
+    } else if (!is_skipping_body_) {
+      FinalizeRequest();
+    }
     return false;
   }
   if (parser_.upgrade) {
@@ -181,11 +220,27 @@ int HttpRequestParser::OnHeadersCompleteImpl(http_parser* p) {
     return -1;
   }
   LOG_TRACE() << "headers complete";
+  // The upgrade requests have no body, they are checked before the handler
+  if (!p->upgrade && !AdmitRequest()) {
+    is_closed_ = !http_should_keep_alive(p);
+    request_constructor_->SetIsFinal(is_closed_);
+    if (!FinalizeRequest()) return -1;
+    is_skipping_body_ = true;
+    return 0;
+  }
+  if (request_constructor_->IsBodyStreamed() && !StartBodyStream(p)) {
+    return -1;
+  }
   return 0;
 }
 
 int HttpRequestParser::OnBodyImpl(http_parser* p, const char* data,
                                   size_t size) {
+  if (is_skipping_body_) return 0;
+  if (body_stream_producer_) {
+    PushBodyStreamChunk({data, size});
+    return 0;
+  }
   UASSERT(request_constructor_);
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "body: '" << std::string_view(data, size) << "'";
@@ -199,17 +254,76 @@ int HttpRequestParser::OnBodyImpl(http_parser* p, const char* data,
 }
 
 int HttpRequestParser::OnMessageCompleteImpl(http_parser* p) {
+  if (is_skipping_body_) {
+    LOG_TRACE() << "message complete, the body was skipped";
+    is_skipping_body_ = false;
+    return 0;
+  }
+  if (body_stream_producer_) {
+    LOG_TRACE() << "message complete";
+    StopBodyStream(true);
+    return 0;
+  }
   UASSERT(request_constructor_);
   if (p->upgrade) {
     return -1;  // error
   }
-  request_constructor_->SetIsFinal(!http_should_keep_alive(p));
+  is_closed_ = !http_should_keep_alive(p);
+  request_constructor_->SetIsFinal(is_closed_);
   if (!CheckUrlComplete(p)) return -1;
   LOG_TRACE() << "message complete";
   if (!FinalizeRequest()) return -1;
   return 0;
 }
 
+HttpRequestParser::FastParseResult HttpRequestParser::ParseFast(
+    std::string_view data, std::size_t& parsed_size) {
+  auto& head = request_head_;
+  if (!ParseRequestHead(data, head) ||
+      data.size() - head.size < head.content_length) {
+    return FastParseResult::kFallback;
+  }
+  parsed_size = head.size + head.content_length;
+
+  LOG_TRACE() << "message begin";
+  CreateRequestConstructor();
+  // Same sequence of calls as with the http_parser callbacks
+  try {
+    request_constructor_->SetMethod(head.method);
+    request_constructor_->AppendUrl(head.url.data(), head.url.size());
+    request_constructor_->SetHttpMajor(head.http_major);
+    request_constructor_->SetHttpMinor(head.http_minor);
+    url_complete_ = true;
+    request_constructor_->ParseUrl();
+
+    for (const auto& [field, value] : head.headers) {
+      request_constructor_->AppendHeaderField(field.data(), field.size());
+      request_constructor_->AppendHeaderValue(value.data(), value.size());
+    }
+    request_constructor_->AppendHeaderField("", 0);
+
+    const bool is_admitted = AdmitRequest();
+    if (head.content_length != 0 && is_admitted) {
+      const auto body = data.substr(head.size, head.content_length);
+      if (input_buffer_) {
+        request_constructor_->SetBody(body, input_buffer_);
+      } else {
+        request_constructor_->AppendBody(body.data(), body.size());
+      }
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "can't parse request: " << ex;
+    FinalizeRequest();
+    return FastParseResult::kError;
+  }
+
+  request_constructor_->SetIsFinal(!head.keep_alive);
+  is_closed_ = !head.keep_alive;
+  LOG_TRACE() << "message complete";
+  if (!FinalizeRequest()) return FastParseResult::kError;
+  return FastParseResult::kParsed;
+}
+
 void HttpRequestParser::CreateRequestConstructor() {
   ++stats_.parsing_request_count;
   request_constructor_.emplace(request_constructor_config_, handler_info_index_,
@@ -252,6 +366,51 @@ bool HttpRequestParser::FinalizeRequestImpl() {
   return true;
 }
 
+bool HttpRequestParser::StartBodyStream(http_parser* p) {
+  // The requests without a body are passed to the handler as usual
+  if (!(p->flags & F_CHUNKED) &&
+      (p->content_length == 0 || p->content_length == ULLONG_MAX)) {
+    return true;
+  }
+
+  is_closed_ = !http_should_keep_alive(p);
+  request_constructor_->SetIsFinal(is_closed_);
+
+  const auto queue = RequestBodyStream::Queue::Create(kMaxBodyStreamQueueSize);
+  is_body_stream_complete_ = std::make_shared<std::atomic<bool>>(false);
+  request_constructor_->SetBodyStream(
+      RequestBodyStream{queue->GetConsumer(), is_body_stream_complete_});
+  if (!FinalizeRequest()) return false;
+
+  body_stream_producer_.emplace(queue->GetProducer());
+  return true;
+}
+
+bool HttpRequestParser::AdmitRequest() {
+  UASSERT(request_constructor_);
+  if (!admit_request_cb_) return true;
+  return request_constructor_->Admit(admit_request_cb_);
+}
+
+void HttpRequestParser::PushBodyStreamChunk(std::string_view data) {
+  UASSERT(body_stream_producer_);
+  LOG_TRACE() << "body stream chunk, size=" << data.size();
+  while (!data.empty()) {
+    const auto chunk = data.substr(0, kMaxBodyStreamQueueSize);
+    data.remove_prefix(chunk.size());
+    // Fails if the handler is not interested in the rest of the body or the
+    // connection is closing, the rest of the body is skipped then
+    if (!body_stream_producer_->Push(std::string{chunk}, {})) return;
+  }
+}
+
+void HttpRequestParser::StopBodyStream(bool is_complete) {
+  UASSERT(body_stream_producer_);
+  *is_body_stream_complete_ = is_complete;
+  is_body_stream_complete_.reset();
+  body_stream_producer_.reset();
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -13,6 +13,7 @@
 #include <userver/server/request/request_config.hpp>
 
 #include "http_request_constructor.hpp"
+#include "http_request_head_parser.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,17 +23,26 @@ class HttpRequestParser final : public request::RequestParser {
  public:
   using OnNewRequestCb =
       std::function<void(std::shared_ptr<request::RequestBase>&&)>;
+  using AdmitRequestCb = HttpRequestConstructor::AdmitRequestCb;
 
+  /// The `admit_request_cb`, if set, is called right after the headers of a
+  /// request are parsed, the body of the rejected requests is not buffered
   HttpRequestParser(const HandlerInfoIndex& handler_info_index,
                     const request::HttpRequestConfig& request_config,
                     OnNewRequestCb&& on_new_request_cb, net::ParserStats& stats,
-                    request::ResponseDataAccounter& data_accounter);
+                    request::ResponseDataAccounter& data_accounter,
+                    AdmitRequestCb admit_request_cb = {});
 
   HttpRequestParser(HttpRequestParser&&) = delete;
   HttpRequestParser& operator=(HttpRequestParser&&) = delete;
 
   bool Parse(const char* data, size_t size) override;
 
+  /// Same as Parse(), but the requests may keep the `buffer` that holds the
+  /// `data` alive and reference their bodies in it
+  bool Parse(const char* data, size_t size,
+             std::shared_ptr<const void> buffer);
+
  private:
   static int OnMessageBegin(http_parser* p);
   static int OnUrl(http_parser* p, const char* data, size_t size);
@@ -50,6 +60,11 @@ class HttpRequestParser final : public request::RequestParser {
   int OnBodyImpl(http_parser* p, const char* data, size_t size);
   int OnMessageCompleteImpl(http_parser* p);
 
+  enum class FastParseResult { kParsed, kFallback, kError };
+
+  // Parses the request that is entirely in `data` without http_parser
+  FastParseResult ParseFast(std::string_view data, std::size_t& parsed_size);
+
   void CreateRequestConstructor();
 
   bool CheckUrlComplete(http_parser* p);
@@ -57,15 +72,35 @@ class HttpRequestParser final : public request::RequestParser {
   bool FinalizeRequest();
   bool FinalizeRequestImpl();
 
+  // For the handlers with `request-body-stream: true` the request is passed to
+  // the handler right after the headers, while the body is being received
+  bool StartBodyStream(http_parser* p);
+  void PushBodyStreamChunk(std::string_view data);
+  void StopBodyStream(bool is_complete);
+
+  // Returns false if the request was rejected before its body is received
+  bool AdmitRequest();
+
   const HandlerInfoIndex& handler_info_index_;
   const HttpRequestConstructor::Config request_constructor_config_;
 
   bool url_complete_ = false;
+  // A request with `Connection: close` was parsed
+  bool is_closed_ = false;
+  // The buffer of the data that is being parsed, if it may be referenced
+  std::shared_ptr<const void> input_buffer_;
+
+  std::optional<RequestBodyStream::Queue::Producer> body_stream_producer_;
+  std::shared_ptr<std::atomic<bool>> is_body_stream_complete_;
+  // The request was rejected and answered, the rest of its body is skipped
+  bool is_skipping_body_ = false;
 
   OnNewRequestCb on_new_request_cb_;
+  AdmitRequestCb admit_request_cb_;
 
   http_parser parser_{};
   std::optional<HttpRequestConstructor> request_constructor_;
+  RequestHead request_head_;
 
   static const http_parser_settings parser_settings;
   net::ParserStats& stats_;
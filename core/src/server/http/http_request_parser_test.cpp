@@ -0,0 +1,270 @@
+#include <userver/utest/utest.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <userver/server/http/http_request.hpp>
+
+#include <server/http/http_request_impl.hpp>
+#include <server/http/http_request_parser.hpp>
+
+#include "create_parser_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct ParsedRequest {
+  std::string method;
+  std::string url;
+  std::string header;
+  std::size_t header_count;
+  std::string body;
+  std::string arg;
+  bool is_final;
+
+  bool operator==(const ParsedRequest& other) const {
+    return method == other.method && url == other.url &&
+           header == other.header && header_count == other.header_count &&
+           body == other.body && arg == other.arg && is_final == other.is_final;
+  }
+};
+
+std::vector<ParsedRequest> Parse(std::string_view data,
+                                 std::size_t chunk_size) {
+  std::vector<ParsedRequest> result;
+  auto parser = server::CreateTestParser(
+      [&result](std::shared_ptr<server::request::RequestBase>&& request) {
+        auto& http_request_impl =
+            dynamic_cast<server::http::HttpRequestImpl&>(*request);
+        const server::http::HttpRequest http_request(http_request_impl);
+        result.push_back({http_request.GetMethodStr(), http_request.GetUrl(),
+                          http_request.GetHeader("X-Value"),
+                          http_request.HeaderCount(),
+                          http_request.RequestBody(), http_request.GetArg("a"),
+                          http_request_impl.IsFinal()});
+      });
+
+  while (!data.empty()) {
+    const auto chunk = data.substr(0, chunk_size);
+    EXPECT_TRUE(parser.Parse(chunk.data(), chunk.size()));
+    data.remove_prefix(chunk.size());
+  }
+  return result;
+}
+
+}  // namespace
+
+UTEST(HttpRequestParser, FastPathMatchesHttpParser) {
+  const std::string data =
+      "GET /path?a=b HTTP/1.1\r\n"
+      "Host: example.com\r\n"
+      "X-Value: \t value \r\n"
+      "\r\n"
+      "POST /post HTTP/1.1\r\n"
+      "Content-Length: 4\r\n"
+      "\r\n"
+      "body"
+      "PUT /chunked?a=c HTTP/1.1\r\n"
+      "Transfer-Encoding: chunked\r\n"
+      "\r\n"
+      "4\r\nbody\r\n0\r\n\r\n"
+      "DELETE /last HTTP/1.1\r\n"
+      "X-Value: last\r\n"
+      "Connection: close\r\n"
+      "\r\n";
+
+  // The whole buffer goes through the fast path except the chunked request,
+  // single bytes go through http_parser
+  const auto fast = Parse(data, data.size());
+  const auto slow = Parse(data, 1);
+
+  ASSERT_EQ(fast.size(), 4);
+  EXPECT_EQ(fast, slow);
+
+  EXPECT_EQ(fast[0].method, "GET");
+  EXPECT_EQ(fast[0].url, "/path?a=b");
+  EXPECT_EQ(fast[0].header, "value ");
+  EXPECT_EQ(fast[0].header_count, 2);
+  EXPECT_EQ(fast[0].arg, "b");
+  EXPECT_EQ(fast[1].body, "body");
+  EXPECT_EQ(fast[2].body, "body");
+  EXPECT_EQ(fast[2].arg, "c");
+  EXPECT_FALSE(fast[2].is_final);
+  EXPECT_TRUE(fast[3].is_final);
+}
+
+UTEST(HttpRequestParser, DataAfterFinalRequest) {
+  std::size_t parsed = 0;
+  auto parser = server::CreateTestParser(
+      [&parsed](std::shared_ptr<server::request::RequestBase>&&) {
+        ++parsed;
+      });
+
+  const std::string_view data =
+      "GET / HTTP/1.1\r\nConnection: close\r\n\r\n"
+      "GET / HTTP/1.1\r\n\r\n";
+  EXPECT_FALSE(parser.Parse(data.data(), data.size()));
+  EXPECT_EQ(parsed, 1);
+}
+
+UTEST(HttpRequestParser, ZeroCopyBody) {
+  const server::http::HandlerInfoIndex handler_info_index;
+  server::request::HttpRequestConfig config;
+  config.testing_mode = true;
+  config.zero_copy_body = true;
+  server::net::ParserStats stats;
+  server::request::ResponseDataAccounter accounter;
+
+  std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+  server::http::HttpRequestParser parser(
+      handler_info_index, config,
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        requests.push_back(std::move(request));
+      },
+      stats, accounter);
+
+  const std::string body(2000, 'x');
+  const auto buffer = std::make_shared<std::string>(
+      "POST /big HTTP/1.1\r\nContent-Length: 2000\r\n\r\n" + body +
+      "POST /small HTTP/1.1\r\nContent-Length: 5\r\n\r\nsmall");
+  EXPECT_TRUE(parser.Parse(buffer->data(), buffer->size(), buffer));
+  ASSERT_EQ(requests.size(), 2);
+
+  auto& big = dynamic_cast<server::http::HttpRequestImpl&>(*requests[0]);
+  auto& small = dynamic_cast<server::http::HttpRequestImpl&>(*requests[1]);
+  EXPECT_EQ(buffer.use_count(), 2);
+
+  const auto view = big.RequestBodyView();
+  EXPECT_EQ(view, body);
+  EXPECT_GE(view.data(), buffer->data());
+  EXPECT_LT(view.data(), buffer->data() + buffer->size());
+  EXPECT_EQ(big.RequestBody(), body);
+  EXPECT_NE(big.RequestBody().data(), view.data());
+
+  EXPECT_EQ(small.RequestBodyView(), "small");
+  EXPECT_EQ(small.RequestBody(), "small");
+
+  big.SetRequestBody("replaced");
+  EXPECT_EQ(big.RequestBodyView(), "replaced");
+  EXPECT_EQ(big.RequestBody(), "replaced");
+  EXPECT_EQ(buffer.use_count(), 1);
+}
+
+
+UTEST(HttpRequestParser, LazyArgs) {
+  std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+  auto parser = server::CreateTestParser(
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        requests.push_back(std::move(request));
+      });
+
+  const std::string_view data =
+      "GET /path?a=1&B=2&b=3&c=%41&d HTTP/1.1\r\n\r\n"
+      "GET /invalid?a=1&b=%zz HTTP/1.1\r\n\r\n";
+  EXPECT_TRUE(parser.Parse(data.data(), data.size()));
+  ASSERT_EQ(requests.size(), 2);
+
+  auto& request = dynamic_cast<server::http::HttpRequestImpl&>(*requests[0]);
+  EXPECT_FALSE(request.GetResponse().IsReady());
+  const auto& values = request.GetArgVector("b");
+  EXPECT_EQ(values, (std::vector<std::string>{"3"}));
+  EXPECT_EQ(request.GetArg("a"), "1");
+  EXPECT_FALSE(request.HasArg("A"));
+  EXPECT_FALSE(request.HasArg("d"));
+
+  // Decoding the rest of the arguments keeps the references valid
+  EXPECT_EQ(request.ArgCount(), 4);
+  auto names = request.ArgNames();
+  std::sort(names.begin(), names.end());
+  EXPECT_EQ(names, (std::vector<std::string>{"B", "a", "b", "c"}));
+  EXPECT_EQ(&request.GetArgVector("b"), &values);
+  EXPECT_EQ(request.GetArg("B"), "2");
+  EXPECT_EQ(request.GetArg("c"), "A");
+
+  // The arguments are validated before the request is handled
+  auto& invalid = dynamic_cast<server::http::HttpRequestImpl&>(*requests[1]);
+  EXPECT_TRUE(invalid.GetResponse().IsReady());
+  EXPECT_EQ(invalid.GetHttpResponse().GetStatus(),
+            server::http::HttpStatus::kBadRequest);
+}
+
+UTEST(HttpRequestParser, ArgsFromReplacedBody) {
+  std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+  auto parser = server::CreateTestParser(
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        requests.push_back(std::move(request));
+      });
+
+  const std::string_view data =
+      "POST /path?a=1 HTTP/1.1\r\nContent-Length: 3\r\n\r\nxyz";
+  EXPECT_TRUE(parser.Parse(data.data(), data.size()));
+  ASSERT_EQ(requests.size(), 1);
+
+  auto& request = dynamic_cast<server::http::HttpRequestImpl&>(*requests[0]);
+  request.SetRequestBody("b=2&a=3");
+  request.ParseArgsFromBody();
+  EXPECT_EQ(request.GetArgVector("a"), (std::vector<std::string>{"1", "3"}));
+
+  // The decoded arguments outlive the body they were parsed from
+  request.SetRequestBody("replaced");
+  EXPECT_EQ(request.GetArg("b"), "2");
+  EXPECT_EQ(request.ArgCount(), 2);
+}
+
+UTEST(HttpRequestParser, RejectedBeforeBody) {
+  const server::http::HandlerInfoIndex handler_info_index;
+  server::request::HttpRequestConfig config;
+  config.testing_mode = true;
+  server::net::ParserStats stats;
+  server::request::ResponseDataAccounter accounter;
+
+  std::vector<std::shared_ptr<server::request::RequestBase>> requests;
+  std::size_t admissions = 0;
+  server::http::HttpRequestParser parser(
+      handler_info_index, config,
+      [&requests](std::shared_ptr<server::request::RequestBase>&& request) {
+        requests.push_back(std::move(request));
+      },
+      stats, accounter,
+      [&admissions](server::request::RequestBase& request) {
+        // Rejects every other request
+        if (admissions++ % 2 == 1) return true;
+        request.GetResponse().SetStatusServiceUnavailable();
+        return false;
+      });
+
+  const std::string body(2000, 'x');
+  const std::string data =
+      "POST /rejected HTTP/1.1\r\nContent-Length: 2000\r\n\r\n" + body +
+      "POST /admitted HTTP/1.1\r\nContent-Length: 5\r\n\r\nsmall"
+      "POST /chunked HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+      "5\r\nhello\r\n0\r\n\r\n"
+      "GET /admitted HTTP/1.1\r\n\r\n";
+  // Both the fast path and http_parser
+  for (std::size_t chunk_size : {data.size(), std::size_t{7}}) {
+    requests.clear();
+    std::string_view rest = data;
+    while (!rest.empty()) {
+      const auto chunk = rest.substr(0, chunk_size);
+      EXPECT_TRUE(parser.Parse(chunk.data(), chunk.size()));
+      rest.remove_prefix(chunk.size());
+    }
+    ASSERT_EQ(requests.size(), 4);
+
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      auto& request =
+          dynamic_cast<server::http::HttpRequestImpl&>(*requests[i]);
+      const bool is_rejected = i % 2 == 0;
+      EXPECT_EQ(request.GetResponse().IsReady(), is_rejected);
+      EXPECT_EQ(request.IsAdmitted(), !is_rejected);
+      if (is_rejected) EXPECT_TRUE(request.RequestBody().empty());
+    }
+    EXPECT_EQ(dynamic_cast<server::http::HttpRequestImpl&>(*requests[1])
+                  .RequestBody(),
+              "small");
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -1,12 +1,18 @@
 #include <userver/server/http/http_response.hpp>
 
+#include <unistd.h>
+
+#include <algorithm>
 #include <array>
+#include <stdexcept>
 
 #include <cctz/time_zone.h>
 #include <fmt/compile.h>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/fs/blocking/file_descriptor.hpp>
+#include <userver/fs/read.hpp>
 #include <userver/hostinfo/blocking/get_hostname.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/http/content_type.hpp>
@@ -17,6 +23,8 @@
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
 #include <userver/utils/small_string.hpp>
 
+#include <compression/compressor.hpp>
+#include <server/http/headers_block.hpp>
 #include <server/http/http_cached_date.hpp>
 
 #include "http_request_impl.hpp"
@@ -39,8 +47,49 @@ constexpr std::string_view kDefaultContentType = "application/octet-stream";
 constexpr std::string_view kClose = "close";
 constexpr std::string_view kKeepAlive = "keep-alive";
 
+// Keeps the IoData of a single write on the stack of Socket::SendAll
+constexpr std::size_t kMaxChunksPerWrite = 15;
+
+struct ChunkSizeLine final {
+  // CRLF, up to 16 hex digits of the chunk size, CRLF
+  std::array<char, 2 + 16 + 2> data;
+  std::size_t size{0};
+};
+
 const std::string kHostname = hostinfo::blocking::GetRealHostName();
 
+// Read buffer for sending files over the connections that are not plain
+// sockets, e.g. TLS
+constexpr std::size_t kFileReadChunkSize = 64 * 1024;
+
+std::size_t SendFileContents(engine::io::RwBase& socket,
+                             const fs::FileInfoWithData& file) {
+  const int fd = file.file->GetNative();
+  std::size_t sent_bytes = 0;
+  if (auto* plain_socket = dynamic_cast<engine::io::Socket*>(&socket)) {
+    sent_bytes = plain_socket->SendFile(fd, 0, file.size, engine::Deadline{});
+  } else {
+    std::string buffer(std::min(file.size, kFileReadChunkSize), '\0');
+    while (sent_bytes < file.size) {
+      const auto read_bytes =
+          ::pread(fd, buffer.data(),
+                  std::min(buffer.size(), file.size - sent_bytes), sent_bytes);
+      if (read_bytes <= 0) break;
+      const auto written = socket.WriteAll(buffer.data(), read_bytes, {});
+      sent_bytes += written;
+      if (written != static_cast<std::size_t>(read_bytes)) break;
+    }
+  }
+
+  if (sent_bytes != file.size) {
+    // Either the peer has gone or the file was truncated after the
+    // Content-Length was sent
+    throw std::runtime_error(fmt::format(
+        "Sent {} of {} bytes of a file response body", sent_bytes, file.size));
+  }
+  return sent_bytes;
+}
+
 void CheckHeaderName(std::string_view name) {
   static constexpr auto init = []() {
     std::array<uint8_t, 256> res{};  // zero initialize
@@ -96,6 +145,18 @@ void AppendToCharArray(char*& data, const std::string_view what) {
 
 const std::string kEmptyString{};
 
+// These headers are computed for each response
+constexpr std::array<std::string_view, 4> kPerResponseHeaders{
+    "content-length", "transfer-encoding", "connection", "date"};
+
+std::string ToLowerAscii(std::string_view str) {
+  std::string result{str};
+  for (auto& c : result) {
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+  }
+  return result;
+}
+
 }  // namespace
 
 namespace server::http {
@@ -119,6 +180,95 @@ void OutputHeader(USERVER_NAMESPACE::http::headers::HeadersString& header,
       });
 }
 
+HeadersBlock::HeadersBlock(HeadersList headers) {
+  headers_.reserve(headers.size());
+  for (auto& [name, value] : headers) {
+    if (name.empty()) throw std::runtime_error("empty header name");
+    CheckHeaderName(name);
+    CheckHeaderValue(value);
+
+    auto lowercase_name = ToLowerAscii(name);
+    if (std::find(kPerResponseHeaders.begin(), kPerResponseHeaders.end(),
+                  lowercase_name) != kPerResponseHeaders.end()) {
+      throw std::runtime_error("header '" + name +
+                               "' is computed for each response and can not "
+                               "be static");
+    }
+    for (const auto& header : headers_) {
+      if (header.lowercase_name == lowercase_name) {
+        throw std::runtime_error("duplicate header '" + name + "'");
+      }
+    }
+    headers_.push_back({std::move(name), std::move(lowercase_name),
+                        std::move(value)});
+  }
+
+  // headers_ is not modified any more, so the keys may refer to it
+  keys_.reserve(headers_.size());
+  ends_.reserve(headers_.size());
+  for (const auto& header : headers_) {
+    keys_.emplace_back(std::string_view{header.name});
+    serialized_.append(header.name)
+        .append(kKeyValueHeaderSeparator)
+        .append(header.value)
+        .append(kCrlf);
+    ends_.push_back(serialized_.size());
+    has_content_type_ |= (header.lowercase_name == "content-type");
+  }
+}
+
+const std::string* HeadersBlock::FindValue(
+    std::string_view name) const noexcept {
+  const utils::StrIcaseEqual equal;
+  for (const auto& header : headers_) {
+    if (equal(header.name, name)) return &header.value;
+  }
+  return nullptr;
+}
+
+bool HeadersBlock::IsOverridden(
+    std::size_t i, const USERVER_NAMESPACE::http::headers::HeaderMap& overrides,
+    utils::span<const HeadersBlock* const> overriding_blocks) const {
+  UASSERT(i < keys_.size());
+  if (overrides.find(keys_[i]) != overrides.end()) return true;
+  for (const auto* block : overriding_blocks) {
+    if (block->FindValue(headers_[i].name)) return true;
+  }
+  return false;
+}
+
+void HeadersBlock::OutputInHttpFormat(
+    const USERVER_NAMESPACE::http::headers::HeaderMap& overrides,
+    utils::span<const HeadersBlock* const> overriding_blocks,
+    USERVER_NAMESPACE::http::headers::HeadersString& buffer) const {
+  const auto append = [&buffer](std::string_view what) {
+    const auto old_size = buffer.size();
+    buffer.resize_and_overwrite(old_size + what.size(),
+                                [&](char* data, std::size_t size) {
+                                  data += old_size;
+                                  AppendToCharArray(data, what);
+                                  return size;
+                                });
+  };
+
+  if (overrides.empty() && overriding_blocks.empty()) {
+    append(serialized_);
+    return;
+  }
+
+  const std::string_view serialized{serialized_};
+  std::size_t begin = 0;
+  for (std::size_t i = 0; i < keys_.size(); ++i) {
+    if (IsOverridden(i, overrides, overriding_blocks)) {
+      // Flush the headers before the overridden one at once
+      const auto header_begin = (i == 0 ? 0 : ends_[i - 1]);
+      append(serialized.substr(begin, header_begin - begin));
+      begin = ends_[i];
+    }
+  }
+  append(serialized.substr(begin));
+}
+
 }  // namespace impl
 
 HttpResponse::HttpResponse(const HttpRequestImpl& request,
@@ -186,6 +336,12 @@ bool HttpResponse::SetStatus(HttpStatus status) {
   return true;
 }
 
+void HttpResponse::AddStaticHeaders(const impl::HeadersBlock& headers) {
+  UINVARIANT(static_headers_count_ < static_headers_.size(),
+             "Too many static header blocks for a response");
+  static_headers_[static_headers_count_++] = &headers;
+}
+
 bool HttpResponse::ClearHeaders() {
   if (headers_end_.IsReady()) {
     // Attempt to set headers for Stream'ed response after it is already set
@@ -217,26 +373,30 @@ HttpResponse::HeadersMapKeys HttpResponse::GetHeaderNames() const {
 
 const std::string& HttpResponse::GetHeader(std::string_view header_name) const {
   auto it = headers_.find(header_name);
-  if (it == headers_.end()) return kEmptyString;
-  return it->second;
+  if (it != headers_.end()) return it->second;
+  const auto* value = FindStaticHeader(header_name);
+  return value ? *value : kEmptyString;
 }
 
 const std::string& HttpResponse::GetHeader(
     const USERVER_NAMESPACE::http::headers::PredefinedHeader& header_name)
     const {
   auto it = headers_.find(header_name);
-  if (it == headers_.end()) return kEmptyString;
-  return it->second;
+  if (it != headers_.end()) return it->second;
+  const auto* value = FindStaticHeader(header_name);
+  return value ? *value : kEmptyString;
 }
 
 bool HttpResponse::HasHeader(std::string_view header_name) const {
-  return headers_.find(header_name) != headers_.end();
+  return headers_.find(header_name) != headers_.end() ||
+         FindStaticHeader(header_name);
 }
 
 bool HttpResponse::HasHeader(
     const USERVER_NAMESPACE::http::headers::PredefinedHeader& header_name)
     const {
-  return headers_.find(header_name) != headers_.end();
+  return headers_.find(header_name) != headers_.end() ||
+         FindStaticHeader(header_name);
 }
 
 HttpResponse::CookiesMapKeys HttpResponse::GetCookieNames() const {
@@ -247,6 +407,28 @@ const Cookie& HttpResponse::GetCookie(std::string_view cookie_name) const {
   return cookies_.at(cookie_name.data());
 }
 
+utils::span<const impl::HeadersBlock* const> HttpResponse::GetStaticHeaders()
+    const noexcept {
+  return utils::span<const impl::HeadersBlock* const>{static_headers_}.first(
+      static_headers_count_);
+}
+
+const std::string* HttpResponse::FindStaticHeader(
+    std::string_view name) const noexcept {
+  const auto static_headers = GetStaticHeaders();
+  // The later blocks take precedence
+  for (auto it = static_headers.end(); it != static_headers.begin();) {
+    if (const auto* value = (*--it)->FindValue(name)) return value;
+  }
+  return nullptr;
+}
+
+bool HttpResponse::HasStaticContentType() const noexcept {
+  const auto static_headers = GetStaticHeaders();
+  return std::any_of(static_headers.begin(), static_headers.end(),
+                     [](const auto* block) { return block->HasContentType(); });
+}
+
 void HttpResponse::SetHeadersEnd() { headers_end_.Send(); }
 
 bool HttpResponse::WaitForHeadersEnd() { return headers_end_.WaitForEvent(); }
@@ -275,11 +457,18 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
                        // impl::GetCachedDate() must not cross thread boundaries
                        impl::GetCachedDate());
   }
-  if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
+  if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end &&
+      !HasStaticContentType()) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentType,
                        kDefaultContentType);
   }
   headers_.OutputInHttpFormat(header);
+  // The later blocks are more specific, e.g. the ones of the handler
+  const auto static_headers = GetStaticHeaders();
+  for (std::size_t i = 0; i < static_headers.size(); ++i) {
+    static_headers[i]->OutputInHttpFormat(
+        headers_, static_headers.subspan(i + 1), header);
+  }
   if (headers_.find(USERVER_NAMESPACE::http::headers::kConnection) == end) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kConnection,
                        (request_.IsFinal() ? kClose : kKeepAlive));
@@ -323,10 +512,13 @@ std::size_t HttpResponse::SetBodyNotStreamed(
   const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
   const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
   const auto& data = GetData();
+  // The data is set instead of the file on errors
+  const auto* file = data.empty() ? file_body_.get() : nullptr;
+  const auto body_size = file ? file->size : data.size();
 
   if (!is_body_forbidden) {
     impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentLength,
-                       fmt::format(FMT_COMPILE("{}"), data.size()));
+                       fmt::format(FMT_COMPILE("{}"), body_size));
   }
   header.append(kCrlf);
 
@@ -338,7 +530,11 @@ std::size_t HttpResponse::SetBodyNotStreamed(
   }
 
   ssize_t sent_bytes = 0;
-  if (!is_head_request && !is_body_forbidden) {
+  if (file && !is_head_request && !is_body_forbidden) {
+    sent_bytes =
+        socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+    sent_bytes += SendFileContents(socket, *file);
+  } else if (!is_head_request && !is_body_forbidden) {
     sent_bytes = socket.WriteAll(
         {{header.data(), header.size()}, {data.data(), data.size()}},
         engine::Deadline{});
@@ -361,34 +557,69 @@ std::size_t HttpResponse::SetBodyStreamed(
   // headers end marker
   header.append(kCrlf);
 
-  // send HTTP headers
-  size_t sent_bytes = socket.WriteAll(header.data(), header.size(), {});
-  header.clear();
-  header.shrink_to_fit();  // free memory before time-consuming operation
-
   if (is_body_forbidden) {
-    return sent_bytes;
+    return socket.WriteAll(header.data(), header.size(), {});
   }
 
-  // Transmit HTTP response body
-  std::string body_part;
+  // Transmit HTTP response body. The chunks that are already produced are
+  // sent with a single vectored write, as well as the headers if the first
+  // chunk is ready by the time they are sent.
+  std::array<std::string, kMaxChunksPerWrite> body_parts;
+  std::array<ChunkSizeLine, kMaxChunksPerWrite> size_lines;
+  std::array<engine::io::IoData, kMaxChunksPerWrite * 2 + 1> io_data{};
+
+  std::size_t sent_bytes = 0;
+  bool is_header_sent = false;
   // First chunk must be sent without kCrlf
   // because kCrlf was sent with headers
   bool first_chunk_processed = false;
-  while (body_stream_->Pop(body_part)) {
-    if (body_part.empty()) {
-      LOG_DEBUG() << "Zero size body_part in http_response.cpp";
-      continue;
+  for (;;) {
+    std::size_t parts_count = 0;
+    std::size_t io_data_count = 0;
+    if (!is_header_sent) {
+      io_data[io_data_count++] = {header.data(), header.size()};
+    } else if (body_stream_->Pop(body_parts[0])) {
+      parts_count = 1;
+    } else {
+      break;
+    }
+    while (parts_count < kMaxChunksPerWrite &&
+           body_stream_->PopNoblock(body_parts[parts_count])) {
+      ++parts_count;
     }
 
-    auto size = first_chunk_processed
-                    ? fmt::format("\r\n{:x}\r\n", body_part.size())
-                    : fmt::format("{:x}\r\n", body_part.size());
-    sent_bytes += socket.WriteAll(
-        {{size.data(), size.size()}, {body_part.data(), body_part.size()}},
-        engine::Deadline{});
+    for (std::size_t i = 0; i < parts_count; ++i) {
+      const auto& body_part = body_parts[i];
+      if (body_part.empty()) {
+        LOG_DEBUG() << "Zero size body_part in http_response.cpp";
+        continue;
+      }
+
+      auto& size_line = size_lines[i];
+      size_line.size =
+          fmt::format_to_n(size_line.data.data(), size_line.data.size(),
+                           FMT_COMPILE("{}{:x}\r\n"),
+                           first_chunk_processed ? kCrlf : std::string_view{},
+                           body_part.size())
+              .size;
+      io_data[io_data_count++] = {size_line.data.data(), size_line.size};
+      io_data[io_data_count++] = {body_part.data(), body_part.size()};
+
+      first_chunk_processed = true;
+    }
+
+    if (io_data_count != 0) {
+      sent_bytes += socket.WriteAll(io_data.data(), io_data_count, {});
+    }
 
-    first_chunk_processed = true;
+    if (!is_header_sent) {
+      is_header_sent = true;
+      header.clear();
+      header.shrink_to_fit();  // free memory before time-consuming operation
+    }
+    for (std::size_t i = 0; i < parts_count; ++i) {
+      body_parts[i] = std::string{};
+    }
   }
 
   const std::string_view terminating_chunk{
@@ -424,6 +655,13 @@ void HttpResponse::SetStreamBody() {
   body_stream_producer_.emplace(body_queue->GetProducer());
 }
 
+void HttpResponse::SetFileBody(
+    std::shared_ptr<const fs::FileInfoWithData> file) {
+  UASSERT(file);
+  UASSERT(file->file);
+  file_body_ = std::move(file);
+}
+
 bool HttpResponse::IsBodyStreamed() const { return body_stream_.has_value(); }
 
 HttpResponse::Queue::Producer HttpResponse::GetBodyProducer() {
@@ -435,6 +673,12 @@ HttpResponse::Queue::Producer HttpResponse::GetBodyProducer() {
   return producer;
 }
 
+void HttpResponse::SetBodyStreamCompressor(
+    std::unique_ptr<compression::Compressor> compressor) {
+  UASSERT(IsBodyStreamed());
+  body_stream_compressor_ = std::move(compressor);
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <userver/server/http/http_status.hpp>
 #include <userver/utils/small_string.hpp>
 
+#include <server/http/headers_block.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <userver/server/request/response_base.hpp>
 
@@ -26,6 +27,12 @@ const server::http::HttpResponse::HeadersMap kHeaders = [] {
   return map;
 }();
 
+const server::http::impl::HeadersBlock kHeadersBlock{[] {
+  server::http::impl::HeadersBlock::HeadersList headers;
+  for (const auto& [name, value] : kHeaders) headers.emplace_back(name, value);
+  return headers;
+}()};
+
 void OutputHeader(std::string& header, std::string_view key,
                   std::string_view val) {
   const auto old_size = header.size();
@@ -76,6 +83,38 @@ void http_headers_serialization_inplace(benchmark::State& state) {
   }
 }
 
+// Same as http_headers_serialization_inplace, but the headers are spliced from
+// a pre-serialized block
+void http_headers_serialization_static_block(benchmark::State& state) {
+  const server::http::HttpResponse::HeadersMap overrides;
+  for ([[maybe_unused]] auto _ : state) {
+    USERVER_NAMESPACE::http::headers::HeadersString os;
+
+    os.resize_and_overwrite(
+        USERVER_NAMESPACE::http::headers::kTypicalHeadersSize,
+        [&](char* data, std::size_t) {
+          char* old_data_pointer = data;
+          auto append = [&data](const std::string_view what) {
+            std::memcpy(data, what.begin(), what.size());
+            data += what.size();
+          };
+          append("HTTP/");
+          data = fmt::format_to(data, FMT_COMPILE("{}.{} {} "), 1, 1, 200);
+          append(HttpStatusString(server::http::HttpStatus::kOk));
+          append("\r\n");
+          return data - old_data_pointer;
+        });
+
+    kHeadersBlock.OutputInHttpFormat(overrides, {}, os);
+
+    server::http::impl::OutputHeader(
+        os, USERVER_NAMESPACE::http::headers::kContentLength,
+        fmt::format(FMT_COMPILE("{}"), 1024));
+
+    benchmark::DoNotOptimize(os);
+  }
+}
+
 void http_headers_serialization_no_ostreams(benchmark::State& state) {
   for ([[maybe_unused]] auto _ : state) {
     std::string os;
@@ -152,6 +191,7 @@ void HttpResponseSetHeaderBenchmark(benchmark::State& state) {
 }  // namespace
 
 BENCHMARK(http_headers_serialization_inplace);
+BENCHMARK(http_headers_serialization_static_block);
 BENCHMARK(http_headers_serialization_no_ostreams);
 BENCHMARK(http_headers_serialization_ostreams);
 BENCHMARK(HttpResponseSetHeaderBenchmark);
@@ -1,5 +1,7 @@
 #include <userver/server/http/http_response_body_stream.hpp>
 
+#include <compression/compressor.hpp>
+#include <userver/http/common_headers.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -16,6 +18,13 @@ void ResponseBodyStream::PushBodyChunk(std::string&& chunk,
                                        engine::Deadline deadline) {
   UASSERT_MSG(headers_ended_,
               "SetEndOfHeaders() was not called before PushBodyChunk()");
+  auto* compressor = http_response_.body_stream_compressor_.get();
+  if (compressor) {
+    // Each chunk is flushed, so that the client gets it at once
+    std::string compressed;
+    compressor->Compress(chunk, /*flush=*/true, compressed);
+    chunk = std::move(compressed);
+  }
   const auto success = queue_producer_.Push(std::move(chunk), deadline);
   UASSERT(success);
 }
@@ -31,6 +40,11 @@ void ResponseBodyStream::SetHeader(std::string_view name,
 }
 
 void ResponseBodyStream::SetEndOfHeaders() {
+  const auto* compressor = http_response_.body_stream_compressor_.get();
+  if (compressor && !headers_ended_) {
+    http_response_.SetContentEncoding(
+        std::string{compression::ToString(compressor->GetEncoding())});
+  }
   headers_ended_ = true;
   http_response_.SetHeadersEnd();
 }
@@ -43,6 +57,18 @@ void ResponseBodyStream::SetStatusCode(HttpStatus status) {
   http_response_.SetStatus(status);
 }
 
+void ResponseBodyStream::PushBodyEnd(engine::Deadline deadline) {
+  auto& compressor = http_response_.body_stream_compressor_;
+  if (!compressor || !headers_ended_) return;
+
+  std::string end;
+  compressor->Finish(end);
+  compressor.reset();
+  // The connection may be already closed, e.g. on the cancellation
+  [[maybe_unused]] const auto success =
+      queue_producer_.Push(std::move(end), deadline);
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include <fmt/format.h>
 #include <gmock/gmock.h>
 
+#include <server/http/headers_block.hpp>
 #include <server/http/http_request_impl.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/http/common_headers.hpp>
@@ -117,6 +118,26 @@ UTEST_P(HttpResponseBody, ForbiddenBody) {
 INSTANTIATE_UTEST_SUITE_P(HttpResponseForbiddenBody, HttpResponseBody,
                           testing::Values(100, 101, 150, 199, 304, 204));
 
+TEST(HttpResponse, AccounterParent) {
+  server::request::ResponseDataAccounter server_accounter;
+  server::request::ResponseDataAccounter connection_accounter{server_accounter};
+  const server::http::HttpRequestImpl request{connection_accounter};
+  auto& response = request.GetHttpResponse();
+
+  constexpr std::string_view kBody = "test data";
+  response.SetData(std::string{kBody});
+  EXPECT_EQ(connection_accounter.GetCurrentLevel(), kBody.size());
+  EXPECT_EQ(server_accounter.GetCurrentLevel(), kBody.size());
+  EXPECT_FALSE(response.IsLimitReached());
+
+  server_accounter.SetMaxLevel(kBody.size());
+  EXPECT_TRUE(response.IsLimitReached());
+
+  response.SetSendFailed(std::chrono::steady_clock::now());
+  EXPECT_EQ(connection_accounter.GetCurrentLevel(), 0);
+  EXPECT_EQ(server_accounter.GetCurrentLevel(), 0);
+}
+
 TEST(HttpResponse, GetHeaderDoesntThrow) {
   server::request::ResponseDataAccounter accounter{};
   const server::http::HttpRequestImpl request_impl{accounter};
@@ -126,4 +147,69 @@ TEST(HttpResponse, GetHeaderDoesntThrow) {
   EXPECT_TRUE(header.empty());
 }
 
+UTEST(HttpResponse, StaticHeaders) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  const server::http::impl::HeadersBlock server_headers{
+      {{"Server", "userver"}, {"X-Common", "server"}}};
+  const server::http::impl::HeadersBlock handler_headers{
+      {{"X-First", "first"},
+       {"Content-Type", "text/plain"},
+       {"x-common", "handler"},
+       {"X-Last", "last"}}};
+
+  server::request::ResponseDataAccounter accounter;
+  server::http::HttpRequestImpl request{accounter};
+  server::http::HttpResponse response{request, accounter};
+  response.AddStaticHeaders(server_headers);
+  response.AddStaticHeaders(handler_headers);
+  response.SetHeader(std::string{"x-first"}, "dynamic");
+  response.SetData("test data");
+
+  EXPECT_EQ(response.GetHeader("x-last"), "last");
+  EXPECT_EQ(response.GetHeader("X-Common"), "handler");
+  EXPECT_EQ(response.GetHeader(http::headers::kContentType), "text/plain");
+  EXPECT_FALSE(response.HasHeader("X-Unknown"));
+
+  auto [server, client] =
+      internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+  auto send_task = engine::AsyncNoSpan(
+      [](auto&& response, auto&& socket) { response.SendResponse(socket); },
+      std::ref(response), std::move(server));
+
+  std::string buffer(4096, '\0');
+  const auto reply_size =
+      client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+  buffer.resize(reply_size);
+
+  EXPECT_THAT(buffer, testing::HasSubstr("\r\nServer: userver\r\n"));
+  EXPECT_THAT(buffer, testing::HasSubstr("\r\nx-first: dynamic\r\n"));
+  EXPECT_THAT(buffer, testing::Not(testing::HasSubstr("X-First: first")));
+  EXPECT_THAT(buffer, testing::HasSubstr("\r\nContent-Type: text/plain\r\n"));
+  EXPECT_THAT(buffer, testing::Not(testing::HasSubstr("octet-stream")));
+  EXPECT_THAT(buffer, testing::HasSubstr("\r\nx-common: handler\r\n"));
+  EXPECT_THAT(buffer, testing::Not(testing::HasSubstr("X-Common: server")));
+  EXPECT_THAT(buffer, testing::HasSubstr("\r\nX-Last: last\r\n"));
+}
+
+TEST(HttpResponse, StaticHeadersValidation) {
+  using server::http::impl::HeadersBlock;
+  using Headers = HeadersBlock::HeadersList;
+  EXPECT_THROW(HeadersBlock(Headers{{"Bad Name", "value"}}),
+               std::runtime_error);
+  EXPECT_THROW(HeadersBlock(Headers{{"X-Header", "bad\r\nvalue"}}),
+               std::runtime_error);
+  EXPECT_THROW(HeadersBlock(Headers{{"X-Header", "1"}, {"x-header", "2"}}),
+               std::runtime_error);
+  EXPECT_THROW(HeadersBlock(Headers{{"Content-Length", "1"}}),
+               std::runtime_error);
+  EXPECT_THROW(HeadersBlock(Headers{{"date", "today"}}), std::runtime_error);
+
+  const HeadersBlock block{Headers{{"X-Header", "value"}}};
+  EXPECT_FALSE(block.IsEmpty());
+  EXPECT_FALSE(block.HasContentType());
+  EXPECT_TRUE(HeadersBlock{Headers{}}.IsEmpty());
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#include <userver/server/http/json_body_stream_writer.hpp>
+
+#include <userver/server/http/http_response_body_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+JsonBodyStreamWriter::JsonBodyStreamWriter(ResponseBodyStream& stream,
+                                           engine::Deadline deadline,
+                                           std::size_t flush_threshold)
+    : stream_(stream), deadline_(deadline), flush_threshold_(flush_threshold) {}
+
+void JsonBodyStreamWriter::FlushIfNeeded() {
+  if (builder_.GetStringView().size() >= flush_threshold_) Flush();
+}
+
+void JsonBodyStreamWriter::Flush() {
+  auto chunk = builder_.ExtractString();
+  if (chunk.empty()) return;
+  stream_.PushBodyChunk(std::move(chunk), deadline_);
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -20,6 +20,10 @@ const char kLf = '\n';
 
 const std::string kOwsChars = " \t";
 
+constexpr std::string_view kCrLf = "\r\n";
+
+constexpr std::size_t kMaxPartHeadersSize = 16 * 1024;
+
 [[nodiscard]] std::string_view LtrimOws(std::string_view str) {
   const auto first_pchar_pos = str.find_first_not_of(kOwsChars);
   str.remove_prefix(
@@ -406,9 +410,8 @@ bool IsMultipartFormDataContentType(std::string_view content_type) {
   return false;
 }
 
-bool ParseMultipartFormData(const std::string& content_type,
-                            std::string_view body, FormDataArgs& form_data_args,
-                            bool strict_cr_lf) {
+bool ParseMultipartContentType(std::string_view content_type,
+                               std::string& boundary, std::string& charset) {
   static const std::string kBoundary = "boundary";
   static const std::string kCharset = "charset";
   static const std::string kBoundaryNotFound =
@@ -422,8 +425,6 @@ bool ParseMultipartFormData(const std::string& content_type,
   unparsed.remove_prefix(kMultipartFormData.size());
   SkipOptionalSpaces(unparsed);
 
-  std::string boundary;
-  std::string charset;
   while (!unparsed.empty()) {
     if (!SkipSymbol(unparsed, ';')) return false;
     SkipOptionalSpaces(unparsed);
@@ -455,11 +456,151 @@ bool ParseMultipartFormData(const std::string& content_type,
     LOG_WARNING() << kBoundaryNotFound;
     return false;
   }
+  return true;
+}
+
+bool ParseMultipartFormData(const std::string& content_type,
+                            std::string_view body, FormDataArgs& form_data_args,
+                            bool strict_cr_lf) {
+  std::string boundary;
+  std::string charset;
+  if (!ParseMultipartContentType(content_type, boundary, charset)) {
+    return false;
+  }
 
   return ParseMultipartFormDataBody(body, boundary, std::move(charset),
                                     form_data_args, strict_cr_lf);
 }
 
+MultipartFormDataStreamParser::MultipartFormDataStreamParser(
+    std::string_view boundary)
+    : delimiter_(std::string{kCrLf} + "--" + std::string{boundary}),
+      // The delimiter at the start of the body has no line break before it
+      pending_(kCrLf) {
+  UASSERT(!boundary.empty());
+}
+
+void MultipartFormDataStreamParser::Append(std::string_view data) {
+  UASSERT(!is_end_of_input_);
+  pending_.append(data);
+}
+
+void MultipartFormDataStreamParser::SetEndOfInput() { is_end_of_input_ = true; }
+
+MultipartFormDataStreamParser::Event MultipartFormDataStreamParser::Next() {
+  const auto event = DoNext();
+  if (event != Event::kNeedMoreData || !is_end_of_input_) return event;
+
+  LOG_WARNING() << "Unexpected request body end";
+  state_ = State::kError;
+  return Event::kError;
+}
+
+MultipartFormDataStreamParser::Event MultipartFormDataStreamParser::DoNext() {
+  switch (state_) {
+    case State::kPreamble: {
+      const auto pos = pending_.find(delimiter_);
+      if (pos == std::string::npos) {
+        // Keep the tail that may be the beginning of the delimiter
+        if (pending_.size() >= delimiter_.size()) {
+          pending_.erase(0, pending_.size() - delimiter_.size() + 1);
+        }
+        return Event::kNeedMoreData;
+      }
+      pending_.erase(0, pos + delimiter_.size());
+      state_ = State::kDelimiter;
+      return DoNext();
+    }
+
+    case State::kDelimiter: {
+      if (pending_.size() < 2) return Event::kNeedMoreData;
+      if (pending_.compare(0, 2, "--") == 0) {
+        pending_.clear();
+        state_ = State::kEnd;
+        return Event::kEnd;
+      }
+      // https://datatracker.ietf.org/doc/html/rfc2046#section-5.1.1
+      const auto pos = pending_.find_first_not_of(kOwsChars);
+      if (pos == std::string::npos || pending_.size() < pos + kCrLf.size()) {
+        return Event::kNeedMoreData;
+      }
+      if (pending_.compare(pos, kCrLf.size(), kCrLf) != 0) {
+        LOG_WARNING() << "Line break expected after the boundary";
+        state_ = State::kError;
+        return Event::kError;
+      }
+      pending_.erase(0, pos + kCrLf.size());
+      state_ = State::kHeaders;
+      return DoNext();
+    }
+
+    case State::kHeaders: {
+      const auto pos = pending_.compare(0, kCrLf.size(), kCrLf) == 0
+                           ? 0
+                           : pending_.find("\r\n\r\n");
+      if (pos == std::string::npos) {
+        if (pending_.size() > kMaxPartHeadersSize) {
+          LOG_WARNING() << "Too long multipart/form-data part headers";
+          state_ = State::kError;
+          return Event::kError;
+        }
+        return Event::kNeedMoreData;
+      }
+      const auto headers_size = pos == 0 ? kCrLf.size() : pos + 4;
+      std::string_view headers{pending_.data(), headers_size};
+
+      FormDataArgInfo arg_info;
+      if (!ParseMultipartFormDataHeaders(headers, arg_info, kCrLf)) {
+        state_ = State::kError;
+        return Event::kError;
+      }
+      if (arg_info.arg.content_disposition.empty()) {
+        LOG_WARNING() << "Missing Content-Disposition header";
+        state_ = State::kError;
+        return Event::kError;
+      }
+      part_.name = std::move(arg_info.name);
+      part_.filename = std::move(arg_info.arg.filename);
+      part_.content_type.reset();
+      if (arg_info.arg.content_type) {
+        part_.content_type.emplace(*arg_info.arg.content_type);
+      }
+      pending_.erase(0, headers_size);
+      state_ = State::kValue;
+      return Event::kPart;
+    }
+
+    case State::kValue: {
+      const auto pos = pending_.find(delimiter_);
+      if (pos != std::string::npos) {
+        data_.assign(pending_, 0, pos);
+        pending_.erase(0, pos + delimiter_.size());
+        state_ = State::kValueEnd;
+        if (!data_.empty()) return Event::kData;
+        return DoNext();
+      }
+      // Keep the tail that may be the beginning of the delimiter
+      if (pending_.size() < delimiter_.size()) return Event::kNeedMoreData;
+      const auto size = pending_.size() - delimiter_.size() + 1;
+      data_.assign(pending_, 0, size);
+      pending_.erase(0, size);
+      return Event::kData;
+    }
+
+    case State::kValueEnd:
+      state_ = State::kDelimiter;
+      return Event::kPartEnd;
+
+    case State::kEnd:
+      return Event::kEnd;
+
+    case State::kError:
+      return Event::kError;
+  }
+
+  UINVARIANT(false, "Unexpected MultipartFormDataStreamParser state");
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
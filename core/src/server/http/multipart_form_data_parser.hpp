@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -22,6 +23,60 @@ bool ParseMultipartFormData(const std::string& content_type,
                             std::string_view body, FormDataArgs& form_data_args,
                             bool strict_cr_lf = false);
 
+bool ParseMultipartContentType(std::string_view content_type,
+                               std::string& boundary, std::string& charset);
+
+// Incremental multipart/form-data parser for the bodies that are not kept in
+// memory as a whole. Unlike ParseMultipartFormData() it requires CRLF line
+// breaks.
+class MultipartFormDataStreamParser final {
+ public:
+  enum class Event {
+    kNeedMoreData,  // Append() more data or call SetEndOfInput()
+    kPart,          // GetPart() has the headers of the next part
+    kData,          // GetData() has the next chunk of the part value
+    kPartEnd,       // The value of the part is over
+    kEnd,           // The closing boundary is reached
+    kError,
+  };
+
+  struct Part {
+    std::string name;
+    std::optional<std::string> filename;
+    std::optional<std::string> content_type;
+  };
+
+  explicit MultipartFormDataStreamParser(std::string_view boundary);
+
+  void Append(std::string_view data);
+  void SetEndOfInput();
+
+  Event Next();
+
+  const Part& GetPart() const { return part_; }
+  const std::string& GetData() const { return data_; }
+
+ private:
+  enum class State {
+    kPreamble,
+    kDelimiter,
+    kHeaders,
+    kValue,
+    kValueEnd,
+    kEnd,
+    kError,
+  };
+
+  Event DoNext();
+
+  const std::string delimiter_;
+  std::string pending_;
+  std::string data_;
+  Part part_;
+  State state_{State::kPreamble};
+  bool is_end_of_input_{false};
+};
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
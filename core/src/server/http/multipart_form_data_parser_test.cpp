@@ -532,4 +532,121 @@ TEST(MultipartFormDataParser, ParseErrors) {
   EXPECT_TRUE(form_data_args.empty());
 }
 
+namespace {
+
+struct StreamedPart {
+  std::string name;
+  std::optional<std::string> filename;
+  std::optional<std::string> content_type;
+  std::string value;
+
+  bool operator==(const StreamedPart& other) const {
+    return name == other.name && filename == other.filename &&
+           content_type == other.content_type && value == other.value;
+  }
+};
+
+// Returns std::nullopt on error
+std::optional<std::vector<StreamedPart>> StreamParse(
+    const std::string& content_type, std::string_view body,
+    std::size_t chunk_size) {
+  namespace sh = server::http;
+  std::string boundary;
+  std::string charset;
+  if (!sh::ParseMultipartContentType(content_type, boundary, charset)) {
+    return std::nullopt;
+  }
+
+  sh::MultipartFormDataStreamParser parser{boundary};
+  std::vector<StreamedPart> result;
+  bool is_in_part = false;
+  while (true) {
+    switch (parser.Next()) {
+      case sh::MultipartFormDataStreamParser::Event::kNeedMoreData:
+        if (body.empty()) {
+          parser.SetEndOfInput();
+        } else {
+          parser.Append(body.substr(0, chunk_size));
+          body.remove_prefix(std::min(chunk_size, body.size()));
+        }
+        break;
+      case sh::MultipartFormDataStreamParser::Event::kPart: {
+        EXPECT_FALSE(is_in_part);
+        is_in_part = true;
+        const auto& part = parser.GetPart();
+        result.push_back({part.name, part.filename, part.content_type, {}});
+        break;
+      }
+      case sh::MultipartFormDataStreamParser::Event::kData:
+        EXPECT_TRUE(is_in_part);
+        EXPECT_FALSE(parser.GetData().empty());
+        result.back().value += parser.GetData();
+        break;
+      case sh::MultipartFormDataStreamParser::Event::kPartEnd:
+        EXPECT_TRUE(is_in_part);
+        is_in_part = false;
+        break;
+      case sh::MultipartFormDataStreamParser::Event::kEnd:
+        EXPECT_FALSE(is_in_part);
+        return result;
+      case sh::MultipartFormDataStreamParser::Event::kError:
+        return std::nullopt;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(MultipartFormDataStreamParser, ParseOk) {
+  const std::string kContentType = "multipart/form-data; boundary=zzz";
+  const std::string kBody =
+      "preamble\r\n"
+      "--zzz\r\n"
+      "Content-Disposition: form-data; name=\"text\"\r\n"
+      "\r\n"
+      "default\r\n"
+      "--zzz \t\r\n"
+      "Content-Disposition: form-data; name=\"file1\"; filename=\"a.txt\"\r\n"
+      "Content-Type: text/plain\r\n"
+      "\r\n"
+      "\r\n-Content\r\n-of\r\n--zz a.txt.\n\r\n"
+      "--zzz\r\n"
+      "Content-Disposition: form-data; name=\"empty\"\r\n"
+      "\r\n"
+      "\r\n"
+      "--zzz--\r\n"
+      "epilogue";
+
+  const std::vector<StreamedPart> expected{
+      {"text", std::nullopt, std::nullopt, "default"},
+      {"file1", "a.txt", "text/plain", "\r\n-Content\r\n-of\r\n--zz a.txt.\n"},
+      {"empty", std::nullopt, std::nullopt, ""},
+  };
+  for (std::size_t chunk_size = 1; chunk_size <= kBody.size(); ++chunk_size) {
+    EXPECT_EQ(StreamParse(kContentType, kBody, chunk_size), expected)
+        << "chunk_size=" << chunk_size;
+  }
+}
+
+TEST(MultipartFormDataStreamParser, ParseErrors) {
+  const std::string kContentType = "multipart/form-data; boundary=zzz";
+  const std::string kBodies[] = {
+      "",
+      "--zzz\r\n",
+      "--zzz\r\nContent-Disposition: form-data; name=\"arg\"\r\n\r\nvalue",
+      "--zzz\r\nContent-Type: text/plain\r\n\r\nvalue\r\n--zzz--",
+      "--zzz\r\nContent-Disposition: form-data\r\n\r\nvalue\r\n--zzz--",
+      "--zzz\nContent-Disposition: form-data; name=\"arg\"\n\nvalue\n--zzz--",
+  };
+
+  for (const auto& body : kBodies) {
+    for (std::size_t chunk_size = 1; chunk_size <= body.size() + 1;
+         ++chunk_size) {
+      EXPECT_EQ(StreamParse(kContentType, body, chunk_size), std::nullopt)
+          << body;
+    }
+  }
+  EXPECT_EQ(StreamParse("multipart/form-data", "--zzz--", 1), std::nullopt);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,122 @@
+#include <server/http/path_trie.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+namespace {
+
+constexpr std::string_view kAnySuffixMark{"*"};
+
+}  // namespace
+
+PathTrie::PathTrie() { Compile(); }
+
+std::size_t PathTrie::AddRoute(const std::vector<FixedSegment>& fixed_segments,
+                               std::size_t length) {
+  BuilderNode* cur = &root_;
+  for (const auto& fixed_segment : fixed_segments) {
+    UASSERT(fixed_segment.index < length);
+    cur = &cur->next[fixed_segment.index][std::string{fixed_segment.segment}];
+  }
+
+  const auto [it, inserted] = cur->routes.emplace(length, route_count_);
+  if (inserted) {
+    ++route_count_;
+    Compile();
+  }
+  return it->second;
+}
+
+void PathTrie::SplitPath(std::string_view path, Segments& segments) {
+  segments.clear();
+  while (true) {
+    const auto pos = path.find('/');
+    if (pos == std::string_view::npos) break;
+    segments.push_back(path.substr(0, pos));
+    path.remove_prefix(pos + 1);
+  }
+  segments.push_back(path);
+}
+
+std::uint32_t PathTrie::FindChild(const Group& group,
+                                  std::string_view segment) const noexcept {
+  const auto begin = children_.begin() + group.children_begin;
+  const auto end = children_.begin() + group.children_end;
+  const auto it = std::lower_bound(
+      begin, end, segment,
+      [](const Child& child, std::string_view value) {
+        return child.segment < value;
+      });
+  if (it == end || it->segment != segment) return kNone;
+  return it->node;
+}
+
+const PathTrie::Route* PathTrie::FindRoute(const Node& node,
+                                           std::size_t length,
+                                           bool exact) const noexcept {
+  const auto begin = routes_.begin() + node.routes_begin;
+  const auto end = routes_.begin() + node.routes_end;
+  auto it = std::upper_bound(begin, end, length,
+                             [](std::size_t value, const Route& route) {
+                               return value < route.length;
+                             });
+  if (it == begin) return nullptr;
+  --it;
+  if (exact && it->length != length) return nullptr;
+  return &*it;
+}
+
+void PathTrie::Compile() {
+  nodes_.clear();
+  groups_.clear();
+  children_.clear();
+  routes_.clear();
+
+  nodes_.emplace_back();
+  CompileNode(root_, 0);
+}
+
+void PathTrie::CompileNode(const BuilderNode& builder, std::uint32_t node_id) {
+  nodes_[node_id].routes_begin = routes_.size();
+  for (const auto& [length, route] : builder.routes) {
+    routes_.push_back(Route{length, route});
+  }
+  nodes_[node_id].routes_end = routes_.size();
+
+  // The groups and the children of the node are laid out before descending,
+  // so that the siblings are adjacent
+  const auto groups_begin = static_cast<std::uint32_t>(groups_.size());
+  nodes_[node_id].groups_begin = groups_begin;
+  for (const auto& [index, children] : builder.next) {
+    Group group{index, static_cast<std::uint32_t>(children_.size()), 0, kNone};
+    // std::map orders the keys the same way as std::string_view compares
+    for (const auto& child_item : children) {
+      const auto& segment = child_item.first;
+      const auto child_id = static_cast<std::uint32_t>(nodes_.size());
+      nodes_.emplace_back();
+      children_.push_back(Child{segment, child_id});
+      if (segment == kAnySuffixMark) group.any_suffix_node = child_id;
+    }
+    group.children_end = children_.size();
+    groups_.push_back(group);
+  }
+  nodes_[node_id].groups_end = groups_.size();
+
+  auto group_id = groups_begin;
+  for (const auto& group_item : builder.next) {
+    auto child_id = groups_[group_id].children_begin;
+    for (const auto& child_item : group_item.second) {
+      CompileNode(child_item.second, children_[child_id].node);
+      ++child_id;
+    }
+    ++group_id;
+  }
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
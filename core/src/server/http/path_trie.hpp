@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+// Routing trie over the '/'-separated segments of a path. A route is a set of
+// fixed segments at their positions and the total number of segments, the
+// rest of the positions are wildcards. A route with a fixed "*" segment also
+// matches the longer paths.
+//
+// The routes are added to a tree of maps, after each addition the tree is
+// compiled into flat arrays with integer indexed nodes. Matching works on
+// those arrays and does not allocate.
+class PathTrie final {
+ public:
+  // The segments of a path, they reference the path
+  using Segments = boost::container::small_vector<std::string_view, 16>;
+
+  struct FixedSegment final {
+    std::size_t index;
+    std::string_view segment;
+  };
+
+  static constexpr std::size_t kNoAnySuffix = static_cast<std::size_t>(-1);
+
+  PathTrie();
+
+  // Returns the id of the route, the routes get sequential ids starting from
+  // 0. The same fixed segments with the same length get the same id.
+  // `fixed_segments` must be ordered by index.
+  std::size_t AddRoute(const std::vector<FixedSegment>& fixed_segments,
+                       std::size_t length);
+
+  // Same as boost::split by '/': "/a/b" -> {"", "a", "b"}
+  static void SplitPath(std::string_view path, Segments& segments);
+
+  // Calls `accept(route, any_suffix_index)` for the matching routes from the
+  // most specific one until it returns true. `any_suffix_index` is the
+  // position of the "*" segment or kNoAnySuffix for the exact match.
+  //
+  // The deeper fixed matches are preferred, then the exact match of the
+  // length, then the "*" with the longest fixed prefix.
+  template <typename Accept>
+  bool Match(const Segments& segments, Accept& accept) const {
+    return MatchNode(0, segments, accept);
+  }
+
+ private:
+  static constexpr std::uint32_t kNone = static_cast<std::uint32_t>(-1);
+
+  struct BuilderNode final {
+    // ordered by position in path
+    std::map<std::size_t, std::map<std::string, BuilderNode>> next;
+
+    // by path length
+    std::map<std::size_t, std::size_t> routes;
+  };
+
+  // The groups, the children and the routes of a node are stored
+  // contiguously, [begin, end) ranges reference them
+  struct Node final {
+    std::uint32_t groups_begin{0};
+    std::uint32_t groups_end{0};
+    std::uint32_t routes_begin{0};
+    std::uint32_t routes_end{0};
+  };
+
+  // Children of a node with fixed segments at the same position
+  struct Group final {
+    std::size_t index;
+    std::uint32_t children_begin;
+    std::uint32_t children_end;
+    std::uint32_t any_suffix_node;
+  };
+
+  struct Child final {
+    // references the key of BuilderNode::next
+    std::string_view segment;
+    std::uint32_t node;
+  };
+
+  struct Route final {
+    std::size_t length;
+    std::size_t route;
+  };
+
+  template <typename Accept>
+  bool MatchNode(std::uint32_t node_id, const Segments& segments,
+                 Accept& accept) const {
+    const auto& node = nodes_[node_id];
+    for (auto i = node.groups_begin; i != node.groups_end; ++i) {
+      const auto& group = groups_[i];
+      if (group.index >= segments.size()) break;
+      const auto child = FindChild(group, segments[group.index]);
+      if (child != kNone && MatchNode(child, segments, accept)) return true;
+    }
+
+    // check for match without '*'
+    const auto* route = FindRoute(node, segments.size(), /*exact=*/true);
+    if (route && accept(route->route, kNoAnySuffix)) return true;
+
+    // check "/some/.../path/*"
+    for (auto i = node.groups_end; i != node.groups_begin;) {
+      const auto& group = groups_[--i];
+      if (group.index >= segments.size() || group.any_suffix_node == kNone) {
+        continue;
+      }
+      const auto* suffix_route = FindRoute(nodes_[group.any_suffix_node],
+                                           segments.size(), /*exact=*/false);
+      if (suffix_route && accept(suffix_route->route, group.index)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  std::uint32_t FindChild(const Group& group,
+                          std::string_view segment) const noexcept;
+
+  // Returns the route of `length` if `exact`, otherwise the longest route
+  // that is not longer than `length`
+  const Route* FindRoute(const Node& node, std::size_t length,
+                         bool exact) const noexcept;
+
+  void Compile();
+  void CompileNode(const BuilderNode& builder, std::uint32_t node_id);
+
+  BuilderNode root_;
+  std::size_t route_count_{0};
+
+  std::vector<Node> nodes_;
+  std::vector<Group> groups_;
+  std::vector<Child> children_;
+  std::vector<Route> routes_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
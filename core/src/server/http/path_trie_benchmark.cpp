@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <server/http/path_trie.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+
+// A route table of a typical service: a few API versions of REST resources
+// with the nested item routes, some fixed routes and the static files
+struct RouteTable final {
+  std::vector<std::string> routes;
+  std::vector<std::string> paths;
+};
+
+RouteTable MakeRouteTable(std::int64_t resources_count) {
+  RouteTable table;
+  for (int version = 1; version <= 2; ++version) {
+    for (std::int64_t i = 0; i < resources_count; ++i) {
+      const auto base = fmt::format("/v{}/resource-{}", version, i);
+      table.routes.push_back(base);
+      table.routes.push_back(base + "/{id}");
+      table.routes.push_back(base + "/{id}/items");
+      table.routes.push_back(base + "/{id}/items/{item_id}");
+      table.routes.push_back(base + "/search");
+
+      table.paths.push_back(base + "/search");
+      table.paths.push_back(base + "/1d2c3e4f");
+      table.paths.push_back(base + "/1d2c3e4f/items/42");
+    }
+  }
+  table.routes.emplace_back("/ping");
+  table.routes.emplace_back("/static/*");
+  table.paths.emplace_back("/static/css/main.4f2a.css");
+  return table;
+}
+
+PathTrie MakeTrie(const RouteTable& table) {
+  PathTrie trie;
+  PathTrie::Segments segments;
+  for (const auto& route : table.routes) {
+    PathTrie::SplitPath(route, segments);
+    std::vector<PathTrie::FixedSegment> fixed_segments;
+    for (std::size_t i = 0; i < segments.size(); ++i) {
+      if (segments[i].empty() || segments[i].front() != '{') {
+        fixed_segments.push_back({i, segments[i]});
+      }
+    }
+    trie.AddRoute(fixed_segments, segments.size());
+  }
+  return trie;
+}
+
+void path_trie_match(benchmark::State& state) {
+  const auto table = MakeRouteTable(state.range(0));
+  const auto trie = MakeTrie(table);
+
+  std::size_t i = 0;
+  PathTrie::Segments segments;
+  for ([[maybe_unused]] auto _ : state) {
+    const auto& path = table.paths[i++ % table.paths.size()];
+    PathTrie::SplitPath(path, segments);
+
+    std::size_t matched_route = 0;
+    auto accept = [&matched_route](std::size_t route, std::size_t) {
+      matched_route = route;
+      return true;
+    };
+    benchmark::DoNotOptimize(trie.Match(segments, accept));
+    benchmark::DoNotOptimize(matched_route);
+  }
+}
+BENCHMARK(path_trie_match)->RangeMultiplier(4)->Range(4, 256);
+
+void path_trie_not_found(benchmark::State& state) {
+  const auto table = MakeRouteTable(state.range(0));
+  const auto trie = MakeTrie(table);
+
+  PathTrie::Segments segments;
+  for ([[maybe_unused]] auto _ : state) {
+    PathTrie::SplitPath("/v1/unknown/resource/path", segments);
+    auto accept = [](std::size_t, std::size_t) { return true; };
+    benchmark::DoNotOptimize(trie.Match(segments, accept));
+  }
+}
+BENCHMARK(path_trie_not_found)->RangeMultiplier(4)->Range(4, 256);
+
+}  // namespace
+
+USERVER_NAMESPACE_END
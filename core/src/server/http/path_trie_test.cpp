@@ -0,0 +1,113 @@
+#include <server/http/path_trie.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::impl::PathTrie;
+
+// "{...}" segments are the wildcards
+std::size_t AddRoute(PathTrie& trie, std::string_view pattern) {
+  PathTrie::Segments segments;
+  PathTrie::SplitPath(pattern, segments);
+
+  std::vector<PathTrie::FixedSegment> fixed_segments;
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    if (segments[i].empty() || segments[i].front() != '{') {
+      fixed_segments.push_back({i, segments[i]});
+    }
+  }
+  return trie.AddRoute(fixed_segments, segments.size());
+}
+
+// Returns the candidates in the order they were offered
+std::vector<std::pair<std::size_t, std::size_t>> Candidates(
+    const PathTrie& trie, std::string_view path) {
+  PathTrie::Segments segments;
+  PathTrie::SplitPath(path, segments);
+
+  std::vector<std::pair<std::size_t, std::size_t>> result;
+  auto accept = [&result](std::size_t route, std::size_t any_suffix_index) {
+    result.emplace_back(route, any_suffix_index);
+    return false;
+  };
+  EXPECT_FALSE(trie.Match(segments, accept));
+  return result;
+}
+
+}  // namespace
+
+TEST(PathTrie, SplitPath) {
+  PathTrie::Segments segments;
+
+  PathTrie::SplitPath("/a/bc", segments);
+  EXPECT_EQ(segments, (PathTrie::Segments{"", "a", "bc"}));
+
+  PathTrie::SplitPath("/a/", segments);
+  EXPECT_EQ(segments, (PathTrie::Segments{"", "a", ""}));
+
+  PathTrie::SplitPath("", segments);
+  EXPECT_EQ(segments, (PathTrie::Segments{""}));
+}
+
+TEST(PathTrie, RouteIds) {
+  PathTrie trie;
+  EXPECT_EQ(AddRoute(trie, "/a/{x}"), 0);
+  EXPECT_EQ(AddRoute(trie, "/a/b"), 1);
+  EXPECT_EQ(AddRoute(trie, "/a/{y}"), 0);
+  EXPECT_EQ(AddRoute(trie, "/a/{y}/"), 2);
+}
+
+TEST(PathTrie, Order) {
+  constexpr auto kExact = PathTrie::kNoAnySuffix;
+
+  PathTrie trie;
+  const auto me = AddRoute(trie, "/v1/users/me");
+  const auto user = AddRoute(trie, "/v1/users/{id}");
+  const auto any = AddRoute(trie, "/v1/*");
+  const auto users_any = AddRoute(trie, "/v1/users/*");
+  const auto user_orders = AddRoute(trie, "/v1/users/{id}/orders");
+
+  using Expected = std::vector<std::pair<std::size_t, std::size_t>>;
+  EXPECT_EQ(Candidates(trie, "/v1/users/me"),
+            (Expected{{me, kExact}, {user, kExact}, {users_any, 3}, {any, 2}}));
+  EXPECT_EQ(Candidates(trie, "/v1/users/42"),
+            (Expected{{user, kExact}, {users_any, 3}, {any, 2}}));
+  EXPECT_EQ(Candidates(trie, "/v1/users/42/orders"),
+            (Expected{{user_orders, kExact}, {users_any, 3}, {any, 2}}));
+  EXPECT_EQ(Candidates(trie, "/v1/users"), (Expected{{any, 2}}));
+  EXPECT_EQ(Candidates(trie, "/v1/users/"),
+            (Expected{{user, kExact}, {users_any, 3}, {any, 2}}));
+  EXPECT_EQ(Candidates(trie, "/v2/users/me"), Expected{});
+}
+
+TEST(PathTrie, LongestAnySuffix) {
+  PathTrie trie;
+  const auto short_route = AddRoute(trie, "/static/*");
+  const auto long_route = AddRoute(trie, "/static/*/{a}/{b}");
+
+  PathTrie::Segments segments;
+  PathTrie::SplitPath("/static/a/b/c/d", segments);
+
+  std::vector<std::size_t> routes;
+  auto accept = [&routes](std::size_t route, std::size_t any_suffix_index) {
+    EXPECT_EQ(any_suffix_index, 2);
+    routes.push_back(route);
+    return true;
+  };
+  EXPECT_TRUE(trie.Match(segments, accept));
+  EXPECT_EQ(routes, std::vector<std::size_t>{long_route});
+
+  routes.clear();
+  PathTrie::SplitPath("/static/a", segments);
+  EXPECT_TRUE(trie.Match(segments, accept));
+  EXPECT_EQ(routes, std::vector<std::size_t>{short_route});
+}
+
+USERVER_NAMESPACE_END
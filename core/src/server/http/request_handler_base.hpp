@@ -18,6 +18,13 @@ class RequestHandlerBase {
   virtual engine::TaskWithResult<void> StartRequestTask(
       std::shared_ptr<request::RequestBase> request) const = 0;
 
+  /// Called once the headers of the request are parsed, before its body is
+  /// received. Returns false and sets the response if the request is rejected,
+  /// the body of the request is skipped then.
+  virtual bool AdmitRequest(request::RequestBase& /*request*/) const {
+    return true;
+  }
+
   virtual const HandlerInfoIndex& GetHandlerInfoIndex() const = 0;
 
   virtual const logging::LoggerPtr& LoggerAccess() const noexcept = 0;
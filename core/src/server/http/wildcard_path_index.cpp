@@ -4,13 +4,13 @@
 
 #include <boost/algorithm/string/split.hpp>
 
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::http::impl {
 namespace {
 
-const std::string kAnySuffixMark{"*"};
-
 constexpr char kWildcardStart = '{';
 constexpr char kWildcardFinish = '}';
 
@@ -29,23 +29,11 @@ std::string ExtractWildcardName(const std::string& str) {
   return str.substr(1, str.size() - 2);
 }
 
-bool GetFromHandlerMethodIndex(const WildcardPathIndex::Node& node,
-                               HttpMethod method,
-                               const std::vector<std::string>& path,
-                               MatchRequestResult& match_result,
-                               bool limit_path_length) {
-  const auto& index_map = node.handler_method_index_map;
-  decltype(index_map.begin()) it;
-  if (limit_path_length) {
-    it = index_map.find(path.size());
-  } else {
-    it = index_map.upper_bound(path.size());
-    if (it == index_map.begin()) return false;
-    --it;
-  }
-  if (it == index_map.end()) return false;
-  const auto& handler_method_index = it->second;
-
+bool GetFromHandlerMethodIndex(const HandlerMethodIndex& handler_method_index,
+                               HttpMethod method, std::string_view path_string,
+                               const PathTrie::Segments& path,
+                               std::size_t any_suffix_index,
+                               MatchRequestResult& match_result) {
   const auto* handler_info_data =
       handler_method_index.GetHandlerInfoData(method);
   if (!handler_info_data) {
@@ -60,7 +48,18 @@ bool GetFromHandlerMethodIndex(const WildcardPathIndex::Node& node,
           "matched path from handler has length greater than path from "
           "request");
     match_result.args_from_path.emplace_back(
-        arg.name, arg.index == path.size() ? std::string{} : path[arg.index]);
+        arg.name,
+        arg.index == path.size() ? std::string_view{} : path[arg.index]);
+  }
+
+  if (any_suffix_index == PathTrie::kNoAnySuffix) {
+    match_result.matched_path_length = path_string.size();
+  } else {
+    match_result.matched_path_length =
+        path[any_suffix_index].data() - path_string.data();
+    for (size_t i = any_suffix_index; i < path.size(); i++) {
+      match_result.args_from_path.emplace_back(std::string_view{}, path[i]);
+    }
   }
   match_result.status = MatchRequestResult::Status::kOk;
   return true;
@@ -106,10 +105,16 @@ void WildcardPathIndex::AddHandler(const handlers::HttpHandlerBase& handler,
   }
 }
 
-bool WildcardPathIndex::MatchRequest(HttpMethod method, const std::string& path,
+bool WildcardPathIndex::MatchRequest(HttpMethod method, std::string_view path,
                                      MatchRequestResult& match_result) const {
-  return MatchRequest(root_, method, SplitBySlash(path), path.size(),
-                      match_result);
+  PathTrie::Segments segments;
+  PathTrie::SplitPath(path, segments);
+
+  auto accept = [&](std::size_t route, std::size_t any_suffix_index) {
+    return GetFromHandlerMethodIndex(routes_[route], method, path, segments,
+                                     any_suffix_index, match_result);
+  };
+  return trie_.Match(segments, accept);
 }
 
 void WildcardPathIndex::AddHandler(const std::string& path,
@@ -142,56 +147,16 @@ void WildcardPathIndex::AddPath(const handlers::HttpHandlerBase& handler,
                                 std::vector<PathItem>&& fixed_path,
                                 std::vector<PathItem> wildcards) {
   size_t length = fixed_path.size() + wildcards.size();
-  Node* cur = &root_;
-  for (auto& path_item : std::move(fixed_path)) {
-    cur = &cur->next[path_item.index][std::move(path_item.name)];
-  }
-  cur->handler_method_index_map[length].AddHandler(handler, task_processor,
-                                                   std::move(wildcards));
-}
-
-bool WildcardPathIndex::MatchRequest(const Node& node, HttpMethod method,
-                                     const std::vector<std::string>& path,
-                                     size_t path_string_length,
-                                     MatchRequestResult& match_result) const {
-  for (const auto& next_item : node.next) {
-    if (next_item.first >= path.size()) break;
-    auto it = next_item.second.find(path[next_item.first]);
-    if (it != next_item.second.end()) {
-      if (MatchRequest(it->second, method, path, path_string_length,
-                       match_result))
-        return true;
-    }
-  }
-
-  // check for match without '*'
-  if (GetFromHandlerMethodIndex(node, method, path, match_result, true)) {
-    match_result.matched_path_length = path_string_length;
-    return true;
-  }
-
-  // check "/some/.../path/*"
-  auto node_next_it = node.next.lower_bound(path.size());
-  while (node_next_it != node.next.begin()) {
-    --node_next_it;
-    auto it = node_next_it->second.find(kAnySuffixMark);
-    if (it != node_next_it->second.end()) {
-      if (GetFromHandlerMethodIndex(it->second, method, path, match_result,
-                                    false)) {
-        size_t asterisk_pos = node_next_it->first;
-        match_result.matched_path_length = asterisk_pos;
-        for (size_t i = 0; i < asterisk_pos; i++) {
-          match_result.matched_path_length += path[i].size();
-        }
-        for (size_t i = asterisk_pos; i < path.size(); i++) {
-          match_result.args_from_path.emplace_back(std::string{}, path[i]);
-        }
-        return true;
-      }
-    }
+  std::vector<PathTrie::FixedSegment> fixed_segments;
+  fixed_segments.reserve(fixed_path.size());
+  for (const auto& path_item : fixed_path) {
+    fixed_segments.push_back({path_item.index, path_item.name});
   }
 
-  return false;
+  const auto route = trie_.AddRoute(fixed_segments, length);
+  if (route == routes_.size()) routes_.emplace_back();
+  UASSERT(route < routes_.size());
+  routes_[route].AddHandler(handler, task_processor, std::move(wildcards));
 }
 
 PathItem WildcardPathIndex::ExtractFixedPathItem(size_t index,
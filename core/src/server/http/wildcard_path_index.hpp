@@ -1,7 +1,8 @@
 #pragma once
 
-#include <map>
+#include <deque>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
@@ -9,6 +10,7 @@
 
 #include <server/http/handler_info_index.hpp>
 #include <server/http/handler_method_index.hpp>
+#include <server/http/path_trie.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_method.hpp>
 
@@ -20,18 +22,10 @@ bool HasWildcardSpecificSymbols(const std::string& path);
 
 class WildcardPathIndex final {
  public:
-  struct Node {
-    // ordered by position in path
-    std::map<size_t, std::map<std::string, Node>> next;
-
-    // by path length
-    std::map<size_t, HandlerMethodIndex> handler_method_index_map;
-  };
-
   void AddHandler(const handlers::HttpHandlerBase& handler,
                   engine::TaskProcessor& task_processor);
 
-  bool MatchRequest(HttpMethod method, const std::string& path,
+  bool MatchRequest(HttpMethod method, std::string_view path,
                     MatchRequestResult& match_result) const;
 
  private:
@@ -44,18 +38,15 @@ class WildcardPathIndex final {
                std::vector<PathItem>&& fixed_path,
                std::vector<PathItem> wildcards);
 
-  bool MatchRequest(const Node& node, HttpMethod method,
-                    const std::vector<std::string>& path,
-                    size_t path_string_length,
-                    MatchRequestResult& match_result) const;
-
   static PathItem ExtractFixedPathItem(size_t index, std::string&& path_elem);
 
   static PathItem ExtractWildcardPathItem(
       size_t index, const std::string& path_elem,
       std::unordered_set<std::string>& wildcard_names);
 
-  Node root_;
+  PathTrie trie_;
+  // by route id of trie_
+  std::deque<HandlerMethodIndex> routes_;
 };
 
 }  // namespace server::http::impl
@@ -0,0 +1,154 @@
+#include <server/middlewares/compression.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/tracing/scope_time.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+constexpr std::string_view kVaryValue = "Accept-Encoding";
+
+bool StartsWith(std::string_view value, std::string_view prefix) {
+  return value.substr(0, prefix.size()) == prefix;
+}
+
+bool IsCompressibleStatus(http::HttpStatus status) {
+  const auto code = static_cast<int>(status);
+  return code >= 200 && status != http::HttpStatus::kNoContent &&
+         status != http::HttpStatus::kPartialContent &&
+         status != http::HttpStatus::kNotModified;
+}
+
+// The data of these types is compressed already
+bool IsCompressibleContentType(std::string_view content_type) {
+  if (StartsWith(content_type, "image/")) {
+    return StartsWith(content_type, "image/svg+xml");
+  }
+  constexpr std::string_view kCompressedTypes[] = {
+      "audio/",           "video/",           "font/woff",
+      "application/zip",  "application/gzip", "application/x-gzip",
+      "application/zstd", "application/x-7z-compressed",
+  };
+  for (const auto type : kCompressedTypes) {
+    if (StartsWith(content_type, type)) return false;
+  }
+  return true;
+}
+
+void AddVaryAcceptEncoding(http::HttpResponse& response) {
+  const auto& vary =
+      response.GetHeader(USERVER_NAMESPACE::http::headers::kVary);
+  if (vary.empty()) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       std::string{kVaryValue});
+  } else if (vary.find(kVaryValue) == std::string::npos) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       fmt::format("{}, {}", vary, kVaryValue));
+  }
+}
+
+}  // namespace
+
+Compression::Compression(const handlers::HttpHandlerBase& handler,
+                         const components::ComponentConfig&)
+    : enabled_(handler.GetConfig().response_compression.enabled),
+      min_size_(handler.GetConfig().response_compression.min_size) {
+  const auto& config = handler.GetConfig().response_compression;
+  levels_[static_cast<std::size_t>(compression::Encoding::kGzip)] =
+      config.gzip_level;
+  levels_[static_cast<std::size_t>(compression::Encoding::kBrotli)] =
+      config.brotli_level;
+  levels_[static_cast<std::size_t>(compression::Encoding::kZstd)] =
+      config.zstd_level;
+  if (!enabled_) return;
+
+  for (const auto& name : config.encodings) {
+    const auto encoding = compression::EncodingFromString(name);
+    if (!compression::IsSupported(encoding)) {
+      LOG_WARNING() << "'" << name
+                    << "' response compression is disabled at build time";
+      continue;
+    }
+    // Throws on the invalid levels at startup
+    compression::MakeCompressor(encoding, GetLevel(encoding));
+    encodings_.push_back(encoding);
+  }
+}
+
+bool Compression::IsNoop() const noexcept {
+  return !enabled_ || encodings_.empty();
+}
+
+void Compression::HandleRequest(http::HttpRequest& request,
+                                request::RequestContext& context) const {
+  if (IsNoop()) {
+    Next(request, context);
+    return;
+  }
+
+  auto& response = request.GetHttpResponse();
+  const auto encoding = compression::NegotiateEncoding(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding),
+      encodings_);
+
+  if (response.IsBodyStreamed()) {
+    AddVaryAcceptEncoding(response);
+    if (encoding) {
+      // ResponseBodyStream compresses the chunks and sets Content-Encoding
+      response.SetBodyStreamCompressor(
+          compression::MakeCompressor(*encoding, GetLevel(*encoding)));
+    }
+    Next(request, context);
+    return;
+  }
+
+  Next(request, context);
+  CompressResponse(response, encoding);
+}
+
+void Compression::CompressResponse(
+    http::HttpResponse& response,
+    std::optional<compression::Encoding> encoding) const {
+  if (!IsCompressibleStatus(response.GetStatus()) ||
+      response.HasHeader(USERVER_NAMESPACE::http::headers::kContentEncoding) ||
+      !IsCompressibleContentType(
+          response.GetHeader(USERVER_NAMESPACE::http::headers::kContentType))) {
+    return;
+  }
+
+  const auto& data = response.GetData();
+  if (data.size() < min_size_) return;
+
+  AddVaryAcceptEncoding(response);
+  if (!encoding) return;
+
+  const auto scope_time =
+      tracing::ScopeTime::CreateOptionalScopeTime("http_compress_response");
+  try {
+    auto compressed =
+        compression::Compress(*encoding, data, GetLevel(*encoding));
+    if (compressed.size() >= data.size()) return;
+
+    response.SetData(std::move(compressed));
+    response.SetContentEncoding(std::string{compression::ToString(*encoding)});
+  } catch (const compression::CompressionError& e) {
+    LOG_ERROR() << "Failed to compress the response, sending it as is: " << e;
+  }
+}
+
+int Compression::GetLevel(compression::Encoding encoding) const {
+  return levels_[static_cast<std::size_t>(encoding)];
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include <compression/compressor.hpp>
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+class HttpResponse;
+}
+
+namespace server::middlewares {
+
+class Compression final : public HttpMiddlewareBase {
+ public:
+  static constexpr std::string_view kName{"userver-compression-middleware"};
+
+  Compression(const handlers::HttpHandlerBase&,
+              const components::ComponentConfig&);
+
+ private:
+  void HandleRequest(http::HttpRequest& request,
+                     request::RequestContext& context) const override;
+
+  bool IsNoop() const noexcept override;
+
+  void CompressResponse(http::HttpResponse& response,
+                        std::optional<compression::Encoding> encoding) const;
+
+  int GetLevel(compression::Encoding encoding) const;
+
+  const bool enabled_;
+  const std::size_t min_size_;
+  // Supported ones in the order of preference
+  std::vector<compression::Encoding> encodings_;
+  // By compression::Encoding
+  std::array<int, 3> levels_{};
+};
+
+using CompressionFactory = SimpleHttpMiddlewareFactory<Compression>;
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
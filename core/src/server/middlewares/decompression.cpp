@@ -36,6 +36,8 @@ void Decompression::HandleRequest(http::HttpRequest& request,
   }
 }
 
+bool Decompression::IsNoop() const noexcept { return !decompress_request_; }
+
 bool Decompression::DecompressRequestBody(http::HttpRequest& request) const {
   if (!decompress_request_ || !request.IsBodyCompressed()) {
     return true;
@@ -92,6 +94,10 @@ void SetAcceptEncoding::HandleRequest(http::HttpRequest& request,
   Next(request, context);
 }
 
+bool SetAcceptEncoding::IsNoop() const noexcept {
+  return !decompress_request_;
+}
+
 void SetAcceptEncoding::SetResponseAcceptEncoding(
     http::HttpResponse& response) const {
   if (!decompress_request_) return;
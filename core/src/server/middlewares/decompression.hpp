@@ -26,6 +26,8 @@ class Decompression final : public HttpMiddlewareBase {
   void HandleRequest(http::HttpRequest& request,
                      request::RequestContext& context) const override;
 
+  bool IsNoop() const noexcept override;
+
   bool DecompressRequestBody(http::HttpRequest& request) const;
 
   const bool decompress_request_;
@@ -49,6 +51,8 @@ class SetAcceptEncoding final : public HttpMiddlewareBase {
   void HandleRequest(http::HttpRequest& request,
                      request::RequestContext& context) const override;
 
+  bool IsNoop() const noexcept override;
+
   void SetResponseAcceptEncoding(http::HttpResponse& response) const;
 
   const bool decompress_request_;
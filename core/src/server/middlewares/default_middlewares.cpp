@@ -4,6 +4,7 @@
 
 #include <server/middlewares/auth.hpp>
 #include <server/middlewares/baggage.hpp>
+#include <server/middlewares/compression.hpp>
 #include <server/middlewares/deadline_propagation.hpp>
 #include <server/middlewares/decompression.hpp>
 #include <server/middlewares/exceptions_handling.hpp>
@@ -27,6 +28,7 @@ components::ComponentList DefaultMiddlewaresList() {
       .Append<DeadlinePropagationFactory>()
       .Append<DecompressionFactory>()
       .Append<SetAcceptEncodingFactory>()
+      .Append<CompressionFactory>()
       .Append<ExceptionsHandlingFactory>()
       .Append<UnknownExceptionsHandlingFactory>();
 }
@@ -16,6 +16,8 @@ void HttpMiddlewareBase::Next(http::HttpRequest& request,
   next_->HandleRequest(request, context);
 }
 
+bool HttpMiddlewareBase::IsNoop() const noexcept { return false; }
+
 HttpMiddlewareFactoryBase::HttpMiddlewareFactoryBase(
     const components::ComponentConfig& config,
     const components::ComponentContext& context)
@@ -0,0 +1,34 @@
+#include <server/middlewares/pipeline.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares::impl {
+
+void PipelineBuilder::Append(std::unique_ptr<HttpMiddlewareBase> middleware) {
+  UASSERT(middleware);
+  if (middleware->IsNoop()) {
+    ++skipped_;
+    return;
+  }
+
+  *next_ = std::move(middleware);
+  next_ = &(*next_)->next_;
+}
+
+std::unique_ptr<HttpMiddlewareBase> PipelineBuilder::Build() && {
+  UASSERT_MSG(first_, "The pipeline is empty");
+  next_ = &first_;
+  return std::move(first_);
+}
+
+void PipelineBuilder::Run(const HttpMiddlewareBase& first,
+                          http::HttpRequest& request,
+                          request::RequestContext& context) {
+  first.HandleRequest(request, context);
+}
+
+}  // namespace server::middlewares::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <userver/server/middlewares/http_middleware_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares::impl {
+
+// Links the middlewares of a handler into a chain. Middlewares that are
+// no-ops for the handler are dropped at startup, so that a request only pays
+// for the stages that do something.
+class PipelineBuilder final {
+ public:
+  PipelineBuilder() = default;
+
+  PipelineBuilder(const PipelineBuilder&) = delete;
+  PipelineBuilder& operator=(const PipelineBuilder&) = delete;
+
+  // The last appended middleware must not call Next()
+  void Append(std::unique_ptr<HttpMiddlewareBase> middleware);
+
+  std::unique_ptr<HttpMiddlewareBase> Build() &&;
+
+  std::size_t GetSkippedCount() const noexcept { return skipped_; }
+
+  static void Run(const HttpMiddlewareBase& first, http::HttpRequest& request,
+                  request::RequestContext& context);
+
+ private:
+  std::unique_ptr<HttpMiddlewareBase> first_;
+  std::unique_ptr<HttpMiddlewareBase>* next_{&first_};
+  std::size_t skipped_{0};
+};
+
+}  // namespace server::middlewares::impl
+
+USERVER_NAMESPACE_END
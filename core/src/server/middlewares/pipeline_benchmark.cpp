@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+#include <server/http/http_request_impl.hpp>
+#include <server/middlewares/pipeline.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/request/request_context.hpp>
+#include <userver/server/request/response_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Per-request cost of the middleware pipeline itself, without the work of
+// the stages
+
+class PassThrough final : public server::middlewares::HttpMiddlewareBase {
+ public:
+  explicit PassThrough(bool is_noop) : is_noop_(is_noop) {}
+
+ private:
+  void HandleRequest(server::http::HttpRequest& request,
+                     server::request::RequestContext& context) const override {
+    benchmark::DoNotOptimize(this);
+    Next(request, context);
+  }
+
+  bool IsNoop() const noexcept override { return is_noop_; }
+
+  const bool is_noop_;
+};
+
+class Terminal final : public server::middlewares::HttpMiddlewareBase {
+ private:
+  void HandleRequest(server::http::HttpRequest&,
+                     server::request::RequestContext&) const override {
+    benchmark::DoNotOptimize(this);
+  }
+};
+
+template <typename BuildPipeline>
+void RunPipeline(benchmark::State& state, BuildPipeline build_pipeline) {
+  engine::RunStandalone([&] {
+    server::middlewares::impl::PipelineBuilder builder;
+    build_pipeline(builder);
+    builder.Append(std::make_unique<Terminal>());
+    const auto pipeline = std::move(builder).Build();
+
+    server::request::ResponseDataAccounter data_accounter;
+    server::http::HttpRequestImpl request_impl{data_accounter};
+    server::http::HttpRequest request{request_impl};
+    server::request::RequestContext context;
+
+    for ([[maybe_unused]] auto _ : state) {
+      server::middlewares::impl::PipelineBuilder::Run(*pipeline, request,
+                                                      context);
+    }
+  });
+}
+
+}  // namespace
+
+// A chain of N stages that only call Next()
+void middleware_pipeline_chain(benchmark::State& state) {
+  RunPipeline(state, [&](auto& builder) {
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      builder.Append(std::make_unique<PassThrough>(false));
+    }
+  });
+}
+BENCHMARK(middleware_pipeline_chain)->RangeMultiplier(2)->Range(1, 16);
+
+// The shape of the default pipeline: 11 stages before the handler, 4 of which
+// are no-ops for a handler without compression and rate limits. Arg is 1 if
+// the no-op stages are dropped at startup.
+void middleware_pipeline_default_shape(benchmark::State& state) {
+  const bool skip_noops = state.range(0);
+  RunPipeline(state, [&](auto& builder) {
+    constexpr bool kIsNoop[] = {false, false, true,  false, true, true,
+                                false, false, false, true,  false};
+    for (const bool is_noop : kIsNoop) {
+      builder.Append(std::make_unique<PassThrough>(is_noop && skip_noops));
+    }
+  });
+  state.counters["skipped"] = skip_noops ? 4 : 0;
+}
+BENCHMARK(middleware_pipeline_default_shape)->DenseRange(0, 1);
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <server/middlewares/rate_limit.hpp>
 
+#include <server/handlers/adaptive_concurrency_limiter.hpp>
 #include <server/handlers/http_handler_base_statistics.hpp>
 
 #include <userver/http/common_headers.hpp>
@@ -17,6 +18,7 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler,
       statistics_{handler.GetHandlerStatistics()},
       max_requests_per_second_{handler.GetConfig().max_requests_per_second},
       max_requests_in_flight_{handler.GetConfig().max_requests_in_flight},
+      adaptive_concurrency_{handler.GetAdaptiveConcurrencyLimiter()},
       handler_{handler} {
   if (max_requests_per_second_.has_value()) {
     const auto max_rps = *max_requests_per_second_;
@@ -31,9 +33,25 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler,
 
 void RateLimit::HandleRequest(http::HttpRequest& request,
                               request::RequestContext& context) const {
-  if (CheckRateLimit(request)) {
+  if (!CheckRateLimit(request)) return;
+
+  if (!adaptive_concurrency_) {
     Next(request, context);
+    return;
+  }
+
+  // Measures the latency of the request until the token is destroyed
+  const auto token = adaptive_concurrency_->TryAcquire();
+  if (!token) {
+    RejectOverAdaptiveLimit(request);
+    return;
   }
+  Next(request, context);
+}
+
+bool RateLimit::IsNoop() const noexcept {
+  return !max_requests_per_second_ && !max_requests_in_flight_ &&
+         !adaptive_concurrency_;
 }
 
 bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
@@ -57,9 +75,9 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
   }
 
   auto max_requests_in_flight = max_requests_in_flight_;
-  auto requests_in_flight = statistics.GetInFlight();
+  // GetInFlight() sums the sharded counters, do not call it without a limit
   if (max_requests_in_flight &&
-      (requests_in_flight > *max_requests_in_flight)) {
+      (statistics.GetInFlight() > *max_requests_in_flight)) {
     auto& http_response = request.GetHttpResponse();
     auto log_reason = fmt::format("reached max_requests_in_flight={}",
                                   *max_requests_in_flight);
@@ -77,6 +95,21 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
   return true;
 }
 
+void RateLimit::RejectOverAdaptiveLimit(
+    const http::HttpRequest& request) const {
+  auto& http_response = request.GetHttpResponse();
+  auto log_reason = fmt::format("reached adaptive concurrency limit={}",
+                                adaptive_concurrency_->GetLimit());
+  SetThrottleReason(
+      http_response, std::move(log_reason),
+      std::string{
+          USERVER_NAMESPACE::http::headers::ratelimit_reason::kInFlight});
+
+  statistics_.ForMethod(request.GetMethod()).IncrementTooManyRequestsInFlight();
+
+  FailProcessingAndSetResponse(request);
+}
+
 void RateLimit::FailProcessingAndSetResponse(
     const http::HttpRequest& request) const {
   const auto ex = handlers::ExceptionWithCode<
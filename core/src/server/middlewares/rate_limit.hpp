@@ -9,6 +9,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
 class HttpHandlerStatistics;
+class AdaptiveConcurrencyLimiter;
 }
 
 namespace server::middlewares {
@@ -24,8 +25,12 @@ class RateLimit final : public HttpMiddlewareBase {
   void HandleRequest(http::HttpRequest& request,
                      request::RequestContext& context) const override;
 
+  bool IsNoop() const noexcept override;
+
   bool CheckRateLimit(const http::HttpRequest& request) const;
 
+  void RejectOverAdaptiveLimit(const http::HttpRequest& request) const;
+
   void FailProcessingAndSetResponse(const http::HttpRequest& request) const;
 
   mutable utils::TokenBucket rate_limit_;
@@ -33,6 +38,7 @@ class RateLimit final : public HttpMiddlewareBase {
 
   std::optional<std::size_t> max_requests_per_second_;
   std::optional<std::size_t> max_requests_in_flight_;
+  handlers::AdaptiveConcurrencyLimiter* adaptive_concurrency_;
 
   const handlers::HttpHandlerBase& handler_;
 };
@@ -0,0 +1,111 @@
+#include <server/net/buffer_pool.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+namespace {
+
+// Reads that fit into a quarter of the buffer before it shrinks. Keeps the
+// size stable for the connections with the interleaved small and big requests
+constexpr std::size_t kShrinkAfterSmallReads = 16;
+
+}  // namespace
+
+struct BufferPool::SizeClass final {
+  SizeClass(std::size_t size, std::size_t capacity)
+      : size(size), capacity(capacity), free_buffers(capacity) {}
+
+  const std::size_t size;
+  const std::size_t capacity;
+  boost::lockfree::stack<std::vector<char>*> free_buffers;
+};
+
+struct BufferPool::Deleter final {
+  void operator()(std::vector<char>* buffer) const noexcept {
+    pool->Release(size_class, buffer);
+  }
+
+  std::shared_ptr<BufferPool> pool;
+  std::size_t size_class;
+};
+
+BufferPool::BufferPool(std::size_t min_size, std::size_t max_size,
+                       std::size_t max_idle_size) {
+  UINVARIANT(min_size > 0 && min_size <= max_size,
+             "Invalid receive buffer sizes");
+
+  std::vector<std::size_t> sizes;
+  for (auto size = min_size; size < max_size; size *= 2) sizes.push_back(size);
+  sizes.push_back(max_size);
+
+  // The idle memory is split evenly between the size classes
+  const auto class_idle_size = max_idle_size / sizes.size();
+  classes_.reserve(sizes.size());
+  for (const auto size : sizes) {
+    classes_.push_back(
+        std::make_unique<SizeClass>(size, class_idle_size / size));
+  }
+}
+
+BufferPool::BufferPool(const ConnectionConfig& config)
+    : BufferPool(config.in_buffer_min_size, config.in_buffer_size,
+                 config.in_buffer_pool_size) {}
+
+BufferPool::~BufferPool() {
+  for (auto& size_class : classes_) {
+    size_class->free_buffers.consume_all(
+        [](std::vector<char>* buffer) { delete buffer; });
+  }
+}
+
+std::size_t BufferPool::GetBufferSize(std::size_t size_class) const noexcept {
+  UASSERT(size_class < classes_.size());
+  return classes_[size_class]->size;
+}
+
+BufferPool::Buffer BufferPool::Acquire(std::size_t size_class) {
+  UASSERT(size_class < classes_.size());
+  auto& free_buffers = classes_[size_class]->free_buffers;
+
+  std::vector<char>* buffer = nullptr;
+  if (!free_buffers.pop(buffer)) {
+    buffer = new std::vector<char>(classes_[size_class]->size);
+  }
+  return Buffer{buffer, Deleter{shared_from_this(), size_class}};
+}
+
+void BufferPool::Release(std::size_t size_class,
+                         std::vector<char>* buffer) noexcept {
+  auto& free_buffers = classes_[size_class]->free_buffers;
+  if (classes_[size_class]->capacity == 0 ||
+      !free_buffers.bounded_push(buffer)) {
+    delete buffer;
+  }
+}
+
+BufferSizer::BufferSizer(const BufferPool& pool) noexcept : pool_(pool) {}
+
+void BufferSizer::OnRead(std::size_t bytes_read) noexcept {
+  const auto size = pool_.GetBufferSize(size_class_);
+  if (bytes_read >= size) {
+    small_reads_ = 0;
+    if (size_class_ + 1 < pool_.GetSizeClassCount()) ++size_class_;
+    return;
+  }
+
+  if (size_class_ == 0 || bytes_read > size / 4) {
+    small_reads_ = 0;
+    return;
+  }
+  if (++small_reads_ == kShrinkAfterSmallReads) {
+    small_reads_ = 0;
+    --size_class_;
+  }
+}
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <boost/lockfree/stack.hpp>
+
+#include <server/net/connection_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::net {
+
+/// The receive buffers shared by the connections of a listener. The sizes
+/// of the buffers are the power of two multiples of the min size, each size
+/// class has its own bounded free list.
+class BufferPool final : public std::enable_shared_from_this<BufferPool> {
+ public:
+  /// The buffer returns to the pool when the last reference is dropped
+  using Buffer = std::shared_ptr<std::vector<char>>;
+
+  BufferPool(std::size_t min_size, std::size_t max_size,
+             std::size_t max_idle_size);
+  explicit BufferPool(const ConnectionConfig& config);
+  ~BufferPool();
+
+  BufferPool(const BufferPool&) = delete;
+  BufferPool& operator=(const BufferPool&) = delete;
+
+  std::size_t GetSizeClassCount() const noexcept { return classes_.size(); }
+  std::size_t GetBufferSize(std::size_t size_class) const noexcept;
+
+  /// The pool must be owned by a std::shared_ptr
+  Buffer Acquire(std::size_t size_class);
+
+ private:
+  struct SizeClass;
+  struct Deleter;
+
+  void Release(std::size_t size_class, std::vector<char>* buffer) noexcept;
+
+  std::vector<std::unique_ptr<SizeClass>> classes_;
+};
+
+/// Chooses the size class of the receive buffer of a connection by the
+/// sizes of the previous reads: grows when a read fills the whole buffer and
+/// shrinks after a series of reads that fit into a quarter of it.
+class BufferSizer final {
+ public:
+  explicit BufferSizer(const BufferPool& pool) noexcept;
+
+  std::size_t GetSizeClass() const noexcept { return size_class_; }
+
+  void OnRead(std::size_t bytes_read) noexcept;
+
+ private:
+  const BufferPool& pool_;
+  std::size_t size_class_{0};
+  std::size_t small_reads_{0};
+};
+
+}  // namespace server::net
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,68 @@
+#include <server/net/buffer_pool.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace net = server::net;
+
+TEST(ServerNetBufferPool, SizeClasses) {
+  const auto pool = std::make_shared<net::BufferPool>(4096, 30000, 1 << 20);
+  ASSERT_EQ(pool->GetSizeClassCount(), 4);
+  EXPECT_EQ(pool->GetBufferSize(0), 4096);
+  EXPECT_EQ(pool->GetBufferSize(2), 16384);
+  EXPECT_EQ(pool->GetBufferSize(3), 30000);
+
+  const auto single = std::make_shared<net::BufferPool>(4096, 4096, 0);
+  EXPECT_EQ(single->GetSizeClassCount(), 1);
+  EXPECT_EQ(single->Acquire(0)->size(), 4096);
+}
+
+TEST(ServerNetBufferPool, Reuse) {
+  const auto pool = std::make_shared<net::BufferPool>(1024, 4096, 1 << 20);
+
+  auto buffer = pool->Acquire(1);
+  EXPECT_EQ(buffer->size(), 2048);
+  const auto* data = buffer->data();
+
+  // The buffer outlives its references in the request bodies
+  net::BufferPool::Buffer body_view = buffer;
+  buffer.reset();
+  EXPECT_NE(pool->Acquire(1)->data(), data) << "the buffer is still in use";
+
+  body_view.reset();
+  EXPECT_EQ(pool->Acquire(1)->data(), data);
+  EXPECT_NE(pool->Acquire(0)->data(), data);
+}
+
+TEST(ServerNetBufferPool, NoIdleBuffers) {
+  const auto pool = std::make_shared<net::BufferPool>(1024, 1024, 1023);
+  auto first = pool->Acquire(0);
+  auto second = pool->Acquire(0);
+  first.reset();
+  second.reset();
+}
+
+TEST(ServerNetBufferSizer, GrowAndShrink) {
+  const auto pool = std::make_shared<net::BufferPool>(1024, 4096, 1 << 20);
+  net::BufferSizer sizer{*pool};
+  EXPECT_EQ(sizer.GetSizeClass(), 0);
+
+  sizer.OnRead(1024);
+  EXPECT_EQ(sizer.GetSizeClass(), 1);
+  sizer.OnRead(2048);
+  sizer.OnRead(4096);
+  sizer.OnRead(4096);
+  EXPECT_EQ(sizer.GetSizeClass(), 2);
+
+  // A big read breaks the series of the small ones
+  for (int i = 0; i < 10; ++i) sizer.OnRead(100);
+  sizer.OnRead(3000);
+  for (int i = 0; i < 10; ++i) sizer.OnRead(100);
+  EXPECT_EQ(sizer.GetSizeClass(), 2);
+
+  for (int i = 0; i < 100; ++i) sizer.OnRead(100);
+  EXPECT_EQ(sizer.GetSizeClass(), 0);
+}
+
+USERVER_NAMESPACE_END
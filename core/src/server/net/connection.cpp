@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <array>
+#include <mutex>
 #include <stdexcept>
 #include <system_error>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <server/http/http_request_parser.hpp>
@@ -13,29 +16,61 @@
 #include <userver/engine/exception.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/server/http/http_response.hpp>
 #include <userver/server/request/request_config.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+// The amount of the serialized HTTP/2 frames to send with a single write
+constexpr std::size_t kHttp2OutputChunkSize = 64 * 1024;
+
+}  // namespace
+
+struct Connection::Http2Stream final {
+  std::shared_ptr<request::RequestBase> request;
+  engine::TaskWithResult<void> responder;
+};
+
+/// The state of an HTTP/2 connection that is shared by the reader, the
+/// writer and the responders of the streams.
+struct Connection::Http2State final {
+  engine::Mutex mutex;
+  std::optional<http::Http2Session> session;
+  std::unordered_map<Http2StreamId, Http2Stream> streams;
+  // The streams that are closed by the session, but are not finished yet
+  std::vector<std::pair<Http2Stream, std::optional<std::size_t>>>
+      closed_streams;
+  bool is_reading_finished{false};
+
+  // Notifies the writer about the frames to serialize
+  engine::SingleConsumerEvent output_event;
+};
+
 Connection::Connection(
     const ConnectionConfig& config,
     const request::HttpRequestConfig& handler_defaults_config,
     std::unique_ptr<engine::io::RwBase> peer_socket,
     const engine::io::Sockaddr& remote_address,
     const http::RequestHandlerBase& request_handler,
-    std::shared_ptr<Stats> stats,
+    std::shared_ptr<Stats> stats, std::shared_ptr<BufferPool> buffer_pool,
     request::ResponseDataAccounter& data_accounter)
     : config_(config),
       handler_defaults_config_(handler_defaults_config),
       peer_socket_(std::move(peer_socket)),
       request_handler_(request_handler),
       stats_(std::move(stats)),
+      buffer_pool_(std::move(buffer_pool)),
       data_accounter_(data_accounter),
       remote_address_(remote_address),
       peer_name_(remote_address_.PrimaryAddressString()),
@@ -48,6 +83,12 @@ Connection::Connection(
 }
 
 void Connection::Process() {
+  if (config_.http_version == HttpVersion::k2 && IsHttp2Connection()) {
+    ProcessHttp2();
+    Shutdown();
+    return;
+  }
+
   LOG_TRACE() << "Starting socket listener for fd " << Fd();
 
   // In case of TaskProcessor overload keep receiving requests as we wish to
@@ -109,11 +150,28 @@ void Connection::ListenForRequests(
             is_accepting_requests_ = false;
           }
         },
-        stats_->parser_stats, data_accounter_);
+        stats_->parser_stats, data_accounter_,
+        [this](request::RequestBase& request) {
+          return request_handler_.AdmitRequest(request);
+        });
 
-    std::vector<char> buf(config_.in_buffer_size);
-    std::size_t last_bytes_read = 0;
+    if (!pending_input_.empty()) {
+      if (!request_parser.Parse(pending_input_.data(), pending_input_.size())) {
+        LOG_DEBUG() << "Malformed request from " << Getpeername() << " on fd "
+                    << Fd();
+        is_accepting_requests_ = false;
+      }
+      pending_input_ = std::string{};
+    }
+
+    // The requests with `zero_copy_body` may keep the buffer alive, it
+    // returns to the pool with the last of them
+    BufferSizer buffer_sizer{*buffer_pool_};
+    BufferPool::Buffer buf;
+    bool is_buffer_filled = false;
     while (is_accepting_requests_) {
+      if (!WaitForPipelinedResponses()) return;
+
       auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
 
       bool is_readable = true;
@@ -127,14 +185,17 @@ void Connection::ListenForRequests(
       // 3. recv (return some data)
       //
       // So instead we just do 2. and 3., shaving off a whole recv syscall
-      if (last_bytes_read != buf.size()) {
+      if (!is_buffer_filled) {
+        // The connection may stay idle for a long time, do not pin the buffer
+        buf.reset();
         is_readable = peer_socket_->WaitReadable(deadline);
       }
-
-      last_bytes_read =
-          is_readable ? peer_socket_->ReadSome(buf.data(), buf.size(), deadline)
-                      : 0;
-      if (!last_bytes_read) {
+      std::size_t bytes_read = 0;
+      if (is_readable) {
+        if (!buf) buf = buffer_pool_->Acquire(buffer_sizer.GetSizeClass());
+        bytes_read = peer_socket_->ReadSome(buf->data(), buf->size(), deadline);
+      }
+      if (!bytes_read) {
         LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
                     << " closed connection or the connection timed out";
 
@@ -147,16 +208,22 @@ void Connection::ListenForRequests(
         // processing and pending requests.
         return;
       }
-      LOG_TRACE() << "Received " << last_bytes_read << " byte(s) from "
+      LOG_TRACE() << "Received " << bytes_read << " byte(s) from "
                   << Getpeername() << " on fd " << Fd();
 
-      if (!request_parser.Parse(buf.data(), last_bytes_read)) {
+      is_buffer_filled = bytes_read == buf->size();
+      if (!request_parser.Parse(buf->data(), bytes_read, buf)) {
         LOG_DEBUG() << "Malformed request from " << Getpeername() << " on fd "
                     << Fd();
 
         // Stop accepting new requests, send previous answers.
         is_accepting_requests_ = false;
       }
+      const auto size_class = buffer_sizer.GetSizeClass();
+      buffer_sizer.OnRead(bytes_read);
+      if (buf.use_count() != 1 || buffer_sizer.GetSizeClass() != size_class) {
+        buf.reset();
+      }
     }
 
     send_stopper.Release();
@@ -200,11 +267,24 @@ bool Connection::NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
   return producer.Push({std::move(request_ptr), std::move(task)});
 }
 
+bool Connection::WaitForPipelinedResponses() {
+  // The handlers of the pipelined requests run in parallel, but the responses
+  // are sent in order. Do not start new handlers while the ready responses
+  // pile up behind a slow one.
+  while (data_accounter_.GetCurrentLevel() >
+         config_.max_pipelined_responses_size) {
+    LOG_TRACE() << "Waiting for " << data_accounter_.GetCurrentLevel()
+                << " bytes of pipelined responses to be sent on fd " << Fd();
+    if (!response_sent_event_.WaitForEvent()) return false;
+  }
+  return true;
+}
+
 void Connection::ProcessResponses(Queue::Consumer& consumer) noexcept {
   try {
     QueueItem item;
     while (consumer.Pop(item)) {
-      HandleQueueItem(item);
+      if (!HandleQueueItem(item)) is_response_chain_valid_ = false;
 
       // now we must complete processing
       engine::TaskCancellationBlocker block_cancel;
@@ -218,13 +298,14 @@ void Connection::ProcessResponses(Queue::Consumer& consumer) noexcept {
                               std::move(remote_address_));
       item.first.reset();
       item.second = {};
+      response_sent_event_.Send();
     }
   } catch (const std::exception& e) {
     LOG_ERROR() << "Exception for fd " << Fd() << ": " << e;
   }
 }
 
-void Connection::HandleQueueItem(QueueItem& item) noexcept {
+bool Connection::HandleQueueItem(QueueItem& item) noexcept {
   auto& request = *item.first;
 
   if (engine::current_task::IsCancelRequested()) {
@@ -233,8 +314,7 @@ void Connection::HandleQueueItem(QueueItem& item) noexcept {
     auto request_task = std::move(item.second);
     request_task.SyncCancel();
     LOG_DEBUG() << "Request processing interrupted";
-    is_response_chain_valid_ = false;
-    return;  // avoids throwing and catching exception down below
+    return false;  // avoids throwing and catching exception down below
   }
 
   try {
@@ -255,11 +335,12 @@ void Connection::HandleQueueItem(QueueItem& item) noexcept {
     }
   } catch (const engine::WaitInterruptedException&) {
     LOG_DEBUG() << "Request processing interrupted";
-    is_response_chain_valid_ = false;
+    return false;
   } catch (const std::exception& e) {
     LOG_WARNING() << "Request failed with unhandled exception: " << e;
     request.MarkAsInternalServerError();
   }
+  return true;
 }
 
 void Connection::SendResponse(request::RequestBase& request) {
@@ -294,6 +375,229 @@ void Connection::SendResponse(request::RequestBase& request) {
                           request_handler_.LoggerAccessTskv(), peer_name_);
 }
 
+bool Connection::IsHttp2Connection() noexcept {
+  if (auto* tls_socket =
+          dynamic_cast<engine::io::TlsWrapper*>(peer_socket_.get())) {
+    return tls_socket->GetAlpnProtocol() == http::Http2Session::kAlpnProtocol;
+  }
+
+  // There is no negotiation over plain text connections, the clients with
+  // prior knowledge of HTTP/2 start with the connection preface right away
+  constexpr auto kPreface = http::Http2Session::kClientPreface;
+  try {
+    const auto deadline =
+        engine::Deadline::FromDuration(config_.keepalive_timeout);
+    std::vector<char> buf(config_.in_buffer_size);
+    while (pending_input_.size() < kPreface.size() &&
+           utils::text::StartsWith(kPreface, pending_input_)) {
+      const auto bytes_read =
+          peer_socket_->ReadSome(buf.data(), buf.size(), deadline);
+      if (!bytes_read) break;
+      pending_input_.append(buf.data(), bytes_read);
+    }
+  } catch (const std::exception& ex) {
+    LOG_DEBUG() << "Failed to receive the first bytes from peer "
+                << Getpeername() << " on fd " << Fd() << ": " << ex;
+    pending_input_.clear();
+    is_accepting_requests_ = false;
+    return false;
+  }
+
+  if (pending_input_.empty()) {
+    // The connection was closed before sending anything
+    is_accepting_requests_ = false;
+  }
+  return utils::text::StartsWith(pending_input_, kPreface);
+}
+
+void Connection::ProcessHttp2() {
+  using RequestBasePtr = std::shared_ptr<request::RequestBase>;
+  LOG_TRACE() << "Starting HTTP/2 session for fd " << Fd();
+
+  Http2State state;
+  state.session.emplace(
+      request_handler_.GetHandlerInfoIndex(), handler_defaults_config_,
+      config_.http2_session_config,
+      [this, &state](Http2StreamId stream_id, RequestBasePtr&& request_ptr) {
+        ++stats_->active_request_count;
+        auto task = request_handler_.StartRequestTask(request_ptr);
+        // Keep serving the open streams in case of TaskProcessor overload
+        auto responder = engine::CriticalAsyncNoSpan(
+            [this, &state, stream_id](QueueItem item) {
+              ServeHttp2Stream(state, stream_id, item);
+            },
+            QueueItem{request_ptr, std::move(task)});
+        state.streams.emplace(stream_id, Http2Stream{std::move(request_ptr),
+                                                     std::move(responder)});
+      },
+      [&state](Http2StreamId stream_id, std::optional<std::size_t> sent_bytes) {
+        const auto it = state.streams.find(stream_id);
+        if (it == state.streams.end()) return;
+        state.closed_streams.emplace_back(std::move(it->second), sent_bytes);
+        state.streams.erase(it);
+      },
+      stats_->parser_stats, data_accounter_);
+
+  auto reader = engine::CriticalAsyncNoSpan(
+      [this, &state] { ListenForHttp2Frames(state); });
+
+  // The frames of all the streams are written by this task
+  std::string output;
+  std::vector<std::pair<Http2Stream, std::optional<std::size_t>>>
+      closed_streams;
+  for (;;) {
+    bool is_finished = false;
+    {
+      std::lock_guard lock(state.mutex);
+      state.session->Serialize(output, kHttp2OutputChunkSize);
+      closed_streams.swap(state.closed_streams);
+      is_finished = state.is_reading_finished || !state.session->IsAlive();
+    }
+    for (auto& [stream, sent_bytes] : closed_streams) {
+      FinishHttp2Stream(stream, sent_bytes);
+    }
+    closed_streams.clear();
+
+    if (!output.empty()) {
+      try {
+        peer_socket_->WriteAll(output.data(), output.size(), {});
+      } catch (const std::exception& ex) {
+        LOG_WARNING() << "Error while sending data to peer " << Getpeername()
+                      << " on fd " << Fd() << ": " << ex;
+        break;
+      }
+      output.clear();
+      continue;
+    }
+    if (is_finished || !state.output_event.WaitForEvent()) break;
+  }
+
+  reader.SyncCancel();
+  {
+    std::lock_guard lock(state.mutex);
+    closed_streams.swap(state.closed_streams);
+    for (auto& [stream_id, stream] : state.streams) {
+      closed_streams.emplace_back(std::move(stream), std::nullopt);
+    }
+    state.streams.clear();
+  }
+  for (auto& [stream, sent_bytes] : closed_streams) {
+    FinishHttp2Stream(stream, sent_bytes);
+  }
+}
+
+void Connection::ListenForHttp2Frames(Http2State& state) noexcept {
+  try {
+    bool is_alive = true;
+    if (!pending_input_.empty()) {
+      {
+        std::lock_guard lock(state.mutex);
+        is_alive =
+            state.session->Parse(pending_input_.data(), pending_input_.size());
+      }
+      state.output_event.Send();
+      pending_input_ = std::string{};
+    }
+
+    std::vector<char> buf(config_.in_buffer_size);
+    while (is_alive) {
+      std::size_t bytes_read = 0;
+      try {
+        bytes_read = peer_socket_->ReadSome(
+            buf.data(), buf.size(),
+            engine::Deadline::FromDuration(config_.keepalive_timeout));
+      } catch (const engine::io::IoTimeout&) {
+        // The connection is not idle while its requests are processed
+        std::lock_guard lock(state.mutex);
+        if (!state.streams.empty()) continue;
+        throw;
+      }
+      if (!bytes_read) {
+        LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
+                    << " closed connection";
+        break;
+      }
+
+      {
+        std::lock_guard lock(state.mutex);
+        is_alive = state.session->Parse(buf.data(), bytes_read);
+      }
+      state.output_event.Send();
+    }
+  } catch (const engine::io::IoTimeout&) {
+    LOG_INFO() << "Closing idle connection on timeout";
+  } catch (const engine::io::IoCancelled&) {
+    LOG_TRACE() << "engine::io::IoCancelled thrown in ListenForHttp2Frames()";
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Error while receiving from peer " << Getpeername()
+                  << " on fd " << Fd() << ": " << ex;
+  }
+
+  {
+    std::lock_guard lock(state.mutex);
+    state.is_reading_finished = true;
+  }
+  state.output_event.Send();
+}
+
+void Connection::ServeHttp2Stream(Http2State& state, Http2StreamId stream_id,
+                                  QueueItem& item) noexcept {
+  if (!HandleQueueItem(item)) return;
+
+  auto& request = *item.first;
+  auto& response = static_cast<http::HttpResponse&>(request.GetResponse());
+  try {
+    {
+      std::lock_guard lock(state.mutex);
+      request.SetStartSendResponseTime();
+      state.session->SubmitResponse(stream_id);
+    }
+    state.output_event.Send();
+
+    if (!response.IsBodyStreamed() || !response.GetData().empty()) return;
+
+    std::string body_part;
+    while (http::Http2Session::PopStreamedBodyPart(response, body_part)) {
+      {
+        std::lock_guard lock(state.mutex);
+        state.session->AppendStreamedBody(stream_id, std::move(body_part));
+      }
+      state.output_event.Send();
+      body_part = std::string{};
+    }
+    // The stream is reset or the connection is closed
+    if (engine::current_task::IsCancelRequested()) return;
+
+    {
+      std::lock_guard lock(state.mutex);
+      state.session->FinishStreamedBody(stream_id);
+    }
+    state.output_event.Send();
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "Error while sending data: " << ex;
+  }
+}
+
+void Connection::FinishHttp2Stream(
+    Http2Stream& stream, std::optional<std::size_t> sent_bytes) noexcept {
+  // The stream may be reset by the peer while its request is processed
+  stream.responder.SyncCancel();
+
+  auto& request = *stream.request;
+  auto& response = static_cast<http::HttpResponse&>(request.GetResponse());
+  if (sent_bytes) {
+    http::Http2Session::SetResponseSent(response, *sent_bytes);
+  } else {
+    response.SetSendFailed(std::chrono::steady_clock::now());
+  }
+  request.SetFinishSendResponseTime();
+  --stats_->active_request_count;
+  ++stats_->requests_processed_count;
+
+  request.WriteAccessLogs(request_handler_.LoggerAccess(),
+                          request_handler_.LoggerAccessTskv(), peer_name_);
+}
+
 std::string Connection::Getpeername() const { return peer_name_; }
 
 }  // namespace server::net
@@ -2,15 +2,19 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 
+#include <server/http/http2_session.hpp>
 #include <server/http/request_handler_base.hpp>
+#include <server/net/buffer_pool.hpp>
 #include <server/net/connection_config.hpp>
 #include <server/net/stats.hpp>
 #include <server/request/request_parser.hpp>
 
 #include <userver/concurrent/queue.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/server/request/request_base.hpp>
 #include <userver/server/request/request_config.hpp>
 
@@ -28,6 +32,7 @@ class Connection final {
              const engine::io::Sockaddr& remote_address,
              const http::RequestHandlerBase& request_handler,
              std::shared_ptr<Stats> stats,
+             std::shared_ptr<BufferPool> buffer_pool,
              request::ResponseDataAccounter& data_accounter);
 
   void Process();
@@ -39,6 +44,10 @@ class Connection final {
                               engine::TaskWithResult<void>>;
   using Queue = concurrent::SpscQueue<QueueItem>;
 
+  struct Http2Stream;
+  struct Http2State;
+  using Http2StreamId = http::Http2Session::StreamId;
+
   void Shutdown() noexcept;
 
   bool IsRequestTasksEmpty() const noexcept;
@@ -47,11 +56,22 @@ class Connection final {
                          engine::TaskCancellationToken token) noexcept;
   bool NewRequest(std::shared_ptr<request::RequestBase>&& request_ptr,
                   Queue::Producer&);
+  // Returns false if the listener is cancelled
+  bool WaitForPipelinedResponses();
 
   void ProcessResponses(Queue::Consumer&) noexcept;
-  void HandleQueueItem(QueueItem& item) noexcept;
+  // Returns false if the processing was interrupted
+  bool HandleQueueItem(QueueItem& item) noexcept;
   void SendResponse(request::RequestBase& request);
 
+  bool IsHttp2Connection() noexcept;
+  void ProcessHttp2();
+  void ListenForHttp2Frames(Http2State& state) noexcept;
+  void ServeHttp2Stream(Http2State& state, Http2StreamId stream_id,
+                        QueueItem& item) noexcept;
+  void FinishHttp2Stream(Http2Stream& stream,
+                         std::optional<std::size_t> sent_bytes) noexcept;
+
   std::string Getpeername() const;
 
   const ConnectionConfig& config_;
@@ -59,12 +79,18 @@ class Connection final {
   std::unique_ptr<engine::io::RwBase> peer_socket_;
   const http::RequestHandlerBase& request_handler_;
   const std::shared_ptr<Stats> stats_;
-  request::ResponseDataAccounter& data_accounter_;
+  const std::shared_ptr<BufferPool> buffer_pool_;
+  // The responses of the connection, accounted in the ones of the server
+  request::ResponseDataAccounter data_accounter_;
 
   engine::io::Sockaddr remote_address_;
   std::string peer_name_;
 
   std::shared_ptr<Queue> request_tasks_;
+  // The bytes that were read to choose the protocol
+  std::string pending_input_;
+  // Wakes up the listener that waits for the pipelined responses to be sent
+  engine::SingleConsumerEvent response_sent_event_;
 
   bool is_accepting_requests_{true};
   bool is_response_chain_valid_{true};
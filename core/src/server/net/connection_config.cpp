@@ -1,23 +1,74 @@
 #include <server/net/connection_config.hpp>
 
+#include <stdexcept>
+
+#include <userver/utils/trivial_map.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+constexpr utils::TrivialBiMap kHttpVersionMap([](auto selector) {
+  return selector()
+      .Case(HttpVersion::k11, "1.1")
+      .Case(HttpVersion::k2, "2");
+});
+
+}  // namespace
+
+HttpVersion Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<HttpVersion>) {
+  return utils::ParseFromValueString(value, kHttpVersionMap);
+}
+
+Http2SessionConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<Http2SessionConfig>) {
+  Http2SessionConfig config;
+
+  config.max_concurrent_streams =
+      value["max_concurrent_streams"].As<std::uint32_t>(
+          config.max_concurrent_streams);
+  config.initial_window_size = value["initial_window_size"].As<std::uint32_t>(
+      config.initial_window_size);
+  config.max_frame_size =
+      value["max_frame_size"].As<std::uint32_t>(config.max_frame_size);
+
+  return config;
+}
+
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ConnectionConfig>) {
   ConnectionConfig config;
 
   config.in_buffer_size =
       value["in_buffer_size"].As<size_t>(config.in_buffer_size);
+  config.in_buffer_min_size =
+      value["in_buffer_min_size"].As<size_t>(config.in_buffer_min_size);
+  config.in_buffer_pool_size =
+      value["in_buffer_pool_size"].As<size_t>(config.in_buffer_pool_size);
   config.requests_queue_size_threshold =
       value["requests_queue_size_threshold"].As<size_t>(
           config.requests_queue_size_threshold);
+  config.max_pipelined_responses_size =
+      value["max_pipelined_responses_size"].As<size_t>(
+          config.max_pipelined_responses_size);
   config.keepalive_timeout =
       value["keepalive_timeout"].As<std::chrono::seconds>(
           config.keepalive_timeout);
+  config.http_version =
+      value["http_version"].As<HttpVersion>(config.http_version);
+  config.http2_session_config =
+      value["http2_session"].As<Http2SessionConfig>(
+          config.http2_session_config);
+
+  if (config.in_buffer_min_size == 0 ||
+      config.in_buffer_min_size > config.in_buffer_size) {
+    throw std::runtime_error("Invalid in_buffer_min_size value in " +
+                             value.GetPath());
+  }
 
   return config;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -9,12 +10,34 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+enum class HttpVersion {
+  k11,  ///< HTTP/1.1 only
+  k2,   ///< HTTP/2 (ALPN h2 or h2c with prior knowledge) and HTTP/1.1
+};
+
+struct Http2SessionConfig {
+  std::uint32_t max_concurrent_streams = 100;
+  std::uint32_t initial_window_size = 64 * 1024 - 1;
+  std::uint32_t max_frame_size = 16 * 1024;
+};
+
 struct ConnectionConfig {
   size_t in_buffer_size = 32 * 1024;
+  size_t in_buffer_min_size = 4 * 1024;
+  size_t in_buffer_pool_size = 16 * 1024 * 1024;
   size_t requests_queue_size_threshold = 100;
+  size_t max_pipelined_responses_size = 16 * 1024 * 1024;
   std::chrono::seconds keepalive_timeout{10 * 60};
+  HttpVersion http_version = HttpVersion::k11;
+  Http2SessionConfig http2_session_config;
 };
 
+HttpVersion Parse(const yaml_config::YamlConfig& value,
+                  formats::parse::To<HttpVersion>);
+
+Http2SessionConfig Parse(const yaml_config::YamlConfig& value,
+                         formats::parse::To<Http2SessionConfig>);
+
 ConnectionConfig Parse(const yaml_config::YamlConfig& value,
                        formats::parse::To<ConnectionConfig>);
 
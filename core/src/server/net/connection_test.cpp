@@ -118,7 +118,8 @@ UTEST(ServerNetConnection, EarlyCancel) {
     net::Connection connection(
         config.connection_config, config.handler_defaults,
         std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
-        stats, data_accounter);
+        stats, std::make_shared<net::BufferPool>(config.connection_config),
+        data_accounter);
 
     connection.Process();
   });
@@ -155,7 +156,8 @@ UTEST(ServerNetConnection, EarlyTimeout) {
     net::Connection connection(
         config.connection_config, config.handler_defaults,
         std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
-        stats, data_accounter);
+        stats, std::make_shared<net::BufferPool>(config.connection_config),
+        data_accounter);
 
     connection.Process();
   });
@@ -182,7 +184,8 @@ UTEST(ServerNetConnection, TimeoutWithTaskCancellation) {
     net::Connection connection(
         config.connection_config, config.handler_defaults,
         std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
-        stats, data_accounter);
+        stats, std::make_shared<net::BufferPool>(config.connection_config),
+        data_accounter);
 
     connection.Process();
   });
@@ -230,7 +233,8 @@ UTEST(ServerNetConnection, RemoteClosed) {
     net::Connection connection(
         config.connection_config, config.handler_defaults,
         std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
-        stats, data_accounter);
+        stats, std::make_shared<net::BufferPool>(config.connection_config),
+        data_accounter);
 
     connection.Process();
   });
@@ -261,7 +265,8 @@ UTEST(ServerNetConnection, KeepAlive) {
     net::Connection connection(
         config.connection_config, config.handler_defaults,
         std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
-        stats, data_accounter);
+        stats, std::make_shared<net::BufferPool>(config.connection_config),
+        data_accounter);
 
     connection.Process();
   });
@@ -296,7 +301,8 @@ UTEST(ServerNetConnection, CancelMultipleInFlight) {
       net::Connection connection(
           config.connection_config, config.handler_defaults,
           std::make_unique<engine::io::Socket>(std::move(peer)), {}, handler,
-          stats, data_accounter);
+          stats, std::make_shared<net::BufferPool>(config.connection_config),
+          data_accounter);
 
       connection.Process();
     });
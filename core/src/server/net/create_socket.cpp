@@ -1,5 +1,11 @@
 #include "create_socket.hpp"
 
+#include <sys/socket.h>
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <array>
 #include <string>
 
 #include <fmt/format.h>
@@ -8,8 +14,11 @@
 #include <userver/engine/io/socket.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
@@ -72,6 +81,36 @@ engine::io::Socket CreateSocket(const ListenerConfig& config) {
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
 }
 
+void AttachReuseportCpuSteering(engine::io::Socket& socket,
+                                std::size_t shards) {
+  if (socket.Getsockname().Domain() == engine::io::AddrDomain::kUnix) return;
+
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+  // The returned value is the index of the socket in the group, the kernel
+  // falls back to the hash of the connection for the out of range values
+  std::array<sock_filter, 3> code{{
+      // A = the CPU that handles the packet
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      // A = A % shards
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(shards)},
+      // return A
+      {BPF_RET | BPF_A, 0, 0, 0},
+  }};
+  sock_fprog program{static_cast<unsigned short>(code.size()), code.data()};
+
+  utils::CheckSyscall(::setsockopt(socket.Fd(), SOL_SOCKET,
+                                   SO_ATTACH_REUSEPORT_CBPF, &program,
+                                   sizeof(program)),
+                      "attaching the reuseport CPU steering program, fd={}",
+                      socket.Fd());
+#else
+  (void)shards;
+  LOG_WARNING() << "SO_ATTACH_REUSEPORT_CBPF is not supported, the "
+                   "connections are not steered by CPU";
+#endif
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
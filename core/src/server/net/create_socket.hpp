@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 #include <server/net/listener_config.hpp>
 #include <userver/engine/io/socket.hpp>
 
@@ -9,6 +11,13 @@ namespace server::net {
 
 engine::io::Socket CreateSocket(const ListenerConfig& config);
 
+/// Makes the kernel pass the new connections of the SO_REUSEPORT group of the
+/// `socket` to the member number `CPU % shards`, where CPU is the one that
+/// handled the connection packets. Does nothing for the unix sockets or on
+/// the platforms without SO_ATTACH_REUSEPORT_CBPF.
+void AttachReuseportCpuSteering(engine::io::Socket& socket,
+                                std::size_t shards);
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
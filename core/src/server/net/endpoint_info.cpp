@@ -6,7 +6,16 @@ namespace server::net {
 
 EndpointInfo::EndpointInfo(const ListenerConfig& listener_config,
                            http::HttpRequestHandler& request_handler)
-    : listener_config(listener_config), request_handler(request_handler) {}
+    : listener_config(listener_config), request_handler(request_handler) {
+  if (listener_config.tls) {
+    if (listener_config.tls_max_concurrent_handshakes) {
+      tls_handshake_semaphore.emplace(
+          listener_config.tls_max_concurrent_handshakes);
+    }
+    tls_session_ticket_keys =
+        std::make_unique<engine::io::TlsSessionTicketKeys>();
+  }
+}
 
 std::string EndpointInfo::GetDescription() const {
   if (listener_config.unix_socket_path.empty())
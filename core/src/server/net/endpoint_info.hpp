@@ -1,6 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
+#include <optional>
+
+#include <userver/engine/io/tls_wrapper.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <server/http/http_request_handler.hpp>
 #include <server/net/connection.hpp>
@@ -20,6 +26,11 @@ struct EndpointInfo {
   Connection::Type connection_type{Connection::Type::kRequest};
 
   std::atomic<size_t> connection_count{0};
+
+  // TLS listeners only
+  engine::TaskProcessor* tls_handshake_task_processor{nullptr};
+  std::optional<engine::Semaphore> tls_handshake_semaphore;
+  std::unique_ptr<engine::io::TlsSessionTicketKeys> tls_session_ticket_keys;
 };
 
 }  // namespace server::net
@@ -16,7 +16,8 @@ class Listener final {
  public:
   Listener(std::shared_ptr<EndpointInfo> endpoint_info,
            engine::TaskProcessor& task_processor,
-           request::ResponseDataAccounter& data_accounter);
+           request::ResponseDataAccounter& data_accounter,
+           ListenerShard shard);
   ~Listener();
 
   Listener(const Listener&) = delete;
@@ -32,6 +33,7 @@ class Listener final {
   engine::TaskProcessor* task_processor_;
   std::shared_ptr<EndpointInfo> endpoint_info_;
   request::ResponseDataAccounter* data_accounter_;
+  ListenerShard shard_;
 
   std::unique_ptr<ListenerImpl> impl_;
 };
@@ -23,6 +23,11 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   config.max_connections =
       value["max_connections"].As<size_t>(config.max_connections);
   config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+  config.reuseport_cpu_steering = value["reuseport-cpu-steering"].As<bool>(
+      config.reuseport_cpu_steering);
+  config.accept_throttling_queue_wait =
+      value["accept-throttling-queue-wait"].As<std::chrono::milliseconds>(
+          config.accept_throttling_queue_wait);
   config.task_processor = value["task_processor"].As<std::string>();
   config.backlog = value["backlog"].As<int>(config.backlog);
 
@@ -37,6 +42,13 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   if (config.backlog <= 0) {
     throw std::runtime_error("Invalid backlog value in " + value.GetPath());
   }
+  if (config.shards && *config.shards == 0) {
+    throw std::runtime_error("Invalid shards value in " + value.GetPath());
+  }
+  if (config.accept_throttling_queue_wait.count() < 0) {
+    throw std::runtime_error("Invalid accept-throttling-queue-wait value in " +
+                             value.GetPath());
+  }
 
   auto cert_path = value["tls"]["cert"].As<std::string>({});
   auto pkey_path = value["tls"]["private-key"].As<std::string>({});
@@ -57,6 +69,16 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   if (!pkey_pass_name.empty()) {
     config.tls_private_key_passphrase_name = pkey_pass_name;
   }
+  config.tls_kernel_offload =
+      value["tls"]["kernel-offload"].As<bool>(config.tls_kernel_offload);
+  config.tls_handshake_task_processor =
+      value["tls"]["handshake-task-processor"]
+          .As<std::optional<std::string>>();
+  config.tls_max_concurrent_handshakes =
+      value["tls"]["max-concurrent-handshakes"].As<std::size_t>(
+          config.tls_max_concurrent_handshakes);
+  config.tls_session_ticket_keys_name =
+      value["tls"]["session-ticket-keys-name"].As<std::string>({});
   auto ca_paths = value["tls"]["ca"].As<std::vector<std::string>>({});
   for (const auto& ca_path : ca_paths) {
     auto contents = fs::blocking::ReadFileContents(ca_path);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 
@@ -23,6 +24,10 @@ struct ListenerConfig {
   int backlog = 1024;  // truncated to net.core.somaxconn
   size_t max_connections = 32768;
   std::optional<size_t> shards;
+  // Let the kernel pick the shard by the CPU that received the connection
+  bool reuseport_cpu_steering{false};
+  // Pause accepting while the task processor queue wait time is bigger
+  std::chrono::milliseconds accept_throttling_queue_wait{0};
   std::string task_processor;
 
   bool tls{false};
@@ -31,6 +36,12 @@ struct ListenerConfig {
   std::string tls_private_key_passphrase_name;
   crypto::PrivateKey tls_private_key;
   std::vector<crypto::Certificate> tls_certificate_authorities;
+  bool tls_kernel_offload{false};
+  // Task processor to run the handshakes on instead of the listener one
+  std::optional<std::string> tls_handshake_task_processor;
+  // 0 for unlimited
+  std::size_t tls_max_concurrent_handshakes{0};
+  std::string tls_session_ticket_keys_name;
 };
 
 ListenerConfig Parse(const yaml_config::YamlConfig& value,
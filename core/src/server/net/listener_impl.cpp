@@ -2,18 +2,22 @@
 
 #include <netinet/tcp.h>
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <vector>
 
+#include <server/http/http2_session.hpp>
 #include <server/net/create_socket.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/io/tls_wrapper.hpp>
 #include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
 #include <userver/logging/log.hpp>
@@ -24,12 +28,33 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+namespace {
+
+// The backlog keeps the connections while the accepting is paused
+constexpr std::chrono::milliseconds kAcceptThrottlingPause{10};
+
+engine::io::Socket CreateShardSocket(const ListenerConfig& config,
+                                     ListenerShard shard) {
+  auto socket = CreateSocket(config);
+  // The program is shared by the SO_REUSEPORT group, the sockets of the other
+  // shards join the group later and get their connections by the index
+  if (config.reuseport_cpu_steering && shard.index == 0) {
+    AttachReuseportCpuSteering(socket, shard.count);
+  }
+  return socket;
+}
+
+}  // namespace
+
 ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
                            std::shared_ptr<EndpointInfo> endpoint_info,
-                           request::ResponseDataAccounter& data_accounter)
+                           request::ResponseDataAccounter& data_accounter,
+                           ListenerShard shard)
     : task_processor_(task_processor),
       endpoint_info_(std::move(endpoint_info)),
       stats_(std::make_shared<Stats>()),
+      buffer_pool_(std::make_shared<BufferPool>(
+          endpoint_info_->listener_config.connection_config)),
       data_accounter_(data_accounter),
       socket_listener_task_(engine::CriticalAsyncNoSpan(
           task_processor_,
@@ -48,7 +73,7 @@ ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
               }
             }
           },
-          CreateSocket(endpoint_info_->listener_config))) {}
+          CreateShardSocket(endpoint_info_->listener_config, shard))) {}
 
 ListenerImpl::~ListenerImpl() {
   LOG_TRACE() << "Stopping socket listener task";
@@ -61,6 +86,7 @@ ListenerImpl::~ListenerImpl() {
 Stats ListenerImpl::GetStats() const { return *stats_; }
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
+  WaitForTaskProcessorCapacity();
   auto peer_socket = request_socket.Accept({});
 
   const auto new_connection_count = ++endpoint_info_->connection_count;
@@ -88,6 +114,31 @@ void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket) {
       std::move(peer_socket), std::move(guard)));
 }
 
+void ListenerImpl::WaitForTaskProcessorCapacity() {
+  const auto max_queue_wait =
+      endpoint_info_->listener_config.accept_throttling_queue_wait;
+  if (max_queue_wait.count() == 0) return;
+
+  bool is_throttled = false;
+  while (!engine::current_task::ShouldCancel()) {
+    // The time in the queue of the task processor after the yield is the
+    // queue wait time of the tasks of the new connections
+    const auto yield_start = std::chrono::steady_clock::now();
+    engine::Yield();
+    if (std::chrono::steady_clock::now() - yield_start < max_queue_wait) break;
+
+    if (!is_throttled) {
+      is_throttled = true;
+      ++stats_->accepts_throttled;
+      LOG_LIMITED_WARNING() << endpoint_info_->GetDescription()
+                            << " pauses accepting connections, the task "
+                               "processor queue wait time exceeds "
+                            << max_queue_wait.count() << "ms";
+    }
+    engine::InterruptibleSleepFor(kAcceptThrottlingPause);
+  }
+}
+
 void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
   if (peer_socket.Getsockname().Domain() == engine::io::AddrDomain::kInet6 ||
       peer_socket.Getsockname().Domain() == engine::io::AddrDomain::kInet)
@@ -99,11 +150,8 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
   std::unique_ptr<engine::io::RwBase> socket;
   auto remote_address = peer_socket.Getpeername();
   if (endpoint_info_->listener_config.tls) {
-    const auto& config = endpoint_info_->listener_config;
     socket = std::make_unique<engine::io::TlsWrapper>(
-        engine::io::TlsWrapper::StartTlsServer(
-            std::move(peer_socket), config.tls_cert, config.tls_private_key, {},
-            config.tls_certificate_authorities));
+        StartTls(std::move(peer_socket)));
   } else {
     socket = std::make_unique<engine::io::Socket>(std::move(peer_socket));
   }
@@ -112,13 +160,55 @@ void ListenerImpl::ProcessConnection(engine::io::Socket peer_socket) {
                             endpoint_info_->listener_config.handler_defaults,
                             std::move(socket), std::move(remote_address),
                             endpoint_info_->request_handler, stats_,
-                            data_accounter_);
+                            buffer_pool_, data_accounter_);
 
   LOG_TRACE() << "Start connection processing for fd " << fd;
   connection_ptr.Process();
   LOG_TRACE() << "Finishing connection for fd " << fd;
 }
 
+engine::io::TlsWrapper ListenerImpl::StartTls(
+    engine::io::Socket&& peer_socket) {
+  const auto& config = endpoint_info_->listener_config;
+  std::vector<std::string> alpn_protocols;
+  if (config.connection_config.http_version == HttpVersion::k2) {
+    alpn_protocols = {std::string{http::Http2Session::kAlpnProtocol},
+                      "http/1.1"};
+  }
+
+  // The handshakes are CPU-heavy, a reconnect storm should neither take all
+  // the workers nor delay the requests of the established connections
+  engine::SemaphoreLock handshake_lock;
+  if (endpoint_info_->tls_handshake_semaphore) {
+    handshake_lock =
+        engine::SemaphoreLock{*endpoint_info_->tls_handshake_semaphore};
+  }
+
+  const auto handshake = [&] {
+    return engine::io::TlsWrapper::StartTlsServer(
+        std::move(peer_socket), config.tls_cert, config.tls_private_key, {},
+        config.tls_certificate_authorities, alpn_protocols,
+        config.tls_kernel_offload,
+        endpoint_info_->tls_session_ticket_keys.get());
+  };
+
+  try {
+    auto tls = endpoint_info_->tls_handshake_task_processor
+                   ? engine::AsyncNoSpan(
+                         *endpoint_info_->tls_handshake_task_processor,
+                         handshake)
+                         .Get()
+                   : handshake();
+    ++stats_->tls_handshakes;
+    if (tls.IsSessionReused()) ++stats_->tls_handshakes_resumed;
+    return tls;
+  } catch (const std::exception&) {
+    ++stats_->tls_handshakes;
+    ++stats_->tls_handshakes_failed;
+    throw;
+  }
+}
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 
 #include <userver/concurrent/background_task_storage.hpp>
 #include <userver/engine/io/socket.hpp>
+#include <userver/engine/io/tls_wrapper.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 
+#include "buffer_pool.hpp"
 #include "connection.hpp"
 #include "endpoint_info.hpp"
 #include "stats.hpp"
@@ -15,23 +19,33 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
+/// The position of a listener among the SO_REUSEPORT sockets of a port
+struct ListenerShard final {
+  std::size_t index{0};
+  std::size_t count{1};
+};
+
 class ListenerImpl final {
  public:
   ListenerImpl(engine::TaskProcessor& task_processor,
                std::shared_ptr<EndpointInfo> endpoint_info,
-               request::ResponseDataAccounter& data_accounter);
+               request::ResponseDataAccounter& data_accounter,
+               ListenerShard shard);
   ~ListenerImpl();
 
   Stats GetStats() const;
 
  private:
   void AcceptConnection(engine::io::Socket& request_socket);
+  void WaitForTaskProcessorCapacity();
   void ProcessConnection(engine::io::Socket peer_socket);
+  engine::io::TlsWrapper StartTls(engine::io::Socket&& peer_socket);
 
   engine::TaskProcessor& task_processor_;
   std::shared_ptr<EndpointInfo> endpoint_info_;
 
   std::shared_ptr<Stats> stats_;
+  std::shared_ptr<BufferPool> buffer_pool_;
   request::ResponseDataAccounter& data_accounter_;
 
   concurrent::BackgroundTaskStorageCore connections_;
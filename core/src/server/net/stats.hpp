@@ -27,6 +27,10 @@ struct Stats {
       : active_connections(other.active_connections.load()),
         connections_created(other.connections_created.load()),
         connections_closed(other.connections_closed.load()),
+        accepts_throttled(other.accepts_throttled.load()),
+        tls_handshakes(other.tls_handshakes.load()),
+        tls_handshakes_resumed(other.tls_handshakes_resumed.load()),
+        tls_handshakes_failed(other.tls_handshakes_failed.load()),
         parser_stats(other.parser_stats),
         active_request_count(other.active_request_count.load()),
         requests_processed_count(other.requests_processed_count.load()) {}
@@ -37,6 +41,10 @@ struct Stats {
   std::atomic<size_t> active_connections{0};
   std::atomic<size_t> connections_created{0};
   std::atomic<size_t> connections_closed{0};
+  std::atomic<size_t> accepts_throttled{0};
+  std::atomic<size_t> tls_handshakes{0};
+  std::atomic<size_t> tls_handshakes_resumed{0};
+  std::atomic<size_t> tls_handshakes_failed{0};
 
   // per connection
   ParserStats parser_stats;
@@ -48,6 +56,10 @@ inline Stats& operator+=(Stats& lhs, const Stats& rhs) {
   lhs.active_connections += rhs.active_connections;
   lhs.connections_created += rhs.connections_created;
   lhs.connections_closed += rhs.connections_closed;
+  lhs.accepts_throttled += rhs.accepts_throttled;
+  lhs.tls_handshakes += rhs.tls_handshakes;
+  lhs.tls_handshakes_resumed += rhs.tls_handshakes_resumed;
+  lhs.tls_handshakes_failed += rhs.tls_handshakes_failed;
 
   lhs.parser_stats += rhs.parser_stats;
   lhs.active_request_count += rhs.active_request_count;
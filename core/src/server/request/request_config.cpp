@@ -22,6 +22,8 @@ HttpRequestConfig Parse(const yaml_config::YamlConfig& value,
   conf.parse_args_from_body =
       value["parse_args_from_body"].As<bool>(conf.parse_args_from_body);
 
+  conf.zero_copy_body = value["zero_copy_body"].As<bool>(conf.zero_copy_body);
+
   conf.set_tracing_headers =
       value["set_tracing_headers"].As<bool>(conf.set_tracing_headers);
 
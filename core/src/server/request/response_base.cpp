@@ -22,6 +22,7 @@ void ResponseDataAccounter::StartRequest(
   current_ += size;
   auto ms = ToMsFromStart(create_time);
   time_sum_ += ms.count();
+  if (parent_) parent_->StartRequest(size, create_time);
 }
 
 void ResponseDataAccounter::StopRequest(
@@ -30,6 +31,11 @@ void ResponseDataAccounter::StopRequest(
   auto ms = ToMsFromStart(create_time);
   time_sum_ -= ms.count();
   count_--;
+  if (parent_) parent_->StopRequest(size, create_time);
+}
+
+bool ResponseDataAccounter::IsLimitReached() const {
+  return current_ >= max_ || (parent_ && parent_->IsLimitReached());
 }
 
 std::chrono::milliseconds ResponseDataAccounter::GetAvgRequestTime() const {
@@ -68,7 +74,7 @@ void ResponseBase::SetReady(std::chrono::steady_clock::time_point now) {
 }
 
 bool ResponseBase::IsLimitReached() const {
-  return accounter_.GetCurrentLevel() >= accounter_.GetMaxLevel();
+  return accounter_.IsLimitReached();
 }
 
 void ResponseBase::SetSendFailed(
@@ -1,5 +1,9 @@
 #include <userver/server/request/task_inherited_data.hpp>
 
+#include <algorithm>
+
+#include <userver/utils/assert.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request {
@@ -34,6 +38,37 @@ bool DeadlineSignal::IsExpired() const noexcept {
   return value_.load(std::memory_order_relaxed);
 }
 
+DeadlineBudgetStats::DeadlineBudgetStats() noexcept = default;
+
+DeadlineBudgetStats::DeadlineBudgetStats(
+    const DeadlineBudgetStats& other) noexcept
+    : limited_calls_(other.GetLimitedCalls()),
+      skipped_calls_(other.GetSkippedCalls()) {}
+
+DeadlineBudgetStats& DeadlineBudgetStats::operator=(
+    const DeadlineBudgetStats& other) noexcept {
+  if (this == &other) return *this;
+  limited_calls_.store(other.GetLimitedCalls(), std::memory_order_relaxed);
+  skipped_calls_.store(other.GetSkippedCalls(), std::memory_order_relaxed);
+  return *this;
+}
+
+void DeadlineBudgetStats::AccountLimitedCall() noexcept {
+  limited_calls_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DeadlineBudgetStats::AccountSkippedCall() noexcept {
+  skipped_calls_.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::uint64_t DeadlineBudgetStats::GetLimitedCalls() const noexcept {
+  return limited_calls_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t DeadlineBudgetStats::GetSkippedCalls() const noexcept {
+  return skipped_calls_.load(std::memory_order_relaxed);
+}
+
 engine::TaskInheritedVariable<TaskInheritedData> kTaskInheritedData;
 
 engine::Deadline GetTaskInheritedDeadline() noexcept {
@@ -63,6 +98,62 @@ DeadlinePropagationBlocker::~DeadlinePropagationBlocker() {
   }
 }
 
+DeadlineBudget::DeadlineBudget(std::size_t planned_calls,
+                               std::chrono::milliseconds min_call_budget)
+    : old_value_(GetTaskInheritedDataOrDefault()),
+      calls_left_(planned_calls),
+      min_call_budget_(min_call_budget),
+      call_deadline_(old_value_.deadline) {
+  UINVARIANT(planned_calls > 0, "DeadlineBudget needs at least one call");
+}
+
+DeadlineBudget::~DeadlineBudget() {
+  if (!is_patched_) return;
+
+  // Keep the stats accounted while the deadline was patched
+  const auto* const current = kTaskInheritedData.GetOptional();
+  if (current) {
+    old_value_.deadline_budget_stats = current->deadline_budget_stats;
+  }
+  kTaskInheritedData.Set(std::move(old_value_));
+}
+
+bool DeadlineBudget::StartCall() {
+  const auto* const current = kTaskInheritedData.GetOptional();
+  if (!old_value_.deadline.IsReachable() || !current) return true;
+
+  const auto time_left = old_value_.deadline.TimeLeft();
+  const auto calls = static_cast<engine::Deadline::Duration::rep>(
+      std::max<std::size_t>(calls_left_, 1));
+  if (calls_left_ > 1) --calls_left_;
+
+  const auto share = time_left / calls;
+  if (share < min_call_budget_) {
+    current->deadline_budget_stats.AccountSkippedCall();
+    // Do not leave the deadline of the previous call for the code below
+    if (is_patched_) SetDeadline(*current, old_value_.deadline);
+    call_deadline_ = old_value_.deadline;
+    return false;
+  }
+
+  current->deadline_budget_stats.AccountLimitedCall();
+  call_deadline_ = engine::Deadline::FromDuration(share);
+  SetDeadline(*current, call_deadline_);
+  return true;
+}
+
+engine::Deadline DeadlineBudget::GetCallDeadline() const noexcept {
+  return call_deadline_;
+}
+
+void DeadlineBudget::SetDeadline(const TaskInheritedData& current,
+                                 engine::Deadline deadline) {
+  auto patched = current;
+  patched.deadline = deadline;
+  kTaskInheritedData.Set(std::move(patched));
+  is_patched_ = true;
+}
+
 }  // namespace server::request
 
 USERVER_NAMESPACE_END
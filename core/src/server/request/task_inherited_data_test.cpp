@@ -0,0 +1,79 @@
+#include <userver/server/request/task_inherited_data.hpp>
+
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::chrono::milliseconds kRequestTimeout{10'000};
+
+void SetRequestDeadline(engine::Deadline deadline) {
+  server::request::TaskInheritedData data;
+  data.deadline = deadline;
+  server::request::kTaskInheritedData.Set(std::move(data));
+}
+
+const server::request::DeadlineBudgetStats& GetStats() {
+  return server::request::kTaskInheritedData.Get().deadline_budget_stats;
+}
+
+}  // namespace
+
+UTEST(DeadlineBudget, NoDeadline) {
+  server::request::DeadlineBudget budget{2};
+  EXPECT_TRUE(budget.StartCall());
+  EXPECT_FALSE(server::request::GetTaskInheritedDeadline().IsReachable());
+  EXPECT_FALSE(budget.GetCallDeadline().IsReachable());
+}
+
+UTEST(DeadlineBudget, Split) {
+  const auto request_deadline = engine::Deadline::FromDuration(kRequestTimeout);
+  SetRequestDeadline(request_deadline);
+
+  {
+    server::request::DeadlineBudget budget{2};
+
+    ASSERT_TRUE(budget.StartCall());
+    const auto first_call_deadline =
+        server::request::GetTaskInheritedDeadline();
+    EXPECT_EQ(first_call_deadline, budget.GetCallDeadline());
+    EXPECT_LE(first_call_deadline.TimeLeft(), kRequestTimeout / 2);
+    EXPECT_GT(first_call_deadline.TimeLeft(), kRequestTimeout / 4);
+
+    // The last call gets all the remaining time
+    ASSERT_TRUE(budget.StartCall());
+    EXPECT_GT(server::request::GetTaskInheritedDeadline().TimeLeft(),
+              kRequestTimeout / 2);
+    EXPECT_EQ(GetStats().GetLimitedCalls(), 2u);
+  }
+
+  EXPECT_EQ(server::request::GetTaskInheritedDeadline(), request_deadline);
+  EXPECT_EQ(GetStats().GetLimitedCalls(), 2u);
+  EXPECT_EQ(GetStats().GetSkippedCalls(), 0u);
+}
+
+UTEST(DeadlineBudget, SkipTooShort) {
+  const auto request_deadline = engine::Deadline::FromDuration(kRequestTimeout);
+  SetRequestDeadline(request_deadline);
+
+  {
+    server::request::DeadlineBudget budget{4, kRequestTimeout / 2};
+    EXPECT_FALSE(budget.StartCall());
+    EXPECT_EQ(budget.GetCallDeadline(), request_deadline);
+    EXPECT_EQ(server::request::GetTaskInheritedDeadline(), request_deadline);
+  }
+
+  EXPECT_EQ(GetStats().GetLimitedCalls(), 0u);
+  EXPECT_EQ(GetStats().GetSkippedCalls(), 1u);
+}
+
+UTEST(DeadlineBudget, SkipExpired) {
+  SetRequestDeadline(engine::Deadline::Passed());
+
+  server::request::DeadlineBudget budget{1};
+  EXPECT_FALSE(budget.StartCall());
+  EXPECT_EQ(GetStats().GetSkippedCalls(), 1u);
+}
+
+USERVER_NAMESPACE_END
@@ -18,7 +18,9 @@
 #include <server/pph_config.hpp>
 #include <server/requests_view.hpp>
 #include <server/server_config.hpp>
+#include <server/tls_session_ticket_keys_config.hpp>
 #include <userver/fs/blocking/read.hpp>
+#include <userver/storages/secdist/component.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -59,14 +61,21 @@ void PortInfo::Init(const ServerConfig& config,
 
   endpoint_info_ =
       std::make_shared<net::EndpointInfo>(listener_config, *request_handler_);
+  if (listener_config.tls_handshake_task_processor) {
+    endpoint_info_->tls_handshake_task_processor =
+        &component_context.GetTaskProcessor(
+            *listener_config.tls_handshake_task_processor);
+  }
 
   const auto& event_thread_pool = task_processor.EventThreadPool();
-  size_t listener_shards = listener_config.shards ? *listener_config.shards
-                                                  : event_thread_pool.GetSize();
+  const size_t listener_shards = listener_config.shards
+                                     ? *listener_config.shards
+                                     : event_thread_pool.GetSize();
 
   listeners_.reserve(listener_shards);
-  while (listener_shards--) {
-    listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
+  for (size_t i = 0; i < listener_shards; ++i) {
+    listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_,
+                            net::ListenerShard{i, listener_shards});
   }
 }
 
@@ -119,6 +128,7 @@ class ServerImpl final {
   const ServerConfig& GetServerConfig() const { return config_; }
 
   RequestsView& GetRequestsView();
+  void OnSecdistUpdate(const storages::secdist::SecdistConfig& secdist);
   void WriteTotalHandlerStatistics(utils::statistics::Writer& writer) const;
 
   void SetRpsRatelimitStatusCode(http::HttpStatus status_code);
@@ -138,6 +148,8 @@ class ServerImpl final {
   RequestsView requests_view_{};
 
   ServerConfig config_;
+
+  concurrent::AsyncEventSubscriberScope secdist_subscription_;
 };
 
 ServerImpl::ServerImpl(ServerConfig config,
@@ -165,10 +177,34 @@ ServerImpl::ServerImpl(ServerConfig config,
                             component_context, true);
   }
 
+  if (!config_.listener.tls_session_ticket_keys_name.empty()) {
+    auto* secdist_component =
+        component_context.FindComponentOptional<components::Secdist>();
+    if (secdist_component) {
+      secdist_subscription_ = secdist_component->GetStorage().UpdateAndListen(
+          this, "server_tls_session_ticket_keys",
+          &ServerImpl::OnSecdistUpdate);
+    } else {
+      OnSecdistUpdate(secdist);
+    }
+  }
+
   LOG_INFO() << "Server is created, listening for incoming connections.";
 }
 
-ServerImpl::~ServerImpl() { Stop(); }
+ServerImpl::~ServerImpl() {
+  secdist_subscription_.Unsubscribe();
+  Stop();
+}
+
+void ServerImpl::OnSecdistUpdate(
+    const storages::secdist::SecdistConfig& secdist) {
+  const auto& name = config_.listener.tls_session_ticket_keys_name;
+  UASSERT(!name.empty());
+  UASSERT(main_port_info_.endpoint_info_->tls_session_ticket_keys);
+  main_port_info_.endpoint_info_->tls_session_ticket_keys->SetKeys(
+      secdist.Get<TlsSessionTicketKeysConfig>().GetKeys(name));
+}
 
 void ServerImpl::StartPortInfos() {
   UASSERT(main_port_info_.request_handler_);
@@ -336,6 +372,15 @@ void Server::WriteMonitorData(utils::statistics::Writer& writer) const {
     conn_stats["active"] = server_stats.active_connections;
     conn_stats["opened"] = server_stats.connections_created;
     conn_stats["closed"] = server_stats.connections_closed;
+    conn_stats["throttled"] = server_stats.accepts_throttled;
+  }
+
+  if (pimpl->GetServerConfig().listener.tls) {
+    if (auto tls_stats = writer["tls"]) {
+      tls_stats["handshakes"] = server_stats.tls_handshakes;
+      tls_stats["resumed"] = server_stats.tls_handshakes_resumed;
+      tls_stats["failed"] = server_stats.tls_handshakes_failed;
+    }
   }
 
   if (auto request_stats = writer["requests"]) {
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/crypto/base64.hpp>
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/strong_typedef.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server {
+
+// Base64-encoded TLS session ticket keys from the "tls_session_ticket_keys"
+// secdist section, the first key of a list encrypts the new tickets
+class TlsSessionTicketKeysConfig final {
+ public:
+  using Key = utils::NonLoggable<class TlsSessionTicketKeyT, std::string>;
+
+  explicit TlsSessionTicketKeysConfig(const formats::json::Value& doc)
+      : keys_(doc["tls_session_ticket_keys"]
+                  .As<std::unordered_map<std::string, std::vector<Key>>>(
+                      {})) {}
+
+  std::vector<std::string> GetKeys(const std::string& name) const {
+    const auto it = keys_.find(name);
+    if (it == keys_.end()) {
+      LOG_ERROR() << "No TLS session ticket keys for name '" << name << "'";
+      throw std::out_of_range("No TLS session ticket keys for name " + name);
+    }
+
+    std::vector<std::string> result;
+    result.reserve(it->second.size());
+    for (const auto& key : it->second) {
+      result.push_back(crypto::base64::Base64Decode(key.GetUnderlying()));
+    }
+    return result;
+  }
+
+ private:
+  std::unordered_map<std::string, std::vector<Key>> keys_;
+};
+
+}  // namespace server
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,232 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+
+constexpr int kMaxWindowBits = 15;
+// zlib does not support the 256 bytes window for the raw deflate streams
+constexpr int kMinServerWindowBits = 9;
+constexpr int kMemLevel = 8;
+
+// The tail of the empty block that ends each message flushed with
+// Z_SYNC_FLUSH, it is not sent, RFC 7692, 7.2.1
+constexpr std::string_view kEmptyBlockTail{"\x00\x00\xff\xff", 4};
+
+constexpr std::size_t kOutputChunkSize = 16 * 1024;
+
+std::string_view TrimOws(std::string_view value) {
+  while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+    value.remove_prefix(1);
+  }
+  while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+    value.remove_suffix(1);
+  }
+  return value;
+}
+
+std::string_view NextItem(std::string_view& value, char delimiter) {
+  const auto pos = value.find(delimiter);
+  const auto item = value.substr(0, pos);
+  value.remove_prefix(pos == std::string_view::npos ? value.size() : pos + 1);
+  return TrimOws(item);
+}
+
+// The values may be quoted, RFC 7692, 5.2
+std::optional<int> ParseWindowBits(std::string_view value) {
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+  if (value.empty() || value.size() > 2) return std::nullopt;
+
+  int result = 0;
+  for (const char c : value) {
+    if (c < '0' || c > '9') return std::nullopt;
+    result = result * 10 + (c - '0');
+  }
+  if (result < 8 || result > kMaxWindowBits) return std::nullopt;
+  return result;
+}
+
+// Returns std::nullopt for the offers that can not be accepted
+std::optional<DeflateParams> ParseOffer(std::string_view offer) {
+  DeflateParams params;
+  bool has_client_max_window_bits = false;
+
+  while (!offer.empty()) {
+    auto param = NextItem(offer, ';');
+    const auto eq_pos = param.find('=');
+    const auto name = TrimOws(param.substr(0, eq_pos));
+    std::optional<std::string_view> value;
+    if (eq_pos != std::string_view::npos) {
+      value = TrimOws(param.substr(eq_pos + 1));
+    }
+
+    // The duplicate parameters make the offer invalid
+    if (name == "server_no_context_takeover") {
+      if (value || params.server_no_context_takeover) return std::nullopt;
+      params.server_no_context_takeover = true;
+    } else if (name == "client_no_context_takeover") {
+      if (value || params.client_no_context_takeover) return std::nullopt;
+      params.client_no_context_takeover = true;
+    } else if (name == "server_max_window_bits") {
+      if (!value || params.server_max_window_bits) return std::nullopt;
+      const auto bits = ParseWindowBits(*value);
+      if (!bits || *bits < kMinServerWindowBits) return std::nullopt;
+      params.server_max_window_bits = *bits;
+    } else if (name == "client_max_window_bits") {
+      // The decompressor accepts any window, the parameter is just a hint
+      if (has_client_max_window_bits) return std::nullopt;
+      if (value && !ParseWindowBits(*value)) return std::nullopt;
+      has_client_max_window_bits = true;
+    } else {
+      return std::nullopt;
+    }
+  }
+  return params;
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions,
+                                              const DeflateConfig& config) {
+  if (!config.enabled) return std::nullopt;
+
+  const utils::StrIcaseEqual equal;
+  while (!extensions.empty()) {
+    auto offer = NextItem(extensions, ',');
+    if (!equal(NextItem(offer, ';'), kExtensionName)) continue;
+
+    auto params = ParseOffer(offer);
+    if (!params) continue;
+
+    params->server_no_context_takeover |= config.server_no_context_takeover;
+    params->client_no_context_takeover |= config.client_no_context_takeover;
+    return params;
+  }
+  return std::nullopt;
+}
+
+std::string ToResponseHeader(const DeflateParams& params) {
+  std::string result{kExtensionName};
+  if (params.server_no_context_takeover) {
+    result += "; server_no_context_takeover";
+  }
+  if (params.client_no_context_takeover) {
+    result += "; client_no_context_takeover";
+  }
+  if (params.server_max_window_bits) {
+    result += "; server_max_window_bits=";
+    result += std::to_string(*params.server_max_window_bits);
+  }
+  return result;
+}
+
+PerMessageDeflate::PerMessageDeflate(const DeflateParams& params,
+                                     int compression_level)
+    : params_(params) {
+  const auto window_bits =
+      params.server_max_window_bits.value_or(kMaxWindowBits);
+  if (deflateInit2(&deflate_, compression_level, Z_DEFLATED, -window_bits,
+                   kMemLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw std::runtime_error("Failed to initialize the deflate stream");
+  }
+  if (inflateInit2(&inflate_, -kMaxWindowBits) != Z_OK) {
+    deflateEnd(&deflate_);
+    throw std::runtime_error("Failed to initialize the inflate stream");
+  }
+}
+
+PerMessageDeflate::~PerMessageDeflate() {
+  deflateEnd(&deflate_);
+  inflateEnd(&inflate_);
+}
+
+void PerMessageDeflate::Compress(utils::span<const std::byte> data,
+                                 std::string& output) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  deflate_.next_in =
+      reinterpret_cast<Bytef*>(const_cast<std::byte*>(data.data()));
+  deflate_.avail_in = data.size();
+
+  const auto start = output.size();
+  do {
+    const auto offset = output.size();
+    output.resize(offset + kOutputChunkSize);
+    deflate_.next_out = reinterpret_cast<Bytef*>(output.data() + offset);
+    deflate_.avail_out = kOutputChunkSize;
+
+    const auto ret = deflate(&deflate_, Z_SYNC_FLUSH);
+    output.resize(output.size() - deflate_.avail_out);
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      throw std::runtime_error("Failed to compress a websocket message");
+    }
+  } while (deflate_.avail_out == 0);
+
+  UASSERT(output.size() - start >= kEmptyBlockTail.size());
+  output.resize(output.size() - kEmptyBlockTail.size());
+
+  if (params_.server_no_context_takeover) deflateReset(&deflate_);
+}
+
+CloseStatus PerMessageDeflate::Decompress(std::string& payload,
+                                          std::size_t max_size) {
+  payload.append(kEmptyBlockTail);
+  inflate_.next_in = reinterpret_cast<Bytef*>(payload.data());
+  inflate_.avail_in = payload.size();
+
+  decompressed_.clear();
+  while (true) {
+    const auto offset = decompressed_.size();
+    if (offset > max_size) {
+      inflateReset(&inflate_);
+      return CloseStatus::kTooBigData;
+    }
+    // One byte over the limit to detect the too big messages
+    const auto chunk_size = std::min(kOutputChunkSize, max_size + 1 - offset);
+    decompressed_.resize(offset + chunk_size);
+    inflate_.next_out = reinterpret_cast<Bytef*>(decompressed_.data() + offset);
+    inflate_.avail_out = chunk_size;
+
+    const auto ret = inflate(&inflate_, Z_SYNC_FLUSH);
+    decompressed_.resize(decompressed_.size() - inflate_.avail_out);
+    if (ret == Z_STREAM_END) {
+      // The client has finished the stream with a final block
+      inflateReset(&inflate_);
+      break;
+    }
+    if (ret != Z_OK && ret != Z_BUF_ERROR) {
+      inflateReset(&inflate_);
+      return CloseStatus::kBadMessageData;
+    }
+    if (inflate_.avail_out != 0) {
+      if (inflate_.avail_in != 0) {
+        inflateReset(&inflate_);
+        return CloseStatus::kBadMessageData;
+      }
+      break;
+    }
+  }
+  if (decompressed_.size() > max_size) {
+    inflateReset(&inflate_);
+    return CloseStatus::kTooBigData;
+  }
+
+  if (params_.client_no_context_takeover) inflateReset(&inflate_);
+  payload.swap(decompressed_);
+  return CloseStatus::kNone;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
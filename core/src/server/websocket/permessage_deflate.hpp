@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <zlib.h>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// The negotiated parameters of the permessage-deflate extension
+struct DeflateParams final {
+  bool server_no_context_takeover = false;
+  bool client_no_context_takeover = false;
+  /// Set if the client limited the window of the server
+  std::optional<int> server_max_window_bits;
+};
+
+/// Chooses the first acceptable permessage-deflate offer of the
+/// Sec-WebSocket-Extensions request header, the malformed offers are skipped
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions,
+                                              const DeflateConfig& config);
+
+/// Returns the value of the Sec-WebSocket-Extensions response header
+std::string ToResponseHeader(const DeflateParams& params);
+
+/// The compression and the decompression contexts of a connection
+class PerMessageDeflate final {
+ public:
+  PerMessageDeflate(const DeflateParams& params, int compression_level);
+  ~PerMessageDeflate();
+
+  PerMessageDeflate(const PerMessageDeflate&) = delete;
+  PerMessageDeflate& operator=(const PerMessageDeflate&) = delete;
+
+  /// Appends the compressed message to the `output`, without the trailing
+  /// empty block
+  void Compress(utils::span<const std::byte> data, std::string& output);
+
+  /// Decompresses the `payload` in place
+  /// @returns kNone on success, kTooBigData if the decompressed message is
+  /// bigger than `max_size` and kBadMessageData for the corrupted data
+  CloseStatus Decompress(std::string& payload, std::size_t max_size);
+
+ private:
+  const DeflateParams params_;
+  z_stream deflate_{};
+  z_stream inflate_{};
+  // Keeps the capacity between the messages
+  std::string decompressed_;
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
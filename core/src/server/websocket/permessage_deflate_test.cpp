@@ -0,0 +1,114 @@
+#include <server/websocket/permessage_deflate.hpp>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+std::optional<std::string> Negotiate(std::string_view extensions,
+                                     ws::DeflateConfig config = {}) {
+  config.enabled = true;
+  const auto params = ws::impl::NegotiateDeflate(extensions, config);
+  if (!params) return std::nullopt;
+  return ws::impl::ToResponseHeader(*params);
+}
+
+std::string MakeMessage(int id) {
+  return R"({"event":"notification","id":)" + std::to_string(id) +
+         R"(,"text":"some text of the notification"})";
+}
+
+utils::span<const std::byte> AsBytes(std::string_view data) {
+  return utils::as_bytes(utils::span<const char>(data));
+}
+
+}  // namespace
+
+TEST(WebsocketPerMessageDeflate, Negotiate) {
+  EXPECT_EQ(ws::impl::NegotiateDeflate("permessage-deflate", {}),
+            std::nullopt);
+  EXPECT_EQ(Negotiate(""), std::nullopt);
+  EXPECT_EQ(Negotiate("x-webkit-deflate-frame"), std::nullopt);
+
+  EXPECT_EQ(Negotiate("permessage-deflate"), "permessage-deflate");
+  EXPECT_EQ(Negotiate("permessage-deflate; client_max_window_bits"),
+            "permessage-deflate");
+  EXPECT_EQ(Negotiate("permessage-deflate;server_no_context_takeover"),
+            "permessage-deflate; server_no_context_takeover");
+  EXPECT_EQ(
+      Negotiate("permessage-deflate; server_max_window_bits=\"10\"; "
+                "client_no_context_takeover"),
+      "permessage-deflate; client_no_context_takeover; "
+      "server_max_window_bits=10");
+
+  // The first acceptable offer wins
+  EXPECT_EQ(Negotiate("permessage-deflate; server_max_window_bits=8, "
+                      "permessage-deflate; unknown_param, "
+                      "permessage-deflate; server_no_context_takeover, "
+                      "permessage-deflate"),
+            "permessage-deflate; server_no_context_takeover");
+  EXPECT_EQ(Negotiate("permessage-deflate; server_max_window_bits, "
+                      "permessage-deflate; client_max_window_bits=16, "
+                      "permessage-deflate; server_no_context_takeover; "
+                      "server_no_context_takeover"),
+            std::nullopt);
+
+  ws::DeflateConfig config;
+  config.server_no_context_takeover = true;
+  config.client_no_context_takeover = true;
+  EXPECT_EQ(Negotiate("permessage-deflate", config),
+            "permessage-deflate; server_no_context_takeover; "
+            "client_no_context_takeover");
+}
+
+TEST(WebsocketPerMessageDeflate, RoundTrip) {
+  for (const bool no_context_takeover : {false, true}) {
+    ws::impl::DeflateParams params;
+    params.server_no_context_takeover = no_context_takeover;
+    params.client_no_context_takeover = no_context_takeover;
+    // The server compresses, the "client" decompresses with the same params
+    ws::impl::PerMessageDeflate server{params, 6};
+    ws::impl::PerMessageDeflate client{params, 6};
+
+    std::size_t first_size = 0;
+    for (int i = 0; i < 10; ++i) {
+      const auto message = MakeMessage(i);
+      std::string payload;
+      server.Compress(AsBytes(message), payload);
+      if (i == 0) {
+        first_size = payload.size();
+      } else if (!no_context_takeover) {
+        // The context of the previous messages helps
+        EXPECT_LT(payload.size(), first_size);
+      }
+
+      ASSERT_EQ(client.Decompress(payload, 1024), ws::CloseStatus::kNone);
+      EXPECT_EQ(payload, message);
+    }
+  }
+}
+
+TEST(WebsocketPerMessageDeflate, DecompressErrors) {
+  ws::impl::PerMessageDeflate deflate{{}, 6};
+
+  const std::string message(10000, 'a');
+  std::string payload;
+  deflate.Compress(AsBytes(message), payload);
+  auto too_big = payload;
+  EXPECT_EQ(deflate.Decompress(too_big, message.size() - 1),
+            ws::CloseStatus::kTooBigData);
+
+  ws::impl::PerMessageDeflate other{{}, 6};
+  std::string corrupted = "\xff\xff\xff\xff";
+  EXPECT_EQ(other.Decompress(corrupted, 1024),
+            ws::CloseStatus::kBadMessageData);
+
+  ws::impl::PerMessageDeflate fresh{{}, 6};
+  EXPECT_EQ(fresh.Decompress(payload, message.size()), ws::CloseStatus::kNone);
+  EXPECT_EQ(payload, message);
+}
+
+USERVER_NAMESPACE_END
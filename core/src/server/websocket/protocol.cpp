@@ -39,14 +39,17 @@ union Mask32 {
   uint8_t mask8[4];
 };
 
+// The fragments of a message may start unaligned
 void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-  auto* dest32 = reinterpret_cast<uint32_t*>(dest);
   while (len >= sizeof(uint32_t)) {
-    *(dest32++) ^= mask.mask32;
+    uint32_t value = 0;
+    std::memcpy(&value, dest, sizeof(value));
+    value ^= mask.mask32;
+    std::memcpy(dest, &value, sizeof(value));
+    dest += sizeof(uint32_t);
     len -= sizeof(uint32_t);
   }
-  auto* dest8 = reinterpret_cast<uint8_t*>(dest32);
-  for (unsigned i = 0; i < len; ++i) *(dest8++) ^= mask.mask8[i];
+  for (unsigned i = 0; i < len; ++i) *(dest++) ^= mask.mask8[i];
 }
 
 template <class T, class V>
@@ -61,7 +64,7 @@ namespace frames {
 
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final) {
+    Continuation is_continuation, Final is_final, Compressed is_compressed) {
   boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
   frame.resize(sizeof(WSHeader));
@@ -74,6 +77,10 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
   hdr->bits.opcode = is_text ? kText : kBinary;
   if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+  if (is_compressed == Compressed::kYes) {
+    UASSERT(is_continuation == Continuation::kNo);
+    hdr->bits.reserved = kReservedCompressed;
+  }
 
   if (data.size() <= 125) {
     hdr->bits.payloadLen = data.size();
@@ -159,6 +166,17 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
 
   const bool isDataFrame =
       (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
+
+  // Only the first frame of a compressed message may have RSV1 set
+  if (hdr.bits.reserved != 0) {
+    if (hdr.bits.reserved != kReservedCompressed || !frame.allow_compressed ||
+        !isDataFrame || hdr.bits.opcode == kContinuation) {
+      return CloseStatus::kProtocolError;
+    }
+  }
+  if (isDataFrame && hdr.bits.opcode != kContinuation) {
+    frame.is_compressed = hdr.bits.reserved == kReservedCompressed;
+  }
   if (hdr.bits.payloadLen <= 125) {
     payload_len = hdr.bits.payloadLen;
   } else if (hdr.bits.payloadLen == 126) {
@@ -200,9 +218,11 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
                 {});
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
+    // The previous fragments of the message are already unmasked
     if (mask.mask32)
-      XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data()),
-                     frame.payload->size(), mask);
+      XorMaskInplace(
+          reinterpret_cast<uint8_t*>(frame.payload->data() + newPayloadOffset),
+          payload_len, mask);
   }
   char opcode = hdr.bits.opcode;
   char fin = hdr.bits.fin;
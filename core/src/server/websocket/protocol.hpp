@@ -6,6 +6,8 @@
 
 #include <boost/container/small_vector.hpp>
 
+#include <server/websocket/permessage_deflate.hpp>
+
 #include <userver/engine/io/common.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/span.hpp>
@@ -63,6 +65,9 @@ static_assert(sizeof(WSHeader) == 2);
 constexpr inline unsigned int kMaxFrameHeaderSize =
     sizeof(WSHeader) + sizeof(uint64_t);
 
+// RSV1 marks the compressed messages of the permessage-deflate extension
+constexpr inline unsigned char kReservedCompressed = 0x4;
+
 namespace frames {
 
 enum class Continuation {
@@ -75,9 +80,15 @@ enum class Final {
   kNo,
 };
 
+enum class Compressed {
+  kYes,
+  kNo,
+};
+
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final);
+    Continuation is_continuation, Final is_final,
+    Compressed is_compressed = Compressed::kNo);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(
     WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
@@ -94,6 +105,9 @@ struct FrameParserState {
   bool pong_received = false;
   bool waiting_continuation = false;
   bool is_text = false;
+  // permessage-deflate was negotiated, the messages may have RSV1 set
+  bool allow_compressed = false;
+  bool is_compressed = false;
   CloseStatusInt remote_close_status = 0;
 
   std::string* payload = nullptr;
@@ -102,6 +116,11 @@ struct FrameParserState {
 CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
                         unsigned max_payload_size, std::size_t& payload_len);
 
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate);
+
 }  // namespace server::websocket::impl
 
 USERVER_NAMESPACE_END
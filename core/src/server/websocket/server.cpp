@@ -1,5 +1,10 @@
 #include <userver/server/websocket/server.hpp>
 
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include <userver/components/component.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
@@ -14,14 +19,12 @@ USERVER_NAMESPACE_BEGIN
 namespace server::websocket {
 
 namespace {
-inline void SendExactly(engine::io::WritableBase& writable,
-                        utils::span<const char> data1,
-                        utils::span<const std::byte> data2) {
-  if (writable.WriteAll(
-          {{data1.data(), data1.size()}, {data2.data(), data2.size()}}, {}) !=
-      data1.size() + data2.size())
-    throw(engine::io::IoException() << "Socket closed during transfer");
-}
+
+// The payloads up to this size are copied to coalesce the small frames
+constexpr std::size_t kMaxCopiedPayloadSize = 4096;
+// Limits of a single write of the coalesced frames
+constexpr std::size_t kMaxBufferedSize = 64 * 1024;
+constexpr std::size_t kMaxWriteParts = 64;
 
 Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
@@ -29,13 +32,114 @@ utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) {
   return utils::as_bytes(span);
 }
 
+// The serialized frames to send with a single vectored write. The headers and
+// the small payloads are copied into the buffer, the big payloads are
+// referenced.
+class OutputFrames final {
+ public:
+  void AddFrame(utils::span<const char> header,
+                utils::span<const std::byte> payload) {
+    AppendToBuffer(header.data(), header.size());
+    if (payload.size() <= kMaxCopiedPayloadSize) {
+      AppendToBuffer(reinterpret_cast<const char*>(payload.data()),
+                     payload.size());
+    } else {
+      parts_.push_back({payload.data(), 0, payload.size()});
+    }
+  }
+
+  // Keeps the payload alive until the write
+  utils::span<const std::byte> Keep(std::string&& payload) {
+    if (payload.size() <= kMaxCopiedPayloadSize) {
+      // Copied by AddFrame() right away, the storage is reused
+      scratch_ = std::move(payload);
+      return MakeBinarySpan(scratch_);
+    }
+    return MakeBinarySpan(owned_payloads_.emplace_back(std::move(payload)));
+  }
+
+  bool IsFull() const noexcept {
+    return buffer_.size() >= kMaxBufferedSize ||
+           parts_.size() >= kMaxWriteParts;
+  }
+
+  void Write(engine::io::WritableBase& writable) {
+    if (parts_.empty()) return;
+
+    io_data_.clear();
+    std::size_t size = 0;
+    for (const auto& part : parts_) {
+      const void* data = part.data ? part.data : buffer_.data() + part.offset;
+      io_data_.push_back({data, part.size});
+      size += part.size;
+    }
+    const utils::FastScopeGuard clear_guard{[this]() noexcept { Clear(); }};
+    if (writable.WriteAll(io_data_.data(), io_data_.size(), {}) != size) {
+      throw(engine::io::IoException() << "Socket closed during transfer");
+    }
+  }
+
+  // Drops the frames that refer to the payloads of the sent messages
+  void Clear() noexcept {
+    buffer_.clear();
+    parts_.clear();
+    owned_payloads_.clear();
+  }
+
+ private:
+  struct Part final {
+    // nullptr for the parts of the buffer_
+    const void* data;
+    std::size_t offset;
+    std::size_t size;
+  };
+
+  void AppendToBuffer(const char* data, std::size_t size) {
+    if (size == 0) return;
+    if (parts_.empty() || parts_.back().data) {
+      parts_.push_back({nullptr, buffer_.size(), 0});
+    }
+    buffer_.append(data, size);
+    parts_.back().size += size;
+  }
+
+  std::string buffer_;
+  std::vector<Part> parts_;
+  std::deque<std::string> owned_payloads_;
+  std::string scratch_;
+  std::vector<engine::io::IoData> io_data_;
+};
+
 }  // namespace
 
+DeflateConfig Parse(const yaml_config::YamlConfig& config,
+                    formats::parse::To<DeflateConfig>) {
+  DeflateConfig result;
+  result.enabled = config["enabled"].As<bool>(result.enabled);
+  result.server_no_context_takeover =
+      config["server-no-context-takeover"].As<bool>(
+          result.server_no_context_takeover);
+  result.client_no_context_takeover =
+      config["client-no-context-takeover"].As<bool>(
+          result.client_no_context_takeover);
+  result.compression_level =
+      config["compression-level"].As<int>(result.compression_level);
+  result.min_message_size =
+      config["min-message-size"].As<unsigned>(result.min_message_size);
+
+  if (result.compression_level < 0 || result.compression_level > 9) {
+    throw std::runtime_error("Invalid compression-level value in " +
+                             config.GetPath());
+  }
+  return result;
+}
+
 Config Parse(const yaml_config::YamlConfig& config,
              formats::parse::To<Config>) {
   return {
       config["max-remote-payload"].As<unsigned>(65536),
       config["fragment-size"].As<unsigned>(65536),
+      config["permessage-deflate"].As<DeflateConfig>(DeflateConfig{}),
   };
 }
 
@@ -64,52 +168,82 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
 
   Config config;
 
+  // Set if permessage-deflate was negotiated. The compression context is
+  // guarded by write_mutex_, the decompression one is used by Recv() only.
+  std::optional<impl::PerMessageDeflate> deflate_;
+
+  // Guarded by write_mutex_
+  OutputFrames output_;
+
  public:
   WebSocketConnectionImpl(std::unique_ptr<engine::io::RwBase> io_,
                           const engine::io::Sockaddr& remote_addr,
-                          const Config& server_config)
-      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+                          const Config& server_config,
+                          const std::optional<impl::DeflateParams>& deflate)
+      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {
+    if (deflate) {
+      deflate_.emplace(*deflate, config.permessage_deflate.compression_level);
+      frame_.allow_compressed = true;
+    }
+  }
 
   ~WebSocketConnectionImpl() override {
     LOG_TRACE() << "Websocket connection closed";
   }
 
   void SendExtended(MessageExtended& message) {
+    const std::unique_lock lock(write_mutex_);
+    const utils::FastScopeGuard clear_guard{
+        [this]() noexcept { output_.Clear(); }};
+    AddFrames(message);
+    output_.Write(*io);
+  }
+
+  // Requires write_mutex_
+  void AddFrames(MessageExtended& message) {
     stats_.msg_sent++;
     stats_.bytes_sent += message.data.size();
 
-    const std::unique_lock lock(write_mutex_);
-
     LOG_TRACE() << "Write message " << message.data.size() << " bytes";
     if (message.opcode == impl::WSOpcodes::kPing) {
-      SendExactly(*io, impl::frames::PingFrame(), {});
+      output_.AddFrame(impl::frames::PingFrame(), {});
     } else if (message.opcode == impl::WSOpcodes::kPong) {
       const auto control_frame =
           impl::frames::MakeControlFrame(impl::WSOpcodes::kPong, message.data);
-      SendExactly(*io, control_frame, message.data);
+      output_.AddFrame(control_frame, message.data);
     } else if (message.close_status.has_value()) {
       const auto close_frame = impl::frames::CloseFrame(
           static_cast<int>(message.close_status.value()));
-      SendExactly(*io, close_frame, {});
+      output_.AddFrame(close_frame, {});
     } else if (!message.data.empty()) {
       utils::span<const std::byte> data_to_send{message.data};
+      auto compressed = impl::frames::Compressed::kNo;
+      if (deflate_ &&
+          data_to_send.size() >= config.permessage_deflate.min_message_size) {
+        std::string payload;
+        deflate_->Compress(data_to_send, payload);
+        data_to_send = output_.Keep(std::move(payload));
+        compressed = impl::frames::Compressed::kYes;
+      }
+
       auto continuation = impl::frames::Continuation::kNo;
       while (data_to_send.size() > config.fragment_size &&
              config.fragment_size > 0) {
         const auto data_frame_header = impl::frames::DataFrameHeader(
             data_to_send.first(config.fragment_size),
             message.opcode == impl::WSOpcodes::kText, continuation,
-            impl::frames::Final::kNo);
-        SendExactly(*io, data_frame_header,
-                    data_to_send.first(config.fragment_size));
+            impl::frames::Final::kNo, compressed);
+        output_.AddFrame(data_frame_header,
+                         data_to_send.first(config.fragment_size));
         continuation = impl::frames::Continuation::kYes;
+        compressed = impl::frames::Compressed::kNo;
         data_to_send =
             data_to_send.last(data_to_send.size() - config.fragment_size);
       }
       const auto data_frame_header = impl::frames::DataFrameHeader(
           data_to_send, message.opcode == impl::WSOpcodes::kText, continuation,
-          impl::frames::Final::kYes);
-      SendExactly(*io, data_frame_header, data_to_send);
+          impl::frames::Final::kYes, compressed);
+      output_.AddFrame(data_frame_header, data_to_send);
     }
   }
 
@@ -121,6 +255,21 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
     SendExtended(mext);
   }
 
+  void SendBatch(utils::span<const Message> messages) override {
+    const std::unique_lock lock(write_mutex_);
+    const utils::FastScopeGuard clear_guard{
+        [this]() noexcept { output_.Clear(); }};
+    for (const auto& message : messages) {
+      MessageExtended mext{
+          MakeBinarySpan(message.data),
+          message.is_text ? impl::WSOpcodes::kText : impl::WSOpcodes::kBinary,
+          message.close_status};
+      AddFrames(mext);
+      if (output_.IsFull()) output_.Write(*io);
+    }
+    output_.Write(*io);
+  }
+
   void SendText(std::string_view message) override {
     MessageExtended mext{MakeBinarySpan(message), impl::WSOpcodes::kText, {}};
     SendExtended(mext);
@@ -176,6 +325,17 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
         }
         if (frame_.waiting_continuation) continue;
 
+        if (frame_.is_compressed) {
+          status_raw =
+              deflate_->Decompress(msg.data, config.max_remote_payload);
+          if (status_raw != CloseStatus::kNone) {
+            MessageExtended close_msg{{}, impl::WSOpcodes::kClose, status_raw};
+            SendExtended(close_msg);
+            msg = CloseMessage(status_raw);
+            return;
+          }
+        }
+
         msg.is_text = frame_.is_text;
         stats_.msg_recv++;
         stats_.bytes_recv += msg.data.size();
@@ -218,10 +378,22 @@ WebSocketConnection::~WebSocketConnection() = default;
 std::shared_ptr<WebSocketConnection> MakeWebSocket(
     std::unique_ptr<engine::io::RwBase>&& socket,
     engine::io::Sockaddr&& peer_name, const Config& config) {
+  return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config,
+                             std::nullopt);
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate) {
   return std::make_shared<WebSocketConnectionImpl>(
-      std::move(socket), std::move(peer_name), config);
+      std::move(socket), std::move(peer_name), config, deflate);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -63,6 +63,14 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
 
   if (!HandleHandshake(request, response, context)) return "";
 
+  auto deflate = websocket::impl::NegotiateDeflate(
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions),
+      config_.permessage_deflate);
+  if (deflate) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+                       websocket::impl::ToResponseHeader(*deflate));
+  }
+
   response.SetStatus(server::http::HttpStatus::kSwitchingProtocols);
   response.SetHeader(USERVER_NAMESPACE::http::headers::kConnection, "Upgrade");
   response.SetHeader(USERVER_NAMESPACE::http::headers::kUpgrade, "websocket");
@@ -72,11 +80,12 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
   request.SetUpgradeWebsocket(
       [context = std::make_shared<server::request::RequestContext>(
            std::move(context)),
+       deflate = std::move(deflate),
        this](std::unique_ptr<engine::io::RwBase> socket,
              engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket),
-                                           std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(
+            std::move(socket), std::move(peer_name), config_, deflate);
         try {
           Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -112,6 +121,33 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: object
+        description: settings of the permessage-deflate extension (RFC 7692)
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: accept the permessage-deflate offers of the clients
+                defaultDescription: false
+            server-no-context-takeover:
+                type: boolean
+                description: reset the compression context after each sent message
+                defaultDescription: false
+            client-no-context-takeover:
+                type: boolean
+                description: ask the clients to reset the compression context after each message
+                defaultDescription: false
+            compression-level:
+                type: integer
+                description: zlib compression level of the sent messages
+                defaultDescription: 6
+                minimum: 0
+                maximum: 9
+            min-message-size:
+                type: integer
+                description: smaller messages are sent uncompressed
+                defaultDescription: 64
 )");
 }
 
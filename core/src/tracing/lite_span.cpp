@@ -0,0 +1,43 @@
+#include <userver/tracing/lite_span.hpp>
+
+#include <string>
+
+#include <tracing/time_storage.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+impl::TimeStorage* GetCurrentTimeStorage() noexcept {
+  auto* span = Span::CurrentSpanUnchecked();
+  return span ? &span->GetTimeStorage() : nullptr;
+}
+
+}  // namespace
+
+LiteSpan::LiteSpan(std::string_view name) noexcept
+    : time_storage_(GetCurrentTimeStorage()),
+      name_(name),
+      start_(time_storage_ ? std::chrono::steady_clock::now()
+                           : std::chrono::steady_clock::time_point{}) {}
+
+LiteSpan::~LiteSpan() {
+  if (!time_storage_) return;
+  time_storage_->PushLap(std::string{name_}, DurationSinceStart());
+}
+
+tracing::Span& LiteSpan::Promote() {
+  if (!span_) span_.emplace(std::string{name_});
+  return *span_;
+}
+
+ScopeTime::Duration LiteSpan::DurationSinceStart() const {
+  if (!time_storage_) return ScopeTime::Duration{0};
+  return std::chrono::steady_clock::now() - start_;
+}
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#include <userver/tracing/lite_span.hpp>
+
+#include <logging/logging_test.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/tracing/scope_time.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+class LiteSpan : public LoggingTest {};
+
+UTEST_F(LiteSpan, RecordsIntoCurrentSpan) {
+  {
+    tracing::Span span("outer_span");
+    for (int i = 0; i < 2; ++i) {
+      const tracing::LiteSpan scope{"lite_scope"};
+      engine::SleepFor(std::chrono::milliseconds{1});
+      EXPECT_GE(scope.DurationSinceStart(), std::chrono::milliseconds{1});
+    }
+    EXPECT_GE(tracing::ScopeTime{}.DurationTotal("lite_scope"),
+              std::chrono::milliseconds{2});
+  }
+
+  logging::LogFlush();
+  const auto logs = GetStreamString();
+  EXPECT_NE(std::string::npos, logs.find("lite_scope_time=")) << logs;
+  EXPECT_EQ(std::string::npos, logs.find("stopwatch_name=lite_scope")) << logs;
+}
+
+UTEST_F(LiteSpan, Promote) {
+  {
+    tracing::Span span("outer_span");
+    tracing::LiteSpan scope{"lite_scope"};
+    scope.Promote().AddTag("promoted", 1);
+    EXPECT_EQ(&scope.Promote(), &tracing::Span::CurrentSpan());
+  }
+
+  logging::LogFlush();
+  const auto logs = GetStreamString();
+  EXPECT_NE(std::string::npos, logs.find("stopwatch_name=lite_scope")) << logs;
+  EXPECT_NE(std::string::npos, logs.find("promoted=1")) << logs;
+  EXPECT_NE(std::string::npos, logs.find("lite_scope_time=")) << logs;
+}
+
+UTEST(LiteSpanNoSpan, DoesNothing) {
+  engine::AsyncNoSpan([] {
+    const tracing::LiteSpan scope{"lite_scope"};
+    EXPECT_EQ(scope.DurationSinceStart(), tracing::ScopeTime::Duration{0});
+  }).Get();
+}
+
+USERVER_NAMESPACE_END
@@ -1,21 +1,28 @@
 #include <tracing/span_impl.hpp>
 
+#include <cstring>
 #include <type_traits>
+#include <variant>
+
+#include <boost/container/small_vector.hpp>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/encoding/hex.hpp>
 #include <userver/utils/rand.hpp>
 #include <userver/utils/uuid4.hpp>
+#include <utils/datetime/cached_time_string.hpp>
 #include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,6 +37,8 @@ constexpr std::string_view kStopWatchTag = "stopwatch_name";
 constexpr std::string_view kTotalTimeTag = "total_time";
 constexpr std::string_view kTimeUnitsTag = "stopwatch_units";
 constexpr std::string_view kStartTimestampTag = "start_timestamp";
+constexpr std::string_view kCpuTimeTag = "cpu_ms";
+constexpr std::string_view kAllocatedBytesTag = "alloc_bytes";
 
 constexpr std::string_view kReferenceType = "span_ref_type";
 constexpr std::string_view kReferenceTypeChild = "child";
@@ -44,21 +53,57 @@ struct TsBuffer final {
   std::string_view ToStringView() && noexcept = delete;
 };
 
+// digits of int64
+constexpr std::size_t kMaxSecondsSize = 20;
+
+compiler::ThreadLocal local_cached_start_seconds = [] {
+  return utils::datetime::impl::CachedTimeString<kMaxSecondsSize>{};
+};
+
+// `<seconds since epoch>.<microseconds>`, the seconds are formatted once per
+// second
 TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
-  const auto start_ts_epoch =
+  const auto fractional_part =
       std::chrono::duration_cast<std::chrono::microseconds>(
           start.time_since_epoch())
-          .count();
+          .count() %
+      1000000;
+
   TsBuffer buffer;
-  const auto integral_part = start_ts_epoch / 1000000;
-  const auto fractional_part = start_ts_epoch % 1000000;
-  buffer.size =
-      fmt::format_to_n(std::data(buffer.data), std::size(buffer.data),
-                       FMT_COMPILE("{}.{:0>6}"), integral_part, fractional_part)
-          .size;
+  char* out = std::data(buffer.data);
+  {
+    auto cached_seconds = local_cached_start_seconds.Use();
+    const auto seconds =
+        cached_seconds->Get(start, [](auto start_seconds, char* seconds_out) {
+          const auto* const end =
+              fmt::format_to(seconds_out, FMT_COMPILE("{}"),
+                             start_seconds.time_since_epoch().count());
+          return static_cast<std::size_t>(end - seconds_out);
+        });
+    std::memcpy(out, seconds.data(), seconds.size());
+    out += seconds.size();
+  }
+  *out++ = '.';
+  out = utils::datetime::impl::WriteFixedDigits<6>(
+      out, static_cast<std::uint32_t>(fractional_part));
+  buffer.size = static_cast<std::size_t>(out - std::data(buffer.data));
   return buffer;
 }
 
+bool IsErrorFlag(std::string_view key, const logging::LogExtra::Value& value) {
+  if (key != kErrorFlag) return false;
+  return std::visit(
+      [](const auto& flag) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(flag)>,
+                                     std::string>) {
+          return !flag.empty();
+        } else {
+          return flag != 0;
+        }
+      },
+      value);
+}
+
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
@@ -96,22 +141,52 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    trace_buffer_ = parent->trace_buffer_;
+  } else {
+    trace_buffer_ = impl::TraceBuffer::StartTrace();
+    is_trace_root_ = static_cast<bool>(trace_buffer_);
+  }
+
+  const auto* context = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (context && context->IsResourceAccounted()) {
+    resource_task_ = context;
+    start_resource_usage_ = context->GetResourceUsage();
   }
 }
 
 Span::Impl::~Impl() {
-  if (!ShouldLog()) {
+  bool should_log = ShouldLog();
+  if (should_log) {
+    const auto span_exporter = impl::GetSpanExporter();
+    if (span_exporter.exporter) {
+      span_exporter.exporter->Export(
+          MakeFinishedSpan(/*move_tags=*/!span_exporter.log_spans));
+      should_log = span_exporter.log_spans;
+    }
+  }
+
+  if (is_trace_root_ && trace_buffer_) {
+    const auto duration = std::chrono::steady_clock::now() - start_steady_time_;
+    if (!trace_buffer_->FinishTrace(duration)) return;
+  }
+
+  if (!should_log) {
     return;
   }
 
-  {
-    const DetachLocalSpansScope ignore_local_span;
-    logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
-                          source_location_};
-    std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+  if (trace_buffer_ && !is_trace_root_) {
+    std::move(*this).LogSpan(*trace_buffer_);
+  } else {
+    std::move(*this).LogSpan(logging::GetDefaultLogger());
   }
 }
 
+void Span::Impl::LogSpan(logging::LoggerRef logger) && {
+  const DetachLocalSpansScope ignore_local_span;
+  logging::LogHelper lh{logger, log_level_, source_location_};
+  std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+}
+
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   const auto steady_now = std::chrono::steady_clock::now();
   const auto duration = steady_now - start_steady_time_;
@@ -128,6 +203,12 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   writer.PutTag(kReferenceType, ref_type);
   writer.PutTag(kTimeUnitsTag, "ms");
   writer.PutTag(kStartTimestampTag, timestamp_buffer.ToStringView());
+  if (const auto usage = GetResourceUsage()) {
+    writer.PutTag(kCpuTimeTag,
+                  std::chrono::duration_cast<RealMilliseconds>(usage->cpu_time)
+                      .count());
+    writer.PutTag(kAllocatedBytesTag, usage->allocated_bytes);
+  }
 
   time_storage_.MergeInto(writer);
 
@@ -141,11 +222,64 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
   LogOpenTracing();
 }
 
+FinishedSpan Span::Impl::MakeFinishedSpan(bool move_tags) {
+  const auto duration = std::chrono::steady_clock::now() - start_steady_time_;
+
+  FinishedSpan span;
+  span.name = name_;
+  span.trace_id = trace_id_;
+  span.span_id = span_id_;
+  span.parent_id = parent_id_;
+  span.reference_type = reference_type_;
+  span.level = log_level_;
+  span.start_time = start_system_time_;
+  span.end_time =
+      start_system_time_ +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(duration);
+
+  auto tags = move_tags ? std::move(log_extra_inheritable_)
+                        : logging::LogExtra{log_extra_inheritable_};
+  if (log_extra_local_) tags.Extend(*log_extra_local_);
+
+  span.tags.reserve(tags.extra_->size());
+  for (auto& [key, value] : *tags.extra_) {
+    span.tags.emplace_back(key, std::move(value.GetValue()));
+  }
+  time_storage_.MergeInto(span.tags);
+  if (const auto usage = GetResourceUsage()) {
+    span.tags.emplace_back(
+        std::string{kCpuTimeTag},
+        std::chrono::duration_cast<RealMilliseconds>(usage->cpu_time).count());
+    span.tags.emplace_back(std::string{kAllocatedBytesTag},
+                           usage->allocated_bytes);
+  }
+
+  return span;
+}
+
+std::optional<engine::current_task::ResourceUsage>
+Span::Impl::GetResourceUsage() const {
+  // The usage of another task is unrelated to the span
+  const auto* current = engine::current_task::GetCurrentTaskContextUnchecked();
+  if (!resource_task_ || current != resource_task_) return std::nullopt;
+
+  const auto now = resource_task_->GetResourceUsage();
+  return engine::current_task::ResourceUsage{
+      now.cpu_time - start_resource_usage_.cpu_time,
+      now.allocated_bytes - start_resource_usage_.allocated_bytes,
+  };
+}
+
 void Span::Impl::LogTo(logging::impl::TagWriter writer) {
   writer.ExtendLogExtra(log_extra_inheritable_);
   tracer_->LogSpanContextTo(*this, writer);
 }
 
+void Span::Impl::MarkErrorIfNeeded(std::string_view key,
+                                   const logging::LogExtra::Value& value) {
+  if (trace_buffer_ && IsErrorFlag(key, value)) trace_buffer_->MarkErrored();
+}
+
 void Span::Impl::DetachFromCoroStack() { unlink(); }
 
 void Span::Impl::AttachToCoroStack() {
@@ -308,6 +442,7 @@ tracing::ScopeTime Span::CreateScopeTime(std::string name) {
 
 void Span::AddNonInheritableTag(std::string key,
                                 logging::LogExtra::Value value) {
+  pimpl_->MarkErrorIfNeeded(key, value);
   if (!pimpl_->log_extra_local_) pimpl_->log_extra_local_.emplace();
   pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
@@ -328,6 +463,7 @@ std::optional<logging::Level> Span::GetLocalLogLevel() const {
 }
 
 void Span::AddTag(std::string key, logging::LogExtra::Value value) {
+  pimpl_->MarkErrorIfNeeded(key, value);
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value));
 }
 
@@ -353,6 +489,7 @@ std::string Span::GetTag(std::string_view tag) const {
 }
 
 void Span::AddTagFrozen(std::string key, logging::LogExtra::Value value) {
+  pimpl_->MarkErrorIfNeeded(key, value);
   pimpl_->log_extra_inheritable_.Extend(std::move(key), std::move(value),
                                         logging::LogExtra::ExtendType::kFrozen);
 }
@@ -389,6 +526,8 @@ const std::string& Span::GetTraceId() const { return pimpl_->GetTraceId(); }
 
 const std::string& Span::GetSpanId() const { return pimpl_->GetSpanId(); }
 
+const std::string& Span::GetName() const { return pimpl_->GetName(); }
+
 const std::string& Span::GetParentId() const { return pimpl_->GetParentId(); }
 
 ScopeTime::Duration Span::GetTotalDuration(
@@ -0,0 +1,47 @@
+#include <userver/tracing/span_exporter.hpp>
+
+#include <atomic>
+
+#include <userver/rcu/rcu.hpp>
+
+#include <tracing/span_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+auto& GlobalSpanExporter() {
+  static rcu::Variable<impl::SpanExporterRef> exporter{};
+  return exporter;
+}
+
+// Spares the rcu read in the destructor of each span while there is no
+// exporter
+std::atomic<bool> is_span_exporter_set{false};
+
+}  // namespace
+
+SpanExporter::~SpanExporter() = default;
+
+void SetSpanExporter(std::shared_ptr<SpanExporter> exporter, bool log_spans) {
+  const bool is_set = static_cast<bool>(exporter);
+  GlobalSpanExporter().Assign(
+      impl::SpanExporterRef{std::move(exporter), log_spans || !is_set});
+  is_span_exporter_set = is_set;
+}
+
+namespace impl {
+
+SpanExporterRef GetSpanExporter() {
+  if (!is_span_exporter_set) return {};
+  const auto exporter = GlobalSpanExporter().Read();
+  return *exporter;
+}
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -2,12 +2,14 @@
 
 #include <chrono>
 #include <list>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 
 #include <boost/intrusive/list.hpp>
 
+#include <userver/engine/task/task_base.hpp>
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log_extra.hpp>
@@ -15,15 +17,29 @@
 #include <userver/logging/log_helper.hpp>
 #include <userver/tracing/scope_time.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <tracing/tail_sampling.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
 
+namespace impl {
+
+struct SpanExporterRef final {
+  std::shared_ptr<SpanExporter> exporter;
+  bool log_spans{true};
+};
+
+// Returns an empty exporter if the export is disabled
+SpanExporterRef GetSpanExporter();
+
+}  // namespace impl
+
 inline const std::string kLinkTag = "link";
 inline const std::string kParentLinkTag = "parent_link";
 
@@ -57,6 +73,7 @@ class Span::Impl
   const std::string& GetTraceId() const& noexcept { return trace_id_; }
   const std::string& GetSpanId() const& noexcept { return span_id_; }
   const std::string& GetParentId() const& noexcept { return parent_id_; }
+  const std::string& GetName() const noexcept { return name_; }
 
   std::string GetTraceId() && noexcept { return std::move(trace_id_); }
   std::string GetSpanId() && noexcept { return std::move(span_id_); }
@@ -68,6 +85,10 @@ class Span::Impl
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+  // Makes the tail sampling keep the trace if the tag marks an error
+  void MarkErrorIfNeeded(std::string_view key,
+                         const logging::LogExtra::Value& value);
+
   void DetachFromCoroStack();
   void AttachToCoroStack();
 
@@ -79,6 +100,9 @@ class Span::Impl
 
   static std::string GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
+  FinishedSpan MakeFinishedSpan(bool move_tags);
+  std::optional<engine::current_task::ResourceUsage> GetResourceUsage() const;
+  void LogSpan(logging::LoggerRef logger) &&;
 
   const std::string name_;
   const bool is_no_log_span_;
@@ -96,12 +120,20 @@ class Span::Impl
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
 
+  // Set if the resources of the task that started the span are accounted
+  const engine::impl::TaskContext* resource_task_{nullptr};
+  engine::current_task::ResourceUsage start_resource_usage_{};
+
   std::string trace_id_;
   std::string span_id_;
   std::string parent_id_;
   const ReferenceType reference_type_;
   utils::impl::SourceLocation source_location_;
 
+  // Shared by the spans of a trace with the tail sampling enabled
+  std::shared_ptr<impl::TraceBuffer> trace_buffer_;
+  bool is_trace_root_{false};
+
   friend class Span;
   friend class SpanBuilder;
   friend class TagScope;
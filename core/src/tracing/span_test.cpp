@@ -1,11 +1,17 @@
+#include <algorithm>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/tail_sampling.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -177,6 +183,22 @@ UTEST_F(Span, InheritTag) {
   EXPECT_NE(std::string::npos, GetStreamString().find("k=v"));
 }
 
+UTEST_F(Span, LogExtraOverridesTag) {
+  tracing::Span span("span_name");
+  span.AddTag("k", "span");
+  span.AddTagFrozen("frozen", "span");
+
+  LOG_INFO() << "inside"
+             << logging::LogExtra{
+                    {"k", "log"}, {"frozen", "log"}, {"extra", "log"}};
+  logging::LogFlush();
+
+  const auto logs = GetStreamString();
+  EXPECT_NE(std::string::npos, logs.find("\tk=log\tfrozen=span\textra=log"))
+      << logs;
+  EXPECT_EQ(std::string::npos, logs.find("k=span")) << logs;
+}
+
 UTEST_F(Span, NonInheritTag) {
   tracing::Span span("span_name");
 
@@ -561,6 +583,146 @@ UTEST_F(Span, NoLogWithSetLogLevel) {
   tracing::Tracer::SetNoLogSpans(tracing::NoLogSpans());
 }
 
+UTEST_F(Span, TailSamplingDropsFastTraces) {
+  tracing::TailSampling config;
+  config.enabled = true;
+  config.slow_threshold = std::chrono::hours{1};
+  config.sample_rate = 0;
+  tracing::SetTailSampling(std::move(config));
+
+  {
+    tracing::Span root(tracing::Tracer::GetTracer(), "tail_root", nullptr,
+                       tracing::ReferenceType::kChild);
+    { tracing::Span child("tail_child"); }
+
+    logging::LogFlush();
+    EXPECT_EQ(std::string::npos, GetStreamString().find("tail_child"));
+  }
+
+  logging::LogFlush();
+  EXPECT_EQ(std::string::npos, GetStreamString().find("tail_child"));
+  EXPECT_EQ(std::string::npos, GetStreamString().find("tail_root"));
+
+  tracing::SetTailSampling(tracing::TailSampling{});
+}
+
+UTEST_F(Span, TailSamplingKeepsErroredTraces) {
+  tracing::TailSampling config;
+  config.enabled = true;
+  config.slow_threshold = std::chrono::hours{1};
+  config.sample_rate = 0;
+  tracing::SetTailSampling(std::move(config));
+
+  {
+    tracing::Span root(tracing::Tracer::GetTracer(), "tail_root", nullptr,
+                       tracing::ReferenceType::kChild);
+    {
+      tracing::Span child("tail_child");
+      child.AddTag(tracing::kErrorFlag, true);
+    }
+
+    logging::LogFlush();
+    EXPECT_EQ(std::string::npos, GetStreamString().find("tail_child"));
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(std::string::npos, GetStreamString().find("tail_child"));
+  EXPECT_NE(std::string::npos, GetStreamString().find("tail_root"));
+
+  tracing::SetTailSampling(tracing::TailSampling{});
+}
+
+UTEST_F(Span, TailSamplingKeepsSlowTraces) {
+  tracing::TailSampling config;
+  config.enabled = true;
+  config.slow_threshold = std::chrono::milliseconds{0};
+  config.sample_rate = 0;
+  tracing::SetTailSampling(std::move(config));
+
+  {
+    tracing::Span root(tracing::Tracer::GetTracer(), "tail_root", nullptr,
+                       tracing::ReferenceType::kChild);
+    tracing::Span child("tail_child");
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(std::string::npos, GetStreamString().find("tail_child"));
+  EXPECT_NE(std::string::npos, GetStreamString().find("tail_root"));
+
+  tracing::SetTailSampling(tracing::TailSampling{});
+}
+
+UTEST_F(Span, TailSamplingLogsOverflowedTraces) {
+  tracing::TailSampling config;
+  config.enabled = true;
+  config.slow_threshold = std::chrono::hours{1};
+  config.sample_rate = 0;
+  config.max_spans_per_trace = 1;
+  tracing::SetTailSampling(std::move(config));
+
+  {
+    tracing::Span root(tracing::Tracer::GetTracer(), "tail_root", nullptr,
+                       tracing::ReferenceType::kChild);
+    { tracing::Span child("tail_first_child"); }
+    { tracing::Span child("tail_second_child"); }
+
+    logging::LogFlush();
+    EXPECT_NE(std::string::npos, GetStreamString().find("tail_first_child"));
+    EXPECT_NE(std::string::npos, GetStreamString().find("tail_second_child"));
+  }
+
+  logging::LogFlush();
+  EXPECT_NE(std::string::npos, GetStreamString().find("tail_root"));
+
+  tracing::SetTailSampling(tracing::TailSampling{});
+}
+
+namespace {
+
+class CollectingSpanExporter final : public tracing::SpanExporter {
+ public:
+  void Export(tracing::FinishedSpan&& span) noexcept override {
+    spans.push_back(std::move(span));
+  }
+
+  std::vector<tracing::FinishedSpan> spans;
+};
+
+}  // namespace
+
+UTEST_F(Span, Exporter) {
+  auto exporter = std::make_shared<CollectingSpanExporter>();
+  tracing::SetSpanExporter(exporter, /*log_spans=*/false);
+
+  std::string trace_id;
+  {
+    tracing::Span span("exported_span");
+    span.AddTag("inheritable", 1);
+    span.AddNonInheritableTag("local", "value");
+    trace_id = span.GetTraceId();
+    {
+      tracing::Span ignored("ignored_span");
+      ignored.SetLocalLogLevel(logging::Level::kError);
+    }
+  }
+  tracing::SetSpanExporter(nullptr);
+
+  logging::LogFlush();
+  EXPECT_EQ(std::string::npos, GetStreamString().find("exported_span"));
+
+  ASSERT_EQ(exporter->spans.size(), 1);
+  const auto& span = exporter->spans.front();
+  EXPECT_EQ(span.name, "exported_span");
+  EXPECT_EQ(span.trace_id, trace_id);
+  EXPECT_LE(span.start_time, span.end_time);
+  EXPECT_NE(std::find(span.tags.begin(), span.tags.end(),
+                      logging::LogExtra::Pair{"inheritable", 1}),
+            span.tags.end());
+  EXPECT_NE(std::find(span.tags.begin(), span.tags.end(),
+                      logging::LogExtra::Pair{"local", "value"}),
+            span.tags.end());
+}
+
 UTEST_F(Span, ForeignSpan) {
   auto tracer = tracing::MakeTracer("test_service", {});
 
@@ -0,0 +1,147 @@
+#include <tracing/tail_sampling.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/logging/impl/tag_writer.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+namespace {
+
+auto& GlobalTailSampling() {
+  static rcu::Variable<TailSampling> config{};
+  return config;
+}
+
+// Bytes buffered by all the traces of the process
+std::atomic<std::size_t> global_buffered_size{0};
+
+}  // namespace
+
+TailSampling Parse(const formats::json::Value& value,
+                   formats::parse::To<TailSampling>) {
+  const TailSampling defaults;
+
+  TailSampling ret;
+  ret.enabled = value["enabled"].As<bool>(defaults.enabled);
+  ret.slow_threshold = std::chrono::milliseconds{
+      value["slow-threshold-ms"].As<std::int64_t>(
+          defaults.slow_threshold.count())};
+  ret.sample_rate = value["sample-rate"].As<double>(defaults.sample_rate);
+  ret.max_spans_per_trace = value["max-spans-per-trace"].As<std::size_t>(
+      defaults.max_spans_per_trace);
+  ret.memory_budget =
+      value["memory-budget-bytes"].As<std::size_t>(defaults.memory_budget);
+
+  return ret;
+}
+
+void SetTailSampling(TailSampling&& config) {
+  GlobalTailSampling().Assign(std::move(config));
+}
+
+namespace impl {
+
+std::shared_ptr<TraceBuffer> TraceBuffer::StartTrace() {
+  const auto config = GlobalTailSampling().Read();
+  if (!config->enabled) return nullptr;
+
+  // The randomly sampled traces are known to be logged from the start
+  if (config->sample_rate > 0 && utils::RandRange(1.0) < config->sample_rate) {
+    return nullptr;
+  }
+
+  return std::make_shared<TraceBuffer>(
+      logging::GetDefaultLogger().GetFormat(), *config);
+}
+
+TraceBuffer::TraceBuffer(logging::Format format, const TailSampling& config)
+    : LoggerBase(format),
+      slow_threshold_(config.slow_threshold),
+      max_records_(config.max_spans_per_trace),
+      memory_budget_(config.memory_budget) {
+  // Spans check the level of the default logger themselves. The level is not
+  // lowered further to keep the log locations below it disabled.
+  LoggerBase::SetLevel(logging::GetDefaultLogger().GetLevel());
+}
+
+TraceBuffer::~TraceBuffer() { ReleaseMemory(); }
+
+void TraceBuffer::Log(logging::Level level, std::string_view msg) {
+  std::vector<Record> overflowed;
+  {
+    const std::lock_guard lock{mutex_};
+    if (state_ == State::kDropped) return;
+
+    if (state_ == State::kBuffering) {
+      const auto size = msg.size();
+      if (records_.size() < max_records_ &&
+          global_buffered_size.fetch_add(size) + size <= memory_budget_) {
+        buffered_size_ += size;
+        records_.push_back(Record{level, std::string{msg}});
+        return;
+      }
+
+      global_buffered_size -= size;
+      state_ = State::kKept;
+      overflowed = ExtractRecords();
+    }
+  }
+
+  auto& logger = logging::GetDefaultLogger();
+  for (const auto& record : overflowed) logger.Log(record.level, record.text);
+  logger.Log(level, msg);
+}
+
+void TraceBuffer::PrependCommonTags(logging::impl::TagWriter writer) const {
+  logging::GetDefaultLogger().PrependCommonTags(writer);
+}
+
+void TraceBuffer::MarkErrored() noexcept { is_errored_ = true; }
+
+bool TraceBuffer::FinishTrace(
+    std::chrono::steady_clock::duration root_duration) {
+  std::vector<Record> records;
+  bool is_kept = false;
+  {
+    const std::lock_guard lock{mutex_};
+    if (state_ == State::kBuffering) {
+      state_ = (is_errored_ || root_duration >= slow_threshold_)
+                   ? State::kKept
+                   : State::kDropped;
+    }
+    // Dropped traces also release the memory here instead of waiting for
+    // the detached child spans that hold the buffer
+    records = ExtractRecords();
+    is_kept = (state_ == State::kKept);
+    if (!is_kept) records.clear();
+  }
+
+  auto& logger = logging::GetDefaultLogger();
+  for (const auto& record : records) logger.Log(record.level, record.text);
+  return is_kept;
+}
+
+std::vector<TraceBuffer::Record> TraceBuffer::ExtractRecords() {
+  ReleaseMemory();
+  return std::exchange(records_, {});
+}
+
+void TraceBuffer::ReleaseMemory() noexcept {
+  global_buffered_size -= buffered_size_;
+  buffered_size_ = 0;
+}
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
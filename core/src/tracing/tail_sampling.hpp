@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/impl/logger_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+class Value;
+}
+
+namespace tracing {
+
+struct TailSampling {
+  bool enabled{false};
+  std::chrono::milliseconds slow_threshold{1000};
+  double sample_rate{0.01};
+  std::size_t max_spans_per_trace{256};
+  std::size_t memory_budget{64 * 1024 * 1024};
+};
+
+TailSampling Parse(const formats::json::Value& value,
+                   formats::parse::To<TailSampling>);
+
+void SetTailSampling(TailSampling&& config);
+
+namespace impl {
+
+// Keeps the log records of the finished spans of a trace until the root span
+// finishes and decides whether the trace is interesting: slow, errored or
+// randomly sampled. Interesting traces are written to the default logger,
+// others are dropped.
+//
+// A trace that does not fit into its limits or into the global memory budget
+// is written as is, so the budget bounds the memory and never loses spans.
+class TraceBuffer final : public logging::impl::LoggerBase {
+ public:
+  // Returns nullptr if the spans of a new trace should be logged right away
+  static std::shared_ptr<TraceBuffer> StartTrace();
+
+  TraceBuffer(logging::Format format, const TailSampling& config);
+  ~TraceBuffer() override;
+
+  void Log(logging::Level level, std::string_view msg) override;
+
+  void PrependCommonTags(logging::impl::TagWriter writer) const override;
+
+  void MarkErrored() noexcept;
+
+  // Writes or drops the buffered records, returns whether the root span should
+  // be logged
+  bool FinishTrace(std::chrono::steady_clock::duration root_duration);
+
+ private:
+  enum class State {
+    kBuffering,
+    kKept,
+    kDropped,
+  };
+
+  struct Record final {
+    logging::Level level;
+    std::string text;
+  };
+
+  std::vector<Record> ExtractRecords();
+  void ReleaseMemory() noexcept;
+
+  const std::chrono::steady_clock::duration slow_threshold_;
+  const std::size_t max_records_;
+  const std::size_t memory_budget_;
+
+  std::atomic<bool> is_errored_{false};
+  std::mutex mutex_;
+  State state_{State::kBuffering};
+  std::vector<Record> records_;
+  std::size_t buffered_size_{0};
+};
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
@@ -52,6 +52,15 @@ void TimeStorage::MergeInto(logging::impl::TagWriter writer) {
   }
 }
 
+void TimeStorage::MergeInto(
+    std::vector<logging::LogExtra::Pair>& tags) const {
+  for (const auto& [key, value] : data_) {
+    tags.emplace_back(
+        key + std::string{kTimerSuffix},
+        std::chrono::duration<double, std::milli>(value).count());
+  }
+}
+
 }  // namespace tracing::impl
 
 USERVER_NAMESPACE_END
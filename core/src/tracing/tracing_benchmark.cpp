@@ -1,7 +1,11 @@
 #include <benchmark/benchmark.h>
 
+#include <string>
+
 #include <userver/engine/run_standalone.hpp>
+#include <userver/logging/log_extra.hpp>
 #include <userver/logging/null_logger.hpp>
+#include <userver/tracing/lite_span.hpp>
 #include <userver/tracing/tracer.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +37,26 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+void tracing_child_span(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const tracing::Span parent("parent");
+    for ([[maybe_unused]] auto _ : state) {
+      const tracing::Span span("name");
+    }
+  });
+}
+BENCHMARK(tracing_child_span);
+
+void tracing_lite_span(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const tracing::Span parent("parent");
+    for ([[maybe_unused]] auto _ : state) {
+      const tracing::LiteSpan span("name");
+    }
+  });
+}
+BENCHMARK(tracing_lite_span);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
   auto span = tracer->CreateSpanWithoutParent("name");
   span.AddTag("meta_code", 200);
@@ -52,6 +76,26 @@ void tracing_opentracing_ctr(benchmark::State& state) {
 }
 BENCHMARK(tracing_opentracing_ctr);
 
+// Tag values of 16+ bytes (ids, urls) do not fit into the inline buffer of
+// std::string. 'log_extra_bytes' is the footprint of the tags storage, a span
+// has two of them.
+void tracing_string_tags(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const std::string value(state.range(0), 'x');
+    const tracing::Span parent("parent");
+    for ([[maybe_unused]] auto _ : state) {
+      tracing::Span span("name");
+      span.AddTag("first_tag", value);
+      span.AddTag("second_tag", value);
+      span.AddNonInheritableTag("third_tag", value);
+      span.AddNonInheritableTag("fourth_tag", value);
+    }
+  });
+
+  state.counters["log_extra_bytes"] = sizeof(logging::LogExtra);
+}
+BENCHMARK(tracing_string_tags)->Arg(8)->Arg(24)->Arg(40);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
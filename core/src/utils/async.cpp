@@ -42,6 +42,23 @@ void SpanWrapCall::DoBeforeInvoke() {
 
 SpanWrapCall::~SpanWrapCall() = default;
 
+struct InheritVariablesWrapCall::Impl {
+  engine::impl::task_local::Storage storage_;
+};
+
+InheritVariablesWrapCall::InheritVariablesWrapCall() {
+  if (engine::current_task::IsTaskProcessorThread()) {
+    pimpl_->storage_.InheritFrom(engine::impl::task_local::GetCurrentStorage());
+  }
+}
+
+void InheritVariablesWrapCall::DoBeforeInvoke() {
+  engine::impl::task_local::GetCurrentStorage().InitializeFrom(
+      std::move(pimpl_->storage_));
+}
+
+InheritVariablesWrapCall::~InheritVariablesWrapCall() = default;
+
 }  // namespace utils::impl
 
 USERVER_NAMESPACE_END
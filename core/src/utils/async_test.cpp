@@ -1,12 +1,15 @@
 #include <userver/utils/async.hpp>
 
+#include <string>
 #include <vector>
 
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/numeric.hpp>
 
 #include <userver/concurrent/variable.hpp>
+#include <userver/engine/task/inherited_variable.hpp>
 #include <userver/engine/task/task_with_result.hpp>
+#include <userver/tracing/span.hpp>
 #include <userver/utest/utest.hpp>
 
 #include <engine/ev/thread_control.hpp>
@@ -74,6 +77,24 @@ UTEST(UtilsAsync, FromNonWorkerThread) {
 
 namespace {
 
+engine::TaskInheritedVariable<std::string> kInheritedString;
+
+}  // namespace
+
+UTEST(UtilsAsync, NoSpanInheritVariables) {
+  kInheritedString.Set("parent");
+
+  utils::AsyncNoSpanInheritVariables([] {
+    EXPECT_EQ(tracing::Span::CurrentSpanUnchecked(), nullptr);
+    EXPECT_EQ(kInheritedString.Get(), "parent");
+    kInheritedString.Set("child");
+  }).Get();
+
+  EXPECT_EQ(kInheritedString.Get(), "parent");
+}
+
+namespace {
+
 using Request = int;
 using Response = int;
 
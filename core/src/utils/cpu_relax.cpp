@@ -36,11 +36,13 @@ CpuRelax::CpuRelax(std::size_t every, tracing::ScopeTime* scope)
 
 void CpuRelax::Relax() {
   if (every_iterations_ == 0) return;
-  if (++iterations_ == every_iterations_) {
-    iterations_ = 0;
+  // engine::ShouldYield() preempts the loop that has been running for the
+  // whole `preemption-time-slice` before reaching `every_iterations_`
+  if (++iterations_ == every_iterations_ || engine::ShouldYield()) {
     pause_.Pause();
     LOG_TRACE() << fmt::format("CPU relax: yielding after {} iterations",
-                               every_iterations_);
+                               iterations_);
+    iterations_ = 0;
     if (engine::current_task::IsTaskProcessorThread()) {
       engine::Yield();
     }
@@ -59,12 +61,13 @@ StreamingCpuRelax::StreamingCpuRelax(std::uint64_t check_time_after_bytes,
 void StreamingCpuRelax::Relax(std::uint64_t bytes_processed) {
   bytes_since_last_time_check_ += bytes_processed;
 
-  if (bytes_since_last_time_check_ >= check_time_after_bytes_) {
+  if (bytes_since_last_time_check_ >= check_time_after_bytes_ ||
+      engine::ShouldYield()) {
     total_bytes_ += std::exchange(bytes_since_last_time_check_, 0);
 
     const auto now = std::chrono::steady_clock::now();
 
-    if (now - last_yield_time_ > kYieldInterval) {
+    if (now - last_yield_time_ > kYieldInterval || engine::ShouldYield()) {
       pause_.Pause();
       LOG_TRACE() << "StreamingCpuRelax: yielding after using "
                   << std::chrono::duration_cast<std::chrono::milliseconds>(
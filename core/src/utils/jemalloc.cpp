@@ -6,6 +6,13 @@
 #include <cerrno>
 #endif
 
+#include <cstddef>
+#include <cstdint>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
 #include <userver/utils/thread_name.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -21,6 +28,16 @@ void malloc_stats_print(void (*write_cb)(void*, const char*), void* je_cbopaque,
                         const char*) {
   write_cb(je_cbopaque, "(libjemalloc support is disabled)");
 }
+
+void* mallocx(size_t, int) { return nullptr; }
+
+void sdallocx(void*, size_t, int) {}
+
+constexpr int MALLOCX_TCACHE_NONE = 0;
+
+constexpr int MALLOCX_ARENA(unsigned) { return 0; }
+
+constexpr int MALLOCX_ALIGN(size_t) { return 0; }
 #endif
 
 std::error_code MakeErrorCode(int rc) { return {rc, std::system_category()}; }
@@ -36,6 +53,23 @@ std::error_code MallCtl(const char* name) {
   return MakeErrorCode(rc);
 }
 
+template <typename T>
+std::error_code MallCtlRead(const char* name, T& value) {
+  size_t size = sizeof(value);
+  int rc = mallctl(name, &value, &size, nullptr, 0);
+  return MakeErrorCode(rc);
+}
+
+int DeallocationFlags(std::size_t alignment) {
+  int flags = MALLOCX_TCACHE_NONE;
+  if (alignment > alignof(std::max_align_t)) flags |= MALLOCX_ALIGN(alignment);
+  return flags;
+}
+
+int AllocationFlags(unsigned arena_index, std::size_t alignment) {
+  return MALLOCX_ARENA(arena_index) | DeallocationFlags(alignment);
+}
+
 void MallocStatPrintCb(void* data, const char* msg) {
   auto* s = static_cast<std::string*>(data);
   *s += msg;
@@ -55,6 +89,19 @@ std::error_code ProfDeactivate() { return MallCtl<bool>("prof.active", false); }
 
 std::error_code ProfDump() { return MallCtl("prof.dump"); }
 
+std::error_code ProfDump(std::string& dump) {
+  const auto file = fs::blocking::TempFile::Create();
+  if (auto ec = MallCtl<const char*>("prof.dump", file.GetPath().c_str())) {
+    return ec;
+  }
+  dump = fs::blocking::ReadFileContents(file.GetPath());
+  return {};
+}
+
+std::error_code SetThreadProfName(const std::string& name) {
+  return MallCtl<const char*>("thread.prof.name", name.c_str());
+}
+
 std::error_code SetMaxBgThreads(size_t max_bg_threads) {
   return MallCtl<size_t>("max_background_threads", max_bg_threads);
 }
@@ -68,6 +115,54 @@ std::error_code StopBgThreads() {
   return MallCtl<bool>("background_thread", false);
 }
 
+std::error_code CreateArena(unsigned& arena_index) {
+  return MallCtlRead("arenas.create", arena_index);
+}
+
+std::error_code DestroyArena(unsigned arena_index) {
+  const auto name = fmt::format("arena.{}.destroy", arena_index);
+  return MallCtl(name.c_str());
+}
+
+std::error_code GetArenaAllocatedBytes(unsigned arena_index,
+                                       std::size_t& allocated_bytes) {
+  // refresh the cached statistics
+  std::uint64_t epoch = 1;
+  if (auto ec = MallCtl<std::uint64_t>("epoch", epoch)) return ec;
+
+  std::size_t small = 0;
+  std::size_t large = 0;
+  if (auto ec = MallCtlRead(
+          fmt::format("stats.arenas.{}.small.allocated", arena_index).c_str(),
+          small)) {
+    return ec;
+  }
+  if (auto ec = MallCtlRead(
+          fmt::format("stats.arenas.{}.large.allocated", arena_index).c_str(),
+          large)) {
+    return ec;
+  }
+  allocated_bytes = small + large;
+  return {};
+}
+
+void* AllocateInArena(unsigned arena_index, std::size_t size,
+                      std::size_t alignment) noexcept {
+  return mallocx(size, AllocationFlags(arena_index, alignment));
+}
+
+void DeallocateInArena(void* ptr, std::size_t size,
+                       std::size_t alignment) noexcept {
+  // the arena is deduced from the pointer
+  sdallocx(ptr, size, DeallocationFlags(alignment));
+}
+
+const std::uint64_t* GetThreadAllocatedBytesCounter() noexcept {
+  std::uint64_t* counter = nullptr;
+  if (MallCtlRead("thread.allocatedp", counter)) return nullptr;
+  return counter;
+}
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
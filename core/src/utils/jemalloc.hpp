@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <system_error>
 
@@ -15,6 +17,13 @@ std::error_code ProfDeactivate();
 
 std::error_code ProfDump();
 
+// Dumps the sampled live allocations in heap_v2 format, which is accepted by
+// jeprof and pprof, to `dump`. Blocking.
+std::error_code ProfDump(std::string& dump);
+
+// Sets the name of the current thread in the heap profiles
+std::error_code SetThreadProfName(const std::string& name);
+
 std::error_code SetMaxBgThreads(size_t max_bg_threads);
 
 std::error_code EnableBgThreads();
@@ -22,6 +31,26 @@ std::error_code EnableBgThreads();
 // blocking
 std::error_code StopBgThreads();
 
+// Dedicated arenas, ENOTSUP without jemalloc
+std::error_code CreateArena(unsigned& arena_index);
+
+// Discards all the allocations of the arena
+std::error_code DestroyArena(unsigned arena_index);
+
+std::error_code GetArenaAllocatedBytes(unsigned arena_index,
+                                       std::size_t& allocated_bytes);
+
+// Returns nullptr on failure, bypasses the thread cache
+void* AllocateInArena(unsigned arena_index, std::size_t size,
+                      std::size_t alignment) noexcept;
+
+void DeallocateInArena(void* ptr, std::size_t size,
+                       std::size_t alignment) noexcept;
+
+// Pointer to the monotonic count of bytes allocated by the current thread,
+// nullptr without jemalloc. Valid until the thread exits.
+const std::uint64_t* GetThreadAllocatedBytesCounter() noexcept;
+
 }  // namespace utils::jemalloc
 
 USERVER_NAMESPACE_END
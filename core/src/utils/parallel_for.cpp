@@ -0,0 +1,41 @@
+#include <userver/utils/parallel_for.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/task/task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace {
+// More chunks than workers let the workers that got fast chunks help the
+// others
+constexpr std::size_t kChunksPerWorker = 4;
+
+std::size_t DivideRoundUp(std::size_t value, std::size_t divisor) {
+  return (value + divisor - 1) / divisor;
+}
+}  // namespace
+
+ParallelForPlan MakeParallelForPlan(engine::TaskProcessor& task_processor,
+                                    std::size_t size,
+                                    std::size_t min_chunk_size) {
+  ParallelForPlan plan;
+  if (size == 0) return plan;
+
+  const auto workers = std::max<std::size_t>(
+      engine::GetWorkerCount(task_processor), 1);
+  plan.chunk_size =
+      std::max({min_chunk_size, DivideRoundUp(size, workers * kChunksPerWorker),
+                std::size_t{1}});
+  plan.chunk_count = DivideRoundUp(size, plan.chunk_size);
+  plan.task_count = std::min(workers, plan.chunk_count);
+  plan.caller_participates =
+      &engine::current_task::GetTaskProcessor() == &task_processor;
+  return plan;
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#include <userver/utils/parallel_for.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST_MT(ParallelFor, AllElementsProcessedOnce, 4) {
+  std::vector<std::atomic<int>> processed(10000);
+  std::atomic<std::size_t> calls{0};
+
+  utils::ParallelFor(engine::current_task::GetTaskProcessor(), "test",
+                     processed.size(), 100,
+                     [&](std::size_t begin, std::size_t end) {
+                       EXPECT_LT(begin, end);
+                       EXPECT_LE(end, processed.size());
+                       for (auto i = begin; i < end; ++i) ++processed[i];
+                       ++calls;
+                     });
+
+  for (const auto& value : processed) ASSERT_EQ(value.load(), 1);
+  // 4 chunks per worker
+  EXPECT_EQ(calls.load(), 16);
+}
+
+UTEST_MT(ParallelFor, MinChunkSize, 4) {
+  std::atomic<std::size_t> calls{0};
+  utils::ParallelFor(engine::current_task::GetTaskProcessor(), "test", 1000,
+                     600, [&](std::size_t begin, std::size_t end) {
+                       EXPECT_TRUE(end - begin == 600 || end == 1000);
+                       ++calls;
+                     });
+  EXPECT_EQ(calls.load(), 2);
+}
+
+UTEST(ParallelFor, Empty) {
+  utils::ParallelFor(engine::current_task::GetTaskProcessor(), "test", 0, 1,
+                     [](std::size_t, std::size_t) { FAIL(); });
+}
+
+UTEST_MT(ParallelFor, Exception, 2) {
+  UEXPECT_THROW(
+      utils::ParallelFor(engine::current_task::GetTaskProcessor(), "test", 100,
+                         1,
+                         [](std::size_t begin, std::size_t) {
+                           if (begin == 42) throw std::runtime_error("test");
+                         }),
+      std::runtime_error);
+}
+
+UTEST_MT(ParallelMapReduce, Sum, 4) {
+  std::vector<std::int64_t> values(100000);
+  std::iota(values.begin(), values.end(), 0);
+
+  const auto sum = utils::ParallelMapReduce(
+      engine::current_task::GetTaskProcessor(), "test", values.size(), 1000,
+      std::int64_t{0},
+      [&](std::size_t begin, std::size_t end) {
+        return std::accumulate(values.begin() + begin, values.begin() + end,
+                               std::int64_t{0});
+      },
+      std::plus<>{});
+  EXPECT_EQ(sum, std::accumulate(values.begin(), values.end(),
+                                 std::int64_t{0}));
+}
+
+UTEST_MT(ParallelMapReduce, Order, 4) {
+  const auto concatenated = utils::ParallelMapReduce(
+      engine::current_task::GetTaskProcessor(), "test", 26, 1, std::string{},
+      [](std::size_t begin, std::size_t end) {
+        std::string result;
+        for (auto i = begin; i < end; ++i) result += static_cast<char>('a' + i);
+        return result;
+      },
+      [](std::string accumulated, std::string chunk) {
+        return accumulated + chunk;
+      });
+  EXPECT_EQ(concatenated, "abcdefghijklmnopqrstuvwxyz");
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,382 @@
+#include <userver/utils/periodic_scheduler.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include <engine/ev/timer_wheel.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/rand.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using engine::ev::TimerWheel;
+
+}  // namespace
+
+class PeriodicScheduler::Impl final {
+ public:
+  Impl(engine::TaskProcessor& task_processor,
+       std::chrono::milliseconds resolution);
+  ~Impl();
+
+  engine::TaskProcessor& GetTaskProcessor() const noexcept {
+    return task_processor_;
+  }
+
+  // Schedules the job to fire at `deadline`, `mutex` must be locked
+  void ScheduleLocked(impl::PeriodicJob& job, Clock::time_point deadline);
+
+  // Cancels the scheduled firing of the job, `mutex` must be locked
+  void CancelLocked(impl::PeriodicJob& job) noexcept;
+
+  static void OnExpired(TimerWheel::Entry& entry) noexcept;
+
+  // Protects the wheel and the scheduling state of all the jobs
+  std::mutex mutex;
+  std::atomic<std::size_t> jobs_count{0};
+
+ private:
+  void Run();
+
+  TimerWheel::Tick ToTick(Clock::time_point time_point) const noexcept;
+  Clock::time_point FromTick(TimerWheel::Tick tick) const noexcept;
+
+  engine::TaskProcessor& task_processor_;
+  const std::chrono::milliseconds resolution_;
+  const Clock::time_point epoch_;
+
+  TimerWheel wheel_;
+  std::size_t scheduled_count_{0};
+  // Intrusive list of the jobs that fired during the current Advance()
+  impl::PeriodicJob* fired_{nullptr};
+
+  engine::SingleConsumerEvent wake_event_;
+  engine::TaskWithResult<void> driver_;
+};
+
+namespace impl {
+
+class PeriodicJob final : public std::enable_shared_from_this<PeriodicJob> {
+ public:
+  using Settings = PeriodicScheduler::Settings;
+  using Flags = PeriodicScheduler::Flags;
+
+  PeriodicJob(PeriodicScheduler::Impl& scheduler, std::string name,
+              Settings settings, PeriodicScheduler::Callback callback)
+      : scheduler_(scheduler),
+        name_(std::move(name)),
+        callback_(std::move(callback)),
+        task_processor_(settings.task_processor
+                            ? *settings.task_processor
+                            : scheduler.GetTaskProcessor()),
+        settings_(std::move(settings)),
+        entry_(&PeriodicScheduler::Impl::OnExpired) {
+    entry_.data = this;
+  }
+
+  void Start() {
+    const auto settings = settings_.Read();
+    const auto now = Clock::now();
+
+    const std::lock_guard lock(scheduler_.mutex);
+    period_start_ = now;
+    scheduler_.ScheduleLocked(*this, (settings->flags & Flags::kNow)
+                                         ? now
+                                         : now + MutatePeriod(*settings));
+  }
+
+  void Stop() noexcept {
+    engine::TaskWithResult<void> task;
+    {
+      const std::lock_guard lock(task_mutex_);
+      if (is_stopped_.exchange(true)) return;
+      task = std::move(step_task_);
+    }
+    {
+      const std::lock_guard lock(scheduler_.mutex);
+      scheduler_.CancelLocked(*this);
+    }
+
+    try {
+      if (task.IsValid()) {
+        LOG_INFO() << "Stopping periodic job with name=" << name_;
+        task.SyncCancel();
+      }
+    } catch (const std::exception& e) {
+      LOG_ERROR() << "Exception while stopping periodic job with name="
+                  << name_ << ": " << e;
+    }
+    --scheduler_.jobs_count;
+  }
+
+  bool IsStopped() const noexcept { return is_stopped_.load(); }
+
+  void SetSettings(Settings settings) {
+    bool has_changed{};
+    {
+      auto writer = settings_.StartWrite();
+      settings.flags = writer->flags;
+      has_changed = settings.period != writer->period;
+      *writer = std::move(settings);
+      writer.Commit();
+    }
+    if (!has_changed) return;
+
+    // Like PeriodicTask, apply the new period to the awaited execution
+    const auto settings_ptr = settings_.Read();
+    const std::lock_guard lock(scheduler_.mutex);
+    if (is_stopped_ || is_step_running_ || !entry_.IsScheduled()) return;
+    scheduler_.ScheduleLocked(*this,
+                              period_start_ + MutatePeriod(*settings_ptr));
+  }
+
+  void ForceStepAsync() {
+    const std::lock_guard lock(scheduler_.mutex);
+    if (is_stopped_) return;
+    if (is_step_running_) {
+      should_force_step_ = true;
+    } else {
+      scheduler_.ScheduleLocked(*this, Clock::now());
+    }
+  }
+
+  // Called by the driver of the wheel after the job has fired
+  void SpawnStep() {
+    const std::lock_guard lock(task_mutex_);
+    if (is_stopped_) return;
+    step_task_ = engine::CriticalAsyncNoSpan(
+        task_processor_, [self = shared_from_this()] { self->RunStep(); });
+  }
+
+ private:
+  friend class PeriodicScheduler::Impl;
+
+  void RunStep() {
+    const auto before = Clock::now();
+    const bool no_exception = DoStep();
+
+    const auto settings = settings_.Read();
+    const std::lock_guard lock(scheduler_.mutex);
+    is_step_running_ = false;
+    if (is_stopped_) return;
+
+    has_failed_ = !no_exception;
+    const auto now = Clock::now();
+    period_start_ = (settings->flags & Flags::kStrong) ? before : now;
+    scheduler_.ScheduleLocked(*this, std::exchange(should_force_step_, false)
+                                         ? now
+                                         : period_start_ +
+                                               MutatePeriod(*settings));
+  }
+
+  bool DoStep() {
+    const auto settings = settings_.Read();
+    tracing::Span span(name_, tracing::ReferenceType::kChild,
+                       settings->span_level);
+    try {
+      callback_();
+      return true;
+    } catch (const std::exception& e) {
+      LOG_ERROR() << "Exception in periodic job with name=" << name_ << ": "
+                  << e;
+      return false;
+    }
+  }
+
+  // `mutex` of the scheduler must be locked
+  std::chrono::milliseconds MutatePeriod(const Settings& settings) {
+    auto period = settings.period;
+    if (has_failed_) period = settings.exception_period.value_or(period);
+    if (!(settings.flags & Flags::kChaotic)) return period;
+
+    return std::chrono::milliseconds{utils::RandRange(
+        (period - settings.distribution).count(),
+        (period + settings.distribution).count() + 1)};
+  }
+
+  PeriodicScheduler::Impl& scheduler_;
+  const std::string name_;
+  const PeriodicScheduler::Callback callback_;
+  engine::TaskProcessor& task_processor_;
+  rcu::Variable<Settings> settings_;
+
+  std::mutex task_mutex_;
+  std::atomic<bool> is_stopped_{false};
+  engine::TaskWithResult<void> step_task_;
+
+  // State guarded by the mutex of the scheduler
+  TimerWheel::Entry entry_;
+  Clock::time_point deadline_;
+  Clock::time_point period_start_;
+  bool is_step_running_{false};
+  PeriodicJob* next_fired_{nullptr};
+  bool has_failed_{false};
+  bool should_force_step_{false};
+};
+
+}  // namespace impl
+
+PeriodicScheduler::Impl::Impl(engine::TaskProcessor& task_processor,
+                              std::chrono::milliseconds resolution)
+    : task_processor_(task_processor),
+      resolution_(resolution),
+      epoch_(Clock::now()) {
+  UASSERT(resolution_.count() > 0);
+  driver_ = engine::CriticalAsyncNoSpan(task_processor_, [this] { Run(); });
+}
+
+PeriodicScheduler::Impl::~Impl() {
+  UASSERT_MSG(jobs_count == 0,
+              "All the jobs must be stopped before the PeriodicScheduler is "
+              "destroyed");
+  driver_.SyncCancel();
+}
+
+void PeriodicScheduler::Impl::ScheduleLocked(impl::PeriodicJob& job,
+                                             Clock::time_point deadline) {
+  job.deadline_ = deadline;
+  if (!job.entry_.IsScheduled() && scheduled_count_++ == 0) {
+    // The driver sleeps until the first job is scheduled
+    wake_event_.Send();
+  }
+  wheel_.Schedule(job.entry_, ToTick(deadline));
+}
+
+void PeriodicScheduler::Impl::CancelLocked(impl::PeriodicJob& job) noexcept {
+  if (!job.entry_.IsScheduled()) return;
+  wheel_.Cancel(job.entry_);
+  --scheduled_count_;
+}
+
+void PeriodicScheduler::Impl::OnExpired(TimerWheel::Entry& entry) noexcept {
+  auto& job = *static_cast<impl::PeriodicJob*>(entry.data);
+  auto& self = job.scheduler_;
+  --self.scheduled_count_;
+
+  if (Clock::now() < job.deadline_) {
+    // The deadline is further than the wheel covers
+    self.ScheduleLocked(job, job.deadline_);
+    return;
+  }
+
+  job.is_step_running_ = true;
+  job.next_fired_ = std::exchange(self.fired_, &job);
+}
+
+void PeriodicScheduler::Impl::Run() {
+  std::vector<std::shared_ptr<impl::PeriodicJob>> fired;
+
+  while (!engine::current_task::ShouldCancel()) {
+    bool is_empty = false;
+    TimerWheel::Tick next_tick = 0;
+    {
+      const std::lock_guard lock(mutex);
+      wheel_.Advance((Clock::now() - epoch_) / resolution_);
+      for (auto* job = std::exchange(fired_, nullptr); job;
+           job = std::exchange(job->next_fired_, nullptr)) {
+        // Stop() cancels the entry under the mutex before releasing the job
+        fired.push_back(job->shared_from_this());
+      }
+      is_empty = (scheduled_count_ == 0);
+      next_tick = wheel_.GetNextTick();
+    }
+
+    for (auto& job : fired) job->SpawnStep();
+    fired.clear();
+
+    if (is_empty) {
+      [[maybe_unused]] const bool is_woken_up = wake_event_.WaitForEvent();
+    } else {
+      [[maybe_unused]] const bool is_woken_up =
+          wake_event_.WaitForEventUntil(FromTick(next_tick));
+    }
+  }
+}
+
+TimerWheel::Tick PeriodicScheduler::Impl::ToTick(
+    Clock::time_point time_point) const noexcept {
+  if (time_point <= epoch_) return 0;
+  // Rounded up, so that a job never fires before its deadline
+  return (time_point - epoch_ + resolution_ - Clock::duration{1}) /
+         resolution_;
+}
+
+Clock::time_point PeriodicScheduler::Impl::FromTick(
+    TimerWheel::Tick tick) const noexcept {
+  return epoch_ + resolution_ * static_cast<std::int64_t>(tick);
+}
+
+PeriodicScheduler::Job::Job() noexcept = default;
+
+PeriodicScheduler::Job::Job(std::shared_ptr<impl::PeriodicJob> job) noexcept
+    : job_(std::move(job)) {}
+
+PeriodicScheduler::Job::Job(Job&&) noexcept = default;
+
+PeriodicScheduler::Job& PeriodicScheduler::Job::operator=(
+    Job&& other) noexcept {
+  if (this != &other) {
+    Stop();
+    job_ = std::move(other.job_);
+  }
+  return *this;
+}
+
+PeriodicScheduler::Job::~Job() { Stop(); }
+
+void PeriodicScheduler::Job::Stop() noexcept {
+  if (!job_) return;
+  job_->Stop();
+  job_.reset();
+}
+
+void PeriodicScheduler::Job::SetSettings(Settings settings) {
+  UASSERT(job_);
+  job_->SetSettings(std::move(settings));
+}
+
+void PeriodicScheduler::Job::ForceStepAsync() {
+  UASSERT(job_);
+  job_->ForceStepAsync();
+}
+
+bool PeriodicScheduler::Job::IsRunning() const noexcept {
+  return job_ && !job_->IsStopped();
+}
+
+PeriodicScheduler::PeriodicScheduler(engine::TaskProcessor& task_processor,
+                                     std::chrono::milliseconds resolution)
+    : impl_(std::make_unique<Impl>(task_processor, resolution)) {}
+
+PeriodicScheduler::~PeriodicScheduler() = default;
+
+PeriodicScheduler::Job PeriodicScheduler::Add(std::string name,
+                                              Settings settings,
+                                              Callback callback) {
+  UASSERT_MSG(!name.empty(), "Periodic job must have a name");
+  LOG_DEBUG() << "Adding periodic job with name=" << name;
+
+  auto job = std::make_shared<impl::PeriodicJob>(
+      *impl_, std::move(name), std::move(settings), std::move(callback));
+  ++impl_->jobs_count;
+  job->Start();
+  return Job{std::move(job)};
+}
+
+std::size_t PeriodicScheduler::GetJobsCount() const noexcept {
+  return impl_->jobs_count.load();
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,239 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/utils/periodic_scheduler.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/* Scheduler is dumb, but the life is short. */
+const auto kSlowRatio = 10;
+
+constexpr auto kResolution = 1ms;
+
+using Count = std::size_t;
+
+struct SimpleJobData final {
+  engine::Mutex mutex;
+  engine::ConditionVariable cv;
+  Count count = 0;
+  std::chrono::milliseconds sleep{0};
+  bool throw_exception = false;
+
+  auto GetJobFunction() {
+    return [this] { Run(); };
+  }
+
+  void Run() {
+    engine::SleepFor(sleep);
+    const std::unique_lock lock(mutex);
+    ++count;
+    cv.NotifyOne();
+
+    if (throw_exception) throw std::runtime_error("error_msg");
+  }
+
+  Count GetCount() const { return count; }
+
+  template <typename Duration, typename Pred>
+  auto WaitFor(Duration duration, Pred pred) {
+    std::unique_lock<engine::Mutex> lock(mutex);
+    return cv.WaitFor(lock, duration, pred);
+  }
+};
+
+}  // namespace
+
+UTEST(PeriodicScheduler, Noop) {
+  const utils::PeriodicScheduler scheduler(
+      engine::current_task::GetTaskProcessor());
+  EXPECT_EQ(scheduler.GetJobsCount(), 0);
+}
+
+UTEST(PeriodicScheduler, AddStop) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor());
+
+  auto job = scheduler.Add("job", 100ms, [] {});
+  EXPECT_TRUE(job.IsRunning());
+  EXPECT_EQ(scheduler.GetJobsCount(), 1);
+
+  job.Stop();
+  EXPECT_FALSE(job.IsRunning());
+  EXPECT_EQ(scheduler.GetJobsCount(), 0);
+
+  {
+    const auto other = scheduler.Add("job", 100ms, [] {});
+    EXPECT_EQ(scheduler.GetJobsCount(), 1);
+    // ~Job() should call Stop()
+  }
+  EXPECT_EQ(scheduler.GetJobsCount(), 0);
+}
+
+UTEST(PeriodicScheduler, MultipleRun) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor(),
+                                     kResolution);
+  SimpleJobData simple;
+
+  constexpr auto period = 3ms;
+  constexpr Count n = 10;
+
+  const auto start = std::chrono::steady_clock::now();
+  auto job = scheduler.Add("job", period, simple.GetJobFunction());
+  EXPECT_TRUE(simple.WaitFor(period * n * kSlowRatio,
+                             [&simple] { return simple.GetCount() > n; }));
+  const auto finish = std::chrono::steady_clock::now();
+
+  EXPECT_GE(finish - start, period * n);
+}
+
+UTEST(PeriodicScheduler, Strong) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor(),
+                                     kResolution);
+  SimpleJobData simple;
+
+  simple.sleep = 30ms;
+  constexpr auto period = 10ms;
+  constexpr Count n = 7;
+
+  const auto start = std::chrono::steady_clock::now();
+  auto job = scheduler.Add(
+      "job",
+      utils::PeriodicScheduler::Settings(
+          period, utils::PeriodicScheduler::Flags::kStrong),
+      simple.GetJobFunction());
+  EXPECT_TRUE(simple.WaitFor(simple.sleep * n * kSlowRatio,
+                             [&] { return simple.GetCount() > n; }));
+  const auto finish = std::chrono::steady_clock::now();
+
+  EXPECT_GE(finish - start, simple.sleep * n);
+}
+
+UTEST(PeriodicScheduler, NowAndNotNow) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor(),
+                                     kResolution);
+  SimpleJobData now;
+  SimpleJobData not_now;
+
+  constexpr auto timeout = 50ms;
+
+  auto now_job = scheduler.Add(
+      "now",
+      utils::PeriodicScheduler::Settings(utest::kMaxTestWaitTime,
+                                         utils::PeriodicScheduler::Flags::kNow),
+      now.GetJobFunction());
+  auto not_now_job =
+      scheduler.Add("not-now", utest::kMaxTestWaitTime,
+                    not_now.GetJobFunction());
+
+  EXPECT_TRUE(now.WaitFor(timeout, [&now] { return now.GetCount() > 0; }));
+  EXPECT_FALSE(
+      not_now.WaitFor(timeout, [&not_now] { return not_now.GetCount() > 0; }));
+}
+
+UTEST(PeriodicScheduler, ExceptionPeriod) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor(),
+                                     kResolution);
+  SimpleJobData simple;
+  simple.throw_exception = true;
+
+  utils::PeriodicScheduler::Settings settings(
+      utest::kMaxTestWaitTime, utils::PeriodicScheduler::Flags::kNow);
+  settings.exception_period = 10ms;
+
+  auto job = scheduler.Add("job", settings, simple.GetJobFunction());
+  EXPECT_TRUE(simple.WaitFor(utest::kMaxTestWaitTime,
+                             [&simple] { return simple.GetCount() > 2; }));
+}
+
+UTEST(PeriodicScheduler, SetSettings) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor(),
+                                     kResolution);
+  SimpleJobData simple;
+
+  auto job = scheduler.Add("job", utest::kMaxTestWaitTime,
+                           simple.GetJobFunction());
+  EXPECT_FALSE(
+      simple.WaitFor(20ms, [&simple] { return simple.GetCount() > 0; }));
+
+  // The awaited execution is rescheduled with the new period
+  job.SetSettings(10ms);
+  EXPECT_TRUE(simple.WaitFor(utest::kMaxTestWaitTime,
+                             [&simple] { return simple.GetCount() > 2; }));
+}
+
+UTEST(PeriodicScheduler, ForceStepAsync) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor(),
+                                     kResolution);
+  SimpleJobData simple;
+
+  auto job = scheduler.Add("job", utest::kMaxTestWaitTime,
+                           simple.GetJobFunction());
+  job.ForceStepAsync();
+  EXPECT_TRUE(simple.WaitFor(utest::kMaxTestWaitTime,
+                             [&simple] { return simple.GetCount() == 1; }));
+
+  job.ForceStepAsync();
+  EXPECT_TRUE(simple.WaitFor(utest::kMaxTestWaitTime,
+                             [&simple] { return simple.GetCount() == 2; }));
+}
+
+UTEST(PeriodicScheduler, StopCancelsRunningStep) {
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor(),
+                                     kResolution);
+  engine::SingleConsumerEvent started;
+  std::atomic<bool> was_cancelled{false};
+
+  auto job = scheduler.Add(
+      "job",
+      utils::PeriodicScheduler::Settings(
+          utest::kMaxTestWaitTime, utils::PeriodicScheduler::Flags::kNow),
+      [&] {
+        started.Send();
+        engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+        was_cancelled = engine::current_task::IsCancelRequested();
+      });
+
+  ASSERT_TRUE(started.WaitForEventFor(utest::kMaxTestWaitTime));
+  job.Stop();
+  EXPECT_TRUE(was_cancelled);
+}
+
+UTEST_MT(PeriodicScheduler, ManyJobs, 4) {
+  /// [PeriodicScheduler]
+  utils::PeriodicScheduler scheduler(engine::current_task::GetTaskProcessor());
+
+  constexpr std::size_t kJobs = 1000;
+  std::vector<std::atomic<Count>> counters(kJobs);
+
+  std::vector<utils::PeriodicScheduler::Job> jobs;
+  jobs.reserve(kJobs);
+  for (std::size_t i = 0; i < kJobs; ++i) {
+    jobs.push_back(scheduler.Add(
+        "job", utils::PeriodicScheduler::Settings(
+                   20ms, utils::PeriodicScheduler::Flags::kChaotic),
+        [&counter = counters[i]] { ++counter; }));
+  }
+  /// [PeriodicScheduler]
+
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  for (const auto& counter : counters) {
+    while (counter.load() < 2 && !deadline.IsReached()) engine::SleepFor(10ms);
+    EXPECT_GE(counter.load(), 2);
+  }
+
+  jobs.clear();
+  EXPECT_EQ(scheduler.GetJobsCount(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -7,6 +7,7 @@
 #endif
 
 #include <cmath>
+#include <functional>
 
 #include <userver/utils/statistics/impl/histogram_bucket.hpp>
 #include <userver/utils/statistics/writer.hpp>
@@ -135,11 +136,11 @@ Histogram& Histogram::operator=(const Histogram& other) {
 
 Histogram::~Histogram() = default;
 
-// NOLINTNEXTLINE(readability-make-member-function-const)
-void Histogram::Account(double value, std::uint64_t count) noexcept {
+std::size_t Histogram::FindBucketIndex(double value) const noexcept {
   if (bucket_count_ > kMaxBPlusBounds) {
-    impl::histogram::Account(buckets_.get(), value, count);
-    return;
+    const auto bounds = impl::histogram::Access::Bounds(GetView());
+    const auto iter = boost::upper_bound(bounds, value, std::less_equal<>{});
+    return iter == bounds.end() ? 0 : (iter - bounds.begin()) + 1;
   }
 
   std::size_t block_index = 0;
@@ -150,9 +151,12 @@ void Histogram::Account(double value, std::uint64_t count) noexcept {
   // block_index now points to a block in a hypothetical additional layer.
   const auto pre_bucket_index = block_index - kBlocksCount;
   // 0th bucket is the "infinity" bucket.
-  const auto bucket_index =
-      pre_bucket_index + 1 > bucket_count_ ? 0 : pre_bucket_index + 1;
-  auto& bucket = buckets_[bucket_index];
+  return pre_bucket_index + 1 > bucket_count_ ? 0 : pre_bucket_index + 1;
+}
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void Histogram::Account(double value, std::uint64_t count) noexcept {
+  auto& bucket = buckets_[FindBucketIndex(value)];
   bucket.counter.fetch_add(count, std::memory_order_relaxed);
 }
 
@@ -168,6 +172,22 @@ void DumpMetric(Writer& writer, const Histogram& histogram) {
   writer = histogram.GetView();
 }
 
+std::vector<double> MakeExponentialBounds(double first_bound, double factor,
+                                          std::size_t count) {
+  UINVARIANT(impl::histogram::IsBoundPositive(first_bound),
+             "Histogram bounds must be positive");
+  UINVARIANT(factor > 1, "Exponential histogram factor must be greater than 1");
+
+  std::vector<double> bounds;
+  bounds.reserve(count);
+  double bound = first_bound;
+  for (std::size_t i = 0; i < count; ++i) {
+    bounds.push_back(bound);
+    bound *= factor;
+  }
+  return bounds;
+}
+
 }  // namespace utils::statistics
 
 USERVER_NAMESPACE_END
@@ -1,4 +1,5 @@
 #include <userver/utils/statistics/histogram.hpp>
+#include <userver/utils/statistics/sharded_histogram.hpp>
 
 #include <benchmark/benchmark.h>
 #include <boost/range/irange.hpp>
@@ -35,4 +36,30 @@ void HistogramAccount(benchmark::State& state) {
 // poorly (fixed).
 BENCHMARK(HistogramAccount)->DenseRange(10, 50, 10);
 
+// All the threads write to the same histogram.
+template <typename HistogramType>
+void HistogramAccountContended(benchmark::State& state) {
+  static const auto kBounds =
+      utils::statistics::MakeExponentialBounds(1, 1.5, 30);
+  static HistogramType histogram{kBounds};
+
+  auto values_raw = std::vector<double>(1024);
+  for (auto& value : values_raw) {
+    value = utils::RandRange(0.0, kBounds.back());
+  }
+  const auto values = Launder(std::move(values_raw));
+
+  while (state.KeepRunningBatch(values.size())) {
+    for (const auto value : values) {
+      histogram.Account(value);
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(HistogramAccountContended, utils::statistics::Histogram)
+    ->ThreadRange(1, 16);
+BENCHMARK_TEMPLATE(HistogramAccountContended,
+                   utils::statistics::ShardedHistogram)
+    ->ThreadRange(1, 16);
+
 USERVER_NAMESPACE_END
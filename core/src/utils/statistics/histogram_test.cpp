@@ -193,6 +193,16 @@ UTEST(StatisticsHistogram, BucketNarrowing) {
   }
 }
 
+UTEST(StatisticsHistogram, ExponentialBounds) {
+  const auto bounds = utils::statistics::MakeExponentialBounds(0.5, 2, 4);
+  EXPECT_EQ(bounds, (std::vector<double>{0.5, 1, 2, 4}));
+
+  utils::statistics::Histogram histogram{bounds};
+  histogram.Account(3);
+  EXPECT_EQ(fmt::to_string(histogram.GetView()),
+            "[0.5]=0,[1]=0,[2]=0,[4]=1,[inf]=0");
+}
+
 UTEST_DEATH(StatisticsHistogramDeathTest, InvalidBuckets) {
   EXPECT_UINVARIANT_FAILURE_MSG(
       (utils::statistics::Histogram{std::vector<double>{10, 5, 3}}),
@@ -1,12 +1,15 @@
 #include <userver/utils/statistics/prometheus.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/overloaded.hpp>
 #include <userver/utils/statistics/fmt.hpp>
@@ -22,10 +25,40 @@ namespace {
 
 enum class Typed { kYes, kNo };
 
+// Prometheus names of the metric paths and of the label names. Both sets are
+// bounded by the code of the service, so the names are shared by all the
+// scrapes and each one is converted once per process, not once per series.
+struct InternedNames final {
+  struct Metric final {
+    std::string prometheus_name;
+    // Index of the metric in the scrape's 'TYPE line is written' flags
+    std::size_t id{0};
+  };
+
+  utils::impl::TransparentMap<std::string, Metric> metrics;
+  utils::impl::TransparentMap<std::string, std::string> labels;
+};
+
+rcu::Variable<InternedNames>& GetInternedNames() {
+  static rcu::Variable<InternedNames> names{rcu::DestructionType::kSync};
+  return names;
+}
+
+template <Typed IsTyped>
+std::atomic<std::size_t>& GetLastOutputSize() {
+  static std::atomic<std::size_t> size{0};
+  return size;
+}
+
 template <Typed IsTyped>
 class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
  public:
-  explicit FormatBuilder() = default;
+  FormatBuilder()
+      : names_(GetInternedNames().Read()),
+        type_written_(names_->metrics.size(), false) {
+    // The output of a scrape is usually about the size of the previous one
+    buf_.reserve(GetLastOutputSize<IsTyped>().load(std::memory_order_relaxed));
+  }
 
   void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
                     const MetricValue& value) override {
@@ -41,12 +74,26 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
   }
 
-  std::string Release() { return fmt::to_string(buf_); }
+  std::string Release() {
+    GetLastOutputSize<IsTyped>().store(buf_.size(), std::memory_order_relaxed);
+    InternNewNames();
+    return std::move(buf_);
+  }
 
  private:
   void DumpMetricNameAndType(std::string_view name, const MetricValue& value) {
+    if (const auto* const interned =
+            utils::impl::FindTransparentOrNullptr(names_->metrics, name)) {
+      if (!type_written_[interned->id]) {
+        type_written_[interned->id] = true;
+        DumpMetricType(interned->prometheus_name, value);
+      }
+      buf_.append(interned->prometheus_name);
+      return;
+    }
+
     if (const auto* const converted =
-            utils::impl::FindTransparentOrNullptr(metrics_, name)) {
+            utils::impl::FindTransparentOrNullptr(new_metrics_, name)) {
       buf_.append(*converted);
       return;
     }
@@ -54,7 +101,7 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
     auto prometheus_name = impl::ToPrometheusName(name);
     DumpMetricType(prometheus_name, value);
     buf_.append(prometheus_name);
-    metrics_.emplace(name, std::move(prometheus_name));
+    new_metrics_.emplace(name, std::move(prometheus_name));
   }
 
   void DumpMetricType([[maybe_unused]] std::string_view prometheus_name,
@@ -89,8 +136,8 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
       if (sep) {
         buf_.push_back(',');
       }
-      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""),
-                     impl::ToPrometheusLabel(label.Name()));
+      buf_.append(GetPrometheusLabel(label.Name()));
+      buf_.append("=\"");
       const auto& value = label.Value();
       std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_),
                         '"', '\'');
@@ -100,8 +147,42 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
     buf_.push_back('}');
   }
 
-  fmt::memory_buffer buf_;
-  utils::impl::TransparentMap<std::string, std::string> metrics_;
+  std::string_view GetPrometheusLabel(std::string_view name) {
+    if (const auto* const interned =
+            utils::impl::FindTransparentOrNullptr(names_->labels, name)) {
+      return *interned;
+    }
+    if (const auto* const converted =
+            utils::impl::FindTransparentOrNullptr(new_labels_, name)) {
+      return *converted;
+    }
+    return new_labels_.emplace(name, impl::ToPrometheusLabel(name))
+        .first->second;
+  }
+
+  void InternNewNames() {
+    if (new_metrics_.empty() && new_labels_.empty()) return;
+
+    auto names = GetInternedNames().StartWrite();
+    for (auto& [name, prometheus_name] : new_metrics_) {
+      const auto id = names->metrics.size();
+      names->metrics.try_emplace(
+          name, InternedNames::Metric{std::move(prometheus_name), id});
+    }
+    for (auto& [name, prometheus_label] : new_labels_) {
+      names->labels.try_emplace(name, std::move(prometheus_label));
+    }
+    names.Commit();
+  }
+
+  const rcu::ReadablePtr<InternedNames> names_;
+  std::vector<bool> type_written_;
+
+  // Names first seen by this scrape, interned in Release()
+  utils::impl::TransparentMap<std::string, std::string> new_metrics_;
+  utils::impl::TransparentMap<std::string, std::string> new_labels_;
+
+  std::string buf_;
 };
 
 }  // namespace
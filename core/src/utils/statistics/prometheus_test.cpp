@@ -409,6 +409,30 @@ child{application="processing"} 8
   }
 }
 
+UTEST(MetricsPrometheus, RepeatedScrapes) {
+  int value = 1;
+  utils::statistics::Storage statistics_storage;
+  auto statistics_holder = statistics_storage.RegisterWriter(
+      "repeated-scrapes", [&value](utils::statistics::Writer& writer) {
+        writer["requests"].ValueWithLabels(value, {"http.worker-id", "1"});
+        writer["requests"].ValueWithLabels(value * 2, {"http.worker-id", "2"});
+      });
+
+  // The second and the third scrapes use the names interned by the first one
+  for (; value <= 3; ++value) {
+    const auto expected =
+        "# TYPE repeated_scrapes_requests gauge\n"
+        "repeated_scrapes_requests{application=\"processing\","
+        "http_worker_id=\"1\"} " +
+        std::to_string(value) +
+        "\n"
+        "repeated_scrapes_requests{application=\"processing\","
+        "http_worker_id=\"2\"} " +
+        std::to_string(value * 2) + "\n";
+    TestToMetricsPrometheus(statistics_storage, expected);
+  }
+}
+
 }  // namespace utils::statistics::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,27 @@
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace impl {
+
+std::size_t AssignCounterShardIndex() noexcept {
+  static std::atomic<std::size_t> next_index{0};
+  return next_index.fetch_add(1, std::memory_order_relaxed) %
+         kCounterShardCount;
+}
+
+}  // namespace impl
+
+void DumpMetric(Writer& writer, const ShardedRateCounter& value) {
+  writer = value.Load();
+}
+
+void ResetMetric(ShardedRateCounter& value) { value.Store(Rate{0}); }
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,70 @@
+#include <userver/utils/statistics/sharded_counter.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+UTEST(ShardedRelaxedCounter, Basic) {
+  ShardedRelaxedCounter<int> counter;
+  EXPECT_EQ(counter.Load(), 0);
+
+  ++counter;
+  counter += 10;
+  counter--;
+  EXPECT_EQ(counter.Load(), 10);
+
+  counter = 5;
+  EXPECT_EQ(counter.Load(), 5);
+
+  const ShardedRelaxedCounter<int> copy = counter;
+  EXPECT_EQ(static_cast<int>(copy), 5);
+}
+
+UTEST(ShardedRateCounter, Basic) {
+  ShardedRateCounter counter{Rate{10}};
+  counter++;
+  counter += Rate{10};
+  counter.Add(Rate{9});
+  EXPECT_EQ(counter.Load(), Rate{30});
+}
+
+UTEST(ShardedRateCounter, DumpMetric) {
+  Storage storage;
+  ShardedRateCounter rate_counter{Rate{10}};
+  const auto rate_counter_scope = storage.RegisterWriter(
+      "test", [&rate_counter](Writer& writer) { writer = rate_counter; });
+
+  EXPECT_EQ(Snapshot{storage}.SingleMetric("test").AsRate(), 10);
+
+  ResetMetric(rate_counter);
+  EXPECT_EQ(Snapshot{storage}.SingleMetric("test").AsRate(), 0);
+}
+
+UTEST_MT(ShardedRateCounter, Concurrent, 4) {
+  constexpr std::size_t kTaskCount = 4;
+  constexpr std::size_t kIterations = 10000;
+  ShardedRateCounter counter;
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTaskCount);
+  for (std::size_t i = 0; i < kTaskCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&counter] {
+      for (std::size_t j = 0; j < kIterations; ++j) ++counter;
+    }));
+  }
+  engine::GetAll(tasks);
+
+  EXPECT_EQ(counter.Load(), Rate{kTaskCount * kIterations});
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#include <userver/utils/statistics/sharded_histogram.hpp>
+
+#include <vector>
+
+#include <userver/utils/statistics/impl/histogram_bucket.hpp>
+#include <userver/utils/statistics/sharded_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <utils/statistics/impl/histogram_view_utils.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+
+namespace {
+
+using impl::histogram::Bucket;
+
+// The shards are separated by at least a cache line, so that the buckets of
+// different shards never share one.
+constexpr std::size_t kPaddingBuckets =
+    (impl::kCounterShardAlignment + sizeof(Bucket) - 1) / sizeof(Bucket);
+
+}  // namespace
+
+ShardedHistogram::ShardedHistogram(utils::span<const double> upper_bounds)
+    : lookup_(upper_bounds),
+      buckets_(std::make_unique<Bucket[]>(
+          kPaddingBuckets + impl::kCounterShardCount *
+                                (upper_bounds.size() + 1 + kPaddingBuckets))),
+      shard_stride_(upper_bounds.size() + 1 + kPaddingBuckets) {
+  for (std::size_t i = 0; i < impl::kCounterShardCount; ++i) {
+    impl::histogram::CopyBounds(GetShard(i), upper_bounds);
+  }
+}
+
+ShardedHistogram::ShardedHistogram(ShardedHistogram&&) noexcept = default;
+
+ShardedHistogram& ShardedHistogram::operator=(ShardedHistogram&&) noexcept =
+    default;
+
+ShardedHistogram::~ShardedHistogram() = default;
+
+// NOLINTNEXTLINE(readability-make-member-function-const)
+void ShardedHistogram::Account(double value, std::uint64_t count) noexcept {
+  auto* shard = GetShard(impl::GetCounterShardIndex());
+  shard[lookup_.FindBucketIndex(value)].counter.fetch_add(
+      count, std::memory_order_relaxed);
+}
+
+HistogramAggregator ShardedHistogram::Collect() const {
+  const auto bounds = impl::histogram::Access::Bounds(lookup_.GetView());
+  const std::vector<double> upper_bounds(bounds.begin(), bounds.end());
+
+  HistogramAggregator result{upper_bounds};
+  for (std::size_t i = 0; i < impl::kCounterShardCount; ++i) {
+    result.Add(impl::histogram::MakeView(GetShard(i)));
+  }
+  return result;
+}
+
+void ResetMetric(ShardedHistogram& histogram) noexcept {
+  for (std::size_t i = 0; i < impl::kCounterShardCount; ++i) {
+    impl::histogram::ResetMetric(histogram.GetShard(i));
+  }
+}
+
+Bucket* ShardedHistogram::GetShard(std::size_t index) const noexcept {
+  return buckets_.get() + kPaddingBuckets + index * shard_stride_;
+}
+
+void DumpMetric(Writer& writer, const ShardedHistogram& histogram) {
+  const auto aggregated = histogram.Collect();
+  writer = aggregated.GetView();
+}
+
+}  // namespace utils::statistics
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,74 @@
+#include <userver/utils/statistics/sharded_histogram.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/get_all.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/fmt.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/testing.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+auto Bounds() { return std::vector<double>{1.5, 5, 42, 60}; }
+
+}  // namespace
+
+UTEST(StatisticsShardedHistogram, Account) {
+  utils::statistics::ShardedHistogram histogram{Bounds()};
+  histogram.Account(10);
+  histogram.Account(1.2);
+  histogram.Account(1.8);
+  histogram.Account(100);
+  histogram.Account(30, 4);
+
+  const auto collected = histogram.Collect();
+  EXPECT_EQ(fmt::to_string(collected.GetView()),
+            "[1.5]=1,[5]=1,[42]=5,[60]=0,[inf]=1");
+}
+
+UTEST(StatisticsShardedHistogram, Reset) {
+  utils::statistics::ShardedHistogram histogram{Bounds()};
+  histogram.Account(10);
+  ResetMetric(histogram);
+
+  const auto collected = histogram.Collect();
+  EXPECT_EQ(collected.GetView().GetTotalCount(), 0);
+}
+
+UTEST(StatisticsShardedHistogram, DumpMetric) {
+  utils::statistics::Storage storage;
+  utils::statistics::ShardedHistogram histogram{Bounds()};
+  histogram.Account(10, 3);
+  const auto entry = storage.RegisterWriter(
+      "test", [&](utils::statistics::Writer& writer) { writer = histogram; });
+
+  const utils::statistics::Snapshot snapshot{storage};
+  const auto view = snapshot.SingleMetric("test").AsHistogram();
+  EXPECT_EQ(view.GetBucketCount(), 4);
+  EXPECT_EQ(view.GetValueAt(2), 3);
+}
+
+UTEST_MT(StatisticsShardedHistogram, Concurrent, 4) {
+  constexpr std::size_t kTaskCount = 4;
+  constexpr std::size_t kIterations = 10000;
+  utils::statistics::ShardedHistogram histogram{Bounds()};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(kTaskCount);
+  for (std::size_t i = 0; i < kTaskCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&histogram] {
+      for (std::size_t j = 0; j < kIterations; ++j) histogram.Account(3);
+    }));
+  }
+  engine::GetAll(tasks);
+
+  const auto collected = histogram.Collect();
+  EXPECT_EQ(collected.GetView().GetValueAt(1), kTaskCount * kIterations);
+  EXPECT_EQ(collected.GetView().GetTotalCount(), kTaskCount * kIterations);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,41 @@
+#pragma once
+
+/// @file userver/ugrpc/byte_buffer_utils.hpp
+/// @brief Utilities for the raw gRPC payloads of the generic calls
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/message.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+/// @brief Serializes the message into a new buffer
+/// @throws std::runtime_error if the message can not be serialized
+grpc::ByteBuffer SerializeToByteBuffer(
+    const google::protobuf::Message& message);
+
+/// @brief Parses the message from the buffer, the buffer is not changed
+/// @returns `false` if the buffer does not hold a valid message
+[[nodiscard]] bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer,
+                                       google::protobuf::Message& message);
+
+/// @brief Returns the slices of the buffer
+/// @note The slices share the memory with the buffer, no bytes are copied
+std::vector<grpc::Slice> GetSlices(const grpc::ByteBuffer& buffer);
+
+/// @brief Copies at most `max_size` first bytes of the buffer, e.g. to inspect
+/// the header of a message without parsing all of it
+std::string CopyPrefix(const grpc::ByteBuffer& buffer, std::size_t max_size);
+
+/// @brief Copies all the bytes of the buffer
+std::string CopyToString(const grpc::ByteBuffer& buffer);
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
@@ -14,12 +14,14 @@
 #include <userver/logging/level.hpp>
 #include <userver/storages/secdist/secdist.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/utils/statistics/entry.hpp>
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -48,6 +50,13 @@ struct ClientFactorySettings final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Each call goes to the channel with the fewest active calls. If not 0,
+  /// the calls go to the first channel with less active calls than that
+  /// instead, so the pool grows up to `channel_count` channels under load.
+  /// Should be a bit less than the HTTP/2 MAX_CONCURRENT_STREAMS of the
+  /// servers.
+  std::size_t max_active_calls_per_channel{0};
 };
 
 /// @brief Creates generated gRPC clients. Has a minimal built-in channel cache:
@@ -62,6 +71,15 @@ class ClientFactory final {
                 testsuite::GrpcControl& testsuite_grpc,
                 dynamic_config::Source source);
 
+  /// The calls of the clients are spread over the `queues`
+  ClientFactory(ClientFactorySettings&& settings,
+                engine::TaskProcessor& channel_task_processor,
+                MiddlewareFactories mws,
+                const ugrpc::impl::CompletionQueues& queues,
+                utils::statistics::Storage& statistics_storage,
+                testsuite::GrpcControl& testsuite_grpc,
+                dynamic_config::Source source);
+
   template <typename Client>
   Client MakeClient(const std::string& client_name,
                     const std::string& endpoint);
@@ -70,15 +88,19 @@ class ClientFactory final {
   impl::ChannelCache::Token GetChannel(const std::string& client_name,
                                        const std::string& endpoint);
 
+  void WriteStatistics(utils::statistics::Writer& writer);
+
   engine::TaskProcessor& channel_task_processor_;
   MiddlewareFactories mws_;
-  grpc::CompletionQueue& queue_;
+  const ugrpc::impl::CompletionQueues queues_;
+  const std::size_t max_active_calls_per_channel_;
   impl::ChannelCache channel_cache_;
   std::unordered_map<std::string, std::unique_ptr<impl::ChannelCache>>
       client_channel_cache_;
   ugrpc::impl::StatisticsStorage client_statistics_storage_;
   const dynamic_config::Source config_source_;
   testsuite::GrpcControl& testsuite_grpc_;
+  utils::statistics::Entry statistics_holder_;
 };
 
 template <typename Client>
@@ -93,8 +115,9 @@ Client ClientFactory::MakeClient(const std::string& client_name,
     mws.push_back(mw_factory->GetMiddleware(client_name));
 
   return Client(impl::ClientParams{
-      client_name, std::move(mws), queue_, statistics,
-      GetChannel(client_name, endpoint), config_source_, testsuite_grpc_});
+      client_name, std::move(mws), queues_, statistics,
+      GetChannel(client_name, endpoint), max_active_calls_per_channel_,
+      config_source_, testsuite_grpc_});
 }
 
 }  // namespace ugrpc::client
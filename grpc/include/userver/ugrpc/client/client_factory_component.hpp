@@ -4,6 +4,7 @@
 /// @brief @copybrief ugrpc::client::ClientFactoryComponent
 
 #include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
 
 #include <userver/ugrpc/client/client_factory.hpp>
 #include <userver/ugrpc/client/queue_holder.hpp>
@@ -47,6 +48,8 @@ namespace ugrpc::client {
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
 /// channel-count | Number of underlying grpc::Channel objects | 1
+/// max-active-calls-per-channel | Number of active calls after which the next channel is used, 0 to pick the least loaded channel | 0
+/// completion-queue-count | Number of completion queues if there is no ugrpc::server::ServerComponent | 1
 /// middlewares | middlewares names to use | []
 ///
 ///
@@ -70,6 +73,7 @@ class ClientFactoryComponent final : public components::LoggableComponentBase {
  private:
   std::optional<QueueHolder> queue_;
   std::optional<ClientFactory> factory_;
+  utils::statistics::Entry queues_statistics_holder_;
 };
 
 }  // namespace ugrpc::client
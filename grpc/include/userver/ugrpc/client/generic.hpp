@@ -0,0 +1,72 @@
+#pragma once
+
+/// @file userver/ugrpc/client/generic.hpp
+/// @brief @copybrief ugrpc::client::GenericClient
+
+#include <memory>
+#include <string_view>
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include <userver/ugrpc/client/impl/client_data.hpp>
+#include <userver/ugrpc/client/qos.hpp>
+#include <userver/ugrpc/client/rpc.hpp>
+#include <userver/ugrpc/impl/static_metadata.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief A client that calls any method of any service, the messages are
+/// passed as raw payloads without parsing. Useful for proxies and caches.
+///
+/// Created by ClientFactory::MakeClient as the code-generated clients are.
+/// `call_name` is the full name of the method, e.g.
+/// `sample.ugrpc.UnitTestService/SayHello`. The messages can be made and
+/// parsed with the utilities from userver/ugrpc/byte_buffer_utils.hpp.
+///
+/// The static config QOS of the code-generated clients does not apply here,
+/// only the `qos` of the call. The statistics of all the calls are written as
+/// of a single `Generic/Call` method.
+class GenericClient final {
+ public:
+  using UnaryCall = client::UnaryCall<grpc::ByteBuffer>;
+  using StreamCall =
+      client::BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>;
+
+  /// @brief Starts a single request -> single response call
+  UnaryCall Unary(std::string_view call_name, const grpc::ByteBuffer& request,
+                  std::unique_ptr<grpc::ClientContext> context =
+                      std::make_unique<grpc::ClientContext>(),
+                  const Qos& qos = {}) const;
+
+  /// @brief Starts a call of a method of any kind, the server gets the
+  /// messages written before `WritesDone` as the request stream
+  StreamCall Stream(std::string_view call_name,
+                    std::unique_ptr<grpc::ClientContext> context =
+                        std::make_unique<grpc::ClientContext>(),
+                    const Qos& qos = {}) const;
+
+  /// @cond
+  // For internal use only
+  explicit GenericClient(impl::ClientParams&& client_params);
+
+  // For internal use only
+  static ugrpc::impl::StaticServiceMetadata GetMetadata();
+  /// @endcond
+
+ private:
+  template <typename Client>
+  friend impl::ClientData& impl::GetClientData(Client& client);
+
+  impl::CallParams CreateCallParams(std::string_view call_name,
+                                    std::unique_ptr<grpc::ClientContext>,
+                                    const Qos& qos) const;
+
+  impl::ClientData impl_;
+};
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
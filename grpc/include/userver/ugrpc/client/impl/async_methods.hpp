@@ -16,6 +16,8 @@
 #include <userver/tracing/in_place_span.hpp>
 #include <userver/tracing/span.hpp>
 
+#include <userver/utils/span.hpp>
+
 #include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/client/impl/async_method_invocation.hpp>
 #include <userver/ugrpc/client/impl/call_params.hpp>
@@ -156,6 +158,7 @@ class RpcData final {
  private:
   std::unique_ptr<grpc::ClientContext> context_;
   std::string client_name_;
+  std::string generic_call_name_;
   std::string_view call_name_;
   bool writes_finished_{false};
   bool is_finished_{false};
@@ -166,6 +169,7 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  ChannelCache::ActiveCall active_call_;
 
   // This data is common for all types of grpc calls - unary and streaming
   // However, in unary call the call is finished as soon as grpc core
@@ -276,6 +280,20 @@ bool Write(GrpcStream& stream, const Request& request,
   return result == impl::AsyncMethodInvocation::WaitStatus::kOk;
 }
 
+// gRPC allows a single write in flight, so the messages are still written one
+// by one. All of them but the last one are buffered, the batch goes to the
+// wire at once.
+template <typename GrpcStream, typename Request>
+bool WriteBatch(GrpcStream& stream, utils::span<const Request> requests,
+                RpcData& data) {
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    grpc::WriteOptions write_options{};
+    if (i + 1 != requests.size()) write_options.set_buffer_hint();
+    if (!Write(stream, requests[i], write_options, data)) return false;
+  }
+  return true;
+}
+
 void PrepareWriteAndCheck(RpcData& data);
 
 template <typename GrpcStream, typename Request>
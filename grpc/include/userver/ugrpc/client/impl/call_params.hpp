@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <string_view>
 
 #include <grpcpp/client_context.h>
@@ -24,6 +25,9 @@ struct CallParams {
   std::unique_ptr<grpc::ClientContext> context;
   ugrpc::impl::MethodStatistics& statistics;
   const Middlewares& mws;
+  ChannelCache::ActiveCall active_call;
+  // Owns the name of a generic call, `call_name` is empty then
+  std::string generic_call_name{};
 };
 
 CallParams DoCreateCallParams(const ClientData&, std::size_t method_id,
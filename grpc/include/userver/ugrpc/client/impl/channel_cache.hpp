@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -15,6 +16,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace utils::statistics {
+class Writer;
+}  // namespace utils::statistics
+
 namespace ugrpc::client::impl {
 
 class ChannelCache final {
@@ -26,11 +31,16 @@ class ChannelCache final {
   ~ChannelCache();
 
   class Token;
+  class ActiveCall;
 
   // The grpc::Channel is kept in cache as long as some Token pointing to it is
   // alive.
   Token Get(const std::string& endpoint);
 
+  /// Writes the active calls of each channel
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ChannelCache& cache);
+
  private:
   struct CountedChannel final {
     CountedChannel(const std::string& endpoint,
@@ -39,6 +49,8 @@ class ChannelCache final {
                    std::size_t count);
 
     utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+    // The calls in flight on each channel, shared by all the clients
+    utils::FixedArray<std::atomic<std::uint64_t>> active_calls;
     std::uint64_t counter{0};
   };
 
@@ -67,12 +79,35 @@ class ChannelCache::Token final {
   const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const
       noexcept;
 
+  // Picks the channel with the fewest active calls. If `max_active_calls` is
+  // not 0, picks the first channel with less active calls than that instead,
+  // so the channels past it are not connected until the load requires them.
+  ActiveCall StartCall(std::size_t max_active_calls) const noexcept;
+
  private:
   ChannelCache* cache_{nullptr};
   const std::string* endpoint_{nullptr};
   CountedChannel* counted_channel_{nullptr};
 };
 
+// Accounts a call on a channel while alive
+class ChannelCache::ActiveCall final {
+ public:
+  ActiveCall() noexcept = default;
+  ActiveCall(std::size_t channel_index,
+             std::atomic<std::uint64_t>& active_calls) noexcept;
+
+  ActiveCall(ActiveCall&&) noexcept;
+  ActiveCall& operator=(ActiveCall&&) noexcept;
+  ~ActiveCall();
+
+  std::size_t GetChannelIndex() const noexcept { return channel_index_; }
+
+ private:
+  std::size_t channel_index_{0};
+  std::atomic<std::uint64_t>* active_calls_{nullptr};
+};
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
@@ -11,8 +11,10 @@
 #include <userver/testsuite/grpc_control.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
 #include <userver/utils/rand.hpp>
 
@@ -23,9 +25,10 @@ namespace ugrpc::client::impl {
 struct ClientParams final {
   std::string client_name;
   Middlewares mws;
-  grpc::CompletionQueue& queue;
+  ugrpc::impl::CompletionQueues queues;
   ugrpc::impl::ServiceStatistics& statistics_storage;
   impl::ChannelCache::Token channel_token;
+  std::size_t max_active_calls_per_channel;
   const dynamic_config::Source config_source;
   testsuite::GrpcControl& testsuite_grpc;
 };
@@ -56,13 +59,24 @@ class ClientData final {
   ClientData(const ClientData&) = delete;
   ClientData& operator=(const ClientData&) = delete;
 
+  /// Picks the channel for the next call
+  ChannelCache::ActiveCall StartCall() const noexcept {
+    return params_.channel_token.StartCall(
+        params_.max_active_calls_per_channel);
+  }
+
   template <typename Service>
-  Stub<Service>& NextStub() const {
-    return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+  Stub<Service>& GetStub(std::size_t channel_index) const {
+    UASSERT(channel_index < stubs_.size());
+    return *static_cast<Stub<Service>*>(stubs_[channel_index].get());
   }
 
-  grpc::CompletionQueue& GetQueue() const { return params_.queue; }
+  /// @returns the queue for the next call
+  grpc::CompletionQueue& GetQueue() const {
+    const auto& queues = params_.queues.queues;
+    if (queues.size() == 1) return *queues[0];
+    return *queues[utils::RandRange(queues.size())];
+  }
 
   dynamic_config::Snapshot GetConfigSnapshot() const {
     return params_.config_source.GetSnapshot();
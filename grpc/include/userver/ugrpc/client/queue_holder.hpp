@@ -3,28 +3,38 @@
 /// @file userver/ugrpc/client/queue_holder.hpp
 /// @brief @copybrief ugrpc::client::QueueHolder
 
+#include <cstddef>
+
 #include <grpcpp/completion_queue.h>
 
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
-/// @brief Manages a gRPC completion queue, usable only in clients
+/// @brief Manages gRPC completion queues, usable only in clients
+///
+/// Each queue is processed by its own thread, the calls are spread over the
+/// queues.
 class QueueHolder final {
  public:
   QueueHolder();
+  explicit QueueHolder(std::size_t queue_count);
 
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
   ~QueueHolder();
 
+  /// @returns the first queue
   grpc::CompletionQueue& GetQueue();
 
+  const ugrpc::impl::CompletionQueues& GetQueues() const;
+
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 176, 16> impl_;
+  utils::FastPimpl<Impl, 72, 8> impl_;
 };
 
 }  // namespace ugrpc::client
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -15,6 +16,7 @@
 #include <userver/engine/future_status.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/function_ref.hpp>
+#include <userver/utils/span.hpp>
 
 #include <userver/ugrpc/client/exceptions.hpp>
 #include <userver/ugrpc/client/impl/async_methods.hpp>
@@ -260,6 +262,15 @@ class [[nodiscard]] OutputStream final : public CallAnyBase {
   ///         and the error details can be fetched from Finish
   [[nodiscard]] bool Write(const Request& request);
 
+  /// @brief Write several outgoing messages at once
+  ///
+  /// The messages are buffered and sent to the wire together, which is
+  /// cheaper than a `Write` per message for the streams of small messages.
+  ///
+  /// @param requests the next messages to write
+  /// @return the same as `Write`
+  [[nodiscard]] bool WriteBatch(utils::span<const Request> requests);
+
   /// @brief Write the next outgoing message and check result
   ///
   /// `WriteAndCheck` doesn't store any references to `request`, so it can be
@@ -311,7 +322,7 @@ class [[nodiscard]] OutputStream final : public CallAnyBase {
 ///
 ///   - `GetContext`;
 ///   - one of (`Read`, `ReadAsync`);
-///   - one of (`Write`, `WritesDone`).
+///   - one of (`Write`, `WriteBatch`, `WritesDone`).
 ///
 /// `WriteAndCheck` is NOT thread-safe.
 ///
@@ -388,6 +399,15 @@ class [[nodiscard]] BidirectionalStream final : public CallAnyBase {
   ///         but Read may still have some data and status code available
   [[nodiscard]] bool Write(const Request& request);
 
+  /// @brief Write several outgoing messages at once
+  ///
+  /// The messages are buffered and sent to the wire together, which is
+  /// cheaper than a `Write` per message for the streams of small messages.
+  ///
+  /// @param requests the next messages to write
+  /// @return the same as `Write`
+  [[nodiscard]] bool WriteBatch(utils::span<const Request> requests);
+
   /// @brief Write the next outgoing message and check result
   ///
   /// `WriteAndCheck` doesn't store any references to `request`, so it can be
@@ -434,6 +454,16 @@ namespace impl {
 void CallMiddlewares(const Middlewares& mws, CallAnyBase& call,
                      utils::function_ref<void()> user_call,
                      const ::google::protobuf::Message* request);
+
+// The raw payloads of the generic calls are not shown to the middlewares
+template <typename Request>
+const ::google::protobuf::Message* ToMiddlewareRequest(const Request& request) {
+  if constexpr (std::is_base_of_v<::google::protobuf::Message, Request>) {
+    return &request;
+  } else {
+    return nullptr;
+  }
+}
 }  // namespace impl
 
 template <typename RPC>
@@ -505,7 +535,7 @@ UnaryCall<Response>::UnaryCall(
                                        &GetData().GetQueue());
         reader_->StartCall();
       },
-      &req);
+      impl::ToMiddlewareRequest(req));
   GetData().SetWritesFinished();
 }
 
@@ -586,6 +616,12 @@ bool OutputStream<Request, Response>::Write(const Request& request) {
   return impl::Write(*stream_, request, write_options, GetData());
 }
 
+template <typename Request, typename Response>
+bool OutputStream<Request, Response>::WriteBatch(
+    utils::span<const Request> requests) {
+  return impl::WriteBatch(*stream_, requests, GetData());
+}
+
 template <typename Request, typename Response>
 void OutputStream<Request, Response>::WriteAndCheck(const Request& request) {
   // Don't buffer writes, otherwise in an event subscription scenario, events
@@ -648,6 +684,12 @@ bool BidirectionalStream<Request, Response>::Write(const Request& request) {
   return impl::Write(*stream_, request, write_options, GetData());
 }
 
+template <typename Request, typename Response>
+bool BidirectionalStream<Request, Response>::WriteBatch(
+    utils::span<const Request> requests) {
+  return impl::WriteBatch(*stream_, requests, GetData());
+}
+
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::WriteAndCheck(
     const Request& request) {
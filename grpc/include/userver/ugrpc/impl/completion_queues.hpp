@@ -6,12 +6,24 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace utils::statistics {
+class Writer;
+}  // namespace utils::statistics
+
 namespace ugrpc::impl {
 
+class QueueRunner;
+
 struct CompletionQueues final {
   std::vector<grpc::CompletionQueue*> queues;
+  /// The threads processing `queues`, in the same order
+  std::vector<const QueueRunner*> runners;
 };
 
+/// Writes the completions processed by each queue
+void DumpMetric(utils::statistics::Writer& writer,
+                const CompletionQueues& queues);
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
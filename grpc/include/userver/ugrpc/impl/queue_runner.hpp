@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+
 #include <grpcpp/completion_queue.h>
 
 #include <userver/engine/single_use_event.hpp>
@@ -13,9 +16,13 @@ class QueueRunner final {
   explicit QueueRunner(grpc::CompletionQueue& queue);
   ~QueueRunner();
 
+  /// Number of the completions handed to the coroutine engine so far
+  std::uint64_t GetProcessedEvents() const noexcept;
+
  private:
   grpc::CompletionQueue& queue_;
   engine::SingleUseEvent completion_;
+  std::atomic<std::uint64_t> processed_events_{0};
 };
 
 }  // namespace ugrpc::impl
@@ -0,0 +1,44 @@
+#pragma once
+
+/// @file userver/ugrpc/server/generic_service_base.hpp
+/// @brief @copybrief ugrpc::server::GenericServiceBase
+
+#include <grpcpp/support/byte_buffer.h>
+
+#include <userver/ugrpc/server/rpc.hpp>
+#include <userver/ugrpc/server/service_base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+/// @brief A call of any method, the messages are passed as raw payloads
+///
+/// Unary and streaming calls all look like a bidirectional stream: a unary
+/// call reads a single request and finishes with `WriteAndFinish`.
+using GenericCall = BidirectionalStream<grpc::ByteBuffer, grpc::ByteBuffer>;
+
+/// @brief The base class for a service that handles the calls of all the
+/// methods not handled by the other services of the server, without parsing
+/// the messages. Useful for proxies and caches.
+///
+/// `GetCallName` of the call returns the full name of the method, e.g.
+/// `sample.ugrpc.UnitTestService/SayHello`. The messages can be parsed lazily
+/// with the utilities from userver/ugrpc/byte_buffer_utils.hpp.
+///
+/// The statistics of all the calls are written as of a single `Generic/Call`
+/// method. A server can have at most one generic service.
+class GenericServiceBase : public ServiceBase {
+ public:
+  /// Handles a call of any method. The handler must finish the call
+  virtual void Handle(GenericCall& call) = 0;
+
+  /// @cond
+  std::unique_ptr<impl::ServiceWorker> MakeWorker(
+      impl::ServiceSettings&& settings) final;
+  /// @endcond
+};
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
@@ -8,6 +8,8 @@
 #include <grpcpp/impl/codegen/async_unary_call.h>
 #include <grpcpp/impl/codegen/status.h>
 
+#include <userver/utils/span.hpp>
+
 #include <userver/ugrpc/server/exceptions.hpp>
 #include <userver/ugrpc/server/impl/async_method_invocation.hpp>
 
@@ -104,6 +106,19 @@ void Write(GrpcStream& stream, const Response& response,
   ThrowOnError(Wait(write), call_name, "Write");
 }
 
+// gRPC allows a single write in flight, so the messages are still written one
+// by one. All of them but the last one are buffered, the batch goes to the
+// wire at once.
+template <typename GrpcStream, typename Response>
+void WriteBatch(GrpcStream& stream, utils::span<const Response> responses,
+                std::string_view call_name) {
+  for (std::size_t i = 0; i < responses.size(); ++i) {
+    grpc::WriteOptions write_options{};
+    if (i + 1 != responses.size()) write_options.set_buffer_hint();
+    Write(stream, responses[i], write_options, call_name);
+  }
+}
+
 template <typename GrpcStream, typename Response>
 void WriteAndFinish(GrpcStream& stream, const Response& response,
                     grpc::WriteOptions options, const grpc::Status& status,
@@ -31,7 +31,7 @@ class QueueHolder final {
 
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 48, 8> impl_;
+  utils::FastPimpl<Impl, 72, 8> impl_;
 };
 
 }  // namespace ugrpc::server::impl
@@ -7,6 +7,7 @@
 
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
+#include <grpcpp/server_builder.h>
 
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
@@ -43,8 +44,8 @@ class ServiceWorker {
   ServiceWorker& operator=(ServiceWorker&&) = delete;
   virtual ~ServiceWorker();
 
-  /// Get the grpcpp service for registration in the `ServerBuilder`
-  virtual grpc::Service& GetService() = 0;
+  /// Register the grpcpp service in the `ServerBuilder`
+  virtual void Register(grpc::ServerBuilder& builder) = 0;
 
   /// Get the static per-gRPC-service metadata provided by codegen
   virtual const ugrpc::impl::StaticServiceMetadata& GetMetadata() const = 0;
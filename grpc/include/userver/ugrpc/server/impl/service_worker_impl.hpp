@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <exception>
 #include <functional>
 #include <string>
@@ -8,6 +9,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -55,6 +57,28 @@ void ReportCustomError(
 void SetupSpan(std::optional<tracing::InPlaceSpan>& span_holder,
                grpc::ServerContext& context, std::string_view call_name);
 
+// The first block of a call arena is a part of the call data, so the small
+// messages do not allocate at all
+inline constexpr std::size_t kArenaInitialBlockSize = 512;
+
+inline google::protobuf::ArenaOptions MakeArenaOptions(char* initial_block) {
+  google::protobuf::ArenaOptions options;
+  options.initial_block = initial_block;
+  options.initial_block_size = kArenaInitialBlockSize;
+  return options;
+}
+
+template <typename InitialRequest>
+InitialRequest& CreateInitialRequest(google::protobuf::Arena& arena) {
+  if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
+    // Is never read or written, grpcpp does not get it for the streams
+    static NoInitialRequest no_initial_request;
+    return no_initial_request;
+  } else {
+    return *google::protobuf::Arena::CreateMessage<InitialRequest>(&arena);
+  }
+}
+
 /// Per-gRPC-service data
 template <typename GrpcppService>
 struct ServiceData final {
@@ -175,7 +199,7 @@ class CallData final {
     auto& access_tskv_logger =
         method_data_.service_data.settings.access_tskv_logger;
     Call responder(CallParams{context_, call_name, statistics_scope,
-                              *access_tskv_logger, span_->Get()},
+                              *access_tskv_logger, span_->Get(), arena_},
                    raw_responder_);
     auto do_call = [&] {
       if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
@@ -215,7 +239,12 @@ class CallData final {
   MethodData<GrpcppService, CallTraits> method_data_;
 
   grpc::ServerContext context_{};
-  InitialRequest initial_request_{};
+  // The request and the messages created by the handler on the arena are
+  // freed at once when the call is over
+  alignas(std::max_align_t) char arena_initial_block_[kArenaInitialBlockSize];
+  google::protobuf::Arena arena_{MakeArenaOptions(arena_initial_block_)};
+  InitialRequest& initial_request_{
+      CreateInitialRequest<InitialRequest>(arena_)};
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
@@ -243,7 +272,9 @@ class ServiceWorkerImpl final : public ServiceWorker {
     service_data_.wait_tokens.WaitForAllTokens();
   }
 
-  grpc::Service& GetService() override { return service_data_.async_service; }
+  void Register(grpc::ServerBuilder& builder) override {
+    builder.RegisterService(&service_data_.async_service);
+  }
 
   const ugrpc::impl::StaticServiceMetadata& GetMetadata() const override {
     return service_data_.metadata;
@@ -0,0 +1,63 @@
+#pragma once
+
+/// @file userver/ugrpc/server/middlewares/cache/component.hpp
+/// @brief @copybrief ugrpc::server::middlewares::cache::Component
+
+#include <userver/utils/statistics/entry.hpp>
+
+#include <userver/ugrpc/server/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// Server response cache middleware
+namespace ugrpc::server::middlewares::cache {
+
+class Middleware;
+
+// clang-format off
+
+/// @ingroup userver_components userver_base_classes
+///
+/// @brief Component for the gRPC server middleware that caches the responses
+/// of the idempotent unary methods
+///
+/// The responses are cached by the method and the serialized request. The
+/// concurrent identical calls of a method wait for the response of the first
+/// one instead of running the handler. Only the successful responses are
+/// cached, if the first call fails the others run the handler on their own.
+///
+/// The cache statistics are written to `grpc.server.cache`.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// methods | full names of the cached methods, e.g. 'package.Service/Method' | -
+/// ways | number of the cache ways | 16
+/// way-size | max number of the responses in a way | 256
+/// lifetime | how long a response is cached | 1s
+
+// clang-format on
+
+class Component final : public MiddlewareComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of ugrpc::server::middlewares::cache::Component
+  static constexpr std::string_view kName = "grpc-server-cache";
+
+  Component(const components::ComponentConfig& config,
+            const components::ComponentContext& context);
+
+  ~Component() override;
+
+  std::shared_ptr<MiddlewareBase> GetMiddleware() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<Middleware> middleware_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace ugrpc::server::middlewares::cache
+
+USERVER_NAMESPACE_END
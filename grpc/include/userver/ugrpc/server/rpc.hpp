@@ -3,10 +3,16 @@
 /// @file userver/ugrpc/server/rpc.hpp
 /// @brief Classes representing an incoming RPC
 
+#include <optional>
+#include <type_traits>
+
+#include <google/protobuf/message.h>
 #include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/server_context.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/span.hpp>
 
 #include <userver/ugrpc/impl/deadline_timepoint.hpp>
 #include <userver/ugrpc/impl/internal_tag_fwd.hpp>
@@ -52,11 +58,28 @@ class CallAnyBase {
 
   tracing::Span& GetSpan() { return params_.call_span; }
 
+  /// @returns the arena the request of this RPC is allocated on
+  /// @note The messages created on the arena, e.g. with
+  /// `google::protobuf::Arena::CreateMessage`, are freed all at once after
+  /// the RPC is finished and must not outlive the handler
+  google::protobuf::Arena& GetArena() { return params_.arena; }
+
   virtual bool IsFinished() const = 0;
 
   /// @cond
   // For internal use only
   ugrpc::impl::RpcStatisticsScope& Statistics(ugrpc::impl::InternalTag);
+
+  using ResponseHook =
+      utils::function_ref<void(const google::protobuf::Message& response)>;
+
+  // For internal use only. The hook is called with the response of a unary
+  // call before it is sent, it must outlive the call handler
+  void SetResponseHook(ResponseHook hook);
+
+  // For internal use only. Finishes a unary call with the response, returns
+  // `false` if the call is not unary or the response is of another type
+  virtual bool FinishWithResponse(const google::protobuf::Message& response);
   /// @endcond
 
  protected:
@@ -66,8 +89,16 @@ class CallAnyBase {
 
   void LogFinish(grpc::Status status) const;
 
+  template <typename Response>
+  void CallResponseHook(const Response& response) {
+    if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
+      if (response_hook_) (*response_hook_)(response);
+    }
+  }
+
  private:
   impl::CallParams params_;
+  std::optional<ResponseHook> response_hook_;
 };
 
 /// @brief Controls a single request -> single response RPC
@@ -92,6 +123,11 @@ class UnaryCall final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void FinishWithError(const grpc::Status& status) override;
 
+  /// @cond
+  // For internal use only
+  bool FinishWithResponse(const google::protobuf::Message& response) override;
+  /// @endcond
+
   /// For internal use only
   UnaryCall(impl::CallParams&& call_params,
             impl::RawResponseWriter<Response>& stream);
@@ -172,6 +208,15 @@ class OutputStream final : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Write several outgoing messages at once
+  ///
+  /// The messages are buffered and sent to the wire together, which is
+  /// cheaper than a `Write` per message for the streams of small messages.
+  ///
+  /// @param responses the next messages to write
+  /// @throws ugrpc::server::RpcError on an RPC error
+  void WriteBatch(utils::span<const Response> responses);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -240,6 +285,15 @@ class BidirectionalStream : public CallAnyBase {
   /// @throws ugrpc::server::RpcError on an RPC error
   void Write(const Response& response);
 
+  /// @brief Write several outgoing messages at once
+  ///
+  /// The messages are buffered and sent to the wire together, which is
+  /// cheaper than a `Write` per message for the streams of small messages.
+  ///
+  /// @param responses the next messages to write
+  /// @throws ugrpc::server::RpcError on an RPC error
+  void WriteBatch(utils::span<const Response> responses);
+
   /// @brief Complete the RPC successfully
   ///
   /// `Finish` must not be called multiple times.
@@ -301,6 +355,7 @@ void UnaryCall<Response>::Finish(const Response& response) {
   UINVARIANT(!is_finished_, "'Finish' called on a finished call");
   is_finished_ = true;
 
+  CallResponseHook(response);
   LogFinish(grpc::Status::OK);
   impl::Finish(stream_, response, grpc::Status::OK, GetCallName());
   Statistics().OnExplicitFinish(grpc::StatusCode::OK);
@@ -317,6 +372,18 @@ void UnaryCall<Response>::FinishWithError(const grpc::Status& status) {
   ugrpc::impl::UpdateSpanWithStatus(GetSpan(), status);
 }
 
+template <typename Response>
+bool UnaryCall<Response>::FinishWithResponse(
+    const google::protobuf::Message& response) {
+  if constexpr (std::is_base_of_v<google::protobuf::Message, Response>) {
+    if (const auto* typed_response = dynamic_cast<const Response*>(&response)) {
+      Finish(*typed_response);
+      return true;
+    }
+  }
+  return false;
+}
+
 template <typename Response>
 bool UnaryCall<Response>::IsFinished() const {
   return is_finished_;
@@ -404,6 +471,15 @@ void OutputStream<Response>::Write(const Response& response) {
   impl::Write(stream_, response, write_options, GetCallName());
 }
 
+template <typename Response>
+void OutputStream<Response>::WriteBatch(utils::span<const Response> responses) {
+  UINVARIANT(state_ != State::kFinished,
+             "'WriteBatch' called on a finished stream");
+
+  impl::SendInitialMetadataIfNew(stream_, GetCallName(), state_);
+  impl::WriteBatch(stream_, responses, GetCallName());
+}
+
 template <typename Response>
 void OutputStream<Response>::Finish() {
   UINVARIANT(state_ != State::kFinished,
@@ -489,6 +565,19 @@ void BidirectionalStream<Request, Response>::Write(const Response& response) {
   }
 }
 
+template <typename Request, typename Response>
+void BidirectionalStream<Request, Response>::WriteBatch(
+    utils::span<const Response> responses) {
+  UINVARIANT(!is_finished_, "'WriteBatch' called on a finished stream");
+
+  try {
+    impl::WriteBatch(stream_, responses, GetCallName());
+  } catch (const RpcInterruptedError&) {
+    is_finished_ = true;
+    throw;
+  }
+}
+
 template <typename Request, typename Response>
 void BidirectionalStream<Request, Response>::Finish() {
   UINVARIANT(!is_finished_, "'Finish' called on a finished stream");
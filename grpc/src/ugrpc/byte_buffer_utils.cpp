@@ -0,0 +1,66 @@
+#include <userver/ugrpc/byte_buffer_utils.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <grpcpp/impl/codegen/proto_utils.h>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc {
+
+namespace {
+
+using Traits = grpc::SerializationTraits<google::protobuf::Message>;
+
+}  // namespace
+
+grpc::ByteBuffer SerializeToByteBuffer(
+    const google::protobuf::Message& message) {
+  grpc::ByteBuffer buffer;
+  bool own_buffer = false;
+  const auto status = Traits::Serialize(message, &buffer, &own_buffer);
+  if (!status.ok()) {
+    throw std::runtime_error("Failed to serialize a '" +
+                             message.GetTypeName() +
+                             "' message: " + status.error_message());
+  }
+  return buffer;
+}
+
+bool ParseFromByteBuffer(const grpc::ByteBuffer& buffer,
+                         google::protobuf::Message& message) {
+  // The copy shares the slices, deserialization clears it
+  grpc::ByteBuffer copy = buffer;
+  return Traits::Deserialize(&copy, &message).ok();
+}
+
+std::vector<grpc::Slice> GetSlices(const grpc::ByteBuffer& buffer) {
+  std::vector<grpc::Slice> slices;
+  if (!buffer.Valid()) return slices;
+
+  [[maybe_unused]] const auto status = buffer.Dump(&slices);
+  UASSERT(status.ok());
+  return slices;
+}
+
+std::string CopyPrefix(const grpc::ByteBuffer& buffer, std::size_t max_size) {
+  std::string result;
+  result.reserve(std::min(max_size, buffer.Length()));
+  for (const auto& slice : GetSlices(buffer)) {
+    if (result.size() == max_size) break;
+    const auto size = std::min(slice.size(), max_size - result.size());
+    result.append(reinterpret_cast<const char*>(slice.begin()), size);
+  }
+  return result;
+}
+
+std::string CopyToString(const grpc::ByteBuffer& buffer) {
+  return CopyPrefix(buffer, buffer.Length());
+}
+
+}  // namespace ugrpc
+
+USERVER_NAMESPACE_END
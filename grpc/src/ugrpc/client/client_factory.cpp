@@ -8,6 +8,9 @@
 #include <userver/engine/async.hpp>
 #include <userver/logging/level_serialization.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 #include <ugrpc/client/impl/client_factory_config.hpp>
@@ -26,9 +29,21 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
                              utils::statistics::Storage& statistics_storage,
                              testsuite::GrpcControl& testsuite_grpc,
                              dynamic_config::Source source)
+    : ClientFactory(std::move(settings), channel_task_processor, std::move(mws),
+                    ugrpc::impl::CompletionQueues{{&queue}, {}},
+                    statistics_storage, testsuite_grpc, source) {}
+
+ClientFactory::ClientFactory(ClientFactorySettings&& settings,
+                             engine::TaskProcessor& channel_task_processor,
+                             MiddlewareFactories mws,
+                             const ugrpc::impl::CompletionQueues& queues,
+                             utils::statistics::Storage& statistics_storage,
+                             testsuite::GrpcControl& testsuite_grpc,
+                             dynamic_config::Source source)
     : channel_task_processor_(channel_task_processor),
       mws_(mws),
-      queue_(queue),
+      queues_(queues),
+      max_active_calls_per_channel_(settings.max_active_calls_per_channel),
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? settings.credentials
                          : grpc::InsecureChannelCredentials(),
@@ -36,6 +51,7 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
       client_statistics_storage_(statistics_storage, "client"),
       config_source_(source),
       testsuite_grpc_(testsuite_grpc) {
+  UINVARIANT(!queues_.queues.empty(), "No completion queues for the clients");
   ugrpc::impl::SetupNativeLogging();
   ugrpc::impl::UpdateNativeLogLevel(settings.native_log_level);
 
@@ -47,6 +63,17 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
                                           : grpc::InsecureChannelCredentials(),
             settings.channel_args, settings.channel_count));
   }
+
+  statistics_holder_ = statistics_storage.RegisterWriter(
+      "grpc.client.channels",
+      [this](utils::statistics::Writer& writer) { WriteStatistics(writer); });
+}
+
+void ClientFactory::WriteStatistics(utils::statistics::Writer& writer) {
+  writer = channel_cache_;
+  for (const auto& [client_name, channel_cache] : client_channel_cache_) {
+    writer.ValueWithLabels(*channel_cache, {"grpc_client", client_name});
+  }
 }
 
 impl::ChannelCache::Token ClientFactory::GetChannel(
@@ -6,6 +6,8 @@
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/storages/secdist/component.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 #include <ugrpc/client/impl/client_factory_config.hpp>
@@ -36,17 +38,22 @@ ClientFactoryComponent::ClientFactoryComponent(
   auto& task_processor =
       context.GetTaskProcessor(config["task-processor"].As<std::string>());
 
-  grpc::CompletionQueue* queue = nullptr;
+  auto& statistics_storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+
+  const ugrpc::impl::CompletionQueues* queues = nullptr;
   if (auto* const server =
           context.FindComponentOptional<ugrpc::server::ServerComponent>()) {
-    queue = &server->GetServer().GetCompletionQueue();
+    queues = &server->GetServer().GetCompletionQueues();
   } else {
-    queue_.emplace();
-    queue = &queue_->GetQueue();
+    queue_.emplace(config["completion-queue-count"].As<std::size_t>(1));
+    queues = &queue_->GetQueues();
+    queues_statistics_holder_ = statistics_storage.RegisterWriter(
+        "grpc.client.completion-queues",
+        [this](utils::statistics::Writer& writer) {
+          ugrpc::impl::DumpMetric(writer, queue_->GetQueues());
+        });
   }
-
-  auto& statistics_storage =
-      context.FindComponent<components::StatisticsStorage>().GetStorage();
   const auto config_source =
       context.FindComponent<components::DynamicConfig>().GetSource();
 
@@ -64,7 +71,7 @@ ClientFactoryComponent::ClientFactoryComponent(
 
   const auto* secdist = GetSecdist(context);
   factory_.emplace(MakeFactorySettings(std::move(factory_config), secdist),
-                   task_processor, mws, *queue, statistics_storage,
+                   task_processor, mws, *queues, statistics_storage,
                    testsuite_grpc, config_source);
 }
 
@@ -118,6 +125,22 @@ properties:
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    max-active-calls-per-channel:
+        type: integer
+        description: |
+            Number of active calls on a channel after which the calls go to
+            the next channel, so the channels are connected as the load
+            grows. 0 sends each call to the least loaded channel.
+        defaultDescription: 0
+        minimum: 0
+    completion-queue-count:
+        type: integer
+        description: |
+            Number of completion queues to create, each one is processed by
+            its own thread. The queues of the gRPC server are used instead
+            if there is one.
+        defaultDescription: 1
+        minimum: 1
     middlewares:
         type: array
         items:
@@ -0,0 +1,99 @@
+#include <userver/ugrpc/client/generic.hpp>
+
+#include <string>
+#include <utility>
+
+#include <grpcpp/generic/generic_stub.h>
+
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+namespace {
+
+constexpr std::string_view kGenericMethodFullNames[] = {"Generic/Call"};
+
+// Makes grpc::GenericStub look like a code-generated grpcpp service for
+// impl::ClientData
+struct GenericService final {
+  using Stub = grpc::GenericStub;
+
+  static std::unique_ptr<Stub> NewStub(std::shared_ptr<grpc::Channel> channel) {
+    return std::make_unique<Stub>(std::move(channel));
+  }
+
+  static constexpr std::string_view service_full_name() { return "Generic"; }
+};
+
+// Binds the method to the generic stub, so that the RPC classes can prepare
+// the call as they do for the code-generated stubs
+class MethodStub final {
+ public:
+  MethodStub(grpc::GenericStub& stub, std::string_view call_name)
+      : stub_(stub), method_("/" + std::string{call_name}) {}
+
+  impl::RawResponseReader<grpc::ByteBuffer> PrepareUnary(
+      grpc::ClientContext* context, const grpc::ByteBuffer& request,
+      grpc::CompletionQueue* queue) {
+    return stub_.PrepareUnaryCall(context, method_, request, queue);
+  }
+
+  impl::RawReaderWriter<grpc::ByteBuffer, grpc::ByteBuffer> PrepareStream(
+      grpc::ClientContext* context, grpc::CompletionQueue* queue) {
+    return stub_.PrepareCall(context, method_, queue);
+  }
+
+ private:
+  grpc::GenericStub& stub_;
+  const std::string method_;
+};
+
+}  // namespace
+
+GenericClient::GenericClient(impl::ClientParams&& client_params)
+    : impl_(std::move(client_params), GetMetadata(),
+            std::in_place_type<GenericService>) {}
+
+GenericClient::UnaryCall GenericClient::Unary(
+    std::string_view call_name, const grpc::ByteBuffer& request,
+    std::unique_ptr<grpc::ClientContext> context, const Qos& qos) const {
+  auto call_params = CreateCallParams(call_name, std::move(context), qos);
+  MethodStub stub{impl_.GetStub<GenericService>(
+                      call_params.active_call.GetChannelIndex()),
+                  call_name};
+  return {std::move(call_params), stub, &MethodStub::PrepareUnary, request};
+}
+
+GenericClient::StreamCall GenericClient::Stream(
+    std::string_view call_name, std::unique_ptr<grpc::ClientContext> context,
+    const Qos& qos) const {
+  auto call_params = CreateCallParams(call_name, std::move(context), qos);
+  MethodStub stub{impl_.GetStub<GenericService>(
+                      call_params.active_call.GetChannelIndex()),
+                  call_name};
+  return {std::move(call_params), stub, &MethodStub::PrepareStream};
+}
+
+ugrpc::impl::StaticServiceMetadata GenericClient::GetMetadata() {
+  return ugrpc::impl::MakeStaticServiceMetadata<GenericService>(
+      kGenericMethodFullNames);
+}
+
+impl::CallParams GenericClient::CreateCallParams(
+    std::string_view call_name, std::unique_ptr<grpc::ClientContext> context,
+    const Qos& qos) const {
+  UINVARIANT(!call_name.empty() && !utils::text::StartsWith(call_name, "/"),
+             "The call name must look like 'package.Service/Method'");
+  ApplyQos(*context, qos, impl_.GetTestsuiteControl());
+
+  auto call_params = impl::DoCreateCallParams(impl_, 0, std::move(context));
+  call_params.call_name = {};
+  call_params.generic_call_name = std::string{call_name};
+  return call_params;
+}
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
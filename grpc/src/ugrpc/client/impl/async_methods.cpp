@@ -88,12 +88,15 @@ void FutureImpl::ClearData() noexcept { data_ = nullptr; }
 
 RpcData::RpcData(impl::CallParams&& params)
     : context_(std::move(params.context)),
-      client_name_(params.call_name),
-      call_name_(params.call_name),
+      client_name_(params.client_name),
+      generic_call_name_(std::move(params.generic_call_name)),
+      call_name_(generic_call_name_.empty() ? params.call_name
+                                            : generic_call_name_),
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      active_call_(std::move(params.active_call)) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_);
@@ -7,6 +7,8 @@
 #include <grpcpp/security/credentials.h>
 
 #include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/to_string.hpp>
 
@@ -55,15 +57,74 @@ std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
   return counted_channel_->channels.size();
 }
 
+ChannelCache::ActiveCall ChannelCache::Token::StartCall(
+    std::size_t max_active_calls) const noexcept {
+  UASSERT(counted_channel_);
+  auto& active_calls = counted_channel_->active_calls;
+  const auto count = active_calls.size();
+
+  if (max_active_calls != 0) {
+    for (std::size_t i = 0; i < count; ++i) {
+      if (active_calls[i].load(std::memory_order_relaxed) < max_active_calls) {
+        return {i, active_calls[i]};
+      }
+    }
+  }
+
+  // Starts from a random channel to spread the calls between equally loaded
+  // channels
+  const auto start = count == 1 ? 0 : utils::RandRange(count);
+  auto best = start;
+  auto best_calls = active_calls[start].load(std::memory_order_relaxed);
+  for (std::size_t i = 1; i < count && best_calls != 0; ++i) {
+    const auto index = (start + i) % count;
+    const auto calls = active_calls[index].load(std::memory_order_relaxed);
+    if (calls < best_calls) {
+      best = index;
+      best_calls = calls;
+    }
+  }
+  return {best, active_calls[best]};
+}
+
+ChannelCache::ActiveCall::ActiveCall(
+    std::size_t channel_index,
+    std::atomic<std::uint64_t>& active_calls) noexcept
+    : channel_index_(channel_index), active_calls_(&active_calls) {
+  active_calls_->fetch_add(1, std::memory_order_relaxed);
+}
+
+ChannelCache::ActiveCall::ActiveCall(ActiveCall&& other) noexcept
+    : channel_index_(other.channel_index_),
+      active_calls_(std::exchange(other.active_calls_, nullptr)) {}
+
+ChannelCache::ActiveCall& ChannelCache::ActiveCall::operator=(
+    ActiveCall&& other) noexcept {
+  std::swap(channel_index_, other.channel_index_);
+  std::swap(active_calls_, other.active_calls_);
+  return *this;
+}
+
+ChannelCache::ActiveCall::~ActiveCall() {
+  if (active_calls_) active_calls_->fetch_sub(1, std::memory_order_relaxed);
+}
+
 ChannelCache::CountedChannel::CountedChannel(
     const std::string& endpoint,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
     const grpc::ChannelArguments& channel_args, std::size_t count) {
   const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
+  // By default the channels with the same arguments share the connections,
+  // the local pools make each channel connect on its own
+  auto own_channel_args = channel_args;
+  if (count > 1) {
+    own_channel_args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  }
   channels = utils::GenerateFixedArray(count, [&](std::size_t) {
     return grpc::CreateCustomChannel(endpoint_string, credentials,
-                                     channel_args);
+                                     own_channel_args);
   });
+  active_calls = utils::FixedArray<std::atomic<std::uint64_t>>(count);
   UASSERT(count > 0);
 }
 
@@ -85,6 +146,18 @@ ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
   return {*this, it->first, it->second};
 }
 
+void DumpMetric(utils::statistics::Writer& writer, const ChannelCache& cache) {
+  const auto channels = cache.channels_.Lock();
+  for (const auto& [endpoint, counted_channel] : *channels) {
+    const auto& active_calls = counted_channel.active_calls;
+    for (std::size_t i = 0; i < active_calls.size(); ++i) {
+      writer["active-calls"].ValueWithLabels(
+          active_calls[i].load(std::memory_order_relaxed),
+          {{"grpc_endpoint", endpoint}, {"grpc_channel", std::to_string(i)}});
+    }
+  }
+}
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
@@ -26,6 +26,10 @@ struct ClientFactoryConfig final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Number of active calls on a channel after which the next channel is
+  /// used, 0 spreads the calls over all the channels
+  std::size_t max_active_calls_per_channel{0};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
@@ -0,0 +1,24 @@
+#include <userver/ugrpc/impl/completion_queues.hpp>
+
+#include <string>
+
+#include <userver/utils/statistics/writer.hpp>
+
+#include <userver/ugrpc/impl/queue_runner.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const CompletionQueues& queues) {
+  for (std::size_t i = 0; i < queues.runners.size(); ++i) {
+    writer["processed-events"].ValueWithLabels(
+        queues.runners[i]->GetProcessedEvents(),
+        {"grpc_queue", std::to_string(i)});
+  }
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -14,7 +14,8 @@ namespace ugrpc::impl {
 namespace {
 
 void ProcessQueue(grpc::CompletionQueue& queue,
-                  engine::SingleUseEvent& completion) noexcept {
+                  engine::SingleUseEvent& completion,
+                  std::atomic<std::uint64_t>& processed_events) noexcept {
   utils::SetCurrentThreadName("grpc-queue");
 
   void* tag = nullptr;
@@ -24,6 +25,7 @@ void ProcessQueue(grpc::CompletionQueue& queue,
     auto* call = static_cast<EventBase*>(tag);
     UASSERT(call != nullptr);
     call->Notify(ok);
+    processed_events.fetch_add(1, std::memory_order_relaxed);
   }
 
   completion.Send();
@@ -32,7 +34,9 @@ void ProcessQueue(grpc::CompletionQueue& queue,
 }  // namespace
 
 QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
-  std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+  std::thread([this] {
+    ProcessQueue(queue_, completion_, processed_events_);
+  }).detach();
 }
 
 QueueRunner::~QueueRunner() {
@@ -40,6 +44,10 @@ QueueRunner::~QueueRunner() {
   completion_.WaitNonCancellable();
 }
 
+std::uint64_t QueueRunner::GetProcessedEvents() const noexcept {
+  return processed_events_.load(std::memory_order_relaxed);
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,171 @@
+#include <userver/ugrpc/server/generic_service_base.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <string_view>
+
+#include <grpcpp/generic/async_generic_service.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/impl/wait_token_storage.hpp>
+#include <userver/utils/lazy_prvalue.hpp>
+
+#include <userver/ugrpc/server/impl/service_worker_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server {
+
+namespace {
+
+constexpr std::string_view kGenericMethodFullNames[] = {"Generic/Call"};
+
+constexpr ugrpc::impl::StaticServiceMetadata kGenericMetadata{
+    "Generic", kGenericMethodFullNames};
+
+struct GenericServiceData final {
+  GenericServiceData(impl::ServiceSettings&& settings,
+                     GenericServiceBase& service)
+      : settings(std::move(settings)),
+        service(service),
+        statistics(this->settings.statistics_storage
+                       .GetServiceStatistics(kGenericMetadata)
+                       .GetMethodStatistics(0)) {}
+
+  const impl::ServiceSettings settings;
+  GenericServiceBase& service;
+  ugrpc::impl::MethodStatistics& statistics;
+  grpc::AsyncGenericService async_service;
+  utils::impl::WaitTokenStorage wait_tokens;
+};
+
+class GenericCallData final {
+ public:
+  GenericCallData(GenericServiceData& data, std::size_t queue_num)
+      : wait_token_(data.wait_tokens.GetToken()),
+        data_(data),
+        queue_num_(queue_num) {}
+
+  void operator()() && {
+    // Same as in impl::CallData, AsyncNotifyWhenDone goes first
+    impl::RpcFinishedEvent notify_when_done(
+        engine::current_task::GetCancellationToken(), context_);
+    context_.AsyncNotifyWhenDone(notify_when_done.GetTag());
+
+    auto& queue = data_.settings.queue.GetQueue(queue_num_);
+    data_.async_service.RequestCall(&context_, &stream_, &queue, &queue,
+                                    prepare_.GetTag());
+
+    if (impl::Wait(prepare_) != impl::AsyncMethodInvocation::WaitStatus::kOk) {
+      // the CompletionQueue is shutting down
+      return;
+    }
+
+    ListenAsync(data_, queue_num_);
+
+    HandleRpc();
+
+    notify_when_done.Wait();
+  }
+
+  static void ListenAsync(GenericServiceData& data, std::size_t queue_num) {
+    engine::CriticalAsyncNoSpan(
+        data.settings.task_processor,
+        utils::LazyPrvalue([&] { return GenericCallData(data, queue_num); }))
+        .Detach();
+  }
+
+ private:
+  void HandleRpc() {
+    std::string_view call_name = context_.method();
+    // grpcpp gives out '/service/method', codegen names have no slash
+    if (!call_name.empty() && call_name.front() == '/') {
+      call_name.remove_prefix(1);
+    }
+    const auto slash = call_name.find('/');
+    const auto service_name = call_name.substr(0, slash);
+    const auto method_name = slash == std::string_view::npos
+                                 ? std::string_view{}
+                                 : call_name.substr(slash + 1);
+
+    impl::SetupSpan(span_, context_, call_name);
+    utils::FastScopeGuard destroy_span([&]() noexcept { span_.reset(); });
+
+    ugrpc::impl::RpcStatisticsScope statistics_scope(data_.statistics);
+
+    GenericCall call(impl::CallParams{context_, call_name, statistics_scope,
+                                      *data_.settings.access_tskv_logger,
+                                      span_->Get(), arena_},
+                     stream_);
+    auto do_call = [&] { data_.service.Handle(call); };
+
+    try {
+      MiddlewareCallContext middleware_context(
+          data_.settings.middlewares, call, do_call, service_name, method_name,
+          data_.settings.config_source.GetSnapshot(), nullptr);
+      middleware_context.Next();
+    } catch (
+        const USERVER_NAMESPACE::server::handlers::CustomHandlerException& ex) {
+      impl::ReportCustomError(ex, call, span_->Get());
+    } catch (const RpcInterruptedError& ex) {
+      impl::ReportNetworkError(ex, call_name, span_->Get());
+      statistics_scope.OnNetworkError();
+    } catch (const std::exception& ex) {
+      impl::ReportHandlerError(ex, call_name, span_->Get());
+    }
+  }
+
+  // 'wait_token_' must be the first field, because its lifetime keeps
+  // GenericServiceData alive during server shutdown.
+  const utils::impl::WaitTokenStorage::Token wait_token_;
+
+  GenericServiceData& data_;
+  const std::size_t queue_num_;
+
+  grpc::GenericServerContext context_{};
+  alignas(std::max_align_t) char
+      arena_initial_block_[impl::kArenaInitialBlockSize];
+  google::protobuf::Arena arena_{impl::MakeArenaOptions(arena_initial_block_)};
+  grpc::GenericServerAsyncReaderWriter stream_{&context_};
+  ugrpc::impl::AsyncMethodInvocation prepare_;
+  std::optional<tracing::InPlaceSpan> span_{};
+};
+
+class GenericServiceWorker final : public impl::ServiceWorker {
+ public:
+  GenericServiceWorker(impl::ServiceSettings&& settings,
+                       GenericServiceBase& service)
+      : data_(std::move(settings), service) {}
+
+  ~GenericServiceWorker() override { data_.wait_tokens.WaitForAllTokens(); }
+
+  void Register(grpc::ServerBuilder& builder) override {
+    builder.RegisterAsyncGenericService(&data_.async_service);
+  }
+
+  const ugrpc::impl::StaticServiceMetadata& GetMetadata() const override {
+    return kGenericMetadata;
+  }
+
+  void Start() override {
+    for (std::size_t i = 0; i < data_.settings.queue.GetSize(); ++i) {
+      GenericCallData::ListenAsync(data_, i);
+    }
+  }
+
+ private:
+  GenericServiceData data_;
+};
+
+}  // namespace
+
+std::unique_ptr<impl::ServiceWorker> GenericServiceBase::MakeWorker(
+    impl::ServiceSettings&& settings) {
+  return std::make_unique<GenericServiceWorker>(std::move(settings), *this);
+}
+
+}  // namespace ugrpc::server
+
+USERVER_NAMESPACE_END
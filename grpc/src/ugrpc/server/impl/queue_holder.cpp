@@ -29,8 +29,10 @@ struct QueueHolder::Impl final {
       : queue(utils::GenerateFixedArray(num, [&server_builder](size_t) {
           return QueueSubHolder(server_builder.AddCompletionQueue());
         })) {
-    for (auto& subholder : queue)
+    for (auto& subholder : queue) {
       queues.queues.push_back(subholder.queue.get());
+      queues.runners.push_back(&subholder.queue_runner);
+    }
   }
 
   utils::FixedArray<QueueSubHolder> queue;
@@ -30,7 +30,7 @@ void Middleware::Handle(MiddlewareCallContext& context) const {
 
       auto baggage = USERVER_NAMESPACE::baggage::TryMakeBaggage(
           ugrpc::impl::ToString(*baggage_header),
-          baggage_settings.allowed_keys);
+          baggage_settings.shared_allowed_keys);
       if (baggage) {
         USERVER_NAMESPACE::baggage::kInheritedBaggage.Set(std::move(*baggage));
       }
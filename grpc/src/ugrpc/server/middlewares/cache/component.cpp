@@ -0,0 +1,82 @@
+#include <userver/ugrpc/server/middlewares/cache/component.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <ugrpc/server/middlewares/cache/middleware.hpp>
+#include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::cache {
+
+namespace {
+
+Middleware::Settings ParseSettings(const components::ComponentConfig& config) {
+  Middleware::Settings settings;
+  for (auto& method : config["methods"].As<std::vector<std::string>>()) {
+    settings.methods.insert(std::move(method));
+  }
+  settings.ways = config["ways"].As<std::size_t>(16);
+  settings.way_size = config["way-size"].As<std::size_t>(256);
+  settings.lifetime = config["lifetime"].As<std::chrono::milliseconds>(
+      std::chrono::seconds{1});
+  return settings;
+}
+
+}  // namespace
+
+Component::Component(const components::ComponentConfig& config,
+                     const components::ComponentContext& context)
+    : MiddlewareComponentBase(config, context),
+      middleware_(std::make_shared<Middleware>(ParseSettings(config))) {
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "grpc.server.cache", [this](utils::statistics::Writer& writer) {
+        DumpMetric(writer, *middleware_);
+      });
+}
+
+Component::~Component() { statistics_holder_.Unregister(); }
+
+std::shared_ptr<MiddlewareBase> Component::GetMiddleware() {
+  return middleware_;
+}
+
+yaml_config::Schema Component::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<MiddlewareComponentBase>(R"(
+type: object
+description: gRPC server response cache middleware component
+additionalProperties: false
+properties:
+    methods:
+        type: array
+        description: full names of the cached methods
+        items:
+            type: string
+            description: method name, e.g. 'package.Service/Method'
+    ways:
+        type: integer
+        description: number of the cache ways
+        defaultDescription: 16
+    way-size:
+        type: integer
+        description: max number of the responses in a way
+        defaultDescription: 256
+    lifetime:
+        type: string
+        description: how long a response is cached
+        defaultDescription: 1s
+)");
+}
+
+}  // namespace ugrpc::server::middlewares::cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,92 @@
+#include "middleware.hpp"
+
+#include <exception>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::cache {
+
+namespace {
+
+// The handler has not finished the call with a response, there is nothing to
+// cache or to share with the concurrent identical calls
+class NoResponseError final : public std::exception {
+ public:
+  const char* what() const noexcept override {
+    return "The gRPC handler has not finished the call with a response";
+  }
+};
+
+std::string MakeKey(std::string_view call_name,
+                    const google::protobuf::Message& request) {
+  std::string key{call_name};
+  key.push_back('\n');
+  request.AppendToString(&key);
+  return key;
+}
+
+}  // namespace
+
+Middleware::Middleware(Settings&& settings)
+    : methods_(std::move(settings.methods)),
+      cache_(settings.ways, settings.way_size) {
+  cache_.SetMaxLifetime(settings.lifetime);
+}
+
+void Middleware::Handle(MiddlewareCallContext& context) const {
+  auto& call = context.GetCall();
+  const auto* request = context.GetInitialRequest();
+  if (!request || utils::impl::FindTransparent(methods_, call.GetCallName()) ==
+                      methods_.end()) {
+    context.Next();
+    return;
+  }
+
+  // The call that runs the handler is finished by the handler itself, the
+  // concurrent identical calls wait for its response. Background updates of
+  // the cache are not enabled, so the update never outlives this call.
+  bool is_handled = false;
+  ResponsePtr response;
+  try {
+    response = cache_.Get(MakeKey(call.GetCallName(), *request),
+                          [&](const std::string&) {
+                            is_handled = true;
+                            ResponsePtr captured;
+                            call.SetResponseHook(
+                                [&](const google::protobuf::Message& message) {
+                                  std::shared_ptr<google::protobuf::Message>
+                                      copy{message.New()};
+                                  copy->CopyFrom(message);
+                                  captured = std::move(copy);
+                                });
+                            context.Next();
+                            if (!captured) throw NoResponseError{};
+                            return captured;
+                          });
+  } catch (const NoResponseError&) {
+    if (is_handled) return;
+    context.Next();
+    return;
+  } catch (const std::exception&) {
+    if (is_handled) throw;
+    // The call we waited for has failed, handle this one on its own
+    context.Next();
+    return;
+  }
+
+  if (is_handled) return;
+  if (!call.FinishWithResponse(*response)) context.Next();
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const Middleware& middleware) {
+  writer["size"] = middleware.cache_.GetSizeApproximate();
+  USERVER_NAMESPACE::cache::impl::DumpMetric(writer,
+                                             middleware.cache_.GetStatistics());
+}
+
+}  // namespace ugrpc::server::middlewares::cache
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <google/protobuf/message.h>
+
+#include <userver/cache/expirable_lru_cache.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+
+#include <userver/ugrpc/server/middlewares/base.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::server::middlewares::cache {
+
+class Middleware final : public MiddlewareBase {
+ public:
+  struct Settings {
+    /// Full names of the cached methods, e.g. 'package.Service/Method'
+    utils::impl::TransparentSet<std::string> methods;
+    std::size_t ways{};
+    std::size_t way_size{};
+    std::chrono::milliseconds lifetime{};
+  };
+
+  explicit Middleware(Settings&& settings);
+
+  void Handle(MiddlewareCallContext& context) const override;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const Middleware& middleware);
+
+ private:
+  using ResponsePtr = std::shared_ptr<const google::protobuf::Message>;
+
+  const utils::impl::TransparentSet<std::string> methods_;
+  mutable USERVER_NAMESPACE::cache::ExpirableLruCache<std::string, ResponsePtr>
+      cache_;
+};
+
+}  // namespace ugrpc::server::middlewares::cache
+
+USERVER_NAMESPACE_END
@@ -119,6 +119,14 @@ ugrpc::impl::RpcStatisticsScope& CallAnyBase::Statistics(
   return params_.statistics;
 }
 
+void CallAnyBase::SetResponseHook(ResponseHook hook) {
+  response_hook_.emplace(hook);
+}
+
+bool CallAnyBase::FinishWithResponse(const google::protobuf::Message&) {
+  return false;
+}
+
 void CallAnyBase::LogFinish(grpc::Status status) const {
   constexpr auto kLevel = logging::Level::kInfo;
   if (!params_.access_tskv_logger.ShouldLog(kLevel)) {
@@ -16,6 +16,8 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/logging.hpp>
 #include <ugrpc/impl/to_string.hpp>
@@ -82,6 +84,8 @@ class Server::Impl final {
 
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  const ugrpc::impl::CompletionQueues& GetCompletionQueues() noexcept;
+
   void Start();
 
   int GetPort() const noexcept;
@@ -114,6 +118,7 @@ class Server::Impl final {
   ugrpc::impl::StatisticsStorage statistics_storage_;
   const dynamic_config::Source config_source_;
   logging::LoggerPtr access_tskv_logger_;
+  utils::statistics::Entry queues_statistics_holder_;
 };
 
 Server::Impl::Impl(ServerConfig&& config,
@@ -136,6 +141,11 @@ Server::Impl::Impl(ServerConfig&& config,
   ApplyChannelArgs(*server_builder_, config);
   queue_.emplace(static_cast<std::size_t>(config.completion_queue_num),
                  std::ref(*server_builder_));
+  queues_statistics_holder_ = statistics_storage.RegisterWriter(
+      "grpc.server.completion-queues",
+      [this](utils::statistics::Writer& writer) {
+        ugrpc::impl::DumpMetric(writer, queue_->GetQueues());
+      });
 
   if (config.port) AddListeningPort(*config.port);
 }
@@ -202,6 +212,12 @@ grpc::CompletionQueue& Server::Impl::GetCompletionQueue() noexcept {
   return *queue_->GetQueues().queues[0];
 }
 
+const ugrpc::impl::CompletionQueues&
+Server::Impl::GetCompletionQueues() noexcept {
+  UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
+  return queue_->GetQueues();
+}
+
 void Server::Impl::Start() {
   std::lock_guard lock(configuration_mutex_);
   UASSERT(state_ == State::kConfiguration);
@@ -235,6 +251,7 @@ void Server::Impl::Stop() noexcept {
     server_->Shutdown();
   }
   service_workers_.clear();
+  queues_statistics_holder_.Unregister();
   queue_.reset();
   server_.reset();
 
@@ -258,7 +275,7 @@ void Server::Impl::DoStart() {
               "Multiple services have been registered "
               "for the same gRPC method");
   for (auto& worker : service_workers_) {
-    server_builder_->RegisterService(&worker->GetService());
+    worker->Register(*server_builder_);
   }
 
   server_ = server_builder_->BuildAndStart();
@@ -300,6 +317,10 @@ grpc::CompletionQueue& Server::GetCompletionQueue() noexcept {
   return impl_->GetCompletionQueue();
 }
 
+const ugrpc::impl::CompletionQueues& Server::GetCompletionQueues() noexcept {
+  return impl_->GetCompletionQueues();
+}
+
 void Server::Start() { return impl_->Start(); }
 
 int Server::GetPort() const noexcept { return impl_->GetPort(); }
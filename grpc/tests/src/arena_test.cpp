@@ -0,0 +1,41 @@
+#include <userver/utest/utest.hpp>
+
+#include <google/protobuf/arena.h>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class UnitTestArenaService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    EXPECT_EQ(request.GetArena(), &call.GetArena());
+
+    using Response = sample::ugrpc::GreetingResponse;
+    auto& response =
+        *google::protobuf::Arena::CreateMessage<Response>(&call.GetArena());
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+};
+
+}  // namespace
+
+using GrpcServerArenaTest = ugrpc::tests::ServiceFixture<UnitTestArenaService>;
+
+UTEST_F(GrpcServerArenaTest, RequestAndResponseOnArena) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest out;
+  out.set_name("userver");
+
+  sample::ugrpc::GreetingResponse in;
+  UEXPECT_NO_THROW(in = client.SayHello(out).Finish());
+  EXPECT_EQ(in.name(), "Hello userver");
+}
+
+USERVER_NAMESPACE_END
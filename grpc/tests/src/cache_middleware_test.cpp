@@ -0,0 +1,113 @@
+#include <userver/utest/utest.hpp>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utils/async.hpp>
+
+#include <ugrpc/server/middlewares/cache/middleware.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class CountingService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    ++handled;
+    if (block) {
+      handler_started.Send();
+      EXPECT_TRUE(release.WaitForEventFor(utest::kMaxTestWaitTime));
+    }
+    if (request.name() == "fail") {
+      call.FinishWithError({grpc::StatusCode::INTERNAL, "failed"});
+      return;
+    }
+
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.Finish(response);
+  }
+
+  std::atomic<int> handled{0};
+  bool block{false};
+  engine::SingleConsumerEvent handler_started;
+  engine::SingleConsumerEvent release;
+};
+
+class GrpcCacheMiddleware : public ugrpc::tests::ServiceFixtureBase {
+ protected:
+  GrpcCacheMiddleware() {
+    ugrpc::server::middlewares::cache::Middleware::Settings settings;
+    settings.methods.insert("sample.ugrpc.UnitTestService/SayHello");
+    settings.ways = 1;
+    settings.way_size = 16;
+    settings.lifetime = std::chrono::hours{1};
+    AddServerMiddleware(
+        std::make_shared<ugrpc::server::middlewares::cache::Middleware>(
+            std::move(settings)));
+
+    RegisterService(service_);
+    StartServer();
+  }
+
+  ~GrpcCacheMiddleware() override { StopServer(); }
+
+  std::string SayHello(const std::string& name) {
+    auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+    sample::ugrpc::GreetingRequest request;
+    request.set_name(name);
+    return client.SayHello(request).Finish().name();
+  }
+
+  CountingService& GetService() { return service_; }
+
+ private:
+  CountingService service_;
+};
+
+}  // namespace
+
+UTEST_F(GrpcCacheMiddleware, CachesResponses) {
+  EXPECT_EQ(SayHello("userver"), "Hello userver");
+  EXPECT_EQ(SayHello("userver"), "Hello userver");
+  EXPECT_EQ(GetService().handled, 1);
+
+  EXPECT_EQ(SayHello("grpc"), "Hello grpc");
+  EXPECT_EQ(GetService().handled, 2);
+}
+
+UTEST_F(GrpcCacheMiddleware, DoesNotCacheErrors) {
+  UEXPECT_THROW(SayHello("fail"), ugrpc::client::InternalError);
+  UEXPECT_THROW(SayHello("fail"), ugrpc::client::InternalError);
+  EXPECT_EQ(GetService().handled, 2);
+}
+
+UTEST_F_MT(GrpcCacheMiddleware, CoalescesConcurrentCalls, 2) {
+  GetService().block = true;
+
+  std::vector<engine::TaskWithResult<std::string>> tasks;
+  tasks.push_back(utils::Async("first", [&] { return SayHello("userver"); }));
+  ASSERT_TRUE(
+      GetService().handler_started.WaitForEventFor(utest::kMaxTestWaitTime));
+
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(utils::Async("next", [&] { return SayHello("userver"); }));
+  }
+  // Lets the calls reach the server and wait for the first one
+  engine::SleepFor(std::chrono::milliseconds{100});
+  GetService().release.Send();
+
+  for (auto& task : tasks) EXPECT_EQ(task.Get(), "Hello userver");
+  EXPECT_EQ(GetService().handled, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/ugrpc/client/client_factory.hpp>
 
+#include <optional>
+
 #include <userver/engine/task/task.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/yaml/value.hpp>
@@ -42,4 +44,35 @@ UTEST(GrpcClient, ChannelsCount) {
   ASSERT_EQ(kChannelsCount, data.GetChannelToken().GetChannelCount());
 }
 
+UTEST(GrpcClient, LeastLoadedChannel) {
+  ugrpc::client::impl::ChannelCache cache{
+      grpc::InsecureChannelCredentials(), grpc::ChannelArguments{}, 3};
+  const auto token = cache.Get("[::]:50051");
+
+  // Each new call goes to one of the idle channels
+  const auto first = token.StartCall(0);
+  auto second = std::optional{token.StartCall(0)};
+  const auto third = token.StartCall(0);
+  const auto second_index = second->GetChannelIndex();
+  EXPECT_NE(first.GetChannelIndex(), second_index);
+  EXPECT_NE(first.GetChannelIndex(), third.GetChannelIndex());
+  EXPECT_NE(second_index, third.GetChannelIndex());
+
+  second.reset();
+  EXPECT_EQ(token.StartCall(0).GetChannelIndex(), second_index);
+}
+
+UTEST(GrpcClient, GrowingChannelPool) {
+  ugrpc::client::impl::ChannelCache cache{
+      grpc::InsecureChannelCredentials(), grpc::ChannelArguments{}, 3};
+  const auto token = cache.Get("[::]:50051");
+
+  const auto first = token.StartCall(2);
+  const auto second = token.StartCall(2);
+  const auto third = token.StartCall(2);
+  EXPECT_EQ(first.GetChannelIndex(), 0u);
+  EXPECT_EQ(second.GetChannelIndex(), 0u);
+  EXPECT_EQ(third.GetChannelIndex(), 1u);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/ugrpc/byte_buffer_utils.hpp>
+#include <userver/ugrpc/client/generic.hpp>
+#include <userver/ugrpc/server/generic_service_base.hpp>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class GenericGreeter final : public ugrpc::server::GenericServiceBase {
+ public:
+  void Handle(ugrpc::server::GenericCall& call) override {
+    if (call.GetCallName() != "sample.ugrpc.UnitTestService/SayHello") {
+      call.FinishWithError({grpc::StatusCode::UNIMPLEMENTED, "no method"});
+      return;
+    }
+
+    grpc::ByteBuffer raw_request;
+    sample::ugrpc::GreetingRequest request;
+    if (!call.Read(raw_request) ||
+        !ugrpc::ParseFromByteBuffer(raw_request, request)) {
+      call.FinishWithError({grpc::StatusCode::INVALID_ARGUMENT, "bad request"});
+      return;
+    }
+
+    sample::ugrpc::GreetingResponse response;
+    response.set_name("Hello " + request.name());
+    call.WriteAndFinish(ugrpc::SerializeToByteBuffer(response));
+  }
+};
+
+}  // namespace
+
+using GrpcGenericService = ugrpc::tests::ServiceFixture<GenericGreeter>;
+
+UTEST_F(GrpcGenericService, CodegenClient) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  EXPECT_EQ(client.SayHello(request).Finish().name(), "Hello userver");
+}
+
+UTEST_F(GrpcGenericService, GenericClient) {
+    auto client = MakeClient<ugrpc::client::GenericClient>();
+
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  const auto raw_response =
+      client
+          .Unary("sample.ugrpc.UnitTestService/SayHello",
+                 ugrpc::SerializeToByteBuffer(request))
+          .Finish();
+
+  sample::ugrpc::GreetingResponse response;
+  ASSERT_TRUE(ugrpc::ParseFromByteBuffer(raw_response, response));
+  EXPECT_EQ(response.name(), "Hello userver");
+  
+  // The response is only parsed on demand
+  EXPECT_EQ(ugrpc::CopyToString(raw_response), response.SerializeAsString());
+  EXPECT_EQ(ugrpc::CopyPrefix(raw_response, 2),
+            response.SerializeAsString().substr(0, 2));
+}
+
+UTEST_F(GrpcGenericService, GenericStream) {
+  auto client = MakeClient<ugrpc::client::GenericClient>();
+
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("stream");
+  auto call = client.Stream("sample.ugrpc.UnitTestService/SayHello");
+  ASSERT_TRUE(call.Write(ugrpc::SerializeToByteBuffer(request)));
+  ASSERT_TRUE(call.WritesDone());
+
+  grpc::ByteBuffer raw_response;
+  ASSERT_TRUE(call.Read(raw_response));
+  sample::ugrpc::GreetingResponse response;
+  ASSERT_TRUE(ugrpc::ParseFromByteBuffer(raw_response, response));
+  EXPECT_EQ(response.name(), "Hello stream");
+  EXPECT_FALSE(call.Read(raw_response));
+}
+
+USERVER_NAMESPACE_END
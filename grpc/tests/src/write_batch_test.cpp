@@ -0,0 +1,110 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service_fixtures.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr int kBatchSize = 10;
+
+std::vector<sample::ugrpc::StreamGreetingResponse> MakeResponses(
+    const std::string& name, int count) {
+  std::vector<sample::ugrpc::StreamGreetingResponse> responses(count);
+  for (int i = 0; i < count; ++i) {
+    responses[i].set_name("Hello " + name);
+    responses[i].set_number(i);
+  }
+  return responses;
+}
+
+class UnitTestBatchService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    call.WriteBatch(MakeResponses(request.name(), request.number()));
+    call.Finish();
+  }
+
+  void WriteMany(WriteManyCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    int count = 0;
+    while (call.Read(request)) {
+      EXPECT_EQ(request.number(), count);
+      ++count;
+    }
+    sample::ugrpc::StreamGreetingResponse response;
+    response.set_number(count);
+    call.Finish(response);
+  }
+
+  void Chat(ChatCall& call) override {
+    sample::ugrpc::StreamGreetingRequest request;
+    while (call.Read(request)) {
+      call.WriteBatch(MakeResponses(request.name(), request.number()));
+    }
+    call.Finish();
+  }
+};
+
+std::vector<sample::ugrpc::StreamGreetingRequest> MakeRequests(int count) {
+  std::vector<sample::ugrpc::StreamGreetingRequest> requests(count);
+  for (int i = 0; i < count; ++i) requests[i].set_number(i);
+  return requests;
+}
+
+}  // namespace
+
+using GrpcWriteBatchTest = ugrpc::tests::ServiceFixture<UnitTestBatchService>;
+
+UTEST_F(GrpcWriteBatchTest, ServerOutputStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::StreamGreetingRequest out;
+  out.set_name("userver");
+  out.set_number(kBatchSize);
+  auto is = client.ReadMany(out);
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kBatchSize; ++i) {
+    ASSERT_TRUE(is.Read(in));
+    EXPECT_EQ(in.number(), i);
+    EXPECT_EQ(in.name(), "Hello userver");
+  }
+  EXPECT_FALSE(is.Read(in));
+}
+
+UTEST_F(GrpcWriteBatchTest, ClientOutputStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto os = client.WriteMany();
+
+  EXPECT_TRUE(os.WriteBatch(MakeRequests(kBatchSize)));
+  EXPECT_TRUE(os.WriteBatch({}));
+
+  sample::ugrpc::StreamGreetingResponse in;
+  UEXPECT_NO_THROW(in = os.Finish());
+  EXPECT_EQ(in.number(), kBatchSize);
+}
+
+UTEST_F(GrpcWriteBatchTest, BidirectionalStream) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  auto bs = client.Chat();
+
+  sample::ugrpc::StreamGreetingRequest out;
+  out.set_name("userver");
+  out.set_number(kBatchSize);
+  ASSERT_TRUE(bs.Write(out));
+
+  sample::ugrpc::StreamGreetingResponse in;
+  for (int i = 0; i < kBatchSize; ++i) {
+    ASSERT_TRUE(bs.Read(in));
+    EXPECT_EQ(in.number(), i);
+  }
+  ASSERT_TRUE(bs.WritesDone());
+  EXPECT_FALSE(bs.Read(in));
+}
+
+USERVER_NAMESPACE_END
@@ -4,17 +4,32 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include <userver/cache/cache_statistics.hpp>
 #include <userver/cache/caching_component_base.hpp>
+#include <userver/cache/mongo_cache_change_stream.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
+#include <userver/cache/persistent_map.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/dump/common.hpp>
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/operations.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 #include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/serialize.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
@@ -77,7 +92,9 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   static constexpr auto kKeyField = &CachedObject::name;
 ///   // Type of kKeyField
 ///   using KeyType = std::string;
-///   // Type of cache map, e.g. unordered_map, map, bimap
+///   // Type of cache map, e.g. unordered_map, map, bimap.
+///   // cache::PersistentMap makes the copying of the previous snapshot on
+///   // incremental updates O(1).
 ///   using DataType = std::unordered_map<KeyType, ObjectType>;
 ///
 ///   // Whether the cache prefers to read from replica (if true, you might get stale data)
@@ -92,6 +109,14 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   // (default implementation calls doc.As<ObjectType>())
 ///   // For using default implementation
 ///   static constexpr bool kUseDefaultDeserializeObject = true;
+///   // or deserialize from a view that borrows the cursor batch, the
+///   // document is not copied and no value tree is built. Takes precedence
+///   // over DeserializeObject.
+///   static ObjectType DeserializeObjectView(formats::bson::DocumentView doc) {
+///     CachedObjectVisitor visitor;
+///     doc.Visit(visitor);
+///     return visitor.Extract();
+///   }
 ///
 ///   // Optional function that overrides data retrieval operation
 ///   static storages::mongo::operations::Find GetFindOperation(
@@ -111,11 +136,30 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 ///   // Whether update part of the cache even if failed to parse some documents
 ///   static constexpr bool kAreInvalidDocumentsSkipped = false;
 ///
+///   // Whether incremental updates read a change stream of the collection
+///   // instead of querying it (optional, see below)
+///   static constexpr bool kUseChangeStream = true;
+///
 ///   // Component to get the collections
 ///   using MongoCollectionsComponent = components::MongoCollections;
 /// };
 /// ```
 
+///
+/// ### Change streams
+/// With `kUseChangeStream` the cache opens a change stream of the collection
+/// on full updates. Incremental updates apply the inserts, updates and
+/// deletions that have arrived since the previous update instead of querying
+/// the collection, so a short update-interval is cheap. The stream holds a
+/// pool connection and requires a replica set.
+///
+/// The stream is resumed after errors from the position of the current
+/// snapshot, which is also saved in the cache dumps. If it cannot be resumed
+/// (or the collection was dropped or renamed), incremental updates fall back
+/// to the queries by kMongoUpdateFieldName or GetFindOperation until the next
+/// full update, the deletions are only noticed by full updates then. Without
+/// them the collection is reread instead.
+
 // clang-format on
 
 template <class MongoCacheTraits>
@@ -134,11 +178,47 @@ class MongoCache
   static yaml_config::Schema GetStaticConfigSchema();
 
  private:
+  using DataType = typename MongoCacheTraits::DataType;
+  using KeyType = typename MongoCacheTraits::KeyType;
+
+  static constexpr bool kUseChangeStream =
+      mongo_cache::impl::IsChangeStreamUsed<MongoCacheTraits>();
+
+  // Position of a cache snapshot in the change stream
+  struct ChangeStreamState {
+    std::optional<formats::bson::Document> resume_token;
+    // keys of the cached objects by the change event ids of their documents
+    cache::PersistentMap<std::string, KeyType> keys;
+  };
+
   void Update(cache::UpdateType type,
               const std::chrono::system_clock::time_point& last_update,
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
+  bool UpdateFromChangeStream(cache::UpdateStatisticsScope& stats_scope);
+
+  std::optional<formats::bson::Document> OpenChangeStream();
+
+  void SetWithChangeStreamState(std::unique_ptr<DataType> data,
+                                ChangeStreamState&& state);
+
+  void RememberChangeStreamState(
+      const DataType* data,
+      std::shared_ptr<const ChangeStreamState> state) const;
+
+  std::shared_ptr<const ChangeStreamState> FindChangeStreamState(
+      const DataType* data) const;
+
+  void WriteContents(dump::Writer& writer,
+                     const DataType& contents) const override;
+
+  std::unique_ptr<const DataType> ReadContents(
+      dump::Reader& reader) const override;
+
+  typename MongoCacheTraits::ObjectType DeserializeObject(
+      const storages::mongo::Cursor::Iterator& it) const;
+
   typename MongoCacheTraits::ObjectType DeserializeObject(
       const formats::bson::Document& doc) const;
 
@@ -155,6 +235,13 @@ class MongoCache
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
   std::size_t cpu_relax_iterations_{0};
+
+  std::optional<mongo_cache::impl::ChangeStreamReader> change_stream_;
+  mutable engine::Mutex change_stream_states_mutex_;
+  // states of the recent snapshots, the dumps look up theirs here
+  mutable std::vector<
+      std::pair<const DataType*, std::shared_ptr<const ChangeStreamState>>>
+      change_stream_states_;
 };
 
 template <class MongoCacheTraits>
@@ -179,6 +266,7 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
   if (CachingComponentBase<
           typename MongoCacheTraits::DataType>::GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
+      !kUseChangeStream &&
       !mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
       !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
     throw std::logic_error(
@@ -193,6 +281,11 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
         components::GetCurrentComponentName(config) + "' cache");
   }
 
+  if constexpr (kUseChangeStream) {
+    change_stream_.emplace(std::string{kName}, *mongo_collection_,
+                           MongoCacheTraits::kIsSecondaryPreferred);
+  }
+
   this->StartPeriodicUpdates();
 }
 
@@ -209,6 +302,20 @@ void MongoCache<MongoCacheTraits>::Update(
     cache::UpdateStatisticsScope& stats_scope) {
   namespace sm = storages::mongo;
 
+  std::optional<formats::bson::Document> resume_token;
+  if constexpr (kUseChangeStream) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (UpdateFromChangeStream(stats_scope)) return;
+      if constexpr (!mongo_cache::impl::kHasUpdateFieldName<MongoCacheTraits> &&
+                    !mongo_cache::impl::kHasFindOperation<MongoCacheTraits>) {
+        // Nothing to poll by, the collection is reread
+        type = cache::UpdateType::kFull;
+      }
+    }
+    // The events that happen during the reading are applied afterwards
+    if (type == cache::UpdateType::kFull) resume_token = OpenChangeStream();
+  }
+
   const auto* collection = mongo_collection_;
   auto find_op = GetFindOperation(type, last_update, now, correction_);
   auto cursor = collection->Execute(find_op);
@@ -221,6 +328,14 @@ void MongoCache<MongoCacheTraits>::Update(
 
   auto scope = tracing::Span::CurrentSpan().CreateScopeTime("copy_data");
   auto new_cache = GetData(type);
+  cache::PersistentMap<std::string, KeyType> keys;
+  if constexpr (kUseChangeStream) {
+    if (type == cache::UpdateType::kIncremental) {
+      if (const auto state = FindChangeStreamState(this->Get().Get())) {
+        keys = state->keys;
+      }
+    }
+  }
 
   // No good way to identify whether cursor accesses DB or reads buffed data
   scope.Reset(kFetchAndParseStage);
@@ -228,7 +343,7 @@ void MongoCache<MongoCacheTraits>::Update(
   utils::CpuRelax relax{cpu_relax_iterations_, &scope};
   std::size_t doc_count = 0;
 
-  for (const auto& doc : cursor) {
+  for (auto it = cursor.begin(); it != cursor.end(); ++it) {
     ++doc_count;
 
     relax.Relax();
@@ -236,11 +351,19 @@ void MongoCache<MongoCacheTraits>::Update(
     stats_scope.IncreaseDocumentsReadCount(1);
 
     try {
-      auto object = DeserializeObject(doc);
+      auto object = DeserializeObject(it);
       auto key = (object.*MongoCacheTraits::kKeyField);
 
       if (type == cache::UpdateType::kIncremental ||
           new_cache->count(key) == 0) {
+        if constexpr (kUseChangeStream) {
+          auto id = mongo_cache::impl::GetChangeEventId(*it);
+          const auto old_key = keys.find(id);
+          if (old_key != keys.end() && !(old_key->second == key)) {
+            new_cache->erase(old_key->second);
+          }
+          keys.insert_or_assign(std::move(id), key);
+        }
         (*new_cache)[key] = std::move(object);
       } else {
         LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
@@ -249,7 +372,7 @@ void MongoCache<MongoCacheTraits>::Update(
     } catch (const std::exception& e) {
       LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
                           << MongoCacheTraits::kName << ", _id="
-                          << doc["_id"].template ConvertTo<std::string>()
+                          << (*it)["_id"].template ConvertTo<std::string>()
                           << ", what(): " << e;
       stats_scope.IncreaseDocumentsParseFailures(1);
 
@@ -270,19 +393,217 @@ void MongoCache<MongoCacheTraits>::Update(
   scope.Reset();
 
   const auto size = new_cache->size();
-  this->Set(std::move(new_cache));
+  if constexpr (kUseChangeStream) {
+    // A stream that could not be resumed is only reopened by a full update
+    SetWithChangeStreamState(
+        std::move(new_cache),
+        ChangeStreamState{std::move(resume_token), std::move(keys)});
+  } else {
+    this->Set(std::move(new_cache));
+  }
   stats_scope.Finish(size);
 }
 
+template <class MongoCacheTraits>
+bool MongoCache<MongoCacheTraits>::UpdateFromChangeStream(
+    cache::UpdateStatisticsScope& stats_scope) {
+  const auto state = FindChangeStreamState(this->Get().Get());
+  if (!state) return false;
+
+  if (!change_stream_->IsOpen()) {
+    if (!state->resume_token) return false;
+    try {
+      change_stream_->Open(state->resume_token);
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to resume the change stream of cache "
+                    << MongoCacheTraits::kName
+                    << ", polling until the next full update: " << ex;
+      return false;
+    }
+  }
+
+  auto batch = change_stream_->ReadAvailable();
+  if (batch.is_invalidated) return false;
+  if (batch.events.empty()) {
+    LOG_INFO() << "No changes in cache " << MongoCacheTraits::kName;
+    stats_scope.FinishNoChanges();
+    return true;
+  }
+
+  auto scope = tracing::Span::CurrentSpan().CreateScopeTime("copy_data");
+  auto new_cache = GetData(cache::UpdateType::kIncremental);
+  auto keys = state->keys;
+
+  scope.Reset(kFetchAndParseStage);
+
+  for (auto& event : batch.events) {
+    stats_scope.IncreaseDocumentsReadCount(1);
+
+    std::optional<typename MongoCacheTraits::ObjectType> object;
+    if (event.document) {
+      try {
+        object = DeserializeObject(*event.document);
+      } catch (const std::exception& e) {
+        LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                            << MongoCacheTraits::kName << ", _id=" << event.id
+                            << ", what(): " << e;
+        stats_scope.IncreaseDocumentsParseFailures(1);
+
+        if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) {
+          // The events are read again by the next update
+          change_stream_->Close();
+          throw;
+        }
+        continue;
+      }
+    }
+
+    if (const auto old_key = keys.find(event.id); old_key != keys.end()) {
+      new_cache->erase(old_key->second);
+      keys.erase(event.id);
+    }
+    if (object) {
+      auto key = ((*object).*MongoCacheTraits::kKeyField);
+      keys.insert_or_assign(std::move(event.id), key);
+      (*new_cache)[key] = std::move(*object);
+    }
+  }
+
+  scope.Reset();
+
+  const auto size = new_cache->size();
+  if (!batch.resume_token) batch.resume_token = state->resume_token;
+  SetWithChangeStreamState(
+      std::move(new_cache),
+      ChangeStreamState{std::move(batch.resume_token), std::move(keys)});
+  stats_scope.Finish(size);
+  return true;
+}
+
+template <class MongoCacheTraits>
+std::optional<formats::bson::Document>
+MongoCache<MongoCacheTraits>::OpenChangeStream() {
+  try {
+    change_stream_->Open(std::nullopt);
+    return change_stream_->GetResumeToken();
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to open the change stream of cache "
+                  << MongoCacheTraits::kName
+                  << ", polling until the next full update: " << ex;
+    return std::nullopt;
+  }
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::SetWithChangeStreamState(
+    std::unique_ptr<DataType> data, ChangeStreamState&& state) {
+  RememberChangeStreamState(
+      data.get(), std::make_shared<const ChangeStreamState>(std::move(state)));
+  this->Set(std::move(data));
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::RememberChangeStreamState(
+    const DataType* data,
+    std::shared_ptr<const ChangeStreamState> state) const {
+  // The dumps take the snapshot right before writing it
+  constexpr std::size_t kMaxStates = 2;
+
+  std::lock_guard lock(change_stream_states_mutex_);
+  if (change_stream_states_.size() == kMaxStates) {
+    change_stream_states_.erase(change_stream_states_.begin());
+  }
+  change_stream_states_.emplace_back(data, std::move(state));
+}
+
+template <class MongoCacheTraits>
+auto MongoCache<MongoCacheTraits>::FindChangeStreamState(
+    const DataType* data) const -> std::shared_ptr<const ChangeStreamState> {
+  std::lock_guard lock(change_stream_states_mutex_);
+  for (const auto& [state_data, state] : change_stream_states_) {
+    if (state_data == data) return state;
+  }
+  return nullptr;
+}
+
+template <class MongoCacheTraits>
+void MongoCache<MongoCacheTraits>::WriteContents(
+    dump::Writer& writer, const DataType& contents) const {
+  CachingComponentBase<DataType>::WriteContents(writer, contents);
+
+  if constexpr (kUseChangeStream && dump::kIsDumpable<DataType>) {
+    const auto state = FindChangeStreamState(&contents);
+    std::optional<std::string> resume_token;
+    if (state && state->resume_token) {
+      resume_token =
+          formats::bson::ToCanonicalJsonString(*state->resume_token);
+    }
+    writer.Write(resume_token);
+
+    writer.Write(state ? state->keys.size() : std::size_t{0});
+    if (state) {
+      for (const auto& [id, key] : state->keys) {
+        writer.Write(id);
+        writer.Write(key);
+      }
+    }
+  }
+}
+
+template <class MongoCacheTraits>
+auto MongoCache<MongoCacheTraits>::ReadContents(dump::Reader& reader) const
+    -> std::unique_ptr<const DataType> {
+  auto contents = CachingComponentBase<DataType>::ReadContents(reader);
+
+  if constexpr (kUseChangeStream && dump::kIsDumpable<DataType>) {
+    ChangeStreamState state;
+    if (auto resume_token = reader.Read<std::optional<std::string>>()) {
+      state.resume_token = formats::bson::FromJsonString(*resume_token);
+    }
+
+    const auto size = reader.Read<std::size_t>();
+    for (std::size_t i = 0; i < size; ++i) {
+      auto id = reader.Read<std::string>();
+      state.keys.insert_or_assign(std::move(id), reader.Read<KeyType>());
+    }
+    RememberChangeStreamState(
+        contents.get(),
+        std::make_shared<const ChangeStreamState>(std::move(state)));
+  }
+  return contents;
+}
+
 template <class MongoCacheTraits>
 typename MongoCacheTraits::ObjectType
 MongoCache<MongoCacheTraits>::DeserializeObject(
-    const formats::bson::Document& doc) const {
-  if constexpr (mongo_cache::impl::kHasDeserializeObject<MongoCacheTraits>) {
-    return MongoCacheTraits::DeserializeObject(doc);
+    const storages::mongo::Cursor::Iterator& it) const {
+  if constexpr (mongo_cache::impl::kHasDeserializeObjectView<
+                    MongoCacheTraits>) {
+    return MongoCacheTraits::DeserializeObjectView(it.GetView());
+  } else if constexpr (mongo_cache::impl::kHasDeserializeObject<
+                           MongoCacheTraits>) {
+    return MongoCacheTraits::DeserializeObject(*it);
+  } else if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<
+                           MongoCacheTraits>) {
+    return it->As<typename MongoCacheTraits::ObjectType>();
   }
-  if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<
+  UASSERT_MSG(false,
+              "No deserialize operation defined but DeserializeObject invoked");
+}
+
+template <class MongoCacheTraits>
+typename MongoCacheTraits::ObjectType
+MongoCache<MongoCacheTraits>::DeserializeObject(
+    const formats::bson::Document& doc) const {
+  if constexpr (mongo_cache::impl::kHasDeserializeObjectView<
                     MongoCacheTraits>) {
+    return MongoCacheTraits::DeserializeObjectView(
+        formats::bson::DocumentView(doc));
+  } else if constexpr (mongo_cache::impl::kHasDeserializeObject<
+                           MongoCacheTraits>) {
+    return MongoCacheTraits::DeserializeObject(doc);
+  } else if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<
+                           MongoCacheTraits>) {
     return doc.As<typename MongoCacheTraits::ObjectType>();
   }
   UASSERT_MSG(false,
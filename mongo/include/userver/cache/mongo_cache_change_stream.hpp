@@ -0,0 +1,63 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
+#include <userver/storages/mongo/collection.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace mongo_cache::impl {
+
+struct ChangeEvent {
+  // id of the changed document, see GetChangeEventId
+  std::string id;
+  // current version of the document, missing for deletions
+  std::optional<formats::bson::Document> document;
+};
+
+struct ChangeBatch {
+  std::vector<ChangeEvent> events;
+  // resumes the stream after the events, if known
+  std::optional<formats::bson::Document> resume_token;
+  // the collection was dropped or renamed, the stream cannot be resumed
+  bool is_invalidated{false};
+};
+
+// Identifies a document in the change events by its `_id`
+std::string GetChangeEventId(const formats::bson::Document& document);
+
+// Keeps a change stream of the cached collection open between the updates
+class ChangeStreamReader final {
+ public:
+  ChangeStreamReader(std::string cache_name,
+                     const storages::mongo::Collection& collection,
+                     bool is_secondary_preferred);
+
+  // Opens the stream after the token or from now on, throws on errors
+  void Open(const std::optional<formats::bson::Document>& resume_token);
+
+  void Close() noexcept;
+
+  bool IsOpen() const;
+
+  // Token of the current position of the open stream, if known
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+  // Reads all the events available now. On errors the stream is closed and
+  // the events read so far are returned.
+  ChangeBatch ReadAvailable();
+
+ private:
+  const std::string cache_name_;
+  const storages::mongo::Collection& collection_;
+  const bool is_secondary_preferred_;
+  std::optional<storages::mongo::ChangeStream> stream_;
+};
+
+}  // namespace mongo_cache::impl
+
+USERVER_NAMESPACE_END
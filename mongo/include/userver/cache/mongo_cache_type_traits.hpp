@@ -11,7 +11,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::bson {
 class Document;
-}
+class DocumentView;
+}  // namespace formats::bson
 
 namespace storages::mongo::operations {
 class Find;
@@ -63,6 +64,21 @@ template <typename T>
 inline constexpr bool kHasCorrectDeserializeObject =
     meta::kIsDetected<HasCorrectDeserializeObject, T>;
 
+template <typename T>
+using HasDeserializeObjectView = decltype(T::DeserializeObjectView);
+template <typename T>
+inline constexpr bool kHasDeserializeObjectView =
+    meta::kIsDetected<HasDeserializeObjectView, T>;
+
+template <typename T>
+using HasCorrectDeserializeObjectView =
+    meta::ExpectSame<typename T::ObjectType,
+                     decltype(std::declval<const T&>().DeserializeObjectView(
+                         std::declval<formats::bson::DocumentView>()))>;
+template <typename T>
+inline constexpr bool kHasCorrectDeserializeObjectView =
+    meta::kIsDetected<HasCorrectDeserializeObjectView, T>;
+
 template <typename T>
 using HasDefaultDeserializeObject = decltype(T::kUseDefaultDeserializeObject);
 template <typename T>
@@ -94,6 +110,20 @@ template <typename T>
 inline constexpr bool kHasDefaultFindOperation =
     meta::kIsDetected<HasDefaultFindOperation, T>;
 
+template <typename T>
+using HasChangeStream = decltype(T::kUseChangeStream);
+template <typename T>
+inline constexpr bool kHasChangeStream = meta::kIsDetected<HasChangeStream, T>;
+
+template <typename T>
+constexpr bool IsChangeStreamUsed() {
+  if constexpr (kHasChangeStream<T>) {
+    return T::kUseChangeStream;
+  } else {
+    return false;
+  }
+}
+
 template <typename T>
 using HasInvalidDocumentsSkipped = decltype(T::kAreInvalidDocumentsSkipped);
 template <typename T>
@@ -122,6 +152,13 @@ struct CheckTraits {
           "Mongo cache traits must specify kUseDefaultDeserializeObject as "
           "bool");
     }
+    if constexpr (kHasChangeStream<MongoCacheTraits>) {
+      static_assert(
+          std::is_same_v<
+              std::decay_t<decltype(MongoCacheTraits::kUseChangeStream)>,
+              bool>,
+          "Mongo cache traits must specify kUseChangeStream as bool");
+    }
     if constexpr (kHasDefaultFindOperation<MongoCacheTraits>) {
       static_assert(
           std::is_same_v<
@@ -169,6 +206,7 @@ struct CheckTraits {
                 "const std::chrono::system_clock::duration& correction)");
 
   static_assert(kHasDeserializeObject<MongoCacheTraits> ||
+                    kHasDeserializeObjectView<MongoCacheTraits> ||
                     kHasDefaultDeserializeObject<MongoCacheTraits>,
                 "Mongo cache traits must specify deserialize object");
   static_assert(
@@ -178,6 +216,13 @@ struct CheckTraits {
       "signature and return value type: "
       "static ObjectType DeserializeObject(const formats::bson::Document& "
       "doc)");
+  static_assert(
+      !kHasDeserializeObjectView<MongoCacheTraits> ||
+          kHasCorrectDeserializeObjectView<MongoCacheTraits>,
+      "Mongo cache traits must specify deserialize object view with correct "
+      "signature and return value type: "
+      "static ObjectType DeserializeObjectView(formats::bson::DocumentView "
+      "doc)");
 };
 
 }  // namespace mongo_cache::impl
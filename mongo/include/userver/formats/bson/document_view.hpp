@@ -0,0 +1,97 @@
+#pragma once
+
+/// @file userver/formats/bson/document_view.hpp
+/// @brief @copybrief formats::bson::DocumentView
+
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+class FieldVisitor;
+
+/// @brief Non-owning view of a serialized BSON document
+///
+/// Unlike formats::bson::Document, the view neither copies the data nor builds
+/// a tree of values. Fields are read sequentially with a FieldVisitor.
+///
+/// @warning The view is only valid while the underlying buffer is alive,
+/// e.g. a view obtained from a storages::mongo::Cursor is invalidated when the
+/// cursor is advanced.
+class DocumentView {
+ public:
+  /// Constructs a view of the document
+  explicit DocumentView(const Document& doc);
+
+  /// @cond
+  /// Constructor from raw BSON data, internal use only
+  DocumentView(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  /// Constructor from native type, internal use only
+  explicit DocumentView(const bson_t* bson);
+  /// @endcond
+
+  /// @brief Calls the visitor for each field of the document in order
+  /// @throws ParseException if the document is malformed
+  void Visit(FieldVisitor& visitor) const;
+
+  /// Returns an owned copy of the document
+  Document Copy() const;
+
+  /// @name Raw data access
+  /// @{
+  const uint8_t* Data() const { return data_; }
+  size_t Size() const { return size_; }
+  /// @}
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+};
+
+// clang-format off
+
+/// @brief SAX-like visitor of DocumentView fields
+///
+/// Embedded documents and arrays are passed as views, the keys of array
+/// elements are their indices. All the callbacks do nothing by default,
+/// override only the ones for the expected fields.
+///
+/// @warning Keys, strings and nested views are only valid during the call.
+///
+/// ## Example usage:
+///
+/// @snippet formats/bson/document_view_test.cpp  Sample formats::bson::FieldVisitor usage
+
+// clang-format on
+
+class FieldVisitor {
+ public:
+  virtual ~FieldVisitor();
+
+  virtual void Null(std::string_view key);
+  virtual void Bool(std::string_view key, bool value);
+  /// Called for both int32 and int64 fields
+  virtual void Int64(std::string_view key, int64_t value);
+  virtual void Double(std::string_view key, double value);
+  virtual void String(std::string_view key, std::string_view value);
+  virtual void ObjectId(std::string_view key, const Oid& value);
+  virtual void DateTime(std::string_view key,
+                        std::chrono::system_clock::time_point value);
+  virtual void Object(std::string_view key, DocumentView value);
+  virtual void Array(std::string_view key, DocumentView value);
+
+  /// @brief Called for the fields of the other types
+  /// @note The value is copied, these fields are not expected to be hot.
+  virtual void Other(std::string_view key, const Value& value);
+};
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 /// @brief Include-all header for MongoDB client
 
 #include <userver/storages/mongo/bulk.hpp>
+#include <userver/storages/mongo/change_stream.hpp>
 #include <userver/storages/mongo/collection.hpp>
 #include <userver/storages/mongo/cursor.hpp>
 #include <userver/storages/mongo/exception.hpp>
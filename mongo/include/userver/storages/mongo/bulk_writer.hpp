@@ -0,0 +1,150 @@
+#pragma once
+
+/// @file userver/storages/mongo/bulk_writer.hpp
+/// @brief @copybrief storages::mongo::BulkWriter
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <variant>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/storages/mongo/bulk_ops.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/options.hpp>
+#include <userver/utils/periodic_task.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// @brief Splits a large stream of write operations into unordered bulks and
+/// executes several of them concurrently on separate pool connections.
+///
+/// A bulk is sent once it has `max_batch_size` operations or once it has
+/// waited for `max_batch_delay`. At most `max_in_flight` bulks are executed at
+/// a time, appending operations blocks until one of them finishes. Server
+/// errors of individual operations (e.g. duplicate keys) are counted in the
+/// result, a bulk that failed as a whole (e.g. on a network error) is retried
+/// up to `max_attempts` times.
+///
+/// As the bulks are unordered, the operations of different bulks may be
+/// applied in any order.
+///
+/// The methods may be called concurrently. Call Finish() to wait for all the
+/// operations, the destructor waits for the bulks in flight but drops the
+/// operations that were not sent yet.
+///
+/// ## Example:
+/// @code
+/// storages::mongo::BulkWriter writer(pool->GetCollection("items"), {});
+/// for (const auto& item : items) {
+///   writer.Append(storages::mongo::bulk_ops::InsertOne(MakeDoc(item)));
+/// }
+/// const auto result = writer.Finish();
+/// @endcode
+class BulkWriter final {
+ public:
+  struct Settings {
+    /// Max number of operations in a bulk
+    std::size_t max_batch_size{1000};
+
+    /// Max time an operation waits for its bulk to fill up, zero disables
+    /// the time based sending
+    std::chrono::milliseconds max_batch_delay{100};
+
+    /// Max number of bulks executed concurrently
+    std::size_t max_in_flight{4};
+
+    /// Max number of attempts to execute a bulk
+    std::size_t max_attempts{3};
+
+    /// Write concern of the bulks, the collection default if not set
+    std::optional<options::WriteConcern> write_concern;
+  };
+
+  /// Aggregated results of the executed bulks
+  struct Result {
+    /// @name Affected document counters
+    /// @{
+    std::size_t inserted{0};
+    std::size_t matched{0};
+    std::size_t modified{0};
+    std::size_t upserted{0};
+    std::size_t deleted{0};
+    /// @}
+
+    /// Number of operations rejected by the server
+    std::size_t server_errors{0};
+
+    /// Number of write concern errors
+    std::size_t write_concern_errors{0};
+
+    /// Number of bulks that failed all of the attempts
+    std::size_t failed_batches{0};
+
+    /// Number of operations in the failed bulks
+    std::size_t failed_operations{0};
+  };
+
+  BulkWriter(Collection collection, Settings settings);
+
+  BulkWriter(const BulkWriter&) = delete;
+  BulkWriter& operator=(const BulkWriter&) = delete;
+
+  ~BulkWriter();
+
+  /// @name Operation appenders
+  /// @{
+  void Append(bulk_ops::InsertOne operation);
+  void Append(bulk_ops::ReplaceOne operation);
+  void Append(bulk_ops::Update operation);
+  void Append(bulk_ops::Delete operation);
+  /// @}
+
+  /// Inserts a single document
+  void InsertOne(formats::bson::Document document);
+
+  /// Sends the appended operations without waiting for the bulk to fill up
+  void Flush();
+
+  /// @brief Sends the appended operations and waits for all the bulks
+  /// @returns the results of all the bulks executed by this writer
+  Result Finish();
+
+  /// Returns the results of the bulks executed so far
+  Result GetResult() const;
+
+ private:
+  using Operation = std::variant<bulk_ops::InsertOne, bulk_ops::ReplaceOne,
+                                 bulk_ops::Update, bulk_ops::Delete>;
+  using Batch = std::vector<Operation>;
+
+  void DoAppend(Operation&& operation);
+  void SendPending(std::unique_lock<engine::Mutex>& lock);
+  void Execute(const Batch& batch);
+  void WaitInFlight();
+
+  Collection collection_;
+  const Settings settings_;
+
+  engine::Semaphore in_flight_semaphore_;
+
+  engine::Mutex mutex_;
+  Batch pending_;
+  std::vector<engine::TaskWithResult<void>> in_flight_;
+
+  mutable engine::Mutex result_mutex_;
+  Result result_;
+
+  utils::PeriodicTask flush_task_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+/// @file userver/storages/mongo/change_stream.hpp
+/// @brief @copybrief storages::mongo::ChangeStream
+
+#include <memory>
+#include <optional>
+
+#include <userver/formats/bson/document.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+namespace impl {
+class ChangeStreamImpl;
+}  // namespace impl
+
+/// @brief Interface for MongoDB change streams
+///
+/// The stream holds a pool connection for its whole lifetime. After an error
+/// the stream cannot be used anymore, open a new one with
+/// storages::mongo::options::ResumeAfter to continue after the last event.
+///
+/// @see https://www.mongodb.com/docs/manual/changeStreams/
+class ChangeStream {
+ public:
+  explicit ChangeStream(std::unique_ptr<impl::ChangeStreamImpl>&&);
+  ~ChangeStream();
+
+  ChangeStream(ChangeStream&&) noexcept;
+  ChangeStream& operator=(ChangeStream&&) noexcept;
+
+  /// @brief Waits for the next change event
+  /// @returns the event or `std::nullopt` if there were no changes during
+  /// storages::mongo::options::MaxAwaitTime
+  /// @throws MongoException on errors
+  std::optional<formats::bson::Document> Next();
+
+  /// @brief Returns the token to resume the stream after the last returned
+  /// event, if any
+  std::optional<formats::bson::Document> GetResumeToken() const;
+
+ private:
+  std::unique_ptr<impl::ChangeStreamImpl> impl_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
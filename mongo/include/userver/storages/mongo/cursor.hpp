@@ -7,6 +7,7 @@
 #include <memory>
 
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -48,6 +49,10 @@ class Cursor {
     reference operator*() const;
     pointer operator->() const;
 
+    /// @brief Returns a view of the current document without copying it
+    /// @warning The view is invalidated when the iterator is advanced.
+    formats::bson::DocumentView GetView() const;
+
     bool operator==(const Iterator&) const;
     bool operator!=(const Iterator&) const;
 
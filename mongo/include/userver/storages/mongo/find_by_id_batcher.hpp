@@ -0,0 +1,98 @@
+#pragma once
+
+/// @file userver/storages/mongo/find_by_id_batcher.hpp
+/// @brief @copybrief storages::mongo::FindByIdBatcher
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/value.hpp>
+#include <userver/storages/mongo/collection.hpp>
+#include <userver/storages/mongo/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+/// @brief Merges concurrent lookups of documents by `_id` into shared
+/// `{_id: {$in: [...]}}` queries.
+///
+/// The first caller of a batch waits up to `max_batch_delay` for other callers
+/// to join it, then executes a single query for all of the collected ids and
+/// hands the found documents out. A batch is sent without waiting once it has
+/// `max_batch_size` ids. This trades a small latency increase for far fewer
+/// queries and pool connections in lookup-heavy services.
+///
+/// The query of a batch is executed by its first caller and is not interrupted
+/// by the cancellation of that caller, the other callers stop waiting on their
+/// cancellation. An error of the query is rethrown to all the callers of the
+/// batch.
+///
+/// @note The projection, if any, must keep the `_id` field.
+///
+/// ## Example:
+/// @code
+/// storages::mongo::FindByIdBatcher batcher(pool->GetCollection("items"), {});
+/// const auto id_value = formats::bson::ValueBuilder(id).ExtractValue();
+/// auto item = batcher.FindById(id_value);
+/// @endcode
+class FindByIdBatcher final {
+ public:
+  struct Settings {
+    /// Max number of ids in a query
+    std::size_t max_batch_size{100};
+
+    /// Max time the first caller of a batch waits for the others
+    std::chrono::microseconds max_batch_delay{500};
+
+    /// Read preference of the queries, the collection default if not set
+    std::optional<options::ReadPreference> read_preference;
+
+    /// Projection of the found documents
+    std::optional<options::Projection> projection;
+  };
+
+  FindByIdBatcher(Collection collection, Settings settings);
+
+  FindByIdBatcher(const FindByIdBatcher&) = delete;
+  FindByIdBatcher& operator=(const FindByIdBatcher&) = delete;
+
+  ~FindByIdBatcher();
+
+  /// @brief Finds a document by its `_id`
+  /// @returns the document or `std::nullopt` if there is none
+  /// @throws CancelledException if the caller is cancelled while waiting for
+  /// the batch
+  std::optional<formats::bson::Document> FindById(
+      const formats::bson::Value& id);
+
+ private:
+  struct Batch {
+    std::vector<formats::bson::Value> ids;
+    std::unordered_map<std::string, formats::bson::Document> found;
+    std::exception_ptr error;
+    bool is_done{false};
+  };
+
+  void Execute(Batch& batch) const;
+
+  const Collection collection_;
+  const Settings settings_;
+
+  engine::Mutex mutex_;
+  engine::ConditionVariable cv_;
+  std::shared_ptr<Batch> pending_;
+};
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
@@ -90,11 +90,13 @@ class Find {
   void SetOption(options::ReadConcern);
   void SetOption(options::Skip);
   void SetOption(options::Limit);
+  void SetOption(options::BatchSize);
   void SetOption(options::Projection);
   void SetOption(const options::Sort&);
   void SetOption(const options::Hint&);
   void SetOption(options::AllowPartialResults);
   void SetOption(options::Tailable);
+  void SetOption(options::Prefetch);
   void SetOption(const options::Comment&);
   void SetOption(const options::MaxServerTime&);
 
@@ -325,7 +327,9 @@ class Aggregate {
   void SetOption(options::ReadConcern);
   void SetOption(const options::WriteConcern&);
   void SetOption(options::WriteConcern::Level);
+  void SetOption(options::BatchSize);
   void SetOption(const options::Hint&);
+  void SetOption(options::Prefetch);
   void SetOption(const options::Comment&);
   void SetOption(const options::MaxServerTime&);
 
@@ -339,6 +343,37 @@ class Aggregate {
   utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
 };
 
+/// Opens a change stream, see storages::mongo::ChangeStream
+class Watch {
+ public:
+  Watch();
+
+  /// @param pipeline an array of aggregation operations applied to the events
+  explicit Watch(formats::bson::Value pipeline);
+  ~Watch();
+
+  Watch(const Watch&);
+  Watch(Watch&&) noexcept;
+  Watch& operator=(const Watch&);
+  Watch& operator=(Watch&&) noexcept;
+
+  void SetOption(const options::ReadPreference&);
+  void SetOption(options::ReadPreference::Mode);
+  void SetOption(options::ReadConcern);
+  void SetOption(const options::ResumeAfter&);
+  void SetOption(options::FullDocument);
+  void SetOption(const options::MaxAwaitTime&);
+
+ private:
+  friend class storages::mongo::impl::cdriver::CDriverCollectionImpl;
+
+  class Impl;
+  static constexpr size_t kSize = 104;
+  static constexpr size_t kAlignment = 8;
+  // MAC_COMPAT: std::string size differs
+  utils::FastPimpl<Impl, kSize, kAlignment, false> impl_;
+};
+
 class Drop {
  public:
   Drop();
@@ -151,6 +151,18 @@ class Limit {
   size_t value_;
 };
 
+/// @brief Specifies the number of documents in a batch of query results
+/// @note The value of `0` means the server default.
+class BatchSize {
+ public:
+  explicit BatchSize(std::uint32_t value) : value_(value) {}
+
+  std::uint32_t Value() const { return value_; }
+
+ private:
+  std::uint32_t value_;
+};
+
 /// @brief Selects fields to be returned
 /// @note `_id` field is always included by default, order might be significant
 /// @see
@@ -276,6 +288,14 @@ class SuppressServerExceptions {};
 /// @see https://docs.mongodb.com/manual/core/tailable-cursors/
 class Tailable {};
 
+/// @brief Fetches the next batch of query results in background while the
+/// current one is being read
+///
+/// The batch size starts from options::BatchSize and is adjusted to the
+/// document size and to the rate of reading, so that the reader does not wait
+/// for the network and no more than a few megabytes are buffered.
+class Prefetch {};
+
 /// Sets a comment for the operation, which would be visible in profile data
 class Comment {
  public:
@@ -300,6 +320,40 @@ class MaxServerTime {
   std::chrono::milliseconds value_;
 };
 
+/// @brief Resumes a change stream after the event with the specified token
+/// @see storages::mongo::ChangeStream::GetResumeToken
+class ResumeAfter {
+ public:
+  explicit ResumeAfter(formats::bson::Document token)
+      : token_(std::move(token)) {}
+
+  const formats::bson::Document& Value() const { return token_; }
+
+ private:
+  formats::bson::Document token_;
+};
+
+/// Selects the contents of `fullDocument` field of the change stream events
+enum class FullDocument {
+  /// The document is returned for inserts and replacements only
+  kDefault,
+  /// The current version of the document is also looked up for updates
+  kUpdateLookup,
+};
+
+/// @brief Specifies how long the server waits for the new change stream
+/// events before returning an empty batch
+class MaxAwaitTime {
+ public:
+  explicit MaxAwaitTime(const std::chrono::milliseconds& value)
+      : value_(value) {}
+
+  const std::chrono::milliseconds& Value() const { return value_; }
+
+ private:
+  std::chrono::milliseconds value_;
+};
+
 }  // namespace storages::mongo::options
 
 USERVER_NAMESPACE_END
@@ -58,7 +58,8 @@ struct PoolConfig final {
   size_t initial_size = kDefaultInitialSize;
   /// Total connections limit
   size_t max_size = kDefaultMaxSize;
-  /// Idle connections limit
+  /// Idle connections limit, more connections are kept while the recent load
+  /// uses them
   size_t idle_limit = kDefaultIdleLimit;
   /// Establishing connections limit
   size_t connecting_limit = kDefaultConnectingLimit;
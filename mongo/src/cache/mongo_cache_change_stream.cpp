@@ -0,0 +1,106 @@
+#include <userver/cache/mongo_cache_change_stream.hpp>
+
+#include <chrono>
+
+#include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/serialize.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/mongo/operations.hpp>
+#include <userver/storages/mongo/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace mongo_cache::impl {
+
+namespace {
+
+// Every update waits this long for the events after the available ones
+constexpr std::chrono::milliseconds kMaxAwaitTime{10};
+
+std::string MakeChangeEventId(const formats::bson::Value& id) {
+  return ToCanonicalJsonString(formats::bson::MakeDoc("_id", id)).ToString();
+}
+
+}  // namespace
+
+std::string GetChangeEventId(const formats::bson::Document& document) {
+  return MakeChangeEventId(document["_id"]);
+}
+
+ChangeStreamReader::ChangeStreamReader(
+    std::string cache_name, const storages::mongo::Collection& collection,
+    bool is_secondary_preferred)
+    : cache_name_(std::move(cache_name)),
+      collection_(collection),
+      is_secondary_preferred_(is_secondary_preferred) {}
+
+void ChangeStreamReader::Open(
+    const std::optional<formats::bson::Document>& resume_token) {
+  namespace sm = storages::mongo;
+
+  Close();
+
+  sm::operations::Watch watch;
+  watch.SetOption(sm::options::FullDocument::kUpdateLookup);
+  watch.SetOption(sm::options::MaxAwaitTime{kMaxAwaitTime});
+  if (resume_token) watch.SetOption(sm::options::ResumeAfter{*resume_token});
+  if (is_secondary_preferred_) {
+    watch.SetOption(sm::options::ReadPreference::kSecondaryPreferred);
+  }
+  stream_.emplace(collection_.Execute(watch));
+}
+
+void ChangeStreamReader::Close() noexcept { stream_.reset(); }
+
+bool ChangeStreamReader::IsOpen() const { return stream_.has_value(); }
+
+std::optional<formats::bson::Document> ChangeStreamReader::GetResumeToken()
+    const {
+  if (!stream_) return std::nullopt;
+  return stream_->GetResumeToken();
+}
+
+ChangeBatch ChangeStreamReader::ReadAvailable() {
+  ChangeBatch batch;
+  if (!stream_) return batch;
+
+  try {
+    while (auto event = stream_->Next()) {
+      const auto type = (*event)["operationType"].As<std::string>();
+      if (type == "insert" || type == "update" || type == "replace" ||
+          type == "delete") {
+        ChangeEvent change;
+        change.id = MakeChangeEventId((*event)["documentKey"]["_id"]);
+        // An updated document could have been deleted before the lookup,
+        // it is removed now as the deletion comes later anyway
+        const auto full_document = (*event)["fullDocument"];
+        if (type != "delete" && !full_document.IsMissing() &&
+            !full_document.IsNull()) {
+          change.document = full_document.As<formats::bson::Document>();
+        }
+        batch.events.push_back(std::move(change));
+      } else if (type == "drop" || type == "rename" ||
+                 type == "dropDatabase" || type == "invalidate") {
+        LOG_WARNING() << "Change stream of cache " << cache_name_
+                      << " was invalidated by '" << type << "' event";
+        batch.is_invalidated = true;
+        Close();
+        return batch;
+      }
+      batch.resume_token = stream_->GetResumeToken();
+    }
+    // The token may move past the last event when there are no more changes
+    if (auto resume_token = stream_->GetResumeToken()) {
+      batch.resume_token = std::move(resume_token);
+    }
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Change stream of cache " << cache_name_
+                  << " has failed, it is resumed on the next update: " << ex;
+    Close();
+  }
+  return batch;
+}
+
+}  // namespace mongo_cache::impl
+
+USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <userver/cache/update_type.hpp>
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 #include <userver/storages/mongo/operations.hpp>
 
 #include <gtest/gtest.h>
@@ -24,6 +25,19 @@ struct IncorrectSignatureOfDeserializeObject {
   static ObjectType DeserializeObject(int x, const formats::bson::Document&);
 };
 
+struct CorrectDeserializeObjectView {
+  using ObjectType = int;
+
+  static ObjectType DeserializeObjectView(formats::bson::DocumentView);
+};
+
+struct IncorrectSignatureOfDeserializeObjectView {
+  using ObjectType = int;
+
+  static ObjectType DeserializeObjectView(const formats::bson::Document&,
+                                          int x);
+};
+
 // Do not use it as example of MongoCacheTraits
 struct CorrectMongoCacheTraits {
   static constexpr int kMongoCollectionsField = 0;
@@ -62,6 +76,15 @@ TEST(CheckTraits, DeserializeObject) {
                IncorrectSignatureOfFindOperation>);
 }
 
+TEST(CheckTraits, DeserializeObjectView) {
+  EXPECT_TRUE(mongo_cache::impl::kHasCorrectDeserializeObjectView<
+              CorrectDeserializeObjectView>);
+  EXPECT_FALSE(mongo_cache::impl::kHasCorrectDeserializeObjectView<
+               IncorrectSignatureOfDeserializeObjectView>);
+  EXPECT_FALSE(mongo_cache::impl::kHasCorrectDeserializeObjectView<
+               CorrectDeserializeObject>);
+}
+
 TEST(CheckTraits, FindOperation) {
   EXPECT_TRUE(
       mongo_cache::impl::kHasCorrectFindOperation<CorrectMongoCacheTraits>);
@@ -71,6 +94,23 @@ TEST(CheckTraits, FindOperation) {
                IncorrectSignatureOfFindOperation>);
 }
 
+struct ChangeStreamTraits : CorrectMongoCacheTraits {
+  static constexpr bool kUseChangeStream = true;
+};
+
+struct DisabledChangeStreamTraits : CorrectMongoCacheTraits {
+  static constexpr bool kUseChangeStream = false;
+};
+
+TEST(CheckTraits, ChangeStream) {
+  EXPECT_TRUE(mongo_cache::impl::IsChangeStreamUsed<ChangeStreamTraits>());
+  EXPECT_FALSE(
+      mongo_cache::impl::IsChangeStreamUsed<DisabledChangeStreamTraits>());
+  EXPECT_FALSE(
+      mongo_cache::impl::IsChangeStreamUsed<CorrectMongoCacheTraits>());
+  mongo_cache::impl::CheckTraits<ChangeStreamTraits>{};
+}
+
 TEST(CheckTraits, CorrectTraits) {
   mongo_cache::impl::CheckTraits<CorrectMongoCacheTraits>{};
 }
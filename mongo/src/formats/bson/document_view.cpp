@@ -0,0 +1,118 @@
+#include <userver/formats/bson/document_view.hpp>
+
+#include <fmt/format.h>
+
+#include <userver/formats/bson/exception.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::bson {
+
+namespace {
+
+Value CopyElement(const bson_iter_t& it, std::string_view key) {
+  impl::MutableBson bson;
+  if (!bson_append_iter(bson.Get(), key.data(), static_cast<int>(key.size()),
+                        &it)) {
+    throw ParseException(fmt::format("malformed BSON element '{}'", key));
+  }
+  return Document(bson.Extract())[std::string{key}];
+}
+
+}  // namespace
+
+DocumentView::DocumentView(const Document& doc)
+    : DocumentView(doc.GetBson().get()) {}
+
+DocumentView::DocumentView(const bson_t* bson)
+    : DocumentView(bson_get_data(bson), bson->len) {}
+
+void DocumentView::Visit(FieldVisitor& visitor) const {
+  bson_iter_t it;
+  if (!bson_iter_init_from_data(&it, data_, size_)) {
+    throw ParseException("malformed BSON document");
+  }
+
+  while (bson_iter_next(&it)) {
+    const std::string_view key(bson_iter_key(&it), bson_iter_key_len(&it));
+    switch (bson_iter_type(&it)) {
+      case BSON_TYPE_NULL:
+        visitor.Null(key);
+        break;
+      case BSON_TYPE_BOOL:
+        visitor.Bool(key, bson_iter_bool(&it));
+        break;
+      case BSON_TYPE_INT32:
+        visitor.Int64(key, bson_iter_int32(&it));
+        break;
+      case BSON_TYPE_INT64:
+        visitor.Int64(key, bson_iter_int64(&it));
+        break;
+      case BSON_TYPE_DOUBLE:
+        visitor.Double(key, bson_iter_double(&it));
+        break;
+      case BSON_TYPE_UTF8: {
+        uint32_t length = 0;
+        const char* str = bson_iter_utf8(&it, &length);
+        visitor.String(key, std::string_view(str, length));
+        break;
+      }
+      case BSON_TYPE_OID:
+        visitor.ObjectId(key, *bson_iter_oid(&it));
+        break;
+      case BSON_TYPE_DATE_TIME:
+        visitor.DateTime(key, std::chrono::system_clock::time_point(
+                                  std::chrono::milliseconds(
+                                      bson_iter_date_time(&it))));
+        break;
+      case BSON_TYPE_DOCUMENT:
+      case BSON_TYPE_ARRAY: {
+        const uint8_t* data = nullptr;
+        uint32_t length = 0;
+        if (bson_iter_type(&it) == BSON_TYPE_DOCUMENT) {
+          bson_iter_document(&it, &length, &data);
+          visitor.Object(key, DocumentView(data, length));
+        } else {
+          bson_iter_array(&it, &length, &data);
+          visitor.Array(key, DocumentView(data, length));
+        }
+        break;
+      }
+      default:
+        visitor.Other(key, CopyElement(it, key));
+    }
+  }
+}
+
+Document DocumentView::Copy() const {
+  return Document(impl::MutableBson(data_, size_).Extract());
+}
+
+FieldVisitor::~FieldVisitor() = default;
+
+void FieldVisitor::Null(std::string_view) {}
+
+void FieldVisitor::Bool(std::string_view, bool) {}
+
+void FieldVisitor::Int64(std::string_view, int64_t) {}
+
+void FieldVisitor::Double(std::string_view, double) {}
+
+void FieldVisitor::String(std::string_view, std::string_view) {}
+
+void FieldVisitor::ObjectId(std::string_view, const Oid&) {}
+
+void FieldVisitor::DateTime(std::string_view,
+                            std::chrono::system_clock::time_point) {}
+
+void FieldVisitor::Object(std::string_view, DocumentView) {}
+
+void FieldVisitor::Array(std::string_view, DocumentView) {}
+
+void FieldVisitor::Other(std::string_view, const Value&) {}
+
+}  // namespace formats::bson
+
+USERVER_NAMESPACE_END
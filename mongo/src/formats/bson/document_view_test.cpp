@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <userver/formats/bson.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample formats::bson::FieldVisitor usage]
+struct Item {
+  std::string name;
+  int64_t count{0};
+  std::vector<std::string> tags;
+};
+
+class TagsVisitor final : public formats::bson::FieldVisitor {
+ public:
+  explicit TagsVisitor(std::vector<std::string>& tags) : tags_(tags) {}
+
+  void String(std::string_view, std::string_view value) override {
+    tags_.emplace_back(value);
+  }
+
+ private:
+  std::vector<std::string>& tags_;
+};
+
+class ItemVisitor final : public formats::bson::FieldVisitor {
+ public:
+  void String(std::string_view key, std::string_view value) override {
+    if (key == "name") item_.name = value;
+  }
+
+  void Int64(std::string_view key, int64_t value) override {
+    if (key == "count") item_.count = value;
+  }
+
+  void Array(std::string_view key,
+             formats::bson::DocumentView value) override {
+    if (key != "tags") return;
+    TagsVisitor visitor{item_.tags};
+    value.Visit(visitor);
+  }
+
+  Item Extract() { return std::move(item_); }
+
+ private:
+  Item item_;
+};
+
+Item ParseItem(formats::bson::DocumentView doc) {
+  ItemVisitor visitor;
+  doc.Visit(visitor);
+  return visitor.Extract();
+}
+/// [Sample formats::bson::FieldVisitor usage]
+
+class RecordingVisitor final : public formats::bson::FieldVisitor {
+ public:
+  void Null(std::string_view key) override { Record(key, "null"); }
+  void Bool(std::string_view key, bool value) override {
+    Record(key, value ? "true" : "false");
+  }
+  void Int64(std::string_view key, int64_t value) override {
+    Record(key, std::to_string(value));
+  }
+  void Double(std::string_view key, double value) override {
+    Record(key, std::to_string(value));
+  }
+  void String(std::string_view key, std::string_view value) override {
+    Record(key, std::string{value});
+  }
+  void ObjectId(std::string_view key,
+                const formats::bson::Oid& value) override {
+    Record(key, value.ToString());
+  }
+  void DateTime(std::string_view key,
+                std::chrono::system_clock::time_point value) override {
+    Record(key, std::to_string(std::chrono::duration_cast<
+                                   std::chrono::milliseconds>(
+                                   value.time_since_epoch())
+                                   .count()));
+  }
+  void Object(std::string_view key,
+              formats::bson::DocumentView value) override {
+    Record(key, "object");
+    value.Visit(*this);
+  }
+  void Array(std::string_view key, formats::bson::DocumentView value) override {
+    Record(key, "array");
+    value.Visit(*this);
+  }
+  void Other(std::string_view key,
+             const formats::bson::Value& value) override {
+    Record(key, value.As<formats::bson::Decimal128>().ToString());
+  }
+
+  std::vector<std::string> records;
+
+ private:
+  void Record(std::string_view key, const std::string& value) {
+    records.push_back(std::string{key} + '=' + value);
+  }
+};
+
+}  // namespace
+
+TEST(DocumentView, Visit) {
+  const formats::bson::Oid oid{"0123456789abcdef01234567"};
+  const auto doc = formats::bson::MakeDoc(
+      "null", nullptr, "bool", true, "int32", 1, "int64", int64_t{-2},
+      "double", 0.5, "string", "str", "oid", oid, "date",
+      std::chrono::system_clock::time_point{std::chrono::milliseconds{3}},
+      "object", formats::bson::MakeDoc("inner", "x"), "array",
+      formats::bson::MakeArray(4, 5), "decimal",
+      formats::bson::Decimal128{"1.5"});
+
+  RecordingVisitor visitor;
+  formats::bson::DocumentView{doc}.Visit(visitor);
+  const std::vector<std::string> expected{
+      "null=null",
+      "bool=true",
+      "int32=1",
+      "int64=-2",
+      "double=" + std::to_string(0.5),
+      "string=str",
+      "oid=0123456789abcdef01234567",
+      "date=3",
+      "object=object",
+      "inner=x",
+      "array=array",
+      "0=4",
+      "1=5",
+      "decimal=1.5",
+  };
+  EXPECT_EQ(visitor.records, expected);
+}
+
+TEST(DocumentView, Sample) {
+  const auto doc = formats::bson::MakeDoc(
+      "_id", formats::bson::Oid{}, "name", "item", "count", 42, "tags",
+      formats::bson::MakeArray("a", "b"), "extra", 1.0);
+
+  const auto item = ParseItem(formats::bson::DocumentView{doc});
+  EXPECT_EQ(item.name, "item");
+  EXPECT_EQ(item.count, 42);
+  EXPECT_EQ(item.tags, (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(DocumentView, Copy) {
+  const auto doc = formats::bson::MakeDoc("a", 1, "b", "c");
+  const formats::bson::DocumentView view{doc};
+
+  const auto copy = view.Copy();
+  EXPECT_EQ(copy, doc);
+  EXPECT_NE(copy.GetBson(), doc.GetBson());
+  EXPECT_EQ(formats::bson::DocumentView{copy}.Size(), view.Size());
+}
+
+TEST(DocumentView, Malformed) {
+  const uint8_t data[] = {1, 0, 0, 0, 0};
+  RecordingVisitor visitor;
+  EXPECT_THROW(formats::bson::DocumentView(data, sizeof(data)).Visit(visitor),
+               formats::bson::ParseException);
+}
+
+USERVER_NAMESPACE_END
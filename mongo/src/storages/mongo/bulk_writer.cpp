@@ -0,0 +1,156 @@
+#include <userver/storages/mongo/bulk_writer.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/write_result.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+namespace {
+
+const std::string kFlushTaskName = "mongo_bulk_writer_flush";
+
+}  // namespace
+
+BulkWriter::BulkWriter(Collection collection, Settings settings)
+    : collection_(std::move(collection)),
+      settings_(std::move(settings)),
+      in_flight_semaphore_(std::max<std::size_t>(settings_.max_in_flight, 1)) {
+  if (settings_.max_batch_delay.count() > 0) {
+    flush_task_.Start(kFlushTaskName,
+                      {settings_.max_batch_delay,
+                       {utils::PeriodicTask::Flags::kStrong},
+                       logging::Level::kTrace},
+                      [this] { Flush(); });
+  }
+}
+
+BulkWriter::~BulkWriter() {
+  flush_task_.Stop();
+  for (auto& task : in_flight_) task.BlockingWait();
+}
+
+void BulkWriter::Append(bulk_ops::InsertOne operation) {
+  DoAppend(std::move(operation));
+}
+
+void BulkWriter::Append(bulk_ops::ReplaceOne operation) {
+  DoAppend(std::move(operation));
+}
+
+void BulkWriter::Append(bulk_ops::Update operation) {
+  DoAppend(std::move(operation));
+}
+
+void BulkWriter::Append(bulk_ops::Delete operation) {
+  DoAppend(std::move(operation));
+}
+
+void BulkWriter::InsertOne(formats::bson::Document document) {
+  DoAppend(bulk_ops::InsertOne(std::move(document)));
+}
+
+void BulkWriter::Flush() {
+  std::unique_lock lock(mutex_);
+  if (!pending_.empty()) SendPending(lock);
+}
+
+BulkWriter::Result BulkWriter::Finish() {
+  flush_task_.Stop();
+  Flush();
+  WaitInFlight();
+  return GetResult();
+}
+
+BulkWriter::Result BulkWriter::GetResult() const {
+  std::lock_guard lock(result_mutex_);
+  return result_;
+}
+
+void BulkWriter::DoAppend(Operation&& operation) {
+  std::unique_lock lock(mutex_);
+  pending_.push_back(std::move(operation));
+  if (pending_.size() >= settings_.max_batch_size) SendPending(lock);
+}
+
+void BulkWriter::SendPending(std::unique_lock<engine::Mutex>& lock) {
+  UASSERT(lock.owns_lock());
+
+  // Waits for a free slot before taking the operations, so that they stay
+  // pending if the wait is cancelled
+  engine::SemaphoreLock in_flight_lock(in_flight_semaphore_);
+
+  in_flight_.erase(std::remove_if(in_flight_.begin(), in_flight_.end(),
+                                  [](const auto& task) {
+                                    return task.IsFinished();
+                                  }),
+                   in_flight_.end());
+
+  auto batch = std::exchange(pending_, {});
+  pending_.reserve(std::min<std::size_t>(settings_.max_batch_size, 1024));
+
+  in_flight_.push_back(utils::CriticalAsync(
+      "mongo_bulk_writer",
+      [this, batch = std::move(batch),
+       in_flight_lock = std::move(in_flight_lock)] { Execute(batch); }));
+}
+
+void BulkWriter::Execute(const Batch& batch) {
+  for (std::size_t attempt = 1;; ++attempt) {
+    auto bulk = collection_.MakeUnorderedBulk(
+        options::SuppressServerExceptions{});
+    if (settings_.write_concern) bulk.SetOption(*settings_.write_concern);
+    for (const auto& operation : batch) {
+      std::visit([&bulk](const auto& op) { bulk.Append(op); }, operation);
+    }
+
+    try {
+      const auto write_result = collection_.Execute(std::move(bulk));
+
+      std::lock_guard lock(result_mutex_);
+      result_.inserted += write_result.InsertedCount();
+      result_.matched += write_result.MatchedCount();
+      result_.modified += write_result.ModifiedCount();
+      result_.upserted += write_result.UpsertedCount();
+      result_.deleted += write_result.DeletedCount();
+      result_.server_errors += write_result.ServerErrors().size();
+      result_.write_concern_errors += write_result.WriteConcernErrors().size();
+      return;
+    } catch (const MongoException& ex) {
+      if (attempt >= settings_.max_attempts ||
+          engine::current_task::ShouldCancel()) {
+        LOG_ERROR() << "Mongo bulk of " << batch.size()
+                    << " operations failed after " << attempt
+                    << " attempt(s): " << ex;
+        std::lock_guard lock(result_mutex_);
+        ++result_.failed_batches;
+        result_.failed_operations += batch.size();
+        return;
+      }
+      LOG_WARNING() << "Mongo bulk of " << batch.size()
+                    << " operations failed, retrying: " << ex;
+    }
+  }
+}
+
+void BulkWriter::WaitInFlight() {
+  std::vector<engine::TaskWithResult<void>> tasks;
+  {
+    std::lock_guard lock(mutex_);
+    tasks.swap(in_flight_);
+  }
+  for (auto& task : tasks) task.Get();
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
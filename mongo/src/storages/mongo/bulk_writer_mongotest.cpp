@@ -0,0 +1,77 @@
+#include <userver/utest/utest.hpp>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+#include <userver/storages/mongo/bulk_writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+class BulkWriter : public MongoPoolFixture {};
+}  // namespace
+
+UTEST_F(BulkWriter, Empty) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_empty");
+
+  mongo::BulkWriter writer(coll, {});
+  const auto result = writer.Finish();
+
+  EXPECT_EQ(0, result.inserted);
+  EXPECT_EQ(0, result.failed_batches);
+  EXPECT_EQ(0, coll.Count({}));
+}
+
+UTEST_F_MT(BulkWriter, SplitsIntoBatches, 4) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_batches");
+
+  mongo::BulkWriter::Settings settings;
+  settings.max_batch_size = 10;
+  settings.max_in_flight = 3;
+  mongo::BulkWriter writer(coll, std::move(settings));
+  for (int i = 0; i < 1000; ++i) {
+    writer.InsertOne(bson::MakeDoc("_id", i));
+  }
+  const auto result = writer.Finish();
+
+  EXPECT_EQ(1000, result.inserted);
+  EXPECT_EQ(0, result.server_errors);
+  EXPECT_EQ(0, result.failed_batches);
+  EXPECT_EQ(1000, coll.Count({}));
+}
+
+UTEST_F(BulkWriter, FlushesByTime) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_time");
+
+  mongo::BulkWriter::Settings settings;
+  settings.max_batch_delay = std::chrono::milliseconds{10};
+  mongo::BulkWriter writer(coll, std::move(settings));
+  writer.InsertOne(bson::MakeDoc("_id", 1));
+
+  while (writer.GetResult().inserted == 0) {
+    engine::SleepFor(std::chrono::milliseconds{10});
+  }
+  EXPECT_EQ(1, coll.Count({}));
+}
+
+UTEST_F(BulkWriter, CountsServerErrors) {
+  auto coll = GetDefaultPool().GetCollection("bulk_writer_errors");
+  coll.InsertOne(bson::MakeDoc("_id", 1));
+
+  mongo::BulkWriter writer(coll, {});
+  for (int i = 0; i < 3; ++i) {
+    writer.InsertOne(bson::MakeDoc("_id", i));
+  }
+  const auto result = writer.Finish();
+
+  EXPECT_EQ(2, result.inserted);
+  EXPECT_EQ(1, result.server_errors);
+  EXPECT_EQ(0, result.failed_batches);
+  EXPECT_EQ(3, coll.Count({}));
+}
+
+USERVER_NAMESPACE_END
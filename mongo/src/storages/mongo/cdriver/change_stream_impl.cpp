@@ -0,0 +1,54 @@
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+
+CDriverChangeStreamImpl::CDriverChangeStreamImpl(
+    cdriver::CDriverPoolImpl::BoundClientPtr client,
+    cdriver::ChangeStreamPtr stream,
+    std::shared_ptr<stats::OperationStatisticsItem> watch_stats)
+    : client_(std::move(client)),
+      stream_(std::move(stream)),
+      watch_stats_(std::move(watch_stats)) {
+  UASSERT(client_ && stream_);
+}
+
+std::optional<formats::bson::Document> CDriverChangeStreamImpl::Next() {
+  stats::OperationStopwatch stopwatch(watch_stats_, "watch");
+  const bson_t* event = nullptr;
+  if (mongoc_change_stream_next(stream_.get(), &event)) {
+    stopwatch.AccountSuccess();
+    return formats::bson::Document(
+        formats::bson::impl::MutableBson::CopyNative(event).Extract());
+  }
+
+  MongoError error;
+  if (mongoc_change_stream_error_document(stream_.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error iterating over change stream");
+  }
+  stopwatch.AccountSuccess();
+  return std::nullopt;
+}
+
+std::optional<formats::bson::Document>
+CDriverChangeStreamImpl::GetResumeToken() const {
+  const bson_t* token = mongoc_change_stream_get_resume_token(stream_.get());
+  if (!token) return std::nullopt;
+  return formats::bson::Document(
+      formats::bson::impl::MutableBson::CopyNative(token).Extract());
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
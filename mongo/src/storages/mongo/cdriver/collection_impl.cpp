@@ -15,7 +15,9 @@
 #include <userver/utils/text.hpp>
 
 #include <formats/bson/wrappers.hpp>
+#include <storages/mongo/cdriver/change_stream_impl.hpp>
 #include <storages/mongo/cdriver/cursor_impl.hpp>
+#include <storages/mongo/cdriver/prefetch_cursor_impl.hpp>
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
 #include <storages/mongo/operations_common.hpp>
@@ -266,6 +268,11 @@ Cursor CDriverCollectionImpl::Execute(const operations::Find& operation) const {
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_find_with_opts(
       context.collection.get(), native_filter_bson_ptr,
       impl::GetNative(options), operation.impl_->read_prefs.Get()));
+  if (operation.impl_->should_prefetch) {
+    return Cursor(std::make_unique<impl::cdriver::CDriverPrefetchCursorImpl>(
+        std::move(context.client), std::move(cdriver_cursor),
+        std::move(context.stats), operation.impl_->batch_size));
+  }
   return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
       std::move(context.client), std::move(cdriver_cursor),
       std::move(context.stats)));
@@ -533,11 +540,43 @@ Cursor CDriverCollectionImpl::Execute(const operations::Aggregate& operation) {
   impl::cdriver::CursorPtr cdriver_cursor(mongoc_collection_aggregate(
       context.collection.get(), MONGOC_QUERY_NONE, native_pipeline_bson_ptr,
       impl::GetNative(options), operation.impl_->read_prefs.Get()));
+  if (operation.impl_->should_prefetch) {
+    return Cursor(std::make_unique<impl::cdriver::CDriverPrefetchCursorImpl>(
+        std::move(context.client), std::move(cdriver_cursor),
+        std::move(context.stats), operation.impl_->batch_size));
+  }
   return Cursor(std::make_unique<impl::cdriver::CDriverCursorImpl>(
       std::move(context.client), std::move(cdriver_cursor),
       std::move(context.stats)));
 }
 
+ChangeStream CDriverCollectionImpl::Execute(
+    const operations::Watch& operation) const {
+  auto context = MakeRequestContext("mongo_watch", operation);
+
+  if (const auto* read_prefs = operation.impl_->read_prefs.Get()) {
+    mongoc_collection_set_read_prefs(context.collection.get(), read_prefs);
+  }
+
+  auto pipeline_doc = operation.impl_->pipeline.GetInternalArrayDocument();
+  stats::OperationStopwatch stopwatch(context.stats);
+  cdriver::ChangeStreamPtr stream(mongoc_collection_watch(
+      context.collection.get(), pipeline_doc.GetBson().get(),
+      impl::GetNative(operation.impl_->options)));
+
+  // The initial aggregate is run right away and the stream reports its error
+  MongoError error;
+  if (mongoc_change_stream_error_document(stream.get(), error.GetNative(),
+                                          nullptr)) {
+    stopwatch.AccountError(error.GetKind());
+    error.Throw("Error opening change stream");
+  }
+  stopwatch.AccountSuccess();
+
+  return ChangeStream(std::make_unique<impl::cdriver::CDriverChangeStreamImpl>(
+      std::move(context.client), std::move(stream), std::move(context.stats)));
+}
+
 void CDriverCollectionImpl::Execute(const operations::Drop& operation) {
   auto context = MakeRequestContext("mongo_drop", operation);
 
@@ -44,7 +44,7 @@ CDriverCursorImpl::CDriverCursorImpl(
   Next();
 }
 
-bool CDriverCursorImpl::IsValid() const { return cursor_ || current_; }
+bool CDriverCursorImpl::IsValid() const { return cursor_ || current_bson_; }
 
 bool CDriverCursorImpl::HasMore() const {
   return cursor_ && mongoc_cursor_more(cursor_.get());
@@ -52,12 +52,22 @@ bool CDriverCursorImpl::HasMore() const {
 
 const formats::bson::Document& CDriverCursorImpl::Current() const {
   if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  if (!current_) {
+    current_ = formats::bson::Document(
+        formats::bson::impl::MutableBson::CopyNative(current_bson_).Extract());
+  }
   return *current_;
 }
 
+formats::bson::DocumentView CDriverCursorImpl::CurrentView() const {
+  if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  return formats::bson::DocumentView(current_bson_);
+}
+
 void CDriverCursorImpl::Next() {
   if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
 
+  current_bson_ = nullptr;
   current_ = std::nullopt;
   if (!HasMore()) {
     UASSERT(!cursor_ && !client_);
@@ -72,8 +82,7 @@ void CDriverCursorImpl::Next() {
   MongoError error;
   while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) && HasMore()) {
     if (mongoc_cursor_next(cursor_.get(), &current_bson)) {
-      current_ = formats::bson::Document(
-          formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
+      current_bson_ = current_bson;
       break;
     }
   }
@@ -85,6 +94,11 @@ void CDriverCursorImpl::Next() {
     cursor_next_sw.AccountError(error.GetKind());
   }
   if (!HasMore()) {
+    if (current_bson_) {
+      // the last document outlives the batch buffer
+      Current();
+      current_bson_ = current_->GetBson().get();
+    }
     cursor_.reset();
     client_.reset();
   }
@@ -4,6 +4,7 @@
 #include <optional>
 
 #include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
 
 #include <storages/mongo/cdriver/pool_impl.hpp>
 #include <storages/mongo/cdriver/wrappers.hpp>
@@ -25,10 +26,13 @@ class CDriverCursorImpl final : public CursorImpl {
   bool HasMore() const override;
 
   const formats::bson::Document& Current() const override;
+  formats::bson::DocumentView CurrentView() const override;
   void Next() override;
 
  private:
-  std::optional<formats::bson::Document> current_;
+  // points into the batch buffer of the cursor, copied lazily by Current()
+  const bson_t* current_bson_{nullptr};
+  mutable std::optional<formats::bson::Document> current_;
   cdriver::CDriverPoolImpl::BoundClientPtr client_;
   cdriver::CursorPtr cursor_;
   const std::shared_ptr<stats::OperationStatisticsItem> find_stats_;
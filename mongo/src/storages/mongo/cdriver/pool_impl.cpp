@@ -1,5 +1,6 @@
 #include <storages/mongo/cdriver/pool_impl.hpp>
 
+#include <algorithm>
 #include <limits>
 
 #include <bson/bson.h>
@@ -13,6 +14,7 @@
 #include <userver/tracing/span.hpp>
 #include <userver/tracing/tags.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
 #include <userver/utils/impl/userver_experiments.hpp>
 #include <userver/utils/traceful_exception.hpp>
 
@@ -31,6 +33,7 @@ utils::impl::UserverExperiment kServerSelectionTimeoutExperiment{
 
 const std::string kMaintenanceTaskName = "mongo_maintenance";
 constexpr size_t kIdleConnectionDropRate = 1;
+constexpr size_t kWarmUpConnectionRate = 2;
 
 int32_t CheckedDurationMs(const std::chrono::milliseconds& timeout,
                           const char* name) {
@@ -299,12 +302,14 @@ mongoc_client_t* CDriverPoolImpl::Pop() {
             << Id() << "' has too many establishing connections. "
             << MakeQueueDeadlineMessage(inherited_timeout);
       }
+      ++cold_acquires_;
       client = Create();
     }
   }
 
   UASSERT(client);
   in_use_lock.Release();
+  utils::AtomicMax(peak_in_use_, InUseApprox());
   return client;
 }
 
@@ -375,14 +380,46 @@ mongoc_client_t* CDriverPoolImpl::Create() {
 
 void CDriverPoolImpl::DoMaintenance() {
   LOG_DEBUG() << "Starting mongo pool '" << Id() << "' maintenance";
+
+  // Keeps the connections needed for the recent load and prepares the ones
+  // the callers had to wait for, so that the pool follows the load instead of
+  // creating connections on the request path.
+  const auto recent_peak = peak_in_use_.exchange(InUseApprox());
+  const auto cold_acquires = cold_acquires_.exchange(0);
+  const auto target_size =
+      std::min(std::max(recent_peak + cold_acquires, idle_limit_), MaxSize());
+
+  if (cold_acquires) WarmUp(target_size);
+
   for (auto idle_drop_left = kIdleConnectionDropRate;
-       idle_drop_left && size_.load() > idle_limit_; --idle_drop_left) {
+       idle_drop_left && size_.load() > target_size; --idle_drop_left) {
     LOG_TRACE() << "Trying to drop idle connection";
     Drop(TryGetIdle());
   }
   LOG_DEBUG() << "Finished mongo pool '" << Id() << "' maintenance";
 }
 
+void CDriverPoolImpl::WarmUp(size_t target_size) {
+  for (auto warm_up_left = kWarmUpConnectionRate;
+       warm_up_left && size_.load() < target_size; --warm_up_left) {
+    // Does not compete with the callers for the limits
+    engine::SemaphoreLock in_use_lock(in_use_semaphore_, std::try_to_lock);
+    if (!in_use_lock) return;
+    const engine::SemaphoreLock connecting_lock(connecting_semaphore_,
+                                                std::try_to_lock);
+    if (!connecting_lock) return;
+
+    LOG_TRACE() << "Creating a connection ahead of the load";
+    try {
+      Push(Create());
+      in_use_lock.Release();
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to warm up mongo pool '" << Id() << "': " << ex;
+      return;
+    }
+  }
+}
+
 }  // namespace storages::mongo::impl::cdriver
 
 USERVER_NAMESPACE_END
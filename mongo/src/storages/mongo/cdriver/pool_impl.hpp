@@ -63,6 +63,7 @@ class CDriverPoolImpl final : public PoolImpl {
   mongoc_client_t* Create();
 
   void DoMaintenance();
+  void WarmUp(size_t target_size);
 
   const std::string app_name_;
   std::string default_database_;
@@ -73,6 +74,9 @@ class CDriverPoolImpl final : public PoolImpl {
   const size_t idle_limit_;
   const std::chrono::milliseconds queue_timeout_;
   std::atomic<size_t> size_;
+  // Load observed since the previous maintenance, used to size the pool
+  std::atomic<size_t> peak_in_use_{0};
+  std::atomic<size_t> cold_acquires_{0};
   engine::Semaphore in_use_semaphore_;
   engine::Semaphore connecting_semaphore_;
   boost::lockfree::queue<mongoc_client_t*> queue_;
@@ -0,0 +1,178 @@
+#include <storages/mongo/cdriver/prefetch_cursor_impl.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <bson/bson.h>
+#include <mongoc/mongoc.h>
+
+#include <userver/storages/mongo/mongo_error.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+
+#include <formats/bson/wrappers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Fallback to this function if mongoc.h does not
+// provide mongoc_cursor_get_batch_num
+template <class... T>
+int mongoc_cursor_get_batch_num(const T*...) noexcept {
+  return -1;
+}
+
+}  // namespace
+
+namespace storages::mongo::impl::cdriver {
+namespace {
+
+// the server default for the first batch
+constexpr std::uint32_t kDefaultBatchSize = 101;
+constexpr std::uint32_t kMinBatchSize = 16;
+// keeps the two buffered batches well below the 16MB message size limit
+constexpr std::size_t kMaxBatchBytes = 4 * 1024 * 1024;
+
+}  // namespace
+
+CDriverPrefetchCursorImpl::CDriverPrefetchCursorImpl(
+    cdriver::CDriverPoolImpl::BoundClientPtr client, cdriver::CursorPtr cursor,
+    std::shared_ptr<stats::OperationStatisticsItem> find_stats,
+    std::uint32_t batch_size)
+    : batch_size_(batch_size ? batch_size : kDefaultBatchSize),
+      client_(std::move(client)),
+      cursor_(std::move(cursor)),
+      find_stats_(std::move(find_stats)) {
+  if (cursor_) {
+    MongoError error;
+    if (mongoc_cursor_error(cursor_.get(), error.GetNative())) {
+      error.Throw("Error iterating over query results");
+    }
+    StartFetch();
+  }
+
+  // Prime the cursor
+  TakeFetched();
+}
+
+CDriverPrefetchCursorImpl::~CDriverPrefetchCursorImpl() = default;
+
+bool CDriverPrefetchCursorImpl::IsValid() const { return pos_ < docs_.size(); }
+
+bool CDriverPrefetchCursorImpl::HasMore() const {
+  return pos_ + 1 < docs_.size() || fetch_task_.IsValid();
+}
+
+const formats::bson::Document& CDriverPrefetchCursorImpl::Current() const {
+  if (!IsValid()) throw std::logic_error("Reading from invalid cursor");
+  return docs_[pos_];
+}
+
+formats::bson::DocumentView CDriverPrefetchCursorImpl::CurrentView() const {
+  return formats::bson::DocumentView(Current().GetBson().get());
+}
+
+void CDriverPrefetchCursorImpl::Next() {
+  if (!IsValid()) throw std::logic_error("Advancing cursor past the end");
+
+  if (++pos_ < docs_.size()) return;
+  TakeFetched();
+}
+
+void CDriverPrefetchCursorImpl::StartFetch() {
+  UASSERT(!fetch_task_.IsValid());
+  fetch_task_ = utils::CriticalAsync(
+      "mongo_cursor_prefetch",
+      [this, batch_size = batch_size_] { return Fetch(batch_size); });
+}
+
+void CDriverPrefetchCursorImpl::TakeFetched() {
+  docs_.clear();
+  pos_ = 0;
+  while (docs_.empty() && fetch_task_.IsValid()) {
+    const bool has_waited = !fetch_task_.IsFinished();
+    auto batch = fetch_task_.Get();
+    Autotune(batch, has_waited);
+
+    docs_ = std::move(batch.docs);
+    if (batch.is_last) {
+      cursor_.reset();
+      client_.reset();
+    } else {
+      StartFetch();
+    }
+  }
+}
+
+CDriverPrefetchCursorImpl::Batch CDriverPrefetchCursorImpl::Fetch(
+    std::uint32_t batch_size) {
+  UASSERT(client_ && cursor_);
+  mongoc_cursor_set_batch_size(cursor_.get(), batch_size);
+
+  Batch batch;
+  if (next_batch_head_) {
+    batch.bytes += next_batch_head_->GetBson()->len;
+    batch.docs.push_back(*std::move(next_batch_head_));
+    next_batch_head_.reset();
+  }
+
+  const auto batch_num_before = mongoc_cursor_get_batch_num(cursor_.get());
+  stats::OperationStopwatch cursor_next_sw(find_stats_, "find");
+
+  const bson_t* current_bson = nullptr;
+  MongoError error;
+  while (!mongoc_cursor_error(cursor_.get(), error.GetNative()) &&
+         mongoc_cursor_more(cursor_.get())) {
+    if (!mongoc_cursor_next(cursor_.get(), &current_bson)) continue;
+
+    formats::bson::Document doc(
+        formats::bson::impl::MutableBson::CopyNative(current_bson).Extract());
+    // Stops once the next batch has arrived, so that the request for it
+    // overlaps with the reading of the current one
+    if (!batch.docs.empty() &&
+        (batch_num_before != mongoc_cursor_get_batch_num(cursor_.get()) ||
+         batch.docs.size() >= batch_size)) {
+      next_batch_head_ = std::move(doc);
+      break;
+    }
+    batch.bytes += current_bson->len;
+    batch.docs.push_back(std::move(doc));
+  }
+
+  if (batch_num_before == mongoc_cursor_get_batch_num(cursor_.get())) {
+    cursor_next_sw.Discard();
+  } else if (!error) {
+    cursor_next_sw.AccountSuccess();
+  } else {
+    cursor_next_sw.AccountError(error.GetKind());
+  }
+  if (error) {
+    error.Throw("Error iterating over query results");
+  }
+
+  batch.is_last = !next_batch_head_ && !mongoc_cursor_more(cursor_.get());
+  return batch;
+}
+
+void CDriverPrefetchCursorImpl::Autotune(const Batch& batch, bool has_waited) {
+  total_docs_ += batch.docs.size();
+  total_bytes_ += batch.bytes;
+  if (!total_docs_) return;
+
+  // Larger batches take fewer round trips when the reader outpaces the
+  // network, the memory limit keeps the documents from piling up otherwise
+  std::size_t batch_size = batch_size_;
+  if (has_waited) batch_size *= 2;
+
+  const auto avg_doc_bytes =
+      std::max<std::size_t>(total_bytes_ / total_docs_, 1);
+  const auto max_batch_size =
+      std::max<std::size_t>(kMaxBatchBytes / avg_doc_bytes, kMinBatchSize);
+  batch_size_ = std::clamp<std::size_t>(batch_size, kMinBatchSize,
+                                        max_batch_size);
+}
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
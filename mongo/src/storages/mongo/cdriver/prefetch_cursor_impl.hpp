@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/document_view.hpp>
+
+#include <storages/mongo/cdriver/pool_impl.hpp>
+#include <storages/mongo/cdriver/wrappers.hpp>
+#include <storages/mongo/cursor_impl.hpp>
+#include <storages/mongo/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo::impl::cdriver {
+
+/// Reads the batches of the cursor in background, one batch ahead of the
+/// consumer, and adjusts the size of the batches to the consumer
+class CDriverPrefetchCursorImpl final : public CursorImpl {
+ public:
+  CDriverPrefetchCursorImpl(
+      cdriver::CDriverPoolImpl::BoundClientPtr, cdriver::CursorPtr,
+      std::shared_ptr<stats::OperationStatisticsItem> find_stats,
+      std::uint32_t batch_size);
+  ~CDriverPrefetchCursorImpl() override;
+
+  bool IsValid() const override;
+  bool HasMore() const override;
+
+  const formats::bson::Document& Current() const override;
+  formats::bson::DocumentView CurrentView() const override;
+  void Next() override;
+
+ private:
+  struct Batch {
+    std::vector<formats::bson::Document> docs;
+    std::size_t bytes{0};
+    bool is_last{false};
+  };
+
+  void StartFetch();
+  void TakeFetched();
+  Batch Fetch(std::uint32_t batch_size);
+  void Autotune(const Batch& batch, bool has_waited);
+
+  std::vector<formats::bson::Document> docs_;
+  std::size_t pos_{0};
+
+  std::uint32_t batch_size_;
+  std::size_t total_docs_{0};
+  std::size_t total_bytes_{0};
+
+  // accessed by the fetch task only while it runs
+  cdriver::CDriverPoolImpl::BoundClientPtr client_;
+  cdriver::CursorPtr cursor_;
+  const std::shared_ptr<stats::OperationStatisticsItem> find_stats_;
+  // the first document of the next server batch
+  std::optional<formats::bson::Document> next_batch_head_;
+
+  engine::TaskWithResult<Batch> fetch_task_;
+};
+
+}  // namespace storages::mongo::impl::cdriver
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,93 @@
+#include <userver/storages/mongo/find_by_id_batcher.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/formats/bson/serialize.hpp>
+#include <userver/formats/bson/value_builder.hpp>
+#include <userver/storages/mongo/exception.hpp>
+#include <userver/storages/mongo/operations.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::mongo {
+
+namespace {
+
+std::string MakeIdKey(const formats::bson::Value& id) {
+  return ToCanonicalJsonString(formats::bson::MakeDoc("_id", id)).ToString();
+}
+
+}  // namespace
+
+FindByIdBatcher::FindByIdBatcher(Collection collection, Settings settings)
+    : collection_(std::move(collection)), settings_(std::move(settings)) {}
+
+FindByIdBatcher::~FindByIdBatcher() = default;
+
+std::optional<formats::bson::Document> FindByIdBatcher::FindById(
+    const formats::bson::Value& id) {
+  auto key = MakeIdKey(id);
+
+  std::unique_lock lock(mutex_);
+  auto batch = pending_;
+  const bool is_leader = !batch;
+  if (is_leader) batch = pending_ = std::make_shared<Batch>();
+
+  batch->ids.push_back(id);
+  if (batch->ids.size() >= std::max<std::size_t>(settings_.max_batch_size, 1)) {
+    pending_.reset();
+    cv_.NotifyAll();
+  }
+
+  if (is_leader) {
+    // The other callers of the batch depend on its query
+    const engine::TaskCancellationBlocker cancel_blocker;
+    [[maybe_unused]] const bool is_full =
+        cv_.WaitFor(lock, settings_.max_batch_delay,
+                    [&] { return pending_ != batch; });
+    if (pending_ == batch) pending_.reset();
+
+    lock.unlock();
+    Execute(*batch);
+    lock.lock();
+
+    batch->is_done = true;
+    cv_.NotifyAll();
+  } else if (!cv_.Wait(lock, [&] { return batch->is_done; })) {
+    throw CancelledException("Find by id was cancelled while waiting for ")
+        << batch->ids.size() << " ids";
+  }
+
+  if (batch->error) std::rethrow_exception(batch->error);
+  const auto it = batch->found.find(key);
+  if (it == batch->found.end()) return std::nullopt;
+  return it->second;
+}
+
+void FindByIdBatcher::Execute(Batch& batch) const {
+  UASSERT(!batch.ids.empty());
+
+  formats::bson::ValueBuilder ids(formats::common::Type::kArray);
+  for (const auto& id : batch.ids) ids.PushBack(id);
+
+  operations::Find find(formats::bson::MakeDoc(
+      "_id", formats::bson::MakeDoc("$in", ids.ExtractValue())));
+  if (settings_.read_preference) find.SetOption(*settings_.read_preference);
+  if (settings_.projection) find.SetOption(*settings_.projection);
+
+  try {
+    for (const auto& doc : collection_.Execute(find)) {
+      batch.found.emplace(MakeIdKey(doc["_id"]), doc);
+    }
+  } catch (const std::exception&) {
+    batch.error = std::current_exception();
+  }
+}
+
+}  // namespace storages::mongo
+
+USERVER_NAMESPACE_END
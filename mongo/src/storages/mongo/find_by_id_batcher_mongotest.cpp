@@ -0,0 +1,59 @@
+#include <userver/utest/utest.hpp>
+
+#include <vector>
+
+#include <storages/mongo/util_mongotest.hpp>
+#include <userver/formats/bson.hpp>
+#include <userver/storages/mongo.hpp>
+#include <userver/storages/mongo/find_by_id_batcher.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace bson = formats::bson;
+namespace mongo = storages::mongo;
+
+namespace {
+class FindByIdBatcher : public MongoPoolFixture {};
+
+bson::Value MakeId(int id) { return bson::ValueBuilder(id).ExtractValue(); }
+}  // namespace
+
+UTEST_F(FindByIdBatcher, Single) {
+  auto coll = GetDefaultPool().GetCollection("find_by_id_single");
+  coll.InsertOne(bson::MakeDoc("_id", 1, "x", "one"));
+
+  mongo::FindByIdBatcher batcher(coll, {});
+
+  const auto found = batcher.FindById(MakeId(1));
+  ASSERT_TRUE(found);
+  EXPECT_EQ("one", (*found)["x"].As<std::string>());
+  EXPECT_FALSE(batcher.FindById(MakeId(2)));
+}
+
+UTEST_F_MT(FindByIdBatcher, Concurrent, 4) {
+  auto coll = GetDefaultPool().GetCollection("find_by_id_concurrent");
+  for (int i = 0; i < 50; ++i) coll.InsertOne(bson::MakeDoc("_id", i, "x", i));
+
+  mongo::FindByIdBatcher::Settings settings;
+  settings.max_batch_size = 16;
+  settings.max_batch_delay = std::chrono::milliseconds{10};
+  settings.projection = mongo::options::Projection{"x"};
+  mongo::FindByIdBatcher batcher(coll, std::move(settings));
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (int i = 0; i < 100; ++i) {
+    tasks.push_back(utils::Async("find", [&batcher, i] {
+      const auto found = batcher.FindById(MakeId(i));
+      if (i < 50) {
+        ASSERT_TRUE(found);
+        EXPECT_EQ(i, (*found)["x"].As<int>());
+      } else {
+        EXPECT_FALSE(found);
+      }
+    }));
+  }
+  for (auto& task : tasks) task.Get();
+}
+
+USERVER_NAMESPACE_END
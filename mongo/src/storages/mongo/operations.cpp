@@ -3,6 +3,7 @@
 #include <mongoc/mongoc.h>
 
 #include <userver/formats/bson/bson_builder.hpp>
+#include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/utils/assert.hpp>
@@ -134,6 +135,14 @@ void AppendLimit(formats::bson::impl::BsonBuilder& builder,
   AppendUint64Option(builder, kOptionName, limit.Value());
 }
 
+void AppendBatchSize(formats::bson::impl::BsonBuilder& builder,
+                     options::BatchSize batch_size) {
+  if (!batch_size.Value()) return;
+
+  static const std::string kOptionName = "batchSize";
+  builder.Append(kOptionName, static_cast<std::int64_t>(batch_size.Value()));
+}
+
 void AppendHint(formats::bson::impl::BsonBuilder& builder,
                 const options::Hint& hint) {
   static const std::string kOptionName = "hint";
@@ -257,6 +266,11 @@ void Find::SetOption(options::Limit limit) {
   AppendLimit(impl::EnsureBuilder(impl_->options), limit);
 }
 
+void Find::SetOption(options::BatchSize batch_size) {
+  impl_->batch_size = batch_size.Value();
+  AppendBatchSize(impl::EnsureBuilder(impl_->options), batch_size);
+}
+
 void Find::SetOption(options::Projection projection) {
   const bson_t* projection_bson = projection.GetProjectionBson();
   if (bson_empty0(projection_bson)) return;
@@ -292,6 +306,8 @@ void Find::SetOption(options::Tailable) {
   }
 }
 
+void Find::SetOption(options::Prefetch) { impl_->should_prefetch = true; }
+
 void Find::SetOption(const options::Comment& comment) {
   AppendComment(impl::EnsureBuilder(impl_->options), impl_->has_comment_option,
                 comment);
@@ -618,10 +634,17 @@ void Aggregate::SetOption(options::WriteConcern::Level level) {
   AppendWriteConcern(impl::EnsureBuilder(impl_->options), level);
 }
 
+void Aggregate::SetOption(options::BatchSize batch_size) {
+  impl_->batch_size = batch_size.Value();
+  AppendBatchSize(impl::EnsureBuilder(impl_->options), batch_size);
+}
+
 void Aggregate::SetOption(const options::Hint& hint) {
   AppendHint(impl::EnsureBuilder(impl_->options), hint);
 }
 
+void Aggregate::SetOption(options::Prefetch) { impl_->should_prefetch = true; }
+
 void Aggregate::SetOption(const options::Comment& comment) {
   AppendComment(impl::EnsureBuilder(impl_->options), impl_->has_comment_option,
                 comment);
@@ -631,6 +654,57 @@ void Aggregate::SetOption(const options::MaxServerTime& max_server_time) {
   AppendMaxServerTime(impl_->max_server_time, max_server_time);
 }
 
+Watch::Watch() : Watch(formats::bson::MakeArray()) {}
+
+Watch::Watch(formats::bson::Value pipeline) : impl_(std::move(pipeline)) {
+  if (!impl_->pipeline.IsArray()) {
+    throw InvalidQueryArgumentException(
+        "Change stream pipeline is not an array");
+  }
+}
+
+Watch::~Watch() = default;
+
+Watch::Watch(const Watch& other) = default;
+Watch::Watch(Watch&&) noexcept = default;
+Watch& Watch::operator=(const Watch& rhs) = default;
+Watch& Watch::operator=(Watch&&) noexcept = default;
+
+void Watch::SetOption(const options::ReadPreference& read_prefs) {
+  impl_->read_prefs = MakeCDriverReadPrefs(read_prefs);
+}
+
+void Watch::SetOption(options::ReadPreference::Mode mode) {
+  impl_->read_prefs = MakeCDriverReadPrefs(mode);
+}
+
+void Watch::SetOption(options::ReadConcern level) {
+  AppendReadConcern(impl::EnsureBuilder(impl_->options), level);
+}
+
+void Watch::SetOption(const options::ResumeAfter& resume_after) {
+  impl::EnsureBuilder(impl_->options)
+      .Append("resumeAfter", resume_after.Value().GetBson().get());
+}
+
+void Watch::SetOption(options::FullDocument full_document) {
+  switch (full_document) {
+    case options::FullDocument::kDefault:
+      return;
+    case options::FullDocument::kUpdateLookup:
+      impl::EnsureBuilder(impl_->options)
+          .Append("fullDocument", "updateLookup");
+      return;
+  }
+  UINVARIANT(false, "Unexpected FullDocument");
+}
+
+void Watch::SetOption(const options::MaxAwaitTime& max_await_time) {
+  impl::EnsureBuilder(impl_->options)
+      .Append("maxAwaitTimeMS",
+              static_cast<std::int64_t>(max_await_time.Value().count()));
+}
+
 Drop::Drop() = default;
 Drop::~Drop() = default;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -53,6 +54,8 @@ class Find::Impl {
   impl::cdriver::ReadPrefsPtr read_prefs;
   std::optional<formats::bson::impl::BsonBuilder> options;
   bool has_comment_option{false};
+  bool should_prefetch{false};
+  std::uint32_t batch_size{0};
   std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
@@ -163,9 +166,22 @@ class Aggregate::Impl {
   stats::OperationKey op_key{stats::OpType::kAggregate};
   std::optional<formats::bson::impl::BsonBuilder> options;
   bool has_comment_option{false};
+  bool should_prefetch{false};
+  std::uint32_t batch_size{0};
   std::chrono::milliseconds max_server_time{kNoMaxServerTime};
 };
 
+class Watch::Impl {
+ public:
+  explicit Impl(formats::bson::Value pipeline_)
+      : pipeline(std::move(pipeline_)) {}
+
+  formats::bson::Value pipeline;
+  impl::cdriver::ReadPrefsPtr read_prefs;
+  stats::OperationKey op_key{stats::OpType::kWatch};
+  std::optional<formats::bson::impl::BsonBuilder> options;
+};
+
 class Drop::Impl {
  public:
   Impl() = default;
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <string>
 
 #include <storages/mongo/dynamic_config.hpp>
@@ -627,6 +628,77 @@ UTEST_F(Options, Tailable) {
   UEXPECT_NO_THROW(coll.FindOne({}, mongo::options::Tailable{}));
 }
 
+UTEST_F(Options, BatchSize) {
+  auto coll = GetDefaultPool().GetCollection("batch_size");
+  for (int i = 0; i < 10; ++i) coll.InsertOne(bson::MakeDoc("x", i));
+
+  auto cursor = coll.Find({}, mongo::options::BatchSize{3});
+  EXPECT_EQ(10, std::distance(cursor.begin(), cursor.end()));
+}
+
+UTEST_F(Options, Prefetch) {
+  auto coll = GetDefaultPool().GetCollection("prefetch");
+  constexpr int kDocsCount = 1000;
+  for (int i = 0; i < kDocsCount; ++i) coll.InsertOne(bson::MakeDoc("x", i));
+
+  {
+    auto cursor = coll.Find(
+        {}, mongo::options::Prefetch{}, mongo::options::BatchSize{20},
+        mongo::options::Sort{{"x", mongo::options::Sort::kAscending}});
+    int expected = 0;
+    for (const auto& doc : cursor) {
+      EXPECT_EQ(expected++, doc["x"].As<int>());
+    }
+    EXPECT_EQ(kDocsCount, expected);
+    EXPECT_FALSE(cursor.HasMore());
+  }
+  {
+    auto cursor = coll.Find(bson::MakeDoc("x", -1), mongo::options::Prefetch{});
+    EXPECT_FALSE(cursor);
+  }
+  {
+    // an abandoned cursor stops its prefetch
+    auto cursor = coll.Find({}, mongo::options::Prefetch{},
+                            mongo::options::BatchSize{20});
+    EXPECT_TRUE(cursor.HasMore());
+  }
+}
+
+UTEST_F(Options, AggregatePrefetch) {
+  auto coll = GetDefaultPool().GetCollection("aggregate_prefetch");
+  constexpr int kDocsCount = 1000;
+  for (int i = 0; i < kDocsCount; ++i) coll.InsertOne(bson::MakeDoc("x", i));
+
+  const auto pipeline =
+      bson::MakeArray(bson::MakeDoc("$sort", bson::MakeDoc("x", 1)));
+  {
+    auto cursor = coll.Aggregate(pipeline, mongo::options::BatchSize{3});
+    EXPECT_EQ(kDocsCount, std::distance(cursor.begin(), cursor.end()));
+  }
+  {
+    auto cursor = coll.Aggregate(pipeline, mongo::options::Prefetch{},
+                                 mongo::options::BatchSize{20});
+    int expected = 0;
+    for (const auto& doc : cursor) {
+      EXPECT_EQ(expected++, doc["x"].As<int>());
+    }
+    EXPECT_EQ(kDocsCount, expected);
+    EXPECT_FALSE(cursor.HasMore());
+  }
+  {
+    auto cursor = coll.Aggregate(
+        bson::MakeArray(bson::MakeDoc("$match", bson::MakeDoc("x", -1))),
+        mongo::options::Prefetch{});
+    EXPECT_FALSE(cursor);
+  }
+  {
+    // an abandoned cursor stops its prefetch
+    auto cursor = coll.Aggregate(pipeline, mongo::options::Prefetch{},
+                                 mongo::options::BatchSize{20});
+    EXPECT_TRUE(cursor.HasMore());
+  }
+}
+
 UTEST_F(Options, Comment) {
   auto coll = GetDefaultPool().GetCollection("comment");
 
@@ -49,6 +49,7 @@ namespace storages::mysql {
 /// -------------------------|---------------------------------------------|---------------
 /// initial_pool_size        | initial connection pool size (per host)     | 5
 /// max_pool_size            | maximum connection pool size (per host)     | 10
+/// statements_cache_size    | prepared statements LRU size per connection | 20
 ///
 // clang-format on
 class Component final : public components::LoggableComponentBase {
@@ -124,6 +124,38 @@ class TypedExtractor final : public ExtractorBase {
   InternalStorageType storage_;
 };
 
+// Binds a single row and passes it to the callback as soon as it's fetched,
+// nothing is stored in between.
+template <typename T, typename ExtractionTag, typename RowCallback>
+class StreamingExtractor final : public ExtractorBase {
+ public:
+  explicit StreamingExtractor(RowCallback& row_callback);
+
+  void Reserve(std::size_t size) final;
+
+  impl::bindings::OutputBindings& BindNextRow() final;
+
+  void CommitLastRow() final;
+
+  void RollbackLastRow() final;
+
+  std::size_t ColumnsCount() const final;
+
+ private:
+  static constexpr std::size_t GetColumnsCount() {
+    if constexpr (std::is_same_v<ExtractionTag, RowTag>) {
+      return boost::pfr::tuple_size_v<T>;
+    } else if constexpr (std::is_same_v<ExtractionTag, FieldTag>) {
+      return 1;
+    } else {
+      static_assert(!sizeof(ExtractionTag), "should be unreachable");
+    }
+  }
+
+  T row_{};
+  RowCallback& row_callback_;
+};
+
 template <typename Container, typename MapFrom, typename ExtractionTag>
 TypedExtractor<Container, MapFrom, ExtractionTag>::TypedExtractor()
     : ExtractorBase{GetColumnsCount()},
@@ -162,6 +194,38 @@ Container&& TypedExtractor<Container, MapFrom, ExtractionTag>::ExtractData() {
   return storage_.ExtractData();
 }
 
+template <typename T, typename ExtractionTag, typename RowCallback>
+StreamingExtractor<T, ExtractionTag, RowCallback>::StreamingExtractor(
+    RowCallback& row_callback)
+    : ExtractorBase{GetColumnsCount()}, row_callback_{row_callback} {}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+void StreamingExtractor<T, ExtractionTag, RowCallback>::Reserve(std::size_t) {
+  // no-op, rows are not stored
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+impl::bindings::OutputBindings&
+StreamingExtractor<T, ExtractionTag, RowCallback>::BindNextRow() {
+  return binder_.BindTo(row_, ExtractionTag{});
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+void StreamingExtractor<T, ExtractionTag, RowCallback>::CommitLastRow() {
+  row_callback_(std::move(row_));
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+void StreamingExtractor<T, ExtractionTag, RowCallback>::RollbackLastRow() {
+  // no-op, because either this function or commit is called, not both
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+std::size_t StreamingExtractor<T, ExtractionTag, RowCallback>::ColumnsCount()
+    const {
+  return GetColumnsCount();
+}
+
 template <typename Container>
 InPlaceStorage<Container>::InPlaceStorage(ResultBinder& binder)
     : binder_{binder} {}
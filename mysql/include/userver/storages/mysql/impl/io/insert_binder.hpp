@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <type_traits>
+#include <utility>
 
 #include <boost/pfr/core.hpp>
 
@@ -23,6 +25,12 @@ struct OwnedMappedRow<Row, true> final {
   Row value;
 };
 
+template <typename Row, std::size_t... Indices>
+constexpr bool AreAllFieldsArithmetic(std::index_sequence<Indices...>) {
+  return (std::is_arithmetic_v<boost::pfr::tuple_element_t<Indices, Row>> &&
+          ...);
+}
+
 class InsertBinderBase : public ParamsBinderBase {
  public:
   explicit InsertBinderBase(std::size_t size);
@@ -34,6 +42,8 @@ class InsertBinderBase : public ParamsBinderBase {
   void SetBindCallback(void* user_data,
                        char (*param_cb)(void*, void*, std::size_t));
 
+  void SetRowSize(std::size_t row_size);
+
   void UpdateBinds(void* binds_array);
 };
 
@@ -52,7 +62,11 @@ class InsertBinder final : public InsertBinderBase {
 
     BindColumns();
 
-    SetBindCallback(this, &BindsRowCallback);
+    if constexpr (kCanBindRowWise) {
+      SetRowSize(sizeof(Row));
+    } else {
+      SetBindCallback(this, &BindsRowCallback);
+    }
   }
 
   std::size_t GetRowsCount() const final { return container_.size(); }
@@ -62,6 +76,12 @@ class InsertBinder final : public InsertBinderBase {
   static constexpr std::size_t kColumnsCount = boost::pfr::tuple_size_v<Row>;
   static constexpr bool kIsMapped =
       !std::is_same_v<typename Container::value_type, Row>;
+  // Contiguous rows of fixed-size fields are bound to the first row once,
+  // the native library then reads all of them at sizeof(Row) stride without
+  // calling back into us for every row.
+  static constexpr bool kCanBindRowWise =
+      !kIsMapped && meta::kIsVector<Container> &&
+      AreAllFieldsArithmetic<Row>(std::make_index_sequence<kColumnsCount>{});
 
   static char BindsRowCallback(void* user_data, void* binds_array,
                                std::size_t row_number);
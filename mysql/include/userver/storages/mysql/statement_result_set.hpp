@@ -157,6 +157,40 @@ class StatementResultSet final {
   template <typename T>
   std::optional<T> AsOptionalSingleField() &&;
 
+  // clang-format off
+  /// @brief Parse statement result set row by row as T and pass each row to
+  /// `row_callback`.
+  /// `T` is expected to be an aggregate of supported types.
+  /// See @ref scripts/docs/en/userver/mysql/supported_types.md for better understanding of
+  /// `T` requirements.
+  ///
+  /// Unlike the other methods, the result set is not stored client-side: the
+  /// rows are read from the network as they are consumed, so only a single row
+  /// is kept in memory. The connection stays busy until all the rows are
+  /// processed.
+  ///
+  /// UINVARIANTs on columns count mismatch or types mismatch.
+  ///
+  /// @snippet storages/tests/unittests/statement_result_set_mysqltest.cpp uMySQL usage sample - StatementResultSet ForEach
+  // clang-format on
+  template <typename T, typename RowCallback>
+  void ForEach(RowCallback&& row_callback) &&;
+
+  // clang-format off
+  /// @brief Parse statement result set row by row as T and pass each row to
+  /// `row_callback`.
+  /// Result set is expected to have a single column, `T` is expected to be one
+  /// of supported types.
+  /// See @ref scripts/docs/en/userver/mysql/supported_types.md for supported types.
+  ///
+  /// The rows are read from the network as they are consumed, see the
+  /// overload above.
+  ///
+  /// UINVARIANTs on columns count not being equal to 1 or type mismatch.
+  // clang-format on
+  template <typename T, typename RowCallback>
+  void ForEach(RowCallback&& row_callback, FieldTag) &&;
+
   // clang-format off
   /// @brief Converts to an interface for on-the-flight mapping
   /// statement result set from `DbType`.
@@ -185,8 +219,13 @@ class StatementResultSet final {
   template <typename T, typename ExtractionTag>
   std::optional<T> DoAsOptionalSingleRow() &&;
 
+  template <typename T, typename ExtractionTag, typename RowCallback>
+  void DoForEach(RowCallback& row_callback) &&;
+
   bool FetchResult(impl::io::ExtractorBase& extractor);
 
+  void StreamResult(impl::io::ExtractorBase& extractor);
+
   struct Impl;
   utils::FastPimpl<Impl, 72, 8> impl_;
 };
@@ -322,6 +361,26 @@ std::optional<T> StatementResultSet::AsOptionalSingleField() && {
   return std::move(*this).DoAsOptionalSingleRow<T, FieldTag>();
 }
 
+template <typename T, typename RowCallback>
+void StatementResultSet::ForEach(RowCallback&& row_callback) && {
+  std::move(*this).DoForEach<T, RowTag>(row_callback);
+}
+
+template <typename T, typename RowCallback>
+void StatementResultSet::ForEach(RowCallback&& row_callback, FieldTag) && {
+  std::move(*this).DoForEach<T, FieldTag>(row_callback);
+}
+
+template <typename T, typename ExtractionTag, typename RowCallback>
+void StatementResultSet::DoForEach(RowCallback& row_callback) && {
+  using Extractor = impl::io::StreamingExtractor<T, ExtractionTag, RowCallback>;
+
+  Extractor extractor{row_callback};
+
+  tracing::ScopeTime for_each{impl::tracing::kForEachScope};
+  StreamResult(extractor);
+}
+
 template <typename Container, typename MapFrom, typename ExtractionTag>
 Container StatementResultSet::DoAsContainerMapped() && {
   static_assert(meta::kIsRange<Container>,
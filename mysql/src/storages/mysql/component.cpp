@@ -63,6 +63,11 @@ properties:
         type: integer
         description: maximum number of created connections
         defaultDescription: 10
+    statements_cache_size:
+        type: integer
+        description: max number of prepared statements cached per connection
+        defaultDescription: 20
+        minimum: 1
 )");
 }
 
@@ -19,6 +19,7 @@ InputBindings::InputBindings(InputBindings&& other) noexcept
       intermediate_buffers_{std::move(other.intermediate_buffers_)},
       params_cb_{other.params_cb_},
       user_data_{other.user_data_},
+      row_size_{other.row_size_},
       // Technically this is incorrect, since bind_ptr_ could've been updated to
       // point into libmariadb, but move neven happens after that
       binds_ptr_{owned_binds_.data()} {}
@@ -35,6 +36,10 @@ void InputBindings::SetUserData(void* user_data) { user_data_ = user_data; }
 
 void* InputBindings::GetUserData() const { return user_data_; }
 
+void InputBindings::SetRowSize(std::size_t row_size) { row_size_ = row_size; }
+
+std::size_t InputBindings::GetRowSize() const { return row_size_; }
+
 std::size_t InputBindings::Size() const { return owned_binds_.size(); }
 
 bool InputBindings::Empty() const { return Size() == 0; }
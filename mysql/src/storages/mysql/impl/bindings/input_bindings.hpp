@@ -28,6 +28,10 @@ class InputBindings : public NativeBindsHelper {
   ParamsCallback GetParamsCallback() const;
   void SetUserData(void* user_data);
   void* GetUserData() const;
+  // Non-zero for row-wise batch binding: the binds point into the first row
+  // and the following rows are read at this stride.
+  void SetRowSize(std::size_t row_size);
+  std::size_t GetRowSize() const;
 
   std::size_t Size() const;
   bool Empty() const;
@@ -93,6 +97,7 @@ class InputBindings : public NativeBindsHelper {
 
   ParamsCallback params_cb_{nullptr};
   void* user_data_{nullptr};
+  std::size_t row_size_{0};
 
   // This is either pointing to owned_binds_.data()
   // or to binds array stored inside mysql internals (happens with batch insert)
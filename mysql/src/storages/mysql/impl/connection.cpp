@@ -109,9 +109,11 @@ Connection::Connection(clients::dns::Resolver& resolver,
                        const settings::EndpointInfo& endpoint_info,
                        const settings::AuthSettings& auth_settings,
                        const settings::ConnectionSettings& connection_settings,
+                       infra::StatementsCacheStatistics& statements_cache_stats,
                        engine::Deadline deadline)
     : socket_{-1, 0},
-      statements_cache_{*this, connection_settings.statements_cache_size} {
+      statements_cache_{*this, connection_settings.statements_cache_size,
+                        statements_cache_stats} {
   { auto _ = mysql_local_scope.Use(); }
 
   InitSocket(resolver, endpoint_info, auth_settings, connection_settings,
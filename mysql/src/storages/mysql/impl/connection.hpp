@@ -26,6 +26,10 @@ struct AuthSettings;
 struct ConnectionSettings;
 }  // namespace settings
 
+namespace infra {
+struct StatementsCacheStatistics;
+}  // namespace infra
+
 namespace impl {
 
 namespace io {
@@ -38,6 +42,7 @@ class Connection final {
              const settings::EndpointInfo& endpoint_info,
              const settings::AuthSettings& auth_settings,
              const settings::ConnectionSettings& connection_settings,
+             infra::StatementsCacheStatistics& statements_cache_stats,
              engine::Deadline deadline);
   ~Connection();
 
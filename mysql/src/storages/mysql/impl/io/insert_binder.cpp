@@ -17,6 +17,10 @@ void InsertBinderBase::SetBindCallback(void* user_data,
   GetBinds().SetParamsCallback(param_cb);
 }
 
+void InsertBinderBase::SetRowSize(std::size_t row_size) {
+  GetBinds().SetRowSize(row_size);
+}
+
 void InsertBinderBase::UpdateBinds(void* binds_array) {
   UASSERT(binds_array);
 
@@ -180,25 +180,30 @@ void Statement::UpdateParamsBindings(io::ParamsBinderBase& params) {
       throw std::runtime_error("Failed to bind statements params");
     }
 
-    if (auto rows_count = params.GetRowsCount(); rows_count > 1) {
+    auto rows_count = params.GetRowsCount();
+    if (rows_count > 1) {
       const auto& server_info = connection_->GetServerInfo();
       if (server_info.server_type != metadata::ServerInfo::Type::kMariaDB ||
           server_info.server_version < metadata::SemVer{10, 2, 6}) {
         throw std::logic_error{"Batch insert requires MariaDB 10.2.6 or later"};
       }
-
-      mysql_stmt_attr_set(native_statement_.get(), STMT_ATTR_ARRAY_SIZE,
-                          &rows_count);
+    } else {
+      rows_count = 0;
     }
 
-    if (auto* user_data = binds.GetUserData()) {
-      mysql_stmt_attr_set(native_statement_.get(), STMT_ATTR_CB_USER_DATA,
-                          user_data);
-    }
-    if (auto* param_cb = binds.GetParamsCallback()) {
-      mysql_stmt_attr_set(native_statement_.get(), STMT_ATTR_CB_PARAM,
-                          reinterpret_cast<void*>(param_cb));
-    }
+    // The statement is cached and these attributes stick to it, so we reset
+    // them for every execution: a leftover callback makes libmariadb ignore
+    // the row size, and a leftover array size turns a single row execution
+    // into a broken batch one.
+    mysql_stmt_attr_set(native_statement_.get(), STMT_ATTR_ARRAY_SIZE,
+                        &rows_count);
+    auto row_size = binds.GetRowSize();
+    mysql_stmt_attr_set(native_statement_.get(), STMT_ATTR_ROW_SIZE,
+                        &row_size);
+    mysql_stmt_attr_set(native_statement_.get(), STMT_ATTR_CB_USER_DATA,
+                        binds.GetUserData());
+    mysql_stmt_attr_set(native_statement_.get(), STMT_ATTR_CB_PARAM,
+                        reinterpret_cast<void*>(binds.GetParamsCallback()));
   }
 }
 
@@ -321,50 +326,73 @@ bool StatementFetcher::FetchResult(io::ExtractorBase& extractor) {
     const auto rows_count = batch_size.value_or(statement_->RowsCount());
     extractor.Reserve(rows_count);
 
-    const auto validate_binds = !std::exchange(binds_validated_, true);
-    if (validate_binds) {
-      // We validate binds even for empty results:
-      // we don't want a query returning empty result to pass tests and then
-      // BOOM with actual data. Performance cost of this should be negligible,
-      // if any.
-      auto& binds = extractor.BindNextRow();
-      binds.ValidateAgainstStatement(*statement_->native_statement_);
-      extractor.RollbackLastRow();
-    }
+    ValidateBinds(extractor);
 
     for (size_t i = 0; i < rows_count; ++i) {
-      auto& binds = extractor.BindNextRow();
-
-      const auto apply_binds = !std::exchange(binds_applied_, true);
-      // We don't have to reapply binds all the time: values in them are changed
-      // by extractor.BindNextRow() call, and mysql_stmt_bind_result is costly.
-      // Not reapplying them for each row gives ~20% speedup in benchmarks with
-      // wide select.
-      const auto parsed = statement_->FetchResultRow(
-          binds, apply_binds, parent_statement_deadline_);
-      if (!parsed) {
-        extractor.RollbackLastRow();
-        return false;
-      }
-      extractor.CommitLastRow();
-      // With this we make OutputBinder operate on MYSQL_BIND array stored in
-      // statement.
-      // sizeof(MYSQL_BIND) = 112 in 64bit mode, and without this
-      // trickery we would have to copy the whole array for each column with
-      // mysql_stst_bind_result, and for say 10 columns and 10^6 rows that
-      // accounts for 10 * 112 * 10^6 ~= 1Gb of memcpy (and 10^6 rows of 10 ints
-      // is only about 40Mb)
-      //
-      // There's no API to access the field, but it surely isn't going anywhere,
-      // so we access it directly.
-      // https://jira.mariadb.org/browse/CONC-620
-      extractor.UpdateBinds(statement_->native_statement_->bind);
+      if (!FetchRow(extractor)) return false;
     }
 
     return true;
   });
 }
 
+void StatementFetcher::StreamResult(io::ExtractorBase& extractor) {
+  auto guard = statement_->connection_->GetBrokenGuard();
+
+  guard.Execute([&] {
+    // Without mysql_stmt_store_result every mysql_stmt_fetch reads the next
+    // row from the socket, so only a single row is kept in memory.
+    ValidateBinds(extractor);
+
+    while (FetchRow(extractor)) {
+    }
+  });
+}
+
+void StatementFetcher::ValidateBinds(io::ExtractorBase& extractor) {
+  const auto validate_binds = !std::exchange(binds_validated_, true);
+  if (validate_binds) {
+    // We validate binds even for empty results:
+    // we don't want a query returning empty result to pass tests and then
+    // BOOM with actual data. Performance cost of this should be negligible,
+    // if any.
+    auto& binds = extractor.BindNextRow();
+    binds.ValidateAgainstStatement(*statement_->native_statement_);
+    extractor.RollbackLastRow();
+  }
+}
+
+bool StatementFetcher::FetchRow(io::ExtractorBase& extractor) {
+  auto& binds = extractor.BindNextRow();
+
+  const auto apply_binds = !std::exchange(binds_applied_, true);
+  // We don't have to reapply binds all the time: values in them are changed
+  // by extractor.BindNextRow() call, and mysql_stmt_bind_result is costly.
+  // Not reapplying them for each row gives ~20% speedup in benchmarks with
+  // wide select.
+  const auto parsed = statement_->FetchResultRow(binds, apply_binds,
+                                                 parent_statement_deadline_);
+  if (!parsed) {
+    extractor.RollbackLastRow();
+    return false;
+  }
+  extractor.CommitLastRow();
+  // With this we make OutputBinder operate on MYSQL_BIND array stored in
+  // statement.
+  // sizeof(MYSQL_BIND) = 112 in 64bit mode, and without this
+  // trickery we would have to copy the whole array for each column with
+  // mysql_stst_bind_result, and for say 10 columns and 10^6 rows that
+  // accounts for 10 * 112 * 10^6 ~= 1Gb of memcpy (and 10^6 rows of 10 ints
+  // is only about 40Mb)
+  //
+  // There's no API to access the field, but it surely isn't going anywhere,
+  // so we access it directly.
+  // https://jira.mariadb.org/browse/CONC-620
+  extractor.UpdateBinds(statement_->native_statement_->bind);
+
+  return true;
+}
+
 std::uint64_t StatementFetcher::RowsAffected() const {
   const auto rows_affected =
       mysql_stmt_affected_rows(statement_->native_statement_.get());
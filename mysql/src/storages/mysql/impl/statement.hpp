@@ -35,6 +35,10 @@ class StatementFetcher final {
 
   bool FetchResult(io::ExtractorBase& extractor);
 
+  // Fetches the rows one by one straight from the socket, without storing
+  // the result set client-side.
+  void StreamResult(io::ExtractorBase& extractor);
+
   std::uint64_t RowsAffected() const;
 
   std::uint64_t LastInsertId() const;
@@ -43,6 +47,9 @@ class StatementFetcher final {
   friend class Statement;
   explicit StatementFetcher(Statement& statement);
 
+  void ValidateBinds(io::ExtractorBase& extractor);
+  bool FetchRow(io::ExtractorBase& extractor);
+
   engine::Deadline parent_statement_deadline_;
   bool binds_applied_{false};
   bool binds_validated_{false};
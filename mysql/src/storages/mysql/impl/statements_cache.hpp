@@ -4,6 +4,7 @@
 #include <userver/utils/str_icase.hpp>
 
 #include <storages/mysql/impl/statement.hpp>
+#include <storages/mysql/infra/statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -13,7 +14,8 @@ class Connection;
 
 class StatementsCache final {
  public:
-  StatementsCache(Connection& connection, std::size_t capacity);
+  StatementsCache(Connection& connection, std::size_t capacity,
+                  infra::StatementsCacheStatistics& stats);
   ~StatementsCache();
 
   Statement& PrepareStatement(const std::string& statement,
@@ -21,6 +23,7 @@ class StatementsCache final {
 
  private:
   Connection& connection_;
+  infra::StatementsCacheStatistics& stats_;
 
   cache::LruMap<std::string, Statement, utils::StrIcaseHash,
                 utils::StrIcaseEqual>
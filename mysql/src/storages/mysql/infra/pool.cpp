@@ -48,8 +48,10 @@ void Pool::Release(ConnectionUniquePtr connection) {
 }
 
 void Pool::WriteStatistics(utils::statistics::Writer& writer) const {
-  writer.ValueWithLabels(stats_,
-                         {{"mysql_instance", settings_.endpoint_info.host}});
+  const utils::statistics::LabelView label{"mysql_instance",
+                                          settings_.endpoint_info.host};
+  writer.ValueWithLabels(stats_, label);
+  writer["statements_cache"].ValueWithLabels(statements_cache_stats_, label);
 }
 
 Pool::Pool(clients::dns::Resolver& resolver,
@@ -72,7 +74,7 @@ Pool::ConnectionUniquePtr Pool::DoCreateConnection(engine::Deadline deadline) {
   try {
     auto connection_ptr = std::make_unique<impl::Connection>(
         resolver_, settings_.endpoint_info, settings_.auth_settings,
-        settings_.connection_settings, deadline);
+        settings_.connection_settings, statements_cache_stats_, deadline);
     monitor_.AccountSuccess();
 
     return connection_ptr;
@@ -84,6 +84,7 @@ class Pool final
   const settings::PoolSettings settings_;
 
   PoolConnectionStatistics stats_{};
+  StatementsCacheStatistics statements_cache_stats_{};
 
   PoolMonitor monitor_;
 };
@@ -16,6 +16,13 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["busy"] = stats.acquired - stats.released;
 }
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const StatementsCacheStatistics& stats) {
+  writer["hits"] = stats.hits;
+  writer["misses"] = stats.misses;
+  writer["evicted"] = stats.evicted;
+}
+
 }  // namespace storages::mysql::infra
 
 USERVER_NAMESPACE_END
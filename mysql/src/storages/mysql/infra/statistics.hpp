@@ -18,9 +18,18 @@ struct PoolConnectionStatistics final {
   Counter released{};
 };
 
+struct StatementsCacheStatistics final {
+  Counter hits{};
+  Counter misses{};
+  Counter evicted{};
+};
+
 void DumpMetric(utils::statistics::Writer& writer,
                 const PoolConnectionStatistics& stats);
 
+void DumpMetric(utils::statistics::Writer& writer,
+                const StatementsCacheStatistics& stats);
+
 }  // namespace storages::mysql::infra
 
 USERVER_NAMESPACE_END
@@ -54,6 +54,10 @@ bool StatementResultSet::FetchResult(impl::io::ExtractorBase& extractor) {
   return impl_->fetcher.FetchResult(extractor);
 }
 
+void StatementResultSet::StreamResult(impl::io::ExtractorBase& extractor) {
+  impl_->fetcher.StreamResult(extractor);
+}
+
 }  // namespace storages::mysql
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 #include "../utils_mysqltest.hpp"
 
+#include <deque>
+#include <vector>
+
 #include <userver/engine/run_standalone.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -46,6 +49,9 @@ void insert_retrieve(benchmark::State& state) {
 }
 BENCHMARK(insert_retrieve)->Range(1 << 10, 1 << 20)->RangeMultiplier(4);
 
+// std::vector of numeric rows is bound row-wise, any other container is bound
+// row by row through a callback.
+template <template <typename...> class Container>
 void batch_insert(benchmark::State& state) {
   engine::TaskProcessorPoolsConfig config{};
   config.defer_events = false;
@@ -69,12 +75,13 @@ void batch_insert(benchmark::State& state) {
                boost::pfr::structure_tie(other);
       }
     };
-    std::vector<Row> rows_to_insert;
-    rows_to_insert.reserve(state.range(0));
+    Container<Row> rows_to_insert;
     for (int i = 0; i < state.range(0); ++i) {
       auto& row = rows_to_insert.emplace_back();
       boost::pfr::for_each_field(row, [i](auto& field) { field = i; });
     }
+    const std::vector<Row> expected_rows{rows_to_insert.begin(),
+                                         rows_to_insert.end()};
 
     for (auto _ : state) {
       state.PauseTiming();
@@ -95,7 +102,7 @@ void batch_insert(benchmark::State& state) {
       const auto db_rows =
           table.DefaultExecute("SELECT a, b, c, d, e, f, g, h, j, k FROM {}")
               .AsVector<Row>();
-      if (rows_to_insert != db_rows) {
+      if (expected_rows != db_rows) {
         state.SkipWithError("INSERT OR SELECT IS BROKEN");
       }
       table.DefaultExecute("DROP TABLE {}");
@@ -103,7 +110,8 @@ void batch_insert(benchmark::State& state) {
     }
   });
 }
-BENCHMARK(batch_insert)->Range(1000, 100'000);
+BENCHMARK_TEMPLATE(batch_insert, std::vector)->Range(1000, 100'000);
+BENCHMARK_TEMPLATE(batch_insert, std::deque)->Range(1000, 100'000);
 
 }  // namespace storages::mysql::benches
 
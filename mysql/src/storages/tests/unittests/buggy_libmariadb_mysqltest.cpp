@@ -17,10 +17,15 @@ UTEST(Libmariadb, CONC622) {
   const settings::AuthSettings auth_settings{};  // doesn't matter
   const settings::ConnectionSettings connection_settings{
       1, false, false, settings::IpMode::kIpV4};
+  infra::StatementsCacheStatistics statements_cache_stats;
 
   const auto try_connect = [&] {
     return impl::Connection{
-        resolver, endpoint_info, auth_settings, connection_settings,
+        resolver,
+        endpoint_info,
+        auth_settings,
+        connection_settings,
+        statements_cache_stats,
         engine::Deadline::FromDuration(std::chrono::milliseconds{200})};
   };
 
@@ -1,6 +1,8 @@
 #include <userver/utest/utest.hpp>
 #include "../utils_mysqltest.hpp"
 
+#include <deque>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::mysql::tests {
@@ -86,6 +88,46 @@ UTEST(Cluster, InsertMany) {
   EXPECT_EQ(db_rows, rows_to_insert);
 }
 
+UTEST(Cluster, InsertManyRowWise) {
+  ClusterWrapper cluster{};
+  TmpTable table{cluster,
+                 "A INT NOT NULL, B BIGINT NOT NULL, C DOUBLE NOT NULL"};
+
+  struct NumericRow final {
+    std::int32_t a{};
+    std::int64_t b{};
+    double c{};
+
+    bool operator==(const NumericRow& other) const {
+      return a == other.a && b == other.b && c == other.c;
+    }
+  };
+
+  constexpr int kRowsCount = 1000;
+
+  std::vector<NumericRow> rows_to_insert;
+  rows_to_insert.reserve(kRowsCount);
+  for (int i = 0; i < kRowsCount; ++i) {
+    rows_to_insert.push_back({i, std::int64_t{i} << 32, i / 2.0});
+  }
+
+  const auto query =
+      table.FormatWithTableName("INSERT INTO {}(A, B, C) VALUES(?, ?, ?)");
+  cluster->ExecuteBulk(kPrimaryHost, query, rows_to_insert);
+  // the same cached statement executed with a single row and a callback batch
+  cluster->ExecuteDecompose(kPrimaryHost, query, rows_to_insert.front());
+  const std::deque<NumericRow> rows_deque{rows_to_insert.begin(),
+                                          rows_to_insert.begin() + 2};
+  cluster->ExecuteBulk(kPrimaryHost, query, rows_deque);
+
+  const auto db_rows = table.DefaultExecute("SELECT A, B, C FROM {}")
+                           .AsVector<NumericRow>();
+  ASSERT_EQ(db_rows.size(), kRowsCount + 3);
+  EXPECT_EQ(std::vector<NumericRow>(db_rows.begin(),
+                                    db_rows.begin() + kRowsCount),
+            rows_to_insert);
+}
+
 UTEST(Cluster, UpdateMany) {
   ClusterWrapper cluster{};
   TmpTable table{cluster, "Id INT PRIMARY KEY, Value TEXT NOT NULL"};
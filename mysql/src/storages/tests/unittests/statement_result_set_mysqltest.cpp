@@ -318,6 +318,69 @@ UTEST(StatementResultSet, MapFrom) {
 
 }  // namespace map_from_sample
 
+namespace for_each_sample {
+
+/// [uMySQL usage sample - StatementResultSet ForEach]
+struct SampleRow final {
+  std::int32_t id;
+  std::string value;
+
+  bool operator==(const SampleRow& other) const {
+    return id == other.id && value == other.value;
+  }
+};
+
+void PerformForEach(const Cluster& cluster,
+                    const std::vector<SampleRow>& expected_data) {
+  cluster.ExecuteBulk(ClusterHostType::kPrimary,
+                      "INSERT INTO SampleTable(id, value) VALUES (?, ?)",
+                      expected_data);
+
+  std::vector<SampleRow> db_rows;
+  cluster
+      .Execute(ClusterHostType::kPrimary,
+               "SELECT id, value FROM SampleTable ORDER BY id")
+      .ForEach<SampleRow>(
+          [&db_rows](SampleRow&& row) { db_rows.push_back(std::move(row)); });
+
+  EXPECT_EQ(expected_data, db_rows);
+}
+/// [uMySQL usage sample - StatementResultSet ForEach]
+
+UTEST(StatementResultSet, ForEach) {
+  const ClusterWrapper cluster{};
+
+  PrepareSampleTable(*cluster);
+
+  std::vector<SampleRow> rows;
+  for (std::int32_t i = 0; i < 1000; ++i) {
+    rows.push_back({i, utils::generators::GenerateUuid()});
+  }
+  PerformForEach(*cluster, rows);
+}
+
+UTEST(StatementResultSet, ForEachFieldTag) {
+  const ClusterWrapper cluster{};
+
+  PrepareSampleTable(*cluster);
+  cluster->ExecuteBulk(ClusterHostType::kPrimary,
+                       "INSERT INTO SampleTable(id, value) VALUES (?, ?)",
+                       std::vector<SampleRow>{{1, "first"}, {2, "second"}});
+
+  std::vector<std::string> values;
+  cluster
+      ->Execute(ClusterHostType::kPrimary,
+                "SELECT value FROM SampleTable ORDER BY id")
+      .ForEach<std::string>(
+          [&values](std::string&& value) {
+            values.push_back(std::move(value));
+          },
+          kFieldTag);
+  EXPECT_EQ(values, (std::vector<std::string>{"first", "second"}));
+}
+
+}  // namespace for_each_sample
+
 }  // namespace storages::mysql::tests
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,89 @@
+#pragma once
+
+/// @file userver/otlp/trace/component.hpp
+/// @brief @copybrief otlp::TraceExporterComponent
+
+#include <memory>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace trace {
+class Exporter;
+}  // namespace trace
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that sends the finished tracing::Span to an OpenTelemetry
+/// collector over OTLP/gRPC.
+///
+/// The spans are passed to the component as is, without formatting them into
+/// the logs. They are queued, converted into protobuf and sent in batches from
+/// a background task. If the queue is full, the new spans are dropped.
+///
+/// The export RPC uses the client factory of
+/// ugrpc::client::ClientFactoryComponent, the spans of the export requests are
+/// neither logged nor exported.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | OTLP/gRPC endpoint of the collector | -
+/// service-name | `service.name` resource attribute of the spans | -
+/// task-processor | task processor to convert and send the spans on | -
+/// client-factory | name of the ugrpc::client::ClientFactoryComponent | grpc-client-factory
+/// max-queue-size | count of the spans waiting for the export, other spans are dropped | 65536
+/// max-batch-size | count of the spans in an export request | 512
+/// export-interval | max time a span waits for its batch to fill up | 1s
+/// export-timeout | deadline of an export request | 10s
+/// log-spans | whether to also write the exported spans to the logs | true
+///
+/// ## Static configuration example:
+///
+/// ```yaml
+/// otlp-trace-exporter:
+///     endpoint: localhost:4317
+///     service-name: my-service
+///     task-processor: fs-task-processor
+///     log-spans: false
+/// ```
+///
+/// ## Statistics
+/// The `otlp.trace-exporter` metrics contain the counters of `exported`,
+/// `dropped` (the queue was full), `rejected` (by the collector) and `failed`
+/// (the request failed) spans, the count of export `requests` and the current
+/// `queue_size`.
+
+// clang-format on
+class TraceExporterComponent final
+    : public components::LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of otlp::TraceExporterComponent
+  static constexpr std::string_view kName = "otlp-trace-exporter";
+
+  TraceExporterComponent(const components::ComponentConfig& config,
+                         const components::ComponentContext& context);
+
+  ~TraceExporterComponent() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<trace::Exporter> exporter_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+}  // namespace otlp
+
+template <>
+inline constexpr bool components::kHasValidate<otlp::TraceExporterComponent> =
+    true;
+
+USERVER_NAMESPACE_END
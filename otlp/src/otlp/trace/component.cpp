@@ -0,0 +1,119 @@
+#include <userver/otlp/trace/component.hpp>
+
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/ugrpc/client/client_factory_component.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <otlp/trace/exporter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp {
+
+namespace {
+
+trace::ExporterConfig ParseExporterConfig(
+    const components::ComponentConfig& config) {
+  const trace::ExporterConfig defaults;
+
+  trace::ExporterConfig result;
+  result.service_name = config["service-name"].As<std::string>();
+  result.max_queue_size =
+      config["max-queue-size"].As<std::size_t>(defaults.max_queue_size);
+  result.max_batch_size =
+      config["max-batch-size"].As<std::size_t>(defaults.max_batch_size);
+  result.export_interval =
+      config["export-interval"].As<std::chrono::milliseconds>(
+          defaults.export_interval);
+  result.export_timeout =
+      config["export-timeout"].As<std::chrono::milliseconds>(
+          defaults.export_timeout);
+  return result;
+}
+
+}  // namespace
+
+TraceExporterComponent::TraceExporterComponent(
+    const components::ComponentConfig& config,
+    const components::ComponentContext& context)
+    : LoggableComponentBase(config, context) {
+  auto& client_factory =
+      context
+          .FindComponent<ugrpc::client::ClientFactoryComponent>(
+              config["client-factory"].As<std::string>(
+                  ugrpc::client::ClientFactoryComponent::kName))
+          .GetFactory();
+
+  exporter_ = std::make_shared<trace::Exporter>(
+      client_factory.MakeClient<trace::TraceServiceClient>(
+          config.Name(), config["endpoint"].As<std::string>()),
+      ParseExporterConfig(config));
+
+  auto& storage =
+      context.FindComponent<components::StatisticsStorage>().GetStorage();
+  statistics_holder_ = storage.RegisterWriter(
+      "otlp.trace-exporter", [this](utils::statistics::Writer& writer) {
+        exporter_->WriteStatistics(writer);
+      });
+
+  exporter_->Start(context.GetTaskProcessor(
+      config["task-processor"].As<std::string>()));
+  tracing::SetSpanExporter(exporter_, config["log-spans"].As<bool>(true));
+}
+
+TraceExporterComponent::~TraceExporterComponent() {
+  tracing::SetSpanExporter(nullptr);
+  statistics_holder_.Unregister();
+  exporter_->Stop();
+}
+
+yaml_config::Schema TraceExporterComponent::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<components::LoggableComponentBase>(R"(
+type: object
+description: Component that sends the finished spans to an OpenTelemetry collector
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: OTLP/gRPC endpoint of the collector
+    service-name:
+        type: string
+        description: service.name resource attribute of the spans
+    task-processor:
+        type: string
+        description: task processor to convert and send the spans on
+    client-factory:
+        type: string
+        description: name of the ugrpc::client::ClientFactoryComponent
+        defaultDescription: grpc-client-factory
+    max-queue-size:
+        type: integer
+        minimum: 1
+        description: count of the spans waiting for the export, other spans are dropped
+        defaultDescription: 65536
+    max-batch-size:
+        type: integer
+        minimum: 1
+        description: count of the spans in an export request
+        defaultDescription: 512
+    export-interval:
+        type: string
+        description: max time a span waits for its batch to fill up
+        defaultDescription: 1s
+    export-timeout:
+        type: string
+        description: deadline of an export request
+        defaultDescription: 10s
+    log-spans:
+        type: boolean
+        description: whether to also write the exported spans to the logs
+        defaultDescription: true
+)");
+}
+
+}  // namespace otlp
+
+USERVER_NAMESPACE_END
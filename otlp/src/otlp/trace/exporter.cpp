@@ -0,0 +1,118 @@
+#include <otlp/trace/exporter.hpp>
+
+#include <algorithm>
+
+#include <grpcpp/client_context.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/ugrpc/client/exceptions.hpp>
+
+#include <otlp/trace/span_conversion.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::trace {
+
+namespace {
+
+constexpr std::string_view kExportSpanName = "otlp_export";
+
+}  // namespace
+
+Exporter::Exporter(TraceServiceClient&& client, ExporterConfig config)
+    : config_(std::move(config)),
+      client_(std::move(client)),
+      queue_(Queue::Create(config_.max_queue_size)),
+      producer_(queue_->GetMultiProducer()),
+      consumer_(queue_->GetConsumer()) {
+  batch_.reserve(config_.max_batch_size);
+}
+
+Exporter::~Exporter() = default;
+
+void Exporter::Start(engine::TaskProcessor& task_processor) {
+  task_ = engine::CriticalAsyncNoSpan(task_processor, [this] { Run(); });
+}
+
+void Exporter::Stop() {
+  if (task_.IsValid()) task_.SyncCancel();
+
+  tracing::FinishedSpan span;
+  while (consumer_.PopNoblock(span)) {
+    batch_.push_back(std::move(span));
+    if (batch_.size() == config_.max_batch_size) SendBatch();
+  }
+  SendBatch();
+}
+
+void Exporter::Export(tracing::FinishedSpan&& span) noexcept {
+  if (!producer_.PushNoblock(std::move(span))) {
+    ++dropped_;
+  }
+}
+
+void Exporter::Run() {
+  while (!engine::current_task::ShouldCancel()) {
+    CollectBatch(engine::Deadline::FromDuration(config_.export_interval));
+    SendBatch();
+  }
+}
+
+void Exporter::CollectBatch(engine::Deadline deadline) {
+  tracing::FinishedSpan span;
+  while (batch_.size() < config_.max_batch_size &&
+         consumer_.Pop(span, deadline)) {
+    batch_.push_back(std::move(span));
+  }
+}
+
+void Exporter::SendBatch() {
+  if (batch_.empty()) return;
+
+  // The spans of the export RPC are neither logged nor exported, otherwise
+  // each export would produce spans for the next one
+  tracing::Span span{std::string{kExportSpanName}};
+  span.SetLocalLogLevel(logging::Level::kNone);
+
+  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+  FillExportRequest(config_.service_name, batch_, request);
+  const auto batch_size = batch_.size();
+  batch_.clear();
+
+  auto context = std::make_unique<grpc::ClientContext>();
+  context->set_deadline(engine::Deadline::FromDuration(config_.export_timeout));
+
+  ++requests_;
+  try {
+    auto call = client_.Export(request, std::move(context));
+    const auto response = call.Finish();
+    const auto rejected = static_cast<std::uint64_t>(
+        response.partial_success().rejected_spans());
+    rejected_ += rejected;
+    exported_ += batch_size - std::min<std::uint64_t>(rejected, batch_size);
+    if (rejected != 0) {
+      LOG_LIMITED_WARNING() << "OTLP collector rejected " << rejected
+                            << " spans: "
+                            << response.partial_success().error_message();
+    }
+  } catch (const ugrpc::client::RpcError& e) {
+    failed_ += batch_size;
+    LOG_LIMITED_WARNING() << "Failed to export " << batch_size
+                          << " spans: " << e;
+  }
+}
+
+void Exporter::WriteStatistics(utils::statistics::Writer& writer) const {
+  writer["exported"] = exported_.load();
+  writer["dropped"] = dropped_.load();
+  writer["rejected"] = rejected_.load();
+  writer["failed"] = failed_.load();
+  writer["requests"] = requests_.load();
+  writer["queue_size"] = queue_->GetSizeApproximate();
+}
+
+}  // namespace otlp::trace
+
+USERVER_NAMESPACE_END
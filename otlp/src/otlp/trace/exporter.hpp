@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/tracing/span_exporter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <opentelemetry/proto/collector/trace/v1/trace_service_client.usrv.pb.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::trace {
+
+using TraceServiceClient =
+    opentelemetry::proto::collector::trace::v1::TraceServiceClient;
+
+struct ExporterConfig final {
+  std::string service_name;
+  std::size_t max_queue_size{65536};
+  std::size_t max_batch_size{512};
+  std::chrono::milliseconds export_interval{1000};
+  std::chrono::milliseconds export_timeout{10000};
+};
+
+// Collects the finished spans into a bounded queue and sends them in batches
+// from a background task. Spans that do not fit into the queue are dropped.
+class Exporter final : public tracing::SpanExporter {
+ public:
+  Exporter(TraceServiceClient&& client, ExporterConfig config);
+  ~Exporter() override;
+
+  void Start(engine::TaskProcessor& task_processor);
+
+  // Stops the background task and sends the spans left in the queue
+  void Stop();
+
+  void Export(tracing::FinishedSpan&& span) noexcept override;
+
+  void WriteStatistics(utils::statistics::Writer& writer) const;
+
+ private:
+  using Queue = concurrent::NonFifoMpscQueue<tracing::FinishedSpan>;
+
+  void Run();
+  void CollectBatch(engine::Deadline deadline);
+  void SendBatch();
+
+  const ExporterConfig config_;
+  TraceServiceClient client_;
+
+  std::shared_ptr<Queue> queue_;
+  Queue::MultiProducer producer_;
+  Queue::Consumer consumer_;
+  std::vector<tracing::FinishedSpan> batch_;
+
+  std::atomic<std::uint64_t> exported_{0};
+  std::atomic<std::uint64_t> dropped_{0};
+  std::atomic<std::uint64_t> rejected_{0};
+  std::atomic<std::uint64_t> failed_{0};
+  std::atomic<std::uint64_t> requests_{0};
+
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace otlp::trace
+
+USERVER_NAMESPACE_END
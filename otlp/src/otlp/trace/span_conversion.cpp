@@ -0,0 +1,125 @@
+#include <otlp/trace/span_conversion.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include <userver/tracing/tags.hpp>
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::trace {
+
+namespace {
+
+constexpr std::size_t kTraceIdSize = 16;
+constexpr std::size_t kSpanIdSize = 8;
+
+constexpr std::string_view kServiceNameAttribute = "service.name";
+constexpr std::string_view kScopeName = "userver";
+
+std::string ToBinaryId(std::string_view id, std::size_t size) {
+  std::string result;
+  if (id.size() != size * 2 ||
+      utils::encoding::FromHex(id, result) != id.size()) {
+    result = id.substr(0, size);
+  }
+  result.resize(size, '\0');
+  return result;
+}
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+void ConvertValue(const logging::LogExtra::Value& value,
+                  opentelemetry::proto::common::v1::AnyValue& result) {
+  std::visit(
+      [&result](const auto& item) {
+        using Item = std::decay_t<decltype(item)>;
+        if constexpr (std::is_same_v<Item, std::string>) {
+          result.set_string_value(item);
+        } else if constexpr (std::is_floating_point_v<Item>) {
+          result.set_double_value(item);
+        } else {
+          result.set_int_value(static_cast<std::int64_t>(item));
+        }
+      },
+      value);
+}
+
+bool IsErrorFlag(const logging::LogExtra::Value& value) {
+  return std::visit(
+      [](const auto& item) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(item)>,
+                                     std::string>) {
+          return !item.empty();
+        } else {
+          return item != 0;
+        }
+      },
+      value);
+}
+
+}  // namespace
+
+void ConvertSpan(const tracing::FinishedSpan& span,
+                 opentelemetry::proto::trace::v1::Span& result) {
+  result.set_trace_id(ToBinaryId(span.trace_id, kTraceIdSize));
+  result.set_span_id(ToBinaryId(span.span_id, kSpanIdSize));
+  if (!span.parent_id.empty()) {
+    result.set_parent_span_id(ToBinaryId(span.parent_id, kSpanIdSize));
+  }
+  result.set_name(span.name);
+  result.set_kind(opentelemetry::proto::trace::v1::Span::SPAN_KIND_INTERNAL);
+  result.set_start_time_unix_nano(ToUnixNano(span.start_time));
+  result.set_end_time_unix_nano(ToUnixNano(span.end_time));
+
+  auto& attributes = *result.mutable_attributes();
+  attributes.Reserve(span.tags.size());
+  for (const auto& [key, value] : span.tags) {
+    if (key == tracing::kErrorFlag && IsErrorFlag(value)) {
+      result.mutable_status()->set_code(
+          opentelemetry::proto::trace::v1::Status::STATUS_CODE_ERROR);
+    } else if (key == tracing::kErrorMessage) {
+      if (const auto* message = std::get_if<std::string>(&value)) {
+        result.mutable_status()->set_message(*message);
+      }
+    }
+
+    auto& attribute = *attributes.Add();
+    attribute.set_key(key);
+    ConvertValue(value, *attribute.mutable_value());
+  }
+}
+
+void FillExportRequest(
+    std::string_view service_name,
+    const std::vector<tracing::FinishedSpan>& spans,
+    opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest&
+        request) {
+  auto& resource_spans = *request.add_resource_spans();
+
+  auto& service_attribute =
+      *resource_spans.mutable_resource()->add_attributes();
+  service_attribute.set_key(std::string{kServiceNameAttribute});
+  service_attribute.mutable_value()->set_string_value(
+      std::string{service_name});
+
+  auto& scope_spans = *resource_spans.add_scope_spans();
+  scope_spans.mutable_scope()->set_name(std::string{kScopeName});
+
+  auto& result = *scope_spans.mutable_spans();
+  result.Reserve(spans.size());
+  for (const auto& span : spans) {
+    ConvertSpan(span, *result.Add());
+  }
+}
+
+}  // namespace otlp::trace
+
+USERVER_NAMESPACE_END
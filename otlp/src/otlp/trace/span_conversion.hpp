@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include <userver/tracing/span_exporter.hpp>
+
+#include <opentelemetry/proto/collector/trace/v1/trace_service.pb.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace otlp::trace {
+
+// Converts the span to OTLP. Trace and span ids that are not hex strings of
+// the OTLP size are truncated or padded with zeros.
+void ConvertSpan(const tracing::FinishedSpan& span,
+                 opentelemetry::proto::trace::v1::Span& result);
+
+void FillExportRequest(
+    std::string_view service_name,
+    const std::vector<tracing::FinishedSpan>& spans,
+    opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest&
+        request);
+
+}  // namespace otlp::trace
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,96 @@
+#include <otlp/trace/span_conversion.hpp>
+
+#include <gtest/gtest.h>
+
+#include <userver/tracing/tags.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+tracing::FinishedSpan MakeSpan() {
+  tracing::FinishedSpan span;
+  span.name = "handler";
+  span.trace_id = "0123456789abcdef0123456789abcdef";
+  span.span_id = "0123456789abcdef";
+  span.parent_id = "fedcba9876543210";
+  span.start_time =
+      std::chrono::system_clock::time_point{std::chrono::seconds{1}};
+  span.end_time = span.start_time + std::chrono::milliseconds{5};
+  span.tags = {
+      {"http_url", std::string{"/ping"}},
+      {"attempts", 2},
+      {"total_time", 5.0},
+  };
+  return span;
+}
+
+}  // namespace
+
+TEST(OtlpSpanConversion, Basic) {
+  opentelemetry::proto::trace::v1::Span result;
+  otlp::trace::ConvertSpan(MakeSpan(), result);
+
+  EXPECT_EQ(result.name(), "handler");
+  EXPECT_EQ(result.trace_id(),
+            std::string("\x01\x23\x45\x67\x89\xab\xcd\xef"
+                        "\x01\x23\x45\x67\x89\xab\xcd\xef",
+                        16));
+  EXPECT_EQ(result.span_id(),
+            std::string("\x01\x23\x45\x67\x89\xab\xcd\xef", 8));
+  EXPECT_EQ(result.parent_span_id(),
+            std::string("\xfe\xdc\xba\x98\x76\x54\x32\x10", 8));
+  EXPECT_EQ(result.start_time_unix_nano(), 1'000'000'000);
+  EXPECT_EQ(result.end_time_unix_nano(), 1'005'000'000);
+
+  ASSERT_EQ(result.attributes_size(), 3);
+  EXPECT_EQ(result.attributes(0).key(), "http_url");
+  EXPECT_EQ(result.attributes(0).value().string_value(), "/ping");
+  EXPECT_EQ(result.attributes(1).value().int_value(), 2);
+  EXPECT_EQ(result.attributes(2).value().double_value(), 5.0);
+  EXPECT_EQ(result.status().code(),
+            opentelemetry::proto::trace::v1::Status::STATUS_CODE_UNSET);
+}
+
+TEST(OtlpSpanConversion, Error) {
+  auto span = MakeSpan();
+  span.tags.emplace_back(tracing::kErrorFlag, 1);
+  span.tags.emplace_back(tracing::kErrorMessage, std::string{"timeout"});
+
+  opentelemetry::proto::trace::v1::Span result;
+  otlp::trace::ConvertSpan(span, result);
+
+  EXPECT_EQ(result.status().code(),
+            opentelemetry::proto::trace::v1::Status::STATUS_CODE_ERROR);
+  EXPECT_EQ(result.status().message(), "timeout");
+}
+
+TEST(OtlpSpanConversion, ForeignIds) {
+  auto span = MakeSpan();
+  span.trace_id = "not-a-hex-id";
+  span.parent_id.clear();
+
+  opentelemetry::proto::trace::v1::Span result;
+  otlp::trace::ConvertSpan(span, result);
+
+  EXPECT_EQ(result.trace_id().size(), 16);
+  EXPECT_EQ(result.trace_id().substr(0, 12), "not-a-hex-id");
+  EXPECT_TRUE(result.parent_span_id().empty());
+}
+
+TEST(OtlpSpanConversion, ExportRequest) {
+  opentelemetry::proto::collector::trace::v1::ExportTraceServiceRequest request;
+  otlp::trace::FillExportRequest("my-service", {MakeSpan(), MakeSpan()},
+                                 request);
+
+  ASSERT_EQ(request.resource_spans_size(), 1);
+  const auto& resource_spans = request.resource_spans(0);
+  ASSERT_EQ(resource_spans.resource().attributes_size(), 1);
+  EXPECT_EQ(resource_spans.resource().attributes(0).key(), "service.name");
+  EXPECT_EQ(resource_spans.resource().attributes(0).value().string_value(),
+            "my-service");
+  ASSERT_EQ(resource_spans.scope_spans_size(), 1);
+  EXPECT_EQ(resource_spans.scope_spans(0).spans_size(), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -5,11 +5,15 @@
 
 #include <userver/cache/base_postgres_cache_fwd.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <map>
+#include <optional>
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -17,17 +21,22 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
 
 #include <userver/storages/postgres/cluster.hpp>
 #include <userver/storages/postgres/component.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
 #include <userver/storages/postgres/io/chrono.hpp>
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/meta.hpp>
+#include <userver/utils/parallel_for.hpp>
 #include <userver/utils/void_t.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -65,7 +74,7 @@ namespace components {
 /// full-update-op-timeout | timeout for a full update | 1m
 /// incremental-update-op-timeout | timeout for an incremental update | 1s
 /// update-correction | incremental update window adjustment | - (0 for caches with defined GetLastKnownUpdated)
-/// chunk-size | number of rows to request from PostgreSQL via portals, 0 to fetch all rows in one request without portals | 1000
+/// chunk-size | number of rows to request from PostgreSQL via portals (or via a server-side cursor if the driver does not support portals), 0 to fetch all rows in one request | 1000
 ///
 /// @section pg_cc_cache_policy Cache policy
 ///
@@ -97,6 +106,45 @@ namespace components {
 ///
 /// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Custom Container With Write Notification Example
 ///
+/// An incremental update copies the whole container of the previous
+/// snapshot before applying the changes. For big caches with small
+/// incremental updates use cache::PersistentMap as the CacheContainer: its
+/// copy is O(1) and the update copies only the changed parts of it.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Persistent Container Example
+///
+/// Policy may have static function GetFullUpdateQueries returning the
+/// queries that together select all the rows of a partitioned table, e.g.
+/// one query per partition or key range. A full update runs them
+/// concurrently on separate connections of the cluster hosts selected by
+/// kClusterHostType, and merges their results into the new container in the
+/// order of the queries as they arrive. Each query is fetched in one
+/// request, `chunk-size` does not apply. Incremental updates still use
+/// the single query.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Parallel Full Update Example
+///
+/// Policy may have static member kNotifyChannel with the name of a channel
+/// the writers send a `NOTIFY` to after changing the data. The cache listens
+/// on that channel on each shard and runs an incremental update as soon as a
+/// notification arrives, so the changes do not wait for the next periodic
+/// update. The notifications received during `notify-debounce` after the
+/// first one result in a single update. Each listener holds a connection of
+/// the pool. The periodic updates go on as usual and catch up the changes if
+/// the listener loses its connection; the listener resubscribes in
+/// background and forces an update after that, as the notifications might
+/// have been missed.
+///
+/// @snippet cache/postgres_cache_test.cpp Pg Cache Policy Notify Example
+///
+/// Converting the rows to the cache values may take most of the update time
+/// for big caches with expensive conversions. With `parse-task-processor` set,
+/// the rows of each fetched chunk are converted in parallel on that task
+/// processor with utils::ParallelFor, while the values are still inserted
+/// into the container one by one in the order of the rows, so any
+/// CacheContainer works as is. Use a big enough `chunk-size` or 0 for the
+/// conversion to be split between the workers.
+///
 /// @section pg_cc_forward_declaration Forward Declaration
 ///
 /// To forward declare a cache you can forward declare a trait and
@@ -161,6 +209,20 @@ using HasWhere = decltype(T::kWhere);
 template <typename T>
 inline constexpr bool kHasWhere = meta::kIsDetected<HasWhere, T>;
 
+// Component GetFullUpdateQueries in policy
+template <typename T>
+using HasFullUpdateQueriesImpl = decltype(T::GetFullUpdateQueries());
+template <typename T>
+inline constexpr bool kHasFullUpdateQueries =
+    meta::kIsDetected<HasFullUpdateQueriesImpl, T>;
+
+// Component kNotifyChannel in policy
+template <typename T>
+using HasNotifyChannelImpl = decltype(T::kNotifyChannel);
+template <typename T>
+inline constexpr bool kHasNotifyChannel =
+    meta::kIsDetected<HasNotifyChannelImpl, T>;
+
 // Update field
 template <typename T>
 using HasUpdatedField = decltype(T::kUpdatedField);
@@ -240,6 +302,41 @@ void CacheInsertOrAssign(Container& container, Value&& value,
   container.insert_or_assign(std::move(key), std::forward<Value>(value));
 }
 
+template <typename T>
+using HasCountImpl = decltype(std::declval<const T&>().count(
+    std::declval<const cache::ChangeSetKey<T>&>()));
+
+// Whether the changed keys of the container may be reported to the
+// subscribers of CachingComponentBase::UpdateAndListenChanges
+template <typename Container, typename PostgreCachePolicy>
+inline constexpr bool kReportsChanges =
+    cache::kHasChangeSetKey<Container> &&
+    std::is_same_v<cache::ChangeSetKey<Container>,
+                   KeyMemberType<PostgreCachePolicy>>;
+
+template <typename Container, typename Key>
+void AddChangedKey(const Container& container, Key key,
+                   cache::ChangeSet<Key>& changes) {
+  if constexpr (meta::kIsDetected<HasCountImpl, Container>) {
+    if (container.count(key) == 0) {
+      changes.inserted.push_back(std::move(key));
+      return;
+    }
+  }
+  changes.updated.push_back(std::move(key));
+}
+
+// The changed keys are only known for incremental updates
+template <typename Container, typename PostgreCachePolicy>
+std::optional<cache::ChangeSet<cache::ChangeSetKey<Container>>> MakeChangeSet(
+    cache::UpdateType type) {
+  if (kReportsChanges<Container, PostgreCachePolicy> &&
+      type == cache::UpdateType::kIncremental) {
+    return cache::ChangeSet<cache::ChangeSetKey<Container>>{};
+  }
+  return std::nullopt;
+}
+
 template <typename T>
 using HasOnWritesDoneImpl = decltype(std::declval<T&>().OnWritesDone());
 
@@ -362,12 +459,16 @@ inline constexpr std::chrono::seconds kDefaultIncrementalUpdateTimeout{1};
 inline constexpr std::chrono::milliseconds kStatementTimeoutOff{0};
 inline constexpr std::chrono::milliseconds kCpuRelaxThreshold{10};
 inline constexpr std::chrono::milliseconds kCpuRelaxInterval{2};
+inline constexpr std::chrono::milliseconds kDefaultNotifyDebounce{100};
+inline constexpr std::chrono::seconds kNotifyRetryInterval{1};
 
 inline constexpr std::string_view kCopyStage = "copy_data";
 inline constexpr std::string_view kFetchStage = "fetch";
 inline constexpr std::string_view kParseStage = "parse";
 
 inline constexpr std::size_t kDefaultChunkSize = 1000;
+inline constexpr std::size_t kParallelParseMinChunkSize = 1000;
+inline constexpr std::string_view kCursorName = "userver_pg_cache_cursor";
 }  // namespace pg_cache::detail
 
 /// @ingroup userver_components
@@ -403,6 +504,9 @@ class PostgreCache final
 
  private:
   using CachedData = std::unique_ptr<DataType>;
+  using ChangeSet = cache::ChangeSet<cache::ChangeSetKey<DataType>>;
+  constexpr static bool kReportsChanges =
+      pg_cache::detail::kReportsChanges<DataType, PolicyType>;
 
   UpdatedFieldType GetLastUpdated(
       std::chrono::system_clock::time_point last_update,
@@ -416,7 +520,19 @@ class PostgreCache final
   bool MayReturnNull() const override;
 
   CachedData GetDataSnapshot(cache::UpdateType type, tracing::ScopeTime& scope);
+  template <typename... Args>
+  void FetchChunks(storages::postgres::Transaction& trx,
+                   const storages::postgres::Query& query,
+                   CachedData& data_cache, ChangeSet* changes,
+                   std::size_t& changes_count,
+                   cache::UpdateStatisticsScope& stats_scope,
+                   tracing::ScopeTime& scope, const Args&... args);
+  std::size_t FetchPartitions(const storages::postgres::ClusterPtr& cluster,
+                              CachedData& data_cache,
+                              cache::UpdateStatisticsScope& stats_scope,
+                              tracing::ScopeTime& scope);
   void CacheResults(storages::postgres::ResultSet res, CachedData& data_cache,
+                    ChangeSet* changes,
                     cache::UpdateStatisticsScope& stats_scope,
                     tracing::ScopeTime& scope);
 
@@ -425,14 +541,19 @@ class PostgreCache final
 
   std::chrono::milliseconds ParseCorrection(const ComponentConfig& config);
 
+  void ListenForChanges(storages::postgres::Cluster& cluster);
+
   std::vector<storages::postgres::ClusterPtr> clusters_;
 
   const std::chrono::system_clock::duration correction_;
   const std::chrono::milliseconds full_update_timeout_;
   const std::chrono::milliseconds incremental_update_timeout_;
   const std::size_t chunk_size_;
+  const std::chrono::milliseconds notify_debounce_;
   std::size_t cpu_relax_iterations_parse_{0};
   std::size_t cpu_relax_iterations_copy_{0};
+  engine::TaskProcessor* parse_task_processor_{nullptr};
+  std::vector<engine::TaskWithResult<void>> listen_tasks_;
 };
 
 template <typename PostgreCachePolicy>
@@ -450,12 +571,9 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
           config["incremental-update-op-timeout"].As<std::chrono::milliseconds>(
               pg_cache::detail::kDefaultIncrementalUpdateTimeout)},
       chunk_size_{config["chunk-size"].As<size_t>(
-          pg_cache::detail::kDefaultChunkSize)} {
-  UINVARIANT(
-      !chunk_size_ || storages::postgres::Portal::IsSupportedByDriver(),
-      "Either set 'chunk-size' to 0, or enable PostgreSQL portals by building "
-      "the framework with CMake option USERVER_FEATURE_PATCH_LIBPQ set to ON.");
-
+          pg_cache::detail::kDefaultChunkSize)},
+      notify_debounce_{config["notify-debounce"].As<std::chrono::milliseconds>(
+          pg_cache::detail::kDefaultNotifyDebounce)} {
   if (this->GetAllowedUpdateTypes() ==
           cache::AllowedUpdateTypes::kFullAndIncremental &&
       !kIncrementalUpdates) {
@@ -471,6 +589,12 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
         config.Name() + "' cache");
   }
 
+  const auto parse_task_processor =
+      config["parse-task-processor"].As<std::optional<std::string>>();
+  if (parse_task_processor) {
+    parse_task_processor_ = &context.GetTaskProcessor(*parse_task_processor);
+  }
+
   const auto pg_alias = config["pgcomponent"].As<std::string>("");
   if (pg_alias.empty()) {
     throw storages::postgres::InvalidConfig{
@@ -488,10 +612,19 @@ PostgreCache<PostgreCachePolicy>::PostgreCache(const ComponentConfig& config,
              << GetDeltaQuery().Statement() << "`";
 
   this->StartPeriodicUpdates();
+
+  if constexpr (pg_cache::detail::kHasNotifyChannel<PostgreCachePolicy>) {
+    for (const auto& cluster : clusters_) {
+      listen_tasks_.push_back(utils::CriticalAsync(
+          this->GetCacheTaskProcessor(), "pg_cache_listen",
+          [this, &cluster] { ListenForChanges(*cluster); }));
+    }
+  }
 }
 
 template <typename PostgreCachePolicy>
 PostgreCache<PostgreCachePolicy>::~PostgreCache() {
+  for (auto& task : listen_tasks_) task.SyncCancel();
   this->StopPeriodicUpdates();
 }
 
@@ -539,6 +672,47 @@ std::chrono::milliseconds PostgreCache<PostgreCachePolicy>::ParseCorrection(
   }
 }
 
+template <typename PostgreCachePolicy>
+void PostgreCache<PostgreCachePolicy>::ListenForChanges(
+    storages::postgres::Cluster& cluster) {
+  namespace pg = storages::postgres;
+  const auto update_type =
+      this->GetAllowedUpdateTypes() == cache::AllowedUpdateTypes::kOnlyFull
+          ? cache::UpdateType::kFull
+          : cache::UpdateType::kIncremental;
+
+  bool is_resubscribed = false;
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      auto scope = cluster.Listen(PostgreCachePolicy::kNotifyChannel);
+      // The first update runs anyway, but the changes made while the
+      // listener was away are only seen by the periodic updates
+      if (std::exchange(is_resubscribed, true)) {
+        this->InvalidateAsync(update_type);
+      }
+
+      while (true) {
+        scope.WaitNotify(engine::Deadline{});
+        const auto debounce_deadline =
+            engine::Deadline::FromDuration(notify_debounce_);
+        try {
+          while (true) scope.WaitNotify(debounce_deadline);
+        } catch (const pg::ConnectionTimeoutError&) {
+          if (engine::current_task::ShouldCancel()) return;
+        }
+        this->InvalidateAsync(update_type);
+      }
+    } catch (const std::exception& e) {
+      if (engine::current_task::ShouldCancel()) return;
+      LOG_LIMITED_WARNING() << "Cache " << kName
+                            << " failed to listen on channel '"
+                            << PostgreCachePolicy::kNotifyChannel
+                            << "': " << e;
+      engine::InterruptibleSleepFor(pg_cache::detail::kNotifyRetryInterval);
+    }
+  }
+}
+
 template <typename PostgreCachePolicy>
 typename PostgreCache<PostgreCachePolicy>::UpdatedFieldType
 PostgreCache<PostgreCachePolicy>::GetLastUpdated(
@@ -575,27 +749,35 @@ void PostgreCache<PostgreCachePolicy>::Update(
 
   scope.Reset(std::string{pg_cache::detail::kFetchStage});
 
+  auto change_set =
+      pg_cache::detail::MakeChangeSet<DataType, PolicyType>(type);
+  ChangeSet* const change_set_ptr = change_set ? &*change_set : nullptr;
+
   size_t changes = 0;
+  const bool has_parameter = query.Statement().find('$') != std::string::npos;
   // Iterate clusters
   for (auto& cluster : clusters_) {
+    if constexpr (pg_cache::detail::kHasFullUpdateQueries<PostgreCachePolicy>) {
+      if (type == cache::UpdateType::kFull) {
+        changes += FetchPartitions(cluster, data_cache, stats_scope, scope);
+        continue;
+      }
+    }
+
     if (chunk_size_ > 0) {
       auto trx = cluster->Begin(
           kClusterHostTypeFlags, pg::Transaction::RO,
           pg::CommandControl{timeout, pg_cache::detail::kStatementTimeoutOff});
-      auto portal =
-          trx.MakePortal(query, GetLastUpdated(last_update, *data_cache));
-      while (portal) {
-        scope.Reset(std::string{pg_cache::detail::kFetchStage});
-        auto res = portal.Fetch(chunk_size_);
-        stats_scope.IncreaseDocumentsReadCount(res.Size());
-
-        scope.Reset(std::string{pg_cache::detail::kParseStage});
-        CacheResults(res, data_cache, stats_scope, scope);
-        changes += res.Size();
+      if (has_parameter) {
+        FetchChunks(trx, query, data_cache, change_set_ptr, changes,
+                    stats_scope, scope,
+                    GetLastUpdated(last_update, *data_cache));
+      } else {
+        FetchChunks(trx, query, data_cache, change_set_ptr, changes,
+                    stats_scope, scope);
       }
       trx.Commit();
     } else {
-      bool has_parameter = query.Statement().find('$') != std::string::npos;
       auto res = has_parameter
                      ? cluster->Execute(
                            kClusterHostTypeFlags,
@@ -608,10 +790,11 @@ void PostgreCache<PostgreCachePolicy>::Update(
                                timeout, pg_cache::detail::kStatementTimeoutOff},
                            query);
       stats_scope.IncreaseDocumentsReadCount(res.Size());
+      changes += res.Size();
 
       scope.Reset(std::string{pg_cache::detail::kParseStage});
-      CacheResults(res, data_cache, stats_scope, scope);
-      changes += res.Size();
+      CacheResults(std::move(res), data_cache, change_set_ptr, stats_scope,
+                   scope);
     }
   }
 
@@ -650,6 +833,12 @@ void PostgreCache<PostgreCachePolicy>::Update(
     // Set current cache
     stats_scope.Finish(data_cache->size());
     pg_cache::detail::OnWritesDone(*data_cache);
+    if constexpr (kReportsChanges) {
+      if (change_set) {
+        this->SetWithChanges(std::move(data_cache), *change_set);
+        return;
+      }
+    }
     this->Set(std::move(data_cache));
   } else {
     stats_scope.FinishNoChanges();
@@ -661,23 +850,161 @@ bool PostgreCache<PostgreCachePolicy>::MayReturnNull() const {
   return pg_cache::detail::MayReturnNull<PolicyType>();
 }
 
+template <typename PostgreCachePolicy>
+template <typename... Args>
+void PostgreCache<PostgreCachePolicy>::FetchChunks(
+    storages::postgres::Transaction& trx,
+    const storages::postgres::Query& query, CachedData& data_cache,
+    ChangeSet* changes, std::size_t& changes_count,
+    cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime& scope,
+    const Args&... args) {
+  namespace pg = storages::postgres;
+  // Each chunk is converted and released before the next one is fetched, so
+  // only one chunk of the raw rows is kept in memory besides the new data
+  const auto process_chunk = [&](pg::ResultSet&& res) {
+    stats_scope.IncreaseDocumentsReadCount(res.Size());
+    changes_count += res.Size();
+
+    scope.Reset(std::string{pg_cache::detail::kParseStage});
+    CacheResults(std::move(res), data_cache, changes, stats_scope, scope);
+  };
+
+  if (pg::Portal::IsSupportedByDriver()) {
+    auto portal = trx.MakePortal(query, args...);
+    while (portal) {
+      scope.Reset(std::string{pg_cache::detail::kFetchStage});
+      process_chunk(portal.Fetch(chunk_size_));
+    }
+    return;
+  }
+
+  // The stock libpq cannot fetch a part of a result, a server-side cursor
+  // is used instead. It is closed by the end of the transaction.
+  trx.Execute(pg::Query{fmt::format("declare {} no scroll cursor for {}",
+                                    pg_cache::detail::kCursorName,
+                                    query.Statement()),
+                        query.GetName()},
+              args...);
+  const pg::Query fetch_query{fmt::format(
+      "fetch forward {} from {}", chunk_size_, pg_cache::detail::kCursorName)};
+  bool done = false;
+  while (!done) {
+    scope.Reset(std::string{pg_cache::detail::kFetchStage});
+    auto res = trx.Execute(fetch_query);
+    done = res.Size() < chunk_size_;
+    process_chunk(std::move(res));
+  }
+}
+
+template <typename PostgreCachePolicy>
+std::size_t PostgreCache<PostgreCachePolicy>::FetchPartitions(
+    const storages::postgres::ClusterPtr& cluster, CachedData& data_cache,
+    cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime& scope) {
+  namespace pg = storages::postgres;
+  const pg::CommandControl cmd_ctl{full_update_timeout_,
+                                   pg_cache::detail::kStatementTimeoutOff};
+
+  std::vector<engine::TaskWithResult<pg::ResultSet>> tasks;
+  for (auto& query : PostgreCachePolicy::GetFullUpdateQueries()) {
+    tasks.push_back(utils::Async(
+        "pg_cache_fetch_partition",
+        [&cluster, &cmd_ctl, query = pg::Query{std::move(query)}] {
+          return cluster->Execute(kClusterHostTypeFlags, cmd_ctl, query);
+        }));
+  }
+
+  // The container is filled by this task only, the partitions that are not
+  // fetched yet are being fetched meanwhile. On error the rest of the tasks
+  // are cancelled by their destructors.
+  std::size_t changes = 0;
+  for (auto& task : tasks) {
+    scope.Reset(std::string{pg_cache::detail::kFetchStage});
+    auto res = task.Get();
+    stats_scope.IncreaseDocumentsReadCount(res.Size());
+    changes += res.Size();
+
+    scope.Reset(std::string{pg_cache::detail::kParseStage});
+    CacheResults(std::move(res), data_cache, nullptr, stats_scope, scope);
+  }
+  return changes;
+}
+
 template <typename PostgreCachePolicy>
 void PostgreCache<PostgreCachePolicy>::CacheResults(
     storages::postgres::ResultSet res, CachedData& data_cache,
+    [[maybe_unused]] ChangeSet* changes,
     cache::UpdateStatisticsScope& stats_scope, tracing::ScopeTime& scope) {
   auto values = res.AsSetOf<RawValueType>(storages::postgres::kRowTag);
+  const auto insert = [&](ValueType&& value) {
+    if constexpr (kReportsChanges) {
+      if (changes) {
+        pg_cache::detail::AddChangedKey(
+            *data_cache, std::invoke(PostgreCachePolicy::kKeyMember, value),
+            *changes);
+      }
+    }
+    using pg_cache::detail::CacheInsertOrAssign;
+    CacheInsertOrAssign(*data_cache, std::move(value),
+                        PostgreCachePolicy::kKeyMember);
+  };
+  const auto log_parse_failure = [](const std::exception& e) {
+    LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
+                << compiler::GetTypeName<ValueType>() << "': " << e.what();
+  };
+
   utils::CpuRelax relax{cpu_relax_iterations_parse_, &scope};
+  if (parse_task_processor_ &&
+      values.Size() > pg_cache::detail::kParallelParseMinChunkSize) {
+    // The rows are converted in parallel and inserted in their order, so
+    // that the last of the rows with the same key wins as usual. The
+    // failures are accounted for the same way as in the sequential loop
+    // below, so that a broken row never fails the whole update.
+    std::vector<std::optional<ValueType>> parsed(values.Size());
+    std::atomic<std::size_t> failures{0};
+    utils::ParallelFor(
+        *parse_task_processor_, "pg_cache_parse", values.Size(),
+        pg_cache::detail::kParallelParseMinChunkSize,
+        [&](std::size_t begin, std::size_t end) {
+          auto i = begin;
+          try {
+            auto p = values.begin() + begin;
+            for (; i < end; ++i, ++p) {
+              try {
+                parsed[i].emplace(
+                    pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
+              } catch (const std::exception& e) {
+                ++failures;
+                log_parse_failure(e);
+              }
+            }
+          } catch (const std::exception& e) {
+            // the rest of the chunk cannot be read
+            failures += end - i;
+            log_parse_failure(e);
+          }
+        });
+    stats_scope.IncreaseDocumentsParseFailures(failures.load());
+
+    for (auto& value : parsed) {
+      if (!value) continue;
+      relax.Relax();
+      try {
+        insert(std::move(*value));
+      } catch (const std::exception& e) {
+        stats_scope.IncreaseDocumentsParseFailures(1);
+        log_parse_failure(e);
+      }
+    }
+    return;
+  }
+
   for (auto p = values.begin(); p != values.end(); ++p) {
     relax.Relax();
     try {
-      using pg_cache::detail::CacheInsertOrAssign;
-      CacheInsertOrAssign(
-          *data_cache, pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p),
-          PostgreCachePolicy::kKeyMember);
+      insert(pg_cache::detail::ExtractValue<PostgreCachePolicy>(*p));
     } catch (const std::exception& e) {
       stats_scope.IncreaseDocumentsParseFailures(1);
-      LOG_ERROR() << "Error parsing data row in cache '" << kName << "' to '"
-                  << compiler::GetTypeName<ValueType>() << "': " << e.what();
+      log_parse_failure(e);
     }
   }
 }
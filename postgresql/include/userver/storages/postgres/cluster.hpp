@@ -4,6 +4,7 @@
 /// @brief @copybrief storages::postgres::Cluster
 
 #include <memory>
+#include <optional>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
@@ -187,6 +188,11 @@ class Cluster {
   /// control settings.
   /// @note You must specify at least one role from ClusterHostType here
   ///
+  /// If `auto-batching-enabled` is set in the connection settings along with
+  /// the pipeline mode, the statement is sent together with the statements of
+  /// the concurrent tasks over a shared connection. Each statement still
+  /// gets its own result or error.
+  ///
   /// @warning Do NOT create a query string manually by embedding arguments!
   /// It leads to vulnerabilities and bad performance. Either pass arguments
   /// separately, or use storages::postgres::ParameterScope.
@@ -242,6 +248,10 @@ class Cluster {
  private:
   detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  std::optional<ResultSet> TryExecuteBatched(ClusterHostTypeFlags,
+                                             OptionalCommandControl,
+                                             detail::BatchedStatement);
+
   OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
   OptionalCommandControl GetHandlersCmdCtl(
       OptionalCommandControl cmd_ctl) const;
@@ -263,6 +273,13 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  auto batched_res = TryExecuteBatched(
+      flags, statement_cmd_ctl,
+      [&query, &args...](QueryQueue& queue, CommandControl cmd_ctl) {
+        queue.Push(cmd_ctl, query, args...);
+      });
+  if (batched_res) return std::move(*batched_res);
+
   auto ntrx = Start(flags, statement_cmd_ctl);
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
@@ -44,6 +44,12 @@ enum class ClusterHostType {
 
   /// Chooses a host with the lowest RTT
   kNearest = 0x10,
+
+  /// Chooses a host with the fewest connections in use and requests waiting
+  /// for a connection, the ties are resolved using the round-robin algorithm.
+  /// Evens out the load when the hosts differ in capacity or some of them
+  /// are slow to answer.
+  kLeastLoaded = 0x20,
   /// @}
 };
 
@@ -54,7 +60,8 @@ constexpr ClusterHostTypeFlags kClusterHostRolesMask{
     ClusterHostType::kSlave};
 
 constexpr ClusterHostTypeFlags kClusterHostStrategyMask{
-    ClusterHostType::kRoundRobin, ClusterHostType::kNearest};
+    ClusterHostType::kRoundRobin, ClusterHostType::kNearest,
+    ClusterHostType::kLeastLoaded};
 
 std::string ToString(ClusterHostType);
 std::string ToString(ClusterHostTypeFlags);
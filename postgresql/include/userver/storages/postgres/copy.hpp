@@ -0,0 +1,222 @@
+#pragma once
+
+/// @file userver/storages/postgres/copy.hpp
+/// @brief Bulk data transfer with the COPY statement
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <userver/storages/postgres/io/field_buffer.hpp>
+#include <userver/storages/postgres/io/row_types.hpp>
+#include <userver/storages/postgres/io/traits.hpp>
+#include <userver/storages/postgres/io/type_mapping.hpp>
+#include <userver/storages/postgres/io/type_traits.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/query.hpp>
+
+#include <userver/storages/postgres/io/supported_types.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace detail {
+class Connection;
+}  // namespace detail
+
+/// @brief Streams rows into a table with a
+/// `COPY ... FROM STDIN (FORMAT binary)` statement.
+///
+/// Retrieved by calling storages::postgres::Transaction::CopyIn(). The values
+/// are formatted by the same formatters as the query parameters and are sent
+/// in chunks of kChunkSize bytes, sending a chunk waits for the connection to
+/// accept it. The execute timeout of the command control limits the whole
+/// COPY, the statement timeout applies as usual.
+///
+/// No other statement may run in the transaction until the COPY is finished.
+/// If Finish() is not called, the destructor aborts the COPY and the
+/// transaction fails.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+class CopyInStream final {
+ public:
+  /// Size of the data sent to the server at once
+  static constexpr std::size_t kChunkSize = 64 * 1024;
+
+  /// @cond
+  CopyInStream(detail::Connection* conn, const Query& query,
+               OptionalCommandControl cmd_ctl);
+  /// @endcond
+
+  CopyInStream(CopyInStream&&) noexcept;
+  CopyInStream& operator=(CopyInStream&&) = delete;
+
+  CopyInStream(const CopyInStream&) = delete;
+  CopyInStream& operator=(const CopyInStream&) = delete;
+
+  ~CopyInStream();
+
+  /// Write a row with a value for each column of the COPY
+  template <typename... Columns>
+  void Write(const Columns&... columns);
+
+  /// Write a row type: an aggregate, a tuple or a type with `Introspect()`,
+  /// see @ref pg_user_row_types
+  template <typename T>
+  void Write(const T& row, RowTag);
+
+  /// Write each row type of the container
+  template <typename Container>
+  void WriteRows(const Container& rows);
+
+  /// Send the rest of the data and finish the COPY.
+  /// @returns the number of the copied rows
+  std::size_t Finish();
+
+ private:
+  template <typename T>
+  void WriteColumn(const UserTypes& types, const T& value);
+
+  const UserTypes& GetUserTypes() const;
+  void StartRow(std::size_t columns);
+  void EndRow();
+
+  detail::Connection* conn_;
+  std::string buffer_;
+};
+
+/// @brief Reads the rows of a `COPY ... TO STDOUT (FORMAT binary)` statement.
+///
+/// Retrieved by calling storages::postgres::Transaction::CopyOut(). The rows
+/// are read from the connection one by one and are parsed by the same parsers
+/// as the result sets. The execute timeout of the command control limits the
+/// whole COPY.
+///
+/// No other statement may run in the transaction until all the rows are read.
+/// The destructor reads and discards the rest of the rows.
+///
+/// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+class CopyOutStream final {
+ public:
+  /// @cond
+  CopyOutStream(detail::Connection* conn, const Query& query,
+                OptionalCommandControl cmd_ctl);
+  /// @endcond
+
+  CopyOutStream(CopyOutStream&&) noexcept;
+  CopyOutStream& operator=(CopyOutStream&&) = delete;
+
+  CopyOutStream(const CopyOutStream&) = delete;
+  CopyOutStream& operator=(const CopyOutStream&) = delete;
+
+  ~CopyOutStream();
+
+  /// Read the next row into a value per column.
+  /// @returns false after the last row
+  template <typename... Columns>
+  bool Read(Columns&... columns);
+
+  /// Read the next row into a row type, see @ref pg_user_row_types
+  /// @returns false after the last row
+  template <typename T>
+  bool Read(T& row, RowTag);
+
+  /// Read all the remaining rows as row types
+  template <typename T>
+  std::vector<T> ReadAll(RowTag);
+
+ private:
+  template <typename T>
+  void ReadColumn(std::size_t index, T& value) const;
+
+  const io::TypeBufferCategory& GetTypeBufferCategories() const;
+  bool FetchRow(std::size_t columns);
+  bool ParseRow();
+  void Finish();
+
+  detail::Connection* conn_;
+  std::string data_;
+  std::size_t position_{0};
+  std::vector<io::FieldBuffer> columns_;
+  bool is_header_read_{false};
+};
+
+template <typename... Columns>
+void CopyInStream::Write(const Columns&... columns) {
+  static_assert(sizeof...(Columns) > 0, "A row should have columns");
+  const auto& types = GetUserTypes();
+  StartRow(sizeof...(Columns));
+  (WriteColumn(types, columns), ...);
+  EndRow();
+}
+
+template <typename T>
+void CopyInStream::Write(const T& row, RowTag) {
+  static_assert(io::traits::kIsRowType<T>,
+                "This type cannot be used as a row type");
+  std::apply([this](const auto&... columns) { Write(columns...); },
+             io::RowType<T>::GetTuple(row));
+}
+
+template <typename Container>
+void CopyInStream::WriteRows(const Container& rows) {
+  for (const auto& row : rows) Write(row, kRowTag);
+}
+
+template <typename T>
+void CopyInStream::WriteColumn(const UserTypes& types, const T& value) {
+  static_assert(io::traits::kIsMappedToPg<T>,
+                "Type doesn't have mapping to Postgres type");
+  io::WriteRawBinary(types, buffer_, value);
+}
+
+template <typename... Columns>
+bool CopyOutStream::Read(Columns&... columns) {
+  static_assert(sizeof...(Columns) > 0, "A row should have columns");
+  if (!FetchRow(sizeof...(Columns))) return false;
+  std::size_t index = 0;
+  (ReadColumn(index++, columns), ...);
+  return true;
+}
+
+template <typename T>
+bool CopyOutStream::Read(T& row, RowTag) {
+  static_assert(io::traits::kIsRowType<T>,
+                "This type cannot be used as a row type");
+  return std::apply([this](auto&... columns) { return Read(columns...); },
+                    io::RowType<T>::GetTuple(row));
+}
+
+template <typename T>
+std::vector<T> CopyOutStream::ReadAll(RowTag) {
+  std::vector<T> rows;
+  T row{};
+  while (Read(row, kRowTag)) rows.push_back(std::move(row));
+  return rows;
+}
+
+template <typename T>
+void CopyOutStream::ReadColumn(std::size_t index, T& value) const {
+  using Parser = typename io::traits::IO<T>::ParserType;
+  io::traits::CheckParser<T>();
+  auto buffer = columns_[index];
+  if (buffer.is_null) {
+    if constexpr (io::traits::kIsNullable<T>) {
+      io::traits::GetSetNull<T>::SetNull(value);
+      return;
+    } else {
+      throw FieldValueIsNull{index, "COPY column", value};
+    }
+  }
+  // COPY does not tell the types of the columns, the parser of the C++ type
+  // is trusted
+  buffer.category = io::traits::kParserBufferCategory<Parser>;
+  io::ReadBuffer(buffer, value, GetTypeBufferCategories());
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
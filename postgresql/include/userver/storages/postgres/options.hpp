@@ -229,6 +229,10 @@ struct ConnectionSettings {
     kDiscardNone,
     kDiscardAll,
   };
+  enum AutoBatchingOptions {
+    kAutoBatchingDisabled,
+    kAutoBatchingEnabled,
+  };
   using SettingsVersion = std::size_t;
 
   /// Cache prepared statements or not
@@ -259,12 +263,17 @@ struct ConnectionSettings {
   /// Execute discard all after establishing a new connection
   DiscardOnConnectOptions discard_on_connect = kDiscardAll;
 
+  /// Send the concurrent single statements of storages::postgres::Cluster
+  /// together over a shared connection, requires the pipeline mode
+  AutoBatchingOptions auto_batching = kAutoBatchingDisabled;
+
   /// Helps keep track of the changes in settings
   SettingsVersion version{0U};
 
   bool operator==(const ConnectionSettings& rhs) const {
     return !RequiresConnectionReset(rhs) &&
-           recent_errors_threshold == rhs.recent_errors_threshold;
+           recent_errors_threshold == rhs.recent_errors_threshold &&
+           auto_batching == rhs.auto_batching;
   }
 
   bool operator!=(const ConnectionSettings& rhs) const {
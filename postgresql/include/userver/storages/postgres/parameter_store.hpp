@@ -3,7 +3,12 @@
 /// @file userver/storages/postgres/parameter_store.hpp
 /// @brief @copybrief storages::postgres::ParameterStore
 
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+
 #include <userver/storages/postgres/detail/query_parameters.hpp>
+#include <userver/storages/postgres/io/array_types.hpp>
 #include <userver/storages/postgres/io/type_traits.hpp>
 #include <userver/storages/postgres/io/user_types.hpp>
 #include <userver/utils/strong_typedef.hpp>
@@ -42,6 +47,26 @@ class ParameterStore {
     return *this;
   }
 
+  /// @brief Adds a parameter per data member of `Container::value_type`: an
+  /// array of that member's values over all the elements of the container.
+  ///
+  /// Any number of rows takes as many parameters as the row type has data
+  /// members, which keeps bulk statements far below the limit of 65535
+  /// parameters. The members are written straight into the binary arrays
+  /// without copying the columns first:
+  /// @snippet storages/postgres/tests/arrays_pgtest.cpp PushBackColumns
+  ///
+  /// @note Currently only built-in/system types are supported as the data
+  /// members.
+  template <typename Container>
+  ParameterStore& PushBackColumns(const Container& rows) {
+    using RowType = typename Container::value_type;
+    PushBackColumns(
+        rows,
+        std::make_index_sequence<boost::pfr::tuple_size_v<RowType>>{});
+    return *this;
+  }
+
   /// Returns whether the parameter list is empty.
   bool IsEmpty() const { return data_.Size() == 0; }
 
@@ -55,6 +80,19 @@ class ParameterStore {
   /// @endcond
 
  private:
+  template <typename Container, std::size_t... Indexes>
+  void PushBackColumns(const Container& rows, std::index_sequence<Indexes...>) {
+    using Columns = io::detail::ColumnsSplitterHelper<Container>;
+    (PushBackColumn<typename Columns::template FieldView<Indexes>>(rows), ...);
+  }
+
+  template <typename View, typename Container>
+  void PushBackColumn(const Container& rows) {
+    // The chunk provides the size of the column to the array formatter
+    const View column{rows};
+    PushBack(io::detail::ContainerChunk<View>{column.cbegin(), rows.size()});
+  }
+
   static UserTypes kNoUserTypes;
 
   detail::DynamicQueryParameters data_;
@@ -4,6 +4,9 @@
 /// @brief An utility to execute multiple queries in a single network
 /// round-trip.
 
+#include <exception>
+#include <vector>
+
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/result_set.hpp>
@@ -13,6 +16,7 @@
 
 #include <userver/utils/any_movable.hpp>
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -76,6 +80,14 @@ class QueryQueue final {
   /// execution error or a timeout.
   [[nodiscard]] std::vector<ResultSet> Collect();
 
+  /// @cond
+  // Like `Collect`, but the errors of the queries are stored into `errors` at
+  // the indexes of the queries instead of being thrown, the results of
+  // the failed queries are empty. Network and timeout errors are thrown.
+  [[nodiscard]] std::vector<ResultSet> CollectEach(
+      TimeoutDuration timeout, std::vector<std::exception_ptr>& errors);
+  /// @endcond
+
  private:
   struct ParamsHolder final {
     // We only need to know what's here at construction (and at construction we
@@ -87,6 +99,9 @@ class QueryQueue final {
 
   const UserTypes& GetConnectionUserTypes() const;
 
+  std::vector<ResultSet> DoCollect(TimeoutDuration timeout,
+                                   std::vector<std::exception_ptr>* errors);
+
   void DoPush(CommandControl cc, const Query& query, ParamsHolder&& params);
 
   void ValidateUsage() const;
@@ -114,6 +129,14 @@ void QueryQueue::Push(const Query& query, const Args&... args) {
   Push(default_cc_, query, args...);
 }
 
+namespace detail {
+
+/// Pushes a single statement with its arguments into a queue
+using BatchedStatement =
+    USERVER_NAMESPACE::utils::function_ref<void(QueryQueue&, CommandControl)>;
+
+}  // namespace detail
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
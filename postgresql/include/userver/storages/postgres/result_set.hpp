@@ -3,6 +3,7 @@
 /// @file userver/storages/postgres/result_set.hpp
 /// @brief Result accessors
 
+#include <array>
 #include <initializer_list>
 #include <limits>
 #include <memory>
@@ -22,6 +23,7 @@
 
 #include <userver/compiler/demangle.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -134,6 +136,12 @@ namespace storages::postgres {
 /// auto [bar, foo] = row.As<std::string, int>({"bar", "foo"});
 /// row.To({"bar", "foo"}, bar, foo);
 ///
+/// // resolve the names once and read every row by the indexes
+/// const auto indexes = res.IndexesOfNames({"bar", "foo"});
+/// for (auto row : res) {
+///   auto [bar, foo] = row.As<std::string, int>(indexes);
+/// }
+///
 /// // extract the whole row into a row-type structure.
 /// // The FooBar type must not have the C++ to PostgreSQL mapping in this case
 /// auto foobar = row.As<FooBar>();
@@ -150,6 +158,21 @@ namespace storages::postgres {
 /// @note The row is used to extract different types, it doesn't mean it will
 /// actually work with incompatible types.
 ///
+/// @par Reading the fields without copying
+///
+/// `text`, `varchar` and `bytea` fields can be read into `std::string_view`,
+/// both as a single value and as a data member of a row type. The view
+/// points into the result set's buffer, nothing is copied or allocated, and
+/// stays valid as long as any copy of the ResultSet is alive.
+///
+/// @code
+/// const auto res = trx.Execute("select id, payload from table");
+/// for (auto row : res) {
+///   auto [id, payload] = row.As<int, std::string_view>();
+///   // The payload must not outlive the res
+/// }
+/// @endcode
+///
 /// @code
 /// auto foobar = row.As<FooBar>();
 /// row.To(foobar);
@@ -520,6 +543,13 @@ class Row {
   void To(const std::initializer_list<size_type>& indexes, T&&... val) const;
   template <typename... T>
   std::tuple<T...> As(const std::initializer_list<size_type>& indexes) const;
+
+  /// Read fields in order of the indexes returned by
+  /// ResultSet::IndexesOfNames. The indexes are not checked again, so the
+  /// names are looked up once per result set instead of once per row.
+  template <typename... T>
+  std::tuple<T...> As(
+      const std::array<size_type, sizeof...(T)>& indexes) const;
   //@}
 
   size_type IndexOfName(const std::string&) const;
@@ -651,6 +681,14 @@ class ResultSet {
   RowDescription GetRowDescription() const& { return {pimpl_}; }
   // One should store ResultSet before using its accessors
   RowDescription GetRowDescription() const&& = delete;
+
+  /// @brief Indexes of the fields with the given names, to be passed to
+  /// Row::As for each row of the result set.
+  /// @throws FieldNameDoesntExist if the result set doesn't contain
+  ///         such a field
+  template <std::size_t N>
+  std::array<size_type, N> IndexesOfNames(
+      const std::string (&names)[N]) const;
   //@}
 
   //@{
@@ -696,6 +734,7 @@ class ResultSet {
   friend class detail::ConnectionImpl;
   void FillBufferCategories(const UserTypes& types);
   void SetBufferCategoriesFrom(const ResultSet&);
+  size_type IndexOfName(const std::string& name) const;
 
   template <typename T, typename Tag>
   friend class TypedResultSet;
@@ -794,6 +833,13 @@ struct RowDataExtractorBase<std::index_sequence<Indexes...>, T...> {
     std::tuple<T...> tmp{row[*(indexes.begin() + Indexes)].template As<T>()...};
     tmp.swap(val);
   }
+
+  static void ExtractTuple(const Row& row,
+                           const std::array<std::size_t, sizeof...(T)>& indexes,
+                           std::tuple<T...>& val) {
+    (row.GetFieldView(std::get<Indexes>(indexes)).To(std::get<Indexes>(val)),
+     ...);
+  }
 };
 
 template <typename... T>
@@ -919,6 +965,26 @@ std::tuple<T...> Row::As(
   return res;
 }
 
+template <typename... T>
+std::tuple<T...> Row::As(
+    const std::array<size_type, sizeof...(T)>& indexes) const {
+  detail::AssertSaneTypeToDeserialize<T...>();
+  for ([[maybe_unused]] const auto index : indexes) {
+    UASSERT_MSG(index < Size(), "Field indexes of another result set");
+  }
+  std::tuple<T...> res;
+  detail::RowDataExtractor<T...>::ExtractTuple(*this, indexes, res);
+  return res;
+}
+
+template <std::size_t N>
+std::array<ResultSet::size_type, N> ResultSet::IndexesOfNames(
+    const std::string (&names)[N]) const {
+  std::array<size_type, N> indexes{};
+  for (std::size_t i = 0; i < N; ++i) indexes[i] = IndexOfName(names[i]);
+  return indexes;
+}
+
 template <typename T>
 auto ResultSet::AsSetOf() const {
   return AsSetOf<T>(kFieldTag);
@@ -30,8 +30,13 @@ struct TransactionStatistics {
   Counter rollback_total = 0;
   /// Number of out-of-transaction executions
   Counter out_of_trx_total = 0;
-  /// Number of parsed queries
+  /// Number of parsed queries, i.e. prepared statements cache misses
   Counter parse_total = 0;
+  /// Number of queries found in the prepared statements cache
+  Counter prepared_cache_hit_total = 0;
+  /// Number of prepared statements evicted from the cache because it reached
+  /// max_prepared_cache_size
+  Counter prepared_cache_evict_total = 0;
   /// Number of query executions
   Counter execute_total = 0;
   /// Total number of replies
@@ -167,6 +172,10 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     transaction.rollback_total = stats.transaction.rollback_total;
     transaction.out_of_trx_total = stats.transaction.out_of_trx_total;
     transaction.parse_total = stats.transaction.parse_total;
+    transaction.prepared_cache_hit_total =
+        stats.transaction.prepared_cache_hit_total;
+    transaction.prepared_cache_evict_total =
+        stats.transaction.prepared_cache_evict_total;
     transaction.execute_total = stats.transaction.execute_total;
     transaction.reply_total = stats.transaction.reply_total;
     transaction.portal_bind_total = stats.transaction.portal_bind_total;
@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 
+#include <userver/storages/postgres/copy.hpp>
 #include <userver/storages/postgres/detail/connection_ptr.hpp>
 #include <userver/storages/postgres/detail/query_parameters.hpp>
 #include <userver/storages/postgres/detail/time_types.hpp>
@@ -101,6 +102,19 @@ namespace storages::postgres {
 /// trx.Commit();
 /// @endcode
 ///
+/// @par Bulk data transfer
+///
+/// Large amounts of rows are loaded and unloaded faster with the binary COPY,
+/// see Transaction::CopyIn() and Transaction::CopyOut().
+///
+/// @code
+/// auto trx = cluster->Begin(/* transaction options */);
+/// auto copy = trx.CopyIn("copy foobar (foo, bar) from stdin (format binary)");
+/// copy.Write(42, "baz");
+/// copy.Finish();
+/// trx.Commit();
+/// @endcode
+///
 /// @see Transaction
 /// @see ResultSet
 ///
@@ -290,6 +304,33 @@ class Transaction {
   Portal MakePortal(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement that streams
+  /// the rows into a table. Much faster than the multi-row inserts for the
+  /// bulk loads.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyIn
+  CopyInStream CopyIn(const Query& query) {
+    return CopyIn(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... FROM STDIN (FORMAT binary)` statement with
+  /// per-statement command control, the execute timeout limits the whole COPY.
+  CopyInStream CopyIn(OptionalCommandControl statement_cmd_ctl,
+                      const Query& query);
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement that streams
+  /// the rows of a table or of a query.
+  ///
+  /// @snippet storages/postgres/tests/copy_pgtest.cpp CopyOut
+  CopyOutStream CopyOut(const Query& query) {
+    return CopyOut(OptionalCommandControl{}, query);
+  }
+
+  /// Start a `COPY ... TO STDOUT (FORMAT binary)` statement with
+  /// per-statement command control, the execute timeout limits the whole COPY.
+  CopyOutStream CopyOut(OptionalCommandControl statement_cmd_ctl,
+                        const Query& query);
+
   /// Set a connection parameter
   /// https://www.postgresql.org/docs/current/sql-set.html
   /// The parameter is set for this transaction only
@@ -26,8 +26,16 @@ properties:
         defaultDescription: 0 for caches with defined GetLastKnownUpdated
     chunk-size:
         type: integer
-        description: number of rows to request from PostgreSQL, 0 to fetch all rows in one request
+        description: number of rows to request from PostgreSQL via portals or a server-side cursor, 0 to fetch all rows in one request
         defaultDescription: 1000
+    notify-debounce:
+        type: string
+        description: time to collect the notifications before an update, for the policies with kNotifyChannel
+        defaultDescription: 100ms
+    parse-task-processor:
+        type: string
+        description: task processor to convert the fetched rows in parallel on, the rows are converted by the updating task if not set
+        defaultDescription: ""
     pgcomponent:
         type: string
         description: PostgreSQL component name
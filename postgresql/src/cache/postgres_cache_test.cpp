@@ -3,7 +3,9 @@
 #include <userver/cache/base_postgres_cache.hpp>
 
 #include <boost/functional/hash.hpp>
+#include <gtest/gtest.h>
 
+#include <userver/cache/persistent_map.hpp>
 #include <userver/components/minimal_server_component_list.hpp>
 #include <userver/utils/projected_set.hpp>
 
@@ -295,6 +297,63 @@ struct PostgresExamplePolicy7 {
   using CacheContainer = utils::ProjectedUnorderedSet<ValueType, kKeyMember>;
 };
 
+/*! [Pg Cache Policy Persistent Container Example] */
+struct PostgresExamplePolicy8 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+  // Incremental updates do not copy the whole container
+  using CacheContainer = cache::PersistentMap<int, MyStructure>;
+};
+/*! [Pg Cache Policy Persistent Container Example] */
+
+/*! [Pg Cache Policy Parallel Full Update Example] */
+struct PostgresExamplePolicy9 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+
+  // Queries of the full update, they are run concurrently
+  static std::vector<storages::postgres::Query> GetFullUpdateQueries() {
+    return {
+        "select id, bar, updated from test.my_data_p0",
+        "select id, bar, updated from test.my_data_p1",
+        "select id, bar, updated from test.my_data_p2",
+        "select id, bar, updated from test.my_data_p3",
+    };
+  }
+};
+/*! [Pg Cache Policy Parallel Full Update Example] */
+
+static_assert(pg_cache::detail::kHasFullUpdateQueries<PostgresExamplePolicy9>);
+static_assert(!pg_cache::detail::kHasFullUpdateQueries<PostgresExamplePolicy>);
+
+/*! [Pg Cache Policy Notify Example] */
+struct PostgresExamplePolicy10 {
+  static constexpr std::string_view kName = "my-pg-cache";
+  using ValueType = MyStructure;
+  static constexpr auto kKeyMember = &MyStructure::id;
+  static constexpr const char* kQuery =
+      "select id, bar, updated from test.my_data";
+  static constexpr const char* kUpdatedField = "updated";
+  using UpdatedFieldType = storages::postgres::TimePointTz;
+
+  // The writers run `NOTIFY my_data_changed` after changing test.my_data
+  static constexpr std::string_view kNotifyChannel = "my_data_changed";
+};
+/*! [Pg Cache Policy Notify Example] */
+
+static_assert(pg_cache::detail::kHasNotifyChannel<PostgresExamplePolicy10>);
+static_assert(!pg_cache::detail::kHasNotifyChannel<PostgresExamplePolicy>);
+
 // Instantiation test
 using MyCache1 = PostgreCache<PostgresExamplePolicy>;
 using MyCache2 = PostgreCache<PostgresExamplePolicy2>;
@@ -304,6 +363,9 @@ using MyTrivialCache = PostgreCache<PostgresTrivialPolicy>;
 using MyCache5 = PostgreCache<PostgresExamplePolicy5>;
 using MyCache6 = PostgreCache<PostgresExamplePolicy6>;
 using MyCache7 = PostgreCache<PostgresExamplePolicy7>;
+using MyCache8 = PostgreCache<PostgresExamplePolicy8>;
+using MyCache9 = PostgreCache<PostgresExamplePolicy9>;
+using MyCache10 = PostgreCache<PostgresExamplePolicy10>;
 
 // NB: field access required for actual instantiation
 static_assert(MyCache1::kIncrementalUpdates);
@@ -313,6 +375,9 @@ static_assert(MyCache4::kIncrementalUpdates);
 static_assert(MyCache5::kIncrementalUpdates);
 static_assert(MyCache6::kIncrementalUpdates);
 static_assert(MyCache7::kIncrementalUpdates);
+static_assert(MyCache8::kIncrementalUpdates);
+static_assert(MyCache9::kIncrementalUpdates);
+static_assert(MyCache10::kIncrementalUpdates);
 
 namespace pg = storages::postgres;
 static_assert(MyCache1::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
@@ -322,6 +387,9 @@ static_assert(MyCache4::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache5::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache6::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 static_assert(MyCache7::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
+static_assert(MyCache8::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
+static_assert(MyCache9::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
+static_assert(MyCache10::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
 
 // Update() instantiation test
 [[maybe_unused]] void VerifyUpdateCompiles(
@@ -335,6 +403,55 @@ static_assert(MyCache7::kClusterHostTypeFlags == pg::ClusterHostType::kSlave);
   MyCache5 cache5{config, context};
   MyCache6 cache6{config, context};
   MyCache7 cache7{config, context};
+  MyCache8 cache8{config, context};
+  MyCache9 cache9{config, context};
+  MyCache10 cache10{config, context};
+}
+
+// The changed keys are reported for containers keyed by the policy key
+static_assert(pg_cache::detail::kReportsChanges<MyCache1::DataType,
+                                                PostgresExamplePolicy>);
+static_assert(pg_cache::detail::kReportsChanges<MyCache5::DataType,
+                                                PostgresExamplePolicy5>);
+static_assert(!pg_cache::detail::kReportsChanges<MyCache3::DataType,
+                                                 PostgresExamplePolicy3>);
+static_assert(!pg_cache::detail::kReportsChanges<MyCache7::DataType,
+                                                 PostgresExamplePolicy7>);
+
+TEST(PostgreCacheChanges, Incremental) {
+  using Policy = PostgresExamplePolicy;
+  MyCache1::DataType data{{1, {1, "a", {}}}};
+
+  auto changes = pg_cache::detail::MakeChangeSet<MyCache1::DataType, Policy>(
+      cache::UpdateType::kIncremental);
+  ASSERT_TRUE(changes);
+  const std::vector<MyStructure> rows{{1, "b", {}}, {2, "c", {}}, {2, "d", {}}};
+  for (auto value : rows) {
+    // Same as PostgreCache::CacheResults does for each row
+    pg_cache::detail::AddChangedKey(
+        data, std::invoke(Policy::kKeyMember, value), *changes);
+    pg_cache::detail::CacheInsertOrAssign(data, std::move(value),
+                                          Policy::kKeyMember);
+  }
+
+  EXPECT_EQ(changes->inserted, std::vector<int>{2});
+  // A key updated several times within one update is reported again
+  EXPECT_EQ(changes->updated, (std::vector<int>{1, 2}));
+  EXPECT_TRUE(changes->erased.empty());
+  EXPECT_EQ(data.at(2).bar, "d");
+}
+
+TEST(PostgreCacheChanges, FullOrUnknownKeys) {
+  using pg_cache::detail::MakeChangeSet;
+  // Subscribers get null changes and process the whole snapshot
+  const auto full = MakeChangeSet<MyCache1::DataType, PostgresExamplePolicy>(
+      cache::UpdateType::kFull);
+  EXPECT_FALSE(full);
+
+  const auto custom_container =
+      MakeChangeSet<MyCache3::DataType, PostgresExamplePolicy3>(
+          cache::UpdateType::kIncremental);
+  EXPECT_FALSE(custom_container);
 }
 
 inline auto SampleOfComponentRegistration() {
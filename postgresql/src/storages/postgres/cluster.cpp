@@ -111,6 +111,12 @@ detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
   return pimpl_->Start(flags, cmd_ctl);
 }
 
+std::optional<ResultSet> Cluster::TryExecuteBatched(
+    ClusterHostTypeFlags flags, OptionalCommandControl cmd_ctl,
+    detail::BatchedStatement statement) {
+  return pimpl_->TryExecuteBatched(flags, cmd_ctl, statement);
+}
+
 OptionalCommandControl Cluster::GetQueryCmdCtl(
     const std::string& query_name) const {
   return pimpl_->GetQueryCmdCtl(query_name);
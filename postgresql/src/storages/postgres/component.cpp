@@ -318,6 +318,12 @@ properties:
         type: boolean
         description: turns on pipeline connection mode
         defaultDescription: false
+    auto-batching-enabled:
+        type: boolean
+        description: |
+            send concurrent single statements together over a shared
+            connection, requires the pipeline connection mode
+        defaultDescription: false
     connecting_limit:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
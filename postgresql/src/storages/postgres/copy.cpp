@@ -0,0 +1,221 @@
+#include <userver/storages/postgres/copy.hpp>
+
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+namespace {
+
+// https://www.postgresql.org/docs/current/sql-copy.html#id-1.9.3.55.9.4
+constexpr std::string_view kCopySignature{"PGCOPY\n\377\r\n\0", 11};
+constexpr Integer kCopyFlagsWithOids = 1 << 16;
+constexpr Smallint kCopyTrailer = -1;
+
+template <typename T>
+bool ReadInteger(std::string_view data, std::size_t& position, T& value) {
+  if (data.size() - position < sizeof(T)) return false;
+
+  std::make_unsigned_t<T> result = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    result = static_cast<std::make_unsigned_t<T>>(
+        (result << 8) | static_cast<unsigned char>(data[position + i]));
+  }
+  value = static_cast<T>(result);
+  position += sizeof(T);
+  return true;
+}
+
+}  // namespace
+
+CopyInStream::CopyInStream(detail::Connection* conn, const Query& query,
+                           OptionalCommandControl cmd_ctl)
+    : conn_(conn) {
+  UASSERT(conn_);
+  conn_->CopyStart(query, detail::Connection::CopyDirection::kFromStdin,
+                   std::move(cmd_ctl));
+
+  buffer_.reserve(kChunkSize);
+  buffer_.append(kCopySignature);
+  // Flags and the length of the header extension
+  const auto& types = GetUserTypes();
+  io::WriteBuffer(types, buffer_, Integer{0});
+  io::WriteBuffer(types, buffer_, Integer{0});
+}
+
+CopyInStream::CopyInStream(CopyInStream&& other) noexcept
+    : conn_(std::exchange(other.conn_, nullptr)),
+      buffer_(std::move(other.buffer_)) {}
+
+CopyInStream::~CopyInStream() {
+  if (!conn_) return;
+
+  LOG_INFO() << "COPY FROM STDIN is destroyed without Finish(), aborting it";
+  try {
+    conn_->CopyFinish("COPY is aborted by the client");
+  } catch (const std::exception& e) {
+    LOG_DEBUG() << "Aborted COPY finished with " << e;
+  }
+}
+
+std::size_t CopyInStream::Finish() {
+  io::WriteBuffer(GetUserTypes(), buffer_, kCopyTrailer);
+  auto* conn = std::exchange(conn_, nullptr);
+  conn->CopyPutData(buffer_);
+  buffer_.clear();
+  return conn->CopyFinish().RowsAffected();
+}
+
+const UserTypes& CopyInStream::GetUserTypes() const {
+  if (!conn_) throw LogicError{"COPY FROM STDIN is already finished"};
+  return conn_->GetUserTypes();
+}
+
+void CopyInStream::StartRow(std::size_t columns) {
+  io::WriteBuffer(GetUserTypes(), buffer_, static_cast<Smallint>(columns));
+}
+
+void CopyInStream::EndRow() {
+  if (buffer_.size() < kChunkSize) return;
+  conn_->CopyPutData(buffer_);
+  buffer_.clear();
+}
+
+CopyOutStream::CopyOutStream(detail::Connection* conn, const Query& query,
+                             OptionalCommandControl cmd_ctl)
+    : conn_(conn) {
+  UASSERT(conn_);
+  conn_->CopyStart(query, detail::Connection::CopyDirection::kToStdout,
+                   std::move(cmd_ctl));
+}
+
+CopyOutStream::CopyOutStream(CopyOutStream&& other) noexcept
+    : conn_(std::exchange(other.conn_, nullptr)),
+      data_(std::move(other.data_)),
+      position_(other.position_),
+      columns_(std::move(other.columns_)),
+      is_header_read_(other.is_header_read_) {}
+
+CopyOutStream::~CopyOutStream() {
+  if (!conn_) return;
+
+  try {
+    Finish();
+  } catch (const std::exception& e) {
+    LOG_LIMITED_WARNING() << "Failed to finish COPY TO STDOUT: " << e;
+  }
+}
+
+const io::TypeBufferCategory& CopyOutStream::GetTypeBufferCategories() const {
+  UASSERT(conn_);
+  return conn_->GetUserTypes().GetTypeBufferCategories();
+}
+
+bool CopyOutStream::FetchRow(std::size_t columns) {
+  while (conn_) {
+    if (ParseRow()) {
+      if (columns_.size() != columns) {
+        throw InvalidTupleSizeRequested{columns_.size(), columns};
+      }
+      return true;
+    }
+    if (!conn_) break;
+
+    // The rows that were read are dropped before the next one is received
+    data_.erase(0, position_);
+    position_ = 0;
+    if (!conn_->CopyGetData(data_)) {
+      // Throws the error of the statement, if any
+      Finish();
+      throw InvalidInputFormat{"COPY TO STDOUT data has ended unexpectedly"};
+    }
+  }
+  return false;
+}
+
+bool CopyOutStream::ParseRow() {
+  const std::string_view data{data_};
+  auto position = position_;
+
+  if (!is_header_read_) {
+    if (data.size() - position < kCopySignature.size() + 2 * sizeof(Integer)) {
+      return false;
+    }
+    if (data.substr(position, kCopySignature.size()) != kCopySignature) {
+      throw InvalidInputFormat{
+          "COPY TO STDOUT data is not in the binary format"};
+    }
+    position += kCopySignature.size();
+
+    Integer flags = 0;
+    Integer extension_size = 0;
+    ReadInteger(data, position, flags);
+    ReadInteger(data, position, extension_size);
+    if (flags & kCopyFlagsWithOids) {
+      throw InvalidInputFormat{"COPY TO STDOUT with OIDs is not supported"};
+    }
+    if (extension_size < 0) {
+      throw InvalidInputFormat{"Negative COPY header extension size"};
+    }
+    if (data.size() - position < static_cast<std::size_t>(extension_size)) {
+      return false;
+    }
+    position_ = position + extension_size;
+    position = position_;
+    is_header_read_ = true;
+  }
+
+  Smallint column_count = 0;
+  if (!ReadInteger(data, position, column_count)) return false;
+  if (column_count == kCopyTrailer) {
+    position_ = position;
+    Finish();
+    return false;
+  }
+  if (column_count < 0) {
+    throw InvalidInputFormat{"Negative COPY row column count"};
+  }
+
+  columns_.clear();
+  for (Smallint i = 0; i < column_count; ++i) {
+    Integer length = 0;
+    if (!ReadInteger(data, position, length)) return false;
+
+    io::FieldBuffer column;
+    if (length == io::kPgNullBufferSize) {
+      column.is_null = true;
+    } else if (length < 0) {
+      throw InvalidInputFormat{"Negative COPY column size"};
+    } else {
+      if (data.size() - position < static_cast<std::size_t>(length)) {
+        return false;
+      }
+      column.length = length;
+      column.buffer = reinterpret_cast<const std::uint8_t*>(data.data()) +
+                      position;
+      position += length;
+    }
+    columns_.push_back(column);
+  }
+
+  position_ = position;
+  return true;
+}
+
+void CopyOutStream::Finish() {
+  auto* conn = std::exchange(conn_, nullptr);
+  columns_.clear();
+  conn->CopyFinish();
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/cluster_impl.hpp>
 
+#include <limits>
+
 #include <fmt/format.h>
 
 #include <userver/dynamic_config/value.hpp>
@@ -31,15 +33,17 @@ ClusterHostType Fallback(ClusterHostType ht) {
     case ClusterHostType::kNone:
     case ClusterHostType::kRoundRobin:
     case ClusterHostType::kNearest:
+    case ClusterHostType::kLeastLoaded:
       throw ClusterError("Invalid ClusterHostType value for fallback " +
                          ToString(ht));
   }
   UINVARIANT(false, "Unexpected cluster host type");
 }
 
-size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
-                      ClusterHostTypeFlags flags,
-                      std::atomic<uint32_t>& rr_host_idx) {
+size_t SelectDsnIndex(
+    const topology::TopologyBase::DsnIndices& indices,
+    ClusterHostTypeFlags flags, std::atomic<uint32_t>& rr_host_idx,
+    const std::vector<std::shared_ptr<ConnectionPool>>& pools) {
   UASSERT(!indices.empty());
   if (indices.empty()) {
     throw ClusterError("Cannot select host from an empty list");
@@ -54,6 +58,20 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
       idx_pos =
           rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
     }
+  } else if (strategy_flags == ClusterHostType::kLeastLoaded) {
+    // Scanning from a round-robin position spreads the load between the
+    // equally loaded hosts
+    const auto start =
+        rr_host_idx.fetch_add(1, std::memory_order_relaxed) % indices.size();
+    auto min_load = std::numeric_limits<std::size_t>::max();
+    for (size_t i = 0; i < indices.size(); ++i) {
+      const auto pos = (start + i) % indices.size();
+      const auto load = pools[indices[pos]]->GetLoadApprox();
+      if (load < min_load) {
+        min_load = load;
+        idx_pos = pos;
+      }
+    }
   } else if (strategy_flags != ClusterHostType::kNearest) {
     throw LogicError(
         fmt::format("Invalid strategy requested: {}, ensure only one is used",
@@ -62,6 +80,11 @@ size_t SelectDsnIndex(const topology::TopologyBase::DsnIndices& indices,
   return indices[idx_pos];
 }
 
+bool IsAutoBatchingEnabled(const ConnectionSettings& settings) {
+  return settings.auto_batching == ConnectionSettings::kAutoBatchingEnabled &&
+         settings.pipeline_mode == PipelineMode::kEnabled;
+}
+
 }  // namespace
 
 ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
@@ -76,6 +99,8 @@ ClusterImpl::ClusterImpl(DsnList dsns, clients::dns::Resolver* resolver,
       cluster_settings_(cluster_settings),
       bg_task_processor_(bg_task_processor),
       rr_host_idx_(0),
+      is_auto_batching_enabled_(IsAutoBatchingEnabled(
+          cluster_settings.conn_settings)),
       config_source_(std::move(config_source)),
       connlimit_watchdog_(*this, testsuite_tasks, shard_number,
                           [this]() { OnConnlimitChanged(); }) {
@@ -223,7 +248,8 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
     if (alive_dsn_indices->empty()) {
       throw ClusterUnavailable("None of cluster hosts are available");
     }
-    dsn_index = SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_);
+    dsn_index =
+        SelectDsnIndex(*alive_dsn_indices, flags, rr_host_idx_, host_pools_);
   } else {
     auto host_role = static_cast<ClusterHostType>(role_flags.GetValue());
     auto dsn_indices_by_type = topology_->GetDsnIndicesByType();
@@ -245,7 +271,8 @@ ClusterImpl::ConnectionPoolPtr ClusterImpl::FindPool(
                       ToString(host_role), ToString(role_flags)));
     }
     LOG_TRACE() << "Starting transaction on " << host_role;
-    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_);
+    dsn_index = SelectDsnIndex(dsn_indices_it->second, flags, rr_host_idx_,
+                               host_pools_);
   }
 
   UASSERT(dsn_index < host_pools_.size());
@@ -280,6 +307,15 @@ NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
   return FindPool(flags)->Start(cmd_ctl);
 }
 
+std::optional<ResultSet> ClusterImpl::TryExecuteBatched(
+    ClusterHostTypeFlags flags, OptionalCommandControl cmd_ctl,
+    BatchedStatement statement) {
+  if (!is_auto_batching_enabled_ || !(flags & kClusterHostRolesMask)) {
+    return std::nullopt;
+  }
+  return FindPool(flags)->ExecuteBatched(cmd_ctl, statement);
+}
+
 NotifyScope ClusterImpl::Listen(std::string_view channel,
                                 OptionalCommandControl cmd_ctl) {
   return FindPool(ClusterHostType::kMaster)->Listen(channel, cmd_ctl);
@@ -314,6 +350,7 @@ void ClusterImpl::SetQueriesCommandControl(
 }
 
 void ClusterImpl::SetConnectionSettings(const ConnectionSettings& settings) {
+  is_auto_batching_enabled_ = IsAutoBatchingEnabled(settings);
   for (const auto& pool : host_pools_) {
     pool->SetConnectionSettings(settings);
   }
@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -48,6 +49,12 @@ class ClusterImpl {
 
   NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
 
+  /// Returns `std::nullopt` if auto-batching is disabled or the statement
+  /// should be executed in the usual way
+  std::optional<ResultSet> TryExecuteBatched(ClusterHostTypeFlags,
+                                             OptionalCommandControl,
+                                             BatchedStatement statement);
+
   NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
   QueryQueue CreateQueryQueue(ClusterHostTypeFlags flags,
@@ -91,6 +98,7 @@ class ClusterImpl {
   engine::TaskProcessor& bg_task_processor_;
   std::vector<ConnectionPoolPtr> host_pools_;
   std::atomic<uint32_t> rr_host_idx_;
+  std::atomic<bool> is_auto_batching_enabled_;
   dynamic_config::Source config_source_;
   ConnlimitWatchdog connlimit_watchdog_;
 };
@@ -137,8 +137,9 @@ void Connection::AddIntoPipeline(CommandControl cc,
 }
 
 std::vector<ResultSet> Connection::GatherPipeline(
-    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
-  return pimpl_->GatherPipeline(timeout, descriptions);
+    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>* errors) {
+  return pimpl_->GatherPipeline(timeout, descriptions, errors);
 }
 
 ResultSet Connection::Execute(const Query& query, const ParameterStore& store) {
@@ -167,6 +168,23 @@ ResultSet Connection::PortalExecute(StatementId statement_id,
                                std::move(statement_cmd_ctl));
 }
 
+void Connection::CopyStart(const Query& query, CopyDirection direction,
+                           OptionalCommandControl statement_cmd_ctl) {
+  pimpl_->CopyStart(query, direction, std::move(statement_cmd_ctl));
+}
+
+void Connection::CopyPutData(std::string_view data) {
+  pimpl_->CopyPutData(data);
+}
+
+bool Connection::CopyGetData(std::string& data) {
+  return pimpl_->CopyGetData(data);
+}
+
+ResultSet Connection::CopyFinish(const char* error_message) {
+  return pimpl_->CopyFinish(error_message);
+}
+
 void Connection::CancelAndCleanup(TimeoutDuration timeout) {
   pimpl_->CancelAndCleanup(timeout);
 }
@@ -2,7 +2,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <exception>
 #include <string>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage_fwd.hpp>
@@ -51,6 +53,11 @@ class Connection {
                   //!< finished
   };
 
+  enum class CopyDirection {
+    kFromStdin,  //!< COPY ... FROM STDIN, the data is sent to the server
+    kToStdout,   //!< COPY ... TO STDOUT, the data is received from the server
+  };
+
   /// Strong typedef for IDs assigned to prepared statements
   using StatementId =
       USERVER_NAMESPACE::utils::StrongTypedef<struct StatementIdTag,
@@ -80,6 +87,10 @@ class Connection {
     SmallCounter out_of_trx : 1;
     /// Number of parsed queries
     Counter parse_total{0};
+    /// Number of queries found in the prepared statements cache
+    Counter prepared_cache_hit_total{0};
+    /// Number of prepared statements evicted from the cache
+    Counter prepared_cache_evict_total{0};
     /// Number of query executions (calls to `Execute`)
     Counter execute_total{0};
     /// Total number of replies
@@ -224,8 +235,11 @@ class Connection {
                        const detail::QueryParameters& params,
                        const ResultSet& description, tracing::ScopeTime& scope);
 
+  /// If `errors` is not null, the errors of the statements are stored there
+  /// instead of being thrown, see PGConnectionWrapper::GatherPipeline
   std::vector<ResultSet> GatherPipeline(
-      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+      std::vector<std::exception_ptr>* errors = nullptr);
 
   template <typename... T>
   ResultSet Execute(const Query& query, const T&... args) {
@@ -254,6 +268,21 @@ class Connection {
   ResultSet PortalExecute(StatementId, const std::string& portal_name,
                           std::uint32_t n_rows, OptionalCommandControl);
 
+  /// Start a COPY in the `direction`, the execute timeout of the command
+  /// control limits the whole COPY. Other statements cannot run until the
+  /// COPY is finished.
+  /// @throws LogicError if the statement is not a COPY in the `direction`
+  void CopyStart(const Query& query, CopyDirection direction,
+                 OptionalCommandControl);
+  /// Send the data of a COPY FROM STDIN, waits for the data to be sent
+  void CopyPutData(std::string_view data);
+  /// Append the next row of a COPY TO STDOUT to `data`, returns false after
+  /// the last row
+  bool CopyGetData(std::string& data);
+  /// Finish the COPY and wait for its result. A non-null `error_message`
+  /// aborts a COPY FROM STDIN, the rest of a COPY TO STDOUT is discarded.
+  ResultSet CopyFinish(const char* error_message = nullptr);
+
   /// Send cancel to the database backend
   /// Try to return connection to idle state discarding all results.
   /// If there is a transaction in progress - roll it back.
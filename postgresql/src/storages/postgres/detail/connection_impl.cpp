@@ -95,6 +95,28 @@ class CountPortalBind {
   bool completed_{false};
 };
 
+// The COPY is counted as executed at its start
+class CountCopyFinish {
+ public:
+  CountCopyFinish(Connection::Statistics& stats,
+                  SteadyClock::time_point start_time)
+      : stats_(stats), start_time_(start_time) {}
+
+  ~CountCopyFinish() {
+    auto now = SteadyClock::now();
+    if (!completed_) ++stats_.error_execute_total;
+    stats_.sum_query_duration += now - start_time_;
+    stats_.last_execute_finish = now;
+  }
+
+  void AccountResult(ResultSet&) { completed_ = true; }
+
+ private:
+  Connection::Statistics& stats_;
+  const SteadyClock::time_point start_time_;
+  bool completed_{false};
+};
+
 struct TrackTrxEnd {
   TrackTrxEnd(Connection::Statistics& stats) : stats_(stats) {}
   ~TrackTrxEnd() { stats_.trx_end_time = SteadyClock::now(); }
@@ -510,6 +532,111 @@ ResultSet ConnectionImpl::PortalExecute(
                     count_execute, span, scope, &prepared_info->description);
 }
 
+void ConnectionImpl::CopyStart(const Query& query,
+                               Connection::CopyDirection direction,
+                               OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+
+  // COPY is not allowed in the pipeline mode
+  const bool restore_pipeline = IsPipelineActive();
+  if (restore_pipeline) conn_wrapper_.ExitPipelineMode();
+  ScopeGuard pipeline_guard{[this, restore_pipeline] {
+    if (restore_pipeline) conn_wrapper_.EnterPipelineMode();
+  }};
+
+  const TimeoutDuration network_timeout = ExecuteTimeout(statement_cmd_ctl);
+  const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(network_timeout);
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+  CheckDeadlineReached(deadline);
+
+  auto span = MakeQuerySpan(query, {network_timeout, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  const auto start_time = SteadyClock::now();
+  ++stats_.execute_total;
+
+  Connection::CopyDirection started_direction{};
+  try {
+    conn_wrapper_.SendQuery(query.Statement(), scope);
+    started_direction = conn_wrapper_.WaitCopyStart(deadline, scope);
+  } catch (const std::exception&) {
+    ++stats_.error_execute_total;
+    span.AddTag(tracing::kErrorFlag, true);
+    throw;
+  }
+
+  pipeline_guard.Release();
+  copy_.emplace(CopyState{started_direction, query, deadline, network_timeout,
+                          start_time, restore_pipeline});
+
+  if (started_direction != direction) {
+    try {
+      CopyFinish("COPY direction mismatch");
+    } catch (const std::exception& e) {
+      LOG_DEBUG() << "COPY in a wrong direction finished with " << e;
+    }
+    throw LogicError{fmt::format(
+        "Statement `{}` is a COPY in a wrong direction", query.Statement())};
+  }
+}
+
+void ConnectionImpl::CopyPutData(std::string_view data) {
+  const auto& copy = GetCopyState(Connection::CopyDirection::kFromStdin);
+  // A connection in the middle of a COPY cannot be cleaned up
+  ScopeGuard broken_guard{[this] { MarkAsBroken(); }};
+  conn_wrapper_.PutCopyData(data, copy.deadline);
+  broken_guard.Release();
+}
+
+bool ConnectionImpl::CopyGetData(std::string& data) {
+  const auto& copy = GetCopyState(Connection::CopyDirection::kToStdout);
+  ScopeGuard broken_guard{[this] { MarkAsBroken(); }};
+  const bool has_data = conn_wrapper_.GetCopyData(data, copy.deadline);
+  broken_guard.Release();
+  return has_data;
+}
+
+ResultSet ConnectionImpl::CopyFinish(const char* error_message) {
+  if (!copy_) throw LogicError{"There is no COPY in progress"};
+  const auto copy = *std::move(copy_);
+  copy_.reset();
+  if (IsBroken()) throw ConnectionError{"Connection broke during the COPY"};
+
+  {
+    ScopeGuard broken_guard{[this] { MarkAsBroken(); }};
+    if (copy.direction == Connection::CopyDirection::kFromStdin) {
+      conn_wrapper_.PutCopyEnd(error_message, copy.deadline);
+    } else {
+      // The server cannot be stopped early, the rest of the data is discarded
+      std::string discarded;
+      while (conn_wrapper_.GetCopyData(discarded, copy.deadline)) {
+        discarded.clear();
+      }
+    }
+    broken_guard.Release();
+  }
+
+  const auto restore_pipeline = [this, &copy] {
+    if (copy.restore_pipeline && !IsBroken()) {
+      conn_wrapper_.EnterPipelineMode();
+    }
+  };
+
+  auto span =
+      MakeQuerySpan(copy.query, {copy.network_timeout, GetStatementTimeout()});
+  auto scope = span.CreateScopeTime();
+  CountCopyFinish count_finish(stats_, copy.start_time);
+  try {
+    auto res = WaitResult(copy.query.Statement(), copy.deadline,
+                          copy.network_timeout, count_finish, span, scope,
+                          nullptr);
+    restore_pipeline();
+    return res;
+  } catch (const std::exception&) {
+    restore_pipeline();
+    throw;
+  }
+}
+
 void ConnectionImpl::Listen(std::string_view channel,
                             OptionalCommandControl cmd_ctl) {
   ExecuteCommandNoPrepare(
@@ -728,6 +855,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
   if (statement_info) {
     if (statement_info->description.pimpl_) {
       LOG_TRACE() << "Query " << statement << " is already prepared.";
+      ++stats_.prepared_cache_hit_total;
       return *statement_info;
     } else {
       LOG_DEBUG() << "Found prepared but not described statement";
@@ -739,6 +867,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::DoPrepareStatement(
     UASSERT(statement_info);
     DiscardPreparedStatement(*statement_info, deadline);
     prepared_.Erase(statement_info->id);
+    ++stats_.prepared_cache_evict_total;
   }
 
   scope.Reset(scopes::kPrepare);
@@ -906,7 +1035,8 @@ void ConnectionImpl::AddIntoPipeline(CommandControl cc,
 }
 
 std::vector<ResultSet> ConnectionImpl::GatherPipeline(
-    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions) {
+    TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+    std::vector<std::exception_ptr>* errors) {
   const auto deadline = testsuite_pg_ctl_.MakeExecuteDeadline(timeout);
   CheckDeadlineReached(deadline);
 
@@ -918,10 +1048,12 @@ std::vector<ResultSet> ConnectionImpl::GatherPipeline(
     }
   }
 
-  auto result = conn_wrapper_.GatherPipeline(deadline, native_descriptions);
+  auto result =
+      conn_wrapper_.GatherPipeline(deadline, native_descriptions, errors);
+  if (errors) errors->resize(result.size());
 
   for (auto& single_result : result) {
-    FillBufferCategories(single_result);
+    if (single_result.pimpl_) FillBufferCategories(single_result);
   }
 
   return result;
@@ -1083,6 +1215,14 @@ ResultSet ConnectionImpl::WaitResult(const std::string& statement,
   }
 }
 
+ConnectionImpl::CopyState& ConnectionImpl::GetCopyState(
+    Connection::CopyDirection direction) {
+  if (!copy_ || copy_->direction != direction) {
+    throw LogicError{"There is no COPY in the requested direction in progress"};
+  }
+  return *copy_;
+}
+
 void ConnectionImpl::Cancel() { conn_wrapper_.Cancel().Wait(); }
 
 void ConnectionImpl::ReportStatement(const std::string& name) {
@@ -87,7 +87,8 @@ class ConnectionImpl {
                        const detail::QueryParameters& params,
                        const ResultSet& description, tracing::ScopeTime& scope);
   std::vector<ResultSet> GatherPipeline(
-      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions);
+      TimeoutDuration timeout, const std::vector<ResultSet>& descriptions,
+      std::vector<std::exception_ptr>* errors);
 
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
@@ -107,6 +108,12 @@ class ConnectionImpl {
                           const std::string& portal_name, std::uint32_t n_rows,
                           OptionalCommandControl statement_cmd_ctl);
 
+  void CopyStart(const Query& query, Connection::CopyDirection direction,
+                 OptionalCommandControl statement_cmd_ctl);
+  void CopyPutData(std::string_view data);
+  bool CopyGetData(std::string& data);
+  ResultSet CopyFinish(const char* error_message);
+
   void Listen(std::string_view channel, OptionalCommandControl);
   void Unlisten(std::string_view channel, OptionalCommandControl);
   Notification WaitNotify(engine::Deadline deadline);
@@ -132,6 +139,17 @@ class ConnectionImpl {
 
   struct ResetTransactionCommandControl;
 
+  struct CopyState {
+    Connection::CopyDirection direction;
+    Query query;
+    engine::Deadline deadline;
+    TimeoutDuration network_timeout;
+    SteadyClock::time_point start_time;
+    bool restore_pipeline;
+  };
+
+  CopyState& GetCopyState(Connection::CopyDirection direction);
+
   void CheckBusy() const;
   void CheckDeadlineReached(const engine::Deadline& deadline);
   tracing::Span MakeQuerySpan(const Query& query,
@@ -212,6 +230,7 @@ class ConnectionImpl {
   OptionalCommandControl transaction_cmd_ctl_;
   TimeoutDuration current_statement_timeout_{};
   const error_injection::Settings ei_settings_;
+  std::optional<CopyState> copy_;
 
   std::unordered_set<std::string> statements_reported_;
   engine::Mutex statements_mutex_;
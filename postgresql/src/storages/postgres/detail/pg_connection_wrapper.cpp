@@ -582,8 +582,100 @@ Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
   return result;
 }
 
+Connection::CopyDirection PGConnectionWrapper::WaitCopyStart(
+    Deadline deadline, tracing::ScopeTime& scope) {
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+  auto handle = MakeResultHandle(nullptr);
+  while (auto* pg_res = ReadResult(deadline, nullptr)) {
+    auto next_handle = MakeResultHandle(pg_res);
+    // The rest of the results follow the COPY data
+    switch (PQresultStatus(pg_res)) {
+      case PGRES_COPY_IN:
+        return Connection::CopyDirection::kFromStdin;
+      case PGRES_COPY_OUT:
+        return Connection::CopyDirection::kToStdout;
+      case PGRES_COPY_BOTH:
+        // Closes the connection, there is no way back from the replication
+        MakeResult(std::move(next_handle));
+        break;
+      default:
+        break;
+    }
+    handle = std::move(next_handle);
+  }
+
+  // Throws the error of the statement, if any
+  MakeResult(std::move(handle));
+  throw LogicError{"Statement does not start a COPY FROM STDIN or TO STDOUT"};
+}
+
+void PGConnectionWrapper::PutCopyData(std::string_view data,
+                                      Deadline deadline) {
+  while (true) {
+    const int put_res =
+        PQputCopyData(conn_, data.data(), static_cast<int>(data.size()));
+    if (put_res > 0) break;
+    if (put_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(std::string{"PQputCopyData execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+    // No room in the send buffer of a nonblocking connection
+    Flush(deadline);
+  }
+  // Waiting for the socket here applies backpressure to the writer
+  Flush(deadline);
+}
+
+void PGConnectionWrapper::PutCopyEnd(const char* error_message,
+                                     Deadline deadline) {
+  while (true) {
+    const int put_res = PQputCopyEnd(conn_, error_message);
+    if (put_res > 0) break;
+    if (put_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(std::string{"PQputCopyEnd execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+    Flush(deadline);
+  }
+  Flush(deadline);
+}
+
+bool PGConnectionWrapper::GetCopyData(std::string& data, Deadline deadline) {
+  while (true) {
+    char* buffer = nullptr;
+    const int get_res = PQgetCopyData(conn_, &buffer, /*async=*/1);
+    if (get_res > 0) {
+      const std::unique_ptr<char, decltype(&PQfreemem)> guard{buffer,
+                                                              &PQfreemem};
+      data.append(buffer, get_res);
+      return true;
+    }
+    if (get_res == -1) return false;
+    if (get_res < 0) {
+      HandleSocketPostClose();
+      throw CommandError(std::string{"PQgetCopyData execution error: "} +
+                         PQerrorMessage(conn_));
+    }
+
+    if (!WaitSocketReadable(deadline)) {
+      if (engine::current_task::ShouldCancel()) {
+        throw ConnectionInterrupted("Task cancelled while reading COPY data");
+      }
+      PGCW_LOG_LIMITED_WARNING()
+          << "Timeout while reading COPY data from PostgreSQL connection";
+      throw ConnectionTimeoutError("Timed out while reading COPY data");
+    }
+    CheckError<CommandError>("PQconsumeInput", PQconsumeInput(conn_));
+    UpdateLastUse();
+  }
+}
+
 std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
-    Deadline deadline, const std::vector<const PGresult*>& descriptions) {
+    Deadline deadline, const std::vector<const PGresult*>& descriptions,
+    std::vector<std::exception_ptr>* errors) {
   UASSERT(!descriptions.empty());
 
 #if !LIBPQ_HAS_PIPELINING
@@ -627,7 +719,19 @@ std::vector<ResultSet> PGConnectionWrapper::GatherPipeline(
                std::string_view{first_field_name} == kSetConfigQueryResultName;
       }();
       if (!is_set_config_response) {
-        result.push_back(MakeResult(std::move(handle)));
+        if (errors && PQresultStatus(handle.get()) == PGRES_FATAL_ERROR) {
+          // Each statement is followed by a sync, the error does not affect
+          // the rest of the statements
+          try {
+            MakeResult(std::move(handle));
+          } catch (const std::exception&) {
+            errors->resize(result.size() + 1);
+            errors->back() = std::current_exception();
+          }
+          result.push_back(ResultSet{nullptr});
+        } else {
+          result.push_back(MakeResult(std::move(handle)));
+        }
       }
     }
 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <chrono>
+#include <exception>
 #include <string_view>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -114,8 +116,29 @@ class PGConnectionWrapper {
   /// @brief Wait for notification
   Notification WaitNotify(Deadline deadline);
 
+  /// @brief Wait for the start of a COPY FROM STDIN or a COPY TO STDOUT
+  /// @throws LogicError if the statement does not start a COPY
+  Connection::CopyDirection WaitCopyStart(Deadline deadline,
+                                          tracing::ScopeTime&);
+
+  /// @brief Wrapper for PQputCopyData, waits for the data to be sent
+  void PutCopyData(std::string_view data, Deadline deadline);
+
+  /// @brief Wrapper for PQputCopyEnd, a non-null `error_message` aborts the
+  /// COPY. The result of the COPY should be read with WaitResult.
+  void PutCopyEnd(const char* error_message, Deadline deadline);
+
+  /// @brief Wrapper for PQgetCopyData, appends the next row to `data`.
+  /// Returns false after the last row, the result of the COPY should be read
+  /// with WaitResult.
+  bool GetCopyData(std::string& data, Deadline deadline);
+
+  /// If `errors` is not null, a failed statement does not stop the gathering:
+  /// its result is an empty ResultSet and its error is stored in `errors` at
+  /// the same index, other errors are null.
   std::vector<ResultSet> GatherPipeline(
-      Deadline deadline, const std::vector<const PGresult*>& descriptions);
+      Deadline deadline, const std::vector<const PGresult*>& descriptions,
+      std::vector<std::exception_ptr>* errors = nullptr);
 
   /// Consume input from connection
   void ConsumeInput(Deadline deadline, const PGresult* description);
@@ -1,5 +1,7 @@
 #include <storages/postgres/detail/pool.hpp>
 
+#include <algorithm>
+
 #include <storages/postgres/deadline.hpp>
 #include <storages/postgres/detail/cc_config.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
@@ -103,7 +105,8 @@ ConnectionPool::ConnectionPool(
                      stats_.congestion_control, cc_config, config_source,
                      [](const dynamic_config::Snapshot& config) {
                        return config[kCcConfig];
-                     }) {
+                     }),
+      batcher_(*this, testsuite_pg_ctl_) {
   if (kCcExperiment.IsEnabled()) {
     cc_controller_.Start();
   }
@@ -211,6 +214,7 @@ ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
   CheckDeadlineIsExpired(config);
   ConnectionPtr connection{Pop(deadline), std::move(shared_this)};
   ++stats_.connection.used;
+  AccountUsage(stats_.connection.used.Load());
   CheckDeadlineIsExpired(config);
 
   connection->UpdateDefaultCommandControl();
@@ -228,6 +232,10 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.rollback_total += conn_stats.rollback_total;
   stats_.transaction.out_of_trx_total += conn_stats.out_of_trx;
   stats_.transaction.parse_total += conn_stats.parse_total;
+  stats_.transaction.prepared_cache_hit_total +=
+      conn_stats.prepared_cache_hit_total;
+  stats_.transaction.prepared_cache_evict_total +=
+      conn_stats.prepared_cache_evict_total;
   stats_.transaction.execute_total += conn_stats.execute_total;
   stats_.transaction.reply_total += conn_stats.reply_total;
   stats_.transaction.portal_bind_total += conn_stats.portal_bind_total;
@@ -272,6 +280,9 @@ void ConnectionPool::Release(Connection* connection) {
 
   if (!connection->IsConnected() || connection->IsBroken()) {
     DeleteBrokenConnection(connection);
+    // Restore the pool right away, e.g. after a failover, instead of making
+    // the next requests wait for the connections to be established
+    CheckMinPoolSizeUnderflow();
   } else if (connection->IsIdle()) {
     Push(connection);
   } else {
@@ -303,6 +314,11 @@ const InstanceStatistics& ConnectionPool::GetStatistics() const {
   return stats_;
 }
 
+std::size_t ConnectionPool::GetLoadApprox() const {
+  return stats_.connection.used.Load() +
+         wait_count_.load(std::memory_order_relaxed);
+}
+
 Transaction ConnectionPool::Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl) {
   const auto trx_start_time = detail::SteadyClock::now();
@@ -322,6 +338,12 @@ NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
   return NonTransaction{std::move(conn), start_time};
 }
 
+std::optional<ResultSet> ConnectionPool::ExecuteBatched(
+    OptionalCommandControl cmd_ctl, BatchedStatement statement) {
+  return batcher_.Execute(cmd_ctl.value_or(GetDefaultCommandControl()),
+                          statement);
+}
+
 NotifyScope ConnectionPool::Listen(std::string_view channel,
                                    OptionalCommandControl cmd_ctl) {
   const auto deadline =
@@ -464,12 +486,36 @@ void ConnectionPool::TryCreateConnectionAsync() {
 }
 
 void ConnectionPool::CheckMinPoolSizeUnderflow() {
-  auto settings = settings_.Read();
+  const auto settings = settings_.Read();
+  WarmUp(settings->min_size);
+}
+
+void ConnectionPool::WarmUp(std::size_t target_size) {
   auto count = size_semaphore_.UsedApprox();
-  if (count < settings->min_size) {
-    LOG_DEBUG() << "Current pool size is less than min_size (" << count << " < "
-                << settings->min_size << "). Create new connection.";
-    TryCreateConnectionAsync();
+  if (count >= target_size) return;
+
+  auto conn_settings = conn_settings_.Read();
+  if (recent_conn_errors_.GetStatsForPeriod(kRecentErrorPeriod, true) >=
+      conn_settings->recent_errors_threshold) {
+    LOG_DEBUG() << "Too many connection errors in recent period";
+    return;
+  }
+
+  LOG_DEBUG() << "Current pool size is less than the target size (" << count
+              << " < " << target_size << "). Create new connections.";
+  // Connections that are already being established are accounted in the
+  // semaphore, only the missing ones are started
+  for (; count < target_size; ++count) {
+    engine::SemaphoreLock size_lock{size_semaphore_, std::try_to_lock};
+    if (!size_lock) break;
+    connect_task_storage_.Detach(Connect(std::move(size_lock)));
+  }
+}
+
+void ConnectionPool::AccountUsage(std::size_t in_use) {
+  auto peak = peak_usage_.load(std::memory_order_relaxed);
+  while (peak < in_use && !peak_usage_.compare_exchange_weak(
+                              peak, in_use, std::memory_order_relaxed)) {
   }
 }
 
@@ -533,6 +579,8 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
     ++stats_.queue_size_errors;
     throw PoolError("Wait queue size exceeded");
   }
+  // The waiting requests would have used the connections if there were any
+  AccountUsage(stats_.connection.used.Load() + wg.GetValue());
   // No connections found - create a new one if pool is not exhausted
   LOG_DEBUG() << "No idle connections, waiting for one for "
               << deadline.TimeLeft();
@@ -652,6 +700,12 @@ void ConnectionPool::MaintainConnections() {
   auto count = size_semaphore_.UsedApprox();
   auto drop_left = kIdleDropLimit;
   auto settings = settings_.Read();
+  // The pool follows the recent load: as many connections as were in use
+  // since the previous run are kept or created in advance, the extra ones are
+  // dropped one per run
+  const auto recent_peak = peak_usage_.exchange(stats_.connection.used.Load());
+  const auto target_size = std::min(std::max(recent_peak, settings->min_size),
+                                    settings->max_size);
   while (count > 0 && stale_connection) {
     try {
       auto deleter = [this](Connection* c) { DeleteConnection(c); };
@@ -663,7 +717,7 @@ void ConnectionPool::MaintainConnections() {
         break;
       }
       stale_connection = conn->GetIdleDuration() >= kMaxIdleDuration;
-      if (count > settings->min_size && drop_left > 0) {
+      if (count > target_size && drop_left > 0) {
         --drop_left;
         --stats_.connection.used;
         LOG_DEBUG() << "Drop idle connection to `" << DsnCutPassword(dsn_)
@@ -687,8 +741,7 @@ void ConnectionPool::MaintainConnections() {
     --count;
   }
 
-  // Check and maintain minimum count of connections
-  CheckMinPoolSizeUnderflow();
+  WarmUp(target_size);
 }
 
 void ConnectionPool::StartMaintainTask() {
@@ -33,6 +33,7 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/statement_batcher.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -72,11 +73,19 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   void Release(Connection* connection);
 
   const InstanceStatistics& GetStatistics() const;
+
+  /// Number of the connections in use and of the requests waiting for one
+  std::size_t GetLoadApprox() const;
   [[nodiscard]] Transaction Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl = {});
 
   [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
 
+  /// Executes the statement together with the concurrent ones, see
+  /// StatementBatcher::Execute
+  std::optional<ResultSet> ExecuteBatched(OptionalCommandControl cmd_ctl,
+                                          BatchedStatement statement);
+
   NotifyScope Listen(std::string_view channel,
                      OptionalCommandControl cmd_ctl = {});
 
@@ -108,6 +117,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   void TryCreateConnectionAsync();
   void CheckMinPoolSizeUnderflow();
+  void WarmUp(std::size_t target_size);
+  void AccountUsage(std::size_t in_use);
 
   void Push(Connection* connection);
   Connection* Pop(engine::Deadline);
@@ -149,6 +160,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   engine::Semaphore size_semaphore_;
   engine::Semaphore connecting_semaphore_;
   std::atomic<size_t> wait_count_;
+  // Max of used and requested connections since the last maintenance run
+  std::atomic<size_t> peak_usage_{0};
   DefaultCommandControls default_cmd_ctls_;
   testsuite::PostgresControl testsuite_pg_ctl_;
   const error_injection::Settings ei_settings_;
@@ -162,6 +175,8 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   cc::Limiter cc_limiter_;
   congestion_control::v2::LinearController cc_controller_;
   std::atomic<std::size_t> cc_max_connections_;
+
+  StatementBatcher batcher_;
 };
 
 }  // namespace storages::postgres::detail
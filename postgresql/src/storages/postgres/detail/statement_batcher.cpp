@@ -0,0 +1,176 @@
+#include <storages/postgres/detail/statement_batcher.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <storages/postgres/detail/pool.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+struct StatementBatcher::Waiter final {
+  enum class State { kPending, kLeading, kTaken, kDone };
+
+  Waiter(CommandControl cmd_ctl, BatchedStatement statement)
+      : cmd_ctl{cmd_ctl}, statement{statement} {}
+
+  const CommandControl cmd_ctl;
+  const BatchedStatement statement;
+
+  // State is guarded by the mutex of the batcher, the result and the error
+  // are only written by the leader in the kTaken state
+  State state{State::kPending};
+  std::optional<ResultSet> result;
+  std::exception_ptr error;
+  engine::SingleConsumerEvent event;
+};
+
+StatementBatcher::StatementBatcher(
+    ConnectionPool& pool, const testsuite::PostgresControl& testsuite_pg_ctl)
+    : pool_{pool}, testsuite_pg_ctl_{testsuite_pg_ctl} {}
+
+std::optional<ResultSet> StatementBatcher::Execute(
+    CommandControl cmd_ctl, BatchedStatement statement) {
+  Waiter self{cmd_ctl, statement};
+  {
+    const std::lock_guard lock{mutex_};
+    pending_.push_back(&self);
+    if (!has_leader_) {
+      has_leader_ = true;
+      self.state = Waiter::State::kLeading;
+    }
+  }
+
+  // Once the statement is taken into a batch, the leader uses it and writes
+  // the result into the waiter, so the waiter must stay alive until then
+  std::optional<engine::TaskCancellationBlocker> cancellation_blocker;
+  while (true) {
+    {
+      std::unique_lock lock{mutex_};
+      if (self.state == Waiter::State::kDone) break;
+      if (self.state == Waiter::State::kLeading) {
+        lock.unlock();
+        Lead(self);
+        break;
+      }
+    }
+    if (self.event.WaitForEvent()) continue;
+
+    const std::lock_guard lock{mutex_};
+    switch (self.state) {
+      case Waiter::State::kPending:
+      case Waiter::State::kLeading:
+        pending_.erase(std::find(pending_.begin(), pending_.end(), &self));
+        if (self.state == Waiter::State::kLeading) HandOver();
+        return std::nullopt;
+      case Waiter::State::kTaken:
+        cancellation_blocker.emplace();
+        break;
+      case Waiter::State::kDone:
+        break;
+    }
+  }
+
+  if (self.error) std::rethrow_exception(self.error);
+  return std::move(self.result);
+}
+
+void StatementBatcher::Lead(Waiter& self) {
+  std::vector<Waiter*> batch;
+  {
+    const std::lock_guard lock{mutex_};
+    UASSERT(!pending_.empty() && pending_.front() == &self);
+    const auto size = std::min(pending_.size(), kMaxBatchSize);
+    batch.assign(pending_.begin(), pending_.begin() + size);
+    pending_.erase(pending_.begin(), pending_.begin() + size);
+    for (auto* waiter : batch) waiter->state = Waiter::State::kTaken;
+  }
+
+  {
+    // The statements of the other tasks must not fail due to the
+    // cancellation of this one, the execute timeouts limit the batch
+    const engine::TaskCancellationBlocker cancellation_blocker;
+    RunBatch(batch);
+  }
+
+  const std::lock_guard lock{mutex_};
+  for (auto* waiter : batch) {
+    waiter->state = Waiter::State::kDone;
+    // The waiter may be destroyed as soon as the mutex is unlocked
+    if (waiter != &self) waiter->event.Send();
+  }
+  HandOver();
+}
+
+void StatementBatcher::RunBatch(const std::vector<Waiter*>& batch) {
+  UASSERT(!batch.empty());
+  auto timeout = batch.front()->cmd_ctl.execute;
+  for (const auto* waiter : batch) {
+    timeout = std::max(timeout, waiter->cmd_ctl.execute);
+  }
+
+  try {
+    auto conn = pool_.Acquire(testsuite_pg_ctl_.MakeExecuteDeadline(timeout));
+    if (!conn->IsPipelineActive() || !conn->ArePreparedStatementsEnabled()) {
+      // The statements are executed by their tasks in the usual way
+      return;
+    }
+
+    QueryQueue queue{batch.front()->cmd_ctl, std::move(conn)};
+    std::vector<Waiter*> queued;
+    queued.reserve(batch.size());
+    for (auto* waiter : batch) {
+      try {
+        waiter->statement(queue, waiter->cmd_ctl);
+        queued.push_back(waiter);
+      } catch (const std::exception&) {
+        waiter->error = std::current_exception();
+      }
+    }
+    if (queued.empty()) return;
+
+    std::vector<std::exception_ptr> errors;
+    auto results = queue.CollectEach(timeout, errors);
+    if (results.size() != queued.size()) {
+      throw RuntimeError{
+          fmt::format("Batched statements results count mismatch: expected "
+                      "{}, got {}",
+                      queued.size(), results.size())};
+    }
+    for (std::size_t i = 0; i < queued.size(); ++i) {
+      if (errors[i]) {
+        queued[i]->error = errors[i];
+      } else {
+        queued[i]->result = std::move(results[i]);
+      }
+    }
+  } catch (const std::exception&) {
+    const auto error = std::current_exception();
+    for (auto* waiter : batch) {
+      if (!waiter->result && !waiter->error) waiter->error = error;
+    }
+  }
+}
+
+void StatementBatcher::HandOver() {
+  if (pending_.empty()) {
+    has_leader_ = false;
+    return;
+  }
+  auto* next = pending_.front();
+  next->state = Waiter::State::kLeading;
+  next->event.Send();
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/postgres/options.hpp>
+#include <userver/storages/postgres/query_queue.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+#include <userver/testsuite/postgres_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+class ConnectionPool;
+
+/// @brief Sends the single statements of concurrent tasks together over one
+/// pipelined connection of the pool.
+///
+/// There is no dedicated task and no waiting for a batch to fill up. The
+/// first caller becomes the leader: it takes all the waiting statements,
+/// runs them in one QueryQueue and hands the results back. The statements
+/// that arrive meanwhile wait for the next leader, which is the first of
+/// them. The more statements run concurrently, the bigger the batches are.
+class StatementBatcher final {
+ public:
+  /// Maximum number of statements sent at once
+  static constexpr std::size_t kMaxBatchSize = 64;
+
+  StatementBatcher(ConnectionPool& pool,
+                   const testsuite::PostgresControl& testsuite_pg_ctl);
+
+  /// Executes the statement in a batch. Returns `std::nullopt` if the
+  /// statement should be executed on a connection of its own, e.g. if the
+  /// pipeline mode is not available or the task was cancelled while waiting.
+  std::optional<ResultSet> Execute(CommandControl cmd_ctl,
+                                   BatchedStatement statement);
+
+ private:
+  struct Waiter;
+
+  void Lead(Waiter& self);
+  void RunBatch(const std::vector<Waiter*>& batch);
+  // Must be called with the mutex locked
+  void HandOver();
+
+  ConnectionPool& pool_;
+  const testsuite::PostgresControl& testsuite_pg_ctl_;
+  engine::Mutex mutex_;
+  std::deque<Waiter*> pending_;
+  bool has_leader_{false};
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -76,6 +76,11 @@ ConnectionSettings ParseConnectionSettings(const ConfigType& config) {
           ? ConnectionSettings::kDiscardAll
           : ConnectionSettings::kDiscardNone;
 
+  settings.auto_batching =
+      config["auto-batching-enabled"].template As<bool>(false)
+          ? ConnectionSettings::kAutoBatchingEnabled
+          : ConnectionSettings::kAutoBatchingDisabled;
+
   return settings;
 }
 
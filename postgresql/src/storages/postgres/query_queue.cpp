@@ -53,6 +53,16 @@ std::vector<ResultSet> QueryQueue::Collect() {
 }
 
 std::vector<ResultSet> QueryQueue::Collect(TimeoutDuration timeout) {
+  return DoCollect(timeout, nullptr);
+}
+
+std::vector<ResultSet> QueryQueue::CollectEach(
+    TimeoutDuration timeout, std::vector<std::exception_ptr>& errors) {
+  return DoCollect(timeout, &errors);
+}
+
+std::vector<ResultSet> QueryQueue::DoCollect(
+    TimeoutDuration timeout, std::vector<std::exception_ptr>* errors) {
   ValidateUsage();
 
   tracing::Span collect_span{"query_queue_collect"};
@@ -79,7 +89,8 @@ std::vector<ResultSet> QueryQueue::Collect(TimeoutDuration timeout) {
                            meta.params.params_proxy, description, scope);
   }
 
-  auto result = conn_->GatherPipeline(timeout, queries_storage_->descriptions);
+  auto result =
+      conn_->GatherPipeline(timeout, queries_storage_->descriptions, errors);
   if (result.size() != queries_storage_->queries.size()) {
     throw RuntimeError{
         fmt::format("QueryQueue results count mismatch: expected {}, got {}",
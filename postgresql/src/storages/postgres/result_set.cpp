@@ -217,6 +217,12 @@ ResultSet::size_type ResultSet::FieldCount() const {
   return pimpl_->FieldCount();
 }
 
+ResultSet::size_type ResultSet::IndexOfName(const std::string& name) const {
+  const auto index = pimpl_->IndexOfName(name);
+  if (index == npos) throw FieldNameDoesntExist{name};
+  return index;
+}
+
 ResultSet::size_type ResultSet::RowsAffected() const {
   return pimpl_->RowsAffected();
 }
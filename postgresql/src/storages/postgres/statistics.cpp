@@ -55,6 +55,11 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
                            {kPostgresqlError, "connection-timeout"});
   }
   writer["prepared-per-connection"] = stats.connection.prepared_statements;
+  if (auto cache = writer["prepared-cache"]) {
+    cache["hits"] = stats.transaction.prepared_cache_hit_total;
+    cache["misses"] = stats.transaction.parse_total;
+    cache["evicted"] = stats.transaction.prepared_cache_evict_total;
+  }
   writer["roundtrip-time"] = stats.topology.roundtrip_time;
   writer["replication-lag"] = stats.topology.replication_lag;
   if (!stats.statement_timings.empty()) {
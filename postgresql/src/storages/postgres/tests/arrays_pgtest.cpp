@@ -2,6 +2,7 @@
 #include <storages/postgres/tests/util_pgtest.hpp>
 #include <userver/storages/postgres/io/array_types.hpp>
 #include <userver/storages/postgres/io/user_types.hpp>
+#include <userver/storages/postgres/parameter_store.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -1024,6 +1025,45 @@ UTEST_P(PostgreConnection, TransactionDecomposedChunkedContainer) {
 
   trx.Commit();
 }
+
+/// [PushBackColumns]
+void InsertByColumns(pg::Transaction& trx,
+                     const std::vector<IdAndValue>& rows) {
+  pg::ParameterStore params;
+  params.PushBackColumns(rows);
+  trx.Execute(
+      "INSERT INTO columns_array_test(id, value) "
+      "SELECT * FROM UNNEST($1, $2)",
+      params);
+}
+/// [PushBackColumns]
+
+UTEST_P(PostgreConnection, ParameterStoreColumns) {
+  CheckConnection(GetConn());
+
+  GetConn()->Execute(
+      "create temporary table columns_array_test(id integer, value text)");
+
+  // More rows than a statement can have parameters
+  std::vector<IdAndValue> rows_to_insert(70000);
+  for (std::size_t i = 0; i < rows_to_insert.size(); ++i) {
+    rows_to_insert[i] = {static_cast<int>(i), std::to_string(i)};
+  }
+
+  pg::Transaction trx{std::move(GetConn())};
+  UEXPECT_NO_THROW(InsertByColumns(trx, rows_to_insert));
+  const auto inserted_rows =
+      trx.Execute("SELECT id, value FROM columns_array_test ORDER BY id")
+          .AsContainer<std::vector<IdAndValue>>(pg::kRowTag);
+
+  ASSERT_EQ(rows_to_insert.size(), inserted_rows.size());
+  for (std::size_t i = 0; i < rows_to_insert.size(); ++i) {
+    ASSERT_EQ(rows_to_insert[i].id, inserted_rows[i].id);
+    ASSERT_EQ(rows_to_insert[i].value, inserted_rows[i].value);
+  }
+
+  trx.Commit();
+}
 }  // namespace
 
 }  // namespace
@@ -159,6 +159,10 @@ UTEST_F(PostgreCluster, ClusterAnyRW) {
       cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
                      pg::ClusterHostType::kNearest},
                     pg::Transaction::RW));
+  CheckRwTransaction(
+      cluster.Begin({pg::ClusterHostType::kMaster, pg::ClusterHostType::kSlave,
+                     pg::ClusterHostType::kLeastLoaded},
+                    pg::Transaction::RW));
 
   UEXPECT_THROW(
       cluster.Begin(
@@ -188,6 +192,9 @@ UTEST_F(PostgreCluster, ClusterSlaveRO) {
   CheckRoTransaction(cluster.Begin(
       {pg::ClusterHostType::kSlave, pg::ClusterHostType::kNearest},
       pg::Transaction::RO));
+  CheckRoTransaction(cluster.Begin(
+      {pg::ClusterHostType::kSlave, pg::ClusterHostType::kLeastLoaded},
+      pg::Transaction::RO));
 
   UEXPECT_THROW(cluster.Begin({pg::ClusterHostType::kSlave,
                                pg::ClusterHostType::kRoundRobin,
@@ -129,6 +129,8 @@ UTEST_P(PostgreStats, TransactionMultiExecutions) {
   EXPECT_EQ(0, stats.rollback_total);
   EXPECT_EQ(0, stats.out_of_trx);
   EXPECT_EQ(1, stats.parse_total);
+  EXPECT_EQ(exec_count - 1, stats.prepared_cache_hit_total);
+  EXPECT_EQ(0, stats.prepared_cache_evict_total);
   EXPECT_EQ(exec_count + 2, stats.execute_total);
   EXPECT_EQ(exec_count, stats.reply_total);
   EXPECT_EQ(0, stats.portal_bind_total);
@@ -168,7 +168,14 @@ UTEST_P(PostgreConnection, CheckResultset) {
       EXPECT_EQ("foo bar", str);
       EXPECT_EQ(6.28, d);
     }
+    {
+      const auto indexes = res.IndexesOfNames({"double", "str"});
+      auto [d, str] = row.As<double, std::string_view>(indexes);
+      EXPECT_EQ("foo bar", str);
+      EXPECT_EQ(6.28, d);
+    }
   }
+  UEXPECT_THROW(res.IndexesOfNames({"str", "foo"}), pg::FieldNameDoesntExist);
 }
 
 UTEST_P(PostgreConnection, QueryErrors) {
@@ -0,0 +1,129 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/copy.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+namespace {
+
+struct CopyRow final {
+  int id{};
+  std::optional<std::string> value;
+};
+
+constexpr int kRowsCount = 10000;
+
+/// [CopyIn]
+std::size_t CopyRowsIn(pg::Transaction& trx,
+                       const std::vector<CopyRow>& rows) {
+  auto copy =
+      trx.CopyIn("COPY copy_test (id, value) FROM STDIN (FORMAT binary)");
+  copy.WriteRows(rows);
+  return copy.Finish();
+}
+/// [CopyIn]
+
+/// [CopyOut]
+std::vector<CopyRow> CopyRowsOut(pg::Transaction& trx) {
+  auto copy = trx.CopyOut(
+      "COPY (SELECT id, value FROM copy_test ORDER BY id) TO STDOUT "
+      "(FORMAT binary)");
+  return copy.ReadAll<CopyRow>(pg::kRowTag);
+}
+/// [CopyOut]
+
+}  // namespace
+
+UTEST_P(PostgreConnection, CopyInOut) {
+  CheckConnection(GetConn());
+  GetConn()->Execute(
+      "create temporary table copy_test(id integer, value text)");
+
+  std::vector<CopyRow> rows;
+  for (int i = 0; i < kRowsCount; ++i) {
+    rows.push_back(
+        {i, i % 3 ? std::optional{std::to_string(i)} : std::nullopt});
+  }
+
+  pg::Transaction trx{std::move(GetConn())};
+  EXPECT_EQ(CopyRowsIn(trx, rows), rows.size());
+
+  const auto res =
+      trx.Execute("select count(*), count(value) from copy_test");
+  EXPECT_EQ(res.Front()[0].As<pg::Bigint>(), kRowsCount);
+  // Every third row, starting with the first one, has a NULL value
+  EXPECT_EQ(res.Front()[1].As<pg::Bigint>(),
+            kRowsCount - (kRowsCount + 2) / 3);
+
+  const auto copied = CopyRowsOut(trx);
+  ASSERT_EQ(copied.size(), rows.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    EXPECT_EQ(copied[i].id, rows[i].id);
+    EXPECT_EQ(copied[i].value, rows[i].value);
+  }
+
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyOutPartialRead) {
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  {
+    auto copy = trx.CopyOut(
+        "COPY (SELECT i, i::text FROM generate_series(1, 1000) i) TO STDOUT "
+        "(FORMAT binary)");
+    int id = 0;
+    std::string value;
+    ASSERT_TRUE(copy.Read(id, value));
+    EXPECT_EQ(id, 1);
+    EXPECT_EQ(value, "1");
+  }
+
+  // The rest of the rows are discarded, the connection is usable
+  const auto res = trx.Execute("select 1");
+  EXPECT_EQ(res.Front()[0].As<int>(), 1);
+  trx.Commit();
+}
+
+UTEST_P(PostgreConnection, CopyInAbort) {
+  CheckConnection(GetConn());
+  GetConn()->Execute("create temporary table copy_abort_test(id integer)");
+
+  pg::Transaction trx{std::move(GetConn())};
+  {
+    auto copy =
+        trx.CopyIn("COPY copy_abort_test (id) FROM STDIN (FORMAT binary)");
+    copy.Write(1);
+  }
+
+  // Aborted COPY fails the transaction
+  UEXPECT_THROW(trx.Execute("select 1"), pg::Error);
+  trx.Rollback();
+}
+
+UTEST_P(PostgreConnection, CopyErrors) {
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn())};
+  UEXPECT_THROW(trx.CopyIn("select 1"), pg::LogicError);
+  UEXPECT_THROW(trx.CopyIn("COPY (SELECT 1) TO STDOUT (FORMAT binary)"),
+                pg::LogicError);
+
+  {
+    auto copy = trx.CopyOut("COPY (SELECT 1, 2) TO STDOUT (FORMAT binary)");
+    int value = 0;
+    UEXPECT_THROW(copy.Read(value), pg::InvalidTupleSizeRequested);
+  }
+  trx.Commit();
+}
+
+USERVER_NAMESPACE_END
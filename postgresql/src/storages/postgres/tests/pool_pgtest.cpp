@@ -180,6 +180,27 @@ UTEST_P(PostgrePool, PoolTransaction) {
   PoolTransaction(pool);
 }
 
+UTEST_P(PostgrePool, PoolRestoresBrokenConnection) {
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {1, 1, 10},
+      kCachePreparedStatements, {}, GetTestCmdCtls(),
+      testsuite::PostgresControl{}, error_injection::Settings{}, {},
+      dynamic_config::GetDefaultSource());
+  {
+    pg::detail::ConnectionPtr conn(nullptr);
+    UASSERT_NO_THROW(conn = pool->Acquire(MakeDeadline()));
+    UEXPECT_NO_THROW(conn->Close());
+  }
+
+  // A new connection is being established without waiting for a request
+  EXPECT_EQ(1, pool->GetStatistics().connection.active);
+  PoolTransaction(pool);
+
+  const auto& stats = pool->GetStatistics();
+  EXPECT_EQ(2, stats.connection.open_total);
+  EXPECT_EQ(1, stats.connection.error_total);
+}
+
 UTEST_P(PostgrePool, PoolAliveIfConnectionExists) {
   auto pool = pg::detail::ConnectionPool::Create(
       GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {1, 1, 10},
@@ -458,6 +479,48 @@ UTEST_P(PostgrePool, ForQueryQueueBeingNonTransactional) {
   EXPECT_EQ(inserted_values.front(), 1);
 }
 
+UTEST_P(PostgrePool, ExecuteBatched) {
+  if (GetParam() != pg::InitMode::kSync) {
+    return;
+  }
+
+  // A single connection is shared by all the statements
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "", GetParam(), {1, 1, 10},
+      kPipelineEnabled, {}, GetTestCmdCtls(), {}, {}, {},
+      dynamic_config::GetDefaultSource());
+  if (!pool->Acquire(MakeDeadline())->IsPipelineActive()) {
+    return;
+  }
+
+  constexpr pg::CommandControl kDefaultCC{utest::kMaxTestWaitTime,
+                                          utest::kMaxTestWaitTime};
+  constexpr int kStatementsCount = 20;
+  constexpr int kFailingStatement = 7;
+
+  std::vector<engine::TaskWithResult<std::optional<pg::ResultSet>>> tasks;
+  for (int i = 0; i < kStatementsCount; ++i) {
+    tasks.push_back(engine::AsyncNoSpan([&pool, kDefaultCC, i] {
+      return pool->ExecuteBatched(
+          kDefaultCC, [i](pg::QueryQueue& queue, pg::CommandControl cmd_ctl) {
+            // An error of a statement does not affect the other ones
+            queue.Push(cmd_ctl, "SELECT $1 / $2", i,
+                       i == kFailingStatement ? 0 : 1);
+          });
+    }));
+  }
+
+  for (int i = 0; i < kStatementsCount; ++i) {
+    if (i == kFailingStatement) {
+      UEXPECT_THROW(tasks[i].Get(), pg::DataException);
+      continue;
+    }
+    const auto res = tasks[i].Get();
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->AsSingleRow<int>(), i);
+  }
+}
+
 INSTANTIATE_UTEST_SUITE_P(
     PoolTests, PostgrePool,
     ::testing::Values(pg::InitMode::kAsync, pg::InitMode::kSync),
@@ -100,6 +100,32 @@ Portal Transaction::MakePortal(const PortalName& portal_name,
                 std::move(statement_cmd_ctl)};
 }
 
+CopyInStream Transaction::CopyIn(OptionalCommandControl statement_cmd_ctl,
+                                 const Query& query) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "COPY called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  if (!statement_cmd_ctl) {
+    statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  return CopyInStream{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
+CopyOutStream Transaction::CopyOut(OptionalCommandControl statement_cmd_ctl,
+                                   const Query& query) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "COPY called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  if (!statement_cmd_ctl) {
+    statement_cmd_ctl = conn_->GetQueryCmdCtl(query.GetName());
+  }
+  return CopyOutStream{conn_.get(), query, std::move(statement_cmd_ctl)};
+}
+
 void Transaction::SetParameter(const std::string& param_name,
                                const std::string& value) {
   if (!conn_) {
@@ -4,6 +4,8 @@
 /// @brief Publisher interface for the broker.
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -77,6 +79,22 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  /// @brief Publishes the messages with publisher-confirms without waiting
+  /// for the confirm of each message before sending the next one, and then
+  /// waits for all the confirms.
+  ///
+  /// Up to `max_in_flight_requests` (see PoolSettings) messages of the
+  /// connection are left unconfirmed at a time, the messages fitting into
+  /// that window are sent to the broker in a single write. This gives a much
+  /// higher throughput than a PublishReliable call per message.
+  ///
+  /// Throws on the first message not confirmed by the broker, the messages
+  /// following it might have been published as well.
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type, engine::Deadline deadline);
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
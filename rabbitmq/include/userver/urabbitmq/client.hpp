@@ -4,6 +4,8 @@
 /// @brief @copybrief urabbitmq::Client
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/utils/fast_pimpl.hpp>
@@ -101,6 +103,14 @@ class Client : public std::enable_shared_from_this<Client>,
                     deadline);
   }
 
+  /// @brief Publishes the messages with publisher-confirms, see
+  /// ReliableChannel::PublishReliableBatch. The whole batch is published over
+  /// a single connection of the pool.
+  void PublishReliableBatch(const Exchange& exchange,
+                            const std::string& routing_key,
+                            const std::vector<std::string>& messages,
+                            MessageType type, engine::Deadline deadline);
+
   /// @brief Get a reliable publisher interface for the broker
   /// (publisher-confirms)
   ///
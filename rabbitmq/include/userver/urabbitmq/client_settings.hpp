@@ -57,6 +57,16 @@ struct PoolSettings final {
   /// (tcp error/protocol error/write timeout) leads to a errors burst:
   /// all outstanding request will fails at once
   size_t max_in_flight_requests = 5;
+
+  /// Whether the pool grows above `min_pool_size` (up to `max_pool_size`) when
+  /// the requests have to wait for the connections: either for their
+  /// `max_in_flight_requests` limit or for the frames of the other requests
+  /// to be sent. The connections added this way are closed after the load
+  /// drops.
+  ///
+  /// Every connection has its own reader task and lock, so spreading the load
+  /// over more connections lets it use more of the task processor threads.
+  bool load_based_sizing = false;
 };
 
 class TestsHelper;
@@ -62,6 +62,7 @@ class ConsumerBase {
   ///
   /// If this method returns successfully message would be acked (best effort)
   /// to the broker, if this method throws the message would be requeued.
+  /// The acks might be batched, see ConsumerSettings::ack_batch_size.
   ///
   /// Please keep in mind that it is possible for the message to be delivered
   /// again even if `Process` returns successfully: sadly we can't guarantee
@@ -34,10 +34,14 @@ namespace urabbitmq {
 /// @snippet samples/rabbitmq_service/static_config.yaml  RabbitMQ consumer sample - static config
 ///
 /// ## Static options:
-/// Name             | Description
-/// rabbit_name      | Name of the RabbitMQ component to use for consumption
-/// queue            | Name of the queue to consume from
-/// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// Name               | Description                                                                | Default value
+/// rabbit_name        | Name of the RabbitMQ component to use for consumption                      | --
+/// queue              | Name of the queue to consume from                                          | --
+/// prefetch_count     | prefetch_count for the consumer, limits the amount of in-flight messages   | --
+/// ack_batch_size     | number of processed messages acknowledged to the broker at once            | 1
+/// ack_batch_timeout  | max time a processed message waits for its ack batch to fill up            | 100ms
+/// max_concurrency    | max number of messages processed concurrently, prefetch_count if 0         | 0
+/// max_prefetch_count | upper bound for the prefetch autotuning, 0 disables the autotuning         | 0
 ///
 // clang-format on
 class ConsumerComponentBase : public components::LoggableComponentBase {
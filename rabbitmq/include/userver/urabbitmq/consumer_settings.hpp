@@ -3,7 +3,8 @@
 /// @file userver/urabbitmq/consumer_settings.hpp
 /// @brief Consumer settings.
 
-#include <cstddef>
+#include <chrono>
+#include <cstdint>
 
 #include <userver/urabbitmq/typedefs.hpp>
 
@@ -24,6 +25,29 @@ struct ConsumerSettings final {
   /// Settings this value to 1 basically makes a consumer synchronous, which
   /// could be of use for some workloads
   std::uint16_t prefetch_count;
+
+  /// Number of processed messages acknowledged to the broker at once, a
+  /// contiguous range of them is acknowledged with a single `multiple` ack.
+  /// Clamped to a half of the prefetch window, as the processed messages
+  /// still take the window until they are acknowledged.
+  ///
+  /// 1 acknowledges every message right after it is processed
+  std::uint16_t ack_batch_size{1};
+
+  /// Max time a processed message waits for its ack batch to fill up
+  std::chrono::milliseconds ack_batch_timeout{100};
+
+  /// Max number of messages processed concurrently, `prefetch_count` if 0.
+  /// The messages delivered above this limit wait for a free slot.
+  std::uint16_t max_concurrency{0};
+
+  /// Upper bound for the prefetch autotuning, 0 disables the autotuning.
+  ///
+  /// The prefetch window is periodically resized within
+  /// [prefetch_count, max_prefetch_count] so that it fits the messages being
+  /// processed by `max_concurrency` tasks and the processed ones still waiting
+  /// for their acks, given the measured processing and ack latencies.
+  std::uint16_t max_prefetch_count{0};
 };
 
 }  // namespace urabbitmq
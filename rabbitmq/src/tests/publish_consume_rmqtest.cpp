@@ -1,5 +1,6 @@
 #include "utils_rmqtest.hpp"
 
+#include <algorithm>
 #include <optional>
 
 #include <userver/engine/sleep.hpp>
@@ -150,6 +151,59 @@ UTEST(Consumer, ExhaustesQueue) {
   consumer.Wait();
 }
 
+UTEST(Consumer, ConsumesReliableBatch) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+
+  const size_t messages_count = 1000;
+  std::vector<std::string> messages;
+  for (size_t i = 0; i < messages_count; ++i) {
+    messages.push_back(std::to_string(i));
+  }
+  client->PublishReliableBatch(client.GetExchange(), client.GetRoutingKey(),
+                               messages, urabbitmq::MessageType::kTransient,
+                               client.GetDeadline());
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+
+  auto consumed = consumer.Wait();
+  std::sort(consumed.begin(), consumed.end());
+  std::sort(messages.begin(), messages.end());
+  EXPECT_EQ(consumed, messages);
+}
+
+UTEST(Consumer, BatchesAcks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  urabbitmq::ConsumerSettings settings{client.GetQueue(), 10};
+  settings.ack_batch_size = 4;
+  settings.max_concurrency = 2;
+  settings.max_prefetch_count = 50;
+
+  const size_t messages_count = 203;
+  for (size_t i = 0; i < messages_count; ++i) {
+    client->PublishReliable(client.GetExchange(), client.GetRoutingKey(),
+                            std::to_string(i),
+                            urabbitmq::MessageType::kTransient,
+                            client.GetDeadline());
+  }
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+  EXPECT_EQ(consumer.Wait().size(), messages_count);
+  // The last incomplete batch is acked on stop
+  consumer.Stop();
+
+  Consumer next_consumer{client.Get(), settings};
+  next_consumer.Start();
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+  EXPECT_TRUE(next_consumer.Get().empty());
+}
+
 UTEST(Consumer, ThrowsReturnsToQueue) {
   ClientWrapper client{};
   client.SetupRmqEntities();
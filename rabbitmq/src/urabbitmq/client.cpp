@@ -87,6 +87,15 @@ void Client::PublishReliable(const Exchange& exchange,
   awaiter.Wait(deadline);
 }
 
+void Client::PublishReliableBatch(const Exchange& exchange,
+                                  const std::string& routing_key,
+                                  const std::vector<std::string>& messages,
+                                  MessageType type, engine::Deadline deadline) {
+  ConnectionHelper::PublishReliableBatch(impl_->GetConnection(deadline),
+                                         exchange, routing_key, messages, type,
+                                         deadline);
+}
+
 AdminChannel Client::GetAdminChannel(engine::Deadline deadline) {
   return {impl_->GetConnection(deadline)};
 }
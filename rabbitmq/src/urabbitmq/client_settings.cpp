@@ -72,6 +72,8 @@ PoolSettings Parse(const yaml_config::YamlConfig& config,
       config["max_pool_size"].As<size_t>(result.max_pool_size);
   result.max_in_flight_requests = config["max_in_flight_requests"].As<size_t>(
       result.max_in_flight_requests);
+  result.load_based_sizing =
+      config["load_based_sizing"].As<bool>(result.load_based_sizing);
 
   UINVARIANT(result.min_pool_size <= result.max_pool_size,
              "max_pool_size is less than min_pool_size");
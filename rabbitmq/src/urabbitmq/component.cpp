@@ -72,6 +72,11 @@ properties:
         description: |
           per-connection limit for requests awaiting response from the broker
         defaultDescription: 5
+    load_based_sizing:
+        type: boolean
+        description: |
+          whether to grow the pool above min_pool_size when the requests wait for the connections
+        defaultDescription: false
     use_secure_connection:
         type: boolean
         description: whether to use TLS for connections
@@ -1,5 +1,7 @@
 #include "connection_pool.hpp"
 
+#include <utility>
+
 #include <urabbitmq/connection.hpp>
 #include <urabbitmq/connection_ptr.hpp>
 #include <urabbitmq/make_shared_enabler.hpp>
@@ -16,6 +18,10 @@ constexpr std::chrono::milliseconds kPoolMonitorInterval{1000};
 
 constexpr size_t kMaxSimultaneouslyConnectingClients{5};
 
+// With load based sizing an extra connection is closed after this many
+// monitor intervals without the requests waiting for the connections
+constexpr size_t kIdleIntervalsBeforeShrink{30};
+
 }  // namespace
 
 std::shared_ptr<ConnectionPool> ConnectionPool::Create(
@@ -99,6 +105,45 @@ void ConnectionPool::RunMonitor() {
     } catch (const std::exception& ex) {
       LOG_WARNING() << "Failed to add connection into pool: " << ex;
     }
+  } else if (pool_settings_.load_based_sizing) {
+    AdjustToLoad();
+  }
+}
+
+void ConnectionPool::AdjustToLoad() {
+  const auto stats = stats_.Get();
+  const auto waits_count =
+      stats.in_flight_limit_waits + stats.connection_lock_waits;
+  const auto new_waits =
+      waits_count - std::exchange(last_waits_count_, waits_count);
+
+  const auto alive = AliveConnectionsCountApprox();
+  if (new_waits != 0) {
+    idle_intervals_ = 0;
+    if (alive >= pool_settings_.max_pool_size) return;
+
+    LOG_INFO() << "Requests waited for the connections " << new_waits
+               << " times, adding a connection to the pool of '"
+               << endpoint_info_.host << "'";
+    try {
+      PushConnection(engine::Deadline::FromDuration(kConnectionSetupTimeout));
+    } catch (const std::exception& ex) {
+      LOG_WARNING() << "Failed to add connection into pool: " << ex;
+    }
+    return;
+  }
+
+  if (alive <= pool_settings_.min_pool_size ||
+      ++idle_intervals_ < kIdleIntervalsBeforeShrink) {
+    return;
+  }
+  idle_intervals_ = 0;
+
+  auto connection = TryPop();
+  if (connection) {
+    LOG_INFO() << "Removing an idle connection from the pool of '"
+               << endpoint_info_.host << "'";
+    Drop(connection.release());
   }
 }
 
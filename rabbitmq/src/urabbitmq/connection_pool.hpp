@@ -53,6 +53,7 @@ class ConnectionPool final
   void AccountOverload();
 
   void RunMonitor();
+  void AdjustToLoad();
 
   clients::dns::Resolver& resolver_;
   const EndpointInfo endpoint_info_;
@@ -61,6 +62,9 @@ class ConnectionPool final
   bool use_secure_connection_;
   statistics::ConnectionStatistics& stats_;
 
+  size_t last_waits_count_{0};
+  size_t idle_intervals_{0};
+
   utils::PeriodicTask monitor_;
 };
 
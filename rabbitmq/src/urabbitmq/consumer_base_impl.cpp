@@ -1,6 +1,11 @@
 #include "consumer_base_impl.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -8,10 +13,12 @@
 #include <userver/logging/log.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <urabbitmq/connection.hpp>
 #include <urabbitmq/impl/amqp_channel.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
+#include <urabbitmq/statistics/connection_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,6 +27,14 @@ namespace urabbitmq {
 namespace {
 
 constexpr std::chrono::milliseconds kStartTimeout{2000};
+constexpr std::chrono::seconds kPrefetchTuneInterval{1};
+
+std::size_t GetAckBatchSize(const ConsumerSettings& settings) {
+  // Processed messages take the prefetch window until they are acked
+  return std::clamp<std::size_t>(
+      settings.ack_batch_size, 1,
+      std::max<std::size_t>(settings.prefetch_count / 2, 1));
+}
 
 }  // namespace
 
@@ -28,8 +43,15 @@ ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
       prefetch_count_{settings.prefetch_count},
+      min_prefetch_count_{settings.prefetch_count},
+      max_prefetch_count_{settings.max_prefetch_count},
+      ack_batch_size_{GetAckBatchSize(settings)},
+      ack_batch_timeout_{settings.ack_batch_timeout},
+      concurrency_{settings.max_concurrency != 0 ? settings.max_concurrency
+                                                 : settings.prefetch_count},
       connection_ptr_{std::move(connection)},
-      channel_{connection_ptr_->GetChannel()} {
+      channel_{connection_ptr_->GetChannel()},
+      concurrency_sema_{concurrency_} {
   // We take ownership of the connection, because if it remains pooled
   // things get messy with lifetimes and callbacks
   connection_ptr_.Adopt();
@@ -55,16 +77,44 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
           consumer_tag_.emplace(consumer_tag);
         }
       },
-      // message callback
-      [this](const AMQP::Message& message, uint64_t delivery_tag, bool) {
-        // We received a message but won't ack it, so it will be requeued
-        // at some point
-        if (!stopped_) {
-          OnMessage(message, delivery_tag);
-        }
-      },
+      // message callbacks
+      {[this](uint64_t size) {
+         body_ = std::string{};
+         body_.reserve(size);
+         trace_id_.clear();
+       },
+       [this](const AMQP::MetaData& metadata) {
+         std::string trace_id = metadata.headers().get("u-trace-id");
+         trace_id_ = std::move(trace_id);
+       },
+       [this](const char* data, size_t size) { body_.append(data, size); },
+       [this](uint64_t delivery_tag, bool) {
+         {
+           // The messages that won't be acked are remembered as well, so that
+           // a `multiple` ack doesn't cover them
+           auto state = ack_state_.Lock();
+           state->delivered.insert(delivery_tag);
+           // We received a message but won't ack it, so it will be requeued
+           // at some point
+           if (stopped_) return;
+           ++state->in_flight;
+         }
+         OnMessage(delivery_tag);
+       }},
       start_deadline);
 
+  const bool batches_acks = ack_batch_size_ > 1;
+  if (batches_acks || max_prefetch_count_ > min_prefetch_count_) {
+    maintenance_task_.Start(
+        fmt::format("{}_consumer_acks", queue_name_),
+        {batches_acks ? ack_batch_timeout_
+                      : std::chrono::milliseconds{kPrefetchTuneInterval}},
+        [this] {
+          FlushAcks();
+          if (max_prefetch_count_ > min_prefetch_count_) TunePrefetch();
+        });
+  }
+
   LOG_INFO() << "Started a consumer for '" << queue_name_ << "' queue";
 }
 
@@ -76,9 +126,25 @@ void ConsumerBaseImpl::Stop() {
     // Connection is broken, but that's not a problem
   }
 
+  maintenance_task_.Stop();
+
   // Cancel all the active dispatched tasks
   bts_.CancelAndWait();
 
+  try {
+    FlushAcks();
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to ack the processed messages, they will be "
+                     "requeued by RabbitMQ at some point: "
+                  << ex;
+  }
+  // The messages that are not settled by now are requeued by RabbitMQ
+  {
+    auto state = ack_state_.Lock();
+    channel_.GetStatistics().AccountMessagesSettled(
+        std::exchange(state->in_flight, 0));
+  }
+
   // Destroy the connection: at this point all the remaining tasks are stopped,
   // consumer is either stopped or in unknown state - that could happen if we
   // didn't receive onSuccess callback yet.
@@ -91,12 +157,13 @@ bool ConsumerBaseImpl::IsBroken() const {
   return broken_ || !connection_ptr_.IsUsable();
 }
 
-void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
-                                 uint64_t delivery_tag) {
+void ConsumerBaseImpl::OnMessage(uint64_t delivery_tag) {
   std::string span_name{fmt::format("consume_{}_{}", queue_name_,
                                     consumer_tag_.value_or("ctag:unknown"))};
-  std::string trace_id = message.headers().get("u-trace-id");
-  std::string message_data{message.body(), message.bodySize()};
+  std::string trace_id = std::move(trace_id_);
+  std::string message_data = std::move(body_);
+
+  channel_.GetStatistics().AccountMessageDispatched();
 
   bts_.Detach(engine::AsyncNoSpan(
       dispatcher_, [this, message = std::move(message_data),
@@ -105,8 +172,12 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
         auto span = tracing::Span::MakeSpan(std::move(span_name), trace_id, {});
 
         bool success = false;
+        Clock::duration processing_time{};
         try {
+          const engine::SemaphoreLock processing_lock{concurrency_sema_};
+          const auto processing_started_at = Clock::now();
           dispatch_callback_(std::move(message));
+          processing_time = Clock::now() - processing_started_at;
           success = true;
         } catch (const std::exception& ex) {
           LOG_ERROR() << "Failed to process the consumed message, " << ex.what()
@@ -115,10 +186,9 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
 
         try {
           if (success) {
-            channel_.Ack(delivery_tag, {});
-            channel_.AccountMessageConsumed();
+            OnProcessed(delivery_tag, processing_time);
           } else {
-            channel_.Reject(delivery_tag, true, {});
+            OnFailed(delivery_tag);
           }
         } catch (const std::exception& ex) {
           LOG_WARNING()
@@ -128,6 +198,128 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
       }));
 }
 
+void ConsumerBaseImpl::OnProcessed(uint64_t delivery_tag,
+                                   Clock::duration processing_time) {
+  bool batch_is_full = false;
+  {
+    auto state = ack_state_.Lock();
+    state->delivered.erase(delivery_tag);
+    state->processed.emplace(delivery_tag, Clock::now());
+    state->processing_time += processing_time;
+    ++state->processed_count;
+    batch_is_full = state->processed.size() >= ack_batch_size_;
+  }
+
+  if (batch_is_full) FlushAcks();
+}
+
+void ConsumerBaseImpl::OnFailed(uint64_t delivery_tag) {
+  const std::lock_guard ack_lock{ack_mutex_};
+
+  // The message stays delivered until it is rejected, so that a concurrent
+  // `multiple` ack doesn't cover it
+  const utils::FastScopeGuard settle{[this, delivery_tag]() noexcept {
+    {
+      auto state = ack_state_.Lock();
+      state->delivered.erase(delivery_tag);
+      --state->in_flight;
+    }
+    channel_.GetStatistics().AccountMessagesSettled(1);
+  }};
+  channel_.Reject(delivery_tag, true, {});
+}
+
+void ConsumerBaseImpl::FlushAcks() {
+  const std::lock_guard ack_lock{ack_mutex_};
+
+  std::optional<uint64_t> multiple_ack_tag;
+  std::vector<uint64_t> single_ack_tags;
+  std::size_t acked_count = 0;
+  Clock::duration ack_latency{};
+  {
+    auto state = ack_state_.Lock();
+    if (state->processed.empty()) return;
+
+    // A `multiple` ack covers all the unsettled messages up to its tag, so it
+    // stops right before the first message that is still being processed,
+    // the processed messages past it are acked one by one
+    const auto first_unprocessed =
+        state->delivered.empty() ? std::numeric_limits<uint64_t>::max()
+                                 : *state->delivered.begin();
+    const auto bound = state->processed.lower_bound(first_unprocessed);
+    if (bound != state->processed.begin()) {
+      multiple_ack_tag = std::prev(bound)->first;
+    }
+    for (auto it = bound; it != state->processed.end(); ++it) {
+      single_ack_tags.push_back(it->first);
+    }
+
+    const auto now = Clock::now();
+    for (const auto& [tag, processed_at] : state->processed) {
+      ack_latency += now - processed_at;
+    }
+    acked_count = state->processed.size();
+    state->processed.clear();
+
+    state->in_flight -= acked_count;
+    state->ack_latency += ack_latency;
+    state->acked_count += acked_count;
+  }
+
+  auto& stats = channel_.GetStatistics();
+  stats.AccountMessagesSettled(acked_count);
+
+  if (multiple_ack_tag) channel_.Ack(*multiple_ack_tag, true, {});
+  for (const auto tag : single_ack_tags) channel_.Ack(tag, false, {});
+
+  stats.AccountAcks(
+      single_ack_tags.size() + (multiple_ack_tag ? 1 : 0),
+      std::chrono::duration_cast<std::chrono::milliseconds>(ack_latency));
+  for (std::size_t i = 0; i < acked_count; ++i) {
+    channel_.AccountMessageConsumed();
+  }
+}
+
+void ConsumerBaseImpl::TunePrefetch() {
+  const auto now = Clock::now();
+  if (now - last_tuned_at_ < kPrefetchTuneInterval) return;
+  last_tuned_at_ = now;
+
+  AckState totals;
+  {
+    auto state = ack_state_.Lock();
+    totals.processing_time = std::exchange(state->processing_time, {});
+    totals.processed_count = std::exchange(state->processed_count, 0);
+    totals.ack_latency = std::exchange(state->ack_latency, {});
+    totals.acked_count = std::exchange(state->acked_count, 0);
+  }
+  if (totals.processed_count == 0 || totals.processing_time.count() <= 0) {
+    return;
+  }
+
+  // Every processing slot keeps its message in the prefetch window while the
+  // message is processed and then while it waits for its ack
+  const auto processing_time =
+      std::chrono::duration<double>(totals.processing_time).count() /
+      totals.processed_count;
+  const auto ack_latency =
+      totals.acked_count == 0
+          ? 0.0
+          : std::chrono::duration<double>(totals.ack_latency).count() /
+                totals.acked_count;
+  const auto target = static_cast<std::size_t>(std::ceil(
+      concurrency_ * (processing_time + ack_latency) / processing_time));
+  const auto prefetch_count = static_cast<uint16_t>(std::clamp<std::size_t>(
+      target, min_prefetch_count_, max_prefetch_count_));
+  if (prefetch_count == prefetch_count_) return;
+
+  LOG_INFO() << "Changing prefetch_count of the consumer for '" << queue_name_
+             << "' queue from " << prefetch_count_ << " to " << prefetch_count;
+  channel_.SetQos(prefetch_count,
+                  engine::Deadline::FromDuration(kStartTimeout));
+  prefetch_count_ = prefetch_count;
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
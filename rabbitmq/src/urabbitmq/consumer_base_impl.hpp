@@ -1,9 +1,20 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/semaphore.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
 
@@ -32,12 +43,39 @@ class ConsumerBaseImpl final {
   bool IsBroken() const;
 
  private:
-  void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  using Clock = std::chrono::steady_clock;
+
+  struct AckState final {
+    // Delivered messages that are not processed yet
+    std::set<uint64_t> delivered;
+    // Processed messages waiting for their ack and the time they were
+    // processed at
+    std::map<uint64_t, Clock::time_point> processed;
+    // Dispatched messages that are neither acked nor rejected yet
+    std::size_t in_flight{0};
+
+    // Accumulated since the last prefetch autotuning
+    Clock::duration processing_time{};
+    std::size_t processed_count{0};
+    Clock::duration ack_latency{};
+    std::size_t acked_count{0};
+  };
+
+  void OnMessage(uint64_t delivery_tag);
+  void OnProcessed(uint64_t delivery_tag, Clock::duration processing_time);
+  void OnFailed(uint64_t delivery_tag);
+  void FlushAcks();
+  void TunePrefetch();
   void Stop();
 
   engine::TaskProcessor& dispatcher_;
   const std::string queue_name_;
   uint16_t prefetch_count_;
+  const uint16_t min_prefetch_count_;
+  const uint16_t max_prefetch_count_;
+  const std::size_t ack_batch_size_;
+  const std::chrono::milliseconds ack_batch_timeout_;
+  const std::size_t concurrency_;
 
   ConnectionPtr connection_ptr_;
   impl::AmqpChannel& channel_;
@@ -46,12 +84,26 @@ class ConsumerBaseImpl final {
 
   DispatchCallback dispatch_callback_;
 
+  // The message being received, only touched by the connection reader
+  std::string body_;
+  std::string trace_id_;
+
   std::atomic<bool> stopped_{false};
 
   // Underlying channel errored, just restart the consumer
   // (consumer_base polls this and destructs+constructs us if we broke)
   std::atomic<bool> broken_{false};
 
+  engine::Semaphore concurrency_sema_;
+
+  concurrent::Variable<AckState> ack_state_;
+  // Serializes the acks and rejects, as a `multiple` ack covers all the
+  // unsettled messages up to its delivery tag
+  engine::Mutex ack_mutex_;
+
+  Clock::time_point last_tuned_at_{Clock::now()};
+  utils::PeriodicTask maintenance_task_;
+
   // This should be the last member
   concurrent::BackgroundTaskStorageCore bts_;
 };
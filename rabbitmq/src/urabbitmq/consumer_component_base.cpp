@@ -16,8 +16,18 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config,
   ConsumerSettings settings;
   settings.queue = Queue{config["queue"].As<std::string>()};
   settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
+  settings.ack_batch_size =
+      config["ack_batch_size"].As<uint16_t>(settings.ack_batch_size);
+  settings.ack_batch_timeout =
+      config["ack_batch_timeout"].As<std::chrono::milliseconds>(
+          settings.ack_batch_timeout);
+  settings.max_concurrency =
+      config["max_concurrency"].As<uint16_t>(settings.max_concurrency);
+  settings.max_prefetch_count =
+      config["max_prefetch_count"].As<uint16_t>(settings.max_prefetch_count);
 
   UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
+  UINVARIANT(settings.ack_batch_size > 0, "ack_batch_size is set to zero");
 
   return settings;
 }
@@ -76,6 +86,23 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    ack_batch_size:
+        type: integer
+        description: number of processed messages acknowledged at once
+        defaultDescription: 1
+        minimum: 1
+    ack_batch_timeout:
+        type: string
+        description: max time a processed message waits for its ack batch
+        defaultDescription: 100ms
+    max_concurrency:
+        type: integer
+        description: max number of messages processed concurrently, prefetch_count if 0
+        defaultDescription: 0
+    max_prefetch_count:
+        type: integer
+        description: upper bound for the prefetch autotuning, 0 disables the autotuning
+        defaultDescription: 0
 )");
 }
 
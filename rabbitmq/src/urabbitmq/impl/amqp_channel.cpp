@@ -1,9 +1,12 @@
 #include "amqp_channel.hpp"
 
+#include <deque>
 #include <optional>
+#include <utility>
 
 #include <userver/engine/task/task.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 #include <urabbitmq/impl/amqp_connection.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
@@ -71,6 +74,14 @@ AMQP::Table CreateHeaders() {
   return headers;
 }
 
+void WaitOldest(std::deque<ResponseAwaiter>& in_flight,
+                engine::Deadline deadline) {
+  // The awaiter is taken out first, as the response can't be awaited twice
+  const auto oldest = std::move(in_flight.front());
+  in_flight.pop_front();
+  oldest.Wait(deadline);
+}
+
 }  // namespace
 
 AmqpChannel::AmqpChannel(AmqpConnection& conn) : conn_{conn} {}
@@ -180,10 +191,11 @@ void AmqpChannel::Publish(const Exchange& exchange,
   // We don't account publish here, because there's no way to ensure success
 }
 
-void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
+void AmqpChannel::Ack(uint64_t delivery_tag, bool multiple,
+                      engine::Deadline deadline) {
   // No way to acknowledge success, no way to handle synchronous errors
   auto channel = conn_.GetChannel(deadline);
-  channel->ack(delivery_tag);
+  channel->ack(delivery_tag, multiple ? AMQP::multiple : 0);
 }
 
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue,
@@ -205,14 +217,20 @@ void AmqpChannel::SetQos(uint16_t prefetch_count, engine::Deadline deadline) {
 }
 
 void AmqpChannel::SetupConsumer(const std::string& queue, ErrorCb error_cb,
-                                SuccessCb success_cb, MessageCb message_cb,
+                                SuccessCb success_cb,
+                                MessageCallbacks message_callbacks,
                                 engine::Deadline deadline) {
   auto channel = conn_.GetChannel(deadline);
 
   channel->onError(error_cb);
+  // No onMessage callback, otherwise AMQP-CPP would assemble every message in
+  // a buffer of its own
   channel->consume(queue)
       .onSuccess(success_cb)
-      .onMessage(message_cb)
+      .onSize(std::move(message_callbacks.on_size))
+      .onHeaders(std::move(message_callbacks.on_headers))
+      .onData(std::move(message_callbacks.on_data))
+      .onDelivered(std::move(message_callbacks.on_delivered))
       .onError(error_cb);
 }
 
@@ -229,6 +247,10 @@ void AmqpChannel::AccountMessageConsumed() {
   conn_.GetStatistics().AccountMessageConsumed();
 }
 
+statistics::ConnectionStatistics& AmqpChannel::GetStatistics() {
+  return conn_.GetStatistics();
+}
+
 AmqpReliableChannel::AmqpReliableChannel(AmqpConnection& conn) : conn_{conn} {}
 
 AmqpReliableChannel::~AmqpReliableChannel() = default;
@@ -246,20 +268,86 @@ ResponseAwaiter AmqpReliableChannel::Publish(const Exchange& exchange,
 
   {
     auto reliable = conn_.GetReliableChannel(deadline);
-
-    reliable->publish(exchange.GetUnderlying(), routing_key, envelope)
-        .onAck([this, deferred = awaiter.GetWrapper()] {
-          AccountMessagePublished();
-          deferred->Ok();
-        })
-        .onError([deferred = awaiter.GetWrapper()](const char* error) {
-          deferred->Fail(error);
-        });
+    DoPublish(*reliable, exchange, routing_key, envelope, awaiter);
   }
 
   return awaiter;
 }
 
+void AmqpReliableChannel::PublishBatch(const Exchange& exchange,
+                                       const std::string& routing_key,
+                                       const std::vector<std::string>& messages,
+                                       MessageType type,
+                                       engine::Deadline deadline) {
+  const auto headers = CreateHeaders();
+
+  std::deque<ResponseAwaiter> in_flight;
+  std::size_t published = 0;
+  try {
+    while (published < messages.size()) {
+      std::optional<ResponseAwaiter> reserved;
+      if (in_flight.empty()) {
+        // Waits for the window to be released by other publishers of the
+        // connection
+        reserved.emplace(conn_.GetAwaiter(deadline));
+      }
+
+      {
+        auto reliable = conn_.GetReliableChannel(deadline);
+        conn_.StartWriteBatch();
+        const utils::FastScopeGuard flush{
+            [this]() noexcept { conn_.FlushWriteBatch(); }};
+
+        while (published < messages.size()) {
+          auto awaiter = reserved ? std::exchange(reserved, std::nullopt)
+                                  : conn_.TryGetAwaiter();
+          if (!awaiter) break;
+
+          const auto& message = messages[published++];
+          AMQP::Envelope envelope{message.data(), message.size()};
+          envelope.setPersistent(type == MessageType::kPersistent);
+          envelope.setHeaders(headers);
+
+          DoPublish(*reliable, exchange, routing_key, envelope, *awaiter);
+          in_flight.push_back(std::move(*awaiter));
+        }
+      }
+
+      if (published < messages.size()) {
+        // The window is full, the oldest message is the first to be confirmed
+        WaitOldest(in_flight, deadline);
+      }
+    }
+
+    while (!in_flight.empty()) WaitOldest(in_flight, deadline);
+  } catch (const std::exception&) {
+    // Keeps the window taken until the messages already sent are either
+    // confirmed or failed
+    for (const auto& awaiter : in_flight) {
+      try {
+        awaiter.Wait(deadline);
+      } catch (const std::exception&) {
+      }
+    }
+    throw;
+  }
+}
+
+void AmqpReliableChannel::DoPublish(AMQP::Reliable<AMQP::Tagger>& reliable,
+                                    const Exchange& exchange,
+                                    const std::string& routing_key,
+                                    const AMQP::Envelope& envelope,
+                                    const ResponseAwaiter& awaiter) {
+  reliable.publish(exchange.GetUnderlying(), routing_key, envelope)
+      .onAck([this, deferred = awaiter.GetWrapper()] {
+        AccountMessagePublished();
+        deferred->Ok();
+      })
+      .onError([deferred = awaiter.GetWrapper()](const char* error) {
+        deferred->Fail(error);
+      });
+}
+
 void AmqpReliableChannel::AccountMessagePublished() {
   conn_.GetStatistics().AccountMessagePublished();
 }
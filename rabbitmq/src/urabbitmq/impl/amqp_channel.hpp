@@ -2,6 +2,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <userver/engine/deadline.hpp>
 #include <userver/utils/assert.hpp>
@@ -57,7 +59,7 @@ class AmqpChannel final {
                const std::string& message, MessageType type,
                engine::Deadline deadline);
 
-  void Ack(uint64_t delivery_tag, engine::Deadline deadline);
+  void Ack(uint64_t delivery_tag, bool multiple, engine::Deadline deadline);
 
   void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
@@ -65,15 +67,23 @@ class AmqpChannel final {
 
   using ErrorCb = std::function<void(const char*)>;
   using SuccessCb = std::function<void(const std::string&)>;
-  using MessageCb = std::function<void(const AMQP::Message&, uint64_t, bool)>;
+  // A message is handed out in parts as its frames arrive, so that its body
+  // is assembled right in the consumer buffer instead of an AMQP-CPP one
+  struct MessageCallbacks final {
+    std::function<void(uint64_t size)> on_size;
+    std::function<void(const AMQP::MetaData&)> on_headers;
+    std::function<void(const char* data, size_t size)> on_data;
+    std::function<void(uint64_t delivery_tag, bool redelivered)> on_delivered;
+  };
   void SetupConsumer(const std::string& queue, ErrorCb error_cb,
-                     SuccessCb success_cb, MessageCb message_cb,
+                     SuccessCb success_cb, MessageCallbacks message_callbacks,
                      engine::Deadline deadline);
 
   void CancelConsumer(const std::optional<std::string>& consumer_tag);
 
  private:
   void AccountMessageConsumed();
+  statistics::ConnectionStatistics& GetStatistics();
 
   friend class urabbitmq::ConsumerBaseImpl;
 
@@ -90,7 +100,19 @@ class AmqpReliableChannel final {
                           const std::string& message, MessageType type,
                           engine::Deadline deadline);
 
+  // Keeps up to max_in_flight_requests of the connection unconfirmed at a
+  // time, the frames of the messages published together are sent in a
+  // single write. Throws on the first message that is not confirmed.
+  void PublishBatch(const Exchange& exchange, const std::string& routing_key,
+                    const std::vector<std::string>& messages, MessageType type,
+                    engine::Deadline deadline);
+
  private:
+  void DoPublish(AMQP::Reliable<AMQP::Tagger>& reliable,
+                 const Exchange& exchange, const std::string& routing_key,
+                 const AMQP::Envelope& envelope,
+                 const ResponseAwaiter& awaiter);
+
   void AccountMessagePublished();
 
   AmqpConnection& conn_;
@@ -2,6 +2,7 @@
 
 #include <urabbitmq/impl/amqp_connection_handler.hpp>
 #include <urabbitmq/impl/deferred_wrapper.hpp>
+#include <urabbitmq/statistics/connection_statistics.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -28,6 +29,9 @@ ConnectionLock::ConnectionLock(engine::Mutex& mutex, engine::Deadline deadline)
   }
 }
 
+ConnectionLock::ConnectionLock(engine::Mutex& mutex, std::adopt_lock_t) noexcept
+    : mutex_{mutex}, owns_{true} {}
+
 ConnectionLock::~ConnectionLock() {
   if (owns_) {
     mutex_.unlock();
@@ -85,7 +89,11 @@ AmqpConnection::GetReliableChannel(engine::Deadline deadline) {
 }
 
 ResponseAwaiter AmqpConnection::GetAwaiter(engine::Deadline deadline) {
-  engine::SemaphoreLock lock{waiters_sema_, deadline};
+  engine::SemaphoreLock lock{waiters_sema_, std::try_to_lock};
+  if (!lock.OwnsLock()) {
+    GetStatistics().AccountInFlightLimitWait();
+    lock = engine::SemaphoreLock{waiters_sema_, deadline};
+  }
   if (!lock.OwnsLock()) {
     throw std::runtime_error{
         "Failed to acquire a connection within specified deadline"};
@@ -94,7 +102,21 @@ ResponseAwaiter AmqpConnection::GetAwaiter(engine::Deadline deadline) {
   return ResponseAwaiter{std::move(lock)};
 }
 
+std::optional<ResponseAwaiter> AmqpConnection::TryGetAwaiter() {
+  engine::SemaphoreLock lock{waiters_sema_, std::try_to_lock};
+  if (!lock.OwnsLock()) return std::nullopt;
+
+  return ResponseAwaiter{std::move(lock)};
+}
+
+void AmqpConnection::StartWriteBatch() { handler_.StartWriteBatch(); }
+
+void AmqpConnection::FlushWriteBatch() { handler_.FlushWriteBatch(&conn_); }
+
 ConnectionLock AmqpConnection::Lock(engine::Deadline deadline) {
+  if (mutex_.try_lock()) return {mutex_, std::adopt_lock};
+
+  GetStatistics().AccountConnectionLockWait();
   return {mutex_, deadline};
 }
 
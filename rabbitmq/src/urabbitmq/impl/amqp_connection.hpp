@@ -1,5 +1,8 @@
 #pragma once
 
+#include <mutex>
+#include <optional>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/engine/semaphore.hpp>
@@ -20,6 +23,7 @@ namespace urabbitmq::impl {
 class ConnectionLock final {
  public:
   ConnectionLock(engine::Mutex& mutex, engine::Deadline deadline);
+  ConnectionLock(engine::Mutex& mutex, std::adopt_lock_t) noexcept;
   ~ConnectionLock();
 
   ConnectionLock(const ConnectionLock& other) = delete;
@@ -41,6 +45,7 @@ class LockedChannelProxy final {
   LockedChannelProxy(LockedChannelProxy&& other) = delete;
 
   Channel* operator->() { return &channel_; }
+  Channel& operator*() { return channel_; }
 
  private:
   Channel& channel_;
@@ -66,6 +71,12 @@ class AmqpConnection final {
       engine::Deadline deadline);
 
   ResponseAwaiter GetAwaiter(engine::Deadline deadline);
+  std::optional<ResponseAwaiter> TryGetAwaiter();
+
+  // Must be called under the connection lock, see
+  // AmqpConnectionHandler::StartWriteBatch
+  void StartWriteBatch();
+  void FlushWriteBatch();
 
  private:
   friend class AmqpConnectionLocker;
@@ -92,6 +92,29 @@ void AmqpConnectionHandler::onData(AMQP::Connection* connection,
     return;
   }
 
+  if (write_batching_) {
+    write_batch_.append(buffer, size);
+    return;
+  }
+
+  Write(connection, buffer, size);
+}
+
+void AmqpConnectionHandler::StartWriteBatch() {
+  UASSERT(!write_batching_);
+  write_batching_ = true;
+}
+
+void AmqpConnectionHandler::FlushWriteBatch(AMQP::Connection* connection) {
+  write_batching_ = false;
+  if (!write_batch_.empty() && !IsBroken()) {
+    Write(connection, write_batch_.data(), write_batch_.size());
+  }
+  write_batch_.clear();
+}
+
+void AmqpConnectionHandler::Write(AMQP::Connection* connection,
+                                  const char* buffer, size_t size) {
   try {
     const auto sent = socket_->WriteAll(buffer, size, operation_deadline_);
     if (sent != size) {
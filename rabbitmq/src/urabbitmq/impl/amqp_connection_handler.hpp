@@ -69,6 +69,11 @@ class AmqpConnectionHandler final : public AMQP::ConnectionHandler {
 
   void SetOperationDeadline(engine::Deadline deadline);
 
+  // Frames sent between these calls are buffered and written to the socket
+  // at once. Must be called under the connection lock.
+  void StartWriteBatch();
+  void FlushWriteBatch(AMQP::Connection* connection);
+
   void AccountRead(size_t size);
   void AccountWrite(size_t size);
 
@@ -77,6 +82,8 @@ class AmqpConnectionHandler final : public AMQP::ConnectionHandler {
   const AMQP::Address& GetAddress() const;
 
  private:
+  void Write(AMQP::Connection* connection, const char* buffer, size_t size);
+
   AMQP::Address address_;
   std::unique_ptr<engine::io::RwBase> socket_;
   io::SocketReader reader_;
@@ -88,6 +95,9 @@ class AmqpConnectionHandler final : public AMQP::ConnectionHandler {
 
   engine::Deadline operation_deadline_ = engine::Deadline::Passed();
 
+  bool write_batching_{false};
+  std::string write_batch_;
+
   std::atomic<bool> is_ready_{false};
   std::optional<std::string> error_;
 };
@@ -32,25 +32,25 @@ void SocketReader::Start(AmqpConnection* connection) {
 
 void SocketReader::Stop() { reader_task_.SyncCancel(); }
 
-SocketReader::Buffer::Buffer() { data_.resize(kTmpBufferSize); }
+SocketReader::Buffer::Buffer() { data_.resize(kReadSize); }
 
 bool SocketReader::Buffer::Read(engine::io::RwBase& socket,
                                 AmqpConnection* conn,
                                 AmqpConnectionHandler& parent) {
   try {
     bool is_readable = true;
-    if (last_bytes_read_ != kTmpBufferSize) {
+    if (last_bytes_read_ != kReadSize) {
       is_readable = socket.WaitReadable({});
     }
 
+    if (data_.size() < size_ + kReadSize) {
+      data_.resize(size_ + kReadSize);
+    }
     last_bytes_read_ =
-        is_readable ? socket.ReadSome(&tmp_buffer_[0], kTmpBufferSize, {}) : 0;
+        is_readable ? socket.ReadSome(data_.data() + size_, kReadSize, {}) : 0;
     if (last_bytes_read_ == 0) {
       throw std::runtime_error{"Connection is closed by remote"};
     }
-
-    data_.resize(size_ + last_bytes_read_);
-    std::memcpy(data_.data() + size_, &tmp_buffer_[0], last_bytes_read_);
     size_ += last_bytes_read_;
 
     const auto parsed = [this, conn] {
@@ -37,9 +37,9 @@ class SocketReader final {
               AmqpConnectionHandler& parent);
 
    private:
-    static constexpr size_t kTmpBufferSize = 1 << 15;
-    char tmp_buffer_[kTmpBufferSize]{};
+    static constexpr size_t kReadSize = 1 << 15;
 
+    // The socket is read right into the unparsed data
     std::vector<char> data_{};
     size_t size_{0};
 
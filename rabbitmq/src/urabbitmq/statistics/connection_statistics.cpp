@@ -26,6 +26,26 @@ void ConnectionStatistics::AccountMessagePublished() { ++messages_published_; }
 
 void ConnectionStatistics::AccountMessageConsumed() { ++messages_consumed_; }
 
+void ConnectionStatistics::AccountMessageDispatched() { ++messages_in_flight_; }
+
+void ConnectionStatistics::AccountMessagesSettled(size_t count) {
+  messages_in_flight_ -= count;
+}
+
+void ConnectionStatistics::AccountAcks(
+    size_t acks_sent, std::chrono::milliseconds total_latency) {
+  acks_sent_ += acks_sent;
+  ack_latency_ms_ += total_latency.count();
+}
+
+void ConnectionStatistics::AccountInFlightLimitWait() {
+  ++in_flight_limit_waits_;
+}
+
+void ConnectionStatistics::AccountConnectionLockWait() {
+  ++connection_lock_waits_;
+}
+
 ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
   Frozen result{};
   result.connections_created = connections_created_.Load();
@@ -34,6 +54,11 @@ ConnectionStatistics::Frozen ConnectionStatistics::Get() const {
   result.bytes_read = bytes_read_.Load();
   result.messages_published = messages_published_.Load();
   result.messages_consumed = messages_consumed_.Load();
+  result.messages_in_flight = messages_in_flight_.Load();
+  result.acks_sent = acks_sent_.Load();
+  result.ack_latency_ms = ack_latency_ms_.Load();
+  result.in_flight_limit_waits = in_flight_limit_waits_.Load();
+  result.connection_lock_waits = connection_lock_waits_.Load();
 
   return result;
 }
@@ -46,6 +71,11 @@ ConnectionStatistics::Frozen& ConnectionStatistics::Frozen::operator+=(
   bytes_read += other.bytes_read;
   messages_published += other.messages_published;
   messages_consumed += other.messages_consumed;
+  messages_in_flight += other.messages_in_flight;
+  acks_sent += other.acks_sent;
+  ack_latency_ms += other.ack_latency_ms;
+  in_flight_limit_waits += other.in_flight_limit_waits;
+  connection_lock_waits += other.connection_lock_waits;
 
   return *this;
 }
@@ -58,6 +88,11 @@ void DumpMetric(utils::statistics::Writer& writer,
   writer["bytes_read"] = value.bytes_read;
   writer["messages_published"] = value.messages_published;
   writer["messages_consumed"] = value.messages_consumed;
+  writer["messages_in_flight"] = value.messages_in_flight;
+  writer["acks_sent"] = value.acks_sent;
+  writer["ack_latency_ms"] = value.ack_latency_ms;
+  writer["in_flight_limit_waits"] = value.in_flight_limit_waits;
+  writer["connection_lock_waits"] = value.connection_lock_waits;
 }
 
 }  // namespace urabbitmq::statistics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 
 #include <userver/utils/statistics/relaxed_counter.hpp>
@@ -20,6 +21,13 @@ class ConnectionStatistics final {
   void AccountMessagePublished();
   void AccountMessageConsumed();
 
+  void AccountMessageDispatched();
+  void AccountMessagesSettled(size_t count);
+  void AccountInFlightLimitWait();
+  void AccountConnectionLockWait();
+
+  void AccountAcks(size_t acks_sent, std::chrono::milliseconds total_latency);
+
   struct Frozen final {
     Frozen& operator+=(const Frozen& other);
 
@@ -31,6 +39,13 @@ class ConnectionStatistics final {
 
     size_t messages_published{0};
     size_t messages_consumed{0};
+
+    size_t messages_in_flight{0};
+    size_t acks_sent{0};
+    size_t ack_latency_ms{0};
+
+    size_t in_flight_limit_waits{0};
+    size_t connection_lock_waits{0};
   };
   Frozen Get() const;
 
@@ -43,6 +58,13 @@ class ConnectionStatistics final {
 
   utils::statistics::RelaxedCounter<size_t> messages_published_{0};
   utils::statistics::RelaxedCounter<size_t> messages_consumed_{0};
+
+  utils::statistics::RelaxedCounter<size_t> messages_in_flight_{0};
+  utils::statistics::RelaxedCounter<size_t> acks_sent_{0};
+  utils::statistics::RelaxedCounter<size_t> ack_latency_ms_{0};
+
+  utils::statistics::RelaxedCounter<size_t> in_flight_limit_waits_{0};
+  utils::statistics::RelaxedCounter<size_t> connection_lock_waits_{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer,
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <deque>
 #include <string>
 
@@ -41,31 +42,50 @@ struct Set {
   }
 };
 
+constexpr std::chrono::microseconds kBufferingInterval{100};
+
+template <typename RequestGenerator>
+void RunPipelineGrind(benchmark::State& state,
+                      const RequestGenerator& request_generator,
+                      const SentinelPtr& sentinel) {
+  std::deque<typename RequestGenerator::RequestType> requests;
+
+  for (auto i = 0; i < state.range(0); ++i) {
+    requests.push_back(request_generator(state));
+  }
+
+  for (auto _ : state) {
+    requests.front().Get();
+    requests.pop_front();
+    requests.push_back(request_generator(state));
+  }
+
+  for (; !requests.empty(); requests.pop_front()) requests.front().Get();
+
+  const auto stats = sentinel->GetStatistics({});
+  const auto total = stats.GetShardGroupTotalStatistics();
+  const auto& timings = total.timings_percentile;
+  for (auto p : {95, 99, 100}) {
+    state.counters["p" + std::to_string(p)] = timings.GetPercentile(p);
+  }
+}
+
 }  // namespace
 
 BENCHMARK_DEFINE_TEMPLATE_F(Redis, PipelineGrind)(benchmark::State& state) {
   RunStandalone([this, &state] {
-    auto request_generator = T{GetClient(), {}};
-    std::deque<typename T::RequestType> requests;
-
-    for (auto i = 0; i < state.range(0); ++i) {
-      requests.push_back(request_generator(state));
-    }
-
-    for (auto _ : state) {
-      requests.front().Get();
-      requests.pop_front();
-      requests.push_back(request_generator(state));
-    }
-
-    for (; !requests.empty(); requests.pop_front()) requests.front().Get();
-
-    const auto stats = GetSentinel()->GetStatistics({});
-    const auto total = stats.GetShardGroupTotalStatistics();
-    const auto& timings = total.timings_percentile;
-    for (auto p : {95, 99, 100}) {
-      state.counters["p" + std::to_string(p)] = timings.GetPercentile(p);
-    }
+    RunPipelineGrind(state, T{GetClient(), {}}, GetSentinel());
+  });
+}
+
+// The waiting commands are written to the connection together once the whole
+// pipeline is waiting or after kBufferingInterval
+BENCHMARK_DEFINE_TEMPLATE_F(Redis, BufferedPipelineGrind)
+(benchmark::State& state) {
+  RunStandalone([this, &state] {
+    GetSentinel()->SetCommandsBufferingSettings(
+        {true, static_cast<std::size_t>(state.range(0)), kBufferingInterval});
+    RunPipelineGrind(state, T{GetClient(), {}}, GetSentinel());
   });
 }
 
@@ -77,6 +97,14 @@ BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, PipelineGrind, Set)
     ->Args({16, 1024})
     ->Args({32, 1024});
 
+BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, BufferedPipelineGrind, Ping)
+    ->RangeMultiplier(2)
+    ->Range(4, 32);
+
+BENCHMARK_INSTANTIATE_TEMPLATE_F(Redis, BufferedPipelineGrind, Set)
+    ->Args({16, 1024})
+    ->Args({32, 1024});
+
 }  // namespace storages::redis::bench
 
 USERVER_NAMESPACE_END
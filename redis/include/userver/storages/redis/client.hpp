@@ -241,9 +241,15 @@ class Client {
   virtual RequestLtrim Ltrim(std::string key, int64_t start, int64_t stop,
                              const CommandControl& command_control) = 0;
 
+  /// The keys of different shards (hash slots in the cluster mode) are
+  /// requested from them concurrently, the values are returned in the order
+  /// of the keys
   virtual RequestMget Mget(std::vector<std::string> keys,
                            const CommandControl& command_control) = 0;
 
+  /// The keys of different shards (hash slots in the cluster mode) are set
+  /// by separate concurrent commands. Only the keys of one shard (hash slot)
+  /// are set atomically.
   virtual RequestMset Mset(
       std::vector<std::pair<std::string, std::string>> key_values,
       const CommandControl& command_control) = 0;
@@ -360,6 +366,31 @@ class Client {
   virtual RequestType Type(std::string key,
                            const CommandControl& command_control) = 0;
 
+  virtual RequestXack Xack(std::string key, std::string group,
+                           std::vector<std::string> ids,
+                           const CommandControl& command_control) = 0;
+
+  virtual RequestXadd Xadd(
+      std::string key, std::vector<std::pair<std::string, std::string>> fields,
+      const XaddOptions& options, const CommandControl& command_control) = 0;
+
+  virtual RequestXautoclaim Xautoclaim(
+      std::string key, std::string group, std::string consumer,
+      std::chrono::milliseconds min_idle_time, std::string start,
+      const XautoclaimOptions& options,
+      const CommandControl& command_control) = 0;
+
+  /// Creates the consumer group and the stream if it does not exist yet
+  virtual RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) = 0;
+
+  /// Reads a single stream, see XreadgroupOptions::block before blocking
+  virtual RequestXreadgroup Xreadgroup(
+      std::string key, std::string group, std::string consumer,
+      const XreadgroupOptions& options,
+      const CommandControl& command_control) = 0;
+
   virtual RequestZadd Zadd(std::string key, double score, std::string member,
                            const CommandControl& command_control) = 0;
 
@@ -83,6 +83,12 @@ struct CommandControl {
 
     /// Send requests to 'best_dc_count' Redis instances with the min ping
     kNearestServerPing,
+
+    /// Send read requests to 'best_dc_count' Redis instances with the min
+    /// expected latency: the smoothed latency of the recent commands scaled by
+    /// the commands in flight. Unlike the ping, it rises for a replica that
+    /// stalls on fork or slow commands.
+    kNearestServerLatency,
   };
 
   /// Timeout for a single attempt to execute command
@@ -124,6 +130,11 @@ struct CommandControl {
   /// ignored.
   std::optional<ServerId> force_server_id;
 
+  /// If set to false, the command and the commands waiting for the
+  /// buffering window of the connection are sent without waiting for the
+  /// rest of the window, see @ref REDIS_COMMANDS_BUFFERING_SETTINGS
+  std::optional<bool> allow_commands_buffering;
+
   /// If set, command retries are directed to the master instance
   bool force_retries_to_master_on_nil_reply{false};
 
@@ -23,6 +23,9 @@ using GeoaddArg = USERVER_NAMESPACE::redis::GeoaddArg;
 using GeoradiusOptions = USERVER_NAMESPACE::redis::GeoradiusOptions;
 using GeosearchOptions = USERVER_NAMESPACE::redis::GeosearchOptions;
 using ZaddOptions = USERVER_NAMESPACE::redis::ZaddOptions;
+using XaddOptions = USERVER_NAMESPACE::redis::XaddOptions;
+using XreadgroupOptions = USERVER_NAMESPACE::redis::XreadgroupOptions;
+using XautoclaimOptions = USERVER_NAMESPACE::redis::XautoclaimOptions;
 
 class ScanOptionsBase {
  public:
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <vector>
@@ -92,6 +93,28 @@ struct RangeScoreOptions {
   RangeOptions range_options;
 };
 
+struct XaddOptions {
+  /// ID of the new entry, generated by the server by default
+  std::string id = "*";
+  /// Trims the stream to about this number of entries
+  std::optional<size_t> maxlen;
+};
+
+struct XreadgroupOptions {
+  /// `>` reads the new entries, an ID reads the pending entries of the
+  /// consumer after the ID
+  std::string id = ">";
+  std::optional<size_t> count;
+  /// Waits for the new entries up to the time. The connection to the
+  /// instance is blocked meanwhile, including the other commands sent over it.
+  std::optional<std::chrono::milliseconds> block;
+  bool noack = false;
+};
+
+struct XautoclaimOptions {
+  std::optional<size_t> count;
+};
+
 void PutArg(CmdArgs::CmdArgsArray& args_, GeoaddArg arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, std::vector<GeoaddArg> arg);
@@ -112,6 +135,12 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const RangeOptions& arg);
 
 void PutArg(CmdArgs::CmdArgsArray& args_, const RangeScoreOptions& arg);
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XaddOptions& arg);
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg);
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XautoclaimOptions& arg);
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
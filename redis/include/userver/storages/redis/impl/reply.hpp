@@ -11,6 +11,7 @@
 #include <userver/storages/redis/impl/reply_status.hpp>
 
 struct redisReply;
+struct redisReplyObjectFunctions;
 
 USERVER_NAMESPACE_BEGIN
 
@@ -128,6 +129,16 @@ class ReplyData final {
   static ReplyData CreateStatus(std::string&& status_msg);
   static ReplyData CreateNil();
 
+  /// @brief hiredis reader functions that build the ReplyData right from the
+  /// read buffer, without the intermediate tree of redisReply objects.
+  ///
+  /// Only the type and the error message of the root redisReply are filled,
+  /// so the functions may not be used on the connections that subscribe.
+  static redisReplyObjectFunctions& ReaderFunctions();
+
+  /// Moves the data out of a reply built with ReaderFunctions()
+  static ReplyData ExtractFromReader(redisReply* reply);
+
   explicit operator bool() const { return type_ != Type::kNoReply; }
 
   Type GetType() const { return type_; }
@@ -225,6 +236,8 @@ class ReplyData final {
   void ExpectError(const std::string& request_description = {}) const;
 
  private:
+  friend struct ReplyDataReader;
+
   ReplyData() = default;
 
   [[noreturn]] void ThrowUnexpectedReplyType(
@@ -243,6 +256,8 @@ class Reply final {
   Reply(std::string cmd, redisReply* redis_reply, ReplyStatus status,
         std::string status_string);
   Reply(std::string cmd, ReplyData&& data);
+  Reply(std::string cmd, ReplyData&& data, ReplyStatus status,
+        std::string status_string);
 
   std::string server;
   ServerId server_id;
@@ -0,0 +1,114 @@
+#pragma once
+
+/// @file userver/storages/redis/near_cache.hpp
+/// @brief @copybrief storages::redis::NearCache
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/nway_lru_cache.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_options.hpp>
+#include <userver/storages/redis/subscription_token.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+class Writer;
+}  // namespace utils::statistics
+
+namespace storages::redis {
+
+/// @brief In-process cache of the Get and Hget replies for the read-mostly
+/// keys, invalidated by the keyspace notifications of the Redis servers.
+///
+/// Only the keys starting with one of Settings::prefixes are cached, the
+/// rest of the keys are read from Redis as usual. A change of a cached key
+/// drops all its cached replies as soon as the notification arrives.
+///
+/// The servers should publish the keyspace notifications of all the
+/// changes, e.g. with `notify-keyspace-events KA`. The notifications are
+/// not guaranteed to be delivered while the subscription is being
+/// restored, so the entries are also dropped after Settings::max_lifetime.
+///
+/// The replies read while a notification arrives are not stored, so a
+/// stale value may only be served from a lost notification.
+///
+/// @snippet storages/redis/near_cache_test.cpp NearCache
+class NearCache final {
+ public:
+  struct Settings {
+    /// Prefixes of the cached keys
+    std::vector<std::string> prefixes;
+
+    /// The number of ways and the maximum number of keys per way,
+    /// see cache::NWayLRU
+    std::size_t ways{16};
+    std::size_t way_size{1024};
+
+    /// Maximum time the replies are served without reading the key
+    std::chrono::milliseconds max_lifetime{std::chrono::seconds{10}};
+  };
+
+  NearCache(ClientPtr client, SubscribeClientPtr subscribe_client,
+            Settings settings);
+  ~NearCache();
+
+  NearCache(const NearCache&) = delete;
+  NearCache& operator=(const NearCache&) = delete;
+
+  /// Returns the value of the key, reads the key from Redis on a cache miss
+  std::optional<std::string> Get(std::string key,
+                                 const CommandControl& command_control);
+
+  /// Returns the value of the hash field, reads the field from Redis on a
+  /// cache miss
+  std::optional<std::string> Hget(std::string key, std::string field,
+                                  const CommandControl& command_control);
+
+  /// Drops all the cached replies
+  void Invalidate();
+
+  /// Writes the hits, the misses and the invalidations of the cache
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const NearCache& cache);
+
+ private:
+  struct Entry final {
+    // The reply of GET, if it was read
+    std::optional<std::optional<std::string>> value;
+    // The replies of HGET by the field
+    std::unordered_map<std::string, std::optional<std::string>> fields;
+    std::chrono::steady_clock::time_point expiration;
+  };
+
+  bool IsCached(const std::string& key) const;
+  Entry GetEntry(const std::string& key);
+  void Store(const std::string& key, Entry&& entry, std::uint64_t epoch);
+  void OnKeyspaceEvent(const std::string& channel);
+
+  const ClientPtr client_;
+  const Settings settings_;
+  cache::NWayLRU<std::string, Entry> cache_;
+  // Incremented on each invalidation, a reply is dropped if the epoch has
+  // changed while it was being read
+  std::atomic<std::uint64_t> epoch_{0};
+
+  utils::statistics::RelaxedCounter<std::size_t> hits_;
+  utils::statistics::RelaxedCounter<std::size_t> misses_;
+  utils::statistics::RelaxedCounter<std::size_t> invalidations_;
+
+  // Must be destroyed first, the callbacks use the cache
+  std::vector<SubscriptionToken> subscriptions_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -71,6 +71,10 @@ std::vector<GeoPoint> ParseReplyDataArray(
     ReplyData&& array_data, const std::string& request_description,
     To<std::vector<GeoPoint>>);
 
+std::vector<StreamEntry> ParseReplyDataArray(
+    ReplyData&& array_data, const std::string& request_description,
+    To<std::vector<StreamEntry>>);
+
 std::string Parse(ReplyData&& reply_data,
                   const std::string& request_description, To<std::string>);
 
@@ -111,6 +115,14 @@ void Parse(ReplyData&& reply_data, const std::string& request_description,
 SetReply Parse(ReplyData&& reply_data, const std::string& request_description,
                To<SetReply>);
 
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>);
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>);
+
 std::unordered_set<std::string> Parse(ReplyData&& reply_data,
                                       const std::string& request_description,
                                       To<std::unordered_set<std::string>>);
@@ -0,0 +1,124 @@
+#pragma once
+
+/// @file userver/storages/redis/read_coalescer.hpp
+/// @brief @copybrief storages::redis::ReadCoalescer
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/engine/condition_variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_options.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+class Writer;
+}  // namespace utils::statistics
+
+namespace storages::redis {
+
+/// @brief Reads keys through a client, finding the hot keys and merging
+/// concurrent identical reads.
+///
+/// Every Settings::sample_rate-th read is accounted in a Space-Saving sketch
+/// of Settings::sketch_size keys, its counters are halved every
+/// Settings::decay_interval. The Settings::hot_keys_count keys read the most
+/// are written to the metrics with their estimated rate.
+///
+/// With Settings::coalesce a read of a key that is already being read by
+/// another task waits for that reply instead of sending one more command, so
+/// a hot key costs a single in-flight command per host. If the first read
+/// fails, the tasks that waited for it send their own commands.
+///
+/// @snippet storages/redis/read_coalescer_test.cpp ReadCoalescer
+class ReadCoalescer final {
+ public:
+  struct Settings {
+    /// Merge the concurrent reads of the same key
+    bool coalesce{true};
+
+    /// One of that many reads is accounted, 1 accounts all of them
+    std::size_t sample_rate{8};
+    /// Maximum number of the keys tracked
+    std::size_t sketch_size{64};
+    /// Number of the keys written to the metrics
+    std::size_t hot_keys_count{8};
+    std::chrono::milliseconds decay_interval{std::chrono::seconds{10}};
+  };
+
+  /// Key and its estimated reads per second
+  using HotKey = std::pair<std::string, double>;
+
+  ReadCoalescer(ClientPtr client, Settings settings);
+  ~ReadCoalescer();
+
+  ReadCoalescer(const ReadCoalescer&) = delete;
+  ReadCoalescer& operator=(const ReadCoalescer&) = delete;
+
+  std::optional<std::string> Get(std::string key,
+                                 const CommandControl& command_control);
+
+  std::optional<std::string> Hget(std::string key, std::string field,
+                                  const CommandControl& command_control);
+
+  std::unordered_map<std::string, std::string> Hgetall(
+      std::string key, const CommandControl& command_control);
+
+  /// Returns the Settings::hot_keys_count keys read the most, the most read
+  /// first
+  std::vector<HotKey> GetHotKeys() const;
+
+  /// Writes the reads, the merged reads and the rates of the hot keys
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const ReadCoalescer& coalescer);
+
+ private:
+  // The reply of the read in flight, shared by all the tasks waiting for it
+  template <typename Reply>
+  struct Pending final {
+    engine::Mutex mutex;
+    engine::ConditionVariable cv;
+    bool done{false};
+    std::optional<Reply> reply;
+  };
+
+  template <typename Reply>
+  using InFlight =
+      std::unordered_map<std::string, std::shared_ptr<Pending<Reply>>>;
+
+  template <typename Reply, typename Read>
+  Reply Coalesce(InFlight<Reply>& in_flight, std::string id, const Read& read);
+
+  void Account(const std::string& key);
+
+  const ClientPtr client_;
+  const Settings settings_;
+
+  mutable std::mutex sketch_mutex_;
+  // Estimated reads of the keys, the counters are halved on each decay
+  std::unordered_map<std::string, double> counters_;
+  std::chrono::steady_clock::time_point next_decay_;
+
+  engine::Mutex in_flight_mutex_;
+  InFlight<std::optional<std::string>> gets_;
+  InFlight<std::optional<std::string>> hgets_;
+  InFlight<std::unordered_map<std::string, std::string>> hgetalls_;
+
+  utils::statistics::RelaxedCounter<std::size_t> reads_;
+  utils::statistics::RelaxedCounter<std::size_t> coalesced_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
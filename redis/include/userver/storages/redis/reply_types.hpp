@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -105,6 +106,40 @@ struct ScanReplyElem<ScanTag::kZscan> {
 
 enum class SetReply { kSet, kNotSet };
 
+/// An entry of a stream. The fields of the entries deleted from the stream
+/// while pending in a group are empty.
+struct StreamEntry final {
+  std::string id;
+  std::vector<std::pair<std::string, std::string>> fields;
+
+  StreamEntry() = default;
+  StreamEntry(std::string id,
+              std::vector<std::pair<std::string, std::string>> fields)
+      : id(std::move(id)), fields(std::move(fields)) {}
+
+  bool operator==(const StreamEntry& rhs) const {
+    return id == rhs.id && fields == rhs.fields;
+  }
+
+  bool operator!=(const StreamEntry& rhs) const { return !(*this == rhs); }
+};
+
+/// Reply of XREADGROUP with a single stream: the entries read, none if the
+/// read has timed out
+struct XreadgroupReply final {
+  static std::vector<StreamEntry> Parse(ReplyData&& reply_data,
+                                        const std::string& request_description);
+};
+
+struct XautoclaimReply final {
+  /// The ID to continue the claiming from, `0-0` once all the pending
+  /// entries are checked
+  std::string next_start_id;
+  std::vector<StreamEntry> entries;
+};
+
+enum class XgroupCreateReply { kCreated, kAlreadyExists };
+
 enum class StatusOk { kOk };
 
 enum class StatusPong { kPong };
@@ -0,0 +1,86 @@
+#pragma once
+
+/// @file userver/storages/redis/script_registry.hpp
+/// @brief @copybrief storages::redis::ScriptRegistry
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_control.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+/// @brief Lua scripts that are declared once and are evaluated with EVALSHA,
+/// so that each call sends the 40 bytes of SHA-1 instead of the script body.
+///
+/// The script cache of a Redis server is empty after a restart or a
+/// failover, so a script the server does not have is loaded to the shard
+/// and evaluated again, transparently for the caller.
+///
+/// @snippet storages/redis/script_registry_test.cpp ScriptRegistry
+class ScriptRegistry final {
+ public:
+  /// Bodies of the scripts by their names
+  using Scripts = std::unordered_map<std::string, std::string>;
+
+  /// Computes SHA-1 of the scripts, nothing is sent to Redis
+  ScriptRegistry(ClientPtr client, const Scripts& scripts);
+
+  ScriptRegistry(const ScriptRegistry&) = delete;
+  ScriptRegistry& operator=(const ScriptRegistry&) = delete;
+
+  /// Loads all the scripts to the masters of all the shards, e.g. at startup
+  void Preload(const CommandControl& command_control) const;
+
+  /// Returns SHA-1 of the script in hex
+  const std::string& GetSha(const std::string& name) const;
+
+  /// Evaluates the script, the script is selected by the name and the shard
+  /// is selected by the first key
+  template <typename ScriptResult, typename ReplyType = ScriptResult>
+  ReplyType Eval(const std::string& name, std::vector<std::string> keys,
+                 std::vector<std::string> args,
+                 const CommandControl& command_control) const {
+    const auto& script = GetScript(name);
+    auto result = client_
+                      ->EvalSha<ScriptResult, ReplyType>(script.sha, keys,
+                                                         args, command_control)
+                      .Get();
+    if (!result.IsNoScriptError()) return result.Extract();
+
+    Load(script, keys.at(0), command_control);
+    result = client_
+                 ->EvalSha<ScriptResult, ReplyType>(script.sha, keys, args,
+                                                    command_control)
+                 .Get();
+    if (!result.IsNoScriptError()) return result.Extract();
+
+    // The master has changed once again, EVAL loads the script as well
+    return client_
+        ->Eval<ScriptResult, ReplyType>(script.body, std::move(keys),
+                                        std::move(args), command_control)
+        .Get();
+  }
+
+ private:
+  struct Script final {
+    std::string body;
+    std::string sha;
+  };
+
+  const Script& GetScript(const std::string& name) const;
+  void Load(const Script& script, const std::string& key,
+            const CommandControl& command_control) const;
+
+  const ClientPtr client_;
+  std::unordered_map<std::string, Script> scripts_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
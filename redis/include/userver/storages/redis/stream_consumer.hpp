@@ -0,0 +1,119 @@
+#pragma once
+
+/// @file userver/storages/redis/stream_consumer.hpp
+/// @brief @copybrief storages::redis::StreamConsumer
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/storages/redis/client_fwd.hpp>
+#include <userver/storages/redis/command_options.hpp>
+#include <userver/storages/redis/reply_types.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::statistics {
+class Writer;
+}  // namespace utils::statistics
+
+namespace storages::redis {
+
+/// @brief Member of a consumer group of a Redis stream, that hands the
+/// entries to a handler and acknowledges them in batches.
+///
+/// The entries are read with XREADGROUP by up to Settings::batch_size and are
+/// handled concurrently by up to Settings::max_concurrency tasks. The entries
+/// handled without an exception are acknowledged with a single XACK per
+/// batch, the rest stay pending. The entries pending for longer than
+/// Settings::claim_min_idle_time, including the ones of the consumers that
+/// are gone, are claimed with XAUTOCLAIM and handled again, so the delivery
+/// is at-least-once.
+///
+/// The group is created at start if it does not exist yet.
+///
+/// @snippet storages/redis/stream_consumer_test.cpp StreamConsumer
+class StreamConsumer final {
+ public:
+  using Handler = std::function<void(const StreamEntry& entry)>;
+
+  struct Settings {
+    std::string stream;
+    std::string group;
+    /// Name of the consumer, unique within the group
+    std::string consumer;
+
+    /// ID the group starts from if it is created, `$` skips the existing
+    /// entries
+    std::string start_id{"$"};
+
+    /// Maximum number of the entries read and acknowledged at once
+    std::size_t batch_size{100};
+    /// Maximum number of the entries handled concurrently
+    std::size_t max_concurrency{8};
+
+    /// Waiting time of XREADGROUP for the new entries. A blocked read
+    /// delays the other commands sent to the same instance, so by default
+    /// the consumer sleeps for poll_interval between the empty reads
+    /// instead. The timeouts of command_control must exceed it.
+    std::chrono::milliseconds block{0};
+    std::chrono::milliseconds poll_interval{100};
+
+    /// Minimum idle time of the pending entries that are claimed, 0 turns
+    /// the claiming off
+    std::chrono::milliseconds claim_min_idle_time{std::chrono::minutes{1}};
+    std::chrono::milliseconds claim_interval{std::chrono::seconds{10}};
+
+    CommandControl command_control;
+  };
+
+  /// Starts consuming, the handler is called on the task_processor
+  StreamConsumer(ClientPtr client, Settings settings,
+                 engine::TaskProcessor& task_processor, Handler handler);
+
+  /// Stops consuming and waits for the handlers to finish
+  ~StreamConsumer();
+
+  StreamConsumer(const StreamConsumer&) = delete;
+  StreamConsumer& operator=(const StreamConsumer&) = delete;
+
+  /// Writes the entries read, handled, failed, acknowledged and claimed,
+  /// and the lag of the last entry read
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const StreamConsumer& consumer);
+
+ private:
+  void Run();
+  void CreateGroup();
+  void Claim();
+  void Handle(std::vector<StreamEntry>&& entries);
+
+  const ClientPtr client_;
+  const Settings settings_;
+  engine::TaskProcessor& task_processor_;
+  const Handler handler_;
+
+  // Owned by the consuming task
+  std::string claim_start_id_{"0-0"};
+
+  utils::statistics::RelaxedCounter<std::size_t> read_;
+  utils::statistics::RelaxedCounter<std::size_t> handled_;
+  utils::statistics::RelaxedCounter<std::size_t> failed_;
+  utils::statistics::RelaxedCounter<std::size_t> acked_;
+  utils::statistics::RelaxedCounter<std::size_t> claimed_;
+  std::atomic<std::int64_t> lag_ms_{0};
+
+  // Must be the last member, the task uses all the above
+  engine::TaskWithResult<void> task_;
+};
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
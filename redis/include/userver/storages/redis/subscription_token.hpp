@@ -33,6 +33,8 @@ class SubscriptionTokenImplBase {
 
   virtual void SetMaxQueueLength(size_t length) = 0;
 
+  virtual size_t GetDroppedMessagesCount() const;
+
   virtual void Unsubscribe() = 0;
 };
 
@@ -65,8 +67,14 @@ class [[nodiscard]] SubscriptionToken final {
 
   /// There is a MPSC queue inside the connection. This parameter requlates
   /// its maximum length. If it overflows, new messages are discarded.
+  ///
+  /// Each subscription has its own queue, so a slow subscriber does not
+  /// delay the others. The queues share the payloads of the messages.
   void SetMaxQueueLength(size_t length);
 
+  /// Returns the number of the messages discarded due to the queue overflow
+  size_t GetDroppedMessagesCount() const;
+
   /// Unsubscribe from the channel. This method is synchronous, once it
   /// returned, no new calls to callback will be made.
   void Unsubscribe();
@@ -108,14 +108,20 @@ UTEST_F(RedisClusterClientTest, DISABLED_MgetCrossSlot) {
   auto shard = client->ShardByKey(MakeKey(idx[0]));
   while (client->ShardByKey(MakeKey(idx[1])) != shard) ++idx[1];
 
-  for (unsigned long i : idx) {
-    auto req = client->Set(MakeKey(i), std::to_string(add + i), kDefaultCc);
+  {
+    auto req = client->Mset({{MakeKey(idx[0]), std::to_string(add + idx[0])},
+                             {MakeKey(idx[1]), std::to_string(add + idx[1])}},
+                            kDefaultCc);
     UASSERT_NO_THROW(req.Get());
   }
 
   {
-    auto req = client->Mget({MakeKey(idx[0]), MakeKey(idx[1])}, kDefaultCc);
-    UASSERT_THROW(req.Get(), redis::ParseReplyException);
+    // The keys of different slots are requested separately
+    auto req = client->Mget({MakeKey(idx[1]), MakeKey(idx[0])}, kDefaultCc);
+    auto reply = req.Get();
+    ASSERT_EQ(reply.size(), 2);
+    EXPECT_EQ(reply[0], std::to_string(add + idx[1]));
+    EXPECT_EQ(reply[1], std::to_string(add + idx[0]));
   }
 
   for (unsigned long i : idx) {
@@ -1,5 +1,8 @@
 #include "client_impl.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include <userver/utils/assert.hpp>
 
 #include <storages/redis/impl/sentinel.hpp>
@@ -516,21 +519,50 @@ RequestMget ClientImpl::Mget(std::vector<std::string> keys,
   if (keys.empty())
     return CreateDummyRequest<RequestMget>(
         std::make_shared<Reply>("mget", ReplyData::Array{}));
-  const auto shard = ShardByKey(keys.at(0), command_control);
   auto max_chunk_size = CommandControlImpl{command_control}.chunk_size;
   if (max_chunk_size == 0) {
     max_chunk_size = keys.size();
   }
-  auto make_request = [this, shard,
-                       cc = GetCommandControl(command_control)](auto keys) {
+  auto make_request = [this, cc = GetCommandControl(command_control)](
+                          size_t shard, auto keys) {
     return MakeRequest(CmdArgs{"mget", std::move(keys)}, shard, false, cc);
   };
-  if (max_chunk_size >= keys.size()) {
-    return CreateRequest<RequestMget>(make_request(std::move(keys)));
+
+  const auto groups = GroupKeysBySlot(
+      keys.size(), [&keys](size_t i) -> const std::string& { return keys[i]; },
+      command_control);
+  if (groups.size() <= 1) {
+    const auto shard = ShardByKey(keys.at(0), command_control);
+    if (max_chunk_size >= keys.size()) {
+      return CreateRequest<RequestMget>(make_request(shard, std::move(keys)));
+    }
+    return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
+        max_chunk_size, std::move(keys), [&make_request, shard](auto keys) {
+          return make_request(shard, std::move(keys));
+        }));
   }
-  return CreateAggregateRequest<RequestMget>(MakeRequestChunks(
-      max_chunk_size, std::move(keys),
-      [&make_request](auto keys) { return make_request(std::move(keys)); }));
+
+  // The requests of all the groups are sent at once, the values are returned
+  // in the order of the keys
+  std::vector<USERVER_NAMESPACE::redis::Request> requests;
+  std::vector<std::vector<size_t>> positions;
+  for (const auto& group : groups) {
+    const auto shard = ShardByKey(keys[group.front()], command_control);
+    for (size_t begin = 0; begin < group.size(); begin += max_chunk_size) {
+      const auto end = std::min(group.size(), begin + max_chunk_size);
+      std::vector<size_t> chunk_positions(group.begin() + begin,
+                                          group.begin() + end);
+      std::vector<std::string> chunk;
+      chunk.reserve(chunk_positions.size());
+      for (const auto position : chunk_positions) {
+        chunk.push_back(std::move(keys[position]));
+      }
+      requests.push_back(make_request(shard, std::move(chunk)));
+      positions.push_back(std::move(chunk_positions));
+    }
+  }
+  return CreateAggregateRequest<RequestMget>(std::move(requests),
+                                             std::move(positions));
 }
 
 RequestMset ClientImpl::Mset(
@@ -540,10 +572,33 @@ RequestMset ClientImpl::Mset(
     return CreateDummyRequest<RequestMset>(
         std::make_shared<USERVER_NAMESPACE::redis::Reply>(
             "mset", USERVER_NAMESPACE::redis::ReplyData::CreateStatus("OK")));
-  auto shard = ShardByKey(key_values.at(0).first, command_control);
-  return CreateRequest<RequestMset>(
-      MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true,
-                  GetCommandControl(command_control)));
+  const auto groups = GroupKeysBySlot(
+      key_values.size(),
+      [&key_values](size_t i) -> const std::string& {
+        return key_values[i].first;
+      },
+      command_control);
+  if (groups.size() <= 1) {
+    auto shard = ShardByKey(key_values.at(0).first, command_control);
+    return CreateRequest<RequestMset>(
+        MakeRequest(CmdArgs{"mset", std::move(key_values)}, shard, true,
+                    GetCommandControl(command_control)));
+  }
+
+  const auto cc = GetCommandControl(command_control);
+  std::vector<USERVER_NAMESPACE::redis::Request> requests;
+  requests.reserve(groups.size());
+  for (const auto& group : groups) {
+    const auto shard = ShardByKey(key_values[group.front()].first, cc);
+    std::vector<std::pair<std::string, std::string>> group_key_values;
+    group_key_values.reserve(group.size());
+    for (const auto position : group) {
+      group_key_values.push_back(std::move(key_values[position]));
+    }
+    requests.push_back(MakeRequest(
+        CmdArgs{"mset", std::move(group_key_values)}, shard, true, cc));
+  }
+  return CreateAggregateRequest<RequestMset>(std::move(requests));
 }
 
 TransactionPtr ClientImpl::Multi() {
@@ -847,6 +902,58 @@ RequestType ClientImpl::Type(std::string key,
                   GetCommandControl(command_control)));
 }
 
+RequestXack ClientImpl::Xack(std::string key, std::string group,
+                             std::vector<std::string> ids,
+                             const CommandControl& command_control) {
+  if (ids.empty())
+    return CreateDummyRequest<RequestXack>(std::make_shared<Reply>("xack", 0));
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXack>(MakeRequest(
+      CmdArgs{"xack", std::move(key), std::move(group), std::move(ids)}, shard,
+      true, GetCommandControl(command_control)));
+}
+
+RequestXadd ClientImpl::Xadd(
+    std::string key, std::vector<std::pair<std::string, std::string>> fields,
+    const XaddOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXadd>(
+      MakeRequest(CmdArgs{"xadd", std::move(key), options, std::move(fields)},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXautoclaim ClientImpl::Xautoclaim(
+    std::string key, std::string group, std::string consumer,
+    std::chrono::milliseconds min_idle_time, std::string start,
+    const XautoclaimOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXautoclaim>(MakeRequest(
+      CmdArgs{"xautoclaim", std::move(key), std::move(group),
+              std::move(consumer), min_idle_time.count(), std::move(start),
+              options},
+      shard, true, GetCommandControl(command_control)));
+}
+
+RequestXgroupCreate ClientImpl::XgroupCreate(
+    std::string key, std::string group, std::string id,
+    const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXgroupCreate>(
+      MakeRequest(CmdArgs{"xgroup", "CREATE", std::move(key), std::move(group),
+                          std::move(id), "MKSTREAM"},
+                  shard, true, GetCommandControl(command_control)));
+}
+
+RequestXreadgroup ClientImpl::Xreadgroup(
+    std::string key, std::string group, std::string consumer,
+    const XreadgroupOptions& options, const CommandControl& command_control) {
+  auto shard = ShardByKey(key, command_control);
+  return CreateRequest<RequestXreadgroup>(MakeRequest(
+      CmdArgs{"xreadgroup", "GROUP", std::move(group), std::move(consumer),
+              options, "STREAMS", std::move(key), options.id},
+      shard, true, GetCommandControl(command_control)));
+}
+
 RequestZadd ClientImpl::Zadd(std::string key, double score, std::string member,
                              const CommandControl& command_control) {
   auto shard = ShardByKey(key, command_control);
@@ -1117,6 +1224,25 @@ size_t ClientImpl::GetPublishShard(
   return 0;
 }
 
+template <typename GetKey>
+std::vector<std::vector<size_t>> ClientImpl::GroupKeysBySlot(
+    size_t keys_count, const GetKey& get_key, const CommandControl& cc) const {
+  if (force_shard_idx_ || cc.force_shard_idx) return {};
+
+  const bool by_slot = redis_client_->IsInClusterMode();
+  std::unordered_map<size_t, size_t> group_indexes;
+  std::vector<std::vector<size_t>> groups;
+  for (size_t i = 0; i < keys_count; ++i) {
+    const auto& key = get_key(i);
+    const auto id = by_slot ? USERVER_NAMESPACE::redis::Sentinel::HashSlot(key)
+                            : ShardByKey(key);
+    const auto [it, inserted] = group_indexes.emplace(id, groups.size());
+    if (inserted) groups.emplace_back();
+    groups[it->second].push_back(i);
+  }
+  return groups;
+}
+
 size_t ClientImpl::ShardByKey(const std::string& key,
                               const CommandControl& cc) const {
   if (force_shard_idx_) {
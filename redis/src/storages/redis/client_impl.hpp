@@ -336,6 +336,31 @@ class ClientImpl final : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(std::string key,
+                   std::vector<std::pair<std::string, std::string>> fields,
+                   const XaddOptions& options,
+                   const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(std::string key, std::string group,
+                               std::string consumer,
+                               std::chrono::milliseconds min_idle_time,
+                               std::string start,
+                               const XautoclaimOptions& options,
+                               const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(std::string key, std::string group,
+                               std::string consumer,
+                               const XreadgroupOptions& options,
+                               const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
@@ -470,6 +495,12 @@ class ClientImpl final : public Client,
 
   size_t ShardByKey(const std::string& key, const CommandControl& cc) const;
 
+  // Groups the indexes of the keys that may be sent in one multi-key
+  // command: by the shard, and also by the hash slot in the cluster mode
+  template <typename GetKey>
+  std::vector<std::vector<size_t>> GroupKeysBySlot(
+      size_t keys_count, const GetKey& get_key, const CommandControl& cc) const;
+
   void CheckShard(size_t shard, const CommandControl& cc) const;
 
   std::shared_ptr<USERVER_NAMESPACE::redis::Sentinel> redis_client_;
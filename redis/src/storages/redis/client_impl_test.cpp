@@ -0,0 +1,103 @@
+#include <storages/redis/client_impl.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <userver/utest/utest.hpp>
+
+#include <storages/redis/impl/server_common_sentinel_test.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr size_t kShardCount = 3;
+
+std::string MakeValue(const std::string& key) { return "value-" + key; }
+
+/// Returns two keys for each shard
+std::vector<std::vector<std::string>> MakeShardKeys(
+    const storages::redis::Client& client) {
+  std::vector<std::vector<std::string>> shard_keys(kShardCount);
+  for (size_t i = 0;; ++i) {
+    auto key = "key" + std::to_string(i);
+    auto& keys = shard_keys.at(client.ShardByKey(key));
+    if (keys.size() < 2) keys.push_back(std::move(key));
+
+    bool is_done = true;
+    for (const auto& other_keys : shard_keys) {
+      is_done = is_done && other_keys.size() == 2;
+    }
+    if (is_done) return shard_keys;
+  }
+}
+
+/// The keys of the shards are interleaved
+std::vector<std::string> MakeInterleavedKeys(
+    const std::vector<std::vector<std::string>>& shard_keys) {
+  return {shard_keys[0][0], shard_keys[1][0], shard_keys[0][1],
+          shard_keys[2][0], shard_keys[1][1], shard_keys[2][1]};
+}
+
+}  // namespace
+
+UTEST(RedisClient, MgetOrderAcrossShards) {
+  SentinelShardTest sentinel_test(1, kShardCount);
+  auto client = std::make_shared<storages::redis::ClientImpl>(
+      sentinel_test.SentinelClientPtr());
+  const auto shard_keys = MakeShardKeys(*client);
+
+  for (size_t shard = 0; shard < kShardCount; ++shard) {
+    const auto& keys = shard_keys[shard];
+    for (auto* server :
+         {&sentinel_test.Master(shard), &sentinel_test.Slave(shard)}) {
+      server->RegisterHandlerWithConstReply(
+          "mget", keys,
+          redis::ReplyData::Array{MakeValue(keys[0]), MakeValue(keys[1])});
+      for (const auto& key : keys) {
+        server->RegisterHandlerWithConstReply(
+            "mget", {key}, redis::ReplyData::Array{MakeValue(key)});
+      }
+    }
+  }
+
+  const auto keys = MakeInterleavedKeys(shard_keys);
+  std::vector<std::optional<std::string>> expected;
+  for (const auto& key : keys) expected.emplace_back(MakeValue(key));
+
+  EXPECT_EQ(client->Mget(keys, {}).Get(), expected);
+
+  // the chunks of the shards are reassembled in the order of the keys too
+  storages::redis::CommandControl cc;
+  cc.chunk_size = 1;
+  EXPECT_EQ(client->Mget(keys, cc).Get(), expected);
+}
+
+UTEST(RedisClient, MsetAcrossShards) {
+  SentinelShardTest sentinel_test(1, kShardCount);
+  auto client = std::make_shared<storages::redis::ClientImpl>(
+      sentinel_test.SentinelClientPtr());
+  const auto shard_keys = MakeShardKeys(*client);
+
+  std::vector<MockRedisServer::HandlerPtr> handlers;
+  for (size_t shard = 0; shard < kShardCount; ++shard) {
+    const auto& keys = shard_keys[shard];
+    handlers.push_back(sentinel_test.Master(shard).RegisterStatusReplyHandler(
+        "mset",
+        {keys[0], MakeValue(keys[0]), keys[1], MakeValue(keys[1])}, "OK"));
+  }
+
+  std::vector<std::pair<std::string, std::string>> key_values;
+  for (const auto& key : MakeInterleavedKeys(shard_keys)) {
+    key_values.emplace_back(key, MakeValue(key));
+  }
+  UEXPECT_NO_THROW(client->Mset(std::move(key_values), {}).Get());
+
+  // each shard gets its own keys in the order of the original command
+  for (const auto& handler : handlers) {
+    EXPECT_EQ(handler->GetReplyCount(), 1);
+  }
+}
+
+USERVER_NAMESPACE_END
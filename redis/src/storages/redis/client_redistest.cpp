@@ -882,6 +882,44 @@ UTEST_F(RedisClientTest, TransactionZrem) {
   EXPECT_EQ(result.size(), 2);
 }
 
+UTEST_F(RedisClientTest, Streams) {
+  auto client = GetClient();
+
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "$", {}).Get(),
+            storages::redis::XgroupCreateReply::kCreated);
+  EXPECT_EQ(client->XgroupCreate("stream", "group", "$", {}).Get(),
+            storages::redis::XgroupCreateReply::kAlreadyExists);
+
+  const auto id1 = client->Xadd("stream", {{"a", "1"}}, {}, {}).Get();
+  const auto id2 =
+      client->Xadd("stream", {{"b", "2"}, {"c", "3"}}, {}, {}).Get();
+
+  storages::redis::XreadgroupOptions options;
+  options.count = 10;
+  auto entries =
+      client->Xreadgroup("stream", "group", "consumer", options, {}).Get();
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0], storages::redis::StreamEntry(id1, {{"a", "1"}}));
+  EXPECT_EQ(entries[1],
+            storages::redis::StreamEntry(id2, {{"b", "2"}, {"c", "3"}}));
+  EXPECT_TRUE(
+      client->Xreadgroup("stream", "group", "consumer", options, {})
+          .Get()
+          .empty());
+
+  EXPECT_EQ(client->Xack("stream", "group", {id1}, {}).Get(), 1);
+
+  // The second entry is still pending and is claimed by another consumer
+  const auto claimed =
+      client
+          ->Xautoclaim("stream", "group", "other",
+                       std::chrono::milliseconds{0}, "0-0", {}, {})
+          .Get();
+  ASSERT_EQ(claimed.entries.size(), 1);
+  EXPECT_EQ(claimed.entries[0].id, id2);
+  EXPECT_EQ(claimed.next_start_id, "0-0");
+}
+
 UTEST_F(RedisClientTest, WaitAny) {
   constexpr auto kReqCount = 10;
   auto client = GetClient();
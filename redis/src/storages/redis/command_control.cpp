@@ -128,6 +128,9 @@ CommandControl CommandControl::MergeWith(const CommandControl& b) const {
   if (b.force_server_id.has_value()) {
     res.force_server_id = b.force_server_id;
   }
+  if (b.allow_commands_buffering.has_value()) {
+    res.allow_commands_buffering = b.allow_commands_buffering;
+  }
   return (b.force_retries_to_master_on_nil_reply
               ? res.MergeWith(RetryNilFromMaster{})
               : res);
@@ -176,7 +179,8 @@ CommandControl::Strategy StrategyFromString(std::string_view strategy) {
         .Case("every_dc", Strategy::kEveryDc)
         .Case("default", Strategy::kDefault)
         .Case("local_dc_conductor", Strategy::kLocalDcConductor)
-        .Case("nearest_server_ping", Strategy::kNearestServerPing);
+        .Case("nearest_server_ping", Strategy::kNearestServerPing)
+        .Case("nearest_server_latency", Strategy::kNearestServerLatency);
   };
 
   auto result = kToStrategy.TryFind(strategy);
@@ -64,6 +64,23 @@ std::string ParseMovedShard(const std::string& err_string) {
   return err_string.substr(pos, colon_pos - pos) + ":" + std::to_string(port);
 }
 
+std::optional<uint16_t> ParseMovedSlot(const std::string& err_string) {
+  size_t pos = err_string.find(' ');  // skip "MOVED" or "ASK"
+  if (pos == std::string::npos) return std::nullopt;
+  pos++;
+  const size_t end = err_string.find(' ', pos);
+  if (end == std::string::npos) return std::nullopt;
+  try {
+    const auto slot = std::stoul(err_string.substr(pos, end - pos));
+    if (slot >= kClusterHashSlots) return std::nullopt;
+    return slot;
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "exception in " << __func__ << "(\"" << err_string
+                  << "\") " << ex.what();
+    return std::nullopt;
+  }
+}
+
 struct CommandSpecialPrinter {
   const CommandPtr& command;
 };
@@ -261,6 +278,26 @@ class ClusterTopologyHolder
 
   void SendUpdateClusterTopology() { update_topology_watch_.Send(); }
 
+  /// Routes the slot to the master from a MOVED reply until CLUSTER SLOTS is
+  /// read again. Returns false if the host is not a known master.
+  bool MoveSlot(uint16_t slot, const std::string& host_port) {
+    {
+      auto topology = topology_.Read();
+      const auto shard = topology->GetShardByMaster(host_port);
+      if (!shard) return false;
+      if (topology->GetShardIndexBySlot(slot) == *shard) return true;
+    }
+
+    auto topology = topology_.StartWrite();
+    const auto shard = topology->GetShardByMaster(host_port);
+    if (!shard) return false;
+    topology->MoveSlot(slot, *shard);
+    topology.Commit();
+    LOG_INFO() << "Slot " << slot << " moved to " << host_port
+               << ", shard_group_name=" << shard_group_name_;
+    return true;
+  }
+
   std::shared_ptr<Redis> GetRedisInstance(const HostPort& host_port) const {
     const auto connection = nodes_.Get(host_port);
     if (!connection) {
@@ -341,6 +378,7 @@ class ClusterTopologyHolder
   engine::ev::PeriodicWatcher update_topology_timer_;
   engine::ev::AsyncWatcher update_topology_watch_;
   void UpdateClusterTopology();
+  bool HasNewMastersInInit(const ClusterTopology& topology) const;
   /// @}
 
   /// Discover actual nodes in cluster
@@ -363,6 +401,8 @@ class ClusterTopologyHolder
   std::atomic<bool> is_topology_received_{false};
   std::atomic<bool> is_nodes_received_{false};
   std::atomic<bool> update_cluster_slots_flag_{false};
+  /// The new topology waits for the connections to its new masters
+  std::atomic<bool> is_topology_warming_up_{false};
   bool IsInitialized() const {
     return is_nodes_received_.load() && is_topology_received_.load();
   }
@@ -490,6 +530,10 @@ void ClusterTopologyHolder::CreateNodes() {
           }
           topology_holder->GetSignalNodeStateChanged()(host_port, state);
           topology_holder->cv_.NotifyAll();
+          if (state != redis::RedisState::kInit &&
+              topology_holder->is_topology_warming_up_.exchange(false)) {
+            topology_holder->SendUpdateClusterTopology();
+          }
         });
     nodes_.Insert(std::move(host_port), std::move(instance));
   }
@@ -578,6 +622,20 @@ std::shared_ptr<utils::FastScopeGuard<Callback>> MakeSharedScopeGuard(
 
 }  // namespace
 
+bool ClusterTopologyHolder::HasNewMastersInInit(
+    const ClusterTopology& topology) const {
+  const auto current = topology_.Read();
+  for (const auto& info : topology.GetShardInfos()) {
+    const auto& [host, port] = info.master.HostPort();
+    const auto host_port = host + ":" + std::to_string(port);
+    if (current->GetShardByMaster(host_port)) continue;
+
+    const auto instance = GetRedisInstance(host_port);
+    if (instance && instance->GetState() == Redis::State::kInit) return true;
+  }
+  return false;
+}
+
 void ClusterTopologyHolder::UpdateClusterTopology() {
   if (!is_nodes_received_) {
     LOG_DEBUG() << "Skip updating cluster topology: no nodes yet";
@@ -629,8 +687,17 @@ void ClusterTopologyHolder::UpdateClusterTopology() {
 
         try {
           auto topology = ClusterTopology(
-              ++current_topology_version_, std::chrono::steady_clock::now(),
+              current_topology_version_ + 1, std::chrono::steady_clock::now(),
               std::move(shard_infos), password_, redis_thread_pool_, nodes_);
+          if (is_topology_received_ && HasNewMastersInInit(topology)) {
+            /// Keep routing to the old masters until the new ones have tried
+            /// to connect, the state change triggers the update again
+            LOG_INFO() << "Cluster topology update is postponed until the new "
+                          "masters are connected";
+            is_topology_warming_up_ = true;
+            return;
+          }
+          ++current_topology_version_;
           const auto new_shards_count = topology.GetShardsCount();
           topology_.Assign(std::move(topology));
           signal_topology_changed_(new_shards_count);
@@ -796,7 +863,13 @@ void ClusterSentinelImpl::AsyncCommand(const SentinelCommand& scommand,
                       << " shard: " << shard
                       << " movedto:" << ParseMovedShard(reply->data.GetError())
                       << " args:" << args;
-          this->topology_holder_->SendUpdateClusterTopology();
+          /// Only the moved slot is rerouted, the periodic update brings the
+          /// rest of the new slot intervals
+          const auto slot = ParseMovedSlot(reply->data.GetError());
+          if (!slot || !topology_holder_->MoveSlot(
+                           *slot, ParseMovedShard(reply->data.GetError()))) {
+            this->topology_holder_->SendUpdateClusterTopology();
+          }
         }
         const bool retry_to_master =
             !master && reply->data.IsNil() &&
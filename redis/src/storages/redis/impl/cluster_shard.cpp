@@ -21,6 +21,7 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
       return false;
     case CommandControl::Strategy::kLocalDcConductor:
     case CommandControl::Strategy::kNearestServerPing:
+    case CommandControl::Strategy::kNearestServerLatency:
       return true;
   }
   /* never reachable */
@@ -28,6 +29,10 @@ bool IsNearestServerPing(const CommandControlImpl& control) {
   return false;
 }
 
+bool IsNearestServerLatency(const CommandControlImpl& control) {
+  return control.strategy == CommandControl::Strategy::kNearestServerLatency;
+}
+
 }  // namespace
 
 ClusterShard& ClusterShard::operator=(const ClusterShard& other) {
@@ -85,6 +90,7 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
   const auto& available_servers = GetAvailableServers(command->control);
   const auto servers_count = available_servers.size();
   const auto is_nearest_ping_server = IsNearestServerPing(cc);
+  const auto is_by_latency = IsNearestServerLatency(cc);
   const auto is_retry = command->counter != 0;
 
   const auto masters_count = 1;
@@ -97,7 +103,8 @@ bool ClusterShard::AsyncCommand(CommandPtr command) const {
     size_t idx = SentinelImpl::kDefaultPrevInstanceIdx;
     const auto instance =
         GetInstance(available_servers, is_retry, start_idx, attempt,
-                    is_nearest_ping_server, cc.best_dc_count, &idx);
+                    is_nearest_ping_server, is_by_latency, cc.best_dc_count,
+                    &idx);
     if (!instance) {
       continue;
     }
@@ -142,8 +149,8 @@ void ClusterShard::GetStatistics(bool master, const MetricsSettings& settings,
   stats.is_ready = IsReady(WaitConnectedMode::kMasterAndSlave);
 }
 
-/// Prioritize first command_control.best_dc_count nearest by ping instances.
-/// Leave others to be able to fallback
+/// Prioritize first command_control.best_dc_count nearest by ping (or by
+/// expected latency) instances. Leave others to be able to fallback
 void ClusterShard::GetNearestServersPing(
     const CommandControl& command_control,
     std::vector<RedisConnectionPtr>& instances) {
@@ -153,6 +160,16 @@ void ClusterShard::GetNearestServersPing(
     /// We want to leave all instances
     return;
   }
+  if (IsNearestServerLatency(cc)) {
+    std::partial_sort(
+        instances.begin(), instances.begin() + num_instances, instances.end(),
+        [](const RedisConnectionPtr& l, const RedisConnectionPtr& r) {
+          UASSERT(r->Get() && l->Get());
+          return l->Get()->GetExpectedLatency() <
+                 r->Get()->GetExpectedLatency();
+        });
+    return;
+  }
   std::partial_sort(
       instances.begin(), instances.begin() + num_instances, instances.end(),
       [](const RedisConnectionPtr& l, const RedisConnectionPtr& r) {
@@ -223,7 +240,7 @@ std::vector<ClusterShard::RedisConnectionPtr> ClusterShard::GetAvailableServers(
 ClusterShard::RedisPtr ClusterShard::GetInstance(
     const std::vector<RedisConnectionPtr>& instances, bool retry,
     size_t start_idx, size_t attempt, bool is_nearest_ping_server,
-    size_t best_dc_count, size_t* pinstance_idx) {
+    bool is_by_latency, size_t best_dc_count, size_t* pinstance_idx) {
   RedisPtr ret;
   const auto end = (is_nearest_ping_server && attempt == 0 && best_dc_count)
                        ? std::min(instances.size(), best_dc_count)
@@ -239,7 +256,10 @@ ClusterShard::RedisPtr ClusterShard::GetInstance(
     if (cur_inst && cur_inst->IsAvailable() &&
         (!retry || cur_inst->CanRetry()) &&
         (!ret || ret->IsDestroying() ||
-         cur_inst->GetRunningCommands() < ret->GetRunningCommands())) {
+         (is_by_latency
+              ? cur_inst->GetExpectedLatency() < ret->GetExpectedLatency()
+              : cur_inst->GetRunningCommands() <
+                    ret->GetRunningCommands()))) {
       if (pinstance_idx) *pinstance_idx = idx;
       ret = cur_inst;
     }
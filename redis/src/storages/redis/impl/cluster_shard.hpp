@@ -62,8 +62,8 @@ class ClusterShard {
       const CommandControl& command_control) const;
   static RedisPtr GetInstance(const std::vector<RedisConnectionPtr>& instances,
                               bool is_retry, size_t start_idx, size_t attempt,
-                              bool is_nearest_ping_server, size_t best_dc_count,
-                              size_t* pinstance_idx);
+                              bool is_nearest_ping_server, bool is_by_latency,
+                              size_t best_dc_count, size_t* pinstance_idx);
   std::vector<RedisConnectionPtr> MakeReadonlyWithMasters() const;
   bool IsMasterReady() const;
   bool IsReplicaReady() const;
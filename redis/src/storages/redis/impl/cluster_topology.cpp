@@ -1,11 +1,54 @@
 #include "cluster_topology.hpp"
 
+#include <iterator>
+#include <set>
+#include <utility>
+
 #include <storages/redis/impl/cluster_shard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace redis {
 
+namespace {
+
+std::string HostPortToString(const std::pair<std::string, int>& host_port) {
+  return host_port.first + ":" + std::to_string(host_port.second);
+}
+
+void RemoveSlot(std::set<SlotInterval>& intervals, size_t slot) {
+  auto it = intervals.upper_bound(SlotInterval{slot, slot});
+  if (it == intervals.begin()) return;
+  --it;
+  if (it->slot_max < slot) return;
+
+  const auto [slot_min, slot_max] = std::pair{it->slot_min, it->slot_max};
+  intervals.erase(it);
+  if (slot_min < slot) intervals.emplace(slot_min, slot - 1);
+  if (slot < slot_max) intervals.emplace(slot + 1, slot_max);
+}
+
+void AddSlot(std::set<SlotInterval>& intervals, size_t slot) {
+  size_t slot_min = slot;
+  size_t slot_max = slot;
+  auto next = intervals.upper_bound(SlotInterval{slot, slot});
+  if (next != intervals.begin()) {
+    const auto prev = std::prev(next);
+    if (prev->slot_max >= slot) return;
+    if (prev->slot_max + 1 == slot) {
+      slot_min = prev->slot_min;
+      intervals.erase(prev);
+    }
+  }
+  if (next != intervals.end() && next->slot_min == slot + 1) {
+    slot_max = next->slot_max;
+    intervals.erase(next);
+  }
+  intervals.emplace(slot_min, slot_max);
+}
+
+}  // namespace
+
 ClusterTopology::ClusterTopology(
     size_t version, std::chrono::steady_clock::time_point timestamp,
     ClusterShardHostInfos infos, Password password,
@@ -22,9 +65,6 @@ ClusterTopology::ClusterTopology(
       all_instances_count += info.slaves.size() + 1;
     }
 
-    auto HostPortToString = [](const std::pair<std::string, int>& host_port) {
-      return host_port.first + ":" + std::to_string(host_port.second);
-    };
     cluster_shards_.reserve(infos_.size());
 
     ClusterShard::RedisConnectionPtr super_master;
@@ -83,6 +123,27 @@ bool ClusterTopology::IsReady(WaitConnectedMode mode) const {
              [mode](const ClusterShard& shard) { return shard.IsReady(mode); });
 }
 
+std::optional<size_t> ClusterTopology::GetShardByMaster(
+    const std::string& host_port) const {
+  const auto shard = GetShardByHostPort(host_port);
+  if (!shard || HostPortToString(infos_.at(*shard).master.HostPort()) !=
+                    host_port) {
+    return std::nullopt;
+  }
+  return shard;
+}
+
+void ClusterTopology::MoveSlot(uint16_t slot, size_t shard_index) {
+  auto& current_shard = slot_to_shard_.at(slot);
+  if (current_shard == shard_index) return;
+
+  if (current_shard < infos_.size()) {
+    RemoveSlot(infos_[current_shard].slot_intervals, slot);
+  }
+  AddSlot(infos_.at(shard_index).slot_intervals, slot);
+  current_shard = shard_index;
+}
+
 bool ClusterTopology::HasSameInfos(const ClusterShardHostInfos& infos) const {
   /// other fields calculated from infos_
   if (infos_.size() != infos.size()) {
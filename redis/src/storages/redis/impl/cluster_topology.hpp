@@ -72,6 +72,14 @@ class ClusterTopology {
 
   bool IsReady(WaitConnectedMode mode) const;
 
+  /// Returns the shard the host is a master of
+  std::optional<size_t> GetShardByMaster(const std::string& host_port) const;
+
+  /// Routes the slot to the shard, e.g. on MOVED before the new slot
+  /// intervals are read. The slot intervals of the infos are patched too, so
+  /// that HasSameInfos() compares the actual routing with CLUSTER SLOTS.
+  void MoveSlot(uint16_t slot, size_t shard_index);
+
   bool HasSameInfos(const ClusterShardHostInfos& infos) const;
 
   const ClusterShardHostInfos& GetShardInfos() const { return infos_; }
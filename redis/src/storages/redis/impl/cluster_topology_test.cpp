@@ -0,0 +1,133 @@
+#include "cluster_topology.hpp"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <engine/ev/thread_pool.hpp>
+#include <storages/redis/impl/redis_connection_holder.hpp>
+#include <userver/storages/redis/impl/thread_pools.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::string kHost = "localhost";
+
+std::string MakeHostPort(int port) {
+  return kHost + ":" + std::to_string(port);
+}
+
+redis::ClusterShardHostInfo MakeShardInfo(
+    int master_port, const std::vector<int>& replica_ports,
+    std::set<redis::SlotInterval> slot_intervals) {
+  redis::ClusterShardHostInfo info;
+  info.master = redis::ConnectionInfoInt{{kHost, master_port, {}}};
+  for (const auto port : replica_ports) {
+    info.slaves.emplace_back(redis::ConnectionInfo{kHost, port, {}});
+  }
+  info.slot_intervals = std::move(slot_intervals);
+  return info;
+}
+
+/// Two shards: masters 7000 and 7001 with the replicas 7100 and 7101, the
+/// slots are split in halves
+class ClusterTopologyTest : public ::testing::Test {
+ protected:
+  ClusterTopologyTest() : thread_pools_(1, 1) {
+    for (const auto port : {7000, 7001, 7100, 7101}) {
+      nodes_.Insert(MakeHostPort(port),
+                    std::make_shared<redis::RedisConnectionHolder>(
+                        thread_pools_.GetSentinelThreadPool().NextThread(),
+                        thread_pools_.GetRedisThreadPool(), kHost, port,
+                        redis::Password{}, redis::CommandsBufferingSettings{},
+                        redis::ReplicationMonitoringSettings{},
+                        utils::RetryBudgetSettings{}));
+    }
+  }
+
+  static redis::ClusterShardHostInfos MakeInfos() {
+    return {
+        MakeShardInfo(7000, {7100}, {{0, kHalf - 1}}),
+        MakeShardInfo(7001, {7101}, {{kHalf, redis::kClusterHashSlots - 1}}),
+    };
+  }
+
+  redis::ClusterTopology MakeTopology(redis::ClusterShardHostInfos infos) {
+    return redis::ClusterTopology(0, std::chrono::steady_clock::now(),
+                                  std::move(infos), {},
+                                  thread_pools_.GetRedisThreadPool(), nodes_);
+  }
+
+  static constexpr size_t kHalf = redis::kClusterHashSlots / 2;
+
+ private:
+  redis::ThreadPools thread_pools_;
+  redis::NodesStorage nodes_;
+};
+
+}  // namespace
+
+TEST_F(ClusterTopologyTest, GetShardByMaster) {
+  const auto topology = MakeTopology(MakeInfos());
+
+  EXPECT_EQ(topology.GetShardByMaster(MakeHostPort(7000)), 0);
+  EXPECT_EQ(topology.GetShardByMaster(MakeHostPort(7001)), 1);
+  // replicas are known hosts, but not masters
+  EXPECT_EQ(topology.GetShardByHostPort(MakeHostPort(7101)), 1);
+  EXPECT_EQ(topology.GetShardByMaster(MakeHostPort(7101)), std::nullopt);
+  EXPECT_EQ(topology.GetShardByMaster(MakeHostPort(7200)), std::nullopt);
+}
+
+TEST_F(ClusterTopologyTest, MoveSlot) {
+  auto topology = MakeTopology(MakeInfos());
+  constexpr uint16_t kSlot = 100;
+  ASSERT_EQ(topology.GetShardIndexBySlot(kSlot), 0);
+
+  topology.MoveSlot(kSlot, 1);
+  EXPECT_EQ(topology.GetShardIndexBySlot(kSlot), 1);
+  EXPECT_EQ(topology.GetShardIndexBySlot(kSlot - 1), 0);
+  EXPECT_EQ(topology.GetShardIndexBySlot(kSlot + 1), 0);
+
+  // the infos follow the routing
+  auto expected = MakeInfos();
+  expected[0].slot_intervals = {{0, kSlot - 1}, {kSlot + 1, kHalf - 1}};
+  expected[1].slot_intervals = {{kSlot, kSlot},
+                                {kHalf, redis::kClusterHashSlots - 1}};
+  EXPECT_TRUE(topology.HasSameInfos(expected));
+  EXPECT_FALSE(topology.HasSameInfos(MakeInfos()));
+
+  // moving the slot back restores the intervals
+  topology.MoveSlot(kSlot, 0);
+  EXPECT_EQ(topology.GetShardIndexBySlot(kSlot), 0);
+  EXPECT_TRUE(topology.HasSameInfos(MakeInfos()));
+}
+
+TEST_F(ClusterTopologyTest, MoveAdjacentSlots) {
+  auto topology = MakeTopology(MakeInfos());
+
+  // the intervals are merged at the border of the shards
+  topology.MoveSlot(kHalf - 1, 1);
+  topology.MoveSlot(kHalf - 2, 1);
+  auto expected = MakeInfos();
+  expected[0].slot_intervals = {{0, kHalf - 3}};
+  expected[1].slot_intervals = {{kHalf - 2, redis::kClusterHashSlots - 1}};
+  EXPECT_TRUE(topology.HasSameInfos(expected));
+
+  // moving to the same shard changes nothing
+  topology.MoveSlot(kHalf - 1, 1);
+  EXPECT_TRUE(topology.HasSameInfos(expected));
+
+  topology.MoveSlot(0, 1);
+  expected[0].slot_intervals = {{1, kHalf - 3}};
+  expected[1].slot_intervals = {{0, 0},
+                                {kHalf - 2, redis::kClusterHashSlots - 1}};
+  EXPECT_TRUE(topology.HasSameInfos(expected));
+  EXPECT_EQ(topology.GetShardIndexBySlot(0), 1);
+  EXPECT_EQ(topology.GetShardIndexBySlot(1), 0);
+}
+
+USERVER_NAMESPACE_END
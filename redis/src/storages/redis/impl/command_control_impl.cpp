@@ -27,6 +27,8 @@ CommandControlImpl::CommandControlImpl(const CommandControl& command_control) {
     chunk_size = *command_control.chunk_size;
   if (command_control.force_server_id.has_value())
     force_server_id = *command_control.force_server_id;
+  if (command_control.allow_commands_buffering.has_value())
+    allow_commands_buffering = *command_control.allow_commands_buffering;
 }
 
 }  // namespace redis
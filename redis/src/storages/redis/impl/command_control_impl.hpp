@@ -47,6 +47,9 @@ struct CommandControlImpl {
   /// Sentinel may not redirect the command to other instances. strategy is
   /// ignored.
   ServerId force_server_id;
+
+  /// Allow the command to wait for the commands buffering window
+  bool allow_commands_buffering{true};
 };
 
 }  // namespace redis
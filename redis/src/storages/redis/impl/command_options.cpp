@@ -146,6 +146,35 @@ void PutArg(CmdArgs::CmdArgsArray& args_, const RangeScoreOptions& arg) {
   PutArg(args_, arg.range_options);
 }
 
+void PutArg(CmdArgs::CmdArgsArray& args_, const XaddOptions& arg) {
+  if (arg.maxlen) {
+    args_.emplace_back("MAXLEN");
+    args_.emplace_back("~");
+    args_.emplace_back(std::to_string(*arg.maxlen));
+  }
+  args_.emplace_back(arg.id);
+}
+
+// The ID is put after the stream keys by the command itself
+void PutArg(CmdArgs::CmdArgsArray& args_, const XreadgroupOptions& arg) {
+  if (arg.count) {
+    args_.emplace_back("COUNT");
+    args_.emplace_back(std::to_string(*arg.count));
+  }
+  if (arg.block) {
+    args_.emplace_back("BLOCK");
+    args_.emplace_back(std::to_string(arg.block->count()));
+  }
+  if (arg.noack) args_.emplace_back("NOACK");
+}
+
+void PutArg(CmdArgs::CmdArgsArray& args_, const XautoclaimOptions& arg) {
+  if (arg.count) {
+    args_.emplace_back("COUNT");
+    args_.emplace_back(std::to_string(*arg.count));
+  }
+}
+
 }  // namespace redis
 
 USERVER_NAMESPACE_END
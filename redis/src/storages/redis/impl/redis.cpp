@@ -38,6 +38,8 @@ namespace {
 
 const auto kPingLatencyExp = 0.7;
 const auto kInitialPingLatencyMs = 1000;
+// Replies come much more often than pings, so the latency is smoothed longer
+const auto kCommandLatencyExp = 0.9;
 const size_t kMissedPingStreakThresholdDefault = 3;
 
 // channel is used for periodic subscribe/unsubscribe to calculate actual RTT
@@ -112,6 +114,14 @@ bool IsFinalState(Redis::State state) {
          state == Redis::State::kDisconnectError;
 }
 
+// The replies are built by the reader functions installed at the moment
+ReplyData ExtractReplyData(const redisAsyncContext* c, redisReply* reply) {
+  if (reply && c->c.reader->fn == &ReplyData::ReaderFunctions()) {
+    return ReplyData::ExtractFromReader(reply);
+  }
+  return ReplyData{reply};
+}
+
 bool IsUnsubscribeReply(const ReplyPtr& reply) {
   if (!reply->data || !reply->data.IsArray()) return false;
   const auto& reply_array = reply->data.GetArray();
@@ -164,6 +174,7 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::chrono::milliseconds GetPingLatency() const {
     return std::chrono::milliseconds(ping_latency_ms_);
   }
+  std::chrono::microseconds GetExpectedLatency() const;
   void SetCommandsBufferingSettings(
       CommandsBufferingSettings commands_buffering_settings);
   void SetReplicationMonitoringSettings(
@@ -212,9 +223,11 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
 
   void OnNewCommandImpl();
   void CommandLoopImpl();
-  void OnRedisReplyImpl(redisReply* redis_reply, void* privdata, int status,
-                        const char* errstr);
+  void OnRedisReplyImpl(redisReply* redis_reply, ReplyData&& reply_data,
+                        void* privdata, int status, const char* errstr);
   void AccountPingLatency(std::chrono::milliseconds latency);
+  void AccountCommandLatency(const CommandPtr& command,
+                             ReplyStatus reply_status);
   void AccountRtt();
   void OnTimerPingImpl();
   void OnTimerInfoImpl();
@@ -259,6 +272,9 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::atomic<bool> destroying_{false};
 
   redisAsyncContext* context_ = nullptr;
+  // The reader functions of hiredis, replaced with ReplyData ones until the
+  // connection subscribes
+  redisReplyObjectFunctions* default_reply_functions_ = nullptr;
 #ifdef USERVER_FEATURE_REDIS_TLS
   SSLContextPtr ssl_context_;
 #endif
@@ -268,6 +284,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::string server_;
   Password password_{std::string()};
   std::atomic<size_t> commands_size_ = 0;
+  // Set by the commands that should not wait for the buffering window
+  std::atomic_bool flush_commands_ = false;
   size_t sent_count_ = 0;
   size_t cmd_counter_ = 0;
   std::unordered_map<size_t, std::unique_ptr<SingleCommand>> reply_privdata_;
@@ -291,6 +309,8 @@ class Redis::RedisImpl : public std::enable_shared_from_this<Redis::RedisImpl> {
   std::chrono::milliseconds ping_timeout_{4000};
   std::chrono::milliseconds info_replication_interval_{2000};
   std::atomic<double> ping_latency_ms_{kInitialPingLatencyMs};
+  // Negative until the first reply
+  std::atomic<double> command_latency_us_{-1};
   logging::LogExtra log_extra_;
   bool watch_command_timer_started_ = false;
   Statistics statistics_;
@@ -353,6 +373,10 @@ std::chrono::milliseconds Redis::GetPingLatency() const {
   return impl_->GetPingLatency();
 }
 
+std::chrono::microseconds Redis::GetExpectedLatency() const {
+  return impl_->GetExpectedLatency();
+}
+
 bool Redis::IsDestroying() const { return impl_->IsDestroying(); }
 
 bool Redis::IsSyncing() const { return impl_->IsSyncing(); }
@@ -476,6 +500,9 @@ bool Redis::RedisImpl::Connect(const std::string& host, int port,
     return false;
   }
 
+  default_reply_functions_ = context_->c.reader->fn;
+  context_->c.reader->fn = &ReplyData::ReaderFunctions();
+
   ev_thread_control_.RunInEvLoopBlocking([this, &host]() {
     bool err = false;
     auto CheckError = [&err, &host](int status, const std::string& name) {
@@ -533,6 +560,7 @@ void Redis::RedisImpl::InvokeCommand(const CommandPtr& command,
   const CommandControlImpl cc{command->control};
   if (cc.account_in_statistics)
     statistics_.AccountReplyReceived(reply, command);
+  AccountCommandLatency(command, reply->status);
   reply->server = server_;
   if (utils::impl::kRedisRetryBudgetExperiment.IsEnabled()) {
     if (reply->status == ReplyStatus::kTimeoutError) {
@@ -607,6 +635,9 @@ bool Redis::RedisImpl::AsyncCommand(const CommandPtr& command) {
     ++commands_size_;
     commands_.push_back(command);
   }
+  if (!CommandControlImpl{command->control}.allow_commands_buffering) {
+    flush_commands_ = true;
+  }
   ev_thread_control_.Send(watch_command_);
   return true;
 }
@@ -667,6 +698,30 @@ void Redis::RedisImpl::AccountPingLatency(std::chrono::milliseconds latency) {
               << log_extra;
 }
 
+void Redis::RedisImpl::AccountCommandLatency(const CommandPtr& command,
+                                             ReplyStatus reply_status) {
+  // Other errors are not related to the load of the server
+  if (reply_status != ReplyStatus::kOk &&
+      reply_status != ReplyStatus::kTimeoutError) {
+    return;
+  }
+
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - command->GetStartHandlingTime());
+  const auto prev = command_latency_us_.load();
+  command_latency_us_ =
+      prev < 0 ? latency.count()
+               : prev * kCommandLatencyExp +
+                     latency.count() * (1 - kCommandLatencyExp);
+}
+
+std::chrono::microseconds Redis::RedisImpl::GetExpectedLatency() const {
+  auto latency_us = command_latency_us_.load();
+  if (latency_us < 0) latency_us = ping_latency_ms_.load() * 1000;
+  return std::chrono::microseconds{static_cast<std::int64_t>(
+      latency_us * (1 + GetRunningCommands()))};
+}
+
 void Redis::RedisImpl::AccountRtt() {
   auto rtt = GetSocketPeerRtt(context_->c.fd);
   if (rtt) {
@@ -894,7 +949,8 @@ void Redis::RedisImpl::OnNewCommand(struct ev_loop*, ev_async* w,
 
 void Redis::RedisImpl::OnNewCommandImpl() {
   auto commands_buffering_settings = commands_buffering_settings_.Get();
-  if (WatchCommandTimerEnabled(*commands_buffering_settings) &&
+  const bool flush = flush_commands_.exchange(false);
+  if (!flush && WatchCommandTimerEnabled(*commands_buffering_settings) &&
       (!commands_buffering_settings->commands_buffering_threshold ||
        commands_size_.load() <
            commands_buffering_settings->commands_buffering_threshold)) {
@@ -1104,19 +1160,22 @@ void Redis::RedisImpl::OnRedisReply(redisAsyncContext* c, void* r,
   UASSERT(impl != nullptr);
   try {
     if (r || c->err != REDIS_OK) {
-      impl->OnRedisReplyImpl(static_cast<redisReply*>(r), privdata, c->err,
-                             c->errstr);
+      auto* redis_reply = static_cast<redisReply*>(r);
+      impl->OnRedisReplyImpl(redis_reply, ExtractReplyData(c, redis_reply),
+                             privdata, c->err, c->errstr);
     } else {
       // redisAsyncDisconnect causes empty replies with OK status,
       // translate to something sensible.
-      impl->OnRedisReplyImpl(nullptr, privdata, REDIS_ERR_EOF, "Disconnecting");
+      impl->OnRedisReplyImpl(nullptr, ExtractReplyData(c, nullptr), privdata,
+                             REDIS_ERR_EOF, "Disconnecting");
     }
   } catch (const std::exception& ex) {
     LOG_ERROR() << "OnRedisReplyImpl() failed: " << ex;
   }
 }
 
-void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
+void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply,
+                                        ReplyData&& reply_data, void* privdata,
                                         int status, const char* errstr) {
   auto data = reply_privdata_.find(reinterpret_cast<size_t>(privdata));
   if (data == reply_privdata_.end()) return;
@@ -1127,7 +1186,7 @@ void Redis::RedisImpl::OnRedisReplyImpl(redisReply* redis_reply, void* privdata,
   ev_thread_control_.Stop(data->second->timer);
   pcommand = data->second.get();
 
-  auto reply = std::make_shared<Reply>(pcommand->cmd, redis_reply,
+  auto reply = std::make_shared<Reply>(pcommand->cmd, std::move(reply_data),
                                        NativeToReplyStatus(status),
                                        errstr ? errstr : "");
 
@@ -1189,6 +1248,12 @@ void Redis::RedisImpl::ProcessCommand(const CommandPtr& command) {
     }
 
     const bool is_special = IsSubscribesCommand(args);
+    if (is_special && !subscriber_) {
+      // hiredis reads the whole redisReply tree of the subscriber replies.
+      // The replies before the first subscription are not arrays and are
+      // never left half-built by the reader between the reads.
+      context_->c.reader->fn = default_reply_functions_;
+    }
     if (is_special) subscriber_ = true;
     if (subscriber_ && !is_special) {
       LOG_ERROR() << log_extra_ << "impossible for subscriber: " << args[0];
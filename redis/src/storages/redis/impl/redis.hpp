@@ -38,6 +38,9 @@ class Redis {
   bool AsyncCommand(const CommandPtr& command);
   size_t GetRunningCommands() const;
   std::chrono::milliseconds GetPingLatency() const;
+  /// Smoothed latency of the recent commands scaled by the commands in
+  /// flight, the ping latency until the first reply
+  std::chrono::microseconds GetExpectedLatency() const;
   bool IsDestroying() const;
   std::string GetServerHost() const;
   uint16_t GetServerPort() const;
@@ -92,6 +92,11 @@ const std::string_view kCommandTypes[] = {
     "type",
     "unlink",
     "unsubscribe",
+    "xack",
+    "xadd",
+    "xautoclaim",
+    "xgroup",
+    "xreadgroup",
     "zadd",
     "zcard",
     "zcount",
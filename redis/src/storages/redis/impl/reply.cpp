@@ -75,6 +75,113 @@ ReplyData ReplyData::CreateNil() {
   return data;
 }
 
+struct ReplyDataReader final {
+  // hiredis reads the type and the error message of the root object only,
+  // the nested replies are stored right in the array of their parent
+  struct Root final : redisReply {
+    Root() : redisReply{} {}
+
+    ReplyData data;
+  };
+
+  static ReplyData& ParentData(const redisReadTask* task) {
+    auto* parent = task->parent;
+    if (parent->parent) return *static_cast<ReplyData*>(parent->obj);
+    return static_cast<Root*>(static_cast<redisReply*>(parent->obj))->data;
+  }
+
+  static void* Store(const redisReadTask* task, ReplyData&& value) {
+    if (task->parent) {
+      auto& slot = ParentData(task).array_[task->idx];
+      slot = std::move(value);
+      return &slot;
+    }
+
+    auto* root = new Root;
+    root->type = task->type;
+    root->data = std::move(value);
+    if (root->data.IsError() || root->data.IsStatus()) {
+      root->str = root->data.string_.data();
+      root->len = root->data.string_.size();
+    }
+    return static_cast<redisReply*>(root);
+  }
+
+  static void* CreateString(const redisReadTask* task, char* str,
+                            size_t len) {
+    switch (task->type) {
+      case REDIS_REPLY_STRING:
+        return Store(task, ReplyData{std::string(str, len)});
+      case REDIS_REPLY_STATUS:
+        return Store(task, ReplyData::CreateStatus(std::string(str, len)));
+      case REDIS_REPLY_ERROR:
+        return Store(task, ReplyData::CreateError(std::string(str, len)));
+      default:
+        return Store(task, ReplyData{});
+    }
+  }
+
+  // The number of elements is `int` before hiredis 1.0.0 and `size_t` since
+  template <typename Size>
+  static void* CreateArray(const redisReadTask* task, Size elements) {
+    auto* obj = Store(task, ReplyData{ReplyData::Array(elements, ReplyData{})});
+    if (!task->parent) {
+      static_cast<Root*>(static_cast<redisReply*>(obj))->elements = elements;
+    }
+    return obj;
+  }
+
+  static void* CreateInteger(const redisReadTask* task, long long value) {
+    ReplyData data;
+    data.type_ = ReplyData::Type::kInteger;
+    data.integer_ = value;
+    return Store(task, std::move(data));
+  }
+
+#if HIREDIS_MAJOR >= 1
+  static void* CreateDouble(const redisReadTask* task, double /*value*/,
+                            char* /*str*/, size_t /*len*/) {
+    return Store(task, ReplyData{});
+  }
+
+  static void* CreateBool(const redisReadTask* task, int /*value*/) {
+    return Store(task, ReplyData{});
+  }
+#endif
+
+  static void* CreateNil(const redisReadTask* task) {
+    return Store(task, ReplyData::CreateNil());
+  }
+
+  static void FreeObject(void* obj) {
+    delete static_cast<Root*>(static_cast<redisReply*>(obj));
+  }
+
+  static redisReplyObjectFunctions MakeFunctions() {
+    redisReplyObjectFunctions functions{};
+    functions.createString = &CreateString;
+    functions.createArray = &CreateArray;
+    functions.createInteger = &CreateInteger;
+#if HIREDIS_MAJOR >= 1
+    functions.createDouble = &CreateDouble;
+    functions.createBool = &CreateBool;
+#endif
+    functions.createNil = &CreateNil;
+    functions.freeObject = &FreeObject;
+    return functions;
+  }
+};
+
+redisReplyObjectFunctions& ReplyData::ReaderFunctions() {
+  static redisReplyObjectFunctions functions = ReplyDataReader::MakeFunctions();
+  return functions;
+}
+
+ReplyData ReplyData::ExtractFromReader(redisReply* reply) {
+  UASSERT(reply);
+  return std::move(static_cast<ReplyDataReader::Root*>(reply)->data);
+}
+
 std::string ReplyData::GetTypeString() const { return TypeToString(GetType()); }
 
 std::string ReplyData::ToDebugString() const {
@@ -273,6 +380,13 @@ Reply::Reply(std::string cmd, redisReply* redis_reply, ReplyStatus status,
 Reply::Reply(std::string cmd, ReplyData&& data)
     : cmd(std::move(cmd)), data(std::move(data)), status(ReplyStatus::kOk) {}
 
+Reply::Reply(std::string cmd, ReplyData&& data, ReplyStatus status,
+             std::string status_string)
+    : cmd(std::move(cmd)),
+      data(std::move(data)),
+      status(status),
+      status_string(std::move(status_string)) {}
+
 bool Reply::IsOk() const { return status == ReplyStatus::kOk; }
 
 bool Reply::IsLoggableError() const {
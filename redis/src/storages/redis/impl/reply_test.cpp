@@ -1,6 +1,10 @@
 #include <userver/storages/redis/impl/reply.hpp>
 
+#include <memory>
+#include <string_view>
+
 #include <gtest/gtest.h>
+#include <hiredis/hiredis.h>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -22,4 +26,44 @@ TEST(Reply, IsUnusableInstanceErrorERR) {
   EXPECT_FALSE(data.IsUnusableInstanceError());
 }
 
+TEST(Reply, ReaderFunctions) {
+  std::unique_ptr<redisReader, decltype(&redisReaderFree)> reader(
+      redisReaderCreate(), &redisReaderFree);
+  reader->fn = &redis::ReplyData::ReaderFunctions();
+
+  constexpr std::string_view kData =
+      "*4\r\n$5\r\nhello\r\n:42\r\n*2\r\n$-1\r\n+OK\r\n*0\r\n"
+      "-ERR wrong\r\n";
+  ASSERT_EQ(redisReaderFeed(reader.get(), kData.data(), kData.size()),
+            REDIS_OK);
+
+  void* reply = nullptr;
+  ASSERT_EQ(redisReaderGetReply(reader.get(), &reply), REDIS_OK);
+  ASSERT_NE(reply, nullptr);
+  auto* redis_reply = static_cast<redisReply*>(reply);
+  EXPECT_EQ(redis_reply->type, REDIS_REPLY_ARRAY);
+  auto data = redis::ReplyData::ExtractFromReader(redis_reply);
+  reader->fn->freeObject(reply);
+
+  ASSERT_TRUE(data.IsArray());
+  ASSERT_EQ(data.GetSize(), 4u);
+  EXPECT_EQ(data[0].GetString(), "hello");
+  EXPECT_EQ(data[1].GetInt(), 42);
+  ASSERT_TRUE(data[2].IsArray());
+  EXPECT_TRUE(data[2][0].IsNil());
+  EXPECT_EQ(data[2][1].GetStatus(), "OK");
+  EXPECT_TRUE(data[3].IsArray());
+  EXPECT_EQ(data[3].GetSize(), 0u);
+
+  ASSERT_EQ(redisReaderGetReply(reader.get(), &reply), REDIS_OK);
+  ASSERT_NE(reply, nullptr);
+  redis_reply = static_cast<redisReply*>(reply);
+  // hiredis reads the error message of the replies without callbacks
+  EXPECT_EQ(redis_reply->type, REDIS_REPLY_ERROR);
+  EXPECT_EQ(std::string_view(redis_reply->str, redis_reply->len), "ERR wrong");
+  EXPECT_EQ(redis::ReplyData::ExtractFromReader(redis_reply).GetError(),
+            "ERR wrong");
+  reader->fn->freeObject(reply);
+}
+
 USERVER_NAMESPACE_END
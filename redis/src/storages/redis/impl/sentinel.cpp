@@ -272,6 +272,12 @@ size_t Sentinel::ShardByKey(const std::string& key) const {
 
 size_t Sentinel::ShardsCount() const { return impl_->ShardsCount(); }
 
+bool Sentinel::IsInClusterMode() const { return impl_->IsInClusterMode(); }
+
+size_t Sentinel::HashSlot(const std::string& key) {
+  return SentinelImpl::HashSlot(key);
+}
+
 void Sentinel::CheckShardIdx(size_t shard_idx) const {
   CheckShardIdx(shard_idx, ShardsCount());
 }
@@ -344,7 +350,7 @@ void Sentinel::OnSubscribeReply(const MessageCallback message_callback,
   } else if (!strcasecmp(reply_array[0].GetString().c_str(), "MESSAGE")) {
     if (message_callback)
       message_callback(reply->server_id, reply_array[1].GetString(),
-                       reply_array[2].GetString());
+                       MessagePtr{reply, &reply_array[2].GetString()});
   }
 }
 
@@ -366,7 +372,8 @@ void Sentinel::OnPsubscribeReply(const PmessageCallback pmessage_callback,
   } else if (!strcasecmp(reply_array[0].GetString().c_str(), "PMESSAGE")) {
     if (reply_array.size() == 4 && pmessage_callback)
       pmessage_callback(reply->server_id, reply_array[1].GetString(),
-                        reply_array[2].GetString(), reply_array[3].GetString());
+                        reply_array[2].GetString(),
+                        MessagePtr{reply, &reply_array[3].GetString()});
   }
 }
 
@@ -113,6 +113,9 @@ class Sentinel {
 
   size_t ShardByKey(const std::string& key) const;
   size_t ShardsCount() const;
+  bool IsInClusterMode() const;
+  // Returns the cluster hash slot of the key
+  static size_t HashSlot(const std::string& key);
   void CheckShardIdx(size_t shard_idx) const;
   static void CheckShardIdx(size_t shard_idx, size_t shard_count);
 
@@ -174,18 +177,22 @@ class Sentinel {
   virtual void SetConfigDefaultCommandControl(
       const std::shared_ptr<CommandControl>& cc);
 
+  /// Payload of a pubsub message, shared by all the local subscribers and
+  /// owned by the reply it came in
+  using MessagePtr = std::shared_ptr<const std::string>;
+
   using UserMessageCallback = std::function<void(const std::string& channel,
-                                                 const std::string& message)>;
+                                                 const MessagePtr& message)>;
   using UserPmessageCallback =
       std::function<void(const std::string& pattern, const std::string& channel,
-                         const std::string& message)>;
+                         const MessagePtr& message)>;
 
   using MessageCallback =
       std::function<void(ServerId server_id, const std::string& channel,
-                         const std::string& message)>;
+                         const MessagePtr& message)>;
   using PmessageCallback = std::function<void(
       ServerId server_id, const std::string& pattern,
-      const std::string& channel, const std::string& message)>;
+      const std::string& channel, const MessagePtr& message)>;
   using SubscribeCallback =
       std::function<void(ServerId, const std::string& channel, size_t count)>;
   using UnsubscribeCallback =
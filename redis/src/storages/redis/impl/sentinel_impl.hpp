@@ -151,6 +151,8 @@ class SentinelImpl : public SentinelImplBase {
       const utils::RetryBudgetSettings& retry_budget_settings) override;
   PublishSettings GetPublishSettings() override;
 
+  static size_t HashSlot(const std::string& key);
+
  private:
   static constexpr const std::chrono::milliseconds cluster_slots_timeout_ =
       std::chrono::milliseconds(4000);
@@ -243,8 +245,6 @@ class SentinelImpl : public SentinelImplBase {
                   std::vector<std::shared_ptr<Shard>>& shard_objects,
                   const ReadyChangeCallback& ready_callback);
 
-  static size_t HashSlot(const std::string& key);
-
   void ProcessWaitingCommands();
 
   Sentinel& sentinel_obj_;
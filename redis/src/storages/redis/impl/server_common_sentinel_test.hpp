@@ -61,6 +61,9 @@ class SentinelShardTest {
   using MockRedisServerArray = std::vector<std::unique_ptr<MockRedisServer>>;
 
   redis::Sentinel& SentinelClient() const { return *sentinel_client_; }
+  const std::shared_ptr<redis::Sentinel>& SentinelClientPtr() const {
+    return sentinel_client_;
+  }
 
   MockRedisServerArray& Masters() { return masters_; }
   MockRedisServerArray& Slaves() { return slaves_; }
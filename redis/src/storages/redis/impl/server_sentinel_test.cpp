@@ -165,6 +165,36 @@ UTEST(Redis, SentinelMasterAndSlave) {
   }
 }
 
+UTEST(Redis, SentinelNearestServerLatency) {
+  const size_t master_count = 1;
+  const size_t slave_count = 2;
+  const size_t sentinel_count = 1;
+  const size_t request_count = 20;
+  const auto slow_reply = std::chrono::milliseconds(50);
+
+  SentinelTest sentinel_test(sentinel_count, master_count, slave_count);
+  auto& sentinel = sentinel_test.SentinelClient();
+
+  EXPECT_TRUE(sentinel_test.Slave(0).WaitForFirstPingReply(kSmallPeriod));
+  EXPECT_TRUE(sentinel_test.Slave(1).WaitForFirstPingReply(kSmallPeriod));
+
+  auto slow_handler = sentinel_test.Slave(0).RegisterTimeoutHandler(
+      "GET", {"value"}, slow_reply);
+  auto fast_handler =
+      sentinel_test.Slave(1).RegisterHandlerWithConstReply("GET", {"value"}, 1);
+
+  redis::CommandControl cc;
+  cc.strategy = redis::CommandControl::Strategy::kNearestServerLatency;
+  cc.best_dc_count = 1;
+  for (size_t i = 0; i < request_count; ++i) {
+    MakeGetRequest(sentinel, "value", cc).Get();
+  }
+
+  // the slow slave may get the first requests, until its latency is known
+  EXPECT_LE(slow_handler->GetReplyCount(), 2UL);
+  EXPECT_GE(fast_handler->GetReplyCount(), request_count - 2);
+}
+
 UTEST(Redis, SentinelCcRetryToMasterOnNilReply) {
   const size_t master_count = 1;
   const size_t slave_count = 1;
@@ -1,5 +1,7 @@
 #include "mock_server_test.hpp"
 
+#include <atomic>
+#include <memory>
 #include <thread>
 
 #include <userver/storages/redis/impl/base.hpp>
@@ -42,6 +44,27 @@ bool IsConnected(const redis::Redis& redis) {
   return redis.GetState() == redis::RedisState::kConnected;
 }
 
+std::shared_ptr<redis::Redis> MakeConnectedRedis(
+    const std::shared_ptr<redis::ThreadPools>& pool,
+    const MockRedisServer& server) {
+  redis::RedisCreationSettings redis_settings;
+  auto redis = std::make_shared<redis::Redis>(pool->GetRedisThreadPool(),
+                                              redis_settings);
+  redis->Connect({kLocalhost}, server.GetPort(), redis::Password(""));
+  PeriodicWait([&] { return IsConnected(*redis); });
+  return redis;
+}
+
+void GetAndWaitForReply(redis::Redis& redis) {
+  auto replied = std::make_shared<std::atomic<bool>>(false);
+  auto cmd = redis::PrepareCommand(
+      {"GET", "123"}, [replied](const redis::CommandPtr&, redis::ReplyPtr) {
+        *replied = true;
+      });
+  redis.AsyncCommand(cmd);
+  PeriodicWait([&] { return replied->load(); });
+}
+
 }  // namespace
 
 TEST(Redis, NoPassword) {
@@ -184,4 +207,39 @@ TEST_P(RedisDisconnectingReplies, X) {
   PeriodicWait([&] { return !IsConnected(*redis); });
 }
 
+TEST(Redis, ExpectedLatency) {
+  constexpr std::chrono::milliseconds kSlowReply{50};
+  constexpr size_t kRequests = 5;
+
+  MockRedisServer fast_server;
+  auto fast_ping_handler = fast_server.RegisterPingHandler();
+  auto fast_handler = fast_server.RegisterHandlerWithConstReply("GET", 1);
+  MockRedisServer slow_server;
+  auto slow_ping_handler = slow_server.RegisterPingHandler();
+  auto slow_handler = slow_server.RegisterTimeoutHandler("GET", kSlowReply);
+
+  auto pool = std::make_shared<redis::ThreadPools>(1, 1);
+  auto fast = MakeConnectedRedis(pool, fast_server);
+  auto slow = MakeConnectedRedis(pool, slow_server);
+
+  for (size_t i = 0; i < kRequests; ++i) {
+    GetAndWaitForReply(*fast);
+    GetAndWaitForReply(*slow);
+  }
+  EXPECT_EQ(fast_handler->GetReplyCount(), kRequests);
+  EXPECT_EQ(slow_handler->GetReplyCount(), kRequests);
+
+  // the moving average has moved at least this far towards the slow replies
+  const auto slow_latency = slow->GetExpectedLatency();
+  EXPECT_GE(slow_latency, kSlowReply / 4);
+  EXPECT_LT(fast->GetExpectedLatency(), slow_latency);
+
+  // a command in flight has to be waited for too
+  auto cmd = redis::PrepareCommand(
+      {"GET", "123"}, [](const redis::CommandPtr&, redis::ReplyPtr) {});
+  slow->AsyncCommand(cmd);
+  PeriodicWait([&] { return slow->GetRunningCommands() > 0; });
+  EXPECT_GT(slow->GetExpectedLatency(), slow_latency * 3 / 2);
+}
+
 USERVER_NAMESPACE_END
@@ -134,6 +134,7 @@ std::vector<unsigned char> Shard::GetAvailableServers(
 
     case CommandControl::Strategy::kLocalDcConductor:
     case CommandControl::Strategy::kNearestServerPing:
+    case CommandControl::Strategy::kNearestServerLatency:
       return GetNearestServersPing(command_control, with_masters, with_slaves);
   }
 
@@ -145,7 +146,10 @@ std::vector<unsigned char> Shard::GetAvailableServers(
 std::vector<unsigned char> Shard::GetNearestServersPing(
     const CommandControl& command_control, bool with_masters,
     bool with_slaves) const {
-  auto count = CommandControlImpl{command_control}.best_dc_count;
+  const CommandControlImpl cc{command_control};
+  const auto by_latency =
+      cc.strategy == CommandControl::Strategy::kNearestServerLatency;
+  auto count = cc.best_dc_count;
   if (count == 0) count = instances_.size();
 
   using PairPingNum = std::pair<size_t, size_t>;
@@ -154,7 +158,8 @@ std::vector<unsigned char> Shard::GetNearestServersPing(
   sorted_by_ping.reserve(instances_.size());
   for (size_t i = 0; i < instances_.size(); i++) {
     const auto& cur_inst = instances_[i].instance;
-    size_t ping = cur_inst->GetPingLatency().count();
+    size_t ping = by_latency ? cur_inst->GetExpectedLatency().count()
+                             : cur_inst->GetPingLatency().count();
     sorted_by_ping.emplace_back(ping, i);
   }
 
@@ -349,15 +349,17 @@ template <typename CallbackMap, typename PcallbackMap>
 CommandPtr SubscriptionStorageBase::
     SubscriptionStorageImpl<CallbackMap, PcallbackMap>::PrepareSubscribeCommand(
         const ChannelName& channel_name, SubscribeCb cb, size_t shard_idx) {
-  const auto message_callback = [this, shard_idx](ServerId server_id,
-                                                  const std::string& channel,
-                                                  const std::string& message) {
+  const auto message_callback = [this, shard_idx](
+                                    ServerId server_id,
+                                    const std::string& channel,
+                                    const Sentinel::MessagePtr& message) {
     OnMessage(server_id, channel, message, shard_idx);
   };
-  const auto pmessage_callback = [this, shard_idx](ServerId server_id,
-                                                   const std::string& pattern,
-                                                   const std::string& channel,
-                                                   const std::string& message) {
+  const auto pmessage_callback = [this, shard_idx](
+                                     ServerId server_id,
+                                     const std::string& pattern,
+                                     const std::string& channel,
+                                     const Sentinel::MessagePtr& message) {
     OnPmessage(server_id, pattern, channel, message, shard_idx);
   };
   const auto subscribe_callback = [cb](ServerId server_id,
@@ -399,7 +401,7 @@ template <typename CallbackMap, typename PcallbackMap>
 void SubscriptionStorageBase::SubscriptionStorageImpl<
     CallbackMap, PcallbackMap>::OnMessage(ServerId server_id,
                                           const std::string& channel,
-                                          const std::string& message,
+                                          const Sentinel::MessagePtr& message,
                                           size_t shard_idx) {
   try {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -412,7 +414,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
       }
     }
 
-    m.GetInfo(shard_idx).AccountMessage(server_id, message.size());
+    m.GetInfo(shard_idx).AccountMessage(server_id, message->size());
   } catch (const std::out_of_range& e) {
     LOG_ERROR() << "Got MESSAGE while not subscribed on it, channel="
                 << channel;
@@ -424,7 +426,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
     CallbackMap, PcallbackMap>::OnPmessage(ServerId server_id,
                                            const std::string& pattern,
                                            const std::string& channel,
-                                           const std::string& message,
+                                           const Sentinel::MessagePtr& message,
                                            size_t shard_idx) {
   try {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -437,7 +439,7 @@ void SubscriptionStorageBase::SubscriptionStorageImpl<
       }
     }
 
-    m.GetInfo(shard_idx).AccountMessage(server_id, message.size());
+    m.GetInfo(shard_idx).AccountMessage(server_id, message->size());
   } catch (const std::out_of_range& e) {
     LOG_ERROR() << "Got PMESSAGE while not subscribed on it, channel="
                 << channel;
@@ -114,11 +114,12 @@ class SubscriptionStorageBase
   };
 
  protected:
-  using MessageCallback = std::function<void(
-      ServerId, const std::string& channel, const std::string& message)>;
+  using MessageCallback =
+      std::function<void(ServerId, const std::string& channel,
+                         const Sentinel::MessagePtr& message)>;
   using PmessageCallback = std::function<void(
       ServerId, const std::string& pattern, const std::string& channel,
-      const std::string& message)>;
+      const Sentinel::MessagePtr& message)>;
 
   struct ChannelName {
     ChannelName() = default;
@@ -181,10 +182,10 @@ class SubscriptionStorageBase
                                        SubscribeCb cb, size_t shard_idx);
 
     void OnMessage(ServerId server_id, const std::string& channel,
-                   const std::string& message, size_t shard_idx);
+                   const Sentinel::MessagePtr& message, size_t shard_idx);
     void OnPmessage(ServerId server_id, const std::string& pattern,
-                    const std::string& channel, const std::string& message,
-                    size_t shard_idx);
+                    const std::string& channel,
+                    const Sentinel::MessagePtr& message, size_t shard_idx);
     size_t GetChannelsCountApprox() const;
     PubsubShardStatistics GetShardStatistics(size_t shard_idx) const;
     RawPubsubClusterStatistics GetStatistics() const;
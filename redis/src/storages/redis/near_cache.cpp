@@ -0,0 +1,152 @@
+#include <userver/storages/redis/near_cache.hpp>
+
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/storages/redis/subscribe_client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// Channels of the keyspace notifications are `__keyspace@<db>__:<key>`
+constexpr std::string_view kKeyspaceSeparator = "__:";
+
+std::string EscapeGlob(std::string_view prefix) {
+  std::string result;
+  result.reserve(prefix.size());
+  for (const char c : prefix) {
+    if (c == '*' || c == '?' || c == '[' || c == ']' || c == '\\') {
+      result.push_back('\\');
+    }
+    result.push_back(c);
+  }
+  return result;
+}
+
+}  // namespace
+
+NearCache::NearCache(ClientPtr client, SubscribeClientPtr subscribe_client,
+                     Settings settings)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      cache_(settings_.ways, settings_.way_size, {}, {},
+             cache::CachePolicy::kClock) {
+  UASSERT(client_);
+  UASSERT(subscribe_client);
+
+  subscriptions_.reserve(settings_.prefixes.size());
+  for (const auto& prefix : settings_.prefixes) {
+    subscriptions_.push_back(subscribe_client->Psubscribe(
+        fmt::format("__keyspace@*__:{}*", EscapeGlob(prefix)),
+        [this](const std::string& /*pattern*/, const std::string& channel,
+               const std::string& /*message*/) { OnKeyspaceEvent(channel); }));
+  }
+}
+
+NearCache::~NearCache() = default;
+
+std::optional<std::string> NearCache::Get(
+    std::string key, const CommandControl& command_control) {
+  if (!IsCached(key)) {
+    return client_->Get(std::move(key), command_control).Get();
+  }
+
+  // The epoch is taken before the entry is read, it is stored back below
+  const auto epoch = epoch_.load();
+  auto entry = GetEntry(key);
+  if (entry.value) {
+    ++hits_;
+    return *entry.value;
+  }
+  ++misses_;
+
+  auto value = client_->Get(key, command_control).Get();
+  entry.value = value;
+  Store(key, std::move(entry), epoch);
+  return value;
+}
+
+std::optional<std::string> NearCache::Hget(
+    std::string key, std::string field, const CommandControl& command_control) {
+  if (!IsCached(key)) {
+    return client_->Hget(std::move(key), std::move(field), command_control)
+        .Get();
+  }
+
+  const auto epoch = epoch_.load();
+  auto entry = GetEntry(key);
+  if (const auto it = entry.fields.find(field); it != entry.fields.end()) {
+    ++hits_;
+    return it->second;
+  }
+  ++misses_;
+
+  auto value = client_->Hget(key, field, command_control).Get();
+  entry.fields.emplace(std::move(field), value);
+  Store(key, std::move(entry), epoch);
+  return value;
+}
+
+void NearCache::Invalidate() {
+  ++epoch_;
+  cache_.Invalidate();
+}
+
+bool NearCache::IsCached(const std::string& key) const {
+  for (const auto& prefix : settings_.prefixes) {
+    if (std::string_view{key}.substr(0, prefix.size()) == prefix) return true;
+  }
+  return false;
+}
+
+NearCache::Entry NearCache::GetEntry(const std::string& key) {
+  const auto now = std::chrono::steady_clock::now();
+  auto entry = cache_.Get(
+      key, [now](const Entry& entry) { return entry.expiration > now; });
+  if (entry) return std::move(*entry);
+
+  Entry result;
+  result.expiration = now + settings_.max_lifetime;
+  return result;
+}
+
+void NearCache::Store(const std::string& key, Entry&& entry,
+                      std::uint64_t epoch) {
+  cache_.Put(key, std::move(entry));
+  // A notification that arrived while the reply was being read may have
+  // missed the entry that is stored only now
+  if (epoch_.load() != epoch) cache_.InvalidateByKey(key);
+}
+
+void NearCache::OnKeyspaceEvent(const std::string& channel) {
+  const auto pos = channel.find(kKeyspaceSeparator);
+  if (pos == std::string::npos) {
+    LOG_LIMITED_WARNING() << "Unexpected keyspace notification channel '"
+                          << channel << "'";
+    return;
+  }
+
+  ++epoch_;
+  ++invalidations_;
+  cache_.InvalidateByKey(channel.substr(pos + kKeyspaceSeparator.size()));
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const NearCache& cache) {
+  writer["hits"] = cache.hits_.Load();
+  writer["misses"] = cache.misses_.Load();
+  writer["invalidations"] = cache.invalidations_.Load();
+  writer["size"] = cache.cache_.GetSize();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
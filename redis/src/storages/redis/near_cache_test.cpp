@@ -0,0 +1,81 @@
+#include <userver/storages/redis/near_cache.hpp>
+
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/storages/redis/mock_subscribe_client.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::test {
+
+using testing::_;
+
+UTEST(NearCache, GetAndInvalidate) {
+  auto client = std::make_shared<GMockClient>();
+  auto subscribe_client = std::make_shared<MockSubscribeClient>();
+
+  SubscriptionToken::OnPmessageCb on_event;
+  EXPECT_CALL(*subscribe_client, Psubscribe("__keyspace@*__:flags:*", _, _))
+      .WillOnce([&](std::string, SubscriptionToken::OnPmessageCb callback,
+                    const USERVER_NAMESPACE::redis::CommandControl&) {
+        on_event = std::move(callback);
+        return SubscriptionToken{};
+      });
+
+  /// [NearCache]
+  NearCache::Settings settings;
+  settings.prefixes = {"flags:"};
+  NearCache cache{client, subscribe_client, std::move(settings)};
+  /// [NearCache]
+  ASSERT_TRUE(on_event);
+
+  EXPECT_CALL(*client, Get("flags:a", _))
+      .Times(2)
+      .WillRepeatedly([](std::string, const CommandControl&) {
+        return CreateMockRequest<RequestGet>(std::string{"1"});
+      });
+  EXPECT_EQ(cache.Get("flags:a", {}), "1");
+  EXPECT_EQ(cache.Get("flags:a", {}), "1");
+
+  on_event("__keyspace@*__:flags:*", "__keyspace@0__:flags:a", "set");
+  EXPECT_EQ(cache.Get("flags:a", {}), "1");
+}
+
+UTEST(NearCache, HgetAndUncachedKeys) {
+  auto client = std::make_shared<GMockClient>();
+  auto subscribe_client = std::make_shared<MockSubscribeClient>();
+  EXPECT_CALL(*subscribe_client, Psubscribe(_, _, _))
+      .WillOnce(testing::Return(testing::ByMove(SubscriptionToken{})));
+
+  NearCache::Settings settings;
+  settings.prefixes = {"session:"};
+  NearCache cache{client, subscribe_client, std::move(settings)};
+
+  EXPECT_CALL(*client, Hget("session:1", "user", _))
+      .WillOnce([](std::string, std::string, const CommandControl&) {
+        return CreateMockRequest<RequestHget>(std::nullopt);
+      });
+  EXPECT_EQ(cache.Hget("session:1", "user", {}), std::nullopt);
+  EXPECT_EQ(cache.Hget("session:1", "user", {}), std::nullopt);
+
+  // The keys without the prefixes are always read from Redis
+  EXPECT_CALL(*client, Get("other", _))
+      .Times(2)
+      .WillRepeatedly([](std::string, const CommandControl&) {
+        return CreateMockRequest<RequestGet>(std::nullopt);
+      });
+  EXPECT_EQ(cache.Get("other", {}), std::nullopt);
+  EXPECT_EQ(cache.Get("other", {}), std::nullopt);
+
+  cache.Invalidate();
+  EXPECT_CALL(*client, Hget("session:1", "user", _))
+      .WillOnce([](std::string, std::string, const CommandControl&) {
+        return CreateMockRequest<RequestHget>(std::string{"alice"});
+      });
+  EXPECT_EQ(cache.Hget("session:1", "user", {}), "alice");
+}
+
+}  // namespace storages::redis::test
+
+USERVER_NAMESPACE_END
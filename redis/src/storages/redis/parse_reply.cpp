@@ -10,6 +10,7 @@ namespace {
 
 const std::string kOk{"OK"};
 const std::string kPong{"PONG"};
+const std::string kBusyGroup{"BUSYGROUP "};
 
 std::string ExtractStringElem(ReplyData& array_data, size_t elem_idx,
                               const std::string& request_description) {
@@ -65,6 +66,38 @@ Point ParsePointArray(const redis::ReplyData& elem,
   }
 }
 
+[[noreturn]] void ThrowUnexpectedStreamReply(
+    const ReplyData& reply_data, const std::string& request_description) {
+  throw USERVER_NAMESPACE::redis::ParseReplyException(
+      "Unexpected stream reply to '" + request_description +
+      "': " + reply_data.ToDebugString());
+}
+
+// The entry is `[id, [field, value, ...]]`, the fields are nil if the entry
+// has been deleted while pending
+StreamEntry ParseStreamEntry(ReplyData& entry_data,
+                             const std::string& request_description) {
+  if (!entry_data.IsArray() || entry_data.GetSize() != 2 ||
+      !entry_data[0].IsString()) {
+    ThrowUnexpectedStreamReply(entry_data, request_description);
+  }
+
+  StreamEntry entry;
+  entry.id = std::move(entry_data[0].GetString());
+  auto& fields_data = entry_data[1];
+  if (fields_data.IsNil()) return entry;
+  if (!fields_data.IsArray()) {
+    ThrowUnexpectedStreamReply(entry_data, request_description);
+  }
+
+  auto key_values = GetKeyValues(fields_data, request_description);
+  entry.fields.reserve(key_values.size());
+  for (auto elem : key_values) {
+    entry.fields.emplace_back(std::move(elem.Key()), std::move(elem.Value()));
+  }
+  return entry;
+}
+
 }  // namespace
 
 namespace impl {
@@ -227,6 +260,19 @@ std::vector<GeoPoint> ParseReplyDataArray(
   return result;
 }
 
+std::vector<StreamEntry> ParseReplyDataArray(
+    ReplyData&& array_data, const std::string& request_description,
+    To<std::vector<StreamEntry>>) {
+  auto& array = array_data.GetArray();
+  std::vector<StreamEntry> result;
+  result.reserve(array.size());
+
+  for (auto& elem : array) {
+    result.push_back(ParseStreamEntry(elem, request_description));
+  }
+  return result;
+}
+
 std::string Parse(ReplyData&& reply_data,
                   const std::string& request_description, To<std::string>) {
   reply_data.ExpectString(request_description);
@@ -346,6 +392,35 @@ SetReply Parse(ReplyData&& reply_data, const std::string& request_description,
   return SetReply::kSet;
 }
 
+XautoclaimReply Parse(ReplyData&& reply_data,
+                      const std::string& request_description,
+                      To<XautoclaimReply>) {
+  reply_data.ExpectArray(request_description);
+  // Redis 7 adds the IDs of the deleted entries as the third element
+  if (reply_data.GetSize() < 2 || !reply_data[0].IsString() ||
+      !reply_data[1].IsArray()) {
+    ThrowUnexpectedStreamReply(reply_data, request_description);
+  }
+
+  XautoclaimReply result;
+  result.next_start_id = std::move(reply_data[0].GetString());
+  result.entries = ParseReplyDataArray(std::move(reply_data[1]),
+                                       request_description,
+                                       To<std::vector<StreamEntry>>{});
+  return result;
+}
+
+XgroupCreateReply Parse(ReplyData&& reply_data,
+                        const std::string& request_description,
+                        To<XgroupCreateReply>) {
+  if (reply_data.IsError() &&
+      !reply_data.GetError().compare(0, kBusyGroup.size(), kBusyGroup)) {
+    return XgroupCreateReply::kAlreadyExists;
+  }
+  reply_data.ExpectStatusEqualTo(kOk, request_description);
+  return XgroupCreateReply::kCreated;
+}
+
 std::unordered_set<std::string> Parse(ReplyData&& reply_data,
                                       const std::string& request_description,
                                       To<std::unordered_set<std::string>>) {
@@ -383,6 +458,23 @@ ReplyData Parse(ReplyData&& reply_data, const std::string&, To<ReplyData>) {
   return std::move(reply_data);
 }
 
+std::vector<StreamEntry> XreadgroupReply::Parse(
+    ReplyData&& reply_data, const std::string& request_description) {
+  // The reply is nil if the read has timed out, otherwise it is
+  // `[[key, [entry, ...]]]`
+  if (reply_data.IsNil()) return {};
+  reply_data.ExpectArray(request_description);
+  if (reply_data.GetSize() == 0) return {};
+
+  auto& stream_data = reply_data[0];
+  if (reply_data.GetSize() != 1 || !stream_data.IsArray() ||
+      stream_data.GetSize() != 2 || !stream_data[1].IsArray()) {
+    ThrowUnexpectedStreamReply(reply_data, request_description);
+  }
+  return ParseReplyDataArray(std::move(stream_data[1]), request_description,
+                             To<std::vector<StreamEntry>>{});
+}
+
 }  // namespace storages::redis
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,195 @@
+#include <userver/storages/redis/read_coalescer.hpp>
+
+#include <algorithm>
+
+#include <userver/engine/exception.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// Hash field names may contain any bytes, the key goes last to keep the ids
+// of the different pairs different
+std::string HgetId(const std::string& key, const std::string& field) {
+  std::string id = std::to_string(field.size());
+  id.push_back(':');
+  id += field;
+  id += key;
+  return id;
+}
+
+}  // namespace
+
+ReadCoalescer::ReadCoalescer(ClientPtr client, Settings settings)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      next_decay_(std::chrono::steady_clock::now() +
+                  settings_.decay_interval) {
+  UASSERT(client_);
+  UINVARIANT(settings_.sample_rate > 0 && settings_.sketch_size > 0,
+             "sample_rate and sketch_size must be positive");
+}
+
+ReadCoalescer::~ReadCoalescer() = default;
+
+std::optional<std::string> ReadCoalescer::Get(
+    std::string key, const CommandControl& command_control) {
+  Account(key);
+  if (!settings_.coalesce) {
+    return client_->Get(std::move(key), command_control).Get();
+  }
+
+  auto id = key;
+  return Coalesce(gets_, std::move(id),
+                  [&] { return client_->Get(key, command_control).Get(); });
+}
+
+std::optional<std::string> ReadCoalescer::Hget(
+    std::string key, std::string field, const CommandControl& command_control) {
+  Account(key);
+  if (!settings_.coalesce) {
+    return client_->Hget(std::move(key), std::move(field), command_control)
+        .Get();
+  }
+
+  return Coalesce(hgets_, HgetId(key, field), [&] {
+    return client_->Hget(key, field, command_control).Get();
+  });
+}
+
+std::unordered_map<std::string, std::string> ReadCoalescer::Hgetall(
+    std::string key, const CommandControl& command_control) {
+  Account(key);
+  if (!settings_.coalesce) {
+    return client_->Hgetall(std::move(key), command_control).Get();
+  }
+
+  auto id = key;
+  return Coalesce(hgetalls_, std::move(id), [&] {
+    return client_->Hgetall(key, command_control).Get();
+  });
+}
+
+template <typename Reply, typename Read>
+Reply ReadCoalescer::Coalesce(InFlight<Reply>& in_flight, std::string id,
+                              const Read& read) {
+  std::shared_ptr<Pending<Reply>> pending;
+  bool is_leader = false;
+  {
+    std::lock_guard lock(in_flight_mutex_);
+    auto& slot = in_flight[id];
+    if (!slot) {
+      slot = std::make_shared<Pending<Reply>>();
+      is_leader = true;
+    }
+    pending = slot;
+  }
+
+  if (!is_leader) {
+    ++coalesced_;
+    std::unique_lock lock(pending->mutex);
+    if (!pending->cv.Wait(lock, [&] { return pending->done; })) {
+      throw engine::WaitInterruptedException(
+          engine::current_task::CancellationReason());
+    }
+    if (pending->reply) return *pending->reply;
+    // The first read has failed, it is up to each task to retry
+    lock.unlock();
+    return read();
+  }
+
+  // Wakes the waiters up even if the read fails
+  const utils::FastScopeGuard complete([&]() noexcept {
+    {
+      std::lock_guard lock(in_flight_mutex_);
+      in_flight.erase(id);
+    }
+    {
+      std::lock_guard lock(pending->mutex);
+      pending->done = true;
+    }
+    pending->cv.NotifyAll();
+  });
+
+  auto reply = read();
+  // The waiters only read the reply after `done` is set under the mutex
+  pending->reply = reply;
+  return reply;
+}
+
+void ReadCoalescer::Account(const std::string& key) {
+  ++reads_;
+  if (settings_.sample_rate > 1 &&
+      utils::RandRange(settings_.sample_rate) != 0) {
+    return;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  std::lock_guard lock(sketch_mutex_);
+  if (now >= next_decay_) {
+    for (auto& [_, counter] : counters_) counter /= 2;
+    next_decay_ = now + settings_.decay_interval;
+  }
+
+  if (auto it = counters_.find(key); it != counters_.end()) {
+    ++it->second;
+    return;
+  }
+  if (counters_.size() < settings_.sketch_size) {
+    counters_.emplace(key, 1);
+    return;
+  }
+
+  // Space-Saving: the new key replaces the least read one and inherits its
+  // counter, so a key that becomes hot climbs up quickly
+  const auto min = std::min_element(
+      counters_.begin(), counters_.end(),
+      [](const auto& l, const auto& r) { return l.second < r.second; });
+  const auto counter = min->second + 1;
+  counters_.erase(min);
+  counters_.emplace(key, counter);
+}
+
+std::vector<ReadCoalescer::HotKey> ReadCoalescer::GetHotKeys() const {
+  std::vector<HotKey> result;
+  {
+    std::lock_guard lock(sketch_mutex_);
+    result.assign(counters_.begin(), counters_.end());
+  }
+
+  const auto count = std::min(settings_.hot_keys_count, result.size());
+  std::partial_sort(
+      result.begin(), result.begin() + count, result.end(),
+      [](const auto& l, const auto& r) { return l.second > r.second; });
+  result.resize(count);
+
+  // A counter of a key read steadily at `rate` converges to
+  // 2 * rate * decay_interval / sample_rate
+  const auto interval =
+      std::chrono::duration<double>(settings_.decay_interval).count();
+  for (auto& [_, rate] : result) {
+    rate *= static_cast<double>(settings_.sample_rate) / (2 * interval);
+  }
+  return result;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ReadCoalescer& coalescer) {
+  writer["reads"] = coalescer.reads_.Load();
+  writer["coalesced"] = coalescer.coalesced_.Load();
+  for (const auto& [key, rate] : coalescer.GetHotKeys()) {
+    writer["hot_keys"].ValueWithLabels(rate, {"redis_key", key});
+  }
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
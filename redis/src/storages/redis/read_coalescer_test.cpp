@@ -0,0 +1,74 @@
+#include <userver/storages/redis/read_coalescer.hpp>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/async.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::test {
+
+using testing::_;
+
+UTEST(ReadCoalescer, CoalesceGet) {
+  auto client = std::make_shared<testing::NiceMock<GMockClient>>();
+
+  engine::SingleConsumerEvent read_started;
+  engine::SingleConsumerEvent release;
+  EXPECT_CALL(*client, Get("hot", _)).WillOnce([&](auto&&...) {
+    read_started.Send();
+    EXPECT_TRUE(release.WaitForEvent());
+    return CreateMockRequest<RequestGet>(std::string{"value"});
+  });
+
+  /// [ReadCoalescer]
+  ReadCoalescer coalescer{client, {}};
+  /// [ReadCoalescer]
+
+  std::vector<engine::TaskWithResult<std::optional<std::string>>> tasks;
+  tasks.push_back(
+      utils::Async("leader", [&] { return coalescer.Get("hot", {}); }));
+  ASSERT_TRUE(read_started.WaitForEvent());
+
+  for (int i = 0; i < 3; ++i) {
+    tasks.push_back(
+        utils::Async("follower", [&] { return coalescer.Get("hot", {}); }));
+  }
+  // Lets the followers run until they wait for the reply
+  for (int i = 0; i < 10; ++i) engine::Yield();
+  release.Send();
+
+  for (auto& task : tasks) EXPECT_EQ(task.Get(), "value");
+}
+
+UTEST(ReadCoalescer, HotKeys) {
+  auto client = std::make_shared<testing::NiceMock<GMockClient>>();
+  ON_CALL(*client, Get(_, _)).WillByDefault([](auto&&...) {
+    return CreateMockRequest<RequestGet>(std::nullopt);
+  });
+
+  ReadCoalescer::Settings settings;
+  settings.coalesce = false;
+  settings.sample_rate = 1;
+  settings.sketch_size = 2;
+  settings.hot_keys_count = 1;
+  settings.decay_interval = std::chrono::hours{1};
+  ReadCoalescer coalescer{client, settings};
+
+  for (int i = 0; i < 3; ++i) EXPECT_EQ(coalescer.Get("a", {}), std::nullopt);
+  EXPECT_EQ(coalescer.Get("b", {}), std::nullopt);
+  // Replaces "b" and takes over its counter
+  EXPECT_EQ(coalescer.Get("c", {}), std::nullopt);
+
+  const auto hot_keys = coalescer.GetHotKeys();
+  ASSERT_EQ(hot_keys.size(), 1u);
+  EXPECT_EQ(hot_keys[0].first, "a");
+  EXPECT_GT(hot_keys[0].second, 0);
+}
+
+}  // namespace storages::redis::test
+
+USERVER_NAMESPACE_END
@@ -62,7 +62,9 @@ USERVER_NAMESPACE::redis::CommandControl Parse(
   if (result.best_dc_count.has_value() && result.strategy.has_value() &&
       (*result.best_dc_count > 1) &&
       (*result.strategy != USERVER_NAMESPACE::redis::CommandControl::Strategy::
-                               kNearestServerPing)) {
+                               kNearestServerPing) &&
+      (*result.strategy != USERVER_NAMESPACE::redis::CommandControl::Strategy::
+                               kNearestServerLatency)) {
     LOG_WARNING() << "CommandControl.best_dc_count = " << *result.best_dc_count
                   << ", but is ignored for the current strategy ("
                   << static_cast<size_t>(*result.strategy) << ")";
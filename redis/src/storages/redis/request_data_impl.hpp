@@ -2,6 +2,8 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/request.hpp>
@@ -85,6 +87,14 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   explicit AggregateRequestDataImpl(std::vector<RequestDataPtr>&& requests)
       : requests_(std::move(requests)) {}
 
+  // The reply elements of each request are placed at the given positions of
+  // the result, e.g. at the positions of their keys in the original command
+  AggregateRequestDataImpl(std::vector<RequestDataPtr>&& requests,
+                           std::vector<std::vector<size_t>>&& positions)
+      : requests_(std::move(requests)), positions_(std::move(positions)) {
+    UASSERT(positions_.empty() || requests_.size() == positions_.size());
+  }
+
   void Wait() override {
     for (auto& request : requests_) {
       request->Wait();
@@ -92,12 +102,31 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
   }
 
   ReplyType Get(const std::string& request_description) override {
-    std::vector<typename ReplyType::value_type> result;
-    for (auto& request : requests_) {
-      auto data = request->Get(request_description);
-      std::move(data.begin(), data.end(), std::back_inserter(result));
+    if constexpr (std::is_void_v<ReplyType>) {
+      for (auto& request : requests_) request->Get(request_description);
+    } else {
+      std::vector<typename ReplyType::value_type> result;
+      if (positions_.empty()) {
+        for (auto& request : requests_) {
+          auto data = request->Get(request_description);
+          std::move(data.begin(), data.end(), std::back_inserter(result));
+        }
+        return result;
+      }
+
+      size_t size = 0;
+      for (const auto& positions : positions_) size += positions.size();
+      result.resize(size);
+      for (size_t i = 0; i < requests_.size(); ++i) {
+        auto data = requests_[i]->Get(request_description);
+        UINVARIANT(data.size() == positions_[i].size(),
+                   "Unexpected number of the reply elements");
+        for (size_t j = 0; j < data.size(); ++j) {
+          result[positions_[i][j]] = std::move(data[j]);
+        }
+      }
+      return result;
     }
-    return result;
   }
 
   ReplyPtr GetRaw() override {
@@ -112,6 +141,7 @@ class AggregateRequestDataImpl final : public RequestDataBase<ReplyType> {
 
  private:
   std::vector<RequestDataPtr> requests_;
+  std::vector<std::vector<size_t>> positions_;
 };
 
 template <typename Result, typename ReplyType>
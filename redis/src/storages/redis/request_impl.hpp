@@ -22,6 +22,7 @@ Request<Result, ReplyType> CreateRequest(
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions,
     Request<Result, ReplyType>* /* for ADL */) {
   std::vector<std::unique_ptr<RequestDataBase<ReplyType>>> req_data;
   req_data.reserve(requests.size());
@@ -31,7 +32,7 @@ Request<Result, ReplyType> CreateAggregateRequest(
   }
   return Request<Result, ReplyType>(
       std::make_unique<AggregateRequestDataImpl<Result, ReplyType>>(
-          std::move(req_data)));
+          std::move(req_data), std::move(positions)));
 }
 
 template <typename Result, typename ReplyType = Result>
@@ -54,7 +55,17 @@ template <typename Request>
 Request CreateAggregateRequest(
     std::vector<USERVER_NAMESPACE::redis::Request>&& requests) {
   Request* tmp = nullptr;
-  return impl::CreateAggregateRequest(std::move(requests), tmp);
+  return impl::CreateAggregateRequest(std::move(requests), {}, tmp);
+}
+
+// The reply elements of the requests are placed at the `positions`
+template <typename Request>
+Request CreateAggregateRequest(
+    std::vector<USERVER_NAMESPACE::redis::Request>&& requests,
+    std::vector<std::vector<size_t>>&& positions) {
+  Request* tmp = nullptr;
+  return impl::CreateAggregateRequest(std::move(requests), std::move(positions),
+                                      tmp);
 }
 
 template <typename Request>
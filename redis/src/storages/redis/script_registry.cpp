@@ -0,0 +1,63 @@
+#include <userver/storages/redis/script_registry.hpp>
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+ScriptRegistry::ScriptRegistry(ClientPtr client, const Scripts& scripts)
+    : client_(std::move(client)) {
+  UASSERT(client_);
+  for (const auto& [name, body] : scripts) {
+    scripts_.emplace(name, Script{body, crypto::hash::Sha1(body)});
+  }
+}
+
+void ScriptRegistry::Preload(const CommandControl& command_control) const {
+  std::vector<RequestScriptLoad> requests;
+  const auto shards_count = client_->ShardsCount();
+  requests.reserve(shards_count * scripts_.size());
+  for (size_t shard = 0; shard < shards_count; ++shard) {
+    for (const auto& [name, script] : scripts_) {
+      requests.push_back(
+          client_->ScriptLoad(script.body, shard, command_control));
+    }
+  }
+
+  for (auto& request : requests) request.Get();
+}
+
+const std::string& ScriptRegistry::GetSha(const std::string& name) const {
+  return GetScript(name).sha;
+}
+
+const ScriptRegistry::Script& ScriptRegistry::GetScript(
+    const std::string& name) const {
+  const auto it = scripts_.find(name);
+  if (it == scripts_.end()) {
+    throw std::out_of_range(fmt::format("Unknown Redis script '{}'", name));
+  }
+  return it->second;
+}
+
+void ScriptRegistry::Load(const Script& script, const std::string& key,
+                          const CommandControl& command_control) const {
+  const auto shard =
+      command_control.force_shard_idx.value_or(client_->ShardByKey(key));
+  LOG_LIMITED_INFO() << "Loading the Redis script " << script.sha
+                     << " to the shard " << shard;
+  [[maybe_unused]] const auto sha =
+      client_->ScriptLoad(script.body, shard, command_control).Get();
+  UASSERT(sha == script.sha);
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,83 @@
+#include <userver/storages/redis/script_registry.hpp>
+
+#include <userver/crypto/hash.hpp>
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::test {
+
+using testing::_;
+
+namespace {
+
+constexpr std::string_view kScript = "return redis.call('GET', KEYS[1])";
+
+}  // namespace
+
+UTEST(ScriptRegistry, EvalSha) {
+  auto client = std::make_shared<testing::NiceMock<GMockClient>>();
+  const auto sha = crypto::hash::Sha1(kScript);
+
+  /// [ScriptRegistry]
+  ScriptRegistry registry{client, {{"get", std::string{kScript}}}};
+  /// [ScriptRegistry]
+  EXPECT_EQ(registry.GetSha("get"), sha);
+
+  EXPECT_CALL(*client, EvalShaCommon(sha, std::vector<std::string>{"key"},
+                                     std::vector<std::string>{}, _))
+      .WillOnce([](auto&&...) {
+        return CreateMockRequest<RequestEvalShaCommon>(ReplyData{"value"});
+      });
+  EXPECT_CALL(*client, ScriptLoad(_, _, _)).Times(0);
+
+  EXPECT_EQ(registry.Eval<std::string>("get", {"key"}, {}, {}), "value");
+  EXPECT_THROW(registry.Eval<std::string>("unknown", {"key"}, {}, {}),
+               std::out_of_range);
+}
+
+UTEST(ScriptRegistry, ReloadOnNoScript) {
+  auto client = std::make_shared<testing::NiceMock<GMockClient>>();
+  const auto sha = crypto::hash::Sha1(kScript);
+  ScriptRegistry registry{client, {{"get", std::string{kScript}}}};
+
+  ON_CALL(*client, ShardByKey("key")).WillByDefault(testing::Return(1));
+  {
+    testing::InSequence sequence;
+    EXPECT_CALL(*client, EvalShaCommon(sha, _, _, _)).WillOnce([](auto&&...) {
+      return CreateMockRequest<RequestEvalShaCommon>(
+          ReplyData::CreateError("NOSCRIPT No matching script"));
+    });
+    EXPECT_CALL(*client, ScriptLoad(std::string{kScript}, 1, _))
+        .WillOnce([&](auto&&...) {
+          return CreateMockRequest<RequestScriptLoad>(std::string{sha});
+        });
+    EXPECT_CALL(*client, EvalShaCommon(sha, _, _, _)).WillOnce([](auto&&...) {
+      return CreateMockRequest<RequestEvalShaCommon>(ReplyData{"value"});
+    });
+  }
+
+  EXPECT_EQ(registry.Eval<std::string>("get", {"key"}, {}, {}), "value");
+}
+
+UTEST(ScriptRegistry, Preload) {
+  auto client = std::make_shared<testing::NiceMock<GMockClient>>();
+  ScriptRegistry registry{client,
+                          {{"get", std::string{kScript}}, {"noop", "return"}}};
+
+  ON_CALL(*client, ShardsCount()).WillByDefault(testing::Return(2));
+  EXPECT_CALL(*client, ScriptLoad(_, _, _))
+      .Times(4)
+      .WillRepeatedly([](std::string script, size_t, const CommandControl&) {
+        return CreateMockRequest<RequestScriptLoad>(
+            crypto::hash::Sha1(script));
+      });
+
+  registry.Preload({});
+}
+
+}  // namespace storages::redis::test
+
+USERVER_NAMESPACE_END
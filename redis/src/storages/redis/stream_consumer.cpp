@@ -0,0 +1,187 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <string_view>
+#include <utility>
+
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/storages/redis/client.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/async.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis {
+
+namespace {
+
+// The IDs generated by the server are `<milliseconds since epoch>-<seq>`
+std::int64_t LagMs(std::string_view id) {
+  std::int64_t id_ms = 0;
+  const auto* end = id.data() + id.size();
+  if (std::from_chars(id.data(), end, id_ms).ec != std::errc{}) return 0;
+
+  const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::system_clock::now().time_since_epoch())
+                          .count();
+  return std::max<std::int64_t>(now_ms - id_ms, 0);
+}
+
+}  // namespace
+
+StreamConsumer::StreamConsumer(ClientPtr client, Settings settings,
+                               engine::TaskProcessor& task_processor,
+                               Handler handler)
+    : client_(std::move(client)),
+      settings_(std::move(settings)),
+      task_processor_(task_processor),
+      handler_(std::move(handler)),
+      task_(utils::CriticalAsync(task_processor_, "redis_stream_consumer",
+                                 [this] { Run(); })) {
+  UASSERT(client_);
+  UASSERT(handler_);
+  UINVARIANT(settings_.batch_size > 0 && settings_.max_concurrency > 0,
+             "batch_size and max_concurrency must be positive");
+}
+
+StreamConsumer::~StreamConsumer() { task_.SyncCancel(); }
+
+void StreamConsumer::Run() {
+  bool group_created = false;
+  auto next_claim = std::chrono::steady_clock::now();
+
+  while (!engine::current_task::ShouldCancel()) {
+    try {
+      if (!group_created) {
+        CreateGroup();
+        group_created = true;
+      }
+
+      if (settings_.claim_min_idle_time.count() > 0 &&
+          std::chrono::steady_clock::now() >= next_claim) {
+        Claim();
+        next_claim =
+            std::chrono::steady_clock::now() + settings_.claim_interval;
+      }
+
+      XreadgroupOptions options;
+      options.count = settings_.batch_size;
+      if (settings_.block.count() > 0) options.block = settings_.block;
+      auto entries =
+          client_
+              ->Xreadgroup(settings_.stream, settings_.group,
+                           settings_.consumer, options,
+                           settings_.command_control)
+              .Get();
+      if (entries.empty()) {
+        if (!options.block) {
+          engine::InterruptibleSleepFor(settings_.poll_interval);
+        }
+        continue;
+      }
+
+      read_ += entries.size();
+      lag_ms_ = LagMs(entries.back().id);
+      Handle(std::move(entries));
+    } catch (const std::exception& ex) {
+      if (engine::current_task::ShouldCancel()) break;
+      LOG_LIMITED_WARNING() << "Failed to consume the stream '"
+                            << settings_.stream << "' as '"
+                            << settings_.consumer << "' of the group '"
+                            << settings_.group << "': " << ex;
+      engine::InterruptibleSleepFor(settings_.poll_interval);
+    }
+  }
+}
+
+void StreamConsumer::CreateGroup() {
+  const auto reply =
+      client_
+          ->XgroupCreate(settings_.stream, settings_.group, settings_.start_id,
+                         settings_.command_control)
+          .Get();
+  if (reply == XgroupCreateReply::kCreated) {
+    LOG_INFO() << "Created the group '" << settings_.group
+               << "' of the stream '" << settings_.stream << "'";
+  }
+}
+
+void StreamConsumer::Claim() {
+  XautoclaimOptions options;
+  options.count = settings_.batch_size;
+  auto reply = client_
+                   ->Xautoclaim(settings_.stream, settings_.group,
+                                settings_.consumer,
+                                settings_.claim_min_idle_time, claim_start_id_,
+                                options, settings_.command_control)
+                   .Get();
+  claim_start_id_ = std::move(reply.next_start_id);
+  if (reply.entries.empty()) return;
+
+  claimed_ += reply.entries.size();
+  Handle(std::move(reply.entries));
+}
+
+void StreamConsumer::Handle(std::vector<StreamEntry>&& entries) {
+  std::vector<char> succeeded(entries.size(), false);
+  std::atomic<std::size_t> next{0};
+  const auto work = [&] {
+    for (auto i = next++; i < entries.size(); i = next++) {
+      // The entries deleted while pending are only acknowledged
+      if (!entries[i].fields.empty()) {
+        try {
+          handler_(entries[i]);
+          ++handled_;
+        } catch (const std::exception& ex) {
+          ++failed_;
+          LOG_LIMITED_WARNING() << "Failed to handle the entry "
+                                << entries[i].id << " of the stream '"
+                                << settings_.stream << "': " << ex;
+          continue;
+        }
+      }
+      succeeded[i] = true;
+    }
+  };
+
+  const auto workers = std::min(settings_.max_concurrency, entries.size());
+  std::vector<engine::TaskWithResult<void>> tasks;
+  tasks.reserve(workers);
+  for (std::size_t i = 0; i < workers; ++i) {
+    tasks.push_back(
+        utils::Async(task_processor_, "redis_stream_handle", work));
+  }
+  for (auto& task : tasks) task.Get();
+
+  std::vector<std::string> ids;
+  ids.reserve(entries.size());
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    if (succeeded[i]) ids.push_back(std::move(entries[i].id));
+  }
+  if (ids.empty()) return;
+
+  const auto count = ids.size();
+  client_
+      ->Xack(settings_.stream, settings_.group, std::move(ids),
+             settings_.command_control)
+      .Get();
+  acked_ += count;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const StreamConsumer& consumer) {
+  writer["read"] = consumer.read_.Load();
+  writer["handled"] = consumer.handled_.Load();
+  writer["failed"] = consumer.failed_.Load();
+  writer["acked"] = consumer.acked_.Load();
+  writer["claimed"] = consumer.claimed_.Load();
+  writer["lag_ms"] = consumer.lag_ms_.load();
+}
+
+}  // namespace storages::redis
+
+USERVER_NAMESPACE_END
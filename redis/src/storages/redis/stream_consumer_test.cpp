@@ -0,0 +1,123 @@
+#include <userver/storages/redis/stream_consumer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/task/task.hpp>
+#include <userver/storages/redis/mock_client_google.hpp>
+#include <userver/storages/redis/mock_request.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::redis::test {
+
+using testing::_;
+
+namespace {
+
+constexpr std::chrono::seconds kMaxTestWaitTime{10};
+
+}  // namespace
+
+UTEST(StreamConsumer, HandleAndAck) {
+  auto client = std::make_shared<testing::NiceMock<GMockClient>>();
+  EXPECT_CALL(*client, XgroupCreate("events", "workers", "$", _))
+      .WillOnce([](auto&&...) {
+        return CreateMockRequest<RequestXgroupCreate>(
+            XgroupCreateReply::kAlreadyExists);
+      });
+  ON_CALL(*client, Xreadgroup("events", "workers", "worker-1", _, _))
+      .WillByDefault([](auto&&...) {
+        return CreateMockRequest<RequestXreadgroup>(
+            std::vector<StreamEntry>{});
+      });
+  EXPECT_CALL(*client, Xreadgroup("events", "workers", "worker-1", _, _))
+      .WillOnce([](auto&&...) {
+        return CreateMockRequest<RequestXreadgroup>(std::vector<StreamEntry>{
+            {"1-0", {{"type", "created"}}},
+            {"2-0", {{"type", "broken"}}},
+            {"3-0", {{"type", "deleted"}}},
+        });
+      })
+      .RetiresOnSaturation();
+
+  engine::SingleConsumerEvent acked;
+  std::vector<std::string> acked_ids;
+  EXPECT_CALL(*client, Xack("events", "workers", _, _))
+      .WillOnce([&](std::string, std::string, std::vector<std::string> ids,
+                    const CommandControl&) {
+        acked_ids = std::move(ids);
+        acked.Send();
+        return CreateMockRequest<RequestXack>(acked_ids.size());
+      });
+
+  /// [StreamConsumer]
+  StreamConsumer::Settings settings;
+  settings.stream = "events";
+  settings.group = "workers";
+  settings.consumer = "worker-1";
+  settings.poll_interval = std::chrono::milliseconds{1};
+  settings.claim_min_idle_time = std::chrono::milliseconds{0};
+
+  StreamConsumer consumer{
+      client, std::move(settings), engine::current_task::GetTaskProcessor(),
+      [](const StreamEntry& entry) {
+        if (entry.fields.front().second == "broken") {
+          throw std::runtime_error("can not handle");
+        }
+      }};
+  /// [StreamConsumer]
+
+  ASSERT_TRUE(acked.WaitForEventFor(kMaxTestWaitTime));
+  std::sort(acked_ids.begin(), acked_ids.end());
+  EXPECT_EQ(acked_ids, (std::vector<std::string>{"1-0", "3-0"}));
+}
+
+UTEST(StreamConsumer, ClaimPending) {
+  auto client = std::make_shared<testing::NiceMock<GMockClient>>();
+  ON_CALL(*client, XgroupCreate(_, _, _, _)).WillByDefault([](auto&&...) {
+    return CreateMockRequest<RequestXgroupCreate>(XgroupCreateReply::kCreated);
+  });
+  ON_CALL(*client, Xreadgroup(_, _, _, _, _)).WillByDefault([](auto&&...) {
+    return CreateMockRequest<RequestXreadgroup>(std::vector<StreamEntry>{});
+  });
+  EXPECT_CALL(*client, Xautoclaim("events", "workers", "worker-2",
+                                  std::chrono::milliseconds{1000}, "0-0", _, _))
+      .WillOnce([](auto&&...) {
+        // An entry deleted while pending has no fields
+        return CreateMockRequest<RequestXautoclaim>(XautoclaimReply{
+            "0-0", {{"5-0", {{"type", "created"}}}, {"6-0", {}}}});
+      });
+
+  engine::SingleConsumerEvent acked;
+  EXPECT_CALL(*client, Xack("events", "workers", _, _))
+      .WillOnce([&](std::string, std::string, std::vector<std::string> ids,
+                    const CommandControl&) {
+        EXPECT_EQ(ids.size(), 2u);
+        acked.Send();
+        return CreateMockRequest<RequestXack>(ids.size());
+      });
+
+  StreamConsumer::Settings settings;
+  settings.stream = "events";
+  settings.group = "workers";
+  settings.consumer = "worker-2";
+  settings.poll_interval = std::chrono::milliseconds{1};
+  settings.claim_min_idle_time = std::chrono::seconds{1};
+  settings.claim_interval = std::chrono::hours{1};
+
+  std::atomic<int> handled{0};
+  StreamConsumer consumer{client, std::move(settings),
+                          engine::current_task::GetTaskProcessor(),
+                          [&](const StreamEntry&) { ++handled; }};
+
+  ASSERT_TRUE(acked.WaitForEventFor(kMaxTestWaitTime));
+  EXPECT_EQ(handled, 1);
+}
+
+}  // namespace storages::redis::test
+
+USERVER_NAMESPACE_END
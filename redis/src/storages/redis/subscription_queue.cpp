@@ -33,6 +33,11 @@ bool SubscriptionQueue<Item>::PopMessage(Item& msg_ptr) {
   return consumer_.Pop(msg_ptr);
 }
 
+template <typename Item>
+size_t SubscriptionQueue<Item>::GetDroppedCount() const {
+  return dropped_.Load();
+}
+
 template <typename Item>
 void SubscriptionQueue<Item>::Unsubscribe() {
   token_->Unsubscribe();
@@ -48,15 +53,17 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
     const USERVER_NAMESPACE::redis::CommandControl& command_control) {
   return subscribe_sentinel.Subscribe(
       channel,
-      [this](const std::string& channel, const std::string& message) {
+      [this](const std::string& channel, const MessagePtr& message) {
         if (!producer_.PushNoblock(Item(message))) {
+          ++dropped_;
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
-          LOG_ERROR()
-              << "failed to push message '" << message << "' from channel '"
+          LOG_LIMITED_ERROR()
+              << "failed to push message '" << *message << "' from channel '"
               << channel
               << "' into subscription queue due to overflow (max length="
-              << queue_->GetSoftMaxSize() << ')';
+              << queue_->GetSoftMaxSize() << ", dropped=" << dropped_.Load()
+              << ')';
         }
       },
       command_control);
@@ -73,15 +80,17 @@ SubscriptionQueue<Item>::GetSubscriptionToken(
   return subscribe_sentinel.Psubscribe(
       pattern,
       [this](const std::string& pattern, const std::string& channel,
-             const std::string& message) {
+             const MessagePtr& message) {
         if (!producer_.PushNoblock(Item(channel, message))) {
+          ++dropped_;
           // Use SubscriptionQueue::SetMaxLength() or
           // SubscriptionToken::SetMaxQueueLength() if limit is too low
-          LOG_ERROR()
-              << "failed to push pmessage '" << message << "' from channel '"
+          LOG_LIMITED_ERROR()
+              << "failed to push pmessage '" << *message << "' from channel '"
               << channel << "' from pattern '" << pattern
               << "' into subscription queue due to overflow (max length="
-              << queue_->GetSoftMaxSize() << ')';
+              << queue_->GetSoftMaxSize() << ", dropped=" << dropped_.Load()
+              << ')';
         }
       },
       command_control);
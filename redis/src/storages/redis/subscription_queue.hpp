@@ -5,25 +5,30 @@
 
 #include <storages/redis/impl/subscribe_sentinel.hpp>
 #include <userver/concurrent/queue.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace storages::redis {
 
+using MessagePtr = USERVER_NAMESPACE::redis::Sentinel::MessagePtr;
+
+// The message is not copied to the queues of the subscribers of a channel,
+// they share the payload until the last of them handles it
 struct ChannelSubscriptionQueueItem {
-  std::string message;
+  MessagePtr message;
 
   ChannelSubscriptionQueueItem() = default;
-  explicit ChannelSubscriptionQueueItem(std::string message)
+  explicit ChannelSubscriptionQueueItem(MessagePtr message)
       : message(std::move(message)) {}
 };
 
 struct PatternSubscriptionQueueItem {
   std::string channel;
-  std::string message;
+  MessagePtr message;
 
   PatternSubscriptionQueueItem() = default;
-  PatternSubscriptionQueueItem(std::string channel, std::string message)
+  PatternSubscriptionQueueItem(std::string channel, MessagePtr message)
       : channel(std::move(channel)), message(std::move(message)) {}
 };
 
@@ -43,6 +48,9 @@ class SubscriptionQueue {
 
   bool PopMessage(Item& msg_ptr);
 
+  // Messages dropped due to the queue overflow
+  size_t GetDroppedCount() const;
+
   void Unsubscribe();
 
  private:
@@ -68,6 +76,7 @@ class SubscriptionQueue {
   std::shared_ptr<Queue> queue_;
   typename Queue::Producer producer_;
   typename Queue::Consumer consumer_;
+  utils::statistics::RelaxedCounter<size_t> dropped_;
   std::unique_ptr<USERVER_NAMESPACE::redis::SubscriptionToken> token_;
 };
 
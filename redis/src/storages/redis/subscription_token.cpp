@@ -14,6 +14,8 @@ namespace storages::redis {
 
 namespace impl {
 SubscriptionTokenImplBase::~SubscriptionTokenImplBase() = default;
+
+size_t SubscriptionTokenImplBase::GetDroppedMessagesCount() const { return 0; }
 }
 
 SubscriptionToken::SubscriptionToken() = default;
@@ -35,6 +37,11 @@ void SubscriptionToken::SetMaxQueueLength(size_t length) {
   impl_->SetMaxQueueLength(length);
 }
 
+size_t SubscriptionToken::GetDroppedMessagesCount() const {
+  if (!impl_) return 0;
+  return impl_->GetDroppedMessagesCount();
+}
+
 void SubscriptionToken::Unsubscribe() {
   if (!impl_) return;
   impl_->Unsubscribe();
@@ -33,6 +33,10 @@ void SubscriptionTokenImpl::SetMaxQueueLength(size_t length) {
   queue_.SetMaxLength(length);
 }
 
+size_t SubscriptionTokenImpl::GetDroppedMessagesCount() const {
+  return queue_.GetDroppedCount();
+}
+
 void SubscriptionTokenImpl::Unsubscribe() {
   queue_.Unsubscribe();
   subscriber_task_.SyncCancel();
@@ -42,7 +46,9 @@ void SubscriptionTokenImpl::ProcessMessages() {
   ChannelSubscriptionQueueItem msg;
   while (queue_.PopMessage(msg)) {
     tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_message_cb_) on_message_cb_(channel_, msg.message);
+    if (on_message_cb_) on_message_cb_(channel_, *msg.message);
+    // Releases the reply with the payload once all the subscribers are done
+    msg.message.reset();
   }
 }
 
@@ -63,6 +69,10 @@ void PsubscriptionTokenImpl::SetMaxQueueLength(size_t length) {
   queue_.SetMaxLength(length);
 }
 
+size_t PsubscriptionTokenImpl::GetDroppedMessagesCount() const {
+  return queue_.GetDroppedCount();
+}
+
 void PsubscriptionTokenImpl::Unsubscribe() {
   queue_.Unsubscribe();
   subscriber_task_.SyncCancel();
@@ -72,7 +82,8 @@ void PsubscriptionTokenImpl::ProcessMessages() {
   PatternSubscriptionQueueItem msg;
   while (queue_.PopMessage(msg)) {
     tracing::Span span(std::string{kProcessRedisSubscriptionMessage});
-    if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, msg.message);
+    if (on_pmessage_cb_) on_pmessage_cb_(pattern_, msg.channel, *msg.message);
+    msg.message.reset();
   }
 }
 
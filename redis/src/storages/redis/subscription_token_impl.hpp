@@ -24,6 +24,8 @@ class SubscriptionTokenImpl final : public impl::SubscriptionTokenImplBase {
 
   void SetMaxQueueLength(size_t length) override;
 
+  size_t GetDroppedMessagesCount() const override;
+
   void Unsubscribe() override;
 
  private:
@@ -48,6 +50,8 @@ class PsubscriptionTokenImpl final : public impl::SubscriptionTokenImplBase {
 
   void SetMaxQueueLength(size_t length) override;
 
+  size_t GetDroppedMessagesCount() const override;
+
   void Unsubscribe() override;
 
  private:
@@ -70,6 +70,16 @@ TEST(MockSubscribeClientTest, SubscriptionToken) {
   //! [SbTknExmpl1]
 }
 
+TEST(MockSubscribeClientTest, DroppedMessagesCount) {
+  auto token_mock = std::make_unique<MockSubscriptionTokenImpl>();
+  EXPECT_CALL(*token_mock, GetDroppedMessagesCount)
+      .WillOnce(testing::Return(3));
+
+  const SubscriptionToken token{std::move(token_mock)};
+  EXPECT_EQ(token.GetDroppedMessagesCount(), 3u);
+  EXPECT_EQ(SubscriptionToken{}.GetDroppedMessagesCount(), 0u);
+}
+
 }  // namespace storages::redis::test
 
 USERVER_NAMESPACE_END
@@ -328,6 +328,31 @@ class MockClientBase : public Client,
   RequestType Type(std::string key,
                    const CommandControl& command_control) override;
 
+  RequestXack Xack(std::string key, std::string group,
+                   std::vector<std::string> ids,
+                   const CommandControl& command_control) override;
+
+  RequestXadd Xadd(std::string key,
+                   std::vector<std::pair<std::string, std::string>> fields,
+                   const XaddOptions& options,
+                   const CommandControl& command_control) override;
+
+  RequestXautoclaim Xautoclaim(std::string key, std::string group,
+                               std::string consumer,
+                               std::chrono::milliseconds min_idle_time,
+                               std::string start,
+                               const XautoclaimOptions& options,
+                               const CommandControl& command_control) override;
+
+  RequestXgroupCreate XgroupCreate(
+      std::string key, std::string group, std::string id,
+      const CommandControl& command_control) override;
+
+  RequestXreadgroup Xreadgroup(std::string key, std::string group,
+                               std::string consumer,
+                               const XreadgroupOptions& options,
+                               const CommandControl& command_control) override;
+
   RequestZadd Zadd(std::string key, double score, std::string member,
                    const CommandControl& command_control) override;
 
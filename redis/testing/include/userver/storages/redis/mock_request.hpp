@@ -8,6 +8,7 @@
 
 #include <userver/storages/redis/impl/base.hpp>
 #include <userver/storages/redis/impl/exception.hpp>
+#include <userver/storages/redis/impl/reply.hpp>
 #include <userver/storages/redis/impl/request.hpp>
 #include <userver/storages/redis/reply_types.hpp>
 #include <userver/storages/redis/request.hpp>
@@ -32,8 +33,14 @@ class MockRequestData final : public RequestDataBase<ReplyType> {
   }
 
   ReplyPtr GetRaw() override {
-    UASSERT_MSG(false, "not supported in mocked request");
-    return nullptr;
+    if constexpr (std::is_same_v<ReplyType, ReplyData>) {
+      // E.g. EVALSHA replies are parsed from the raw reply
+      return std::make_shared<USERVER_NAMESPACE::redis::Reply>(
+          "mock", std::move(reply_));
+    } else {
+      UASSERT_MSG(false, "not supported in mocked request");
+      return nullptr;
+    }
   }
 
   engine::impl::ContextAccessor* TryGetContextAccessor() noexcept override {
@@ -124,10 +131,10 @@ class MockRequestScanData : public RequestScanDataBase<scan_tag> {
 
 template <typename Result, typename ReplyType = Result>
 Request<Result, ReplyType> CreateMockRequest(
-    Result&& result, Request<Result, ReplyType>* /* for ADL */) {
+    ReplyType&& reply, Request<Result, ReplyType>* /* for ADL */) {
   return Request<Result, ReplyType>(
       std::make_unique<MockRequestData<Result, ReplyType>>(
-          std::forward<Result>(result)));
+          std::move(reply)));
 }
 
 template <typename Result, typename ReplyType = Result>
@@ -45,6 +45,8 @@ class MockSubscriptionTokenImpl : public impl::SubscriptionTokenImplBase {
 
   MOCK_METHOD(void, SetMaxQueueLength, (size_t length), (override));
 
+  MOCK_METHOD(size_t, GetDroppedMessagesCount, (), (const, override));
+
   MOCK_METHOD(void, Unsubscribe, (), (override));
 };
 
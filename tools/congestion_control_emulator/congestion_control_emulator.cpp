@@ -3,6 +3,7 @@
 #include <boost/program_options.hpp>
 
 #include <userver/congestion_control/controller.hpp>
+#include <userver/congestion_control/controllers/gradient.hpp>
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/logger.hpp>
@@ -13,12 +14,23 @@ using namespace congestion_control;
 
 struct Config {
   Policy policy;
+  v2::GradientConfig gradient;
+  std::string controller = "rps";
   std::string log_level = "none";
 };
 
+class NullSensor final : public v2::Sensor {
+  Data GetCurrent() override { return {}; }
+};
+
+class NullLimiter final : public Limiter {
+  void SetLimit(const Limit&) override {}
+};
+
 Config ParseArgs(int argc, char* argv[]) {
   Config config;
   std::string policy_json;
+  std::string gradient_json;
 
   namespace po = boost::program_options;
 
@@ -29,9 +41,17 @@ Config ParseArgs(int argc, char* argv[]) {
     ("log-level",
       po::value(&config.log_level)->default_value(config.log_level),
       "log level (trace, debug, info, warning, error)")
+    ("controller,c",
+      po::value(&config.controller)->default_value(config.controller),
+      "controller to emulate: 'rps' reads lines of "
+      "'current_load overload_events_count', 'gradient' reads lines of "
+      "'total timeouts timings_avg_ms current_load'")
     ("policy,p",
      po::value(&policy_json)->default_value(std::string{}),
      "policy in JSON")
+    ("gradient-config,g",
+     po::value(&gradient_json)->default_value(std::string{}),
+     "gradient controller config in JSON")
   ;
   // clang-format on
 
@@ -47,10 +67,54 @@ Config ParseArgs(int argc, char* argv[]) {
   if (!policy_json.empty()) {
     config.policy = formats::json::FromString(policy_json).As<Policy>();
   }
+  if (!gradient_json.empty()) {
+    config.gradient =
+        formats::json::FromString(gradient_json).As<v2::GradientConfig>();
+  }
 
   return config;
 }
 
+void PrintLimit(const Limit& limit) {
+  if (limit.load_limit) {
+    std::cout << *limit.load_limit << std::endl;
+  } else {
+    std::cout << "(none)" << std::endl;
+  }
+}
+
+void EmulateRps(dynamic_config::Source source) {
+  Controller ctrl("cc", source);
+
+  for (;;) {
+    Sensor::Data data;
+    std::cin >> data.current_load >> data.overload_events_count;
+    if (std::cin.eof()) break;
+    if (!std::cin.good()) throw std::runtime_error("Invalid input");
+
+    ctrl.Feed(data);
+    PrintLimit(ctrl.GetLimit());
+  }
+}
+
+void EmulateGradient(const Config& config, dynamic_config::Source source) {
+  NullSensor sensor;
+  NullLimiter limiter;
+  v2::Stats stats;
+  v2::GradientController ctrl("cc", sensor, limiter, stats, {}, source,
+                              [&config](auto) { return config.gradient; });
+
+  for (;;) {
+    v2::Sensor::Data data;
+    std::cin >> data.total >> data.timeouts >> data.timings_avg_ms >>
+        data.current_load;
+    if (std::cin.eof()) break;
+    if (!std::cin.good()) throw std::runtime_error("Invalid input");
+
+    PrintLimit(ctrl.Update(data));
+  }
+}
+
 int main(int argc, char* argv[]) {
   Config config = ParseArgs(argc, argv);
 
@@ -60,21 +124,12 @@ int main(int argc, char* argv[]) {
 
   dynamic_config::StorageMock dynamic_config{
       {congestion_control::impl::kRpsCcConfig, {config.policy, true}}};
-  Controller ctrl("cc", dynamic_config.GetSource());
-
-  for (;;) {
-    Sensor::Data data;
-    std::string line;
-    std::cin >> data.current_load >> data.overload_events_count;
-    if (std::cin.eof()) break;
-    if (!std::cin.good()) throw std::runtime_error("Invalid input");
 
-    ctrl.Feed(data);
-    auto limit = ctrl.GetLimit();
-    if (limit.load_limit) {
-      std::cout << *limit.load_limit << std::endl;
-    } else {
-      std::cout << "(none)" << std::endl;
-    }
+  if (config.controller == "rps") {
+    EmulateRps(dynamic_config.GetSource());
+  } else if (config.controller == "gradient") {
+    EmulateGradient(config, dynamic_config.GetSource());
+  } else {
+    throw std::runtime_error("Unknown controller: " + config.controller);
   }
 }
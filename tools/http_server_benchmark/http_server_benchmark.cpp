@@ -0,0 +1,64 @@
+#include <string>
+
+#include <userver/components/minimal_server_component_list.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/utils/daemon_run.hpp>
+#include <userver/utils/from_string.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+// Measures the bare request path: parsing, routing and response serialization
+class Ping final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-benchmark-ping";
+
+  using HttpHandlerBase::HttpHandlerBase;
+
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest&,
+      server::request::RequestContext&) const override {
+    return {};
+  }
+};
+
+// Measures the request body path
+class Echo final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-benchmark-echo";
+
+  using HttpHandlerBase::HttpHandlerBase;
+
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest& request,
+      server::request::RequestContext&) const override {
+    return request.RequestBody();
+  }
+};
+
+// Measures the response body path, `?size=N` sets the response size
+class Payload final : public server::handlers::HttpHandlerBase {
+ public:
+  static constexpr std::string_view kName = "handler-benchmark-payload";
+
+  using HttpHandlerBase::HttpHandlerBase;
+
+  std::string HandleRequestThrow(
+      const server::http::HttpRequest& request,
+      server::request::RequestContext&) const override {
+    const auto& size = request.GetArg("size");
+    return std::string(size.empty() ? 0 : utils::FromString<std::size_t>(size),
+                       'x');
+  }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto component_list = components::MinimalServerComponentList()
+                                  .Append<Ping>()
+                                  .Append<Echo>()
+                                  .Append<Payload>();
+  return utils::DaemonMain(argc, argv, component_list);
+}
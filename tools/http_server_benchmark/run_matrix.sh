@@ -0,0 +1,97 @@
+#!/bin/bash
+# Runs the end-to-end server benchmark over a fixed config matrix:
+# TLS x keep-alive x pipelining x body size.
+#
+# usage: run_matrix.sh <http_server_benchmark> <load_generator> <static_config>
+#
+# Environment: DURATION (seconds per case, 10 by default), CONNECTIONS (64),
+# PORT (18080), SERVER_THREADS (4), CLIENT_THREADS (4).
+
+set -euo pipefail
+
+SERVER="$1"
+LOADGEN="$2"
+STATIC_CONFIG="$3"
+
+DURATION="${DURATION:-10}"
+CONNECTIONS="${CONNECTIONS:-64}"
+PORT="${PORT:-18080}"
+SERVER_THREADS="${SERVER_THREADS:-4}"
+CLIENT_THREADS="${CLIENT_THREADS:-4}"
+
+WORKDIR="$(mktemp -d)"
+SERVER_PID=""
+
+cleanup() {
+  if [ -n "$SERVER_PID" ]; then
+    kill "$SERVER_PID" 2>/dev/null || true
+    wait "$SERVER_PID" 2>/dev/null || true
+  fi
+  rm -rf "$WORKDIR"
+}
+trap cleanup EXIT
+
+openssl req -x509 -newkey rsa:2048 -nodes -days 1 -subj '/CN=localhost' \
+  -keyout "$WORKDIR/key.pem" -out "$WORKDIR/cert.pem" 2>/dev/null
+
+start_server() {
+  local tls="$1"
+  {
+    echo "port: $PORT"
+    echo "worker_threads: $SERVER_THREADS"
+    if [ "$tls" = "on" ]; then
+      echo "tls_cert: $WORKDIR/cert.pem"
+      echo "tls_private_key: $WORKDIR/key.pem"
+    fi
+  } > "$WORKDIR/config_vars.yaml"
+
+  "$SERVER" --config "$STATIC_CONFIG" \
+    --config_vars "$WORKDIR/config_vars.yaml" &
+  SERVER_PID=$!
+
+  for _ in $(seq 1 100); do
+    if curl -sk -o /dev/null "$SCHEME://localhost:$PORT/ping"; then
+      return
+    fi
+    sleep 0.1
+  done
+  echo "Server did not start" >&2
+  exit 1
+}
+
+stop_server() {
+  kill "$SERVER_PID"
+  wait "$SERVER_PID" || true
+  SERVER_PID=""
+}
+
+run_case() {
+  echo "=== tls=$1 keep-alive=$2 pipeline=$3 body=$4"
+  local args=(--duration "$DURATION" --connections "$CONNECTIONS"
+              --worker-threads "$CLIENT_THREADS" --keep-alive "$2"
+              --pipeline-depth "$3" --server-pid "$SERVER_PID")
+  if [ "$4" = "0" ]; then
+    args+=(--url "$SCHEME://localhost:$PORT/ping")
+  else
+    args+=(--url "$SCHEME://localhost:$PORT/echo" --method POST
+           --body-size "$4")
+  fi
+  "$LOADGEN" "${args[@]}"
+  echo
+}
+
+for TLS in off on; do
+  if [ "$TLS" = "on" ]; then SCHEME=https; else SCHEME=http; fi
+  start_server "$TLS"
+
+  for BODY in 0 1024 65536; do
+    run_case "$TLS" true 1 "$BODY"
+    run_case "$TLS" false 1 "$BODY"
+    # pipelining is done over plain TCP sockets by the load generator
+    if [ "$TLS" = "off" ]; then
+      run_case "$TLS" true 16 "$BODY"
+    fi
+  done
+
+  stop_server
+done
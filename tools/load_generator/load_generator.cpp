@@ -0,0 +1,488 @@
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/logging/logger.hpp>
+#include <userver/utils/str_icase.hpp>
+
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace {
+
+namespace http = clients::http;
+
+using Clock = std::chrono::steady_clock;
+
+struct Config {
+  std::string log_level = "error";
+  std::string url;
+  std::string method = "GET";
+  std::size_t body_size = 0;
+  std::size_t connections = 16;
+  std::size_t duration_seconds = 10;
+  std::size_t count = 0;
+  bool keep_alive = true;
+  std::size_t pipeline_depth = 1;
+  http::HttpVersion http_version = http::HttpVersion::k11;
+  long timeout_ms = 1000;
+  std::size_t worker_threads = 2;
+  std::size_t io_threads = 1;
+  int server_pid = 0;
+};
+
+struct WorkerStats {
+  std::vector<std::uint32_t> latencies_us;
+  std::size_t errors = 0;
+  std::size_t response_bytes = 0;
+};
+
+struct Target {
+  std::string host;
+  std::string port;
+  std::string path;
+  engine::io::Sockaddr addr;
+};
+
+http::HttpMethod ParseMethod(const std::string& method) {
+  if (method == "GET") return http::HttpMethod::kGet;
+  if (method == "POST") return http::HttpMethod::kPost;
+  if (method == "PUT") return http::HttpMethod::kPut;
+  std::cerr << "--method value is unknown\n";
+  exit(1);
+}
+
+Config ParseConfig(int argc, char* argv[]) {
+  namespace po = boost::program_options;
+
+  Config config;
+  std::string http_version = "1.1";
+  po::options_description desc("Allowed options");
+  desc.add_options()("help,h", "produce help message")(
+      "log-level",
+      po::value(&config.log_level)->default_value(config.log_level),
+      "log level (trace, debug, info, warning, error)")(
+      "url,u", po::value(&config.url), "URL to load")(
+      "method,m", po::value(&config.method)->default_value(config.method),
+      "HTTP method (GET, POST, PUT)")(
+      "body-size,b",
+      po::value(&config.body_size)->default_value(config.body_size),
+      "request body size in bytes")(
+      "connections,c",
+      po::value(&config.connections)->default_value(config.connections),
+      "number of concurrent connections, each runs requests one by one")(
+      "duration,d",
+      po::value(&config.duration_seconds)
+          ->default_value(config.duration_seconds),
+      "test duration in seconds")(
+      "count,n", po::value(&config.count)->default_value(config.count),
+      "total request count, 0 for unlimited within the duration")(
+      "keep-alive",
+      po::value(&config.keep_alive)->default_value(config.keep_alive),
+      "reuse connections, otherwise send 'Connection: close'")(
+      "pipeline-depth",
+      po::value(&config.pipeline_depth)->default_value(config.pipeline_depth),
+      "HTTP/1.1 pipelining depth, values above 1 use plain TCP sockets "
+      "instead of the HTTP client")(
+      "http-version,V",
+      po::value(&http_version)->default_value(http_version),
+      "http version, possible values: 1.0, 1.1, 2, 2tls, 2-prior")(
+      "timeout,t",
+      po::value(&config.timeout_ms)->default_value(config.timeout_ms),
+      "request timeout in ms")(
+      "worker-threads",
+      po::value(&config.worker_threads)->default_value(config.worker_threads),
+      "worker thread count")(
+      "io-threads",
+      po::value(&config.io_threads)->default_value(config.io_threads),
+      "HTTP client io thread count")(
+      "server-pid", po::value(&config.server_pid),
+      "pid of the server to report its CPU time per request");
+
+  po::variables_map vm;
+  try {
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+  } catch (const std::exception& ex) {
+    std::cerr << "Cannot parse command line: " << ex.what() << '\n';
+    exit(1);
+  }
+
+  if (vm.count("help")) {
+    std::cout << desc << '\n';
+    exit(0);
+  }
+
+  if (http_version == "1.0") {
+    config.http_version = http::HttpVersion::k10;
+  } else if (http_version == "1.1") {
+    config.http_version = http::HttpVersion::k11;
+  } else if (http_version == "2") {
+    config.http_version = http::HttpVersion::k2;
+  } else if (http_version == "2tls") {
+    config.http_version = http::HttpVersion::k2Tls;
+  } else if (http_version == "2-prior") {
+    config.http_version = http::HttpVersion::k2PriorKnowledge;
+  } else {
+    std::cerr << "--http-version value is unknown\n";
+    exit(1);
+  }
+
+  if (config.url.empty() || config.connections == 0 ||
+      config.pipeline_depth == 0) {
+    std::cerr << "--url, --connections and --pipeline-depth are required\n";
+    std::cout << desc << '\n';
+    exit(1);
+  }
+
+  // validates the method
+  ParseMethod(config.method);
+
+  if (config.pipeline_depth > 1 &&
+      (!config.keep_alive || config.url.rfind("http://", 0) != 0)) {
+    std::cerr << "Pipelining requires keep-alive and a plain http:// URL\n";
+    exit(1);
+  }
+
+  return config;
+}
+
+// Pipelining bypasses the HTTP client, so the address is resolved upfront with
+// a blocking getaddrinfo before the coroutine engine starts
+Target ResolveTarget(const std::string& url) {
+  constexpr std::string_view kScheme = "http://";
+  std::string_view rest{url};
+  rest.remove_prefix(kScheme.size());
+
+  const auto path_pos = rest.find('/');
+  const auto host_port = rest.substr(0, path_pos);
+  Target target;
+  target.path = path_pos == std::string_view::npos
+                    ? std::string{"/"}
+                    : std::string{rest.substr(path_pos)};
+
+  const auto port_pos = host_port.rfind(':');
+  target.host = std::string{host_port.substr(0, port_pos)};
+  target.port = port_pos == std::string_view::npos
+                    ? std::string{"80"}
+                    : std::string{host_port.substr(port_pos + 1)};
+
+  addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* result = nullptr;
+  if (::getaddrinfo(target.host.c_str(), target.port.c_str(), &hints,
+                    &result) != 0 ||
+      result == nullptr) {
+    std::cerr << "Failed to resolve " << target.host << '\n';
+    exit(1);
+  }
+  target.addr = engine::io::Sockaddr{result->ai_addr};
+  ::freeaddrinfo(result);
+  return target;
+}
+
+class RequestBudget final {
+ public:
+  explicit RequestBudget(const Config& config)
+      : deadline_(engine::Deadline::FromDuration(
+            std::chrono::seconds{config.duration_seconds})),
+        count_(config.count) {}
+
+  bool TryAcquire(std::size_t n = 1) {
+    if (deadline_.IsReached()) return false;
+    if (count_ == 0) return true;
+    return issued_.fetch_add(n) + n <= count_;
+  }
+
+  engine::Deadline GetDeadline() const { return deadline_; }
+
+ private:
+  const engine::Deadline deadline_;
+  const std::size_t count_;
+  std::atomic<std::size_t> issued_{0};
+};
+
+std::uint32_t ElapsedUs(Clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() -
+                                                               start)
+      .count();
+}
+
+void ClientWorker(http::Client& client, const Config& config,
+                  const std::string& body, RequestBudget& budget,
+                  WorkerStats& stats) {
+  const auto method = ParseMethod(config.method);
+
+  while (budget.TryAcquire()) {
+    const auto start = Clock::now();
+    try {
+      auto request = client.CreateRequest()
+                         .method(method)
+                         .url(config.url)
+                         .timeout(config.timeout_ms)
+                         .verify(false)
+                         .http_version(config.http_version);
+      if (!body.empty()) request.data(body);
+      if (!config.keep_alive) request.headers({{"Connection", "close"}});
+
+      auto response = request.perform();
+      stats.latencies_us.push_back(ElapsedUs(start));
+      stats.response_bytes += response->body_view().size();
+      if (!response->IsOk()) ++stats.errors;
+    } catch (const std::exception& e) {
+      LOG_ERROR() << "Request failed: " << e;
+      ++stats.errors;
+    }
+  }
+}
+
+// Returns the size of the first complete response in `buffer`
+std::optional<std::size_t> ParseResponse(std::string_view buffer, bool& ok) {
+  constexpr std::string_view kHeadersEnd = "\r\n\r\n";
+  constexpr std::string_view kContentLength = "content-length:";
+
+  const auto headers_end = buffer.find(kHeadersEnd);
+  if (headers_end == std::string_view::npos) return std::nullopt;
+  const auto headers = buffer.substr(0, headers_end + 2);
+
+  std::size_t content_length = 0;
+  for (std::size_t pos = headers.find("\r\n"); pos != std::string_view::npos;
+       pos = headers.find("\r\n", pos + 2)) {
+    const auto line = headers.substr(pos + 2);
+    if (line.size() > kContentLength.size() &&
+        utils::StrIcaseEqual{}(line.substr(0, kContentLength.size()),
+                               kContentLength)) {
+      content_length = std::strtoull(
+          line.substr(kContentLength.size()).data(), nullptr, 10);
+      break;
+    }
+  }
+
+  const auto total = headers_end + kHeadersEnd.size() + content_length;
+  if (buffer.size() < total) return std::nullopt;
+
+  ok = buffer.substr(0, 12) == "HTTP/1.1 200";
+  return total;
+}
+
+void PipelineWorker(const Target& target, const Config& config,
+                    const std::string& body, RequestBudget& budget,
+                    WorkerStats& stats) {
+  std::string request = config.method + ' ' + target.path +
+                        " HTTP/1.1\r\nHost: " + target.host + "\r\n";
+  if (!body.empty()) {
+    request += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+  }
+  request += "\r\n";
+  request += body;
+
+  std::string batch;
+  for (std::size_t i = 0; i < config.pipeline_depth; ++i) batch += request;
+
+  try {
+    engine::io::Socket socket{target.addr.Domain(),
+                              engine::io::SocketType::kStream};
+    socket.Connect(target.addr, budget.GetDeadline());
+
+    std::string buffer;
+    std::vector<char> chunk(64 * 1024);
+    while (budget.TryAcquire(config.pipeline_depth)) {
+      const auto start = Clock::now();
+      const auto deadline = engine::Deadline::FromDuration(
+          std::chrono::milliseconds{config.timeout_ms});
+      if (socket.SendAll(batch.data(), batch.size(), deadline) !=
+          batch.size()) {
+        stats.errors += config.pipeline_depth;
+        return;
+      }
+
+      std::size_t received = 0;
+      while (received < config.pipeline_depth) {
+        bool ok = false;
+        if (const auto size = ParseResponse(buffer, ok)) {
+          stats.latencies_us.push_back(ElapsedUs(start));
+          stats.response_bytes += *size;
+          if (!ok) ++stats.errors;
+          buffer.erase(0, *size);
+          ++received;
+          continue;
+        }
+
+        const auto read = socket.RecvSome(chunk.data(), chunk.size(), deadline);
+        if (read == 0) {
+          stats.errors += config.pipeline_depth - received;
+          return;
+        }
+        buffer.append(chunk.data(), read);
+      }
+    }
+  } catch (const std::exception& e) {
+    LOG_ERROR() << "Pipelined connection failed: " << e;
+    ++stats.errors;
+  }
+}
+
+std::chrono::microseconds ProcessCpuTime() {
+  rusage usage{};
+  ::getrusage(RUSAGE_SELF, &usage);
+  const auto to_us = [](const timeval& tv) {
+    return std::chrono::seconds{tv.tv_sec} +
+           std::chrono::microseconds{tv.tv_usec};
+  };
+  return to_us(usage.ru_utime) + to_us(usage.ru_stime);
+}
+
+// utime and stime from /proc/<pid>/stat
+std::optional<std::chrono::microseconds> ServerCpuTime(int pid) {
+  if (pid == 0) return std::nullopt;
+
+  std::ifstream stat("/proc/" + std::to_string(pid) + "/stat");
+  std::string content;
+  if (!std::getline(stat, content)) return std::nullopt;
+
+  // the process name may contain spaces, fields are counted after it
+  const auto name_end = content.rfind(')');
+  if (name_end == std::string::npos) return std::nullopt;
+  std::istringstream fields(content.substr(name_end + 2));
+  std::string field;
+  std::uint64_t utime = 0;
+  std::uint64_t stime = 0;
+  // state is the 3rd field, utime and stime are the 14th and 15th
+  for (int i = 3; i <= 15 && fields >> field; ++i) {
+    if (i == 14) utime = std::stoull(field);
+    if (i == 15) stime = std::stoull(field);
+  }
+
+  const auto ticks_per_second = ::sysconf(_SC_CLK_TCK);
+  return std::chrono::microseconds{(utime + stime) * 1'000'000 /
+                                   ticks_per_second};
+}
+
+void Report(const Config& config, std::vector<WorkerStats>& stats,
+            std::chrono::microseconds elapsed,
+            std::chrono::microseconds client_cpu,
+            std::optional<std::chrono::microseconds> server_cpu) {
+  std::vector<std::uint32_t> latencies;
+  std::size_t errors = 0;
+  std::size_t response_bytes = 0;
+  for (auto& worker : stats) {
+    latencies.insert(latencies.end(), worker.latencies_us.begin(),
+                     worker.latencies_us.end());
+    errors += worker.errors;
+    response_bytes += worker.response_bytes;
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  const auto requests = latencies.size();
+  const auto seconds = std::chrono::duration<double>(elapsed).count();
+  const auto percentile = [&latencies](double p) -> std::uint32_t {
+    if (latencies.empty()) return 0;
+    const auto index = static_cast<std::size_t>(p / 100 * latencies.size());
+    return latencies[std::min(index, latencies.size() - 1)];
+  };
+  const auto per_request = [requests](std::chrono::microseconds cpu) {
+    return requests == 0 ? 0.0 : static_cast<double>(cpu.count()) / requests;
+  };
+
+  std::cout << std::fixed << std::setprecision(1)                     //
+            << "url:                 " << config.url << '\n'          //
+            << "connections:         " << config.connections << '\n'  //
+            << "pipeline depth:      " << config.pipeline_depth << '\n'
+            << "keep-alive:          " << config.keep_alive << '\n'
+            << "body size:           " << config.body_size << '\n'
+            << "requests:            " << requests << '\n'
+            << "errors:              " << errors << '\n'
+            << "response bytes:      " << response_bytes << '\n'
+            << "RPS:                 " << requests / seconds << '\n'
+            << "latency p50 (us):    " << percentile(50) << '\n'
+            << "latency p90 (us):    " << percentile(90) << '\n'
+            << "latency p99 (us):    " << percentile(99) << '\n'
+            << "latency p99.9 (us):  " << percentile(99.9) << '\n'
+            << "latency max (us):    " << percentile(100) << '\n'
+            << "client CPU/req (us): " << per_request(client_cpu) << '\n';
+  if (server_cpu) {
+    std::cout << "server CPU/req (us): " << per_request(*server_cpu) << '\n';
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const Config config = ParseConfig(argc, argv);
+
+  const auto logger = logging::MakeStderrLogger(
+      "default", logging::Format::kTskv,
+      logging::LevelFromString(config.log_level));
+  const logging::DefaultLoggerGuard guard{logger};
+
+  std::optional<Target> target;
+  if (config.pipeline_depth > 1) target = ResolveTarget(config.url);
+
+  const std::string body(config.body_size, 'x');
+  std::vector<WorkerStats> stats(config.connections);
+
+  const auto server_cpu_start = ServerCpuTime(config.server_pid);
+  const auto client_cpu_start = ProcessCpuTime();
+  const auto start = Clock::now();
+
+  engine::RunStandalone(config.worker_threads, [&] {
+    auto& tp = engine::current_task::GetTaskProcessor();
+    clients::http::Client client{
+        {"", config.io_threads, false},
+        tp,
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+    // one connection per worker coroutine
+    client.SetMaxHostConnections(config.connections);
+
+    RequestBudget budget{config};
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(config.connections);
+    for (auto& worker_stats : stats) {
+      if (target) {
+        tasks.push_back(engine::AsyncNoSpan(tp, [&] {
+          PipelineWorker(*target, config, body, budget, worker_stats);
+        }));
+      } else {
+        tasks.push_back(engine::AsyncNoSpan(tp, [&] {
+          ClientWorker(client, config, body, budget, worker_stats);
+        }));
+      }
+    }
+    for (auto& task : tasks) task.Get();
+  });
+
+  const auto elapsed =
+      std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() -
+                                                            start);
+  const auto client_cpu = ProcessCpuTime() - client_cpu_start;
+  std::optional<std::chrono::microseconds> server_cpu;
+  if (const auto server_cpu_end = ServerCpuTime(config.server_pid)) {
+    server_cpu = *server_cpu_end - server_cpu_start.value_or(
+                                       std::chrono::microseconds::zero());
+  }
+
+  Report(config, stats, elapsed, client_cpu, server_cpu);
+}
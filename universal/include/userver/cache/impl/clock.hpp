@@ -0,0 +1,358 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/intrusive/unordered_set.hpp>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+template <class Key, class Value>
+class ClockNode final : public LruHashSetHook {
+ public:
+  template <typename... Args>
+  explicit ClockNode(Key&& key, Args&&... args)
+      : key_(std::move(key)), value_(std::forward<Args>(args)...) {}
+
+  void SetKey(Key key) { key_ = std::move(key); }
+
+  void SetValue(Value&& value) { value_ = std::move(value); }
+
+  const Key& GetKey() const noexcept { return key_; }
+
+  const Value& GetValue() const noexcept { return value_; }
+  Value& GetValue() noexcept { return value_; }
+
+  void MarkReferenced() const noexcept {
+    // Avoid dirtying the cache line if the bit is already set
+    if (!referenced_.load(std::memory_order_relaxed)) {
+      referenced_.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  bool ResetReferenced() noexcept {
+    return referenced_.exchange(false, std::memory_order_relaxed);
+  }
+
+  bool IsReferenced() const noexcept {
+    return referenced_.load(std::memory_order_relaxed);
+  }
+
+  std::size_t slot{0};
+
+ private:
+  Key key_;
+  Value value_;
+  mutable std::atomic<bool> referenced_{false};
+};
+
+template <class Key, class Value>
+const Key& GetKey(const ClockNode<Key, Value>& node) noexcept {
+  return node.GetKey();
+}
+
+/// CLOCK approximation of LRU. A hit only sets the access bit of the item,
+/// the eviction hand clears the bits and evicts the first item that was
+/// not accessed since the previous pass of the hand.
+///
+/// GetShared does not modify the structure of the container and may be
+/// called concurrently from multiple threads, as long as no other methods
+/// are called at the same time (e.g. under a shared lock).
+///
+/// The interface mirrors LruBase.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class ClockBase final {
+ public:
+  explicit ClockBase(std::size_t max_size, const Hash& hash = Hash(),
+                     const Equal& equal = Equal());
+  ~ClockBase() { Clear(); }
+
+  ClockBase(ClockBase&& other) noexcept
+      : buckets_(std::move(other.buckets_)),
+        map_(std::move(other.map_)),
+        slots_(std::move(other.slots_)),
+        hand_(other.hand_) {
+    other.buckets_.clear();
+    other.map_.clear();
+    other.slots_.clear();
+  }
+
+  ClockBase& operator=(ClockBase&& other) noexcept {
+    if (this != &other) Clear();
+
+    swap(other.buckets_, buckets_);
+    swap(other.map_, map_);
+    swap(other.slots_, slots_);
+    std::swap(other.hand_, hand_);
+
+    return *this;
+  }
+
+  ClockBase(const ClockBase&) = delete;
+  ClockBase& operator=(const ClockBase&) = delete;
+
+  bool Put(const T& key, U value);
+
+  template <typename... Args>
+  U* Emplace(const T& key, Args&&... args);
+
+  void Erase(const T& key);
+
+  U* Get(const T& key);
+
+  const U* GetShared(const T& key) const;
+
+  const T* GetLeastUsedKey() const;
+
+  U* GetLeastUsedValue();
+
+  void SetMaxSize(std::size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  template <typename Function>
+  void VisitAll(Function&& func);
+
+  std::size_t GetSize() const;
+
+  std::size_t GetCapacity() const;
+
+ private:
+  using Node = ClockNode<T, U>;
+
+  struct NodeHash : Hash {
+    NodeHash(const Hash& h) : Hash{h} {}
+
+    template <class NodeOrKey>
+    auto operator()(const NodeOrKey& x) const {
+      return Hash::operator()(impl::GetKey(x));
+    }
+  };
+
+  struct NodeEqual : Equal {
+    NodeEqual(const Equal& eq) : Equal{eq} {}
+
+    template <class NodeOrKey1, class NodeOrKey2>
+    auto operator()(const NodeOrKey1& x, const NodeOrKey2& y) const {
+      return Equal::operator()(impl::GetKey(x), impl::GetKey(y));
+    }
+  };
+
+  using Map = boost::intrusive::unordered_set<
+      Node, boost::intrusive::constant_time_size<true>,
+      boost::intrusive::hash<NodeHash>, boost::intrusive::equal<NodeEqual>>;
+
+  using BucketTraits = typename Map::bucket_traits;
+  using BucketType = typename Map::bucket_type;
+
+  Node* Find(const T& key) const;
+  std::size_t FindVictimSlot() const;
+  // Moves the hand to the victim and returns its slot. The hand stays there,
+  // so that the item moved into the slot by EraseSlot is examined next.
+  std::size_t AdvanceHand();
+  U& Insert(std::unique_ptr<Node> node);
+  void EraseSlot(std::size_t slot) noexcept;
+
+  std::vector<BucketType> buckets_;
+  Map map_;
+  std::vector<std::unique_ptr<Node>> slots_;
+  std::size_t hand_{0};
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+ClockBase<T, U, Hash, Equal>::ClockBase(std::size_t max_size, const Hash& hash,
+                                        const Equal& equal)
+    : buckets_(max_size ? max_size : 1),
+      map_(BucketTraits(buckets_.data(), buckets_.size()), hash, equal) {
+  UASSERT(max_size > 0);
+  slots_.reserve(buckets_.size());
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool ClockBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  auto* node = Find(key);
+  if (node) {
+    node->SetValue(std::move(value));
+    node->MarkReferenced();
+    return false;
+  }
+
+  if (slots_.size() < buckets_.size()) {
+    Insert(std::make_unique<Node>(T{key}, std::move(value)));
+    return true;
+  }
+
+  // reuse the node of the evicted item
+  auto& victim = *slots_[AdvanceHand()];
+  map_.erase(map_.iterator_to(victim));
+  victim.SetKey(key);
+  victim.SetValue(std::move(value));
+  victim.ResetReferenced();
+  map_.insert(victim);
+  ++hand_;
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U* ClockBase<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
+  auto* existing = Get(key);
+  if (existing) return existing;
+
+  return &Insert(std::make_unique<Node>(T{key}, std::forward<Args>(args)...));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Erase(const T& key) {
+  auto* node = Find(key);
+  if (node) EraseSlot(node->slot);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* ClockBase<T, U, Hash, Equal>::Get(const T& key) {
+  auto* node = Find(key);
+  if (!node) return nullptr;
+  node->MarkReferenced();
+  return &node->GetValue();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const U* ClockBase<T, U, Hash, Equal>::GetShared(const T& key) const {
+  const auto* node = Find(key);
+  if (!node) return nullptr;
+  node->MarkReferenced();
+  return &node->GetValue();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const T* ClockBase<T, U, Hash, Equal>::GetLeastUsedKey() const {
+  if (slots_.empty()) return nullptr;
+  return &slots_[FindVictimSlot()]->GetKey();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* ClockBase<T, U, Hash, Equal>::GetLeastUsedValue() {
+  if (slots_.empty()) return nullptr;
+  return &slots_[FindVictimSlot()]->GetValue();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  UASSERT(new_max_size > 0);
+  if (!new_max_size) ++new_max_size;
+
+  if (buckets_.size() == new_max_size) {
+    return;
+  }
+
+  while (slots_.size() > new_max_size) {
+    EraseSlot(AdvanceHand());
+  }
+
+  std::vector<BucketType> new_buckets(new_max_size);
+  map_.rehash(BucketTraits(new_buckets.data(), new_max_size));
+  buckets_.swap(new_buckets);
+  slots_.reserve(new_max_size);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::Clear() noexcept {
+  map_.clear();
+  slots_.clear();
+  hand_ = 0;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void ClockBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  for (const auto& node : slots_) {
+    func(node->GetKey(), node->GetValue());
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void ClockBase<T, U, Hash, Equal>::VisitAll(Function&& func) {
+  for (auto& node : slots_) {
+    func(node->GetKey(), node->GetValue());
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t ClockBase<T, U, Hash, Equal>::GetSize() const {
+  return slots_.size();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t ClockBase<T, U, Hash, Equal>::GetCapacity() const {
+  return buckets_.size();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename ClockBase<T, U, Hash, Equal>::Node*
+ClockBase<T, U, Hash, Equal>::Find(const T& key) const {
+  auto it = map_.find(key, map_.hash_function(), map_.key_eq());
+  if (it == map_.end()) return nullptr;
+  return const_cast<Node*>(&*it);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t ClockBase<T, U, Hash, Equal>::FindVictimSlot() const {
+  UASSERT(!slots_.empty());
+  for (std::size_t i = 0; i < slots_.size(); ++i) {
+    const auto slot = (hand_ + i) % slots_.size();
+    if (!slots_[slot]->IsReferenced()) return slot;
+  }
+  return hand_ % slots_.size();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t ClockBase<T, U, Hash, Equal>::AdvanceHand() {
+  UASSERT(!slots_.empty());
+  // terminates after at most one full turn, as the bits are cleared
+  while (true) {
+    if (hand_ >= slots_.size()) hand_ = 0;
+    if (!slots_[hand_]->ResetReferenced()) return hand_;
+    ++hand_;
+  }
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U& ClockBase<T, U, Hash, Equal>::Insert(std::unique_ptr<Node> node) {
+  if (slots_.size() >= buckets_.size()) {
+    EraseSlot(AdvanceHand());
+  }
+
+  node->slot = slots_.size();
+  auto [it, ok] = map_.insert(*node);
+  UASSERT(ok);
+  slots_.push_back(std::move(node));
+  return it->GetValue();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void ClockBase<T, U, Hash, Equal>::EraseSlot(std::size_t slot) noexcept {
+  UASSERT(slot < slots_.size());
+  map_.erase(map_.iterator_to(*slots_[slot]));
+  if (slot + 1 != slots_.size()) {
+    std::swap(slots_[slot], slots_.back());
+    slots_[slot]->slot = slot;
+  }
+  slots_.pop_back();
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,368 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <userver/cache/impl/lru.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache::impl {
+
+/// Count-min sketch of 4-bit counters with periodic aging. Estimates how
+/// often a key was seen recently using 8 bytes per cached item.
+template <typename T, typename Hash = std::hash<T>>
+class FrequencySketch final {
+ public:
+  explicit FrequencySketch(std::size_t capacity, const Hash& hash = Hash())
+      : hash_(hash) {
+    Resize(capacity);
+  }
+
+  /// Records an access to the key
+  void Increment(const T& key) noexcept {
+    const auto hash = Spread(hash_(key));
+    const auto frequency = Estimate(hash);
+    if (frequency == kMaxCounter) return;
+
+    // conservative update: only the smallest counters are incremented
+    for (std::size_t i = 0; i < kDepth; ++i) {
+      const auto index = GetIndex(hash, i);
+      if (GetCounter(index) == frequency) {
+        table_[index / kCountersPerWord] +=
+            std::uint64_t{1} << ((index % kCountersPerWord) * kCounterBits);
+      }
+    }
+
+    if (++additions_ >= sample_size_) Age();
+  }
+
+  /// @returns the estimated recent frequency of the key, at most 15
+  std::uint32_t Estimate(const T& key) const noexcept {
+    return Estimate(Spread(hash_(key)));
+  }
+
+  /// Resets the counters and adjusts the sketch size to the cache capacity
+  void Resize(std::size_t capacity) {
+    std::size_t words = 1;
+    while (words * kCountersPerWord < capacity * kCountersPerItem) words *= 2;
+    table_.assign(words, 0);
+    counters_mask_ = words * kCountersPerWord - 1;
+    sample_size_ = std::max<std::size_t>(capacity, 1) * kSampleFactor;
+    additions_ = 0;
+  }
+
+ private:
+  static constexpr std::size_t kDepth = 4;
+  static constexpr std::size_t kCounterBits = 4;
+  static constexpr std::size_t kCountersPerWord = 64 / kCounterBits;
+  static constexpr std::size_t kCountersPerItem = 16;
+  static constexpr std::size_t kSampleFactor = 10;
+  static constexpr std::uint32_t kMaxCounter = 15;
+  static constexpr std::uint64_t kResetMask = 0x7777777777777777;
+  static constexpr std::uint64_t kSeeds[kDepth] = {
+      0xc3a5c85c97cb3127, 0xb492b66fbe98f273, 0x9ae16a3b2f90404f,
+      0xcbf29ce484222325};
+
+  // std::hash of integers is an identity function, so the bits are mixed
+  static std::uint64_t Spread(std::uint64_t x) noexcept {
+    x = (x ^ (x >> 33)) * 0xff51afd7ed558ccd;
+    x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53;
+    return x ^ (x >> 33);
+  }
+
+  std::size_t GetIndex(std::uint64_t hash, std::size_t i) const noexcept {
+    auto x = (hash + kSeeds[i]) * kSeeds[i];
+    x ^= x >> 32;
+    return x & counters_mask_;
+  }
+
+  std::uint32_t GetCounter(std::size_t index) const noexcept {
+    const auto word = table_[index / kCountersPerWord];
+    return (word >> ((index % kCountersPerWord) * kCounterBits)) & kMaxCounter;
+  }
+
+  std::uint32_t Estimate(std::uint64_t hash) const noexcept {
+    auto frequency = kMaxCounter;
+    for (std::size_t i = 0; i < kDepth; ++i) {
+      frequency = std::min(frequency, GetCounter(GetIndex(hash, i)));
+    }
+    return frequency;
+  }
+
+  // Halves all the counters, so that the old popularity fades away
+  void Age() noexcept {
+    for (auto& word : table_) word = (word >> 1) & kResetMask;
+    additions_ /= 2;
+  }
+
+  Hash hash_;
+  std::vector<std::uint64_t> table_;
+  std::size_t counters_mask_{0};
+  std::size_t sample_size_{0};
+  std::size_t additions_{0};
+};
+
+/// W-TinyLFU: a window LRU of ~1% of the capacity, followed by the main SLRU
+/// space (20% probation, 80% protected). An item evicted from the window
+/// gets into the main space only if its estimated frequency is higher than
+/// that of the main space victim, otherwise it is dropped (rejected).
+///
+/// The interface mirrors LruBase. The capacity is at least 2.
+template <typename T, typename U, typename Hash = std::hash<T>,
+          typename Equal = std::equal_to<T>>
+class WTinyLfuBase final {
+ public:
+  using NodeType = std::unique_ptr<LruNode<T, U>>;
+
+  explicit WTinyLfuBase(std::size_t max_size, const Hash& hash = Hash(),
+                        const Equal& equal = Equal());
+
+  WTinyLfuBase(WTinyLfuBase&& other) noexcept = default;
+  WTinyLfuBase& operator=(WTinyLfuBase&& other) noexcept = default;
+
+  WTinyLfuBase(const WTinyLfuBase&) = delete;
+  WTinyLfuBase& operator=(const WTinyLfuBase&) = delete;
+
+  bool Put(const T& key, U value);
+
+  template <typename... Args>
+  U* Emplace(const T& key, Args&&... args);
+
+  void Erase(const T& key);
+
+  U* Get(const T& key);
+
+  const T* GetLeastUsedKey() const;
+
+  U* GetLeastUsedValue();
+
+  void SetMaxSize(std::size_t new_max_size);
+
+  void Clear() noexcept;
+
+  template <typename Function>
+  void VisitAll(Function&& func) const;
+
+  template <typename Function>
+  void VisitAll(Function&& func);
+
+  std::size_t GetSize() const;
+
+  std::size_t GetCapacity() const;
+
+  /// @returns the number of items dropped by the admission policy
+  std::size_t GetAdmissionRejects() const noexcept {
+    return admission_rejects_;
+  }
+
+ private:
+  using Lru = LruBase<T, U, Hash, Equal>;
+
+  static std::size_t GetWindowSize(std::size_t max_size) noexcept {
+    return std::max<std::size_t>(max_size / 100, 1);
+  }
+
+  static std::size_t GetMainSize(std::size_t max_size) noexcept {
+    return std::max<std::size_t>(max_size - GetWindowSize(max_size), 1);
+  }
+
+  static std::size_t GetProtectedSize(std::size_t main_size) noexcept {
+    return std::max<std::size_t>(main_size * 4 / 5, 1);
+  }
+
+  U* Find(const T& key);
+  NodeType MakeRoomInWindow();
+  NodeType Admit(NodeType candidate);
+  std::size_t GetMainSpaceSize() const;
+
+  Lru window_;
+  // Probation is bounded only by the main space size, so that it grows
+  // while the protected segment is not filled yet
+  Lru probation_;
+  Lru protected_;
+  FrequencySketch<T, Hash> sketch_;
+  std::size_t main_size_;
+  std::size_t admission_rejects_{0};
+};
+
+template <typename T, typename U, typename Hash, typename Equal>
+WTinyLfuBase<T, U, Hash, Equal>::WTinyLfuBase(std::size_t max_size,
+                                              const Hash& hash,
+                                              const Equal& equal)
+    : window_(GetWindowSize(max_size), hash, equal),
+      probation_(GetMainSize(max_size), hash, equal),
+      protected_(GetProtectedSize(GetMainSize(max_size)), hash, equal),
+      sketch_(max_size, hash),
+      main_size_(GetMainSize(max_size)) {
+  UASSERT(max_size > 0);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+bool WTinyLfuBase<T, U, Hash, Equal>::Put(const T& key, U value) {
+  sketch_.Increment(key);
+  auto* const existing = Find(key);
+  if (existing) {
+    *existing = std::move(value);
+    return false;
+  }
+
+  auto node = MakeRoomInWindow();
+  if (node) {
+    node->SetKey(key);
+    node->SetValue(std::move(value));
+  } else {
+    node = std::make_unique<LruNode<T, U>>(T{key}, std::move(value));
+  }
+  window_.InsertNode(std::move(node));
+  return true;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename... Args>
+U* WTinyLfuBase<T, U, Hash, Equal>::Emplace(const T& key, Args&&... args) {
+  sketch_.Increment(key);
+  auto* const existing = Find(key);
+  if (existing) return existing;
+
+  MakeRoomInWindow();
+  return &window_.InsertNode(std::make_unique<LruNode<T, U>>(
+      T{key}, std::forward<Args>(args)...));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void WTinyLfuBase<T, U, Hash, Equal>::Erase(const T& key) {
+  window_.Erase(key);
+  probation_.Erase(key);
+  protected_.Erase(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* WTinyLfuBase<T, U, Hash, Equal>::Get(const T& key) {
+  // misses are recorded too, so that a key becomes admittable after
+  // being requested repeatedly
+  sketch_.Increment(key);
+  return Find(key);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+const T* WTinyLfuBase<T, U, Hash, Equal>::GetLeastUsedKey() const {
+  if (const auto* key = probation_.GetLeastUsedKey()) return key;
+  if (const auto* key = protected_.GetLeastUsedKey()) return key;
+  return window_.GetLeastUsedKey();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* WTinyLfuBase<T, U, Hash, Equal>::GetLeastUsedValue() {
+  if (auto* value = probation_.GetLeastUsedValue()) return value;
+  if (auto* value = protected_.GetLeastUsedValue()) return value;
+  return window_.GetLeastUsedValue();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void WTinyLfuBase<T, U, Hash, Equal>::SetMaxSize(std::size_t new_max_size) {
+  UASSERT(new_max_size > 0);
+  const auto new_main_size = GetMainSize(new_max_size);
+  const auto new_protected_size = GetProtectedSize(new_main_size);
+
+  window_.SetMaxSize(GetWindowSize(new_max_size));
+  while (protected_.GetSize() > new_protected_size) {
+    probation_.InsertNode(protected_.ExtractLeastUsedNode());
+  }
+  protected_.SetMaxSize(new_protected_size);
+  main_size_ = new_main_size;
+  while (GetMainSpaceSize() > main_size_) probation_.ExtractLeastUsedNode();
+  probation_.SetMaxSize(main_size_);
+
+  sketch_.Resize(new_max_size);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+void WTinyLfuBase<T, U, Hash, Equal>::Clear() noexcept {
+  window_.Clear();
+  probation_.Clear();
+  protected_.Clear();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void WTinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) const {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+template <typename Function>
+void WTinyLfuBase<T, U, Hash, Equal>::VisitAll(Function&& func) {
+  window_.VisitAll(func);
+  probation_.VisitAll(func);
+  protected_.VisitAll(func);
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t WTinyLfuBase<T, U, Hash, Equal>::GetSize() const {
+  return window_.GetSize() + GetMainSpaceSize();
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t WTinyLfuBase<T, U, Hash, Equal>::GetCapacity() const {
+  return window_.GetCapacity() + main_size_;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+U* WTinyLfuBase<T, U, Hash, Equal>::Find(const T& key) {
+  if (auto* value = window_.Get(key)) return value;
+  if (auto* value = protected_.Get(key)) return value;
+
+  auto node = probation_.ExtractNode(key);
+  if (!node) return nullptr;
+
+  if (protected_.GetSize() >= protected_.GetCapacity()) {
+    probation_.InsertNode(protected_.ExtractLeastUsedNode());
+  }
+  return &protected_.InsertNode(std::move(node));
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename WTinyLfuBase<T, U, Hash, Equal>::NodeType
+WTinyLfuBase<T, U, Hash, Equal>::MakeRoomInWindow() {
+  if (window_.GetSize() < window_.GetCapacity()) return NodeType();
+  return Admit(window_.ExtractLeastUsedNode());
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+typename WTinyLfuBase<T, U, Hash, Equal>::NodeType
+WTinyLfuBase<T, U, Hash, Equal>::Admit(NodeType candidate) {
+  UASSERT(candidate);
+  if (GetMainSpaceSize() < main_size_) {
+    probation_.InsertNode(std::move(candidate));
+    return NodeType();
+  }
+
+  // the main space is full, so the probation segment is not empty
+  const auto* victim_key = probation_.GetLeastUsedKey();
+  UASSERT(victim_key);
+  if (sketch_.Estimate(candidate->GetKey()) <= sketch_.Estimate(*victim_key)) {
+    ++admission_rejects_;
+    return candidate;
+  }
+
+  auto victim = probation_.ExtractLeastUsedNode();
+  probation_.InsertNode(std::move(candidate));
+  return victim;
+}
+
+template <typename T, typename U, typename Hash, typename Equal>
+std::size_t WTinyLfuBase<T, U, Hash, Equal>::GetMainSpaceSize() const {
+  return probation_.GetSize() + protected_.GetSize();
+}
+
+}  // namespace cache::impl
+
+USERVER_NAMESPACE_END
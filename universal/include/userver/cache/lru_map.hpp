@@ -3,7 +3,13 @@
 /// @file userver/cache/lru_map.hpp
 /// @brief @copybrief cache::LruMap
 
+#include <cstddef>
+#include <type_traits>
+
+#include <userver/cache/impl/clock.hpp>
 #include <userver/cache/impl/lru.hpp>
+#include <userver/cache/impl/tinylfu.hpp>
+#include <userver/cache/policy.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -13,9 +19,11 @@ namespace cache {
 /// @ingroup userver_universal userver_containers
 ///
 /// LRU key value storage (LRU cache), thread safety matches Standard Library
-/// thread safety
+/// thread safety. The eviction policy is selected by `Policy`,
+/// see cache::CachePolicy.
 template <typename T, typename U, typename Hash = std::hash<T>,
-          typename Equal = std::equal_to<T>>
+          typename Equal = std::equal_to<T>,
+          CachePolicy Policy = CachePolicy::kLRU>
 class LruMap final {
  public:
   explicit LruMap(size_t max_size, const Hash& hash = Hash(),
@@ -47,6 +55,17 @@ class LruMap final {
   /// @warning Returned pointer may be freed on the next map access!
   U* Get(const T& key) { return impl_.Get(key); }
 
+  /// Returns pointer to value if the key is in the map and marks it as used
+  /// without modifying the map, so concurrent calls are allowed while no
+  /// other methods are called (e.g. under a shared lock);
+  /// returns nullptr otherwise. Only available for CachePolicy::kClock.
+  /// @warning Returned pointer may be freed on the next non-const map access!
+  const U* GetShared(const T& key) const {
+    static_assert(Policy == CachePolicy::kClock,
+                  "GetShared is only available for CachePolicy::kClock");
+    return impl_.GetShared(key);
+  }
+
   /// Returns value by key and updates its usage; returns default_value
   /// otherwise without modifying the cache.
   U GetOr(const T& key, const U& default_value) {
@@ -60,6 +79,11 @@ class LruMap final {
   /// @warning Returned pointer may be freed on the next map access!
   U* GetLeastUsed() { return impl_.GetLeastUsedValue(); }
 
+  /// Returns pointer to the key of the least recently used value;
+  /// returns nullptr if LRU is empty.
+  /// @warning Returned pointer may be freed on the next map access!
+  const T* GetLeastUsedKey() const { return impl_.GetLeastUsedKey(); }
+
   /// Sets the max size of the LRU, truncates values if new_max_size < GetSize()
   void SetMaxSize(size_t new_max_size) {
     return impl_.SetMaxSize(new_max_size);
@@ -84,8 +108,24 @@ class LruMap final {
 
   std::size_t GetCapacity() const { return impl_.GetCapacity(); }
 
+  /// Returns the number of new items that were not admitted into the cache
+  /// by the CachePolicy::kWTinyLFU policy, always 0 for other policies
+  std::size_t GetAdmissionRejects() const {
+    if constexpr (Policy == CachePolicy::kWTinyLFU) {
+      return impl_.GetAdmissionRejects();
+    } else {
+      return 0;
+    }
+  }
+
  private:
-  impl::LruBase<T, U, Hash, Equal> impl_;
+  using Impl = std::conditional_t<
+      Policy == CachePolicy::kWTinyLFU, impl::WTinyLfuBase<T, U, Hash, Equal>,
+      std::conditional_t<Policy == CachePolicy::kClock,
+                         impl::ClockBase<T, U, Hash, Equal>,
+                         impl::LruBase<T, U, Hash, Equal>>>;
+
+  Impl impl_;
 };
 
 }  // namespace cache
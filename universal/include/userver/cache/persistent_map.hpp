@@ -0,0 +1,450 @@
+#pragma once
+
+/// @file userver/cache/persistent_map.hpp
+/// @brief @copybrief cache::PersistentMap
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Hash map with O(1) copying, the copies share the unchanged elements.
+///
+/// The map is a hash array mapped trie. A copy of the map shares the whole
+/// trie with the original, a modification of the copy copies only the nodes
+/// on the path from the root to the modified element: at most 14 nodes of at
+/// most 32 slots each. The nodes that are not shared with other copies are
+/// modified in place.
+///
+/// That makes the map a good fit for the data of the caches with incremental
+/// updates: the previous snapshot is copied in O(1) and an update of a few
+/// elements does not copy the rest of them. See cache::PostgreCache and
+/// components::MongoCache for examples.
+///
+/// Thread safety matches the Standard Library thread safety, each of the
+/// copies may be modified concurrently with the others.
+///
+/// Iterators are forward and const, any modification of the map invalidates
+/// them. Iteration order is unspecified. Cache dumps of the map are not
+/// supported yet.
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename Equal = std::equal_to<Key>>
+class PersistentMap final {
+  struct Leaf;
+  struct Node;
+
+  using LeafPtr = std::shared_ptr<Leaf>;
+  using NodePtr = std::shared_ptr<Node>;
+  using Slot = std::variant<LeafPtr, NodePtr>;
+
+  static constexpr unsigned kBitsPerLevel = 5;
+  static constexpr unsigned kHashBits =
+      std::numeric_limits<std::size_t>::digits;
+  // levels of the hash chunks and the level of the full hash collisions
+  static constexpr std::size_t kMaxDepth =
+      (kHashBits + kBitsPerLevel - 1) / kBitsPerLevel + 1;
+
+ public:
+  using key_type = Key;
+  using mapped_type = Value;
+  using value_type = std::pair<const Key, Value>;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = Equal;
+
+  class const_iterator;
+  using iterator = const_iterator;
+
+  PersistentMap() = default;
+
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept { return {}; }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  const_iterator find(const Key& key) const;
+  size_type count(const Key& key) const { return find(key) == end() ? 0 : 1; }
+  bool contains(const Key& key) const { return find(key) != end(); }
+
+  /// @throws std::out_of_range if there is no such key
+  const Value& at(const Key& key) const;
+
+  /// Returns a reference to the value of `key`, inserts the default
+  /// constructed value if it is missing. The value is stored in a separate
+  /// node for this copy of the map, the other copies are not affected by
+  /// the changes through the reference.
+  Value& operator[](const Key& key);
+
+  /// Returns `true` if the value was inserted and `false` if it was assigned
+  template <typename M>
+  bool insert_or_assign(const Key& key, M&& obj) {
+    return InsertOrAssign(key, std::forward<M>(obj));
+  }
+
+  /// @overload
+  template <typename M>
+  bool insert_or_assign(Key&& key, M&& obj) {
+    return InsertOrAssign(std::move(key), std::forward<M>(obj));
+  }
+
+  /// Returns the number of the erased elements
+  size_type erase(const Key& key);
+
+  void clear() noexcept {
+    root_.reset();
+    size_ = 0;
+  }
+
+  void swap(PersistentMap& other) noexcept {
+    root_.swap(other.root_);
+    std::swap(size_, other.size_);
+  }
+
+ private:
+  struct Leaf {
+    template <typename... Args>
+    explicit Leaf(std::size_t hash, Args&&... args)
+        : hash(hash), value(std::forward<Args>(args)...) {}
+
+    std::size_t hash;
+    value_type value;
+  };
+
+  struct Node {
+    // Bit N is set if there is a slot for the hash chunk N, the slots are
+    // ordered by the chunk. The nodes of the full hash collisions do not use
+    // the bitmap and contain only the leaves.
+    std::uint32_t bitmap{0};
+    std::vector<Slot> slots;
+  };
+
+  static unsigned ChunkAt(std::size_t hash, unsigned shift) noexcept {
+    return (hash >> shift) & ((1u << kBitsPerLevel) - 1);
+  }
+
+  static std::uint32_t Bit(unsigned chunk) noexcept {
+    return std::uint32_t{1} << chunk;
+  }
+
+  static std::size_t SlotPos(std::uint32_t bitmap, unsigned chunk) noexcept {
+    return __builtin_popcount(bitmap & (Bit(chunk) - 1));
+  }
+
+  static bool IsKey(const Leaf& leaf, std::size_t hash, const Key& key) {
+    return leaf.hash == hash && Equal{}(leaf.value.first, key);
+  }
+
+  /// Copies the node if it is shared with another copy of the map
+  template <typename T>
+  static T& MakeUnique(std::shared_ptr<T>& ptr) {
+    UASSERT(ptr);
+    if (ptr.use_count() == 1) {
+      // synchronizes with the release of the node by the other copies
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } else {
+      ptr = std::make_shared<T>(std::as_const(*ptr));
+    }
+    return *ptr;
+  }
+
+  template <typename K, typename M>
+  bool InsertOrAssign(K&& key, M&& obj);
+
+  template <typename MakeLeaf>
+  LeafPtr& FindOrInsertUnique(const Key& key, std::size_t hash,
+                              MakeLeaf&& make_leaf, bool& inserted);
+
+  static void EraseUnique(NodePtr& node_ptr, const Key& key, std::size_t hash,
+                          unsigned shift);
+
+  NodePtr root_;
+  size_type size_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+class PersistentMap<Key, Value, Hash, Equal>::const_iterator final {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = PersistentMap::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+  const_iterator() = default;
+
+  reference operator*() const { return GetLeaf().value; }
+  pointer operator->() const { return &GetLeaf().value; }
+
+  const_iterator& operator++() {
+    Advance();
+    return *this;
+  }
+
+  const_iterator operator++(int) {
+    auto copy = *this;
+    Advance();
+    return copy;
+  }
+
+  bool operator==(const const_iterator& other) const noexcept {
+    return depth_ == other.depth_ &&
+           (depth_ == 0 || path_[depth_ - 1] == other.path_[depth_ - 1]);
+  }
+
+  bool operator!=(const const_iterator& other) const noexcept {
+    return !(*this == other);
+  }
+
+ private:
+  friend class PersistentMap;
+
+  void Push(const Node* node, std::size_t pos) noexcept {
+    UASSERT(depth_ < kMaxDepth);
+    path_[depth_++] = {node, pos};
+  }
+
+  void DescendToLeaf(const Node* node) noexcept {
+    while (true) {
+      Push(node, 0);
+      const auto* child = std::get_if<NodePtr>(&node->slots.front());
+      if (!child) return;
+      node = child->get();
+    }
+  }
+
+  void Advance() noexcept {
+    UASSERT(depth_ > 0);
+    while (depth_ > 0) {
+      auto& [node, pos] = path_[depth_ - 1];
+      if (++pos < node->slots.size()) {
+        if (const auto* child = std::get_if<NodePtr>(&node->slots[pos])) {
+          DescendToLeaf(child->get());
+        }
+        return;
+      }
+      --depth_;
+    }
+  }
+
+  const Leaf& GetLeaf() const noexcept {
+    UASSERT(depth_ > 0);
+    const auto& [node, pos] = path_[depth_ - 1];
+    return *std::get<LeafPtr>(node->slots[pos]);
+  }
+
+  // the slots from the root to the current leaf
+  std::array<std::pair<const Node*, std::size_t>, kMaxDepth> path_{};
+  std::size_t depth_{0};
+};
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentMap<Key, Value, Hash, Equal>::begin() const noexcept
+    -> const_iterator {
+  const_iterator it;
+  if (root_) it.DescendToLeaf(root_.get());
+  return it;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentMap<Key, Value, Hash, Equal>::find(const Key& key) const
+    -> const_iterator {
+  if (!root_) return end();
+
+  const auto hash = Hash{}(key);
+  const Node* node = root_.get();
+  const_iterator it;
+  for (unsigned shift = 0;; shift += kBitsPerLevel) {
+    if (shift >= kHashBits) {
+      for (std::size_t pos = 0; pos < node->slots.size(); ++pos) {
+        if (IsKey(*std::get<LeafPtr>(node->slots[pos]), hash, key)) {
+          it.Push(node, pos);
+          return it;
+        }
+      }
+      return end();
+    }
+
+    const auto chunk = ChunkAt(hash, shift);
+    if (!(node->bitmap & Bit(chunk))) return end();
+
+    const auto pos = SlotPos(node->bitmap, chunk);
+    it.Push(node, pos);
+    const auto& slot = node->slots[pos];
+    if (const auto* leaf = std::get_if<LeafPtr>(&slot)) {
+      return IsKey(**leaf, hash, key) ? it : end();
+    }
+    node = std::get<NodePtr>(slot).get();
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+const Value& PersistentMap<Key, Value, Hash, Equal>::at(const Key& key) const {
+  const auto it = find(key);
+  if (it == end()) throw std::out_of_range("PersistentMap::at");
+  return it->second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+Value& PersistentMap<Key, Value, Hash, Equal>::operator[](const Key& key) {
+  const auto hash = Hash{}(key);
+  bool inserted = false;
+  auto& leaf = FindOrInsertUnique(
+      key, hash,
+      [&] {
+        return std::make_shared<Leaf>(hash, std::piecewise_construct,
+                                      std::forward_as_tuple(key),
+                                      std::forward_as_tuple());
+      },
+      inserted);
+  if (inserted) ++size_;
+  return MakeUnique(leaf).value.second;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename K, typename M>
+bool PersistentMap<Key, Value, Hash, Equal>::InsertOrAssign(K&& key, M&& obj) {
+  const auto hash = Hash{}(key);
+  bool inserted = false;
+  auto& leaf = FindOrInsertUnique(
+      key, hash,
+      [&] {
+        return std::make_shared<Leaf>(hash, std::forward<K>(key),
+                                      std::forward<M>(obj));
+      },
+      inserted);
+  if (inserted) {
+    ++size_;
+  } else if (leaf.use_count() == 1) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    leaf->value.second = std::forward<M>(obj);
+  } else {
+    leaf =
+        std::make_shared<Leaf>(hash, leaf->value.first, std::forward<M>(obj));
+  }
+  return inserted;
+}
+
+template <typename Key, typename Value, typename Hash, typename Equal>
+auto PersistentMap<Key, Value, Hash, Equal>::erase(const Key& key)
+    -> size_type {
+  // not copying the path if there is nothing to erase
+  if (find(key) == end()) return 0;
+
+  EraseUnique(root_, key, Hash{}(key), 0);
+  if (root_->slots.empty()) root_.reset();
+  --size_;
+  return 1;
+}
+
+// Makes the nodes on the path to the key unique and returns the slot of the
+// key, the slot is created with `make_leaf` if the key is missing.
+template <typename Key, typename Value, typename Hash, typename Equal>
+template <typename MakeLeaf>
+auto PersistentMap<Key, Value, Hash, Equal>::FindOrInsertUnique(
+    const Key& key, std::size_t hash, MakeLeaf&& make_leaf, bool& inserted)
+    -> LeafPtr& {
+  inserted = false;
+  if (!root_) root_ = std::make_shared<Node>();
+
+  Node* node = &MakeUnique(root_);
+  for (unsigned shift = 0;; shift += kBitsPerLevel) {
+    if (shift >= kHashBits) {
+      for (auto& slot : node->slots) {
+        auto& leaf = std::get<LeafPtr>(slot);
+        if (IsKey(*leaf, hash, key)) return leaf;
+      }
+      inserted = true;
+      return std::get<LeafPtr>(node->slots.emplace_back(make_leaf()));
+    }
+
+    const auto chunk = ChunkAt(hash, shift);
+    const auto pos = SlotPos(node->bitmap, chunk);
+    if (!(node->bitmap & Bit(chunk))) {
+      node->bitmap |= Bit(chunk);
+      inserted = true;
+      return std::get<LeafPtr>(
+          *node->slots.emplace(node->slots.begin() + pos, make_leaf()));
+    }
+
+    auto& slot = node->slots[pos];
+    if (auto* leaf = std::get_if<LeafPtr>(&slot)) {
+      if (IsKey(**leaf, hash, key)) return *leaf;
+
+      // Moves the other leaf one level down, it is moved again on the next
+      // iteration if the next chunks of the hashes are the same
+      auto child = std::make_shared<Node>();
+      const auto next_shift = shift + kBitsPerLevel;
+      if (next_shift < kHashBits) {
+        child->bitmap = Bit(ChunkAt((*leaf)->hash, next_shift));
+      }
+      child->slots.emplace_back(std::move(*leaf));
+      slot = std::move(child);
+    }
+    node = &MakeUnique(std::get<NodePtr>(slot));
+  }
+}
+
+// The key must be present in the map
+template <typename Key, typename Value, typename Hash, typename Equal>
+void PersistentMap<Key, Value, Hash, Equal>::EraseUnique(NodePtr& node_ptr,
+                                                         const Key& key,
+                                                         std::size_t hash,
+                                                         unsigned shift) {
+  auto& node = MakeUnique(node_ptr);
+  if (shift >= kHashBits) {
+    const auto it =
+        std::find_if(node.slots.begin(), node.slots.end(), [&](const Slot& s) {
+          return IsKey(*std::get<LeafPtr>(s), hash, key);
+        });
+    UASSERT(it != node.slots.end());
+    node.slots.erase(it);
+    return;
+  }
+
+  const auto chunk = ChunkAt(hash, shift);
+  UASSERT(node.bitmap & Bit(chunk));
+  const auto pos = SlotPos(node.bitmap, chunk);
+  auto& slot = node.slots[pos];
+  if (auto* child = std::get_if<NodePtr>(&slot)) {
+    EraseUnique(*child, key, hash, shift + kBitsPerLevel);
+
+    // The child with a single leaf is replaced with the leaf. The other
+    // children keep at least two elements, so they are never empty.
+    auto& child_slots = (*child)->slots;
+    UASSERT(!child_slots.empty());
+    if (child_slots.size() == 1 &&
+        std::holds_alternative<LeafPtr>(child_slots.front())) {
+      auto leaf = std::get<LeafPtr>(std::move(child_slots.front()));
+      slot = std::move(leaf);
+    }
+    return;
+  }
+
+  node.bitmap &= ~Bit(chunk);
+  node.slots.erase(node.slots.begin() + pos);
+}
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
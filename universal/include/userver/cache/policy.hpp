@@ -0,0 +1,29 @@
+#pragma once
+
+/// @file userver/cache/policy.hpp
+/// @brief @copybrief cache::CachePolicy
+
+USERVER_NAMESPACE_BEGIN
+
+namespace cache {
+
+/// @brief Eviction and admission policy of the LRU caches
+enum class CachePolicy {
+  /// Plain least-recently-used eviction
+  kLRU,
+
+  /// Window TinyLFU: new items get into a small LRU window and are admitted
+  /// into the main SLRU space only if they are requested more often than
+  /// the items they would evict. Protects the hot items from being flushed
+  /// by scans of rarely used keys.
+  kWTinyLFU,
+
+  /// CLOCK approximation of LRU: a hit only sets the access bit of the item
+  /// without reordering, so cache::NWayLRU serves hits under a shared lock
+  /// of the way and concurrent readers do not serialize
+  kClock,
+};
+
+}  // namespace cache
+
+USERVER_NAMESPACE_END
@@ -4,6 +4,9 @@
 /// @brief @copybrief crypto::hash
 /// @ingroup userver_universal
 
+#include <cstddef>
+#include <memory>
+#include <string>
 #include <string_view>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,6 +18,64 @@ enum class OutputEncoding { kBinary, kBase16, kHex = kBase16, kBase64 };
 
 enum class Pad { kWith, kWithout };
 
+/// Hash algorithms of crypto::hash::Hasher
+enum class Algorithm {
+  kSha1,
+  kSha224,
+  kSha256,
+  kSha384,
+  kSha512,
+  /// Not available if built with USERVER_NO_CRYPTOPP_BLAKE2
+  kBlake2b128,
+  /// Broken, must not be used except for compatibility
+  kWeakMd5,
+};
+
+/// @brief Incremental hash (or HMAC) calculation for the data that comes in
+/// chunks and is never held in memory at once, e.g. a streamed HTTP response
+/// body or a large dump.
+///
+/// Produces the same results as the one-shot functions, e.g.
+/// `Hasher(Algorithm::kSha256)` fed with "te" and "st" results in
+/// `Sha256("test")`. Uses the SHA CPU extensions if available.
+///
+/// Not thread-safe.
+///
+/// @snippet crypto/hash_test.cpp Hasher
+class Hasher final {
+ public:
+  /// @throws CryptoException if the algorithm is not available
+  explicit Hasher(Algorithm algorithm);
+
+  /// @brief Creates an HMAC calculator
+  /// @param key HMAC key
+  /// @throws CryptoException if the algorithm is not available for HMAC
+  static Hasher Hmac(Algorithm algorithm, std::string_view key);
+
+  Hasher(Hasher&&) noexcept;
+  Hasher& operator=(Hasher&&) noexcept;
+  ~Hasher();
+
+  /// Feeds the next chunk of data
+  void Update(std::string_view data);
+
+  /// @brief Returns the hash of all the data fed since the construction or
+  /// the previous `Final`, resets the hasher (HMAC key is retained)
+  /// @param encoding result could be returned as binary string or encoded
+  /// @throws CryptoException internal library exception
+  std::string Final(OutputEncoding encoding = OutputEncoding::kHex);
+
+  /// Size of the binary hash in bytes
+  std::size_t DigestSize() const;
+
+ private:
+  class Impl;
+
+  explicit Hasher(std::unique_ptr<Impl>&& impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 /// @brief Calculates Blake2-128, output format depends from encoding param
 /// @param encoding result could be returned as binary string or encoded
@@ -0,0 +1,268 @@
+#pragma once
+
+/// @file userver/decimal64/bulk.hpp
+/// @brief Operations over arrays of decimal64::Decimal
+/// @ingroup userver_universal
+///
+/// The functions process whole arrays at once: the overflow checks of the
+/// elements are combined and reported once per array, and the rounding policy
+/// and the powers of 10 are resolved at compile time.
+///
+/// Any contiguous container of `Decimal` (std::vector, std::array,
+/// utils::span) can be passed.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <userver/decimal64/decimal64.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace decimal64 {
+
+namespace impl {
+
+template <typename Range>
+using BulkDecimal =
+    std::remove_cv_t<std::remove_reference_t<decltype(*std::data(
+        std::declval<Range&>()))>>;
+
+// Each int64 is split into a signed upper and an unsigned lower 32-bit half,
+// the halves are summed separately without overflows for up to kSumBlockSize
+// values.
+inline constexpr std::size_t kSumBlockSize = std::size_t{1} << 31;
+
+// Exact sum of values whose partial sums overflow int64
+template <typename Dec>
+int64_t SumWide(const Dec* data, std::size_t size) {
+  // sum == upper * 2^32 + lower
+  int64_t upper = 0;
+  std::uint64_t lower = 0;
+  for (std::size_t begin = 0; begin < size; begin += kSumBlockSize) {
+    const std::size_t end = begin + std::min(kSumBlockSize, size - begin);
+    int64_t block_upper = 0;
+    std::uint64_t block_lower = lower;
+    for (std::size_t i = begin; i < end; ++i) {
+      const int64_t value = data[i].AsUnbiased();
+      block_upper += value >> 32;
+      block_lower += static_cast<std::uint32_t>(value);
+    }
+    if (__builtin_add_overflow(upper, block_upper, &upper) ||
+        __builtin_add_overflow(
+            upper, static_cast<int64_t>(block_lower >> 32), &upper)) {
+      throw OutOfBoundsError();
+    }
+    lower = block_lower & 0xffffffff;
+  }
+
+  constexpr int64_t kMaxUpper = std::numeric_limits<int32_t>::max();
+  constexpr int64_t kMinUpper = std::numeric_limits<int32_t>::min();
+  if (upper < kMinUpper || upper > kMaxUpper) throw OutOfBoundsError();
+
+  return static_cast<int64_t>((static_cast<std::uint64_t>(upper) << 32) |
+                              lower);
+}
+
+// Parses `[+-]?\d+(\.\d+)?` with at most `Prec` fractional digits and at most
+// kMaxDecimalDigits digits in total, up to `delimiter` or `end`. Returns
+// nullopt for anything else, `it` is left unspecified in this case.
+template <typename Dec>
+constexpr std::optional<Dec> TryParseSimple(const char*& it, const char* end,
+                                            char delimiter) noexcept {
+  constexpr int kMaxIntegerDigits = kMaxDecimalDigits - Dec::kDecimalPoints;
+
+  bool is_negative = false;
+  if (it != end && (*it == '-' || *it == '+')) {
+    is_negative = *it == '-';
+    ++it;
+  }
+
+  std::uint64_t value = 0;
+  const char* const integer_begin = it;
+  while (it != end && *it >= '0' && *it <= '9') {
+    value = value * 10 + static_cast<std::uint64_t>(*it - '0');
+    ++it;
+  }
+  const auto integer_digits = it - integer_begin;
+  if (integer_digits == 0 || integer_digits > kMaxIntegerDigits) {
+    return std::nullopt;
+  }
+
+  std::ptrdiff_t fractional_digits = 0;
+  if (it != end && *it == '.') {
+    ++it;
+    const char* const fractional_begin = it;
+    while (it != end && *it >= '0' && *it <= '9') {
+      value = value * 10 + static_cast<std::uint64_t>(*it - '0');
+      ++it;
+    }
+    fractional_digits = it - fractional_begin;
+    if (fractional_digits == 0 || fractional_digits > Dec::kDecimalPoints) {
+      return std::nullopt;
+    }
+  }
+  if (it != end && *it != delimiter) return std::nullopt;
+
+  value *= static_cast<std::uint64_t>(
+      kPowSeries10[Dec::kDecimalPoints - fractional_digits]);
+  const auto unbiased = static_cast<int64_t>(value);
+  return Dec::FromUnbiased(is_negative ? -unbiased : unbiased);
+}
+
+}  // namespace impl
+
+/// @brief Returns the sum of `values`
+///
+/// Unlike summation with `operator+`, only the final result is checked for
+/// overflow, intermediate sums may exceed the limits of `Decimal`.
+///
+/// @throw decimal64::OutOfBoundsError if the sum does not fit into `Decimal`
+template <typename Range>
+impl::BulkDecimal<Range> Sum(const Range& values) {
+  using Dec = impl::BulkDecimal<Range>;
+  static_assert(kIsDecimal<Dec>, "Sum expects a contiguous range of Decimal");
+
+  const Dec* const data = std::data(values);
+  const std::size_t size = std::size(values);
+
+  // A plain loop is as fast as the memory allows, the wide summation is only
+  // needed if partial sums overflow
+  int64_t sum = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    if (__builtin_add_overflow(sum, data[i].AsUnbiased(), &sum)) {
+      return Dec::FromUnbiased(impl::SumWide(data, size));
+    }
+  }
+  return Dec::FromUnbiased(sum);
+}
+
+/// @brief Multiplies each of `values` by an integer
+///
+/// @throw decimal64::OutOfBoundsError if any of the results does not fit into
+/// `Decimal`, `values` are left partially updated in this case
+template <typename Range, typename Int, impl::EnableIfInt<Int> = 0>
+void MultiplyInPlace(Range& values, Int factor) {
+  using Dec = impl::BulkDecimal<Range>;
+  static_assert(kIsDecimal<Dec>,
+                "MultiplyInPlace expects a contiguous range of Decimal");
+
+  const int64_t factor64 = impl::ToInt64(factor);
+  bool is_overflow = false;
+  for (auto& value : values) {
+    int64_t result{};
+    is_overflow |=
+        __builtin_mul_overflow(value.AsUnbiased(), factor64, &result);
+    value = Dec::FromUnbiased(result);
+  }
+  if (is_overflow) throw OutOfBoundsError();
+}
+
+/// @brief Multiplies each of `values` by a `Decimal`, rounding the results
+/// according to `RoundPolicy`
+///
+/// @throw decimal64::OutOfBoundsError if any of the results does not fit into
+/// `Decimal`, `values` are left partially updated in this case
+template <typename Range, int Prec2, typename RoundPolicy>
+void MultiplyInPlace(Range& values, Decimal<Prec2, RoundPolicy> factor) {
+  using Dec = impl::BulkDecimal<Range>;
+  static_assert(kIsDecimal<Dec>,
+                "MultiplyInPlace expects a contiguous range of Decimal");
+  static_assert(std::is_same_v<typename Dec::RoundPolicy, RoundPolicy>,
+                "Rounding policies must match, as for operator*");
+
+  const int64_t factor_unbiased = factor.AsUnbiased();
+  for (auto& value : values) {
+    int64_t product{};
+    if (__builtin_mul_overflow(value.AsUnbiased(), factor_unbiased,
+                               &product)) {
+      // Rare for prices, the wide multiplication handles it
+      value *= factor;
+      continue;
+    }
+    value = Dec::FromUnbiased(impl::Div<RoundPolicy>(product, kPow10<Prec2>));
+  }
+}
+
+/// @brief Converts each of `from` to the `Decimal` type of `to`, as
+/// decimal64::decimal_cast does
+///
+/// `from` and `to` must have the same size.
+///
+/// @throw decimal64::OutOfBoundsError if any of the results does not fit into
+/// the target `Decimal`, `to` is left partially updated in this case
+template <typename FromRange, typename ToRange>
+void CastInto(const FromRange& from, ToRange& to) {
+  using FromDec = impl::BulkDecimal<const FromRange>;
+  using ToDec = impl::BulkDecimal<ToRange>;
+  static_assert(kIsDecimal<FromDec> && kIsDecimal<ToDec>,
+                "CastInto expects contiguous ranges of Decimal");
+  constexpr int kExponent = ToDec::kDecimalPoints - FromDec::kDecimalPoints;
+
+  const std::size_t size = std::size(from);
+  UINVARIANT(std::size(to) == size, "CastInto expects ranges of equal size");
+
+  const FromDec* const source = std::data(from);
+  ToDec* const target = std::data(to);
+
+  if constexpr (kExponent >= 0) {
+    bool is_overflow = false;
+    for (std::size_t i = 0; i < size; ++i) {
+      int64_t result{};
+      is_overflow |= __builtin_mul_overflow(source[i].AsUnbiased(),
+                                            kPow10<kExponent>, &result);
+      target[i] = ToDec::FromUnbiased(result);
+    }
+    if (is_overflow) throw OutOfBoundsError();
+  } else {
+    for (std::size_t i = 0; i < size; ++i) {
+      target[i] = ToDec::FromUnbiased(impl::Div<typename ToDec::RoundPolicy>(
+          source[i].AsUnbiased(), kPow10<-kExponent>));
+    }
+  }
+}
+
+/// @brief Parses `delimiter`-separated decimals, e.g. a column of a CSV file
+///
+/// Each value must match the format of the `Decimal(std::string_view)`
+/// constructor. Typical values are parsed by a specialized fast path.
+///
+/// @throw decimal64::ParseError on invalid input
+/// @throw decimal64::OutOfBoundsError if a value does not fit into `Dec`
+template <typename Dec>
+std::vector<Dec> FromStringBulk(std::string_view input, char delimiter = ',') {
+  static_assert(kIsDecimal<Dec>);
+
+  std::vector<Dec> result;
+  if (input.empty()) return result;
+  result.reserve(std::count(input.begin(), input.end(), delimiter) + 1);
+
+  const char* const end = input.data() + input.size();
+  const char* field_begin = input.data();
+  while (true) {
+    const char* it = field_begin;
+    if (const auto value = impl::TryParseSimple<Dec>(it, end, delimiter)) {
+      result.push_back(*value);
+    } else {
+      // Produces the proper error for invalid input
+      it = std::find(field_begin, end, delimiter);
+      const auto field_size = static_cast<std::size_t>(it - field_begin);
+      result.emplace_back(std::string_view(field_begin, field_size));
+    }
+
+    if (it == end) break;
+    field_begin = it + 1;
+  }
+  return result;
+}
+
+}  // namespace decimal64
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,156 @@
+#pragma once
+
+/// @file userver/formats/common/aggregates.hpp
+/// @brief @copybrief formats::common::ReflectedAggregate
+/// @ingroup userver_universal userver_formats
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <boost/pfr/core.hpp>
+#include <boost/pfr/tuple_size.hpp>
+
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::common {
+
+/// @brief Enables parsing and serialization of an aggregate in all formats
+///
+/// Specialize it for an aggregate with the names of its fields, in the order
+/// of declaration:
+///
+/// @snippet formats/common/aggregates_test.cpp  Sample reflected aggregate
+///
+/// Then the aggregate can be parsed from and serialized to formats::json,
+/// formats::yaml and formats::bson values without hand-written Parse and
+/// Serialize functions, include <userver/formats/parse/aggregates.hpp> and
+/// <userver/formats/serialize/aggregates.hpp>. It is also written to
+/// formats::json::StringBuilder and parsed without building a
+/// formats::json::Value via formats::json::parser::AggregateParser.
+///
+/// Empty std::optional fields are not serialized, missing or null fields are
+/// parsed as empty std::optional.
+template <typename T>
+struct ReflectedAggregate {};
+
+namespace impl {
+
+template <typename T>
+using FieldNamesType = decltype(ReflectedAggregate<T>::kFieldNames);
+
+template <typename T>
+constexpr std::size_t GetFieldsCount() {
+  return std::extent_v<FieldNamesType<T>>;
+}
+
+constexpr std::size_t GetHashSlotsCount(std::size_t fields_count) {
+  std::size_t slots = 1;
+  while (slots < fields_count * 2) slots *= 2;
+  return slots;
+}
+
+// Compile-time perfect hash of the field names, for the lookup of the fields
+// by the key during SAX parsing
+template <std::size_t FieldsCount>
+struct FieldNamesHash final {
+  static constexpr std::size_t kEmptySlot = FieldsCount;
+
+  static constexpr std::uint32_t Hash(std::string_view name,
+                                      std::uint32_t seed) noexcept {
+    std::uint32_t hash = 2166136261u ^ seed;
+    for (const char c : name) {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    // the low bits of FNV-1a do not depend on the high bits of the seed, mix
+    // them in so that every seed gives a different slots layout
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    return hash;
+  }
+
+  constexpr std::size_t Find(std::string_view key,
+                             const std::string_view* names) const noexcept {
+    const auto index = slots[Hash(key, seed) & (slots.size() - 1)];
+    if (index == kEmptySlot || names[index] != key) return kEmptySlot;
+    return index;
+  }
+
+  std::array<std::size_t, GetHashSlotsCount(FieldsCount)> slots{};
+  std::uint32_t seed{0};
+};
+
+template <std::size_t FieldsCount>
+constexpr FieldNamesHash<FieldsCount> MakeFieldNamesHash(
+    const std::string_view* names) {
+  FieldNamesHash<FieldsCount> result{};
+  for (std::uint32_t seed = 0;; ++seed) {
+    result.seed = seed;
+    for (auto& slot : result.slots) slot = result.kEmptySlot;
+
+    bool ok = true;
+    for (std::size_t i = 0; i < FieldsCount && ok; ++i) {
+      auto& slot = result.slots[result.Hash(names[i], seed) &
+                                (result.slots.size() - 1)];
+      if (slot != result.kEmptySlot) {
+        // duplicate names never get a perfect hash
+        if (names[slot] == names[i]) throw "Duplicate field names";
+        ok = false;
+      }
+      slot = i;
+    }
+    if (ok) return result;
+  }
+}
+
+template <typename T>
+struct FieldNames final {
+  static constexpr std::size_t kCount = GetFieldsCount<T>();
+
+  static constexpr std::array<std::string_view, kCount> kNames = [] {
+    std::array<std::string_view, kCount> names{};
+    for (std::size_t i = 0; i < kCount; ++i) {
+      names[i] = ReflectedAggregate<T>::kFieldNames[i];
+    }
+    return names;
+  }();
+
+  static constexpr FieldNamesHash<kCount> kHash =
+      MakeFieldNamesHash<kCount>(kNames.data());
+
+  static constexpr std::size_t Find(std::string_view key) noexcept {
+    return kHash.Find(key, kNames.data());
+  }
+};
+
+template <typename T>
+constexpr bool IsReflectedAggregate() {
+  if constexpr (meta::kIsDetected<FieldNamesType, T>) {
+    static_assert(std::is_aggregate_v<T>,
+                  "formats::common::ReflectedAggregate is specialized for a "
+                  "type that is not an aggregate");
+    static_assert(GetFieldsCount<T>() == boost::pfr::tuple_size_v<T>,
+                  "The count of field names in "
+                  "formats::common::ReflectedAggregate does not match the "
+                  "count of fields of the aggregate");
+    return true;
+  } else {
+    return false;
+  }
+}
+
+}  // namespace impl
+
+/// Whether formats::common::ReflectedAggregate is specialized for `T`
+template <typename T>
+inline constexpr bool kIsReflectedAggregate = impl::IsReflectedAggregate<T>();
+
+}  // namespace formats::common
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,162 @@
+#pragma once
+
+/// @file userver/formats/json/lazy_value.hpp
+/// @brief @copybrief formats::json::LazyValue
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+struct LazyDocument;
+}  // namespace impl
+
+/// @ingroup userver_universal userver_formats
+///
+/// @brief Non-mutable JSON value that is parsed on demand.
+///
+/// formats::json::FromStringLazy makes a single pass over the input and
+/// builds an index of the structural characters (`{}[]:,` outside of
+/// strings). Member and element access only walks that index, skipping the
+/// nested objects and arrays in O(1), and no DOM is built for the parts of
+/// the document that are never accessed. Conversions go through the usual
+/// formats::json::Value::As, only the accessed value is parsed into a DOM.
+///
+/// Use it for big documents when only a few fields are read. When most of
+/// the document is read, formats::json::FromString is faster.
+///
+/// Only the structure of the document is validated by FromStringLazy, the
+/// scalars and strings are validated when accessed. Paths in the exceptions
+/// thrown by As are relative to the converted value.
+///
+/// ## Example usage:
+///
+/// @snippet formats/json/lazy_value_test.cpp  Sample formats::json::LazyValue usage
+class LazyValue final {
+ public:
+  /// @brief Constructs a missing value
+  LazyValue() noexcept;
+
+  LazyValue(const LazyValue&);
+  LazyValue(LazyValue&&) noexcept;
+  LazyValue& operator=(const LazyValue&);
+  LazyValue& operator=(LazyValue&&) noexcept;
+  ~LazyValue();
+
+  /// @brief Access member by key.
+  /// @throw TypeMismatchException if not a missing value, an object or null.
+  LazyValue operator[](std::string_view key) const;
+
+  /// @brief Access array member by index.
+  /// @throw TypeMismatchException if not an array value.
+  /// @throw OutOfBoundsException if index is greater or equal
+  /// than size.
+  LazyValue operator[](std::size_t index) const;
+
+  /// @brief Returns whether the array or object is empty.
+  /// @throw TypeMismatchException if not an array or an object.
+  bool IsEmpty() const;
+
+  /// @brief Returns array size or object members count.
+  /// @throw TypeMismatchException if not an array or an object.
+  std::size_t GetSize() const;
+
+  /// @brief Returns true if *this holds nothing. When `IsMissing()` returns
+  /// `true` any attempt to get the actual value or iterate over *this will
+  /// throw MemberMissingException.
+  bool IsMissing() const noexcept;
+
+  /// @brief Returns true if *this holds a null (Type::kNull).
+  bool IsNull() const noexcept;
+
+  /// @brief Returns true if *this holds a bool.
+  bool IsBool() const noexcept;
+
+  /// @brief Returns true if *this holds a number.
+  bool IsNumber() const noexcept;
+
+  /// @brief Returns true if *this holds a string.
+  bool IsString() const noexcept;
+
+  /// @brief Returns true if *this holds an array (Type::kArray).
+  bool IsArray() const noexcept;
+
+  /// @brief Returns true if *this holds a map (Type::kObject).
+  bool IsObject() const noexcept;
+
+  /// @brief Returns true if *this holds a `key`.
+  /// @throw TypeMismatchException if `*this` is not a map or null.
+  bool HasMember(std::string_view key) const;
+
+  /// @brief Returns the JSON text of the value, as it is in the input.
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  std::string_view GetRawJson() const;
+
+  /// @brief Returns full path to this value.
+  std::string GetPath() const;
+
+  /// @brief Parses the value into a DOM, the result is a root value.
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  /// @throw ParseException if the value is not a valid JSON.
+  Value Parse() const;
+
+  /// @brief Extracts the specified type with strict type checks, see
+  /// formats::json::Value::As.
+  template <typename T>
+  T As() const {
+    return Parse().As<T>();
+  }
+
+  /// @brief Extracts the specified type with strict type checks, or
+  /// constructs the default value when the field is not present
+  template <typename T, typename First, typename... Rest>
+  T As(First&& default_arg, Rest&&... more_default_args) const {
+    if (IsMissing() || IsNull()) {
+      return T(std::forward<First>(default_arg),
+               std::forward<Rest>(more_default_args)...);
+    }
+    return As<T>();
+  }
+
+  /// @throw MemberMissingException if `this->IsMissing()`.
+  void CheckNotMissing() const;
+
+ private:
+  friend LazyValue FromStringLazy(std::string_view doc);
+
+  LazyValue(std::shared_ptr<const impl::LazyDocument> document,
+            std::size_t begin, std::size_t end, std::uint32_t structural,
+            std::string path);
+
+  LazyValue MakeMissing(std::string path) const;
+  char GetFirstChar() const noexcept;
+  void CheckContainer() const;
+
+  std::shared_ptr<const impl::LazyDocument> document_;
+  // text of the value is [begin_, end_) of the document
+  std::size_t begin_{0};
+  std::size_t end_{0};
+  // index of the opening bracket in the structural index, for objects and
+  // arrays only
+  std::uint32_t structural_{0};
+  std::string path_;
+};
+
+/// @brief Indexes the JSON for the on-demand parsing
+/// @throw ParseException if the document is empty or its structure is
+/// invalid
+/// @see formats::json::LazyValue
+LazyValue FromStringLazy(std::string_view doc);
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
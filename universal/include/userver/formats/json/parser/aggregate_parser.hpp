@@ -0,0 +1,391 @@
+#pragma once
+
+/// @file userver/formats/json/parser/aggregate_parser.hpp
+/// @brief @copybrief formats::json::parser::AggregateParser
+
+#include <bitset>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <userver/formats/common/aggregates.hpp>
+#include <userver/formats/json/parser/array_parser.hpp>
+#include <userver/formats/json/parser/bool_parser.hpp>
+#include <userver/formats/json/parser/int_parser.hpp>
+#include <userver/formats/json/parser/map_parser.hpp>
+#include <userver/formats/json/parser/number_parser.hpp>
+#include <userver/formats/json/parser/parser_json.hpp>
+#include <userver/formats/json/parser/string_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/formats/parse/aggregates.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+template <typename T>
+class AggregateParser;
+
+namespace impl {
+
+template <typename T, typename = void>
+struct ParserFor;
+
+template <typename T>
+inline constexpr bool kIsStringKeyMap = false;
+
+template <typename Value, typename... Rest>
+inline constexpr bool kIsStringKeyMap<std::map<std::string, Value, Rest...>> =
+    true;
+
+template <typename Value, typename... Rest>
+inline constexpr bool
+    kIsStringKeyMap<std::unordered_map<std::string, Value, Rest...>> = true;
+
+template <typename T>
+using ParserForType = typename ParserFor<T>::Type;
+
+// Parses a formats::json::Value and converts it to `T` with As, for the
+// types without a dedicated SAX parser
+template <typename T>
+class ValueAsParser final : public Subscriber<Value> {
+ public:
+  using ResultType = T;
+
+  ValueAsParser() { value_parser_.Subscribe(*this); }
+
+  void Reset() { value_parser_.Reset(); }
+
+  void Subscribe(Subscriber<T>& subscriber) { subscriber_ = &subscriber; }
+
+  auto& GetParser() { return value_parser_.GetParser(); }
+
+ private:
+  void OnSend(Value&& value) override {
+    if (subscriber_) subscriber_->OnSend(value.As<T>());
+  }
+
+  JsonValueParser value_parser_;
+  Subscriber<T>* subscriber_{nullptr};
+};
+
+// Owns the item parser of an ArrayParser
+template <typename Array>
+class OwningArrayParser final {
+ public:
+  using Item = meta::RangeValueType<Array>;
+  using ResultType = Array;
+
+  void Reset() { array_parser_.Reset(); }
+
+  void Subscribe(Subscriber<Array>& subscriber) {
+    array_parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return array_parser_.GetParser(); }
+
+ private:
+  ParserForType<Item> item_parser_;
+  ArrayParser<Item, ParserForType<Item>, Array> array_parser_{item_parser_};
+};
+
+// Owns the value parser of a MapParser
+template <typename Map>
+class OwningMapParser final {
+ public:
+  using Item = typename Map::mapped_type;
+  using ResultType = Map;
+
+  void Reset() { map_parser_.Reset(); }
+
+  void Subscribe(Subscriber<Map>& subscriber) {
+    map_parser_.Subscribe(subscriber);
+  }
+
+  auto& GetParser() { return map_parser_.GetParser(); }
+
+ private:
+  ParserForType<Item> item_parser_;
+  MapParser<Map, ParserForType<Item>> map_parser_{item_parser_};
+};
+
+// Parses null as an empty optional, delegates other values to `ItemParser`
+template <typename T>
+class OptionalParser final : public TypedParser<std::optional<T>>,
+                             public Subscriber<T> {
+ public:
+  OptionalParser() { item_parser_.Subscribe(*this); }
+
+  void Null() override { this->SetResult(std::nullopt); }
+  void Bool(bool b) override { PushItemParser().Bool(b); }
+  void Int64(int64_t i) override { PushItemParser().Int64(i); }
+  void Uint64(uint64_t i) override { PushItemParser().Uint64(i); }
+  void Double(double d) override { PushItemParser().Double(d); }
+  void String(std::string_view sw) override { PushItemParser().String(sw); }
+  void StartObject() override { PushItemParser().StartObject(); }
+  void StartArray() override { PushItemParser().StartArray(); }
+
+ private:
+  BaseParser& PushItemParser() {
+    item_parser_.Reset();
+    this->parser_state_->PushParser(item_parser_.GetParser());
+    return item_parser_.GetParser();
+  }
+
+  void OnSend(T&& value) override { this->SetResult(std::move(value)); }
+
+  std::string GetPathItem() const override { return {}; }
+
+  std::string Expected() const override { return "value or null"; }
+
+  ParserForType<T> item_parser_;
+};
+
+// Skips the value of an unknown field
+class SkipParser final : public TypedParser<bool> {
+ public:
+  void Reset() override { depth_ = 0; }
+
+  void Null() override { OnScalar(); }
+  void Bool(bool) override { OnScalar(); }
+  void Int64(int64_t) override { OnScalar(); }
+  void Uint64(uint64_t) override { OnScalar(); }
+  void Double(double) override { OnScalar(); }
+  void String(std::string_view) override { OnScalar(); }
+  void StartObject() override { ++depth_; }
+  void Key(std::string_view) override {}
+  void EndObject() override { OnEnd(); }
+  void StartArray() override { ++depth_; }
+  void EndArray() override { OnEnd(); }
+
+ private:
+  void OnScalar() {
+    if (depth_ == 0) this->SetResult(true);
+  }
+
+  void OnEnd() {
+    if (--depth_ == 0) this->SetResult(true);
+  }
+
+  std::string GetPathItem() const override { return {}; }
+
+  std::string Expected() const override { return "value"; }
+
+  std::size_t depth_{0};
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<std::is_same_v<T, bool>>> {
+  using Type = BoolParser;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<std::is_same_v<T, std::int32_t>>> {
+  using Type = Int32Parser;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<std::is_same_v<T, std::int64_t>>> {
+  using Type = Int64Parser;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+  using Type = NumberParser<T>;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<std::is_same_v<T, std::string>>> {
+  using Type = StringParser;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<meta::kIsOptional<T>>> {
+  using Type = OptionalParser<typename T::value_type>;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<meta::kIsVector<T>>> {
+  using Type = OwningArrayParser<T>;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<kIsStringKeyMap<T>>> {
+  using Type = OwningMapParser<T>;
+};
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<common::kIsReflectedAggregate<T>>> {
+  using Type = AggregateParser<T>;
+};
+
+template <typename T>
+constexpr bool HasDedicatedParser() {
+  return std::is_same_v<T, bool> || std::is_same_v<T, std::int32_t> ||
+         std::is_same_v<T, std::int64_t> || std::is_floating_point_v<T> ||
+         std::is_same_v<T, std::string> || meta::kIsOptional<T> ||
+         meta::kIsVector<T> || kIsStringKeyMap<T> ||
+         common::kIsReflectedAggregate<T>;
+}
+
+template <typename T>
+struct ParserFor<T, std::enable_if_t<!HasDedicatedParser<T>()>> {
+  using Type = ValueAsParser<T>;
+};
+
+// Stores the parsed value of a field into the aggregate
+template <typename T, std::size_t Index>
+class FieldSink final
+    : public Subscriber<boost::pfr::tuple_element_t<Index, T>> {
+ public:
+  explicit FieldSink(T& result) : result_(result) {}
+
+  void OnSend(boost::pfr::tuple_element_t<Index, T>&& value) override {
+    boost::pfr::get<Index>(result_) = std::move(value);
+  }
+
+ private:
+  T& result_;
+};
+
+template <typename T, typename Indices>
+struct AggregateFields;
+
+template <typename T, std::size_t... Indices>
+struct AggregateFields<T, std::index_sequence<Indices...>> final {
+  explicit AggregateFields(T& result)
+      : sinks{FieldSink<T, Indices>(result)...} {
+    (std::get<Indices>(parsers).Subscribe(std::get<Indices>(sinks)), ...);
+  }
+
+  std::tuple<ParserForType<boost::pfr::tuple_element_t<Indices, T>>...>
+      parsers;
+  std::tuple<FieldSink<T, Indices>...> sinks;
+};
+
+}  // namespace impl
+
+/// @brief SAX parser for the aggregates marked with
+/// formats::common::ReflectedAggregate.
+///
+/// The fields are looked up by a compile-time perfect hash of their names,
+/// and parsed by the SAX parsers of their types without building a
+/// formats::json::Value. The types without a dedicated SAX parser (e.g.
+/// unsigned integers or types with custom Parse functions) are parsed into a
+/// formats::json::Value and converted via As.
+///
+/// Unknown fields are skipped, missing fields that are not std::optional are
+/// reported as errors.
+///
+/// @snippet formats/common/aggregates_test.cpp  Sample aggregate SAX parsing
+template <typename T>
+class AggregateParser final : public TypedParser<T> {
+ public:
+  AggregateParser() = default;
+
+  AggregateParser(const AggregateParser&) = delete;
+  AggregateParser& operator=(const AggregateParser&) = delete;
+
+  void Reset() override {
+    state_ = State::kStart;
+    result_ = T{};
+    seen_.reset();
+  }
+
+ private:
+  using Names = common::impl::FieldNames<T>;
+  static constexpr std::size_t kFieldsCount = Names::kCount;
+  using Indices = std::make_index_sequence<kFieldsCount>;
+
+  void StartObject() override {
+    if (state_ != State::kStart) this->Throw("object");
+    state_ = State::kInside;
+  }
+
+  void Key(std::string_view key) override {
+    if (state_ != State::kInside) {
+      this->Throw("field '" + std::string(key) + "'");
+    }
+
+    const auto index = Names::Find(key);
+    if (index == kFieldsCount) {
+      unknown_key_ = key;
+      current_ = kFieldsCount;
+      skip_parser_.Reset();
+      this->parser_state_->PushParser(skip_parser_.GetParser());
+      return;
+    }
+
+    current_ = index;
+    seen_.set(index);
+    PushFieldParser(index, Indices{});
+  }
+
+  void EndObject() override {
+    if (state_ != State::kInside) this->Throw("'}'");
+    CheckRequiredFields(Indices{});
+    this->SetResult(std::move(result_));
+  }
+
+  template <std::size_t... I>
+  void PushFieldParser(std::size_t index, std::index_sequence<I...>) {
+    ((index == I ? PushFieldParser<I>() : void()), ...);
+  }
+
+  template <std::size_t I>
+  void PushFieldParser() {
+    auto& parser = std::get<I>(fields_.parsers);
+    parser.Reset();
+    this->parser_state_->PushParser(parser.GetParser());
+  }
+
+  template <std::size_t... I>
+  void CheckRequiredFields(std::index_sequence<I...>) const {
+    (CheckRequiredField<I>(), ...);
+  }
+
+  template <std::size_t I>
+  void CheckRequiredField() const {
+    if constexpr (!meta::kIsOptional<boost::pfr::tuple_element_t<I, T>>) {
+      if (!seen_.test(I)) {
+        throw InternalParseError("Field '" + std::string{Names::kNames[I]} +
+                                 "' is missing");
+      }
+    }
+  }
+
+  std::string GetPathItem() const override {
+    if (state_ != State::kInside) return {};
+    if (current_ == kFieldsCount) return unknown_key_;
+    return std::string{Names::kNames[current_]};
+  }
+
+  std::string Expected() const override {
+    return state_ == State::kInside ? "field name or '}'" : "object";
+  }
+
+  enum class State {
+    kStart,
+    kInside,
+  };
+
+  State state_{State::kStart};
+  T result_{};
+  std::bitset<kFieldsCount> seen_;
+  std::size_t current_{kFieldsCount};
+  std::string unknown_key_;
+  impl::AggregateFields<T, Indices> fields_{result_};
+  impl::SkipParser skip_parser_;
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,219 @@
+#pragma once
+
+/// @file userver/formats/json/parser/columnar_parser.hpp
+/// @brief @copybrief formats::json::parser::ColumnarParser
+
+#include <bitset>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <userver/formats/common/aggregates.hpp>
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/parser/typed_parser.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::parser {
+
+namespace impl {
+
+template <typename Columns, std::size_t Index>
+using ColumnItem =
+    typename boost::pfr::tuple_element_t<Index, Columns>::value_type;
+
+// Appends the parsed value of a field to its column
+template <typename Columns, std::size_t Index>
+class ColumnSink final : public Subscriber<ColumnItem<Columns, Index>> {
+ public:
+  explicit ColumnSink(Columns& result) : result_(result) {}
+
+  void OnSend(ColumnItem<Columns, Index>&& value) override {
+    boost::pfr::get<Index>(result_).push_back(std::move(value));
+  }
+
+ private:
+  Columns& result_;
+};
+
+template <typename Columns, typename Indices>
+struct ColumnarFields;
+
+template <typename Columns, std::size_t... Indices>
+struct ColumnarFields<Columns, std::index_sequence<Indices...>> final {
+  explicit ColumnarFields(Columns& result)
+      : sinks{ColumnSink<Columns, Indices>(result)...} {
+    (std::get<Indices>(parsers).Subscribe(std::get<Indices>(sinks)), ...);
+  }
+
+  std::tuple<ParserForType<ColumnItem<Columns, Indices>>...> parsers;
+  std::tuple<ColumnSink<Columns, Indices>...> sinks;
+};
+
+template <typename Columns, std::size_t... Indices>
+constexpr bool AreAllFieldsVectors(std::index_sequence<Indices...>) {
+  return (meta::kIsVector<boost::pfr::tuple_element_t<Indices, Columns>> &&
+          ...);
+}
+
+}  // namespace impl
+
+// clang-format off
+
+/// @brief SAX parser of a JSON array of objects into a struct of columns
+///
+/// `Columns` is an aggregate of std::vector fields marked with
+/// formats::common::ReflectedAggregate. Each object of the array is a row:
+/// its fields are looked up by the names of the columns and parsed straight
+/// into the column vectors, without building a formats::json::Value or a
+/// per-row object. The result may be passed as is to the APIs that take
+/// columns, e.g. storages::clickhouse::Cluster::Insert.
+///
+/// The items of the columns are parsed as the fields of
+/// formats::json::parser::AggregateParser. Unknown fields are skipped,
+/// missing fields of std::optional columns are parsed as empty optionals,
+/// other missing fields are reported as errors.
+///
+/// @snippet formats/json/parser/columnar_parser_test.cpp  Sample columnar parsing
+
+// clang-format on
+
+template <typename Columns>
+class ColumnarParser final : public TypedParser<Columns> {
+ public:
+  ColumnarParser() = default;
+
+  ColumnarParser(const ColumnarParser&) = delete;
+  ColumnarParser& operator=(const ColumnarParser&) = delete;
+
+  void Reset() override {
+    state_ = State::kStart;
+    result_ = Columns{};
+    rows_ = 0;
+  }
+
+ private:
+  using Names = common::impl::FieldNames<Columns>;
+  static constexpr std::size_t kColumnsCount = Names::kCount;
+  using Indices = std::make_index_sequence<kColumnsCount>;
+
+  static_assert(impl::AreAllFieldsVectors<Columns>(Indices{}),
+                "All the fields of the columns must be std::vector");
+
+  void StartArray() override {
+    if (state_ != State::kStart) this->Throw("array");
+    state_ = State::kArray;
+  }
+
+  void StartObject() override {
+    if (state_ != State::kArray) this->Throw("object");
+    state_ = State::kObject;
+    seen_.reset();
+  }
+
+  void Key(std::string_view key) override {
+    if (state_ != State::kObject) {
+      this->Throw("field '" + std::string(key) + "'");
+    }
+
+    const auto index = Names::Find(key);
+    if (index == kColumnsCount) {
+      unknown_key_ = key;
+      current_ = kColumnsCount;
+      skip_parser_.Reset();
+      this->parser_state_->PushParser(skip_parser_.GetParser());
+      return;
+    }
+
+    if (seen_.test(index)) {
+      throw InternalParseError("Duplicate field '" + std::string(key) + "'");
+    }
+    current_ = index;
+    seen_.set(index);
+    PushFieldParser(index, Indices{});
+  }
+
+  void EndObject() override {
+    if (state_ != State::kObject) this->Throw("'}'");
+    FillMissingFields(Indices{});
+    ++rows_;
+    state_ = State::kArray;
+  }
+
+  void EndArray() override {
+    if (state_ != State::kArray) this->Throw("']'");
+    this->SetResult(std::move(result_));
+  }
+
+  template <std::size_t... I>
+  void PushFieldParser(std::size_t index, std::index_sequence<I...>) {
+    ((index == I ? PushFieldParser<I>() : void()), ...);
+  }
+
+  template <std::size_t I>
+  void PushFieldParser() {
+    auto& parser = std::get<I>(fields_.parsers);
+    parser.Reset();
+    this->parser_state_->PushParser(parser.GetParser());
+  }
+
+  template <std::size_t... I>
+  void FillMissingFields(std::index_sequence<I...>) {
+    (FillMissingField<I>(), ...);
+  }
+
+  // Keeps the columns of the same length
+  template <std::size_t I>
+  void FillMissingField() {
+    if (seen_.test(I)) return;
+    if constexpr (meta::kIsOptional<impl::ColumnItem<Columns, I>>) {
+      boost::pfr::get<I>(result_).emplace_back();
+    } else {
+      throw InternalParseError("Field '" + std::string{Names::kNames[I]} +
+                               "' is missing");
+    }
+  }
+
+  std::string GetPathItem() const override {
+    if (state_ == State::kStart) return {};
+    if (state_ == State::kArray) return std::to_string(rows_);
+    if (current_ == kColumnsCount) {
+      return std::to_string(rows_) + '.' + unknown_key_;
+    }
+    return std::to_string(rows_) + '.' + std::string{Names::kNames[current_]};
+  }
+
+  std::string Expected() const override {
+    switch (state_) {
+      case State::kStart:
+        return "array";
+      case State::kArray:
+        return "object or ']'";
+      case State::kObject:
+        return "field name or '}'";
+    }
+    return {};
+  }
+
+  enum class State {
+    kStart,
+    kArray,
+    kObject,
+  };
+
+  State state_{State::kStart};
+  Columns result_{};
+  std::size_t rows_{0};
+  std::bitset<kColumnsCount> seen_;
+  std::size_t current_{kColumnsCount};
+  std::string unknown_key_;
+  impl::ColumnarFields<Columns, Indices> fields_{result_};
+  impl::SkipParser skip_parser_;
+};
+
+}  // namespace formats::json::parser
+
+USERVER_NAMESPACE_END
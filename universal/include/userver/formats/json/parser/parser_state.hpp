@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <userver/utils/fast_pimpl.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -24,6 +26,14 @@ class ParserState final {
 
   void ProcessInput(std::string_view sw);
 
+  /// @brief Same as ProcessInput(), but reads the input by chunks so that the
+  /// whole input never has to be held in memory.
+  ///
+  /// `read_chunk` is called each time more input is needed, it returns an empty
+  /// string_view at the end of input. The returned data must be valid until
+  /// the next call.
+  void ProcessChunkedInput(utils::function_ref<std::string_view()> read_chunk);
+
   void PopMe(BaseParser& parser);
 
   [[noreturn]] void ThrowError(const std::string& err_msg);
@@ -169,6 +169,23 @@ T ParseToType(std::string_view input) {
   return result;
 }
 
+/// Same as ParseToType(), but reads the input by chunks, see
+/// ParserState::ProcessChunkedInput()
+template <typename T, typename Parser>
+T ParseChunkedToType(utils::function_ref<std::string_view()> read_chunk) {
+  T result{};
+  Parser parser;
+  parser.Reset();
+  SubscriberSink<T> sink(result);
+  parser.Subscribe(sink);
+
+  ParserState state;
+  state.PushParser(parser);
+  state.ProcessChunkedInput(read_chunk);
+
+  return result;
+}
+
 }  // namespace formats::json::parser
 
 USERVER_NAMESPACE_END
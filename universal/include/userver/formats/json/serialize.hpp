@@ -11,6 +11,7 @@
 #include <userver/formats/json/value.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 #include <userver/utils/fmt_compat.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -20,6 +21,10 @@ class LogHelper;
 
 }  // namespace logging
 
+namespace utils {
+class Arena;
+}  // namespace utils
+
 namespace formats::json {
 
 constexpr inline std::size_t kDepthParseLimit = 128;
@@ -27,9 +32,29 @@ constexpr inline std::size_t kDepthParseLimit = 128;
 /// Parse JSON from string
 formats::json::Value FromString(std::string_view doc);
 
+/// @brief Parse JSON from string into the `arena`, e.g. the one from
+/// server::request::RequestBase::GetArena().
+///
+/// Saves the allocations of the nodes of the document. The returned value and
+/// the values obtained from it must not outlive the `arena`, use
+/// formats::json::Value::Clone() to keep them longer.
+/// formats::json::ValueBuilder copies such values instead of taking over
+/// their nodes.
+formats::json::Value FromStringInArena(std::string_view doc,
+                                       utils::Arena& arena);
+
 /// Parse JSON from stream
 formats::json::Value FromStream(std::istream& is);
 
+/// @brief Parse JSON from the chunks of input, the whole input never has to be
+/// held in memory.
+///
+/// `read_chunk` is called each time more input is needed, it returns an empty
+/// string_view at the end of input. The returned data must be valid until
+/// the next call.
+formats::json::Value FromChunks(
+    utils::function_ref<std::string_view()> read_chunk);
+
 /// Serialize JSON to stream
 void Serialize(const formats::json::Value& doc, std::ostream& os);
 
@@ -7,6 +7,7 @@
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/variant.hpp>
 
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/serialize/to.hpp>
 
@@ -24,6 +25,13 @@ formats::json::Value Serialize(const boost::variant<Types...>& value,
       value);
 }
 
+template <typename... Types>
+void WriteToStream(const boost::variant<Types...>& value,
+                   formats::json::StringBuilder& sw) {
+  boost::apply_visitor([&sw](const auto& item) { WriteToStream(item, sw); },
+                       value);
+}
+
 }  // namespace formats::serialize
 
 USERVER_NAMESPACE_END
@@ -67,6 +67,13 @@ class StringBuilder final : public serialize::SaxStream {
   std::string GetString() const;
   std::string_view GetStringView() const;
 
+  /// @brief Returns the JSON written so far and clears the buffer
+  ///
+  /// The open objects and arrays stay open, the rest of the JSON is written
+  /// as usual. Allows sending a large JSON in parts without keeping it all in
+  /// memory.
+  std::string ExtractString();
+
   void WriteNull();
   void WriteString(std::string_view value);
   void WriteBool(bool value);
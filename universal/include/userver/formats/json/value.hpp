@@ -16,6 +16,7 @@
 #include <userver/formats/json/string_builder_fwd.hpp>
 #include <userver/formats/json/validate.hpp>
 #include <userver/formats/parse/common.hpp>
+#include <userver/utils/function_ref.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,6 +24,10 @@ namespace logging {
 class LogHelper;
 }  // namespace logging
 
+namespace utils {
+class Arena;
+}  // namespace utils
+
 namespace formats::json {
 namespace impl {
 class InlineObjectBuilder;
@@ -322,7 +327,11 @@ class Value final {
   friend std::string Parse(const Value& value, parse::To<std::string>);
 
   friend formats::json::Value FromString(std::string_view);
+  friend formats::json::Value FromStringInArena(std::string_view,
+                                              utils::Arena&);
   friend formats::json::Value FromStream(std::istream&);
+  friend formats::json::Value FromChunks(
+      utils::function_ref<std::string_view()>);
   friend void Serialize(const formats::json::Value&, std::ostream&);
   friend std::string ToString(const formats::json::Value&);
   friend std::string ToStableString(const formats::json::Value&);
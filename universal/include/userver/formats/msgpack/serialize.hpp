@@ -0,0 +1,34 @@
+#pragma once
+
+/// @file userver/formats/msgpack/serialize.hpp
+/// @brief Parsers and serializers of MessagePack
+/// @ingroup userver_universal userver_formats
+
+#include <string>
+#include <string_view>
+
+#include <userver/formats/json/value.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// MessagePack support
+///
+/// MessagePack documents are represented by formats::json::Value, so the
+/// Parse and Serialize functions written for JSON are used as is. Maps with
+/// non-string keys and extension types are not supported, binary data is
+/// parsed as strings.
+namespace formats::msgpack {
+
+/// @brief Parse MessagePack from a string of bytes
+/// @throws formats::json::ParseException on malformed or unsupported data
+formats::json::Value FromString(std::string_view data);
+
+/// @brief Serialize the value to a string of MessagePack bytes
+///
+/// The integers are written in the shortest form, the doubles are written
+/// as float 64.
+std::string ToString(const formats::json::Value& value);
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
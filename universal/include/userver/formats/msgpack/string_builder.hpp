@@ -0,0 +1,115 @@
+#pragma once
+
+/// @file userver/formats/msgpack/string_builder.hpp
+/// @brief @copybrief formats::msgpack::StringBuilder
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/formats/json/value.hpp>
+#include <userver/formats/serialize/to.hpp>
+#include <userver/formats/serialize/write_to_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+// clang-format off
+
+/// @ingroup userver_universal userver_containers userver_formats userver_formats_serialize_sax
+///
+/// @brief SAX like builder of MessagePack, the counterpart of
+/// formats::json::StringBuilder with the same interface.
+///
+/// The WriteToStream functions that are templates over the builder type work
+/// with both builders. The sizes of maps and arrays are written when their
+/// guards are destroyed.
+///
+/// ## Example usage:
+///
+/// @snippet formats/msgpack/string_builder_test.cpp  Sample formats::msgpack::StringBuilder usage
+
+// clang-format on
+
+class StringBuilder final : public serialize::SaxStream {
+ public:
+  // Required by the WriteToStream fallback to Serialize
+  using Value = formats::json::Value;
+
+  StringBuilder();
+  ~StringBuilder();
+
+  /// Construct this guard on new object start and its destructor will end the
+  /// object
+  class ObjectGuard final {
+   public:
+    explicit ObjectGuard(StringBuilder& sw);
+    ~ObjectGuard();
+
+   private:
+    StringBuilder& sw_;
+  };
+
+  /// Construct this guard on new array start and its destructor will end the
+  /// array
+  class ArrayGuard final {
+   public:
+    explicit ArrayGuard(StringBuilder& sw);
+    ~ArrayGuard();
+
+   private:
+    StringBuilder& sw_;
+  };
+
+  /// @return MessagePack bytes
+  std::string GetString() const;
+  std::string_view GetStringView() const;
+
+  void WriteNull();
+  void WriteString(std::string_view value);
+  void WriteBool(bool value);
+  void WriteInt64(int64_t value);
+  void WriteUInt64(uint64_t value);
+  void WriteDouble(double value);
+
+  /// ONLY for objects/dicts: write key
+  void Key(std::string_view sw);
+
+  void WriteValue(const Value& value);
+
+ private:
+  struct Container {
+    std::size_t header_offset;
+    std::uint32_t size;
+    bool is_map;
+  };
+
+  void StartContainer(bool is_map);
+  void EndContainer();
+  void OnValue();
+
+  std::string data_;
+  std::vector<Container> containers_;
+};
+
+void WriteToStream(bool value, StringBuilder& sw);
+void WriteToStream(long long value, StringBuilder& sw);
+void WriteToStream(unsigned long long value, StringBuilder& sw);
+void WriteToStream(int value, StringBuilder& sw);
+void WriteToStream(unsigned value, StringBuilder& sw);
+void WriteToStream(long value, StringBuilder& sw);
+void WriteToStream(unsigned long value, StringBuilder& sw);
+void WriteToStream(double value, StringBuilder& sw);
+void WriteToStream(const char* value, StringBuilder& sw);
+void WriteToStream(std::string_view value, StringBuilder& sw);
+void WriteToStream(const formats::json::Value& value, StringBuilder& sw);
+void WriteToStream(const std::string& value, StringBuilder& sw);
+
+void WriteToStream(std::chrono::system_clock::time_point tp, StringBuilder& sw);
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
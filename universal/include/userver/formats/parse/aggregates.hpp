@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file userver/formats/parse/aggregates.hpp
+/// @brief Parsers for aggregates marked with
+/// formats::common::ReflectedAggregate
+/// @ingroup userver_universal userver_formats_parse
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <userver/formats/common/aggregates.hpp>
+#include <userver/formats/common/meta.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/utils/meta_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::parse {
+
+namespace impl {
+
+template <typename Value>
+using HasStringViewSubscript =
+    decltype(std::declval<const Value&>()[std::string_view{}]);
+
+template <typename Value>
+Value GetMember(const Value& value, std::string_view name) {
+  if constexpr (meta::kIsDetected<HasStringViewSubscript, Value>) {
+    return value[name];
+  } else {
+    return value[std::string{name}];
+  }
+}
+
+template <typename T, typename Value, std::size_t... Indices>
+T ParseAggregate(const Value& value, std::index_sequence<Indices...>) {
+  using Names = common::impl::FieldNames<T>;
+  // fields are parsed left-to-right in brace-init
+  return T{GetMember(value, Names::kNames[Indices])
+               .template As<boost::pfr::tuple_element_t<Indices, T>>()...};
+}
+
+}  // namespace impl
+
+/// Parses the aggregates marked with formats::common::ReflectedAggregate
+template <typename Value, typename T>
+std::enable_if_t<common::kIsFormatValue<Value> &&
+                     common::kIsReflectedAggregate<T>,
+                 T>
+Parse(const Value& value, To<T>) {
+  value.CheckObjectOrNull();
+  return impl::ParseAggregate<T>(
+      value, std::make_index_sequence<common::impl::GetFieldsCount<T>()>{});
+}
+
+}  // namespace formats::parse
+
+USERVER_NAMESPACE_END
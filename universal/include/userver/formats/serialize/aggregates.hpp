@@ -0,0 +1,51 @@
+#pragma once
+
+/// @file userver/formats/serialize/aggregates.hpp
+/// @brief Serializers for aggregates marked with
+/// formats::common::ReflectedAggregate
+/// @ingroup userver_universal userver_formats_serialize
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <userver/formats/common/aggregates.hpp>
+#include <userver/formats/common/type.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+#include <userver/formats/serialize/to.hpp>
+#include <userver/formats/serialize/write_to_stream.hpp>
+#include <userver/utils/meta.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::serialize {
+
+namespace impl {
+
+template <typename Value, typename T, std::size_t... Indices>
+Value SerializeAggregate(const T& value, std::index_sequence<Indices...>) {
+  using Names = common::impl::FieldNames<T>;
+  typename Value::Builder builder(formats::common::Type::kObject);
+  const auto serialize_field = [&builder](std::string_view name,
+                                          const auto& field) {
+    if (IsEmptyOptional(field)) return;
+    builder[std::string{name}] = field;
+  };
+  (serialize_field(Names::kNames[Indices], boost::pfr::get<Indices>(value)),
+   ...);
+  return builder.ExtractValue();
+}
+
+}  // namespace impl
+
+/// Serializes the aggregates marked with formats::common::ReflectedAggregate
+template <typename T, typename Value>
+std::enable_if_t<common::kIsReflectedAggregate<T>, Value> Serialize(
+    const T& value, To<Value>) {
+  return impl::SerializeAggregate<Value>(
+      value, std::make_index_sequence<common::impl::GetFieldsCount<T>()>{});
+}
+
+}  // namespace formats::serialize
+
+USERVER_NAMESPACE_END
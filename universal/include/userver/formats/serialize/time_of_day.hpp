@@ -16,13 +16,13 @@ namespace formats::serialize {
 
 template <typename Value, typename Duration>
 Value Serialize(const utils::datetime::TimeOfDay<Duration>& value, To<Value>) {
-  return typename Value::Builder(fmt::to_string(value)).ExtractValue();
+  return typename Value::Builder(fmt::format("{}", value)).ExtractValue();
 }
 
-template <typename Value, typename Duration, typename StringBuilder>
+template <typename Duration, typename StringBuilder>
 void WriteToStream(const utils::datetime::TimeOfDay<Duration>& value,
                    StringBuilder& sw) {
-  WriteToStream(fmt::to_string(value), sw);
+  WriteToStream(fmt::format("{}", value), sw);
 }
 
 }  // namespace formats::serialize
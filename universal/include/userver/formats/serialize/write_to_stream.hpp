@@ -6,14 +6,21 @@
 
 #include <map>
 #include <optional>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <variant>
 
 #include <userver/utils/meta.hpp>
 
+#include <userver/formats/common/aggregates.hpp>
 #include <userver/formats/common/meta.hpp>
 
+namespace boost::uuids {
+struct uuid;
+}
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::impl::strong_typedef {
@@ -62,19 +69,57 @@ void WriteToStreamArray(const T& value, StringBuilder& sw) {
   }
 }
 
+// Dict keys are strings or utils::StrongTypedef of strings
+template <typename Key, typename StringBuilder>
+void WriteToStreamKey(const Key& key, StringBuilder& sw) {
+  if constexpr (std::is_convertible_v<const Key&, std::string_view>) {
+    sw.Key(key);
+  } else {
+    static_assert(
+        std::is_convertible_v<
+            const Key&, const utils::impl::strong_typedef::StrongTypedefTag&>,
+        "Dict keys should be strings or StrongTypedefs of strings");
+    sw.Key(key.GetUnderlying());
+  }
+}
+
 // Dict like types serialization
 template <typename T, typename StringBuilder>
 void WriteToStreamDict(const T& value, StringBuilder& sw) {
   typename StringBuilder::ObjectGuard guard(sw);
   for (const auto& [key, item] : value) {
-    sw.Key(key);
+    WriteToStreamKey(key, sw);
     WriteToStream(item, sw);
   }
 }
 
+template <typename Field>
+bool IsEmptyOptional(const Field& field) noexcept {
+  if constexpr (meta::kIsOptional<Field>) {
+    return !field.has_value();
+  } else {
+    return false;
+  }
+}
+
+// formats::common::ReflectedAggregate serialization, empty optionals are
+// skipped
+template <typename T, typename StringBuilder, std::size_t... Indices>
+void WriteToStreamAggregate(const T& value, StringBuilder& sw,
+                            std::index_sequence<Indices...>) {
+  using Names = common::impl::FieldNames<T>;
+  typename StringBuilder::ObjectGuard guard(sw);
+  const auto write_field = [&sw](std::string_view name, const auto& field) {
+    if (IsEmptyOptional(field)) return;
+    sw.Key(name);
+    WriteToStream(field, sw);
+  };
+  (write_field(Names::kNames[Indices], boost::pfr::get<Indices>(value)), ...);
+}
+
 }  // namespace impl
 
-/// Handle ranges, fall back to using formats::*::Serialize
+/// Handle ranges, aggregates marked with formats::common::ReflectedAggregate, fall back to using formats::*::Serialize
 ///
 /// The signature of this WriteToStream must remain the less specialized one, so
 /// that it is not preferred over other functions.
@@ -85,9 +130,16 @@ std::enable_if_t<
 WriteToStream(const T& value, StringBuilder& sw) {
   using Value = typename StringBuilder::Value;
 
-  if constexpr (meta::kIsMap<T>) {
+  if constexpr (common::kIsReflectedAggregate<T>) {
+    impl::WriteToStreamAggregate(
+        value, sw,
+        std::make_index_sequence<common::impl::GetFieldsCount<T>()>{});
+  } else if constexpr (meta::kIsMap<T>) {
     impl::WriteToStreamDict(value, sw);
   } else if constexpr (meta::kIsRange<T>) {
+    static_assert(!std::is_same_v<T, boost::uuids::uuid>,
+                  "Include <userver/formats/serialize/boost_uuid.hpp> to "
+                  "serialize boost::uuids::uuid");
     static_assert(!meta::kIsRecursiveRange<T>,
                   "Trying to log a recursive range, which can be dangerous. "
                   "(boost::filesystem::path?) Please implement WriteToStream "
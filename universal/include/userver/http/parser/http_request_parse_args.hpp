@@ -6,6 +6,7 @@
 
 #include <functional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -27,6 +28,15 @@ using ArgsConsumer =
 
 void ParseAndConsumeArgs(std::string_view args, ArgsConsumer handler);
 
+/// Same as ParseAndConsumeArgs, but decodes and consumes only the arguments
+/// with the decoded name equal to `name`
+void ParseAndConsumeArgsByName(std::string_view args, std::string_view name,
+                               ArgsConsumer handler);
+
+/// Throws std::runtime_error if ParseAndConsumeArgs would throw for `args`,
+/// without decoding the arguments
+void ValidateArgs(std::string_view args);
+
 }  // namespace http::parser
 
 USERVER_NAMESPACE_END
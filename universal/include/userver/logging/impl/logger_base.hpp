@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <string_view>
 
 #include <userver/logging/format.hpp>
 #include <userver/logging/level.hpp>
@@ -26,6 +28,11 @@ class LoggerBase {
 
   virtual void Log(Level level, std::string_view msg) = 0;
 
+  /// Logs a binary record written by LogHelper when the deferred formatting is
+  /// enabled. By default formats the record and passes it to Log().
+  virtual void LogRecord(Level level, std::chrono::system_clock::time_point time,
+                         std::string_view record);
+
   virtual void Flush();
 
   virtual void PrependCommonTags(TagWriter writer) const;
@@ -39,6 +46,11 @@ class LoggerBase {
   void SetFlushOn(Level level);
   bool ShouldFlush(Level level) const;
 
+  /// With the deferred formatting LogHelper only copies the tags into a
+  /// compact record and the logger formats it later, see LogRecord().
+  void SetDeferredFormatting(bool enable) noexcept;
+  bool IsDeferredFormatting() const noexcept;
+
  protected:
   virtual bool DoShouldLog(Level level) const noexcept;
 
@@ -46,6 +58,7 @@ class LoggerBase {
   const Format format_;
   std::atomic<Level> level_{Level::kNone};
   std::atomic<Level> flush_level_{Level::kWarning};
+  std::atomic<bool> is_deferred_formatting_{false};
 };
 
 bool ShouldLogNoSpan(const LoggerBase& logger, Level level) noexcept;
@@ -48,8 +48,8 @@ class TagWriter {
   // The tags must not be duplicated in other Put* calls.
   void PutLogExtra(const LogExtra& extra);
 
-  // Copies the tags to the internal LogExtra. They will be deduplicated
-  // automatically.
+  // Adds the tags without copying them, `extra` must outlive the LogHelper.
+  // They will be deduplicated with the other LogExtra tags automatically.
   void ExtendLogExtra(const LogExtra& extra);
 
  private:
@@ -60,6 +60,9 @@ class TagWriter {
   void PutKey(TagKey key);
   void PutKey(RuntimeTagKey key);
 
+  // Puts the tags as if `extra` was extended with `overrides`
+  void PutLogExtra(const LogExtra& extra, const LogExtra& overrides);
+
   void MarkValueEnd() noexcept;
 
   LogHelper& lh_;
@@ -3,13 +3,17 @@
 /// @file userver/logging/log.hpp
 /// @brief Logging helpers
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <string_view>
 
 #include <userver/compiler/select.hpp>
 #include <userver/logging/fwd.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log_filepath.hpp>
 #include <userver/logging/log_helper.hpp>
+#include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -107,16 +111,45 @@ class RateLimitData {
   std::chrono::steady_clock::time_point last_reset_time{};
 };
 
+// Thread-safe, static lifetime data of a single LOG_LIMITED location
+class RateLimitLocation {
+ public:
+  RateLimitLocation(std::string_view path, int line) noexcept
+      : path(path), line(line) {}
+
+  RateLimitLocation(RateLimitLocation&&) = delete;
+  RateLimitLocation& operator=(RateLimitLocation&&) = delete;
+
+  const std::string_view path;
+  const int line;
+
+  utils::TokenBucket bucket;
+  std::atomic<uint64_t> bucket_version{0};
+
+  // Dropped since the last written message or summary
+  std::atomic<uint64_t> pending_dropped_count{0};
+  std::atomic<uint64_t> total_dropped_count{0};
+
+  std::atomic<bool> is_registered{false};
+  RateLimitLocation* next_registered{nullptr};
+};
+
 // Represents a single rate limit usage
 class RateLimiter {
  public:
-  RateLimiter(RateLimitData& data, Level level) noexcept;
+  RateLimiter(RateLimitData& data, RateLimitLocation& location,
+              LoggerRef logger, Level level) noexcept;
+  RateLimiter(RateLimitData& data, RateLimitLocation& location,
+              const LoggerPtr& logger, Level level) noexcept;
   bool ShouldLog() const { return should_log_; }
   void SetShouldNotLog() { should_log_ = false; }
   Level GetLevel() const { return level_; }
   friend LogHelper& operator<<(LogHelper& lh, const RateLimiter& rl) noexcept;
 
  private:
+  RateLimiter(RateLimitData& data, RateLimitLocation& location,
+              const LoggerBase* logger, Level level) noexcept;
+
   const Level level_;
   bool should_log_{true};
   uint64_t dropped_count_{0};
@@ -130,12 +163,21 @@ class StaticLogEntry final {
   StaticLogEntry(StaticLogEntry&&) = delete;
   StaticLogEntry& operator=(StaticLogEntry&&) = delete;
 
+  // Cheap check for the disabled locations, does not evaluate the logger
+  bool IsDisabled(Level level) const noexcept {
+    return level < min_level_.load(std::memory_order_relaxed);
+  }
+
   bool ShouldNotLog(LoggerRef logger, Level level) const noexcept;
   bool ShouldNotLog(const LoggerPtr& logger, Level level) const noexcept;
 
  private:
+  // No logger writes the messages below this level from this location. Updated
+  // on the logger level changes and by the dynamic debug.
+  std::atomic<Level> min_level_{Level::kTrace};
+
   static constexpr std::size_t kContentSize =
-      compiler::SelectSize().For64Bit(40).For32Bit(24);
+      compiler::SelectSize().For64Bit(48).For32Bit(28);
 
   alignas(void*) std::byte content_[kContentSize];
 };
@@ -241,12 +283,13 @@ struct EntryStorage final {
 /// @hideinitializer
 // static_cast<int> below are workarounds for -Wtautological-compare
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define LOG_TO(logger, lvl)                                             \
-  __builtin_expect(                                                     \
-      USERVER_IMPL_DYNAMIC_DEBUG_ENTRY().ShouldNotLog((logger), (lvl)), \
-      static_cast<int>(lvl) <                                           \
-          static_cast<int>(USERVER_NAMESPACE::logging::Level::kInfo))   \
-      ? USERVER_NAMESPACE::logging::impl::Noop{}                        \
+#define LOG_TO(logger, lvl)                                               \
+  __builtin_expect(                                                       \
+      USERVER_IMPL_DYNAMIC_DEBUG_ENTRY().IsDisabled((lvl)) ||             \
+          USERVER_IMPL_DYNAMIC_DEBUG_ENTRY().ShouldNotLog((logger), (lvl)), \
+      static_cast<int>(lvl) <                                             \
+          static_cast<int>(USERVER_NAMESPACE::logging::Level::kInfo))     \
+      ? USERVER_NAMESPACE::logging::impl::Noop{}                          \
       : USERVER_IMPL_LOG_TO((logger), (lvl))
 
 /// @brief If lvl matches the verbosity then builds a stream and evaluates a
@@ -350,7 +393,12 @@ struct EntryStorage final {
                  rl_data;                                                  \
              return rl_data;                                               \
            }(),                                                            \
-           (lvl)};                                                         \
+           []() -> USERVER_NAMESPACE::logging::impl::RateLimitLocation& {  \
+             static USERVER_NAMESPACE::logging::impl::RateLimitLocation    \
+                 rl_location{USERVER_FILEPATH, __LINE__};                  \
+             return rl_location;                                           \
+           }(),                                                            \
+           (logger), (lvl)};                                               \
        log_limited_to_rl.ShouldLog(); log_limited_to_rl.SetShouldNotLog()) \
   LOG_TO((logger), log_limited_to_rl.GetLevel()) << log_limited_to_rl
 
@@ -0,0 +1,99 @@
+#pragma once
+
+/// @file userver/utils/arena.hpp
+/// @brief @copybrief utils::Arena
+
+#include <cstddef>
+#include <new>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Monotonic memory arena: the allocations are carved out of big
+/// blocks and are freed all at once with the arena.
+///
+/// Suits a lot of small objects with the same lifetime, e.g. the objects of
+/// a request. Use utils::ArenaAllocator to put the standard containers into
+/// the arena.
+///
+/// Not thread safe.
+///
+/// @snippet src/utils/arena_test.cpp  Sample Arena
+class Arena final {
+ public:
+  static constexpr std::size_t kDefaultBlockSize = 4096;
+
+  /// The first block is allocated with the first allocation
+  explicit Arena(std::size_t block_size = kDefaultBlockSize) noexcept;
+  ~Arena();
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  /// @throws std::bad_alloc if the memory can not be allocated
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /// Returns the total size of the blocks of the arena
+  std::size_t GetCapacity() const noexcept { return capacity_; }
+
+ private:
+  struct Block;
+
+  void* AllocateInNewBlock(std::size_t size, std::size_t alignment);
+
+  Block* blocks_{nullptr};
+  char* current_{nullptr};
+  char* end_{nullptr};
+  std::size_t next_block_size_;
+  std::size_t capacity_{0};
+};
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Allocator for the standard containers that allocates from an
+/// utils::Arena. The deallocations are no-op, the arena must outlive the
+/// container.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit ArenaAllocator(Arena& arena) noexcept : arena_(&arena) {}
+
+  template <typename U>
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+      : arena_(other.arena_) {}
+
+  T* allocate(std::size_t n) {
+    if (n > static_cast<std::size_t>(-1) / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, std::size_t) noexcept {}
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const noexcept {
+    return arena_ == other.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+    return arena_ != other.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class ArenaAllocator;
+
+  Arena* arena_;
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
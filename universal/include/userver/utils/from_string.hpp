@@ -29,21 +29,7 @@ namespace impl {
                                            std::type_index resultType);
 
 template <typename T>
-std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
-  static_assert(!std::is_const_v<T> && !std::is_volatile_v<T>);
-  static_assert(!std::is_reference_v<T>);
-
-  if (str == nullptr) {
-    impl::ThrowFromStringException("nullptr string", "<null>", typeid(T));
-  }
-  if (str[0] == '\0') {
-    impl::ThrowFromStringException("empty string", str, typeid(T));
-  }
-  if (std::isspace(str[0])) {
-    impl::ThrowFromStringException("leading spaces are not allowed", str,
-                                   typeid(T));
-  }
-
+T FromStringStrtod(const char* str) {
   errno = 0;
   char* end = nullptr;
 
@@ -79,25 +65,95 @@ std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
 }
 
 template <typename T>
-std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
-    const std::string& str) {
-  return FromString<T>(str.data());
-}
-
-template <typename T>
-std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
-    std::string_view str) {
+T FromStringStrtod(std::string_view str) {
   static constexpr std::size_t kSmallBufferSize = 32;
 
   if (str.size() >= kSmallBufferSize) {
-    return FromString<T>(std::string{str});
+    return FromStringStrtod<T>(std::string{str}.c_str());
   }
 
   char buffer[kSmallBufferSize];
   std::copy(str.data(), str.data() + str.size(), buffer);
   buffer[str.size()] = '\0';
 
-  return FromString<T>(buffer);
+  return FromStringStrtod<T>(buffer);
+}
+
+// std::from_chars does not parse hexadecimal floats without
+// std::chars_format::hex and does not accept the "0x" prefix at all
+inline bool IsHexFloat(std::string_view str) noexcept {
+  if (!str.empty() && (str[0] == '-' || str[0] == '+')) str.remove_prefix(1);
+  return str.size() > 1 && str[0] == '0' && (str[1] == 'x' || str[1] == 'X');
+}
+
+template <typename T>
+std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
+    std::string_view str) {
+  static_assert(!std::is_const_v<T> && !std::is_volatile_v<T>);
+  static_assert(!std::is_reference_v<T>);
+
+  if (str.empty()) {
+    impl::ThrowFromStringException("empty string", str, typeid(T));
+  }
+  if (std::isspace(str[0])) {
+    impl::ThrowFromStringException("leading spaces are not allowed", str,
+                                   typeid(T));
+  }
+
+#ifdef __cpp_lib_to_chars
+  // std::from_chars is locale independent and much faster than std::strtod
+  if constexpr (!std::is_same_v<T, long double>) {
+    if (!IsHexFloat(str)) {
+      std::size_t offset = 0;
+
+      // to allow leading plus
+      if (str.size() > 1 && str[0] == '+' && str[1] == '-') {
+        impl::ThrowFromStringException("no number found", str, typeid(T));
+      }
+      if (str[0] == '+') offset = 1;
+
+      T result{};
+      const auto [end, error_code] =
+          std::from_chars(str.data() + offset, str.data() + str.size(), result);
+
+      if (error_code == std::errc::result_out_of_range) {
+        impl::ThrowFromStringException("overflow", str, typeid(T));
+      }
+      if (error_code == std::errc::invalid_argument) {
+        impl::ThrowFromStringException("no number found", str, typeid(T));
+      }
+
+      if (end != str.data() + str.size()) {
+        if (std::isspace(*end)) {
+          impl::ThrowFromStringException("trailing spaces are not allowed",
+                                         str, typeid(T));
+        } else {
+          impl::ThrowFromStringException(
+              "extra junk at the end of the string is not allowed", str,
+              typeid(T));
+        }
+      }
+
+      return result;
+    }
+  }
+#endif
+
+  return FromStringStrtod<T>(str);
+}
+
+template <typename T>
+std::enable_if_t<std::is_floating_point_v<T>, T> FromString(const char* str) {
+  if (str == nullptr) {
+    impl::ThrowFromStringException("nullptr string", "<null>", typeid(T));
+  }
+  return FromString<T>(std::string_view{str});
+}
+
+template <typename T>
+std::enable_if_t<std::is_floating_point_v<T>, T> FromString(
+    const std::string& str) {
+  return FromString<T>(std::string_view{str});
 }
 
 template <typename T>
@@ -160,7 +216,8 @@ std::enable_if_t<meta::kIsInteger<T>, T> FromString(std::string_view str) {
 /// - Integer types. Leading plus or minus is allowed. The number is always
 ///   base-10.
 /// - Floating-point types. The accepted number format is identical to
-///   `std::strtod`.
+///   `std::strtod` in the "C" locale, the locale of the process is ignored
+///   when `std::from_chars` supports floating-point types.
 ///
 /// @tparam T The type of the number to be parsed
 /// @param str The string that contains the number
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
@@ -28,16 +29,19 @@ struct TransparentHash : public std::hash<std::string_view> {
 
 #if __cpp_lib_generic_unordered_lookup >= 201811L
 template <typename Key, typename Value, typename Hash = TransparentHash<Key>,
-          typename Equal = std::equal_to<>>
-using TransparentMap = std::unordered_map<Key, Value, Hash, Equal>;
+          typename Equal = std::equal_to<>,
+          typename Allocator = std::allocator<std::pair<const Key, Value>>>
+using TransparentMap = std::unordered_map<Key, Value, Hash, Equal, Allocator>;
 
 template <typename Key, typename Hash = TransparentHash<Key>,
           typename Equal = std::equal_to<>>
 using TransparentSet = std::unordered_set<Key, Hash, Equal>;
 #else
 template <typename Key, typename Value, typename Hash = TransparentHash<Key>,
-          typename Equal = std::equal_to<>>
-using TransparentMap = boost::unordered_map<Key, Value, Hash, Equal>;
+          typename Equal = std::equal_to<>,
+          typename Allocator = std::allocator<std::pair<const Key, Value>>>
+using TransparentMap =
+    boost::unordered_map<Key, Value, Hash, Equal, Allocator>;
 
 template <typename Key, typename Hash = TransparentHash<Key>,
           typename Equal = std::equal_to<>>
@@ -0,0 +1,480 @@
+#pragma once
+
+/// @file userver/utils/perfect_hash_map.hpp
+/// @brief @copybrief utils::PerfectHashBiMap
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/trivial_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace impl::perfect_hash {
+
+constexpr std::uint64_t Mix(std::uint64_t value) noexcept {
+  // splitmix64 finalizer
+  value ^= value >> 30;
+  value *= 0xbf58476d1ce4e5b9;
+  value ^= value >> 27;
+  value *= 0x94d049bb133111eb;
+  value ^= value >> 31;
+  return value;
+}
+
+constexpr std::uint64_t Byte(const char* data, std::size_t index) noexcept {
+  return static_cast<unsigned char>(data[index]);
+}
+
+// Compilers merge the shifts into a single unaligned load
+constexpr std::uint64_t Read4(const char* data) noexcept {
+  return Byte(data, 0) | (Byte(data, 1) << 8) | (Byte(data, 2) << 16) |
+         (Byte(data, 3) << 24);
+}
+
+constexpr std::uint64_t Read8(const char* data) noexcept {
+  return Read4(data) | (Read4(data + 4) << 32);
+}
+
+inline constexpr std::uint64_t kLowBits = 0x7f7f7f7f7f7f7f7f;
+inline constexpr std::uint64_t kHighBits = 0x8080808080808080;
+
+constexpr std::uint64_t Repeat(std::uint8_t byte) noexcept {
+  return byte * 0x0101010101010101;
+}
+
+// Turns the ASCII uppercase letters of each byte of `word` into lowercase ones
+// and keeps the other bytes. Strings that differ only in case get equal hashes,
+// which allows case insensitive search. Other bytes are not folded, so that
+// e.g. '[' and '{' keep different hashes.
+constexpr std::uint64_t FoldCase(std::uint64_t word) noexcept {
+  // The high bit of a byte of low_bits + x is set if the low 7 bits of the
+  // byte are >= 0x80 - x, no carries cross the bytes
+  const std::uint64_t low_bits = word & kLowBits;
+  const std::uint64_t at_least_a = low_bits + Repeat(0x80 - 'A');
+  const std::uint64_t above_z = low_bits + Repeat(0x80 - 'Z' - 1);
+  const std::uint64_t is_upper = at_least_a & ~above_z & ~word & kHighBits;
+  return word | (is_upper >> 2);
+}
+
+constexpr std::uint64_t HashStep(std::uint64_t hash,
+                                 std::uint64_t word) noexcept {
+  hash = (hash ^ word) * 0xbf58476d1ce4e5b9;
+  return hash ^ (hash >> 29);
+}
+
+// Strings are read by 8-byte words, the last word overlaps the previous one.
+// Strings shorter than 8 bytes are read as a single word of their first and
+// last bytes.
+constexpr std::uint64_t Hash(std::string_view value,
+                             std::uint64_t seed) noexcept {
+  const char* const data = value.data();
+  const std::size_t size = value.size();
+  std::uint64_t hash = seed ^ (size * 0x9e3779b97f4a7c15);
+  if (size >= 8) {
+    for (std::size_t i = 0; i + 8 < size; i += 8) {
+      hash = HashStep(hash, FoldCase(Read8(data + i)));
+    }
+    hash = HashStep(hash, FoldCase(Read8(data + size - 8)));
+  } else if (size >= 4) {
+    hash = HashStep(hash,
+                    FoldCase(Read4(data) | (Read4(data + size - 4) << 32)));
+  } else if (size > 0) {
+    hash = HashStep(hash, FoldCase(Byte(data, 0) | (Byte(data, size / 2) << 8) |
+                                   (Byte(data, size - 1) << 16)));
+  }
+  return Mix(hash);
+}
+
+// Same as `==`, but reads the strings the same way as Hash does, without a
+// std::memcmp call
+constexpr bool Equal(std::string_view lhs, std::string_view rhs) noexcept {
+  const std::size_t size = lhs.size();
+  if (size != rhs.size()) return false;
+
+  const char* const x = lhs.data();
+  const char* const y = rhs.data();
+  if (size >= 8) {
+    for (std::size_t i = 0; i + 8 < size; i += 8) {
+      if (Read8(x + i) != Read8(y + i)) return false;
+    }
+    return Read8(x + size - 8) == Read8(y + size - 8);
+  } else if (size >= 4) {
+    return Read4(x) == Read4(y) && Read4(x + size - 4) == Read4(y + size - 4);
+  } else if (size > 0) {
+    return x[0] == y[0] && x[size / 2] == y[size / 2] &&
+           x[size - 1] == y[size - 1];
+  }
+  return true;
+}
+
+template <typename T>
+constexpr bool Equal(T lhs, T rhs) noexcept {
+  return lhs == rhs;
+}
+
+template <typename T>
+constexpr std::uint64_t Hash(T value, std::uint64_t seed) noexcept {
+  static_assert(std::is_integral_v<T> || std::is_enum_v<T>,
+                "utils::PerfectHashBiMap supports only strings, integers and "
+                "enums");
+  if constexpr (std::is_enum_v<T>) {
+    return Hash(static_cast<std::underlying_type_t<T>>(value), seed);
+  } else {
+    return Mix(static_cast<std::uint64_t>(value) ^ seed);
+  }
+}
+
+constexpr std::size_t BitCeil(std::size_t value) noexcept {
+  std::size_t result = 1;
+  while (result < value) result *= 2;
+  return result;
+}
+
+constexpr int Log2(std::size_t power_of_two) noexcept {
+  int result = 0;
+  while ((std::size_t{1} << result) < power_of_two) ++result;
+  return result;
+}
+
+// About 2 keys per bucket and a load factor of 0.5 keep the pilot search short
+// enough for the compile time evaluation
+constexpr std::size_t BucketsCount(std::size_t size) noexcept {
+  return BitCeil(size / 2 + 1);
+}
+
+constexpr std::size_t SlotsCount(std::size_t size) noexcept {
+  return BitCeil(size * 2);
+}
+
+inline constexpr std::uint64_t kMaxPilot = 1 << 16;
+inline constexpr std::uint64_t kMaxSeed = 16;
+
+// Perfect hash table in the PTHash style: the bucket of a key is chosen by its
+// hash, and each bucket gets a "pilot" that moves all of its keys to free
+// slots. A lookup takes a single hash computation and a single comparison.
+template <typename Key, std::size_t Size>
+class Table final {
+ public:
+  static constexpr std::size_t kBuckets = BucketsCount(Size);
+  static constexpr std::size_t kSlots = SlotsCount(Size);
+  using Index = std::conditional_t<(Size < 0xffff), std::uint16_t,
+                                   std::uint32_t>;
+  static constexpr Index kEmpty = std::numeric_limits<Index>::max();
+
+  constexpr explicit Table(const std::array<Key, Size>& keys) {
+    for (seed_ = 0; seed_ < kMaxSeed; ++seed_) {
+      if (TryBuild(keys)) return;
+    }
+    UINVARIANT(false,
+               "Failed to build utils::PerfectHashBiMap, probably some keys "
+               "differ only in case");
+  }
+
+  /// Returns the index of the only key that may be equal to `key`, or kEmpty
+  template <typename T>
+  constexpr Index FindCandidate(T key) const noexcept {
+    const auto hash = Hash(key, seed_);
+    return slots_[Slot(hash, pilots_[Bucket(hash)])];
+  }
+
+ private:
+  static constexpr std::size_t Bucket(std::uint64_t hash) noexcept {
+    return hash & (kBuckets - 1);
+  }
+
+  // Multiply-shift takes the high bits, which do not depend on the low bits
+  // used for the bucket
+  static constexpr std::size_t Slot(std::uint64_t hash,
+                                    std::uint64_t pilot_hash) noexcept {
+    constexpr int kShift = 64 - Log2(kSlots);
+    if constexpr (kShift == 64) {
+      return 0;
+    } else {
+      return ((hash ^ pilot_hash) * 0x9e3779b97f4a7c15) >> kShift;
+    }
+  }
+
+  constexpr bool TryBuild(const std::array<Key, Size>& keys) {
+    std::array<std::uint64_t, Size> hashes{};
+    std::array<std::size_t, kBuckets + 1> bucket_begin{};
+    for (std::size_t i = 0; i < Size; ++i) {
+      hashes[i] = Hash(keys[i], seed_);
+      ++bucket_begin[Bucket(hashes[i]) + 1];
+    }
+    for (std::size_t b = 0; b < kBuckets; ++b) {
+      bucket_begin[b + 1] += bucket_begin[b];
+    }
+
+    // Stable counting sort by bucket. Only the first of the equal keys is
+    // kept, as utils::TrivialBiMap finds the first matching Case.
+    std::array<Index, Size> keys_by_bucket{};
+    std::array<std::size_t, kBuckets> bucket_end{};
+    for (std::size_t b = 0; b < kBuckets; ++b) bucket_end[b] = bucket_begin[b];
+    for (std::size_t i = 0; i < Size; ++i) {
+      const auto bucket = Bucket(hashes[i]);
+      bool is_duplicate = false;
+      for (auto j = bucket_begin[bucket]; j < bucket_end[bucket]; ++j) {
+        const auto other = keys_by_bucket[j];
+        if (hashes[other] != hashes[i]) continue;
+        // Different keys with equal hashes would always collide
+        if (!(keys[other] == keys[i])) return false;
+        is_duplicate = true;
+      }
+      if (!is_duplicate) {
+        keys_by_bucket[bucket_end[bucket]++] = static_cast<Index>(i);
+      }
+    }
+
+    std::size_t max_bucket_size = 0;
+    for (std::size_t b = 0; b < kBuckets; ++b) {
+      max_bucket_size =
+          std::max(max_bucket_size, bucket_end[b] - bucket_begin[b]);
+    }
+
+    for (auto& slot : slots_) slot = kEmpty;
+    for (auto& pilot : pilots_) pilot = 0;
+
+    // The largest buckets are placed first, while there are many free slots
+    for (auto bucket_size = max_bucket_size; bucket_size > 0; --bucket_size) {
+      for (std::size_t b = 0; b < kBuckets; ++b) {
+        if (bucket_end[b] - bucket_begin[b] != bucket_size) continue;
+        if (!TryPlaceBucket(hashes, keys_by_bucket, bucket_begin[b],
+                            bucket_end[b], b)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  constexpr bool TryPlaceBucket(const std::array<std::uint64_t, Size>& hashes,
+                                const std::array<Index, Size>& keys_by_bucket,
+                                std::size_t begin, std::size_t end,
+                                std::size_t bucket) {
+    for (std::uint64_t pilot = 0; pilot < kMaxPilot; ++pilot) {
+      const auto pilot_hash = Mix(pilot);
+      std::size_t placed = begin;
+      for (; placed < end; ++placed) {
+        const auto key_index = keys_by_bucket[placed];
+        auto& slot = slots_[Slot(hashes[key_index], pilot_hash)];
+        if (slot != kEmpty) break;
+        slot = key_index;
+      }
+      if (placed == end) {
+        pilots_[bucket] = pilot_hash;
+        return true;
+      }
+
+      for (auto i = begin; i < placed; ++i) {
+        slots_[Slot(hashes[keys_by_bucket[i]], pilot_hash)] = kEmpty;
+      }
+    }
+    return false;
+  }
+
+  std::uint64_t seed_{0};
+  // Hashes of the pilots, to skip the hashing on lookup
+  std::array<std::uint64_t, kBuckets> pilots_{};
+  std::array<Index, kSlots> slots_{};
+};
+
+template <typename First, typename Second, std::size_t Size>
+struct Cases final {
+  std::array<First, Size> firsts{};
+  std::array<Second, Size> seconds{};
+};
+
+template <typename First, typename Second, std::size_t Size>
+struct Data final {
+  template <typename Map>
+  constexpr explicit Data(const Map& map) : Data(Collect(map)) {}
+
+  constexpr explicit Data(const Cases<First, Second, Size>& cases)
+      : firsts(cases.firsts),
+        seconds(cases.seconds),
+        by_first(firsts),
+        by_second(seconds) {}
+
+  template <typename Map>
+  static constexpr Cases<First, Second, Size> Collect(const Map& map) {
+    Cases<First, Second, Size> result;
+    for (std::size_t i = 0; i < Size; ++i) {
+      const auto values = map.GetValuesByIndex(i);
+      result.firsts[i] = values.first;
+      result.seconds[i] = values.second;
+    }
+    return result;
+  }
+
+  std::array<First, Size> firsts;
+  std::array<Second, Size> seconds;
+  Table<First, Size> by_first;
+  Table<Second, Size> by_second;
+};
+
+template <const auto& Map>
+using DataFor = Data<typename std::decay_t<decltype(Map)>::First,
+                     typename std::decay_t<decltype(Map)>::Second, Map.size()>;
+
+template <const auto& Map>
+inline constexpr DataFor<Map> kData{Map};
+
+template <typename Key, typename Value, typename Table, std::size_t Size>
+constexpr std::optional<Value> Find(const Table& table,
+                                    const std::array<Key, Size>& keys,
+                                    const std::array<Value, Size>& values,
+                                    Key key) noexcept {
+  const auto index = table.FindCandidate(key);
+  if (index == Table::kEmpty || !Equal(keys[index], key)) return std::nullopt;
+  return values[index];
+}
+
+template <typename Value, typename Table, std::size_t Size>
+constexpr std::optional<Value> FindICase(
+    const Table& table, const std::array<std::string_view, Size>& keys,
+    const std::array<Value, Size>& values, std::string_view key) noexcept {
+  const auto index = table.FindCandidate(key);
+  if (index == Table::kEmpty || keys[index].size() != key.size() ||
+      !ICaseEqualLowercase(keys[index], key)) {
+    return std::nullopt;
+  }
+  return values[index];
+}
+
+}  // namespace impl::perfect_hash
+
+/// @ingroup userver_universal userver_containers
+///
+/// @brief utils::TrivialBiMap with lookups by a perfect hash function, for
+/// maps with hundreds of strings, integers or enums.
+///
+/// utils::TrivialBiMap compares the keys one by one, which gets slow for
+/// large maps with keys of the same length, e.g. HTTP header names or error
+/// codes. PerfectHashBiMap builds a perfect hash table for both directions of
+/// the `Map` at compile time and stores it in static storage. A lookup is a
+/// hash computation and a single comparison.
+///
+/// The search API is the same as for utils::TrivialBiMap. If several Case
+/// calls have equal keys, the first one is found, as with utils::TrivialBiMap.
+///
+/// @snippet universal/src/utils/perfect_hash_map_test.cpp  sample
+///
+/// Maps with keys that differ only in case are not supported, such maps fail
+/// to compile.
+template <const auto& Map>
+class PerfectHashBiMap final {
+  using MapType = std::decay_t<decltype(Map)>;
+
+ public:
+  using First = typename MapType::First;
+  using Second = typename MapType::Second;
+  using value_type = typename MapType::value_type;
+
+  template <class T>
+  using MappedTypeFor = typename MapType::template MappedTypeFor<T>;
+
+  constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
+    return impl::perfect_hash::Find(Data().by_first, Data().firsts,
+                                    Data().seconds, value);
+  }
+
+  constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
+    return impl::perfect_hash::Find(Data().by_second, Data().seconds,
+                                    Data().firsts, value);
+  }
+
+  template <class T>
+  constexpr std::optional<MappedTypeFor<T>> TryFind(T value) const noexcept {
+    static_assert(
+        !std::is_convertible_v<T, First> || !std::is_convertible_v<T, Second>,
+        "Ambiguous conversion, use TryFindByFirst/TryFindBySecond instead");
+
+    if constexpr (std::is_convertible_v<T, First>) {
+      return TryFindByFirst(value);
+    } else {
+      return TryFindBySecond(value);
+    }
+  }
+
+  /// @brief Case insensitive search for value.
+  ///
+  /// First parameters in Case() should be lower case string literals.
+  constexpr std::optional<Second> TryFindICaseByFirst(
+      std::string_view value) const noexcept {
+    return impl::perfect_hash::FindICase(Data().by_first, Data().firsts,
+                                         Data().seconds, value);
+  }
+
+  /// @brief Case insensitive search for value.
+  ///
+  /// Second parameters in Case() should be lower case string literals.
+  constexpr std::optional<First> TryFindICaseBySecond(
+      std::string_view value) const noexcept {
+    return impl::perfect_hash::FindICase(Data().by_second, Data().seconds,
+                                         Data().firsts, value);
+  }
+
+  /// @brief Case insensitive search for value that calls either
+  /// TryFindICaseBySecond or TryFindICaseByFirst.
+  constexpr std::optional<MappedTypeFor<std::string_view>> TryFindICase(
+      std::string_view value) const noexcept {
+    static_assert(!std::is_convertible_v<std::string_view, First> ||
+                      !std::is_convertible_v<std::string_view, Second>,
+                  "Ambiguous conversion, use "
+                  "TryFindICaseByFirst/TryFindICaseBySecond");
+
+    if constexpr (std::is_convertible_v<std::string_view, First>) {
+      return TryFindICaseByFirst(value);
+    } else {
+      return TryFindICaseBySecond(value);
+    }
+  }
+
+  /// Returns count of Case's in mapping
+  constexpr std::size_t size() const noexcept { return Map.size(); }
+
+  /// @copydoc utils::TrivialBiMap::Describe
+  std::string Describe() const { return Map.Describe(); }
+
+  /// @copydoc utils::TrivialBiMap::DescribeFirst
+  std::string DescribeFirst() const { return Map.DescribeFirst(); }
+
+  /// @copydoc utils::TrivialBiMap::DescribeSecond
+  std::string DescribeSecond() const { return Map.DescribeSecond(); }
+
+  /// @copydoc utils::TrivialBiMap::DescribeByType
+  template <typename T>
+  std::string DescribeByType() const {
+    return Map.template DescribeByType<T>();
+  }
+
+  constexpr value_type GetValuesByIndex(std::size_t index) const {
+    UASSERT(index < size());
+    return value_type{Data().firsts[index], Data().seconds[index]};
+  }
+
+  constexpr auto begin() const { return Map.begin(); }
+  constexpr auto end() const { return Map.end(); }
+  constexpr auto cbegin() const { return Map.cbegin(); }
+  constexpr auto cend() const { return Map.cend(); }
+
+ private:
+  static constexpr const auto& Data() noexcept {
+    return impl::perfect_hash::kData<Map>;
+  }
+};
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -3,7 +3,11 @@
 /// @file userver/utils/regex.hpp
 /// @brief @copybrief utils::regex
 
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <userver/utils/fast_pimpl.hpp>
 
@@ -11,14 +15,36 @@ USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+/// @brief Regular expression engine of utils::regex and utils::RegexSet
+enum class RegexEngine {
+  /// Backtracking boost::regex, supports backreferences and lookarounds but
+  /// may take exponential time on some patterns
+  kBoost,
+
+  /// Linear-time RE2 without backreferences and lookarounds, use it for
+  /// untrusted patterns and inputs. Available if userver is built with
+  /// USERVER_FEATURE_RE2.
+  kRe2,
+};
+
+/// @brief Returns true if the engine was compiled in
+bool IsRegexEngineAvailable(RegexEngine engine) noexcept;
+
 /// @ingroup userver_universal userver_containers
 ///
 /// @brief Small alias for boost::regex / std::regex without huge includes
+///
+/// Pass RegexEngine::kRe2 to match in time linear in the size of the input,
+/// which protects from ReDoS on user-supplied patterns.
 class regex final {
  public:
   regex();
   explicit regex(std::string_view pattern);
 
+  /// @throws std::runtime_error if the pattern is invalid or the engine is
+  /// not available
+  regex(std::string_view pattern, RegexEngine engine);
+
   ~regex();
 
   regex(const regex&);
@@ -27,9 +53,11 @@ class regex final {
   regex& operator=(const regex&);
   regex& operator=(regex&&) noexcept;
 
+  RegexEngine GetEngine() const noexcept;
+
  private:
   struct Impl;
-  utils::FastPimpl<Impl, 16, 8> impl_;
+  utils::FastPimpl<Impl, 40, 8> impl_;
 
   friend bool regex_match(std::string_view str, const regex& pattern);
   friend bool regex_search(std::string_view str, const regex& pattern);
@@ -43,6 +71,52 @@ bool regex_match(std::string_view str, const regex& pattern);
 /// target character sequence
 bool regex_search(std::string_view str, const regex& pattern);
 
+/// @ingroup userver_universal userver_containers
+///
+/// @brief Matches a string against a list of patterns at once, e.g. the
+/// header or URL rule lists.
+///
+/// With RegexEngine::kRe2 all the patterns are compiled into a single
+/// automaton and the input is scanned once regardless of the number of
+/// patterns. With RegexEngine::kBoost the patterns are tried one by one.
+///
+/// The set is immutable, copies are cheap and share the compiled patterns.
+class RegexSet final {
+ public:
+  enum class Mode {
+    /// A pattern matches if it matches the entire string, like regex_match
+    kMatch,
+    /// A pattern matches if it matches anywhere in the string, like
+    /// regex_search
+    kSearch,
+  };
+
+  /// @throws std::runtime_error if any of the patterns is invalid or the
+  /// engine is not available
+  RegexSet(const std::vector<std::string>& patterns, Mode mode,
+           RegexEngine engine = RegexEngine::kBoost);
+
+  ~RegexSet();
+
+  RegexSet(const RegexSet&);
+  RegexSet(RegexSet&&) noexcept;
+  RegexSet& operator=(const RegexSet&);
+  RegexSet& operator=(RegexSet&&) noexcept;
+
+  /// @returns sorted indexes of the patterns that match `str`
+  std::vector<std::size_t> Match(std::string_view str) const;
+
+  /// @returns true if any of the patterns matches `str`
+  bool MatchAny(std::string_view str) const;
+
+  /// @returns number of patterns in the set
+  std::size_t Size() const noexcept;
+
+ private:
+  struct Impl;
+  std::shared_ptr<const Impl> impl_;
+};
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <fmt/core.h>
 
@@ -17,6 +18,11 @@ Value Serialize(const SmallString<N>& value, formats::serialize::To<Value>) {
   return typename Value::Builder{std::string_view{value}}.ExtractValue();
 }
 
+template <std::size_t N, typename StringBuilder>
+void WriteToStream(const SmallString<N>& value, StringBuilder& sw) {
+  WriteToStream(std::string_view{value}, sw);
+}
+
 template <typename Value, std::size_t N>
 SmallString<N> Parse(const Value& value, formats::parse::To<SmallString<N>>) {
   return SmallString<N>{value.template As<std::string>()};
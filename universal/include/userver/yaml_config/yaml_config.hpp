@@ -5,9 +5,11 @@
 
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include <userver/formats/json_fwd.hpp>
 #include <userver/formats/parse/common.hpp>
@@ -185,8 +187,17 @@ class YamlConfig {
   const_iterator end() const;
 
  private:
+  using ConfigVarsIndex = std::unordered_map<std::string, formats::yaml::Value>;
+
+  // Child config that shares the config_vars of *this
+  YamlConfig MakeChild(formats::yaml::Value yaml, Mode mode) const;
+
+  formats::yaml::Value GetConfigVar(const std::string& name) const;
+
   formats::yaml::Value yaml_;
   formats::yaml::Value config_vars_;
+  // Memoized `$var` lookups, shared by all the children of a config
+  std::shared_ptr<const ConfigVarsIndex> config_vars_index_;
   Mode mode_{Mode::kSecure};
 
   friend bool Parse(const YamlConfig& value, formats::parse::To<bool>);
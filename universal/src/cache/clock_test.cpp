@@ -0,0 +1,122 @@
+#include <userver/cache/impl/clock.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Clock = cache::impl::ClockBase<int, int>;
+
+}  // namespace
+
+TEST(ClockBase, PutGet) {
+  Clock cache(10);
+  EXPECT_TRUE(cache.Put(1, 10));
+  EXPECT_FALSE(cache.Put(1, 11));
+  EXPECT_TRUE(cache.Put(2, 20));
+
+  ASSERT_NE(cache.Get(1), nullptr);
+  EXPECT_EQ(*cache.Get(1), 11);
+  EXPECT_EQ(*cache.GetShared(2), 20);
+  EXPECT_EQ(cache.Get(3), nullptr);
+  EXPECT_EQ(cache.GetShared(3), nullptr);
+  EXPECT_EQ(cache.GetSize(), 2);
+
+  cache.Erase(1);
+  EXPECT_EQ(cache.Get(1), nullptr);
+  EXPECT_EQ(*cache.Get(2), 20);
+  EXPECT_EQ(cache.GetSize(), 1);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetSize(), 0);
+  EXPECT_EQ(cache.GetLeastUsedValue(), nullptr);
+}
+
+TEST(ClockBase, Emplace) {
+  cache::impl::ClockBase<int, std::string> cache(2);
+  EXPECT_EQ(*cache.Emplace(1, 3, 'a'), "aaa");
+  EXPECT_EQ(*cache.Emplace(1, 2, 'b'), "aaa");
+  EXPECT_EQ(*cache.Emplace(2, 1, 'b'), "b");
+  EXPECT_EQ(*cache.Emplace(3, 1, 'c'), "c");
+  EXPECT_EQ(cache.GetSize(), 2);
+}
+
+TEST(ClockBase, SecondChance) {
+  Clock cache(3);
+  cache.Put(1, 1);
+  cache.Put(2, 2);
+  cache.Put(3, 3);
+
+  // the referenced item survives the pass of the hand
+  EXPECT_NE(cache.GetShared(1), nullptr);
+  EXPECT_EQ(*cache.GetLeastUsedKey(), 2);
+  cache.Put(4, 4);
+
+  EXPECT_NE(cache.Get(1), nullptr);
+  EXPECT_EQ(cache.Get(2), nullptr);
+  EXPECT_NE(cache.Get(3), nullptr);
+  EXPECT_NE(cache.Get(4), nullptr);
+}
+
+TEST(ClockBase, AllReferenced) {
+  Clock cache(3);
+  for (int i = 0; i < 3; ++i) cache.Put(i, i);
+  for (int i = 0; i < 3; ++i) cache.Get(i);
+
+  // the hand clears all the bits and evicts the oldest item
+  cache.Put(3, 3);
+  EXPECT_EQ(cache.Get(0), nullptr);
+  EXPECT_EQ(cache.GetSize(), 3);
+}
+
+TEST(ClockBase, SetMaxSize) {
+  Clock cache(100);
+  for (int i = 0; i < 100; ++i) cache.Put(i, i);
+  for (int i = 0; i < 10; ++i) cache.Get(i);
+
+  cache.SetMaxSize(10);
+  EXPECT_EQ(cache.GetSize(), 10);
+  EXPECT_EQ(cache.GetCapacity(), 10);
+  // the unreferenced items are evicted first
+  for (int i = 0; i < 10; ++i) EXPECT_NE(cache.Get(i), nullptr);
+
+  cache.SetMaxSize(20);
+  for (int i = 100; i < 200; ++i) cache.Put(i, i);
+  EXPECT_EQ(cache.GetSize(), 20);
+}
+
+TEST(ClockBase, VisitAllAndMove) {
+  Clock cache(10);
+  for (int i = 0; i < 5; ++i) cache.Put(i, i);
+
+  Clock other = std::move(cache);
+  std::vector<int> keys;
+  other.VisitAll([&keys](int key, int value) {
+    EXPECT_EQ(key, value);
+    keys.push_back(key);
+  });
+  EXPECT_EQ(keys.size(), 5);
+  EXPECT_EQ(*other.Get(4), 4);
+}
+
+TEST(LruMap, ClockPolicy) {
+  cache::LruMap<int, int, std::hash<int>, std::equal_to<int>,
+                cache::CachePolicy::kClock>
+      map(2);
+  map.Put(1, 1);
+  map.Put(2, 2);
+  EXPECT_EQ(*map.GetShared(1), 1);
+  map.Put(3, 3);
+
+  EXPECT_EQ(map.GetOr(1, 0), 1);
+  EXPECT_EQ(map.GetOr(2, 0), 0);
+  EXPECT_EQ(map.GetOr(3, 0), 3);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include <userver/cache/persistent_map.hpp>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Map = cache::PersistentMap<int, std::string>;
+
+struct CollidingHash {
+  std::size_t operator()(int key) const noexcept { return key % 2; }
+};
+
+using CollidingMap = cache::PersistentMap<int, int, CollidingHash>;
+
+template <typename Map>
+std::map<typename Map::key_type, typename Map::mapped_type> ToStdMap(
+    const Map& map) {
+  std::map<typename Map::key_type, typename Map::mapped_type> result;
+  for (const auto& [key, value] : map) {
+    EXPECT_TRUE(result.emplace(key, value).second) << "duplicate key " << key;
+  }
+  EXPECT_EQ(result.size(), map.size());
+  return result;
+}
+
+}  // namespace
+
+TEST(PersistentMap, Empty) {
+  const Map map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_EQ(map.count(1), 0);
+  EXPECT_THROW(map.at(1), std::out_of_range);
+}
+
+TEST(PersistentMap, InsertFindErase) {
+  Map map;
+  EXPECT_TRUE(map.insert_or_assign(1, "one"));
+  EXPECT_TRUE(map.insert_or_assign(2, "two"));
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  map[3] = "three";
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(1), "uno");
+  EXPECT_EQ(map.find(2)->second, "two");
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_FALSE(map.contains(4));
+
+  EXPECT_EQ(map.erase(4), 0);
+  EXPECT_EQ(map.erase(1), 1);
+  EXPECT_EQ(map.erase(1), 0);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_FALSE(map.contains(1));
+
+  EXPECT_EQ(map.erase(2), 1);
+  EXPECT_EQ(map.erase(3), 1);
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(PersistentMap, CopiesAreIndependent) {
+  Map original;
+  for (int i = 0; i < 1000; ++i) original[i] = std::to_string(i);
+
+  auto copy = original;
+  copy[1] = "changed";
+  copy.insert_or_assign(5, "changed too");
+  copy.insert_or_assign(1000, "new");
+  copy.erase(7);
+
+  EXPECT_EQ(original.size(), 1000);
+  EXPECT_EQ(original.at(1), "1");
+  EXPECT_EQ(original.at(5), "5");
+  EXPECT_EQ(original.at(7), "7");
+  EXPECT_FALSE(original.contains(1000));
+
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(copy.at(1), "changed");
+  EXPECT_EQ(copy.at(5), "changed too");
+  EXPECT_EQ(copy.at(1000), "new");
+  EXPECT_FALSE(copy.contains(7));
+
+  EXPECT_EQ(ToStdMap(original).size(), 1000);
+  EXPECT_EQ(ToStdMap(copy).size(), 1000);
+}
+
+TEST(PersistentMap, HashCollisions) {
+  CollidingMap map;
+  for (int i = 0; i < 100; ++i) map.insert_or_assign(i, i * 10);
+  EXPECT_EQ(map.size(), 100);
+
+  const auto copy = map;
+  for (int i = 0; i < 100; i += 2) EXPECT_EQ(map.erase(i), 1);
+
+  EXPECT_EQ(map.size(), 50);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1) << i;
+    EXPECT_EQ(copy.at(i), i * 10);
+  }
+  EXPECT_EQ(ToStdMap(map).size(), 50);
+  EXPECT_EQ(ToStdMap(copy).size(), 100);
+}
+
+TEST(PersistentMap, MatchesUnorderedMap) {
+  Map map;
+  std::unordered_map<int, std::string> expected;
+  std::vector<std::pair<Map, std::unordered_map<int, std::string>>> snapshots;
+
+  unsigned state = 1;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1103515245 + 12345;
+    const int key = static_cast<int>(state % 3000);
+    if (state % 5 == 0) {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    } else {
+      map.insert_or_assign(key, std::to_string(i));
+      expected.insert_or_assign(key, std::to_string(i));
+    }
+    if (i % 1000 == 0) snapshots.emplace_back(map, expected);
+  }
+
+  const auto result = ToStdMap(map);
+  ASSERT_EQ(result.size(), expected.size());
+  for (const auto& [key, value] : expected) {
+    EXPECT_EQ(result.at(key), value);
+    EXPECT_EQ(map.at(key), value);
+  }
+
+  for (const auto& [snapshot, snapshot_expected] : snapshots) {
+    const auto snapshot_result = ToStdMap(snapshot);
+    ASSERT_EQ(snapshot_result.size(), snapshot_expected.size());
+    for (const auto& [key, value] : snapshot_expected) {
+      EXPECT_EQ(snapshot_result.at(key), value);
+    }
+  }
+}
+
+USERVER_NAMESPACE_END
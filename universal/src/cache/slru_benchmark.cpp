@@ -1,12 +1,19 @@
 #include <benchmark/benchmark.h>
 
+#include <cstddef>
+#include <functional>
+
+#include <userver/cache/impl/lru.hpp>
 #include <userver/cache/impl/slru.hpp>
+#include <userver/cache/impl/tinylfu.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace {
 
 using Slru = cache::impl::SlruBase<unsigned, unsigned>;
+using Lru = cache::impl::LruBase<unsigned, unsigned>;
+using WTinyLfu = cache::impl::WTinyLfuBase<unsigned, unsigned>;
 
 constexpr unsigned kElementsCount = 1000;
 constexpr unsigned kProbationPart = 800;
@@ -31,6 +38,53 @@ Slru FillSlruBlocks(unsigned elements_count) {
   return slru;
 }
 
+WTinyLfu FillWTinyLfu(unsigned elements_count) {
+  WTinyLfu cache(kElementsCount);
+  for (unsigned i = 0; i < elements_count; ++i) {
+    cache.Put(i, i);
+  }
+  return cache;
+}
+
+Lru MakeCache(std::size_t size, Lru*) {
+  return Lru(size, std::hash<unsigned>{}, std::equal_to<unsigned>{});
+}
+
+Slru MakeCache(std::size_t size, Slru*) {
+  return Slru(size / 5, size - size / 5);
+}
+
+WTinyLfu MakeCache(std::size_t size, WTinyLfu*) { return WTinyLfu(size); }
+
+// Hot keys are requested in between the scan of keys that are requested
+// only once. Reports the hit rate of the hot keys.
+template <typename Cache>
+void ScanHitRate(benchmark::State& state) {
+  const auto hot_keys = static_cast<unsigned>(state.range(0));
+  auto cache = MakeCache(kElementsCount, static_cast<Cache*>(nullptr));
+
+  std::size_t hits = 0;
+  std::size_t requests = 0;
+  unsigned scan_key = hot_keys;
+  for ([[maybe_unused]] auto _ : state) {
+    for (unsigned i = 0; i < kElementsCount; ++i) {
+      const auto hot_key = i % hot_keys;
+      ++requests;
+      if (cache.Get(hot_key)) {
+        ++hits;
+      } else {
+        cache.Put(hot_key, hot_key);
+      }
+
+      for (unsigned j = 0; j < 4; ++j, ++scan_key) {
+        if (!cache.Get(scan_key)) cache.Put(scan_key, scan_key);
+      }
+    }
+  }
+  state.counters["hit_rate"] =
+      static_cast<double>(hits) / static_cast<double>(requests ? requests : 1);
+}
+
 }  // namespace
 
 void SlruPut(benchmark::State& state) {
@@ -81,4 +135,38 @@ void SlruPutOverflow(benchmark::State& state) {
 }
 BENCHMARK(SlruPutOverflow);
 
+void WTinyLfuPut(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    auto cache = FillWTinyLfu(kElementsCount);
+    benchmark::DoNotOptimize(cache);
+  }
+}
+BENCHMARK(WTinyLfuPut);
+
+void WTinyLfuHas(benchmark::State& state) {
+  auto cache = FillWTinyLfu(kElementsCount);
+  for ([[maybe_unused]] auto _ : state) {
+    for (unsigned i = 0; i < kElementsCount; ++i) {
+      benchmark::DoNotOptimize(cache.Get(i));
+    }
+  }
+}
+BENCHMARK(WTinyLfuHas);
+
+void WTinyLfuPutOverflow(benchmark::State& state) {
+  auto cache = FillWTinyLfu(kElementsCount);
+  unsigned i = kElementsCount;
+  for ([[maybe_unused]] auto _ : state) {
+    for (unsigned j = 0; j < kElementsCount; ++j) {
+      cache.Put(++i, 0);
+    }
+    benchmark::DoNotOptimize(cache);
+  }
+}
+BENCHMARK(WTinyLfuPutOverflow);
+
+BENCHMARK_TEMPLATE(ScanHitRate, Lru)->Arg(100)->Arg(500);
+BENCHMARK_TEMPLATE(ScanHitRate, Slru)->Arg(100)->Arg(500);
+BENCHMARK_TEMPLATE(ScanHitRate, WTinyLfu)->Arg(100)->Arg(500);
+
 USERVER_NAMESPACE_END
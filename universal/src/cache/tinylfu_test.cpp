@@ -0,0 +1,149 @@
+#include <userver/cache/impl/tinylfu.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <userver/cache/lru_map.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using WTinyLfu = cache::impl::WTinyLfuBase<int, int>;
+
+}  // namespace
+
+TEST(FrequencySketch, Estimate) {
+  cache::impl::FrequencySketch<int> sketch(100);
+  EXPECT_EQ(sketch.Estimate(1), 0);
+
+  for (int i = 0; i < 5; ++i) sketch.Increment(1);
+  sketch.Increment(2);
+
+  EXPECT_EQ(sketch.Estimate(1), 5);
+  EXPECT_EQ(sketch.Estimate(2), 1);
+  EXPECT_EQ(sketch.Estimate(3), 0);
+}
+
+TEST(FrequencySketch, Saturation) {
+  cache::impl::FrequencySketch<int> sketch(100);
+  for (int i = 0; i < 100; ++i) sketch.Increment(1);
+  EXPECT_EQ(sketch.Estimate(1), 15);
+}
+
+TEST(FrequencySketch, Aging) {
+  constexpr int kCapacity = 10;
+  cache::impl::FrequencySketch<int> sketch(kCapacity);
+  for (int i = 0; i < 8; ++i) sketch.Increment(-1);
+  EXPECT_EQ(sketch.Estimate(-1), 8);
+
+  // the sample size is 10 * capacity, after it the counters are halved
+  for (int i = 0; i < 10 * kCapacity; ++i) sketch.Increment(i);
+  EXPECT_LE(sketch.Estimate(-1), 4);
+}
+
+TEST(WTinyLfu, PutGet) {
+  WTinyLfu cache(100);
+  EXPECT_TRUE(cache.Put(1, 10));
+  EXPECT_FALSE(cache.Put(1, 11));
+  EXPECT_TRUE(cache.Put(2, 20));
+
+  ASSERT_NE(cache.Get(1), nullptr);
+  EXPECT_EQ(*cache.Get(1), 11);
+  EXPECT_EQ(*cache.Get(2), 20);
+  EXPECT_EQ(cache.Get(3), nullptr);
+  EXPECT_EQ(cache.GetSize(), 2);
+
+  cache.Erase(1);
+  EXPECT_EQ(cache.Get(1), nullptr);
+  EXPECT_EQ(cache.GetSize(), 1);
+
+  cache.Clear();
+  EXPECT_EQ(cache.GetSize(), 0);
+}
+
+TEST(WTinyLfu, Emplace) {
+  cache::impl::WTinyLfuBase<int, std::string> cache(10);
+  EXPECT_EQ(*cache.Emplace(1, 3, 'a'), "aaa");
+  EXPECT_EQ(*cache.Emplace(1, 2, 'b'), "aaa");
+}
+
+TEST(WTinyLfu, SizeIsBounded) {
+  constexpr std::size_t kSize = 100;
+  WTinyLfu cache(kSize);
+  EXPECT_EQ(cache.GetCapacity(), kSize);
+
+  for (int i = 0; i < 10000; ++i) {
+    cache.Put(i, i);
+    ASSERT_LE(cache.GetSize(), kSize);
+  }
+  EXPECT_EQ(cache.GetSize(), kSize);
+}
+
+TEST(WTinyLfu, ScanResistance) {
+  constexpr std::size_t kSize = 100;
+  constexpr int kHotKeys = 50;
+  WTinyLfu cache(kSize);
+
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < kHotKeys; ++i) {
+      if (!cache.Get(i)) cache.Put(i, i);
+    }
+  }
+
+  // the hot keys keep being requested during a scan of keys that are never
+  // requested again
+  for (int i = 0; i < 10000; ++i) {
+    if (!cache.Get(i % kHotKeys)) cache.Put(i % kHotKeys, i % kHotKeys);
+    const auto scan_key = kHotKeys + i;
+    if (!cache.Get(scan_key)) cache.Put(scan_key, scan_key);
+  }
+  EXPECT_GT(cache.GetAdmissionRejects(), 0);
+
+  int hits = 0;
+  for (int i = 0; i < kHotKeys; ++i) {
+    if (cache.Get(i)) ++hits;
+  }
+  EXPECT_EQ(hits, kHotKeys);
+}
+
+TEST(WTinyLfu, SetMaxSize) {
+  WTinyLfu cache(1000);
+  for (int i = 0; i < 1000; ++i) cache.Put(i, i);
+  for (int i = 0; i < 1000; i += 2) cache.Get(i);
+  EXPECT_EQ(cache.GetSize(), 1000);
+
+  cache.SetMaxSize(100);
+  EXPECT_EQ(cache.GetSize(), 100);
+  EXPECT_EQ(cache.GetCapacity(), 100);
+
+  cache.SetMaxSize(2000);
+  for (int i = 0; i < 3000; ++i) cache.Put(i, i);
+  EXPECT_EQ(cache.GetSize(), 2000);
+}
+
+TEST(WTinyLfu, VisitAll) {
+  WTinyLfu cache(100);
+  for (int i = 0; i < 100; ++i) cache.Put(i, i);
+  for (int i = 0; i < 100; i += 3) cache.Get(i);
+
+  std::size_t count = 0;
+  cache.VisitAll([&](int key, int value) {
+    EXPECT_EQ(key, value);
+    ++count;
+  });
+  EXPECT_EQ(count, cache.GetSize());
+}
+
+TEST(LruMap, WTinyLfuPolicy) {
+  cache::LruMap<int, int, std::hash<int>, std::equal_to<int>,
+                cache::CachePolicy::kWTinyLFU>
+      map(10);
+  map.Put(1, 1);
+  EXPECT_EQ(map.GetOr(1, 0), 1);
+  EXPECT_EQ(map.GetOr(2, 0), 0);
+  EXPECT_EQ(map.GetAdmissionRejects(), 0);
+}
+
+USERVER_NAMESPACE_END
@@ -1,9 +1,19 @@
 #include <userver/crypto/base64.hpp>
 
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
 #include <cryptopp/base64.h>
 
 #include <userver/crypto/exception.hpp>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define USERVER_IMPL_BASE64_AVX2
+#include <immintrin.h>
+#endif
+
 #ifdef CRYPTOPP_NO_GLOBAL_BYTE
 using CryptoPP::byte;
 #endif
@@ -14,25 +24,255 @@ namespace crypto::base64 {
 
 namespace {
 
-template <typename Base64Encoder>
-std::string Base64Encode(std::string_view data, Pad pad) {
-  std::string response;
-  try {
-    Base64Encoder encoder(new CryptoPP::StringSink(response));
-    CryptoPP::AlgorithmParameters params =
-        CryptoPP::MakeParameters(CryptoPP::Name::Pad(), Pad::kWith == pad)(
-            CryptoPP::Name::InsertLineBreaks(), false);
-    encoder.IsolatedInitialize(params);
-    encoder.PutMessageEnd(reinterpret_cast<const byte*>(data.data()),
-                          data.size());
-  } catch (const CryptoPP::Exception& exc) {
-    throw crypto::CryptoException(exc.what());
+struct Alphabet final {
+  std::string_view chars;
+  char char62;
+  char char63;
+};
+
+constexpr Alphabet kStandard{
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", '+',
+    '/'};
+
+[[maybe_unused]] constexpr Alphabet kUrl{
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_", '-',
+    '_'};
+
+constexpr char kPadding = '=';
+constexpr std::int8_t kInvalid = -1;
+
+constexpr std::array<std::int8_t, 256> MakeDecodeTable(
+    const Alphabet& alphabet) {
+  std::array<std::int8_t, 256> table{};
+  for (auto& value : table) value = kInvalid;
+  for (std::size_t i = 0; i < alphabet.chars.size(); ++i) {
+    table[static_cast<unsigned char>(alphabet.chars[i])] =
+        static_cast<std::int8_t>(i);
   }
-  return response;
+  return table;
+}
+
+constexpr auto kStandardDecodeTable = MakeDecodeTable(kStandard);
+[[maybe_unused]] constexpr auto kUrlDecodeTable = MakeDecodeTable(kUrl);
+
+#ifdef USERVER_IMPL_BASE64_AVX2
+#define USERVER_IMPL_AVX2_TARGET __attribute__((target("avx2")))
+
+bool HasAvx2() noexcept {
+  static const bool kHasAvx2 = __builtin_cpu_supports("avx2");
+  return kHasAvx2;
+}
+
+// Encodes 24 bytes into 32 characters per iteration, reads 32 bytes at a
+// time. Returns the count of the encoded bytes.
+USERVER_IMPL_AVX2_TARGET std::size_t EncodeAvx2(const char* input,
+                                                std::size_t size, char* out,
+                                                const Alphabet& alphabet) {
+  // Places the 3-byte groups into the 4-byte slots: 12 bytes of each lane
+  // are taken from the offset 4 of the first lane and from the offset 0 of
+  // the second one
+  const auto reshuffle = _mm256_set_epi8(
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,  //
+      14, 15, 13, 14, 11, 12, 10, 11, 8, 9, 7, 8, 5, 6, 4, 5);
+  // Offsets of the characters for the index ranges: [0, 26), [26, 52),
+  // [52, 62), 62, 63
+  const auto offset_62 = static_cast<char>(alphabet.char62 - 62);
+  const auto offset_63 = static_cast<char>(alphabet.char63 - 63);
+  const auto offsets = _mm256_setr_epi8(
+      'A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, offset_62, offset_63,
+      0, 0, 'A', 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, offset_62, offset_63,
+      0, 0);
+
+  std::size_t i = 0;
+  for (; size - i >= 32; i += 24) {
+    auto data =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+    data = _mm256_permutevar8x32_epi32(
+        data, _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6));
+    data = _mm256_shuffle_epi8(data, reshuffle);
+
+    // Split each 3 bytes into 4 6-bit indices
+    const auto t0 = _mm256_and_si256(data, _mm256_set1_epi32(0x0fc0fc00));
+    const auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const auto t2 = _mm256_and_si256(data, _mm256_set1_epi32(0x003f03f0));
+    const auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const auto indices = _mm256_or_si256(t1, t3);
+
+    // 0 for [0, 26), 1 for [26, 52), 2..11 for [52, 62), 12, 13 for 62, 63
+    auto ranges = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    ranges = _mm256_sub_epi8(
+        ranges, _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(out + i / 3 * 4),
+        _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, ranges)));
+  }
+  return i;
+}
+
+USERVER_IMPL_AVX2_TARGET inline __m256i InRange(__m256i chars, char min,
+                                                char max) {
+  return _mm256_and_si256(
+      _mm256_cmpgt_epi8(chars, _mm256_set1_epi8(min - 1)),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8(max + 1), chars));
+}
+
+// Decodes 32 characters into 24 bytes per iteration, stops at the first
+// block with a character out of the alphabet. Returns the count of the
+// decoded characters.
+USERVER_IMPL_AVX2_TARGET std::size_t DecodeAvx2(const char* encoded,
+                                                std::size_t size, char* out,
+                                                const Alphabet& alphabet) {
+  const auto pack_bytes = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,  //
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+  std::size_t i = 0;
+  for (; size - i >= 32; i += 32) {
+    const auto chars =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + i));
+    const auto is_upper = InRange(chars, 'A', 'Z');
+    const auto is_lower = InRange(chars, 'a', 'z');
+    const auto is_digit = InRange(chars, '0', '9');
+    const auto is_62 =
+        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(alphabet.char62));
+    const auto is_63 =
+        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(alphabet.char63));
+    const auto valid = _mm256_or_si256(
+        _mm256_or_si256(_mm256_or_si256(is_upper, is_lower), is_digit),
+        _mm256_or_si256(is_62, is_63));
+    if (_mm256_movemask_epi8(valid) != -1) break;
+
+    const auto upper_values = _mm256_sub_epi8(chars, _mm256_set1_epi8('A'));
+    const auto lower_values =
+        _mm256_sub_epi8(chars, _mm256_set1_epi8('a' - 26));
+    const auto digit_values =
+        _mm256_add_epi8(chars, _mm256_set1_epi8(52 - '0'));
+    auto values = _mm256_and_si256(is_upper, upper_values);
+    values = _mm256_or_si256(values, _mm256_and_si256(is_lower, lower_values));
+    values = _mm256_or_si256(values, _mm256_and_si256(is_digit, digit_values));
+    values = _mm256_or_si256(values,
+                             _mm256_and_si256(is_62, _mm256_set1_epi8(62)));
+    values = _mm256_or_si256(values,
+                             _mm256_and_si256(is_63, _mm256_set1_epi8(63)));
+
+    // Join each 4 6-bit values into 3 bytes
+    const auto pairs =
+        _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    auto joined = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    joined = _mm256_shuffle_epi8(joined, pack_bytes);
+    joined = _mm256_permutevar8x32_epi32(
+        joined, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+    auto* dst = out + i / 4 * 3;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm256_castsi256_si128(joined));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16),
+                     _mm256_extracti128_si256(joined, 1));
+  }
+  return i;
+}
+#endif
+
+std::string Encode(std::string_view data, Pad pad,
+                   const Alphabet& alphabet) {
+  const auto full_groups = data.size() / 3;
+  const auto tail = data.size() % 3;
+  std::string result(
+      full_groups * 4 + (tail == 0 ? 0 : (pad == Pad::kWith ? 4 : tail + 1)),
+      '\0');
+
+  const auto* input = reinterpret_cast<const unsigned char*>(data.data());
+  auto* out = result.data();
+  std::size_t i = 0;
+#ifdef USERVER_IMPL_BASE64_AVX2
+  if (HasAvx2()) {
+    i = EncodeAvx2(data.data(), data.size(), out, alphabet);
+    out += i / 3 * 4;
+  }
+#endif
+
+  const auto* chars = alphabet.chars.data();
+  for (; data.size() - i >= 3; i += 3) {
+    const std::uint32_t group =
+        (input[i] << 16) | (input[i + 1] << 8) | input[i + 2];
+    *(out++) = chars[group >> 18];
+    *(out++) = chars[(group >> 12) & 0x3f];
+    *(out++) = chars[(group >> 6) & 0x3f];
+    *(out++) = chars[group & 0x3f];
+  }
+
+  if (tail != 0) {
+    const std::uint32_t group =
+        (input[i] << 16) | (tail == 2 ? input[i + 1] << 8 : 0);
+    *(out++) = chars[group >> 18];
+    *(out++) = chars[(group >> 12) & 0x3f];
+    if (tail == 2) *(out++) = chars[(group >> 6) & 0x3f];
+    if (pad == Pad::kWith) {
+      *(out++) = kPadding;
+      if (tail == 1) *(out++) = kPadding;
+    }
+  }
+  return result;
+}
+
+// Decodes the data that consists only of the alphabet characters with an
+// optional padding. Returns nullopt for any other input, it is left to the
+// lenient CryptoPP decoder.
+std::optional<std::string> DecodeStrict(
+    std::string_view data, const Alphabet& alphabet,
+    const std::array<std::int8_t, 256>& table) {
+  if (data.size() % 4 == 0 && !data.empty() && data.back() == kPadding) {
+    data.remove_suffix(1);
+    if (data.back() == kPadding) data.remove_suffix(1);
+  }
+  const auto tail = data.size() % 4;
+  if (tail == 1) return std::nullopt;
+
+  std::string result(data.size() / 4 * 3 + (tail == 0 ? 0 : tail - 1), '\0');
+  auto* out = result.data();
+  std::size_t i = 0;
+#ifdef USERVER_IMPL_BASE64_AVX2
+  if (HasAvx2()) {
+    i = DecodeAvx2(data.data(), data.size(), out, alphabet);
+    out += i / 4 * 3;
+  }
+#else
+  static_cast<void>(alphabet);
+#endif
+
+  const auto value = [&](std::size_t pos) {
+    return table[static_cast<unsigned char>(data[pos])];
+  };
+  for (; data.size() - i >= 4; i += 4) {
+    const auto a = value(i);
+    const auto b = value(i + 1);
+    const auto c = value(i + 2);
+    const auto d = value(i + 3);
+    if ((a | b | c | d) < 0) return std::nullopt;
+
+    const std::uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+    *(out++) = static_cast<char>(group >> 16);
+    *(out++) = static_cast<char>(group >> 8);
+    *(out++) = static_cast<char>(group);
+  }
+
+  if (tail != 0) {
+    const auto a = value(i);
+    const auto b = value(i + 1);
+    const auto c = tail == 3 ? value(i + 2) : 0;
+    if ((a | b | c) < 0) return std::nullopt;
+
+    const std::uint32_t group = (a << 18) | (b << 12) | (c << 6);
+    *(out++) = static_cast<char>(group >> 16);
+    if (tail == 3) *(out++) = static_cast<char>(group >> 8);
+  }
+  return result;
 }
 
 template <typename Base64Decoder>
-std::string Base64Decode(std::string_view data) {
+std::string DecodeLenient(std::string_view data) {
   std::string response;
   try {
     Base64Decoder decoder(new CryptoPP::StringSink(response));
@@ -47,20 +287,24 @@ std::string Base64Decode(std::string_view data) {
 }  // namespace
 
 std::string Base64Encode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64Encoder>(data, pad);
+  return Encode(data, pad, kStandard);
 }
 
 std::string Base64Decode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64Decoder>(data);
+  auto result = DecodeStrict(data, kStandard, kStandardDecodeTable);
+  if (result) return std::move(*result);
+  return DecodeLenient<CryptoPP::Base64Decoder>(data);
 }
 
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 std::string Base64UrlEncode(std::string_view data, Pad pad) {
-  return Base64Encode<CryptoPP::Base64URLEncoder>(data, pad);
+  return Encode(data, pad, kUrl);
 }
 
 std::string Base64UrlDecode(std::string_view data) {
-  return Base64Decode<CryptoPP::Base64URLDecoder>(data);
+  auto result = DecodeStrict(data, kUrl, kUrlDecodeTable);
+  if (result) return std::move(*result);
+  return DecodeLenient<CryptoPP::Base64URLDecoder>(data);
 }
 #endif
 
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include <userver/crypto/base64.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,6 +19,26 @@ TEST(Crypto, Base64) {
   EXPECT_EQ("U/8=", crypto::base64::Base64Encode("S\xff"));
 }
 
+TEST(Crypto, Base64Long) {
+  // Long enough for the vectorized code paths, with a tail after them
+  std::string data;
+  for (int i = 0; i < 1000; ++i) data.push_back(static_cast<char>(i * 37));
+
+  for (std::size_t size : {23, 24, 31, 32, 33, 100, 1000}) {
+    const auto input = data.substr(0, size);
+    const auto encoded = crypto::base64::Base64Encode(input);
+    EXPECT_EQ(input, crypto::base64::Base64Decode(encoded));
+    EXPECT_EQ(input,
+              crypto::base64::Base64Decode(crypto::base64::Base64Encode(
+                  input, crypto::base64::Pad::kWithout)));
+
+    // Non-alphabet characters are skipped
+    auto with_line_breaks = encoded;
+    with_line_breaks.insert(with_line_breaks.size() / 2, "\n");
+    EXPECT_EQ(input, crypto::base64::Base64Decode(with_line_breaks));
+  }
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BASE64_URL
 TEST(Crypto, Base64Url) {
   EXPECT_EQ("U_8=", crypto::base64::Base64UrlEncode("S\xff"));
@@ -24,6 +46,11 @@ TEST(Crypto, Base64Url) {
                        "S\xff", crypto::base64::Pad::kWithout));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8"));
   EXPECT_EQ("S\xFF", crypto::base64::Base64UrlDecode("U_8="));
+
+  const std::string data(100, '\xff');
+  const auto encoded = crypto::base64::Base64UrlEncode(data);
+  EXPECT_EQ(encoded.find_first_of("+/"), std::string::npos);
+  EXPECT_EQ(data, crypto::base64::Base64UrlDecode(encoded));
 }
 #endif
 
@@ -1,6 +1,7 @@
 #include <userver/crypto/hash.hpp>
 
 #include <array>
+#include <memory>
 
 #include <cryptopp/base64.h>
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
@@ -12,6 +13,7 @@
 #include <cryptopp/sha.h>
 
 #include <userver/crypto/exception.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <cryptopp/md5.h>
 
@@ -95,10 +97,125 @@ std::string CalculateHash(std::string_view data,
   return EncodeArray(digest.data(), digest.size(), encoding);
 }
 
+using HashPtr = std::unique_ptr<CryptoPP::HashTransformation>;
+
+HashPtr MakeHash(crypto::hash::Algorithm algorithm) {
+  using crypto::hash::Algorithm;
+  switch (algorithm) {
+    case Algorithm::kSha1:
+      return std::make_unique<CryptoPP::SHA1>();
+    case Algorithm::kSha224:
+      return std::make_unique<CryptoPP::SHA224>();
+    case Algorithm::kSha256:
+      return std::make_unique<CryptoPP::SHA256>();
+    case Algorithm::kSha384:
+      return std::make_unique<CryptoPP::SHA384>();
+    case Algorithm::kSha512:
+      return std::make_unique<CryptoPP::SHA512>();
+    case Algorithm::kBlake2b128:
+#ifndef USERVER_NO_CRYPTOPP_BLAKE2
+      return std::make_unique<AlgoBlake2b128>();
+#else
+      throw crypto::CryptoException("Blake2b is not available in this build");
+#endif
+    case Algorithm::kWeakMd5:
+      return std::make_unique<CryptoPP::Weak::MD5>();
+  }
+  throw crypto::CryptoException("Unknown hash algorithm");
+}
+
+template <typename HashAlgorithm>
+HashPtr MakeHmacOf(std::string_view key) {
+  return std::make_unique<CryptoPP::HMAC<HashAlgorithm>>(
+      reinterpret_cast<const byte*>(key.data()), key.size());
+}
+
+HashPtr MakeHmac(crypto::hash::Algorithm algorithm, std::string_view key) {
+  using crypto::hash::Algorithm;
+  switch (algorithm) {
+    case Algorithm::kSha1:
+      return MakeHmacOf<CryptoPP::SHA1>(key);
+    case Algorithm::kSha224:
+      return MakeHmacOf<CryptoPP::SHA224>(key);
+    case Algorithm::kSha256:
+      return MakeHmacOf<CryptoPP::SHA256>(key);
+    case Algorithm::kSha384:
+      return MakeHmacOf<CryptoPP::SHA384>(key);
+    case Algorithm::kSha512:
+      return MakeHmacOf<CryptoPP::SHA512>(key);
+    case Algorithm::kBlake2b128:
+      throw crypto::CryptoException("HMAC is not available for Blake2b");
+    case Algorithm::kWeakMd5:
+      return MakeHmacOf<CryptoPP::Weak::MD5>(key);
+  }
+  throw crypto::CryptoException("Unknown hash algorithm");
+}
+
 }  // namespace
 
 namespace crypto::hash {
 
+class Hasher::Impl final {
+ public:
+  explicit Impl(HashPtr&& hash) : hash_(std::move(hash)) {
+    UASSERT(hash_->DigestSize() <= CryptoPP::SHA512::DIGESTSIZE);
+  }
+
+  CryptoPP::HashTransformation& Get() const { return *hash_; }
+
+ private:
+  HashPtr hash_;
+};
+
+Hasher::Hasher(Algorithm algorithm)
+    : impl_(std::make_unique<Impl>(MakeHash(algorithm))) {}
+
+Hasher Hasher::Hmac(Algorithm algorithm, std::string_view key) {
+  try {
+    return Hasher(std::make_unique<Impl>(MakeHmac(algorithm, key)));
+  } catch (const CryptoPP::Exception& exc) {
+    throw CryptoException(exc.what());
+  }
+}
+
+Hasher::Hasher(std::unique_ptr<Impl>&& impl) : impl_(std::move(impl)) {}
+
+Hasher::Hasher(Hasher&&) noexcept = default;
+
+Hasher& Hasher::operator=(Hasher&&) noexcept = default;
+
+Hasher::~Hasher() = default;
+
+void Hasher::Update(std::string_view data) {
+  UASSERT_MSG(impl_, "Using a moved-out Hasher");
+  try {
+    impl_->Get().Update(reinterpret_cast<const byte*>(data.data()),
+                        data.size());
+  } catch (const CryptoPP::Exception& exc) {
+    throw CryptoException(exc.what());
+  }
+}
+
+std::string Hasher::Final(OutputEncoding encoding) {
+  UASSERT_MSG(impl_, "Using a moved-out Hasher");
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init): performance
+  std::array<byte, CryptoPP::SHA512::DIGESTSIZE> digest;
+  const auto size = impl_->Get().DigestSize();
+  try {
+    // Final() also restarts the hash for the next message
+    impl_->Get().Final(digest.data());
+  } catch (const CryptoPP::Exception& exc) {
+    throw CryptoException(exc.what());
+  }
+
+  return EncodeArray(digest.data(), size, encoding);
+}
+
+std::size_t Hasher::DigestSize() const {
+  UASSERT_MSG(impl_, "Using a moved-out Hasher");
+  return impl_->Get().DigestSize();
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 std::string Blake2b128(std::string_view data, OutputEncoding encoding) {
   return CalculateHash<AlgoBlake2b128>(data, encoding);
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <string_view>
+
+#include <cryptopp/cpu.h>
+
+#include <userver/crypto/hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Shows whether CryptoPP picked the SHA CPU extensions, software SHA is
+// several times slower
+const char* ShaExtensionsLabel() {
+#if CRYPTOPP_BOOL_X86 || CRYPTOPP_BOOL_X32 || CRYPTOPP_BOOL_X64
+  return CryptoPP::HasSHA() ? "sha-ni" : "no sha-ni";
+#elif CRYPTOPP_BOOL_ARM32 || CRYPTOPP_BOOL_ARMV8
+  return CryptoPP::HasSHA2() ? "armv8 sha2" : "no armv8 sha2";
+#else
+  return "";
+#endif
+}
+
+std::string MakeData(std::size_t size) { return std::string(size, 'x'); }
+
+}  // namespace
+
+void HashSha256OneShot(benchmark::State& state) {
+  const auto data = MakeData(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(crypto::hash::Sha256(
+        data, crypto::hash::OutputEncoding::kBinary));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetLabel(ShaExtensionsLabel());
+}
+BENCHMARK(HashSha256OneShot)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+void HashStreaming(benchmark::State& state, crypto::hash::Algorithm algorithm) {
+  constexpr std::size_t kChunkSize = 16 * 1024;
+  const auto data = MakeData(state.range(0));
+  crypto::hash::Hasher hasher(algorithm);
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < data.size(); i += kChunkSize) {
+      hasher.Update(std::string_view{data}.substr(i, kChunkSize));
+    }
+    benchmark::DoNotOptimize(
+        hasher.Final(crypto::hash::OutputEncoding::kBinary));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetLabel(ShaExtensionsLabel());
+}
+BENCHMARK_CAPTURE(HashStreaming, sha1, crypto::hash::Algorithm::kSha1)
+    ->RangeMultiplier(16)
+    ->Range(64, 1 << 20);
+BENCHMARK_CAPTURE(HashStreaming, sha256, crypto::hash::Algorithm::kSha256)
+    ->RangeMultiplier(16)
+    ->Range(64, 1 << 20);
+BENCHMARK_CAPTURE(HashStreaming, sha512, crypto::hash::Algorithm::kSha512)
+    ->RangeMultiplier(16)
+    ->Range(64, 1 << 20);
+
+void HashHmacSha256Streaming(benchmark::State& state) {
+  constexpr std::size_t kChunkSize = 16 * 1024;
+  const auto data = MakeData(state.range(0));
+  auto hmac =
+      crypto::hash::Hasher::Hmac(crypto::hash::Algorithm::kSha256, "secret");
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < data.size(); i += kChunkSize) {
+      hmac.Update(std::string_view{data}.substr(i, kChunkSize));
+    }
+    benchmark::DoNotOptimize(hmac.Final(crypto::hash::OutputEncoding::kBinary));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(HashHmacSha256Streaming)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,10 @@
+#include <string>
+#include <string_view>
+#include <utility>
+
 #include <gtest/gtest.h>
 
+#include <userver/crypto/exception.hpp>
 #include <userver/crypto/hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -94,6 +99,70 @@ TEST(Crypto, Hmac) {
                                crypto::hash::OutputEncoding::kHex));
 }
 
+TEST(Crypto, Hasher) {
+  /// [Hasher]
+  crypto::hash::Hasher hasher(crypto::hash::Algorithm::kSha256);
+  for (std::string_view chunk : {"te", "", "st"}) {
+    hasher.Update(chunk);
+  }
+  EXPECT_EQ(hasher.Final(), crypto::hash::Sha256("test"));
+  /// [Hasher]
+
+  // Final() resets the hasher
+  EXPECT_EQ(hasher.Final(), crypto::hash::Sha256({}));
+  hasher.Update("test\n");
+  EXPECT_EQ(
+      hasher.Final(crypto::hash::OutputEncoding::kBase64),
+      crypto::hash::Sha256("test\n", crypto::hash::OutputEncoding::kBase64));
+  EXPECT_EQ(hasher.DigestSize(), 32);
+}
+
+TEST(Crypto, HasherAlgorithms) {
+  using crypto::hash::Algorithm;
+  using OneShot = std::string (*)(std::string_view,
+                                  crypto::hash::OutputEncoding);
+  const std::pair<Algorithm, OneShot> algorithms[] = {
+      {Algorithm::kSha1, &crypto::hash::Sha1},
+      {Algorithm::kSha224, &crypto::hash::Sha224},
+      {Algorithm::kSha256, &crypto::hash::Sha256},
+      {Algorithm::kSha384, &crypto::hash::Sha384},
+      {Algorithm::kSha512, &crypto::hash::Sha512},
+#ifndef USERVER_NO_CRYPTOPP_BLAKE2
+      {Algorithm::kBlake2b128, &crypto::hash::Blake2b128},
+#endif
+      {Algorithm::kWeakMd5, &crypto::hash::weak::Md5},
+  };
+
+  const std::string data(1000, 'x');
+  for (const auto& [algorithm, one_shot] : algorithms) {
+    crypto::hash::Hasher hasher(algorithm);
+    for (std::size_t i = 0; i < data.size(); i += 7) {
+      hasher.Update(std::string_view{data}.substr(i, 7));
+    }
+    EXPECT_EQ(hasher.Final(crypto::hash::OutputEncoding::kHex),
+              one_shot(data, crypto::hash::OutputEncoding::kHex));
+  }
+}
+
+TEST(Crypto, HasherHmac) {
+  using crypto::hash::Algorithm;
+
+  auto hmac = crypto::hash::Hasher::Hmac(Algorithm::kSha256, "test");
+  hmac.Update("t");
+  hmac.Update("est");
+  EXPECT_EQ(hmac.Final(), crypto::hash::HmacSha256("test", "test"));
+
+  // The key is retained after Final()
+  hmac.Update("test");
+  EXPECT_EQ(hmac.Final(), crypto::hash::HmacSha256("test", "test"));
+
+  auto hmac512 = crypto::hash::Hasher::Hmac(Algorithm::kSha512, "secret");
+  EXPECT_EQ(hmac512.Final(), crypto::hash::HmacSha512("secret", ""));
+
+  EXPECT_THROW(crypto::hash::Hasher::Hmac(Algorithm::kBlake2b128, "key"),
+               crypto::CryptoException);
+}
+
 #ifndef USERVER_NO_CRYPTOPP_BLAKE2
 TEST(Crypto, Blake2b128) {
   EXPECT_EQ("e9a804b2e527fd3601d2ffc0bb023cd6",
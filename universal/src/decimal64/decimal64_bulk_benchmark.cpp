@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <userver/decimal64/bulk.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Dec4 = decimal64::Decimal<4>;
+using Dec2 = decimal64::Decimal<2>;
+
+std::vector<Dec4> MakePrices(std::size_t count) {
+  std::minstd_rand rng{42};
+  std::uniform_int_distribution<int64_t> distribution{0, 100'000'000};
+  std::vector<Dec4> result;
+  result.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back(Dec4::FromUnbiased(distribution(rng)));
+  }
+  return result;
+}
+
+std::string MakeCsv(const std::vector<Dec4>& prices) {
+  std::string result;
+  for (const auto price : prices) {
+    if (!result.empty()) result += ',';
+    result += ToString(price);
+  }
+  return result;
+}
+
+}  // namespace
+
+void decimal64_sum_one_by_one(benchmark::State& state) {
+  const auto prices = MakePrices(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    Dec4 sum{0};
+    for (const auto price : prices) sum += price;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_sum_one_by_one)->Range(64, 1 << 20);
+
+void decimal64_sum_bulk(benchmark::State& state) {
+  const auto prices = MakePrices(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::Sum(prices));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_sum_bulk)->Range(64, 1 << 20);
+
+void decimal64_multiply_one_by_one(benchmark::State& state) {
+  auto prices = MakePrices(state.range(0));
+  const Dec2 discount{"0.95"};
+  for ([[maybe_unused]] auto _ : state) {
+    for (auto& price : prices) price = price * discount / discount;
+    benchmark::DoNotOptimize(prices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(decimal64_multiply_one_by_one)->Range(64, 1 << 16);
+
+void decimal64_multiply_bulk(benchmark::State& state) {
+  auto prices = MakePrices(state.range(0));
+  const Dec2 discount{"0.95"};
+  const Dec2 inverse{"1.05"};
+  for ([[maybe_unused]] auto _ : state) {
+    decimal64::MultiplyInPlace(prices, discount);
+    decimal64::MultiplyInPlace(prices, inverse);
+    benchmark::DoNotOptimize(prices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(decimal64_multiply_bulk)->Range(64, 1 << 16);
+
+void decimal64_multiply_by_integer_bulk(benchmark::State& state) {
+  auto prices = MakePrices(state.range(0));
+  int factor = 1;
+  benchmark::DoNotOptimize(factor);
+  for ([[maybe_unused]] auto _ : state) {
+    decimal64::MultiplyInPlace(prices, factor);
+    benchmark::DoNotOptimize(prices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_multiply_by_integer_bulk)->Range(64, 1 << 16);
+
+void decimal64_cast_one_by_one(benchmark::State& state) {
+  const auto prices = MakePrices(state.range(0));
+  std::vector<Dec2> result(prices.size());
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+      result[i] = decimal64::decimal_cast<Dec2>(prices[i]);
+    }
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_cast_one_by_one)->Range(64, 1 << 16);
+
+void decimal64_cast_bulk(benchmark::State& state) {
+  const auto prices = MakePrices(state.range(0));
+  std::vector<Dec2> result(prices.size());
+  for ([[maybe_unused]] auto _ : state) {
+    decimal64::CastInto(prices, result);
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_cast_bulk)->Range(64, 1 << 16);
+
+void decimal64_from_string_one_by_one(benchmark::State& state) {
+  const auto csv = MakeCsv(MakePrices(state.range(0)));
+  for ([[maybe_unused]] auto _ : state) {
+    std::vector<Dec4> result;
+    std::string_view input = csv;
+    while (true) {
+      const auto pos = input.find(',');
+      result.emplace_back(input.substr(0, pos));
+      if (pos == std::string_view::npos) break;
+      input.remove_prefix(pos + 1);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_from_string_one_by_one)->Range(64, 1 << 16);
+
+void decimal64_from_string_bulk(benchmark::State& state) {
+  const auto csv = MakeCsv(MakePrices(state.range(0)));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(decimal64::FromStringBulk<Dec4>(csv));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(decimal64_from_string_bulk)->Range(64, 1 << 16);
+
+USERVER_NAMESPACE_END
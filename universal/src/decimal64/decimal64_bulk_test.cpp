@@ -0,0 +1,155 @@
+#include <userver/decimal64/bulk.hpp>
+
+#include <array>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/utest/assert_macros.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Dec2 = decimal64::Decimal<2>;
+using Dec4 = decimal64::Decimal<4>;
+using Dec4HalfEven = decimal64::Decimal<4, decimal64::HalfEvenRoundPolicy>;
+
+constexpr auto kMaxInt64 = std::numeric_limits<int64_t>::max();
+constexpr auto kMinInt64 = std::numeric_limits<int64_t>::min();
+
+std::vector<Dec4> MakeRandomPrices(std::size_t count) {
+  std::minstd_rand rng{42};
+  std::uniform_int_distribution<int64_t> distribution{-1'000'000'000,
+                                                      1'000'000'000};
+  std::vector<Dec4> result;
+  for (std::size_t i = 0; i < count; ++i) {
+    result.push_back(Dec4::FromUnbiased(distribution(rng)));
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(Decimal64Bulk, Sum) {
+  EXPECT_EQ(decimal64::Sum(std::vector<Dec4>{}), Dec4{0});
+  EXPECT_EQ(decimal64::Sum(std::array{Dec4{"1.5"}, Dec4{"-0.25"}}),
+            Dec4{"1.25"});
+
+  for (const std::size_t size : {1, 3, 4, 5, 17, 1000}) {
+    const auto values = MakeRandomPrices(size);
+    Dec4 expected{0};
+    for (const auto value : values) expected += value;
+    EXPECT_EQ(decimal64::Sum(values), expected) << size;
+    EXPECT_EQ(decimal64::Sum(utils::span<const Dec4>{values}), expected);
+  }
+}
+
+TEST(Decimal64Bulk, SumOverflow) {
+  const auto max = Dec4::FromUnbiased(kMaxInt64);
+  const auto min = Dec4::FromUnbiased(kMinInt64);
+  const auto one = Dec4::FromUnbiased(1);
+
+  // Intermediate sums may overflow as long as the result fits
+  std::vector<Dec4> values{max, max, max, max, -max, -max, -max, -max, one};
+  EXPECT_EQ(decimal64::Sum(values), one);
+
+  values = {max, max, max, max, min, min, min, min, one};
+  EXPECT_EQ(decimal64::Sum(values), Dec4::FromUnbiased(-3));
+
+  UEXPECT_THROW(decimal64::Sum(std::vector<Dec4>{max, one}),
+                decimal64::OutOfBoundsError);
+  UEXPECT_THROW(decimal64::Sum(std::vector<Dec4>{min, -one}),
+                decimal64::OutOfBoundsError);
+  UEXPECT_THROW(decimal64::Sum(std::vector<Dec4>(8, max)),
+                decimal64::OutOfBoundsError);
+  UEXPECT_THROW(decimal64::Sum(std::vector<Dec4>(9, min)),
+                decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64Bulk, MultiplyByInteger) {
+  auto values = MakeRandomPrices(13);
+  auto expected = values;
+  for (auto& value : expected) value *= -3;
+
+  decimal64::MultiplyInPlace(values, -3);
+  EXPECT_EQ(values, expected);
+
+  std::vector<Dec4> overflowing{Dec4{1}, Dec4::FromUnbiased(kMaxInt64 / 2)};
+  UEXPECT_THROW(decimal64::MultiplyInPlace(overflowing, 3),
+                decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64Bulk, MultiplyByDecimal) {
+  std::vector<Dec4HalfEven> values{
+      Dec4HalfEven{"10.0005"}, Dec4HalfEven{"10.0015"},
+      Dec4HalfEven{"-2.5"},
+      // The product does not fit into int64
+      Dec4HalfEven::FromUnbiased(kMaxInt64 / 4)};
+  auto expected = values;
+  const decimal64::Decimal<1, decimal64::HalfEvenRoundPolicy> factor{"0.5"};
+  for (auto& value : expected) value *= factor;
+
+  decimal64::MultiplyInPlace(values, factor);
+  EXPECT_EQ(values, expected);
+  EXPECT_EQ(values[0], Dec4HalfEven{"5.0002"});
+  EXPECT_EQ(values[1], Dec4HalfEven{"5.0008"});
+
+  std::vector<Dec4> overflowing{Dec4::FromUnbiased(kMaxInt64 / 2)};
+  UEXPECT_THROW(decimal64::MultiplyInPlace(overflowing, Dec2{"2.5"}),
+                decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64Bulk, CastInto) {
+  const auto values = MakeRandomPrices(11);
+
+  std::vector<Dec2> narrowed(values.size());
+  decimal64::CastInto(values, narrowed);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(narrowed[i], decimal64::decimal_cast<Dec2>(values[i]));
+  }
+
+  std::vector<Dec4> widened(values.size());
+  decimal64::CastInto(narrowed, widened);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(widened[i], decimal64::decimal_cast<Dec4>(narrowed[i]));
+  }
+
+  const std::vector<Dec2> overflowing{Dec2::FromUnbiased(kMaxInt64)};
+  std::vector<Dec4> target(1);
+  UEXPECT_THROW(decimal64::CastInto(overflowing, target),
+                decimal64::OutOfBoundsError);
+}
+
+TEST(Decimal64Bulk, FromStringBulk) {
+  EXPECT_TRUE(decimal64::FromStringBulk<Dec4>("").empty());
+  EXPECT_EQ(decimal64::FromStringBulk<Dec4>("1.5,-0.0001,+42,0.1234"),
+            (std::vector<Dec4>{Dec4{"1.5"}, Dec4{"-0.0001"}, Dec4{42},
+                               Dec4{"0.1234"}}));
+  EXPECT_EQ(decimal64::FromStringBulk<Dec2>("7;000000000000000000001.10", ';'),
+            (std::vector<Dec2>{Dec2{7}, Dec2{"1.1"}}));
+  EXPECT_EQ(decimal64::FromStringBulk<Dec4>("-99999999999999.9999"),
+            std::vector<Dec4>{Dec4::FromUnbiased(-999999999999999999)});
+
+  const auto values = MakeRandomPrices(100);
+  std::string csv;
+  for (const auto value : values) {
+    if (!csv.empty()) csv += ',';
+    csv += ToString(value);
+  }
+  EXPECT_EQ(decimal64::FromStringBulk<Dec4>(csv), values);
+
+  UEXPECT_THROW(decimal64::FromStringBulk<Dec4>("1,"), decimal64::ParseError);
+  UEXPECT_THROW(decimal64::FromStringBulk<Dec4>("1, 2"), decimal64::ParseError);
+  UEXPECT_THROW(decimal64::FromStringBulk<Dec4>("1.12345"),
+                decimal64::ParseError);
+  UEXPECT_THROW(decimal64::FromStringBulk<Dec4>(".5"), decimal64::ParseError);
+  UEXPECT_THROW(decimal64::FromStringBulk<Dec4>("922337203685478"),
+                decimal64::ParseError);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,189 @@
+#include <userver/formats/common/aggregates.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/parse/aggregates.hpp>
+#include <userver/formats/serialize/aggregates.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+#include <userver/formats/yaml/value_builder.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+/// [Sample reflected aggregate]
+namespace sample {
+
+struct Point {
+  int x;
+  int y;
+  std::optional<std::string> label;
+};
+
+}  // namespace sample
+
+template <>
+struct formats::common::ReflectedAggregate<sample::Point> {
+  static constexpr std::string_view kFieldNames[] = {"x", "y", "label"};
+};
+/// [Sample reflected aggregate]
+
+namespace {
+
+struct Shape {
+  std::string name;
+  std::vector<sample::Point> points;
+  std::map<std::string, double> attributes;
+  unsigned weight;
+  bool closed;
+  std::optional<sample::Point> center;
+};
+
+}  // namespace
+
+template <>
+struct formats::common::ReflectedAggregate<Shape> {
+  static constexpr std::string_view kFieldNames[] = {
+      "name", "points", "attributes", "weight", "closed", "center"};
+};
+
+namespace {
+
+struct Wide {
+  int id, timestamp, value, unit, sensor, x, y, z, w, h, d, t;
+};
+
+}  // namespace
+
+template <>
+struct formats::common::ReflectedAggregate<Wide> {
+  static constexpr std::string_view kFieldNames[] = {
+      "id", "timestamp", "value", "unit", "sensor", "x",
+      "y",  "z",         "w",     "h",    "d",      "t"};
+};
+
+namespace sample {
+
+bool operator==(const Point& lhs, const Point& rhs) {
+  return lhs.x == rhs.x && lhs.y == rhs.y && lhs.label == rhs.label;
+}
+
+}  // namespace sample
+
+namespace {
+
+constexpr std::string_view kShapeJson = R"({
+  "name": "triangle",
+  "unknown": {"nested": [1, {"deeper": null}], "other": "x"},
+  "points": [{"x": 0, "y": 0, "label": "origin"}, {"x": 1, "y": 0},
+             {"x": 0, "y": 1, "label": null}],
+  "attributes": {"area": 0.5},
+  "weight": 3,
+  "closed": true
+})";
+
+void CheckShape(const Shape& shape) {
+  EXPECT_EQ(shape.name, "triangle");
+  ASSERT_EQ(shape.points.size(), 3);
+  EXPECT_EQ(shape.points[0], (sample::Point{0, 0, "origin"}));
+  EXPECT_EQ(shape.points[1], (sample::Point{1, 0, std::nullopt}));
+  EXPECT_EQ(shape.points[2], (sample::Point{0, 1, std::nullopt}));
+  EXPECT_EQ(shape.attributes, (std::map<std::string, double>{{"area", 0.5}}));
+  EXPECT_EQ(shape.weight, 3);
+  EXPECT_TRUE(shape.closed);
+  EXPECT_FALSE(shape.center);
+}
+
+}  // namespace
+
+static_assert(formats::common::kIsReflectedAggregate<sample::Point>);
+static_assert(!formats::common::kIsReflectedAggregate<std::string>);
+static_assert(formats::common::impl::FieldNames<Shape>::Find("closed") == 4);
+static_assert(formats::common::impl::FieldNames<Shape>::Find("open") == 6);
+
+TEST(FormatsAggregates, JsonParse) {
+  CheckShape(formats::json::FromString(kShapeJson).As<Shape>());
+
+  EXPECT_THROW(formats::json::FromString(R"({"x": 1})").As<sample::Point>(),
+               formats::json::MemberMissingException);
+  EXPECT_THROW(formats::json::FromString("[]").As<sample::Point>(),
+               formats::json::TypeMismatchException);
+}
+
+TEST(FormatsAggregates, JsonSerialize) {
+  const sample::Point point{1, 2, std::nullopt};
+  const auto json = formats::json::ValueBuilder{point}.ExtractValue();
+  EXPECT_EQ(json, formats::json::FromString(R"({"x": 1, "y": 2})"));
+
+  const auto shape = formats::json::FromString(kShapeJson).As<Shape>();
+  CheckShape(formats::json::ValueBuilder{shape}.ExtractValue().As<Shape>());
+}
+
+TEST(FormatsAggregates, JsonWriteToStream) {
+  const auto shape = formats::json::FromString(kShapeJson).As<Shape>();
+
+  formats::json::StringBuilder sb;
+  WriteToStream(shape, sb);
+  const auto json = formats::json::FromString(sb.GetString());
+  EXPECT_EQ(json, formats::json::ValueBuilder{shape}.ExtractValue());
+  EXPECT_FALSE(json.HasMember("center"));
+}
+
+TEST(FormatsAggregates, YamlRoundtrip) {
+  const auto yaml = formats::yaml::FromString(R"(
+name: triangle
+points:
+  - {x: 0, y: 0, label: origin}
+  - {x: 1, y: 0}
+  - {x: 0, y: 1}
+attributes: {area: 0.5}
+weight: 3
+closed: true
+)");
+  const auto shape = yaml.As<Shape>();
+  CheckShape(shape);
+  CheckShape(formats::yaml::ValueBuilder{shape}.ExtractValue().As<Shape>());
+}
+
+TEST(FormatsAggregates, FieldNamesLookup) {
+  using Names = formats::common::impl::FieldNames<Wide>;
+  for (std::size_t i = 0; i < Names::kCount; ++i) {
+    EXPECT_EQ(Names::Find(Names::kNames[i]), i);
+  }
+  EXPECT_EQ(Names::Find("unknown"), Names::kCount);
+  EXPECT_EQ(Names::Find(""), Names::kCount);
+}
+
+TEST(FormatsAggregates, SaxParse) {
+  /// [Sample aggregate SAX parsing]
+  namespace fjp = formats::json::parser;
+
+  using Parser = fjp::AggregateParser<sample::Point>;
+  const auto point = fjp::ParseToType<sample::Point, Parser>(
+      R"({"y": 2, "x": 1, "comment": ["skipped"]})");
+  EXPECT_EQ(point, (sample::Point{1, 2, std::nullopt}));
+  /// [Sample aggregate SAX parsing]
+
+  CheckShape(fjp::ParseToType<Shape, fjp::AggregateParser<Shape>>(kShapeJson));
+}
+
+TEST(FormatsAggregates, SaxParseErrors) {
+  namespace fjp = formats::json::parser;
+  using Parser = fjp::AggregateParser<Shape>;
+
+  EXPECT_THROW((fjp::ParseToType<Shape, Parser>("[]")), fjp::ParseError);
+  EXPECT_THROW((fjp::ParseToType<Shape, Parser>(R"({"name": "x"})")),
+               fjp::ParseError);
+  EXPECT_THROW((fjp::ParseToType<Shape, Parser>(
+                   R"({"name": "x", "points": [{"x": "1", "y": 0}]})")),
+               fjp::ParseError);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include <rapidjson/document.h>
+
+#include <userver/formats/json/impl/types.hpp>
+#include <userver/utils/arena.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+// rapidjson allocator that carves the memory out of utils::Arena, the memory
+// is never freed by rapidjson
+class ArenaAllocator final {
+ public:
+  static constexpr bool kNeedFree = false;
+
+  // Required by rapidjson::GenericDocument, never used for allocations
+  ArenaAllocator() noexcept = default;
+
+  explicit ArenaAllocator(utils::Arena& arena) noexcept : arena_(&arena) {}
+
+  void* Malloc(std::size_t size) {
+    if (size == 0) return nullptr;
+    return arena_->Allocate(size, alignof(std::max_align_t));
+  }
+
+  void* Realloc(void* original, std::size_t original_size,
+                std::size_t new_size) {
+    if (original == nullptr) return Malloc(new_size);
+    if (new_size == 0) return nullptr;
+    if (new_size <= original_size) return original;
+
+    void* result = Malloc(new_size);
+    std::memcpy(result, original, original_size);
+    return result;
+  }
+
+  static void Free(void*) noexcept {}
+
+  bool operator==(const ArenaAllocator& other) const noexcept {
+    return arena_ == other.arena_;
+  }
+
+  bool operator!=(const ArenaAllocator& other) const noexcept {
+    return arena_ != other.arena_;
+  }
+
+ private:
+  utils::Arena* arena_{nullptr};
+};
+
+using ArenaValue = ::rapidjson::GenericValue<UTF8, ArenaAllocator>;
+using ArenaDocument =
+    ::rapidjson::GenericDocument<UTF8, ArenaAllocator, ::rapidjson::CrtAllocator>;
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
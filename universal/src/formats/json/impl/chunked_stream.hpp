@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/function_ref.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json::impl {
+
+/// @brief rapidjson input stream that reads the next chunk of input only when
+/// the previous one is fully consumed.
+///
+/// `read_chunk` returns an empty string_view at the end of input, the returned
+/// data must be valid until the next call.
+class ChunkedStream final {
+ public:
+  using Ch = char;
+
+  explicit ChunkedStream(utils::function_ref<std::string_view()> read_chunk)
+      : read_chunk_(read_chunk) {}
+
+  Ch Peek() { return (pos_ < chunk_.size() || Fetch()) ? chunk_[pos_] : '\0'; }
+
+  Ch Take() {
+    if (pos_ >= chunk_.size() && !Fetch()) return '\0';
+    return chunk_[pos_++];
+  }
+
+  std::size_t Tell() const noexcept { return chunk_offset_ + pos_; }
+
+  /// Returns the consumed part of the current chunk starting at `from` offset
+  /// of the whole input or an empty string_view if `from` is in the previous
+  /// chunks
+  std::string_view GetConsumedSince(std::size_t from) const noexcept {
+    if (from < chunk_offset_ || from > Tell()) return {};
+    return chunk_.substr(from - chunk_offset_, Tell() - from);
+  }
+
+  // Write methods are required by the rapidjson stream concept
+  Ch* PutBegin() {
+    UASSERT(false);
+    return nullptr;
+  }
+  void Put(Ch) { UASSERT(false); }
+  void Flush() { UASSERT(false); }
+  std::size_t PutEnd(Ch*) {
+    UASSERT(false);
+    return 0;
+  }
+
+ private:
+  bool Fetch() {
+    if (is_finished_) return false;
+
+    const auto next_chunk = read_chunk_();
+    if (next_chunk.empty()) {
+      // The last chunk is kept for GetConsumedSince()
+      is_finished_ = true;
+      return false;
+    }
+
+    chunk_offset_ += chunk_.size();
+    chunk_ = next_chunk;
+    pos_ = 0;
+    return true;
+  }
+
+  utils::function_ref<std::string_view()> read_chunk_;
+  std::string_view chunk_;
+  std::size_t pos_{0};
+  std::size_t chunk_offset_{0};
+  bool is_finished_{false};
+};
+
+}  // namespace formats::json::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,8 @@
 #include <formats/json/impl/types_impl.hpp>
 
+#include <cstring>
+#include <new>
+
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -15,6 +18,23 @@ VersionedValuePtr::Data::Data(Document&& doc)
       "Both Document and Value must use CrtAllocator for the fast move");
 }
 
+VersionedValuePtr::Data::Data(ArenaValue&& value) : in_arena(true) {
+  static_assert(sizeof(ArenaValue) == sizeof(Value) &&
+                    std::is_trivially_destructible_v<ArenaAllocator>,
+                "rapidjson values with different allocators must have the "
+                "same layout");
+  // rapidjson values do not store the allocator, so the nodes allocated in
+  // the arena are reused as is. ArenaAllocator::kNeedFree is false, the
+  // `value` frees nothing on destruction.
+  std::memcpy(static_cast<void*>(&native), static_cast<const void*>(&value),
+              sizeof(Value));
+}
+
+VersionedValuePtr::Data::~Data() {
+  // the arena frees the memory, the nodes must not be freed via CrtAllocator
+  if (in_arena) new (&native) Value{};
+}
+
 VersionedValuePtr::VersionedValuePtr() noexcept = default;
 
 VersionedValuePtr::VersionedValuePtr(std::shared_ptr<Data>&& data) noexcept
@@ -24,7 +44,11 @@ VersionedValuePtr::~VersionedValuePtr() = default;
 
 VersionedValuePtr::operator bool() const { return !!data_; }
 
-bool VersionedValuePtr::IsUnique() const { return data_.use_count() == 1; }
+bool VersionedValuePtr::IsUnique() const {
+  // values in arena are never moved out, to keep the ValueBuilder from freeing
+  // or reallocating their nodes
+  return data_.use_count() == 1 && !data_->in_arena;
+}
 
 const Value* VersionedValuePtr::Get() const {
   return data_ ? &data_->native : nullptr;
@@ -6,6 +6,8 @@
 
 #include <userver/formats/json/impl/types.hpp>
 
+#include <formats/json/impl/arena_allocator.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace formats::json::impl {
@@ -18,7 +20,10 @@ struct VersionedValuePtr::Data {
   // https://github.com/Tencent/rapidjson/issues/387
   explicit Data(Document&&);
 
-  ~Data() = default;
+  // Takes the value parsed into utils::Arena, the arena owns its memory
+  explicit Data(ArenaValue&&);
+
+  ~Data();
 
   // native rapidjson value
   Value native;
@@ -26,6 +31,10 @@ struct VersionedValuePtr::Data {
   // version of internal rapidjson structures (member arrays)
   // used in ValueBuilder to avoid UAF, ignored in read-only Value
   std::atomic<size_t> version{0};
+
+  // the memory of `native` belongs to utils::Arena and must not be freed or
+  // reused by the ValueBuilder
+  const bool in_arena{false};
 };
 
 template <typename... Args>
@@ -0,0 +1,432 @@
+#include <userver/formats/json/lazy_value.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <formats/json/impl/exttypes.hpp>
+#include <userver/formats/common/path.hpp>
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::json {
+
+namespace impl {
+
+struct LazyDocument final {
+  std::string text;
+  // positions of `{}[]:,` outside of strings
+  std::vector<std::uint32_t> structurals;
+  // for the opening brackets: index of the matching closing bracket in
+  // `structurals`
+  std::vector<std::uint32_t> matches;
+};
+
+}  // namespace impl
+
+namespace {
+
+enum CharClass : std::uint8_t {
+  kOther,
+  kWhitespace,
+  kQuote,
+  kOpen,
+  kClose,
+  kSeparator,
+};
+
+constexpr std::array<CharClass, 256> kCharClasses = [] {
+  std::array<CharClass, 256> classes{};
+  classes[' '] = kWhitespace;
+  classes['\t'] = kWhitespace;
+  classes['\n'] = kWhitespace;
+  classes['\r'] = kWhitespace;
+  classes['"'] = kQuote;
+  classes['{'] = kOpen;
+  classes['['] = kOpen;
+  classes['}'] = kClose;
+  classes[']'] = kClose;
+  classes[':'] = kSeparator;
+  classes[','] = kSeparator;
+  return classes;
+}();
+
+CharClass GetClass(char c) noexcept {
+  return kCharClasses[static_cast<unsigned char>(c)];
+}
+
+[[noreturn]] void ThrowParseError(std::string_view text, std::size_t offset,
+                                  std::string_view message) {
+  throw ParseException(fmt::format("JSON parse error at offset {}: {}",
+                                   std::min(offset, text.size()), message));
+}
+
+// Stage 1: a single pass over the input that finds the structural characters
+// and matches the brackets
+void BuildIndex(impl::LazyDocument& document) {
+  const std::string_view text = document.text;
+  auto& structurals = document.structurals;
+  auto& matches = document.matches;
+
+  std::vector<std::uint32_t> open_brackets;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    switch (GetClass(text[i])) {
+      case kOther:
+      case kWhitespace:
+        break;
+      case kQuote: {
+        const auto string_begin = i;
+        for (++i; i < text.size() && text[i] != '"'; ++i) {
+          if (text[i] == '\\') ++i;
+        }
+        if (i >= text.size()) {
+          ThrowParseError(text, string_begin, "unterminated string");
+        }
+        break;
+      }
+      case kOpen:
+        if (open_brackets.size() >= kDepthParseLimit) {
+          ThrowParseError(text, i,
+                          "exceeded maximum allowed JSON depth of " +
+                              std::to_string(kDepthParseLimit));
+        }
+        open_brackets.push_back(structurals.size());
+        structurals.push_back(i);
+        break;
+      case kClose: {
+        const char expected_open = (text[i] == '}' ? '{' : '[');
+        if (open_brackets.empty() ||
+            text[structurals[open_brackets.back()]] != expected_open) {
+          ThrowParseError(text, i, "unbalanced brackets");
+        }
+        matches.resize(structurals.size() + 1);
+        matches[open_brackets.back()] = structurals.size();
+        open_brackets.pop_back();
+        structurals.push_back(i);
+        break;
+      }
+      case kSeparator:
+        if (open_brackets.empty()) {
+          ThrowParseError(text, i, "unexpected separator");
+        }
+        structurals.push_back(i);
+        break;
+    }
+  }
+
+  if (!open_brackets.empty()) {
+    ThrowParseError(text, text.size(), "unbalanced brackets");
+  }
+  matches.resize(structurals.size());
+}
+
+std::size_t SkipWhitespace(std::string_view text, std::size_t pos) noexcept {
+  while (pos < text.size() && GetClass(text[pos]) == kWhitespace) ++pos;
+  return pos;
+}
+
+std::size_t TrimWhitespace(std::string_view text, std::size_t begin,
+                           std::size_t end) noexcept {
+  while (end > begin && GetClass(text[end - 1]) == kWhitespace) --end;
+  return end;
+}
+
+struct Element final {
+  std::size_t begin;
+  std::size_t end;
+  // the opening bracket of an object or an array
+  std::uint32_t structural;
+  // the separator or the closing bracket after the element
+  std::uint32_t next;
+};
+
+// Locates the element after the structural character `prev`
+Element GetElement(const impl::LazyDocument& document, std::uint32_t prev) {
+  const std::string_view text = document.text;
+  const auto& structurals = document.structurals;
+  UASSERT(prev + 1 < structurals.size());
+
+  const auto begin = SkipWhitespace(text, structurals[prev] + 1);
+  const auto next_pos = structurals[prev + 1];
+  if (begin == next_pos && GetClass(text[begin]) == kOpen) {
+    const auto close = document.matches[prev + 1];
+    const auto end = structurals[close] + 1;
+    if (SkipWhitespace(text, end) != structurals[close + 1]) {
+      ThrowParseError(text, end, "missing separator");
+    }
+    return {begin, end, prev + 1, close + 1};
+  }
+
+  const auto end = TrimWhitespace(text, begin, next_pos);
+  if (begin == end) ThrowParseError(text, begin, "missing value");
+  return {begin, end, 0, prev + 1};
+}
+
+// Calls `func(key_raw, element)` for the members of the object or the
+// elements of the array opened by `open`, `key_raw` is empty for arrays.
+// Stops when `func` returns true.
+template <typename Func>
+void ForEachElement(const impl::LazyDocument& document, std::uint32_t open,
+                    Func&& func) {
+  const std::string_view text = document.text;
+  const auto& structurals = document.structurals;
+  const auto close = document.matches[open];
+  const bool is_object = (text[structurals[open]] == '{');
+
+  if (open + 1 == close &&
+      SkipWhitespace(text, structurals[open] + 1) == structurals[close]) {
+    return;
+  }
+
+  auto prev = open;
+  while (true) {
+    Element element{};
+    if (is_object) {
+      if (prev + 1 >= close || text[structurals[prev + 1]] != ':') {
+        ThrowParseError(text, structurals[prev] + 1, "missing name separator");
+      }
+      const auto key_begin = SkipWhitespace(text, structurals[prev] + 1);
+      const auto key_end =
+          TrimWhitespace(text, key_begin, structurals[prev + 1]);
+      if (key_end - key_begin < 2 || text[key_begin] != '"' ||
+          text[key_end - 1] != '"') {
+        ThrowParseError(text, key_begin, "invalid object key");
+      }
+      element = GetElement(document, prev + 1);
+      if (func(text.substr(key_begin, key_end - key_begin), element)) return;
+    } else {
+      element = GetElement(document, prev);
+      if (func(std::string_view{}, element)) return;
+    }
+
+    if (element.next == close) return;
+    if (text[structurals[element.next]] != ',') {
+      ThrowParseError(text, structurals[element.next], "missing separator");
+    }
+    prev = element.next;
+  }
+}
+
+bool KeyEquals(std::string_view key_raw, std::string_view key) {
+  const auto unquoted = key_raw.substr(1, key_raw.size() - 2);
+  if (unquoted.find('\\') == std::string_view::npos) return unquoted == key;
+  return FromString(key_raw).As<std::string>() == key;
+}
+
+int GetExtendedType(std::string_view raw) {
+  switch (raw.front()) {
+    case '{':
+      return impl::objectValue;
+    case '[':
+      return impl::arrayValue;
+    case '"':
+      return impl::stringValue;
+    case 't':
+    case 'f':
+      return impl::booleanValue;
+    case 'n':
+      return impl::nullValue;
+    default:
+      return impl::realValue;
+  }
+}
+
+}  // namespace
+
+LazyValue::LazyValue() noexcept = default;
+
+LazyValue::LazyValue(const LazyValue&) = default;
+
+LazyValue::LazyValue(LazyValue&&) noexcept = default;
+
+LazyValue& LazyValue::operator=(const LazyValue&) = default;
+
+LazyValue& LazyValue::operator=(LazyValue&&) noexcept = default;
+
+LazyValue::~LazyValue() = default;
+
+LazyValue::LazyValue(std::shared_ptr<const impl::LazyDocument> document,
+                     std::size_t begin, std::size_t end,
+                     std::uint32_t structural, std::string path)
+    : document_(std::move(document)),
+      begin_(begin),
+      end_(end),
+      structural_(structural),
+      path_(std::move(path)) {}
+
+LazyValue LazyValue::operator[](std::string_view key) const {
+  if (IsMissing() || IsNull()) {
+    return MakeMissing(common::MakeChildPath(GetPath(), key));
+  }
+  if (!IsObject()) {
+    throw TypeMismatchException(GetExtendedType(GetRawJson()),
+                                impl::objectValue, GetPath());
+  }
+
+  LazyValue result = MakeMissing(common::MakeChildPath(path_, key));
+  ForEachElement(*document_, structural_,
+                 [&](std::string_view key_raw, const Element& element) {
+                   if (!KeyEquals(key_raw, key)) return false;
+                   result.begin_ = element.begin;
+                   result.end_ = element.end;
+                   result.structural_ = element.structural;
+                   return true;
+                 });
+  return result;
+}
+
+LazyValue LazyValue::operator[](std::size_t index) const {
+  CheckNotMissing();
+  if (!IsArray()) {
+    throw TypeMismatchException(GetExtendedType(GetRawJson()),
+                                impl::arrayValue, GetPath());
+  }
+
+  std::size_t current = 0;
+  LazyValue result = MakeMissing(common::MakeChildPath(path_, index));
+  ForEachElement(*document_, structural_,
+                 [&](std::string_view, const Element& element) {
+                   if (current++ != index) return false;
+                   result.begin_ = element.begin;
+                   result.end_ = element.end;
+                   result.structural_ = element.structural;
+                   return true;
+                 });
+
+  if (result.IsMissing()) {
+    throw OutOfBoundsException(index, current, GetPath());
+  }
+  return result;
+}
+
+bool LazyValue::IsEmpty() const { return GetSize() == 0; }
+
+std::size_t LazyValue::GetSize() const {
+  CheckContainer();
+  if (IsNull()) return 0;
+
+  std::size_t size = 0;
+  ForEachElement(*document_, structural_,
+                 [&size](std::string_view, const Element&) {
+                   ++size;
+                   return false;
+                 });
+  return size;
+}
+
+bool LazyValue::IsMissing() const noexcept { return begin_ == end_; }
+
+bool LazyValue::IsNull() const noexcept {
+  return !IsMissing() && GetFirstChar() == 'n';
+}
+
+bool LazyValue::IsBool() const noexcept {
+  const auto c = GetFirstChar();
+  return !IsMissing() && (c == 't' || c == 'f');
+}
+
+bool LazyValue::IsNumber() const noexcept {
+  const auto c = GetFirstChar();
+  return !IsMissing() && (c == '-' || (c >= '0' && c <= '9'));
+}
+
+bool LazyValue::IsString() const noexcept {
+  return !IsMissing() && GetFirstChar() == '"';
+}
+
+bool LazyValue::IsArray() const noexcept {
+  return !IsMissing() && GetFirstChar() == '[';
+}
+
+bool LazyValue::IsObject() const noexcept {
+  return !IsMissing() && GetFirstChar() == '{';
+}
+
+bool LazyValue::HasMember(std::string_view key) const {
+  if (!IsMissing() && !IsNull() && !IsObject()) {
+    throw TypeMismatchException(GetExtendedType(GetRawJson()),
+                                impl::objectValue, GetPath());
+  }
+  return !(*this)[key].IsMissing();
+}
+
+std::string_view LazyValue::GetRawJson() const {
+  CheckNotMissing();
+  return std::string_view{document_->text}.substr(begin_, end_ - begin_);
+}
+
+std::string LazyValue::GetPath() const {
+  return path_.empty() ? std::string{common::kPathRoot} : path_;
+}
+
+Value LazyValue::Parse() const { return FromString(GetRawJson()); }
+
+void LazyValue::CheckNotMissing() const {
+  if (IsMissing()) {
+    throw MemberMissingException(GetPath());
+  }
+}
+
+LazyValue LazyValue::MakeMissing(std::string path) const {
+  return LazyValue{document_, 0, 0, 0, std::move(path)};
+}
+
+char LazyValue::GetFirstChar() const noexcept {
+  return IsMissing() ? '\0' : document_->text[begin_];
+}
+
+void LazyValue::CheckContainer() const {
+  CheckNotMissing();
+  if (!IsNull() && !IsArray() && !IsObject()) {
+    throw TypeMismatchException(GetExtendedType(GetRawJson()),
+                                impl::arrayValue, GetPath());
+  }
+}
+
+LazyValue FromStringLazy(std::string_view doc) {
+  if (doc.empty()) {
+    throw ParseException("JSON document is empty");
+  }
+  if (doc.size() >= std::numeric_limits<std::uint32_t>::max()) {
+    throw ParseException("JSON document is too big for the lazy parsing");
+  }
+
+  auto document = std::make_shared<impl::LazyDocument>();
+  document->text = std::string{doc};
+  BuildIndex(*document);
+
+  const std::string_view text = document->text;
+  const auto begin = SkipWhitespace(text, 0);
+  if (begin == text.size()) {
+    throw ParseException("JSON document is empty");
+  }
+
+  std::size_t end = 0;
+  std::uint32_t structural = 0;
+  if (document->structurals.empty()) {
+    end = TrimWhitespace(text, begin, text.size());
+  } else {
+    const auto close = document->matches[0];
+    if (document->structurals[0] != begin || GetClass(text[begin]) != kOpen ||
+        close + 1 != document->structurals.size()) {
+      ThrowParseError(text, begin, "unexpected structural characters");
+    }
+    end = document->structurals[close] + 1;
+    if (SkipWhitespace(text, end) != text.size()) {
+      ThrowParseError(text, end, "unexpected characters after the root value");
+    }
+  }
+
+  return LazyValue{std::move(document), begin, end, structural,
+                   std::string{common::kPathRoot}};
+}
+
+}  // namespace formats::json
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kDoc = R"({
+  "key1": 1,
+  "key2": "val",
+  "key3": {"sub": -1, "arr": [1, [2, {"x": "]}"}], null]},
+  "key4": [1, 2, 3],
+  "key\"5": true,
+  "key6": {},
+  "key7": [ ],
+  "key8": null
+})";
+
+}  // namespace
+
+TEST(FormatsJsonLazy, Sample) {
+  /// [Sample formats::json::LazyValue usage]
+  // Only the structure of the document is indexed here
+  const auto json = formats::json::FromStringLazy(R"({
+    "big": [1, 2, 3],
+    "value": {"id": 42}
+  })");
+
+  // Only the accessed value is parsed
+  EXPECT_EQ(json["value"]["id"].As<int>(), 42);
+  EXPECT_EQ(json["missing"].As<int>(0), 0);
+  /// [Sample formats::json::LazyValue usage]
+}
+
+TEST(FormatsJsonLazy, MemberAccess) {
+  const auto json = formats::json::FromStringLazy(kDoc);
+  EXPECT_TRUE(json.IsObject());
+  EXPECT_EQ(json.GetSize(), 8);
+
+  EXPECT_EQ(json["key1"].As<int>(), 1);
+  EXPECT_TRUE(json["key1"].IsNumber());
+  EXPECT_EQ(json["key2"].As<std::string>(), "val");
+  EXPECT_TRUE(json["key2"].IsString());
+  EXPECT_EQ(json["key3"]["sub"].As<int>(), -1);
+  EXPECT_EQ(json["key3"]["arr"][1][1]["x"].As<std::string>(), "]}");
+  EXPECT_TRUE(json["key3"]["arr"][2].IsNull());
+  EXPECT_EQ(json["key3"]["arr"].GetSize(), 3);
+  EXPECT_EQ(json["key4"].As<std::vector<int>>(), (std::vector<int>{1, 2, 3}));
+  EXPECT_TRUE(json["key\"5"].As<bool>());
+  EXPECT_TRUE(json["key\"5"].IsBool());
+  EXPECT_TRUE(json["key6"].IsEmpty());
+  EXPECT_TRUE(json["key7"].IsArray());
+  EXPECT_TRUE(json["key7"].IsEmpty());
+  EXPECT_TRUE(json["key8"].IsNull());
+
+  EXPECT_EQ(json["key3"]["arr"][1].GetRawJson(), R"([2, {"x": "]}"}])");
+  EXPECT_EQ(json["key3"]["arr"][1].GetPath(), "key3.arr[1]");
+  EXPECT_EQ(json["key3"].Parse(),
+            formats::json::FromString(kDoc)["key3"].Clone());
+}
+
+TEST(FormatsJsonLazy, Missing) {
+  const auto json = formats::json::FromStringLazy(kDoc);
+
+  EXPECT_TRUE(json["nope"].IsMissing());
+  EXPECT_TRUE(json["nope"]["deeper"].IsMissing());
+  EXPECT_TRUE(json["key8"]["deeper"].IsMissing());
+  EXPECT_FALSE(json.HasMember("nope"));
+  EXPECT_TRUE(json.HasMember("key6"));
+  EXPECT_EQ(json["nope"]["deeper"].GetPath(), "nope.deeper");
+  EXPECT_EQ(json["nope"].As<int>(42), 42);
+  EXPECT_TRUE(formats::json::LazyValue{}.IsMissing());
+
+  EXPECT_THROW(json["nope"].As<int>(), formats::json::MemberMissingException);
+  EXPECT_THROW(json["key4"][3], formats::json::OutOfBoundsException);
+  EXPECT_THROW(json["key1"]["sub"], formats::json::TypeMismatchException);
+  EXPECT_THROW(json["key3"][0], formats::json::TypeMismatchException);
+  EXPECT_THROW(json["key2"].As<int>(), formats::json::TypeMismatchException);
+}
+
+TEST(FormatsJsonLazy, Scalars) {
+  EXPECT_EQ(formats::json::FromStringLazy(" 42 ").As<int>(), 42);
+  EXPECT_EQ(formats::json::FromStringLazy(R"("a,b")").As<std::string>(),
+            "a,b");
+  EXPECT_TRUE(formats::json::FromStringLazy("null").IsNull());
+}
+
+TEST(FormatsJsonLazy, Invalid) {
+  using formats::json::FromStringLazy;
+  using formats::json::ParseException;
+
+  EXPECT_THROW(FromStringLazy(""), ParseException);
+  EXPECT_THROW(FromStringLazy("  "), ParseException);
+  EXPECT_THROW(FromStringLazy("{"), ParseException);
+  EXPECT_THROW(FromStringLazy("[}"), ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"a": "b})"), ParseException);
+  EXPECT_THROW(FromStringLazy("{} {}"), ParseException);
+  EXPECT_THROW(FromStringLazy("1, 2"), ParseException);
+
+  EXPECT_THROW(FromStringLazy("[1,]").GetSize(), ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"a" 1})")["a"], ParseException);
+  EXPECT_THROW(FromStringLazy(R"({"a": [] 1})")["b"], ParseException);
+  EXPECT_THROW(FromStringLazy("[tru]")[0].As<bool>(), ParseException);
+}
+
+USERVER_NAMESPACE_END
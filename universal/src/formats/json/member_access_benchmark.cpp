@@ -3,6 +3,7 @@
 #include <benchmark/benchmark.h>
 
 #include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/lazy_value.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 
@@ -102,6 +103,47 @@ void json_path_long_and_deeply_nested(benchmark::State& state) {
 }
 BENCHMARK(json_path_long_and_deeply_nested);
 
+void json_lazy_path_short(benchmark::State& state) {
+  const auto json = formats::json::FromStringLazy(bench_json_data);
+
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = (json["short"].As<std::string>() == "1");
+    benchmark::DoNotOptimize(res);
+    if (!res) throw std::runtime_error("unexpected");
+  }
+}
+BENCHMARK(json_lazy_path_short);
+
+void json_lazy_path_long_and_deeply_nested(benchmark::State& state) {
+  const auto json = formats::json::FromStringLazy(bench_json_data);
+
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res =
+        (json["nested_long_long_long_long_path"]["deeply"]["deeply"]["nested"]
+             ["json"]["value"]["with"]["some"]["data"]
+                 .As<std::string>() == "4");
+    benchmark::DoNotOptimize(res);
+    if (!res) throw std::runtime_error("unexpected");
+  }
+}
+BENCHMARK(json_lazy_path_long_and_deeply_nested);
+
+void json_parse_and_path_short(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::FromString(bench_json_data);
+    benchmark::DoNotOptimize(json["short"].As<std::string>());
+  }
+}
+BENCHMARK(json_parse_and_path_short);
+
+void json_lazy_parse_and_path_short(benchmark::State& state) {
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::FromStringLazy(bench_json_data);
+    benchmark::DoNotOptimize(json["short"].As<std::string>());
+  }
+}
+BENCHMARK(json_lazy_parse_and_path_short);
+
 formats::json::ValueBuilder Build(size_t count) {
   formats::json::ValueBuilder builder;
   for (size_t i = 0; i < count; i++) builder[std::to_string(i)] = i;
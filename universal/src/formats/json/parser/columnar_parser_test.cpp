@@ -0,0 +1,111 @@
+#include <userver/formats/json/parser/columnar_parser.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+/// [Sample columnar parsing]
+namespace sample {
+
+struct Measurements {
+  std::vector<std::string> sensor;
+  std::vector<std::int64_t> timestamp;
+  std::vector<double> value;
+  std::vector<std::optional<std::string>> unit;
+};
+
+}  // namespace sample
+
+template <>
+struct formats::common::ReflectedAggregate<sample::Measurements> {
+  static constexpr std::string_view kFieldNames[] = {"sensor", "timestamp",
+                                                     "value", "unit"};
+};
+
+TEST(ColumnarParser, Sample) {
+  namespace fjp = formats::json::parser;
+
+  using Parser = fjp::ColumnarParser<sample::Measurements>;
+  const auto columns = fjp::ParseToType<sample::Measurements, Parser>(R"([
+    {"sensor": "a", "timestamp": 1, "value": 0.5, "unit": "C"},
+    {"value": 2, "timestamp": 2, "sensor": "b", "extra": {"skipped": []}}
+  ])");
+
+  EXPECT_EQ(columns.sensor, (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(columns.timestamp, (std::vector<std::int64_t>{1, 2}));
+  EXPECT_EQ(columns.value, (std::vector<double>{0.5, 2}));
+  EXPECT_EQ(columns.unit,
+            (std::vector<std::optional<std::string>>{"C", std::nullopt}));
+}
+/// [Sample columnar parsing]
+
+TEST(ColumnarParser, Empty) {
+  namespace fjp = formats::json::parser;
+  using Parser = fjp::ColumnarParser<sample::Measurements>;
+
+  const auto columns = fjp::ParseToType<sample::Measurements, Parser>("[]");
+  EXPECT_TRUE(columns.sensor.empty());
+  EXPECT_TRUE(columns.unit.empty());
+}
+
+TEST(ColumnarParser, Chunked) {
+  namespace fjp = formats::json::parser;
+  using Parser = fjp::ColumnarParser<sample::Measurements>;
+
+  std::string input = "[";
+  for (int i = 0; i < 1000; ++i) {
+    if (i != 0) input += ',';
+    input += R"({"sensor": "s", "timestamp": )" + std::to_string(i) +
+             R"(, "value": 1.5})";
+  }
+  input += ']';
+
+  std::string_view rest = input;
+  const auto columns = fjp::ParseChunkedToType<sample::Measurements, Parser>(
+      [&rest]() -> std::string_view {
+        const auto chunk = rest.substr(0, 7);
+        rest.remove_prefix(chunk.size());
+        return chunk;
+      });
+
+  ASSERT_EQ(columns.timestamp.size(), 1000);
+  EXPECT_EQ(columns.timestamp.back(), 999);
+  EXPECT_EQ(columns.sensor.size(), 1000);
+  EXPECT_EQ(columns.value.size(), 1000);
+  EXPECT_EQ(columns.unit.size(), 1000);
+}
+
+TEST(ColumnarParser, Errors) {
+  namespace fjp = formats::json::parser;
+  using Parser = fjp::ColumnarParser<sample::Measurements>;
+
+  EXPECT_THROW((fjp::ParseToType<sample::Measurements, Parser>("{}")),
+               fjp::ParseError);
+  EXPECT_THROW((fjp::ParseToType<sample::Measurements, Parser>("[1]")),
+               fjp::ParseError);
+  // missing required field
+  EXPECT_THROW((fjp::ParseToType<sample::Measurements, Parser>(
+                   R"([{"sensor": "a", "value": 1}])")),
+               fjp::ParseError);
+  // duplicate field would misalign the columns
+  EXPECT_THROW(
+      (fjp::ParseToType<sample::Measurements, Parser>(
+          R"([{"sensor": "a", "sensor": "b", "timestamp": 1, "value": 1}])")),
+      fjp::ParseError);
+
+  try {
+    fjp::ParseToType<sample::Measurements, Parser>(
+        R"([{"sensor": "a", "timestamp": 1, "value": 1},
+            {"sensor": "a", "timestamp": "1", "value": 1}])");
+    FAIL() << "ParseError expected";
+  } catch (const fjp::ParseError& e) {
+    EXPECT_NE(std::string{e.what()}.find("1.timestamp"), std::string::npos)
+        << e.what();
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -3,11 +3,15 @@
 #include <fmt/format.h>
 
 #include <userver/formats/json/inline.hpp>
+#include <userver/formats/json/lazy_value.hpp>
+#include <userver/formats/json/parser/aggregate_parser.hpp>
+#include <userver/formats/json/parser/columnar_parser.hpp>
 #include <userver/formats/json/parser/parser.hpp>
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/formats/serialize/common_containers.hpp>
+#include <userver/utils/arena.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -90,6 +94,16 @@ void JsonParseValueDom(benchmark::State& state) {
 }
 BENCHMARK(JsonParseValueDom)->RangeMultiplier(2)->Range(1, 16);
 
+void JsonParseValueArena(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    utils::Arena arena;
+    const auto res = formats::json::FromStringInArena(input, arena);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseValueArena)->RangeMultiplier(2)->Range(1, 16);
+
 void JsonParseValueSax(benchmark::State& state) {
   const auto input = BuildObject(state.range(0));
   for ([[maybe_unused]] auto _ : state) {
@@ -100,6 +114,37 @@ void JsonParseValueSax(benchmark::State& state) {
 }
 BENCHMARK(JsonParseValueSax)->RangeMultiplier(2)->Range(1, 16);
 
+void JsonParseValueLazy(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto res = formats::json::FromStringLazy(input);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseValueLazy)->RangeMultiplier(2)->Range(1, 16);
+
+void JsonParseFewFieldsDom(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::FromString(input);
+    const auto res = json["three"].As<std::string>() +
+                     json["two"]["three"].As<std::string>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseFewFieldsDom)->RangeMultiplier(2)->Range(1, 16);
+
+void JsonParseFewFieldsLazy(benchmark::State& state) {
+  const auto input = BuildObject(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::FromStringLazy(input);
+    const auto res = json["three"].As<std::string>() +
+                     json["two"]["three"].As<std::string>();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(JsonParseFewFieldsLazy)->RangeMultiplier(2)->Range(1, 16);
+
 namespace {
 
 struct SomeValue final {
@@ -218,4 +263,78 @@ BENCHMARK(JsonParseValueDomLotsOfMissingKeys)
 
 }  // namespace
 
+namespace {
+
+struct Measurement {
+  std::string sensor;
+  std::int64_t timestamp;
+  double value;
+};
+
+struct Measurements {
+  std::vector<std::string> sensor;
+  std::vector<std::int64_t> timestamp;
+  std::vector<double> value;
+};
+
+}  // namespace
+
+template <>
+struct formats::common::ReflectedAggregate<Measurement> {
+  static constexpr std::string_view kFieldNames[] = {"sensor", "timestamp",
+                                                     "value"};
+};
+
+template <>
+struct formats::common::ReflectedAggregate<Measurements>
+    : formats::common::ReflectedAggregate<Measurement> {};
+
+namespace {
+
+std::string BuildMeasurements(std::size_t count) {
+  std::string result = "[";
+  for (std::size_t i = 0; i < count; ++i) {
+    if (i != 0) result += ',';
+    result += fmt::format(
+        R"({{"sensor":"sensor-{}","timestamp":{},"value":{}.5}})", i % 16,
+        1600000000 + i, i);
+  }
+  result += ']';
+  return result;
+}
+
+void JsonParseRowsSax(benchmark::State& state) {
+  namespace fjp = formats::json::parser;
+  using RowParser = fjp::AggregateParser<Measurement>;
+  const auto input = BuildMeasurements(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    RowParser row_parser;
+    fjp::ArrayParser<Measurement, RowParser> parser(row_parser);
+    parser.Reset();
+
+    fjp::ParserState parser_state;
+    parser_state.PushParser(parser);
+    parser_state.ProcessInput(input);
+  }
+}
+BENCHMARK(JsonParseRowsSax)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+void JsonParseColumnsSax(benchmark::State& state) {
+  namespace fjp = formats::json::parser;
+  const auto input = BuildMeasurements(state.range(0));
+
+  for ([[maybe_unused]] auto _ : state) {
+    fjp::ColumnarParser<Measurements> parser;
+    parser.Reset();
+
+    fjp::ParserState parser_state;
+    parser_state.PushParser(parser);
+    parser_state.ProcessInput(input);
+  }
+}
+BENCHMARK(JsonParseColumnsSax)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+}  // namespace
+
 USERVER_NAMESPACE_END
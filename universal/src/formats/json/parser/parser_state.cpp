@@ -9,6 +9,8 @@
 #include <rapidjson/error/en.h>
 #include <rapidjson/reader.h>
 
+#include <formats/json/impl/chunked_stream.hpp>
+
 #include <userver/formats/common/path.hpp>
 #include <userver/formats/json/parser/base_parser.hpp>
 #include <userver/formats/json/parser/parser_handler.hpp>
@@ -20,6 +22,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace formats::json::parser {
 
+namespace impl = formats::json::impl;
+
 namespace {
 
 std::string ToLimited(std::string_view sw) {
@@ -42,6 +46,10 @@ struct ParserState::Impl {
   void PushParser(BaseParser& parser, ParserState& parser_state);
 
   [[nodiscard]] std::string GetPath() const;
+
+  // `get_token(from, to)` returns the input between the offsets if available
+  template <typename Stream, typename TokenGetter>
+  void ProcessStream(Stream& is, const TokenGetter& get_token);
 };
 
 void ParserState::Impl::PushParser(BaseParser& parser,
@@ -66,21 +74,12 @@ std::string ParserState::Impl::GetPath() const {
   return result;
 }
 
-ParserState::ParserState() = default;
-
-ParserState::~ParserState() = default;
-
-void ParserState::PushParser(BaseParser& parser) {
-  impl_->PushParser(parser, *this);
-}
-
-void ParserState::ProcessInput(std::string_view sw) {
+template <typename Stream, typename TokenGetter>
+void ParserState::Impl::ProcessStream(Stream& is,
+                                      const TokenGetter& get_token) {
   rapidjson::Reader reader;
-  rapidjson::MemoryStream is(sw.data(), sw.size());
   reader.IterativeParseInit();
 
-  auto& stack = impl_->stack;
-
   size_t pos = 0;
   try {
     while (!reader.IterativeParseComplete()) {
@@ -101,7 +100,7 @@ void ParserState::ProcessInput(std::string_view sw) {
       if (reader.HasParseError()) {
         throw ParseError{
             reader.GetErrorOffset(),
-            impl_->GetPath(),
+            GetPath(),
             rapidjson::GetParseError_En(reader.GetParseErrorCode()),
         };
       }
@@ -110,13 +109,14 @@ void ParserState::ProcessInput(std::string_view sw) {
     throw;
   } catch (const std::exception& e) {
     auto cur_pos = is.Tell();
-    auto msg = (cur_pos == pos)
-                   ? ""
-                   : fmt::format(", the latest token was {}",
-                                 ToLimited(sw.substr(pos, cur_pos - pos)));
+    const auto token = (cur_pos == pos) ? std::string_view{}
+                                        : get_token(pos, cur_pos);
+    auto msg = token.empty() ? ""
+                             : fmt::format(", the latest token was {}",
+                                           ToLimited(token));
     throw ParseError{
         cur_pos,
-        impl_->GetPath(),
+        GetPath(),
         e.what() + msg,
     };
   }
@@ -126,6 +126,29 @@ void ParserState::ProcessInput(std::string_view sw) {
   }
 }
 
+ParserState::ParserState() = default;
+
+ParserState::~ParserState() = default;
+
+void ParserState::PushParser(BaseParser& parser) {
+  impl_->PushParser(parser, *this);
+}
+
+void ParserState::ProcessInput(std::string_view sw) {
+  rapidjson::MemoryStream is(sw.data(), sw.size());
+  impl_->ProcessStream(is, [sw](std::size_t from, std::size_t to) {
+    return sw.substr(from, to - from);
+  });
+}
+
+void ParserState::ProcessChunkedInput(
+    utils::function_ref<std::string_view()> read_chunk) {
+  impl::ChunkedStream is{read_chunk};
+  impl_->ProcessStream(is, [&is](std::size_t from, std::size_t /*to*/) {
+    return is.GetConsumedSince(from);
+  });
+}
+
 BaseParser& ParserState::GetTopParser() const {
   UASSERT(!impl_->stack.empty());
   return *impl_->stack.back().parser;
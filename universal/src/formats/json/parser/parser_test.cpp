@@ -21,6 +21,27 @@
 USERVER_NAMESPACE_BEGIN
 namespace fjp = formats::json::parser;
 
+namespace {
+
+// Returns the input by the chunks of `chunk_size` characters
+class ChunkReader final {
+ public:
+  ChunkReader(std::string_view input, std::size_t chunk_size)
+      : input_(input), chunk_size_(chunk_size) {}
+
+  std::string_view operator()() {
+    const auto chunk = input_.substr(0, chunk_size_);
+    input_.remove_prefix(chunk.size());
+    return chunk;
+  }
+
+ private:
+  std::string_view input_;
+  const std::size_t chunk_size_;
+};
+
+}  // namespace
+
 TEST(JsonStringParser, Int64) {
   std::string input{"12345"};
 
@@ -401,6 +422,37 @@ TEST(JsonStringParser, JsonValueBad) {
   }
 }
 
+TEST(JsonStringParser, ChunkedInput) {
+  const std::string input =
+      R"({"key": [1, -2.5, "some long string"], "other": {"x": null}})";
+  const auto expected = formats::json::FromString(input);
+
+  for (const std::size_t chunk_size : {1, 2, 7, 1000}) {
+    ChunkReader reader{input, chunk_size};
+    EXPECT_EQ((fjp::ParseChunkedToType<formats::json::Value,
+                                       fjp::JsonValueParser>(reader)),
+              expected)
+        << "chunk_size=" << chunk_size;
+  }
+
+  ChunkReader truncated{R"({"key": [1, 2)", 3};
+  EXPECT_THROW((fjp::ParseChunkedToType<formats::json::Value,
+                                        fjp::JsonValueParser>(truncated)),
+               fjp::ParseError);
+
+  // The latest token is reported only if it is in the current chunk
+  ChunkReader whole{"3.01", 1000};
+  EXPECT_THROW_TEXT((fjp::ParseChunkedToType<int, fjp::IntParser>(whole)),
+                    fjp::ParseError,
+                    "Parse error at pos 4, path '': integer was expected, but "
+                    "double found, the latest token was 3.01");
+  ChunkReader split{"3.01", 1};
+  EXPECT_THROW_TEXT((fjp::ParseChunkedToType<int, fjp::IntParser>(split)),
+                    fjp::ParseError,
+                    "Parse error at pos 4, path '': integer was expected, but "
+                    "double found");
+}
+
 TEST(JsonStringParser, BomSymbol) {
   std::string input =
       "{\r\n\"track_id\": \"0000436301831\",\r\n\"service\": "
@@ -16,6 +16,8 @@
 #include <rapidjson/writer.h>
 
 #include <formats/json/impl/accept.hpp>
+#include <formats/json/impl/arena_allocator.hpp>
+#include <formats/json/impl/chunked_stream.hpp>
 #include <formats/json/impl/json_tree.hpp>
 #include <formats/json/impl/types_impl.hpp>
 #include <userver/formats/json/exception.hpp>
@@ -101,6 +103,20 @@ impl::VersionedValuePtr EnsureValid(impl::Document&& json) {
   return impl::VersionedValuePtr::Create(std::move(json));
 }
 
+[[noreturn]] void ThrowParseError(std::string_view doc,
+                                  rapidjson::ParseResult ok) {
+  const auto offset = ok.Offset();
+  const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
+  // Some versions of libstdc++ have runtime issues in
+  // string_view::find_last_of("\n", 0, offset) implementation.
+  const auto from_pos = doc.substr(0, offset).find_last_of('\n');
+  const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+
+  throw ParseException(
+      fmt::format("JSON parse error at line {} column {}: {}", line, column,
+                  rapidjson::GetParseError_En(ok.Code())));
+}
+
 }  // namespace
 
 Value FromString(std::string_view doc) {
@@ -113,20 +129,28 @@ Value FromString(std::string_view doc) {
       json.Parse<rapidjson::kParseDefaultFlags |
                  rapidjson::kParseIterativeFlag |
                  rapidjson::kParseFullPrecisionFlag>(doc.data(), doc.size());
-  if (!ok) {
-    const auto offset = ok.Offset();
-    const auto line = 1 + std::count(doc.begin(), doc.begin() + offset, '\n');
-    // Some versions of libstdc++ have runtime issues in
-    // string_view::find_last_of("\n", 0, offset) implementation.
-    const auto from_pos = doc.substr(0, offset).find_last_of('\n');
-    const auto column = offset > from_pos ? offset - from_pos : offset + 1;
+  if (!ok) ThrowParseError(doc, ok);
 
-    throw ParseException(
-        fmt::format("JSON parse error at line {} column {}: {}", line, column,
-                    rapidjson::GetParseError_En(ok.Code())));
+  return Value{EnsureValid(std::move(json))};
+}
+
+Value FromStringInArena(std::string_view doc, utils::Arena& arena) {
+  if (doc.empty()) {
+    throw ParseException("JSON document is empty");
   }
 
-  return Value{EnsureValid(std::move(json))};
+  impl::ArenaAllocator allocator{arena};
+  impl::ArenaDocument json{&allocator};
+  rapidjson::ParseResult ok =
+      json.Parse<rapidjson::kParseDefaultFlags |
+                 rapidjson::kParseIterativeFlag |
+                 rapidjson::kParseFullPrecisionFlag>(doc.data(), doc.size());
+  if (!ok) ThrowParseError(doc, ok);
+
+  auto root = impl::VersionedValuePtr::Create(
+      static_cast<impl::ArenaValue&&>(json));
+  CheckKeyUniqueness(root.Get());
+  return Value{std::move(root)};
 }
 
 Value FromStream(std::istream& is) {
@@ -149,6 +173,22 @@ Value FromStream(std::istream& is) {
   return Value{EnsureValid(std::move(json))};
 }
 
+Value FromChunks(utils::function_ref<std::string_view()> read_chunk) {
+  impl::ChunkedStream in{read_chunk};
+  impl::Document json{&g_allocator};
+  rapidjson::ParseResult ok =
+      json.ParseStream<rapidjson::kParseDefaultFlags |
+                       rapidjson::kParseIterativeFlag |
+                       rapidjson::kParseFullPrecisionFlag>(in);
+  if (!ok) {
+    throw ParseException(fmt::format("JSON parse error at offset {}: {}",
+                                     ok.Offset(),
+                                     rapidjson::GetParseError_En(ok.Code())));
+  }
+
+  return Value{EnsureValid(std::move(json))};
+}
+
 void Serialize(const Value& doc, std::ostream& os) {
   rapidjson::OStreamWrapper out{os};
   rapidjson::Writer writer(out);
@@ -1,17 +1,23 @@
+#include <cstdint>
+#include <map>
+#include <optional>
 #include <string_view>
 #include <variant>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include <rapidjson/document.h>
 
 #include <userver/formats/json/impl/types.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/parse/common_containers.hpp>
 #include <userver/formats/parse/variant.hpp>
 #include <userver/formats/serialize/common_containers.hpp>
 #include <userver/formats/serialize/variant.hpp>
+#include <userver/utils/text_light.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -1259,6 +1265,156 @@ void JsonArrayToVariantParseBenchmark(benchmark::State& state) {
 }
 BENCHMARK(JsonArrayToVariantParseBenchmark)->Range(16, 4096);
 
+
+namespace {
+
+struct Item final {
+  std::string name;
+  std::int64_t id{};
+  std::optional<double> price;
+  std::vector<std::string> tags;
+  std::map<std::string, int> counters;
+};
+
+formats::json::Value Serialize(const Item& value,
+                               formats::serialize::To<formats::json::Value>) {
+  formats::json::ValueBuilder builder{formats::json::Type::kObject};
+  builder["name"] = value.name;
+  builder["id"] = value.id;
+  builder["price"] = value.price;
+  builder["tags"] = value.tags;
+  builder["counters"] = value.counters;
+  return builder.ExtractValue();
+}
+
+void WriteToStream(const Item& value, formats::json::StringBuilder& sw) {
+  formats::json::StringBuilder::ObjectGuard guard{sw};
+  sw.Key("name");
+  WriteToStream(value.name, sw);
+  sw.Key("id");
+  WriteToStream(value.id, sw);
+  sw.Key("price");
+  WriteToStream(value.price, sw);
+  sw.Key("tags");
+  WriteToStream(value.tags, sw);
+  sw.Key("counters");
+  WriteToStream(value.counters, sw);
+}
+
+std::vector<Item> GenerateItems(std::size_t size) {
+  std::vector<Item> items(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    auto& item = items[i];
+    item.name = "item-" + std::to_string(i);
+    item.id = i;
+    if (i % 2) item.price = i * 1.5;
+    item.tags = {"some", "tags"};
+    item.counters = {{"views", 10}, {"likes", 2}};
+  }
+  return items;
+}
+
+}  // namespace
+
+void JsonSerializeStructsDom(benchmark::State& state) {
+  const auto items = GenerateItems(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    const auto json = formats::json::ValueBuilder{items}.ExtractValue();
+    benchmark::DoNotOptimize(formats::json::ToString(json));
+  }
+}
+BENCHMARK(JsonSerializeStructsDom)->RangeMultiplier(4)->Range(1, 4096);
+
+void JsonSerializeStructsStringBuilder(benchmark::State& state) {
+  const auto items = GenerateItems(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::StringBuilder sb;
+    WriteToStream(items, sb);
+    benchmark::DoNotOptimize(sb.GetString());
+  }
+}
+BENCHMARK(JsonSerializeStructsStringBuilder)
+    ->RangeMultiplier(4)
+    ->Range(1, 4096);
+
+enum class TextKind { kAscii, kCjk, kEmoji };
+
+// A text field of `size` bytes with an escaped character in every line
+std::string MakeText(TextKind kind, std::size_t size) {
+  std::string_view word;
+  switch (kind) {
+    case TextKind::kAscii:
+      word = "lorem ipsum ";
+      break;
+    case TextKind::kCjk:
+      word = "\u6f22\u5b57\u304b\u306a ";
+      break;
+    case TextKind::kEmoji:
+      word = "\U0001F600\U0001F680 ";
+      break;
+  }
+
+  std::string result;
+  while (result.size() < size) {
+    result += word;
+    if (result.size() % 128 < word.size()) result += "\"quoted\"\n";
+  }
+  return result;
+}
+
+void TextArguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto kind : {TextKind::kAscii, TextKind::kCjk, TextKind::kEmoji}) {
+    for (const int size : {64, 4096, 65536}) {
+      benchmark->Args({static_cast<int>(kind), size});
+    }
+  }
+}
+
+void JsonSerializeText(benchmark::State& state) {
+  const auto text = MakeText(static_cast<TextKind>(state.range(0)),
+                             static_cast<std::size_t>(state.range(1)));
+  const auto json = formats::json::ValueBuilder{text}.ExtractValue();
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(formats::json::ToString(json));
+  }
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(JsonSerializeText)->Apply(TextArguments);
+
+void JsonStringBuilderText(benchmark::State& state) {
+  const auto text = MakeText(static_cast<TextKind>(state.range(0)),
+                             static_cast<std::size_t>(state.range(1)));
+  for ([[maybe_unused]] auto _ : state) {
+    formats::json::StringBuilder sb;
+    sb.WriteString(text);
+    benchmark::DoNotOptimize(sb.GetStringView());
+  }
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(JsonStringBuilderText)->Apply(TextArguments);
+
+void JsonParseText(benchmark::State& state) {
+  const auto text = MakeText(static_cast<TextKind>(state.range(0)),
+                             static_cast<std::size_t>(state.range(1)));
+  const auto input =
+      formats::json::ToString(formats::json::ValueBuilder{text}.ExtractValue());
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(formats::json::FromString(input));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(JsonParseText)->Apply(TextArguments);
+
+void Utf8ValidateText(benchmark::State& state) {
+  const auto text = MakeText(static_cast<TextKind>(state.range(0)),
+                             static_cast<std::size_t>(state.range(1)));
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::text::IsUtf8(text));
+  }
+  state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(Utf8ValidateText)->Apply(TextArguments);
+
 }  // namespace
 
 USERVER_NAMESPACE_END
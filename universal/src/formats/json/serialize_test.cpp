@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <utility>
 
 #include <boost/range/adaptor/reversed.hpp>
 
@@ -9,6 +10,7 @@
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
 #include <userver/formats/parse/common_containers.hpp>
+#include <userver/utils/arena.hpp>
 #include <userver/utils/fmt_compat.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -68,6 +70,56 @@ TEST(FormatsJson, ParseErrorLineColumnValidation) {
                        "line 2 column 12");
 }
 
+TEST(FormatsJson, FromChunks) {
+  const std::string_view input =
+      R"({"key": [1, -2.5, "some long string"], "other": {"x": null}})";
+  const auto expected = formats::json::FromString(input);
+
+  for (const std::size_t chunk_size : {1, 3, 1000}) {
+    auto rest = input;
+    const auto value = formats::json::FromChunks([&rest, chunk_size] {
+      const auto chunk = rest.substr(0, chunk_size);
+      rest.remove_prefix(chunk.size());
+      return chunk;
+    });
+    EXPECT_EQ(value, expected) << "chunk_size=" << chunk_size;
+  }
+
+  auto truncated = input.substr(0, 20);
+  EXPECT_THROW(formats::json::FromChunks([&truncated] {
+                 return std::exchange(truncated, std::string_view{});
+               }),
+               formats::json::ParseException);
+}
+
+TEST(FormatsJson, FromStringArena) {
+  const std::string_view input =
+      R"({"key": [1, -2.5, "some long string"], "other": {"x": null}})";
+  const auto expected = formats::json::FromString(input);
+
+  utils::Arena arena;
+  auto value = formats::json::FromStringInArena(input, arena);
+  EXPECT_EQ(value, expected);
+  EXPECT_GT(arena.GetCapacity(), 0);
+
+  // the builders copy the nodes out of the arena
+  formats::json::ValueBuilder builder{std::move(value)};
+  builder["other"]["y"] = "some other long string";
+  builder["key"].PushBack(42);
+  const auto built = builder.ExtractValue();
+  EXPECT_EQ(built["key"][3].As<int>(), 42);
+  EXPECT_EQ(built["other"]["y"].As<std::string>(), "some other long string");
+
+  const auto cloned = formats::json::FromStringInArena(input, arena).Clone();
+  EXPECT_EQ(cloned, expected);
+
+  EXPECT_THROW(
+      formats::json::FromStringInArena(R"({"a": 1, "a": 2})", arena),
+      formats::json::ParseException);
+  EXPECT_THROW(formats::json::FromStringInArena("[1,", arena),
+               formats::json::ParseException);
+}
+
 TEST(FormatsJson, ParseFromBadFile) {
   using formats::json::blocking::FromFile;
   using ParseException = formats::json::Value::ParseException;
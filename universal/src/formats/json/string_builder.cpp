@@ -38,6 +38,13 @@ std::string StringBuilder::GetString() const {
   return std::string{GetStringView()};
 }
 
+std::string StringBuilder::ExtractString() {
+  auto result = GetString();
+  // keeps the capacity and the state of the writer
+  impl_->buffer.Clear();
+  return result;
+}
+
 void StringBuilder::WriteNull() { impl_->writer.Null(); }
 
 void StringBuilder::WriteString(std::string_view value) {
@@ -2,12 +2,21 @@
 
 #include <array>
 #include <cstring>
+#include <map>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
 
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/serialize_boost_variant.hpp>
 #include <userver/formats/json/serialize_duration.hpp>
 #include <userver/formats/json/string_builder.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/serialize/boost_optional.hpp>
+#include <userver/formats/serialize/time_of_day.hpp>
 #include <userver/utest/death_tests.hpp>
+#include <userver/utils/small_string_serialization.hpp>
+#include <userver/utils/strong_typedef.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -143,6 +152,27 @@ TEST(JsonStringBuilder, Array) {
   EXPECT_EQ("[\"123\",true]", sw.GetString());
 }
 
+TEST(JsonStringBuilder, ExtractString) {
+  StringBuilder sw;
+  std::string result;
+  {
+    StringBuilder::ArrayGuard guard(sw);
+    sw.WriteString("123");
+    result += sw.ExtractString();
+    EXPECT_EQ(sw.GetStringView(), "");
+    {
+      StringBuilder::ObjectGuard object_guard(sw);
+      sw.Key("a");
+      result += sw.ExtractString();
+      sw.WriteBool(true);
+    }
+  }
+  result += sw.ExtractString();
+
+  EXPECT_EQ("[\"123\",{\"a\":true}]", result);
+  EXPECT_EQ(sw.GetStringView(), "");
+}
+
 TEST(JsonStringBuilder, RawValue) {
   StringBuilder sw;
   {
@@ -218,6 +248,40 @@ TEST(JsonStringBuilder, FilledOptional) {
   EXPECT_EQ(sw.GetString(), "42");
 }
 
+TEST(JsonStringBuilder, BoostOptional) {
+  StringBuilder sw;
+  WriteToStream(std::vector<boost::optional<int>>{42, boost::none}, sw);
+  EXPECT_EQ(sw.GetString(), "[42,null]");
+}
+
+TEST(JsonStringBuilder, BoostVariant) {
+  StringBuilder sw;
+  WriteToStream(std::vector<boost::variant<int, std::string>>{1, "one"}, sw);
+  EXPECT_EQ(sw.GetString(), R"([1,"one"])");
+}
+
+TEST(JsonStringBuilder, TimeOfDay) {
+  StringBuilder sw;
+  WriteToStream(utils::datetime::TimeOfDay<std::chrono::minutes>{"12:34"}, sw);
+  EXPECT_EQ(sw.GetString(), R"("12:34")");
+}
+
+TEST(JsonStringBuilder, SmallString) {
+  StringBuilder sw;
+  WriteToStream(utils::SmallString<8>{"small"}, sw);
+  EXPECT_EQ(sw.GetString(), R"("small")");
+}
+
+TEST(JsonStringBuilder, StrongTypedefKeys) {
+  using Key = utils::StrongTypedef<class KeyTag, std::string>;
+  const std::map<Key, int> map{{Key{"a"}, 1}, {Key{"b"}, 2}};
+
+  StringBuilder sw;
+  WriteToStream(map, sw);
+  EXPECT_EQ(sw.GetString(), R"({"a":1,"b":2})");
+  EXPECT_EQ(FromString(sw.GetString()), ValueBuilder{map}.ExtractValue());
+}
+
 template <typename T>
 class JsonStringBuilderIntegralTypes : public ::testing::Test {};
 
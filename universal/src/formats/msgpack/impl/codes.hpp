@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+// MessagePack format codes,
+// https://github.com/msgpack/msgpack/blob/master/spec.md
+namespace formats::msgpack::impl {
+
+inline constexpr std::uint8_t kPositiveFixIntMax = 0x7f;
+inline constexpr std::uint8_t kFixMap = 0x80;
+inline constexpr std::uint8_t kFixArray = 0x90;
+inline constexpr std::uint8_t kFixStr = 0xa0;
+inline constexpr std::uint8_t kNil = 0xc0;
+inline constexpr std::uint8_t kFalse = 0xc2;
+inline constexpr std::uint8_t kTrue = 0xc3;
+inline constexpr std::uint8_t kBin8 = 0xc4;
+inline constexpr std::uint8_t kBin16 = 0xc5;
+inline constexpr std::uint8_t kBin32 = 0xc6;
+inline constexpr std::uint8_t kFloat32 = 0xca;
+inline constexpr std::uint8_t kFloat64 = 0xcb;
+inline constexpr std::uint8_t kUInt8 = 0xcc;
+inline constexpr std::uint8_t kUInt16 = 0xcd;
+inline constexpr std::uint8_t kUInt32 = 0xce;
+inline constexpr std::uint8_t kUInt64 = 0xcf;
+inline constexpr std::uint8_t kInt8 = 0xd0;
+inline constexpr std::uint8_t kInt16 = 0xd1;
+inline constexpr std::uint8_t kInt32 = 0xd2;
+inline constexpr std::uint8_t kInt64 = 0xd3;
+inline constexpr std::uint8_t kStr8 = 0xd9;
+inline constexpr std::uint8_t kStr16 = 0xda;
+inline constexpr std::uint8_t kStr32 = 0xdb;
+inline constexpr std::uint8_t kArray16 = 0xdc;
+inline constexpr std::uint8_t kArray32 = 0xdd;
+inline constexpr std::uint8_t kMap16 = 0xde;
+inline constexpr std::uint8_t kMap32 = 0xdf;
+inline constexpr std::uint8_t kNegativeFixIntFirst = 0xe0;
+
+inline constexpr std::int64_t kNegativeFixIntMin = -32;
+inline constexpr std::size_t kFixStrMaxSize = 31;
+inline constexpr std::size_t kFixContainerMaxSize = 15;
+
+// the code and the 32 bit size of map 32 and array 32
+inline constexpr std::size_t kContainerHeaderMaxSize = 5;
+
+}  // namespace formats::msgpack::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,208 @@
+#include <userver/formats/msgpack/serialize.hpp>
+
+#include <cstring>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <userver/formats/msgpack/string_builder.hpp>
+
+#include <formats/msgpack/impl/codes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+namespace {
+
+using formats::json::ValueBuilder;
+
+class Reader final {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  bool AtEnd() const noexcept { return pos_ == data_.size(); }
+
+  std::uint8_t ReadCode() { return static_cast<std::uint8_t>(Read(1)[0]); }
+
+  template <typename T>
+  T ReadBigEndian() {
+    const auto bytes = Read(sizeof(T));
+    T result = 0;
+    for (const char c : bytes) {
+      result = static_cast<T>((result << 8) | static_cast<std::uint8_t>(c));
+    }
+    return result;
+  }
+
+  std::string_view Read(std::size_t size) {
+    if (data_.size() - pos_ < size) Fail("unexpected end of data");
+    const auto result = data_.substr(pos_, size);
+    pos_ += size;
+    return result;
+  }
+
+  [[noreturn]] void Fail(std::string_view message) const {
+    throw formats::json::ParseException(
+        fmt::format("MessagePack parse error at offset {}: {}", pos_, message));
+  }
+
+ private:
+  std::string_view data_;
+  std::size_t pos_{0};
+};
+
+template <typename Unsigned, typename Signed>
+Signed ReadSigned(Reader& reader) {
+  return static_cast<Signed>(reader.ReadBigEndian<Unsigned>());
+}
+
+double ReadFloat32(Reader& reader) {
+  const auto bits = reader.ReadBigEndian<std::uint32_t>();
+  float result{};
+  static_assert(sizeof(result) == sizeof(bits));
+  std::memcpy(&result, &bits, sizeof(bits));
+  return result;
+}
+
+double ReadFloat64(Reader& reader) {
+  const auto bits = reader.ReadBigEndian<std::uint64_t>();
+  double result{};
+  static_assert(sizeof(result) == sizeof(bits));
+  std::memcpy(&result, &bits, sizeof(bits));
+  return result;
+}
+
+ValueBuilder ParseValue(Reader& reader, std::size_t depth);
+
+ValueBuilder ParseArray(Reader& reader, std::size_t size, std::size_t depth) {
+  ValueBuilder result{formats::common::Type::kArray};
+  for (std::size_t i = 0; i < size; ++i) {
+    result.PushBack(ParseValue(reader, depth + 1));
+  }
+  return result;
+}
+
+std::string_view ParseKey(Reader& reader) {
+  const auto code = reader.ReadCode();
+  if ((code & 0xe0) == impl::kFixStr) return reader.Read(code & 0x1f);
+  switch (code) {
+    case impl::kStr8:
+      return reader.Read(reader.ReadBigEndian<std::uint8_t>());
+    case impl::kStr16:
+      return reader.Read(reader.ReadBigEndian<std::uint16_t>());
+    case impl::kStr32:
+      return reader.Read(reader.ReadBigEndian<std::uint32_t>());
+    default:
+      reader.Fail("only string keys are supported");
+  }
+}
+
+ValueBuilder ParseMap(Reader& reader, std::size_t size, std::size_t depth) {
+  ValueBuilder result{formats::common::Type::kObject};
+  for (std::size_t i = 0; i < size; ++i) {
+    const std::string key{ParseKey(reader)};
+    if (result.HasMember(key)) reader.Fail("duplicate key '" + key + "'");
+    result[key] = ParseValue(reader, depth + 1);
+  }
+  return result;
+}
+
+ValueBuilder ParseValue(Reader& reader, std::size_t depth) {
+  if (depth >= formats::json::kDepthParseLimit) {
+    reader.Fail(fmt::format("exceeded maximum allowed depth of {}",
+                            formats::json::kDepthParseLimit));
+  }
+
+  const auto code = reader.ReadCode();
+  if (code <= impl::kPositiveFixIntMax) return ValueBuilder{uint64_t{code}};
+  if (code >= impl::kNegativeFixIntFirst) {
+    return ValueBuilder{int64_t{static_cast<std::int8_t>(code)}};
+  }
+  if ((code & 0xf0) == impl::kFixMap) {
+    return ParseMap(reader, code & 0x0f, depth);
+  }
+  if ((code & 0xf0) == impl::kFixArray) {
+    return ParseArray(reader, code & 0x0f, depth);
+  }
+  if ((code & 0xe0) == impl::kFixStr) {
+    return ValueBuilder{reader.Read(code & 0x1f)};
+  }
+
+  switch (code) {
+    case impl::kNil:
+      return ValueBuilder{};
+    case impl::kFalse:
+      return ValueBuilder{false};
+    case impl::kTrue:
+      return ValueBuilder{true};
+    case impl::kStr8:
+    case impl::kBin8:
+      return ValueBuilder{reader.Read(reader.ReadBigEndian<std::uint8_t>())};
+    case impl::kStr16:
+    case impl::kBin16:
+      return ValueBuilder{reader.Read(reader.ReadBigEndian<std::uint16_t>())};
+    case impl::kStr32:
+    case impl::kBin32:
+      return ValueBuilder{reader.Read(reader.ReadBigEndian<std::uint32_t>())};
+    case impl::kFloat32:
+      return ValueBuilder{ReadFloat32(reader)};
+    case impl::kFloat64:
+      return ValueBuilder{ReadFloat64(reader)};
+    case impl::kUInt8:
+      return ValueBuilder{uint64_t{reader.ReadBigEndian<std::uint8_t>()}};
+    case impl::kUInt16:
+      return ValueBuilder{uint64_t{reader.ReadBigEndian<std::uint16_t>()}};
+    case impl::kUInt32:
+      return ValueBuilder{uint64_t{reader.ReadBigEndian<std::uint32_t>()}};
+    case impl::kUInt64:
+      return ValueBuilder{reader.ReadBigEndian<std::uint64_t>()};
+    case impl::kInt8:
+      return ValueBuilder{
+          int64_t{ReadSigned<std::uint8_t, std::int8_t>(reader)}};
+    case impl::kInt16:
+      return ValueBuilder{
+          int64_t{ReadSigned<std::uint16_t, std::int16_t>(reader)}};
+    case impl::kInt32:
+      return ValueBuilder{
+          int64_t{ReadSigned<std::uint32_t, std::int32_t>(reader)}};
+    case impl::kInt64:
+      return ValueBuilder{ReadSigned<std::uint64_t, std::int64_t>(reader)};
+    case impl::kArray16:
+      return ParseArray(reader, reader.ReadBigEndian<std::uint16_t>(), depth);
+    case impl::kArray32:
+      return ParseArray(reader, reader.ReadBigEndian<std::uint32_t>(), depth);
+    case impl::kMap16:
+      return ParseMap(reader, reader.ReadBigEndian<std::uint16_t>(), depth);
+    case impl::kMap32:
+      return ParseMap(reader, reader.ReadBigEndian<std::uint32_t>(), depth);
+    default:
+      reader.Fail(fmt::format("unsupported type code {:#x}", code));
+  }
+}
+
+}  // namespace
+
+formats::json::Value FromString(std::string_view data) {
+  if (data.empty()) {
+    throw formats::json::ParseException("MessagePack document is empty");
+  }
+
+  Reader reader{data};
+  auto result = ParseValue(reader, 0);
+  if (!reader.AtEnd()) reader.Fail("extra data after the document");
+  return result.ExtractValue();
+}
+
+std::string ToString(const formats::json::Value& value) {
+  StringBuilder sb;
+  sb.WriteValue(value);
+  return sb.GetString();
+}
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/msgpack/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::string_literals;
+
+}  // namespace
+
+TEST(FormatsMsgpack, Scalars) {
+  using formats::msgpack::FromString;
+
+  EXPECT_TRUE(FromString("\xc0").IsNull());
+  EXPECT_TRUE(FromString("\xc3").As<bool>());
+  EXPECT_EQ(FromString("\x05").As<int>(), 5);
+  EXPECT_EQ(FromString("\xff").As<int>(), -1);
+  EXPECT_EQ(FromString("\xcd\x01\x00"s).As<int>(), 256);
+  EXPECT_EQ(FromString("\xd1\xff\x00"s).As<int>(), -256);
+  EXPECT_EQ(FromString("\xa3"
+                       "abc")
+                .As<std::string>(),
+            "abc");
+  EXPECT_EQ(FromString("\xca\x3f\xc0\x00\x00"s).As<double>(), 1.5);
+
+  EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("5")), "\x05");
+  EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("-1")), "\xff");
+  EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString("256")), "\xcd\x01\x00"s);
+  EXPECT_EQ(formats::msgpack::ToString(formats::json::FromString(R"("abc")")),
+            "\xa3"
+            "abc");
+}
+
+TEST(FormatsMsgpack, Roundtrip) {
+  const auto json = formats::json::FromString(R"({
+    "null": null,
+    "bool": false,
+    "ints": [0, 127, 128, 65536, -32, -33, -129, -40000, -5000000000,
+             18446744073709551615],
+    "double": -2.5,
+    "strings": ["", "short", "a string that is longer than 31 bytes for sure",
+                "Мос"],
+    "nested": {"a": {"b": {"c": []}}, "d": {}}
+  })");
+
+  const auto msgpack = formats::msgpack::ToString(json);
+  EXPECT_LT(msgpack.size(), formats::json::ToString(json).size());
+  EXPECT_EQ(formats::msgpack::FromString(msgpack), json);
+
+  std::string large_array = "[0";
+  for (int i = 1; i < 70000; ++i) large_array += "," + std::to_string(i);
+  large_array += "]";
+  const auto large = formats::json::FromString(large_array);
+  EXPECT_EQ(formats::msgpack::FromString(formats::msgpack::ToString(large)),
+            large);
+
+  EXPECT_EQ(formats::msgpack::FromString(formats::msgpack::ToString(
+                formats::json::FromString("18446744073709551615")))
+                .As<std::uint64_t>(),
+            std::numeric_limits<std::uint64_t>::max());
+}
+
+TEST(FormatsMsgpack, Invalid) {
+  using formats::json::ParseException;
+  using formats::msgpack::FromString;
+
+  EXPECT_THROW(FromString(""), ParseException);
+  EXPECT_THROW(FromString("\x92\x01"), ParseException);
+  EXPECT_THROW(FromString("\xa5"
+                          "abc"),
+               ParseException);
+  EXPECT_THROW(FromString("\x01\x02"), ParseException);
+  // non-string key
+  EXPECT_THROW(FromString("\x81\x01\x02"), ParseException);
+  // duplicate key
+  EXPECT_THROW(FromString("\x82\xa1"
+                          "a"
+                          "\x01\xa1"
+                          "a"
+                          "\x02"),
+               ParseException);
+  // ext types
+  EXPECT_THROW(FromString("\xd4\x01\x02"), ParseException);
+  EXPECT_THROW(FromString(std::string(200, '\x91') + "\xc0"), ParseException);
+}
+
+USERVER_NAMESPACE_END
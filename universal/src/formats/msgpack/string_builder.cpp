@@ -0,0 +1,258 @@
+#include <userver/formats/msgpack/string_builder.hpp>
+
+#include <cstring>
+#include <limits>
+
+#include <userver/formats/json/exception.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+
+#include <formats/msgpack/impl/codes.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace formats::msgpack {
+
+namespace {
+
+template <typename T>
+void AppendBigEndian(std::string& data, T value) {
+  char bytes[sizeof(T)];
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    bytes[sizeof(T) - 1 - i] = static_cast<char>(value & 0xff);
+    value >>= 8;
+  }
+  data.append(bytes, sizeof(T));
+}
+
+void AppendCode(std::string& data, std::uint8_t code) {
+  data.push_back(static_cast<char>(code));
+}
+
+void AppendStringHeader(std::string& data, std::size_t size) {
+  if (size <= impl::kFixStrMaxSize) {
+    AppendCode(data, impl::kFixStr | size);
+  } else if (size <= std::numeric_limits<std::uint8_t>::max()) {
+    AppendCode(data, impl::kStr8);
+    AppendBigEndian(data, static_cast<std::uint8_t>(size));
+  } else if (size <= std::numeric_limits<std::uint16_t>::max()) {
+    AppendCode(data, impl::kStr16);
+    AppendBigEndian(data, static_cast<std::uint16_t>(size));
+  } else if (size <= std::numeric_limits<std::uint32_t>::max()) {
+    AppendCode(data, impl::kStr32);
+    AppendBigEndian(data, static_cast<std::uint32_t>(size));
+  } else {
+    throw formats::json::Exception("String is too long for MessagePack");
+  }
+}
+
+}  // namespace
+
+StringBuilder::StringBuilder() = default;
+
+StringBuilder::~StringBuilder() = default;
+
+std::string StringBuilder::GetString() const {
+  return std::string{GetStringView()};
+}
+
+std::string_view StringBuilder::GetStringView() const {
+  UASSERT_MSG(containers_.empty(), "Not all the guards are destroyed");
+  return data_;
+}
+
+void StringBuilder::WriteNull() {
+  OnValue();
+  AppendCode(data_, impl::kNil);
+}
+
+void StringBuilder::WriteString(std::string_view value) {
+  OnValue();
+  AppendStringHeader(data_, value.size());
+  data_.append(value);
+}
+
+void StringBuilder::WriteBool(bool value) {
+  OnValue();
+  AppendCode(data_, value ? impl::kTrue : impl::kFalse);
+}
+
+void StringBuilder::WriteInt64(int64_t value) {
+  if (value >= 0) {
+    WriteUInt64(static_cast<uint64_t>(value));
+    return;
+  }
+
+  OnValue();
+  if (value >= impl::kNegativeFixIntMin) {
+    AppendCode(data_, static_cast<std::uint8_t>(value));
+  } else if (value >= std::numeric_limits<std::int8_t>::min()) {
+    AppendCode(data_, impl::kInt8);
+    AppendBigEndian(data_, static_cast<std::uint8_t>(value));
+  } else if (value >= std::numeric_limits<std::int16_t>::min()) {
+    AppendCode(data_, impl::kInt16);
+    AppendBigEndian(data_, static_cast<std::uint16_t>(value));
+  } else if (value >= std::numeric_limits<std::int32_t>::min()) {
+    AppendCode(data_, impl::kInt32);
+    AppendBigEndian(data_, static_cast<std::uint32_t>(value));
+  } else {
+    AppendCode(data_, impl::kInt64);
+    AppendBigEndian(data_, static_cast<std::uint64_t>(value));
+  }
+}
+
+void StringBuilder::WriteUInt64(uint64_t value) {
+  OnValue();
+  if (value <= impl::kPositiveFixIntMax) {
+    AppendCode(data_, static_cast<std::uint8_t>(value));
+  } else if (value <= std::numeric_limits<std::uint8_t>::max()) {
+    AppendCode(data_, impl::kUInt8);
+    AppendBigEndian(data_, static_cast<std::uint8_t>(value));
+  } else if (value <= std::numeric_limits<std::uint16_t>::max()) {
+    AppendCode(data_, impl::kUInt16);
+    AppendBigEndian(data_, static_cast<std::uint16_t>(value));
+  } else if (value <= std::numeric_limits<std::uint32_t>::max()) {
+    AppendCode(data_, impl::kUInt32);
+    AppendBigEndian(data_, static_cast<std::uint32_t>(value));
+  } else {
+    AppendCode(data_, impl::kUInt64);
+    AppendBigEndian(data_, value);
+  }
+}
+
+void StringBuilder::WriteDouble(double value) {
+  OnValue();
+  static_assert(sizeof(double) == sizeof(std::uint64_t));
+  std::uint64_t bits{};
+  std::memcpy(&bits, &value, sizeof(bits));
+  AppendCode(data_, impl::kFloat64);
+  AppendBigEndian(data_, bits);
+}
+
+void StringBuilder::Key(std::string_view sw) {
+  UASSERT_MSG(!containers_.empty() && containers_.back().is_map,
+              "Key is written outside of the object");
+  ++containers_.back().size;
+  AppendStringHeader(data_, sw.size());
+  data_.append(sw);
+}
+
+void StringBuilder::WriteValue(const Value& value) {
+  if (value.IsNull()) {
+    WriteNull();
+  } else if (value.IsBool()) {
+    WriteBool(value.As<bool>());
+  } else if (value.IsInt64()) {
+    WriteInt64(value.As<int64_t>());
+  } else if (value.IsUInt64()) {
+    WriteUInt64(value.As<uint64_t>());
+  } else if (value.IsDouble()) {
+    WriteDouble(value.As<double>());
+  } else if (value.IsString()) {
+    WriteString(value.As<std::string>());
+  } else if (value.IsArray()) {
+    ArrayGuard guard{*this};
+    for (const auto& item : value) WriteValue(item);
+  } else {
+    UASSERT(value.IsObject());
+    ObjectGuard guard{*this};
+    for (auto it = value.begin(); it != value.end(); ++it) {
+      Key(it.GetName());
+      WriteValue(*it);
+    }
+  }
+}
+
+void StringBuilder::StartContainer(bool is_map) {
+  OnValue();
+  containers_.push_back({data_.size(), 0, is_map});
+  // the header is written on EndContainer(), when the size is known
+  data_.append(impl::kContainerHeaderMaxSize, '\0');
+}
+
+void StringBuilder::EndContainer() {
+  UASSERT(!containers_.empty());
+  const auto container = containers_.back();
+  containers_.pop_back();
+
+  char* header = data_.data() + container.header_offset;
+  if (container.size <= impl::kFixContainerMaxSize) {
+    // the small containers are the most common ones, shrink the header
+    *header = static_cast<char>(
+        (container.is_map ? impl::kFixMap : impl::kFixArray) | container.size);
+    data_.erase(container.header_offset + 1,
+                impl::kContainerHeaderMaxSize - 1);
+    return;
+  }
+
+  *header = static_cast<char>(container.is_map ? impl::kMap32 : impl::kArray32);
+  for (std::size_t i = 0; i < sizeof(std::uint32_t); ++i) {
+    header[sizeof(std::uint32_t) - i] =
+        static_cast<char>((container.size >> (8 * i)) & 0xff);
+  }
+}
+
+void StringBuilder::OnValue() {
+  if (!containers_.empty() && !containers_.back().is_map) {
+    ++containers_.back().size;
+  }
+}
+
+void WriteToStream(bool value, StringBuilder& sw) { sw.WriteBool(value); }
+
+void WriteToStream(long long value, StringBuilder& sw) { sw.WriteInt64(value); }
+
+void WriteToStream(unsigned long long value, StringBuilder& sw) {
+  sw.WriteUInt64(value);
+}
+
+void WriteToStream(int value, StringBuilder& sw) { sw.WriteInt64(value); }
+
+void WriteToStream(unsigned value, StringBuilder& sw) { sw.WriteUInt64(value); }
+
+void WriteToStream(long value, StringBuilder& sw) { sw.WriteInt64(value); }
+
+void WriteToStream(unsigned long value, StringBuilder& sw) {
+  sw.WriteUInt64(value);
+}
+
+void WriteToStream(double value, StringBuilder& sw) { sw.WriteDouble(value); }
+
+void WriteToStream(const char* value, StringBuilder& sw) {
+  sw.WriteString(value);
+}
+
+void WriteToStream(std::string_view value, StringBuilder& sw) {
+  sw.WriteString(value);
+}
+
+void WriteToStream(const formats::json::Value& value, StringBuilder& sw) {
+  sw.WriteValue(value);
+}
+
+void WriteToStream(const std::string& value, StringBuilder& sw) {
+  WriteToStream(std::string_view{value}, sw);
+}
+
+void WriteToStream(std::chrono::system_clock::time_point tp,
+                   StringBuilder& sw) {
+  WriteToStream(
+      utils::datetime::Timestring(tp, "UTC", utils::datetime::kRfc3339Format),
+      sw);
+}
+
+StringBuilder::ObjectGuard::ObjectGuard(StringBuilder& sw) : sw_(sw) {
+  sw_.StartContainer(/*is_map=*/true);
+}
+
+StringBuilder::ObjectGuard::~ObjectGuard() { sw_.EndContainer(); }
+
+StringBuilder::ArrayGuard::ArrayGuard(StringBuilder& sw) : sw_(sw) {
+  sw_.StartContainer(/*is_map=*/false);
+}
+
+StringBuilder::ArrayGuard::~ArrayGuard() { sw_.EndContainer(); }
+
+}  // namespace formats::msgpack
+
+USERVER_NAMESPACE_END
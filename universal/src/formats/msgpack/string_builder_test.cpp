@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/string_builder.hpp>
+#include <userver/formats/msgpack/serialize.hpp>
+#include <userver/formats/msgpack/string_builder.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/formats/serialize/common_containers.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [Sample formats::msgpack::StringBuilder usage]
+struct Item {
+  std::string name;
+  std::vector<int> values;
+  std::optional<double> weight;
+};
+
+// Templates over the builder serve both JSON and MessagePack
+template <typename StringBuilder>
+void WriteToStream(const Item& item, StringBuilder& sw) {
+  typename StringBuilder::ObjectGuard guard{sw};
+  sw.Key("name");
+  WriteToStream(item.name, sw);
+  sw.Key("values");
+  WriteToStream(item.values, sw);
+  if (item.weight) {
+    sw.Key("weight");
+    WriteToStream(*item.weight, sw);
+  }
+}
+
+TEST(FormatsMsgpackStringBuilder, Sample) {
+  const std::vector<Item> items{{"first", {1, 2, 3}, 0.5}, {"second", {}, {}}};
+
+  formats::msgpack::StringBuilder sb;
+  WriteToStream(items, sb);
+
+  const auto value = formats::msgpack::FromString(sb.GetStringView());
+  EXPECT_EQ(value[0]["name"].As<std::string>(), "first");
+  EXPECT_EQ(value[1]["values"].As<std::vector<int>>(), std::vector<int>{});
+  EXPECT_FALSE(value[1].HasMember("weight"));
+}
+/// [Sample formats::msgpack::StringBuilder usage]
+
+}  // namespace
+
+TEST(FormatsMsgpackStringBuilder, SameAsJson) {
+  const std::map<std::string, std::vector<Item>> data{
+      {"items", {{"a", {-1, 1000, -100000}, 1.25}, {"b", {0}, {}}}},
+      {"more", std::vector<Item>(20, Item{"c", std::vector<int>(20, 7), {}})},
+  };
+
+  formats::json::StringBuilder json;
+  WriteToStream(data, json);
+  formats::msgpack::StringBuilder msgpack;
+  WriteToStream(data, msgpack);
+
+  EXPECT_EQ(formats::msgpack::FromString(msgpack.GetStringView()),
+            formats::json::FromString(json.GetStringView()));
+}
+
+TEST(FormatsMsgpackStringBuilder, WriteValue) {
+  const auto json =
+      formats::json::FromString(R"({"a": [1, "x", null, {"b": true}]})");
+
+  formats::msgpack::StringBuilder sb;
+  WriteToStream(json, sb);
+  EXPECT_EQ(sb.GetString(), formats::msgpack::ToString(json));
+  EXPECT_EQ(formats::msgpack::FromString(sb.GetStringView()), json);
+}
+
+USERVER_NAMESPACE_END
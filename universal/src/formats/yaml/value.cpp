@@ -1,5 +1,7 @@
 #include <userver/formats/yaml/value.hpp>
 
+#include <charconv>
+#include <optional>
 #include <string_view>
 
 #include <yaml-cpp/yaml.h>
@@ -34,6 +36,28 @@ struct IsConvertibleChecker {
 
 auto MakeMissingNode() { return YAML::Node{}[0]; }
 
+// yaml-cpp parses numbers via iostreams, which are slow and locale dependent.
+// Plain decimal numbers are parsed with std::from_chars, the YAML specific
+// forms like '.inf' are left to yaml-cpp.
+std::optional<double> TryParseDecimalDouble(std::string_view str) {
+#ifdef __cpp_lib_to_chars
+  const std::size_t digit_pos = (!str.empty() && str[0] == '-') ? 1 : 0;
+  if (str.size() <= digit_pos || str[digit_pos] < '0' || str[digit_pos] > '9') {
+    return std::nullopt;
+  }
+
+  double result{};
+  const auto [end, error_code] =
+      std::from_chars(str.data(), str.data() + str.size(), result);
+  if (error_code == std::errc{} && end == str.data() + str.size()) {
+    return result;
+  }
+#else
+  static_cast<void>(str);
+#endif
+  return std::nullopt;
+}
+
 }  // namespace
 
 Value::Value() noexcept : Value(YAML::Node()) {}
@@ -192,6 +216,10 @@ uint64_t Parse(const Value& value, parse::To<uint64_t>) {
 }
 
 double Parse(const Value& value, parse::To<double>) {
+  if (!value.IsMissing() && value.value_pimpl_->IsScalar()) {
+    const auto result = TryParseDecimalDouble(value.value_pimpl_->Scalar());
+    if (result) return *result;
+  }
   return value.ValueAs<double>();
 }
 
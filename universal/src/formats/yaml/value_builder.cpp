@@ -1,5 +1,8 @@
 #include <userver/formats/yaml/value_builder.hpp>
 
+#include <charconv>
+#include <limits>
+
 #include <yaml-cpp/yaml.h>
 
 #include <formats/common/validations.hpp>
@@ -25,6 +28,23 @@ YAML::NodeType::value ToNative(Type t) {
   UINVARIANT(false, "Unexpected YAML type");
 }
 
+template <typename Float>
+YAML::Node MakeFloatNode(Float value) {
+  formats::common::ValidateFloat<Exception>(value);
+#ifdef __cpp_lib_to_chars
+  // yaml-cpp formats via iostreams with max_digits10 precision, which is slow
+  // and prints 0.1 as 0.10000000000000001. std::to_chars gives the shortest
+  // form that is parsed back to the same value.
+  char buffer[std::numeric_limits<Float>::max_digits10 + 8];
+  const auto [end, error_code] =
+      std::to_chars(buffer, buffer + sizeof(buffer), value);
+  UASSERT(error_code == std::errc{});
+  return YAML::Node(std::string(buffer, end));
+#else
+  return YAML::Node(value);
+#endif
+}
+
 }  // namespace
 
 ValueBuilder::ValueBuilder() : value_(YAML::Node()) {}
@@ -54,11 +74,9 @@ ValueBuilder::ValueBuilder(long long t) : value_(YAML::Node(t)) {}
 
 ValueBuilder::ValueBuilder(unsigned long long t) : value_(YAML::Node(t)) {}
 
-ValueBuilder::ValueBuilder(float t)
-    : value_(YAML::Node(formats::common::ValidateFloat<Exception>(t))) {}
+ValueBuilder::ValueBuilder(float t) : value_(MakeFloatNode(t)) {}
 
-ValueBuilder::ValueBuilder(double t)
-    : value_(YAML::Node(formats::common::ValidateFloat<Exception>(t))) {}
+ValueBuilder::ValueBuilder(double t) : value_(MakeFloatNode(t)) {}
 
 ValueBuilder& ValueBuilder::operator=(const ValueBuilder& other) {
   if (this == &other) return *this;
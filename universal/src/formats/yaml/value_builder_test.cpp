@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <limits>
+
 #include <userver/formats/yaml/exception.hpp>
 #include <userver/formats/yaml/value_builder.hpp>
 
@@ -73,4 +75,21 @@ TEST(YamlValueBuilder, MultiSegmentPath) {
   ASSERT_TRUE(builder["foo"].HasMember("bar"));
 }
 
+TEST(YamlValueBuilder, ShortestDouble) {
+  formats::yaml::ValueBuilder builder(formats::common::Type::kObject);
+  builder["double"] = 0.1;
+  builder["float"] = 0.1f;
+  builder["large"] = 1e300;
+  builder["denorm"] = std::numeric_limits<double>::denorm_min();
+  const auto yaml = builder.ExtractValue();
+
+  EXPECT_EQ(yaml["double"].As<std::string>(), "0.1");
+  EXPECT_EQ(yaml["float"].As<std::string>(), "0.1");
+  EXPECT_EQ(yaml["double"].As<double>(), 0.1);
+  EXPECT_EQ(yaml["float"].As<float>(), 0.1f);
+  EXPECT_EQ(yaml["large"].As<double>(), 1e300);
+  EXPECT_EQ(yaml["denorm"].As<double>(),
+            std::numeric_limits<double>::denorm_min());
+}
+
 USERVER_NAMESPACE_END
@@ -5,6 +5,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include <map>
 #include <unordered_map>
 #include <vector>
 
@@ -38,6 +39,13 @@ struct TransparentICaseEqual final {
   }
 };
 
+struct TransparentICaseLess final {
+  using is_transparent = void;
+  bool operator()(std::string_view lhs, std::string_view rhs) const noexcept {
+    return utils::StrIcaseLess{}(lhs, rhs);
+  }
+};
+
 template <typename KeyEq>
 class LinearSearch final {
  public:
@@ -93,6 +101,7 @@ using LinearSearchMap = LinearSearch<TransparentICaseEqual>;
 using StdUnorderedMap =
     std::unordered_map<std::string, std::string, TransparentICaseHash,
                        TransparentICaseEqual>;
+using StdMap = std::map<std::string, std::string, TransparentICaseLess>;
 
 template <typename Map>
 class MapProxyBase {
@@ -166,6 +175,20 @@ class MapProxy<LinearSearchMap> final : public MapProxyBase<LinearSearchMap> {
   using MapProxyBase<LinearSearchMap>::MapProxyBase;
 };
 
+template <>
+class MapProxy<StdMap> final : public MapProxyBase<StdMap> {
+ public:
+  using MapProxyBase<StdMap>::MapProxyBase;
+
+  // NOLINTNEXTLINE
+  void Reserve(std::size_t) {}
+
+  // NOLINTNEXTLINE
+  auto FindPredefined(const http::headers::PredefinedHeader& header) {
+    return Find(header);
+  }
+};
+
 template <>
 class MapProxy<StdUnorderedMap> final : public MapProxyBase<StdUnorderedMap> {
  public:
@@ -524,6 +547,7 @@ BENCHMARK_TEMPLATE(HttpHeadersMap_Showcase, LinearSearchMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Showcase, AbslMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Showcase, BoostFlatHashMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Showcase, StdUnorderedMap);
+BENCHMARK_TEMPLATE(HttpHeadersMap_Showcase, StdMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Showcase, HeaderMap);
 
 }  // namespace
@@ -532,24 +556,28 @@ BENCHMARK_TEMPLATE(HttpHeadersMap_Find, LinearSearchMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Find, AbslMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Find, BoostFlatHashMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Find, StdUnorderedMap);
+BENCHMARK_TEMPLATE(HttpHeadersMap_Find, StdMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Find, HeaderMap);
 
 BENCHMARK_TEMPLATE(HttpHeadersMap_FindPredefined, LinearSearchMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_FindPredefined, AbslMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_FindPredefined, BoostFlatHashMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_FindPredefined, StdUnorderedMap);
+BENCHMARK_TEMPLATE(HttpHeadersMap_FindPredefined, StdMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_FindPredefined, HeaderMap);
 
 BENCHMARK_TEMPLATE(HttpHeadersMap_Populate, LinearSearchMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Populate, AbslMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Populate, BoostFlatHashMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Populate, StdUnorderedMap);
+BENCHMARK_TEMPLATE(HttpHeadersMap_Populate, StdMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_Populate, HeaderMap);
 
 BENCHMARK_TEMPLATE(HttpHeadersMap_PopulateWithKnown, LinearSearchMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_PopulateWithKnown, AbslMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_PopulateWithKnown, BoostFlatHashMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_PopulateWithKnown, StdUnorderedMap);
+BENCHMARK_TEMPLATE(HttpHeadersMap_PopulateWithKnown, StdMap);
 BENCHMARK_TEMPLATE(HttpHeadersMap_PopulateWithKnown, HeaderMap);
 
 BENCHMARK_TEMPLATE(HttpHeadersMap_CopyAndEraseAll, LinearSearchMap);
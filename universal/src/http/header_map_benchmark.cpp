@@ -1,9 +1,12 @@
 #include <benchmark/benchmark.h>
 
+#include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <userver/http/header_map.hpp>
+#include <userver/utils/small_string.hpp>
 
 #include <userver/internal/http/header_map_tests_helper.hpp>
 
@@ -50,6 +53,13 @@ std::vector<CollisionsBlock> GenerateCollisions() {
 
 const auto kCollisionBlocks = GenerateCollisions();
 
+constexpr std::array<std::string_view, 8> kTypicalHeaders{
+    "Host",          "User-Agent",   "Accept",     "Content-Type",
+    "Authorization", "X-Request-Id", "X-Trace-Id", "Cookie"};
+
+// Inline capacity that fits most of the real header values
+constexpr std::size_t kSmallValueSize = 40;
+
 }  // namespace
 
 // We have 120 * 25 = 3000 headers,
@@ -159,4 +169,40 @@ void HeaderMapEraseBenchmark(benchmark::State& state) {
 }
 BENCHMARK(HeaderMapEraseBenchmark);
 
+// std::string keeps up to 15 bytes inline, so every header value of 16+ bytes
+// (ids, content types, user agents) is a separate allocation. The two
+// benchmarks below compare HeaderMap with a vector of SmallString values
+// with a tunable inline capacity, 'entry_bytes' is the per-header footprint.
+void HeaderMapTypicalValuesBenchmark(benchmark::State& state) {
+  const std::string value(state.range(0), 'x');
+
+  for ([[maybe_unused]] auto _ : state) {
+    http::headers::HeaderMap map{};
+    for (const auto name : kTypicalHeaders) map.emplace(name, value);
+    benchmark::DoNotOptimize(map);
+  }
+
+  state.counters["entry_bytes"] =
+      sizeof(std::pair<const std::string, std::string>);
+}
+BENCHMARK(HeaderMapTypicalValuesBenchmark)->Arg(8)->Arg(24)->Arg(40);
+
+void HeaderMapSmallStringValuesBaseline(benchmark::State& state) {
+  const std::string value(state.range(0), 'x');
+
+  using Entry = std::pair<std::string, utils::SmallString<kSmallValueSize>>;
+  for ([[maybe_unused]] auto _ : state) {
+    std::vector<Entry> map;
+    map.reserve(kTypicalHeaders.size());
+    for (const auto name : kTypicalHeaders) {
+      map.emplace_back(std::string{name},
+                       utils::SmallString<kSmallValueSize>{value});
+    }
+    benchmark::DoNotOptimize(map);
+  }
+
+  state.counters["entry_bytes"] = sizeof(Entry);
+}
+BENCHMARK(HeaderMapSmallStringValuesBaseline)->Arg(8)->Arg(24)->Arg(40);
+
 USERVER_NAMESPACE_END
@@ -1,14 +1,174 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <cstring>
 #include <stdexcept>
 
-#include <userver/utils/encoding/hex.hpp>
-
 USERVER_NAMESPACE_BEGIN
 
 namespace http::parser {
 
+namespace {
+
+// Returns the position of the first `first` or `second` byte in `data`
+// starting from `pos`, or data.size() if there are none
+std::size_t FindEither(std::string_view data, std::size_t pos, char first,
+                       char second) noexcept {
+  const auto* const begin = data.data();
+  const auto size = data.size();
+  std::size_t i = pos;
+
+#if defined(__AVX2__)
+  const auto first_vector = _mm256_set1_epi8(first);
+  const auto second_vector = _mm256_set1_epi8(second);
+  for (; i + 32 <= size; i += 32) {
+    const auto chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + i));
+    const auto found = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, first_vector),
+                                       _mm256_cmpeq_epi8(chunk, second_vector));
+    const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(found));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+#elif defined(__SSE2__)
+  const auto first_vector = _mm_set1_epi8(first);
+  const auto second_vector = _mm_set1_epi8(second);
+  const auto find_mask = [&](__m128i chunk) {
+    const auto found = _mm_or_si128(_mm_cmpeq_epi8(chunk, first_vector),
+                                    _mm_cmpeq_epi8(chunk, second_vector));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(found));
+  };
+  // Two vectors per iteration to keep up with the libc memchr on long strings
+  for (; i + 32 <= size; i += 32) {
+    const auto low = find_mask(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i)));
+    const auto high = find_mask(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i + 16)));
+    const auto mask = low | (high << 16);
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+  if (i + 16 <= size) {
+    const auto mask = find_mask(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i)));
+    if (mask != 0) return i + __builtin_ctz(mask);
+    i += 16;
+  }
+  if (i + 8 <= size) {
+    const auto mask = find_mask(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(begin + i))) & 0xff;
+    if (mask != 0) return i + __builtin_ctz(mask);
+    i += 8;
+  }
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+  const auto first_vector = vdupq_n_u8(static_cast<std::uint8_t>(first));
+  const auto second_vector = vdupq_n_u8(static_cast<std::uint8_t>(second));
+  for (; i + 16 <= size; i += 16) {
+    const auto chunk =
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(begin + i));
+    const auto found = vorrq_u8(vceqq_u8(chunk, first_vector),
+                                vceqq_u8(chunk, second_vector));
+    // 4 bits per byte
+    const auto mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(found), 4)), 0);
+    if (mask != 0) return i + __builtin_ctzll(mask) / 4;
+  }
+#endif
+
+  for (; i < size; ++i) {
+    if (begin[i] == first || begin[i] == second) return i;
+  }
+  return size;
+}
+
+constexpr std::array<std::int8_t, 256> MakeXDigitValues() {
+  std::array<std::int8_t, 256> values{};
+  for (auto& value : values) value = -1;
+  for (int c = '0'; c <= '9'; ++c) values[c] = c - '0';
+  for (int c = 'a'; c <= 'f'; ++c) values[c] = c - 'a' + 10;
+  for (int c = 'A'; c <= 'F'; ++c) values[c] = c - 'A' + 10;
+  return values;
+}
+
+constexpr auto kXDigitValues = MakeXDigitValues();
+
+// Returns the byte encoded by the `%XX` sequence at `pos` or -1 if the
+// sequence is invalid
+int DecodePercent(std::string_view data, std::size_t pos) noexcept {
+  if (pos + 2 >= data.size()) return -1;
+  const int high = kXDigitValues[static_cast<unsigned char>(data[pos + 1])];
+  const int low = kXDigitValues[static_cast<unsigned char>(data[pos + 2])];
+  if (high < 0 || low < 0) return -1;
+  return (high << 4) | low;
+}
+
+[[noreturn]] void ThrowInvalidPercentEncoding(std::string_view data,
+                                              std::size_t pos) {
+  static constexpr std::size_t kMaxOutputLength = 100;
+  std::string data_short(data);
+  if (data_short.size() > kMaxOutputLength) {
+    data_short = data_short.substr(0, kMaxOutputLength);
+    data_short += "<...>";
+  }
+  const auto percent_encoded_len =
+      std::min(data.size() - pos, std::size_t{3});
+
+  throw std::runtime_error("invalid percent-encoding sequence '" +
+                           std::string(data.substr(pos, percent_encoded_len)) +
+                           "\' in input '" + std::move(data_short) + '\'');
+}
+
+void ValidatePercentEncoding(std::string_view data) {
+  std::size_t pos = 0;
+  while (pos < data.size()) {
+    const auto* const percent = static_cast<const char*>(
+        std::memchr(data.data() + pos, '%', data.size() - pos));
+    if (!percent) return;
+
+    pos = percent - data.data();
+    if (DecodePercent(data, pos) < 0) ThrowInvalidPercentEncoding(data, pos);
+    pos += 3;
+  }
+}
+
+bool NeedsDecoding(std::string_view data) noexcept {
+  return FindEither(data, 0, '%', '+') != data.size();
+}
+
+// Calls `func` with the raw name and value of every `name=value` argument
+// with a non-empty name, the arguments without '=' are skipped
+template <typename Func>
+void ForEachRawArg(std::string_view args, Func&& func) {
+  std::size_t name_begin = 0;
+  std::size_t name_end = args.size();  // args.size() if no '=' seen
+  std::size_t pos = 0;
+  while (true) {
+    pos = FindEither(args, pos, '&', '=');
+    if (pos == args.size() || args[pos] == '&') {
+      if (name_end != args.size() && name_begin < name_end) {
+        func(args.substr(name_begin, name_end - name_begin),
+             args.substr(name_end + 1, pos - name_end - 1));
+      }
+      if (pos == args.size()) return;
+      name_begin = pos + 1;
+      name_end = args.size();
+    } else if (name_end == args.size()) {
+      name_end = pos;
+    }
+    ++pos;
+  }
+}
+
+}  // namespace
+
 void ParseArgs(std::string_view args,
                std::unordered_map<std::string, std::vector<std::string>,
                                   utils::StrCaseHash>& result) {
@@ -18,71 +178,70 @@ void ParseArgs(std::string_view args,
 }
 
 std::string UrlDecode(std::string_view url) {
-  const auto* data = url.data();
-  const auto* data_end = url.data() + url.size();
-  // Fast path: no %, just id
-  if (!memchr(data, '%', data_end - data) &&
-      !memchr(data, '+', data_end - data)) {
-    return {data, data_end};
-  }
+  // Fast path: no '%' and '+', just id
+  std::size_t pos = FindEither(url, 0, '%', '+');
+  if (pos == url.size()) return std::string{url};
 
-  std::string res;
-  for (const char* ptr = data; ptr < data_end; ++ptr) {
-    if (*ptr == '%') {
-      if (ptr + 2 < data_end &&
-          utils::encoding::FromHex({ptr + 1, 2}, res) == 2) {
-        ptr += 2;
+  // The decoded string is never longer than the encoded one
+  std::string res(url.size(), '\0');
+  char* out = res.data();
+  std::size_t copied = 0;
+  while (pos != url.size()) {
+    std::memcpy(out, url.data() + copied, pos - copied);
+    out += pos - copied;
+
+    // Runs of the encoded chars are decoded without searching
+    do {
+      if (url[pos] == '+') {
+        *out++ = ' ';
+        ++pos;
       } else {
-        static constexpr std::size_t kMaxOutputLength = 100;
-        std::string data_short(data, data_end - data);
-        if (data_short.size() > kMaxOutputLength) {
-          data_short = data_short.substr(0, kMaxOutputLength);
-          data_short += "<...>";
-        }
-        const auto percent_encoded_len =
-            std::min(static_cast<std::size_t>(data_end - ptr), std::size_t{3});
-
-        throw std::runtime_error("invalid percent-encoding sequence '" +
-                                 std::string(ptr, percent_encoded_len) +
-                                 "\' in input '" + std::move(data_short) +
-                                 '\'');
+        const auto decoded = DecodePercent(url, pos);
+        if (decoded < 0) ThrowInvalidPercentEncoding(url, pos);
+        *out++ = static_cast<char>(decoded);
+        pos += 3;
       }
-    } else if (*ptr == '+') {
-      res += ' ';
-    } else {
-      res += *ptr;
-    }
+    } while (pos < url.size() && (url[pos] == '%' || url[pos] == '+'));
+
+    copied = pos;
+    pos = FindEither(url, pos, '%', '+');
   }
+  std::memcpy(out, url.data() + copied, url.size() - copied);
+  out += url.size() - copied;
+  res.resize(out - res.data());
   return res;
 }
 
 void ParseAndConsumeArgs(std::string_view args, ArgsConsumer handler) {
-  const char* end = args.data() + args.size();
-  const char* key_begin = args.data();
-  const char* key_end = args.data();
-  bool parse_key = true;
-  for (const char* ptr = args.data(); ptr <= end; ++ptr) {
-    if (ptr == end || *ptr == '&') {
-      if (!parse_key) {
-        const char* value_begin = key_end + 1;
-        const char* value_end = ptr;
-        if (key_begin < key_end && value_begin <= value_end) {
-          std::string_view key(key_begin, key_end - key_begin);
-          std::string_view value(value_begin, value_end - value_begin);
-          handler(USERVER_NAMESPACE::http::parser::UrlDecode(key),
-                  USERVER_NAMESPACE::http::parser::UrlDecode(value));
-        }
-      }
-      parse_key = true;
-      key_begin = ptr + 1;
-      continue;
-    }
-    if (*ptr == '=' && parse_key) {
-      parse_key = false;
-      key_end = ptr;
-      continue;
+  ForEachRawArg(args, [&handler](std::string_view key, std::string_view value) {
+    handler(UrlDecode(key), UrlDecode(value));
+  });
+}
+
+void ParseAndConsumeArgsByName(std::string_view args, std::string_view name,
+                               ArgsConsumer handler) {
+  ForEachRawArg(args, [name, &handler](std::string_view key,
+                                       std::string_view value) {
+    // The decoded key is never longer than the encoded one
+    if (key.size() < name.size()) return;
+
+    if (!NeedsDecoding(key)) {
+      if (key != name) return;
+      handler(std::string{key}, UrlDecode(value));
+      return;
     }
-  }
+
+    auto decoded_key = UrlDecode(key);
+    if (decoded_key != name) return;
+    handler(std::move(decoded_key), UrlDecode(value));
+  });
+}
+
+void ValidateArgs(std::string_view args) {
+  ForEachRawArg(args, [](std::string_view key, std::string_view value) {
+    ValidatePercentEncoding(key);
+    ValidatePercentEncoding(value);
+  });
 }
 
 }  // namespace http::parser
@@ -1,5 +1,10 @@
 #include <benchmark/benchmark.h>
 
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/http/url.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -40,4 +45,70 @@ void make_query(benchmark::State& state) {
 }
 BENCHMARK(make_query)->RangeMultiplier(2)->Range(1, 256);
 
+namespace {
+
+// `count` arguments like a search request, every fourth value is encoded
+std::string MakeSearchArgs(std::int64_t count) {
+  std::string args;
+  for (std::int64_t i = 0; i < count; ++i) {
+    if (i != 0) args += '&';
+    args += "search_param_" + std::to_string(i) + '=';
+    args += (i % 4 == 0) ? "some+encoded%20value%2C" + std::to_string(i)
+                         : "plain_value_" + std::to_string(i);
+  }
+  return args;
+}
+
+}  // namespace
+
+void url_decode(benchmark::State& state, char filler) {
+  const std::string input(state.range(0), filler);
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(http::parser::UrlDecode(input));
+  }
+}
+BENCHMARK_CAPTURE(url_decode, plain, 'a')->Range(8, 1024);
+BENCHMARK_CAPTURE(url_decode, spaces, '+')->Range(8, 1024);
+
+void url_decode_percent(benchmark::State& state) {
+  std::string input;
+  while (input.size() < static_cast<std::size_t>(state.range(0))) {
+    input += "text%20with%2Cencoded+chars";
+  }
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(http::parser::UrlDecode(input));
+  }
+}
+BENCHMARK(url_decode_percent)->Range(8, 1024);
+
+// Decoding all the arguments up front
+void parse_args_all(benchmark::State& state) {
+  const auto args = MakeSearchArgs(state.range(0));
+  for ([[maybe_unused]] auto _ : state) {
+    std::unordered_map<std::string, std::vector<std::string>,
+                       utils::StrCaseHash>
+        result;
+    http::parser::ParseArgs(args, result);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(parse_args_all)->RangeMultiplier(2)->Range(4, 64);
+
+// Validating the arguments and decoding the two of them that are read
+void parse_args_on_demand(benchmark::State& state) {
+  const auto args = MakeSearchArgs(state.range(0));
+  const auto last_name = "search_param_" + std::to_string(state.range(0) - 1);
+  for ([[maybe_unused]] auto _ : state) {
+    http::parser::ValidateArgs(args);
+    std::vector<std::string> values;
+    const auto consume = [&values](std::string&&, std::string&& value) {
+      values.push_back(std::move(value));
+    };
+    http::parser::ParseAndConsumeArgsByName(args, "search_param_0", consume);
+    http::parser::ParseAndConsumeArgsByName(args, last_name, consume);
+    benchmark::DoNotOptimize(values);
+  }
+}
+BENCHMARK(parse_args_on_demand)->RangeMultiplier(2)->Range(4, 64);
+
 USERVER_NAMESPACE_END
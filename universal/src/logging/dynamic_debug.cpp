@@ -1,6 +1,9 @@
 #include "dynamic_debug.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
+#include <mutex>
 
 #include <fmt/format.h>
 
@@ -18,6 +21,43 @@ LogEntryContentSet& GetAllLocations() noexcept {
   return locations;
 }
 
+// Counts of the live loggers per level, the locations skip the messages below
+// the lowest level of the loggers without calling them
+struct LoggerLevels final {
+  // The locations are destroyed after the levels that use them
+  LoggerLevels() { GetAllLocations(); }
+
+  std::mutex mutex;
+  std::array<std::size_t, kLevelMax + 1> counts{};
+  Level min_level{Level::kNone};
+};
+
+LoggerLevels& GetLoggerLevels() noexcept {
+  static LoggerLevels levels;
+  return levels;
+}
+
+Level GetEntryMinLevel(EntryState state, Level loggers_min_level) noexcept {
+  switch (state) {
+    case EntryState::kForceEnabled:
+      return Level::kTrace;
+    case EntryState::kForceDisabled:
+      return std::max(Level::kWarning, loggers_min_level);
+    case EntryState::kDefault:
+      return loggers_min_level;
+  }
+  return Level::kTrace;
+}
+
+void SetEntryState(LogEntryContent& entry, EntryState state,
+                   Level loggers_min_level) noexcept {
+  entry.state = state;
+  if (entry.min_level) {
+    entry.min_level->store(GetEntryMinLevel(state, loggers_min_level),
+                           std::memory_order_relaxed);
+  }
+}
+
 [[noreturn]] void ThrowUnknownDynamicLogLocation(std::string_view location,
                                                  int line) {
   if (line != kAnyLine) {
@@ -58,14 +98,18 @@ void AddDynamicDebugLog(const std::string& location_relative, int line,
       ThrowUnknownDynamicLogLocation(location_relative, line);
     }
 
-    it_lower->state = state;
+    auto& levels = GetLoggerLevels();
+    const std::lock_guard lock{levels.mutex};
+    SetEntryState(*it_lower, state, levels.min_level);
     return;
   } else {
+    auto& levels = GetLoggerLevels();
+    const std::lock_guard lock{levels.mutex};
     for (; it_lower != all_locations.end(); ++it_lower) {
       if (std::strncmp(it_lower->path, location_relative.c_str(),
                        location_relative.size()) != 0)
         break;
-      it_lower->state = state;
+      SetEntryState(*it_lower, state, levels.min_level);
     }
   }
 }
@@ -79,8 +123,10 @@ void RemoveDynamicDebugLog(const std::string& location_relative, int line) {
       {location_relative.c_str(),
        line != kAnyLine ? line : std::numeric_limits<int>::max()});
 
+  auto& levels = GetLoggerLevels();
+  const std::lock_guard lock{levels.mutex};
   for (; it_lower != it_upper; ++it_lower) {
-    it_lower->state = EntryState::kDefault;
+    SetEntryState(*it_lower, EntryState::kDefault, levels.min_level);
   }
 }
 
@@ -95,6 +141,38 @@ void RegisterLogLocation(LogEntryContent& location) {
   UASSERT(location.path);
   UASSERT(location.line);
   GetAllLocations().insert(location);
+
+  auto& levels = GetLoggerLevels();
+  const std::lock_guard lock{levels.mutex};
+  SetEntryState(location, location.state, levels.min_level);
+}
+
+void OnLoggerLevelChange(std::optional<Level> old_level,
+                         std::optional<Level> new_level) noexcept {
+  if (old_level == new_level) return;
+
+  auto& levels = GetLoggerLevels();
+  const std::lock_guard lock{levels.mutex};
+  if (old_level) {
+    UASSERT(levels.counts[static_cast<int>(*old_level)] > 0);
+    --levels.counts[static_cast<int>(*old_level)];
+  }
+  if (new_level) ++levels.counts[static_cast<int>(*new_level)];
+
+  const auto it = std::find_if(levels.counts.begin(), levels.counts.end(),
+                               [](std::size_t count) { return count > 0; });
+  // Without the loggers nothing is written, but keep the locations enabled for
+  // the loggers created later
+  const auto min_level =
+      it == levels.counts.end()
+          ? Level::kTrace
+          : static_cast<Level>(it - levels.counts.begin());
+  if (min_level == levels.min_level) return;
+
+  levels.min_level = min_level;
+  for (auto& location : GetAllLocations()) {
+    SetEntryState(location, location.state, min_level);
+  }
 }
 
 }  // namespace logging
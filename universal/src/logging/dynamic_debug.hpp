@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 #include <string_view>
 
 #include <boost/intrusive/set.hpp>
@@ -26,12 +27,15 @@ using LogEntryContentHook =
     bi::set_base_hook<bi::optimize_size<true>, bi::link_mode<bi::normal_link>>;
 
 struct LogEntryContent {
-  LogEntryContent(const char* path, int line) noexcept
-      : line(line), path(path) {}
+  LogEntryContent(const char* path, int line,
+                  std::atomic<Level>* min_level = nullptr) noexcept
+      : line(line), path(path), min_level(min_level) {}
 
   std::atomic<EntryState> state{EntryState::kDefault};
   const int line;
   const char* const path;
+  // Level of the StaticLogEntry to skip the messages without the logger call
+  std::atomic<Level>* const min_level;
   LogEntryContentHook hook;
 };
 
@@ -57,6 +61,11 @@ const LogEntryContentSet& GetDynamicDebugLocations();
 
 void RegisterLogLocation(LogEntryContent& location);
 
+// Accounts the level of a logger, std::nullopt for a created or destroyed
+// logger. The log locations skip the levels that no logger writes.
+void OnLoggerLevelChange(std::optional<Level> old_level,
+                         std::optional<Level> new_level) noexcept;
+
 }  // namespace logging
 
 USERVER_NAMESPACE_END
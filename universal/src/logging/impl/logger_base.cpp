@@ -1,14 +1,26 @@
 #include <userver/logging/impl/logger_base.hpp>
 
+#include <logging/dynamic_debug.hpp>
+#include <logging/log_record.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
-LoggerBase::LoggerBase(Format format) noexcept : format_(format) {}
+LoggerBase::LoggerBase(Format format) noexcept : format_(format) {
+  OnLoggerLevelChange(std::nullopt, level_.load());
+}
+
+LoggerBase::~LoggerBase() { OnLoggerLevelChange(level_.load(), std::nullopt); }
 
-LoggerBase::~LoggerBase() = default;
+void LoggerBase::LogRecord(Level level,
+                           std::chrono::system_clock::time_point time,
+                           std::string_view record) {
+  LogBuffer message;
+  FormatLogRecord(message, format_, level, time, record);
+  Log(level, std::string_view{message.data(), message.size()});
+}
 
 void LoggerBase::Flush() {}
 
@@ -16,7 +28,9 @@ void LoggerBase::PrependCommonTags(TagWriter /*writer*/) const {}
 
 Format LoggerBase::GetFormat() const noexcept { return format_; }
 
-void LoggerBase::SetLevel(Level level) { level_ = level; }
+void LoggerBase::SetLevel(Level level) {
+  OnLoggerLevelChange(level_.exchange(level), level);
+}
 
 Level LoggerBase::GetLevel() const noexcept { return level_; }
 
@@ -30,6 +44,14 @@ bool LoggerBase::ShouldFlush(Level level) const {
   return flush_level_ <= level;
 }
 
+void LoggerBase::SetDeferredFormatting(bool enable) noexcept {
+  is_deferred_formatting_ = enable;
+}
+
+bool LoggerBase::IsDeferredFormatting() const noexcept {
+  return is_deferred_formatting_;
+}
+
 bool LoggerBase::DoShouldLog(Level /*level*/) const noexcept { return true; }
 
 bool ShouldLogNoSpan(const LoggerBase& logger, Level level) noexcept {
@@ -31,8 +31,23 @@ void TagWriter::PutLogExtra(const LogExtra& extra) {
   }
 }
 
+void TagWriter::PutLogExtra(const LogExtra& extra,
+                            const LogExtra& overrides) {
+  for (const auto& item : *extra.extra_) {
+    const auto* const overridden =
+        item.second.IsFrozen() ? nullptr : overrides.Find(item.first);
+    const auto& value = overridden ? overridden->second : item.second;
+    PutTag(RuntimeTagKey{item.first}, value.GetValue());
+  }
+  for (const auto& item : *overrides.extra_) {
+    if (!extra.Find(item.first)) {
+      PutTag(RuntimeTagKey{item.first}, item.second.GetValue());
+    }
+  }
+}
+
 void TagWriter::ExtendLogExtra(const LogExtra& extra) {
-  lh_.pimpl_->GetLogExtra().Extend(extra);
+  lh_.pimpl_->AddInheritedLogExtra(extra);
 }
 
 TagWriter::TagWriter(LogHelper& lh) noexcept : lh_(lh) {}
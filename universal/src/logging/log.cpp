@@ -100,13 +100,40 @@ void LogFlush(LoggerRef logger) { logger.Flush(); }
 
 namespace impl {
 
-RateLimiter::RateLimiter(RateLimitData& data, Level level) noexcept
+RateLimiter::RateLimiter(RateLimitData& data, RateLimitLocation& location,
+                         LoggerRef logger, Level level) noexcept
+    : RateLimiter(data, location, &logger, level) {}
+
+RateLimiter::RateLimiter(RateLimitData& data, RateLimitLocation& location,
+                         const LoggerPtr& logger, Level level) noexcept
+    : RateLimiter(data, location, logger.get(), level) {}
+
+RateLimiter::RateLimiter(RateLimitData& data, RateLimitLocation& location,
+                         const LoggerBase* logger, Level level) noexcept
     : level_(level) {
   try {
     if (!impl::IsLogLimitedEnabled()) {
       return;
     }
 
+    const auto buckets_version = impl::GetLogLimitedBucketsVersion();
+    if (buckets_version != 0) {
+      if (location.bucket_version.load(std::memory_order_relaxed) !=
+          buckets_version) {
+        impl::ConfigureLogLimitedBucket(location, logger, buckets_version);
+      }
+
+      if (location.bucket.Obtain()) {
+        dropped_count_ = location.pending_dropped_count.exchange(0);
+      } else {
+        ++location.pending_dropped_count;
+        ++location.total_dropped_count;
+        impl::RegisterDroppingLocation(location);
+        should_log_ = false;
+      }
+      return;
+    }
+
     const auto reset_interval = impl::GetLogLimitedInterval();
     const auto now = std::chrono::steady_clock::now();
 
@@ -121,6 +148,8 @@ RateLimiter::RateLimiter(RateLimitData& data, Level level) noexcept
     } else {
       // drop the current message
       ++data.dropped_count;
+      ++location.total_dropped_count;
+      impl::RegisterDroppingLocation(location);
       should_log_ = false;
     }
   } catch (const std::exception& e) {
@@ -140,7 +169,7 @@ LogHelper& operator<<(LogHelper& lh, const RateLimiter& rl) noexcept {
 StaticLogEntry::StaticLogEntry(const char* path, int line) noexcept {
   static_assert(sizeof(LogEntryContent) == sizeof(content_));
   // static_assert(std::is_trivially_destructible_v<LogEntryContent>);
-  auto* item = new (&content_) LogEntryContent(path, line);
+  auto* item = new (&content_) LogEntryContent(path, line, &min_level_);
   RegisterLogLocation(*item);
 }
 
@@ -190,7 +190,11 @@ void LogHelper::DoLog() noexcept {
     if (pimpl_->IsWithinValue()) {
       pimpl_->MarkValueEnd();
     }
-    GetTagWriter().PutLogExtra(pimpl_->GetLogExtra());
+    if (const auto* const inherited = pimpl_->GetInheritedLogExtra()) {
+      GetTagWriter().PutLogExtra(*inherited, pimpl_->GetLogExtra());
+    } else {
+      GetTagWriter().PutLogExtra(pimpl_->GetLogExtra());
+    }
     pimpl_->PutMessageEnd();
 
     pimpl_->LogTheMessage();
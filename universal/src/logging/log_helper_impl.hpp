@@ -4,8 +4,7 @@
 #include <ostream>
 #include <unordered_set>
 
-#include <fmt/format.h>
-
+#include <logging/log_record.hpp>
 #include <userver/logging/level.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/logging/log_extra.hpp>
@@ -14,9 +13,6 @@ USERVER_NAMESPACE_BEGIN
 
 namespace logging {
 
-inline constexpr std::size_t kInitialLogBufferSize = 1500;
-using LogBuffer = fmt::basic_memory_buffer<char, kInitialLogBufferSize>;
-
 struct LogHelper::InternalTag final {};
 
 class LogHelper::Impl final {
@@ -42,6 +38,12 @@ class LogHelper::Impl final {
 
   LogExtra& GetLogExtra() { return extra_; }
 
+  // The tags that are not copied, e.g. the ones of the current span
+  void AddInheritedLogExtra(const LogExtra& extra);
+  const LogExtra* GetInheritedLogExtra() const noexcept {
+    return inherited_extra_;
+  }
+
   void StartText();
 
   std::size_t GetTextSize() const { return msg_.size() - initial_length_; }
@@ -81,9 +83,14 @@ class LogHelper::Impl final {
   impl::LoggerBase* logger_;
   const Level level_;
   const char key_value_separator_;
+  // The message is written as a binary record, see logging/log_record.hpp
+  const bool is_deferred_;
+  impl::LogTimePoint time_{};
+  std::size_t record_key_position_{0};
   LogBuffer msg_;
   std::optional<LazyInitedStream> lazy_stream_;
   LogExtra extra_;
+  const LogExtra* inherited_extra_{nullptr};
   std::size_t initial_length_{0};
   bool is_within_value_{false};
   std::optional<std::unordered_set<std::string>> debug_tag_keys_;
@@ -0,0 +1,161 @@
+#include <logging/log_record.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <fmt/chrono.h>
+#include <fmt/compile.h>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/encoding/tskv.hpp>
+#include <utils/datetime/cached_time_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging::impl {
+
+namespace {
+
+constexpr std::size_t kTimeStringSize =
+    std::string_view{"0000-00-00T00:00:00"}.size();
+constexpr int kFractionDigits = 6;
+
+using utils::datetime::impl::SystemSecondsTimePoint;
+using CachedTimeString =
+    utils::datetime::impl::CachedTimeString<kTimeStringSize>;
+
+compiler::ThreadLocal local_cached_time = [] { return CachedTimeString{}; };
+
+std::uint32_t FractionalMicroseconds(LogTimePoint time) noexcept {
+  return std::chrono::time_point_cast<std::chrono::microseconds>(time)
+             .time_since_epoch()
+             .count() %
+         1'000'000;
+}
+
+std::size_t RenderTimeString(SystemSecondsTimePoint time, char* out) {
+  const auto* const end = fmt::format_to(
+      out, FMT_COMPILE("{:%FT%T}"),
+      fmt::localtime(std::chrono::system_clock::to_time_t(time)));
+  return static_cast<std::size_t>(end - out);
+}
+
+char* Append(char* out, std::string_view value) noexcept {
+  std::memcpy(out, value.data(), value.size());
+  return out + value.size();
+}
+
+// Puts `<prefix>YYYY-MM-DDTHH:MM:SS.ffffff<level_prefix><LEVEL>`. The date and
+// the time are formatted once per second, only the fraction is formatted for
+// each message.
+void PutTimestampAndLevel(LogBuffer& buffer, std::string_view prefix,
+                          LogTimePoint time, std::string_view level_prefix,
+                          Level level) {
+  const auto level_string = logging::ToUpperCaseString(level);
+  const auto old_size = buffer.size();
+  buffer.resize(old_size + prefix.size() + kTimeStringSize + 1 +
+                kFractionDigits + level_prefix.size() + level_string.size());
+
+  char* out = Append(buffer.data() + old_size, prefix);
+  {
+    auto cached_time = local_cached_time.Use();
+    out = Append(out, cached_time->Get(time, RenderTimeString));
+  }
+  *out++ = '.';
+  out = utils::datetime::impl::WriteFixedDigits<kFractionDigits>(
+      out, FractionalMicroseconds(time));
+  out = Append(out, level_prefix);
+  Append(out, level_string);
+}
+
+struct TagHeader final {
+  std::uint32_t key_size;
+  std::uint32_t value_size;
+  bool key_needs_escaping;
+};
+
+}  // namespace
+
+char GetKeyValueSeparator(Format format) {
+  switch (format) {
+    case Format::kTskv:
+    case Format::kRaw:
+      return '=';
+    case Format::kLtsv:
+      return ':';
+  }
+
+  UINVARIANT(false, "Invalid logging::Format enum value");
+}
+
+void PutMessageBegin(LogBuffer& buffer, Format format, Level level,
+                     LogTimePoint time) {
+  switch (format) {
+    case Format::kTskv:
+      PutTimestampAndLevel(buffer, "tskv\ttimestamp=", time, "\tlevel=", level);
+      return;
+    case Format::kLtsv:
+      PutTimestampAndLevel(buffer, "timestamp:", time, "\tlevel:", level);
+      return;
+    case Format::kRaw: {
+      buffer.append(std::string_view{"tskv"});
+      return;
+    }
+  }
+  UASSERT_MSG(false, "Invalid value of Format enum");
+}
+
+std::size_t PutRecordKey(LogBuffer& record, std::string_view key,
+                         bool key_needs_escaping) {
+  const TagHeader header{static_cast<std::uint32_t>(key.size()), 0,
+                         key_needs_escaping};
+  const auto key_position = record.size();
+  record.resize(key_position + sizeof(header));
+  std::memcpy(record.data() + key_position, &header, sizeof(header));
+  record.append(key);
+  return key_position;
+}
+
+void EndRecordValue(LogBuffer& record, std::size_t key_position) noexcept {
+  UASSERT(key_position + sizeof(TagHeader) <= record.size());
+  TagHeader header{};
+  std::memcpy(&header, record.data() + key_position, sizeof(header));
+  header.value_size = static_cast<std::uint32_t>(
+      record.size() - key_position - sizeof(header) - header.key_size);
+  std::memcpy(record.data() + key_position, &header, sizeof(header));
+}
+
+void FormatLogRecord(LogBuffer& output, Format format, Level level,
+                     LogTimePoint time, std::string_view record) {
+  PutMessageBegin(output, format, level, time);
+  const auto key_value_separator = GetKeyValueSeparator(format);
+
+  while (!record.empty()) {
+    UASSERT(record.size() >= sizeof(TagHeader));
+    TagHeader header{};
+    std::memcpy(&header, record.data(), sizeof(header));
+    record.remove_prefix(sizeof(header));
+
+    const auto key = record.substr(0, header.key_size);
+    const auto value = record.substr(header.key_size, header.value_size);
+    record.remove_prefix(key.size() + value.size());
+
+    output.push_back(utils::encoding::kTskvPairsSeparator);
+    if (header.key_needs_escaping) {
+      utils::encoding::EncodeTskv(
+          output, key, utils::encoding::EncodeTskvMode::kKeyReplacePeriod);
+    } else {
+      output.append(key);
+    }
+    output.push_back(key_value_separator);
+    utils::encoding::EncodeTskv(output, value,
+                                utils::encoding::EncodeTskvMode::kValue);
+  }
+
+  output.push_back('\n');
+}
+
+}  // namespace logging::impl
+
+USERVER_NAMESPACE_END
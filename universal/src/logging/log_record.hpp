@@ -0,0 +1,50 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include <userver/logging/format.hpp>
+#include <userver/logging/level.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace logging {
+
+inline constexpr std::size_t kInitialLogBufferSize = 1500;
+using LogBuffer = fmt::basic_memory_buffer<char, kInitialLogBufferSize>;
+
+namespace impl {
+
+using LogTimePoint = std::chrono::system_clock::time_point;
+
+char GetKeyValueSeparator(Format format);
+
+// Writes the timestamp and the level that start a message in the `format`.
+void PutMessageBegin(LogBuffer& buffer, Format format, Level level,
+                     LogTimePoint time);
+
+// A binary log record is a sequence of tags. Each tag is stored as a fixed-size
+// header followed by the key and the value, the values are not escaped.
+// The record is turned into text by FormatLogRecord, which may be called later
+// on another thread.
+//
+// Puts the tag header and the key, returns the position of the header to pass
+// to EndRecordValue after the value is appended to the buffer.
+std::size_t PutRecordKey(LogBuffer& record, std::string_view key,
+                         bool key_needs_escaping);
+
+void EndRecordValue(LogBuffer& record, std::size_t key_position) noexcept;
+
+// Formats the message with the same output as the one written directly by
+// LogHelper, including the trailing newline.
+void FormatLogRecord(LogBuffer& output, Format format, Level level,
+                     LogTimePoint time, std::string_view record);
+
+}  // namespace impl
+
+}  // namespace logging
+
+USERVER_NAMESPACE_END
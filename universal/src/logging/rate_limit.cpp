@@ -1,6 +1,11 @@
 #include <logging/rate_limit.hpp>
 
 #include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <userver/logging/log.hpp>
+#include <userver/utils/algo.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -21,6 +26,20 @@ std::atomic<bool>& AtomicLogLimited() noexcept {
   return enabled;
 }
 
+struct GlobalBuckets final {
+  std::mutex mutex;
+  std::optional<LogLimitedBuckets> buckets;
+  std::uint64_t last_version{0};
+  std::atomic<std::uint64_t> version{0};
+};
+
+GlobalBuckets& GetGlobalBuckets() noexcept {
+  static GlobalBuckets buckets;
+  return buckets;
+}
+
+std::atomic<RateLimitLocation*> dropping_locations{nullptr};
+
 }  // namespace
 
 void SetLogLimitedEnable(bool enable) noexcept { AtomicLogLimited() = enable; }
@@ -35,6 +54,63 @@ std::chrono::steady_clock::duration GetLogLimitedInterval() noexcept {
   return AtomicLogLimitedDuration().load();
 }
 
+void SetLogLimitedBuckets(std::optional<LogLimitedBuckets> buckets) {
+  auto& global = GetGlobalBuckets();
+  const std::lock_guard lock{global.mutex};
+  const bool is_enabled = buckets.has_value();
+  global.buckets = std::move(buckets);
+  // Locations reconfigure their buckets on the next log after a version change
+  global.version = is_enabled ? ++global.last_version : 0;
+}
+
+std::uint64_t GetLogLimitedBucketsVersion() noexcept {
+  return GetGlobalBuckets().version.load(std::memory_order_relaxed);
+}
+
+void ConfigureLogLimitedBucket(RateLimitLocation& location,
+                               const LoggerBase* logger,
+                               std::uint64_t version) {
+  LogLimitedBucket bucket;
+  {
+    auto& global = GetGlobalBuckets();
+    const std::lock_guard lock{global.mutex};
+    if (!global.buckets || global.version != version) return;
+    bucket = utils::FindOrDefault(global.buckets->loggers, logger,
+                                  global.buckets->defaults);
+  }
+
+  location.bucket.SetRefillPolicy(bucket.refill);
+  location.bucket.SetMaxSize(bucket.burst);
+  location.bucket_version = version;
+}
+
+void RegisterDroppingLocation(RateLimitLocation& location) noexcept {
+  if (location.is_registered.exchange(true)) return;
+
+  auto* head = dropping_locations.load();
+  do {
+    location.next_registered = head;
+  } while (!dropping_locations.compare_exchange_weak(head, &location));
+}
+
+void ForEachDroppingLocation(
+    utils::function_ref<void(RateLimitLocation&)> func) {
+  for (auto* location = dropping_locations.load(); location;
+       location = location->next_registered) {
+    func(*location);
+  }
+}
+
+void LogDroppedSummary() {
+  ForEachDroppingLocation([](RateLimitLocation& location) {
+    const auto dropped = location.pending_dropped_count.exchange(0);
+    if (dropped == 0) return;
+
+    LOG_WARNING() << "LOG_LIMITED at " << location.path << ':'
+                  << location.line << " dropped " << dropped << " logs";
+  });
+}
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
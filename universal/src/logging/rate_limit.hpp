@@ -1,11 +1,21 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include <userver/logging/fwd.hpp>
+#include <userver/utils/function_ref.hpp>
+#include <userver/utils/token_bucket.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace logging::impl {
 
+class RateLimitLocation;
+
 void SetLogLimitedEnable(bool enable) noexcept;
 
 bool IsLogLimitedEnabled() noexcept;
@@ -14,6 +24,36 @@ void SetLogLimitedInterval(std::chrono::steady_clock::duration d) noexcept;
 
 std::chrono::steady_clock::duration GetLogLimitedInterval() noexcept;
 
+struct LogLimitedBucket final {
+  std::size_t burst{1};
+  utils::TokenBucket::RefillPolicy refill;
+};
+
+struct LogLimitedBuckets final {
+  LogLimitedBucket defaults;
+  std::unordered_map<const LoggerBase*, LogLimitedBucket> loggers;
+};
+
+// Makes each LOG_LIMITED location write no more messages than its token bucket
+// allows. std::nullopt brings back the exponential backoff.
+void SetLogLimitedBuckets(std::optional<LogLimitedBuckets> buckets);
+
+// Returns 0 if the token bucket mode is disabled
+std::uint64_t GetLogLimitedBucketsVersion() noexcept;
+
+void ConfigureLogLimitedBucket(RateLimitLocation& location,
+                               const LoggerBase* logger, std::uint64_t version);
+
+// Locations that dropped logs are registered for the summaries and statistics
+void RegisterDroppingLocation(RateLimitLocation& location) noexcept;
+
+void ForEachDroppingLocation(
+    utils::function_ref<void(RateLimitLocation&)> func);
+
+// Writes the count of logs dropped since the last written message for each
+// LOG_LIMITED location to the default logger
+void LogDroppedSummary();
+
 }  // namespace logging::impl
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,98 @@
+#include <userver/utils/arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+// The blocks double in size up to this limit
+constexpr std::size_t kMaxBlockSize = 64 * 1024;
+
+char* AlignUp(char* ptr, std::size_t alignment) noexcept {
+  const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+  const auto aligned = (address + alignment - 1) & ~(alignment - 1);
+  return ptr + (aligned - address);
+}
+
+}  // namespace
+
+struct alignas(std::max_align_t) Arena::Block final {
+  Block* next;
+  std::size_t size;
+};
+
+Arena::Arena(std::size_t block_size) noexcept
+    : next_block_size_(std::max(block_size, sizeof(Block) * 2)) {}
+
+Arena::~Arena() {
+  while (blocks_) {
+    auto* next = blocks_->next;
+    std::free(blocks_);
+    blocks_ = next;
+  }
+}
+
+void* Arena::Allocate(std::size_t size, std::size_t alignment) {
+  UASSERT_MSG(alignment != 0 && (alignment & (alignment - 1)) == 0,
+              "alignment must be a power of two");
+  if (size == 0) size = 1;
+
+  if (current_) {
+    char* result = AlignUp(current_, alignment);
+    if (result <= end_ && static_cast<std::size_t>(end_ - result) >= size) {
+      current_ = result + size;
+      return result;
+    }
+  }
+  return AllocateInNewBlock(size, alignment);
+}
+
+void* Arena::AllocateInNewBlock(std::size_t size, std::size_t alignment) {
+  if (size > static_cast<std::size_t>(-1) - sizeof(Block) - alignment) {
+    throw std::bad_alloc();
+  }
+  const std::size_t required_size = sizeof(Block) + size + alignment;
+  // Allocations that take a big part of a block get a block of their own, so
+  // that the rest of the current block is not wasted
+  const bool is_dedicated = required_size > next_block_size_ / 2;
+  const std::size_t block_size =
+      is_dedicated ? required_size : next_block_size_;
+
+  auto* memory = std::malloc(block_size);
+  if (!memory) throw std::bad_alloc();
+  capacity_ += block_size;
+
+  auto* block = static_cast<Block*>(memory);
+  block->size = block_size;
+  char* const begin = reinterpret_cast<char*>(block + 1);
+  char* const end = reinterpret_cast<char*>(block) + block_size;
+  char* const result = AlignUp(begin, alignment);
+
+  if (is_dedicated && blocks_) {
+    // The current block has more space left, keep allocating from it
+    block->next = blocks_->next;
+    blocks_->next = block;
+    return result;
+  }
+
+  block->next = blocks_;
+  blocks_ = block;
+  current_ = result + size;
+  end_ = end;
+  if (!is_dedicated && next_block_size_ < kMaxBlockSize) {
+    next_block_size_ = std::min(next_block_size_ * 2, kMaxBlockSize);
+  }
+  return result;
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,57 @@
+#include <userver/utils/arena.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Arena, Sample) {
+  /// [Sample Arena]
+  utils::Arena arena;
+
+  using Allocator = utils::ArenaAllocator<std::pair<const std::string, int>>;
+  std::unordered_map<std::string, int, std::hash<std::string>,
+                     std::equal_to<>, Allocator>
+      map{0, std::hash<std::string>{}, std::equal_to<>{}, Allocator{arena}};
+  map["first"] = 1;
+  map["second"] = 2;
+  EXPECT_EQ(map.at("first"), 1);
+  // The nodes and the buckets of the map are freed with the arena
+  /// [Sample Arena]
+  EXPECT_NE(arena.GetCapacity(), 0);
+}
+
+TEST(Arena, Alignment) {
+  utils::Arena arena{64};
+  for (const std::size_t alignment : {1, 2, 4, 8, 16, 64, 256}) {
+    auto* ptr = arena.Allocate(3, alignment);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0)
+        << "alignment=" << alignment;
+  }
+}
+
+TEST(Arena, LargeAllocations) {
+  utils::Arena arena{128};
+  auto* small = static_cast<char*>(arena.Allocate(8, 1));
+  auto* large = static_cast<char*>(arena.Allocate(1024, 8));
+  auto* next_small = static_cast<char*>(arena.Allocate(8, 1));
+
+  // The large allocation does not waste the rest of the current block
+  EXPECT_EQ(next_small, small + 8);
+  for (std::size_t i = 0; i < 1024; ++i) large[i] = 'a';
+  EXPECT_GE(arena.GetCapacity(), 1024 + 128);
+}
+
+TEST(Arena, Vector) {
+  utils::Arena arena{16};
+  std::vector<std::uint64_t, utils::ArenaAllocator<std::uint64_t>> vector{
+      utils::ArenaAllocator<std::uint64_t>{arena}};
+  for (std::uint64_t i = 0; i < 10000; ++i) vector.push_back(i);
+  for (std::uint64_t i = 0; i < 10000; ++i) ASSERT_EQ(vector[i], i);
+}
+
+USERVER_NAMESPACE_END
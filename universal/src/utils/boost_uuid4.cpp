@@ -2,12 +2,10 @@
 
 #include <array>
 
-#include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
-#include <userver/compiler/thread_local.hpp>
-#include <userver/utils/rand.hpp>
+#include <utils/random_bytes.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -101,19 +99,22 @@ boost::uuids::uuid FromChars(const char* begin, const char* end) {
   return u;
 }
 
-compiler::ThreadLocal local_uuid_generator = [] {
-  return WithDefaultRandom([](RandomBase& rng) {
-    return boost::uuids::basic_random_generator<RandomBase>(rng);
-  });
-};
-
 }  // namespace
 
 namespace generators {
 
 boost::uuids::uuid GenerateBoostUuid() {
-  auto generator = local_uuid_generator.Use();
-  return (*generator)();
+  boost::uuids::uuid uuid{};
+  {
+    auto random_bytes = impl::UseLocalRandomBytes();
+    random_bytes->Fill(uuid.data);
+  }
+
+  // version 4 (random)
+  uuid.data[6] = (uuid.data[6] & 0x0F) | 0x40;
+  // variant 10x (RFC 4122)
+  uuid.data[8] = (uuid.data[8] & 0x3F) | 0x80;
+  return uuid;
 }
 
 }  // namespace generators
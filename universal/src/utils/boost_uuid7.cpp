@@ -1,16 +1,13 @@
 #include <userver/utils/boost_uuid7.hpp>
 
 #include <chrono>
-#include <limits>
-
-#include <boost/random/uniform_int.hpp>
-#include <boost/random/variate_generator.hpp>
 
 #include <userver/compiler/thread_local.hpp>
 #include <userver/utils/datetime/wall_coarse_clock.hpp>
-#include <userver/utils/rand.hpp>
 #include <userver/utils/span.hpp>
 
+#include <utils/random_bytes.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -19,13 +16,7 @@ namespace {
 /// https://commitfest.postgresql.org/43/4388/
 class UuidV7Generator {
  public:
-  UuidV7Generator(utils::RandomBase& rng)
-      : random_generator_(&rng,
-                          boost::uniform_int<std::uint64_t>(
-                              std::numeric_limits<std::uint64_t>::min(),
-                              std::numeric_limits<std::uint64_t>::max())) {}
-
-  boost::uuids::uuid operator()() {
+  boost::uuids::uuid operator()(utils::impl::RandomBytes& random_bytes) {
     boost::uuids::uuid uuid{};
     auto current_timestamp = CurrentUnixTimestamp();
 
@@ -46,7 +37,7 @@ class UuidV7Generator {
       current_timestamp = previous_timestamp_;
 
       // Fill var and rand_b with random data
-      GenerateRandomBlock(utils::span<std::uint8_t>(uuid.data).subspan(8));
+      random_bytes.Fill(utils::span<std::uint8_t>(uuid.data).subspan(8));
 
       // Fill rand_a and rand_b with counter data
 
@@ -61,7 +52,7 @@ class UuidV7Generator {
                      static_cast<std::uint8_t>(sequence_counter_ << 4);
     } else {
       // fill ver, rand_a, var and rand_b with random data
-      GenerateRandomBlock(utils::span<std::uint8_t>(uuid.data).subspan(6));
+      random_bytes.Fill(utils::span<std::uint8_t>(uuid.data).subspan(6));
 
       // Keep most significant bit of a counter initialized as zero
       // for guarding against counter rollover.
@@ -95,31 +86,12 @@ class UuidV7Generator {
   }
 
  private:
-  void GenerateRandomBlock(utils::span<std::uint8_t> block) {
-    int i = 0;
-    std::uint64_t random_value = random_generator_();
-
-    for (auto it = block.begin(), end = block.end(); it != end; ++it, ++i) {
-      if (i == sizeof(std::uint64_t)) {
-        random_value = random_generator_();
-        i = 0;
-      }
-
-      *it = static_cast<std::uint8_t>((random_value >> (i * 8)) & 0xFF);
-    }
-  }
-
   static std::uint64_t CurrentUnixTimestamp() {
     return std::chrono::duration_cast<std::chrono::milliseconds>(
                utils::datetime::WallCoarseClock::now().time_since_epoch())
         .count();
   }
 
- private:
-  boost::random::variate_generator<utils::RandomBase*,
-                                   boost::uniform_int<std::uint64_t>>
-      random_generator_;
-
   std::uint32_t sequence_counter_{0};
   std::uint64_t previous_timestamp_{0};
 
@@ -127,15 +99,15 @@ class UuidV7Generator {
 };
 
 compiler::ThreadLocal local_uuid_v7_generator = [] {
-  return utils::WithDefaultRandom(
-      [](utils::RandomBase& rng) { return UuidV7Generator(rng); });
+  return UuidV7Generator{};
 };
 
 }  // namespace
 
 boost::uuids::uuid utils::generators::GenerateBoostUuidV7() {
   auto generator = local_uuid_v7_generator.Use();
-  return (*generator)();
+  auto random_bytes = utils::impl::UseLocalRandomBytes();
+  return (*generator)(*random_bytes);
 }
 
 USERVER_NAMESPACE_END
@@ -1,10 +1,27 @@
 #include <benchmark/benchmark.h>
 
+#include <random>
+
+#include <boost/uuid/random_generator.hpp>
+
 #include <userver/utils/boost_uuid4.hpp>
 #include <userver/utils/boost_uuid7.hpp>
+#include <userver/utils/uuid4.hpp>
+#include <userver/utils/uuid7.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+// The way UUIDv4 used to be generated: a thread-local Mersenne Twister
+// queried for every 4 bytes of the id
+boost::uuids::uuid GenerateBoostUuidMt19937() {
+  thread_local boost::uuids::basic_random_generator<std::mt19937> generator;
+  return generator();
+}
+
+}  // namespace
+
 template <typename UuidGenerator>
 void GenerateUuid(UuidGenerator generator, benchmark::State& state) {
   for ([[maybe_unused]] auto _ : state) {
@@ -13,17 +30,37 @@ void GenerateUuid(UuidGenerator generator, benchmark::State& state) {
       benchmark::ClobberMemory();
     }
   }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
 }
 
 void GenerateUuidV4(benchmark::State& state) {
   GenerateUuid(&utils::generators::GenerateBoostUuid, state);
 }
 
+void GenerateUuidV4Mt19937(benchmark::State& state) {
+  GenerateUuid(&GenerateBoostUuidMt19937, state);
+}
+
 void GenerateUuidV7(benchmark::State& state) {
   GenerateUuid(&utils::generators::GenerateBoostUuidV7, state);
 }
 
+void GenerateUuidV4String(benchmark::State& state) {
+  GenerateUuid(&utils::generators::GenerateUuid, state);
+}
+
+void GenerateUuidV7String(benchmark::State& state) {
+  GenerateUuid(&utils::generators::GenerateUuidV7, state);
+}
+
 BENCHMARK(GenerateUuidV4)->RangeMultiplier(2)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV4Mt19937)->RangeMultiplier(2)->Range(1, 1 << 12);
 BENCHMARK(GenerateUuidV7)->RangeMultiplier(2)->Range(1, 1 << 12);
+BENCHMARK(GenerateUuidV4String)->Arg(1);
+BENCHMARK(GenerateUuidV7String)->Arg(1);
+
+// Thread-local buffers should scale linearly with threads
+BENCHMARK(GenerateUuidV4)->Arg(64)->ThreadRange(1, 8);
+BENCHMARK(GenerateUuidV7)->Arg(64)->ThreadRange(1, 8);
 
 USERVER_NAMESPACE_END
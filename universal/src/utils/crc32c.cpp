@@ -0,0 +1,73 @@
+#include <utils/crc32c.hpp>
+
+#include <array>
+#include <cstring>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+namespace {
+
+// reversed Castagnoli polynomial
+constexpr std::uint32_t kPolynomial = 0x82f63b78;
+
+constexpr std::array<std::uint32_t, 256> MakeTable() {
+  std::array<std::uint32_t, 256> table{};
+  for (std::uint32_t i = 0; i < table.size(); ++i) {
+    std::uint32_t value = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      value = (value >> 1) ^ ((value & 1) ? kPolynomial : 0);
+    }
+    table[i] = value;
+  }
+  return table;
+}
+
+constexpr auto kTable = MakeTable();
+
+std::uint32_t Crc32cSoftware(std::string_view data, std::uint32_t crc) {
+  for (const char c : data) {
+    crc = kTable[(crc ^ static_cast<unsigned char>(c)) & 0xff] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define USERVER_IMPL_CRC32C_HARDWARE
+
+__attribute__((target("sse4.2"))) std::uint32_t Crc32cHardware(
+    std::string_view data, std::uint32_t crc) {
+  std::uint64_t crc64 = crc;
+  while (data.size() >= sizeof(std::uint64_t)) {
+    std::uint64_t word = 0;
+    std::memcpy(&word, data.data(), sizeof(word));
+    crc64 = __builtin_ia32_crc32di(crc64, word);
+    data.remove_prefix(sizeof(word));
+  }
+  crc = static_cast<std::uint32_t>(crc64);
+  for (const char c : data) {
+    crc = __builtin_ia32_crc32qi(crc, static_cast<unsigned char>(c));
+  }
+  return crc;
+}
+
+bool HasHardwareCrc32c() noexcept {
+  static const bool kHasSse42 = __builtin_cpu_supports("sse4.2");
+  return kHasSse42;
+}
+#endif
+
+}  // namespace
+
+std::uint32_t Crc32c(std::string_view data, std::uint32_t crc) noexcept {
+  crc = ~crc;
+#ifdef USERVER_IMPL_CRC32C_HARDWARE
+  if (HasHardwareCrc32c()) return ~Crc32cHardware(data, crc);
+#endif
+  return ~Crc32cSoftware(data, crc);
+}
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils {
+
+/// CRC-32C (Castagnoli) checksum of `data`, hardware-accelerated when the CPU
+/// supports SSE 4.2. Pass the previous result as `crc` to checksum the data
+/// in parts.
+std::uint32_t Crc32c(std::string_view data, std::uint32_t crc = 0) noexcept;
+
+}  // namespace utils
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,26 @@
+#include <utils/crc32c.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+TEST(Crc32c, KnownValues) {
+  EXPECT_EQ(utils::Crc32c(""), 0);
+  EXPECT_EQ(utils::Crc32c("123456789"), 0xe3069283);
+  // RFC 3720, B.4: 32 bytes of zeroes
+  EXPECT_EQ(utils::Crc32c(std::string(32, '\0')), 0x8a9136aa);
+}
+
+TEST(Crc32c, Parts) {
+  const std::string data = "The quick brown fox jumps over the lazy dog";
+  for (std::size_t split = 0; split <= data.size(); ++split) {
+    const std::string_view view = data;
+    EXPECT_EQ(utils::Crc32c(view.substr(split),
+                            utils::Crc32c(view.substr(0, split))),
+              utils::Crc32c(data));
+  }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::datetime::impl {
+
+using SystemSecondsTimePoint =
+    std::chrono::time_point<std::chrono::system_clock, std::chrono::seconds>;
+
+/// @brief The part of a time string that changes once per second, e.g. the
+/// date and the time of a log timestamp, rendered once and reused
+///
+/// Meant to be stored in a compiler::ThreadLocal, one per string format.
+template <std::size_t Capacity>
+class CachedTimeString final {
+ public:
+  /// Returns the string for the second of `time`. If the second differs from
+  /// the cached one, calls `render(seconds_time_point, char* out)`, that must
+  /// write at most `Capacity` chars to `out` and return their count.
+  ///
+  /// The result is invalidated by the next call.
+  template <typename Render>
+  std::string_view Get(std::chrono::system_clock::time_point time,
+                       Render&& render) {
+    const auto seconds =
+        std::chrono::time_point_cast<std::chrono::seconds>(time);
+    if (seconds != seconds_ || size_ == 0) {
+      size_ = render(seconds, static_cast<char*>(data_));
+      UASSERT(size_ <= Capacity);
+      seconds_ = seconds;
+    }
+    return {data_, size_};
+  }
+
+ private:
+  SystemSecondsTimePoint seconds_{};
+  std::size_t size_{0};
+  char data_[Capacity]{};
+};
+
+/// Writes `Digits` decimal digits of `value` with leading zeros, e.g. the
+/// fractional seconds of a timestamp. Returns the end of the written digits.
+template <int Digits>
+constexpr char* WriteFixedDigits(char* out, std::uint32_t value) noexcept {
+  for (int i = Digits - 1; i >= 0; --i) {
+    out[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+  return out + Digits;
+}
+
+}  // namespace utils::datetime::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#include <utils/datetime/cached_time_string.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using CachedTimeString = utils::datetime::impl::CachedTimeString<16>;
+
+}  // namespace
+
+TEST(CachedTimeString, RendersOncePerSecond) {
+  CachedTimeString cache;
+  int renders = 0;
+  const auto render = [&renders](auto seconds, char* out) {
+    ++renders;
+    const auto str = std::to_string(seconds.time_since_epoch().count());
+    str.copy(out, str.size());
+    return str.size();
+  };
+
+  const std::chrono::system_clock::time_point time{std::chrono::seconds{42}};
+  EXPECT_EQ(cache.Get(time, render), "42");
+  EXPECT_EQ(cache.Get(time + std::chrono::milliseconds{999}, render), "42");
+  EXPECT_EQ(renders, 1);
+
+  EXPECT_EQ(cache.Get(time + std::chrono::seconds{1}, render), "43");
+  EXPECT_EQ(renders, 2);
+
+  // the time may go backwards
+  EXPECT_EQ(cache.Get(time, render), "42");
+  EXPECT_EQ(renders, 3);
+}
+
+TEST(CachedTimeString, Epoch) {
+  CachedTimeString cache;
+  const auto render = [](auto, char* out) {
+    out[0] = 'x';
+    return 1;
+  };
+  EXPECT_EQ(cache.Get(std::chrono::system_clock::time_point{}, render), "x");
+}
+
+TEST(CachedTimeString, WriteFixedDigits) {
+  char buffer[6];
+  auto* end = utils::datetime::impl::WriteFixedDigits<6>(buffer, 42);
+  EXPECT_EQ(std::string(buffer, end), "000042");
+
+  end = utils::datetime::impl::WriteFixedDigits<6>(buffer, 999999);
+  EXPECT_EQ(std::string(buffer, end), "999999");
+
+  end = utils::datetime::impl::WriteFixedDigits<3>(buffer, 0);
+  EXPECT_EQ(std::string(buffer, end), "000");
+}
+
+USERVER_NAMESPACE_END
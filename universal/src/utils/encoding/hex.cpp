@@ -1,12 +1,21 @@
 #include <userver/utils/encoding/hex.hpp>
 
+#include <cstdint>
 #include <stdexcept>
 #include <string_view>
 
-#ifdef __SSSE3__
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define USERVER_IMPL_HEX_AVX2
+#include <immintrin.h>
+#elif defined(__SSSE3__)
 #include <tmmintrin.h>
 #endif
 
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define USERVER_IMPL_HEX_NEON
+#include <arm_neon.h>
+#endif
+
 USERVER_NAMESPACE_BEGIN
 
 namespace utils::encoding {
@@ -105,6 +114,166 @@ bool IsXDigit(unsigned char x_digit) noexcept {
   return false;
 }
 
+#ifdef USERVER_IMPL_HEX_AVX2
+#define USERVER_IMPL_AVX2_TARGET __attribute__((target("avx2")))
+
+bool HasAvx2() noexcept {
+  static const bool kHasAvx2 = __builtin_cpu_supports("avx2");
+  return kHasAvx2;
+}
+
+// Converts 16 bytes into 32 hex characters per iteration, returns the count
+// of the converted bytes
+USERVER_IMPL_AVX2_TARGET std::size_t ToHexAvx2(const char* input,
+                                               std::size_t size, char* out) {
+  const auto low_4_bits_mask = _mm_set1_epi8(0xf);
+  const auto digits = _mm256_setr_epi8(
+      '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e',
+      'f', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd',
+      'e', 'f');
+
+  std::size_t i = 0;
+  for (; size - i >= 16; i += 16) {
+    const auto data =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    const auto hi = _mm_and_si128(_mm_srli_epi64(data, 4), low_4_bits_mask);
+    const auto lo = _mm_and_si128(data, low_4_bits_mask);
+    // h4(b0), l4(b0), h4(b1), l4(b1), ... for all the 16 bytes
+    const auto indices = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_unpacklo_epi8(hi, lo)),
+        _mm_unpackhi_epi8(hi, lo), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i * 2),
+                        _mm256_shuffle_epi8(digits, indices));
+  }
+  return i;
+}
+
+// Returns 0xff for the hex characters and 0 for the rest, stores the values
+// of the hex characters into `values`
+USERVER_IMPL_AVX2_TARGET inline __m256i ClassifyXDigitsAvx2(__m256i chars,
+                                                            __m256i& values) {
+  const auto lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+  const auto is_digit =
+      _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)),
+                       _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+  const auto is_alpha =
+      _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                       _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+  values = _mm256_blendv_epi8(
+      _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)),
+      _mm256_sub_epi8(chars, _mm256_set1_epi8('0')), is_digit);
+  return _mm256_or_si256(is_digit, is_alpha);
+}
+
+// Returns the length of the hex prefix, checks 32 characters per iteration
+// and stops at the first block with a non-hex character
+USERVER_IMPL_AVX2_TARGET std::size_t HexPrefixAvx2(const char* encoded,
+                                                   std::size_t size) {
+  std::size_t i = 0;
+  for (; size - i >= 32; i += 32) {
+    const auto chars =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + i));
+    __m256i values;
+    const auto mask = static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(ClassifyXDigitsAvx2(chars, values)));
+    if (mask != 0xffffffff) return i + __builtin_ctz(~mask);
+  }
+  return i;
+}
+
+// Converts 32 hex characters into 16 bytes per iteration, stops at the first
+// block with a non-hex character. Returns the count of the converted
+// characters.
+USERVER_IMPL_AVX2_TARGET std::size_t FromHexAvx2(const char* encoded,
+                                                 std::size_t size, char* out) {
+  // hi * 16 + lo for each pair of the bytes
+  const auto pair_multipliers = _mm256_set1_epi16(0x0110);
+
+  std::size_t i = 0;
+  for (; size - i >= 32; i += 32) {
+    const auto chars =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(encoded + i));
+    __m256i values;
+    const auto valid = ClassifyXDigitsAvx2(chars, values);
+    if (_mm256_movemask_epi8(valid) != -1) break;
+
+    const auto words = _mm256_maddubs_epi16(values, pair_multipliers);
+    // 8 bytes in the low half of each lane, gather them together
+    const auto packed = _mm256_permute4x64_epi64(
+        _mm256_packus_epi16(words, words), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i / 2),
+                     _mm256_castsi256_si128(packed));
+  }
+  return i;
+}
+#endif
+
+#ifdef USERVER_IMPL_HEX_NEON
+// Converts 16 bytes into 32 hex characters per iteration, returns the count
+// of the converted bytes
+std::size_t ToHexNeon(const char* input, std::size_t size, char* out) {
+  const auto digits =
+      vld1q_u8(reinterpret_cast<const std::uint8_t*>(kXdigits.data()));
+  const auto low_4_bits_mask = vdupq_n_u8(0xf);
+
+  std::size_t i = 0;
+  for (; size - i >= 16; i += 16) {
+    const auto data =
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(input + i));
+    const auto hi = vshrq_n_u8(data, 4);
+    const auto lo = vandq_u8(data, low_4_bits_mask);
+    auto* dst = reinterpret_cast<std::uint8_t*>(out + i * 2);
+    vst1q_u8(dst, vqtbl1q_u8(digits, vzip1q_u8(hi, lo)));
+    vst1q_u8(dst + 16, vqtbl1q_u8(digits, vzip2q_u8(hi, lo)));
+  }
+  return i;
+}
+
+// Returns 0xff for the hex characters and 0 for the rest, stores the values
+// of the hex characters into `values`
+inline uint8x16_t ClassifyXDigitsNeon(uint8x16_t chars, uint8x16_t& values) {
+  const auto digit_values = vsubq_u8(chars, vdupq_n_u8('0'));
+  const auto alpha_values =
+      vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  const auto is_digit = vcleq_u8(digit_values, vdupq_n_u8(9));
+  const auto is_alpha = vcleq_u8(alpha_values, vdupq_n_u8(5));
+  values = vbslq_u8(is_digit, digit_values,
+                    vaddq_u8(alpha_values, vdupq_n_u8(10)));
+  return vorrq_u8(is_digit, is_alpha);
+}
+
+// Returns the length of the hex prefix rounded down to 16 characters
+std::size_t HexPrefixNeon(const char* encoded, std::size_t size) {
+  std::size_t i = 0;
+  for (; size - i >= 16; i += 16) {
+    const auto chars =
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(encoded + i));
+    uint8x16_t values;
+    if (vminvq_u8(ClassifyXDigitsNeon(chars, values)) != 0xff) break;
+  }
+  return i;
+}
+
+// Converts 16 hex characters into 8 bytes per iteration, stops at the first
+// block with a non-hex character. Returns the count of the converted
+// characters.
+std::size_t FromHexNeon(const char* encoded, std::size_t size, char* out) {
+  std::size_t i = 0;
+  for (; size - i >= 16; i += 16) {
+    const auto chars =
+        vld1q_u8(reinterpret_cast<const std::uint8_t*>(encoded + i));
+    uint8x16_t values;
+    if (vminvq_u8(ClassifyXDigitsNeon(chars, values)) != 0xff) break;
+
+    const auto hi = vget_low_u8(vuzp1q_u8(values, values));
+    const auto lo = vget_low_u8(vuzp2q_u8(values, values));
+    vst1_u8(reinterpret_cast<std::uint8_t*>(out + i / 2),
+            vorr_u8(vshl_n_u8(hi, 4), lo));
+  }
+  return i;
+}
+#endif
+
 #ifdef __SSSE3__
 const auto kLow4BitsMask = _mm_set1_epi8(0xf);
 const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
@@ -116,6 +285,11 @@ const auto kDigitsMask = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
 std::string_view GetHexPart(std::string_view encoded) noexcept {
   const char* ptr = encoded.data();
   const char* last = ptr + encoded.size();
+#if defined(USERVER_IMPL_HEX_AVX2)
+  if (detail::HasAvx2()) ptr += detail::HexPrefixAvx2(ptr, encoded.size());
+#elif defined(USERVER_IMPL_HEX_NEON)
+  ptr += detail::HexPrefixNeon(ptr, encoded.size());
+#endif
   for (; ptr != last; ptr++) {
     if (!detail::IsXDigit(*ptr)) {
       break;
@@ -138,6 +312,18 @@ void ToHex(std::string_view input, std::string& out) noexcept {
   const auto* last = input.data() + input.size();
   auto* dst = out.data();
 
+#if defined(USERVER_IMPL_HEX_AVX2)
+  if (detail::HasAvx2()) {
+    const auto converted = detail::ToHexAvx2(first, input.size(), dst);
+    first += converted;
+    dst += converted * 2;
+  }
+#elif defined(USERVER_IMPL_HEX_NEON)
+  const auto converted = detail::ToHexNeon(first, input.size(), dst);
+  first += converted;
+  dst += converted * 2;
+#endif
+
 #ifdef __SSSE3__
   while (last - first >= 8) {
     // we only take 8 bytes because each byte transforms into 2 bytes
@@ -186,10 +372,26 @@ bool IsHexData(std::string_view encoded) noexcept {
 }
 
 size_t FromHex(std::string_view encoded, std::string& out) noexcept {
+  const auto old_size = out.size();
+  out.resize(old_size + FromHexUpperBound(encoded.size()));
+  auto* dst = out.data() + old_size;
+
   // we need to read in pairs
   const char* first = encoded.data();
   const char* pair_ptr = first;
   const char* last = first + encoded.size();
+#if defined(USERVER_IMPL_HEX_AVX2)
+  if (detail::HasAvx2()) {
+    const auto converted = detail::FromHexAvx2(first, encoded.size(), dst);
+    pair_ptr += converted;
+    dst += converted / 2;
+  }
+#elif defined(USERVER_IMPL_HEX_NEON)
+  const auto converted = detail::FromHexNeon(first, encoded.size(), dst);
+  pair_ptr += converted;
+  dst += converted / 2;
+#endif
+
   for (; pair_ptr != last; pair_ptr += 2) {
     if (!detail::IsXDigit(pair_ptr[0])) {
       break;
@@ -203,9 +405,10 @@ size_t FromHex(std::string_view encoded, std::string& out) noexcept {
       break;
     }
 
-    out.push_back((detail::GetXDigitValue(pair_ptr[0]) << 4) |
-                  (detail::GetXDigitValue(pair_ptr[1])));
+    *(dst++) = (detail::GetXDigitValue(pair_ptr[0]) << 4) |
+               (detail::GetXDigitValue(pair_ptr[1]));
   }
+  out.resize(dst - out.data());
 
   return static_cast<size_t>(std::distance(first, pair_ptr));
 }
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cctype>
 #include <forward_list>
 #include <string>
 
@@ -138,6 +139,37 @@ TEST(Hex, GetHexPart) {
   }
 }
 
+TEST(Hex, LongRoundTrip) {
+  // Long enough for the vectorized code paths, with a tail after them
+  std::string data;
+  for (int i = 0; i < 1000; ++i) data.push_back(static_cast<char>(i * 37));
+
+  for (std::size_t size : {15, 16, 31, 32, 33, 100, 1000}) {
+    const auto input = std::string_view{data}.substr(0, size);
+    const auto hex = ToHex(input);
+    ASSERT_EQ(LengthInHexForm(input), hex.size());
+    EXPECT_TRUE(IsHexData(hex));
+    EXPECT_EQ(input, FromHex(hex));
+
+    std::string upper = hex;
+    for (auto& c : upper) c = std::toupper(c);
+    EXPECT_EQ(input, FromHex(upper));
+  }
+}
+
+TEST(Hex, LongWrongSymbol) {
+  const auto hex = ToHex(std::string(100, 'x'));
+  for (std::size_t pos : {0, 1, 31, 32, 33, 63, 64, 150, 199}) {
+    std::string data = hex;
+    data[pos] = 'g';
+    EXPECT_EQ(pos / 2 * 2, GetHexPart(data).size()) << pos;
+
+    std::string result;
+    EXPECT_EQ(pos / 2 * 2, FromHex(data, result)) << pos;
+    EXPECT_EQ(std::string(pos / 2, 'x'), result) << pos;
+  }
+}
+
 }  // namespace utils::encoding
 
 USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include <userver/utils/from_string.hpp>
 
@@ -28,4 +29,20 @@ BENCHMARK_TEMPLATE(ConstFromString, std::uint32_t)->DenseRange(1, 10, 1);
 BENCHMARK_TEMPLATE(ConstFromString, std::uint16_t)->DenseRange(1, 5, 1);
 BENCHMARK_TEMPLATE(ConstFromString, double)->DenseRange(1, 10, 1);
 
+template <typename T>
+void FractionalFromString(benchmark::State& state) {
+  const std::vector<std::string> values{
+      "0.1", "-12.625", "3.14159265358979", "6.02214076e23", "1e-7",
+      "1.17549435e-38"};
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& value : values) {
+      benchmark::DoNotOptimize(utils::FromString<T>(value));
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(FractionalFromString, float);
+BENCHMARK_TEMPLATE(FractionalFromString, double);
+
 USERVER_NAMESPACE_END
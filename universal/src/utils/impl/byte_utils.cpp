@@ -4,6 +4,7 @@
 #include <emmintrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <limits>
@@ -101,6 +102,18 @@ struct CaseInsensitiveSSEFetcher final {
     return FailFastCompare(Load16(lhs), Load16(rhs));
   }
 
+  // i-th bit is set if lower-cased lhs[i] and rhs[i] differ
+  static inline std::uint32_t MismatchMask8(const std::uint8_t* lhs,
+                                            const std::uint8_t* rhs) noexcept {
+    return MismatchMask(Load8(lhs), Load8(rhs)) & 0xff;
+  }
+
+  // i-th bit is set if lower-cased lhs[i] and rhs[i] differ
+  static inline std::uint32_t MismatchMask16(const std::uint8_t* lhs,
+                                             const std::uint8_t* rhs) noexcept {
+    return MismatchMask(Load16(lhs), Load16(rhs));
+  }
+
  private:
   static inline __m128i Load8(const std::uint8_t* data) noexcept {
     // _mm_loadu_si64 is missing in gcc prior to version 9
@@ -145,6 +158,12 @@ struct CaseInsensitiveSSEFetcher final {
     return is_zero_vector(lowercase_diff);
   }
 
+  static inline std::uint32_t MismatchMask(__m128i lhs, __m128i rhs) noexcept {
+    const auto equal =
+        _mm_cmpeq_epi8(DoLowercaseBytes(lhs), DoLowercaseBytes(rhs));
+    return ~static_cast<std::uint32_t>(_mm_movemask_epi8(equal)) & 0xffff;
+  }
+
   static inline std::pair<std::uint64_t, std::uint64_t> LowercaseBytes(
       __m128i value) noexcept {
     const auto lowercase = DoLowercaseBytes(value);
@@ -390,6 +409,73 @@ inline bool NoCaseEqual(std::string_view lhs, std::string_view rhs) noexcept {
   return lhs.empty() || CompareAndAdvance<Fetcher, 8>(lhs_suffix, rhs_suffix);
 }
 
+inline int CompareThreeWayNaive(std::string_view lhs,
+                                std::string_view rhs) noexcept {
+  const auto min_len = std::min(lhs.size(), rhs.size());
+  for (std::size_t i = 0; i < min_len; ++i) {
+    unsigned char a = lhs[i];
+    unsigned char b = rhs[i];
+
+    if (a == b) continue;
+    if ('A' <= a && a <= 'Z') a |= 32;
+    if ('A' <= b && b <= 'Z') b |= 32;
+    if (a == b) continue;
+
+    return static_cast<int>(a) - static_cast<int>(b);
+  }
+
+  if (lhs.size() != rhs.size()) return lhs.size() < rhs.size() ? -1 : 1;
+  return 0;
+}
+
+#ifdef __SSE2__
+inline int CompareThreeWaySse(std::string_view lhs,
+                              std::string_view rhs) noexcept {
+  const auto min_len = std::min(lhs.size(), rhs.size());
+  if (min_len < 8) {
+    // we can't do SSE for short strings, so this is actually decently fast.
+    return CompareThreeWayNaive(lhs, rhs);
+  }
+
+  const auto* lhs_data = reinterpret_cast<const std::uint8_t*>(lhs.data());
+  const auto* rhs_data = reinterpret_cast<const std::uint8_t*>(rhs.data());
+  const auto compare_at = [lhs, rhs](std::size_t pos) {
+    return CompareThreeWayNaive(lhs.substr(pos, 1), rhs.substr(pos, 1));
+  };
+
+  // Every block is lower-cased and compared in one go, the position of the
+  // first mismatch comes from the mask. The last block overlaps the previous
+  // one instead of falling back to a byte loop for the leftovers, which is
+  // fine because the overlapping part is already known to be equal.
+  if (min_len >= 16) {
+    std::size_t pos = 0;
+    for (; pos + 16 <= min_len; pos += 16) {
+      const auto mask =
+          CaseInsensitiveSSEFetcher::MismatchMask16(lhs_data + pos,
+                                                    rhs_data + pos);
+      if (mask != 0) return compare_at(pos + __builtin_ctz(mask));
+    }
+    if (pos != min_len) {
+      pos = min_len - 16;
+      const auto mask =
+          CaseInsensitiveSSEFetcher::MismatchMask16(lhs_data + pos,
+                                                    rhs_data + pos);
+      if (mask != 0) return compare_at(pos + __builtin_ctz(mask));
+    }
+  } else {
+    for (const std::size_t pos : {std::size_t{0}, min_len - 8}) {
+      const auto mask =
+          CaseInsensitiveSSEFetcher::MismatchMask8(lhs_data + pos,
+                                                   rhs_data + pos);
+      if (mask != 0) return compare_at(pos + __builtin_ctz(mask));
+    }
+  }
+
+  if (lhs.size() != rhs.size()) return lhs.size() < rhs.size() ? -1 : 1;
+  return 0;
+}
+#endif
+
 }  // namespace
 
 SipHasher::SipHasher(std::uint64_t k0, std::uint64_t k1) noexcept
@@ -436,6 +522,22 @@ bool CaseInsensitiveEqualNoSse::operator()(std::string_view lhs,
   return NoCaseEqual<CaseInsensitiveFetcher>(lhs, rhs);
 }
 
+int CaseInsensitiveCompareThreeWay::operator()(std::string_view lhs,
+                                               std::string_view rhs) const
+    noexcept {
+#ifdef __SSE2__
+  return CompareThreeWaySse(lhs, rhs);
+#else
+  return CaseInsensitiveCompareThreeWayNoSse{}(lhs, rhs);
+#endif
+}
+
+int CaseInsensitiveCompareThreeWayNoSse::operator()(std::string_view lhs,
+                                                    std::string_view rhs) const
+    noexcept {
+  return CompareThreeWayNaive(lhs, rhs);
+}
+
 }  // namespace utils::impl
 
 USERVER_NAMESPACE_END
@@ -57,6 +57,21 @@ class CaseInsensitiveEqualNoSse final {
   bool operator()(std::string_view lhs, std::string_view rhs) const noexcept;
 };
 
+// Lexicographical three-way comparison with uppercase ASCII symbols
+// ('A' - 'Z') being treated as their lowercase counterpart. Returns a negative
+// value, zero or a positive value, the bytes are compared as unsigned.
+class CaseInsensitiveCompareThreeWay final {
+ public:
+  int operator()(std::string_view lhs, std::string_view rhs) const noexcept;
+};
+
+// Same as CaseInsensitiveCompareThreeWay, but doesn't explicitly use SSE2
+// even if it's available.
+class CaseInsensitiveCompareThreeWayNoSse final {
+ public:
+  int operator()(std::string_view lhs, std::string_view rhs) const noexcept;
+};
+
 }  // namespace utils::impl
 
 USERVER_NAMESPACE_END
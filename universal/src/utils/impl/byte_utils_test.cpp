@@ -4,6 +4,7 @@
 #include <cctype>
 #include <cstdint>
 #include <cstring>
+#include <string>
 
 #include <utils/impl/byte_utils.hpp>
 
@@ -366,6 +367,73 @@ void TestCaseInsensitiveEqual() {
   }
 }
 
+int Sign(int value) { return (value > 0) - (value < 0); }
+
+int ReferenceCompareThreeWay(std::string_view lhs, std::string_view rhs) {
+  const auto lowercase = [](std::string_view data) {
+    std::string result{data};
+    for (auto& c : result) {
+      if (c >= 'A' && c <= 'Z') c = 'a' + (c - 'A');
+    }
+    return result;
+  };
+
+  // std::string compares chars as unsigned via char_traits
+  return Sign(lowercase(lhs).compare(lowercase(rhs)));
+}
+
+template <typename Cmp>
+void TestCaseInsensitiveCompareThreeWay() {
+  const Cmp cmp{};
+
+  const auto switch_case = [] {
+    auto all_possible_bytes = kAllPossibleBytesString;
+    for (auto& c : all_possible_bytes) {
+      if (c >= 'a' && c <= 'z') {
+        c = 'A' + (c - 'a');
+      } else if (c >= 'A' && c <= 'Z') {
+        c = 'a' + (c - 'A');
+      }
+    }
+
+    return all_possible_bytes;
+  }();
+
+  // equal up to the case, prefixes compare less
+  for (std::size_t start = 0; start < kAllPossibleBytesString.size();
+       start += 7) {
+    for (std::size_t len = 0; start + len <= kAllPossibleBytesString.size();
+         ++len) {
+      const auto lhs =
+          std::string_view{kAllPossibleBytesString}.substr(start, len);
+      const auto rhs = std::string_view{switch_case}.substr(start, len);
+      ASSERT_EQ(cmp(lhs, rhs), 0);
+      if (len != 0) {
+        ASSERT_LT(cmp(lhs.substr(0, len - 1), rhs), 0);
+        ASSERT_GT(cmp(lhs, rhs.substr(0, len - 1)), 0);
+      }
+    }
+  }
+
+  // a single differing byte at every position, including the ones that
+  // compare differently as signed and unsigned chars
+  for (std::size_t len = 1; len <= 100; ++len) {
+    for (std::size_t diff_at = 0; diff_at < len; ++diff_at) {
+      for (const unsigned char diff : {0x01, 0x20, 0x80, 0xff}) {
+        auto rhs = switch_case.substr(0, len);
+        rhs[diff_at] = static_cast<char>(rhs[diff_at] ^ diff);
+        const auto lhs = std::string_view{kAllPossibleBytesString}.substr(
+            0, len + diff_at % 3);
+
+        ASSERT_EQ(Sign(cmp(lhs, rhs)), ReferenceCompareThreeWay(lhs, rhs))
+            << "len=" << len << ", diff_at=" << diff_at;
+        ASSERT_EQ(Sign(cmp(rhs, lhs)), ReferenceCompareThreeWay(rhs, lhs))
+            << "len=" << len << ", diff_at=" << diff_at;
+      }
+    }
+  }
+}
+
 }  // namespace
 
 TEST(SipHashCase, MatchesReferenceImplementation) {
@@ -390,4 +458,14 @@ TEST(CaseInsensitiveEqualNoSse, Correctness) {
   TestCaseInsensitiveEqual<utils::impl::CaseInsensitiveEqualNoSse>();
 }
 
+TEST(CaseInsensitiveCompareThreeWay, Correctness) {
+  TestCaseInsensitiveCompareThreeWay<
+      utils::impl::CaseInsensitiveCompareThreeWay>();
+}
+
+TEST(CaseInsensitiveCompareThreeWayNoSse, Correctness) {
+  TestCaseInsensitiveCompareThreeWay<
+      utils::impl::CaseInsensitiveCompareThreeWayNoSse>();
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,149 @@
+#include <userver/utils/perfect_hash_map.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+/// [sample]
+constexpr utils::TrivialBiMap kStatuses = [](auto selector) {
+  return selector()
+      .Case("ok", 200)
+      .Case("created", 201)
+      .Case("not-found", 404)
+      .Case("conflict", 409)
+      .Case("internal-server-error", 500)
+      .Case("service-unavailable-for-a-while", 503);
+};
+
+constexpr utils::PerfectHashBiMap<kStatuses> kStatusesHashed;
+/// [sample]
+
+enum class Colors { kRed, kOrange, kYellow, kGreen, kBlue, kViolet };
+enum ThirdPartyColor { kGreen, kBlue, kViolet, kRed, kOrange, kYellow };
+
+constexpr utils::TrivialBiMap kColors = [](auto selector) {
+  return selector()
+      .Case(ThirdPartyColor::kRed, Colors::kRed)
+      .Case(ThirdPartyColor::kOrange, Colors::kOrange)
+      .Case(ThirdPartyColor::kYellow, Colors::kYellow)
+      .Case(ThirdPartyColor::kGreen, Colors::kGreen)
+      .Case(ThirdPartyColor::kBlue, Colors::kBlue)
+      .Case(ThirdPartyColor::kViolet, Colors::kViolet);
+};
+
+constexpr utils::PerfectHashBiMap<kColors> kColorsHashed;
+
+constexpr utils::TrivialBiMap kDuplicates = [](auto selector) {
+  return selector()
+      .Case("a", 1)
+      .Case("b", 2)
+      .Case("a", 3)
+      .Case("c", 1);
+};
+
+constexpr utils::PerfectHashBiMap<kDuplicates> kDuplicatesHashed;
+
+// Only the letters are folded for the case insensitive search, other bytes
+// that differ in the 0x20 bit are distinct keys
+constexpr utils::TrivialBiMap kPunctuation = [](auto selector) {
+  return selector()
+      .Case("[", 1)
+      .Case("{", 2)
+      .Case("@", 3)
+      .Case("`", 4)
+      .Case("a\\b", 5)
+      .Case("a|b", 6)
+      .Case("key[0]-long-enough", 7)
+      .Case("key{0}-long-enough", 8);
+};
+
+constexpr utils::PerfectHashBiMap<kPunctuation> kPunctuationHashed;
+
+constexpr utils::TrivialBiMap kEmpty = [](auto selector) {
+  return selector().Case("", 0);
+};
+
+constexpr utils::PerfectHashBiMap<kEmpty> kEmptyHashed;
+
+}  // namespace
+
+TEST(PerfectHashBiMap, String) {
+  EXPECT_EQ(kStatusesHashed.TryFind("ok"), 200);
+  EXPECT_EQ(kStatusesHashed.TryFind("service-unavailable-for-a-while"), 503);
+  EXPECT_EQ(kStatusesHashed.TryFind(404), "not-found");
+  EXPECT_EQ(kStatusesHashed.TryFind(500), "internal-server-error");
+
+  EXPECT_FALSE(kStatusesHashed.TryFind("o"));
+  EXPECT_FALSE(kStatusesHashed.TryFind("OK"));
+  EXPECT_FALSE(kStatusesHashed.TryFind("service-unavailable-for-a-whil"));
+  EXPECT_FALSE(kStatusesHashed.TryFind(""));
+  EXPECT_FALSE(kStatusesHashed.TryFind(42));
+}
+
+TEST(PerfectHashBiMap, Constexpr) {
+  static_assert(kStatusesHashed.TryFind("created") == 201);
+  static_assert(kStatusesHashed.TryFind(409) == "conflict");
+  static_assert(kStatusesHashed.TryFind("ten") == std::nullopt);
+  static_assert(kStatusesHashed.size() == 6);
+}
+
+TEST(PerfectHashBiMap, ICase) {
+  EXPECT_EQ(kStatusesHashed.TryFindICase("OK"), 200);
+  EXPECT_EQ(kStatusesHashed.TryFindICase("Not-Found"), 404);
+  EXPECT_EQ(kStatusesHashed.TryFindICase("Service-Unavailable-For-A-While"),
+            503);
+  EXPECT_FALSE(kStatusesHashed.TryFindICase("OKAY"));
+  EXPECT_FALSE(kStatusesHashed.TryFindICase("no_-found"));
+}
+
+TEST(PerfectHashBiMap, NonLetters) {
+  EXPECT_EQ(kPunctuationHashed.TryFind("["), 1);
+  EXPECT_EQ(kPunctuationHashed.TryFind("{"), 2);
+  EXPECT_EQ(kPunctuationHashed.TryFind("`"), 4);
+  EXPECT_EQ(kPunctuationHashed.TryFind("a|b"), 6);
+  EXPECT_EQ(kPunctuationHashed.TryFind("key{0}-long-enough"), 8);
+
+  EXPECT_EQ(kPunctuationHashed.TryFindICase("@"), 3);
+  EXPECT_EQ(kPunctuationHashed.TryFindICase("A\\B"), 5);
+  EXPECT_EQ(kPunctuationHashed.TryFindICase("KEY[0]-Long-Enough"), 7);
+  EXPECT_FALSE(kPunctuationHashed.TryFindICase("KEY(0)-Long-Enough"));
+}
+
+TEST(PerfectHashBiMap, Enums) {
+  EXPECT_EQ(kColorsHashed.TryFind(ThirdPartyColor::kRed), Colors::kRed);
+  EXPECT_EQ(kColorsHashed.TryFind(ThirdPartyColor::kViolet), Colors::kViolet);
+  EXPECT_EQ(kColorsHashed.TryFind(Colors::kGreen), ThirdPartyColor::kGreen);
+  EXPECT_FALSE(kColorsHashed.TryFind(static_cast<Colors>(42)));
+}
+
+TEST(PerfectHashBiMap, SameAsTrivialBiMap) {
+  for (const auto [first, second] : kStatuses) {
+    EXPECT_EQ(kStatusesHashed.TryFind(first), kStatuses.TryFind(first));
+    EXPECT_EQ(kStatusesHashed.TryFind(second), kStatuses.TryFind(second));
+  }
+
+  // The first matching Case is found
+  for (const auto [first, second] : kDuplicates) {
+    EXPECT_EQ(kDuplicatesHashed.TryFind(first), kDuplicates.TryFind(first));
+    EXPECT_EQ(kDuplicatesHashed.TryFind(second), kDuplicates.TryFind(second));
+  }
+  EXPECT_EQ(kDuplicatesHashed.TryFind("a"), 1);
+  EXPECT_EQ(kDuplicatesHashed.TryFind(1), "a");
+  EXPECT_EQ(kDuplicatesHashed.TryFind(3), "a");
+
+  EXPECT_EQ(kEmptyHashed.TryFind(""), 0);
+  EXPECT_EQ(kEmptyHashed.TryFind(0), "");
+  EXPECT_FALSE(kEmptyHashed.TryFind(" "));
+}
+
+TEST(PerfectHashBiMap, Describe) {
+  EXPECT_EQ(kDuplicatesHashed.Describe(), kDuplicates.Describe());
+  EXPECT_EQ(kDuplicatesHashed.DescribeFirst(), "'a', 'b', 'a', 'c'");
+  EXPECT_EQ(kDuplicatesHashed.GetValuesByIndex(2).second, 3);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,118 @@
+#include <utils/random_bytes.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+namespace {
+
+// "expand 32-byte k"
+constexpr std::uint32_t kSigma[4] = {0x61707865, 0x3320646e, 0x79622d32,
+                                     0x6b206574};
+
+constexpr int kDoubleRounds = 10;
+
+// Word `i` of all the kChaChaLanes blocks. GCC and Clang compile operations on
+// the vector type into SIMD instructions of the target, falling back to
+// several narrower registers when the vector is wider than they are.
+using Lanes = std::uint32_t
+    __attribute__((vector_size(sizeof(std::uint32_t) * kChaChaLanes)));
+
+inline Lanes RotateLeft(Lanes value, int shift) noexcept {
+  return (value << shift) | (value >> (32 - shift));
+}
+
+inline void QuarterRound(Lanes& a, Lanes& b, Lanes& c, Lanes& d) noexcept {
+  a += b;
+  d = RotateLeft(d ^ a, 16);
+  c += d;
+  b = RotateLeft(b ^ c, 12);
+  a += b;
+  d = RotateLeft(d ^ a, 8);
+  c += d;
+  b = RotateLeft(b ^ c, 7);
+}
+
+compiler::ThreadLocal local_random_bytes = [] { return RandomBytes{}; };
+
+}  // namespace
+
+void ChaCha20Blocks(ChaChaState& state, ChaChaBlocks& out) noexcept {
+  Lanes initial[kChaChaWords];
+  for (std::size_t word = 0; word < kChaChaWords; ++word) {
+    for (std::size_t i = 0; i < kChaChaLanes; ++i) {
+      initial[word][i] = state[word];
+    }
+  }
+  for (std::size_t i = 0; i < kChaChaLanes; ++i) initial[12][i] += i;
+
+  Lanes x[kChaChaWords];
+  std::copy(std::begin(initial), std::end(initial), std::begin(x));
+  for (int round = 0; round < kDoubleRounds; ++round) {
+    QuarterRound(x[0], x[4], x[8], x[12]);
+    QuarterRound(x[1], x[5], x[9], x[13]);
+    QuarterRound(x[2], x[6], x[10], x[14]);
+    QuarterRound(x[3], x[7], x[11], x[15]);
+    QuarterRound(x[0], x[5], x[10], x[15]);
+    QuarterRound(x[1], x[6], x[11], x[12]);
+    QuarterRound(x[2], x[7], x[8], x[13]);
+    QuarterRound(x[3], x[4], x[9], x[14]);
+  }
+  for (std::size_t word = 0; word < kChaChaWords; ++word) {
+    x[word] += initial[word];
+  }
+
+  static_assert(sizeof(x) == sizeof(out));
+  std::memcpy(out, x, sizeof(out));
+
+  state[12] += kChaChaLanes;
+}
+
+RandomBytes::RandomBytes() { Reseed(); }
+
+void RandomBytes::Fill(utils::span<std::uint8_t> out) {
+  auto* dest = out.data();
+  std::size_t size = out.size();
+  while (size != 0) {
+    if (position_ == sizeof(buffer_)) Refill();
+
+    const auto chunk = std::min(size, sizeof(buffer_) - position_);
+    const auto* source = reinterpret_cast<const std::uint8_t*>(buffer_);
+    std::memcpy(dest, source + position_, chunk);
+    position_ += chunk;
+    dest += chunk;
+    size -= chunk;
+  }
+}
+
+void RandomBytes::Reseed() {
+  std::random_device device;
+  std::copy(std::begin(kSigma), std::end(kSigma), state_.begin());
+  // 256-bit key
+  for (int word = 4; word < 12; ++word) state_[word] = device();
+  state_[12] = 0;
+  // 96-bit nonce
+  for (int word = 13; word < 16; ++word) state_[word] = device();
+}
+
+void RandomBytes::Refill() {
+  // The block counter must not wrap around for the same key and nonce
+  if (state_[12] > std::numeric_limits<std::uint32_t>::max() - kChaChaLanes) {
+    Reseed();
+  }
+  ChaCha20Blocks(state_, buffer_);
+  position_ = 0;
+}
+
+compiler::ThreadLocalScope<RandomBytes> UseLocalRandomBytes() {
+  return local_random_bytes.Use();
+}
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
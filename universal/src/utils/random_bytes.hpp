@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <userver/compiler/thread_local.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace utils::impl {
+
+inline constexpr std::size_t kChaChaWords = 16;
+
+/// Number of ChaCha20 blocks computed together, one per 32-bit lane of a
+/// 128-bit SIMD register that every x86-64 and aarch64 CPU has
+inline constexpr std::size_t kChaChaLanes = 4;
+
+using ChaChaState = std::array<std::uint32_t, kChaChaWords>;
+
+/// Words of kChaChaLanes blocks: `[word][lane]`
+using ChaChaBlocks = std::uint32_t[kChaChaWords][kChaChaLanes];
+
+/// Computes kChaChaLanes consecutive ChaCha20 blocks (RFC 8439) starting from
+/// the block counter in `state[12]`, writes them to `out` and advances the
+/// counter.
+///
+/// The blocks are interleaved word by word as they are in SIMD registers,
+/// which is fine for random bytes and avoids a costly transposition.
+void ChaCha20Blocks(ChaChaState& state, ChaChaBlocks& out) noexcept;
+
+/// @brief Buffered stream of cryptographically secure random bytes
+///
+/// ChaCha20 keystream with a key and a nonce from std::random_device. Bytes
+/// are generated kChaChaLanes blocks at a time and handed out from the buffer.
+class RandomBytes final {
+ public:
+  RandomBytes();
+
+  RandomBytes(const RandomBytes&) = delete;
+  RandomBytes& operator=(const RandomBytes&) = delete;
+
+  void Fill(utils::span<std::uint8_t> out);
+
+  template <std::size_t N>
+  std::array<std::uint8_t, N> Get() {
+    std::array<std::uint8_t, N> result;
+    Fill(result);
+    return result;
+  }
+
+ private:
+  void Reseed();
+  void Refill();
+
+  ChaChaState state_{};
+  alignas(64) ChaChaBlocks buffer_{};
+  std::size_t position_{sizeof(buffer_)};
+};
+
+/// Thread-local RandomBytes, see utils::WithDefaultRandom for the restrictions
+compiler::ThreadLocalScope<RandomBytes> UseLocalRandomBytes();
+
+}  // namespace utils::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,95 @@
+#include <utils/random_bytes.hpp>
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <userver/utils/encoding/hex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// RFC 8439, 2.3.2
+utils::impl::ChaChaState MakeRfcState() {
+  utils::impl::ChaChaState state{0x61707865, 0x3320646e, 0x79622d32,
+                                 0x6b206574};
+  for (std::uint32_t i = 0; i < 8; ++i) {
+    state[4 + i] = (4 * i) | ((4 * i + 1) << 8) | ((4 * i + 2) << 16) |
+                   ((4 * i + 3) << 24);
+  }
+  state[12] = 1;
+  state[13] = 0x09000000;
+  state[14] = 0x4a000000;
+  state[15] = 0x00000000;
+  return state;
+}
+
+// Serialized block as in RFC 8439
+std::string SerializeBlock(const utils::impl::ChaChaBlocks& blocks,
+                           std::size_t lane) {
+  std::string result;
+  for (std::size_t word = 0; word < utils::impl::kChaChaWords; ++word) {
+    for (int byte = 0; byte < 4; ++byte) {
+      result += static_cast<char>(blocks[word][lane] >> (byte * 8));
+    }
+  }
+  return utils::encoding::ToHex(result);
+}
+
+}  // namespace
+
+TEST(ChaCha20, RfcTestVector) {
+  auto state = MakeRfcState();
+  utils::impl::ChaChaBlocks blocks;
+  utils::impl::ChaCha20Blocks(state, blocks);
+
+  EXPECT_EQ(SerializeBlock(blocks, 0),
+            "10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e"
+            "d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e");
+  EXPECT_EQ(state[12], 1 + utils::impl::kChaChaLanes);
+}
+
+TEST(ChaCha20, LanesAreConsecutiveBlocks) {
+  auto state = MakeRfcState();
+  utils::impl::ChaChaBlocks blocks;
+  utils::impl::ChaCha20Blocks(state, blocks);
+
+  for (std::size_t lane = 1; lane < utils::impl::kChaChaLanes; ++lane) {
+    auto lane_state = MakeRfcState();
+    lane_state[12] += lane;
+    utils::impl::ChaChaBlocks lane_blocks;
+    utils::impl::ChaCha20Blocks(lane_state, lane_blocks);
+
+    EXPECT_EQ(SerializeBlock(blocks, lane), SerializeBlock(lane_blocks, 0))
+        << "lane " << lane;
+  }
+}
+
+TEST(RandomBytes, Fill) {
+  utils::impl::RandomBytes random_bytes;
+
+  // Chunks that cross the buffer boundaries
+  std::set<std::vector<std::uint8_t>> chunks;
+  for (int i = 0; i < 100; ++i) {
+    std::vector<std::uint8_t> chunk(37);
+    random_bytes.Fill(chunk);
+    EXPECT_TRUE(chunks.insert(std::move(chunk)).second);
+  }
+
+  std::vector<std::uint8_t> large(10000);
+  random_bytes.Fill(large);
+  EXPECT_TRUE(std::any_of(large.begin(), large.end(),
+                          [](std::uint8_t byte) { return byte != 0; }));
+}
+
+TEST(RandomBytes, DifferentSeeds) {
+  utils::impl::RandomBytes first;
+  utils::impl::RandomBytes second;
+  EXPECT_NE(first.Get<32>(), second.Get<32>());
+}
+
+USERVER_NAMESPACE_END
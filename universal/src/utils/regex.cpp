@@ -1,43 +1,244 @@
 #include <userver/utils/regex.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <boost/regex.hpp>
+#include <fmt/format.h>
+
+#ifdef USERVER_FEATURE_RE2_ENABLED
+#include <re2/re2.h>
+#include <re2/set.h>
+#else
+namespace re2 {
+class RE2;
+}  // namespace re2
+#endif
 
 USERVER_NAMESPACE_BEGIN
 
 namespace utils {
 
+namespace {
+
+#ifdef USERVER_FEATURE_RE2_ENABLED
+re2::RE2::Options MakeRe2Options() {
+  re2::RE2::Options options;
+  // errors are reported via exceptions instead
+  options.set_log_errors(false);
+  return options;
+}
+
+re2::StringPiece ToStringPiece(std::string_view str) noexcept {
+  return {str.data(), str.size()};
+}
+#endif
+
+void ThrowIfUnavailable(RegexEngine engine) {
+  if (!IsRegexEngineAvailable(engine)) {
+    throw std::runtime_error(
+        "RegexEngine::kRe2 is requested, but userver was built without "
+        "USERVER_FEATURE_RE2");
+  }
+}
+
+std::shared_ptr<const re2::RE2> CompileRe2(
+    [[maybe_unused]] std::string_view pattern) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  auto result = std::make_shared<const re2::RE2>(ToStringPiece(pattern),
+                                                 MakeRe2Options());
+  if (!result->ok()) {
+    throw std::runtime_error(
+        fmt::format("Invalid regex '{}': {}", pattern, result->error()));
+  }
+  return result;
+#else
+  ThrowIfUnavailable(RegexEngine::kRe2);
+  return {};
+#endif
+}
+
+}  // namespace
+
+bool IsRegexEngineAvailable(RegexEngine engine) noexcept {
+  switch (engine) {
+    case RegexEngine::kBoost:
+      return true;
+    case RegexEngine::kRe2:
+#ifdef USERVER_FEATURE_RE2_ENABLED
+      return true;
+#else
+      return false;
+#endif
+  }
+
+  return false;
+}
+
 struct regex::Impl {
   boost::regex r;
+  std::shared_ptr<const re2::RE2> re2;
+  RegexEngine engine{RegexEngine::kBoost};
 
   Impl() = default;
   explicit Impl(std::string_view pattern) : r(pattern.begin(), pattern.end()) {}
+  Impl(std::string_view pattern, RegexEngine engine) : engine(engine) {
+    if (engine == RegexEngine::kRe2) {
+      re2 = CompileRe2(pattern);
+    } else {
+      r.assign(pattern.begin(), pattern.end());
+    }
+  }
+
+  void Swap(Impl& other) noexcept {
+    r.swap(other.r);
+    re2.swap(other.re2);
+    std::swap(engine, other.engine);
+  }
 };
 
 regex::regex() = default;
 
 regex::regex(std::string_view pattern) : impl_(regex::Impl(pattern)) {}
 
+regex::regex(std::string_view pattern, RegexEngine engine)
+    : impl_(pattern, engine) {}
+
 regex::~regex() = default;
 
 regex::regex(const regex&) = default;
 
-regex::regex(regex&& r) noexcept { impl_->r.swap(r.impl_->r); }
+regex::regex(regex&& r) noexcept { impl_->Swap(*r.impl_); }
 
 regex& regex::operator=(const regex&) = default;
 
 regex& regex::operator=(regex&& r) noexcept {
-  impl_->r.swap(r.impl_->r);
+  impl_->Swap(*r.impl_);
   return *this;
 }
 
+RegexEngine regex::GetEngine() const noexcept { return impl_->engine; }
+
 bool regex_match(std::string_view str, const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (pattern.impl_->engine == RegexEngine::kRe2) {
+    return re2::RE2::FullMatch(ToStringPiece(str), *pattern.impl_->re2);
+  }
+#endif
   return boost::regex_match(str.begin(), str.end(), pattern.impl_->r);
 }
 
 bool regex_search(std::string_view str, const regex& pattern) {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (pattern.impl_->engine == RegexEngine::kRe2) {
+    return re2::RE2::PartialMatch(ToStringPiece(str), *pattern.impl_->re2);
+  }
+#endif
   return boost::regex_search(str.begin(), str.end(), pattern.impl_->r);
 }
 
+struct RegexSet::Impl {
+  RegexSet::Mode mode;
+  RegexEngine engine;
+  std::size_t size;
+  std::vector<boost::regex> boost_regexes;
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  std::unique_ptr<re2::RE2::Set> re2_set;
+#endif
+
+  Impl(const std::vector<std::string>& patterns, RegexSet::Mode mode,
+       RegexEngine engine);
+  ~Impl();
+
+  bool BoostMatches(std::string_view str, std::size_t index) const {
+    const auto& r = boost_regexes[index];
+    return mode == RegexSet::Mode::kMatch
+               ? boost::regex_match(str.begin(), str.end(), r)
+               : boost::regex_search(str.begin(), str.end(), r);
+  }
+};
+
+RegexSet::Impl::Impl(const std::vector<std::string>& patterns,
+                     RegexSet::Mode mode, RegexEngine engine)
+    : mode(mode), engine(engine), size(patterns.size()) {
+  ThrowIfUnavailable(engine);
+
+  if (engine == RegexEngine::kBoost) {
+    boost_regexes.reserve(patterns.size());
+    for (const auto& pattern : patterns) {
+      boost_regexes.emplace_back(pattern);
+    }
+    return;
+  }
+
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  re2_set = std::make_unique<re2::RE2::Set>(
+      MakeRe2Options(), mode == RegexSet::Mode::kMatch
+                            ? re2::RE2::ANCHOR_BOTH
+                            : re2::RE2::UNANCHORED);
+  for (const auto& pattern : patterns) {
+    std::string error;
+    if (re2_set->Add(ToStringPiece(pattern), &error) < 0) {
+      throw std::runtime_error(
+          fmt::format("Invalid regex '{}': {}", pattern, error));
+    }
+  }
+  if (!re2_set->Compile()) {
+    throw std::runtime_error("Failed to compile RegexSet: out of memory");
+  }
+#endif
+}
+
+RegexSet::Impl::~Impl() = default;
+
+RegexSet::RegexSet(const std::vector<std::string>& patterns, Mode mode,
+                   RegexEngine engine)
+    : impl_(std::make_shared<const Impl>(patterns, mode, engine)) {}
+
+RegexSet::~RegexSet() = default;
+
+RegexSet::RegexSet(const RegexSet&) = default;
+
+RegexSet::RegexSet(RegexSet&&) noexcept = default;
+
+RegexSet& RegexSet::operator=(const RegexSet&) = default;
+
+RegexSet& RegexSet::operator=(RegexSet&&) noexcept = default;
+
+std::vector<std::size_t> RegexSet::Match(std::string_view str) const {
+  std::vector<std::size_t> result;
+
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (impl_->engine == RegexEngine::kRe2) {
+    std::vector<int> matches;
+    impl_->re2_set->Match(ToStringPiece(str), &matches);
+    result.assign(matches.begin(), matches.end());
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+#endif
+
+  for (std::size_t i = 0; i < impl_->size; ++i) {
+    if (impl_->BoostMatches(str, i)) result.push_back(i);
+  }
+  return result;
+}
+
+bool RegexSet::MatchAny(std::string_view str) const {
+#ifdef USERVER_FEATURE_RE2_ENABLED
+  if (impl_->engine == RegexEngine::kRe2) {
+    return impl_->re2_set->Match(ToStringPiece(str), nullptr);
+  }
+#endif
+
+  for (std::size_t i = 0; i < impl_->size; ++i) {
+    if (impl_->BoostMatches(str, i)) return true;
+  }
+  return false;
+}
+
+std::size_t RegexSet::Size() const noexcept { return impl_->size; }
+
 }  // namespace utils
 
 USERVER_NAMESPACE_END
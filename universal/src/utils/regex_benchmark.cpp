@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <exception>
+#include <string>
+#include <vector>
+
+#include <userver/utils/regex.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::string_view kUuidPattern =
+    "[0-9a-f]{8}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{4}-[0-9a-f]{12}";
+
+const std::vector<std::string> kRoutingRules = [] {
+  std::vector<std::string> result;
+  for (int i = 0; i < 32; ++i) {
+    const auto version = std::to_string(i);
+    result.push_back("/v" + version + "/users/[0-9]+/profile");
+    result.push_back("/v" + version + "/orders/[a-z0-9-]+(/items)?");
+  }
+  result.push_back("/internal/.*");
+  return result;
+}();
+
+constexpr utils::RegexEngine kEngines[] = {utils::RegexEngine::kBoost,
+                                           utils::RegexEngine::kRe2};
+
+bool SkipIfUnavailable(benchmark::State& state, utils::RegexEngine engine) {
+  if (!utils::IsRegexEngineAvailable(engine)) {
+    state.SkipWithError("Regex engine is not available in this build");
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+void RegexMatchUuid(benchmark::State& state) {
+  const auto engine = kEngines[state.range(0)];
+  if (SkipIfUnavailable(state, engine)) return;
+
+  const utils::regex r(kUuidPattern, engine);
+  const std::string input = "8a1d4f6e-52b7-4c55-9e7c-a0b3c2d1e0f9";
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::regex_match(input, r));
+  }
+}
+BENCHMARK(RegexMatchUuid)->DenseRange(0, 1);
+
+void RegexSearchLongText(benchmark::State& state) {
+  const auto engine = kEngines[state.range(0)];
+  if (SkipIfUnavailable(state, engine)) return;
+
+  const utils::regex r(kUuidPattern, engine);
+  const auto input = std::string(state.range(1), 'x') +
+                     "8a1d4f6e-52b7-4c55-9e7c-a0b3c2d1e0f9";
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(utils::regex_search(input, r));
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(RegexSearchLongText)->ArgsProduct({{0, 1}, {64, 4096}});
+
+// (a+)+b backtracks exponentially on a string of 'a' without 'b', boost
+// gives up with an exception on longer inputs
+void RegexPathological(benchmark::State& state) {
+  const auto engine = kEngines[state.range(0)];
+  if (SkipIfUnavailable(state, engine)) return;
+
+  const utils::regex r("(a+)+b", engine);
+  const std::string input(state.range(1), 'a');
+
+  for ([[maybe_unused]] auto _ : state) {
+    try {
+      benchmark::DoNotOptimize(utils::regex_match(input, r));
+    } catch (const std::exception& e) {
+      state.SkipWithError(e.what());
+      break;
+    }
+  }
+}
+BENCHMARK(RegexPathological)->ArgsProduct({{0, 1}, {8, 16, 20}});
+
+// Routing rules: one by one vs a single RegexSet
+void RegexRoutingRulesLoop(benchmark::State& state) {
+  const auto engine = kEngines[state.range(0)];
+  if (SkipIfUnavailable(state, engine)) return;
+
+  std::vector<utils::regex> rules;
+  rules.reserve(kRoutingRules.size());
+  for (const auto& rule : kRoutingRules) rules.emplace_back(rule, engine);
+  const std::string path = "/internal/ping";
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto& rule : rules) {
+      if (utils::regex_match(path, rule)) {
+        benchmark::DoNotOptimize(&rule);
+        break;
+      }
+    }
+  }
+}
+BENCHMARK(RegexRoutingRulesLoop)->DenseRange(0, 1);
+
+void RegexRoutingRulesSet(benchmark::State& state) {
+  const auto engine = kEngines[state.range(0)];
+  if (SkipIfUnavailable(state, engine)) return;
+
+  const utils::RegexSet rules(kRoutingRules, utils::RegexSet::Mode::kMatch,
+                              engine);
+  const std::string path = "/internal/ping";
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(rules.Match(path));
+  }
+}
+BENCHMARK(RegexRoutingRulesSet)->DenseRange(0, 1);
+
+USERVER_NAMESPACE_END
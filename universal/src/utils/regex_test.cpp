@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include <userver/utils/regex.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -35,4 +39,101 @@ TEST(Regex, Search) {
   EXPECT_TRUE(utils::regex_search("a123a", r));
 }
 
+namespace {
+
+class RegexEngineTest : public ::testing::TestWithParam<utils::RegexEngine> {
+ protected:
+  void SetUp() override {
+    if (!utils::IsRegexEngineAvailable(GetParam())) {
+      GTEST_SKIP() << "Regex engine is not available in this build";
+    }
+  }
+};
+
+}  // namespace
+
+INSTANTIATE_TEST_SUITE_P(/*no prefix*/, RegexEngineTest,
+                         ::testing::Values(utils::RegexEngine::kBoost,
+                                           utils::RegexEngine::kRe2));
+
+TEST_P(RegexEngineTest, MatchAndSearch) {
+  const utils::regex r("^[a-z][0-9]+", GetParam());
+  EXPECT_EQ(r.GetEngine(), GetParam());
+
+  EXPECT_FALSE(utils::regex_match({}, r));
+  EXPECT_FALSE(utils::regex_match("a", r));
+  EXPECT_TRUE(utils::regex_match("a123", r));
+  EXPECT_FALSE(utils::regex_match("a123a", r));
+
+  EXPECT_FALSE(utils::regex_search("123", r));
+  EXPECT_TRUE(utils::regex_search("a123a", r));
+}
+
+TEST_P(RegexEngineTest, CopyAndMove) {
+  utils::regex r1("ab+c", GetParam());
+  utils::regex r2(r1);
+  utils::regex r3(std::move(r1));
+  utils::regex r4;
+  r4 = std::move(r3);
+
+  EXPECT_EQ(r4.GetEngine(), GetParam());
+  EXPECT_TRUE(utils::regex_match("abbc", r2));
+  EXPECT_TRUE(utils::regex_match("abbc", r4));
+}
+
+TEST_P(RegexEngineTest, Invalid) {
+  EXPECT_ANY_THROW(utils::regex("a(b", GetParam()));
+}
+
+TEST_P(RegexEngineTest, Set) {
+  const std::vector<std::string> patterns{"/v1/.*", "/v[0-9]/users", "users$",
+                                          "admin"};
+
+  const utils::RegexSet match_set(patterns, utils::RegexSet::Mode::kMatch,
+                                  GetParam());
+  EXPECT_EQ(match_set.Size(), 4);
+  EXPECT_EQ(match_set.Match("/v1/users"), (std::vector<std::size_t>{0, 1}));
+  EXPECT_EQ(match_set.Match("/v2/users"), (std::vector<std::size_t>{1}));
+  EXPECT_TRUE(match_set.Match("/v2/admin").empty());
+  EXPECT_TRUE(match_set.MatchAny("/v1/admin"));
+  EXPECT_FALSE(match_set.MatchAny("/v2/admin"));
+
+  const utils::RegexSet search_set(patterns, utils::RegexSet::Mode::kSearch,
+                                   GetParam());
+  EXPECT_EQ(search_set.Match("/v1/users"),
+            (std::vector<std::size_t>{0, 1, 2}));
+  EXPECT_EQ(search_set.Match("/v2/admin"), (std::vector<std::size_t>{3}));
+  EXPECT_FALSE(search_set.MatchAny("/v2/none"));
+
+  const auto copy = search_set;
+  EXPECT_EQ(copy.Match("/v2/admin"), (std::vector<std::size_t>{3}));
+
+  EXPECT_ANY_THROW(utils::RegexSet({"a(b"}, utils::RegexSet::Mode::kMatch,
+                                   GetParam()));
+}
+
+TEST(Regex, Re2LinearTime) {
+  if (!utils::IsRegexEngineAvailable(utils::RegexEngine::kRe2)) {
+    GTEST_SKIP() << "RE2 is not available in this build";
+  }
+
+  // Catastrophic backtracking for backtracking engines
+  const utils::regex r("(a+)+$", utils::RegexEngine::kRe2);
+  const auto input = std::string(100'000, 'a') + 'b';
+  EXPECT_FALSE(utils::regex_search(input, r));
+  EXPECT_FALSE(utils::regex_match(input, r));
+  EXPECT_TRUE(utils::regex_search(input.substr(0, input.size() - 1), r));
+}
+
+TEST(Regex, Re2Unavailable) {
+  if (utils::IsRegexEngineAvailable(utils::RegexEngine::kRe2)) {
+    GTEST_SKIP() << "RE2 is available in this build";
+  }
+
+  EXPECT_THROW(utils::regex("a", utils::RegexEngine::kRe2), std::runtime_error);
+  EXPECT_THROW(utils::RegexSet({"a"}, utils::RegexSet::Mode::kMatch,
+                               utils::RegexEngine::kRe2),
+               std::runtime_error);
+}
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <vector>
 
 #include <userver/utils/rand.hpp>
@@ -116,7 +117,48 @@ void CaseInsensitiveCompareDifferentStrings(benchmark::State& state) {
   }
 }
 
+void CaseInsensitiveCompareThreeWayEqualStrings(benchmark::State& state) {
+  const auto len = state.range(0);
+
+  const auto first = GenerateRandomString(len);
+  auto second = std::string{first};
+  for (auto& c : second) c ^= 32;  // switch the case of every letter
+  const auto cmp = utils::StrIcaseCompareThreeWay{};
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (std::size_t i = 0; i < 20; ++i) {
+      benchmark::DoNotOptimize(cmp(first, second));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * 20 * len);
+}
+
+void CaseInsensitiveLessSort(benchmark::State& state) {
+  const auto count = state.range(0);
+
+  // header-like keys with a common prefix
+  std::vector<std::string> keys;
+  keys.reserve(count);
+  for (std::int64_t i = 0; i < count; ++i) {
+    keys.push_back("X-YaTaxi-" + GenerateRandomString(16));
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    state.PauseTiming();
+    auto copy = keys;
+    state.ResumeTiming();
+
+    std::sort(copy.begin(), copy.end(), utils::StrIcaseLess{});
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
 BENCHMARK(CaseInsensitiveCompareEqualStrings)->DenseRange(1, 31, 3);
+BENCHMARK(CaseInsensitiveCompareThreeWayEqualStrings)
+    ->DenseRange(1, 31, 3)
+    ->Arg(64)
+    ->Arg(256);
+BENCHMARK(CaseInsensitiveLessSort)->Arg(32)->Arg(1024);
 BENCHMARK_TEMPLATE(CaseInsensitiveCompareDifferentStrings, 31)
     ->DenseRange(1, 31, 3);
 BENCHMARK_TEMPLATE(CaseInsensitiveCompareDifferentStrings, 15)
@@ -1,6 +1,12 @@
 #include <userver/utils/text_light.hpp>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <unordered_map>
@@ -197,6 +203,30 @@ size_t FindTruncatedEndingCorrectSize(std::string_view str) {
   return str.size();
 }
 
+// Returns the count of the leading ASCII bytes
+std::size_t CountAsciiPrefix(const unsigned char* bytes,
+                             std::size_t length) noexcept {
+  std::size_t i = 0;
+#ifdef __SSE2__
+  for (; i + 16 <= length; i += 16) {
+    const auto block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+    // the high bits of the bytes
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(block));
+    if (mask != 0) return i + __builtin_ctz(mask);
+  }
+#else
+  constexpr std::uint64_t kHighBits = 0x8080808080808080;
+  for (; i + 8 <= length; i += 8) {
+    std::uint64_t block{};
+    std::memcpy(&block, bytes + i, 8);
+    if (block & kHighBits) break;
+  }
+#endif
+  while (i < length && bytes[i] < 0x80) ++i;
+  return i;
+}
+
 }  // namespace
 
 unsigned CodePointLengthByFirstByte(unsigned char c) noexcept {
@@ -238,15 +268,15 @@ bool IsWellFormedCodePoint(const unsigned char* bytes,
 }
 
 bool IsValid(const unsigned char* bytes, std::size_t length) noexcept {
-  for (size_t i = 0; i < length; ++i) {
-    if (!IsWellFormedCodePoint(bytes + i, length - i)) {
-      return false;
-    } else {
-      i += CodePointLengthByFirstByte(bytes[i]) - 1;
-    }
+  std::size_t i = 0;
+  while (true) {
+    // the runs of ASCII are skipped in blocks
+    i += CountAsciiPrefix(bytes + i, length - i);
+    if (i == length) return true;
+
+    if (!IsWellFormedCodePoint(bytes + i, length - i)) return false;
+    i += CodePointLengthByFirstByte(bytes[i]);
   }
-
-  return true;
 }
 
 std::size_t GetCodePointsCount(std::string_view text) {
@@ -226,6 +226,20 @@ TEST(TestIsUtf8, IsUtf8) {
   EXPECT_FALSE(utils::text::IsUtf8("\xe0\x9f\x80"));
 }
 
+TEST(TestIsUtf8, LongText) {
+  const std::string ascii(37, 'a');
+  const std::string cyrillic = "\u041c\u043e\u0441\u043a\u0432\u0430";
+  const std::string emoji = "\xf0\x9f\x98\x80";
+
+  EXPECT_TRUE(utils::text::IsUtf8(ascii));
+  EXPECT_TRUE(utils::text::IsUtf8(ascii + cyrillic + ascii + emoji));
+  EXPECT_TRUE(utils::text::IsUtf8(emoji + ascii + ascii + cyrillic));
+
+  EXPECT_FALSE(utils::text::IsUtf8(ascii + "\xa0" + ascii));
+  EXPECT_FALSE(utils::text::IsUtf8(ascii + ascii + "\xc3"));
+  EXPECT_FALSE(utils::text::IsUtf8(ascii + emoji.substr(0, 3) + ascii));
+}
+
 TEST(TestTrimUtf8Truncated, TrimTruncatedEnding) {
   auto test_trim = [](std::string test_str, const std::string expected) {
     auto test_str_orig = test_str;
@@ -1,11 +1,13 @@
 #include <userver/utils/trivial_map.hpp>
 
+#include <array>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
 
 #include <benchmark/benchmark.h>
 
+#include <userver/utils/perfect_hash_map.hpp>
 #include <utils/gbench_auxilary.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -109,6 +111,49 @@ constexpr int kHugeTrivialBiMapValues[] = {
 constexpr auto kHugeTrivialBiMapAlt =
     utils::MakeTrivialBiMap<kHugeTrivialBiMapKeys, kHugeTrivialBiMapValues>();
 
+constexpr utils::PerfectHashBiMap<kHugeTrivialBiMap> kHugePerfectHashBiMap;
+
+// Keys of equal length, like HTTP header names or error codes:
+// "x-header-000", "x-header-001", ..., "x-header-255"
+constexpr std::size_t kSameLengthCount = 256;
+constexpr std::string_view kSameLengthPrefix = "x-header-";
+constexpr std::size_t kSameLengthKeySize = kSameLengthPrefix.size() + 3;
+
+constexpr auto kSameLengthChars = [] {
+  std::array<char, kSameLengthCount * kSameLengthKeySize> result{};
+  for (std::size_t i = 0; i < kSameLengthCount; ++i) {
+    char* key = result.data() + i * kSameLengthKeySize;
+    for (const char c : kSameLengthPrefix) *key++ = c;
+    *key++ = static_cast<char>('0' + i / 100);
+    *key++ = static_cast<char>('0' + i / 10 % 10);
+    *key++ = static_cast<char>('0' + i % 10);
+  }
+  return result;
+}();
+
+constexpr auto kSameLengthKeys = [] {
+  std::array<std::string_view, kSameLengthCount> result{};
+  for (std::size_t i = 0; i < kSameLengthCount; ++i) {
+    result[i] = std::string_view{
+        kSameLengthChars.data() + i * kSameLengthKeySize, kSameLengthKeySize};
+  }
+  return result;
+}();
+
+constexpr auto kSameLengthValues = [] {
+  std::array<int, kSameLengthCount> result{};
+  for (std::size_t i = 0; i < kSameLengthCount; ++i) {
+    result[i] = static_cast<int>(i);
+  }
+  return result;
+}();
+
+constexpr auto kSameLengthTrivialBiMap =
+    utils::MakeTrivialBiMap<kSameLengthKeys, kSameLengthValues>();
+
+constexpr utils::PerfectHashBiMap<kSameLengthTrivialBiMap>
+    kSameLengthPerfectHashBiMap;
+
 const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_hello", 1}, {"aaaaaaaaaaaaaaaa_world", 2},
     {"aaaaaaaaaaaaaaaa_a", 3},     {"aaaaaaaaaaaaaaaa_b", 4},
@@ -400,6 +445,35 @@ void MappingHugeTrivialBiMapZip(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeTrivialBiMapZip);
 
+void MappingHugePerfectHashBiMap(benchmark::State& state) {
+  auto hello = MyLaunder("aaaaaaaaaaaaaaaa_hello");
+  auto world = MyLaunder("aaaaaaaaaaaaaaaa_world");
+  auto a = MyLaunder("aaaaaaaaaaaaaaaa_a");
+  auto b = MyLaunder("aaaaaaaaaaaaaaaa_b");
+  auto c = MyLaunder("aaaaaaaaaaaaaaaa_c");
+
+  auto d = MyLaunder("aaaaaaaaaaaaaaaa_d");
+  auto e = MyLaunder("aaaaaaaaaaaaaaaa_e");
+  auto f9 = MyLaunder("aaaaaaaaaaaaaaaa_f9");
+  auto z = MyLaunder("aaaaaaaaaaaaaaaa_z");
+  auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(hello));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(world));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(a));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(b));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(c));
+
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(d));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(e));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(f9));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(z));
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(z9));
+  }
+}
+BENCHMARK(MappingHugePerfectHashBiMap);
+
 void MappingHugeUnordered(benchmark::State& state) {
   auto hello = MyLaunder("aaaaaaaaaaaaaaaa_hello");
   auto world = MyLaunder("aaaaaaaaaaaaaaaa_world");
@@ -438,6 +512,39 @@ void MappingHugeTrivialBiMapLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeTrivialBiMapLast);
 
+void MappingHugePerfectHashBiMapLast(benchmark::State& state) {
+  auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kHugePerfectHashBiMap.TryFind(z9));
+  }
+}
+BENCHMARK(MappingHugePerfectHashBiMapLast);
+
+template <typename Map>
+void MappingSameLength(benchmark::State& state, const Map& map) {
+  std::array<std::string_view, 8> keys{};
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = MyLaunder(kSameLengthKeys[i * 31]);
+  }
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto key : keys) {
+      benchmark::DoNotOptimize(map.TryFind(key));
+    }
+  }
+}
+
+void MappingSameLengthTrivialBiMap(benchmark::State& state) {
+  MappingSameLength(state, kSameLengthTrivialBiMap);
+}
+BENCHMARK(MappingSameLengthTrivialBiMap);
+
+void MappingSameLengthPerfectHashBiMap(benchmark::State& state) {
+  MappingSameLength(state, kSameLengthPerfectHashBiMap);
+}
+BENCHMARK(MappingSameLengthPerfectHashBiMap);
+
 void MappingHugeUnorderedLast(benchmark::State& state) {
   auto z9 = MyLaunder("aaaaaaaaaaaaaaaa_z9");
 
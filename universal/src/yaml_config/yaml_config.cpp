@@ -26,6 +26,21 @@ std::string GetSubstitutionVarName(const formats::yaml::Value& value) {
   return value.As<std::string>().substr(1);
 }
 
+// YAML mappings are searched linearly, a config with hundreds of components
+// would scan all the config_vars for each `$var` otherwise
+auto MakeConfigVarsIndex(const formats::yaml::Value& config_vars) {
+  using Index = std::unordered_map<std::string, formats::yaml::Value>;
+  if (!config_vars.IsObject()) return std::shared_ptr<const Index>{};
+
+  Index index;
+  index.reserve(config_vars.GetSize());
+  for (auto it = config_vars.begin(); it != config_vars.end(); ++it) {
+    index.emplace(it.GetName(), *it);
+  }
+  return std::shared_ptr<const Index>{
+      std::make_shared<Index>(std::move(index))};
+}
+
 std::string GetFallbackName(std::string_view str) {
   return std::string{str} + "#fallback";
 }
@@ -78,8 +93,26 @@ YamlConfig::YamlConfig(formats::yaml::Value yaml,
                        formats::yaml::Value config_vars, Mode mode)
     : yaml_(std::move(yaml)),
       config_vars_(std::move(config_vars)),
+      config_vars_index_(MakeConfigVarsIndex(config_vars_)),
       mode_(mode) {}
 
+YamlConfig YamlConfig::MakeChild(formats::yaml::Value yaml, Mode mode) const {
+  YamlConfig result;
+  result.yaml_ = std::move(yaml);
+  result.config_vars_ = config_vars_;
+  result.config_vars_index_ = config_vars_index_;
+  result.mode_ = mode;
+  return result;
+}
+
+formats::yaml::Value YamlConfig::GetConfigVar(const std::string& name) const {
+  if (!config_vars_index_) return config_vars_[name];
+
+  const auto it = config_vars_index_->find(name);
+  if (it == config_vars_index_->end()) return config_vars_[name];
+  return it->second;
+}
+
 const formats::yaml::Value& YamlConfig::Yaml() const { return yaml_; }
 
 YamlConfig YamlConfig::operator[](std::string_view key) const {
@@ -99,7 +132,7 @@ YamlConfig YamlConfig::operator[](std::string_view key) const {
   if (IsSubstitution(value)) {
     const auto var_name = GetSubstitutionVarName(value);
 
-    auto var_data = config_vars_[var_name];
+    auto var_data = GetConfigVar(var_name);
     if (!var_data.IsMissing()) {
       // Strip substitutions off to disallow nested substitutions
       return YamlConfig{std::move(var_data), {}, Mode::kSecure};
@@ -130,7 +163,7 @@ YamlConfig YamlConfig::operator[](std::string_view key) const {
     }
   }
 
-  return YamlConfig{std::move(value), config_vars_, mode_};
+  return MakeChild(std::move(value), mode_);
 }
 
 YamlConfig YamlConfig::operator[](size_t index) const {
@@ -139,7 +172,7 @@ YamlConfig YamlConfig::operator[](size_t index) const {
   if (IsSubstitution(value)) {
     const auto var_name = GetSubstitutionVarName(value);
 
-    auto var_data = config_vars_[var_name];
+    auto var_data = GetConfigVar(var_name);
     if (!var_data.IsMissing()) {
       // Strip substitutions off to disallow nested substitutions
       return YamlConfig{std::move(var_data), {}, Mode::kSecure};
@@ -149,7 +182,7 @@ YamlConfig YamlConfig::operator[](size_t index) const {
     return MakeMissingConfig(*this, index);
   }
 
-  return {std::move(value), config_vars_};
+  return MakeChild(std::move(value), Mode::kSecure);
 }
 
 std::size_t YamlConfig::GetSize() const { return yaml_.GetSize(); }